@@ -0,0 +1,163 @@
+/**
+ * @file bench_graph.c
+ * @brief Micro-benchmarks de grafos (graph.h, graph_algorithms.h)
+ *
+ * Grafo não-direcionado aleatório com n vértices, um anel (conexo) e mais
+ * 3n arestas de peso uniforme em [1, 100]: grau médio 8. ns/op = tempo por
+ * arco armazenado (2 por aresta), comparável entre lista e CSR.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "bench_harness.h"
+#include "data_structures/graph.h"
+#include "algorithms/graph_algorithms.h"
+#include <stdlib.h>
+
+typedef struct {
+    Graph *graph;
+    CSRGraph *csr;
+    size_t arcs;
+} GraphState;
+
+static void teardown(void *state) {
+    GraphState *st = state;
+    graph_csr_destroy(st->csr);
+    graph_destroy(st->graph);
+    free(st);
+}
+
+static void* setup(size_t n) {
+    GraphState *st = calloc(1, sizeof(GraphState));
+    if (st == NULL) {
+        return NULL;
+    }
+    st->graph = graph_create(n, GRAPH_UNDIRECTED, GRAPH_ADJACENCY_LIST, true);
+    if (st->graph == NULL) {
+        teardown(st);
+        return NULL;
+    }
+
+    uint64_t seed = 0x6AA9ULL;
+    for (size_t v = 0; v < n; v++) {
+        double w = 1.0 + (double)(bench_random(&seed) % 100);
+        graph_add_edge(st->graph, v, (v + 1) % n, w);
+    }
+    for (size_t e = 0; e < 3 * n; e++) {
+        Vertex a = (Vertex)(bench_random(&seed) % n);
+        Vertex b = (Vertex)(bench_random(&seed) % n);
+        double w = 1.0 + (double)(bench_random(&seed) % 100);
+        if (a != b) {
+            graph_add_edge(st->graph, a, b, w);
+        }
+    }
+
+    st->csr = graph_freeze(st->graph);
+    if (st->csr == NULL) {
+        teardown(st);
+        return NULL;
+    }
+    st->arcs = graph_csr_num_edges(st->csr);
+    return st;
+}
+
+static void count_visit(Vertex v, void *user_data) {
+    *(uint64_t *)user_data += v;
+}
+
+static size_t run_graph_bfs(void *state) {
+    GraphState *st = state;
+    uint64_t sum = 0;
+    graph_bfs(st->graph, 0, count_visit, &sum);
+    bench_consume(sum);
+    return st->arcs;
+}
+
+static size_t run_bfs_csr(void *state) {
+    GraphState *st = state;
+    BFSResult *r = bfs_csr(st->csr, 0, 1);
+    bench_consume(r != NULL ? r->num_reached : 0);
+    bfs_free(r);
+    return st->arcs;
+}
+
+static size_t consume_paths(GraphState *st, ShortestPathResult *r) {
+    bench_consume(r != NULL ? (uint64_t)r->dist[r->num_vertices - 1] : 0);
+    shortest_path_free(r);
+    return st->arcs;
+}
+
+static size_t run_dijkstra(void *state) {
+    GraphState *st = state;
+    return consume_paths(st, dijkstra(st->graph, 0));
+}
+
+static size_t run_dijkstra_csr(void *state) {
+    GraphState *st = state;
+    return consume_paths(st, dijkstra_csr(st->csr, 0));
+}
+
+static size_t run_spfa_csr(void *state) {
+    GraphState *st = state;
+    return consume_paths(st, bellman_ford_spfa_csr(st->csr, 0));
+}
+
+static size_t run_delta_stepping_csr(void *state) {
+    GraphState *st = state;
+    return consume_paths(st, delta_stepping_csr(st->csr, 0, 25.0, 1));
+}
+
+static size_t consume_mst(GraphState *st, MSTResult *r) {
+    bench_consume(r != NULL ? (uint64_t)r->total_weight : 0);
+    mst_free(r);
+    return st->arcs;
+}
+
+static size_t run_kruskal_csr(void *state) {
+    GraphState *st = state;
+    return consume_mst(st, kruskal_csr(st->csr));
+}
+
+static size_t run_filter_kruskal_csr(void *state) {
+    GraphState *st = state;
+    return consume_mst(st, filter_kruskal_csr(st->csr));
+}
+
+static size_t run_prim_csr(void *state) {
+    GraphState *st = state;
+    return consume_mst(st, prim_csr(st->csr));
+}
+
+static size_t run_boruvka_csr(void *state) {
+    GraphState *st = state;
+    return consume_mst(st, boruvka_csr(st->csr, 1));
+}
+
+static size_t run_freeze(void *state) {
+    GraphState *st = state;
+    CSRGraph *csr = graph_freeze(st->graph);
+    bench_consume(csr != NULL ? graph_csr_num_edges(csr) : 0);
+    graph_csr_destroy(csr);
+    return st->arcs;
+}
+
+static const BenchCase CASES[] = {
+    {"freeze",                setup, NULL, run_freeze,             teardown},
+    {"bfs/list",              setup, NULL, run_graph_bfs,          teardown},
+    {"bfs/csr",               setup, NULL, run_bfs_csr,            teardown},
+    {"dijkstra/list",         setup, NULL, run_dijkstra,           teardown},
+    {"dijkstra/csr",          setup, NULL, run_dijkstra_csr,       teardown},
+    {"spfa/csr",              setup, NULL, run_spfa_csr,           teardown},
+    {"delta_stepping/csr",    setup, NULL, run_delta_stepping_csr, teardown},
+    {"kruskal/csr",           setup, NULL, run_kruskal_csr,        teardown},
+    {"filter_kruskal/csr",    setup, NULL, run_filter_kruskal_csr, teardown},
+    {"prim/csr",              setup, NULL, run_prim_csr,           teardown},
+    {"boruvka/csr",           setup, NULL, run_boruvka_csr,        teardown},
+};
+
+int main(int argc, char **argv) {
+    static const size_t sizes[] = {1000, 100000, 1000000};
+    return bench_main(argc, argv, "graph", CASES, sizeof(CASES) / sizeof(CASES[0]),
+                      sizes, sizeof(sizes) / sizeof(sizes[0]));
+}
@@ -0,0 +1,341 @@
+/**
+ * @file bench_harness.c
+ * @brief Execução, estatísticas e saída dos micro-benchmarks
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+// clock_gettime/CLOCK_MONOTONIC (POSIX) com CMAKE_C_EXTENSIONS OFF
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "bench_harness.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+/** Repetições medidas sem --reps */
+#define BENCH_DEFAULT_REPS 11
+
+/** Execuções de aquecimento sem --warmup */
+#define BENCH_DEFAULT_WARMUP 2
+
+/** Tamanhos aceitos em --sizes */
+#define BENCH_MAX_SIZES 32
+
+typedef enum {
+    BENCH_FORMAT_TEXT,
+    BENCH_FORMAT_CSV,
+    BENCH_FORMAT_JSON
+} BenchFormat;
+
+typedef struct {
+    size_t warmup;
+    size_t repetitions;
+    size_t sizes[BENCH_MAX_SIZES];
+    size_t num_sizes;
+    BenchFormat format;
+    const char *filter;
+    FILE *out;
+    size_t emitted;        // resultados já escritos (vírgulas do JSON)
+} BenchOptions;
+
+static volatile uint64_t bench_sink;
+
+// ============================================================================
+// UTILITÁRIOS
+// ============================================================================
+
+uint64_t bench_now_ns(void) {
+    struct timespec ts;
+#if defined(CLOCK_MONOTONIC)
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+        return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+    }
+#endif
+    if (timespec_get(&ts, TIME_UTC) == 0) {
+        return 0;
+    }
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void bench_consume(uint64_t value) {
+    bench_sink ^= value;
+}
+
+uint64_t bench_random(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+static int compare_ns(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Percentil pelo posto mais próximo sobre samples ordenado
+static double percentile(const double *samples, size_t count, double p) {
+    size_t rank = (size_t)ceil(p / 100.0 * (double)count);
+    if (rank == 0) {
+        rank = 1;
+    }
+    return samples[rank - 1];
+}
+
+static void summarize(BenchResult *result, double *samples, size_t count) {
+    qsort(samples, count, sizeof(double), compare_ns);
+
+    double sum = 0.0;
+    for (size_t i = 0; i < count; i++) {
+        sum += samples[i];
+    }
+    result->repetitions = count;
+    result->min_ns = samples[0];
+    result->max_ns = samples[count - 1];
+    result->mean_ns = sum / (double)count;
+    result->median_ns = (count % 2 == 1)
+        ? samples[count / 2]
+        : 0.5 * (samples[count / 2 - 1] + samples[count / 2]);
+    result->p90_ns = percentile(samples, count, 90.0);
+    result->p99_ns = percentile(samples, count, 99.0);
+    result->ops_per_sec = (result->median_ns > 0.0) ? 1e9 / result->median_ns : 0.0;
+}
+
+// ============================================================================
+// SAÍDA
+// ============================================================================
+
+static void emit_begin(BenchOptions *opts, const char *suite) {
+    switch (opts->format) {
+        case BENCH_FORMAT_TEXT:
+            fprintf(opts->out, "=== %s (warmup %zu, reps %zu) ===\n",
+                    suite, opts->warmup, opts->repetitions);
+            fprintf(opts->out, "%-36s %10s %12s %12s %12s %12s %14s\n",
+                    "benchmark", "n", "median ns/op", "p90", "p99", "min", "ops/s");
+            break;
+        case BENCH_FORMAT_CSV:
+            fprintf(opts->out, "suite,benchmark,n,ops,repetitions,min_ns,median_ns,"
+                               "mean_ns,p90_ns,p99_ns,max_ns,ops_per_sec\n");
+            break;
+        case BENCH_FORMAT_JSON:
+            fprintf(opts->out, "{\n  \"suite\": \"%s\",\n  \"warmup\": %zu,\n"
+                               "  \"repetitions\": %zu,\n  \"results\": [",
+                    suite, opts->warmup, opts->repetitions);
+            break;
+    }
+}
+
+static void emit_result(BenchOptions *opts, const char *suite, const BenchResult *r) {
+    switch (opts->format) {
+        case BENCH_FORMAT_TEXT:
+            fprintf(opts->out, "%-36s %10zu %12.2f %12.2f %12.2f %12.2f %14.4g\n",
+                    r->name, r->n, r->median_ns, r->p90_ns, r->p99_ns, r->min_ns,
+                    r->ops_per_sec);
+            break;
+        case BENCH_FORMAT_CSV:
+            fprintf(opts->out, "%s,%s,%zu,%zu,%zu,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.1f\n",
+                    suite, r->name, r->n, r->ops, r->repetitions, r->min_ns,
+                    r->median_ns, r->mean_ns, r->p90_ns, r->p99_ns, r->max_ns,
+                    r->ops_per_sec);
+            break;
+        case BENCH_FORMAT_JSON:
+            // Nomes de casos são identificadores fixos: sem escapes
+            fprintf(opts->out, "%s\n    {\"name\": \"%s\", \"n\": %zu, \"ops\": %zu, "
+                               "\"repetitions\": %zu, \"min_ns\": %.3f, \"median_ns\": %.3f, "
+                               "\"mean_ns\": %.3f, \"p90_ns\": %.3f, \"p99_ns\": %.3f, "
+                               "\"max_ns\": %.3f, \"ops_per_sec\": %.1f}",
+                    opts->emitted > 0 ? "," : "", r->name, r->n, r->ops,
+                    r->repetitions, r->min_ns, r->median_ns, r->mean_ns, r->p90_ns,
+                    r->p99_ns, r->max_ns, r->ops_per_sec);
+            break;
+    }
+    opts->emitted++;
+    fflush(opts->out);
+}
+
+static void emit_end(BenchOptions *opts) {
+    if (opts->format == BENCH_FORMAT_JSON) {
+        fprintf(opts->out, "%s]\n}\n", opts->emitted > 0 ? "\n  " : "");
+    }
+}
+
+// ============================================================================
+// MEDIÇÃO
+// ============================================================================
+
+static bool measure(const BenchCase *bc, size_t n, const BenchOptions *opts,
+                    double *samples, BenchResult *result) {
+    void *state = bc->setup(n);
+    if (state == NULL) {
+        return false;
+    }
+
+    size_t ops = 0;
+    for (size_t i = 0; i < opts->warmup + opts->repetitions; i++) {
+        if (bc->prepare != NULL) {
+            bc->prepare(state);
+        }
+        uint64_t start = bench_now_ns();
+        ops = bc->run(state);
+        uint64_t elapsed = bench_now_ns() - start;
+
+        if (i >= opts->warmup) {
+            samples[i - opts->warmup] = (double)elapsed / (double)(ops > 0 ? ops : 1);
+        }
+    }
+    if (bc->teardown != NULL) {
+        bc->teardown(state);
+    }
+
+    result->name = bc->name;
+    result->n = n;
+    result->ops = ops;
+    summarize(result, samples, opts->repetitions);
+    return true;
+}
+
+// ============================================================================
+// LINHA DE COMANDO
+// ============================================================================
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "uso: %s [--sizes a,b,c] [--reps N] [--warmup N]\n"
+            "          [--format text|csv|json] [--output arquivo]\n"
+            "          [--filter substring] [--list]\n", prog);
+}
+
+static bool parse_size(const char *text, size_t *value) {
+    char *end = NULL;
+    unsigned long long parsed = strtoull(text, &end, 10);
+    if (end == text || (*end != '\0' && *end != ',')) {
+        return false;
+    }
+    *value = (size_t)parsed;
+    return true;
+}
+
+static bool parse_sizes(const char *text, BenchOptions *opts) {
+    opts->num_sizes = 0;
+    while (*text != '\0') {
+        if (opts->num_sizes == BENCH_MAX_SIZES ||
+            !parse_size(text, &opts->sizes[opts->num_sizes]) ||
+            opts->sizes[opts->num_sizes] == 0) {
+            return false;
+        }
+        opts->num_sizes++;
+        text = strchr(text, ',');
+        if (text == NULL) {
+            break;
+        }
+        text++;
+    }
+    return opts->num_sizes > 0;
+}
+
+int bench_main(int argc, char **argv, const char *suite,
+               const BenchCase *cases, size_t num_cases,
+               const size_t *default_sizes, size_t num_sizes) {
+    BenchOptions opts = {0};
+    opts.warmup = BENCH_DEFAULT_WARMUP;
+    opts.repetitions = BENCH_DEFAULT_REPS;
+    opts.format = BENCH_FORMAT_TEXT;
+    opts.out = stdout;
+    opts.num_sizes = num_sizes < BENCH_MAX_SIZES ? num_sizes : BENCH_MAX_SIZES;
+    memcpy(opts.sizes, default_sizes, opts.num_sizes * sizeof(size_t));
+
+    const char *output = NULL;
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+        bool ok = true;
+
+        if (strcmp(arg, "--list") == 0) {
+            for (size_t c = 0; c < num_cases; c++) {
+                printf("%s\n", cases[c].name);
+            }
+            return 0;
+        } else if (value == NULL) {
+            ok = false;
+        } else if (strcmp(arg, "--sizes") == 0) {
+            ok = parse_sizes(value, &opts);
+        } else if (strcmp(arg, "--reps") == 0) {
+            ok = parse_size(value, &opts.repetitions) && opts.repetitions > 0;
+        } else if (strcmp(arg, "--warmup") == 0) {
+            ok = parse_size(value, &opts.warmup);
+        } else if (strcmp(arg, "--filter") == 0) {
+            opts.filter = value;
+        } else if (strcmp(arg, "--output") == 0) {
+            output = value;
+        } else if (strcmp(arg, "--format") == 0) {
+            if (strcmp(value, "text") == 0) {
+                opts.format = BENCH_FORMAT_TEXT;
+            } else if (strcmp(value, "csv") == 0) {
+                opts.format = BENCH_FORMAT_CSV;
+            } else if (strcmp(value, "json") == 0) {
+                opts.format = BENCH_FORMAT_JSON;
+            } else {
+                ok = false;
+            }
+        } else {
+            ok = false;
+        }
+
+        if (!ok) {
+            usage(argv[0]);
+            return 2;
+        }
+        i++;
+    }
+
+    if (output != NULL) {
+        opts.out = fopen(output, "w");
+        if (opts.out == NULL) {
+            perror(output);
+            return 2;
+        }
+    }
+
+    double *samples = malloc(opts.repetitions * sizeof(double));
+    if (samples == NULL) {
+        if (opts.out != stdout) {
+            fclose(opts.out);
+        }
+        return 1;
+    }
+
+    int status = 0;
+    emit_begin(&opts, suite);
+    for (size_t c = 0; c < num_cases; c++) {
+        if (opts.filter != NULL && strstr(cases[c].name, opts.filter) == NULL) {
+            continue;
+        }
+        for (size_t s = 0; s < opts.num_sizes; s++) {
+            BenchResult result;
+            if (!measure(&cases[c], opts.sizes[s], &opts, samples, &result)) {
+                fprintf(stderr, "%s: setup falhou para n = %zu\n",
+                        cases[c].name, opts.sizes[s]);
+                status = 1;
+                continue;
+            }
+            emit_result(&opts, suite, &result);
+        }
+    }
+    emit_end(&opts);
+
+    free(samples);
+    if (opts.out != stdout) {
+        fclose(opts.out);
+    }
+    return status;
+}
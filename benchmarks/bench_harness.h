@@ -0,0 +1,111 @@
+/**
+ * @file bench_harness.h
+ * @brief Infraestrutura comum dos micro-benchmarks (bench_*)
+ *
+ * Cada executável bench_<módulo> descreve seus casos como BenchCase e
+ * delega a bench_main() a linha de comando, o aquecimento, as repetições,
+ * a varredura de tamanhos e a saída (texto, CSV ou JSON).
+ *
+ * Uma medição de um caso para um tamanho n:
+ *  1. setup(n) monta o estado (fora do tempo medido);
+ *  2. warmup execuções descartadas, depois repetitions execuções medidas;
+ *     antes de cada uma, prepare(state) restaura a entrada (fora do tempo);
+ *  3. run(state) é cronometrado e devolve quantas operações fez, o que
+ *     converte o tempo da execução em ns/op;
+ *  4. teardown(state).
+ *
+ * O relatório traz mínimo, mediana, média, p90, p99 e máximo de ns/op
+ * entre as repetições e a vazão (operações/s) pela mediana, que é a
+ * estatística a comparar entre versões: resiste a ruído de escalonamento.
+ *
+ * Uso:
+ * @code
+ * bench_sorting --sizes 1000,100000 --reps 21 --warmup 3 --format json \
+ *               --output sorting.json --filter pdqsort
+ * @endcode
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+// CASOS
+// ============================================================================
+
+/**
+ * @brief Um caso de benchmark
+ */
+typedef struct {
+    const char *name;                 /**< Identificador, ex.: "quick_sort/random" */
+    void* (*setup)(size_t n);         /**< Monta o estado para o tamanho n (NULL = falha) */
+    void (*prepare)(void *state);     /**< Restaura a entrada antes de cada execução (pode ser NULL) */
+    size_t (*run)(void *state);       /**< Trecho medido; devolve o número de operações */
+    void (*teardown)(void *state);    /**< Libera o estado (pode ser NULL) */
+} BenchCase;
+
+/**
+ * @brief Estatísticas de um caso para um tamanho
+ */
+typedef struct {
+    const char *name;      /**< Nome do caso */
+    size_t n;              /**< Tamanho da entrada */
+    size_t ops;            /**< Operações por execução (da última execução) */
+    size_t repetitions;    /**< Execuções medidas */
+    double min_ns;         /**< Menor ns/op */
+    double median_ns;      /**< Mediana de ns/op */
+    double mean_ns;        /**< Média de ns/op */
+    double p90_ns;         /**< Percentil 90 de ns/op */
+    double p99_ns;         /**< Percentil 99 de ns/op */
+    double max_ns;         /**< Maior ns/op */
+    double ops_per_sec;    /**< Vazão pela mediana */
+} BenchResult;
+
+// ============================================================================
+// EXECUÇÃO
+// ============================================================================
+
+/**
+ * @brief Ponto de entrada de um executável de benchmark
+ *
+ * @param suite Nome da suíte (vai para a saída)
+ * @param cases Casos da suíte
+ * @param num_cases Número de casos
+ * @param default_sizes Tamanhos usados sem --sizes
+ * @param num_sizes Número de tamanhos padrão
+ * @return Código de saída do processo (0, 1 em falha de setup, 2 em uso inválido)
+ *
+ * Opções: --sizes a,b,c  --reps N (padrão 11)  --warmup N (padrão 2)
+ * --format text|csv|json  --output arquivo  --filter substring  --list.
+ */
+int bench_main(int argc, char **argv, const char *suite,
+               const BenchCase *cases, size_t num_cases,
+               const size_t *default_sizes, size_t num_sizes);
+
+// ============================================================================
+// UTILITÁRIOS PARA OS CASOS
+// ============================================================================
+
+/**
+ * @brief Relógio monotônico em nanossegundos (origem arbitrária)
+ */
+uint64_t bench_now_ns(void);
+
+/**
+ * @brief Impede que o compilador descarte um resultado calculado no run
+ *
+ * Acumula value em uma variável volatile.
+ */
+void bench_consume(uint64_t value);
+
+/**
+ * @brief Gerador xorshift64* para montar entradas (state != 0)
+ */
+uint64_t bench_random(uint64_t *state);
+
+#endif // BENCH_HARNESS_H
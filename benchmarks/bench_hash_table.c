@@ -0,0 +1,160 @@
+/**
+ * @file bench_hash_table.c
+ * @brief Micro-benchmarks da tabela hash (hash_table.h)
+ *
+ * Chaves int pseudoaleatórias distintas com valores int. ns/op = tempo por
+ * put ou get; os "put" partem de uma tabela vazia de capacidade inicial
+ * pequena, então incluem os rehashes de crescimento.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "bench_harness.h"
+#include "data_structures/hash_table.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t n;
+    CollisionStrategy strategy;
+    int *keys;          // n chaves presentes, em ordem de inserção
+    int *probes;        // n chaves presentes embaralhadas (ou ausentes)
+    int *values;        // saída de get_batch
+    HashTable *table;
+} HashState;
+
+static HashTable* new_table(CollisionStrategy strategy) {
+    return hashtable_create(sizeof(int), sizeof(int), 16, hash_int, compare_int,
+                            strategy, NULL, NULL);
+}
+
+static void teardown(void *state) {
+    HashState *st = state;
+    hashtable_destroy(st->table);
+    free(st->keys);
+    free(st->probes);
+    free(st->values);
+    free(st);
+}
+
+// Chaves ímpares distintas (produto de ímpares módulo 2^32, bijetivo);
+// as ausentes são as vizinhas pares
+static HashState* hash_state_create(size_t n, CollisionStrategy strategy,
+                                    bool fill, bool missing) {
+    HashState *st = calloc(1, sizeof(HashState));
+    if (st == NULL) {
+        return NULL;
+    }
+    st->n = n;
+    st->strategy = strategy;
+    st->keys = malloc(n * sizeof(int));
+    st->probes = malloc(n * sizeof(int));
+    st->values = malloc(n * sizeof(int));
+    st->table = new_table(strategy);
+    if (st->keys == NULL || st->probes == NULL || st->values == NULL || st->table == NULL) {
+        teardown(st);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t k = (uint32_t)(i * 2 + 1) * 0x9E3779B1u;
+        st->keys[i] = (int)k;
+        st->probes[i] = missing ? (int)(k ^ 1u) : st->keys[i];
+    }
+    uint64_t seed = 0xC0FFEEULL;
+    for (size_t i = n; i > 1; i--) {
+        size_t j = (size_t)(bench_random(&seed) % i);
+        int tmp = st->probes[i - 1];
+        st->probes[i - 1] = st->probes[j];
+        st->probes[j] = tmp;
+    }
+    if (fill) {
+        for (size_t i = 0; i < n; i++) {
+            int value = (int)i;
+            if (hashtable_put(st->table, &st->keys[i], &value) != DS_SUCCESS) {
+                teardown(st);
+                return NULL;
+            }
+        }
+    }
+    return st;
+}
+
+static void prepare_empty(void *state) {
+    HashState *st = state;
+    hashtable_destroy(st->table);
+    st->table = new_table(st->strategy);
+}
+
+static size_t run_put(void *state) {
+    HashState *st = state;
+    for (size_t i = 0; i < st->n; i++) {
+        int value = (int)i;
+        hashtable_put(st->table, &st->keys[i], &value);
+    }
+    bench_consume(hashtable_size(st->table));
+    return st->n;
+}
+
+static size_t run_put_batch(void *state) {
+    HashState *st = state;
+    hashtable_put_batch(st->table, st->keys, st->keys, st->n);
+    bench_consume(hashtable_size(st->table));
+    return st->n;
+}
+
+static size_t run_get(void *state) {
+    HashState *st = state;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < st->n; i++) {
+        int value = 0;
+        if (hashtable_get(st->table, &st->probes[i], &value) == DS_SUCCESS) {
+            sum += (uint64_t)value;
+        }
+    }
+    bench_consume(sum);
+    return st->n;
+}
+
+static size_t run_get_batch(void *state) {
+    HashState *st = state;
+    hashtable_get_batch(st->table, st->probes, st->n, st->values, NULL);
+    bench_consume((uint64_t)st->values[st->n / 2]);
+    return st->n;
+}
+
+#define STRATEGY_SETUPS(tag, strategy)                                   \
+    static void* setup_empty_##tag(size_t n) {                           \
+        return hash_state_create(n, strategy, false, false);             \
+    }                                                                    \
+    static void* setup_hit_##tag(size_t n) {                             \
+        return hash_state_create(n, strategy, true, false);              \
+    }                                                                    \
+    static void* setup_miss_##tag(size_t n) {                            \
+        return hash_state_create(n, strategy, true, true);               \
+    }
+
+STRATEGY_SETUPS(chaining, HASH_CHAINING)
+STRATEGY_SETUPS(linear, HASH_LINEAR_PROBING)
+STRATEGY_SETUPS(flat, HASH_FLAT)
+
+static const BenchCase CASES[] = {
+    {"chaining/put",      setup_empty_chaining, prepare_empty, run_put,       teardown},
+    {"chaining/get_hit",  setup_hit_chaining,   NULL,          run_get,       teardown},
+    {"chaining/get_miss", setup_miss_chaining,  NULL,          run_get,       teardown},
+    {"linear/put",        setup_empty_linear,   prepare_empty, run_put,       teardown},
+    {"linear/get_hit",    setup_hit_linear,     NULL,          run_get,       teardown},
+    {"linear/get_miss",   setup_miss_linear,    NULL,          run_get,       teardown},
+    {"flat/put",          setup_empty_flat,     prepare_empty, run_put,       teardown},
+    {"flat/put_batch",    setup_empty_flat,     prepare_empty, run_put_batch, teardown},
+    {"flat/get_hit",      setup_hit_flat,       NULL,          run_get,       teardown},
+    {"flat/get_miss",     setup_miss_flat,      NULL,          run_get,       teardown},
+    {"flat/get_batch",    setup_hit_flat,       NULL,          run_get_batch, teardown},
+};
+
+int main(int argc, char **argv) {
+    static const size_t sizes[] = {1000, 100000, 1000000};
+    return bench_main(argc, argv, "hash_table", CASES, sizeof(CASES) / sizeof(CASES[0]),
+                      sizes, sizeof(sizes) / sizeof(sizes[0]));
+}
@@ -0,0 +1,202 @@
+/**
+ * @file bench_metaheuristics.c
+ * @brief Micro-benchmarks de otimização (optimization/)
+ *
+ * n = cidades (TSP) ou dimensões (funções contínuas). ns/op é por
+ * iteração do SA, por avaliação do GA, por ponto avaliado em lote ou por
+ * busca local 2-opt completa, conforme o caso. Sementes fixas: a mesma
+ * versão faz o mesmo trabalho em todas as execuções.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "bench_harness.h"
+#include "optimization/common.h"
+#include "optimization/benchmarks/tsp.h"
+#include "optimization/benchmarks/continuous.h"
+#include "optimization/metaheuristics/simulated_annealing.h"
+#include "optimization/metaheuristics/genetic_algorithm.h"
+#include <stdlib.h>
+#include <string.h>
+
+/** Iterações de cada execução do SA */
+#define BENCH_SA_ITERATIONS 20000
+
+/** Gerações de cada execução do GA */
+#define BENCH_GA_GENERATIONS 50
+
+/** Pontos por lote na avaliação contínua */
+#define BENCH_BATCH_POINTS 1024
+
+// ============================================================================
+// TSP
+// ============================================================================
+
+typedef struct {
+    size_t n;
+    TSPInstance *inst;
+    int *initial;     // tour aleatório fixo
+    int *tour;        // cópia de trabalho
+} TSPState;
+
+static void tsp_teardown(void *state) {
+    TSPState *st = state;
+    tsp_instance_destroy(st->inst);
+    free(st->initial);
+    free(st->tour);
+    free(st);
+}
+
+static void* tsp_setup(size_t n) {
+    TSPState *st = calloc(1, sizeof(TSPState));
+    if (st == NULL) {
+        return NULL;
+    }
+    st->n = n;
+    st->inst = tsp_create_random(n, 42);
+    st->initial = malloc(n * sizeof(int));
+    st->tour = malloc(n * sizeof(int));
+    if (st->inst == NULL || st->initial == NULL || st->tour == NULL) {
+        tsp_teardown(st);
+        return NULL;
+    }
+
+    uint64_t seed = 0x75BULL;
+    for (size_t i = 0; i < n; i++) {
+        st->initial[i] = (int)i;
+    }
+    for (size_t i = n; i > 1; i--) {
+        size_t j = (size_t)(bench_random(&seed) % i);
+        int tmp = st->initial[i - 1];
+        st->initial[i - 1] = st->initial[j];
+        st->initial[j] = tmp;
+    }
+    return st;
+}
+
+static void tsp_prepare(void *state) {
+    TSPState *st = state;
+    memcpy(st->tour, st->initial, st->n * sizeof(int));
+}
+
+static size_t run_tsp_sa(void *state) {
+    TSPState *st = state;
+    SAConfig cfg = sa_default_config();
+    cfg.max_iterations = BENCH_SA_ITERATIONS;
+    cfg.initial_temp = 50.0;
+    cfg.move_delta = tsp_move_or_opt;
+    cfg.move_apply = tsp_move_apply;
+    cfg.trace.mode = OPT_TRACE_NONE;
+
+    OptResult result = sa_run(&cfg, st->n * sizeof(int), st->n, tsp_tour_cost,
+                              tsp_neighbor_2opt, tsp_generate_random, st->inst);
+    bench_consume((uint64_t)result.best.cost);
+    size_t iterations = result.num_iterations;
+    opt_result_destroy(&result);
+    return iterations;
+}
+
+static size_t run_tsp_ga(void *state) {
+    TSPState *st = state;
+    GAConfig cfg = ga_default_config();
+    cfg.max_generations = BENCH_GA_GENERATIONS;
+    cfg.num_threads = 1;
+    cfg.trace.mode = OPT_TRACE_NONE;
+
+    OptResult result = ga_run(&cfg, st->n * sizeof(int), st->n, tsp_tour_cost,
+                              tsp_generate_random, ga_crossover_ox, ga_mutation_swap,
+                              NULL, st->inst);
+    bench_consume((uint64_t)result.best.cost);
+    size_t evaluations = result.num_evaluations;
+    opt_result_destroy(&result);
+    return evaluations;
+}
+
+static size_t run_tsp_2opt(void *state) {
+    TSPState *st = state;
+    double cost = tsp_local_search_2opt(st->tour, st->n, tsp_tour_cost, st->inst);
+    bench_consume((uint64_t)cost);
+    return 1;
+}
+
+static size_t run_tsp_or_opt(void *state) {
+    TSPState *st = state;
+    double cost = tsp_local_search_or_opt(st->tour, st->n, tsp_tour_cost, st->inst);
+    bench_consume((uint64_t)cost);
+    return 1;
+}
+
+// ============================================================================
+// FUNÇÕES CONTÍNUAS
+// ============================================================================
+
+typedef struct {
+    size_t dims;
+    ContinuousInstance *inst;
+    double *points;
+    double *costs;
+} ContinuousState;
+
+static void continuous_teardown(void *state) {
+    ContinuousState *st = state;
+    continuous_instance_destroy(st->inst);
+    free(st->points);
+    free(st->costs);
+    free(st);
+}
+
+static void* continuous_setup(size_t dims, ContinuousInstance *inst) {
+    ContinuousState *st = calloc(1, sizeof(ContinuousState));
+    if (st == NULL) {
+        continuous_instance_destroy(inst);
+        return NULL;
+    }
+    st->dims = dims;
+    st->inst = inst;
+    st->points = malloc(BENCH_BATCH_POINTS * dims * sizeof(double));
+    st->costs = malloc(BENCH_BATCH_POINTS * sizeof(double));
+    if (inst == NULL || st->points == NULL || st->costs == NULL) {
+        continuous_teardown(st);
+        return NULL;
+    }
+
+    uint64_t seed = 0xD1FFULL;
+    double range = inst->upper_bound - inst->lower_bound;
+    for (size_t i = 0; i < BENCH_BATCH_POINTS * dims; i++) {
+        double u = (double)(bench_random(&seed) >> 11) * 0x1.0p-53;
+        st->points[i] = inst->lower_bound + u * range;
+    }
+    return st;
+}
+
+static void* rastrigin_setup(size_t dims) {
+    return continuous_setup(dims, continuous_create_rastrigin(dims));
+}
+
+static void* rosenbrock_setup(size_t dims) {
+    return continuous_setup(dims, continuous_create_rosenbrock(dims));
+}
+
+static size_t run_continuous_batch(void *state) {
+    ContinuousState *st = state;
+    continuous_evaluate_batch(st->points, BENCH_BATCH_POINTS, st->dims * sizeof(double),
+                              st->dims, st->costs, st->inst);
+    bench_consume((uint64_t)st->costs[0]);
+    return BENCH_BATCH_POINTS;
+}
+
+static const BenchCase CASES[] = {
+    {"tsp/sa_or_opt_delta",       tsp_setup,        NULL,        run_tsp_sa,           tsp_teardown},
+    {"tsp/ga_ox",                 tsp_setup,        NULL,        run_tsp_ga,           tsp_teardown},
+    {"tsp/local_search_2opt",     tsp_setup,        tsp_prepare, run_tsp_2opt,         tsp_teardown},
+    {"tsp/local_search_or_opt",   tsp_setup,        tsp_prepare, run_tsp_or_opt,       tsp_teardown},
+    {"continuous/rastrigin_batch", rastrigin_setup, NULL,        run_continuous_batch, continuous_teardown},
+    {"continuous/rosenbrock_batch", rosenbrock_setup, NULL,      run_continuous_batch, continuous_teardown},
+};
+
+int main(int argc, char **argv) {
+    static const size_t sizes[] = {20, 100, 500};
+    return bench_main(argc, argv, "metaheuristics", CASES, sizeof(CASES) / sizeof(CASES[0]),
+                      sizes, sizeof(sizes) / sizeof(sizes[0]));
+}
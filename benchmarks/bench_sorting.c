@@ -0,0 +1,150 @@
+/**
+ * @file bench_sorting.c
+ * @brief Micro-benchmarks de ordenação (sorting.h, pdqsort.h)
+ *
+ * ns/op = tempo por elemento ordenado. Cada execução reordena uma cópia
+ * da mesma entrada, restaurada fora do tempo medido.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "bench_harness.h"
+#include "algorithms/sorting.h"
+#include "data_structures/pdqsort.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    size_t n;
+    int *input;
+    int *work;
+} SortState;
+
+static void* setup_with_pattern(size_t n, bool nearly_sorted) {
+    SortState *st = malloc(sizeof(SortState));
+    if (st == NULL) {
+        return NULL;
+    }
+    st->n = n;
+    st->input = malloc(n * sizeof(int));
+    st->work = malloc(n * sizeof(int));
+    if (st->input == NULL || st->work == NULL) {
+        free(st->input);
+        free(st->work);
+        free(st);
+        return NULL;
+    }
+
+    uint64_t seed = 0x5EED5EEDULL;
+    for (size_t i = 0; i < n; i++) {
+        st->input[i] = (int)(bench_random(&seed) >> 33);
+    }
+    if (nearly_sorted) {
+        // Quase ordenado: 99% crescente, 1% de trocas aleatórias
+        sort_int(st->input, n);
+        for (size_t k = 0; k < n / 100; k++) {
+            size_t i = (size_t)(bench_random(&seed) % n);
+            size_t j = (size_t)(bench_random(&seed) % n);
+            int tmp = st->input[i];
+            st->input[i] = st->input[j];
+            st->input[j] = tmp;
+        }
+    }
+    return st;
+}
+
+static void* setup_random(size_t n) {
+    return setup_with_pattern(n, false);
+}
+
+static void* setup_nearly_sorted(size_t n) {
+    return setup_with_pattern(n, true);
+}
+
+static void prepare(void *state) {
+    SortState *st = state;
+    memcpy(st->work, st->input, st->n * sizeof(int));
+}
+
+static void teardown(void *state) {
+    SortState *st = state;
+    free(st->input);
+    free(st->work);
+    free(st);
+}
+
+static size_t finish(SortState *st) {
+    bench_consume((uint64_t)st->work[st->n / 2]);
+    return st->n;
+}
+
+static size_t run_libc_qsort(void *state) {
+    SortState *st = state;
+    qsort(st->work, st->n, sizeof(int), compare_int);
+    return finish(st);
+}
+
+static size_t run_quick_sort(void *state) {
+    SortState *st = state;
+    quick_sort(st->work, st->n, sizeof(int), compare_int);
+    return finish(st);
+}
+
+static size_t run_merge_sort(void *state) {
+    SortState *st = state;
+    merge_sort(st->work, st->n, sizeof(int), compare_int);
+    return finish(st);
+}
+
+static size_t run_heap_sort(void *state) {
+    SortState *st = state;
+    heap_sort(st->work, st->n, sizeof(int), compare_int);
+    return finish(st);
+}
+
+static size_t run_shell_sort(void *state) {
+    SortState *st = state;
+    shell_sort(st->work, st->n, sizeof(int), compare_int);
+    return finish(st);
+}
+
+static size_t run_pdqsort(void *state) {
+    SortState *st = state;
+    ds_pdqsort(st->work, st->n, sizeof(int), compare_int);
+    return finish(st);
+}
+
+static size_t run_sort_int(void *state) {
+    SortState *st = state;
+    sort_int(st->work, st->n);
+    return finish(st);
+}
+
+static size_t run_radix_sort_u32(void *state) {
+    SortState *st = state;
+    // Entradas são não-negativas: a ordem de uint32_t coincide com a de int
+    radix_sort_u32((uint32_t *)st->work, st->n, 1);
+    return finish(st);
+}
+
+static const BenchCase CASES[] = {
+    {"qsort_libc/random",         setup_random,        prepare, run_libc_qsort,     teardown},
+    {"quick_sort/random",         setup_random,        prepare, run_quick_sort,     teardown},
+    {"merge_sort/random",         setup_random,        prepare, run_merge_sort,     teardown},
+    {"heap_sort/random",          setup_random,        prepare, run_heap_sort,      teardown},
+    {"shell_sort/random",         setup_random,        prepare, run_shell_sort,     teardown},
+    {"pdqsort/random",            setup_random,        prepare, run_pdqsort,        teardown},
+    {"sort_int/random",           setup_random,        prepare, run_sort_int,       teardown},
+    {"radix_sort_u32/random",     setup_random,        prepare, run_radix_sort_u32, teardown},
+    {"quick_sort/nearly_sorted",  setup_nearly_sorted, prepare, run_quick_sort,     teardown},
+    {"pdqsort/nearly_sorted",     setup_nearly_sorted, prepare, run_pdqsort,        teardown},
+    {"sort_int/nearly_sorted",    setup_nearly_sorted, prepare, run_sort_int,       teardown},
+};
+
+int main(int argc, char **argv) {
+    static const size_t sizes[] = {1000, 100000, 1000000};
+    return bench_main(argc, argv, "sorting", CASES, sizeof(CASES) / sizeof(CASES[0]),
+                      sizes, sizeof(sizes) / sizeof(sizes[0]));
+}
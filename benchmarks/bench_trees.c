@@ -0,0 +1,211 @@
+/**
+ * @file bench_trees.c
+ * @brief Micro-benchmarks de árvores e heaps (bst.h, avl_tree.h,
+ *        bplus_tree.h, heap.h)
+ *
+ * Chaves int pseudoaleatórias. ns/op = tempo por elemento inserido,
+ * buscado, visitado ou extraído.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "bench_harness.h"
+#include "data_structures/bst.h"
+#include "data_structures/avl_tree.h"
+#include "data_structures/bplus_tree.h"
+#include "data_structures/heap.h"
+#include <stdlib.h>
+
+typedef struct {
+    size_t n;
+    int *keys;
+    BST *bst;
+    AVLTree *avl;
+    BPlusTree *bptree;
+    Heap *heap;
+} TreeState;
+
+static void destroy_containers(TreeState *st) {
+    bst_destroy(st->bst);
+    avl_destroy(st->avl);
+    bptree_destroy(st->bptree);
+    heap_destroy(st->heap);
+    st->bst = NULL;
+    st->avl = NULL;
+    st->bptree = NULL;
+    st->heap = NULL;
+}
+
+static void teardown(void *state) {
+    TreeState *st = state;
+    destroy_containers(st);
+    free(st->keys);
+    free(st);
+}
+
+static void* setup_keys(size_t n) {
+    TreeState *st = calloc(1, sizeof(TreeState));
+    if (st == NULL) {
+        return NULL;
+    }
+    st->n = n;
+    st->keys = malloc(n * sizeof(int));
+    if (st->keys == NULL) {
+        free(st);
+        return NULL;
+    }
+    uint64_t seed = 0x7EE5ULL;
+    for (size_t i = 0; i < n; i++) {
+        st->keys[i] = (int)(bench_random(&seed) >> 33);
+    }
+    return st;
+}
+
+// Contêineres vazios antes de cada execução dos casos de inserção
+static void prepare_empty(void *state) {
+    TreeState *st = state;
+    destroy_containers(st);
+    st->bst = bst_create(sizeof(int), compare_int, NULL);
+    st->avl = avl_create(sizeof(int), compare_int, NULL);
+    st->bptree = bptree_create(sizeof(int), compare_int, NULL);
+    st->heap = heap_create(sizeof(int), 16, HEAP_MIN, compare_int, NULL);
+}
+
+// Contêineres cheios montados uma vez para os casos de leitura
+static void* setup_filled(size_t n) {
+    TreeState *st = setup_keys(n);
+    if (st == NULL) {
+        return NULL;
+    }
+    prepare_empty(st);
+    if (st->bst == NULL || st->avl == NULL || st->bptree == NULL || st->heap == NULL) {
+        teardown(st);
+        return NULL;
+    }
+    for (size_t i = 0; i < n; i++) {
+        bst_insert(st->bst, &st->keys[i]);
+        avl_insert(st->avl, &st->keys[i]);
+        bptree_insert(st->bptree, &st->keys[i]);
+    }
+    return st;
+}
+
+static size_t run_bst_insert(void *state) {
+    TreeState *st = state;
+    for (size_t i = 0; i < st->n; i++) {
+        bst_insert(st->bst, &st->keys[i]);
+    }
+    bench_consume(bst_size(st->bst));
+    return st->n;
+}
+
+static size_t run_avl_insert(void *state) {
+    TreeState *st = state;
+    for (size_t i = 0; i < st->n; i++) {
+        avl_insert(st->avl, &st->keys[i]);
+    }
+    bench_consume(avl_size(st->avl));
+    return st->n;
+}
+
+static size_t run_bptree_insert(void *state) {
+    TreeState *st = state;
+    for (size_t i = 0; i < st->n; i++) {
+        bptree_insert(st->bptree, &st->keys[i]);
+    }
+    bench_consume(bptree_size(st->bptree));
+    return st->n;
+}
+
+static size_t run_bst_search(void *state) {
+    TreeState *st = state;
+    size_t hits = 0;
+    for (size_t i = 0; i < st->n; i++) {
+        hits += bst_contains(st->bst, &st->keys[i]);
+    }
+    bench_consume(hits);
+    return st->n;
+}
+
+static size_t run_avl_search(void *state) {
+    TreeState *st = state;
+    size_t hits = 0;
+    for (size_t i = 0; i < st->n; i++) {
+        hits += avl_contains(st->avl, &st->keys[i]);
+    }
+    bench_consume(hits);
+    return st->n;
+}
+
+static size_t run_bptree_search(void *state) {
+    TreeState *st = state;
+    size_t hits = 0;
+    for (size_t i = 0; i < st->n; i++) {
+        hits += bptree_contains(st->bptree, &st->keys[i]);
+    }
+    bench_consume(hits);
+    return st->n;
+}
+
+static size_t run_bst_iterate(void *state) {
+    TreeState *st = state;
+    BSTIter it;
+    void *data;
+    uint64_t sum = 0;
+    size_t visited = 0;
+    bst_iter_begin(st->bst, BST_INORDER, &it);
+    while (bst_iter_next(&it, &data)) {
+        sum += (uint64_t)*(int *)data;
+        visited++;
+    }
+    bench_consume(sum);
+    return visited;
+}
+
+static size_t run_avl_iterate(void *state) {
+    TreeState *st = state;
+    AVLIter it;
+    void *data;
+    uint64_t sum = 0;
+    size_t visited = 0;
+    avl_iter_begin(st->avl, AVL_INORDER, &it);
+    while (avl_iter_next(&it, &data)) {
+        sum += (uint64_t)*(int *)data;
+        visited++;
+    }
+    bench_consume(sum);
+    return visited;
+}
+
+static size_t run_heap_push_pop(void *state) {
+    TreeState *st = state;
+    for (size_t i = 0; i < st->n; i++) {
+        heap_insert(st->heap, &st->keys[i]);
+    }
+    uint64_t sum = 0;
+    int value;
+    while (heap_extract(st->heap, &value) == DS_SUCCESS) {
+        sum += (uint64_t)value;
+    }
+    bench_consume(sum);
+    return 2 * st->n;
+}
+
+static const BenchCase CASES[] = {
+    {"bst/insert",       setup_keys,   prepare_empty, run_bst_insert,    teardown},
+    {"avl/insert",       setup_keys,   prepare_empty, run_avl_insert,    teardown},
+    {"bptree/insert",    setup_keys,   prepare_empty, run_bptree_insert, teardown},
+    {"bst/search",       setup_filled, NULL,          run_bst_search,    teardown},
+    {"avl/search",       setup_filled, NULL,          run_avl_search,    teardown},
+    {"bptree/search",    setup_filled, NULL,          run_bptree_search, teardown},
+    {"bst/iterate",      setup_filled, NULL,          run_bst_iterate,   teardown},
+    {"avl/iterate",      setup_filled, NULL,          run_avl_iterate,   teardown},
+    {"heap/push_pop",    setup_keys,   prepare_empty, run_heap_push_pop, teardown},
+};
+
+int main(int argc, char **argv) {
+    static const size_t sizes[] = {1000, 100000, 1000000};
+    return bench_main(argc, argv, "trees", CASES, sizeof(CASES) / sizeof(CASES[0]),
+                      sizes, sizeof(sizes) / sizeof(sizes[0]));
+}
@@ -22,6 +22,9 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
+
+#include "data_structures/graph.h"
 
 // ============================================================================
 // N-QUEENS
@@ -61,6 +64,32 @@ NQueensResult nqueens_solve(size_t n);
  */
 size_t nqueens_count(size_t n);
 
+/** Maior n aceito por nqueens_count_bitboard (uma mascara de 32 bits por linha) */
+#define NQUEENS_BITBOARD_MAX 32
+
+/**
+ * @brief Conta solucoes com bitboards, simetria e paralelismo
+ *
+ * Colunas e as duas diagonais ocupadas sao mascaras de bits; as casas
+ * livres de uma linha sao ~(cols | diag1 | diag2) e cada uma e extraida
+ * pelo bit menos significativo (x & -x), sem varrer colunas nem testar
+ * rainhas anteriores. A reflexao vertical divide a busca ao meio: so a
+ * metade esquerda da primeira linha e explorada e conta em dobro (com n
+ * impar, a coluna central entra com a segunda linha restrita a metade
+ * esquerda). Os pares validos de colunas das duas primeiras linhas viram
+ * itens de trabalho distribuidos dinamicamente entre as threads do pool
+ * global (thread_pool.h).
+ *
+ * @param n Tamanho do tabuleiro (<= NQUEENS_BITBOARD_MAX)
+ * @param num_threads Threads (0 = ds_get_num_threads())
+ * @return Numero de solucoes (0 se n == 0 ou n > NQUEENS_BITBOARD_MAX)
+ *
+ * Complexidade: O(N!) no pior caso, com custo constante pequeno por no
+ * Referencia: Richards, M. (1997). "Backtracking Algorithms in MCPL using
+ * Bit Patterns and Recursion"; Knuth TAOCP 4A S7.2.2
+ */
+uint64_t nqueens_count_bitboard(size_t n, size_t num_threads);
+
 /**
  * @brief Libera memoria de NQueensResult
  */
@@ -100,6 +129,49 @@ SubsetSumResult subset_sum_all(const int *set, size_t n, int target);
  */
 bool subset_sum_exists(const int *set, size_t n, int target);
 
+/** Maior n aceito por subset_sum_exists_mitm (memoria O(2^(n/2))) */
+#define SUBSET_SUM_MITM_MAX 48
+
+/**
+ * @brief Verifica se existe subconjunto que soma ao alvo (meet-in-the-middle)
+ *
+ * Horowitz-Sahni: as 2^(n/2) somas de cada metade sao geradas ja em ordem
+ * (cada elemento faz um merge da lista com ela mesma deslocada) e as duas
+ * listas sao percorridas com dois ponteiros. Aceita valores negativos e
+ * alvos grandes; o subconjunto vazio soma 0.
+ *
+ * @param set Array de inteiros de 64 bits
+ * @param n Tamanho do conjunto (ate SUBSET_SUM_MITM_MAX)
+ * @param target Soma alvo
+ * @param included Saida opcional (n posicoes): um subconjunto encontrado
+ * @return true se existe; false tambem se n > SUBSET_SUM_MITM_MAX, se a
+ *         soma dos |set[i]| nao cabe em int64_t ou em falha de alocacao
+ *
+ * Complexidade: O(2^(n/2) * n) tempo, O(2^(n/2)) memoria
+ * Referencia: Horowitz, E. & Sahni, S. (1974). "Computing Partitions with
+ * Applications to the Knapsack Problem". JACM 21(2)
+ */
+bool subset_sum_exists_mitm(const int64_t *set, size_t n, int64_t target, bool *included);
+
+/**
+ * @brief Verifica se existe subconjunto que soma ao alvo (DP em bitset)
+ *
+ * O conjunto de somas alcancaveis 0..target e um bitset de palavras
+ * uint64_t; cada elemento x faz reach |= reach << x palavra a palavra
+ * (64 somas por operacao). Para assim que target fica alcancavel.
+ *
+ * @param set Array de inteiros nao negativos
+ * @param n Tamanho do conjunto
+ * @param target Soma alvo (>= 0)
+ * @return true se existe; false com target ou algum elemento negativo
+ *         ou em falha de alocacao
+ *
+ * Complexidade: O(n * target / 64) tempo, O(target / 8) bytes
+ * Referencia: Cormen S34.5.5; Pisinger, D. (1999). "Linear Time Algorithms
+ * for Knapsack Problems with Bounded Weights". J. Algorithms 33(1)
+ */
+bool subset_sum_exists_bitset(const int *set, size_t n, int target);
+
 /**
  * @brief Libera memoria de SubsetSumResult
  */
@@ -136,6 +208,92 @@ PermutationResult permutations_generate(const int *arr, size_t n);
  */
 size_t permutations_count(size_t n);
 
+/** Maior n dos iteradores e do rank (20! e o ultimo fatorial em 64 bits) */
+#define PERMUTATION_MAX_N 20
+
+/**
+ * @brief Iterador de permutacoes sem alocacao (ordem lexicografica de indices)
+ *
+ * Percorre as permutacoes de posicoes de arr com rank em [rank, end): a
+ * permutacao de rank r e arr[p[0]], ..., arr[p[n-1]] com p = unrank(r).
+ * Valores repetidos em arr geram saidas repetidas (como em
+ * permutations_generate). Os campos sao internos; o struct pode ficar na
+ * pilha.
+ */
+typedef struct {
+    const int *arr;
+    size_t n;
+    uint64_t rank;                     /**< Rank da proxima permutacao */
+    uint64_t end;
+    bool fresh;                        /**< Proxima saida reescreve out inteiro */
+    unsigned char idx[PERMUTATION_MAX_N];
+} PermutationIterator;
+
+/**
+ * @brief Inicializa o iterador nas permutacoes de rank [first, last)
+ *
+ * last e limitado a n!; use UINT64_MAX para ir ate o fim.
+ *
+ * @return false com it/arr NULL, n == 0 ou n > PERMUTATION_MAX_N
+ *
+ * Complexidade: O(n^2) (unrank de first)
+ */
+bool permutation_iterator_init(PermutationIterator *it, const int *arr, size_t n,
+                               uint64_t first, uint64_t last);
+
+/**
+ * @brief Escreve a proxima permutacao em out (n inteiros)
+ *
+ * out deve ser o mesmo buffer em todas as chamadas e nao ser alterado
+ * entre elas: so o sufixo que muda e reescrito (em media menos de 3
+ * posicoes por passo).
+ *
+ * @return false quando o intervalo acabou (out nao e tocado)
+ *
+ * Complexidade: O(1) amortizado, O(n) pior caso
+ * Referencia: Knuth TAOCP 4A S7.2.1.2 (Algorithm L)
+ */
+bool permutation_iterator_next(PermutationIterator *it, int *out);
+
+/**
+ * @brief Rank lexicografico de uma permutacao de 0..n-1 (codigo de Lehmer)
+ *
+ * @return Rank em [0, n!) ou UINT64_MAX se perm nao e permutacao de 0..n-1
+ *         ou n > PERMUTATION_MAX_N
+ *
+ * Complexidade: O(n) (popcount sobre mascara dos ja vistos)
+ */
+uint64_t permutation_rank(const int *perm, size_t n);
+
+/**
+ * @brief Permutacao de 0..n-1 com o rank dado (inversa de permutation_rank)
+ *
+ * @return false se rank >= n! ou n > PERMUTATION_MAX_N
+ *
+ * Complexidade: O(n^2)
+ */
+bool permutation_unrank(uint64_t rank, size_t n, int *perm);
+
+/**
+ * @brief Callback de permutations_for_each; devolver false interrompe
+ */
+typedef bool (*PermutationVisitFn)(const int *perm, size_t n, void *user_data);
+
+/**
+ * @brief Visita as n! permutacoes de arr sem armazena-las
+ *
+ * O intervalo de ranks e cortado em blocos distribuidos entre as threads;
+ * cada uma itera o seu com um buffer na pilha. Com mais de uma thread,
+ * visit e chamada concorrentemente e em ordem nao determinada.
+ *
+ * @param num_threads Threads (0 = ds_get_num_threads(), 1 = serial, em ordem)
+ * @return true se todas foram visitadas (nenhum visit devolveu false)
+ *
+ * Complexidade: O(n!) chamadas de visit
+ */
+bool permutations_for_each(const int *arr, size_t n, PermutationVisitFn visit, void *user_data,
+                           size_t num_threads);
+
 /**
  * @brief Libera memoria de PermutationResult
  */
@@ -170,6 +328,60 @@ typedef struct {
  */
 GraphColoringResult graph_coloring(const int *adj, size_t n, int m);
 
+/** Vertices ate os quais graph_coloring_dsatur monta linhas de adjacencia em bitset */
+#define GRAPH_COLORING_BITSET_MAX 4096
+
+/**
+ * @brief Colore um grafo com no maximo m cores (DSATUR exato)
+ *
+ * Mesma entrada e resultado de graph_coloring (adj[i*n + j] ou adj[j*n + i]
+ * indica aresta; lacos sao ignorados). Busca exata guiada pela heuristica
+ * DSATUR de Brelaz:
+ * - O proximo vertice e o de maior saturacao (cores distintas entre os
+ *   vizinhos), com empate pelo maior grau; heap indexado, O(log n)
+ * - Cores proibidas de cada vertice num bitset de m bits; a menor cor
+ *   livre sai por ctz sobre ~palavra
+ * - Forward checking: um vizinho sem cor com as m cores proibidas corta
+ * - Simetria de cores: so se abre uma cor nova por vez
+ * - Um clique guloso (AND/popcount sobre linhas de adjacencia em bitset,
+ *   ate GRAPH_COLORING_BITSET_MAX vertices) e colorido de antemao; clique
+ *   maior que m prova que nao ha coloracao
+ * - m acima de grau maximo + 1 e reduzido (o guloso sempre resolve)
+ *
+ * Com mais de uma thread, as primeiras decisoes da busca sao enumeradas em
+ * itens de trabalho (varios por thread) e cada thread explora suas
+ * subarvores; a primeira coloracao encontrada interrompe as demais. A
+ * coloracao devolvida pode depender do numero de threads, a resposta nao.
+ *
+ * @param adj Matriz de adjacencia (n x n, row-major)
+ * @param n Numero de vertices
+ * @param m Numero maximo de cores
+ * @param num_threads Threads (0 = ds_get_num_threads(), 1 = serial)
+ * @return GraphColoringResult; colors == NULL em falha de alocacao
+ *
+ * Complexidade: O(m^n) pior caso; memoria O(n * min(m, grau maximo + 1))
+ * Referencia: Brelaz, D. (1979). "New methods to color the vertices of a
+ * graph". CACM 22(4); San Segundo, P. (2012). "A new DSATUR-based
+ * algorithm for exact vertex coloring". Comput. Oper. Res. 39(7)
+ */
+GraphColoringResult graph_coloring_dsatur(const int *adj, size_t n, int m, size_t num_threads);
+
+/**
+ * @brief graph_coloring_dsatur sobre um snapshot CSR (instancias esparsas)
+ *
+ * Arcos de digrafos valem nos dois sentidos; arestas repetidas e lacos
+ * sao ignorados. Nenhuma matriz n x n e montada acima de
+ * GRAPH_COLORING_BITSET_MAX vertices.
+ *
+ * Complexidade: O(V + E) de preparo + busca
+ */
+GraphColoringResult graph_coloring_dsatur_csr(const CSRGraph *csr, int m, size_t num_threads);
+
+/**
+ * @brief graph_coloring_dsatur sobre um Graph (congela em CSR internamente)
+ */
+GraphColoringResult graph_coloring_dsatur_graph(const Graph *graph, int m, size_t num_threads);
+
 /**
  * @brief Libera memoria de GraphColoringResult
  */
@@ -29,26 +29,108 @@
 // STRASSEN MATRIX MULTIPLICATION
 // ============================================================================
 
+/** Faixa de limiares testada por strassen_autotune */
+#define STRASSEN_THRESHOLD_MIN 64
+#define STRASSEN_THRESHOLD_MAX 512
+
+/** Limiar usado quando nao ha relogio ou memoria para o autoajuste */
+#define STRASSEN_THRESHOLD_DEFAULT 512
+
+/**
+ * @brief Parametros de strassen_multiply_ex
+ */
+typedef struct {
+    size_t threshold;       /**< n <= threshold usa matrix_multiply (0 = strassen_autotune()) */
+    size_t parallel_depth;  /**< Niveis com os 7 produtos em tarefas do pool (padrao 1; 0 = serial) */
+    size_t num_threads;     /**< Threads (0 = ds_get_num_threads(); 1 = serial) */
+} StrassenConfig;
+
+/**
+ * @brief Configuracao padrao (limiar autoajustado, 1 nivel paralelo)
+ */
+StrassenConfig strassen_default_config(void);
+
 /**
  * @brief Multiplica duas matrizes n x n usando Strassen
  *
- * Para n pequeno (<=64), usa multiplicacao classica.
+ * Equivale a strassen_multiply_ex com strassen_default_config().
  * Matrizes armazenadas em row-major order.
  *
+ * Com n > STRASSEN_THRESHOLD_MIN, a primeira chamada do processo roda
+ * strassen_autotune(): aloca tres matrizes de 2*STRASSEN_THRESHOLD_MAX
+ * (~24 MiB) e cronometra varias multiplicacoes, o que pode levar mais de
+ * um segundo. Chame strassen_autotune() na inicializacao, ou use
+ * strassen_multiply_ex com threshold fixo, para tirar esse custo do
+ * caminho critico.
+ *
  * @param A Matriz A (n x n)
  * @param B Matriz B (n x n)
  * @param C Matriz resultado C = A*B (n x n, pre-alocada)
  * @param n Dimensao das matrizes
  *
  * Complexidade: O(n^2.807) vs O(n^3) classico
- * Espaco: O(n^2 log n)
- *
  * Referencia: Cormen S4.2 (pseudocodigo STRASSEN p. 79-80)
  */
 void strassen_multiply(const double *A, const double *B, double *C, size_t n);
 
 /**
- * @brief Multiplicacao classica de matrizes n x n
+ * @brief Strassen com workspace unico e produtos em paralelo
+ *
+ * Os quadrantes sao visoes com stride sobre A, B e C (sem copias) e todos
+ * os temporarios saem de um unico workspace alocado antes da recursao.
+ * Nos primeiros parallel_depth niveis os 7 produtos sao tarefas do pool,
+ * cada uma com sua fatia do workspace; abaixo disso um unico produto
+ * temporario e reaproveitado e somado em C logo depois de calculado.
+ * Para n > threshold, n e completado com zeros so ate o menor multiplo de
+ * 2^niveis que a recursao precisa (n = 1025 com limiar 512 vira 1032).
+ * Com threshold = 0 vale o custo da primeira chamada descrito em
+ * strassen_multiply.
+ *
+ * @param config Parametros (NULL = strassen_default_config())
+ *
+ * Espaco: ~n^2 doubles em serie; ~7 n^2 com parallel_depth = 1 (cada
+ * nivel paralelo multiplica por 7/4 a fatia dos filhos)
+ */
+void strassen_multiply_ex(const double *A, const double *B, double *C, size_t n,
+                          const StrassenConfig *config);
+
+/**
+ * @brief Mede o limiar de Strassen nesta maquina (resultado guardado)
+ *
+ * Para s = STRASSEN_THRESHOLD_MIN, 2*MIN, ..., STRASSEN_THRESHOLD_MAX,
+ * compara o GEMM direto de 2s com um nivel de Strassen sobre 2s e devolve
+ * o primeiro s em que Strassen vence (MAX se nunca vencer). A primeira
+ * chamada custa algumas multiplicacoes de ate 2*MAX; as seguintes sao
+ * imediatas. Thread-safe: a medicao roda uma unica vez (pthread_once) e
+ * chamadas concorrentes esperam por ela.
+ *
+ * @return Limiar de n abaixo do qual Strassen usa matrix_multiply
+ */
+size_t strassen_autotune(void);
+
+/**
+ * @brief Multiplicacao de matrizes retangulares C (m x n) = A (m x k) * B (k x n)
+ *
+ * GEMM blocado no esquema de Goto/BLIS: paineis de B (256 x 2048) e blocos
+ * de A (96 x 256) sao empacotados de forma contigua para caberem em L2/L1,
+ * e um micro-kernel mantem um bloco MR x NR de C em registradores
+ * (AVX-512 8 x 16 ou AVX2/FMA 6 x 8, escolhidos em tempo de execucao;
+ * NEON 4 x 8; escalar 4 x 4). Dimensoes quaisquer, sem completar com zeros;
+ * as bordas usam um bloco temporario. Row-major; C nao pode se sobrepor a
+ * A ou B.
+ *
+ * @param A Matriz A (m x k)
+ * @param B Matriz B (k x n)
+ * @param C Matriz resultado (m x n, pre-alocada)
+ *
+ * Complexidade: O(m*n*k) tempo, O(KC * (MC + NC)) espaco auxiliar
+ * Referencia: Goto & van de Geijn (2008), "Anatomy of High-Performance
+ * Matrix Multiplication", ACM TOMS 34(3); Van Zee & van de Geijn (2015), BLIS
+ */
+void matrix_multiply(const double *A, const double *B, double *C, size_t m, size_t k, size_t n);
+
+/**
+ * @brief Multiplicacao classica de matrizes n x n (matrix_multiply com m = k = n)
  *
  * Complexidade: O(n^3)
  */
@@ -78,7 +160,9 @@ typedef struct {
 /**
  * @brief Encontra o par de pontos mais proximo
  *
- * @param points Array de pontos
+ * Equivale a closest_pair_parallel com uma thread.
+ *
+ * @param points Array de pontos (nao alterado)
  * @param n Numero de pontos (deve ser >= 2)
  * @return ClosestPairResult com os dois pontos e a distancia
  *
@@ -89,6 +173,45 @@ typedef struct {
  */
 ClosestPairResult closest_pair(Point2D *points, size_t n);
 
+/**
+ * @brief Par mais proximo com pre-ordenacao radix e metades em paralelo
+ *
+ * Copia os pontos em SoA (x e y em arrays separados) e ordena uma unica
+ * vez por x com radix_sort_kv sobre os bits da coordenada (y vai junto
+ * como valor). A ordem por y nao e pre-calculada: cada chamada devolve o
+ * seu segmento ordenado por y por merge das metades (Shamos & Hoey), de
+ * modo que a faixa central sai de uma varredura sequencial. As metades
+ * acima de 32768 pontos viram tarefas do pool global.
+ *
+ * @param points Array de pontos (nao alterado)
+ * @param n Numero de pontos
+ * @param num_threads Threads (1 = serial; outro valor = pool global)
+ * @return Par e distancia; distance = DBL_MAX se n < 2, em falha de
+ *         alocacao ou com coordenadas NaN
+ *
+ * Complexidade: O(n log n) (O(n) na pre-ordenacao)
+ * Espaco: 32 bytes por ponto (mais o buffer do radix)
+ */
+ClosestPairResult closest_pair_parallel(const Point2D *points, size_t n, size_t num_threads);
+
+/**
+ * @brief Par mais proximo por grade uniforme (O(n) esperado em dados uniformes)
+ *
+ * Distribui os pontos numa grade com ~1 ponto por celula (lado
+ * sqrt(area / n)) por contagem, e compara cada ponto com a sua celula e as
+ * 8 vizinhas. O resultado e exato quando a distancia encontrada nao passa
+ * do lado da celula; senao, ou se a grade ficar concentrada demais (soma
+ * dos quadrados das ocupacoes > 32 n), delega para closest_pair_parallel.
+ *
+ * Complexidade: O(n) esperado para pontos uniformes; O(n log n) no pior
+ * caso (pela delegacao)
+ * Espaco: O(n)
+ *
+ * Referencia: Rabin (1976), "Probabilistic algorithms"; Khuller & Matias
+ * (1995), "A simple randomized sieve algorithm for the closest-pair problem"
+ */
+ClosestPairResult closest_pair_grid(const Point2D *points, size_t n);
+
 // ============================================================================
 // KARATSUBA MULTIPLICATION
 // ============================================================================
@@ -96,8 +219,8 @@ ClosestPairResult closest_pair(Point2D *points, size_t n);
 /**
  * @brief Multiplicacao de inteiros grandes usando Karatsuba
  *
- * Para numeros que cabem em long long. Para numeros maiores,
- * seria necessario BigInteger.
+ * Para numeros que cabem em long long. Para numeros maiores, ver
+ * bigint_multiply (bigint.h), que opera sobre arrays de limbs de 64 bits.
  *
  * @param x Primeiro numero
  * @param y Segundo numero
@@ -148,7 +271,8 @@ MaxSubarrayResult max_subarray_kadane(const int *arr, size_t n);
 /**
  * @brief Encontra o k-esimo menor elemento (0-indexed)
  *
- * Usa particionamento estilo quicksort com pivot aleatorio.
+ * Usa particionamento estilo quicksort com pivot aleatorio. Subarrays de
+ * ate 32 elementos sao ordenados por sort_small_int (rede de ordenacao).
  *
  * @param arr Array de inteiros (sera modificado!)
  * @param n Tamanho do array
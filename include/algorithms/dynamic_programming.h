@@ -28,6 +28,7 @@
 #ifndef DYNAMIC_PROGRAMMING_H
 #define DYNAMIC_PROGRAMMING_H
 
+#include "data_structures/common.h"
 #include <stddef.h>
 #include <stdbool.h>
 
@@ -76,11 +77,29 @@ typedef struct {
  * @param y Segunda string
  * @return size_t Comprimento da LCS
  *
- * Complexidade: O(m*n) tempo e espaco
+ * Complexidade: O(m*n) tempo, O(min(m,n)) espaco
  * Referencia: Cormen S15.4 (pseudocodigo LCS-LENGTH p. 394)
  */
 size_t dp_lcs_length(const char *x, const char *y);
 
+/**
+ * @brief Comprimento da LCS com a tabela percorrida em frente de onda
+ *
+ * A tabela e dividida em blocos de 256 x 256
+ * celulas. Um bloco depende so dos blocos de cima e da esquerda, entao os
+ * blocos de uma mesma anti-diagonal sao independentes e sao repartidos
+ * entre as threads do pool global. Entre blocos so circulam a ultima linha e a
+ * ultima coluna de cada um.
+ *
+ * @param x Primeira string
+ * @param y Segunda string
+ * @param num_threads Threads (0 = ds_get_num_threads(); 1 = serial)
+ * @return size_t Comprimento da LCS (igual a dp_lcs_length)
+ *
+ * Complexidade: O(m*n) trabalho, O(m + n) espaco
+ */
+size_t dp_lcs_length_wavefront(const char *x, const char *y, size_t num_threads);
+
 /**
  * @brief Calcula a LCS com reconstrucao da subsequencia
  *
@@ -93,6 +112,26 @@ size_t dp_lcs_length(const char *x, const char *y);
  */
 LCSResult dp_lcs(const char *x, const char *y);
 
+/**
+ * @brief LCS com reconstrucao em espaco linear (Hirschberg)
+ *
+ * Divide x ao meio, calcula em espaco linear a ultima linha da tabela da
+ * primeira metade (de frente para tras) e da segunda (de tras para frente)
+ * e corta y no ponto em que a soma e maxima; as duas metades sao
+ * resolvidas recursivamente. Substitui dp_lcs quando a tabela completa nao
+ * cabe na memoria. A subsequencia devolvida e uma LCS valida, nao
+ * necessariamente a mesma escolhida por dp_lcs.
+ *
+ * @param x Primeira string
+ * @param y Segunda string
+ * @return LCSResult com comprimento e string da LCS (caller deve liberar sequence)
+ *
+ * Complexidade: O(m*n) tempo (~2x dp_lcs_length), O(min(m,n)) espaco
+ * Referencia: Hirschberg (1975), "A linear space algorithm for computing
+ * maximal common subsequences", CACM 18(6)
+ */
+LCSResult dp_lcs_hirschberg(const char *x, const char *y);
+
 /**
  * @brief Libera memoria de LCSResult
  */
@@ -111,16 +150,26 @@ typedef struct {
     size_t n;
 } KnapsackResult;
 
+/**
+ * @brief Tamanho maximo (bytes) da tabela de decisoes de dp_knapsack; acima
+ *        disso a reconstrucao usa dp_knapsack_linear_space
+ */
+#define DP_KNAPSACK_BITSET_LIMIT ((size_t)1 << 28)
+
 /**
  * @brief Knapsack 0/1 - valor maximo
  *
- * @param weights Array de pesos dos itens
+ * Uma unica linha de valores, atualizada in-place com w decrescente; a
+ * atualizacao max(dp[w], dp[w - peso] + valor) e vetorizada (AVX2, SSE2
+ * ou NEON).
+ *
+ * @param weights Array de pesos dos itens (itens com peso negativo sao ignorados)
  * @param values Array de valores dos itens
  * @param n Numero de itens
  * @param capacity Capacidade da mochila
  * @return int Valor maximo alcancavel
  *
- * Complexidade: O(n*W) tempo e espaco, onde W = capacity
+ * Complexidade: O(n*W) tempo, O(W) espaco, onde W = capacity
  * Referencia: Cormen S16.2 (fracionario); Kleinberg & Tardos (2005) S6.4
  */
 int dp_knapsack_value(const int *weights, const int *values, size_t n, int capacity);
@@ -128,10 +177,30 @@ int dp_knapsack_value(const int *weights, const int *values, size_t n, int capac
 /**
  * @brief Knapsack 0/1 com reconstrucao dos itens selecionados
  *
+ * Guarda so um bit de decisao por celula (o item melhorou dp[w]?), 1/32 da
+ * tabela de int. Se essa tabela passar de DP_KNAPSACK_BITSET_LIMIT ou nao
+ * puder ser alocada, delega para dp_knapsack_linear_space.
+ *
  * @return KnapsackResult (caller deve liberar selected)
+ *
+ * Complexidade: O(n*W) tempo, O(n*W/8) bytes
  */
 KnapsackResult dp_knapsack(const int *weights, const int *values, size_t n, int capacity);
 
+/**
+ * @brief Knapsack 0/1 com reconstrucao em espaco O(W) (divisao de Hirschberg)
+ *
+ * Divide os itens ao meio, calcula a linha de valores de cada metade e
+ * reparte a capacidade no ponto em que a soma e maxima; cada metade e
+ * resolvida recursivamente com sua parte da capacidade. Como em
+ * dp_lcs_hirschberg, a selecao e otima mas pode diferir da de dp_knapsack.
+ *
+ * @return KnapsackResult (caller deve liberar selected)
+ *
+ * Complexidade: O(n*W) tempo (~2x dp_knapsack_value), O(W + n) espaco
+ */
+KnapsackResult dp_knapsack_linear_space(const int *weights, const int *values, size_t n, int capacity);
+
 /**
  * @brief Libera memoria de KnapsackResult
  */
@@ -150,11 +219,54 @@ void dp_knapsack_result_destroy(KnapsackResult *result);
  * @param s2 Segunda string
  * @return size_t Numero minimo de operacoes
  *
- * Complexidade: O(m*n) tempo e espaco
+ * Complexidade: O(m*n) tempo, O(min(m, n)) espaco (duas linhas da tabela)
  * Referencia: Cormen Problem 15-5; Levenshtein (1966)
  */
 size_t dp_edit_distance(const char *s1, const char *s2);
 
+/** Retorno das variantes com comprimento explicito em argumentos invalidos */
+#define DP_EDIT_DISTANCE_ERROR ((size_t)-1)
+
+/**
+ * @brief Distancia de edicao pelo algoritmo bit-paralelo de Myers
+ *
+ * Cada coluna da tabela de DP e representada por vetores de bits com as
+ * diferencas verticais (+1/-1) entre celulas vizinhas; uma coluna inteira
+ * de 64 linhas e atualizada com ~15 operacoes de palavra. A string menor
+ * faz o papel do padrao; acima de 64 bytes ela e dividida em blocos de 64
+ * linhas, com a diferenca horizontal propagada entre blocos (Hyyro).
+ *
+ * @param s1 Primeira sequencia (m bytes, pode conter zeros)
+ * @param m Comprimento de s1
+ * @param s2 Segunda sequencia (n bytes)
+ * @param n Comprimento de s2
+ * @return Distancia, ou DP_EDIT_DISTANCE_ERROR (ponteiro NULL com
+ *         comprimento > 0 ou falha de alocacao)
+ *
+ * Complexidade: O(max(m,n) * ceil(min(m,n) / 64)) tempo,
+ * O(256 * ceil(min(m,n) / 64)) espaco
+ * Referencia: Myers (1999), "A fast bit-vector algorithm for approximate
+ * string matching based on dynamic programming"; Hyyro (2003)
+ */
+size_t dp_edit_distance_myers(const char *s1, size_t m, const char *s2, size_t n);
+
+/**
+ * @brief Distancia de edicao limitada a k (DP em faixa de Ukkonen)
+ *
+ * So as diagonais |i - j| <= k podem ter valor <= k; as demais sao
+ * tratadas como infinito. A busca termina assim que todas as celulas de
+ * uma linha passam de k: para pares muito diferentes o custo e
+ * proporcional ao prefixo ate o descarte, nao ao produto dos tamanhos.
+ *
+ * @param k Limite
+ * @return Distancia se <= k, senao k + 1; DP_EDIT_DISTANCE_ERROR em
+ *         argumentos invalidos ou falha de alocacao
+ *
+ * Complexidade: O(k * max(m,n)) tempo, O(min(m,n)) espaco
+ * Referencia: Ukkonen (1985), "Algorithms for approximate string matching"
+ */
+size_t dp_edit_distance_bounded(const char *s1, size_t m, const char *s2, size_t n, size_t k);
+
 // ============================================================================
 // LIS - Longest Increasing Subsequence
 // ============================================================================
@@ -181,12 +293,51 @@ typedef struct {
 size_t dp_lis_length(const int *arr, size_t n);
 
 /**
- * @brief LIS com reconstrucao (O(n^2))
+ * @brief LIS (estritamente crescente) com reconstrucao
+ *
+ * Patience sorting: para cada comprimento k guarda o indice do menor final
+ * de uma subsequencia crescente de comprimento k (busca binaria sobre esses
+ * finais) e, para cada elemento, o indice do seu predecessor; a LIS e
+ * refeita seguindo os predecessores a partir do ultimo final.
  *
  * @return LISResult (caller deve liberar sequence)
+ *
+ * Complexidade: O(n log n) tempo, O(n) espaco
+ * Referencia: Fredman (1975); Aldous & Diaconis (1999), "Longest increasing
+ * subsequences: from patience sorting to the Baik-Deift-Johansson theorem"
  */
 LISResult dp_lis(const int *arr, size_t n);
 
+/**
+ * @brief Maior subsequencia nao decrescente (repeticoes permitidas)
+ *
+ * Igual a dp_lis, com a busca binaria pelo primeiro final estritamente
+ * maior (upper bound) em vez do primeiro maior ou igual.
+ *
+ * @return LISResult (caller deve liberar sequence)
+ *
+ * Complexidade: O(n log n) tempo, O(n) espaco
+ */
+LISResult dp_lis_non_decreasing(const int *arr, size_t n);
+
+/**
+ * @brief LIS sobre registros arbitrarios com funcao de comparacao
+ *
+ * @param base Array de n registros de elem_size bytes
+ * @param n Numero de registros
+ * @param elem_size Tamanho de cada registro
+ * @param cmp Ordem dos registros
+ * @param strict true: crescente (cmp < 0 entre vizinhos); false: nao
+ *        decrescente (cmp <= 0)
+ * @param indices Saida opcional (n posicoes): indices dos registros da
+ *        subsequencia, em ordem crescente; NULL calcula so o comprimento
+ * @return Comprimento (0 em argumentos invalidos ou falha de alocacao)
+ *
+ * Complexidade: O(n log n) comparacoes, O(n) espaco
+ */
+size_t dp_lis_generic(const void *base, size_t n, size_t elem_size, CompareFn cmp,
+                      bool strict, size_t *indices);
+
 /**
  * @brief Libera memoria de LISResult
  */
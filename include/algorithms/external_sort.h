@@ -0,0 +1,92 @@
+/**
+ * @file external_sort.h
+ * @brief Ordenacao externa (merge sort em disco) de registros de tamanho fixo
+ *
+ * Para arquivos maiores que a memoria disponivel:
+ *
+ * 1. Geracao de runs: le blocos de ate memory_bytes, ordena cada bloco em
+ *    memoria (parallel_sample_sort) e grava como um run temporario. Com
+ *    read_ahead, a gravacao do run i e a leitura do bloco i+1 acontecem em
+ *    paralelo (duas tarefas do pool global sobre metades do orcamento).
+ * 2. Merge k-way: uma arvore de perdedores (loser tree) escolhe o menor
+ *    registro entre k runs com ceil(log2 k) comparacoes por registro. Cada
+ *    run e lido em blocos de io_buffer_bytes e a saida e gravada em blocos
+ *    do mesmo tamanho (E/S sequencial grande). Acima de max_fan_in runs,
+ *    passes intermediarios juntam grupos de runs ate restarem max_fan_in.
+ *
+ * Um arquivo que cabe num unico bloco e ordenado em memoria e gravado
+ * direto na saida, sem runs temporarios.
+ *
+ * Uso:
+ * @code
+ * ExternalSortConfig config = external_sort_default_config();
+ * config.memory_bytes = 4ull << 30;           // 4 GB por run
+ * config.temp_dir = "/scratch";
+ * bool ok = external_sort("trace.bin", "trace.sorted", sizeof(TraceRecord),
+ *                         compare_trace, &config, NULL);
+ * @endcode
+ *
+ * Referencias:
+ * - Knuth (1998), TAOCP Vol 3, S5.4 (External Sorting)
+ * - Graefe, G. (2006). "Implementing Sorting in Database Systems". ACM
+ *   Computing Surveys 38(3)
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#include "data_structures/common.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Parametros da ordenacao externa
+ */
+typedef struct {
+    size_t memory_bytes;        /**< Memoria para ordenar cada run (padrao 256 MB) */
+    size_t io_buffer_bytes;     /**< Buffer de leitura por run e de escrita no merge (padrao 1 MB) */
+    size_t max_fan_in;          /**< Maximo de runs por merge (padrao 128, minimo 2) */
+    size_t num_threads;         /**< Threads da ordenacao dos runs (0 = todas) */
+    bool read_ahead;            /**< Le o proximo bloco enquanto grava o run atual */
+    const char *temp_dir;       /**< Diretorio dos runs (NULL = ao lado da saida) */
+} ExternalSortConfig;
+
+/**
+ * @brief Estatisticas de uma ordenacao externa
+ */
+typedef struct {
+    size_t records;             /**< Registros ordenados */
+    size_t runs;                /**< Runs iniciais gerados (1 = ordenado em memoria) */
+    size_t merge_passes;        /**< Passes de merge (0 quando runs == 1) */
+} ExternalSortStats;
+
+/**
+ * @brief Configuracao padrao
+ */
+ExternalSortConfig external_sort_default_config(void);
+
+/**
+ * @brief Ordena um arquivo de registros de record_size bytes
+ *
+ * @param input_path Arquivo de entrada (tamanho multiplo de record_size)
+ * @param output_path Arquivo de saida (sobrescrito; deve ser diferente da entrada)
+ * @param record_size Tamanho de cada registro em bytes
+ * @param cmp Comparacao entre registros
+ * @param config Parametros (NULL = external_sort_default_config())
+ * @param stats Estatisticas de saida (pode ser NULL)
+ * @return true em sucesso; false se algum argumento for invalido, a
+ *         entrada terminar num registro parcial, ou houver falha de E/S ou
+ *         de alocacao (os runs temporarios sao removidos em qualquer caso)
+ *
+ * Complexidade: O(n log n) comparacoes; E/S de 2 * (1 + passes) * tamanho
+ * Espaco: memory_bytes + (fan_in + 1) * io_buffer_bytes
+ * Estavel: Nao
+ */
+bool external_sort(const char *input_path, const char *output_path,
+                   size_t record_size, CompareFn cmp,
+                   const ExternalSortConfig *config, ExternalSortStats *stats);
+
+#endif // EXTERNAL_SORT_H
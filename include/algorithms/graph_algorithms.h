@@ -22,10 +22,31 @@
 
 #include "data_structures/graph.h"
 #include <stddef.h>
+#include <stdint.h>
 #include <float.h>
 
 #define GRAPH_INFINITY DBL_MAX
 #define GRAPH_NO_PARENT ((size_t)-1)
+#define GRAPH_UNREACHED ((size_t)-1)
+#define GRAPH_INFINITY_F FLT_MAX
+#define GRAPH_NO_NEXT UINT32_MAX
+
+/**
+ * @brief Precisao da matriz do Floyd-Warshall em blocos
+ */
+typedef enum {
+    APSP_DOUBLE,           /**< 8 bytes por par */
+    APSP_FLOAT             /**< 4 bytes por par (metade da memoria) */
+} APSPPrecision;
+
+/**
+ * @brief Estrategia de selecao do proximo vertice no Dijkstra
+ */
+typedef enum {
+    DIJKSTRA_AUTO,         /**< Escolhe pela densidade (E vs V^2 / log V) */
+    DIJKSTRA_DENSE,        /**< Varredura linear O(V^2) - grafos densos */
+    DIJKSTRA_BINARY_HEAP   /**< Heap binario indexado O((V+E) log V) - esparsos */
+} DijkstraStrategy;
 
 /**
  * @brief Resultado de shortest path (single-source)
@@ -46,6 +67,22 @@ typedef struct {
     size_t num_vertices;
 } AllPairsResult;
 
+/**
+ * @brief Resultado de all-pairs em matriz contigua (linha i em [i * stride])
+ *
+ * Exatamente um entre dist e dist_f e nao nulo, conforme a precisao.
+ * Pares sem caminho valem GRAPH_INFINITY (double) ou GRAPH_INFINITY_F
+ * (float). stride e num_vertices arredondado para o tamanho do bloco.
+ */
+typedef struct {
+    double *dist;
+    float *dist_f;
+    uint32_t *next;        /**< Proximo vertice de i para j (GRAPH_NO_NEXT); NULL sem caminhos */
+    size_t num_vertices;
+    size_t stride;
+    bool has_negative_cycle;
+} AllPairsMatrix;
+
 /**
  * @brief Aresta para MST
  */
@@ -64,9 +101,46 @@ typedef struct {
     double total_weight;
 } MSTResult;
 
+/**
+ * @brief Resultado de BFS (distancias em numero de arcos)
+ */
+typedef struct {
+    size_t *dist;          /**< GRAPH_UNREACHED se nao alcancado */
+    size_t *parent;        /**< GRAPH_NO_PARENT na origem e nos nao alcancados */
+    size_t num_vertices;
+    size_t num_reached;    /**< Vertices com dist finita (inclui a origem) */
+} BFSResult;
+
+/**
+ * @brief Resultado do PageRank (rank soma 1)
+ *
+ * Exatamente um entre rank e rank_f e nao nulo, conforme a precisao.
+ */
+typedef struct {
+    double *rank;
+    float *rank_f;
+    size_t num_vertices;
+    size_t iterations;     /**< Iteracoes executadas */
+    double residual;       /**< Norma L1 da mudanca na ultima iteracao */
+    bool converged;        /**< residual < tolerancia antes de max_iterations */
+} PageRankResult;
+
+/**
+ * @brief Componentes fortemente conexos (component[v] em 0 .. num_components - 1)
+ */
+typedef struct {
+    size_t *component;
+    size_t num_vertices;
+    size_t num_components;
+} SCCResult;
+
 void shortest_path_free(ShortestPathResult *result);
 void all_pairs_free(AllPairsResult *result);
+void all_pairs_matrix_free(AllPairsMatrix *result);
 void mst_free(MSTResult *result);
+void bfs_free(BFSResult *result);
+void scc_free(SCCResult *result);
+void pagerank_free(PageRankResult *result);
 
 // ============================================================================
 // CAMINHOS MINIMOS - SINGLE SOURCE
@@ -90,10 +164,30 @@ void mst_free(MSTResult *result);
  * @param source Vertice origem
  * @return ShortestPathResult* Distancias e predecessores (caller libera)
  *
+ * Equivale a dijkstra_with_strategy(graph, source, DIJKSTRA_AUTO).
+ *
  * Complexidade: O((V+E) log V) com min-heap
  */
 ShortestPathResult* dijkstra(const Graph *graph, Vertex source);
 
+/**
+ * @brief Dijkstra com estrategia explicita de fila de prioridade
+ *
+ * DIJKSTRA_DENSE varre todos os vertices a cada EXTRACT-MIN (O(V^2)),
+ * o que e otimo para matrizes de adjacencia. DIJKSTRA_BINARY_HEAP usa
+ * um heap binario com mapa de posicoes para DECREASE-KEY em O(log V).
+ * DIJKSTRA_AUTO escolhe o heap quando E * log2(V) < V^2.
+ *
+ * @param graph Grafo (pesos >= 0)
+ * @param source Vertice origem
+ * @param strategy Estrategia de selecao
+ * @return ShortestPathResult* Distancias e predecessores (caller libera)
+ *
+ * Complexidade: O(V^2) denso, O((V+E) log V) heap
+ */
+ShortestPathResult* dijkstra_with_strategy(const Graph *graph, Vertex source,
+                                           DijkstraStrategy strategy);
+
 /**
  * @brief Bellman-Ford - Caminho minimo com pesos negativos
  *
@@ -116,6 +210,31 @@ ShortestPathResult* dijkstra(const Graph *graph, Vertex source);
  */
 ShortestPathResult* bellman_ford(const Graph *graph, Vertex source);
 
+/**
+ * @brief Bellman-Ford com fila (SPFA)
+ *
+ * Em vez de V - 1 passadas sobre todas as arestas, mantem uma fila FIFO
+ * (Queue) dos vertices cuja distancia caiu; so os arcos deles sao
+ * relaxados de novo, e um vertice nunca aparece duas vezes na fila. Para
+ * quando a fila esvazia. Ciclo negativo alcancavel: detectado quando o
+ * caminho ate algum vertice passa a ter V arcos (busca interrompida e
+ * has_negative_cycle = true, como no bellman_ford).
+ *
+ * Em grafos com poucas arestas negativas cada vertice entra na fila poucas
+ * vezes, perto do custo do Dijkstra; o pior caso segue O(V * E). Roda
+ * sobre um snapshot CSR do grafo (bellman_ford_spfa_csr), montado e
+ * liberado internamente.
+ *
+ * @param graph Grafo (pode ter pesos negativos)
+ * @param source Vertice origem
+ * @return ShortestPathResult* (has_negative_cycle = true se ciclo negativo)
+ *
+ * Complexidade: O(V * E) pior caso, O(E) tipico
+ * Referencia: Moore, E. F. (1959). "The shortest path through a maze";
+ * Duan, F. (1994) "SPFA"
+ */
+ShortestPathResult* bellman_ford_spfa(const Graph *graph, Vertex source);
+
 // ============================================================================
 // CAMINHOS MINIMOS - ALL PAIRS
 // ============================================================================
@@ -141,6 +260,37 @@ ShortestPathResult* bellman_ford(const Graph *graph, Vertex source);
  */
 AllPairsResult* floyd_warshall(const Graph *graph);
 
+/**
+ * @brief Floyd-Warshall em blocos, paralelo, sobre matriz contigua
+ *
+ * A matriz e dividida em blocos de 64 x 64. Para cada bloco diagonal k:
+ * (1) o proprio bloco (k, k) roda o Floyd-Warshall classico; (2) os blocos
+ * da linha k e da coluna k sao atualizados a partir dele, em paralelo;
+ * (3) todos os demais blocos (i, j) recebem o produto min-plus
+ * (i, k) x (k, j), em paralelo. Na fase 3, que domina o custo, os tres
+ * blocos sao distintos e cabem no cache; o laco interno e um min(c, a + b)
+ * sem desvios, vetorizado (AVX2 quando a CPU suporta).
+ *
+ * As distancias sao as do floyd_warshall (a menos de arredondamento: as
+ * somas sao associadas em outra ordem); em empates, next pode apontar
+ * outro caminho minimo. Aceita pesos negativos; has_negative_cycle indica
+ * dist[i][i] < 0 (nesse caso as distancias nao tem significado).
+ *
+ * @param graph Grafo
+ * @param precision APSP_DOUBLE ou APSP_FLOAT
+ * @param with_paths Se true, mantem a matriz next para reconstruir caminhos
+ * @param num_threads Threads (0 = ds_get_num_threads(), 1 = serial)
+ * @return AllPairsMatrix* Resultado (liberar com all_pairs_matrix_free) ou
+ *         NULL (sem memoria, ou with_paths com V >= 2^32 - 1)
+ *
+ * Complexidade: O(V^3) trabalho, O(V^3 / B) acessos a memoria (B = 64)
+ * Espaco: stride^2 distancias (+ stride^2 uint32_t com caminhos)
+ * Referencia: Venkataraman, G., Sahni, S. & Mukhopadhyaya, S. (2003).
+ * "A Blocked All-Pairs Shortest-Paths Algorithm". ACM JEA 8
+ */
+AllPairsMatrix* floyd_warshall_blocked(const Graph *graph, APSPPrecision precision,
+                                       bool with_paths, size_t num_threads);
+
 // ============================================================================
 // ARVORE GERADORA MINIMA (MST)
 // ============================================================================
@@ -160,10 +310,14 @@ AllPairsResult* floyd_warshall(const Graph *graph);
  *           UNION(u, v)
  *   return A
  *
+ * As arestas sao ordenadas por radix sort LSD sobre os bits do peso
+ * (radix_sort_kv, RADIX_KEY_DOUBLE) a partir de 1024 arestas; o
+ * Union-Find usa path halving e union by rank.
+ *
  * @param graph Grafo nao-direcionado ponderado
  * @return MSTResult* Arestas da MST (caller libera)
  *
- * Complexidade: O(E log E)
+ * Complexidade: O(E) para ordenar (8 passos de radix) + O(E alpha(V))
  */
 MSTResult* kruskal(const Graph *graph);
 
@@ -191,4 +345,412 @@ MSTResult* kruskal(const Graph *graph);
  */
 MSTResult* prim(const Graph *graph);
 
+// ============================================================================
+// VARIANTES SOBRE SNAPSHOT CSR (graph_freeze)
+// ============================================================================
+
+/**
+ * @brief Dijkstra sobre snapshot CSR (heap binario indexado)
+ *
+ * Le pesos diretamente do array contiguo, sem alocacao por vizinho.
+ *
+ * Complexidade: O((V+E) log V)
+ */
+ShortestPathResult* dijkstra_csr(const CSRGraph *csr, Vertex source);
+
+/**
+ * @brief Bellman-Ford sobre snapshot CSR
+ *
+ * Relaxa todos os arcos armazenados (ambos os sentidos em grafos
+ * nao-direcionados), com parada antecipada quando nada muda.
+ *
+ * Complexidade: O(V * E)
+ */
+ShortestPathResult* bellman_ford_csr(const CSRGraph *csr, Vertex source);
+
+/**
+ * @brief SPFA sobre snapshot CSR (mesma semantica de bellman_ford_spfa)
+ *
+ * Complexidade: O(V * E) pior caso
+ */
+ShortestPathResult* bellman_ford_spfa_csr(const CSRGraph *csr, Vertex source);
+
+/**
+ * @brief Delta-stepping paralelo sobre snapshot CSR
+ *
+ * Vertices ficam em baldes de largura delta pela distancia provisoria
+ * (floor(dist / delta)). O menor balde nao vazio vira a fronteira e seus
+ * arcos sao relaxados em paralelo; cada relaxacao e um minimo atomico
+ * (CAS relaxado) sobre a distancia e o vertice melhorado vai para os
+ * baldes locais da thread, sem fila compartilhada. O balde atual e
+ * reprocessado ate esvaziar e entao se passa ao proximo. Delta pequeno
+ * se aproxima do Dijkstra; grande, do Bellman-Ford.
+ *
+ * As distancias sao as do Dijkstra (a menos de arredondamento em somas de
+ * ordem diferente). Os pais sao recalculados no fim a partir delas: o menor
+ * u com dist[u] + w(u,v) == dist[v], logo o resultado e deterministico.
+ *
+ * @param csr Snapshot com pesos nao negativos
+ * @param source Vertice de origem
+ * @param delta Largura do balde (<= 0: peso maximo / grau medio)
+ * @param num_threads Threads (0 = ds_get_num_threads(), 1 = serial)
+ * @return ShortestPathResult* Mesmo formato do dijkstra_csr, ou NULL com
+ *         pesos negativos ou sem memoria (delta muito pequeno diante dos
+ *         pesos cria muitos baldes)
+ *
+ * Complexidade: O(V + E + L/delta) trabalho esperado em grafos de grau
+ * limitado com pesos aleatorios, L = maior distancia
+ * Referencia: Meyer, U. & Sanders, P. (2003). "Delta-stepping: a
+ * parallelizable shortest path algorithm". J. Algorithms 49(1)
+ */
+ShortestPathResult* delta_stepping_csr(const CSRGraph *csr, Vertex source, double delta,
+                                       size_t num_threads);
+
+/**
+ * @brief Kruskal sobre snapshot CSR (arestas em radix sort, como kruskal)
+ *
+ * Complexidade: O(E alpha(V))
+ */
+MSTResult* kruskal_csr(const CSRGraph *csr);
+
+/**
+ * @brief Filter-Kruskal sobre snapshot CSR
+ *
+ * Particiona as arestas em tres pelo peso de um pivo aleatorio, resolve as
+ * leves recursivamente, e so entao filtra as pesadas: as que ja ligam
+ * vertices conectados saem antes de serem ordenadas. Em grafos em que a
+ * MST usa as arestas leves, a maior parte das pesadas nunca e ordenada.
+ * Particoes de ate 4096 arestas vao direto para o Kruskal.
+ *
+ * Complexidade: O(E + V log V log(E/V)) esperado em grafos aleatorios
+ * Referencia: Osipov, V., Sanders, P. & Singler, J. (2009). "The
+ * Filter-Kruskal Minimum Spanning Tree Algorithm". ALENEX
+ */
+MSTResult* filter_kruskal_csr(const CSRGraph *csr);
+
+/**
+ * @brief Boruvka paralelo sobre snapshot CSR
+ *
+ * Cada rodada: (1) em paralelo por vertice, a aresta minima para fora da
+ * sua componente; (2) vertices agrupados por componente (contagem) e
+ * reducao paralela por componente, sem atomicos; (3) cada componente se
+ * pendura na do outro lado da sua aresta; empates de peso sao
+ * desfeitos pelas pontas, entao os unicos ciclos sao pares, quebrados pela
+ * componente de menor indice; (4) raizes por compressao de caminho e
+ * renumeracao. O numero de componentes ao menos cai pela metade por
+ * rodada.
+ *
+ * @param csr Snapshot (digrafos: arcos tratados como arestas)
+ * @param num_threads Threads (0 = ds_get_num_threads(), 1 = serial)
+ * @return MSTResult* Floresta geradora minima (caller libera)
+ *
+ * Complexidade: O((V + E) log V) trabalho, O(log V) rodadas
+ * Referencia: Boruvka, O. (1926); Chung, S. & Condon, A. (1996).
+ * "Parallel Implementation of Boruvka's Minimum Spanning Tree Algorithm". IPPS
+ */
+MSTResult* boruvka_csr(const CSRGraph *csr, size_t num_threads);
+
+/**
+ * @brief Prim sobre snapshot CSR (heap binario indexado)
+ *
+ * Complexidade: O((V+E) log V)
+ */
+MSTResult* prim_csr(const CSRGraph *csr);
+
+/**
+ * @brief BFS paralela com troca de direcao (top-down / bottom-up)
+ *
+ * BFS sincronizada por nivel. Top-down: as threads repartem a fila da
+ * fronteira e reivindicam cada vizinho novo com um CAS na distancia.
+ * Bottom-up: cada vertice ainda nao visitado procura, entre seus
+ * predecessores, algum na fronteira (bitmap de 64 bits por palavra) e para
+ * no primeiro; cada thread escreve palavras inteiras do proximo bitmap, sem
+ * atomicos. Passa para bottom-up quando os arcos da fronteira superam 1/15
+ * dos arcos ainda nao explorados, e volta quando a fronteira cai abaixo de
+ * V/18 e diminuindo. Em digrafos, a transposta e montada so se o
+ * bottom-up for usado.
+ *
+ * As distancias sao sempre as da BFS serial; com mais de uma thread, o pai
+ * escolhido entre os da camada anterior pode variar de uma execucao a outra.
+ *
+ * @param csr Snapshot CSR
+ * @param source Vertice de origem
+ * @param num_threads Threads (0 = ds_get_num_threads(), 1 = serial)
+ * @return BFSResult* Distancias e pais (liberar com bfs_free) ou NULL
+ *
+ * Complexidade: O(V + E) trabalho
+ * Referencia: Beamer, S., Asanovic, K. & Patterson, D. (2012).
+ * "Direction-Optimizing Breadth-First Search". SC
+ */
+BFSResult* bfs_csr(const CSRGraph *csr, Vertex source, size_t num_threads);
+
+/**
+ * @brief Componentes fortemente conexos em paralelo
+ *
+ * Tres fases, todas com laços ds_parallel_for e atomicos sobre arrays planos:
+ * - Trim: vertices sem arco de entrada ou de saida para outro vertice
+ *   ativo sao componentes unitarios (repetido ate SCC_TRIM_ROUNDS vezes)
+ * - Forward-backward: a partir do vertice de maior grau, BFS para frente e
+ *   para tras; a intersecao e o componente do pivo (em geral o gigante)
+ * - Coloracao: cada vertice ativo recebe o maior vertice que o alcanca
+ *   (propagacao ate ponto fixo); cada raiz (cor == proprio indice) fecha
+ *   seu componente com uma BFS reversa restrita a sua cor
+ *
+ * A particao e a mesma do graph_csr_strongly_connected_components; os
+ * componentes sao numerados pela ordem do menor vertice de cada um, o que
+ * independe do numero de threads. Em digrafos monta a transposta.
+ *
+ * @param csr Snapshot CSR
+ * @param num_threads Threads (0 = ds_get_num_threads(), 1 = serial)
+ * @return SCCResult* (liberar com scc_free) ou NULL
+ *
+ * Complexidade: O(V + E) por rodada de coloracao; o numero de rodadas
+ * depende da estrutura do grafo condensado
+ * Referencias: Fleischer, L., Hendrickson, B. & Pinar, A. (2000). "On
+ * Identifying Strongly Connected Components in Parallel". IPDPS
+ * Workshops; Orzan, S. (2004). "On Distributed Verification and Verified
+ * Distribution". PhD thesis; Hong, S., Rodia, N. C. & Olukotun, K.
+ * (2013). "On Fast Parallel Detection of Strongly Connected Components
+ * (SCC) in Small-World Graphs". SC
+ */
+SCCResult* scc_csr_parallel(const CSRGraph *csr, size_t num_threads);
+
+// ============================================================================
+// CAMINHO MINIMO PONTO A PONTO (SOBRE SNAPSHOT CSR)
+// ============================================================================
+
+/**
+ * @brief Heuristica do A*: estimativa de dist(v, target)
+ *
+ * Deve ser consistente: h(u) <= w(u, v) + h(v) para todo arco e h(target) = 0
+ * (ex.: distancia euclidiana quando os pesos sao comprimentos). Com uma
+ * heuristica apenas admissivel o caminho devolvido pode nao ser minimo.
+ */
+typedef double (*PathHeuristicFn)(Vertex v, Vertex target, void *user_data);
+
+/**
+ * @brief Espaco de trabalho reutilizavel entre consultas origem-destino
+ *
+ * Guarda distancias, pais, heaps e marcas de visita das duas direcoes.
+ * Cada entrada so vale se sua marca for a da consulta atual, entao uma
+ * consulta custa so o que visita, sem inicializacao O(V). O snapshot
+ * precisa viver mais que o espaco de trabalho; um espaco de trabalho nao
+ * pode ser usado por duas threads ao mesmo tempo.
+ */
+typedef struct PathSearch PathSearch;
+
+/**
+ * @brief Cria o espaco de trabalho para consultas sobre csr
+ *
+ * Em digrafos monta tambem a transposta (arcos de entrada), usada pela
+ * busca reversa do Dijkstra bidirecional.
+ *
+ * @return PathSearch* ou NULL (csr NULL, peso negativo ou falha de alocacao)
+ *
+ * Complexidade: O(V + E)
+ */
+PathSearch* path_search_create(const CSRGraph *csr);
+
+void path_search_destroy(PathSearch *search);
+
+/**
+ * @brief Dijkstra bidirecional de source ate target
+ *
+ * Alterna entre a busca a partir de source e a busca reversa a partir de
+ * target, expandindo o lado de menor chave no topo. mu guarda o melhor
+ * dist_f(v) + dist_b(v) visto ao relaxar arcos; para quando a soma dos
+ * dois topos alcanca mu.
+ *
+ * @return Distancia minima; GRAPH_INFINITY se target nao e alcancavel ou
+ *         os argumentos sao invalidos
+ *
+ * Complexidade: O((V + E) log V) no pior caso; na pratica cada lado
+ * visita so uma bola em volta de sua ponta
+ * Referencia: Pohl, I. (1971). "Bi-directional Search". Machine
+ * Intelligence 6; Goldberg, A. V. & Harrelson, C. (2005). SODA
+ */
+double path_search_bidirectional(PathSearch *search, Vertex source, Vertex target);
+
+/**
+ * @brief A* de source ate target
+ *
+ * Dijkstra com chave dist(v) + h(v); para ao retirar target do heap.
+ * h e avaliada uma vez por vertice tocado; heuristic NULL vira h = 0
+ * (Dijkstra com parada antecipada).
+ *
+ * @return Distancia minima; GRAPH_INFINITY se target nao e alcancavel ou
+ *         os argumentos sao invalidos
+ *
+ * Complexidade: O((V + E) log V) no pior caso
+ * Referencia: Hart, P. E., Nilsson, N. J. & Raphael, B. (1968). "A Formal
+ * Basis for the Heuristic Determination of Minimum Cost Paths". IEEE SSC 4(2)
+ */
+double path_search_astar(PathSearch *search, Vertex source, Vertex target,
+                         PathHeuristicFn heuristic, void *user_data);
+
+/**
+ * @brief Caminho encontrado pela ultima consulta (source ... target)
+ *
+ * @param path Saida; so e escrita se capacity bastar
+ * @return Numero de vertices do caminho (0 se a ultima consulta nao achou)
+ */
+size_t path_search_path(const PathSearch *search, Vertex *path, size_t capacity);
+
+/**
+ * @brief Vertices retirados do heap na ultima consulta (ambos os lados)
+ */
+size_t path_search_settled(const PathSearch *search);
+
+// ============================================================================
+// CONTRACTION HIERARCHIES
+// ============================================================================
+
+/** Vertices assentados por busca de testemunha antes de desistir (cria o atalho) */
+#define CH_WITNESS_SETTLE_LIMIT 500
+
+/**
+ * @brief Hierarquia de contracao: grafos "para cima" e "para baixo" em CSR
+ *
+ * Inclui o espaco de trabalho das consultas (mesmo esquema de marcas do
+ * PathSearch), entao uma hierarquia nao pode ser consultada por duas
+ * threads ao mesmo tempo. Nao guarda referencia ao snapshot de origem.
+ */
+typedef struct ContractionHierarchy ContractionHierarchy;
+
+/**
+ * @brief Pre-processa csr em uma hierarquia de contracao
+ *
+ * Contrai os vertices um a um, em ordem crescente de prioridade
+ * (diferenca de arestas: atalhos criados - arcos removidos, mais o numero
+ * de vizinhos ja contraidos), com atualizacao preguicosa: o topo do heap e
+ * reavaliado e so e contraido se continuar minimo. Ao contrair v, cada par
+ * u -> v -> x ganha um atalho u -> x, a menos que uma busca de testemunha
+ * (Dijkstra local a partir de u que ignora v, limitada por w(u,v) + w(v,x)
+ * e por CH_WITNESS_SETTLE_LIMIT vertices) ache caminho tao curto quanto.
+ * Os arcos de v para vizinhos ainda nao contraidos (mais altos na ordem)
+ * formam o grafo para cima (saida) e para baixo (entrada).
+ *
+ * Arcos paralelos ficam so com o menor peso; auto-lacos sao descartados.
+ *
+ * @return ContractionHierarchy* ou NULL (csr NULL, peso negativo ou falha
+ *         de alocacao)
+ *
+ * Referencia: Geisberger, R., Sanders, P., Schultes, D. & Delling, D.
+ * (2008). "Contraction Hierarchies: Faster and Simpler Hierarchical
+ * Routing in Road Networks". WEA
+ */
+ContractionHierarchy* contraction_hierarchy_build(const CSRGraph *csr);
+
+void contraction_hierarchy_destroy(ContractionHierarchy *ch);
+
+/**
+ * @brief Distancia minima de source ate target na hierarquia
+ *
+ * Dijkstra bidirecional em que cada lado so sobe na ordem de contracao
+ * (origem pelos arcos para cima, destino pelos arcos para baixo); cada
+ * lado para quando seu topo alcanca a melhor soma vista.
+ *
+ * @return Distancia; GRAPH_INFINITY se target nao e alcancavel ou os
+ *         argumentos sao invalidos
+ */
+double contraction_hierarchy_query(ContractionHierarchy *ch, Vertex source, Vertex target);
+
+/**
+ * @brief Caminho da ultima consulta no grafo original (atalhos expandidos)
+ *
+ * @param path Saida; so e escrita se capacity bastar
+ * @return Numero de vertices do caminho (0 se a ultima consulta nao achou)
+ */
+size_t contraction_hierarchy_path(const ContractionHierarchy *ch, Vertex *path, size_t capacity);
+
+/**
+ * @brief Atalhos adicionados no pre-processamento
+ */
+size_t contraction_hierarchy_num_shortcuts(const ContractionHierarchy *ch);
+
+/**
+ * @brief Vertices retirados dos heaps na ultima consulta
+ */
+size_t contraction_hierarchy_settled(const ContractionHierarchy *ch);
+
+// ============================================================================
+// CONSTRUCAO EM LOTE A PARTIR DE LISTA DE ARESTAS
+// ============================================================================
+
+/**
+ * @brief Monta o snapshot CSR direto de uma lista de arestas, em paralelo
+ *
+ * Counting sort pela origem: graus contados com incrementos atomicos (so
+ * com mais de uma thread), offsets por soma de prefixos em blocos e cada
+ * arco espalhado na posicao reservada na sua linha. Cada linha e entao
+ * ordenada por (destino, peso), o que torna o resultado independente do
+ * numero de threads. Nao passa pelas listas ligadas do Graph.
+ *
+ * Grafos nao-direcionados recebem os dois sentidos de cada aresta
+ * (auto-lacos uma vez), como graph_freeze().
+ *
+ * @param edges Arestas (src, dest, weight)
+ * @param m Numero de arestas
+ * @param num_vertices Vertices; extremos >= num_vertices dao NULL
+ * @param type Direcionado ou nao
+ * @param dedup Funde arestas repetidas, mantendo o menor peso
+ * @param drop_self_loops Descarta arestas (v, v)
+ * @param num_threads Threads (0 = ds_get_num_threads(), 1 = serial)
+ * @return CSRGraph* (liberar com graph_csr_destroy) ou NULL
+ *
+ * Complexidade: O(V + m) mais a ordenacao das linhas, O(m log grau max)
+ */
+CSRGraph* graph_build_from_edges(const Edge *edges, size_t m, size_t num_vertices,
+                                 GraphType type, bool dedup, bool drop_self_loops,
+                                 size_t num_threads);
+
+// ============================================================================
+// PAGERANK E SpMV (SOBRE SNAPSHOT CSR)
+// ============================================================================
+
+/**
+ * @brief y = A x, com A[u][v] = peso do arco u -> v (produto por linha)
+ *
+ * Cada thread escreve so as suas linhas de y: sem atomicos nem reducao.
+ *
+ * @param x Vetor de entrada (V posicoes)
+ * @param y Saida (V posicoes, nao pode sobrepor x)
+ * @param num_threads Threads (0 = ds_get_num_threads(), 1 = serial)
+ * @return false em argumentos NULL
+ *
+ * Complexidade: O(V + A)
+ */
+bool spmv_csr(const CSRGraph *csr, const double *x, double *y, size_t num_threads);
+
+/**
+ * @brief spmv_csr com vetores float (pesos convertidos para float)
+ */
+bool spmv_csr_f(const CSRGraph *csr, const float *x, float *y, size_t num_threads);
+
+/**
+ * @brief PageRank por iteracao de potencia no modelo pull
+ *
+ * Cada vertice soma as contribuicoes rank[u] / grau_saida(u) dos seus
+ * predecessores, sem escrita concorrente; os digrafos montam a transposta
+ * uma vez. Vertices sem arco de saida (dangling) distribuem seu rank
+ * uniformemente. Pesos sao ignorados; arcos repetidos contam repetidos.
+ *
+ * rank'(v) = (1 - d) / V + d * (D / V + soma_{u -> v} rank(u) / grau(u))
+ *
+ * @param damping Fator d em [0, 1] (usual: 0.85)
+ * @param tolerance Para quando a norma L1 da mudanca fica abaixo disto
+ * @param max_iterations Limite de iteracoes
+ * @param precision APSP_DOUBLE ou APSP_FLOAT (metade da memoria por vetor)
+ * @param num_threads Threads (0 = ds_get_num_threads(), 1 = serial)
+ * @return PageRankResult* (liberar com pagerank_free) ou NULL (argumentos
+ *         invalidos, grafo vazio ou sem memoria)
+ *
+ * Complexidade: O(V + A) por iteracao
+ * Referencia: Page, L., Brin, S., Motwani, R. & Winograd, T. (1999). "The
+ * PageRank Citation Ranking: Bringing Order to the Web". Stanford InfoLab
+ */
+PageRankResult* pagerank_csr(const CSRGraph *csr, double damping, double tolerance,
+                             size_t max_iterations, APSPPrecision precision,
+                             size_t num_threads);
+
 #endif // GRAPH_ALGORITHMS_H
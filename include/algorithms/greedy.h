@@ -21,6 +21,7 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 // ============================================================================
 // ACTIVITY SELECTION
@@ -99,6 +100,110 @@ HuffmanResult greedy_huffman(const char *chars, const int *freqs, size_t n);
  */
 void huffman_result_destroy(HuffmanResult *result);
 
+// ============================================================================
+// HUFFMAN CANONICO (codificacao e decodificacao de bytes)
+// ============================================================================
+
+/** Comprimento maximo dos codigos canonicos (como em JPEG) */
+#define HUFFMAN_MAX_CODE_LENGTH 16
+
+/** Bits consumidos por consulta na tabela de decodificacao */
+#define HUFFMAN_LOOKUP_BITS 11
+
+/**
+ * @brief Comprimentos otimos de Huffman para frequencias ja ordenadas
+ *
+ * Duas filas (van Leeuwen): as folhas vem do array ordenado e os nos
+ * internos sao criados em ordem nao decrescente, logo o menor peso esta
+ * sempre na frente de uma das filas. Sem heap e sem limite de comprimento.
+ *
+ * @param freqs Frequencias em ordem crescente (a soma deve caber em 64 bits)
+ * @param n Numero de simbolos
+ * @param lengths Saida: comprimento do codigo de cada posicao (1 se n == 1)
+ * @return false se freqs nao esta ordenado, n == 0 ou falha de alocacao
+ *
+ * Complexidade: O(n)
+ * Referencia: van Leeuwen, J. (1976). "On the construction of Huffman
+ * trees". ICALP
+ */
+bool huffman_lengths_sorted(const uint64_t *freqs, size_t n, uint32_t *lengths);
+
+/**
+ * @brief Codec canonico de Huffman sobre bytes (opaco)
+ */
+typedef struct HuffmanCodec HuffmanCodec;
+
+/**
+ * @brief Cria o codec a partir da frequencia de cada byte
+ *
+ * Os comprimentos otimos sao limitados a HUFFMAN_MAX_CODE_LENGTH com o
+ * ajuste de JPEG (Annex K.3) e os codigos sao atribuidos canonicamente
+ * (por comprimento, depois por simbolo), de modo que so os 256
+ * comprimentos precisam ser transmitidos.
+ *
+ * @param freqs Frequencia de cada byte (0 = ausente; ao menos um > 0)
+ * @return HuffmanCodec* ou NULL
+ *
+ * Complexidade: O(256 log 256)
+ */
+HuffmanCodec* huffman_codec_create(const uint64_t freqs[256]);
+
+/**
+ * @brief Recria o codec a partir dos comprimentos (lado do decodificador)
+ *
+ * @param lengths Comprimento de cada byte (0 = ausente)
+ * @return NULL se algum comprimento passa de HUFFMAN_MAX_CODE_LENGTH, se
+ *         nenhum e > 0 ou se viola a desigualdade de Kraft
+ */
+HuffmanCodec* huffman_codec_from_lengths(const uint8_t lengths[256]);
+
+/**
+ * @brief Comprimentos do codec (256 posicoes, a serem transmitidos)
+ */
+const uint8_t* huffman_codec_lengths(const HuffmanCodec *codec);
+
+/**
+ * @brief Destroi o codec
+ */
+void huffman_codec_destroy(HuffmanCodec *codec);
+
+/**
+ * @brief Bytes exatos que huffman_encode produz para in
+ *
+ * @return Tamanho ou SIZE_MAX se algum byte de in nao tem codigo
+ */
+size_t huffman_encoded_size(const HuffmanCodec *codec, const unsigned char *in, size_t n);
+
+/**
+ * @brief Codifica n bytes em um fluxo de bits empacotado
+ *
+ * Bits em ordem LSB-first (como DEFLATE), acumulados num buffer de 64
+ * bits e descarregados 32 por vez; o ultimo byte e completado com zeros.
+ *
+ * @return Bytes escritos em out; 0 se out_capacity nao basta ou algum byte
+ *         nao tem codigo (n == 0 tambem da 0)
+ *
+ * Complexidade: O(n)
+ */
+size_t huffman_encode(const HuffmanCodec *codec, const unsigned char *in, size_t n,
+                      unsigned char *out, size_t out_capacity);
+
+/**
+ * @brief Decodifica exatamente n bytes de in
+ *
+ * Cada passo consulta HUFFMAN_LOOKUP_BITS bits numa tabela de
+ * 2^HUFFMAN_LOOKUP_BITS entradas (simbolo + comprimento); codigos mais
+ * longos caem na decodificacao canonica por comprimento.
+ *
+ * @return false se in acaba antes de n simbolos ou contem codigo invalido
+ *
+ * Complexidade: O(n)
+ * Referencia: Moffat, A. & Turpin, A. (1997). "On the Implementation of
+ * Minimum Redundancy Prefix Codes". IEEE Trans. Comm. 45(10)
+ */
+bool huffman_decode(const HuffmanCodec *codec, const unsigned char *in, size_t in_size,
+                    unsigned char *out, size_t n);
+
 // ============================================================================
 // FRACTIONAL KNAPSACK
 // ============================================================================
@@ -139,6 +244,74 @@ double greedy_fractional_knapsack_value(const double *weights, const double *val
 FractionalKnapsackResult greedy_fractional_knapsack(const double *weights, const double *values,
                                                      size_t n, double capacity);
 
+/**
+ * @brief Mochila fracionaria sem ordenacao (selecao pela razao de corte)
+ *
+ * Balas-Zemel: particiona em tres pela razao de um pivo aleatorio
+ * (maior, igual, menor). Se os de razao maior ja passam da capacidade,
+ * continua so neles; senao leva todos e, se sobrar capacidade apos os de
+ * razao igual, continua nos de razao menor. Cada passo descarta uma
+ * fracao constante esperada dos itens.
+ *
+ * Itens com valor <= 0, peso negativo ou NaN sao ignorados (fracao 0);
+ * itens de peso 0 e valor positivo entram inteiros.
+ *
+ * @return FractionalKnapsackResult (mesmo formato de greedy_fractional_knapsack)
+ *
+ * Complexidade: O(n) esperado
+ * Espaco: O(n)
+ *
+ * Referencia: Balas, E. & Zemel, E. (1980). "An Algorithm for Large
+ * Zero-One Knapsack Problems". Oper. Res. 28(5); Cormen S9.2
+ */
+FractionalKnapsackResult greedy_fractional_knapsack_linear(const double *weights, const double *values,
+                                                            size_t n, double capacity);
+
+/**
+ * @brief Valor maximo da mochila fracionaria em O(n) esperado
+ */
+double greedy_fractional_knapsack_value_linear(const double *weights, const double *values,
+                                               size_t n, double capacity);
+
+/**
+ * @brief Mochila fracionaria sobre itens que chegam em blocos (opaco)
+ *
+ * Guarda so os itens que ainda podem entrar na solucao: itens novos so
+ * sobem a razao de corte, entao os abaixo dela sao descartados. A selecao
+ * linear roda quando o buffer dobra desde a ultima compactacao, logo o
+ * custo e O(1) amortizado por item e a memoria e O(itens na solucao +
+ * bloco).
+ */
+typedef struct FractionalKnapsackStream FractionalKnapsackStream;
+
+/**
+ * @brief Cria o fluxo para uma mochila de capacidade dada (> 0)
+ */
+FractionalKnapsackStream* fractional_knapsack_stream_create(double capacity);
+
+/**
+ * @brief Acrescenta um bloco de itens (indices globais na ordem de chegada)
+ *
+ * @return false em falha de alocacao (o bloco nao entra)
+ */
+bool fractional_knapsack_stream_add(FractionalKnapsackStream *stream, const double *weights,
+                                    const double *values, size_t count);
+
+/**
+ * @brief Valor maximo com os itens vistos ate agora
+ */
+double fractional_knapsack_stream_value(FractionalKnapsackStream *stream);
+
+/**
+ * @brief Fracoes de todos os itens vistos (n = itens vistos)
+ */
+FractionalKnapsackResult fractional_knapsack_stream_result(FractionalKnapsackStream *stream);
+
+/**
+ * @brief Destroi o fluxo
+ */
+void fractional_knapsack_stream_destroy(FractionalKnapsackStream *stream);
+
 /**
  * @brief Libera memoria de FractionalKnapsackResult
  */
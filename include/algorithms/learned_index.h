@@ -0,0 +1,102 @@
+/**
+ * @file learned_index.h
+ * @brief Indice aprendido estatico (PGM) sobre um array ordenado de int
+ *
+ * Um modelo linear por partes aproxima a funcao chave -> posicao com erro
+ * maximo epsilon: cada segmento guarda (primeira chave, posicao, inclinacao)
+ * e preve a posicao de qualquer chave do seu intervalo a no maximo
+ * epsilon posicoes do lower_bound real. Os segmentos sao construidos em
+ * O(n) pelo algoritmo guloso do cone (shrinking cone), e os proprios
+ * segmentos sao indexados recursivamente pelo mesmo metodo
+ * (epsilon interno LEARNED_INDEX_EPSILON_INTERNAL) ate restar um unico
+ * segmento na raiz.
+ *
+ * Uma consulta desce os niveis com uma previsao e uma busca binaria numa
+ * janela de ~2 epsilon posicoes por nivel: O(niveis * log epsilon), independente
+ * da distribuicao das chaves (ao contrario de interpolation_search, cujo
+ * pior caso e O(n) em dados assimetricos). A janela e sempre verificada;
+ * se a chave estiver fora dela, a busca continua por busca binaria no
+ * restante do array (o resultado e correto para qualquer entrada).
+ *
+ * Memoria: 24 bytes por segmento. Dados quase lineares precisam de poucos
+ * segmentos (uma progressao aritmetica usa um so); em geral o numero de
+ * segmentos cai com epsilon^2 e fica muito abaixo de uma arvore sobre n
+ * chaves.
+ *
+ * Referencias:
+ * - Ferragina, P. & Vinciguerra, G. (2020). "The PGM-index: a fully-dynamic
+ *   compressed learned index with provable worst-case bounds". VLDB 13(8)
+ * - Kraska, T. et al. (2018). "The Case for Learned Index Structures". SIGMOD
+ * - Galakatos, A. et al. (2019). "FITing-Tree". SIGMOD (shrinking cone)
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#ifndef LEARNED_INDEX_H
+#define LEARNED_INDEX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * Epsilon dos niveis internos (sobre os segmentos). Os niveis internos sao
+ * pequenos e ficam no cache: uma janela maior ali custa pouco e reduz o
+ * numero de niveis (cada nivel e um acesso dependente a memoria).
+ */
+#define LEARNED_INDEX_EPSILON_INTERNAL 64
+
+/** Epsilon padrao sugerido para o nivel das chaves */
+#define LEARNED_INDEX_EPSILON_DEFAULT 16
+
+typedef struct LearnedIndex LearnedIndex;
+
+/**
+ * @brief Constroi o indice sobre keys (ordem crescente, repetidos permitidos)
+ *
+ * O indice guarda o ponteiro keys, sem copiar: o array deve permanecer
+ * valido e inalterado enquanto o indice existir.
+ *
+ * @param keys Array ordenado
+ * @param n Numero de chaves
+ * @param epsilon Erro maximo de posicao no nivel das chaves
+ * @return Novo indice, ou NULL (keys NULL com n > 0, array fora de ordem ou
+ *         falha de alocacao)
+ *
+ * Complexidade: O(n)
+ */
+LearnedIndex *learned_index_build(const int *keys, size_t n, size_t epsilon);
+
+/**
+ * @brief Libera o indice (o array de chaves nao e liberado)
+ */
+void learned_index_destroy(LearnedIndex *index);
+
+/**
+ * @brief Primeira posicao i com keys[i] >= key (n se nao houver)
+ *
+ * Complexidade: O(niveis * log epsilon)
+ */
+size_t learned_index_lower_bound(const LearnedIndex *index, int key);
+
+/**
+ * @brief Posicao da primeira ocorrencia de key, ou SEARCH_NOT_FOUND
+ */
+size_t learned_index_find(const LearnedIndex *index, int key);
+
+/**
+ * @brief Numero de segmentos no nivel das chaves
+ */
+size_t learned_index_segments(const LearnedIndex *index);
+
+/**
+ * @brief Numero de niveis (1 = so o nivel das chaves)
+ */
+size_t learned_index_levels(const LearnedIndex *index);
+
+/**
+ * @brief Bytes usados pelo indice (sem contar o array de chaves)
+ */
+size_t learned_index_memory(const LearnedIndex *index);
+
+#endif // LEARNED_INDEX_H
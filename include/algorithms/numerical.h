@@ -22,6 +22,7 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 // ============================================================================
 // GCD - Euclidean Algorithm
@@ -82,7 +83,10 @@ ExtendedGCDResult extended_gcd(long long a, long long b);
 /**
  * @brief Exponenciacao rapida modular: (base^exp) mod mod
  *
- * Usa repeated squaring para calcular em O(log exp).
+ * Usa repeated squaring para calcular em O(log exp). Os produtos sao
+ * feitos em 128 bits, entao qualquer mod ate LLONG_MAX e exato; com mod
+ * impar as multiplicacoes sao de Montgomery (sem divisao de 128 bits).
+ * Para modulos maiores que 64 bits, ver bigint_pow_mod (bigint.h).
  *
  * @param base Base
  * @param exp Expoente (nao-negativo)
@@ -128,22 +132,126 @@ typedef struct {
  *
  * Complexidade: O(n log log n) tempo, O(n) espaco
  * Referencia: Cormen S31.8; Eratostenes (~240 BC)
+ *
+ * Para limites grandes (onde um bool por inteiro nao cabe na memoria),
+ * ver o crivo segmentado abaixo.
  */
 SieveResult sieve_of_eratosthenes(size_t limit);
 
 /**
- * @brief Verifica se um numero e primo (usando trial division)
+ * @brief Verifica se um numero e primo
+ *
+ * Filtro por divisao pelos primos ate 61 e, depois, Miller-Rabin
+ * deterministico com as 7 bases de Sinclair (2, 325, 9375, 28178, 450775,
+ * 9780504, 1795265022), que nao tem pseudoprimo forte comum abaixo de
+ * 2^64 (abaixo de 4759123141 bastam 2, 7 e 61). As potencias usam
+ * multiplicacao de Montgomery em 64 bits.
  *
  * @param n Numero a verificar
  * @return bool true se primo
  *
- * Complexidade: O(sqrt(n))
+ * Complexidade: O(log n) multiplicacoes de 64 bits
+ * Referencia: Cormen S31.8; Miller (1976); Rabin (1980); Jaeschke (1993),
+ * "On strong pseudoprimes to several bases". Math. Comp. 61
  */
 bool is_prime(long long n);
 
+/**
+ * @brief is_prime para toda a faixa de uint64_t
+ */
+bool is_prime_u64(uint64_t n);
+
+/**
+ * @brief out[i] = is_prime_u64(values[i]) para i em [0, n)
+ *
+ * @param num_threads Threads (0 = ds_get_num_threads(); 1 = serial)
+ */
+void is_prime_batch(const uint64_t *values, size_t n, bool *out, size_t num_threads);
+
 /**
  * @brief Libera memoria de SieveResult
  */
 void sieve_result_destroy(SieveResult *result);
 
+// ============================================================================
+// SEGMENTED SIEVE (roda 2*3*5, bits empacotados)
+// ============================================================================
+
+/*
+ * Cada byte representa 30 inteiros consecutivos: os 8 bits sao os restos
+ * coprimos com 30 (1, 7, 11, 13, 17, 19, 23, 29), entao multiplos de 2, 3
+ * e 5 nao ocupam memoria (3.75 inteiros por bit). Cada primo base p
+ * guarda, para cada um dos 8 restos, o proximo byte a marcar, que avanca
+ * exatamente p bytes (30p inteiros) por passo, sem divisoes no laco.
+ *
+ * O intervalo e crivado em segmentos de SIEVE_SEGMENT_BYTES (L1) a
+ * SIEVE_SEGMENT_MAX_BYTES (L2), com ao menos sqrt(hi) / 2 bytes: acima de
+ * ~10^10 o custo fixo por segmento dos primos base grandes (8 restos que
+ * quase nunca caem no segmento) passa a dominar.
+ *
+ * Memoria: um segmento por thread mais 72 bytes por primo base ate
+ * sqrt(hi); independe do tamanho do intervalo.
+ */
+
+/** Bytes minimos por segmento: 32 KiB (L1d tipica) = 983040 inteiros */
+#define SIEVE_SEGMENT_BYTES 32768
+
+/** Bytes maximos por segmento: 256 KiB (L2 tipica) */
+#define SIEVE_SEGMENT_MAX_BYTES 262144
+
+/** Maior hi aceito pelo crivo segmentado (os primos base cabem em 32 bits) */
+#define SIEVE_SEGMENTED_MAX ((uint64_t)1 << 62)
+
+typedef struct PrimeIterator PrimeIterator;
+
+/**
+ * @brief Iterador sobre os primos de [lo, hi), em ordem crescente
+ *
+ * @return Iterador, ou NULL (hi > SIEVE_SEGMENTED_MAX ou falha de alocacao)
+ *
+ * Complexidade: O((hi - lo) log log hi + sqrt(hi)) no total
+ * Referencia: Bays, C. & Hudson, R. H. (1977). "The segmented sieve of
+ * Eratosthenes and primes in arithmetic progressions to 10^12". BIT 17;
+ * Pritchard, P. (1982). "Explaining the wheel sieve". Acta Informatica 17
+ */
+PrimeIterator *prime_iterator_create(uint64_t lo, uint64_t hi);
+
+/**
+ * @brief Proximo primo do intervalo
+ *
+ * @param it Iterador
+ * @param prime Saida
+ * @return false quando o intervalo acabou
+ */
+bool prime_iterator_next(PrimeIterator *it, uint64_t *prime);
+
+/**
+ * @brief Libera o iterador
+ */
+void prime_iterator_destroy(PrimeIterator *it);
+
+/**
+ * @brief Numero de primos em [lo, hi)
+ *
+ * O intervalo e dividido em blocos de segmentos contiguos, um por thread
+ * (tarefas do pool global).
+ *
+ * @param lo Inicio (inclusive)
+ * @param hi Fim (exclusive, <= SIEVE_SEGMENTED_MAX)
+ * @param num_threads Threads (0 = ds_get_num_threads())
+ * @param count Saida
+ * @return false em argumentos invalidos ou falha de alocacao
+ */
+bool prime_count_range(uint64_t lo, uint64_t hi, size_t num_threads, uint64_t *count);
+
+/**
+ * @brief Primos de [lo, hi) em ordem crescente
+ *
+ * @param count Saida: numero de primos
+ * @param num_threads Threads (0 = ds_get_num_threads())
+ * @return Array alocado (liberar com free), ou NULL (intervalo sem primos,
+ *         argumentos invalidos ou falha de alocacao; *count = 0)
+ */
+uint64_t *primes_in_range(uint64_t lo, uint64_t hi, size_t num_threads, size_t *count);
+
 #endif // NUMERICAL_H
@@ -0,0 +1,264 @@
+/**
+ * @file pipeline.h
+ * @brief Pipeline de fluxo de dados em lotes (parse -> filtro -> agregacao -> ordenacao)
+ *
+ * Encadear os algoritmos da biblioteca fase a fase (le tudo, filtra tudo,
+ * agrega tudo, ordena tudo) copia o conjunto inteiro entre etapas e deixa
+ * a CPU parada durante a E/S e vice-versa. Aqui cada etapa roda na sua
+ * propria thread e recebe lotes de tamanho fixo da etapa anterior, entao
+ * a leitura do lote i+1 acontece enquanto o lote i e filtrado e o i-1
+ * agregado.
+ *
+ * Cada aresta entre duas etapas tem um conjunto fixo de queue_depth lotes
+ * pre-alocados que circulam por dois aneis SPSC (queue.h): cheios do
+ * produtor para o consumidor e vazios de volta. Sem lote vazio o produtor
+ * espera (back-pressure): a memoria em transito e limitada a
+ * queue_depth * batch_size itens por aresta, sem alocacao no regime
+ * permanente. A espera gira brevemente e depois dorme num contador de
+ * eventos (mutex/condvar so no caminho lento).
+ *
+ * A primeira etapa e a fonte: process e chamado com items NULL ate
+ * retornar PIPELINE_DONE. A ultima e o sorvedouro (nao emite). As demais
+ * recebem cada lote em process e podem emitir qualquer numero de itens
+ * (do tamanho out_item_size) com pipeline_emit; flush, se houver, roda no
+ * fim do fluxo e serve a etapas que so produzem ao final (agregacao,
+ * ordenacao). A ultima etapa roda na thread chamadora.
+ *
+ * Uso:
+ * @code
+ * PipelineFilter *filter = pipeline_filter_create(sizeof(LogRecord),
+ *     offsetof(LogRecord, message), sizeof(((LogRecord *)0)->message),
+ *     "timeout", 7, SM_ALGO_AUTO);
+ * PipelineAggregate *agg = pipeline_aggregate_create(sizeof(LogRecord),
+ *     offsetof(LogRecord, host), sizeof(uint32_t), hash_int, compare_int);
+ * PipelineSort *sort = pipeline_sort_create(pipeline_group_size(sizeof(uint32_t)),
+ *     compare_group_by_count);
+ *
+ * PipelineStage stages[5] = {
+ *     {"parse", parse_lines, NULL, &reader, sizeof(LogRecord)},
+ *     pipeline_filter_stage(filter, false),
+ *     pipeline_aggregate_stage(agg),
+ *     pipeline_sort_stage(sort),
+ *     {"output", write_groups, NULL, out, 0},
+ * };
+ * bool ok = pipeline_run(stages, 5, NULL, NULL);
+ * @endcode
+ *
+ * Referencias:
+ * - Graefe, G. (1994). "Volcano - An Extensible and Parallel Query
+ *   Evaluation System". IEEE TKDE 6(1)
+ * - Boncz, P., Zukowski, M. & Nes, N. (2005). "MonetDB/X100:
+ *   Hyper-Pipelining Query Execution". CIDR '05
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include "algorithms/string_matching.h"
+#include "data_structures/common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+// NUCLEO
+// ============================================================================
+
+/**
+ * @brief Resultado de uma chamada de process
+ */
+typedef enum {
+    PIPELINE_CONTINUE = 0,  /**< Pronta para o proximo lote */
+    PIPELINE_DONE,          /**< Fim do fluxo desta etapa (a fonte terminou; um filtro viu o suficiente) */
+    PIPELINE_ERROR          /**< Aborta o pipeline inteiro */
+} PipelineStatus;
+
+/**
+ * @brief Saida de uma etapa (opaca): destino de pipeline_emit
+ */
+typedef struct PipelineEmitter PipelineEmitter;
+
+/**
+ * @brief Processa um lote
+ *
+ * @param ctx Contexto da etapa
+ * @param items count itens contiguos do tamanho out_item_size da etapa
+ *        anterior (NULL na fonte). Validos so durante a chamada
+ * @param count Itens no lote (0 na fonte)
+ * @param out Saida da etapa
+ *
+ * Depois de PIPELINE_DONE a etapa nao e mais chamada: o flush roda, os
+ * lotes restantes da entrada sao descartados e o fluxo segue adiante.
+ */
+typedef PipelineStatus (*PipelineProcessFn)(void *ctx, const void *items, size_t count,
+                                            PipelineEmitter *out);
+
+/**
+ * @brief Chamada uma vez no fim da entrada (antes de repassar o fim adiante)
+ * @return false aborta o pipeline
+ */
+typedef bool (*PipelineFlushFn)(void *ctx, PipelineEmitter *out);
+
+/**
+ * @brief Uma etapa do pipeline
+ */
+typedef struct {
+    const char *name;           /**< Nome (diagnostico; pode ser NULL) */
+    PipelineProcessFn process;  /**< Obrigatorio */
+    PipelineFlushFn flush;      /**< Opcional */
+    void *ctx;                  /**< Usado so pela thread da etapa */
+    size_t out_item_size;       /**< Bytes por item emitido (ignorado na ultima etapa) */
+} PipelineStage;
+
+/**
+ * @brief Parametros do pipeline
+ */
+typedef struct {
+    size_t batch_size;          /**< Itens por lote (padrao 1024) */
+    size_t queue_depth;         /**< Lotes por aresta (padrao 4, minimo 2) */
+} PipelineConfig;
+
+/**
+ * @brief Contadores de uma etapa
+ *
+ * input_stalls alto na etapa k e output_stalls alto na k-1 indicam que o
+ * gargalo esta depois de k; o inverso, que esta antes.
+ */
+typedef struct {
+    size_t items_in;            /**< Itens recebidos */
+    size_t items_out;           /**< Itens emitidos */
+    size_t batches_in;          /**< Lotes recebidos */
+    size_t batches_out;         /**< Lotes enviados */
+    size_t input_stalls;        /**< Esperas por lote cheio (entrada vazia) */
+    size_t output_stalls;       /**< Esperas por lote vazio (back-pressure) */
+} PipelineStageStats;
+
+/**
+ * @brief Configuracao padrao
+ */
+PipelineConfig pipeline_default_config(void);
+
+/**
+ * @brief Executa as etapas ate a fonte terminar
+ *
+ * @param stages num_stages etapas, da fonte ao sorvedouro
+ * @param config Parametros (NULL = pipeline_default_config())
+ * @param stats num_stages contadores de saida (pode ser NULL)
+ * @return true se todas as etapas terminaram; false em argumento invalido,
+ *         falha de alocacao ou de criacao de thread, ou se alguma etapa
+ *         retornou PIPELINE_ERROR / flush falso
+ *
+ * Espaco: (num_stages - 1) * queue_depth * batch_size itens
+ */
+bool pipeline_run(const PipelineStage *stages, size_t num_stages,
+                  const PipelineConfig *config, PipelineStageStats *stats);
+
+/**
+ * @brief Emite um item (copiado) para a proxima etapa
+ *
+ * Pode esperar por um lote vazio. So a thread da etapa dona de out.
+ *
+ * @return false se o pipeline foi abortado ou a etapa e a ultima
+ */
+bool pipeline_emit(PipelineEmitter *out, const void *item);
+
+/**
+ * @brief Emite count itens contiguos
+ */
+bool pipeline_emit_n(PipelineEmitter *out, const void *items, size_t count);
+
+// ============================================================================
+// ETAPAS PRONTAS
+// ============================================================================
+
+/**
+ * @brief Filtro por substring: repassa so os registros cujo campo de texto
+ *        contem o padrao (busca com StringPattern pre-compilado)
+ */
+typedef struct PipelineFilter PipelineFilter;
+
+/**
+ * @brief Cria o filtro
+ *
+ * @param item_size Tamanho do registro
+ * @param field_offset Inicio do campo de texto no registro
+ * @param field_size Tamanho maximo do campo (a busca para no primeiro '\0')
+ * @param pattern Padrao de m bytes (copiado)
+ * @param algo Algoritmo de busca (SM_ALGO_AUTO = string_search_choose)
+ * @return Filtro ou NULL (campo fora do registro, padrao invalido ou sem memoria)
+ */
+PipelineFilter *pipeline_filter_create(size_t item_size, size_t field_offset, size_t field_size,
+                                       const void *pattern, size_t m,
+                                       StringSearchAlgorithm algo);
+void pipeline_filter_destroy(PipelineFilter *filter);
+
+/**
+ * @brief Etapa do filtro (out_item_size = item_size); inverted = repassa os que nao contem
+ */
+PipelineStage pipeline_filter_stage(PipelineFilter *filter, bool inverted);
+
+/**
+ * @brief Agregacao por chave em tabela hash: conta os registros de cada chave
+ *
+ * No fim do fluxo emite um grupo por chave distinta, na ordem da tabela,
+ * com o layout de pipeline_group_size.
+ */
+typedef struct PipelineAggregate PipelineAggregate;
+
+/** Deslocamento do contador uint64_t num grupo com chave de key_size bytes */
+#define PIPELINE_GROUP_COUNT_OFFSET(key_size) \
+    (((key_size) + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t))
+
+/**
+ * @brief Bytes de um grupo: a chave, completada ate multiplo de 8, e o
+ *        contador uint64_t em PIPELINE_GROUP_COUNT_OFFSET(key_size)
+ */
+size_t pipeline_group_size(size_t key_size);
+
+/**
+ * @brief Cria a agregacao
+ *
+ * @param key_offset, key_size Chave dentro do registro de item_size bytes
+ * @param hash_fn, compare_fn Hash e igualdade sobre a chave (como em hashtable_create)
+ * @return Agregacao ou NULL (chave fora do registro, funcoes NULL ou sem memoria)
+ */
+PipelineAggregate *pipeline_aggregate_create(size_t item_size, size_t key_offset, size_t key_size,
+                                             HashFn hash_fn, CompareFn compare_fn);
+void pipeline_aggregate_destroy(PipelineAggregate *agg);
+
+/**
+ * @brief Etapa da agregacao (out_item_size = pipeline_group_size(key_size))
+ */
+PipelineStage pipeline_aggregate_stage(PipelineAggregate *agg);
+
+/**
+ * @brief Grupos distintos vistos ate agora
+ */
+size_t pipeline_aggregate_groups(const PipelineAggregate *agg);
+
+/**
+ * @brief Ordenacao: cada lote recebido vira um run ordenado enquanto as
+ *        etapas anteriores ainda produzem; no fim, os runs sao intercalados
+ *        dois a dois e o resultado emitido em ordem
+ */
+typedef struct PipelineSort PipelineSort;
+
+/**
+ * @brief Cria a ordenacao de itens de item_size bytes
+ * @return Ordenacao ou NULL (item_size zero, cmp NULL ou sem memoria)
+ */
+PipelineSort *pipeline_sort_create(size_t item_size, CompareFn cmp);
+void pipeline_sort_destroy(PipelineSort *sort);
+
+/**
+ * @brief Etapa da ordenacao (out_item_size = item_size; estavel: Nao)
+ *
+ * Complexidade: O(n log b) nos lotes de b itens + O(n log(n / b)) no merge
+ * Espaco: 2n itens
+ */
+PipelineStage pipeline_sort_stage(PipelineSort *sort);
+
+#endif // PIPELINE_H
@@ -19,6 +19,7 @@
 
 #include "data_structures/common.h"
 #include <stddef.h>
+#include <stdint.h>
 
 #define SEARCH_NOT_FOUND ((size_t)-1)
 
@@ -32,6 +33,8 @@
  * @param cmp Funcao de comparacao
  * @return size_t Indice do elemento ou SEARCH_NOT_FOUND
  *
+ * Com cmp == compare_int e elem_size == sizeof(int), usa linear_search_int32.
+ *
  * Complexidade: O(n)
  * Referencia: Cormen S2.1; Knuth TAOCP 3 S6.1
  */
@@ -80,7 +83,9 @@ size_t ternary_search(const void *arr, size_t n, size_t elem_size,
 /**
  * @brief Jump Search - Busca por saltos de tamanho sqrt(n)
  *
- * Salta blocos de sqrt(n) e faz busca linear no bloco.
+ * Salta blocos de sqrt(n) e faz busca linear no bloco. Com compare_int
+ * sobre int, ate 256 elementos e a varredura do bloco usam
+ * linear_search_int32.
  *
  * Complexidade: O(sqrt(n))
  * Referencia: Knuth TAOCP 3 S6.2.1
@@ -92,7 +97,8 @@ size_t jump_search(const void *arr, size_t n, size_t elem_size,
  * @brief Exponential Search - Busca exponencial + binaria
  *
  * Encontra range exponencialmente, depois busca binaria no range.
- * Util para listas ilimitadas.
+ * Util para listas ilimitadas. Com compare_int sobre int, ate 256
+ * elementos usam linear_search_int32.
  *
  * Complexidade: O(log n)
  * Referencia: Knuth TAOCP 3 S6.2.1
@@ -100,4 +106,163 @@ size_t jump_search(const void *arr, size_t n, size_t elem_size,
 size_t exponential_search(const void *arr, size_t n, size_t elem_size,
                           const void *target, CompareFn cmp);
 
+// ============================================================================
+// BUSCA LINEAR VETORIZADA
+// ============================================================================
+
+/**
+ * @brief Primeiro indice com arr[i] == target (SSE2/NEON, 16 por iteracao)
+ *
+ * Compara 4 vetores por iteracao e junta as mascaras; so localiza a
+ * posicao exata no bloco em que houve igualdade. Para tabelas pequenas
+ * (centenas de elementos) supera qualquer busca em arvore ou binaria.
+ * SEARCH_NO_SIMD compila apenas o laco escalar.
+ *
+ * @return Indice ou SEARCH_NOT_FOUND (tambem para arr NULL)
+ *
+ * Complexidade: O(n)
+ */
+size_t linear_search_int32(const int32_t *arr, size_t n, int32_t target);
+
+/**
+ * @brief linear_search_int32 para int64_t (8 por iteracao)
+ */
+size_t linear_search_int64(const int64_t *arr, size_t n, int64_t target);
+
+/**
+ * @brief linear_search_int32 para float, com a igualdade de ==
+ *
+ * -0.0 e +0.0 sao iguais; NaN nunca e encontrado.
+ */
+size_t linear_search_float(const float *arr, size_t n, float target);
+
+// ============================================================================
+// BUSCA SEM DESVIOS, LAYOUT DE EYTZINGER E LOTES
+// ============================================================================
+
+/**
+ * @brief Primeira posicao i com arr[i] >= target (n se nao houver)
+ *
+ * O intervalo e reduzido sempre a metade com uma selecao condicional (cmov)
+ * em vez de um desvio, e os dois candidatos do passo seguinte sao
+ * pre-carregados (prefetch). O numero de iteracoes depende so de n.
+ *
+ * @return Indice em [0, n], ou SEARCH_NOT_FOUND para argumentos NULL
+ *
+ * Complexidade: O(log n)
+ * Referencia: Khuong, P.-V. & Morin, P. (2017). "Array Layouts for
+ * Comparison-Based Searching". ACM JEA 22
+ */
+size_t lower_bound_branchless(const void *arr, size_t n, size_t elem_size,
+                              const void *target, CompareFn cmp);
+
+/**
+ * @brief lower_bound_branchless para int, com comparacao inline
+ *
+ * Com CompareFn, a chamada indireta por nivel domina o custo e a versao
+ * generica fica proxima de binary_search; as versoes _int eliminam a
+ * chamada e sao as indicadas para tabelas de consulta quentes.
+ */
+size_t lower_bound_int(const int *arr, size_t n, int target);
+
+/**
+ * @brief lower_bound de m chaves intercaladas
+ *
+ * As chaves avancam juntas, em grupos de SEARCH_BATCH_WIDTH, um nivel por
+ * vez: os acessos a memoria de chaves diferentes se sobrepoem em vez de
+ * esperar um cache miss por vez. out[j] recebe o lower_bound de
+ * targets[j] (mesma semantica de lower_bound_branchless).
+ *
+ * Complexidade: O(m log n)
+ */
+void lower_bound_batch(const void *arr, size_t n, size_t elem_size,
+                       const void *targets, size_t m, CompareFn cmp, size_t *out);
+
+/**
+ * @brief lower_bound_batch para int
+ */
+void lower_bound_int_batch(const int *arr, size_t n, const int *targets, size_t m,
+                           size_t *out);
+
+/** Chaves buscadas em paralelo por grupo nos lotes */
+#define SEARCH_BATCH_WIDTH 16
+
+/**
+ * @brief binary_search de m consultas intercaladas (group prefetching)
+ *
+ * Para muitas consultas no mesmo array ordenado: cada grupo de
+ * SEARCH_BATCH_WIDTH consultas desce um nivel por vez e pre-carrega a
+ * proxima sonda de cada uma, de modo que ate SEARCH_BATCH_WIDTH cache
+ * misses ficam em voo ao mesmo tempo. Como todas as descidas tem
+ * ceil(log2 n) passos, o grupo anda em passo unico (sem a maquina de
+ * estados do AMAC).
+ *
+ * @param arr Array ordenado
+ * @param n Numero de elementos
+ * @param elem_size Tamanho de cada elemento
+ * @param queries m chaves (elem_size bytes cada)
+ * @param m Numero de consultas
+ * @param cmp Funcao de comparacao
+ * @param out out[j] = indice da primeira ocorrencia de queries[j], ou
+ *            SEARCH_NOT_FOUND (tambem para arr/cmp NULL)
+ *
+ * Complexidade: O(m log n)
+ */
+void binary_search_batch(const void *arr, size_t n, size_t elem_size,
+                         const void *queries, size_t m, CompareFn cmp, size_t *out);
+
+/**
+ * @brief binary_search_batch para int (comparacao inline)
+ */
+void binary_search_int_batch(const int *arr, size_t n, const int *queries, size_t m,
+                             size_t *out);
+
+/**
+ * @brief Copia um array ordenado para o layout de Eytzinger (ordem BFS)
+ *
+ * O no k (base 0) tem filhos 2k+1 e 2k+2: os primeiros niveis ficam
+ * contiguos no cache e os 16 descendentes a 4 niveis de distancia ocupam
+ * uma regiao contigua, que a busca pre-carrega.
+ *
+ * @param sorted Array em ordem crescente
+ * @param n Numero de elementos
+ * @param elem_size Tamanho de cada elemento
+ * @return Novo array de n elementos (liberar com free), ou NULL
+ *
+ * Complexidade: O(n)
+ */
+void *eytzinger_build(const void *sorted, size_t n, size_t elem_size);
+
+/**
+ * @brief lower_bound num array de eytzinger_build
+ *
+ * @return Indice em eyt do menor elemento >= target, ou SEARCH_NOT_FOUND
+ *         se nao houver (ou argumentos NULL)
+ *
+ * Complexidade: O(log n)
+ * Referencia: Khuong & Morin (2017), S3
+ */
+size_t eytzinger_lower_bound(const void *eyt, size_t n, size_t elem_size,
+                             const void *target, CompareFn cmp);
+
+/**
+ * @brief eytzinger_lower_bound de m chaves intercaladas
+ *
+ * out[j] recebe o resultado de eytzinger_lower_bound para targets[j].
+ */
+void eytzinger_lower_bound_batch(const void *eyt, size_t n, size_t elem_size,
+                                 const void *targets, size_t m, CompareFn cmp,
+                                 size_t *out);
+
+/**
+ * @brief eytzinger_lower_bound para int
+ */
+size_t eytzinger_lower_bound_int(const int *eyt, size_t n, int target);
+
+/**
+ * @brief eytzinger_lower_bound_batch para int
+ */
+void eytzinger_lower_bound_int_batch(const int *eyt, size_t n, const int *targets,
+                                     size_t m, size_t *out);
+
 #endif // SEARCHING_H
@@ -0,0 +1,220 @@
+/**
+ * @file sort_kernels.h
+ * @brief Kernels de ordenacao especializados por tipo (gerados por macro)
+ *
+ * As ordenacoes de sorting.h recebem elem_size + CompareFn: cada
+ * comparacao e uma chamada indireta e cada troca copia bytes. Os macros
+ * abaixo geram, para um tipo concreto, um introsort com comparacao e
+ * trocas inline (atribuicao nativa do tipo):
+ *
+ * - mediana de 3 (ninther acima de 128 elementos)
+ * - particao de Lomuto sem desvios: o resultado da comparacao soma no
+ *   indice de escrita, sem salto condicional por elemento
+ * - chaves iguais ao pivo anterior sao separadas de uma vez (O(n) para
+ *   entradas com poucas chaves distintas)
+ * - insertion sort abaixo de 24 elementos (ou BASE, em SORT_DEFINE_WITH_BASE)
+ * - heapsort apos 2 log2(n) niveis: O(n log n) no pior caso
+ * - entrada ja ordenada detectada numa varredura inicial (O(n))
+ *
+ * Uso:
+ * @code
+ * // Num .c: define void sort_float(float *arr, size_t n)
+ * SORT_DEFINE(float)
+ *
+ * // Ordem/tipo customizados: nome, tipo e LESS(a, b) estrito
+ * typedef struct { int key; int value; } Pair;
+ * #define PAIR_LESS(a, b) ((a).key < (b).key)
+ * SORT_DEFINE_WITH(pair, Pair, PAIR_LESS)     // void sort_pair(Pair*, size_t)
+ * @endcode
+ *
+ * O nome do tipo vira sufixo da funcao: para tipos com espaco
+ * (unsigned long) use SORT_DEFINE_WITH ou um typedef. SORT_DECLARE gera o
+ * prototipo para headers. LESS deve ser uma ordem fraca estrita; para
+ * ponto flutuante, NaN nao tem posicao definida (mas nao causa acesso
+ * fora do array: todos os lacos sao limitados).
+ *
+ * Referencias:
+ * - Musser, D. R. (1997). "Introspective Sorting and Selection Algorithms"
+ * - Edelkamp, S. & Weiss, A. (2016). "BlockQuicksort"
+ * - Peters, O. R. L. (2021). "Pattern-defeating Quicksort"
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#ifndef SORT_KERNELS_H
+#define SORT_KERNELS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Ordem crescente padrao dos kernels */
+#define SORT_LESS_DEFAULT(a, b) ((a) < (b))
+
+/** Particoes menores: insertion sort */
+#define SORT_KERNEL_INSERTION_THRESHOLD 24
+
+/** Particoes maiores: pivo pelo ninther de Tukey */
+#define SORT_KERNEL_NINTHER_THRESHOLD 128
+
+/**
+ * @brief Prototipo de sort_<name>(T *arr, size_t n)
+ */
+#define SORT_DECLARE(name, T) void sort_##name(T *arr, size_t n)
+
+/**
+ * @brief Define sort_<T>(T *arr, size_t n) com a ordem de operator <
+ */
+#define SORT_DEFINE(T) SORT_DEFINE_WITH(T, T, SORT_LESS_DEFAULT)
+
+/**
+ * @brief Define sort_<name>(T *arr, size_t n) com LESS(a, b) inline
+ *
+ * Gera helpers static sort_<name>_* e a funcao publica sort_<name>.
+ * NULL ou n <= 1 nao fazem nada.
+ *
+ * Complexidade: O(n log n) pior caso
+ * Espaco: O(log n) pilha
+ * Estavel: Nao
+ */
+#define SORT_DEFINE_WITH(name, T, LESS) \
+    SORT_DEFINE_WITH_BASE(name, T, LESS, sort_##name##_insertion)
+
+/**
+ * @brief Como SORT_DEFINE_WITH, com BASE(T *a, size_t n) nas particoes pequenas
+ *
+ * BASE ordena particoes com menos de SORT_KERNEL_INSERTION_THRESHOLD
+ * elementos no lugar do insertion sort (p.ex. uma rede de ordenacao:
+ * sort_small_int em sorting.h). Deve produzir a mesma ordem que LESS.
+ */
+#define SORT_DEFINE_WITH_BASE(name, T, LESS, BASE)                              \
+    static inline void sort_##name##_swap(T *a, T *b) {                         \
+        T t = *a; *a = *b; *b = t;                                              \
+    }                                                                           \
+                                                                                \
+    static inline void sort_##name##_sort3(T *a, T *b, T *c) {                  \
+        if (LESS(*b, *a)) sort_##name##_swap(a, b);                             \
+        if (LESS(*c, *b)) sort_##name##_swap(b, c);                             \
+        if (LESS(*b, *a)) sort_##name##_swap(a, b);                             \
+    }                                                                           \
+                                                                                \
+    static inline void sort_##name##_insertion(T *a, size_t n) {                \
+        for (size_t i = 1; i < n; i++) {                                        \
+            T x = a[i];                                                         \
+            size_t j = i;                                                       \
+            while (j > 0 && LESS(x, a[j - 1])) {                                \
+                a[j] = a[j - 1];                                                \
+                j--;                                                            \
+            }                                                                   \
+            a[j] = x;                                                           \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    static void sort_##name##_sift_down(T *a, size_t n, size_t i) {             \
+        T x = a[i];                                                             \
+        for (;;) {                                                              \
+            size_t child = 2 * i + 1;                                           \
+            if (child >= n) break;                                              \
+            if (child + 1 < n && LESS(a[child], a[child + 1])) child++;         \
+            if (!LESS(x, a[child])) break;                                      \
+            a[i] = a[child];                                                    \
+            i = child;                                                          \
+        }                                                                       \
+        a[i] = x;                                                               \
+    }                                                                           \
+                                                                                \
+    static void sort_##name##_heapsort(T *a, size_t n) {                        \
+        for (size_t i = n / 2; i > 0; i--) sort_##name##_sift_down(a, n, i - 1); \
+        for (size_t i = n - 1; i > 0; i--) {                                    \
+            sort_##name##_swap(&a[0], &a[i]);                                   \
+            sort_##name##_sift_down(a, i, 0);                                   \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    /* Pivo a[0]; [1, s) recebe os x com LESS(x, pivo) sem desvio */            \
+    static size_t sort_##name##_partition_lt(T *a, size_t n) {                  \
+        T pivot = a[0];                                                         \
+        size_t s = 1;                                                           \
+        for (size_t k = 1; k < n; k++) {                                        \
+            T x = a[k];                                                         \
+            size_t c = LESS(x, pivot) ? 1 : 0;                                  \
+            a[k] = a[s];                                                        \
+            a[s] = x;                                                           \
+            s += c;                                                             \
+        }                                                                       \
+        sort_##name##_swap(&a[0], &a[s - 1]);                                   \
+        return s - 1;                                                           \
+    }                                                                           \
+                                                                                \
+    /* Como partition_lt com x <= pivo; devolve quantos ficaram a esquerda */   \
+    static size_t sort_##name##_partition_le(T *a, size_t n) {                  \
+        T pivot = a[0];                                                         \
+        size_t s = 1;                                                           \
+        for (size_t k = 1; k < n; k++) {                                        \
+            T x = a[k];                                                         \
+            size_t c = LESS(pivot, x) ? 0 : 1;                                  \
+            a[k] = a[s];                                                        \
+            a[s] = x;                                                           \
+            s += c;                                                             \
+        }                                                                       \
+        return s;                                                               \
+    }                                                                           \
+                                                                                \
+    /* leftmost = false: a[-1] <= todo elemento de [a, a + n) */                \
+    static void sort_##name##_loop(T *a, size_t n, size_t depth, bool leftmost) { \
+        for (;;) {                                                              \
+            if (n < SORT_KERNEL_INSERTION_THRESHOLD) {                          \
+                BASE(a, n);                                                     \
+                return;                                                         \
+            }                                                                   \
+            if (depth == 0) {                                                   \
+                sort_##name##_heapsort(a, n);                                   \
+                return;                                                         \
+            }                                                                   \
+            depth--;                                                            \
+                                                                                \
+            size_t mid = n / 2;                                                 \
+            if (n > SORT_KERNEL_NINTHER_THRESHOLD) {                            \
+                sort_##name##_sort3(&a[0], &a[mid], &a[n - 1]);                  \
+                sort_##name##_sort3(&a[1], &a[mid - 1], &a[n - 2]);              \
+                sort_##name##_sort3(&a[2], &a[mid + 1], &a[n - 3]);              \
+                sort_##name##_sort3(&a[mid - 1], &a[mid], &a[mid + 1]);          \
+            } else {                                                            \
+                sort_##name##_sort3(&a[0], &a[mid], &a[n - 1]);                  \
+            }                                                                   \
+            sort_##name##_swap(&a[0], &a[mid]);                                 \
+                                                                                \
+            /* Pivo igual ao anterior: todos os iguais saem de uma vez */       \
+            if (!leftmost && !LESS(a[-1], a[0])) {                              \
+                size_t eq = sort_##name##_partition_le(a, n);                   \
+                a += eq;                                                        \
+                n -= eq;                                                        \
+                continue;                                                       \
+            }                                                                   \
+                                                                                \
+            size_t p = sort_##name##_partition_lt(a, n);                        \
+            size_t right = n - p - 1;                                           \
+            if (p < right) {                                                    \
+                sort_##name##_loop(a, p, depth, leftmost);                      \
+                a += p + 1;                                                     \
+                n = right;                                                      \
+                leftmost = false;                                               \
+            } else {                                                            \
+                sort_##name##_loop(a + p + 1, right, depth, false);             \
+                n = p;                                                          \
+            }                                                                   \
+        }                                                                       \
+    }                                                                           \
+                                                                                \
+    void sort_##name(T *arr, size_t n) {                                        \
+        if (arr == NULL || n <= 1) return;                                      \
+        /* Ja ordenado: O(n); em entradas aleatorias sai no inicio */           \
+        size_t run = 1;                                                         \
+        while (run < n && !LESS(arr[run], arr[run - 1])) run++;                 \
+        if (run == n) return;                                                   \
+        size_t depth = 0;                                                       \
+        for (size_t m = n; m > 1; m >>= 1) depth += 2;                          \
+        sort_##name##_loop(arr, n, depth, true);                                \
+    }
+
+#endif /* SORT_KERNELS_H */
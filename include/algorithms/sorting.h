@@ -12,7 +12,7 @@
  * Complexidades:
  * - Quadraticos: Bubble O(n^2), Selection O(n^2), Insertion O(n^2)
  * - Sub-quadratico: Shell O(n^1.25) empirico
- * - Eficientes: Merge O(n log n), Quick O(n log n) avg, Heap O(n log n)
+ * - Eficientes: Merge O(n log n), Quick O(n log n) (pdqsort), Heap O(n log n)
  * - Lineares: Counting O(n+k), Radix O(d*(n+k)), Bucket O(n) avg
  *
  * Referencias:
@@ -28,7 +28,9 @@
 #define SORTING_H
 
 #include "data_structures/common.h"
+#include "algorithms/sort_kernels.h"
 #include <stddef.h>
+#include <stdint.h>
 
 /**
  * @brief Bubble Sort - Ordenacao por troca adjacente
@@ -108,13 +110,16 @@ void merge_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp);
  * @brief Quick Sort - Ordenacao rapida (divide-and-conquer)
  *
  * Particiona em torno de um pivo, ordena recursivamente as particoes.
- * Usa median-of-three para escolha do pivo.
+ * Implementado pelo pattern-defeating quicksort (ds_pdqsort): pivo por
+ * mediana de 3 / ninther, insertion sort em particoes pequenas,
+ * particionamento em blocos sem desvios e fallback para heapsort.
  *
- * Complexidade: O(n log n) medio, O(n^2) pior caso
+ * Complexidade: O(n log n) pior caso, O(n) para entradas ordenadas
  * Espaco: O(log n) pilha de recursao
  * Estavel: Nao
  *
- * Referencia: Cormen S7 (pseudocodigo PARTITION p. 171); Sedgewick S2.3
+ * Referencia: Cormen S7 (pseudocodigo PARTITION p. 171); Sedgewick S2.3;
+ * Peters (2021) "Pattern-defeating Quicksort"
  */
 void quick_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp);
 
@@ -165,6 +170,66 @@ void counting_sort(int *arr, size_t n, int max_val);
  */
 void radix_sort(int *arr, size_t n);
 
+// ============================================================================
+// RADIX SORT LSD BASE 256
+// ============================================================================
+
+/**
+ * @brief Tipo da chave para radix_sort_kv
+ *
+ * Com sinal e ponto flutuante sao transformados em inteiros sem sinal de
+ * mesma ordem (inversao do bit de sinal; negativos IEEE-754 tem todos os
+ * bits invertidos) e restaurados no fim.
+ */
+typedef enum {
+    RADIX_KEY_U32,       /**< uint32_t */
+    RADIX_KEY_U64,       /**< uint64_t */
+    RADIX_KEY_I64,       /**< int64_t */
+    RADIX_KEY_FLOAT,     /**< float (-0.0 antes de +0.0; NaN negativo no inicio, positivo no fim) */
+    RADIX_KEY_DOUBLE     /**< double (mesma ordem que float) */
+} RadixKeyType;
+
+/**
+ * @brief Radix Sort LSD por bytes, com valores associados opcionais
+ *
+ * Um unico passo de leitura monta os histogramas de todos os bytes (em
+ * paralelo no pool global a partir de 65536 chaves: um histograma por
+ * bloco, somados no fim); bytes iguais em todas as chaves pulam o passo. Cada
+ * passo distribui chaves (e valores) para um buffer alternado.
+ *
+ * @param type Tipo das chaves
+ * @param keys Array de chaves (4 ou 8 bytes conforme type)
+ * @param values Array paralelo de valores (NULL = so chaves)
+ * @param n Numero de pares
+ * @param value_size Bytes por valor
+ * @param num_threads Threads do histograma (0 = ds_get_num_threads())
+ *
+ * Em falha de alocacao os arrays nao sao alterados.
+ *
+ * Complexidade: O(w * (n + 256)), w = bytes da chave (4 ou 8)
+ * Espaco: O(n) (copia das chaves e dos valores)
+ * Estavel: Sim
+ *
+ * Referencia: Knuth TAOCP 3 S5.2.5; Terdiman (2000) "Radix Sort Revisited"
+ */
+void radix_sort_kv(RadixKeyType type, void *keys, void *values, size_t n,
+                   size_t value_size, size_t num_threads);
+
+/** @brief Radix Sort base 256 de uint32_t (ver radix_sort_kv) */
+void radix_sort_u32(uint32_t *keys, size_t n, size_t num_threads);
+
+/** @brief Radix Sort base 256 de uint64_t (ver radix_sort_kv) */
+void radix_sort_u64(uint64_t *keys, size_t n, size_t num_threads);
+
+/** @brief Radix Sort base 256 de int64_t (ver radix_sort_kv) */
+void radix_sort_i64(int64_t *keys, size_t n, size_t num_threads);
+
+/** @brief Radix Sort base 256 de float (ver radix_sort_kv) */
+void radix_sort_float(float *keys, size_t n, size_t num_threads);
+
+/** @brief Radix Sort base 256 de double (ver radix_sort_kv) */
+void radix_sort_double(double *keys, size_t n, size_t num_threads);
+
 /**
  * @brief Bucket Sort - Ordenacao por distribuicao em baldes
  *
@@ -182,6 +247,111 @@ void radix_sort(int *arr, size_t n);
  */
 void bucket_sort(double *arr, size_t n);
 
+// ============================================================================
+// ORDENACAO PARALELA (pool global de thread_pool.h)
+// ============================================================================
+
+/**
+ * @brief Merge Sort paralelo com intercalacao paralela
+ *
+ * As duas metades sao ordenadas como tarefas do pool global (threads
+ * ociosas roubam as metades pendentes) e alternam entre arr e um buffer
+ * auxiliar, de modo que cada nivel faz uma unica passada. A intercalacao
+ * tambem e dividida em tarefas: a sequencia maior e partida ao meio e a
+ * outra por busca binaria. Folhas de ate 8192 elementos sao serias.
+ *
+ * @param num_threads 1 = merge_sort; outro valor = pool global inteiro
+ *
+ * Complexidade: O(n log n) trabalho, O(log^3 n) caminho critico
+ * Espaco: O(n)
+ * Estavel: Sim
+ *
+ * Referencia: Cormen S27.3 (P-MERGE-SORT)
+ */
+void parallel_merge_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp,
+                         size_t num_threads);
+
+/**
+ * @brief Sample Sort paralelo para entradas grandes
+ *
+ * Ordena uma amostra de 32 elementos por bucket, escolhe 4 * threads - 1
+ * splitters e distribui os elementos num unico passo (contagem por bloco
+ * + prefixo + scatter). Elementos iguais a um splitter vao para um bucket
+ * proprio, que nao precisa ser ordenado (entradas com muitas repeticoes
+ * nao desbalanceiam). Os buckets sao ordenados com ds_pdqsort por
+ * escalonamento dinamico e copiados de volta.
+ *
+ * Abaixo de 65536 elementos, com 1 thread ou em falha de alocacao, usa
+ * ds_pdqsort serial.
+ *
+ * @param num_threads Threads (0 = ds_get_num_threads())
+ *
+ * Complexidade: O(n log n) esperado
+ * Espaco: O(n) (copia + 2 bytes de bucket por elemento)
+ * Estavel: Nao
+ *
+ * Referencia: Frazer & McKellar (1970) "Samplesort"; Sanders & Winkel
+ * (2004) "Super Scalar Sample Sort"
+ */
+void parallel_sample_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp,
+                          size_t num_threads);
+
+// ============================================================================
+// KERNELS ESPECIALIZADOS POR TIPO (sort_kernels.h)
+// ============================================================================
+
+/**
+ * @brief Ordena ints em ordem crescente com comparacao e trocas inline
+ *
+ * Introsort gerado por SORT_DEFINE(int): sem chamada indireta por
+ * comparacao nem copia por bytes. Mesmo resultado que
+ * quick_sort(arr, n, sizeof(int), compare_int).
+ *
+ * Complexidade: O(n log n) pior caso
+ * Estavel: Nao
+ */
+SORT_DECLARE(int, int);
+
+/**
+ * @brief Ordena doubles em ordem crescente (operador <, sem epsilon)
+ *
+ * Ao contrario de compare_double, valores a menos de 1e-9 sao distintos.
+ */
+SORT_DECLARE(double, double);
+
+/**
+ * @brief Ordena uint64_t em ordem crescente
+ */
+SORT_DECLARE(uint64_t, uint64_t);
+
+// ============================================================================
+// REDES DE ORDENACAO PARA ARRAYS PEQUENOS (sorting_network.c)
+// ============================================================================
+
+/**
+ * @brief Ordena ate 32 ints por uma rede bitonica (AVX2 quando disponivel)
+ *
+ * O array e completado com INT_MAX ate 8, 16 ou 32 elementos e ordenado
+ * por uma sequencia fixa de min/max, sem desvios dependentes dos dados.
+ * Em x86 com AVX2 (detectado em tempo de execucao) cada camada da rede
+ * processa 8 ints por instrucao; SORTING_NO_SIMD deixa so a rede escalar.
+ * Caso base de sort_int, quick_select() e median(). Acima de 32 elementos
+ * delega para sort_int.
+ *
+ * Complexidade: O(1) para n <= 32 (no maximo 15 camadas)
+ * Estavel: Nao
+ */
+void sort_small_int(int *arr, size_t n);
+
+/**
+ * @brief Ordena ate 32 floats pela rede de sort_small_int
+ *
+ * Os floats sao mapeados para int32 preservando a ordem total IEEE-754
+ * (-NaN < -inf < ... < -0 < +0 < ... < inf < NaN). Acima de 32 elementos
+ * delega para radix_sort_float.
+ */
+void sort_small_float(float *arr, size_t n);
+
 /**
  * @brief Verifica se um array esta ordenado
  *
@@ -8,11 +8,17 @@
  * - Rabin-Karp (hashing)
  * - Boyer-Moore (bad character + good suffix)
  *
+ * alem de Horspool, BNDM e Shift-Or com selecao automatica por padrao
+ * pre-compilado, da busca vetorizada por filtro de primeiro/ultimo byte
+ * (SIMD) e do automato de Aho-Corasick para buscar varios padroes de uma vez.
+ *
  * Complexidades:
  * - Naive: O(n*m) pior caso
  * - KMP: O(n+m) garantido
  * - Rabin-Karp: O(n+m) medio, O(n*m) pior caso
  * - Boyer-Moore: O(n/m) melhor caso, O(n*m) pior caso
+ * - SIMD: O(n*m) pior caso, ~n/32 comparacoes vetoriais no caso tipico
+ * - Aho-Corasick: O(n + ocorrencias) para k padroes, apos construcao O(M * sigma)
  *
  * Referencias:
  * - Cormen et al. (2009), Chapters 32.1-32.4
@@ -20,6 +26,8 @@
  * - Boyer, Moore (1977), "A fast string searching algorithm"
  * - Karp, Rabin (1987), "Efficient randomized pattern-matching algorithms"
  * - Sedgewick & Wayne (2011), Chapter 5.3
+ * - Aho, Corasick (1975), "Efficient string matching: an aid to bibliographic search"
+ * - Mula, W. (2016), "SIMD-friendly algorithms for substring searching"
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
@@ -30,6 +38,8 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
 
 #define SM_NOT_FOUND ((size_t)-1)
 
@@ -126,6 +136,26 @@ size_t kmp_search(const char *text, const char *pattern);
  */
 MatchResult kmp_search_all(const char *text, const char *pattern);
 
+/**
+ * @brief Busca KMP sobre bytes com comprimentos explicitos - primeira ocorrencia
+ *
+ * Variantes *_mem: texto e padrao sao sequencias arbitrarias de bytes
+ * (podem conter zeros), sem strlen. As versoes para strings C chamam estas
+ * apos um unico strlen de cada argumento.
+ *
+ * @param text Bytes do texto (n bytes)
+ * @param n Comprimento do texto
+ * @param pattern Bytes do padrao (m bytes)
+ * @param m Comprimento do padrao
+ * @return size_t Posicao da primeira ocorrencia, 0 se m == 0, ou SM_NOT_FOUND
+ */
+size_t kmp_search_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+/**
+ * @brief Busca KMP sobre bytes - todas as ocorrencias
+ */
+MatchResult kmp_search_all_mem(const void *text, size_t n, const void *pattern, size_t m);
+
 // ============================================================================
 // RABIN-KARP
 // ============================================================================
@@ -152,6 +182,16 @@ size_t rabin_karp_search(const char *text, const char *pattern);
  */
 MatchResult rabin_karp_search_all(const char *text, const char *pattern);
 
+/**
+ * @brief Busca Rabin-Karp sobre bytes com comprimentos explicitos (ver kmp_search_mem)
+ */
+size_t rabin_karp_search_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+/**
+ * @brief Busca Rabin-Karp sobre bytes - todas as ocorrencias
+ */
+MatchResult rabin_karp_search_all_mem(const void *text, size_t n, const void *pattern, size_t m);
+
 // ============================================================================
 // BOYER-MOORE
 // ============================================================================
@@ -162,8 +202,8 @@ MatchResult rabin_karp_search_all(const char *text, const char *pattern);
  * Combina bad character rule e good suffix rule para pular
  * o maximo de posicoes possivel. Compara da direita para a esquerda.
  *
- * Implementacao simplificada com bad character rule completa
- * e good suffix heuristic.
+ * Implementacao com bad character rule e regra completa do bom sufixo
+ * (good suffix rule).
  *
  * @param text Texto onde buscar
  * @param pattern Padrao a encontrar
@@ -181,4 +221,365 @@ size_t boyer_moore_search(const char *text, const char *pattern);
  */
 MatchResult boyer_moore_search_all(const char *text, const char *pattern);
 
+/**
+ * @brief Busca Boyer-Moore sobre bytes com comprimentos explicitos (ver kmp_search_mem)
+ *
+ * Usa a regra completa do bom sufixo (pre-processamento O(m) pelos
+ * sufixos de Charras & Lecroq) e a tabela de mau caractere sobre os 256
+ * valores de byte.
+ */
+size_t boyer_moore_search_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+/**
+ * @brief Busca Boyer-Moore sobre bytes - todas as ocorrencias
+ */
+MatchResult boyer_moore_search_all_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+// ============================================================================
+// SIMD - filtro de primeiro e ultimo byte
+// ============================================================================
+
+/**
+ * @brief Busca vetorizada - primeira ocorrencia
+ *
+ * Compara 16 ou 32 posicoes candidatas de uma vez: um vetor do texto com o
+ * primeiro byte do padrao e o vetor deslocado de m-1 com o ultimo byte. So
+ * as posicoes em que ambos batem (raras em texto real) sao verificadas com
+ * memcmp. Padroes de 1 byte usam memchr.
+ *
+ * Escolha em tempo de execucao: AVX2 (32 bytes) quando a CPU suporta,
+ * senao SSE2 em x86-64 ou NEON em AArch64 (16 bytes), senao um laco
+ * escalar guiado por memchr. Defina STRING_MATCHING_NO_SIMD para usar
+ * apenas o laco escalar.
+ *
+ * @param text Texto onde buscar
+ * @param pattern Padrao a encontrar
+ * @return size_t Posicao da primeira ocorrencia ou SM_NOT_FOUND
+ *
+ * Complexidade: O(n*m) pior caso (primeiro e ultimo bytes sempre batem),
+ * O(n) tipico com constante bem menor que os lacos byte a byte
+ * Espaco: O(1)
+ *
+ * Referencia: Mula, W. (2016), "SIMD-friendly algorithms for substring searching"
+ */
+size_t simd_search(const char *text, const char *pattern);
+
+/**
+ * @brief Busca vetorizada - todas as ocorrencias (inclusive sobrepostas)
+ */
+MatchResult simd_search_all(const char *text, const char *pattern);
+
+/**
+ * @brief Busca vetorizada sobre bytes com comprimentos explicitos (ver kmp_search_mem)
+ */
+size_t simd_search_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+/**
+ * @brief Busca vetorizada sobre bytes - todas as ocorrencias
+ */
+MatchResult simd_search_all_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+// ============================================================================
+// HORSPOOL, BNDM, SHIFT-OR E SELECAO AUTOMATICA
+// ============================================================================
+
+/**
+ * @brief Algoritmo usado por um padrao pre-compilado
+ */
+typedef enum {
+    SM_ALGO_AUTO = 0,       /**< Escolha por string_search_choose */
+    SM_ALGO_KMP,
+    SM_ALGO_BOYER_MOORE,
+    SM_ALGO_HORSPOOL,       /**< Boyer-Moore-Horspool: so o salto do ultimo byte */
+    SM_ALGO_BNDM,           /**< Backward Nondeterministic DAWG Matching, m <= 64 */
+    SM_ALGO_SHIFT_OR,       /**< Bit-paralelo, m <= 64 */
+    SM_ALGO_SIMD            /**< Filtro de primeiro/ultimo byte (simd_search) */
+} StringSearchAlgorithm;
+
+/**
+ * @brief Padrao pre-processado (opaco)
+ *
+ * Guarda uma copia do padrao e as tabelas do algoritmo escolhido, para
+ * buscar o mesmo padrao em muitos textos (por exemplo, linha a linha de um
+ * log) pagando o pre-processamento uma unica vez.
+ */
+typedef struct StringPattern StringPattern;
+
+/**
+ * @brief Escolhe o algoritmo pelo comprimento e pelo alfabeto do padrao
+ *
+ * O numero de bytes distintos de um padrao com m >= 8 indica o alfabeto do
+ * texto. Com alfabeto pequeno (ate 4 bytes distintos: DNA, dados binarios)
+ * o primeiro e o ultimo byte casam com frequencia e o filtro SIMD passa o
+ * tempo verificando candidatos:
+ * - 32 <= m <= 64: BNDM
+ * - m < 32: Shift-Or (com kernel vetorial, so para 2 bytes distintos)
+ * - m > 64: SIMD com kernel vetorial, senao Boyer-Moore
+ *
+ * Nos demais casos, SIMD; sem kernel vetorial (laco com memchr), Horspool
+ * para m >= 32.
+ */
+StringSearchAlgorithm string_search_choose(const void *pattern, size_t m);
+
+/**
+ * @brief Pre-processa um padrao de m bytes para o algoritmo algo
+ *
+ * @param pattern Bytes do padrao (copiados)
+ * @param m Comprimento (> 0)
+ * @param algo Algoritmo, ou SM_ALGO_AUTO
+ * @return Padrao compilado, ou NULL (pattern NULL, m == 0, algo invalido,
+ *         BNDM/Shift-Or com m > 64 ou falha de alocacao)
+ *
+ * Complexidade: O(m + sigma)
+ */
+StringPattern *string_pattern_compile(const void *pattern, size_t m, StringSearchAlgorithm algo);
+
+/**
+ * @brief Libera um padrao compilado
+ */
+void string_pattern_destroy(StringPattern *sp);
+
+/**
+ * @brief Algoritmo efetivamente usado (SM_ALGO_AUTO ja resolvido)
+ */
+StringSearchAlgorithm string_pattern_algorithm(const StringPattern *sp);
+
+/**
+ * @brief Primeira ocorrencia do padrao compilado em n bytes de text
+ * @return Posicao ou SM_NOT_FOUND
+ */
+size_t string_pattern_search(const StringPattern *sp, const void *text, size_t n);
+
+/**
+ * @brief Todas as ocorrencias (inclusive sobrepostas) do padrao compilado
+ */
+MatchResult string_pattern_search_all(const StringPattern *sp, const void *text, size_t n);
+
+/**
+ * @brief Todas as ocorrencias, reaproveitando a memoria de result
+ *
+ * result->count e zerado e as posicoes sao gravadas no array existente;
+ * so ha realocacao quando a capacidade nao basta. Reutilizando o mesmo
+ * MatchResult a cada linha, a busca deixa de alocar assim que a
+ * capacidade se estabiliza. Liberar com match_result_destroy ao final.
+ *
+ * @param result MatchResult de match_result_create ou de chamadas anteriores
+ * @return false em argumentos NULL ou falha de alocacao (result guarda as
+ *         ocorrencias que couberam)
+ */
+bool string_pattern_search_into(const StringPattern *sp, const void *text, size_t n,
+                                MatchResult *result);
+
+/**
+ * @brief Pre-compila um padrao para KMP (funcao de falha calculada uma vez)
+ *
+ * Atalho para string_pattern_compile(pattern, m, SM_ALGO_KMP); buscar com
+ * string_pattern_search / string_pattern_search_into e liberar com
+ * string_pattern_destroy.
+ */
+StringPattern *kmp_compile(const void *pattern, size_t m);
+
+/**
+ * @brief Pre-compila um padrao para Boyer-Moore (mau caractere e bom sufixo)
+ *
+ * Atalho para string_pattern_compile(pattern, m, SM_ALGO_BOYER_MOORE).
+ */
+StringPattern *bm_compile(const void *pattern, size_t m);
+
+/**
+ * @brief Busca avulsa com o algoritmo de string_search_choose
+ *
+ * Para buscar o mesmo padrao repetidas vezes, prefira
+ * string_pattern_compile + string_pattern_search.
+ *
+ * @return Posicao da primeira ocorrencia, 0 se m == 0, ou SM_NOT_FOUND
+ */
+size_t string_search_auto(const void *text, size_t n, const void *pattern, size_t m);
+
+/**
+ * @brief Busca Horspool sobre bytes - primeira ocorrencia
+ *
+ * Complexidade: O(n/m) melhor caso, O(n*m) pior caso
+ * Referencia: Horspool (1980), "Practical fast searching in strings"
+ */
+size_t horspool_search_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+/**
+ * @brief Busca Horspool sobre bytes - todas as ocorrencias
+ */
+MatchResult horspool_search_all_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+/**
+ * @brief Busca BNDM sobre bytes - primeira ocorrencia (m <= 64)
+ *
+ * Complexidade: O(n/m) melhor caso, O(n*m) pior caso
+ * Referencia: Navarro & Raffinot (1998), "A bit-parallel approach to
+ * suffix automata"
+ */
+size_t bndm_search_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+/**
+ * @brief Busca BNDM sobre bytes - todas as ocorrencias (m <= 64)
+ */
+MatchResult bndm_search_all_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+/**
+ * @brief Busca Shift-Or sobre bytes - primeira ocorrencia (m <= 64)
+ *
+ * Complexidade: O(n), um shift e um or por byte, sem desvios no laco
+ * Referencia: Baeza-Yates & Gonnet (1992), "A new approach to text searching"
+ */
+size_t shift_or_search_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+/**
+ * @brief Busca Shift-Or sobre bytes - todas as ocorrencias (m <= 64)
+ */
+MatchResult shift_or_search_all_mem(const void *text, size_t n, const void *pattern, size_t m);
+
+// ============================================================================
+// AHO-CORASICK - varios padroes
+// ============================================================================
+
+/**
+ * @brief Automato de Aho-Corasick (opaco)
+ *
+ * Trie dos padroes com as transicoes de falha ja resolvidas: um automato
+ * deterministico completo, com exatamente uma consulta de tabela por byte
+ * do texto. A tabela e um unico array plano de estados x classes de bytes
+ * (bytes que nao aparecem em nenhum padrao compartilham uma classe), com os
+ * indices de estado ja multiplicados pela largura da linha. Os estados que
+ * reportam ocorrencias ficam numerados no fim, de modo que o laco de busca
+ * so faz uma comparacao por byte para saber se ha algo a reportar.
+ *
+ * Memoria: 4 bytes por (estado, classe); o numero de estados e no maximo a
+ * soma dos comprimentos dos padroes.
+ */
+typedef struct AhoCorasick AhoCorasick;
+
+/**
+ * @brief Ocorrencia de um padrao: indice do padrao e posicao inicial no texto
+ */
+typedef struct {
+    size_t pattern;
+    size_t position;
+} AhoMatch;
+
+/**
+ * @brief Lista de ocorrencias de aho_corasick_search_all
+ */
+typedef struct {
+    AhoMatch *matches;
+    size_t count;
+    size_t capacity;
+} AhoMatchResult;
+
+/**
+ * @brief Callback por ocorrencia de aho_corasick_scan
+ * @return false para interromper a busca
+ */
+typedef bool (*AhoMatchFn)(size_t pattern, size_t position, void *ctx);
+
+/**
+ * @brief Constroi o automato para k padroes
+ *
+ * Padroes repetidos sao permitidos (cada indice e reportado). O automato
+ * nao guarda ponteiros para os padroes: o array pode ser liberado apos a
+ * construcao.
+ *
+ * @param patterns Array de k strings nao vazias
+ * @param k Numero de padroes
+ * @return Automato, ou NULL (argumentos NULL, k == 0, padrao vazio ou
+ *         falha de alocacao)
+ *
+ * Complexidade: O(M * sigma), M = soma dos comprimentos, sigma = numero de
+ * bytes distintos nos padroes
+ * Referencia: Aho & Corasick (1975); Cormen S32.3 (automato de strings)
+ */
+AhoCorasick *aho_corasick_create(const char *const *patterns, size_t k);
+
+/**
+ * @brief Libera o automato
+ */
+void aho_corasick_destroy(AhoCorasick *ac);
+
+/**
+ * @brief Numero de estados do automato (inclui a raiz)
+ */
+size_t aho_corasick_states(const AhoCorasick *ac);
+
+/**
+ * @brief Percorre n bytes de text reportando cada ocorrencia a fn
+ *
+ * As ocorrencias sao reportadas em ordem de posicao final; na mesma
+ * posicao final, do padrao mais longo para o mais curto. O texto pode
+ * conter bytes nulos.
+ *
+ * @param fn Callback (NULL apenas conta as ocorrencias)
+ * @return Numero de ocorrencias reportadas (incluindo a que interrompeu)
+ *
+ * Complexidade: O(n + ocorrencias)
+ */
+size_t aho_corasick_scan(const AhoCorasick *ac, const char *text, size_t n,
+                         AhoMatchFn fn, void *ctx);
+
+/**
+ * @brief Busca incremental: estado do automato entre blocos de um fluxo
+ *
+ * Permite buscar em dados que chegam em pedacos (leitura de arquivo,
+ * socket, regioes de um mmap) sem junta-los numa string: o estado do
+ * automato e levado de um bloco ao seguinte, entao ocorrencias que cruzam
+ * a fronteira entre blocos sao encontradas, e as posicoes reportadas sao
+ * absolutas (contadas desde o inicio do fluxo). Os blocos tem comprimento
+ * explicito e podem conter bytes nulos. Para um unico padrao, um automato
+ * com k = 1 e a versao deterministica do automato do KMP.
+ *
+ * Os campos sao publicos apenas para permitir alocacao na pilha; use
+ * aho_stream_init e aho_stream_feed. offset e o total de bytes consumidos.
+ */
+typedef struct {
+    const AhoCorasick *ac;
+    uint32_t state;
+    size_t offset;
+    bool stopped;
+} AhoStream;
+
+/**
+ * @brief Inicia (ou reinicia) um fluxo no estado inicial, offset 0
+ */
+void aho_stream_init(AhoStream *stream, const AhoCorasick *ac);
+
+/**
+ * @brief Consome n bytes de chunk, reportando ocorrencias com posicao absoluta
+ *
+ * Se fn devolver false, o fluxo e encerrado: as chamadas seguintes nao
+ * fazem nada ate um novo aho_stream_init.
+ *
+ * @return Numero de ocorrencias reportadas neste bloco
+ *
+ * Complexidade: O(n + ocorrencias)
+ */
+size_t aho_stream_feed(AhoStream *stream, const char *chunk, size_t n,
+                       AhoMatchFn fn, void *ctx);
+
+/**
+ * @brief Busca em um arquivo lido em blocos de 64 KB a partir da posicao atual
+ *
+ * @return Numero de ocorrencias reportadas (0 em argumentos NULL ou falha
+ *         de alocacao; erros de leitura encerram a busca, ver ferror)
+ */
+size_t aho_corasick_scan_file(const AhoCorasick *ac, FILE *file, AhoMatchFn fn, void *ctx);
+
+/**
+ * @brief Todas as ocorrencias de todos os padroes em text (string C)
+ *
+ * @return AhoMatchResult (vazio em argumentos NULL; parcial se faltar
+ *         memoria); liberar com aho_match_result_destroy
+ */
+AhoMatchResult aho_corasick_search_all(const AhoCorasick *ac, const char *text);
+
+/**
+ * @brief Libera memoria de um AhoMatchResult
+ */
+void aho_match_result_destroy(AhoMatchResult *result);
+
 #endif // STRING_MATCHING_H
@@ -0,0 +1,146 @@
+/**
+ * @file suffix_array.h
+ * @brief Suffix array (SA-IS) com array LCP (Kasai) para consultas repetidas
+ *
+ * Complementa string_matching.h no cenario oposto: em vez de pre-processar
+ * o padrao, pre-processa um texto fixo uma unica vez. Depois disso, contar
+ * ou localizar as ocorrencias de qualquer padrao custa O(m log n), sem
+ * percorrer o texto.
+ *
+ * - Construcao: SA-IS (induced sorting), O(n) tempo e memoria auxiliar
+ *   O(n); LCP pelo algoritmo de Kasai, O(n)
+ * - Consulta: duas buscas binarias sobre o SA (limites inferior e superior
+ *   do intervalo de sufixos com prefixo igual ao padrao)
+ * - Memoria: 4 bytes por posicao para o SA e 4 para o LCP (n < 2^32 - 1)
+ *
+ * O indice guarda o ponteiro para o texto, sem copiar: o texto deve
+ * permanecer valido e inalterado enquanto o indice existir. O texto e uma
+ * sequencia arbitraria de bytes (pode conter zeros).
+ *
+ * Serializacao: suffix_array_save grava um cabecalho de 24 bytes seguido
+ * de SA e LCP como uint32_t na ordem de bytes da maquina. O arquivo pode
+ * ser mapeado diretamente (suffix_array_load usa mmap em sistemas POSIX)
+ * ou entregue ja em memoria a suffix_array_from_buffer, sem copia.
+ *
+ * Referencias:
+ * - Nong, G., Zhang, S. & Chan, W. H. (2009). "Linear Suffix Array
+ *   Construction by Almost Pure Induced-Sorting". DCC
+ * - Kasai, T. et al. (2001). "Linear-Time Longest-Common-Prefix
+ *   Computation in Suffix Arrays and Its Applications". CPM
+ * - Manber, U. & Myers, G. (1993). "Suffix arrays: a new method for
+ *   on-line string searches". SIAM J. Computing
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#ifndef SUFFIX_ARRAY_H
+#define SUFFIX_ARRAY_H
+
+#include "algorithms/string_matching.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct SuffixArray SuffixArray;
+
+/**
+ * @brief Constroi o suffix array e o LCP de n bytes de text
+ *
+ * @param text Texto (nao copiado)
+ * @param n Comprimento (n < UINT32_MAX - 1)
+ * @return Indice, ou NULL (text NULL com n > 0, n grande demais ou falha
+ *         de alocacao)
+ *
+ * Complexidade: O(n)
+ */
+SuffixArray *suffix_array_build(const void *text, size_t n);
+
+/**
+ * @brief Libera o indice (e desfaz o mapeamento, se carregado por mmap)
+ */
+void suffix_array_destroy(SuffixArray *sa);
+
+/**
+ * @brief Comprimento do texto indexado
+ */
+size_t suffix_array_length(const SuffixArray *sa);
+
+/**
+ * @brief SA: posicoes iniciais dos sufixos em ordem lexicografica (n entradas)
+ */
+const uint32_t *suffix_array_data(const SuffixArray *sa);
+
+/**
+ * @brief LCP: lcp[i] = maior prefixo comum entre os sufixos sa[i-1] e sa[i]
+ *        (lcp[0] = 0)
+ */
+const uint32_t *suffix_array_lcp(const SuffixArray *sa);
+
+/**
+ * @brief Intervalo [*first, *last) do SA com os sufixos que comecam por pattern
+ *
+ * @return true se existe ao menos uma ocorrencia (m == 0 casa com todos)
+ *
+ * Complexidade: O(m log n)
+ */
+bool suffix_array_range(const SuffixArray *sa, const void *pattern, size_t m,
+                        size_t *first, size_t *last);
+
+/**
+ * @brief Numero de ocorrencias de pattern (inclusive sobrepostas)
+ *
+ * Complexidade: O(m log n)
+ */
+size_t suffix_array_count(const SuffixArray *sa, const void *pattern, size_t m);
+
+/**
+ * @brief Posicoes de todas as ocorrencias, em ordem crescente
+ *
+ * @return MatchResult (vazio em argumentos NULL, m == 0 ou sem ocorrencia)
+ *
+ * Complexidade: O(m log n + occ log occ)
+ */
+MatchResult suffix_array_locate(const SuffixArray *sa, const void *pattern, size_t m);
+
+/**
+ * @brief Maior substring que ocorre ao menos duas vezes (maximo do LCP)
+ *
+ * @param position Saida: uma posicao da substring (pode ser NULL)
+ * @return Comprimento (0 se nao ha repeticao)
+ *
+ * Complexidade: O(n)
+ */
+size_t suffix_array_longest_repeat(const SuffixArray *sa, size_t *position);
+
+/**
+ * @brief Grava SA e LCP em path (o texto nao e gravado)
+ * @return false em argumentos NULL ou erro de escrita
+ */
+bool suffix_array_save(const SuffixArray *sa, const char *path);
+
+/**
+ * @brief Carrega um indice gravado por suffix_array_save
+ *
+ * Em sistemas POSIX o arquivo e mapeado com mmap (somente leitura, sem
+ * copia); nos demais, lido para a memoria.
+ *
+ * @param path Arquivo do indice
+ * @param text O mesmo texto usado na construcao
+ * @param n Seu comprimento (conferido com o cabecalho)
+ * @return Indice, ou NULL (arquivo invalido, n diferente ou erro de E/S)
+ */
+SuffixArray *suffix_array_load(const char *path, const void *text, size_t n);
+
+/**
+ * @brief Usa um indice serializado que ja esta em memoria, sem copia
+ *
+ * buffer (por exemplo, uma regiao mapeada pelo chamador) deve continuar
+ * valido enquanto o indice existir e estar alinhado a 4 bytes.
+ *
+ * @return Indice, ou NULL (cabecalho invalido, tamanho ou n incompativeis)
+ */
+SuffixArray *suffix_array_from_buffer(const void *buffer, size_t size, const void *text, size_t n);
+
+#endif // SUFFIX_ARRAY_H
@@ -0,0 +1,134 @@
+/**
+ * @file arena.h
+ * @brief Arena (bump allocator) com pools por classe de tamanho
+ *
+ * Alocador em blocos grandes ("chunks") para containers baseados em nós.
+ * Em vez de um malloc por nó, os nós são recortados sequencialmente de
+ * chunks contíguos, o que:
+ * - elimina o overhead de cabeçalho do malloc por nó
+ * - melhora a localidade (nós vizinhos na memória)
+ * - permite liberar todos os nós de uma vez (reset/destroy)
+ *
+ * Blocos liberados individualmente vão para uma free-list da sua classe
+ * de tamanho (múltiplos de 16 bytes até DS_ARENA_MAX_POOLED) e são
+ * reutilizados por alocações do mesmo tamanho: para nós de tamanho fixo
+ * a arena se comporta como um pool allocator.
+ *
+ * Uso típico:
+ * @code
+ * DSArena *arena = ds_arena_create(0);
+ * DSAllocator alloc = ds_arena_allocator(arena);
+ * BST *tree = bst_create_with_allocator(sizeof(int), compare_int, NULL, &alloc);
+ * // ... inserções/remoções ...
+ * ds_arena_destroy(arena);  // libera a árvore inteira de uma só vez
+ * @endcode
+ *
+ * Referências:
+ * - Hanson, D. R. (1990). "Fast Allocation and Deallocation of Memory
+ *   Based on Object Lifetimes". Software: Practice and Experience 20(1).
+ * - Wilson et al. (1995). "Dynamic Storage Allocation: A Survey and
+ *   Critical Review"
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include "common.h"
+#include <stddef.h>
+
+/** Tamanho padrão de chunk (64 KiB) */
+#define DS_ARENA_DEFAULT_CHUNK (64u * 1024u)
+
+/** Maior bloco reaproveitado via free-list por classe de tamanho */
+#define DS_ARENA_MAX_POOLED 512u
+
+typedef struct DSArena DSArena;
+
+/**
+ * @brief Cria uma arena vazia
+ *
+ * @param chunk_size Tamanho de cada chunk em bytes (0 = DS_ARENA_DEFAULT_CHUNK)
+ * @return DSArena* Arena criada ou NULL em falha
+ *
+ * Nenhum chunk é alocado até a primeira alocação.
+ *
+ * Complexidade: O(1)
+ */
+DSArena* ds_arena_create(size_t chunk_size);
+
+/**
+ * @brief Destrói a arena e todos os blocos alocados nela
+ *
+ * Containers que usam a arena não devem ser usados após esta chamada
+ * (nem destruídos: a memória deles já foi liberada).
+ *
+ * Complexidade: O(número de chunks)
+ */
+void ds_arena_destroy(DSArena *arena);
+
+/**
+ * @brief Aloca size bytes alinhados a max_align_t
+ *
+ * Reutiliza um bloco da free-list da classe, se houver; senão avança o
+ * ponteiro do chunk atual. Pedidos maiores que o chunk recebem um chunk
+ * dedicado.
+ *
+ * @return void* Bloco alocado ou NULL em falha
+ *
+ * Complexidade: O(1) amortizado
+ */
+void* ds_arena_alloc(DSArena *arena, size_t size);
+
+/**
+ * @brief Redimensiona um bloco da arena
+ *
+ * Se ptr for o último bloco do chunk corrente e houver espaço, cresce ou
+ * encolhe no lugar; senão aloca um novo bloco, copia e libera o antigo.
+ *
+ * @return void* Bloco redimensionado ou NULL em falha (ptr segue válido)
+ *
+ * Complexidade: O(1) no lugar; O(old_size) com cópia
+ */
+void* ds_arena_realloc(DSArena *arena, void *ptr, size_t old_size, size_t new_size);
+
+/**
+ * @brief Devolve um bloco à arena
+ *
+ * @param size Mesmo tamanho passado a ds_arena_alloc
+ *
+ * Blocos de até DS_ARENA_MAX_POOLED bytes entram na free-list da classe;
+ * blocos maiores só são recuperados no reset/destroy.
+ *
+ * Complexidade: O(1)
+ */
+void ds_arena_free(DSArena *arena, void *ptr, size_t size);
+
+/**
+ * @brief Invalida todas as alocações, mantendo o primeiro chunk para reuso
+ *
+ * Complexidade: O(número de chunks)
+ */
+void ds_arena_reset(DSArena *arena);
+
+/**
+ * @brief Bytes entregues por ds_arena_alloc ainda não devolvidos
+ */
+size_t ds_arena_bytes_used(const DSArena *arena);
+
+/**
+ * @brief Bytes reservados em chunks (memória realmente obtida do sistema)
+ */
+size_t ds_arena_bytes_reserved(const DSArena *arena);
+
+/**
+ * @brief Obtém um DSAllocator que aloca nesta arena
+ *
+ * O alocador retornado não possui a arena: ela deve sobreviver a todos
+ * os containers criados com ele.
+ */
+DSAllocator ds_arena_allocator(DSArena *arena);
+
+#endif // ARENA_H
@@ -50,9 +50,15 @@ typedef struct ArrayList ArrayList;
 typedef enum {
     GROWTH_DOUBLE,    /**< Crescimento 2x (padrão, melhor análise amortizada) */
     GROWTH_1_5,       /**< Crescimento 1.5x (menos desperdício de memória) */
-    GROWTH_FIXED      /**< Crescimento fixo de N elementos */
+    GROWTH_FIXED,     /**< Crescimento fixo de N elementos */
+    GROWTH_GOLDEN     /**< Crescimento ≈1.618x (razão áurea, aproximada por 1.625) */
 } GrowthStrategy;
 
+/**
+ * @brief Predicado de arraylist_erase_if (true = remover o elemento)
+ */
+typedef bool (*ArrayListPredicateFn)(const void *element, void *ctx);
+
 // ============================================================================
 // FUNÇÕES DE CRIAÇÃO E DESTRUIÇÃO
 // ============================================================================
@@ -92,6 +98,50 @@ ArrayList* arraylist_create(size_t element_size, size_t initial_capacity, Destro
 ArrayList* arraylist_create_with_growth(size_t element_size, size_t initial_capacity,
                                         GrowthStrategy growth, DestroyFn destroy);
 
+/**
+ * @brief Cria um ArrayList cujo cabeçalho e buffer vêm de um alocador customizado
+ *
+ * @param element_size Tamanho de cada elemento em bytes
+ * @param initial_capacity Capacidade inicial
+ * @param growth Estratégia de crescimento
+ * @param destroy Função de destruição customizada
+ * @param allocator Alocador (NULL = malloc/realloc/free); arraylist_clone() o herda
+ * @return ArrayList* Ponteiro para o ArrayList criado, ou NULL em caso de erro
+ *
+ * Complexidade: O(capacity)
+ */
+ArrayList* arraylist_create_with_allocator(size_t element_size, size_t initial_capacity,
+                                           GrowthStrategy growth, DestroyFn destroy,
+                                           const DSAllocator *allocator);
+
+/**
+ * @brief Cria um ArrayList com os primeiros elementos embutidos no cabeçalho
+ *
+ * Os primeiros inline_capacity elementos vivem na mesma alocação do
+ * cabeçalho: uma lista pequena custa uma única alocação e nenhum acesso
+ * indireto a outro bloco. Ao passar de inline_capacity os elementos vão
+ * para um buffer separado, e arraylist_shrink_to_fit os traz de volta
+ * quando voltam a caber.
+ *
+ * @param element_size Tamanho de cada elemento em bytes
+ * @param inline_capacity Elementos no buffer embutido (> 0)
+ * @param growth Estratégia de crescimento após o buffer embutido
+ * @param destroy Função de destruição customizada
+ * @param allocator Alocador (NULL = malloc/realloc/free)
+ * @return ArrayList* Ponteiro para o ArrayList criado, ou NULL em caso de erro
+ *
+ * Exemplo:
+ * @code
+ * // Milhões de listas de 2-3 ids: uma alocação por lista
+ * ArrayList *ids = arraylist_create_small(sizeof(int), 4, GROWTH_DOUBLE, NULL, NULL);
+ * @endcode
+ *
+ * Complexidade: O(1)
+ */
+ArrayList* arraylist_create_small(size_t element_size, size_t inline_capacity,
+                                  GrowthStrategy growth, DestroyFn destroy,
+                                  const DSAllocator *allocator);
+
 /**
  * @brief Destrói o ArrayList e libera toda a memória associada
  *
@@ -154,6 +204,32 @@ DataStructureError arraylist_push_front(ArrayList *list, const void *data);
  */
 DataStructureError arraylist_insert(ArrayList *list, size_t index, const void *data);
 
+/**
+ * @brief Insere count elementos contíguos de data no final
+ *
+ * Cresce no máximo uma vez (até a capacidade da estratégia ou até caber
+ * o lote, o que for maior) e copia com um único memcpy.
+ *
+ * @return DataStructureError Código de erro (lista inalterada em caso de erro)
+ *
+ * Complexidade: O(count) amortizado
+ */
+DataStructureError arraylist_append_n(ArrayList *list, const void *data, size_t count);
+
+/**
+ * @brief Insere count elementos contíguos de data a partir de index
+ *
+ * Os elementos em [index, size) são deslocados uma única vez, com um
+ * memmove, em vez de uma vez por elemento inserido.
+ *
+ * @param index Posição do primeiro elemento inserido (0..size)
+ * @return DataStructureError Código de erro (lista inalterada em caso de erro)
+ *
+ * Complexidade: O(n + count)
+ */
+DataStructureError arraylist_insert_range(ArrayList *list, size_t index,
+                                          const void *data, size_t count);
+
 // ============================================================================
 // OPERAÇÕES DE REMOÇÃO
 // ============================================================================
@@ -196,6 +272,32 @@ DataStructureError arraylist_pop_front(ArrayList *list, void *output);
  */
 DataStructureError arraylist_remove_at(ArrayList *list, size_t index, void *output);
 
+/**
+ * @brief Remove os elementos [first, first + count)
+ *
+ * Chama destroy em cada elemento removido e fecha o espaço com um único
+ * memmove.
+ *
+ * @return DataStructureError Código de erro (DS_ERROR_INVALID_INDEX se o
+ *         intervalo passar do fim)
+ *
+ * Complexidade: O(n - first)
+ */
+DataStructureError arraylist_erase_range(ArrayList *list, size_t first, size_t count);
+
+/**
+ * @brief Remove todos os elementos para os quais pred retorna true
+ *
+ * Compactação estável em uma passada: cada bloco de elementos mantidos é
+ * movido uma vez para sua posição final. destroy é chamado nos removidos.
+ *
+ * @param ctx Repassado a pred
+ * @return size_t Número de elementos removidos
+ *
+ * Complexidade: O(n)
+ */
+size_t arraylist_erase_if(ArrayList *list, ArrayListPredicateFn pred, void *ctx);
+
 /**
  * @brief Remove a primeira ocorrência de um valor
  *
@@ -320,6 +422,29 @@ size_t arraylist_size(const ArrayList *list);
  */
 size_t arraylist_capacity(const ArrayList *list);
 
+/**
+ * @brief Retorna os bytes ocupados pelo ArrayList
+ *
+ * @param list Ponteiro para o ArrayList
+ * @return size_t Cabeçalho (com o buffer embutido, se houver) mais o buffer
+ *         externo inteiro, incluindo a capacidade não usada; buffers
+ *         mapeados contam páginas inteiras
+ *
+ * Complexidade: O(1)
+ */
+size_t arraylist_memory_usage(const ArrayList *list);
+
+/**
+ * @brief Verifica se os elementos estão no buffer embutido
+ *
+ * @param list Ponteiro para o ArrayList
+ * @return true se a lista foi criada com arraylist_create_small e ainda
+ *         cabe no buffer embutido
+ *
+ * Complexidade: O(1)
+ */
+bool arraylist_is_inline(const ArrayList *list);
+
 /**
  * @brief Remove todos os elementos do ArrayList
  *
@@ -396,10 +521,10 @@ ArrayList* arraylist_clone(const ArrayList *list, CopyFn copy);
  * @param list Ponteiro para o ArrayList
  * @param compare Função de comparação
  *
- * Usa QuickSort otimizado (stdlib qsort internamente).
- * Referência: Hoare, C. A. R. (1962). "Quicksort"
+ * Usa o pattern-defeating quicksort (ds_pdqsort, ver pdqsort.h).
+ * Referência: Peters, O. R. L. (2021). "Pattern-defeating Quicksort"
  *
- * Complexidade: O(n log n) esperado, O(n²) pior caso
+ * Complexidade: O(n log n) pior caso, O(n) se já ordenado
  */
 void arraylist_sort(ArrayList *list, CompareFn compare);
 
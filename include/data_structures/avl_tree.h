@@ -38,8 +38,29 @@ typedef struct AVLNode AVLNode;
  * @brief Cria AVL tree
  */
 AVLTree* avl_create(size_t element_size, CompareFn compare, DestroyFn destroy);
+
+/**
+ * @brief Cria AVL tree com nós obtidos de um alocador customizado
+ *
+ * allocator NULL = malloc/free. avl_clone() herda o mesmo alocador.
+ */
+AVLTree* avl_create_with_allocator(size_t element_size, CompareFn compare,
+                                   DestroyFn destroy, const DSAllocator *allocator);
 void avl_destroy(AVLTree *tree);
 
+/**
+ * @brief Constrói AVL perfeitamente balanceada a partir de array ordenado
+ *
+ * Sem rotações: o elemento do meio vira a raiz, recursivamente.
+ *
+ * @param array Elementos em ordem não-decrescente de compare (copiados)
+ * @return AVLTree* Árvore criada, ou NULL (array fora de ordem ou sem memória)
+ *
+ * Complexidade: O(n)
+ */
+AVLTree* avl_from_sorted_array(size_t element_size, const void *array, size_t size,
+                               CompareFn compare, DestroyFn destroy);
+
 /**
  * @brief Insere elemento mantendo balanceamento
  *
@@ -55,6 +76,9 @@ void avl_destroy(AVLTree *tree);
  * - LR (Left-Right): rotação esquerda-direita dupla
  * - RL (Right-Left): rotação direita-esquerda dupla
  *
+ * Retorna DS_ERROR_FULL com DS_INDEX_MAX elementos (só alcançável com
+ * DS_COMPACT_INDEX).
+ *
  * Complexidade: O(log n) GARANTIDO
  */
 DataStructureError avl_insert(AVLTree *tree, const void *data);
@@ -86,17 +110,144 @@ DataStructureError avl_max(const AVLTree *tree, void *output);
 DataStructureError avl_range_search(const AVLTree *tree, const void *min,
                                     const void *max, void **results, size_t *count);
 
-// Travessias
+/**
+ * @brief Retorna o k-ésimo menor elemento (Order Statistics)
+ *
+ * Cada nó guarda o tamanho da sua subárvore, mantido nas rotações.
+ *
+ * @param k Posição (1 = menor, size = maior), como em bst_select
+ * @return DS_SUCCESS, DS_ERROR_INVALID_INDEX ou DS_ERROR_NULL_POINTER
+ *
+ * Referência: Cormen et al., 2009, Chapter 14 (Order-Statistic Trees)
+ *
+ * Complexidade: O(log n) GARANTIDO
+ */
+DataStructureError avl_select(const AVLTree *tree, size_t k, void *output);
+
+/**
+ * @brief Rank de um elemento: quantos são estritamente menores
+ *
+ * Mesma convenção de bst_rank (posição em ordem, começando de 0); não
+ * exige que data esteja na árvore.
+ *
+ * Complexidade: O(log n) GARANTIDO
+ */
+size_t avl_rank(const AVLTree *tree, const void *data);
+
+/**
+ * @brief Quantos elementos estão em [min, max] (sem copiá-los)
+ *
+ * Complexidade: O(log n) GARANTIDO
+ */
+size_t avl_range_count(const AVLTree *tree, const void *min, const void *max);
+
+/*
+ * Operações de conjunto baseadas em join/split (Blelloch, Ferizovic &
+ * Sun, 2016): tree é modificada no lugar e other é só lida. Custo
+ * O(m log(n/m + 1)) para tamanhos m <= n: juntar um índice pequeno a um
+ * grande não percorre o grande, e dois índices do mesmo tamanho saem em
+ * tempo linear. Pensadas para chaves únicas; com repetidos o resultado
+ * continua uma AVL válida, mas cada elemento de other é casado com no
+ * máximo uma cópia em tree.
+ *
+ * Com o alocador padrão e ds_get_num_threads() > 1, as duas metades de
+ * cada nível grande rodam em paralelo no pool global (thread_pool.h):
+ * compare, copy_fn e destroy podem ser chamadas de várias threads ao mesmo
+ * tempo. Árvores com alocador customizado são processadas em série.
+ */
+
+/**
+ * @brief tree = tree ∪ other
+ *
+ * Elementos de other sem igual em tree são copiados (copy_fn, ou memcpy
+ * se NULL); nos iguais fica o de tree.
+ *
+ * @return DS_SUCCESS, DS_ERROR_NULL_POINTER ou DS_ERROR_OUT_OF_MEMORY (tree
+ *         continua válida, sem parte dos elementos de other)
+ */
+DataStructureError avl_union(AVLTree *tree, const AVLTree *other, CopyFn copy_fn);
+
+/**
+ * @brief tree = tree ∩ other (remove de tree o que não tem igual em other)
+ */
+DataStructureError avl_intersection(AVLTree *tree, const AVLTree *other);
+
+/**
+ * @brief tree = tree \ other (remove de tree o que tem igual em other)
+ */
+DataStructureError avl_difference(AVLTree *tree, const AVLTree *other);
+
+// Travessias (iterativas, sobre AVLIter; sem recursão)
 typedef void (*AVLTraversalFn)(void *data, void *user_data);
 void avl_inorder(const AVLTree *tree, AVLTraversalFn callback, void *user_data);
 void avl_preorder(const AVLTree *tree, AVLTraversalFn callback, void *user_data);
 void avl_postorder(const AVLTree *tree, AVLTraversalFn callback, void *user_data);
 
+/**
+ * Profundidade máxima da pilha do iterador. A altura de uma AVL com n nós
+ * é < 1.4405 log2(n + 2), ou seja < 93 para qualquer n de 64 bits.
+ */
+#define AVL_ITER_MAX_DEPTH 96
+
+typedef enum {
+    AVL_INORDER,
+    AVL_PREORDER,
+    AVL_POSTORDER
+} AVLOrder;
+
+/**
+ * @brief Cursor de travessia com pilha explícita de tamanho fixo
+ *
+ * Os nós da AVL não têm ponteiro de pai; o caminho pendente fica em uma
+ * pilha dentro do próprio cursor (alocado pelo chamador, sem malloc), que
+ * pode ser pausado e retomado. Campos são de uso interno; a árvore não deve
+ * ser modificada enquanto o cursor estiver ativo.
+ */
+typedef struct {
+    const AVLNode *stack[AVL_ITER_MAX_DEPTH];  /**< Nós pendentes (uso interno) */
+    size_t depth;                              /**< Altura da pilha (uso interno) */
+    AVLOrder order;                            /**< Ordem da travessia */
+} AVLIter;
+
+/**
+ * @brief Posiciona o cursor no primeiro nó da ordem pedida
+ *
+ * Complexidade: O(log n)
+ */
+void avl_iter_begin(const AVLTree *tree, AVLOrder order, AVLIter *it);
+
+/**
+ * @brief Cursor em ordem a partir do primeiro elemento >= key
+ *
+ * Complexidade: O(log n)
+ */
+void avl_iter_seek(const AVLTree *tree, const void *key, AVLIter *it);
+
+/**
+ * @brief Devolve o próximo elemento e avança
+ *
+ * @param data Saída: dados do nó (pode ser NULL)
+ * @return false quando a travessia terminou
+ *
+ * Complexidade: O(1) amortizado, O(log n) no pior caso
+ */
+bool avl_iter_next(AVLIter *it, void **data);
+
 // Propriedades
 bool avl_is_empty(const AVLTree *tree);
 size_t avl_size(const AVLTree *tree);
 int avl_height(const AVLTree *tree);
 
+/**
+ * @brief Bytes alocados: cabeçalho e, por elemento, nó + cópia dos dados
+ *
+ * Cada nó guarda três ponteiros (dados, esquerda, direita), o tamanho da
+ * subárvore e a altura: 40 bytes, ou 32 com DS_COMPACT_INDEX.
+ *
+ * Complexidade: O(1)
+ */
+size_t avl_memory_usage(const AVLTree *tree);
+
 /**
  * @brief Verifica se a árvore é AVL válida
  *
@@ -65,6 +65,22 @@ typedef struct TreeNode TreeNode;
  */
 BinaryTree* btree_create(size_t element_size, CompareFn compare, DestroyFn destroy);
 
+/**
+ * @brief Cria uma árvore binária com nós obtidos de um alocador customizado
+ *
+ * @param element_size Tamanho de cada elemento em bytes
+ * @param compare Função de comparação (pode ser NULL)
+ * @param destroy Função de destruição (NULL se não necessário)
+ * @param allocator Alocador de nós e do cabeçalho (NULL = malloc/free);
+ *                  btree_clone() herda o mesmo alocador
+ * @return BinaryTree* Ponteiro para a árvore criada, ou NULL em caso de erro
+ *
+ * Complexidade: O(1)
+ */
+BinaryTree* btree_create_with_allocator(size_t element_size, CompareFn compare,
+                                        DestroyFn destroy,
+                                        const DSAllocator *allocator);
+
 /**
  * @brief Destrói a árvore e libera memória
  *
@@ -211,7 +227,11 @@ typedef void (*TraversalFn)(void *data, void *user_data);
  *
  * Para BST: visita nós em ordem crescente
  *
- * Complexidade: O(n)
+ * As três travessias em profundidade são iterativas e seguem os ponteiros
+ * de pai (sem recursão nem pilha): árvores degeneradas não estouram a
+ * pilha de chamadas.
+ *
+ * Complexidade: O(n) tempo, O(1) espaço
  */
 void btree_inorder(const BinaryTree *tree, TraversalFn callback, void *user_data);
 
@@ -269,6 +289,64 @@ void btree_postorder(const BinaryTree *tree, TraversalFn callback, void *user_da
  */
 void btree_levelorder(const BinaryTree *tree, TraversalFn callback, void *user_data);
 
+/**
+ * @brief Ordens de travessia do iterador
+ */
+typedef enum {
+    BTREE_INORDER,
+    BTREE_PREORDER,
+    BTREE_POSTORDER
+} BTreeOrder;
+
+/** Entradas da pilha do cursor (potência de 2) */
+#define BTREE_ITER_STACK 64
+
+/**
+ * @brief Cursor de travessia (alocado pelo chamador)
+ *
+ * Os nós pendentes ficam em uma pilha circular de BTREE_ITER_STACK
+ * entradas dentro do cursor. Em árvores mais fundas as entradas mais
+ * antigas são descartadas e recuperadas pelos ponteiros de pai, então o
+ * espaço é fixo para qualquer altura (inclusive uma lista degenerada).
+ *
+ * A travessia pode ser pausada e retomada a qualquer momento, consumindo
+ * a árvore sob demanda. Campos são de uso interno; a árvore não deve ser
+ * modificada enquanto o cursor estiver ativo.
+ */
+typedef struct {
+    const TreeNode *stack[BTREE_ITER_STACK];  /**< Pendentes (uso interno) */
+    size_t top;                               /**< Topo da pilha circular (uso interno) */
+    size_t count;                             /**< Entradas válidas (uso interno) */
+    bool truncated;                           /**< Houve descarte (uso interno) */
+    const TreeNode *last;                     /**< Último nó devolvido (uso interno) */
+    BTreeOrder order;                         /**< Ordem da travessia */
+} BTreeIter;
+
+/**
+ * @brief Posiciona o cursor no primeiro nó da ordem pedida
+ *
+ * Exemplo:
+ * @code
+ * BTreeIter it;
+ * void *data;
+ * btree_iter_begin(tree, BTREE_INORDER, &it);
+ * while (btree_iter_next(&it, &data)) { ... }
+ * @endcode
+ *
+ * Complexidade: O(h)
+ */
+void btree_iter_begin(const BinaryTree *tree, BTreeOrder order, BTreeIter *it);
+
+/**
+ * @brief Devolve o próximo elemento e avança
+ *
+ * @param data Saída: dados do nó (pode ser NULL)
+ * @return false quando a travessia terminou
+ *
+ * Complexidade: O(1) amortizado, O(h) no pior caso
+ */
+bool btree_iter_next(BTreeIter *it, void **data);
+
 // ============================================================================
 // CONSULTAS E PROPRIEDADES
 // ============================================================================
@@ -293,6 +371,16 @@ bool btree_is_empty(const BinaryTree *tree);
  */
 size_t btree_size(const BinaryTree *tree);
 
+/**
+ * @brief Retorna os bytes ocupados pela árvore (cabeçalho, nós e dados)
+ *
+ * @param tree Ponteiro para a árvore
+ * @return size_t Bytes alocados
+ *
+ * Complexidade: O(1)
+ */
+size_t btree_memory_usage(const BinaryTree *tree);
+
 /**
  * @brief Retorna a altura da árvore
  *
@@ -474,4 +562,68 @@ int btree_distance(const BinaryTree *tree, TreeNode *node1, TreeNode *node2);
  */
 int btree_diameter(const BinaryTree *tree);
 
+// ============================================================================
+// ÍNDICE DE LCA (ÁRVORE ESTÁTICA)
+// ============================================================================
+
+/**
+ * @brief Índice pré-processado para LCA e distância em O(1)
+ *
+ * Para muitas consultas sobre uma árvore que não muda. Os nós são
+ * numerados em pré-ordem; para u, v com pre(u) < pre(v), o LCA é o pai do
+ * nó de menor profundidade de pai em (pre(u), pre(v)] — um RMQ sobre um
+ * array de n chaves, sem o tour de Euler de 2n - 1 posições.
+ *
+ * O RMQ usa blocos de 64: dentro do bloco, uma máscara de 64 bits por
+ * posição (pilha de mínimos) resolve a consulta com um ctz; entre blocos,
+ * uma sparse table sobre os mínimos dos blocos. Memória O(n), ~20 bytes
+ * por nó, mais uma tabela nó → índice.
+ *
+ * O índice fica inválido se a árvore for modificada.
+ *
+ * Referências:
+ * - Bender, M. A. & Farach-Colton, M. (2000). "The LCA Problem Revisited".
+ *   LATIN 2000
+ * - Fischer, J. & Heun, V. (2006). "Theoretical and Practical Improvements
+ *   on the RMQ-Problem, with Applications to LCA and LCE". CPM 2006
+ */
+typedef struct BTreeLCAIndex BTreeLCAIndex;
+
+/**
+ * @brief Pré-processa a árvore para consultas de LCA
+ *
+ * @param tree Árvore (não vazia, com menos de 2^32 nós)
+ * @return BTreeLCAIndex* Índice (usa o alocador da árvore) ou NULL
+ *
+ * Complexidade: O(n) (travessia iterativa, sem recursão)
+ */
+BTreeLCAIndex* btree_lca_index_create(const BinaryTree *tree);
+
+void btree_lca_index_destroy(BTreeLCAIndex *index);
+
+/**
+ * @brief LCA de dois nós da árvore indexada
+ *
+ * @return TreeNode* LCA, ou NULL se algum nó não pertence à árvore
+ *
+ * Complexidade: O(1)
+ */
+TreeNode* btree_lca_index_query(const BTreeLCAIndex *index, const TreeNode *node1,
+                                const TreeNode *node2);
+
+/**
+ * @brief Distância em arestas entre dois nós, -1 se algum não pertence à árvore
+ *
+ * Complexidade: O(1)
+ */
+int btree_lca_index_distance(const BTreeLCAIndex *index, const TreeNode *node1,
+                             const TreeNode *node2);
+
+/**
+ * @brief Profundidade do nó (raiz = 0), -1 se não pertence à árvore
+ *
+ * Complexidade: O(1)
+ */
+int btree_lca_index_depth(const BTreeLCAIndex *index, const TreeNode *node);
+
 #endif // BINARY_TREE_H
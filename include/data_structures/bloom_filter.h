@@ -0,0 +1,115 @@
+/**
+ * @file bloom_filter.h
+ * @brief Filtro de Bloom em blocos: um acesso à memória por consulta
+ *
+ * Filtro de pertinência probabilístico para evitar consultas caras (disco,
+ * rede, uma HashTable enorme) a chaves que certamente não existem. Nunca
+ * gera falsos negativos; falsos positivos ocorrem com taxa controlada pelo
+ * número de bits por chave.
+ *
+ * Em vez de espalhar k bits pelo array inteiro (k cache misses), cada
+ * chave escolhe um único bloco de 64 bytes — uma linha de cache — e liga um
+ * bit em cada uma das 8 palavras de 64 bits do bloco ("split block", como
+ * no Parquet/Impala). A consulta lê uma linha e testa as 8 palavras sem
+ * desvios, em um laço que o compilador vetoriza.
+ *
+ * Taxa de falsos positivos medida (k = 8):
+ * - 8 bits/chave: ~2.9%    - 12 bits/chave: ~0.42%
+ * - 10 bits/chave: ~1.0%   - 16 bits/chave: ~0.09%
+ * Um pouco acima de um Bloom clássico com os mesmos bits, pela variação
+ * de ocupação entre blocos.
+ *
+ * Complexidade:
+ * - Add / Contains: O(1), uma linha de cache
+ * - Memória: bits_per_key * expected_items bits (arredondado a blocos)
+ *
+ * Referências:
+ * - Putze, F., Sanders, P. & Singler, J. (2007). "Cache-, Hash- and
+ *   Space-Efficient Bloom Filters". WEA 2007
+ * - Apache Parquet, "Split Block Bloom Filter" (especificação)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include "common.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Bytes por bloco (uma linha de cache) */
+#define BLOOM_BLOCK_BYTES 64
+
+typedef struct BloomFilter BloomFilter;
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+/**
+ * @brief Cria um filtro vazio dimensionado para expected_items chaves
+ *
+ * @param expected_items Número previsto de chaves (> 0)
+ * @param bits_per_key Bits por chave (> 0); 10 dá ~1% de falsos positivos
+ * @param hash_fn Função hash das chaves (mesmo esquema de HashTable)
+ * @return BloomFilter* Filtro criado ou NULL
+ *
+ * O hash é remisturado internamente, então hash_int e similares servem.
+ */
+BloomFilter* bloom_filter_create(size_t expected_items, size_t bits_per_key, HashFn hash_fn);
+
+/**
+ * @brief Cria um filtro com alocador customizado (NULL = libc)
+ */
+BloomFilter* bloom_filter_create_with_allocator(size_t expected_items, size_t bits_per_key,
+                                                HashFn hash_fn, const DSAllocator *allocator);
+
+void bloom_filter_destroy(BloomFilter *filter);
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+/**
+ * @brief Adiciona uma chave
+ *
+ * @return DS_SUCCESS ou DS_ERROR_NULL_POINTER
+ */
+DataStructureError bloom_filter_add(BloomFilter *filter, const void *key);
+
+/**
+ * @brief Testa se a chave pode estar no conjunto
+ *
+ * @return false se a chave certamente não foi adicionada; true se foi ou
+ *         em caso de falso positivo
+ */
+bool bloom_filter_contains(const BloomFilter *filter, const void *key);
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+/**
+ * @brief Número de chamadas a bloom_filter_add desde a criação/clear
+ */
+size_t bloom_filter_count(const BloomFilter *filter);
+
+/**
+ * @brief Bytes ocupados pelos blocos
+ */
+size_t bloom_filter_size_bytes(const BloomFilter *filter);
+
+/**
+ * @brief Bytes alocados ao todo: cabeçalho e blocos com a folga de
+ *        alinhamento (bloom_filter_size_bytes conta só os blocos)
+ */
+size_t bloom_filter_memory_usage(const BloomFilter *filter);
+
+/**
+ * @brief Remove todas as chaves
+ */
+void bloom_filter_clear(BloomFilter *filter);
+
+#endif // BLOOM_FILTER_H
@@ -0,0 +1,184 @@
+/**
+ * @file bplus_tree.h
+ * @brief Árvore B+ - mapa ordenado com nós do tamanho de blocos de cache
+ *
+ * Alternativa à AVL (avl_tree.h) para conjuntos grandes: cada nó guarda
+ * dezenas de elementos contíguos em vez de um, então uma busca toca
+ * O(log_B n) nós em vez de O(log2 n), e o custo de ponteiros passa de 3 por
+ * elemento para cerca de 1 por nó folha.
+ *
+ * Organização:
+ * - Os elementos ficam só nas folhas, em ordem, e cada folha aponta para a
+ *   seguinte: range_search e inorder percorrem a lista sem subir na árvore
+ * - Nós internos guardam separadores (cópias de elementos) e filhos; o
+ *   separador k[i-1] é sempre uma cópia do menor elemento do filho i
+ * - Nós ocupam cerca de BPTREE_NODE_BYTES; a capacidade de cada nó sai do
+ *   tamanho do elemento (mínimo BPTREE_MIN_FANOUT)
+ * - Dentro do nó a busca é binária sobre o array contíguo
+ *
+ * Mesma semântica da AVL: elementos iguais são permitidos (o novo entra
+ * depois dos já existentes), search/remove atuam sobre o primeiro igual.
+ *
+ * Complexidade GARANTIDA:
+ * - Insert / Search / Remove: O(log n) comparações, O(log_B n) nós
+ * - Min/Max: O(log_B n)
+ * - Range search: O(log_B n + k)
+ * - Construção a partir de array ordenado: O(n)
+ *
+ * Referências:
+ * - Bayer, R. & McCreight, E. (1972). "Organization and Maintenance of
+ *   Large Ordered Indexes". Acta Informatica 1(3)
+ * - Comer, D. (1979). "The Ubiquitous B-Tree". ACM Computing Surveys 11(2)
+ * - Cormen et al. (2009), Chapter 18
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef BPLUS_TREE_H
+#define BPLUS_TREE_H
+
+#include "common.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Medido com gcc -O2 em x86-64, 2M chaves int aleatórias: nós de 256 e 512
+ * bytes buscam ~30% mais devagar que 1 KB; de 1 KB a 4 KB o tempo fica
+ * estável (2-3 níveis) e a inserção passa a pagar o memmove dentro da folha.
+ * Contra a AVL: inserção ~4.5x e busca ~3x mais rápidas.
+ */
+
+/** Tamanho alvo de cada nó em bytes (inclui cabeçalho e posição de folga) */
+#define BPTREE_NODE_BYTES 1024
+
+/** Capacidade mínima de elementos/separadores por nó */
+#define BPTREE_MIN_FANOUT 4
+
+typedef struct BPlusTree BPlusTree;
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+/**
+ * @brief Cria árvore B+ vazia
+ */
+BPlusTree* bptree_create(size_t element_size, CompareFn compare, DestroyFn destroy);
+
+/**
+ * @brief Cria árvore B+ com nós obtidos de um alocador customizado
+ *
+ * allocator NULL = malloc/free. bptree_clone() herda o mesmo alocador.
+ */
+BPlusTree* bptree_create_with_allocator(size_t element_size, CompareFn compare,
+                                        DestroyFn destroy, const DSAllocator *allocator);
+
+/**
+ * @brief Constrói a árvore a partir de um array ordenado (bulk loading)
+ *
+ * Preenche as folhas da esquerda para a direita e monta os níveis internos
+ * por cima, sem divisões: os nós saem cheios (exceto a distribuição do
+ * resto entre os últimos), o que também os deixa contíguos por nível.
+ *
+ * @param array Elementos em ordem não-decrescente de compare (copiados)
+ * @return BPlusTree* Árvore criada, ou NULL (argumento inválido, array fora
+ *         de ordem ou sem memória)
+ *
+ * Complexidade: O(n)
+ */
+BPlusTree* bptree_from_sorted_array(size_t element_size, const void *array, size_t size,
+                                    CompareFn compare, DestroyFn destroy);
+
+void bptree_destroy(BPlusTree *tree);
+
+// ============================================================================
+// OPERAÇÕES
+// ============================================================================
+
+/**
+ * @brief Insere elemento (cópia)
+ *
+ * Desce até a folha e divide os nós cheios no caminho de volta.
+ *
+ * Complexidade: O(log n)
+ */
+DataStructureError bptree_insert(BPlusTree *tree, const void *data);
+
+/**
+ * @brief Busca o primeiro elemento igual a data
+ *
+ * Complexidade: O(log n)
+ */
+DataStructureError bptree_search(const BPlusTree *tree, const void *data, void *output);
+bool bptree_contains(const BPlusTree *tree, const void *data);
+
+/**
+ * @brief Remove o primeiro elemento igual a data
+ *
+ * Folhas e nós internos abaixo da ocupação mínima (metade) pegam um
+ * elemento emprestado de um irmão ou são fundidos com ele.
+ *
+ * Complexidade: O(log n)
+ */
+DataStructureError bptree_remove(BPlusTree *tree, const void *data);
+
+/**
+ * @brief Retorna min/max
+ */
+DataStructureError bptree_min(const BPlusTree *tree, void *output);
+DataStructureError bptree_max(const BPlusTree *tree, void *output);
+
+/**
+ * @brief Range search: elementos em [min, max], em ordem
+ *
+ * @param results Recebe um array alocado com malloc (liberar com free), ou
+ *        NULL se nenhum elemento estiver no intervalo
+ *
+ * Complexidade: O(log n + k), seguindo a lista de folhas
+ */
+DataStructureError bptree_range_search(const BPlusTree *tree, const void *min,
+                                       const void *max, void **results, size_t *count);
+
+// Travessia (em ordem, pela lista de folhas)
+typedef void (*BPTreeTraversalFn)(void *data, void *user_data);
+void bptree_inorder(const BPlusTree *tree, BPTreeTraversalFn callback, void *user_data);
+
+// Propriedades
+bool bptree_is_empty(const BPlusTree *tree);
+size_t bptree_size(const BPlusTree *tree);
+
+/**
+ * @brief Altura (-1 vazia, 0 quando a raiz é folha)
+ */
+int bptree_height(const BPlusTree *tree);
+
+/**
+ * @brief Número máximo de elementos por folha
+ */
+size_t bptree_leaf_capacity(const BPlusTree *tree);
+
+/**
+ * @brief Bytes ocupados: cabeçalho e todos os nós, contados pela capacidade
+ *        (folhas com leaf_bytes, internos com inner_bytes)
+ *
+ * Complexidade: O(n / B) (percorre os nós)
+ */
+size_t bptree_memory_usage(const BPlusTree *tree);
+
+/**
+ * @brief Verifica se a árvore B+ é válida
+ *
+ * Verifica:
+ * 1. Elementos ordenados dentro e entre folhas (pela lista encadeada)
+ * 2. Separadores iguais ao menor elemento do filho correspondente
+ * 3. Ocupação mínima dos nós (exceto raiz) e folhas todas na mesma altura
+ * 4. Contagem de elementos igual a size
+ */
+bool bptree_is_valid(const BPlusTree *tree);
+
+void bptree_clear(BPlusTree *tree);
+BPlusTree* bptree_clone(const BPlusTree *tree, CopyFn copy_fn);
+void bptree_print(const BPlusTree *tree, PrintFn print);
+
+#endif // BPLUS_TREE_H
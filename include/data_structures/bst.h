@@ -66,6 +66,21 @@ typedef struct BSTNode BSTNode;
  */
 BST* bst_create(size_t element_size, CompareFn compare, DestroyFn destroy);
 
+/**
+ * @brief Cria uma BST cujos nós são obtidos de um alocador customizado
+ *
+ * @param element_size Tamanho de cada elemento em bytes
+ * @param compare Função de comparação (OBRIGATÓRIA para BST)
+ * @param destroy Função de destruição (NULL se não necessário)
+ * @param allocator Alocador de nós e do cabeçalho (NULL = malloc/free);
+ *                  bst_clone() herda o mesmo alocador
+ * @return BST* Ponteiro para a BST criada, ou NULL em caso de erro
+ *
+ * Complexidade: O(1)
+ */
+BST* bst_create_with_allocator(size_t element_size, CompareFn compare,
+                               DestroyFn destroy, const DSAllocator *allocator);
+
 /**
  * @brief Destrói a BST e libera memória
  *
@@ -322,7 +337,11 @@ typedef void (*BSTTraversalFn)(void *data, void *user_data);
  *
  * Para BST: visita elementos em ordem crescente
  *
- * Complexidade: O(n)
+ * As três travessias em profundidade são iterativas e seguem os ponteiros
+ * de pai, sem recursão: uma BST degenerada (inserções ordenadas) não
+ * estoura a pilha de chamadas.
+ *
+ * Complexidade: O(n) tempo, O(1) espaço
  */
 void bst_inorder(const BST *bst, BSTTraversalFn callback, void *user_data);
 
@@ -359,6 +378,75 @@ void bst_postorder(const BST *bst, BSTTraversalFn callback, void *user_data);
  */
 void bst_levelorder(const BST *bst, BSTTraversalFn callback, void *user_data);
 
+/**
+ * @brief Ordens de travessia do iterador
+ */
+typedef enum {
+    BST_INORDER,
+    BST_PREORDER,
+    BST_POSTORDER
+} BSTOrder;
+
+/** Entradas da pilha do cursor (potência de 2) */
+#define BST_ITER_STACK 64
+
+/**
+ * @brief Cursor de travessia (alocado pelo chamador)
+ *
+ * Os nós pendentes ficam em uma pilha circular de BST_ITER_STACK
+ * entradas dentro do cursor, sem malloc. Em uma árvore mais funda que isso
+ * as entradas mais antigas são descartadas e recuperadas pelos ponteiros de
+ * pai quando a pilha esvazia: memória fixa para qualquer altura, e subidas
+ * pela árvore só quando a pilha não basta.
+ *
+ * O cursor pode ser pausado e retomado para consumir a árvore em
+ * streaming. Campos são de uso interno; a BST não deve ser modificada
+ * enquanto o cursor estiver ativo.
+ */
+typedef struct {
+    const BSTNode *stack[BST_ITER_STACK];  /**< Pendentes (uso interno) */
+    size_t top;                            /**< Topo da pilha circular (uso interno) */
+    size_t count;                          /**< Entradas válidas (uso interno) */
+    bool truncated;                        /**< Houve descarte (uso interno) */
+    const BSTNode *last;                   /**< Último nó devolvido (uso interno) */
+    BSTOrder order;                        /**< Ordem da travessia */
+} BSTIter;
+
+/**
+ * @brief Posiciona o cursor no primeiro nó da ordem pedida
+ *
+ * Exemplo:
+ * @code
+ * BSTIter it;
+ * void *data;
+ * bst_iter_begin(bst, BST_INORDER, &it);
+ * while (bst_iter_next(&it, &data)) { ... }
+ * @endcode
+ *
+ * Complexidade: O(h)
+ */
+void bst_iter_begin(const BST *bst, BSTOrder order, BSTIter *it);
+
+/**
+ * @brief Cursor em ordem a partir do primeiro elemento >= key
+ *
+ * Para varreduras de intervalo sem coletar os elementos em um array:
+ * avance enquanto o elemento for <= o limite superior.
+ *
+ * Complexidade: O(h)
+ */
+void bst_iter_seek(const BST *bst, const void *key, BSTIter *it);
+
+/**
+ * @brief Devolve o próximo elemento e avança
+ *
+ * @param data Saída: dados do nó (pode ser NULL)
+ * @return false quando a travessia terminou
+ *
+ * Complexidade: O(1) amortizado, O(h) no pior caso
+ */
+bool bst_iter_next(BSTIter *it, void **data);
+
 // ============================================================================
 // CONSULTAS E PROPRIEDADES
 // ============================================================================
@@ -383,6 +471,17 @@ bool bst_is_empty(const BST *bst);
  */
 size_t bst_size(const BST *bst);
 
+/**
+ * @brief Retorna os bytes ocupados (cabeçalho, nós e dados)
+ *
+ * @param bst Ponteiro para a BST
+ * @return size_t Bytes alocados; cada nó custa sizeof(BSTNode) mais uma
+ *         alocação separada de element_size
+ *
+ * Complexidade: O(1)
+ */
+size_t bst_memory_usage(const BST *bst);
+
 /**
  * @brief Retorna a altura da BST
  *
@@ -16,6 +16,8 @@
 
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
 
 /**
  * @brief Tipo de função para comparação entre elementos
@@ -81,6 +83,32 @@ typedef enum {
     DS_ERROR_INVALID_PARAM    /**< Parâmetro inválido */
 } DataStructureError;
 
+// ============================================================================
+// MODO COMPACTO
+// ============================================================================
+
+/**
+ * @brief Índice interno dos containers (posições em arrays, contagens de subárvore)
+ *
+ * Com -DDS_COMPACT_INDEX (opção ENABLE_COMPACT_INDEX do CMake) é um
+ * uint32_t: os arrays de pais e tamanhos do union_find, os de posições e
+ * handles da indexed_priority_queue e o contador de subárvore da AVL
+ * ocupam metade, e os containers não aceitam mais de DS_INDEX_MAX
+ * elementos (a criação ou a inserção falha). Sem a flag é size_t.
+ *
+ * A API pública continua em size_t nos dois modos; só a representação
+ * interna muda. Ponteiros entre nós (listas, árvores, tries) não são
+ * afetados: trocá-los por índices exigiria alocar os nós num pool.
+ * Use *_memory_usage() para medir o efeito.
+ */
+#ifdef DS_COMPACT_INDEX
+typedef uint32_t ds_index_t;
+#define DS_INDEX_MAX ((size_t)UINT32_MAX)
+#else
+typedef size_t ds_index_t;
+#define DS_INDEX_MAX SIZE_MAX
+#endif
+
 /**
  * @brief Estrutura para armazenar dados genéricos com metadados
  */
@@ -91,6 +119,88 @@ typedef struct {
     DestroyFn destroy;      /**< Função de destruição customizada (opcional) */
 } GenericContainer;
 
+// ============================================================================
+// ALOCADOR PLUGÁVEL
+// ============================================================================
+
+/**
+ * @brief Função de alocação de um alocador customizado
+ *
+ * @param ctx Contexto do alocador (DSAllocator::ctx)
+ * @param size Número de bytes
+ * @return void* Bloco alinhado a max_align_t, ou NULL
+ */
+typedef void* (*DSAllocFn)(void *ctx, size_t size);
+
+/**
+ * @brief Função de realocação de um alocador customizado
+ *
+ * @param ctx Contexto do alocador
+ * @param ptr Bloco atual (nunca NULL)
+ * @param old_size Tamanho atual do bloco
+ * @param new_size Novo tamanho
+ * @return void* Bloco com o conteúdo preservado, ou NULL (ptr segue válido)
+ */
+typedef void* (*DSReallocFn)(void *ctx, void *ptr, size_t old_size, size_t new_size);
+
+/**
+ * @brief Função de liberação de um alocador customizado
+ *
+ * @param ctx Contexto do alocador
+ * @param ptr Bloco retornado por DSAllocFn (nunca NULL)
+ * @param size Tamanho pedido na alocação (útil para pools por tamanho)
+ */
+typedef void (*DSFreeFn)(void *ctx, void *ptr, size_t size);
+
+/**
+ * @brief Alocador usado pelos containers baseados em nós
+ *
+ * Containers criados com *_create_with_allocator() fazem todas as
+ * alocações internas (cabeçalho, nós e buffers) através deste alocador,
+ * o que permite usar arenas, pools por thread, jemalloc ou memória em
+ * huge pages sem alterar a biblioteca. Buffers devolvidos ao usuário
+ * (ex: *_to_array) continuam vindo de malloc e são liberados com free().
+ *
+ * Se realloc for NULL, ds_realloc() usa alloc + memcpy + free.
+ * Se free for NULL os blocos nunca são devolvidos individualmente:
+ * a memória é recuperada em bloco pelo dono do alocador (ex: arena).
+ */
+typedef struct {
+    DSAllocFn alloc;       /**< Obrigatória */
+    DSReallocFn realloc;   /**< Opcional */
+    DSFreeFn free;         /**< Opcional (NULL = liberação em bloco) */
+    void *ctx;             /**< Estado do alocador */
+} DSAllocator;
+
+/**
+ * @brief Alocador padrão (malloc/free da libc)
+ */
+const DSAllocator* ds_default_allocator(void);
+
+/**
+ * @brief Aloca via alocador (NULL usa o alocador padrão)
+ */
+void* ds_alloc(const DSAllocator *allocator, size_t size);
+
+/**
+ * @brief Aloca e zera via alocador (NULL usa o alocador padrão)
+ *
+ * Com o alocador padrão usa calloc, que evita zerar blocos grandes à mão.
+ */
+void* ds_calloc(const DSAllocator *allocator, size_t count, size_t size);
+
+/**
+ * @brief Realoca via alocador (NULL usa o alocador padrão)
+ *
+ * ptr NULL equivale a ds_alloc(). Em falha retorna NULL e ptr segue válido.
+ */
+void* ds_realloc(const DSAllocator *allocator, void *ptr, size_t old_size, size_t new_size);
+
+/**
+ * @brief Libera via alocador (NULL usa o alocador padrão; ptr NULL é ignorado)
+ */
+void ds_free(const DSAllocator *allocator, void *ptr, size_t size);
+
 // ============================================================================
 // FUNÇÕES AUXILIARES PARA TIPOS COMUNS
 // ============================================================================
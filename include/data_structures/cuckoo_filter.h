@@ -0,0 +1,129 @@
+/**
+ * @file cuckoo_filter.h
+ * @brief Cuckoo filter: filtro de pertinência com remoção
+ *
+ * Guarda só uma impressão digital (fingerprint) de 16 bits de cada chave
+ * em uma tabela cuckoo de buckets com 4 posições. Cada fingerprint tem dois
+ * buckets candidatos, i1 = h(x) e i2 = i1 XOR h(fp), e o outro bucket pode
+ * ser obtido de qualquer um deles só com o fingerprint — por isso
+ * fingerprints podem ser realocados sem conhecer a chave original (partial-
+ * key cuckoo hashing).
+ *
+ * Diferente do filtro de Bloom, aceita remoção. Cada bucket é uma palavra
+ * de 64 bits e a busca compara as 4 posições de uma vez (SWAR), então uma
+ * consulta lê no máximo dois buckets.
+ *
+ * - Falsos positivos: ~2·4/2^16 ≈ 0.012% (sem falsos negativos)
+ * - Ocupação: até ~95% das posições antes de cuckoo_filter_add falhar
+ * - Memória: ~2 bytes por posição (~2.1 bytes por chave a 95%)
+ *
+ * Remover uma chave nunca adicionada pode apagar o fingerprint de outra
+ * chave (falso negativo); só remova chaves sabidamente inseridas. Inserir a
+ * mesma chave duas vezes guarda duas cópias (até 8, as posições dos seus
+ * dois buckets), que precisam de duas remoções.
+ *
+ * Referências:
+ * - Fan, B., Andersen, D. G., Kaminsky, M. & Mitzenmacher, M. (2014).
+ *   "Cuckoo Filter: Practically Better Than Bloom". CoNEXT '14
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef CUCKOO_FILTER_H
+#define CUCKOO_FILTER_H
+
+#include "common.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Posições (fingerprints) por bucket */
+#define CUCKOO_BUCKET_SLOTS 4
+
+/** Realocações tentadas por inserção antes de declarar o filtro cheio */
+#define CUCKOO_MAX_KICKS 500
+
+typedef struct CuckooFilter CuckooFilter;
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+/**
+ * @brief Cria um filtro para até capacity chaves
+ *
+ * O número de buckets é a potência de 2 que comporta capacity chaves a 95%
+ * de ocupação.
+ *
+ * @param capacity Número previsto de chaves (> 0)
+ * @param hash_fn Função hash das chaves
+ * @return CuckooFilter* Filtro criado ou NULL
+ */
+CuckooFilter* cuckoo_filter_create(size_t capacity, HashFn hash_fn);
+
+/**
+ * @brief Cria um filtro com alocador customizado (NULL = libc)
+ */
+CuckooFilter* cuckoo_filter_create_with_allocator(size_t capacity, HashFn hash_fn,
+                                                  const DSAllocator *allocator);
+
+void cuckoo_filter_destroy(CuckooFilter *filter);
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+/**
+ * @brief Adiciona uma chave
+ *
+ * Quando CUCKOO_MAX_KICKS realocações não bastam, o último fingerprint
+ * deslocado fica guardado à parte: a inserção ainda tem sucesso (nada se
+ * perde), mas as seguintes retornam DS_ERROR_FULL até que uma remoção
+ * libere espaço.
+ *
+ * @return DS_SUCCESS, DS_ERROR_FULL ou DS_ERROR_NULL_POINTER
+ */
+DataStructureError cuckoo_filter_add(CuckooFilter *filter, const void *key);
+
+/**
+ * @brief Testa se a chave pode estar no conjunto
+ *
+ * Complexidade: O(1), dois buckets
+ */
+bool cuckoo_filter_contains(const CuckooFilter *filter, const void *key);
+
+/**
+ * @brief Remove uma ocorrência da chave
+ *
+ * @return DS_SUCCESS, DS_ERROR_NOT_FOUND ou DS_ERROR_NULL_POINTER
+ */
+DataStructureError cuckoo_filter_remove(CuckooFilter *filter, const void *key);
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+/**
+ * @brief Número de fingerprints armazenados
+ */
+size_t cuckoo_filter_size(const CuckooFilter *filter);
+
+/**
+ * @brief Total de posições (buckets * CUCKOO_BUCKET_SLOTS)
+ */
+size_t cuckoo_filter_capacity(const CuckooFilter *filter);
+
+double cuckoo_filter_load_factor(const CuckooFilter *filter);
+size_t cuckoo_filter_size_bytes(const CuckooFilter *filter);
+
+/**
+ * @brief Bytes alocados ao todo (cabeçalho e buckets)
+ */
+size_t cuckoo_filter_memory_usage(const CuckooFilter *filter);
+
+/**
+ * @brief Remove todas as chaves
+ */
+void cuckoo_filter_clear(CuckooFilter *filter);
+
+#endif // CUCKOO_FILTER_H
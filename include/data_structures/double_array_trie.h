@@ -0,0 +1,153 @@
+/**
+ * @file double_array_trie.h
+ * @brief Trie estática em double array (base/check) para dicionários somente leitura
+ *
+ * Construída uma vez a partir de uma lista ordenada (ou de um Trie), a trie
+ * vive em um único array contíguo de células {base, check}, sem ponteiros:
+ * a transição do estado s pelo byte c vai para t = base[s] + c e só existe
+ * se check[t] == s. Cada passo da busca lê uma célula de 8 bytes.
+ *
+ * - O fim de uma chave é a transição pelo código 0 (o '\0' da string);
+ *   a base dessa célula terminal guarda o índice da chave na lista ordenada
+ * - Sem ponteiros, o array é gravado e mapeado como está: vários processos
+ *   podem compartilhar o mesmo dicionário via datrie_mmap_open sem
+ *   reconstruí-lo (as páginas físicas são as do cache de arquivos)
+ * - Chaves são strings C arbitrárias (qualquer byte exceto '\0')
+ *
+ * Complexidade (m = tamanho da string):
+ * - Search / Lookup / Starts with: O(m), um acesso ao array por byte
+ * - Autocomplete: O(m + 256 * nós da subárvore)
+ * - Construção: O(total de bytes * probes para achar cada base)
+ *
+ * Referências:
+ * - Aoe, J. (1989). "An Efficient Digital Search Algorithm by Using a
+ *   Double-Array Structure". IEEE Trans. Software Engineering 15(9)
+ * - Yata, S. et al. (2007). "A Compact Static Double-Array Keeping
+ *   Character Codes". Information Processing & Management 43(1)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef DOUBLE_ARRAY_TRIE_H
+#define DOUBLE_ARRAY_TRIE_H
+
+#include "common.h"
+#include "trie.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct DoubleArrayTrie DoubleArrayTrie;
+
+// ============================================================================
+// CONSTRUÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+/**
+ * @brief Constrói a trie a partir de strings em ordem estritamente crescente (strcmp)
+ *
+ * As strings são só lidas; o resultado não guarda referências a elas.
+ *
+ * @return DoubleArrayTrie* Trie criada, ou NULL (argumento NULL, lista fora
+ *         de ordem ou com repetições, array acima de INT32_MAX células ou sem
+ *         memória)
+ */
+DoubleArrayTrie* datrie_from_sorted_array(const char *const *strings, size_t count);
+
+/**
+ * @brief Constrói a trie com as strings de um Trie (via trie_to_array)
+ */
+DoubleArrayTrie* datrie_from_trie(const Trie *trie);
+
+/**
+ * @brief Libera a trie (e desfaz o mapeamento, se aberta por datrie_mmap_open)
+ */
+void datrie_destroy(DoubleArrayTrie *trie);
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+/**
+ * @brief Busca uma string
+ *
+ * Complexidade: O(m)
+ */
+bool datrie_search(const DoubleArrayTrie *trie, const char *str);
+
+/**
+ * @brief Busca uma string e devolve sua posição na lista de construção
+ *
+ * @param index Recebe o índice (0-based) da string na ordem de strcmp
+ * @return true se a string existir
+ *
+ * Complexidade: O(m)
+ */
+bool datrie_lookup(const DoubleArrayTrie *trie, const char *str, size_t *index);
+
+/**
+ * @brief Verifica se existe alguma string com o prefixo dado
+ *
+ * Complexidade: O(m) onde m = |prefix|
+ */
+bool datrie_starts_with(const DoubleArrayTrie *trie, const char *prefix);
+
+/**
+ * @brief Todas as strings com o prefixo dado, em ordem (autocomplete)
+ *
+ * @param results Array de strings alocado com malloc (cada string e o
+ *        array são liberados com free); NULL se não houver resultados
+ */
+DataStructureError datrie_autocomplete(const DoubleArrayTrie *trie, const char *prefix,
+                                       char ***results, size_t *count);
+
+size_t datrie_size(const DoubleArrayTrie *trie);
+
+/**
+ * @brief Bytes do array de células (o mesmo que o corpo do arquivo serializado)
+ */
+size_t datrie_memory_usage(const DoubleArrayTrie *trie);
+
+// ============================================================================
+// SERIALIZAÇÃO
+// ============================================================================
+
+/*
+ * Formato binário (versão 1): cabeçalho de 40 bytes com magic "DATRIE01",
+ * versão, marca de ordem de bytes e as contagens de chaves, de células e o
+ * tamanho da maior chave, seguido das células {int32 base, int32 check}
+ * exatamente como em memória. Arquivos de outra ordem de bytes são
+ * recusados em vez de convertidos.
+ */
+
+/**
+ * @brief Grava a trie em path
+ * @return false em argumentos NULL ou erro de escrita (o arquivo é removido)
+ */
+bool datrie_save(const DoubleArrayTrie *trie, const char *path);
+
+/**
+ * @brief Abre um arquivo gravado por datrie_save sem copiar as células
+ *
+ * Em sistemas POSIX o arquivo é mapeado com mmap (somente leitura); nos
+ * demais, é lido para a memória. Só o cabeçalho e a raiz são validados,
+ * mas toda transição é conferida contra o tamanho do array.
+ *
+ * @return Trie (liberar com datrie_destroy) ou NULL (arquivo inválido,
+ *         incompatível ou erro de E/S)
+ *
+ * Complexidade: O(1) com mmap
+ */
+DoubleArrayTrie* datrie_mmap_open(const char *path);
+
+/**
+ * @brief Usa um arquivo serializado que já está em memória, sem cópia
+ *
+ * buffer deve estar alinhado a 8 bytes e continuar válido enquanto a trie
+ * existir.
+ *
+ * @return Trie ou NULL (cabeçalho inválido ou tamanho incompatível)
+ */
+DoubleArrayTrie* datrie_from_buffer(const void *buffer, size_t size);
+
+#endif // DOUBLE_ARRAY_TRIE_H
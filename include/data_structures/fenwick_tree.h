@@ -0,0 +1,114 @@
+/**
+ * @file fenwick_tree.h
+ * @brief Fenwick tree (Binary Indexed Tree) para somas de prefixo
+ *
+ * Mantém um vetor de n inteiros de 64 bits com atualização pontual e soma
+ * de prefixo em O(log n), em um único array de n + 1 posições: a posição i
+ * (base 1) guarda a soma dos (i & -i) elementos que terminam em i.
+ *
+ * Uso típico: contadores acumulados (histogramas, roll-ups de métricas por
+ * intervalo de tempo) onde uma varredura linear ou bst_range_count seria
+ * O(n) por consulta.
+ *
+ * Complexidade:
+ * - Criação a partir de um array: O(n)
+ * - Add / Prefix sum / Range sum / Get / Set: O(log n)
+ * - Lower bound (valores não negativos): O(log n)
+ * - Espaço: (n + 1) * 8 bytes
+ *
+ * Somas são aritmética inteira de 64 bits; estouro é responsabilidade de
+ * quem chama.
+ *
+ * Referências:
+ * - Fenwick, P. M. (1994). "A New Data Structure for Cumulative Frequency
+ *   Tables". Software: Practice and Experience 24(3): 327–336
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef FENWICK_TREE_H
+#define FENWICK_TREE_H
+
+#include "common.h"
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct FenwickTree FenwickTree;
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+/**
+ * @brief Cria uma Fenwick tree com n elementos
+ *
+ * @param values n valores iniciais, ou NULL para começar com zeros
+ * @param n Número de elementos (> 0)
+ * @return FenwickTree* Árvore criada ou NULL
+ *
+ * Complexidade: O(n)
+ */
+FenwickTree* fenwick_create(const int64_t *values, size_t n);
+
+/**
+ * @brief Cria uma Fenwick tree com alocador customizado (NULL = libc)
+ */
+FenwickTree* fenwick_create_with_allocator(const int64_t *values, size_t n,
+                                           const DSAllocator *allocator);
+
+void fenwick_destroy(FenwickTree *tree);
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+/**
+ * @brief Soma delta ao elemento index
+ *
+ * @return DS_SUCCESS, DS_ERROR_NULL_POINTER ou DS_ERROR_INVALID_INDEX
+ */
+DataStructureError fenwick_add(FenwickTree *tree, size_t index, int64_t delta);
+
+/**
+ * @brief Substitui o elemento index por value
+ *
+ * @return DS_SUCCESS, DS_ERROR_NULL_POINTER ou DS_ERROR_INVALID_INDEX
+ */
+DataStructureError fenwick_set(FenwickTree *tree, size_t index, int64_t value);
+
+/**
+ * @brief Valor atual do elemento index (0 se índice inválido)
+ */
+int64_t fenwick_get(const FenwickTree *tree, size_t index);
+
+/**
+ * @brief Soma dos count primeiros elementos, [0, count)
+ *
+ * count maior que o tamanho é limitado a n.
+ */
+int64_t fenwick_prefix_sum(const FenwickTree *tree, size_t count);
+
+/**
+ * @brief Soma dos elementos em [lo, hi) (0 se lo >= hi)
+ */
+int64_t fenwick_range_sum(const FenwickTree *tree, size_t lo, size_t hi);
+
+/**
+ * @brief Menor índice i com prefix_sum(i + 1) >= target
+ *
+ * Exige elementos não negativos (somas de prefixo monótonas). Serve para
+ * amostragem por peso e para achar o k-ésimo item de um histograma.
+ *
+ * @return Índice em [0, n), ou n se a soma total é menor que target
+ */
+size_t fenwick_lower_bound(const FenwickTree *tree, int64_t target);
+
+size_t fenwick_size(const FenwickTree *tree);
+
+/**
+ * @brief Bytes ocupados (cabeçalho e n + 1 contadores de 64 bits)
+ */
+size_t fenwick_memory_usage(const FenwickTree *tree);
+
+#endif // FENWICK_TREE_H
@@ -8,6 +8,8 @@
  * Representações:
  * - Adjacency List: melhor para grafos esparsos (|E| << |V|²)
  * - Adjacency Matrix: melhor para grafos densos (|E| ≈ |V|²)
+ * - Adjacency Bitset: grafos densos não-ponderados, 1 bit por par (64x
+ *   menos memória que a matriz de doubles)
  *
  * Complexidade (Adjacency List):
  * - Add vertex: O(1)
@@ -25,6 +27,11 @@
  * - Check edge: O(1)
  * - Get neighbors: O(|V|)
  *
+ * Complexidade (Adjacency Bitset):
+ * - Add edge / Remove edge / Check edge: O(1)
+ * - Out degree: O(|V|/64) com popcount
+ * - Get neighbors: O(|V|/64 + grau), palavras vazias são puladas inteiras
+ *
  * Referências Acadêmicas:
  * - Cormen, T. H., et al. (2009). "Introduction to Algorithms" (3rd ed.),
  *   Chapter 22 - Elementary Graph Algorithms
@@ -41,12 +48,14 @@
 #include "common.h"
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 // ============================================================================
 // ESTRUTURAS OPACAS
 // ============================================================================
 
 typedef struct Graph Graph;
+typedef struct CSRGraph CSRGraph;
 typedef size_t Vertex;  /**< Identificador de vértice (índice) */
 
 /**
@@ -62,7 +71,8 @@ typedef enum {
  */
 typedef enum {
     GRAPH_ADJACENCY_LIST,    /**< Lista de adjacências (esparso) */
-    GRAPH_ADJACENCY_MATRIX   /**< Matriz de adjacências (denso) */
+    GRAPH_ADJACENCY_MATRIX,  /**< Matriz de adjacências (denso) */
+    GRAPH_ADJACENCY_BITSET   /**< Matriz de bits (denso, só não-ponderado) */
 } GraphRepresentation;
 
 /**
@@ -84,14 +94,28 @@ typedef struct {
  * @param num_vertices Número inicial de vértices
  * @param type Tipo (direcionado ou não)
  * @param representation Representação (lista ou matriz)
- * @param weighted Se true, arestas têm pesos
+ * @param weighted Se true, arestas têm pesos (NULL com GRAPH_ADJACENCY_BITSET)
  * @return Graph* Grafo criado
  *
- * Complexidade: O(V) para lista, O(V²) para matriz
+ * Complexidade: O(V) para lista, O(V²) para matriz, O(V²/64) para bitset
  */
 Graph* graph_create(size_t num_vertices, GraphType type,
                     GraphRepresentation representation, bool weighted);
 
+/**
+ * @brief Cria um grafo cujas estruturas internas vêm de um alocador customizado
+ *
+ * @param allocator Alocador do cabeçalho, dos nós de adjacência e da matriz
+ *                  (NULL = libc); graph_clone() e graph_transpose() o herdam.
+ *                  Snapshots CSR e arrays retornados ao usuário usam malloc.
+ * @return Graph* Grafo criado
+ *
+ * Complexidade: O(V) para lista, O(V²) para matriz
+ */
+Graph* graph_create_with_allocator(size_t num_vertices, GraphType type,
+                                   GraphRepresentation representation, bool weighted,
+                                   const DSAllocator *allocator);
+
 /**
  * @brief Destrói o grafo
  */
@@ -156,6 +180,17 @@ double graph_edge_weight(const Graph *graph, Vertex src, Vertex dest);
  */
 size_t graph_num_edges(const Graph *graph);
 
+/**
+ * @brief Bytes alocados pela representação
+ *
+ * Lista: um ponteiro por vértice e um nó de 24 bytes por arco (duas por
+ * aresta não direcionada). Matriz: capacity^2 doubles. Bitset:
+ * capacity^2 bits. Comparar com graph_csr_memory_usage ajuda a escolher.
+ *
+ * Complexidade: O(V + E) na lista, O(1) nas demais
+ */
+size_t graph_memory_usage(const Graph *graph);
+
 // ============================================================================
 // GRAU DOS VÉRTICES
 // ============================================================================
@@ -201,6 +236,50 @@ DataStructureError graph_neighbors(const Graph *graph, Vertex v,
  */
 DataStructureError graph_edges(const Graph *graph, Edge **edges, size_t *count);
 
+/**
+ * @brief Cursor sobre os vizinhos de um vértice (alocado pelo chamador)
+ *
+ * Percorre diretamente a lista ou a linha da matriz interna, sem alocar.
+ * Campos são de uso interno; o grafo não deve ser modificado enquanto
+ * um iterador estiver ativo.
+ */
+typedef struct {
+    const Graph *graph;   /**< Grafo percorrido */
+    Vertex source;        /**< Vértice cujos vizinhos são percorridos */
+    const void *node;     /**< Próximo nó da lista (uso interno) */
+    size_t column;        /**< Próxima coluna da matriz (uso interno) */
+} GraphNeighborIter;
+
+/**
+ * @brief Posiciona o iterador no primeiro vizinho de v
+ *
+ * Exemplo:
+ * @code
+ * GraphNeighborIter it;
+ * Vertex w; double weight;
+ * graph_neighbor_iter_begin(g, v, &it);
+ * while (graph_neighbor_iter_next(&it, &w, &weight)) { ... }
+ * @endcode
+ *
+ * Em caso de erro o iterador fica vazio (next retorna false).
+ *
+ * Complexidade: O(1)
+ */
+DataStructureError graph_neighbor_iter_begin(const Graph *graph, Vertex v,
+                                             GraphNeighborIter *it);
+
+/**
+ * @brief Avança para o próximo vizinho
+ *
+ * @param it Iterador
+ * @param dest Saída: vizinho (pode ser NULL)
+ * @param weight Saída: peso da aresta (pode ser NULL)
+ * @return bool false quando não há mais vizinhos
+ *
+ * Complexidade: O(1) amortizado lista, O(V) total por linha na matriz
+ */
+bool graph_neighbor_iter_next(GraphNeighborIter *it, Vertex *dest, double *weight);
+
 // ============================================================================
 // TRAVESSIAS
 // ============================================================================
@@ -316,6 +395,8 @@ bool graph_is_bipartite(const Graph *graph);
  * @param size Tamanho do array
  * @return DataStructureError DS_ERROR_INVALID_PARAM se grafo tem ciclo
  *
+ * A DFS usa pilha explícita de iteradores (sem recursão).
+ *
  * Pseudocódigo: DFS modificado (Cormen et al., 2009, p. 613)
  * TOPOLOGICAL-SORT(G)
  *   call DFS(G) to compute finishing times v.f for each vertex v
@@ -338,6 +419,8 @@ size_t graph_num_connected_components(const Graph *graph);
 /**
  * @brief Retorna componentes fortemente conexos (algoritmo de Kosaraju)
  *
+ * As duas DFS usam pilha explícita de iteradores (sem recursão).
+ *
  * Referência: Cormen et al., 2009, p. 615
  * Complexidade: O(V + E)
  */
@@ -354,6 +437,17 @@ DataStructureError graph_strongly_connected_components(const Graph *graph,
  */
 double** graph_to_adjacency_matrix(const Graph *graph);
 
+/**
+ * @brief Linha de bits de v em um grafo GRAPH_ADJACENCY_BITSET
+ *
+ * O bit j % 64 da palavra j / 64 indica a aresta v -> j. A linha pertence ao
+ * grafo e é invalidada por graph_add_vertex().
+ *
+ * @param num_words Saída opcional com o número de palavras da linha
+ * @return Ponteiro para a linha ou NULL se a representação não for bitset
+ */
+const uint64_t* graph_adjacency_bits(const Graph *graph, Vertex v, size_t *num_words);
+
 /**
  * @brief Imprime o grafo
  */
@@ -374,4 +468,198 @@ Graph* graph_clone(const Graph *graph);
  */
 Graph* graph_transpose(const Graph *graph);
 
+// ============================================================================
+// SNAPSHOT IMUTÁVEL EM CSR (COMPRESSED SPARSE ROW)
+// ============================================================================
+
+/**
+ * @brief Congela o grafo em uma visão CSR imutável
+ *
+ * CSR armazena as adjacências em três arrays contíguos:
+ * - offsets[V+1]: arcos de u ocupam [offsets[u], offsets[u+1])
+ * - dest[A]: vértice destino de cada arco
+ * - weight[A]: peso de cada arco
+ *
+ * Grafos não-direcionados guardam os dois sentidos de cada aresta.
+ * A ordem dos vizinhos é a mesma de graph_neighbors(), logo travessias
+ * sobre o snapshot visitam os vértices na mesma ordem do grafo original.
+ * O snapshot não observa modificações posteriores do grafo.
+ *
+ * Referência: Saad, Y. (2003). "Iterative Methods for Sparse Linear
+ * Systems" (2nd ed.), Section 3.4 - Storage Schemes
+ *
+ * @param graph Grafo de origem
+ * @return CSRGraph* Snapshot (liberar com graph_csr_destroy) ou NULL
+ *
+ * Complexidade: O(V + E) lista, O(V²) matriz
+ */
+CSRGraph* graph_freeze(const Graph *graph);
+
+/**
+ * @brief Destrói o snapshot CSR
+ */
+void graph_csr_destroy(CSRGraph *csr);
+
+/**
+ * @brief Monta um snapshot CSR a partir de arrays já preenchidos
+ *
+ * O snapshot assume os três arrays (alocados com malloc) e os libera em
+ * graph_csr_destroy(); se a função falhar, continuam do chamador. Para
+ * grafos não-direcionados cada aresta deve aparecer nos dois sentidos
+ * (auto-laços uma vez), como em graph_freeze().
+ *
+ * @param num_edges Contagem devolvida por graph_csr_num_edges()
+ * @param offsets V+1 posições, offsets[0] = 0
+ * @param dest offsets[V] destinos
+ * @param weight offsets[V] pesos
+ * @return CSRGraph* Snapshot ou NULL (array NULL ou falha de alocação)
+ *
+ * Complexidade: O(1)
+ */
+CSRGraph* graph_csr_from_arrays(size_t num_vertices, size_t num_edges, GraphType type,
+                                size_t *offsets, Vertex *dest, double *weight);
+
+/**
+ * @brief Retorna o número de vértices do snapshot
+ */
+size_t graph_csr_num_vertices(const CSRGraph *csr);
+
+/**
+ * @brief Retorna o número de arestas (mesma contagem de graph_num_edges)
+ */
+size_t graph_csr_num_edges(const CSRGraph *csr);
+
+/**
+ * @brief Bytes de offsets, destinos e pesos (mais o cabeçalho, num CSR
+ *        lido ou mapeado de arquivo)
+ */
+size_t graph_csr_memory_usage(const CSRGraph *csr);
+
+/**
+ * @brief Retorna true se o snapshot veio de um grafo direcionado
+ */
+bool graph_csr_is_directed(const CSRGraph *csr);
+
+/**
+ * @brief Retorna o grau de saída de um vértice
+ *
+ * Complexidade: O(1)
+ */
+size_t graph_csr_out_degree(const CSRGraph *csr, Vertex v);
+
+/**
+ * @brief Acessa os vizinhos de um vértice sem alocar
+ *
+ * @param csr Snapshot CSR
+ * @param v Vértice
+ * @param dests Saída: ponteiro para os destinos (interno, não liberar)
+ * @param weights Saída: ponteiro para os pesos (pode ser NULL)
+ * @param count Saída: número de vizinhos
+ *
+ * Complexidade: O(1)
+ */
+DataStructureError graph_csr_neighbors(const CSRGraph *csr, Vertex v,
+                                       const Vertex **dests,
+                                       const double **weights, size_t *count);
+
+/**
+ * @brief BFS sobre o snapshot CSR (mesma semântica de graph_bfs)
+ *
+ * Complexidade: O(V + E)
+ */
+void graph_csr_bfs(const CSRGraph *csr, Vertex start, VertexVisitFn visit, void *user_data);
+
+/**
+ * @brief DFS sobre o snapshot CSR (mesma ordem de graph_dfs)
+ *
+ * Usa pilha explícita de cursores em vez de recursão.
+ *
+ * Complexidade: O(V + E)
+ */
+void graph_csr_dfs(const CSRGraph *csr, Vertex start, VertexVisitFn visit, void *user_data);
+
+/**
+ * @brief Ordenação topológica sobre o snapshot CSR (algoritmo de Kahn)
+ *
+ * Iterativa: fila de vértices com grau de entrada zero, sem recursão nem
+ * passada extra de detecção de ciclo. A ordem pode diferir da de
+ * graph_topological_sort (ambas válidas).
+ *
+ * @param order Saída: array com V vértices (liberar com free)
+ * @return DataStructureError DS_ERROR_INVALID_PARAM se não direcionado ou com ciclo
+ *
+ * Referência: Kahn, A. B. (1962). "Topological sorting of large networks". CACM 5(11)
+ * Complexidade: O(V + E)
+ */
+DataStructureError graph_csr_topological_sort(const CSRGraph *csr, Vertex **order, size_t *size);
+
+/**
+ * @brief Componentes fortemente conexos sobre o snapshot CSR (Tarjan)
+ *
+ * Uma única DFS com pilha de chamadas explícita (vértice + cursor de arco)
+ * e arrays alocados de uma vez: não estoura a pilha em grafos grandes e
+ * dispensa o transposto do Kosaraju. Componentes saem numerados em ordem
+ * topológica reversa do grafo condensado.
+ *
+ * @param components Saída: componente de cada vértice (liberar com free)
+ *
+ * Referência: Tarjan, R. E. (1972). "Depth-First Search and Linear Graph
+ * Algorithms". SIAM J. Comput. 1(2)
+ * Complexidade: O(V + E)
+ */
+DataStructureError graph_csr_strongly_connected_components(const CSRGraph *csr,
+                                                           size_t **components,
+                                                           size_t *num_components);
+
+// ============================================================================
+// SERIALIZAÇÃO CSR
+// ============================================================================
+
+/*
+ * Formato binário (versão 1): cabeçalho de 48 bytes com magic "GRAPHCSR",
+ * versão, marca de ordem de bytes, tipo do grafo, sizeof(size_t) e as
+ * contagens V, E e A (arcos), seguido de offsets[V+1], dest[A] e weight[A]
+ * exatamente como em memória. Arquivos de outra ordem de bytes ou largura
+ * de size_t são recusados em vez de convertidos.
+ */
+
+/**
+ * @brief Grava o snapshot CSR em path
+ * @return false em argumentos NULL ou erro de escrita (o arquivo é removido)
+ *
+ * Complexidade: O(V + A)
+ */
+bool graph_csr_save(const CSRGraph *csr, const char *path);
+
+/**
+ * @brief Congela o grafo e grava o snapshot (graph_freeze + graph_csr_save)
+ */
+bool graph_save(const Graph *graph, const char *path);
+
+/**
+ * @brief Abre um arquivo gravado por graph_csr_save sem copiar os arrays
+ *
+ * Em sistemas POSIX o arquivo é mapeado com mmap (somente leitura) e
+ * offsets/dest/weight apontam direto para o mapeamento: as páginas só são
+ * lidas quando acessadas. Nos demais, o arquivo é lido para a memória.
+ * Só o cabeçalho e as pontas de offsets são validados; o conteúdo dos
+ * arrays é confiado ao arquivo.
+ *
+ * @return Snapshot (liberar com graph_csr_destroy, que desfaz o mapeamento)
+ *         ou NULL (arquivo inválido, incompatível ou erro de E/S)
+ *
+ * Complexidade: O(1) com mmap
+ */
+CSRGraph* graph_mmap_open(const char *path);
+
+/**
+ * @brief Usa um arquivo CSR que já está em memória, sem cópia
+ *
+ * buffer deve estar alinhado a 8 bytes e continuar válido enquanto o
+ * snapshot existir.
+ *
+ * @return Snapshot ou NULL (cabeçalho inválido ou tamanho incompatível)
+ */
+CSRGraph* graph_csr_from_buffer(const void *buffer, size_t size);
+
 #endif // GRAPH_H
@@ -21,6 +21,16 @@
  * Estratégias de Colisão:
  * 1. Chaining (Separate Chaining): Usa listas encadeadas
  * 2. Open Addressing: Linear Probing, Quadratic Probing, Double Hashing
+ * 3. Flat (estilo Swiss Table): chaves e valores de tamanho fixo ficam
+ *    inline em um único array contíguo de slots; um array paralelo de
+ *    bytes de controle guarda 7 bits do hash (tag) ou EMPTY/DELETED.
+ *    A sondagem compara apenas bytes de controle e só toca o slot
+ *    quando a tag coincide: ~1 cache miss por busca para chaves pequenas.
+ *    Os bytes de controle são examinados em grupos de 16 com SSE2/NEON
+ *    (fallback escalar portável; -DHASH_FLAT_NO_SIMD força o escalar).
+ *    Capacidade potência de 2, rehash quando load > 0.875.
+ *    Referência: Kulukundis, M. (2017). "Designing a Fast, Efficient,
+ *    Cache-friendly Hash Table, Step by Step" (CppCon / Abseil)
  *
  * @author Algoritmos e Heurísticas
  * @date 2025
@@ -32,6 +42,7 @@
 #include "common.h"
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 // ============================================================================
 // ESTRUTURA DA HASH TABLE (OPACA)
@@ -49,7 +60,8 @@ typedef enum {
     HASH_CHAINING,           /**< Separate chaining com listas encadeadas */
     HASH_LINEAR_PROBING,     /**< Open addressing com linear probing */
     HASH_QUADRATIC_PROBING,  /**< Open addressing com quadratic probing */
-    HASH_DOUBLE_HASHING      /**< Open addressing com double hashing */
+    HASH_DOUBLE_HASHING,     /**< Open addressing com double hashing */
+    HASH_FLAT                /**< Open addressing com slots inline + bytes de controle */
 } CollisionStrategy;
 
 // ============================================================================
@@ -77,7 +89,8 @@ typedef enum {
  *                                   HASH_CHAINING, destroy_string, NULL);
  * @endcode
  *
- * Load Factor: rehash automático quando load > 0.75 (chaining) ou > 0.5 (open addressing)
+ * Load Factor: rehash automático quando load > 0.75 (chaining), > 0.5 (open addressing)
+ * ou > 0.875 (HASH_FLAT, contando slots DELETED)
  *
  * Complexidade: O(capacity)
  */
@@ -86,6 +99,28 @@ HashTable* hashtable_create(size_t key_size, size_t value_size, size_t initial_c
                             CollisionStrategy strategy,
                             DestroyFn destroy_key, DestroyFn destroy_value);
 
+/**
+ * @brief Cria uma tabela hash cujas alocações internas usam um alocador customizado
+ *
+ * @param allocator Alocador (NULL = malloc/free); os demais parâmetros são
+ *                  os de hashtable_create()
+ * @return HashTable* Ponteiro para a tabela criada, ou NULL em caso de erro
+ *
+ * Cabeçalho, arrays de buckets/entradas/slots, nós de chain e buffers de
+ * chave/valor passam pelo alocador. Com uma arena (arena.h) os nós de
+ * HASH_CHAINING ficam contíguos e são reaproveitados após remoções, e a
+ * tabela inteira pode ser descartada com ds_arena_reset(). Iteradores e
+ * arrays retornados por hashtable_keys/values continuam usando malloc.
+ *
+ * Complexidade: O(capacity)
+ */
+HashTable* hashtable_create_with_allocator(size_t key_size, size_t value_size,
+                                           size_t initial_capacity,
+                                           HashFn hash_fn, CompareFn compare_fn,
+                                           CollisionStrategy strategy,
+                                           DestroyFn destroy_key, DestroyFn destroy_value,
+                                           const DSAllocator *allocator);
+
 /**
  * @brief Destrói a tabela hash e libera memória
  *
@@ -197,6 +232,48 @@ DataStructureError hashtable_remove(HashTable *table, const void *key, void *old
  */
 bool hashtable_contains(const HashTable *table, const void *key);
 
+/**
+ * @brief Busca n chaves de uma vez, sobrepondo os cache misses
+ *
+ * @param table Ponteiro para a tabela
+ * @param keys n chaves contíguas (key_size bytes cada)
+ * @param n Número de chaves
+ * @param values Saída: n valores contíguos (NULL para só testar presença);
+ *               posições de chaves ausentes não são escritas
+ * @param found Saída: found[i] indica se keys[i] existe (pode ser NULL)
+ * @return DS_SUCCESS se todas existem, DS_ERROR_NOT_FOUND se alguma falta
+ *         ou DS_ERROR_NULL_POINTER
+ *
+ * Em grupos de 16 chaves: calcula todos os hashes, pré-carrega (prefetch)
+ * bucket, nó e chave de cada uma nível a nível e só então compara. Uma
+ * série de hashtable_get espera cada miss terminar antes de começar o
+ * próximo; aqui até 16 ficam em voo. Compensa quando a tabela não cabe
+ * no cache (probes de join, por exemplo).
+ *
+ * Complexidade: O(n) esperado
+ */
+DataStructureError hashtable_get_batch(const HashTable *table, const void *keys, size_t n,
+                                       void *values, bool *found);
+
+/**
+ * @brief Insere (ou atualiza) n pares de uma vez
+ *
+ * @param keys n chaves contíguas
+ * @param values n valores contíguos (value_size bytes cada)
+ * @return DS_SUCCESS ou o primeiro erro; os pares anteriores a ele ficam
+ *         inseridos
+ *
+ * Reserva antes capacidade para n chaves novas (um único rehash em vez de
+ * vários durante o lote) e então insere em grupos com o mesmo prefetch de
+ * hashtable_get_batch. Com rehash incremental ativo equivale a n chamadas
+ * de hashtable_put, para não trocar a migração gradual por um rehash
+ * bloqueante.
+ *
+ * Complexidade: O(n) esperado (+ O(capacity) se precisar crescer)
+ */
+DataStructureError hashtable_put_batch(HashTable *table, const void *keys, const void *values,
+                                       size_t n);
+
 // ============================================================================
 // CONSULTAS E UTILITÁRIOS
 // ============================================================================
@@ -246,6 +323,18 @@ size_t hashtable_capacity(const HashTable *table);
  */
 double hashtable_load_factor(const HashTable *table);
 
+/**
+ * @brief Bytes alocados pela tabela: cabeçalho, arrays e buffers de chave/valor
+ *
+ * Conta o que a tabela pede ao alocador (sem o overhead do malloc). Em
+ * open addressing inclui os buffers das lápides, que só são liberados no
+ * próximo rehash. Memória apontada pelas chaves/valores (ex: strings) não
+ * entra.
+ *
+ * Complexidade: O(1) (O(capacity) em open addressing)
+ */
+size_t hashtable_memory_usage(const HashTable *table);
+
 /**
  * @brief Remove todos os pares chave-valor
  *
@@ -338,6 +427,41 @@ void hashtable_iterator_destroy(HashTableIterator *iter);
  */
 DataStructureError hashtable_rehash(HashTable *table, size_t new_capacity);
 
+/**
+ * @brief Ativa o rehash incremental (só HASH_CHAINING)
+ *
+ * @param table Ponteiro para a tabela
+ * @param buckets_per_step Buckets não vazios migrados por put/remove
+ *        (0 = rehash de uma vez, o padrão)
+ * @return DataStructureError DS_ERROR_INVALID_PARAM para outras estratégias
+ *
+ * Quando o load passa de 0.75, put aloca o array com o dobro de buckets e
+ * mantém o antigo: cada put/remove seguinte religa buckets_per_step
+ * buckets do antigo para o novo (visitando no máximo 10 vazios por
+ * bucket), de modo que nenhuma operação paga o rehash inteiro. Enquanto
+ * a migração durar, buscas consultam os dois arrays e inserções vão
+ * sempre para o novo, como no dict do Redis. hashtable_get não migra
+ * (a tabela é const); hashtable_rehash_step permite migrar em momentos
+ * ociosos. Desativar (0) durante uma migração a conclui na hora.
+ *
+ * Complexidade: O(1), ou O(n) se concluir uma migração
+ */
+DataStructureError hashtable_set_incremental_rehash(HashTable *table, size_t buckets_per_step);
+
+/**
+ * @brief Verifica se há uma migração incremental em andamento
+ */
+bool hashtable_is_rehashing(const HashTable *table);
+
+/**
+ * @brief Migra até `buckets` buckets não vazios da migração em andamento
+ *
+ * @return true se a migração ainda não terminou
+ *
+ * Complexidade: O(buckets * tamanho das chains)
+ */
+bool hashtable_rehash_step(HashTable *table, size_t buckets);
+
 /**
  * @brief Retorna array com todas as chaves
  *
@@ -390,6 +514,136 @@ typedef struct {
  */
 HashTableStats hashtable_stats(const HashTable *table);
 
+/**
+ * @brief Relatório de qualidade de uma função hash sobre um conjunto de chaves
+ */
+typedef struct {
+    HashTableStats stats;           /**< hashtable_stats da tabela HASH_CHAINING resultante */
+    double expected_empty_buckets;  /**< Buckets vazios esperados com hash uniforme */
+    double expected_collisions;     /**< Colisões esperadas com hash uniforme */
+    double ns_per_key;              /**< Tempo médio de uma chamada de hash_fn */
+} HashQualityReport;
+
+/**
+ * @brief Mede distribuição e velocidade de hash_fn sobre keys
+ *
+ * Insere as count chaves (key_size bytes cada, contíguas) em uma tabela
+ * HASH_CHAINING temporária com capacidade inicial capacity e preenche
+ * report->stats com hashtable_stats. Para n chaves distintas em m buckets,
+ * um hash uniforme deixa m·(1 - 1/m)^n buckets vazios; valores de
+ * empty_buckets/collisions bem acima do esperado indicam agrupamento.
+ * ns_per_key cronometra só hash_fn, repetida até cerca de 2^20 chamadas.
+ *
+ * @param keys Array de chaves
+ * @param count Número de chaves
+ * @param key_size Tamanho de cada chave
+ * @param capacity Capacidade inicial (0 = count)
+ * @param report Relatório de saída
+ * @return DS_SUCCESS, DS_ERROR_NULL_POINTER, DS_ERROR_INVALID_PARAM
+ *         (count ou key_size zero) ou DS_ERROR_OUT_OF_MEMORY
+ *
+ * Exemplo:
+ * @code
+ * HashQualityReport djb2, wy;
+ * hashtable_hash_quality(names, n, sizeof(char*), hash_djb2, compare_string, 0, &djb2);
+ * hashtable_hash_quality(names, n, sizeof(char*), hash_wyhash_string, compare_string, 0, &wy);
+ * @endcode
+ *
+ * Complexidade: O(count + capacity)
+ */
+DataStructureError hashtable_hash_quality(const void *keys, size_t count, size_t key_size,
+                                          HashFn hash_fn, CompareFn compare_fn,
+                                          size_t capacity, HashQualityReport *report);
+
+// ============================================================================
+// TABELA HASH CONCORRENTE (SEGMENTOS COM LOCK DE LEITURA/ESCRITA)
+// ============================================================================
+
+/*
+ * A tabela é dividida em segmentos (potência de 2); os bits altos do hash
+ * (misturado) escolhem o segmento e cada segmento é uma HashTable
+ * HASH_CHAINING independente protegida por um lock de leitura/escrita
+ * próprio, em sua linha de cache:
+ *
+ * - get/contains tomam o lock de leitura: leitores do mesmo segmento não
+ *   se bloqueiam, e leitores de segmentos diferentes não compartilham
+ *   nenhuma linha de cache
+ * - put/remove tomam o lock de escrita só do seu segmento
+ * - Cada segmento cresce sozinho (com rehash incremental), então um resize
+ *   não para os demais segmentos
+ *
+ * O lock dá preferência a escritores: um escritor esperando impede novos
+ * leitores de entrar, para que escritas não passem fome sob muitas leituras.
+ *
+ * Referências:
+ * - Lea, D. (2006). java.util.concurrent.ConcurrentHashMap (segmentos)
+ * - Herlihy, M. & Shavit, N. (2008). "The Art of Multiprocessor
+ *   Programming", Chapter 13 - Concurrent Hashing
+ */
+
+/** Número de segmentos usado quando num_segments é 0 */
+#define CHT_DEFAULT_SEGMENTS 64
+
+typedef struct ConcurrentHashTable ConcurrentHashTable;
+
+/**
+ * @brief Cria uma tabela concorrente
+ *
+ * @param num_segments Número de segmentos (arredondado para potência de 2;
+ *        0 = CHT_DEFAULT_SEGMENTS). Mais segmentos que threads escritoras
+ *        reduzem conflitos; alguns por núcleo costumam bastar
+ * @param destroy_key, destroy_value Como em hashtable_create()
+ * @return ConcurrentHashTable* Tabela criada ou NULL (argumento inválido ou sem memória)
+ *
+ * Os segmentos usam o alocador padrão (libc), seguro entre threads.
+ */
+ConcurrentHashTable* cht_create(size_t key_size, size_t value_size, size_t num_segments,
+                                HashFn hash_fn, CompareFn compare_fn,
+                                DestroyFn destroy_key, DestroyFn destroy_value);
+
+/**
+ * @brief Libera a tabela (não concorrente com outras operações)
+ */
+void cht_destroy(ConcurrentHashTable *table);
+
+/**
+ * @brief Insere ou atualiza (qualquer thread)
+ *
+ * Complexidade: O(1) amortizado; um resize afeta só o segmento da chave
+ */
+DataStructureError cht_put(ConcurrentHashTable *table, const void *key, const void *value);
+
+/**
+ * @brief Copia o valor da chave para value (pode ser NULL) (qualquer thread)
+ *
+ * Não há versão que devolve ponteiro: o valor poderia ser alterado ou
+ * liberado por outra thread logo após o lock ser solto.
+ */
+DataStructureError cht_get(const ConcurrentHashTable *table, const void *key, void *value);
+
+/**
+ * @brief Remove a chave, copiando o valor para old_value (pode ser NULL)
+ */
+DataStructureError cht_remove(ConcurrentHashTable *table, const void *key, void *old_value);
+
+bool cht_contains(const ConcurrentHashTable *table, const void *key);
+
+/**
+ * @brief Número de elementos (instantâneo; pode mudar logo em seguida)
+ */
+size_t cht_size(const ConcurrentHashTable *table);
+size_t cht_num_segments(const ConcurrentHashTable *table);
+
+/**
+ * @brief Bytes alocados (soma de hashtable_memory_usage dos segmentos)
+ */
+size_t cht_memory_usage(const ConcurrentHashTable *table);
+
+/**
+ * @brief Remove todos os elementos (segmento a segmento)
+ */
+void cht_clear(ConcurrentHashTable *table);
+
 // ============================================================================
 // FUNÇÕES HASH AUXILIARES
 // ============================================================================
@@ -416,6 +670,43 @@ size_t hash_djb2(const void *data);
  */
 size_t hash_fnv1a(const void *data, size_t size);
 
+/**
+ * @brief Função hash wyhash para dados binários, com semente
+ *
+ * @param data Ponteiro para os dados (pode ser NULL se size == 0)
+ * @param size Tamanho dos dados
+ * @param seed Semente; sementes diferentes geram famílias de hash independentes
+ * @return size_t Hash value
+ *
+ * Lê 8 bytes por vez (três cadeias independentes acima de 48 bytes) em vez
+ * de um byte por iteração como djb2/FNV-1a. O resultado depende da ordem de
+ * bytes da máquina.
+ * Referência: https://github.com/wangyi-fudan/wyhash
+ */
+size_t hash_wyhash(const void *data, size_t size, uint64_t seed);
+
+/**
+ * @brief wyhash para strings (char*) usando a semente global
+ *
+ * Substituto direto de hash_string/hash_djb2 como HashFn.
+ */
+size_t hash_wyhash_string(const void *data);
+
+/**
+ * @brief Define a semente global usada por hash_wyhash_string
+ *
+ * Contra HashDoS, chame uma vez no início do programa com
+ * hash_random_seed(), antes de criar tabelas: trocar a semente invalida
+ * os hashes de tabelas já populadas. A semente padrão é 0.
+ */
+void hash_set_seed(uint64_t seed);
+uint64_t hash_get_seed(void);
+
+/**
+ * @brief Gera uma semente imprevisível (relógio, endereços, contador)
+ */
+uint64_t hash_random_seed(void);
+
 /**
  * @brief Função hash multiplicativa (Knuth)
  *
@@ -8,6 +8,8 @@
  *
  * Implementado como array para eficiência (heap implícito).
  * Para índice i: parent = (i-1)/2, left = 2i+1, right = 2i+2
+ * (heap_create_with_arity generaliza para d filhos: parent = (i-1)/d;
+ * typed_heap.h gera heaps tipados sem CompareFn)
  *
  * Complexidade das Operações:
  * - Insert: O(log n)
@@ -63,6 +65,38 @@ typedef enum {
 Heap* heap_create(size_t element_size, size_t initial_capacity,
                   HeapType type, CompareFn compare, DestroyFn destroy);
 
+/**
+ * @brief Cria um heap cujo cabeçalho e array vêm de um alocador customizado
+ *
+ * @param allocator Alocador (NULL = malloc/realloc/free); demais parâmetros
+ *                  como em heap_create()
+ * @return Heap* Heap criado
+ *
+ * Complexidade: O(capacity)
+ */
+Heap* heap_create_with_allocator(size_t element_size, size_t initial_capacity,
+                                 HeapType type, CompareFn compare, DestroyFn destroy,
+                                 const DSAllocator *allocator);
+
+/**
+ * @brief Cria um heap d-ário (cada nó com arity filhos)
+ *
+ * Com arity 4 ou 8 os filhos de um nó ficam numa mesma linha de cache
+ * (para elementos pequenos) e a altura cai para log_d n: inserções sobem
+ * menos níveis e as extrações fazem menos acessos dispersos. heap_update
+ * e os índices continuam válidos (filhos de i: arity*i+1 .. arity*i+arity).
+ *
+ * @param arity Filhos por nó (>= 2; 2 equivale a heap_create_with_allocator)
+ * @param allocator Alocador (NULL = malloc/realloc/free); demais parâmetros
+ *                  como em heap_create()
+ * @return Heap* Heap criado, ou NULL (arity < 2 ou parâmetros inválidos)
+ *
+ * Complexidade: O(capacity)
+ */
+Heap* heap_create_with_arity(size_t element_size, size_t initial_capacity, size_t arity,
+                             HeapType type, CompareFn compare, DestroyFn destroy,
+                             const DSAllocator *allocator);
+
 /**
  * @brief Destrói o heap
  *
@@ -111,6 +145,9 @@ DataStructureError heap_insert(Heap *heap, const void *data);
  *   return max
  *
  * Algoritmo: Remove raiz, substitui pelo último, "afunda" (heap-down/bubble-down).
+ * A implementação é bottom-up: o buraco da raiz desce pelo melhor filho
+ * até uma folha e o último elemento sobe dali, o que evita comparar esse
+ * elemento em cada nível.
  *
  * Complexidade: O(log n)
  */
@@ -219,6 +256,17 @@ size_t heap_size(const Heap *heap);
  */
 size_t heap_capacity(const Heap *heap);
 
+/**
+ * @brief Retorna o número de filhos por nó (2 para heap binário)
+ */
+size_t heap_arity(const Heap *heap);
+
+/**
+ * @brief Retorna os bytes ocupados (cabeçalho e array, incluindo a
+ *        capacidade não usada)
+ */
+size_t heap_memory_usage(const Heap *heap);
+
 /**
  * @brief Limpa o heap
  */
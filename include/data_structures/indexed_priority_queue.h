@@ -0,0 +1,146 @@
+/**
+ * @file indexed_priority_queue.h
+ * @brief Fila de prioridade indexada (handles inteiros + mapa de posições)
+ *
+ * Cada elemento é identificado por um handle inteiro em [0, max_handles),
+ * escolhido pelo usuário (tipicamente o id do vértice). Além do heap binário
+ * de handles, a fila mantém pos[handle] com a posição do handle no heap, o
+ * que permite localizar e reposicionar qualquer elemento sem busca linear —
+ * a operação decrease-key de Dijkstra, Prim e A*.
+ *
+ * As chaves ficam em um array indexado pelo handle; o heap só move handles
+ * (size_t), independentemente de element_size.
+ *
+ * Complexidade:
+ * - Insert / Extract / Remove / Change key: O(log n)
+ * - Peek / Contains / Key of: O(1)
+ * - Memória: O(max_handles) desde a criação
+ *
+ * Referências:
+ * - Sedgewick & Wayne (2011), Section 2.4 - Index priority queue
+ * - Cormen et al. (2009), Section 6.5
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef INDEXED_PRIORITY_QUEUE_H
+#define INDEXED_PRIORITY_QUEUE_H
+
+#include "common.h"
+#include "priority_queue.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct IndexedPriorityQueue IndexedPriorityQueue;
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+/**
+ * @brief Cria uma fila indexada para handles em [0, max_handles)
+ * @param max_handles Número de handles distintos (ex.: número de vértices)
+ * @param element_size Tamanho de cada chave
+ * @param type PQ_MIN ou PQ_MAX
+ * @param compare Função de comparação das chaves
+ * @return Fila criada, ou NULL (argumento inválido, max_handles > DS_INDEX_MAX
+ *         ou falha de alocação)
+ */
+IndexedPriorityQueue* ipq_create(size_t max_handles, size_t element_size,
+                                 PriorityQueueType type, CompareFn compare);
+
+/**
+ * @brief Cria uma fila indexada com alocador customizado (NULL = libc)
+ */
+IndexedPriorityQueue* ipq_create_with_allocator(size_t max_handles, size_t element_size,
+                                                PriorityQueueType type, CompareFn compare,
+                                                const DSAllocator *allocator);
+
+void ipq_destroy(IndexedPriorityQueue *ipq);
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+/**
+ * @brief Insere o handle com a chave dada
+ * @return DS_ERROR_INVALID_INDEX se handle >= max_handles,
+ *         DS_ERROR_INVALID_PARAM se o handle já estiver na fila
+ *
+ * Complexidade: O(log n)
+ */
+DataStructureError ipq_insert(IndexedPriorityQueue *ipq, size_t handle, const void *key);
+
+/**
+ * @brief Remove o elemento de maior prioridade
+ * @param handle Recebe o handle removido (pode ser NULL)
+ * @param key Recebe a chave removida (pode ser NULL)
+ *
+ * Complexidade: O(log n)
+ */
+DataStructureError ipq_extract(IndexedPriorityQueue *ipq, size_t *handle, void *key);
+
+/**
+ * @brief Consulta o elemento de maior prioridade sem removê-lo
+ * @param handle Recebe o handle (pode ser NULL)
+ * @param key Recebe a chave (pode ser NULL)
+ *
+ * Complexidade: O(1)
+ */
+DataStructureError ipq_peek(const IndexedPriorityQueue *ipq, size_t *handle, void *key);
+
+/**
+ * @brief Aumenta a prioridade de um handle (decrease-key em PQ_MIN)
+ *
+ * Em PQ_MIN a nova chave deve ser <= a atual; em PQ_MAX, >= a atual.
+ *
+ * @return DS_ERROR_NOT_FOUND se o handle não estiver na fila,
+ *         DS_ERROR_INVALID_PARAM se a nova chave diminuir a prioridade
+ *
+ * Complexidade: O(log n)
+ */
+DataStructureError ipq_decrease_key(IndexedPriorityQueue *ipq, size_t handle,
+                                    const void *key);
+
+/**
+ * @brief Troca a chave de um handle, em qualquer direção
+ *
+ * Complexidade: O(log n)
+ */
+DataStructureError ipq_change_key(IndexedPriorityQueue *ipq, size_t handle,
+                                  const void *key);
+
+/**
+ * @brief Remove um handle arbitrário da fila
+ *
+ * Complexidade: O(log n)
+ */
+DataStructureError ipq_remove(IndexedPriorityQueue *ipq, size_t handle);
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+bool ipq_contains(const IndexedPriorityQueue *ipq, size_t handle);
+
+/**
+ * @brief Copia a chave atual de um handle presente na fila
+ */
+DataStructureError ipq_key_of(const IndexedPriorityQueue *ipq, size_t handle, void *key);
+
+bool ipq_is_empty(const IndexedPriorityQueue *ipq);
+size_t ipq_size(const IndexedPriorityQueue *ipq);
+size_t ipq_max_handles(const IndexedPriorityQueue *ipq);
+
+/**
+ * @brief Bytes ocupados: cabeçalho, heap e pos (ds_index_t) e as chaves
+ */
+size_t ipq_memory_usage(const IndexedPriorityQueue *ipq);
+
+/**
+ * @brief Remove todos os handles (O(n), não O(max_handles))
+ */
+void ipq_clear(IndexedPriorityQueue *ipq);
+
+#endif // INDEXED_PRIORITY_QUEUE_H
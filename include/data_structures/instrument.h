@@ -0,0 +1,248 @@
+/**
+ * @file instrument.h
+ * @brief Contadores e temporizadores de instrumentação dos caminhos quentes
+ *
+ * Camada opcional, ligada em tempo de compilação com
+ * -DENABLE_INSTRUMENTATION=ON (define DS_INSTRUMENT). Desligada, as macros
+ * DS_COUNT/DS_TIMER_* expandem para nada: nem os argumentos são avaliados,
+ * e o custo é zero. As funções ds_instrument_* existem nos dois modos;
+ * sem DS_INSTRUMENT devolvem tudo zerado.
+ *
+ * Ligada, cada thread incrementa o próprio bloco de contadores (registrado
+ * no primeiro uso, sem lock e sem instrução atômica de leitura-escrita no
+ * caminho quente); ds_instrument_snapshot() soma os blocos de todas as
+ * threads. Temporizadores acumulam ticks de rdtsc (x86) ou nanossegundos
+ * do relógio monotônico e contam as chamadas.
+ *
+ * Pontos instrumentados:
+ * - allocator: alocações, bytes pedidos e liberações (ds_alloc & cia.)
+ * - hash_table: sondagens (slots, grupos ou nós visitados) e rehashes;
+ *   temporizador de rehash
+ * - avl_tree: rotações
+ * - sorting: comparações e trocas das ordenações genéricas e do pdqsort;
+ *   temporizador por chamada de ordenação
+ * - optimization: avaliações da função objetivo por execução de
+ *   metaheurística; temporizador por execução
+ *
+ * Exemplo:
+ * @code
+ * ds_instrument_reset();
+ * run_workload();
+ * ds_instrument_dump(stderr);
+ * @endcode
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef INSTRUMENT_H
+#define INSTRUMENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// ============================================================================
+// COMPONENTES, CONTADORES E TEMPORIZADORES
+// ============================================================================
+
+/**
+ * @brief Módulo a que um contador é atribuído
+ */
+typedef enum {
+    DS_COMPONENT_ALLOCATOR,      /**< ds_alloc/ds_calloc/ds_realloc/ds_free */
+    DS_COMPONENT_HASH_TABLE,     /**< hash_table.c */
+    DS_COMPONENT_AVL_TREE,       /**< avl_tree.c */
+    DS_COMPONENT_SORTING,        /**< sorting.c e pdqsort.c */
+    DS_COMPONENT_OPTIMIZATION,   /**< Metaheurísticas (optimization/) */
+    DS_COMPONENT_COUNT
+} DSComponent;
+
+/**
+ * @brief Evento contado
+ */
+typedef enum {
+    DS_COUNTER_COMPARISONS,      /**< Chamadas da função de comparação */
+    DS_COUNTER_SWAPS,            /**< Trocas de elementos */
+    DS_COUNTER_ALLOCATIONS,      /**< Alocações (inclui realocações) */
+    DS_COUNTER_ALLOCATED_BYTES,  /**< Bytes pedidos nas alocações */
+    DS_COUNTER_FREES,            /**< Liberações */
+    DS_COUNTER_PROBES,           /**< Posições visitadas em buscas */
+    DS_COUNTER_ROTATIONS,        /**< Rotações de rebalanceamento */
+    DS_COUNTER_REHASHES,         /**< Redimensionamentos de tabela */
+    DS_COUNTER_EVALUATIONS,      /**< Avaliações da função objetivo */
+    DS_COUNTER_COUNT
+} DSCounter;
+
+/**
+ * @brief Trecho cronometrado
+ */
+typedef enum {
+    DS_TIMER_HASH_REHASH,        /**< hashtable_rehash e crescimentos automáticos */
+    DS_TIMER_SORT,               /**< Uma chamada de ordenação genérica */
+    DS_TIMER_OPT_RUN,            /**< Uma execução de metaheurística */
+    DS_TIMER_COUNT
+} DSTimer;
+
+/**
+ * @brief Totais desde o último ds_instrument_reset(), somados entre threads
+ */
+typedef struct {
+    uint64_t counters[DS_COMPONENT_COUNT][DS_COUNTER_COUNT];  /**< [componente][contador] */
+    uint64_t timer_ticks[DS_TIMER_COUNT];   /**< Ticks acumulados por temporizador */
+    uint64_t timer_calls[DS_TIMER_COUNT];   /**< Trechos cronometrados */
+    double ns_per_tick;                     /**< Conversão de ticks para ns (0 se desligado) */
+} DSInstrumentStats;
+
+// ============================================================================
+// API
+// ============================================================================
+
+/**
+ * @brief Indica se a biblioteca foi compilada com DS_INSTRUMENT
+ */
+bool ds_instrument_enabled(void);
+
+/**
+ * @brief Zera os totais (guarda os valores atuais como linha de base)
+ *
+ * Deve ser chamada da thread de controle, não concorrente com
+ * ds_instrument_snapshot(); as threads instrumentadas podem continuar
+ * rodando.
+ */
+void ds_instrument_reset(void);
+
+/**
+ * @brief Copia os totais desde o último reset
+ *
+ * Contadores de threads já encerradas continuam somados. Com threads
+ * ativas, cada contador é lido atomicamente, mas o conjunto não é um
+ * instantâneo consistente.
+ *
+ * Complexidade: O(threads que já usaram a instrumentação)
+ */
+void ds_instrument_snapshot(DSInstrumentStats *stats);
+
+/**
+ * @brief Escreve em out os contadores e temporizadores não nulos
+ *
+ * Uma linha "componente.contador valor" por contador e, por temporizador,
+ * chamadas, tempo total e tempo médio por chamada. Sem DS_INSTRUMENT,
+ * escreve só um aviso.
+ */
+void ds_instrument_dump(FILE *out);
+
+/**
+ * @brief Nome do componente ("hash_table", ...)
+ */
+const char* ds_instrument_component_name(DSComponent component);
+
+/**
+ * @brief Nome do contador ("probes", ...)
+ */
+const char* ds_instrument_counter_name(DSCounter counter);
+
+/**
+ * @brief Nome do temporizador ("hash_rehash", ...)
+ */
+const char* ds_instrument_timer_name(DSTimer timer);
+
+// ============================================================================
+// MACROS DOS PONTOS INSTRUMENTADOS
+// ============================================================================
+
+#ifdef DS_INSTRUMENT
+
+#include <stdatomic.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define DS_INSTRUMENT_RDTSC 1
+#endif
+
+/**
+ * @brief Bloco de contadores de uma thread (uso interno)
+ *
+ * Só a thread dona escreve; leitura e escrita relaxadas separadas evitam a
+ * instrução com lock e ainda permitem a leitura concorrente do snapshot.
+ */
+typedef struct DSInstrumentBlock {
+    _Atomic uint64_t counters[DS_COMPONENT_COUNT][DS_COUNTER_COUNT];
+    _Atomic uint64_t timer_ticks[DS_TIMER_COUNT];
+    _Atomic uint64_t timer_calls[DS_TIMER_COUNT];
+    struct DSInstrumentBlock *next;
+} DSInstrumentBlock;
+
+extern _Thread_local DSInstrumentBlock *ds_instrument_local;
+
+/** Registra o bloco da thread corrente (uso interno; NULL sem memória) */
+DSInstrumentBlock* ds_instrument_register(void);
+
+static inline void ds_instrument_bump(_Atomic uint64_t *slot, uint64_t n) {
+    atomic_store_explicit(slot, atomic_load_explicit(slot, memory_order_relaxed) + n,
+                          memory_order_relaxed);
+}
+
+static inline void ds_instrument_add(DSComponent component, DSCounter counter, uint64_t n) {
+    DSInstrumentBlock *block = ds_instrument_local;
+    if (block == NULL && (block = ds_instrument_register()) == NULL) return;
+    ds_instrument_bump(&block->counters[component][counter], n);
+}
+
+static inline uint64_t ds_instrument_ticks(void) {
+#ifdef DS_INSTRUMENT_RDTSC
+    return (uint64_t)__rdtsc();
+#else
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static inline void ds_instrument_timer_add(DSTimer timer, uint64_t ticks) {
+    DSInstrumentBlock *block = ds_instrument_local;
+    if (block == NULL && (block = ds_instrument_register()) == NULL) return;
+    ds_instrument_bump(&block->timer_ticks[timer], ticks);
+    ds_instrument_bump(&block->timer_calls[timer], 1);
+}
+
+/** Soma n ao contador (componente e contador sem prefixo: DS_COUNT(HASH_TABLE, PROBES, 1)) */
+#define DS_COUNT(component, counter, n) \
+    ds_instrument_add(DS_COMPONENT_##component, DS_COUNTER_##counter, (uint64_t)(n))
+
+/** Declara var com o tick inicial de um trecho */
+#define DS_TIMER_BEGIN(var) uint64_t var = ds_instrument_ticks()
+
+/** Fecha o trecho iniciado por DS_TIMER_BEGIN(var) */
+#define DS_TIMER_END(timer, var) \
+    ds_instrument_timer_add(DS_TIMER_##timer, ds_instrument_ticks() - (var))
+
+#if defined(__GNUC__)
+typedef struct {
+    DSTimer timer;
+    uint64_t start;
+} DSTimerScope;
+
+static inline void ds_instrument_scope_end(DSTimerScope *scope) {
+    ds_instrument_timer_add(scope->timer, ds_instrument_ticks() - scope->start);
+}
+
+/** Cronometra até o fim do bloco corrente, inclusive por return antecipado */
+#define DS_TIMER_SCOPE(timer)                                                  \
+    __attribute__((cleanup(ds_instrument_scope_end))) DSTimerScope             \
+    ds_timer_scope_##timer = {DS_TIMER_##timer, ds_instrument_ticks()}
+#else
+#define DS_TIMER_SCOPE(timer) ((void)0)
+#endif
+
+#else // !DS_INSTRUMENT
+
+#define DS_COUNT(component, counter, n) ((void)0)
+#define DS_TIMER_BEGIN(var) ((void)0)
+#define DS_TIMER_END(timer, var) ((void)0)
+#define DS_TIMER_SCOPE(timer) ((void)0)
+
+#endif // DS_INSTRUMENT
+
+#endif // INSTRUMENT_H
@@ -0,0 +1,115 @@
+/**
+ * @file large_alloc.h
+ * @brief Alocação de buffers grandes com huge pages e política NUMA
+ *
+ * Matrizes n x n (distâncias do TSP, feromônio do ACO, APSP) e populações
+ * grandes são lidas por todas as threads. Com malloc, as páginas nascem no
+ * nó NUMA da thread que as tocou primeiro — em geral a que montou a
+ * matriz — e, num servidor de dois sockets, metade das threads passa a ler
+ * memória remota. Os TLB misses de páginas de 4 KiB somam outro custo nos
+ * acessos aleatórios.
+ *
+ * Blocos a partir de DS_LARGE_ALLOC_THRESHOLD vêm de mmap (Linux),
+ * alinhados a DS_HUGE_PAGE_SIZE, e recebem:
+ * - DS_LARGE_HUGE_PAGES: madvise(MADV_HUGEPAGE), huge pages transparentes;
+ * - DS_LARGE_INTERLEAVE: mbind(MPOL_INTERLEAVE) sobre os nós online, para
+ *   dados compartilhados por todas as threads (sem efeito com um só nó).
+ * Sem DS_LARGE_INTERLEAVE vale o first-touch: quem inicializa o bloco em
+ * paralelo, com a mesma partição do cálculo, deixa cada faixa no nó de
+ * quem a usa (como floyd_warshall_blocked).
+ *
+ * O alocador não toca as páginas; a memória volta zerada. Blocos menores,
+ * ou sistemas sem mmap, usam calloc. Os pedidos de huge pages e NUMA são
+ * conselhos: se o kernel os recusa, o bloco segue válido.
+ *
+ * Uso típico:
+ * @code
+ * double *m = ds_large_calloc(n * n, sizeof(double));
+ * // ...
+ * ds_large_free(m, n * n, sizeof(double));   // mesmo count e size
+ * @endcode
+ *
+ * Referências:
+ * - Lameter, C. (2013). "NUMA (Non-Uniform Memory Access): An Overview".
+ *   ACM Queue 11(7)
+ * - Documentação do kernel Linux: "Transparent Hugepage Support"
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef LARGE_ALLOC_H
+#define LARGE_ALLOC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Huge pages transparentes (madvise MADV_HUGEPAGE) */
+#define DS_LARGE_HUGE_PAGES 0x1u
+
+/** Páginas intercaladas entre os nós NUMA online */
+#define DS_LARGE_INTERLEAVE 0x2u
+
+/** Política padrão: huge pages e intercalação */
+#define DS_LARGE_DEFAULT_FLAGS (DS_LARGE_HUGE_PAGES | DS_LARGE_INTERLEAVE)
+
+/** Tamanho de uma huge page (x86-64 e AArch64 com páginas de 4 KiB) */
+#define DS_HUGE_PAGE_SIZE ((size_t)2 << 20)
+
+/** Blocos a partir deste tamanho (bytes) vão para mmap */
+#define DS_LARGE_ALLOC_THRESHOLD DS_HUGE_PAGE_SIZE
+
+// ============================================================================
+// POLÍTICA GLOBAL
+// ============================================================================
+
+/**
+ * @brief Define as flags usadas por ds_large_calloc (DS_LARGE_*)
+ *
+ * 0 volta ao comportamento de malloc (bloco mapeado, sem conselhos).
+ * Vale para as alocações seguintes; pode ser chamada de qualquer thread.
+ */
+void ds_set_large_alloc_flags(unsigned flags);
+
+/**
+ * @brief Flags em vigor (padrão DS_LARGE_DEFAULT_FLAGS)
+ */
+unsigned ds_get_large_alloc_flags(void);
+
+/**
+ * @brief Número de nós NUMA online (1 sem NUMA ou fora do Linux)
+ */
+size_t ds_numa_num_nodes(void);
+
+// ============================================================================
+// ALOCAÇÃO
+// ============================================================================
+
+/**
+ * @brief Aloca count * size bytes zerados com as flags globais
+ *
+ * @return void* Bloco alinhado a max_align_t (a DS_HUGE_PAGE_SIZE quando
+ *         mapeado), ou NULL (sem memória ou count * size estoura)
+ *
+ * Complexidade: O(1) (páginas zeradas sob demanda pelo kernel)
+ */
+void* ds_large_calloc(size_t count, size_t size);
+
+/**
+ * @brief Como ds_large_calloc, com flags explícitas
+ */
+void* ds_large_calloc_flags(size_t count, size_t size, unsigned flags);
+
+/**
+ * @brief Libera um bloco de ds_large_calloc* (ptr NULL é ignorado)
+ *
+ * count e size devem ser os da alocação: decidem entre munmap e free.
+ */
+void ds_large_free(void *ptr, size_t count, size_t size);
+
+/**
+ * @brief O bloco de count * size bytes vem de mmap?
+ */
+bool ds_large_is_mapped(size_t count, size_t size);
+
+#endif // LARGE_ALLOC_H
@@ -12,6 +12,10 @@
  * - Busca: O(n)
  * - Acesso por índice: O(n)
  *
+ * LIST_UNROLLED guarda vários elementos contíguos por nó (um bloco do
+ * tamanho de uma linha de cache): uma alocação por bloco em vez de duas
+ * por elemento, e percursos sequenciais próximos da velocidade de um array.
+ *
  * Referências Acadêmicas:
  * - Knuth, D. E. (1997). "The Art of Computer Programming, Vol 1", Section 2.2
  *   "Linear Lists" - Análise detalhada de listas encadeadas
@@ -43,6 +47,13 @@ typedef struct LinkedList LinkedList;
  * @brief Estrutura opaca do nó da lista
  *
  * Usado para iteração e acesso direto aos elementos.
+ *
+ * Em LIST_UNROLLED cada nó é um bloco de list_node_count() elementos
+ * contíguos: list_begin/list_next/list_prev percorrem blocos,
+ * list_node_data aponta para o primeiro elemento do bloco, list_find
+ * devolve o bloco que contém o valor e list_remove_node remove o bloco
+ * inteiro. Inserções e remoções movem elementos entre blocos, então
+ * ponteiros para nós e dados só valem até a próxima modificação.
  */
 typedef struct ListNode ListNode;
 
@@ -52,7 +63,8 @@ typedef struct ListNode ListNode;
 typedef enum {
     LIST_SINGLY,      /**< Lista simplesmente encadeada */
     LIST_DOUBLY,      /**< Lista duplamente encadeada */
-    LIST_CIRCULAR     /**< Lista circular (duplamente encadeada) */
+    LIST_CIRCULAR,    /**< Lista circular (duplamente encadeada) */
+    LIST_UNROLLED     /**< Duplamente encadeada, vários elementos por nó */
 } ListType;
 
 // ============================================================================
@@ -80,6 +92,26 @@ typedef enum {
  */
 LinkedList* list_create(size_t element_size, ListType type, DestroyFn destroy);
 
+/**
+ * @brief Cria uma lista cujos nós são obtidos de um alocador customizado
+ *
+ * @param element_size Tamanho de cada elemento em bytes
+ * @param type Tipo de lista
+ * @param destroy Função de destruição customizada (NULL se não necessário)
+ * @param allocator Alocador de nós e do cabeçalho (NULL = malloc/free);
+ *                  é copiado, mas seu contexto (ex: DSArena) deve
+ *                  sobreviver à lista
+ * @return LinkedList* Ponteiro para a lista criada, ou NULL em caso de erro
+ *
+ * Com uma arena (arena.h) os nós ficam contíguos e a lista inteira pode
+ * ser descartada com ds_arena_reset()/ds_arena_destroy() sem percorrê-la.
+ *
+ * Complexidade: O(1)
+ */
+LinkedList* list_create_with_allocator(size_t element_size, ListType type,
+                                       DestroyFn destroy,
+                                       const DSAllocator *allocator);
+
 /**
  * @brief Destrói a lista e libera toda a memória associada
  *
@@ -142,23 +174,27 @@ DataStructureError list_insert_at(LinkedList *list, size_t index, const void *da
  * @brief Insere um elemento após um nó específico
  *
  * @param list Ponteiro para a lista
- * @param node Nó após o qual inserir
+ * @param node Nó após o qual inserir (em LIST_UNROLLED, após o último
+ *        elemento do bloco)
  * @param data Ponteiro para o dado a ser inserido
  * @return DataStructureError Código de erro
  *
- * Complexidade: O(1)
+ * Complexidade: O(1) (amortizado em LIST_UNROLLED: um bloco cheio é
+ * dividido ao meio)
  */
 DataStructureError list_insert_after(LinkedList *list, ListNode *node, const void *data);
 
 /**
- * @brief Insere um elemento antes de um nó específico (apenas LIST_DOUBLY e LIST_CIRCULAR)
+ * @brief Insere um elemento antes de um nó específico
+ *
+ * Em LIST_UNROLLED, antes do primeiro elemento do bloco.
  *
  * @param list Ponteiro para a lista
  * @param node Nó antes do qual inserir
  * @param data Ponteiro para o dado a ser inserido
  * @return DataStructureError Código de erro
  *
- * Complexidade: O(1) para LIST_DOUBLY/LIST_CIRCULAR, O(n) para LIST_SINGLY
+ * Complexidade: O(1) para LIST_DOUBLY/LIST_CIRCULAR/LIST_UNROLLED, O(n) para LIST_SINGLY
  */
 DataStructureError list_insert_before(LinkedList *list, ListNode *node, const void *data);
 
@@ -243,7 +279,7 @@ DataStructureError list_remove(LinkedList *list, const void *data, CompareFn com
  * @param output Buffer para armazenar o elemento
  * @return DataStructureError Código de erro
  *
- * Complexidade: O(n)
+ * Complexidade: O(n) (O(n / K) em LIST_UNROLLED, K = elementos por bloco)
  */
 DataStructureError list_get(const LinkedList *list, size_t index, void *output);
 
@@ -307,6 +343,17 @@ bool list_is_empty(const LinkedList *list);
  */
 size_t list_size(const LinkedList *list);
 
+/**
+ * @brief Retorna os bytes ocupados pela lista (cabeçalho, nós e dados)
+ *
+ * @param list Ponteiro para a lista
+ * @return size_t Bytes alocados; em LIST_UNROLLED conta blocos inteiros,
+ *         inclusive as posições livres
+ *
+ * Complexidade: O(1), ou O(n / B) em LIST_UNROLLED (percorre os blocos)
+ */
+size_t list_memory_usage(const LinkedList *list);
+
 /**
  * @brief Remove todos os elementos da lista
  *
@@ -389,6 +436,17 @@ ListNode* list_prev(const ListNode *node);
  */
 void* list_node_data(const ListNode *node);
 
+/**
+ * @brief Número de elementos contíguos em list_node_data(node)
+ *
+ * @param node Nó
+ * @return size_t Elementos do bloco em LIST_UNROLLED; 1 nos demais tipos
+ *         (0 se node for NULL)
+ *
+ * Complexidade: O(1)
+ */
+size_t list_node_count(const ListNode *node);
+
 // ============================================================================
 // OPERAÇÕES AVANÇADAS
 // ============================================================================
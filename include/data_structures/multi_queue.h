@@ -0,0 +1,91 @@
+/**
+ * @file multi_queue.h
+ * @brief MultiQueue: fila de prioridade concorrente relaxada sobre Heap
+ *
+ * Em vez de um único heap com um lock global, a MultiQueue mantém
+ * num_queues heaps sequenciais (tipicamente c·p para p threads, c = 2),
+ * cada um com seu próprio try-lock em uma linha de cache:
+ *
+ * - Insert: escolhe um heap ao acaso e insere nele
+ * - Extract: sorteia dois heaps, compara seus topos e extrai do melhor
+ *   ("power of two choices")
+ *
+ * A ordem é relaxada: o elemento extraído não é necessariamente o de
+ * maior prioridade global, mas está entre os O(num_queues) primeiros com
+ * alta probabilidade — suficiente para escalonadores e atribuição de
+ * trabalho, que toleram pequenas inversões em troca de escalabilidade.
+ *
+ * Uma thread não espera por um lock ocupado: sorteia outro heap. Só a
+ * varredura final de extract, feita quando os sorteios só encontram heaps
+ * vazios, espera pelos locks — assim DS_ERROR_EMPTY nunca é devolvido
+ * enquanto houver elementos que já estavam na fila.
+ *
+ * Referências:
+ * - Rihani, H., Sanders, P. & Dementiev, R. (2015). "MultiQueues: Simple
+ *   Relaxed Concurrent Priority Queues". SPAA '15
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef MULTI_QUEUE_H
+#define MULTI_QUEUE_H
+
+#include "common.h"
+#include "priority_queue.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Heaps por thread recomendados (c em c·p) */
+#define MULTIQUEUE_QUEUES_PER_THREAD 2
+
+typedef struct MultiQueue MultiQueue;
+
+/**
+ * @brief Cria uma MultiQueue com num_queues heaps
+ *
+ * Os heaps usam o alocador padrão (libc), que é seguro entre threads.
+ *
+ * @param num_queues Número de heaps (ex.: MULTIQUEUE_QUEUES_PER_THREAD * threads)
+ * @return MultiQueue* Fila criada ou NULL (argumento inválido ou sem memória)
+ */
+MultiQueue* multiqueue_create(size_t element_size, size_t num_queues,
+                              PriorityQueueType type, CompareFn compare, DestroyFn destroy);
+
+/**
+ * @brief Libera a fila (não concorrente com outras operações)
+ */
+void multiqueue_destroy(MultiQueue *mq);
+
+/**
+ * @brief Insere uma cópia de data (qualquer thread)
+ *
+ * @return DS_SUCCESS, DS_ERROR_OUT_OF_MEMORY ou DS_ERROR_NULL_POINTER
+ */
+DataStructureError multiqueue_insert(MultiQueue *mq, const void *data);
+
+/**
+ * @brief Remove um elemento de alta prioridade (qualquer thread)
+ *
+ * @param output Buffer para o elemento (NULL para descartar)
+ * @return DS_SUCCESS, DS_ERROR_EMPTY (todos os heaps vazios durante a
+ *         varredura) ou DS_ERROR_NULL_POINTER
+ */
+DataStructureError multiqueue_extract(MultiQueue *mq, void *output);
+
+/**
+ * @brief Número de elementos (instantâneo; pode mudar logo em seguida)
+ */
+size_t multiqueue_size(const MultiQueue *mq);
+size_t multiqueue_num_queues(const MultiQueue *mq);
+
+/**
+ * @brief Bytes ocupados: cabeçalho, slots alinhados, cópias do topo e os
+ *        heaps internos
+ *
+ * Lê a capacidade dos heaps sem os locks: chame sem inserções em andamento.
+ */
+size_t multiqueue_memory_usage(const MultiQueue *mq);
+bool multiqueue_is_empty(const MultiQueue *mq);
+
+#endif // MULTI_QUEUE_H
@@ -0,0 +1,117 @@
+/**
+ * @file pairing_heap.h
+ * @brief Pairing heap: heap mergeável com meld em O(1)
+ *
+ * Árvore multi-ramificada com a ordem de heap, representada como
+ * filho-esquerdo/irmão-direito. Inserção e meld apenas ligam duas raízes;
+ * a extração junta os filhos da raiz em duas passadas (pares da esquerda
+ * para a direita, depois acumulando da direita para a esquerda).
+ *
+ * Útil quando filas inteiras precisam ser unidas, como ao fundir o pool de
+ * tarefas de um worker que sai no de outro: pairing_heap_meld não copia
+ * nem percorre elementos.
+ *
+ * Complexidade:
+ * - Insert / Meld / Peek: O(1)
+ * - Extract: O(log n) amortizado
+ * - Cada elemento é um nó alocado (cabeçalho de dois ponteiros + dado)
+ *
+ * Referências:
+ * - Fredman, M. L., Sedgewick, R., Sleator, D. D. & Tarjan, R. E. (1986).
+ *   "The Pairing Heap: A New Form of Self-Adjusting Heap". Algorithmica 1
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef PAIRING_HEAP_H
+#define PAIRING_HEAP_H
+
+#include "common.h"
+#include "heap.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct PairingHeap PairingHeap;
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+/**
+ * @brief Cria um pairing heap vazio
+ * @param element_size Tamanho de cada elemento
+ * @param type HEAP_MIN ou HEAP_MAX
+ * @param compare Função de comparação
+ * @param destroy Função de destruição (pode ser NULL)
+ */
+PairingHeap* pairing_heap_create(size_t element_size, HeapType type,
+                                 CompareFn compare, DestroyFn destroy);
+
+/**
+ * @brief Cria um pairing heap com alocador customizado (NULL = libc)
+ */
+PairingHeap* pairing_heap_create_with_allocator(size_t element_size, HeapType type,
+                                                CompareFn compare, DestroyFn destroy,
+                                                const DSAllocator *allocator);
+
+void pairing_heap_destroy(PairingHeap *heap);
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+/**
+ * @brief Insere uma cópia de data
+ *
+ * Complexidade: O(1)
+ */
+DataStructureError pairing_heap_insert(PairingHeap *heap, const void *data);
+
+/**
+ * @brief Remove o elemento de maior prioridade
+ * @param output Buffer para o elemento (NULL para descartar)
+ *
+ * Complexidade: O(log n) amortizado
+ */
+DataStructureError pairing_heap_extract(PairingHeap *heap, void *output);
+
+/**
+ * @brief Copia o elemento de maior prioridade sem remover
+ *
+ * Complexidade: O(1)
+ */
+DataStructureError pairing_heap_peek(const PairingHeap *heap, void *output);
+
+/**
+ * @brief Move todos os elementos de src para dst
+ *
+ * src fica vazio (e ainda deve ser destruído). Os dois heaps precisam ter
+ * o mesmo element_size, tipo, compare e alocador; caso contrário retorna
+ * DS_ERROR_INVALID_PARAM sem alterar nenhum deles.
+ *
+ * Complexidade: O(1)
+ */
+DataStructureError pairing_heap_meld(PairingHeap *dst, PairingHeap *src);
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+bool pairing_heap_is_empty(const PairingHeap *heap);
+size_t pairing_heap_size(const PairingHeap *heap);
+
+/**
+ * @brief Bytes ocupados: cabeçalho e um nó por elemento (dois ponteiros
+ *        seguidos do elemento, numa única alocação)
+ */
+size_t pairing_heap_memory_usage(const PairingHeap *heap);
+
+/**
+ * @brief Remove (e destrói) todos os elementos
+ *
+ * Complexidade: O(n)
+ */
+void pairing_heap_clear(PairingHeap *heap);
+
+#endif // PAIRING_HEAP_H
@@ -0,0 +1,56 @@
+/**
+ * @file pdqsort.h
+ * @brief Pattern-defeating quicksort genérico (void* + CompareFn)
+ *
+ * Motor de ordenação in-place usado por quick_sort() e arraylist_sort().
+ * Combina:
+ * - pivô por mediana de 3 (ninther de Tukey acima de 128 elementos)
+ * - insertion sort para partições pequenas (< 24 elementos)
+ * - particionamento em blocos sem desvios (BlockQuicksort): os índices
+ *   dos elementos fora do lugar são registrados em buffers de offsets e
+ *   trocados em ciclos, em vez de trocar a cada comparação
+ * - detecção de padrões: entradas já particionadas terminam com insertion
+ *   sort parcial (O(n) para arrays ordenados) e sequências de chaves
+ *   iguais ao pivô são separadas de uma vez (O(n) para muitos repetidos)
+ * - fallback para heapsort após log2(n) partições muito desbalanceadas,
+ *   garantindo O(n log n) no pior caso
+ *
+ * Trocas e cópias de 4, 8 e 16 bytes usam tamanhos fixos (o compilador as
+ * reduz a movimentos de registrador); os demais tamanhos copiam em blocos.
+ *
+ * Referências:
+ * - Peters, O. R. L. (2021). "Pattern-defeating Quicksort". arXiv:2106.05123
+ * - Edelkamp, S. & Weiss, A. (2016). "BlockQuicksort: How Branch
+ *   Mispredictions don't affect Quicksort". ESA 2016
+ * - Musser, D. R. (1997). "Introspective Sorting and Selection Algorithms"
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef PDQSORT_H
+#define PDQSORT_H
+
+#include "common.h"
+#include <stddef.h>
+
+/**
+ * @brief Ordena n elementos de elem_size bytes em ordem crescente de cmp
+ *
+ * @param base Array de elementos
+ * @param n Número de elementos
+ * @param elem_size Tamanho de cada elemento em bytes
+ * @param cmp Função de comparação (negativo, zero, positivo)
+ *
+ * NULL, n <= 1 ou elem_size 0 não fazem nada. Elementos de até 64 bytes
+ * usam buffers na pilha; maiores alocam 2 * elem_size bytes (em falha,
+ * ordena por heapsort, que não precisa de buffer).
+ *
+ * Complexidade: O(n log n) pior caso, O(n) para entradas ordenadas,
+ * invertidas ou com poucas chaves distintas
+ * Espaço: O(log n) pilha
+ * Estável: Não
+ */
+void ds_pdqsort(void *base, size_t n, size_t elem_size, CompareFn cmp);
+
+#endif /* PDQSORT_H */
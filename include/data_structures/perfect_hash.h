@@ -0,0 +1,167 @@
+/**
+ * @file perfect_hash.h
+ * @brief Mapa estático com hash perfeito mínimo (estilo PTHash), serializável
+ *
+ * Para mapas somente leitura construídos uma vez (nome de feature → índice
+ * de coluna, tabelas de símbolos carregadas na inicialização): as n chaves
+ * recebem índices distintos em [0, n), sem slots vazios nem sondagem. Uma
+ * busca calcula um hash, lê um "pilot" do seu bucket e vai direto à única
+ * posição possível, onde confere a chave.
+ *
+ * Construção (PTHash):
+ * - As chaves são divididas em partições independentes de ~2048 chaves,
+ *   construídas em paralelo (tarefas do pool global de thread_pool.h)
+ * - Em cada partição, as chaves caem em buckets de ~4 chaves; do maior
+ *   para o menor bucket, procura-se o menor pilot p tal que
+ *   pos(x, p) = mix(h(x) ^ p) mod m leve todas as chaves do bucket a
+ *   posições ainda livres
+ * - Espaço do hash: 4 bytes de pilot por bucket (~1 byte por chave)
+ *
+ * Chaves são sequências de bytes (key, key_len) e ficam guardadas no mapa,
+ * de modo que chaves ausentes são detectadas. Tudo — pilots, chaves e
+ * valores — vive em um único bloco contíguo sem ponteiros, gravado como
+ * está por phmap_save e mapeado sem cópia por phmap_mmap_open.
+ *
+ * Complexidade:
+ * - Get / Index: O(|key|), um acesso ao pilot e um à posição
+ * - Construção: O(n) esperado
+ *
+ * Referências:
+ * - Pibiri, G. E. & Trani, R. (2021). "PTHash: Revisiting FCH Minimal
+ *   Perfect Hashing". SIGIR '21
+ * - Belazzougui, D., Botelho, F. C. & Dietzfelbinger, M. (2009). "Hash,
+ *   Displace, and Compress". ESA 2009 (CHD)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef PERFECT_HASH_H
+#define PERFECT_HASH_H
+
+#include "common.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Retornado por phmap_index para chaves ausentes */
+#define PHMAP_NOT_FOUND ((size_t)-1)
+
+typedef struct PerfectHashMap PerfectHashMap;
+
+// ============================================================================
+// CONSTRUÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+/**
+ * @brief Constrói o mapa a partir de n chaves distintas
+ *
+ * @param keys keys[i] aponta para key_lengths[i] bytes
+ * @param key_lengths Tamanho de cada chave
+ * @param n Número de chaves (0 gera um mapa vazio)
+ * @param values n valores contíguos de value_size bytes (NULL se value_size == 0)
+ * @param value_size Tamanho de cada valor; 0 para usar só phmap_index
+ * @param num_threads Threads na construção (1 = serial, 0 = todas)
+ * @return PerfectHashMap* Mapa criado, ou NULL (argumento NULL, chaves
+ *         repetidas ou sem memória)
+ *
+ * Chaves e valores são copiados; o índice de cada chave (phmap_index) é
+ * determinado pela construção, não pela ordem de entrada.
+ */
+PerfectHashMap* phmap_build(const void *const *keys, const size_t *key_lengths, size_t n,
+                            const void *values, size_t value_size, size_t num_threads);
+
+/**
+ * @brief phmap_build para strings C (key_len = strlen, sem o '\0')
+ */
+PerfectHashMap* phmap_build_strings(const char *const *keys, size_t n,
+                                    const void *values, size_t value_size,
+                                    size_t num_threads);
+
+/**
+ * @brief Libera o mapa (e desfaz o mapeamento, se aberto por phmap_mmap_open)
+ */
+void phmap_destroy(PerfectHashMap *map);
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+/**
+ * @brief Copia o valor associado à chave
+ *
+ * @param value Buffer de saída (NULL para só testar presença)
+ * @return DS_SUCCESS, DS_ERROR_NOT_FOUND ou DS_ERROR_NULL_POINTER
+ */
+DataStructureError phmap_get(const PerfectHashMap *map, const void *key, size_t key_len,
+                             void *value);
+
+/**
+ * @brief Ponteiro para o valor dentro do mapa, ou NULL se ausente
+ *
+ * O ponteiro fica em key_index * value_size a partir de um início alinhado
+ * a 8 bytes; só é alinhado para o tipo se value_size for múltiplo dele.
+ */
+const void* phmap_get_ptr(const PerfectHashMap *map, const void *key, size_t key_len);
+
+bool phmap_contains(const PerfectHashMap *map, const void *key, size_t key_len);
+
+/**
+ * @brief Índice da chave em [0, n), ou PHMAP_NOT_FOUND
+ *
+ * É a posição do valor e serve diretamente como índice denso (coluna).
+ */
+size_t phmap_index(const PerfectHashMap *map, const void *key, size_t key_len);
+
+/**
+ * @brief Chave armazenada no índice (ponteiro para dentro do mapa)
+ *
+ * @return Ponteiro para os bytes da chave, ou NULL se index >= n
+ */
+const void* phmap_key_at(const PerfectHashMap *map, size_t index, size_t *key_len);
+
+size_t phmap_size(const PerfectHashMap *map);
+size_t phmap_value_size(const PerfectHashMap *map);
+
+/**
+ * @brief Bytes do bloco serializado (pilots + chaves + valores)
+ */
+size_t phmap_memory_usage(const PerfectHashMap *map);
+
+// ============================================================================
+// SERIALIZAÇÃO
+// ============================================================================
+
+/*
+ * Formato binário (versão 1): cabeçalho de 64 bytes com magic "PHMAP001",
+ * versão, marca de ordem de bytes, semente e contagens, seguido das seções
+ * partições, pilots, offsets das chaves, valores e bytes das chaves, cada
+ * uma alinhada a 8 bytes, exatamente como em memória. Arquivos de outra
+ * ordem de bytes são recusados.
+ */
+
+/**
+ * @brief Grava o mapa em path
+ * @return false em argumentos NULL ou erro de escrita (o arquivo é removido)
+ */
+bool phmap_save(const PerfectHashMap *map, const char *path);
+
+/**
+ * @brief Abre um arquivo gravado por phmap_save sem copiar o conteúdo
+ *
+ * Em sistemas POSIX o arquivo é mapeado com mmap (somente leitura); nos
+ * demais, é lido para a memória. Cabeçalho e tabela de partições são
+ * validados; os offsets de chave são conferidos a cada busca.
+ *
+ * @return Mapa (liberar com phmap_destroy) ou NULL
+ */
+PerfectHashMap* phmap_mmap_open(const char *path);
+
+/**
+ * @brief Usa um bloco serializado que já está em memória, sem cópia
+ *
+ * buffer deve estar alinhado a 8 bytes e continuar válido enquanto o mapa
+ * existir.
+ */
+PerfectHashMap* phmap_from_buffer(const void *buffer, size_t size);
+
+#endif // PERFECT_HASH_H
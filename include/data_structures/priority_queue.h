@@ -54,6 +54,15 @@ typedef enum {
 PriorityQueue* pq_create(size_t element_size, size_t initial_capacity,
                          PriorityQueueType type, CompareFn compare, DestroyFn destroy);
 
+/**
+ * @brief Cria uma priority queue com alocador customizado
+ *
+ * O alocador (NULL = libc) é repassado ao heap interno.
+ */
+PriorityQueue* pq_create_with_allocator(size_t element_size, size_t initial_capacity,
+                                        PriorityQueueType type, CompareFn compare,
+                                        DestroyFn destroy, const DSAllocator *allocator);
+
 void pq_destroy(PriorityQueue *pq);
 
 /**
@@ -81,13 +90,14 @@ DataStructureError pq_peek(const PriorityQueue *pq, void *output);
  * @brief Atualiza prioridade de um elemento
  *
  * Complexidade: O(n) para encontrar + O(log n) para atualizar = O(n)
- * Para O(log n), use indexed priority queue
+ * Para O(log n), use ipq_change_key (indexed_priority_queue.h)
  */
 DataStructureError pq_update_priority(PriorityQueue *pq, const void *old_data,
                                       const void *new_data);
 
 bool pq_is_empty(const PriorityQueue *pq);
 size_t pq_size(const PriorityQueue *pq);
+size_t pq_memory_usage(const PriorityQueue *pq);
 void pq_clear(PriorityQueue *pq);
 
 #endif // PRIORITY_QUEUE_H
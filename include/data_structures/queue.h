@@ -74,6 +74,22 @@ typedef enum {
  */
 Queue* queue_create(size_t element_size, QueueType type, size_t initial_capacity, DestroyFn destroy);
 
+/**
+ * @brief Cria uma fila cujas alocações internas usam um alocador customizado
+ *
+ * @param element_size Tamanho de cada elemento em bytes
+ * @param type Tipo de implementação (QUEUE_ARRAY ou QUEUE_LINKED)
+ * @param initial_capacity Capacidade inicial (apenas para QUEUE_ARRAY)
+ * @param destroy Função de destruição customizada (NULL se não necessário)
+ * @param allocator Alocador do cabeçalho, do buffer e dos nós (NULL = libc)
+ * @return Queue* Ponteiro para a fila criada, ou NULL em caso de erro
+ *
+ * Complexidade: O(1) para LINKED, O(capacity) para ARRAY
+ */
+Queue* queue_create_with_allocator(size_t element_size, QueueType type,
+                                   size_t initial_capacity, DestroyFn destroy,
+                                   const DSAllocator *allocator);
+
 /**
  * @brief Destrói a fila e libera toda a memória associada
  *
@@ -140,6 +156,42 @@ DataStructureError queue_dequeue(Queue *queue, void *output);
  */
 DataStructureError queue_front(const Queue *queue, void *output);
 
+/**
+ * @brief Insere count elementos contíguos de data, em ordem (tudo ou nada)
+ *
+ * QUEUE_ARRAY cresce uma vez até caber o lote e copia com no máximo dois
+ * memcpy (o trecho pode dar a volta no circular buffer). QUEUE_LINKED
+ * aloca um nó por elemento e só liga a cadeia à fila se todos couberem.
+ *
+ * @return DataStructureError DS_SUCCESS, DS_ERROR_NULL_POINTER ou
+ *         DS_ERROR_OUT_OF_MEMORY (fila inalterada)
+ *
+ * Complexidade: O(count) amortizado
+ */
+DataStructureError queue_enqueue_n(Queue *queue, const void *data, size_t count);
+
+/**
+ * @brief Remove até max elementos do início para output, em ordem FIFO
+ *
+ * Como em queue_dequeue, output NULL descarta os elementos chamando
+ * destroy. Em QUEUE_ARRAY a cópia usa no máximo dois memcpy.
+ *
+ * @return size_t Número de elementos removidos
+ *
+ * Complexidade: O(n) com n = elementos removidos
+ */
+size_t queue_dequeue_n(Queue *queue, void *output, size_t max);
+
+/**
+ * @brief Ponteiro para o elemento do início, sem cópia
+ *
+ * @return Ponteiro para dentro da fila (NULL se vazia), válido até a
+ *         próxima operação que insira ou remova elementos
+ *
+ * Complexidade: O(1)
+ */
+const void* queue_front_ptr(const Queue *queue);
+
 // ============================================================================
 // CONSULTAS E UTILITÁRIOS
 // ============================================================================
@@ -174,6 +226,17 @@ size_t queue_size(const Queue *queue);
  */
 size_t queue_capacity(const Queue *queue);
 
+/**
+ * @brief Retorna os bytes ocupados pela fila
+ *
+ * @param queue Ponteiro para a fila
+ * @return size_t Cabeçalho mais o buffer inteiro (QUEUE_ARRAY) ou um nó e
+ *         um elemento por item (QUEUE_LINKED)
+ *
+ * Complexidade: O(1)
+ */
+size_t queue_memory_usage(const Queue *queue);
+
 /**
  * @brief Remove todos os elementos da fila
  *
@@ -225,4 +288,145 @@ Queue* queue_clone(const Queue *queue, CopyFn copy);
  */
 DataStructureError queue_to_array(const Queue *queue, void **array, size_t *size);
 
+// ============================================================================
+// FILAS CONCORRENTES (RING BUFFERS SEM LOCK)
+// ============================================================================
+
+/*
+ * Filas limitadas para passar elementos de tamanho fixo entre threads, sem
+ * mutex. A capacidade é arredondada para potência de 2 e o buffer é
+ * alocado uma única vez; enqueue em fila cheia e dequeue em fila vazia
+ * retornam DS_ERROR_FULL / DS_ERROR_EMPTY imediatamente (sem espera).
+ *
+ * Os índices de produtor e consumidor ficam em linhas de cache separadas
+ * (QUEUE_CACHE_LINE) para que uma thread não invalide a linha da outra.
+ * As versões em lote publicam vários elementos com uma única operação
+ * atômica.
+ *
+ * Referências:
+ * - Lamport, L. (1983). "Specifying Concurrent Program Modules". ACM TOPLAS 5(2)
+ * - Vyukov, D. (2010). "Bounded MPMC queue". 1024cores.net
+ */
+
+/** Tamanho de linha de cache usado para separar os índices */
+#define QUEUE_CACHE_LINE 64
+
+/**
+ * @brief Fila de um produtor e um consumidor (SPSC)
+ *
+ * Seguro com exatamente uma thread chamando enqueue e uma chamando dequeue
+ * ao mesmo tempo. Cada lado guarda uma cópia local do índice do outro e só
+ * relê o índice atômico quando a cópia indica fila cheia/vazia.
+ */
+typedef struct SPSCQueue SPSCQueue;
+
+/**
+ * @brief Fila de vários produtores e vários consumidores (MPMC)
+ *
+ * Cada posição tem um número de sequência que diz se está livre ou
+ * ocupada nesta volta do anel; produtores e consumidores reservam posições
+ * com CAS no seu índice e nunca esperam uns pelos outros (Vyukov).
+ */
+typedef struct MPMCQueue MPMCQueue;
+
+/**
+ * @brief Cria fila SPSC com pelo menos capacity posições
+ *
+ * @return SPSCQueue* Fila criada ou NULL (element_size ou capacity zero, ou sem memória)
+ */
+SPSCQueue* spsc_queue_create(size_t element_size, size_t capacity);
+void spsc_queue_destroy(SPSCQueue *queue);
+
+/**
+ * @brief Insere uma cópia de data (só a thread produtora)
+ *
+ * @return DS_SUCCESS, DS_ERROR_FULL ou DS_ERROR_NULL_POINTER
+ */
+DataStructureError spsc_queue_enqueue(SPSCQueue *queue, const void *data);
+
+/**
+ * @brief Remove o elemento mais antigo para output (só a thread consumidora)
+ *
+ * @return DS_SUCCESS, DS_ERROR_EMPTY ou DS_ERROR_NULL_POINTER
+ */
+DataStructureError spsc_queue_dequeue(SPSCQueue *queue, void *output);
+
+/**
+ * @brief Insere até count elementos contíguos de data
+ *
+ * @return size_t Quantos couberam (os primeiros de data), publicados juntos
+ */
+size_t spsc_queue_enqueue_batch(SPSCQueue *queue, const void *data, size_t count);
+
+/**
+ * @brief Remove até max elementos para output, em ordem
+ *
+ * @return size_t Quantos foram removidos
+ */
+size_t spsc_queue_dequeue_batch(SPSCQueue *queue, void *output, size_t max);
+
+/**
+ * @brief Número de elementos (instantâneo; pode mudar logo em seguida)
+ */
+size_t spsc_queue_size(const SPSCQueue *queue);
+size_t spsc_queue_capacity(const SPSCQueue *queue);
+
+/**
+ * @brief Bytes ocupados (cabeçalho alinhado e anel)
+ */
+size_t spsc_queue_memory_usage(const SPSCQueue *queue);
+
+/**
+ * @brief Cria fila MPMC com pelo menos capacity posições (mínimo 2)
+ *
+ * @return MPMCQueue* Fila criada ou NULL (element_size ou capacity zero, ou sem memória)
+ */
+MPMCQueue* mpmc_queue_create(size_t element_size, size_t capacity);
+void mpmc_queue_destroy(MPMCQueue *queue);
+
+/**
+ * @brief Insere uma cópia de data (qualquer thread)
+ *
+ * @return DS_SUCCESS, DS_ERROR_FULL ou DS_ERROR_NULL_POINTER
+ */
+DataStructureError mpmc_queue_enqueue(MPMCQueue *queue, const void *data);
+
+/**
+ * @brief Remove um elemento para output (qualquer thread)
+ *
+ * A ordem é FIFO em relação às reservas de posição: elementos de um mesmo
+ * produtor saem na ordem em que ele os inseriu.
+ *
+ * @return DS_SUCCESS, DS_ERROR_EMPTY ou DS_ERROR_NULL_POINTER
+ */
+DataStructureError mpmc_queue_dequeue(MPMCQueue *queue, void *output);
+
+/**
+ * @brief Insere até count elementos de data reservando-os com um único CAS
+ *
+ * As posições reservadas são consecutivas no anel, então os elementos do
+ * lote saem juntos e em ordem.
+ *
+ * @return size_t Quantos foram inseridos (os primeiros de data)
+ */
+size_t mpmc_queue_enqueue_batch(MPMCQueue *queue, const void *data, size_t count);
+
+/**
+ * @brief Remove até max elementos consecutivos com um único CAS
+ *
+ * @return size_t Quantos foram removidos
+ */
+size_t mpmc_queue_dequeue_batch(MPMCQueue *queue, void *output, size_t max);
+
+/**
+ * @brief Número aproximado de elementos (inclui inserções em andamento)
+ */
+size_t mpmc_queue_size(const MPMCQueue *queue);
+size_t mpmc_queue_capacity(const MPMCQueue *queue);
+
+/**
+ * @brief Bytes ocupados (cabeçalho alinhado e células com sequência)
+ */
+size_t mpmc_queue_memory_usage(const MPMCQueue *queue);
+
 #endif // QUEUE_H
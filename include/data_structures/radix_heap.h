@@ -0,0 +1,105 @@
+/**
+ * @file radix_heap.h
+ * @brief Radix heap: fila de prioridade mínima para chaves inteiras monótonas
+ *
+ * Válida quando nenhuma chave inserida é menor que a última chave extraída —
+ * o caso de Dijkstra com pesos inteiros não negativos e de simulações de
+ * eventos em tempo discreto. Cada elemento é um par {chave uint64_t, valor
+ * size_t} (o valor costuma ser o id do vértice).
+ *
+ * Os elementos ficam em 65 baldes: o balde 0 guarda as chaves iguais a
+ * last (a última mínima extraída) e o balde b > 0 as chaves cujo bit mais
+ * alto diferente de last é o bit b - 1. Ao esvaziar o balde 0, o primeiro
+ * balde não vazio é redistribuído em relação ao seu mínimo; cada elemento
+ * só desce de balde, no máximo 64 vezes ao todo.
+ *
+ * Complexidade:
+ * - Push: O(1)
+ * - Pop: O(log C) amortizado (C = maior diferença entre chaves)
+ * - Peek: O(tamanho do primeiro balde não vazio)
+ *
+ * Não há decrease-key: em Dijkstra insere-se de novo o vértice com a chave
+ * menor e descartam-se as entradas obsoletas na extração (lazy deletion).
+ *
+ * Referências:
+ * - Ahuja, R. K. et al. (1990). "Faster Algorithms for the Shortest Path
+ *   Problem". Journal of the ACM 37(2)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef RADIX_HEAP_H
+#define RADIX_HEAP_H
+
+#include "common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct RadixHeap RadixHeap;
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+RadixHeap* radix_heap_create(void);
+
+/**
+ * @brief Cria um radix heap com alocador customizado (NULL = libc)
+ */
+RadixHeap* radix_heap_create_with_allocator(const DSAllocator *allocator);
+
+void radix_heap_destroy(RadixHeap *heap);
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+/**
+ * @brief Insere o par {key, value}
+ * @return DS_ERROR_INVALID_PARAM se key < radix_heap_last(heap)
+ *
+ * Complexidade: O(1) amortizado
+ */
+DataStructureError radix_heap_push(RadixHeap *heap, uint64_t key, size_t value);
+
+/**
+ * @brief Remove o par de menor chave (empates em ordem arbitrária)
+ * @param key Recebe a chave (pode ser NULL)
+ * @param value Recebe o valor (pode ser NULL)
+ *
+ * Complexidade: O(log C) amortizado
+ */
+DataStructureError radix_heap_pop(RadixHeap *heap, uint64_t *key, size_t *value);
+
+/**
+ * @brief Consulta o par de menor chave sem removê-lo
+ */
+DataStructureError radix_heap_peek(const RadixHeap *heap, uint64_t *key, size_t *value);
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+/**
+ * @brief Última chave mínima extraída (0 se nada foi extraído): limite
+ *        inferior para as próximas inserções
+ */
+uint64_t radix_heap_last(const RadixHeap *heap);
+
+bool radix_heap_is_empty(const RadixHeap *heap);
+size_t radix_heap_size(const RadixHeap *heap);
+
+/**
+ * @brief Bytes ocupados: cabeçalho e a capacidade de todos os baldes
+ *        (que clear mantém)
+ */
+size_t radix_heap_memory_usage(const RadixHeap *heap);
+
+/**
+ * @brief Remove todos os elementos e volta last para 0 (mantém a memória)
+ */
+void radix_heap_clear(RadixHeap *heap);
+
+#endif // RADIX_HEAP_H
@@ -0,0 +1,151 @@
+/**
+ * @file radix_trie.h
+ * @brief Trie compactada (radix / Patricia) com nós adaptativos (ART)
+ *
+ * Alternativa ao Trie (trie.h) para dicionários grandes: o Trie aloca um
+ * array de alphabet_size ponteiros por caractere (2 KB por nó com 256),
+ * enquanto aqui:
+ *
+ * - Caminhos sem ramificação são comprimidos: cada nó interno guarda o
+ *   prefixo comum a todas as chaves abaixo dele (até RADIX_MAX_PREFIX bytes
+ *   explícitos; o resto é conferido na folha, de forma otimista)
+ * - O nó interno cresce e encolhe com o número de filhos: Node4, Node16
+ *   (busca por SIMD, 16 bytes de chave comparados de uma vez), Node48
+ *   (índice de 256 bytes para 48 ponteiros) e Node256 (acesso direto)
+ * - Cada chave vive em uma única folha com a string completa
+ *
+ * Chaves são strings C arbitrárias (qualquer byte exceto '\0'), sem o
+ * limite de alfabeto do Trie; a ordem das travessias é a de strcmp.
+ *
+ * Complexidade (m = tamanho da string):
+ * - Insert / Search / Remove / Starts with: O(m)
+ * - Autocomplete: O(m + k) onde k é o tamanho total dos resultados
+ * - Espaço: O(n) nós internos (no máximo n - 1) mais as n folhas
+ *
+ * Referências:
+ * - Morrison, D. R. (1968). "PATRICIA - Practical Algorithm To Retrieve
+ *   Information Coded in Alphanumeric". J. ACM 15(4)
+ * - Leis, V., Kemper, A. & Neumann, T. (2013). "The Adaptive Radix Tree:
+ *   ARTful Indexing for Main-Memory Databases". ICDE
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef RADIX_TRIE_H
+#define RADIX_TRIE_H
+
+#include "common.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Bytes de prefixo comprimido guardados no nó (o cabeçalho fica com 16 bytes) */
+#define RADIX_MAX_PREFIX 8
+
+typedef struct RadixTrie RadixTrie;
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+/**
+ * @brief Cria uma trie compactada vazia
+ */
+RadixTrie* radix_trie_create(void);
+
+/**
+ * @brief Cria uma trie compactada com nós e folhas de um alocador customizado
+ *
+ * @param allocator Alocador (NULL = malloc/free)
+ */
+RadixTrie* radix_trie_create_with_allocator(const DSAllocator *allocator);
+void radix_trie_destroy(RadixTrie *trie);
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+/**
+ * @brief Insere uma string (sem efeito se já existir)
+ *
+ * Um byte novo em um nó cheio troca o nó pelo tipo seguinte; uma
+ * divergência no meio de um prefixo comprimido cria um Node4 ali.
+ *
+ * Complexidade: O(m)
+ */
+DataStructureError radix_trie_insert(RadixTrie *trie, const char *str);
+
+/**
+ * @brief Busca uma string
+ *
+ * Complexidade: O(m)
+ */
+bool radix_trie_search(const RadixTrie *trie, const char *str);
+
+/**
+ * @brief Verifica se existe alguma string com o prefixo dado
+ *
+ * Complexidade: O(m) onde m = |prefix|
+ */
+bool radix_trie_starts_with(const RadixTrie *trie, const char *prefix);
+
+/**
+ * @brief Remove uma string
+ *
+ * Nós que ficam com poucos filhos voltam ao tipo menor; um Node4 com um só
+ * filho é fundido a ele (o prefixo dos dois é concatenado).
+ *
+ * Complexidade: O(m)
+ */
+DataStructureError radix_trie_remove(RadixTrie *trie, const char *str);
+
+// ============================================================================
+// AUTOCOMPLETE E PREFIXOS
+// ============================================================================
+
+/**
+ * @brief Todas as strings com o prefixo dado, em ordem (autocomplete)
+ *
+ * @param results Array de strings alocado com malloc (cada string e o
+ *        array são liberados com free); NULL se não houver resultados
+ *
+ * Complexidade: O(p + k)
+ */
+DataStructureError radix_trie_autocomplete(const RadixTrie *trie, const char *prefix,
+                                           char ***results, size_t *count);
+
+/**
+ * @brief Maior prefixo comum a todas as strings (liberar com free)
+ *
+ * É o prefixo comum entre a menor e a maior string. Trie vazia: "".
+ */
+char* radix_trie_longest_common_prefix(const RadixTrie *trie);
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+size_t radix_trie_size(const RadixTrie *trie);
+bool radix_trie_is_empty(const RadixTrie *trie);
+
+/**
+ * @brief Bytes alocados para nós internos e folhas
+ */
+size_t radix_trie_memory_usage(const RadixTrie *trie);
+
+/**
+ * @brief Remove todas as strings
+ */
+void radix_trie_clear(RadixTrie *trie);
+
+/**
+ * @brief Converte para array de strings em ordem lexicográfica (strcmp)
+ */
+DataStructureError radix_trie_to_array(const RadixTrie *trie, char ***strings, size_t *count);
+
+/**
+ * @brief Imprime todas as strings
+ */
+void radix_trie_print(const RadixTrie *trie);
+
+#endif // RADIX_TRIE_H
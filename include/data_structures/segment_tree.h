@@ -0,0 +1,120 @@
+/**
+ * @file segment_tree.h
+ * @brief Segment tree iterativa com propagação preguiçosa (range add)
+ *
+ * Mantém um vetor de n inteiros de 64 bits e responde soma, mínimo e
+ * máximo de qualquer intervalo, com soma de uma constante a qualquer
+ * intervalo, tudo em O(log n).
+ *
+ * Implementação bottom-up, sem recursão: as folhas ficam nas posições
+ * [N, 2N) de um array plano (N = n arredondado para potência de 2) e o
+ * nó p tem filhos 2p e 2p + 1. Cada nó guarda (soma, mín, máx) do seu
+ * segmento; os nós internos guardam também o add pendente para os filhos,
+ * empurrado para baixo só no caminho de uma consulta.
+ *
+ * Complexidade:
+ * - Criação a partir de um array: O(n)
+ * - Range add / Range query / Set: O(log n)
+ * - Espaço: ~2N * 24 bytes de nós + N * 8 de adds pendentes
+ *
+ * Somas são aritmética inteira de 64 bits; estouro é responsabilidade de
+ * quem chama.
+ *
+ * Referências:
+ * - Al.Cash (2015). "Efficient and easy segment trees", Codeforces blog
+ * - de Berg, M. et al. (2008). "Computational Geometry" (3rd ed.), Seção 10.3
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef SEGMENT_TREE_H
+#define SEGMENT_TREE_H
+
+#include "common.h"
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct SegmentTree SegmentTree;
+
+/**
+ * @brief Agregados de um intervalo
+ */
+typedef struct {
+    int64_t sum;
+    int64_t min;
+    int64_t max;
+} RangeAggregate;
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+/**
+ * @brief Cria uma segment tree com n elementos
+ *
+ * @param values n valores iniciais, ou NULL para começar com zeros
+ * @param n Número de elementos (> 0)
+ * @return SegmentTree* Árvore criada ou NULL
+ *
+ * Complexidade: O(n)
+ */
+SegmentTree* segment_tree_create(const int64_t *values, size_t n);
+
+/**
+ * @brief Cria uma segment tree com alocador customizado (NULL = libc)
+ */
+SegmentTree* segment_tree_create_with_allocator(const int64_t *values, size_t n,
+                                                const DSAllocator *allocator);
+
+void segment_tree_destroy(SegmentTree *tree);
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+/**
+ * @brief Soma delta a todos os elementos em [lo, hi)
+ *
+ * @return DS_SUCCESS (lo == hi não faz nada), DS_ERROR_NULL_POINTER ou
+ *         DS_ERROR_INVALID_INDEX (lo > hi ou hi > n)
+ */
+DataStructureError segment_tree_range_add(SegmentTree *tree, size_t lo, size_t hi,
+                                          int64_t delta);
+
+/**
+ * @brief Substitui o elemento index por value
+ *
+ * @return DS_SUCCESS, DS_ERROR_NULL_POINTER ou DS_ERROR_INVALID_INDEX
+ */
+DataStructureError segment_tree_set(SegmentTree *tree, size_t index, int64_t value);
+
+/**
+ * @brief Soma, mínimo e máximo de [lo, hi)
+ *
+ * Empurra os adds pendentes no caminho das duas bordas, por isso recebe a
+ * árvore como não-const (o conteúdo lógico não muda).
+ *
+ * @param out Agregados do intervalo
+ * @return DS_SUCCESS, DS_ERROR_NULL_POINTER ou DS_ERROR_INVALID_INDEX
+ *         (intervalo vazio, lo >= hi ou hi > n)
+ */
+DataStructureError segment_tree_query(SegmentTree *tree, size_t lo, size_t hi,
+                                      RangeAggregate *out);
+
+/**
+ * @brief Valor atual do elemento index
+ *
+ * @return DS_SUCCESS, DS_ERROR_NULL_POINTER ou DS_ERROR_INVALID_INDEX
+ */
+DataStructureError segment_tree_get(SegmentTree *tree, size_t index, int64_t *value);
+
+size_t segment_tree_size(const SegmentTree *tree);
+
+/**
+ * @brief Bytes ocupados: 2N agregados e N adds pendentes (N = potência de
+ *        2 >= n) mais o cabeçalho
+ */
+size_t segment_tree_memory_usage(const SegmentTree *tree);
+
+#endif // SEGMENT_TREE_H
@@ -75,6 +75,22 @@ typedef enum {
  */
 Stack* stack_create(size_t element_size, StackType type, size_t initial_capacity, DestroyFn destroy);
 
+/**
+ * @brief Cria uma pilha cujas alocações internas usam um alocador customizado
+ *
+ * @param element_size Tamanho de cada elemento em bytes
+ * @param type Tipo de implementação (STACK_ARRAY ou STACK_LINKED)
+ * @param initial_capacity Capacidade inicial (apenas para STACK_ARRAY)
+ * @param destroy Função de destruição customizada (NULL se não necessário)
+ * @param allocator Alocador do cabeçalho, do buffer e dos nós (NULL = libc)
+ * @return Stack* Ponteiro para a pilha criada, ou NULL em caso de erro
+ *
+ * Complexidade: O(1) para LINKED, O(capacity) para ARRAY
+ */
+Stack* stack_create_with_allocator(size_t element_size, StackType type,
+                                   size_t initial_capacity, DestroyFn destroy,
+                                   const DSAllocator *allocator);
+
 /**
  * @brief Destrói a pilha e libera toda a memória associada
  *
@@ -138,6 +154,43 @@ DataStructureError stack_pop(Stack *stack, void *output);
  */
 DataStructureError stack_top(const Stack *stack, void *output);
 
+/**
+ * @brief Empilha count elementos contíguos de data, em ordem (tudo ou nada)
+ *
+ * data[count - 1] fica no topo, como em count chamadas a stack_push.
+ * STACK_ARRAY cresce uma vez até caber o lote e copia com um único memcpy.
+ *
+ * @return DataStructureError DS_SUCCESS, DS_ERROR_NULL_POINTER ou
+ *         DS_ERROR_OUT_OF_MEMORY (pilha inalterada)
+ *
+ * Complexidade: O(count) amortizado
+ */
+DataStructureError stack_push_n(Stack *stack, const void *data, size_t count);
+
+/**
+ * @brief Desempilha até max elementos para output
+ *
+ * output recebe os elementos na ordem em que foram empilhados (o antigo
+ * topo por último), de modo que stack_pop_n desfaz exatamente um
+ * stack_push_n. Como em stack_pop, destroy é chamado em cada elemento
+ * removido e output pode ser NULL.
+ *
+ * @return size_t Número de elementos removidos
+ *
+ * Complexidade: O(n) com n = elementos removidos
+ */
+size_t stack_pop_n(Stack *stack, void *output, size_t max);
+
+/**
+ * @brief Ponteiro para o elemento do topo, sem cópia
+ *
+ * @return Ponteiro para dentro da pilha (NULL se vazia), válido até a
+ *         próxima operação que empilhe ou desempilhe
+ *
+ * Complexidade: O(1)
+ */
+const void* stack_top_ptr(const Stack *stack);
+
 // ============================================================================
 // CONSULTAS E UTILITÁRIOS
 // ============================================================================
@@ -178,6 +231,17 @@ size_t stack_size(const Stack *stack);
  */
 size_t stack_capacity(const Stack *stack);
 
+/**
+ * @brief Retorna os bytes ocupados pela pilha
+ *
+ * @param stack Ponteiro para a pilha
+ * @return size_t Cabeçalho mais o buffer inteiro (STACK_ARRAY) ou um nó e
+ *         um elemento por item (STACK_LINKED)
+ *
+ * Complexidade: O(1)
+ */
+size_t stack_memory_usage(const Stack *stack);
+
 /**
  * @brief Remove todos os elementos da pilha
  *
@@ -0,0 +1,141 @@
+/**
+ * @file static_bst.h
+ * @brief Árvore de busca estática e implícita (Eytzinger ou van Emde Boas)
+ *
+ * Companheira somente-leitura da BST (bst.h): construída uma vez a partir de
+ * um array ordenado, sem ponteiros nem nós alocados individualmente. A
+ * posição dos filhos é implícita no índice, e o layout decide quais nós
+ * dividem a mesma linha de cache:
+ *
+ * - Eytzinger (ordem BFS): nó k tem filhos 2k e 2k+1; os primeiros níveis
+ *   ficam juntos e a busca pré-carrega os 16 descendentes 4 níveis abaixo
+ * - van Emde Boas: a árvore é cortada ao meio na altura, a metade de cima é
+ *   gravada primeiro e cada subárvore de baixo em seguida, recursivamente.
+ *   Em qualquer escala de bloco B, uma busca toca O(log_B n) blocos sem
+ *   conhecer B (cache-oblivious)
+ *
+ * Complexidade:
+ * - Construção: O(n)
+ * - Busca / lower bound: O(log n) comparações
+ * - Espaço: n elementos (Eytzinger); até 2n posições (van Emde Boas, que
+ *   usa a árvore perfeita de altura ceil(log2(n + 1)))
+ *
+ * Referências Acadêmicas:
+ * - Prokop, H. (1999). "Cache-Oblivious Algorithms". MIT MSc thesis
+ * - Brodal, G. S., Fagerberg, R. & Jacob, R. (2002). "Cache Oblivious
+ *   Search Trees via Binary Trees of Small Height". SODA
+ * - Khuong, P.-V. & Morin, P. (2017). "Array Layouts for
+ *   Comparison-Based Searching". ACM JEA 22
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef STATIC_BST_H
+#define STATIC_BST_H
+
+#include "common.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// ============================================================================
+// ESTRUTURAS
+// ============================================================================
+
+/**
+ * @brief Estrutura opaca da árvore estática
+ */
+typedef struct StaticBST StaticBST;
+
+/**
+ * @brief Layout dos nós no array
+ */
+typedef enum {
+    STATIC_BST_EYTZINGER,   /**< Ordem BFS com pré-carregamento de níveis */
+    STATIC_BST_VEB          /**< van Emde Boas recursivo (cache-oblivious) */
+} StaticBSTLayout;
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+/**
+ * @brief Constrói a árvore a partir de um array ordenado (copiado)
+ *
+ * @param sorted Elementos em ordem crescente de compare
+ * @param size Número de elementos
+ * @param element_size Tamanho de cada elemento em bytes
+ * @param compare Função de comparação (OBRIGATÓRIA)
+ * @param layout STATIC_BST_EYTZINGER ou STATIC_BST_VEB
+ * @return StaticBST* Árvore criada, ou NULL (argumento inválido ou sem memória)
+ *
+ * Complexidade: O(n)
+ */
+StaticBST* static_bst_create(const void *sorted, size_t size, size_t element_size,
+                             CompareFn compare, StaticBSTLayout layout);
+
+/**
+ * @brief Destrói a árvore
+ */
+void static_bst_destroy(StaticBST *tree);
+
+// ============================================================================
+// BUSCA
+// ============================================================================
+
+/**
+ * @brief Busca um elemento igual a key (mesma semântica de bst_search)
+ *
+ * @param output Recebe uma cópia do elemento encontrado
+ * @return DS_SUCCESS, DS_ERROR_NOT_FOUND ou DS_ERROR_NULL_POINTER
+ *
+ * Complexidade: O(log n)
+ */
+DataStructureError static_bst_search(const StaticBST *tree, const void *key, void *output);
+
+/**
+ * @brief Verifica se há um elemento igual a key
+ */
+bool static_bst_contains(const StaticBST *tree, const void *key);
+
+/**
+ * @brief Menor elemento >= key
+ *
+ * @param output Recebe uma cópia do elemento
+ * @return DS_SUCCESS, DS_ERROR_NOT_FOUND (todos < key) ou DS_ERROR_NULL_POINTER
+ *
+ * Complexidade: O(log n)
+ */
+DataStructureError static_bst_lower_bound(const StaticBST *tree, const void *key, void *output);
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+/**
+ * @brief Número de elementos
+ */
+size_t static_bst_size(const StaticBST *tree);
+
+/**
+ * @brief Bytes ocupados: cabeçalho e o array do layout (Eytzinger usa a
+ *        posição 0 como sentinela; vEB completa até 2^h - 1 posições)
+ */
+size_t static_bst_memory_usage(const StaticBST *tree);
+
+/**
+ * @brief Layout usado na construção
+ */
+StaticBSTLayout static_bst_layout(const StaticBST *tree);
+
+/**
+ * @brief Array interno na ordem do layout (somente leitura)
+ *
+ * No van Emde Boas as posições da árvore perfeita que não correspondem a
+ * nenhum elemento ficam zeradas.
+ *
+ * @param slots Saída opcional com o número de posições do array
+ */
+const void* static_bst_data(const StaticBST *tree, size_t *slots);
+
+#endif // STATIC_BST_H
@@ -0,0 +1,193 @@
+/**
+ * @file thread_pool.h
+ * @brief Pool global de threads com roubo de tarefas (work stealing)
+ *
+ * Um único pool para a biblioteca inteira: ordenações, grafos e
+ * metaheurísticas que paralelizam por tarefas usam as mesmas threads em
+ * vez de criar as suas, o que evita oversubscription quando um módulo
+ * paralelo chama outro.
+ *
+ * Cada worker tem uma deque de Chase-Lev: o dono empilha e desempilha
+ * pelo fundo (LIFO, sem lock no caso comum) e os outros roubam pelo topo
+ * (FIFO, um CAS). Threads de fora do pool publicam numa fila de injeção.
+ * Quem espera um grupo não bloqueia: executa tarefas pendentes até o
+ * grupo terminar, então fork-join aninhado não esgota o pool.
+ *
+ * O pool é criado no primeiro uso com ds_get_num_threads() - 1 workers (a
+ * thread que espera é a última). Com uma thread, ou se a criação falhar,
+ * tudo roda em série na thread chamadora, com o mesmo resultado.
+ *
+ * Os módulos paralelos da biblioteca rodam todos neste pool: laços por
+ * ds_parallel_for_threads() (limitados ao campo num_threads) e
+ * divisão-e-conquista por ds_task_spawn()/ds_parallel_invoke(). Chamadas
+ * aninhadas viram tarefas do mesmo pool, sem criar threads. Código de fora
+ * que abre regiões `#pragma omp` pode resolver num_threads por
+ * ds_region_threads(), que serializa a região dentro de uma tarefa.
+ *
+ * Exemplo:
+ * @code
+ * static void square(void *ctx, size_t lo, size_t hi) {
+ *     double *v = ctx;
+ *     for (size_t i = lo; i < hi; i++) v[i] *= v[i];
+ * }
+ *
+ * ds_set_num_threads(8);
+ * ds_parallel_for(0, n, 0, square, values);
+ * @endcode
+ *
+ * Referências:
+ * - Chase, D. & Lev, Y. (2005). "Dynamic Circular Work-Stealing Deque".
+ *   SPAA '05
+ * - Lê, N. M., Pop, A., Cohen, A. & Zappa Nardelli, F. (2013). "Correct
+ *   and Efficient Work-Stealing for Weak Memory Models". PPoPP '13
+ * - Blumofe, R. D. & Leiserson, C. E. (1999). "Scheduling Multithreaded
+ *   Computations by Work Stealing". JACM 46(5)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Tarefa: recebe o argumento passado em ds_task_spawn()
+ */
+typedef void (*DSTaskFn)(void *arg);
+
+/**
+ * @brief Corpo de ds_parallel_for: processa os índices [lo, hi)
+ */
+typedef void (*DSRangeFn)(void *ctx, size_t lo, size_t hi);
+
+/**
+ * @brief Conjunto de tarefas esperadas juntas (fork-join)
+ *
+ * Pode viver na pilha de quem cria; inicialize com ds_task_group_init() e
+ * não o descarte antes de ds_task_wait() retornar.
+ */
+typedef struct {
+    atomic_size_t pending;      /**< Tarefas lançadas e ainda não concluídas (interno) */
+} DSTaskGroup;
+
+// ============================================================================
+// CONFIGURAÇÃO
+// ============================================================================
+
+/**
+ * @brief Define o número de threads da biblioteca (0 = núcleos disponíveis)
+ *
+ * Se o pool já existe com outro tamanho, ele é encerrado e recriado no
+ * próximo uso. Não chame com tarefas em andamento.
+ */
+void ds_set_num_threads(size_t num_threads);
+
+/**
+ * @brief Número de threads em vigor (sempre >= 1)
+ */
+size_t ds_get_num_threads(void);
+
+/**
+ * @brief Resolve um campo num_threads de configuração (0 = global)
+ */
+size_t ds_resolve_threads(size_t requested);
+
+/**
+ * @brief Verdadeiro se um campo num_threads pede execução no pool
+ *
+ * Falso com num_threads = 1 ou com um pool de uma thread. Para fork-join
+ * (ds_task_spawn, ds_parallel_invoke), que usa o pool inteiro; laços
+ * limitados a num_threads usam ds_parallel_for_threads().
+ */
+bool ds_parallel_enabled(size_t num_threads);
+
+/**
+ * @brief Verdadeiro se a thread corrente executa uma tarefa do pool
+ *
+ * Vale para os workers e para a thread de fora enquanto está dentro de
+ * ds_parallel_for(), ds_parallel_invoke() ou ds_task_wait().
+ */
+bool ds_in_task(void);
+
+/**
+ * @brief Threads para uma região OpenMP do chamador com campo num_threads requested
+ *
+ * 1 dentro de uma tarefa do pool (ver ds_in_task()); fora dele, o mesmo
+ * que ds_resolve_threads(requested).
+ */
+size_t ds_region_threads(size_t requested);
+
+/**
+ * @brief Índice da thread corrente: 1..workers no pool, 0 fora dele
+ *
+ * Sempre menor que ds_get_num_threads(); serve para indexar buffers de
+ * rascunho por thread dentro de tarefas. Threads de fora do pool
+ * compartilham o índice 0.
+ */
+size_t ds_thread_index(void);
+
+/**
+ * @brief Encerra os workers e libera o pool (recriado no próximo uso)
+ *
+ * Não chame com tarefas em andamento.
+ */
+void ds_thread_pool_shutdown(void);
+
+// ============================================================================
+// FORK-JOIN
+// ============================================================================
+
+/**
+ * @brief Prepara um grupo vazio
+ */
+void ds_task_group_init(DSTaskGroup *group);
+
+/**
+ * @brief Lança fn(arg) no grupo
+ *
+ * Sem pool (uma thread) ou sem memória para a tarefa, executa fn(arg)
+ * na hora. A tarefa pode lançar e esperar tarefas próprias.
+ *
+ * Complexidade: O(1) amortizado
+ */
+void ds_task_spawn(DSTaskGroup *group, DSTaskFn fn, void *arg);
+
+/**
+ * @brief Espera todas as tarefas do grupo, executando tarefas pendentes
+ *        (deste ou de outros grupos) enquanto isso
+ */
+void ds_task_wait(DSTaskGroup *group);
+
+/**
+ * @brief Executa fa(arg_a) e fb(arg_b) em paralelo e espera as duas
+ */
+void ds_parallel_invoke(DSTaskFn fa, void *arg_a, DSTaskFn fb, void *arg_b);
+
+/**
+ * @brief Executa fn sobre [begin, end) em blocos de até grain índices
+ *
+ * O intervalo é dividido ao meio recursivamente, então os roubos pegam
+ * metades grandes e o número de tarefas fica em O(n / grain). grain = 0
+ * escolhe ~8 blocos por thread.
+ *
+ * Complexidade: O(n / grain) tarefas, profundidade O(log(n / grain))
+ */
+void ds_parallel_for(size_t begin, size_t end, size_t grain, DSRangeFn fn, void *ctx);
+
+/**
+ * @brief ds_parallel_for limitado por um campo num_threads de configuração
+ *
+ * num_threads = 1 (ou um pool de uma thread) executa fn(ctx, begin, end)
+ * na thread chamadora. Com 1 < num_threads < ds_get_num_threads() o
+ * grain sobe para pelo menos ceil(n / num_threads), então no máximo
+ * num_threads threads trabalham no intervalo; com o pool inteiro vale o
+ * grain pedido. 0 = ds_get_num_threads().
+ */
+void ds_parallel_for_threads(size_t num_threads, size_t begin, size_t end, size_t grain,
+                             DSRangeFn fn, void *ctx);
+
+#endif // THREAD_POOL_H
@@ -45,6 +45,14 @@ typedef struct Trie Trie;
  * @param alphabet_size Tamanho do alfabeto (256 para ASCII, 26 para [a-z])
  */
 Trie* trie_create(size_t alphabet_size);
+
+/**
+ * @brief Cria um trie com nós obtidos de um alocador customizado
+ *
+ * @param alphabet_size Tamanho do alfabeto (0 = 26)
+ * @param allocator Alocador de nós (NULL = malloc/free)
+ */
+Trie* trie_create_with_allocator(size_t alphabet_size, const DSAllocator *allocator);
 void trie_destroy(Trie *trie);
 
 /**
@@ -119,6 +127,51 @@ DataStructureError trie_remove(Trie *trie, const char *str);
 DataStructureError trie_autocomplete(const Trie *trie, const char *prefix,
                                      char ***results, size_t *count);
 
+// ============================================================================
+// PONTUAÇÕES E AUTOCOMPLETE TOP-K
+// ============================================================================
+
+/**
+ * @brief Insere uma string com pontuação (peso) para trie_autocomplete_topk
+ *
+ * Se a string já existir, a pontuação é substituída. trie_insert() dá
+ * pontuação 0 às strings novas e mantém a das existentes.
+ *
+ * Cada nó guarda a maior pontuação da sua subárvore: aumentar uma
+ * pontuação só atualiza o caminho; diminuí-la (ou remover a string)
+ * recalcula o caminho a partir dos filhos.
+ *
+ * Complexidade: O(m), ou O(m * alphabet_size) se a pontuação diminuir
+ */
+DataStructureError trie_insert_weighted(Trie *trie, const char *str, double score);
+
+/**
+ * @brief Pontuação de uma string
+ *
+ * @return DS_ERROR_NOT_FOUND se a string não estiver no trie
+ */
+DataStructureError trie_get_score(const Trie *trie, const char *str, double *score);
+
+/**
+ * @brief As k strings de maior pontuação com o prefixo dado
+ *
+ * Busca best-first a partir do nó do prefixo: um max-heap guarda nós pela
+ * maior pontuação da subárvore e strings pela própria pontuação. Uma
+ * string sai do heap só quando nada pendente pode superá-la, então apenas
+ * os caminhos até as k respostas são expandidos, independente de quantas
+ * strings começam com o prefixo.
+ *
+ * @param results Array de strings alocado com malloc (cada string e o
+ *        array são liberados com free), da maior para a menor pontuação e,
+ *        em empates, em ordem lexicográfica; NULL se não houver resultados
+ * @param scores Recebe as pontuações correspondentes (k posições), ou NULL
+ *
+ * Complexidade: O(p + L * alphabet_size * log(L * alphabet_size)) onde
+ * L = soma dos tamanhos das k respostas
+ */
+DataStructureError trie_autocomplete_topk(const Trie *trie, const char *prefix, size_t k,
+                                          char ***results, double *scores, size_t *count);
+
 /**
  * @brief Retorna a string com maior prefixo comum
  *
@@ -139,6 +192,15 @@ size_t trie_size(const Trie *trie);
  */
 bool trie_is_empty(const Trie *trie);
 
+/**
+ * @brief Bytes alocados: cabeçalho, nós e arrays de filhos
+ *
+ * Cada nó com filhos paga alphabet_size ponteiros; folhas não têm array.
+ *
+ * Complexidade: O(nós)
+ */
+size_t trie_memory_usage(const Trie *trie);
+
 /**
  * @brief Remove todas as strings
  */
@@ -0,0 +1,188 @@
+/**
+ * @file typed_heap.h
+ * @brief Heaps d-ários especializados por tipo (gerados por macro)
+ *
+ * Heap (heap.h) guarda elementos de element_size bytes e chama um
+ * CompareFn por comparação. Os macros abaixo geram, para um tipo
+ * concreto, um min-heap d-ário com a comparação inline e elementos
+ * movidos por atribuição nativa:
+ *
+ * - ARITY filhos por nó (4 é um bom padrão: os filhos de um int ou
+ *   double cabem numa mesma linha de cache e a altura cai pela metade)
+ * - inserção com buraco: os pais descem uma vez, sem trocas
+ * - extração bottom-up (Floyd): o buraco da raiz desce pelo menor filho
+ *   até uma folha e só então o último elemento sobe dali
+ *
+ * Uso:
+ * @code
+ * // Num header: tipo e protótipos
+ * TYPED_HEAP_DECLARE(event, Event)
+ *
+ * // Num .c: implementação, com BEFORE(a, b) estrito ("a sai antes de b")
+ * #define EVENT_BEFORE(a, b) ((a).time < (b).time)
+ * TYPED_HEAP_DEFINE(event, Event, 4, EVENT_BEFORE)
+ *
+ * event_heap h;
+ * event_heap_init(&h);
+ * event_heap_push(&h, e);
+ * event_heap_pop(&h, &e);
+ * event_heap_destroy(&h);
+ * @endcode
+ *
+ * int_min_heap e double_min_heap já vêm instanciados (aridade
+ * TYPED_HEAP_DEFAULT_ARITY); para um max-heap basta BEFORE(a, b) = a > b.
+ * O buffer usa malloc/realloc/free.
+ *
+ * Referências:
+ * - Johnson, D. B. (1975). "Priority queues with update and finding
+ *   minimum spanning trees". Information Processing Letters 4(3)
+ * - Knuth, D. E. (1998). "The Art of Computer Programming, Vol 3",
+ *   Section 5.2.3, exercício 18 (remoção bottom-up de Floyd)
+ * - LaMarca, A. & Ladner, R. E. (1996). "The Influence of Caches on the
+ *   Performance of Heaps". ACM Journal of Experimental Algorithmics 1
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#ifndef TYPED_HEAP_H
+#define TYPED_HEAP_H
+
+#include "common.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+/** Aridade de int_min_heap e double_min_heap */
+#define TYPED_HEAP_DEFAULT_ARITY 4
+
+/** Ordem de min-heap padrão */
+#define TYPED_HEAP_LESS(a, b) ((a) < (b))
+
+/** Capacidade do primeiro buffer alocado */
+#define TYPED_HEAP_MIN_CAPACITY 16
+
+/**
+ * @brief Tipo <name>_heap e protótipos das funções <name>_heap_*
+ *
+ * - init: heap vazio, sem alocação
+ * - destroy: libera o buffer (o heap volta a vazio e pode ser reusado)
+ * - reserve: garante capacidade para capacity elementos
+ * - push / pop / peek: DS_ERROR_OUT_OF_MEMORY, DS_ERROR_EMPTY ou
+ *   DS_ERROR_NULL_POINTER; pop aceita output NULL para descartar
+ */
+#define TYPED_HEAP_DECLARE(name, T)                                             \
+    typedef struct {                                                            \
+        T *data;                                                                \
+        size_t size;                                                            \
+        size_t capacity;                                                        \
+    } name##_heap;                                                              \
+                                                                                \
+    void name##_heap_init(name##_heap *h);                                      \
+    void name##_heap_destroy(name##_heap *h);                                   \
+    DataStructureError name##_heap_reserve(name##_heap *h, size_t capacity);    \
+    DataStructureError name##_heap_push(name##_heap *h, T value);               \
+    DataStructureError name##_heap_pop(name##_heap *h, T *output);              \
+    DataStructureError name##_heap_peek(const name##_heap *h, T *output);       \
+    size_t name##_heap_size(const name##_heap *h);
+
+/**
+ * @brief Implementa <name>_heap_* (requer TYPED_HEAP_DECLARE(name, T) antes)
+ *
+ * Complexidade: push O(log_d n); pop O(d log_d n); peek O(1)
+ */
+#define TYPED_HEAP_DEFINE(name, T, ARITY, BEFORE)                               \
+    void name##_heap_init(name##_heap *h) {                                     \
+        h->data = NULL;                                                         \
+        h->size = 0;                                                            \
+        h->capacity = 0;                                                        \
+    }                                                                           \
+                                                                                \
+    void name##_heap_destroy(name##_heap *h) {                                  \
+        if (h == NULL) return;                                                  \
+        free(h->data);                                                          \
+        name##_heap_init(h);                                                    \
+    }                                                                           \
+                                                                                \
+    DataStructureError name##_heap_reserve(name##_heap *h, size_t capacity) {   \
+        if (h == NULL) return DS_ERROR_NULL_POINTER;                            \
+        if (capacity <= h->capacity) return DS_SUCCESS;                         \
+        if (capacity > SIZE_MAX / sizeof(T)) return DS_ERROR_OUT_OF_MEMORY;     \
+        T *data = (T*)realloc(h->data, capacity * sizeof(T));                   \
+        if (data == NULL) return DS_ERROR_OUT_OF_MEMORY;                        \
+        h->data = data;                                                         \
+        h->capacity = capacity;                                                 \
+        return DS_SUCCESS;                                                      \
+    }                                                                           \
+                                                                                \
+    DataStructureError name##_heap_push(name##_heap *h, T value) {              \
+        if (h == NULL) return DS_ERROR_NULL_POINTER;                            \
+        if (h->size == h->capacity) {                                           \
+            size_t grow = h->capacity < TYPED_HEAP_MIN_CAPACITY                 \
+                              ? TYPED_HEAP_MIN_CAPACITY : h->capacity * 2;      \
+            DataStructureError err = name##_heap_reserve(h, grow);              \
+            if (err != DS_SUCCESS) return err;                                  \
+        }                                                                       \
+        /* Buraco sobe: cada pai desce uma vez */                               \
+        size_t i = h->size++;                                                   \
+        while (i > 0) {                                                         \
+            size_t parent = (i - 1) / (ARITY);                                  \
+            if (!BEFORE(value, h->data[parent])) break;                         \
+            h->data[i] = h->data[parent];                                       \
+            i = parent;                                                         \
+        }                                                                       \
+        h->data[i] = value;                                                     \
+        return DS_SUCCESS;                                                      \
+    }                                                                           \
+                                                                                \
+    DataStructureError name##_heap_pop(name##_heap *h, T *output) {             \
+        if (h == NULL) return DS_ERROR_NULL_POINTER;                            \
+        if (h->size == 0) return DS_ERROR_EMPTY;                                \
+        if (output != NULL) *output = h->data[0];                               \
+        T *a = h->data;                                                         \
+        size_t n = --h->size;                                                   \
+        if (n == 0) return DS_SUCCESS;                                          \
+        T last = a[n];                                                          \
+        /* Bottom-up: buraco desce pelo melhor filho até uma folha */           \
+        size_t hole = 0;                                                        \
+        for (;;) {                                                              \
+            size_t first = (ARITY) * hole + 1;                                  \
+            if (first >= n) break;                                              \
+            size_t end = (n - first < (ARITY)) ? n : first + (ARITY);           \
+            size_t best = first;                                                \
+            for (size_t c = first + 1; c < end; c++) {                          \
+                if (BEFORE(a[c], a[best])) best = c;                            \
+            }                                                                   \
+            a[hole] = a[best];                                                  \
+            hole = best;                                                        \
+        }                                                                       \
+        /* ...e o último elemento sobe dali (quase sempre poucos níveis) */     \
+        while (hole > 0) {                                                      \
+            size_t parent = (hole - 1) / (ARITY);                               \
+            if (!BEFORE(last, a[parent])) break;                                \
+            a[hole] = a[parent];                                                \
+            hole = parent;                                                      \
+        }                                                                       \
+        a[hole] = last;                                                         \
+        return DS_SUCCESS;                                                      \
+    }                                                                           \
+                                                                                \
+    DataStructureError name##_heap_peek(const name##_heap *h, T *output) {      \
+        if (h == NULL || output == NULL) return DS_ERROR_NULL_POINTER;          \
+        if (h->size == 0) return DS_ERROR_EMPTY;                                \
+        *output = h->data[0];                                                   \
+        return DS_SUCCESS;                                                      \
+    }                                                                           \
+                                                                                \
+    size_t name##_heap_size(const name##_heap *h) {                             \
+        return (h == NULL) ? 0 : h->size;                                       \
+    }
+
+// ============================================================================
+// INSTÂNCIAS PRONTAS (typed_heap.c)
+// ============================================================================
+
+TYPED_HEAP_DECLARE(int_min, int)
+TYPED_HEAP_DECLARE(double_min, double)
+
+#endif // TYPED_HEAP_H
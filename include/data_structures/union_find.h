@@ -45,7 +45,8 @@ typedef struct UnionFind UnionFind;
  * @brief Cria uma estrutura Union-Find com n elementos
  *
  * @param n Número de elementos (0 a n-1)
- * @return UnionFind* Estrutura criada
+ * @return UnionFind* Estrutura criada, ou NULL (n == 0, n > DS_INDEX_MAX
+ *         ou falha de alocação)
  *
  * Inicialmente, cada elemento está em seu próprio conjunto.
  *
@@ -58,6 +59,17 @@ typedef struct UnionFind UnionFind;
  */
 UnionFind* uf_create(size_t n);
 
+/**
+ * @brief Cria Union-Find cujos arrays vêm de um alocador customizado
+ *
+ * @param n Número de elementos (0 a n-1)
+ * @param allocator Alocador (NULL = malloc/free)
+ * @return UnionFind* Estrutura criada
+ *
+ * Complexidade: O(n)
+ */
+UnionFind* uf_create_with_allocator(size_t n, const DSAllocator *allocator);
+
 void uf_destroy(UnionFind *uf);
 
 /**
@@ -133,6 +145,16 @@ bool uf_connected(UnionFind *uf, size_t x, size_t y);
  */
 size_t uf_count(const UnionFind *uf);
 
+/**
+ * @brief Bytes ocupados pela estrutura (cabeçalho e arrays)
+ *
+ * parent e set_size usam ds_index_t e rank um byte por elemento: com
+ * DS_COMPACT_INDEX são 9 bytes por elemento em vez de 17.
+ *
+ * Complexidade: O(1)
+ */
+size_t uf_memory_usage(const UnionFind *uf);
+
 /**
  * @brief Retorna o tamanho do conjunto contendo x
  *
@@ -187,6 +209,87 @@ void uf_reset(UnionFind *uf);
  */
 void uf_print(const UnionFind *uf);
 
+// ============================================================================
+// UNION-FIND CONCORRENTE
+// ============================================================================
+
+/**
+ * Variante lock-free para várias threads chamando union/find ao mesmo tempo
+ * (sem travas). Cada elemento guarda numa única palavra atômica de 64 bits
+ * o pai (58 bits baixos) e o rank (6 bits altos):
+ * - Link: CAS na palavra da raiz de menor (rank, índice); só sucede se ela
+ *   ainda for raiz com o mesmo rank. A ordem (rank, índice) é total e os
+ *   ranks só crescem enquanto o nó é raiz, então dois links simultâneos
+ *   nunca formam ciclo
+ * - Empate de rank: a raiz que recebeu o link tenta subir o rank com um CAS
+ *   (best effort; falhar só deixa a árvore um pouco mais alta)
+ * - Find: path splitting, cada nó do caminho passa a apontar para o avô com
+ *   um CAS; um CAS que falha é ignorado (outra thread já encurtou o caminho)
+ *
+ * Enquanto houver uniões em andamento, find/connected refletem algum estado
+ * linearizável; depois que todas terminam, o resultado é o mesmo do UnionFind
+ * sequencial (mesma partição, não necessariamente os mesmos representantes).
+ *
+ * Referências:
+ * - Anderson, R. J. & Woll, H. (1991). "Wait-free Parallel Algorithms for the
+ *   Union-Find Problem". STOC
+ * - Jayanti, S. V. & Tarjan, R. E. (2016). "A Randomized Concurrent Algorithm
+ *   for Disjoint Set Union". PODC
+ */
+typedef struct ConcurrentUnionFind ConcurrentUnionFind;
+
+/**
+ * @brief Cria union-find concorrente com n elementos (n < 2^58)
+ *
+ * @return ConcurrentUnionFind* Estrutura criada ou NULL (n == 0 ou sem memória)
+ *
+ * Complexidade: O(n)
+ */
+ConcurrentUnionFind* cuf_create(size_t n);
+
+void cuf_destroy(ConcurrentUnionFind *uf);
+
+/**
+ * @brief Representante do conjunto de x (seguro entre threads)
+ *
+ * @return size_t Raiz atual, ou x se inválido
+ *
+ * Complexidade: O(α(n)) amortizado sem contenção
+ */
+size_t cuf_find(ConcurrentUnionFind *uf, size_t x);
+
+/**
+ * @brief Une os conjuntos de x e y (seguro entre threads)
+ *
+ * @return bool true se esta chamada fez a união, false se já estavam juntos
+ *
+ * Entre várias chamadas simultâneas que unem os mesmos dois conjuntos,
+ * exatamente uma retorna true.
+ */
+bool cuf_union(ConcurrentUnionFind *uf, size_t x, size_t y);
+
+/**
+ * @brief Verifica se x e y estão no mesmo conjunto (seguro entre threads)
+ *
+ * Só retorna false se, em algum instante da chamada, ambos eram raízes
+ * distintas de seus conjuntos.
+ */
+bool cuf_connected(ConcurrentUnionFind *uf, size_t x, size_t y);
+
+/**
+ * @brief Número de conjuntos disjuntos
+ *
+ * Complexidade: O(1)
+ */
+size_t cuf_count(const ConcurrentUnionFind *uf);
+
+/**
+ * @brief Bytes ocupados pela estrutura (cabeçalho e array de palavras)
+ *
+ * Complexidade: O(1)
+ */
+size_t cuf_memory_usage(const ConcurrentUnionFind *uf);
+
 // ============================================================================
 // ANÁLISE DE COMPLEXIDADE
 // ============================================================================
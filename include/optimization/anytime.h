@@ -0,0 +1,225 @@
+/**
+ * @file anytime.h
+ * @brief Modo servico: solver em thread de fundo com melhorias em fluxo
+ *
+ * opt_anytime_start() dispara uma execucao qualquer (ga_run, sa_run,
+ * alns_run...) numa thread propria e volta na hora. Enquanto ela roda, o
+ * chamador consulta a melhor solucao ja avaliada (opt_anytime_poll),
+ * espera a proxima melhoria com prazo (opt_anytime_wait) ou recebe cada
+ * melhoria num callback; opt_anytime_stop() encerra a execucao ao fim da
+ * iteracao corrente, sem perder o que ja foi encontrado. Assim uma
+ * interface obtem uma solucao razoavel em poucos milissegundos e solucoes
+ * melhores depois, sem reiniciar com orcamentos maiores.
+ *
+ * O solver acompanha as melhorias envolvendo a funcao objetivo, como o
+ * cache de eval_cache.h: a execucao recebe opt_anytime_objective com o
+ * handle como context, e toda solucao avaliada melhor que a melhor ate ali
+ * e copiada e publicada. A parada usa OptStopCriteria.cancel, que todo
+ * algoritmo com criterios de parada confere ao fim de cada iteracao.
+ *
+ * Uso tipico:
+ * @code
+ * static OptResult solve(OptAnytime *solver, void *user_data) {
+ *     GAConfig cfg = ga_default_config();
+ *     cfg.max_generations = SIZE_MAX;              // ate opt_anytime_stop
+ *     cfg.trace.mode = OPT_TRACE_NONE;             // historico O(1)
+ *     cfg.stop.cancel = opt_anytime_cancel_flag(solver);
+ *     return ga_run(&cfg, n * sizeof(int), n, opt_anytime_objective,
+ *                   tsp_generate_random, ga_crossover_ox, ga_mutation_swap,
+ *                   NULL, solver);
+ * }
+ *
+ * OptAnytimeConfig ac = opt_anytime_default_config(n * sizeof(int),
+ *                                                  tsp_tour_cost, inst);
+ * OptAnytime *solver = opt_anytime_start(&ac, solve, NULL);
+ * OptAnytimeStatus st;
+ * if (opt_anytime_wait(solver, 0, 100.0)) opt_anytime_poll(solver, tour, &st);
+ * ...
+ * opt_anytime_stop(solver);
+ * OptResult r = opt_anytime_join(solver);
+ * opt_anytime_destroy(solver);
+ * @endcode
+ *
+ * Atencao: como no cache de avaliacoes, o context repassado ao algoritmo
+ * e o handle; callbacks que leem o context do problema devem ser
+ * envolvidos pelo usuario, que pode entao publicar as melhorias com
+ * opt_anytime_offer em vez de usar opt_anytime_objective.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#ifndef OPT_ANYTIME_H
+#define OPT_ANYTIME_H
+
+#include "optimization/common.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+// TIPOS
+// ============================================================================
+
+/**
+ * @brief Execucao em fundo (opaco)
+ */
+typedef struct OptAnytime OptAnytime;
+
+/**
+ * @brief Corpo da execucao, chamado na thread de fundo
+ *
+ * Deve usar opt_anytime_objective (context = solver) ou opt_anytime_offer
+ * e opt_anytime_cancel_flag nos criterios de parada.
+ *
+ * @param solver Handle da execucao
+ * @param user_data Repassado de opt_anytime_start
+ * @return OptResult Devolvido por opt_anytime_join
+ */
+typedef OptResult (*OptAnytimeSolveFn)(OptAnytime *solver, void *user_data);
+
+/**
+ * @brief Callback de melhoria
+ *
+ * Chamado na thread que avaliou a solucao, com o lock do handle: as
+ * melhorias chegam em ordem estrita de custo. Deve ser curto e nao chamar
+ * opt_anytime_*.
+ *
+ * @param solution Copia da nova melhor solucao (valida so durante a chamada)
+ * @param cost Custo da solucao
+ * @param evaluations Avaliacoes feitas ate ela
+ * @param elapsed_ms Tempo desde opt_anytime_start
+ * @param user_data Repassado de OptAnytimeConfig
+ */
+typedef void (*OptImprovementFn)(const void *solution, double cost, size_t evaluations,
+                                 double elapsed_ms, void *user_data);
+
+/**
+ * @brief Configuracao do modo servico
+ */
+typedef struct {
+    size_t data_size;            /**< Bytes de uma solucao (copiados a cada melhoria) */
+    ObjectiveFn objective;       /**< Funcao objetivo real (envolvida por opt_anytime_objective) */
+    const void *context;         /**< Contexto de objective */
+    OptDirection direction;      /**< Minimizar ou maximizar */
+    OptImprovementFn on_improvement; /**< Callback por melhoria (NULL = so poll/wait) */
+    void *user_data;             /**< Repassado a on_improvement */
+} OptAnytimeConfig;
+
+/**
+ * @brief Fotografia do estado publicado
+ */
+typedef struct {
+    uint64_t version;            /**< Melhorias publicadas (0 = nenhuma solucao ainda) */
+    double cost;                 /**< Custo da melhor solucao */
+    size_t evaluations;          /**< Avaliacoes ate agora */
+    double best_elapsed_ms;      /**< Instante da melhor solucao desde o inicio */
+    bool finished;               /**< A execucao terminou (join nao bloqueia) */
+} OptAnytimeStatus;
+
+// ============================================================================
+// CONFIGURACAO
+// ============================================================================
+
+/**
+ * @brief Configuracao padrao: minimizar, sem callback
+ */
+OptAnytimeConfig opt_anytime_default_config(size_t data_size, ObjectiveFn objective,
+                                            const void *context);
+
+// ============================================================================
+// CICLO DE VIDA
+// ============================================================================
+
+/**
+ * @brief Dispara solve(solver, user_data) numa thread nova e retorna
+ *
+ * @return OptAnytime* Handle ou NULL (parametros invalidos, memoria ou
+ *         falha ao criar a thread)
+ */
+OptAnytime* opt_anytime_start(const OptAnytimeConfig *config, OptAnytimeSolveFn solve,
+                              void *user_data);
+
+/**
+ * @brief Pede a parada; a execucao termina ao fim da iteracao corrente
+ *
+ * Nao bloqueia; pode ser chamada de qualquer thread, mais de uma vez.
+ */
+void opt_anytime_stop(OptAnytime *solver);
+
+/**
+ * @brief Espera a execucao terminar e devolve seu OptResult
+ *
+ * O resultado e entregue uma vez: chamadas seguintes devolvem um
+ * OptResult vazio. Nao pede a parada (use opt_anytime_stop antes se a
+ * execucao nao tiver limite proprio).
+ */
+OptResult opt_anytime_join(OptAnytime *solver);
+
+/**
+ * @brief Para, espera e libera o handle (o resultado nao lido e descartado)
+ */
+void opt_anytime_destroy(OptAnytime *solver);
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+
+/**
+ * @brief Copia a melhor solucao ja avaliada e o estado da execucao
+ *
+ * @param solver Handle
+ * @param best Saida: data_size bytes (NULL = so o estado)
+ * @param status Saida: versao, custo, avaliacoes... (pode ser NULL)
+ * @return true se ja existe alguma solucao (best foi preenchido)
+ *
+ * Complexidade: O(data_size)
+ */
+bool opt_anytime_poll(OptAnytime *solver, void *best, OptAnytimeStatus *status);
+
+/**
+ * @brief Espera uma melhoria alem de version
+ *
+ * Passe 0 para esperar a primeira solucao ou a versao do ultimo
+ * opt_anytime_poll para esperar a proxima.
+ *
+ * @param solver Handle
+ * @param version Ultima versao conhecida
+ * @param timeout_ms Prazo (negativo = sem prazo)
+ * @return true se ha versao mais nova; false no prazo ou se a execucao
+ *         terminou sem melhorar
+ */
+bool opt_anytime_wait(OptAnytime *solver, uint64_t version, double timeout_ms);
+
+// ============================================================================
+// INTEGRACAO COM OS ALGORITMOS
+// ============================================================================
+
+/**
+ * @brief ObjectiveFn que avalia com o objetivo real e publica melhorias
+ *
+ * context deve ser o OptAnytime. Seguro para avaliacao paralela.
+ */
+double opt_anytime_objective(const void *solution, size_t size, const void *context);
+
+/**
+ * @brief Publica uma solucao ja avaliada (ignorada se nao melhora)
+ *
+ * Para corpos que avaliam por conta propria; conta uma avaliacao.
+ *
+ * @return true se virou a nova melhor
+ */
+bool opt_anytime_offer(OptAnytime *solver, const void *solution, double cost);
+
+/**
+ * @brief Sinal de parada para OptStopCriteria.cancel
+ */
+const atomic_bool* opt_anytime_cancel_flag(OptAnytime *solver);
+
+/**
+ * @brief O solver ja recebeu opt_anytime_stop?
+ */
+bool opt_anytime_stop_requested(const OptAnytime *solver);
+
+#endif // OPT_ANYTIME_H
@@ -10,6 +10,10 @@
  * Representacao: solucao como array de double (vetor em R^D)
  * Funcao objetivo: valor da funcao no ponto (minimizacao)
  *
+ * As funcoes objetivo sao vetorizadas (AVX2+FMA, AVX-512F ou NEON), com o
+ * conjunto de instrucoes escolhido em runtime pela CPU; ver
+ * continuous_simd_level().
+ *
  * Referencias:
  * - Jamil, M. & Yang, X.-S. (2013). "A Literature Survey of Benchmark
  *   Functions for Global Optimization Problems"
@@ -132,12 +136,68 @@ void continuous_instance_destroy(ContinuousInstance *inst);
  */
 double continuous_evaluate(const void *solution_data, size_t size, const void *context);
 
+/**
+ * @brief Avalia count pontos contiguos (BatchObjectiveFn-compatible)
+ *
+ * O despacho por fn_type e por nivel SIMD acontece uma vez por lote; o
+ * laco interno chama o kernel vetorizado em cada linha.
+ *
+ * @param solutions count vetores double de size componentes, stride bytes entre eles
+ * @param costs Saida com count custos
+ *
+ * Complexidade: O(count * D)
+ */
+void continuous_evaluate_batch(const void *solutions, size_t count, size_t stride,
+                               size_t size, double *costs, const void *context);
+
 double continuous_sphere(const double *x, size_t d);
 double continuous_rastrigin(const double *x, size_t d);
 double continuous_rosenbrock(const double *x, size_t d);
 double continuous_ackley(const double *x, size_t d);
 double continuous_schwefel(const double *x, size_t d);
 
+// ============================================================================
+// DESPACHO SIMD
+// ============================================================================
+
+/**
+ * @brief Conjunto de instrucoes usado pelas funcoes objetivo
+ *
+ * Os niveis estao em ordem crescente de largura vetorial.
+ */
+typedef enum {
+    CONTINUOUS_SIMD_SCALAR,  /**< Referencia escalar (libm) */
+    CONTINUOUS_SIMD_NEON,    /**< AArch64 NEON, 2 lanes */
+    CONTINUOUS_SIMD_AVX2,    /**< x86 AVX2 + FMA, 4 lanes */
+    CONTINUOUS_SIMD_AVX512   /**< x86 AVX-512F, 8 lanes */
+} ContinuousSimdLevel;
+
+/**
+ * @brief Nivel SIMD efetivo (melhor suportado pela CPU, limitado pelo teto)
+ *
+ * Tolerancia em relacao a referencia escalar: cada termo difere da libm
+ * em ate ~4 ULP (sin/cos por reducao de Cody-Waite + polinomio de grau
+ * 23); as somas sao reassociadas em W lanes, acrescentando ate
+ * ~(D/W + W) * DBL_EPSILON * sum(|termo_i|). Na pratica o erro relativo
+ * fica abaixo de 1e-12 para D <= 10^4 nos dominios padrao. Argumentos
+ * trigonometricos com |y| > 1e6 usam a libm.
+ *
+ * -DCONTINUOUS_NO_SIMD compila apenas a referencia escalar.
+ */
+ContinuousSimdLevel continuous_simd_level(void);
+
+/**
+ * @brief Limita o nivel SIMD usado pelas funcoes objetivo
+ *
+ * CONTINUOUS_SIMD_SCALAR forca a referencia escalar (util para
+ * reprodutibilidade bit a bit); CONTINUOUS_SIMD_AVX512 remove o teto.
+ * Estado global: chamar antes de iniciar threads de avaliacao.
+ *
+ * @param max_level Nivel maximo permitido
+ * @return ContinuousSimdLevel Nivel efetivo apos a mudanca
+ */
+ContinuousSimdLevel continuous_set_simd_level(ContinuousSimdLevel max_level);
+
 // ============================================================================
 // VIZINHANCA (NeighborFn-compatible)
 // ============================================================================
@@ -3,7 +3,8 @@
  * @brief Benchmark TSP (Traveling Salesman Problem) para algoritmos de otimizacao
  *
  * Fornece instancias hardcoded e aleatorias do TSP, funcao objetivo
- * compativel com ObjectiveFn, vizinhancas (swap, 2-opt) e perturbacoes
+ * compativel com ObjectiveFn, vizinhancas (swap, 2-opt), busca local
+ * (2-opt/or-opt/Lin-Kernighan com listas de candidatos) e perturbacoes
  * (double-bridge) para uso com heuristicas e meta-heuristicas.
  *
  * Representacao: tour como array de int (permutacao de [0..n-1])
@@ -23,22 +24,105 @@
 
 #include "optimization/common.h"
 #include <stddef.h>
+#include <stdio.h>
+#include <math.h>
 
 // ============================================================================
 // INSTANCIA TSP
 // ============================================================================
 
+/**
+ * @brief Armazenamento das distancias de uma instancia TSP
+ */
+typedef enum {
+    TSP_DIST_DOUBLE,   /**< Matriz n x n de double (8 n^2 bytes) */
+    TSP_DIST_FLOAT,    /**< Matriz n x n de float (4 n^2 bytes, ~7 digitos) */
+    TSP_DIST_COORDS,   /**< Sem matriz: distancia calculada das coordenadas */
+    TSP_DIST_AUTO      /**< So na criacao: double ate TSP_MATRIX_MAX_CITIES, coordenadas acima */
+} TSPDistStorage;
+
+/** Maior n para o qual TSP_DIST_AUTO ainda monta a matriz (20000 cidades = 3.2 GB em double) */
+#define TSP_MATRIX_MAX_CITIES 20000
+
+/**
+ * @brief Funcao de distancia entre cidades
+ *
+ * As metricas TSPLIB arredondam para inteiro como em Reinelt (1995), de
+ * modo que os custos batem com os otimos publicados.
+ */
+typedef enum {
+    TSP_METRIC_EUCLIDEAN,   /**< Euclidiana sem arredondamento (instancias geradas) */
+    TSP_METRIC_EUC_2D,      /**< TSPLIB EUC_2D: nint(euclidiana) */
+    TSP_METRIC_CEIL_2D,     /**< TSPLIB CEIL_2D: ceil(euclidiana) */
+    TSP_METRIC_ATT,         /**< TSPLIB ATT: pseudo-euclidiana (att48, att532) */
+    TSP_METRIC_GEO,         /**< TSPLIB GEO: distancia geografica, x = latitude e y = longitude em DDD.MM */
+    TSP_METRIC_EXPLICIT     /**< TSPLIB EXPLICIT: pesos lidos do arquivo (sempre com matriz) */
+} TSPMetric;
+
 /**
  * @brief Instancia do Problema do Caixeiro Viajante
+ *
+ * A matriz e um unico bloco n x n row-major: d(i,j) = dist_matrix[i*n + j].
+ * Use tsp_dist() para acessar independentemente do armazenamento.
  */
 typedef struct {
-    double **dist_matrix;    /**< Matriz de distancias n x n */
+    double *dist_matrix;     /**< Matriz n x n row-major (NULL se storage != TSP_DIST_DOUBLE) */
+    float *dist_matrix_f32;  /**< Matriz n x n row-major (NULL se storage != TSP_DIST_FLOAT) */
+    TSPDistStorage storage;  /**< Forma de armazenamento das distancias */
+    TSPMetric metric;        /**< Funcao de distancia (usada sem matriz e ao montar a matriz) */
     size_t n_cities;         /**< Numero de cidades */
     double *x;               /**< Coordenadas x das cidades */
     double *y;               /**< Coordenadas y das cidades */
     double known_optimum;    /**< Custo otimo conhecido (-1 se desconhecido) */
+    int *neighbors;          /**< Listas kNN: cidade i em neighbors[i*k .. i*k + k-1] (ou NULL) */
+    size_t n_neighbors;      /**< k das listas de vizinhos (0 se nao construidas) */
 } TSPInstance;
 
+/**
+ * @brief Distancia entre as cidades i e j calculada das coordenadas pela metrica
+ *
+ * Usada por tsp_dist sem matriz para as metricas TSPLIB; 0 para
+ * TSP_METRIC_EXPLICIT, que nao tem coordenadas.
+ *
+ * Complexidade: O(1)
+ */
+double tsp_dist_metric(const TSPInstance *inst, size_t i, size_t j);
+
+/**
+ * @brief Distancia entre as cidades i e j
+ *
+ * Inline para que os lacos de custo e de vizinhanca (2-opt) nao paguem
+ * chamada de funcao por aresta; sem matriz, so a euclidiana simples fica
+ * inline.
+ *
+ * Complexidade: O(1)
+ */
+static inline double tsp_dist(const TSPInstance *inst, size_t i, size_t j) {
+    switch (inst->storage) {
+        case TSP_DIST_DOUBLE:
+            return inst->dist_matrix[i * inst->n_cities + j];
+        case TSP_DIST_FLOAT:
+            return (double)inst->dist_matrix_f32[i * inst->n_cities + j];
+        default: {
+            if (inst->metric != TSP_METRIC_EUCLIDEAN) return tsp_dist_metric(inst, i, j);
+            double dx = inst->x[i] - inst->x[j];
+            double dy = inst->y[i] - inst->y[j];
+            return sqrt(dx * dx + dy * dy);
+        }
+    }
+}
+
+/**
+ * @brief Lista dos k vizinhos mais proximos da cidade (ordem crescente)
+ *
+ * @return const int* k indices de cidades, ou NULL se as listas nao
+ *         foram construidas (ver tsp_build_neighbor_lists)
+ */
+static inline const int* tsp_neighbor_list(const TSPInstance *inst, size_t city) {
+    if (inst->neighbors == NULL) return NULL;
+    return inst->neighbors + city * inst->n_neighbors;
+}
+
 // ============================================================================
 // CRIACAO E DESTRUICAO DE INSTANCIAS
 // ============================================================================
@@ -76,6 +160,77 @@ TSPInstance* tsp_create_example_20(void);
  */
 TSPInstance* tsp_create_random(size_t n, unsigned seed);
 
+/**
+ * @brief Cria instancia TSP aleatoria escolhendo o armazenamento das distancias
+ *
+ * Mesmas coordenadas de tsp_create_random(n, seed). TSP_DIST_FLOAT reduz a
+ * matriz pela metade; TSP_DIST_COORDS nao aloca matriz (O(n) memoria),
+ * viabilizando instancias de dezenas de milhares de cidades.
+ *
+ * @param n Numero de cidades
+ * @param seed Semente para reproducibilidade
+ * @param storage Armazenamento das distancias
+ * @return TSPInstance* Instancia alocada ou NULL em falha
+ */
+TSPInstance* tsp_create_random_with_storage(size_t n, unsigned seed, TSPDistStorage storage);
+
+/**
+ * @brief Cria instancia TSP a partir de coordenadas (distancia euclidiana)
+ *
+ * @param x Coordenadas x (n valores, copiadas)
+ * @param y Coordenadas y (n valores, copiadas)
+ * @param n Numero de cidades
+ * @param storage Armazenamento das distancias
+ * @return TSPInstance* Instancia alocada ou NULL em falha
+ *
+ * Complexidade: O(n^2) com matriz; O(n) com TSP_DIST_COORDS
+ */
+TSPInstance* tsp_create_from_coords(const double *x, const double *y, size_t n,
+                                    TSPDistStorage storage);
+
+/**
+ * @brief Le uma instancia TSPLIB (TYPE: TSP) de um arquivo
+ *
+ * Aceita EDGE_WEIGHT_TYPE EUC_2D, CEIL_2D, ATT, GEO e EXPLICIT (formatos
+ * FULL_MATRIX e UPPER/LOWER[_DIAG]_ROW/COL). O arquivo e lido em blocos,
+ * sem carregar o texto inteiro, e os numeros sao convertidos sem depender
+ * do locale corrente.
+ *
+ * Com TSP_DIST_COORDS (ou TSP_DIST_AUTO acima de TSP_MATRIX_MAX_CITIES
+ * cidades) nenhuma matriz e alocada: tsp_dist calcula a metrica das
+ * coordenadas sob demanda, em O(n) memoria. EXPLICIT sempre usa matriz
+ * (double, ou float se pedido).
+ *
+ * @param path Caminho do arquivo .tsp
+ * @param storage Armazenamento das distancias
+ * @return TSPInstance* Instancia alocada (known_optimum = -1) ou NULL se o
+ *         arquivo nao abre, e malformado, usa recurso nao suportado
+ *         (EUC_3D, ATSP, FIXED_EDGES_SECTION...) ou falta memoria
+ *
+ * Complexidade: O(tamanho do arquivo) + O(n^2) se montar a matriz
+ */
+TSPInstance* tsp_load_tsplib(const char *path, TSPDistStorage storage);
+
+/**
+ * @brief Como tsp_load_tsplib, lendo de um FILE* ja aberto (nao fechado)
+ */
+TSPInstance* tsp_read_tsplib(FILE *in, TSPDistStorage storage);
+
+/**
+ * @brief Pre-calcula as listas dos k vizinhos mais proximos de cada cidade
+ *
+ * Listas de candidatos restringem buscas locais (2-opt, Or-opt) e a
+ * construcao de formigas a O(n*k) em vez de O(n^2). Reconstruir com
+ * outro k substitui as listas anteriores.
+ *
+ * @param inst Instancia
+ * @param k Vizinhos por cidade (limitado a n-1)
+ * @return true em sucesso, false em falha de alocacao ou argumento invalido
+ *
+ * Complexidade: O(n^2 * k) pior caso, O(n^2) tipico; memoria O(n*k)
+ */
+bool tsp_build_neighbor_lists(TSPInstance *inst, size_t k);
+
 /**
  * @brief Libera memoria de uma instancia TSP
  *
@@ -94,7 +249,7 @@ void tsp_instance_destroy(TSPInstance *inst);
  *
  * @param tour_data Array de int* (permutacao de [0..n-1])
  * @param n Numero de cidades
- * @param context TSPInstance* com dist_matrix
+ * @param context TSPInstance*
  * @return double Custo total do tour
  *
  * Complexidade: O(n)
@@ -133,6 +288,177 @@ void tsp_neighbor_swap(const void *current, void *neighbor, size_t n, const void
  */
 void tsp_neighbor_2opt(const void *current, void *neighbor, size_t n, const void *context);
 
+// ============================================================================
+// AVALIACAO INCREMENTAL (MoveDeltaFn / MoveApplyFn-compatible)
+// ============================================================================
+
+/**
+ * @brief Tipos de movimento TSP (OptMove.type)
+ */
+typedef enum {
+    TSP_MOVE_2OPT,     /**< Inverte tour[i..j], i < j */
+    TSP_MOVE_SWAP,     /**< Troca as cidades das posicoes i e j */
+    TSP_MOVE_OR_OPT    /**< Move o segmento tour[i..i+k-1] para depois da posicao j */
+} TSPMoveType;
+
+/**
+ * @brief Delta de custo do 2-opt que inverte tour[i..j] (i < j)
+ *
+ * Troca as arestas (a,b),(c,d) por (a,c),(b,d), com b = tour[i],
+ * c = tour[j] e a, d seus vizinhos externos. Assume distancia simetrica.
+ *
+ * Complexidade: O(1)
+ */
+double tsp_delta_2opt(const TSPInstance *inst, const int *tour, size_t n,
+                      size_t i, size_t j);
+
+/**
+ * @brief Delta de custo da troca das posicoes i e j
+ *
+ * Trata posicoes adjacentes (inclusive 0 e n-1) sem contar arestas duas vezes.
+ *
+ * Complexidade: O(1)
+ */
+double tsp_delta_swap(const TSPInstance *inst, const int *tour, size_t n,
+                      size_t i, size_t j);
+
+/**
+ * @brief Delta de custo do or-opt: segmento tour[i..i+len-1] reinserido
+ *        entre as posicoes j e j+1, sem inverter
+ *
+ * Requer i + len <= n e j fora de [i-1, i+len-1] (modulo n).
+ *
+ * Referencia: Or, I. (1976). "Traveling Salesman-Type Combinatorial
+ * Problems and their Relation to the Logistics of Regional Blood Banking"
+ *
+ * Complexidade: O(1)
+ */
+double tsp_delta_or_opt(const TSPInstance *inst, const int *tour, size_t n,
+                        size_t i, size_t len, size_t j);
+
+/**
+ * @brief Aplica o 2-opt: inverte tour[i..j]
+ *
+ * Complexidade: O(j - i)
+ */
+void tsp_apply_2opt(int *tour, size_t i, size_t j);
+
+/**
+ * @brief Aplica a troca das posicoes i e j
+ *
+ * Complexidade: O(1)
+ */
+void tsp_apply_swap(int *tour, size_t i, size_t j);
+
+/**
+ * @brief Aplica o or-opt (mesmos parametros de tsp_delta_or_opt)
+ *
+ * Complexidade: O(distancia entre o segmento e a posicao de insercao)
+ */
+void tsp_apply_or_opt(int *tour, size_t n, size_t i, size_t len, size_t j);
+
+/**
+ * @brief Sorteia um 2-opt (mesma distribuicao de tsp_neighbor_2opt) e retorna o delta
+ *
+ * @param current Tour atual (int*)
+ * @param n Numero de cidades
+ * @param move Saida: TSP_MOVE_2OPT com i < j
+ * @param context TSPInstance*
+ * @return double Delta de custo
+ */
+double tsp_move_2opt(const void *current, size_t n, OptMove *move, const void *context);
+
+/**
+ * @brief Sorteia uma troca (mesma distribuicao de tsp_neighbor_swap) e retorna o delta
+ */
+double tsp_move_swap(const void *current, size_t n, OptMove *move, const void *context);
+
+/**
+ * @brief Sorteia um or-opt com segmento de 1 a 3 cidades e retorna o delta
+ *
+ * Para n < 3 gera um movimento nulo (delta 0, k = 0).
+ */
+double tsp_move_or_opt(const void *current, size_t n, OptMove *move, const void *context);
+
+/**
+ * @brief Aplica qualquer movimento TSPMoveType ao tour
+ */
+void tsp_move_apply(void *tour, size_t n, const OptMove *move, const void *context);
+
+/**
+ * @brief Varredura 2-opt completa por deltas (NeighborhoodScanFn-compatible)
+ *
+ * Percorre os pares i < j a partir de i = scan->start (modulo n - 1);
+ * com first_improvement para no primeiro delta que melhora, senao
+ * escolhe o melhor dos ~n^2/2. Movimentos com |delta| < 1e-9 nao contam
+ * como melhora. Aplicar com tsp_move_apply.
+ *
+ * Complexidade: O(n^2) deltas O(1) no pior caso, sem copiar tours
+ */
+bool tsp_scan_2opt(const void *current, size_t n, OptScan *scan, const void *context);
+
+// ============================================================================
+// BUSCA LOCAL (LocalSearchFn-compatible)
+// ============================================================================
+
+/**
+ * @brief Busca local 2-opt + or-opt com listas de candidatos e don't-look bits
+ *
+ * Melhora o tour no lugar ate um otimo local restrito aos candidatos:
+ * - 2-opt: nova aresta (a, c) com c na lista de a
+ * - or-opt: segmentos de 1 a 3 cidades reinseridos (direto ou invertido)
+ *   junto a um candidato de uma das pontas
+ *
+ * Uma fila FIFO guarda as cidades ativas; so as pontas de cada movimento
+ * aplicado voltam a fila, de modo que cada passada custa ~O(n k) em vez
+ * de O(n^2). A fila e reabastecida com todas as cidades enquanto uma
+ * rodada aplicar algum movimento, entao o resultado e otimo local para
+ * as listas. Usa inst->neighbors (tsp_build_neighbor_lists); sem listas,
+ * calcula listas temporarias de 8 vizinhos em O(n^2) a cada chamada.
+ *
+ * Partindo de um tour construtivo (vizinho mais proximo, GRASP) o custo
+ * e proximo de linear; de tours aleatorios use k >= 10.
+ *
+ * @param tour Tour (int*) melhorado no lugar
+ * @param n Numero de cidades (= inst->n_cities)
+ * @param objective Custo final (NULL = tsp_tour_cost)
+ * @param context TSPInstance*
+ * @return double Custo do tour resultante
+ *
+ * Referencias: Bentley (1992); Or (1976)
+ */
+double tsp_local_search(void *tour, size_t n, ObjectiveFn objective, const void *context);
+
+/**
+ * @brief Como tsp_local_search, apenas com movimentos 2-opt
+ */
+double tsp_local_search_2opt(void *tour, size_t n, ObjectiveFn objective, const void *context);
+
+/**
+ * @brief Como tsp_local_search, apenas com movimentos or-opt
+ */
+double tsp_local_search_or_opt(void *tour, size_t n, ObjectiveFn objective, const void *context);
+
+/**
+ * @brief Busca local Lin-Kernighan (flips 2-opt sequenciais) + or-opt
+ *
+ * De cada cidade ativa t1, constroi uma cadeia de ate 10 flips: a aresta
+ * aberta (t1,t2) e trocada por (t2,t3), t3 na lista de candidatos de t2,
+ * enquanto o ganho parcial for positivo. A cadeia e mantida assim que o
+ * fechamento melhora o tour; senao e desfeita. Os dois primeiros niveis
+ * tentam os 5 e 3 melhores t3 (backtracking), os demais so o melhor.
+ * Arestas adicionadas na cadeia nao sao removidas de novo. Or-opt cobre
+ * as insercoes de segmento que a cadeia nao alcanca.
+ *
+ * Mesmos parametros, listas e criterio de parada de tsp_local_search.
+ * Com tsp_perturb_double_bridge em ils_run (config.local_search =
+ * tsp_local_search_lk) forma o Chained Lin-Kernighan.
+ *
+ * Referencias: Lin & Kernighan (1973); Johnson & McGeoch (1997);
+ * Martin, Otto & Felten (1991)
+ */
+double tsp_local_search_lk(void *tour, size_t n, ObjectiveFn objective, const void *context);
+
 // ============================================================================
 // PERTURBACAO (PerturbFn-compatible)
 // ============================================================================
@@ -141,7 +467,8 @@ void tsp_neighbor_2opt(const void *current, void *neighbor, size_t n, const void
  * @brief Perturbacao double-bridge para TSP
  *
  * Corta o tour em 4 segmentos e reconecta em ordem diferente.
- * Perturbacao forte usada em ILS para escapar de otimos locais 2-opt.
+ * Perturbacao forte usada em ILS para escapar de otimos locais 2-opt;
+ * seguida de tsp_local_search_lk forma o Chained Lin-Kernighan.
  *
  * @param current Tour atual (int*)
  * @param perturbed Buffer para tour perturbado (int*, pre-alocado)
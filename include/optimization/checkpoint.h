@@ -0,0 +1,203 @@
+/**
+ * @file checkpoint.h
+ * @brief Checkpoint binario e retomada de execucoes longas (GA, ALNS)
+ *
+ * Um checkpoint guarda o estado completo do laco principal: populacao ou
+ * solucao corrente, melhor ja visto, streams RNG, pesos adaptativos,
+ * contadores e o prefixo do historico FULL. Retomar de um checkpoint
+ * continua a mesma trajetoria: uma execucao interrompida e retomada com a
+ * mesma configuracao termina com o mesmo resultado de uma ininterrupta.
+ * Aumentar max_generations / max_iterations na retomada estende a
+ * execucao com o mesmo efeito.
+ *
+ * Formato (host-endian, como o CSR de graph.h): cabecalho de 40 bytes com
+ * magic "OPTCKPT1", versao, marca de byte order, algoritmo, sizeof(size_t),
+ * impressao digital das dimensoes do problema e iteracao; depois o estado
+ * do algoritmo; por fim o FNV-1a de 64 bits de tudo que veio antes. O
+ * arquivo e gravado em "<path>.tmp" e renomeado sobre path, entao uma
+ * interrupcao no meio da gravacao preserva o checkpoint anterior.
+ *
+ * Na retomada, arquivo ausente, truncado, corrompido ou de outra
+ * configuracao (algoritmo, dimensoes, numero de operadores/ilhas) e
+ * ignorado e a execucao comeca do zero. Os criterios de parada por tempo
+ * recomecam a contar; o historico em anel e o callback so veem as
+ * iteracoes da sessao corrente.
+ *
+ * Uso tipico:
+ * @code
+ * GAConfig cfg = ga_default_config();
+ * cfg.checkpoint.path = "run.ckpt";
+ * cfg.checkpoint.interval = 100;   // a cada 100 geracoes e no fim
+ * cfg.checkpoint.resume = true;    // continua de run.ckpt se existir
+ * OptResult r = ga_run(&cfg, ...);
+ * @endcode
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#ifndef OPT_CHECKPOINT_H
+#define OPT_CHECKPOINT_H
+
+#include "optimization/common.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// ============================================================================
+// TIPOS
+// ============================================================================
+
+/**
+ * @brief Configuracao de checkpoint de um algoritmo
+ */
+typedef struct {
+    const char *path;            /**< Arquivo do checkpoint (NULL = desligado) */
+    size_t interval;             /**< Iteracoes entre gravacoes (0 = so no fim da execucao) */
+    bool resume;                 /**< Retomar de path se existir e for compativel */
+} OptCheckpointConfig;
+
+/**
+ * @brief Algoritmo dono do checkpoint (gravado no cabecalho)
+ */
+typedef enum {
+    OPT_CHECKPOINT_GA = 1,       /**< ga_run (panmitico ou ilhas) */
+    OPT_CHECKPOINT_ALNS = 2      /**< alns_run */
+} OptCheckpointAlgorithm;
+
+/**
+ * @brief Gravacao ou leitura em andamento
+ *
+ * Gravacao: o estado vai direto para o arquivo temporario. Leitura: o
+ * arquivo inteiro e validado (cabecalho, tamanho e checksum) antes do
+ * primeiro opt_checkpoint_read, entao um checkpoint aceito nunca falha no
+ * meio.
+ */
+typedef struct {
+    FILE *file;                  /**< Arquivo temporario (gravacao, interno) */
+    char *tmp_path;              /**< "<path>.tmp" (gravacao, interno) */
+    unsigned char *buffer;       /**< Arquivo validado (leitura, interno) */
+    size_t size;                 /**< Bytes de estado em buffer (leitura) */
+    size_t pos;                  /**< Proximo byte a ler (leitura) */
+    uint64_t hash;               /**< FNV-1a acumulado (gravacao) */
+    bool ok;                     /**< Nenhuma falha ate aqui */
+} OptCheckpoint;
+
+// ============================================================================
+// CONFIGURACAO
+// ============================================================================
+
+/**
+ * @brief Checkpoint desligado (path = NULL)
+ */
+OptCheckpointConfig opt_checkpoint_none(void);
+
+/**
+ * @brief Decide se a iteracao concluida deve gravar um checkpoint
+ *
+ * Verdadeiro com path definido e (last ou pelo menos interval iteracoes
+ * desde *last_saved); nesse caso *last_saved passa a iteration.
+ *
+ * @param config Configuracao (NULL = desligado)
+ * @param iteration Iteracoes concluidas
+ * @param last_saved Iteracao da ultima gravacao (atualizada)
+ * @param last Ultima iteracao da execucao (parada ou limite)
+ */
+bool opt_checkpoint_due(const OptCheckpointConfig *config, size_t iteration,
+                        size_t *last_saved, bool last);
+
+/**
+ * @brief Impressao digital de dimensoes que o checkpoint deve respeitar
+ *
+ * FNV-1a dos valores; execucoes com impressoes diferentes nao retomam
+ * uma da outra.
+ */
+uint64_t opt_checkpoint_fingerprint(const size_t *values, size_t count);
+
+// ============================================================================
+// GRAVACAO
+// ============================================================================
+
+/**
+ * @brief Abre "<path>.tmp" e grava o cabecalho
+ *
+ * @return true se o arquivo foi criado
+ */
+bool opt_checkpoint_write_begin(OptCheckpoint *ck, const char *path,
+                                OptCheckpointAlgorithm algorithm,
+                                uint64_t fingerprint, size_t iteration);
+
+/**
+ * @brief Acrescenta bytes de estado (falhas ficam em ck->ok)
+ */
+void opt_checkpoint_write(OptCheckpoint *ck, const void *data, size_t bytes);
+
+/**
+ * @brief Acrescenta o estado de um stream RNG (campo a campo, sem padding)
+ */
+void opt_checkpoint_write_rng(OptCheckpoint *ck, const OptRng *rng);
+
+/**
+ * @brief Acrescenta o prefixo [0, iterations) do historico completo
+ *
+ * Sem historico OPT_TRACE_FULL em result grava so a contagem zero.
+ */
+void opt_checkpoint_write_history(OptCheckpoint *ck, const OptResult *result,
+                                  size_t iterations);
+
+/**
+ * @brief Grava o checksum, fecha e renomeia sobre path
+ *
+ * Em falha remove o temporario e deixa path como estava.
+ *
+ * @return true se o checkpoint foi gravado por completo
+ */
+bool opt_checkpoint_write_end(OptCheckpoint *ck, const char *path);
+
+// ============================================================================
+// LEITURA
+// ============================================================================
+
+/**
+ * @brief Le e valida path inteiro
+ *
+ * Rejeita arquivo ausente, magic/versao/byte order/sizeof(size_t)
+ * diferentes, outro algoritmo ou impressao digital e checksum invalido.
+ *
+ * @param iteration Saida: iteracoes concluidas quando o checkpoint foi gravado
+ * @return true se o checkpoint pode ser lido
+ */
+bool opt_checkpoint_read_begin(OptCheckpoint *ck, const char *path,
+                               OptCheckpointAlgorithm algorithm,
+                               uint64_t fingerprint, size_t *iteration);
+
+/**
+ * @brief Copia os proximos bytes de estado
+ *
+ * @return false (e ck->ok = false) se o checkpoint acabou antes
+ */
+bool opt_checkpoint_read(OptCheckpoint *ck, void *data, size_t bytes);
+
+/**
+ * @brief Le um stream RNG gravado por opt_checkpoint_write_rng
+ */
+bool opt_checkpoint_read_rng(OptCheckpoint *ck, OptRng *rng);
+
+/**
+ * @brief Le o prefixo gravado por opt_checkpoint_write_history
+ *
+ * Copia para result->convergence o que couber; sem historico completo as
+ * amostras sao descartadas.
+ */
+bool opt_checkpoint_read_history(OptCheckpoint *ck, OptResult *result);
+
+/**
+ * @brief Libera o buffer de leitura
+ *
+ * @return true se todas as leituras deram certo e o estado foi consumido
+ *         por inteiro
+ */
+bool opt_checkpoint_read_end(OptCheckpoint *ck);
+
+#endif // OPT_CHECKPOINT_H
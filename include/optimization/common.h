@@ -21,8 +21,10 @@
 #ifndef OPT_COMMON_H
 #define OPT_COMMON_H
 
+#include <stdatomic.h>
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 // ============================================================================
 // TIPOS DE OTIMIZACAO
@@ -50,6 +52,24 @@ typedef enum {
  */
 typedef double (*ObjectiveFn)(const void *solution_data, size_t size, const void *context);
 
+/**
+ * @brief Funcao objetivo em lote: avalia uma populacao inteira por chamada
+ *
+ * As solucoes estao contiguas: a i-esima comeca em
+ * (const char*)solutions + i * stride. Permite vetorizar a avaliacao ou
+ * delega-la a outro dispositivo, pagando a chamada indireta uma vez por
+ * geracao em vez de uma vez por individuo.
+ *
+ * @param solutions Buffer com count solucoes consecutivas
+ * @param count Numero de solucoes (tamanho da populacao)
+ * @param stride Bytes entre solucoes consecutivas (element_size)
+ * @param size Dimensao logica de cada solucao
+ * @param costs Saida: costs[i] recebe o custo da i-esima solucao
+ * @param context Contexto do problema
+ */
+typedef void (*BatchObjectiveFn)(const void *solutions, size_t count, size_t stride,
+                                 size_t size, double *costs, const void *context);
+
 /**
  * @brief Funcao de vizinhanca: gera um vizinho a partir da solucao atual
  *
@@ -81,6 +101,88 @@ typedef void (*PerturbFn)(const void *current, void *perturbed, size_t size,
  */
 typedef void (*GenerateFn)(void *solution, size_t size, const void *context);
 
+/**
+ * @brief Busca local aplicada no lugar (GA memetico, ILS, GRASP, MA)
+ *
+ * @param solution Solucao a melhorar (in-place, dados + custo retornado)
+ * @param size Dimensao logica
+ * @param objective Funcao objetivo
+ * @param context Contexto
+ * @return double Novo custo apos busca local
+ */
+typedef double (*LocalSearchFn)(void *solution, size_t size,
+                                ObjectiveFn objective, const void *context);
+
+// ============================================================================
+// MOVIMENTOS (AVALIACAO INCREMENTAL)
+// ============================================================================
+
+/**
+ * @brief Movimento de vizinhanca descrito por parametros, sem materializar o vizinho
+ *
+ * O significado de type, i, j e k e definido pelo problema (ex.: TSPMoveType).
+ */
+typedef struct {
+    int type;    /**< Tipo do movimento */
+    size_t i;    /**< Primeira posicao */
+    size_t j;    /**< Segunda posicao */
+    size_t k;    /**< Parametro extra (ex.: comprimento do segmento) */
+} OptMove;
+
+/**
+ * @brief Sorteia um movimento e retorna o delta de custo, sem alterar current
+ *
+ * Permite avaliar vizinhos em O(1) em vez de copiar a solucao e
+ * recalcular a funcao objetivo em O(n).
+ *
+ * @param current Solucao atual (read-only)
+ * @param size Tamanho da solucao
+ * @param move Saida: movimento sorteado (passado depois a MoveApplyFn)
+ * @param context Contexto do problema
+ * @return double custo(vizinho) - custo(current)
+ */
+typedef double (*MoveDeltaFn)(const void *current, size_t size, OptMove *move,
+                              const void *context);
+
+/**
+ * @brief Aplica um movimento produzido por MoveDeltaFn sobre a solucao
+ *
+ * @param solution Solucao a modificar (no lugar)
+ * @param size Tamanho da solucao
+ * @param move Movimento a aplicar
+ * @param context Contexto do problema
+ */
+typedef void (*MoveApplyFn)(void *solution, size_t size, const OptMove *move,
+                            const void *context);
+
+/**
+ * @brief Estado de uma varredura de vizinhanca (NeighborhoodScanFn)
+ */
+typedef struct {
+    OptDirection direction;    /**< Entrada: sentido da melhora */
+    bool first_improvement;    /**< Entrada: para no primeiro movimento que melhora */
+    size_t start;              /**< Entrada: onde a varredura comeca (dica; o problema interpreta) */
+    OptMove move;              /**< Saida: movimento escolhido */
+    double delta;              /**< Saida: delta de custo de move */
+    size_t evaluations;        /**< Saida: deltas avaliados nesta varredura */
+} OptScan;
+
+/**
+ * @brief Varre a vizinhanca de current por deltas, sem copiar vizinhos
+ *
+ * Com scan->first_improvement, retorna no primeiro movimento que melhora;
+ * senao avalia a vizinhanca inteira e escolhe o melhor. Um 2-opt completo
+ * custa O(n^2) deltas O(1) em vez de O(n^2) copias + avaliacoes O(n).
+ *
+ * @param current Solucao atual (read-only)
+ * @param size Tamanho da solucao
+ * @param scan Entradas e saidas da varredura
+ * @param context Contexto do problema
+ * @return true se scan->move melhora current (aplicar com MoveApplyFn)
+ */
+typedef bool (*NeighborhoodScanFn)(const void *current, size_t size, OptScan *scan,
+                                   const void *context);
+
 // ============================================================================
 // SOLUCAO DE OTIMIZACAO
 // ============================================================================
@@ -94,20 +196,54 @@ typedef struct {
     double cost;         /**< Valor da funcao objetivo */
 } OptSolution;
 
+/**
+ * @brief Pool de buffers de solucao de tamanho fixo (uma por execucao)
+ *
+ * Recicla os buffers devolvidos em vez de chamar malloc/free a cada
+ * candidato. Os buffers sao blocos malloc comuns: um buffer adquirido
+ * pode tambem ser liberado com free() ou virar o data de uma OptSolution.
+ * Nao e thread-safe: use um pool por thread/execucao.
+ */
+typedef struct {
+    size_t data_size;    /**< Tamanho em bytes de cada buffer */
+    void **free_buffers; /**< Pilha de buffers disponiveis */
+    size_t num_free;     /**< Buffers na pilha */
+    size_t capacity;     /**< Capacidade da pilha */
+    size_t num_allocated; /**< Buffers criados via malloc desde a criacao */
+} OptSolutionPool;
+
 // ============================================================================
 // RESULTADO DE OTIMIZACAO
 // ============================================================================
 
+/**
+ * @brief Estatisticas de um operador selecionado adaptativamente (ex.: ALNS)
+ */
+typedef struct {
+    size_t calls;                /**< Vezes em que foi selecionado */
+    size_t new_best;             /**< Vezes em que gerou nova melhor global */
+    size_t improvements;         /**< Vezes em que melhorou a solucao corrente */
+    size_t accepted;             /**< Vezes em que a solucao gerada foi aceita */
+    double total_time_ms;        /**< Tempo de parede gasto no operador */
+    double weight;               /**< Peso de selecao ao final da execucao */
+} OptOperatorStats;
+
 /**
  * @brief Resultado completo de uma execucao de algoritmo de otimizacao
  */
 typedef struct {
     OptSolution best;            /**< Melhor solucao encontrada */
     double *convergence;         /**< Historico de convergencia (best cost por iteracao) */
-    size_t convergence_size;     /**< Tamanho alocado do array convergence */
+    size_t convergence_size;     /**< Tamanho do array convergence (modo RING: amostras validas) */
+    size_t *convergence_iterations; /**< Iteracao de cada amostra (NULL = convergence[i] e a iteracao i) */
     size_t num_iterations;       /**< Iteracoes executadas */
     size_t num_evaluations;      /**< Avaliacoes da funcao objetivo */
+    size_t num_cache_hits;       /**< Avaliacoes servidas por cache (opt_eval_cache_report) */
     double elapsed_time_ms;      /**< Tempo de execucao em milliseconds */
+    double *island_convergence;  /**< Convergencia por ilha (num_islands x convergence_size, row-major; NULL se nao houver) */
+    size_t num_islands;          /**< Linhas de island_convergence (0 = populacao unica) */
+    OptOperatorStats *operator_stats; /**< Estatisticas por operador (NULL se nao houver) */
+    size_t num_operators;        /**< Entradas de operator_stats */
 } OptResult;
 
 // ============================================================================
@@ -137,6 +273,51 @@ OptSolution opt_solution_clone(const OptSolution *src);
  */
 void opt_solution_destroy(OptSolution *sol);
 
+/**
+ * @brief Copia dados e custo de src para dst sem alocar
+ *
+ * @param dst Solucao destino (data ja alocado, mesmo data_size de src)
+ * @param src Solucao origem
+ * @return bool false se algum ponteiro for NULL ou os tamanhos diferirem
+ */
+bool opt_solution_copy_into(OptSolution *dst, const OptSolution *src);
+
+/**
+ * @brief Cria um pool com initial buffers de data_size bytes pre-alocados
+ *
+ * @param data_size Tamanho em bytes de cada buffer
+ * @param initial Buffers alocados de antemao
+ * @return OptSolutionPool Pool (data_size = 0 se falha)
+ */
+OptSolutionPool opt_solution_pool_create(size_t data_size, size_t initial);
+
+/**
+ * @brief Obtem um buffer do pool (malloc apenas se a pilha estiver vazia)
+ *
+ * @return void* Buffer de pool->data_size bytes, conteudo indefinido (NULL se falha)
+ *
+ * Complexidade: O(1)
+ */
+void* opt_solution_pool_acquire(OptSolutionPool *pool);
+
+/**
+ * @brief Devolve um buffer ao pool para reuso
+ *
+ * @param pool Pool de origem
+ * @param data Buffer obtido de opt_solution_pool_acquire (NULL e ignorado)
+ *
+ * Complexidade: O(1) amortizado
+ */
+void opt_solution_pool_release(OptSolutionPool *pool, void *data);
+
+/**
+ * @brief Libera os buffers disponiveis no pool
+ *
+ * Buffers ainda adquiridos nao sao tocados: devolva-os antes ou libere-os
+ * com free().
+ */
+void opt_solution_pool_destroy(OptSolutionPool *pool);
+
 /**
  * @brief Cria resultado com array de convergencia pre-alocado
  *
@@ -152,12 +333,303 @@ OptResult opt_result_create(size_t max_iterations);
  */
 void opt_result_destroy(OptResult *result);
 
+/**
+ * @brief Avalia count solucoes contiguas, em lote se houver batch
+ *
+ * Usa batch quando nao for NULL; senao chama objective uma vez por solucao.
+ *
+ * @return size_t Numero de avaliacoes (count)
+ */
+size_t opt_evaluate_batch(BatchObjectiveFn batch, ObjectiveFn objective,
+                          const void *solutions, size_t count, size_t stride,
+                          size_t size, double *costs, const void *context);
+
+/**
+ * @brief Tempo de parede em milliseconds (relogio TIME_UTC, 0 em falha)
+ */
+double opt_wall_time_ms(void);
+
+/**
+ * @brief Relogio monotonico em milliseconds (origem arbitraria)
+ *
+ * clock_gettime(CLOCK_MONOTONIC) quando disponivel; senao TIME_UTC.
+ * Use so diferencas entre duas leituras.
+ */
+double opt_monotonic_time_ms(void);
+
+// ============================================================================
+// CRITERIOS DE PARADA
+// ============================================================================
+
+/**
+ * @brief Criterios de parada adicionais a max_iterations
+ *
+ * Todos desligados quando zerados: {0} (ou opt_stop_none()) preserva o
+ * comportamento so por iteracoes. A execucao para no primeiro criterio
+ * atingido, sempre ao fim de uma iteracao completa.
+ */
+typedef struct {
+    double time_limit_ms;        /**< Orcamento de tempo de parede (0 = sem limite) */
+    size_t max_evaluations;      /**< Orcamento de avaliacoes (0 = sem limite) */
+    bool use_target;             /**< Parar ao atingir target_cost */
+    double target_cost;          /**< Custo alvo (atingido se <= no min, >= no max) */
+    size_t check_interval;       /**< Le o relogio a cada check_interval checagens (0 = adaptativo) */
+    const atomic_bool *cancel;   /**< Parada pedida por outra thread (NULL = nenhuma; ex.: opt_anytime_stop) */
+} OptStopCriteria;
+
+/**
+ * @brief Estado de parada de uma execucao (criado por opt_stop_begin)
+ */
+typedef struct {
+    OptStopCriteria criteria;    /**< Copia dos criterios */
+    OptDirection direction;      /**< Direcao (para target_cost) */
+    double deadline_ms;          /**< Instante limite no relogio monotonico */
+    double last_read_ms;         /**< Ultima leitura do relogio */
+    size_t interval;             /**< Checagens entre leituras do relogio */
+    size_t countdown;            /**< Checagens ate a proxima leitura do relogio */
+    bool stopped;                /**< Algum criterio ja foi atingido */
+} OptStopState;
+
+/**
+ * @brief Criterios desligados (so max_iterations)
+ */
+OptStopCriteria opt_stop_none(void);
+
+/**
+ * @brief Inicia a contagem de tempo de uma execucao
+ *
+ * @param criteria Criterios (NULL = nenhum)
+ * @param direction Direcao da otimizacao
+ * @return OptStopState Estado a passar para opt_stop_check
+ */
+OptStopState opt_stop_begin(const OptStopCriteria *criteria, OptDirection direction);
+
+/**
+ * @brief Verifica os criterios ao fim de uma iteracao
+ *
+ * Avaliacoes e alvo sao conferidos em toda chamada (comparacoes apenas);
+ * o relogio so e lido a cada check_interval chamadas, amortizando o custo
+ * da syscall em iteracoes curtas. Com check_interval = 0 o intervalo se
+ * ajusta para ~1 leitura a cada 0.5 ms (dobra se as leituras estao mais
+ * proximas, cai para 1 se mais distantes), entao iteracoes longas nao
+ * estouram o orcamento. O sinal cancel e lido em toda chamada (uma carga
+ * relaxed). Uma vez atingido, continua true.
+ *
+ * @param state Estado da execucao
+ * @param evaluations Avaliacoes feitas ate agora
+ * @param best_cost Melhor custo ate agora
+ * @return bool true se a execucao deve parar
+ *
+ * Complexidade: O(1)
+ */
+bool opt_stop_check(OptStopState *state, size_t evaluations, double best_cost);
+
+// ============================================================================
+// PROGRESSO E AMOSTRAGEM DA CONVERGENCIA
+// ============================================================================
+
+/**
+ * @brief Amostra de progresso entregue ao OptProgressFn
+ */
+typedef struct {
+    size_t iteration;            /**< Iteracao (0-based) */
+    size_t evaluations;          /**< Avaliacoes ate aqui */
+    double best_cost;            /**< Melhor custo ate aqui */
+    double elapsed_ms;           /**< Tempo desde o inicio da execucao */
+} OptProgress;
+
+/**
+ * @brief Callback de progresso, chamado a cada amostra (na thread do *_run)
+ *
+ * @param progress Amostra corrente
+ * @param user_data Repassado de OptTraceConfig
+ */
+typedef void (*OptProgressFn)(const OptProgress *progress, void *user_data);
+
+/**
+ * @brief Como o historico de convergencia e guardado em OptResult
+ */
+typedef enum {
+    OPT_TRACE_FULL,   /**< convergence[iter] para toda iteracao (max_iterations doubles) */
+    OPT_TRACE_RING,   /**< Anel com as ultimas capacity amostras + suas iteracoes */
+    OPT_TRACE_NONE    /**< Sem array (so o callback): memoria O(1) */
+} OptTraceMode;
+
+/**
+ * @brief Configuracao de amostragem/streaming do progresso
+ *
+ * Zerada (opt_trace_default()) = historico completo e sem callback, o
+ * comportamento original. Uma iteracao e amostrada a cada every iteracoes
+ * ou, com on_improvement, so quando o melhor custo melhora; a ultima
+ * iteracao e sempre amostrada. A amostragem vale para o callback e para o
+ * modo RING; o modo FULL grava todas as iteracoes no array.
+ */
+typedef struct {
+    OptTraceMode mode;           /**< Armazenamento do historico */
+    size_t capacity;             /**< Amostras do anel (OPT_TRACE_RING; 0 = 1024) */
+    size_t every;                /**< Amostra a cada every iteracoes (0 ou 1 = todas) */
+    bool on_improvement;         /**< Amostrar so quando o melhor custo melhora */
+    OptProgressFn callback;      /**< Callback por amostra (NULL = nenhum) */
+    void *user_data;             /**< Repassado ao callback */
+} OptTraceConfig;
+
+/**
+ * @brief Estado de amostragem de uma execucao (criado por opt_tracer_begin)
+ */
+typedef struct {
+    OptTraceConfig config;       /**< Copia da configuracao */
+    OptDirection direction;      /**< Direcao (para on_improvement) */
+    double start_ms;             /**< Inicio da execucao (relogio monotonico) */
+    double last_best;            /**< Melhor custo da ultima amostra */
+    size_t head;                 /**< Proxima posicao do anel */
+    size_t count;                /**< Amostras no anel */
+    size_t last_iteration;       /**< Ultima iteracao vista */
+    size_t last_evaluations;     /**< Avaliacoes na ultima iteracao vista */
+    double last_cost;            /**< Melhor custo na ultima iteracao vista */
+    bool seen;                   /**< Alguma iteracao foi registrada */
+    bool sampled_any;            /**< Alguma iteracao foi amostrada */
+    bool last_sampled;           /**< A ultima iteracao vista foi amostrada */
+    uint64_t start_ticks;        /**< Inicio em ticks de instrument.h (0 sem DS_INSTRUMENT) */
+} OptTracer;
+
+/**
+ * @brief Historico completo, sem callback
+ */
+OptTraceConfig opt_trace_default(void);
+
+/**
+ * @brief Inicia a amostragem de uma execucao
+ *
+ * @param config Configuracao (NULL = opt_trace_default())
+ * @param direction Direcao da otimizacao
+ * @return OptTracer Estado a passar para as demais opt_tracer_*
+ */
+OptTracer opt_tracer_begin(const OptTraceConfig *config, OptDirection direction);
+
+/**
+ * @brief Cria o OptResult com o historico dimensionado pelo modo
+ *
+ * FULL: max_iterations doubles; RING: capacity doubles + iteracoes;
+ * NONE: nenhum.
+ */
+OptResult opt_tracer_create_result(const OptTracer *tracer, size_t max_iterations);
+
+/**
+ * @brief Registra o fim de uma iteracao
+ *
+ * @param tracer Estado da execucao
+ * @param result Resultado criado por opt_tracer_create_result
+ * @param iteration Iteracao (0-based, crescente)
+ * @param best_cost Melhor custo ate aqui
+ * @param evaluations Avaliacoes ate aqui
+ *
+ * Complexidade: O(1)
+ */
+void opt_tracer_record(OptTracer *tracer, OptResult *result, size_t iteration,
+                       double best_cost, size_t evaluations);
+
+/**
+ * @brief Fecha a amostragem: amostra a ultima iteracao e ordena o anel
+ *
+ * No modo RING, convergence e convergence_iterations ficam em ordem
+ * cronologica e convergence_size passa a ser o numero de amostras.
+ */
+void opt_tracer_finish(OptTracer *tracer, OptResult *result);
+
+// ============================================================================
+// GERADOR DE NUMEROS ALEATORIOS (OptRng)
+// ============================================================================
+
+/**
+ * @brief Estado explicito de um stream xoshiro256**
+ *
+ * Periodo 2^256 - 1, 32 bytes de estado, poucas instrucoes por numero.
+ * Cada OptRng e independente: pode viver na pilha, em uma Config ou
+ * por thread, sem estado global compartilhado.
+ *
+ * Ref: Blackman, D. & Vigna, S. (2021). "Scrambled Linear Pseudorandom
+ * Number Generators". ACM TOMS 47(4).
+ */
+typedef struct {
+    uint64_t s[4];       /**< Estado xoshiro256** */
+    double spare;        /**< Segundo gaussiano do metodo polar */
+    int has_spare;       /**< spare valido? */
+} OptRng;
+
+/**
+ * @brief Semeia o stream (estado expandido via splitmix64)
+ *
+ * @param rng Stream a semear
+ * @param seed Semente (qualquer valor, inclusive 0)
+ */
+void opt_rng_seed(OptRng *rng, uint64_t seed);
+
+/**
+ * @brief Avanca o stream 2^128 passos
+ *
+ * Para streams paralelos nao sobrepostos: copie o stream e chame
+ * opt_rng_jump no original antes de cada nova copia.
+ */
+void opt_rng_jump(OptRng *rng);
+
+/**
+ * @brief Proximos 64 bits aleatorios
+ */
+uint64_t opt_rng_next(OptRng *rng);
+
+/**
+ * @brief Uniforme em [0, 1) com 53 bits de mantissa
+ */
+double opt_rng_uniform(OptRng *rng);
+
+/**
+ * @brief Inteiro uniforme em [min, max] (inclusive, sem vies de modulo)
+ *
+ * Ref: Lemire, D. (2019). "Fast Random Integer Generation in an Interval"
+ */
+int opt_rng_int(OptRng *rng, int min, int max);
+
+/**
+ * @brief Gaussiano N(0,1) pelo metodo polar de Marsaglia
+ */
+double opt_rng_gaussian(OptRng *rng);
+
+/**
+ * @brief Preenche out[0..n) com uniformes em [lo, hi)
+ */
+void opt_rng_fill_uniform(OptRng *rng, double *out, size_t n, double lo, double hi);
+
+/**
+ * @brief Preenche out[0..n) com gaussianos N(0,1)
+ */
+void opt_rng_fill_gaussian(OptRng *rng, double *out, size_t n);
+
+/**
+ * @brief Stream padrao da thread chamadora (usado por opt_random_*)
+ *
+ * Cada thread tem seu proprio stream, entao operadores builtin (vizinhancas,
+ * crossover, mutacao) podem rodar em paralelo sem disputa.
+ */
+OptRng* opt_rng_thread(void);
+
+/**
+ * @brief Escolhe o stream de uma execucao a partir de uma Config
+ *
+ * Semeia o stream da thread com seed (callbacks que usam opt_random_*
+ * ficam reproduziveis) e retorna rng, ou o stream da thread se rng for NULL.
+ *
+ * @param rng Stream proprio da Config (pode ser NULL)
+ * @param seed Semente da Config
+ * @return OptRng* Stream a ser usado pelo algoritmo
+ */
+OptRng* opt_rng_select(OptRng *rng, unsigned seed);
+
 // ============================================================================
 // UTILIDADES
 // ============================================================================
 
 /**
- * @brief Seta seed global para funcoes de otimizacao
+ * @brief Seta seed do stream da thread para funcoes de otimizacao
  *
  * @param seed Semente para gerador de numeros aleatorios
  */
@@ -180,7 +652,7 @@ double opt_random_uniform(void);
 int opt_random_int(int min, int max);
 
 /**
- * @brief Retorna valor aleatorio gaussiano N(0,1) via Box-Muller
+ * @brief Retorna valor aleatorio gaussiano N(0,1) via metodo polar
  *
  * @return double Valor gaussiano
  */
@@ -0,0 +1,141 @@
+/**
+ * @file eval_cache.h
+ * @brief Cache LRU limitado de avaliacoes da funcao objetivo
+ *
+ * Memoiza uma ObjectiveFn cara (ex.: simulacao) para problemas discretos,
+ * em que GA e memetico costumam reavaliar individuos identicos. A chave e
+ * o hash FNV-1a de 64 bits dos bytes da solucao (ts_hash_bytes) e cada
+ * entrada guarda uma copia da solucao: colisoes de hash sao verificadas
+ * com memcmp e nunca devolvem o custo de outra solucao.
+ *
+ * O cache e ele proprio uma ObjectiveFn (opt_eval_cache_objective, com o
+ * cache como context), entao envolve qualquer algoritmo sem alterar sua
+ * interface. Pressupoe objetivo deterministico: o resultado do algoritmo
+ * e o mesmo com ou sem cache. Seguro para avaliacao paralela (pool global):
+ * a busca e a insercao sao protegidas por lock e a avaliacao roda fora
+ * dele.
+ *
+ * Uso tipico:
+ * @code
+ * OptEvalCache *cache = opt_eval_cache_create(4096, n * sizeof(int),
+ *                                             tsp_tour_cost, inst);
+ * OptResult r = ga_run(&cfg, n * sizeof(int), n, opt_eval_cache_objective,
+ *                      tsp_generate_random, ga_crossover_ox, ga_mutation_swap,
+ *                      NULL, cache);
+ * opt_eval_cache_report(cache, &r);   // num_evaluations = avaliacoes reais
+ * opt_eval_cache_destroy(cache);
+ * @endcode
+ *
+ * Atencao: o context repassado ao algoritmo passa a ser o cache; funcoes
+ * que recebem o context do problema (neighbor, generate, crossover...)
+ * devem ser envolvidas pelo usuario ou nao usar o context.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#ifndef OPT_EVAL_CACHE_H
+#define OPT_EVAL_CACHE_H
+
+#include "optimization/common.h"
+#include <stddef.h>
+#include <stdbool.h>
+
+// ============================================================================
+// TIPOS
+// ============================================================================
+
+/**
+ * @brief Cache LRU de avaliacoes (opaco)
+ */
+typedef struct OptEvalCache OptEvalCache;
+
+// ============================================================================
+// CRIACAO E DESTRUICAO
+// ============================================================================
+
+/**
+ * @brief Cria um cache com ate capacity solucoes de data_size bytes
+ *
+ * @param capacity Entradas maximas (a menos usada recentemente sai primeiro)
+ * @param data_size Bytes por solucao (os bytes hasheados e comparados)
+ * @param objective Funcao objetivo real
+ * @param context Contexto repassado a objective
+ * @return OptEvalCache* Cache ou NULL se falha / parametros invalidos
+ *
+ * Memoria: O(capacity * data_size)
+ */
+OptEvalCache* opt_eval_cache_create(size_t capacity, size_t data_size,
+                                    ObjectiveFn objective, const void *context);
+
+/**
+ * @brief Libera o cache
+ */
+void opt_eval_cache_destroy(OptEvalCache *cache);
+
+/**
+ * @brief Esvazia o cache e zera os contadores
+ */
+void opt_eval_cache_clear(OptEvalCache *cache);
+
+// ============================================================================
+// AVALIACAO
+// ============================================================================
+
+/**
+ * @brief ObjectiveFn memoizada: context deve ser o OptEvalCache*
+ *
+ * Hit devolve o custo guardado e move a entrada para o topo; miss chama
+ * a objective real e insere a solucao, expulsando a menos recente se o
+ * cache estiver cheio.
+ *
+ * Complexidade: O(data_size) esperado por chamada (+ objective no miss)
+ */
+double opt_eval_cache_objective(const void *solution_data, size_t size,
+                                const void *cache);
+
+/**
+ * @brief Consulta sem avaliar: copia o custo guardado em *cost se houver
+ *
+ * Um acerto move a entrada para o topo. Nao altera hits nem misses: serve
+ * para usar o cache como conjunto de solucoes visitadas (ex.: otimos
+ * locais no ILS).
+ *
+ * @return true se a solucao esta no cache
+ *
+ * Complexidade: O(data_size) esperado
+ */
+bool opt_eval_cache_lookup(OptEvalCache *cache, const void *solution_data, double *cost);
+
+/**
+ * @brief Guarda (ou atualiza) o custo de uma solucao ja avaliada
+ *
+ * Cheio, expulsa a menos recente. Nao altera hits nem misses.
+ *
+ * Complexidade: O(data_size) esperado
+ */
+void opt_eval_cache_store(OptEvalCache *cache, const void *solution_data, double cost);
+
+// ============================================================================
+// ESTATISTICAS
+// ============================================================================
+
+/** @brief Chamadas servidas pelo cache */
+size_t opt_eval_cache_hits(const OptEvalCache *cache);
+
+/** @brief Chamadas repassadas a objective real */
+size_t opt_eval_cache_misses(const OptEvalCache *cache);
+
+/** @brief Entradas armazenadas no momento */
+size_t opt_eval_cache_size(const OptEvalCache *cache);
+
+/**
+ * @brief Registra os contadores do cache no resultado de uma execucao
+ *
+ * num_evaluations passa a contar so as avaliacoes reais (misses) e
+ * num_cache_hits as servidas pelo cache. Os contadores sao acumulados
+ * desde a criacao (ou o ultimo clear): use um cache por execucao.
+ */
+void opt_eval_cache_report(const OptEvalCache *cache, OptResult *result);
+
+#endif /* OPT_EVAL_CACHE_H */
@@ -62,8 +62,13 @@ typedef struct {
     size_t neighbors_per_iter;     /**< Vizinhos avaliados por iteracao (steepest) */
     size_t num_restarts;           /**< Numero de restarts (random restart) */
     double stochastic_temperature; /**< Temperatura para variante estocastica */
+    MoveDeltaFn move_delta;        /**< Delta incremental do vizinho (NULL = neighbor + objective) */
+    MoveApplyFn move_apply;        /**< Aplica o movimento sorteado por move_delta ou neighborhood_scan */
+    NeighborhoodScanFn neighborhood_scan; /**< Varredura completa por deltas (exige move_apply; NULL = amostragem) */
+    size_t early_exit_min_size;    /**< n a partir do qual o steepest aceita o primeiro vizinho melhor (0 = nunca) */
     OptDirection direction;        /**< Minimizar ou maximizar */
     unsigned seed;                 /**< Semente RNG */
+    OptRng *rng;                   /**< Stream RNG proprio (NULL = stream da thread semeado com seed) */
 } HCConfig;
 
 // ============================================================================
@@ -74,7 +79,8 @@ typedef struct {
  * @brief Retorna configuracao padrao para Hill Climbing
  *
  * Defaults: steepest, 1000 iter, 20 vizinhos/iter, 10 restarts,
- * temp=1.0, minimize, seed=42
+ * temp=1.0, minimize, seed=42, amostragem com saida antecipada a partir
+ * de n = 1000
  *
  * @return HCConfig Configuracao padrao
  */
@@ -98,6 +104,22 @@ HCConfig hc_default_config(void);
  * @param context Contexto do problema (TSPInstance*, ContinuousInstance*, etc.)
  * @return OptResult Resultado com melhor solucao e historico
  *
+ * Com config->move_delta e config->move_apply definidos (ex.: tsp_move_2opt
+ * + tsp_move_apply), cada vizinho custa O(1) via delta e so o movimento
+ * aceito e aplicado; neighbor nao e usado. O custo final da melhor
+ * solucao e recalculado com objective.
+ *
+ * Avaliacao da vizinhanca no steepest e no first improvement:
+ * - Amostrada (padrao): neighbors_per_iter vizinhos sorteados. Com
+ *   solution_size >= early_exit_min_size o steepest para no primeiro
+ *   sorteado que melhora, como o first improvement.
+ * - Completa: com neighborhood_scan + move_apply (ex.: tsp_scan_2opt +
+ *   tsp_move_apply) a vizinhanca inteira e varrida por deltas, sem copiar
+ *   vizinhos; o steepest escolhe o melhor movimento (ou o primeiro que
+ *   melhora, de novo a partir de early_exit_min_size) e o first
+ *   improvement retoma a varredura de onde a anterior parou. Para quando
+ *   nenhum movimento melhora: otimo local exato da vizinhanca.
+ *
  * Complexidade: O(max_iterations * neighbors_per_iter * custo_objective)
  */
 OptResult hc_run(const HCConfig *config,
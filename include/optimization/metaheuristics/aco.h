@@ -83,8 +83,15 @@ typedef struct {
     double tau_min;           /**< Feromonio minimo (MMAS) */
     double tau_max;           /**< Feromonio maximo (MMAS) */
 
+    OptStopCriteria stop;     /**< Parada por tempo, avaliacoes ou custo alvo (zerado = so iteracoes) */
+    OptTraceConfig trace;     /**< Historico e callback de progresso (padrao = historico completo) */
     OptDirection direction;   /**< Minimizar ou maximizar */
     unsigned seed;            /**< Semente RNG */
+    OptRng *rng;              /**< Stream RNG proprio (NULL = stream da thread semeado com seed) */
+    BatchObjectiveFn batch_objective; /**< Avaliacao em lote da populacao (NULL = objective por solucao) */
+    size_t num_threads;       /**< Threads na construcao das formigas (1 = serial, 0 = todas) */
+    size_t candidate_k;       /**< Candidatos por no na construcao (0 = varredura completa) */
+    const int *candidate_lists; /**< Listas n x candidate_k externas (ex.: TSPInstance.neighbors; NULL = k maiores eta) */
 } ACOConfig;
 
 // ============================================================================
@@ -95,7 +102,8 @@ typedef struct {
  * @brief Retorna configuracao padrao para ACO
  *
  * Defaults: n_ants=20, 500 iter, alpha=1.0, beta=3.0, rho=0.1,
- * Q=1.0, tau_0=0.1, AS variant, minimize, seed=42
+ * Q=1.0, tau_0=0.1, AS variant, 1 thread, sem candidatos, no stop criteria,
+ * minimize, seed=42
  *
  * @return ACOConfig Configuracao padrao
  */
@@ -115,7 +123,30 @@ ACOConfig aco_default_config(void);
  * @param context Contexto do problema (TSPInstance*, etc.)
  * @return OptResult Resultado (best.data = int* tour)
  *
- * Complexidade: O(max_iterations * n_ants * n_nodes^2)
+ * heuristic e chamada so na inicializacao: eta(i,j)^beta fica numa matriz
+ * n x n, e choice(i,j) = tau(i,j)^alpha * eta(i,j)^beta e recalculada uma
+ * vez por iteracao (sem pow() quando alpha = 1), entao a construcao so le
+ * linhas de choice. Memoria: 3 matrizes n x n de double.
+ *
+ * Com candidate_k = k > 0 (modo MMAS/ACS para instancias grandes), cada no
+ * so considera seus k candidatos: config->candidate_lists (ex.: listas kNN
+ * de tsp_build_neighbor_lists com o mesmo k) ou, se NULL, os k destinos de
+ * maior eta, escolhidos uma vez em O(n^2) chamadas de heuristic. Quando
+ * todos os candidatos ja foram visitados, a formiga vai para o nao visitado
+ * de maior eta (varredura O(n)). tau, eta^beta e choice guardam so as n*k
+ * arestas candidatas (deposito fora delas e descartado), entao memoria,
+ * evaporacao e atualizacao custam O(n*k).
+ *
+ * As formigas sao construidas (e, sem batch_objective, avaliadas) em
+ * paralelo em num_threads threads; objective deve ser thread-safe. Cada
+ * formiga tem um stream proprio derivado de seed por opt_rng_jump, entao
+ * o resultado nao depende do numero de threads. Com
+ * config->batch_objective a colonia e avaliada numa unica chamada apos a
+ * construcao.
+ *
+ * Complexidade: O(max_iterations * (n_ants * n_nodes^2 / num_threads + n_nodes^2));
+ * com candidatos, O(n_ants * n_nodes * k) por iteracao mais O(n_nodes) por
+ * fallback
  */
 OptResult aco_run(const ACOConfig *config,
                   size_t n_nodes,
@@ -67,8 +67,14 @@ typedef struct {
     double lower_bound;       /**< Limite inferior do dominio */
     double upper_bound;       /**< Limite superior do dominio */
 
+    OptStopCriteria stop;     /**< Parada por tempo, avaliacoes ou custo alvo (zerado = so iteracoes) */
+    OptTraceConfig trace;     /**< Historico e callback de progresso (padrao = historico completo) */
     OptDirection direction;   /**< Minimizar ou maximizar */
     unsigned seed;            /**< Semente RNG */
+    OptRng *rng;              /**< Stream RNG proprio (NULL = stream da thread semeado com seed) */
+    BatchObjectiveFn batch_objective; /**< Avaliacao em lote, com selecao sincrona (NULL = objective por trial, assincrona) */
+    bool parallel_generation; /**< Stream por individuo: trials (e avaliacao) paralelos e deterministicos */
+    size_t num_threads;       /**< Threads da geracao paralela (1 = serial, 0 = todas) */
 } DEConfig;
 
 // ============================================================================
@@ -79,7 +85,7 @@ typedef struct {
  * @brief Retorna configuracao padrao para DE
  *
  * Defaults: pop=50, gen=1000, F=0.8, CR=0.9, DE/rand/1,
- * bounds=[-5.12, 5.12], minimize, seed=42
+ * bounds=[-5.12, 5.12], geracao serial, no stop criteria, minimize, seed=42
  *
  * @return DEConfig Configuracao padrao
  */
@@ -98,7 +104,23 @@ DEConfig de_default_config(void);
  * @param context Contexto do problema (ContinuousInstance*, etc.)
  * @return OptResult Resultado com melhor solucao e historico
  *
- * Complexidade: O(max_gen * pop_size * D)
+ * Sem batch_objective e sem parallel_generation a selecao e assincrona
+ * (DE classico): cada trial e avaliado logo apos gerado e, se aceito, ja
+ * substitui o alvo e o melhor usados pelos individuos seguintes. Com
+ * config->batch_objective ou parallel_generation ela passa a sincrona:
+ * todos os trials da geracao sao gerados contra a populacao corrente e
+ * avaliados juntos (numa chamada de batch_objective, se definido), o que
+ * muda a trajetoria da busca em relacao ao modo assincrono. Mutacao, clamp
+ * e crossover de cada trial sao um unico laco sobre D sem desvios
+ * (vetorizado com OpenMP SIMD).
+ *
+ * Com config->parallel_generation, cada individuo tem seu stream
+ * (derivado de seed por opt_rng_jump) e os trials da geracao sao
+ * construidos (e, sem batch_objective, avaliados) em num_threads threads;
+ * objective deve ser thread-safe. O resultado nao depende do numero de
+ * threads, mas difere do modo serial (que usa um unico stream).
+ *
+ * Complexidade: O(max_gen * pop_size * D / num_threads)
  */
 OptResult de_run(const DEConfig *config,
                  size_t solution_size,
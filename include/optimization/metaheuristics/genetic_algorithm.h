@@ -23,8 +23,8 @@
  *       p1, p2 = select(P), select(P)
  *       c1, c2 = crossover(p1, p2) if rand() < p_c else copy(p1, p2)
  *       mutate(c1, p_m); mutate(c2, p_m)
- *       if local_search: improve(c1); improve(c2)
  *       P_new += [c1, c2]
+ *     evaluate(P_new)              // + local_search; paralelo no pool global
  *     P = P_new
  *   return best(P)
  *
@@ -41,6 +41,7 @@
 #define OPT_GENETIC_ALGORITHM_H
 
 #include "optimization/common.h"
+#include "optimization/checkpoint.h"
 #include <stddef.h>
 #include <stdbool.h>
 
@@ -57,6 +58,14 @@ typedef enum {
     GA_SELECT_RANK          /**< Rank-based selection */
 } GASelectionType;
 
+/**
+ * @brief Topologia de migracao do modelo de ilhas
+ */
+typedef enum {
+    GA_MIGRATION_RING,      /**< Ilha i envia para a ilha (i + 1) mod K */
+    GA_MIGRATION_FULL       /**< Cada ilha envia para todas as outras */
+} GAMigrationTopology;
+
 /**
  * @brief Funcao de crossover: combina dois pais em dois filhos
  *
@@ -82,18 +91,6 @@ typedef void (*CrossoverFn)(const void *parent1, const void *parent2,
 typedef void (*MutationFn)(void *solution, size_t size,
                            double mutation_rate, const void *context);
 
-/**
- * @brief Funcao de busca local (para GA memetico)
- *
- * @param solution Solucao a melhorar (in-place, dados + custo retornado)
- * @param size Dimensao logica
- * @param objective Funcao objetivo
- * @param context Contexto
- * @return double Novo custo apos busca local
- */
-typedef double (*LocalSearchFn)(void *solution, size_t size,
-                                ObjectiveFn objective, const void *context);
-
 /**
  * @brief Configuracao do Algoritmo Genetico
  */
@@ -109,12 +106,24 @@ typedef struct {
 
     bool enable_local_search;     /**< GA memetico */
 
+    size_t num_threads;           /**< Threads na avaliacao da populacao (1 = serial, 0 = todas) */
+
+    size_t num_islands;           /**< Subpopulacoes de population_size cada (1 = panmitico) */
+    size_t migration_interval;    /**< Geracoes entre migracoes */
+    size_t migration_count;       /**< Melhores individuos enviados por ilha e destino */
+    GAMigrationTopology migration_topology; /**< Destinos dos migrantes */
+
     bool enable_adaptive_rates;   /**< Adaptar crossover/mutation rates */
     double adaptive_min_mutation; /**< Taxa minima de mutacao adaptativa */
     double adaptive_max_mutation; /**< Taxa maxima de mutacao adaptativa */
 
+    OptStopCriteria stop;         /**< Parada por tempo, avaliacoes ou custo alvo (zerado = so iteracoes) */
+    OptTraceConfig trace;         /**< Historico e callback de progresso (padrao = historico completo) */
     OptDirection direction;       /**< Minimizar ou maximizar */
     unsigned seed;                /**< Semente RNG */
+    OptRng *rng;                  /**< Stream RNG proprio (NULL = stream da thread semeado com seed) */
+    BatchObjectiveFn batch_objective; /**< Avaliacao em lote da populacao (NULL = objective por solucao) */
+    OptCheckpointConfig checkpoint; /**< Checkpoint a cada interval geracoes e retomada (padrao = desligado) */
 } GAConfig;
 
 // ============================================================================
@@ -125,7 +134,9 @@ typedef struct {
  * @brief Retorna configuracao padrao para GA
  *
  * Defaults: pop=50, gen=500, pc=0.8, pm=0.05, elite=2,
- * tournament(k=3), no local search, no adaptive, minimize, seed=42
+ * tournament(k=3), no local search, no adaptive, 1 ilha (migracao em anel
+ * de 2 individuos a cada 25 geracoes), no stop criteria, sem checkpoint,
+ * minimize, seed=42
  *
  * @return GAConfig Configuracao padrao
  */
@@ -149,7 +160,33 @@ GAConfig ga_default_config(void);
  * @param context Contexto do problema
  * @return OptResult Resultado com melhor solucao e historico
  *
- * Complexidade: O(max_gen * pop_size * custo_objective)
+ * Cada geracao primeiro cria todos os filhos (selecao, crossover e mutacao
+ * consomem o RNG em ordem fixa) em linhas contiguas e depois avalia os
+ * novos individuos: com config->batch_objective, numa unica chamada; senao
+ * com objective por individuo. Com num_threads != 1, as chamadas de
+ * objective e local_search sao tarefas do pool global (data_structures/
+ * thread_pool.h) e devem ser thread-safe. Cada fitness vai para o slot do seu individuo, entao o
+ * resultado para uma seed nao depende do numero de threads.
+ *
+ * Com num_islands = K > 1 (modelo de ilhas), K populacoes de
+ * population_size evoluem independentes, distribuidas entre num_threads
+ * threads do pool global (0 = uma por ilha; avaliacao serial dentro de
+ * cada ilha). A cada
+ * migration_interval geracoes, cada ilha copia seus migration_count
+ * melhores sobre os piores dos destinos da topologia. Cada ilha tem streams
+ * proprios (selecao e opt_random_* dos operadores), derivados de seed por
+ * opt_rng_jump: o resultado tambem nao depende do numero de threads.
+ * result.convergence traz o melhor global; result.island_convergence o
+ * melhor de cada ilha por geracao.
+ *
+ * Com checkpoint.path, o estado (populacoes, melhores, taxas de mutacao,
+ * streams RNG, contadores e historico FULL) e gravado a cada
+ * checkpoint.interval geracoes e no fim; nas ilhas, no fim da primeira
+ * epoca que completar o intervalo. Com checkpoint.resume, a execucao
+ * continua do arquivo e chega ao mesmo resultado de uma ininterrupta
+ * (checkpoint.h); max_generations pode crescer entre as sessoes.
+ *
+ * Complexidade: O(max_gen * pop_size * custo_objective / num_threads)
  */
 OptResult ga_run(const GAConfig *config,
                  size_t element_size,
@@ -31,12 +31,17 @@
  *
  * Variantes:
  * - Reactive GRASP: ajusta alpha dinamicamente baseado em performance historica
+ * - Path-relinking: cada otimo local e religado a uma solucao do pool de
+ *   elite e, ao final, os pares de elite sao religados entre si
  *
  * Referencias:
  * - Feo, T. A. & Resende, M. G. C. (1995). "Greedy Randomized Adaptive
  *   Search Procedures". J. Global Optimization, 6(2), 109-133.
  * - Resende, M. G. C. & Ribeiro, C. C. (2003). "Greedy Randomized Adaptive
  *   Search Procedures". In Handbook of Metaheuristics, Ch. 8.
+ * - Resende, M. G. C. & Ribeiro, C. C. (2005). "GRASP with Path-Relinking:
+ *   Recent Advances and Applications". In Metaheuristics: Progress as Real
+ *   Problem Solvers, 29-63.
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
@@ -67,6 +72,28 @@
 typedef void (*GRASPConstructFn)(void *solution, size_t size,
                                  double alpha, const void *context);
 
+/**
+ * @brief Path-relinking de initial em direcao a guide
+ *
+ * Percorre a trajetoria que transforma initial em guide um atributo por vez
+ * e grava em best a melhor solucao intermediaria (excluindo os extremos).
+ *
+ * @param initial Solucao de partida
+ * @param guide Solucao guia
+ * @param best Buffer para a melhor intermediaria
+ * @param size Dimensao logica
+ * @param objective Funcao objetivo
+ * @param direction Minimizar ou maximizar
+ * @param context Contexto do problema
+ * @param evaluations Incrementado a cada avaliacao
+ * @return double Custo de best, ou o pior valor da direcao (-/+DBL_MAX) se
+ *         nao ha intermediaria
+ */
+typedef double (*GRASPRelinkFn)(const void *initial, const void *guide, void *best,
+                                size_t size, ObjectiveFn objective,
+                                OptDirection direction, const void *context,
+                                size_t *evaluations);
+
 /**
  * @brief Configuracao do GRASP
  */
@@ -76,13 +103,22 @@ typedef struct {
 
     size_t local_search_iterations;  /**< Iteracoes da busca local interna */
     size_t local_search_neighbors;   /**< Vizinhos por iteracao da busca local */
+    LocalSearchFn local_search;      /**< Busca local externa (NULL = busca interna por neighbor) */
 
     bool enable_reactive;            /**< Reactive GRASP (ajusta alpha) */
     size_t reactive_num_alphas;      /**< Numero de alphas candidatos */
     size_t reactive_block_size;      /**< Iteracoes por bloco de atualizacao */
 
+    size_t elite_size;               /**< Capacidade do pool de elite (0 = sem pool nem relinking) */
+    GRASPRelinkFn relink;            /**< Path-relinking com o pool (NULL = pool sem relinking) */
+    bool relink_elite_pairs;         /**< Pos-otimizacao: religar todos os pares de elite ao final */
+    size_t num_threads;              /**< Iteracoes no pool global (1 = serial, 0 = ds_get_num_threads()) */
+
+    OptStopCriteria stop;            /**< Parada por tempo, avaliacoes ou custo alvo (zerado = so iteracoes) */
+    OptTraceConfig trace;            /**< Historico e callback de progresso (padrao = historico completo) */
     OptDirection direction;          /**< Minimizar ou maximizar */
     unsigned seed;                   /**< Semente RNG */
+    OptRng *rng;                     /**< Stream RNG proprio (NULL = stream da thread semeado com seed) */
 } GRASPConfig;
 
 // ============================================================================
@@ -93,7 +129,8 @@ typedef struct {
  * @brief Retorna configuracao padrao para GRASP
  *
  * Defaults: 500 iter, alpha=0.3, LS 100 iter/20 neighbors,
- * no reactive, minimize, seed=42
+ * no reactive, sem pool de elite (relink_elite_pairs=true quando ligado),
+ * serial, no stop criteria, minimize, seed=42
  *
  * @return GRASPConfig Configuracao padrao
  */
@@ -111,11 +148,32 @@ GRASPConfig grasp_default_config(void);
  * @param solution_size Dimensao logica
  * @param objective Funcao objetivo
  * @param construct Funcao de construcao gulosa randomizada
- * @param neighbor Funcao de vizinhanca (para busca local interna)
+ * @param neighbor Funcao de vizinhanca (para busca local interna; NULL se config->local_search)
  * @param context Contexto do problema
  * @return OptResult Resultado com melhor solucao e historico
  *
- * Complexidade: O(max_iterations * (construcao + LS_iterations * neighbors))
+ * Com config->local_search definido, ele substitui a busca local interna
+ * (ex.: tsp_local_search) e conta como uma avaliacao por chamada.
+ *
+ * Com elite_size > 0, os otimos locais disputam um pool de elite (sem
+ * duplicatas; um novo entra no lugar do pior se for melhor que ele). Com
+ * relink definido, cada otimo local e religado a uma elite sorteada, do
+ * melhor dos dois para o pior (backward relinking); a melhor intermediaria
+ * recebe busca local e substitui o otimo se o superar. Com
+ * relink_elite_pairs, ao final todos os pares de elite sao religados e o
+ * melhor resultado (apos busca local) entra na disputa pelo melhor global.
+ *
+ * Com num_threads != 1 e mais de uma thread no pool (data_structures/
+ * thread_pool.h), as iteracoes rodam em rodadas de 2 por thread: alpha e
+ * uma semente do stream da thread sao sorteados antes, cada iteracao
+ * constroi, busca e religa em paralelo, e o pool de elite e compartilhado
+ * sob um mutex. Historico, reativo e parada sao processados na ordem das
+ * iteracoes ao fim de cada rodada. Como a elite sorteada depende de quem
+ * terminou antes, o resultado com pool de elite pode variar entre
+ * execucoes paralelas. construct, objective, neighbor, local_search e
+ * relink precisam ser seguros para chamadas concorrentes.
+ *
+ * Complexidade: O(max_iterations * (construcao + LS_iterations * neighbors + relink))
  */
 OptResult grasp_run(const GRASPConfig *config,
                     size_t element_size,
@@ -159,4 +217,33 @@ void grasp_construct_tsp_nn(void *solution, size_t size,
 void grasp_construct_continuous(void *solution, size_t size,
                                 double alpha, const void *context);
 
+// ============================================================================
+// PATH-RELINKING BUILTIN
+// ============================================================================
+
+/**
+ * @brief Path-relinking por trocas para permutacoes (int* com valores 0..n-1)
+ *
+ * Da esquerda para a direita, cada posicao que difere do guia recebe o
+ * valor do guia por uma troca; cada passo gera e avalia uma intermediaria.
+ *
+ * Complexidade: O(n) avaliacoes
+ */
+double grasp_relink_permutation(const void *initial, const void *guide, void *best,
+                                size_t size, ObjectiveFn objective,
+                                OptDirection direction, const void *context,
+                                size_t *evaluations);
+
+/**
+ * @brief Path-relinking para vetores continuos (double*)
+ *
+ * Copia as coordenadas do guia uma por vez, avaliando cada intermediaria.
+ *
+ * Complexidade: O(D) avaliacoes
+ */
+double grasp_relink_continuous(const void *initial, const void *guide, void *best,
+                               size_t size, ObjectiveFn objective,
+                               OptDirection direction, const void *context,
+                               size_t *evaluations);
+
 #endif /* OPT_GRASP_H */
@@ -10,6 +10,13 @@
  * - Always: aceita sempre (random walk)
  * - SA-like: aceita piores com probabilidade decrescente
  * - Restart: reinicia apos k iteracoes sem melhoria
+ * - Late acceptance: aceita se nao pior que o custo de L iteracoes atras
+ * - LSMC: aceita piores com exp(-delta/T) a temperatura fixa
+ *
+ * Opcionalmente, os otimos locais vao para um conjunto de visitados
+ * (hash + memcmp, LRU limitado) e a forca da perturbacao se adapta:
+ * sobe ao reencontrar um otimo, volta a base ao melhorar e desce aos
+ * poucos quando o salto leva a um otimo novo porem pior.
  *
  * Pseudocodigo (Lourenco et al., 2003):
  *   s = LOCAL-SEARCH(generate())
@@ -25,6 +32,12 @@
  * - Lourenco, H. R., Martin, O. C. & Stutzle, T. (2003).
  *   "Iterated Local Search". In Handbook of Metaheuristics, Ch. 11.
  * - Talbi, E.-G. (2009). Metaheuristics: From Design to Implementation, Ch. 3
+ * - Martin, O., Otto, S. W. & Felten, E. W. (1991). "Large-Step Markov
+ *   Chains for the Traveling Salesman Problem". Complex Systems, 5(3).
+ * - Burke, E. K. & Bykov, Y. (2017). "The Late Acceptance Hill-Climbing
+ *   Heuristic". European J. Operational Research, 258(1).
+ * - Battiti, R. & Protasi, M. (1997). "Reactive Search, a History-Based
+ *   Heuristic for MAX-SAT". ACM J. Experimental Algorithmics, 2.
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
@@ -48,7 +61,9 @@ typedef enum {
     ILS_ACCEPT_BETTER,     /**< Aceita apenas se estritamente melhor */
     ILS_ACCEPT_ALWAYS,     /**< Aceita sempre (random walk) */
     ILS_ACCEPT_SA_LIKE,    /**< Aceita piores com prob exp(-delta/T), T decresce */
-    ILS_ACCEPT_RESTART     /**< Reinicia do melhor apos k iter sem melhoria */
+    ILS_ACCEPT_RESTART,    /**< Reinicia do melhor apos k iter sem melhoria */
+    ILS_ACCEPT_LATE,       /**< Late acceptance: nao pior que o custo corrente de history_length iter atras */
+    ILS_ACCEPT_LSMC        /**< Large-step Markov chain: exp(-delta/lsmc_temperature), T fixa */
 } ILSAcceptance;
 
 /**
@@ -58,15 +73,25 @@ typedef struct {
     size_t max_iterations;           /**< Iteracoes maximas do loop principal */
     size_t local_search_iterations;  /**< Iteracoes da busca local interna */
     size_t local_search_neighbors;   /**< Vizinhos por iteracao da busca local */
+    LocalSearchFn local_search;      /**< Busca local externa (NULL = busca interna por neighbor) */
     int perturbation_strength;       /**< Forca da perturbacao (passada ao PerturbFn) */
 
     ILSAcceptance acceptance;        /**< Criterio de aceitacao */
     double sa_initial_temp;          /**< Temp inicial para SA-like acceptance */
     double sa_alpha;                 /**< Fator de resfriamento para SA-like */
     size_t restart_threshold;        /**< Iter sem melhoria para restart */
+    size_t history_length;           /**< Comprimento L do historico (ILS_ACCEPT_LATE) */
+    double lsmc_temperature;         /**< Temperatura fixa (ILS_ACCEPT_LSMC) */
+
+    bool adaptive_perturbation;      /**< Forca adaptativa entre perturbation_strength e o maximo */
+    int perturbation_max_strength;   /**< Forca maxima da perturbacao adaptativa */
+    size_t visited_capacity;         /**< Otimos locais lembrados (0 = sem conjunto de visitados) */
 
+    OptStopCriteria stop;            /**< Parada por tempo, avaliacoes ou custo alvo (zerado = so iteracoes) */
+    OptTraceConfig trace;            /**< Historico e callback de progresso (padrao = historico completo) */
     OptDirection direction;          /**< Minimizar ou maximizar */
     unsigned seed;                   /**< Semente RNG */
+    OptRng *rng;                     /**< Stream RNG proprio (NULL = stream da thread semeado com seed) */
 } ILSConfig;
 
 // ============================================================================
@@ -77,7 +102,8 @@ typedef struct {
  * @brief Retorna configuracao padrao para ILS
  *
  * Defaults: 1000 iter, LS 200 iter / 20 neighbors, strength=1,
- * accept better, minimize, seed=42
+ * accept better, history=50, lsmc T=1.0, forca fixa (max=10 se adaptativa),
+ * sem visitados, no stop criteria, minimize, seed=42
  *
  * @return ILSConfig Configuracao padrao
  */
@@ -100,6 +126,15 @@ ILSConfig ils_default_config(void);
  * @param context Contexto do problema
  * @return OptResult Resultado com melhor solucao e historico
  *
+ * Com config->local_search definido, ele substitui a busca local interna
+ * (ex.: tsp_local_search) e conta como uma avaliacao por chamada.
+ *
+ * Com visited_capacity > 0, cada otimo local e guardado com o seu custo
+ * (eval_cache.h). Uma perturbacao que cai num otimo ja visitado reaproveita
+ * o custo guardado e pula avaliacao e busca local (contada em
+ * result.num_cache_hits). Reencontrar um otimo pela busca local tambem
+ * conta como revisita para a forca adaptativa.
+ *
  * Complexidade: O(max_iterations * local_search_iterations * neighbors)
  */
 OptResult ils_run(const ILSConfig *config,
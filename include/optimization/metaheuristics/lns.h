@@ -47,6 +47,7 @@
 #define OPT_LNS_H
 
 #include "optimization/common.h"
+#include "optimization/checkpoint.h"
 #include <stddef.h>
 #include <stdbool.h>
 
@@ -117,8 +118,12 @@ typedef struct {
     size_t weight_update_interval;   /**< Intervalo de atualizacao de pesos (ALNS) */
     double weight_decay;             /**< Fator de decaimento de pesos (ALNS, 0.0-1.0) */
 
+    OptStopCriteria stop;            /**< Parada por tempo, avaliacoes ou custo alvo (zerado = so iteracoes) */
+    OptTraceConfig trace;            /**< Historico e callback de progresso (padrao = historico completo) */
     OptDirection direction;          /**< Minimizar ou maximizar */
     unsigned seed;                   /**< Semente RNG */
+    OptRng *rng;                     /**< Stream RNG proprio (NULL = stream da thread semeado com seed) */
+    OptCheckpointConfig checkpoint;  /**< Checkpoint a cada interval iteracoes e retomada (ALNS; padrao = desligado) */
 } LNSConfig;
 
 // ============================================================================
@@ -129,7 +134,7 @@ typedef struct {
  * @brief Retorna configuracao padrao para LNS
  *
  * Defaults: 1000 iter, degree=0.3, basic, accept better,
- * SA T0=100 alpha=0.99, minimize, seed=42
+ * SA T0=100 alpha=0.99, no stop criteria, sem checkpoint, minimize, seed=42
  *
  * @return LNSConfig Configuracao padrao
  */
@@ -175,6 +180,21 @@ OptResult lns_run(const LNSConfig *config,
  * @param repair_ops Array de funcoes repair
  * @param context Contexto do problema
  * @return OptResult Resultado com melhor solucao e historico
+ *
+ * A roleta de cada familia usa uma arvore de Fenwick sobre os pesos:
+ * sorteio em O(log k), reconstruida em O(k) a cada weight_update_interval.
+ * result.operator_stats traz chamadas, novas melhores, melhorias, aceites,
+ * tempo de parede e peso final de cada operador: destroy_ops em
+ * [0, num_destroy_ops), repair_ops em [num_destroy_ops, num_operators).
+ *
+ * Com checkpoint.path, solucao corrente, melhor, temperatura, pesos,
+ * scores do periodo, operator_stats, streams RNG, contadores e historico
+ * FULL sao gravados a cada checkpoint.interval iteracoes e no fim. Com
+ * checkpoint.resume, a execucao continua do arquivo com o mesmo resultado
+ * de uma ininterrupta (checkpoint.h); max_iterations pode crescer entre as
+ * sessoes.
+ *
+ * Complexidade: O(max_iter * (log k + destroy + repair + objective))
  */
 OptResult alns_run(const LNSConfig *config,
                    size_t element_size,
@@ -207,6 +227,40 @@ void lns_repair_tsp_greedy(const void *destroyed, void *repaired, size_t size,
 void lns_destroy_tsp_worst(const void *solution, void *destroyed, size_t size,
                            double degree, const void *context);
 
+/**
+ * @brief Repair regret-2 para TSP: insere primeiro a cidade com maior regret
+ *
+ * Regret-k de uma cidade pendente = soma, para h = 2..k, da diferenca entre
+ * o h-esimo e o melhor custo de insercao entre as arestas do tour parcial.
+ * A cidade de maior regret (empate: menor custo) entra na sua melhor
+ * aresta. As k melhores arestas de cada pendente ficam em cache, com as
+ * cidades numa fila de prioridade (heap binario, entradas invalidadas por
+ * versao). Uma insercao em (u, w) so remove (u, w) e cria (u, x), (x, w):
+ * cada pendente afetada testa as duas arestas novas em O(k) e so recalcula
+ * se (u, w) estava entre as suas k melhores.
+ *
+ * Com listas de vizinhos (tsp_build_neighbor_lists) as candidatas de uma
+ * cidade sao as arestas que tocam seus vizinhos ja no tour (varredura
+ * completa se houver menos de k), e uma insercao so visita as pendentes
+ * que tem u, x ou w como vizinho. Sem listas, todas as pendentes sao
+ * visitadas e o recalculo percorre o tour parcial.
+ *
+ * Referencia: Potvin, J.-Y. & Rousseau, J.-M. (1993). "A parallel route
+ * building algorithm for the vehicle routing and scheduling problem with
+ * time windows". EJOR 66(3).
+ *
+ * Complexidade: O(m * K * (K + log m)) com listas de K vizinhos (m removidas);
+ *               O(m^2 + m * n_recalc * n) sem listas
+ */
+void lns_repair_tsp_regret2(const void *destroyed, void *repaired, size_t size,
+                            const void *context);
+
+/**
+ * @brief Repair regret-3 para TSP (ver lns_repair_tsp_regret2)
+ */
+void lns_repair_tsp_regret3(const void *destroyed, void *repaired, size_t size,
+                            const void *context);
+
 /**
  * @brief Repair random para TSP: insere cidades removidas em posicoes aleatorias
  */
@@ -93,12 +93,20 @@ typedef struct {
 
     size_t ls_iterations;          /**< Iteracoes da busca local */
     size_t ls_neighbors;           /**< Vizinhos por iteracao da busca local */
+    LocalSearchFn local_search;    /**< Busca local externa (NULL = busca interna por neighbor) */
     double ls_probability;         /**< Probabilidade de aplicar LS a cada individuo (0.0-1.0) */
 
     bool ls_on_initial;            /**< Aplicar LS na populacao inicial */
+    size_t ls_budget;              /**< Avaliacoes maximas da busca local interna por individuo (0 = sem limite) */
+    double ls_top_fraction;        /**< Fracao p dos melhores que recebe busca local (1.0 = todos) */
+    size_t num_threads;            /**< Busca local no pool global (1 = serial, 0 = ds_get_num_threads()) */
 
+    OptStopCriteria stop;          /**< Parada por tempo, avaliacoes ou custo alvo (zerado = so iteracoes) */
+    OptTraceConfig trace;          /**< Historico e callback de progresso (padrao = historico completo) */
     OptDirection direction;        /**< Minimizar ou maximizar */
     unsigned seed;                 /**< Semente RNG */
+    OptRng *rng;                   /**< Stream RNG proprio (NULL = stream da thread semeado com seed) */
+    BatchObjectiveFn batch_objective; /**< Avaliacao em lote da populacao (NULL = objective por solucao) */
 } MAConfig;
 
 // ============================================================================
@@ -110,7 +118,8 @@ typedef struct {
  *
  * Defaults: pop=50, gen=200, pc=0.8, pm=0.05, elite=2,
  * tournament(k=3), Lamarckian, LS 50 iter / 10 neighbors,
- * ls_prob=1.0, ls_on_initial=true, minimize, seed=42
+ * ls_prob=1.0, ls_on_initial=true, sem budget, top_fraction=1.0,
+ * serial, no stop criteria, minimize, seed=42
  *
  * @return MAConfig Configuracao padrao
  */
@@ -130,10 +139,30 @@ MAConfig ma_default_config(void);
  * @param generate Funcao geradora
  * @param crossover Funcao de crossover
  * @param mutate Funcao de mutacao
- * @param neighbor Funcao de vizinhanca (para busca local)
+ * @param neighbor Funcao de vizinhanca (para busca local; NULL se config->local_search)
  * @param context Contexto do problema
  * @return OptResult Resultado com melhor solucao e historico
  *
+ * Os filhos de cada geracao sao gerados em sequencia e avaliados juntos
+ * (numa chamada de config->batch_objective, se definido) antes da busca
+ * local, que continua usando objective por vizinho.
+ *
+ * Com config->local_search definido, ele substitui a busca local interna
+ * (ex.: tsp_local_search) e conta como uma avaliacao por chamada; na
+ * aprendizagem baldwiniana roda sobre uma copia e so o custo e mantido.
+ * ls_budget limita so a busca interna (a externa e opaca).
+ *
+ * Com ls_top_fraction < 1, depois da avaliacao so os ceil(p * n) melhores
+ * filhos (e da populacao inicial) sorteados para LS sao refinados; os
+ * demais seguem com o custo da avaliacao.
+ *
+ * Com num_threads != 1 e mais de uma thread no pool (data_structures/
+ * thread_pool.h), a busca local dos individuos roda em paralelo. Cada um
+ * recebe uma semente do stream da execucao e semeia com ela o stream da
+ * thread durante a sua busca: o resultado e o mesmo com qualquer numero de
+ * threads, mas difere do modo serial. objective, neighbor e local_search
+ * precisam ser seguros para chamadas concorrentes.
+ *
  * Complexidade: O(max_gen * pop_size * (crossover + LS_iter * LS_neighbors))
  */
 OptResult ma_run(const MAConfig *config,
@@ -11,6 +11,8 @@
  * Variantes adicionais:
  * - Reheating: reaquece quando taxa de aceitacao cai abaixo de limiar
  * - Auto-calibrate T0: determina T0 automaticamente para ~80% de aceitacao
+ * - Parallel tempering (replica exchange): M cadeias a temperaturas fixas
+ *   rodando em paralelo, trocando estados entre temperaturas vizinhas
  *
  * Pseudocodigo (Kirkpatrick et al., 1983):
  *   s = generate()
@@ -29,6 +31,10 @@
  *   "Optimization by Simulated Annealing". Science, 220(4598), 671-680.
  * - Cerny, V. (1985). "Thermodynamical Approach to the Traveling Salesman Problem"
  * - Hajek, B. (1988). "Cooling Schedules for Optimal Annealing"
+ * - Swendsen, R. H. & Wang, J.-S. (1986). "Replica Monte Carlo Simulation
+ *   of Spin-Glasses". Physical Review Letters, 57(21), 2607-2609.
+ * - Earl, D. J. & Deem, M. W. (2005). "Parallel tempering: Theory,
+ *   applications, and new perspectives". PCCP, 7(23), 3910-3916.
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
@@ -77,8 +83,17 @@ typedef struct {
     double adaptive_target_high;   /**< Limite superior taxa de aceitacao (adaptive) */
     double adaptive_factor;        /**< Fator de ajuste (adaptive, ex: 1.05) */
 
+    size_t num_replicas;           /**< Parallel tempering: replicas a temperatura fixa (<= 1 = SA classico) */
+    double pt_cold_acceptance;     /**< Aceitacao alvo da replica mais fria na calibracao da escada (0.01) */
+    size_t num_threads;            /**< Threads do parallel tempering (1 = serial, 0 = uma por replica) */
+
+    MoveDeltaFn move_delta;        /**< Delta incremental do vizinho (NULL = neighbor + objective) */
+    MoveApplyFn move_apply;        /**< Aplica o movimento sorteado por move_delta */
+    OptStopCriteria stop;          /**< Parada por tempo, avaliacoes ou custo alvo (zerado = so iteracoes) */
+    OptTraceConfig trace;          /**< Historico e callback de progresso (padrao = historico completo) */
     OptDirection direction;        /**< Minimizar ou maximizar */
     unsigned seed;                 /**< Semente RNG */
+    OptRng *rng;                   /**< Stream RNG proprio (NULL = stream da thread semeado com seed) */
 } SAConfig;
 
 // ============================================================================
@@ -89,7 +104,8 @@ typedef struct {
  * @brief Retorna configuracao padrao para Simulated Annealing
  *
  * Defaults: T0=100, Tmin=0.001, alpha=0.95, geometric, 10000 iter,
- * L=50, no reheating, no auto-calibrate, minimize, seed=42
+ * L=50, no reheating, no auto-calibrate, 1 replica, no stop criteria,
+ * minimize, seed=42
  *
  * @return SAConfig Configuracao padrao
  */
@@ -111,7 +127,25 @@ SAConfig sa_default_config(void);
  * @param context Contexto do problema
  * @return OptResult Resultado com melhor solucao e historico
  *
- * Complexidade: O(max_iterations * custo_objective)
+ * Com config->move_delta e config->move_apply definidos, cada vizinho
+ * custa O(1) via delta (tambem na calibracao de T0) e so os movimentos
+ * aceitos sao aplicados; o custo final da melhor solucao e recalculado.
+ *
+ * Com num_replicas = M > 1 roda parallel tempering em vez do resfriamento:
+ * M replicas a temperaturas fixas em escada geometrica entre T_frio e
+ * T_quente. Com auto_calibrate_t0, T_quente = sa_calibrate_t0 (aceitacao
+ * target_acceptance) e T_frio = sa_calibrate_t0 com aceitacao
+ * pt_cold_acceptance; senao initial_temp e final_temp. A cada
+ * markov_chain_length passos (em paralelo no pool global, ate num_threads
+ * threads), pares de temperaturas vizinhas (pares e impares alternados)
+ * trocam estados com probabilidade min(1, exp((1/T_i - 1/T_j) * (E_i - E_j))).
+ * max_iterations conta passos por replica. Cada replica tem streams
+ * proprios (Metropolis e opt_random_* de neighbor/generate) derivados de
+ * seed por opt_rng_jump: o resultado nao depende do numero de threads.
+ * neighbor, objective e move_delta/move_apply devem ser thread-safe.
+ *
+ * Complexidade: O(max_iterations * custo_objective), vezes M / num_threads
+ * no parallel tempering
  */
 OptResult sa_run(const SAConfig *config,
                  size_t element_size,
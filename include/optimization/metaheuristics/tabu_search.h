@@ -9,8 +9,14 @@
  * - Memoria de medio prazo (frequencia) para intensificacao
  * - Tabu tenure reativo (ajusta dinamicamente baseado em ciclagem)
  *
- * A lista tabu armazena hashes de solucoes (solution-based tabu) em vez
- * de move-based tabu, tornando o algoritmo generico para qualquer problema.
+ * Por padrao a lista tabu armazena hashes de solucoes (solution-based
+ * tabu), tornando o algoritmo generico para qualquer problema. Com
+ * movimentos (move_delta/move_apply) e move_attributes definidos, usa
+ * tabu por atributos (move-based): os atributos desfeitos por um movimento
+ * (ex.: arestas removidas por um 2-opt) ficam tabu por tenure iteracoes
+ * numa matriz attribute_dim x attribute_dim, e um movimento e tabu se
+ * recriar algum deles. A verificacao e O(1) e dispensa materializar e
+ * fazer hash dos candidatos.
  *
  * Pseudocodigo (Glover, 1986):
  *   s = generate()
@@ -54,6 +60,41 @@
  */
 typedef uint64_t (*TabuHashFn)(const void *solution_data, size_t size);
 
+/** @brief Maximo de atributos criados/desfeitos por movimento */
+#define TS_MAX_MOVE_ATTRIBUTES 4
+
+/**
+ * @brief Atributo de movimento: celula (u, v) da matriz de tenure
+ *
+ * Para TSP, uma aresta com u < v.
+ */
+typedef struct {
+    size_t u;
+    size_t v;
+} TabuAttribute;
+
+/**
+ * @brief Atributos de um movimento (modo move-based)
+ */
+typedef struct {
+    size_t num_added;                               /**< Atributos criados */
+    size_t num_dropped;                             /**< Atributos desfeitos */
+    TabuAttribute added[TS_MAX_MOVE_ATTRIBUTES];    /**< Tabu se algum estiver marcado */
+    TabuAttribute dropped[TS_MAX_MOVE_ATTRIBUTES];  /**< Marcados tabu apos o movimento */
+} TabuMoveAttributes;
+
+/**
+ * @brief Extrai os atributos de um movimento sobre current
+ *
+ * @param current Solucao atual (antes do movimento)
+ * @param size Dimensao logica
+ * @param move Movimento produzido por MoveDeltaFn
+ * @param attrs Saida: atributos criados e desfeitos (u, v < attribute_dim)
+ * @param context Contexto do problema
+ */
+typedef void (*TabuAttributeFn)(const void *current, size_t size, const OptMove *move,
+                                TabuMoveAttributes *attrs, const void *context);
+
 /**
  * @brief Configuracao do Tabu Search
  */
@@ -77,8 +118,15 @@ typedef struct {
     size_t min_tenure;              /**< Tenure minimo (reativo) */
     size_t max_tenure;              /**< Tenure maximo (reativo) */
 
+    MoveDeltaFn move_delta;         /**< Delta incremental do vizinho (NULL = neighbor + objective) */
+    MoveApplyFn move_apply;         /**< Aplica o movimento sorteado por move_delta */
+    TabuAttributeFn move_attributes; /**< Tabu por atributos (NULL = por hash de solucao; requer move_delta) */
+    size_t attribute_dim;           /**< Lado da matriz de tenure (0 = solution_size) */
+    OptStopCriteria stop;           /**< Parada por tempo, avaliacoes ou custo alvo (zerado = so iteracoes) */
+    OptTraceConfig trace;           /**< Historico e callback de progresso (padrao = historico completo) */
     OptDirection direction;         /**< Minimizar ou maximizar */
     unsigned seed;                  /**< Semente RNG */
+    OptRng *rng;                    /**< Stream RNG proprio (NULL = stream da thread semeado com seed) */
 } TSConfig;
 
 // ============================================================================
@@ -89,7 +137,8 @@ typedef struct {
  * @brief Retorna configuracao padrao para Tabu Search
  *
  * Defaults: 5000 iter, 20 candidates, tenure=15, aspiration=true,
- * no diversification, no intensification, no reactive, minimize, seed=42
+ * no diversification, no intensification, no reactive, solution-hash tabu,
+ * no stop criteria, minimize, seed=42
  *
  * @return TSConfig Configuracao padrao
  */
@@ -112,6 +161,13 @@ TSConfig ts_default_config(void);
  * @param context Contexto do problema
  * @return OptResult Resultado com melhor solucao e historico
  *
+ * Com config->move_delta e config->move_apply definidos, os candidatos sao
+ * avaliados por delta; sem diversificacao so sao materializados (para o
+ * hash tabu) em ordem de custo ate o primeiro admissivel. Com
+ * config->move_attributes, o teste tabu usa a matriz de atributos e so
+ * o movimento escolhido e aplicado; hash_fn fica restrito a memoria de
+ * frequencia e a deteccao de ciclagem do tenure reativo.
+ *
  * Complexidade: O(max_iterations * neighbors_per_iter * custo_objective)
  */
 OptResult ts_run(const TSConfig *config,
@@ -156,4 +212,27 @@ uint64_t ts_hash_int_array(const void *solution_data, size_t size);
  */
 uint64_t ts_hash_double_array(const void *solution_data, size_t size);
 
+// ============================================================================
+// ATRIBUTOS BUILTIN (TabuAttributeFn-compatible)
+// ============================================================================
+
+/**
+ * @brief Atributos de movimentos TSP (TSPMoveType de tsp_move_*): arestas
+ *
+ * dropped = arestas removidas do tour, added = arestas inseridas, como
+ * pares de cidades (u < v); arestas que o movimento mantem sao omitidas.
+ * Use com attribute_dim = 0 (n x n) e os movimentos tsp_move_2opt,
+ * tsp_move_swap ou tsp_move_or_opt + tsp_move_apply.
+ *
+ * @param current Tour atual (int*)
+ * @param n Numero de cidades
+ * @param move Movimento TSP
+ * @param attrs Saida: arestas criadas e desfeitas
+ * @param context TSPInstance* (nao usado)
+ *
+ * Complexidade: O(1)
+ */
+void ts_attributes_tsp(const void *current, size_t n, const OptMove *move,
+                       TabuMoveAttributes *attrs, const void *context);
+
 #endif /* OPT_TABU_SEARCH_H */
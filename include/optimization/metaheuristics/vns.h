@@ -10,6 +10,11 @@
  * O VNS opera sobre k vizinhancas de tamanho crescente. Quando a busca
  * local encontra melhoria, retorna para N_1. Sem melhoria, avanca para N_{k+1}.
  *
+ * Extensoes ortogonais a variante:
+ * - VNS reativa: sorteia k pela taxa de sucesso observada de cada vizinhanca
+ * - Replicated shaking (Parallel VNS): varios pontos de N_k por passo,
+ *   sacudidos e refinados em paralelo; o melhor decide a mudanca
+ *
  * A vizinhanca k eh implementada via NeighborFn com perturbacao de forca k:
  * o parametro `strength` do shake controla quantos passos de vizinhanca aplicar.
  *
@@ -31,6 +36,9 @@
  *   Principles and Applications". European J. Operational Research, 130(3).
  * - Hansen, P., Mladenovic, N. & Moreno Perez, J. A. (2010).
  *   "Variable Neighbourhood Search: Methods and Applications". Annals of OR.
+ * - Garcia-Lopez, F., Melian-Batista, B., Moreno-Perez, J. A. & Moreno-Vega,
+ *   J. M. (2002). "The Parallel Variable Neighborhood Search for the
+ *   p-Median Problem". J. Heuristics, 8(3), 375-388.
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
@@ -82,8 +90,18 @@ typedef struct {
 
     int vnd_num_neighborhoods;      /**< Numero de vizinhancas no VND (GVNS) */
 
+    MoveDeltaFn move_delta;         /**< Delta incremental do vizinho (NULL = neighbor + objective) */
+    MoveApplyFn move_apply;         /**< Aplica o movimento sorteado por move_delta */
+
+    bool reactive;                  /**< Sorteia k pela taxa de sucesso (false = k = 1, 2, ..., k_max) */
+    size_t shake_replicas;          /**< Pontos sacudidos por passo (1 = VNS classica) */
+    size_t num_threads;             /**< Replicas no pool global (1 = serial, 0 = ds_get_num_threads()) */
+
+    OptStopCriteria stop;           /**< Parada por tempo, avaliacoes ou custo alvo (zerado = so iteracoes) */
+    OptTraceConfig trace;           /**< Historico e callback de progresso (padrao = historico completo) */
     OptDirection direction;         /**< Minimizar ou maximizar */
     unsigned seed;                  /**< Semente RNG */
+    OptRng *rng;                    /**< Stream RNG proprio (NULL = stream da thread semeado com seed) */
 } VNSConfig;
 
 // ============================================================================
@@ -94,7 +112,8 @@ typedef struct {
  * @brief Retorna configuracao padrao para VNS
  *
  * Defaults: 1000 iter, k_max=5, LS 200 iter / 20 neighbors,
- * basic variant, minimize, seed=42
+ * basic variant, k sequencial, 1 replica, serial, no stop criteria,
+ * minimize, seed=42
  *
  * @return VNSConfig Configuracao padrao
  */
@@ -117,7 +136,25 @@ VNSConfig vns_default_config(void);
  * @param context Contexto do problema
  * @return OptResult Resultado com melhor solucao e historico
  *
- * Complexidade: O(max_iter * k_max * LS_iter * LS_neighbors)
+ * Com config->move_delta e config->move_apply definidos, a busca local
+ * (e o VND) avalia vizinhos por delta em O(1) e neighbor pode ser NULL.
+ *
+ * result.operator_stats traz uma entrada por vizinhanca (indice k - 1):
+ * calls = shakes em N_k, improvements = accepted = mudancas para a nova
+ * solucao, new_best, total_time_ms de shake + busca local, e weight = a
+ * probabilidade final de sorteio (1 / k_max sem reactive).
+ *
+ * Com reactive, cada passo sorteia k com peso (melhorias + 1) /
+ * (tentativas + 2), e a iteracao termina apos k_max falhas seguidas.
+ *
+ * Com shake_replicas = R > 1, cada passo gera R pontos de N_k (shake +
+ * busca local) e o melhor deles e comparado com a incumbente. Cada replica
+ * semeia o stream da thread com uma semente propria, entao o resultado e o
+ * mesmo em serie ou no pool (data_structures/thread_pool.h, usado com
+ * num_threads != 1); shake, objective, neighbor e move_* precisam ser
+ * seguros para chamadas concorrentes.
+ *
+ * Complexidade: O(max_iter * k_max * R * LS_iter * LS_neighbors)
  */
 OptResult vns_run(const VNSConfig *config,
                   size_t element_size,
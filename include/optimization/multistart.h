@@ -0,0 +1,190 @@
+/**
+ * @file multistart.h
+ * @brief Multi-start paralelo para meta-heuristicas de trajetoria
+ *
+ * Executa N copias independentes de um *_run (HC random restart, SA,
+ * ILS, GRASP, VNS, TS, ALNS ou qualquer funcao OptRunFn), cada uma com sua seed,
+ * distribuidas entre as threads do pool global (thread_pool.h). Retorna o
+ * resultado da melhor execucao e estatisticas do conjunto: media, desvio
+ * padrao, pior custo e time-to-target.
+ *
+ * Cada execucao i usa seed = base_seed + i: como os *_run semeiam o stream
+ * da propria thread (opt_rng_select), o resultado de cada execucao nao
+ * depende da thread em que rodou nem do numero de threads.
+ *
+ * Uso tipico:
+ * @code
+ * OptRunSpec spec = {0};
+ * spec.config = &sa_cfg;
+ * spec.element_size = n * sizeof(int);
+ * spec.solution_size = n;
+ * spec.objective = tsp_tour_cost;
+ * spec.neighbor = tsp_neighbor_2opt;
+ * spec.generate = tsp_generate_random;
+ * spec.context = inst;
+ *
+ * OptMultiStartConfig ms = opt_multistart_default_config();
+ * OptMultiStartResult r = opt_parallel_multistart(&ms, opt_run_sa, &spec);
+ * // r.best, r.mean_cost, r.std_cost ...
+ * opt_multistart_result_destroy(&r);
+ * @endcode
+ *
+ * Referencias:
+ * - Marti, R., Resende, M. G. C. & Ribeiro, C. C. (2013). "Multi-start
+ *   methods for combinatorial optimization". EJOR 226(1).
+ * - Aiex, R. M., Resende, M. G. C. & Ribeiro, C. C. (2007). "TTT plots:
+ *   a perl program to create time-to-target plots". Optim. Letters 1(4).
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#ifndef OPT_MULTISTART_H
+#define OPT_MULTISTART_H
+
+#include "optimization/common.h"
+#include "optimization/metaheuristics/grasp.h"
+#include "optimization/metaheuristics/vns.h"
+#include "optimization/metaheuristics/tabu_search.h"
+#include "optimization/metaheuristics/lns.h"
+#include <stddef.h>
+#include <stdbool.h>
+
+// ============================================================================
+// TIPOS
+// ============================================================================
+
+/**
+ * @brief Uma execucao independente: roda o algoritmo com a seed dada
+ *
+ * Chamada concorrentemente por varias threads: deve ser thread-safe e
+ * nao compartilhar estado mutavel entre execucoes.
+ *
+ * @param seed Semente desta execucao
+ * @param user_data Dados do usuario (read-only)
+ * @return OptResult Resultado da execucao (liberado pelo driver)
+ */
+typedef OptResult (*OptRunFn)(unsigned seed, const void *user_data);
+
+/**
+ * @brief Configuracao do multi-start
+ */
+typedef struct {
+    size_t num_runs;              /**< Execucoes independentes */
+    size_t num_threads;           /**< Threads (1 = serial, 0 = todas) */
+    unsigned base_seed;           /**< Execucao i usa base_seed + i */
+    OptDirection direction;       /**< Minimizar ou maximizar (escolha do melhor) */
+    bool use_target;              /**< Calcular time-to-target */
+    double target_cost;           /**< Custo alvo (atingido se <= no min, >= no max) */
+} OptMultiStartConfig;
+
+/**
+ * @brief Resultado agregado do multi-start
+ */
+typedef struct {
+    OptResult best;               /**< Resultado completo da melhor execucao */
+    size_t best_run;              /**< Indice da melhor execucao */
+    size_t num_runs;              /**< Execucoes concluidas */
+    double *run_costs;            /**< Custo final de cada execucao */
+    double *run_times_ms;         /**< Tempo de parede de cada execucao */
+    double mean_cost;             /**< Media dos custos finais */
+    double std_cost;              /**< Desvio padrao amostral dos custos finais */
+    double worst_cost;            /**< Pior custo final */
+    size_t total_evaluations;     /**< Soma de num_evaluations */
+    double elapsed_time_ms;       /**< Tempo de parede total */
+    size_t target_hits;           /**< Execucoes que atingiram target_cost */
+    double mean_time_to_target_ms; /**< Media do time-to-target entre as que atingiram */
+    double *run_time_to_target_ms; /**< Time-to-target por execucao (-1 = nao atingiu; NULL sem alvo) */
+} OptMultiStartResult;
+
+/**
+ * @brief Descricao de uma chamada *_run para os adaptadores opt_run_*
+ *
+ * Cada adaptador usa so os campos do seu algoritmo; config aponta para a
+ * Config correspondente (HCConfig, SAConfig, ILSConfig, GRASPConfig,
+ * VNSConfig, TSConfig ou LNSConfig). A Config e copiada por execucao com
+ * seed trocada e rng = NULL; se stop != NULL, ele substitui config->stop
+ * (HCConfig nao tem criterios de parada e o ignora).
+ */
+typedef struct {
+    const void *config;           /**< Config do algoritmo (read-only) */
+    size_t element_size;          /**< element_size repassado ao *_run (mesma convencao dele) */
+    size_t solution_size;         /**< Dimensao logica */
+    ObjectiveFn objective;        /**< Funcao objetivo */
+    NeighborFn neighbor;          /**< Vizinhanca (HC, SA, ILS, GRASP, VNS) */
+    GenerateFn generate;          /**< Solucao inicial (HC, SA, ILS, VNS) */
+    PerturbFn perturb;            /**< Perturbacao (ILS; NULL = neighbor repetido) */
+    ShakeFn shake;                /**< Shaking (VNS) */
+    GRASPConstructFn construct;   /**< Construcao gulosa randomizada (GRASP) */
+    TabuHashFn hash_fn;           /**< Hash de solucao (TS; NULL = tabu por atributo/sem hash) */
+    const DestroyFn *destroy_ops; /**< Operadores destroy (ALNS) */
+    const RepairFn *repair_ops;   /**< Operadores repair (ALNS) */
+    const OptStopCriteria *stop;  /**< Substitui config->stop (NULL = o da Config; ex.: portfolio) */
+    const void *context;          /**< Contexto do problema */
+} OptRunSpec;
+
+// ============================================================================
+// CONFIGURACAO
+// ============================================================================
+
+/**
+ * @brief Retorna configuracao padrao do multi-start
+ *
+ * Defaults: 8 execucoes, todas as threads, base_seed=42, minimize, sem alvo
+ *
+ * @return OptMultiStartConfig Configuracao padrao
+ */
+OptMultiStartConfig opt_multistart_default_config(void);
+
+// ============================================================================
+// DRIVER
+// ============================================================================
+
+/**
+ * @brief Executa num_runs copias independentes de run em paralelo
+ *
+ * Cada OptResult recebe elapsed_time_ms da propria execucao. O time-to-
+ * target de uma execucao e estimado pela primeira iteracao de convergence
+ * que atinge o alvo: tempo * (iteracao + 1) / num_iterations.
+ *
+ * @param config Configuracao do multi-start
+ * @param run Execucao a repetir
+ * @param user_data Repassado a run (ex.: OptRunSpec*)
+ * @return OptMultiStartResult Melhor resultado e estatisticas (num_runs = 0 em falha)
+ *
+ * Complexidade: O(num_runs * custo_run / num_threads)
+ */
+OptMultiStartResult opt_parallel_multistart(const OptMultiStartConfig *config,
+                                            OptRunFn run, const void *user_data);
+
+/**
+ * @brief Libera o melhor resultado e os arrays por execucao
+ */
+void opt_multistart_result_destroy(OptMultiStartResult *result);
+
+// ============================================================================
+// ADAPTADORES (OptRunFn-compatible, user_data = const OptRunSpec*)
+// ============================================================================
+
+/** @brief hc_random_restart com spec->config = const HCConfig* */
+OptResult opt_run_hc_restart(unsigned seed, const void *spec);
+
+/** @brief sa_run com spec->config = const SAConfig* */
+OptResult opt_run_sa(unsigned seed, const void *spec);
+
+/** @brief ils_run com spec->config = const ILSConfig* */
+OptResult opt_run_ils(unsigned seed, const void *spec);
+
+/** @brief grasp_run com spec->config = const GRASPConfig* */
+OptResult opt_run_grasp(unsigned seed, const void *spec);
+
+/** @brief vns_run com spec->config = const VNSConfig* */
+OptResult opt_run_vns(unsigned seed, const void *spec);
+
+/** @brief ts_run com spec->config = const TSConfig* */
+OptResult opt_run_ts(unsigned seed, const void *spec);
+
+/** @brief alns_run com spec->config = const LNSConfig* */
+OptResult opt_run_alns(unsigned seed, const void *spec);
+
+#endif /* OPT_MULTISTART_H */
@@ -0,0 +1,174 @@
+/**
+ * @file portfolio.h
+ * @brief Portfolio de meta-heuristicas com corrida (racing) entre elas
+ *
+ * Roda varios *_run (SA, TS, ILS, ALNS... via os adaptadores opt_run_* de
+ * multistart.h) sobre a mesma instancia, em rodadas, e elimina cedo os
+ * bracos que perdem. A cada rodada os sobreviventes repartem os nucleos:
+ * cada um roda max(min_replicas, nucleos / sobreviventes) replicas, entao
+ * os nucleos liberados pelos eliminados passam aos lideres. O orcamento
+ * por execucao cresce eta vezes por rodada (round_evaluations) e/ou o
+ * orcamento de tempo compartilhado e dividido entre as rodadas restantes.
+ *
+ * Regras de eliminacao:
+ * - Successive halving: mantem os ceil(n / eta) bracos de menor custo
+ *   medio na rodada (Karnin et al. 2013; Jamieson & Talwalkar 2016).
+ * - F-race: teste de Friedman sobre todos os blocos ja corridos; se
+ *   significativo, elimina os bracos cuja soma de postos difere da do
+ *   melhor alem do limiar de Conover (Birattari et al. 2002).
+ *
+ * A replica j de uma rodada usa a mesma seed em todos os bracos (um bloco
+ * do teste, como numeros aleatorios comuns). Uma execucao nao pode ser
+ * continuada: cada rodada reinicia as execucoes com orcamento maior, e o
+ * resultado e a melhor solucao entre todas as execucoes de todas as
+ * rodadas. Os bracos ficam com a Config do usuario; quando o portfolio tem
+ * orcamento, cada execucao recebe como stop o spec->stop do braco (ou
+ * nenhum criterio) com time_limit_ms/max_evaluations da rodada: use
+ * max_iterations folgado, com trace.mode = OPT_TRACE_NONE ou RING, para
+ * que o orcamento seja o limite efetivo.
+ *
+ * Com orcamento so por avaliacoes o resultado nao depende do escalonamento
+ * das threads, so de num_threads (que define o numero de replicas).
+ *
+ * Uso tipico:
+ * @code
+ * OptRunSpec sa = tsp_spec(&sa_cfg), ts = tsp_spec(&ts_cfg), ...;
+ * OptPortfolioArm arms[] = {
+ *     {"SA", opt_run_sa, &sa}, {"TS", opt_run_ts, &ts},
+ *     {"ILS", opt_run_ils, &ils}, {"ALNS", opt_run_alns, &alns},
+ * };
+ * OptPortfolioConfig pc = opt_portfolio_default_config();
+ * pc.time_limit_ms = 2000.0;
+ * OptPortfolioResult r = opt_portfolio_run(&pc, arms, 4);
+ * // r.best, arms[r.best_arm].name, r.arms[i].eliminated_round ...
+ * opt_portfolio_result_destroy(&r);
+ * @endcode
+ *
+ * Referencias:
+ * - Birattari, M., Stutzle, T., Paquete, L. & Varrentrapp, K. (2002).
+ *   "A racing algorithm for configuring metaheuristics". GECCO.
+ * - Karnin, Z., Koren, T. & Somekh, O. (2013). "Almost optimal exploration
+ *   in multi-armed bandits". ICML.
+ * - Conover, W. J. (1999). "Practical Nonparametric Statistics", 3a ed.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#ifndef OPT_PORTFOLIO_H
+#define OPT_PORTFOLIO_H
+
+#include "optimization/common.h"
+#include "optimization/multistart.h"
+#include <stddef.h>
+#include <stdbool.h>
+
+// ============================================================================
+// TIPOS
+// ============================================================================
+
+/**
+ * @brief Regra de eliminacao entre rodadas
+ */
+typedef enum {
+    OPT_RACE_SUCCESSIVE_HALVING,  /**< Mantem os ceil(n / eta) de menor custo medio */
+    OPT_RACE_FRACE                /**< Friedman + comparacao de Conover contra o melhor */
+} OptRaceRule;
+
+/**
+ * @brief Um braco do portfolio
+ */
+typedef struct {
+    const char *name;             /**< Rotulo (relatorios) */
+    OptRunFn run;                 /**< Execucao (ex.: opt_run_sa) */
+    const OptRunSpec *spec;       /**< Problema e Config do braco (orcamento vem do portfolio) */
+} OptPortfolioArm;
+
+/**
+ * @brief Configuracao do portfolio
+ */
+typedef struct {
+    OptRaceRule rule;             /**< Regra de eliminacao */
+    size_t num_threads;           /**< Nucleos a repartir (1 = serial, 0 = ds_get_num_threads()) */
+    size_t min_replicas;          /**< Replicas minimas por braco e rodada (>= 2 para F-race) */
+    size_t round_evaluations;     /**< Avaliacoes por execucao na 1a rodada, * eta por rodada (0 = sem limite) */
+    double time_limit_ms;         /**< Orcamento de tempo compartilhado (0 = sem limite) */
+    double eta;                   /**< Fator de reducao/crescimento (> 1) */
+    size_t max_rounds;            /**< Rodadas (0 = ceil(log_eta(bracos)) + 1) */
+    double frace_alpha;           /**< Nivel de significancia do F-race */
+    unsigned base_seed;           /**< Replica/bloco b usa base_seed + b */
+    OptDirection direction;       /**< Minimizar ou maximizar */
+} OptPortfolioConfig;
+
+/**
+ * @brief Estatisticas de um braco
+ */
+typedef struct {
+    size_t runs;                  /**< Execucoes feitas */
+    size_t rounds;                /**< Rodadas disputadas */
+    size_t eliminated_round;      /**< Rodada em que saiu (0 = sobreviveu ate o fim) */
+    double best_cost;             /**< Melhor custo entre as execucoes */
+    double mean_cost;             /**< Custo medio das execucoes */
+    double last_round_mean;       /**< Custo medio na ultima rodada disputada */
+    size_t evaluations;           /**< Soma de num_evaluations */
+    double time_ms;               /**< Soma do tempo de parede das execucoes */
+} OptPortfolioArmStats;
+
+/**
+ * @brief Resultado do portfolio
+ */
+typedef struct {
+    OptResult best;               /**< Melhor execucao entre todos os bracos e rodadas */
+    size_t best_arm;              /**< Braco da melhor execucao */
+    size_t num_arms;              /**< Tamanho de arms */
+    OptPortfolioArmStats *arms;   /**< Estatisticas por braco */
+    size_t num_rounds;            /**< Rodadas executadas */
+    size_t survivors;             /**< Bracos nao eliminados */
+    size_t total_evaluations;     /**< Soma de num_evaluations */
+    double elapsed_time_ms;       /**< Tempo de parede total */
+} OptPortfolioResult;
+
+// ============================================================================
+// CONFIGURACAO
+// ============================================================================
+
+/**
+ * @brief Retorna configuracao padrao do portfolio
+ *
+ * Defaults: successive halving, todos os nucleos, 2 replicas minimas,
+ * 1000 avaliacoes na 1a rodada, sem limite de tempo, eta = 2, rodadas
+ * automaticas, alpha = 0.05, base_seed = 42, minimize
+ *
+ * @return OptPortfolioConfig Configuracao padrao
+ */
+OptPortfolioConfig opt_portfolio_default_config(void);
+
+// ============================================================================
+// DRIVER
+// ============================================================================
+
+/**
+ * @brief Corre os bracos em rodadas e devolve a melhor solucao encontrada
+ *
+ * As execucoes de uma rodada rodam em paralelo no pool (ds_parallel_for);
+ * com time_limit_ms, cada execucao recebe a fatia da rodada dividida pelo
+ * numero de ondas (execucoes / nucleos), entao o total fica perto do
+ * orcamento. Sem round_evaluations nem time_limit_ms, vale o limite de
+ * iteracoes de cada Config.
+ *
+ * @param config Configuracao
+ * @param arms Bracos
+ * @param num_arms Numero de bracos (>= 1)
+ * @return OptPortfolioResult Resultado (num_arms = 0 em falha)
+ *
+ * Complexidade: O(rodadas * bracos * replicas * custo_run / nucleos)
+ */
+OptPortfolioResult opt_portfolio_run(const OptPortfolioConfig *config,
+                                     const OptPortfolioArm *arms, size_t num_arms);
+
+/**
+ * @brief Libera o melhor resultado e as estatisticas
+ */
+void opt_portfolio_result_destroy(OptPortfolioResult *result);
+
+#endif /* OPT_PORTFOLIO_H */
@@ -12,7 +12,9 @@
  */
 
 #include "algorithms/backtracking.h"
+#include "data_structures/thread_pool.h"
 
+#include <stdatomic.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -92,6 +94,67 @@ size_t nqueens_count(size_t n) {
     return count;
 }
 
+// Linhas restantes: cols ocupadas, diag1/diag2 ja deslocadas para a linha atual
+static uint64_t nqueens_bits_rec(uint32_t all, uint32_t cols, uint32_t diag1, uint32_t diag2) {
+    if (cols == all) return 1;
+    uint64_t count = 0;
+    uint32_t avail = all & ~(cols | diag1 | diag2);
+    while (avail != 0) {
+        uint32_t bit = avail & (0u - avail);
+        avail ^= bit;
+        count += nqueens_bits_rec(all, cols | bit, (diag1 | bit) << 1, (diag2 | bit) >> 1);
+    }
+    return count;
+}
+
+typedef struct {
+    const uint32_t *items;
+    uint32_t all;
+    _Atomic uint64_t total;
+} NQueensJob;
+
+static void nqueens_item_range(void *ctx, size_t lo, size_t hi) {
+    NQueensJob *job = ctx;
+    uint64_t local = 0;
+    for (size_t i = lo; i < hi; i++) {
+        uint32_t b0 = job->items[2 * i], b1 = job->items[2 * i + 1];
+        uint32_t diag1 = (((b0 << 1) | b1) << 1);
+        uint32_t diag2 = (((b0 >> 1) | b1) >> 1);
+        local += nqueens_bits_rec(job->all, b0 | b1, diag1, diag2);
+    }
+    atomic_fetch_add_explicit(&job->total, local, memory_order_relaxed);
+}
+
+uint64_t nqueens_count_bitboard(size_t n, size_t num_threads) {
+    if (n == 0 || n > NQUEENS_BITBOARD_MAX) return 0;
+    uint32_t all = (n == 32) ? UINT32_MAX : (1u << n) - 1;
+    if (n < 4) return nqueens_bits_rec(all, 0, 0, 0);
+
+    // Itens: (coluna da linha 0, coluna da linha 1) na metade esquerda por simetria
+    size_t half = n / 2, max_items = (half + 1) * n;
+    uint32_t *items = malloc(max_items * 2 * sizeof(uint32_t));
+    if (items == NULL) return 0;
+    size_t num_items = 0;
+    for (size_t c0 = 0; c0 < half + (n & 1); c0++) {
+        uint32_t b0 = 1u << c0;
+        uint32_t avail = all & ~(b0 | (b0 << 1) | (b0 >> 1));
+        if (c0 == half) avail &= (1u << half) - 1;        // coluna central (n impar)
+        while (avail != 0) {
+            uint32_t b1 = avail & (0u - avail);
+            avail ^= b1;
+            items[2 * num_items] = b0;
+            items[2 * num_items + 1] = b1;
+            num_items++;
+        }
+    }
+
+    NQueensJob job = { .items = items, .all = all };
+    atomic_init(&job.total, 0);
+    ds_parallel_for_threads(num_threads, 0, num_items, 1, nqueens_item_range, &job);
+    free(items);
+    return 2 * atomic_load(&job.total);
+}
+
 void nqueens_result_destroy(NQueensResult *result) {
     if (result == NULL) return;
     for (size_t i = 0; i < result->count; i++) {
@@ -161,6 +224,125 @@ bool subset_sum_exists(const int *set, size_t n, int target) {
     return subset_sum_exists_rec(set, n, target, 0, 0);
 }
 
+// Somas dos 2^k subconjuntos de x em ordem crescente, com a mascara de cada uma
+static bool mitm_half_sums(const int64_t *x, size_t k, int64_t **sums_out, uint32_t **masks_out) {
+    size_t size = (size_t)1 << k;
+    int64_t *sums = malloc(size * sizeof(int64_t));
+    uint32_t *masks = malloc(size * sizeof(uint32_t));
+    int64_t *next_sums = malloc(size * sizeof(int64_t));
+    uint32_t *next_masks = malloc(size * sizeof(uint32_t));
+    if (sums == NULL || masks == NULL || next_sums == NULL || next_masks == NULL) {
+        free(sums); free(masks); free(next_sums); free(next_masks);
+        return false;
+    }
+    sums[0] = 0;
+    masks[0] = 0;
+    size_t len = 1;
+    for (size_t i = 0; i < k; i++) {
+        // Merge de L com L + x[i] (ambas ordenadas)
+        size_t a = 0, b = 0, out = 0;
+        while (a < len || b < len) {
+            if (b == len || (a < len && sums[a] <= sums[b] + x[i])) {
+                next_sums[out] = sums[a];
+                next_masks[out++] = masks[a++];
+            } else {
+                next_sums[out] = sums[b] + x[i];
+                next_masks[out++] = masks[b++] | (1u << i);
+            }
+        }
+        int64_t *ts = sums; sums = next_sums; next_sums = ts;
+        uint32_t *tm = masks; masks = next_masks; next_masks = tm;
+        len *= 2;
+    }
+    free(next_sums);
+    free(next_masks);
+    *sums_out = sums;
+    *masks_out = masks;
+    return true;
+}
+
+bool subset_sum_exists_mitm(const int64_t *set, size_t n, int64_t target, bool *included) {
+    if (set == NULL && n > 0) return false;
+    if (n > SUBSET_SUM_MITM_MAX) return false;
+
+    // Toda soma parcial fica em [-negative, positive]
+    int64_t positive = 0, negative = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (set[i] == INT64_MIN) return false;
+        if (set[i] >= 0) {
+            if (positive > INT64_MAX - set[i]) return false;
+            positive += set[i];
+        } else {
+            if (negative > INT64_MAX + set[i]) return false;
+            negative -= set[i];
+        }
+    }
+
+    size_t k1 = n / 2, k2 = n - k1;
+    int64_t *left, *right;
+    uint32_t *left_masks, *right_masks;
+    if (!mitm_half_sums(set, k1, &left, &left_masks)) return false;
+    if (!mitm_half_sums(set + k1, k2, &right, &right_masks)) {
+        free(left);
+        free(left_masks);
+        return false;
+    }
+
+    // Dois ponteiros: esquerda crescente, direita decrescente. Cada
+    // left + right e a soma de um subconjunto, logo nao estoura
+    size_t i = 0, j = ((size_t)1 << k2);
+    bool found = false;
+    while (i < ((size_t)1 << k1) && j > 0) {
+        int64_t sum = left[i] + right[j - 1];
+        if (sum == target) {
+            found = true;
+            break;
+        }
+        if (sum > target) j--;
+        else i++;
+    }
+    if (found && included != NULL) {
+        for (size_t b = 0; b < k1; b++) included[b] = (left_masks[i] >> b) & 1u;
+        for (size_t b = 0; b < k2; b++) included[k1 + b] = (right_masks[j - 1] >> b) & 1u;
+    }
+    free(left);
+    free(left_masks);
+    free(right);
+    free(right_masks);
+    return found;
+}
+
+bool subset_sum_exists_bitset(const int *set, size_t n, int target) {
+    if (target < 0 || (set == NULL && n > 0)) return false;
+    for (size_t i = 0; i < n; i++) {
+        if (set[i] < 0) return false;
+    }
+    if (target == 0) return true;
+
+    size_t words = (size_t)target / 64 + 1;
+    uint64_t *reach = calloc(words, sizeof(uint64_t));
+    if (reach == NULL) return false;
+    reach[0] = 1;                                        // soma 0
+    size_t tw = (size_t)target / 64, tb = (size_t)target % 64;
+    uint64_t top_mask = ~0ull >> (63 - tb);               // descarta somas > target
+
+    bool found = false;
+    for (size_t i = 0; i < n && !found; i++) {
+        if (set[i] == 0 || set[i] > target) continue;
+        size_t q = (size_t)set[i] / 64, r = (size_t)set[i] % 64;
+        // De cima para baixo: as fontes (w - q, w - q - 1) ainda nao mudaram
+        for (size_t w = words; w-- > q;) {
+            uint64_t shifted = reach[w - q] << r;
+            if (r != 0 && w > q) shifted |= reach[w - q - 1] >> (64 - r);
+            reach[w] |= shifted;
+        }
+        reach[words - 1] &= top_mask;
+        found = (reach[tw] >> tb) & 1u;
+    }
+    free(reach);
+    return found;
+}
+
 void subset_sum_result_destroy(SubsetSumResult *result) {
     if (result == NULL) return;
     for (size_t i = 0; i < result->count; i++) {
@@ -226,6 +408,131 @@ size_t permutations_count(size_t n) {
     return result;
 }
 
+// Quantos blocos de ranks cada thread recebe em permutations_for_each
+#define PERMUTATION_CHUNKS_PER_THREAD 16
+
+static uint64_t perm_factorial(size_t n) {
+    uint64_t f = 1;
+    for (size_t i = 2; i <= n; i++) f *= i;
+    return f;
+}
+
+bool permutation_unrank(uint64_t rank, size_t n, int *perm) {
+    if (perm == NULL || n > PERMUTATION_MAX_N || rank >= perm_factorial(n)) return false;
+    bool used[PERMUTATION_MAX_N] = { false };
+    uint64_t f = perm_factorial(n);
+    for (size_t i = 0; i < n; i++) {
+        f /= (n - i);
+        size_t digit = (size_t)(rank / f);           // digito do sistema fatorial
+        rank %= f;
+        size_t v = 0;
+        for (;; v++) {
+            if (!used[v] && digit-- == 0) break;
+        }
+        used[v] = true;
+        perm[i] = (int)v;
+    }
+    return true;
+}
+
+uint64_t permutation_rank(const int *perm, size_t n) {
+    if (perm == NULL || n > PERMUTATION_MAX_N) return UINT64_MAX;
+    uint32_t seen = 0;
+    uint64_t rank = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (perm[i] < 0 || (size_t)perm[i] >= n || (seen >> perm[i]) & 1u) return UINT64_MAX;
+        // Menores ainda nao usados = perm[i] - popcount(vistos abaixo de perm[i])
+        uint32_t below = seen & ((1u << perm[i]) - 1u);
+        rank = rank * (n - i) + (uint64_t)(perm[i] - __builtin_popcount(below));
+        seen |= 1u << perm[i];
+    }
+    return rank;
+}
+
+bool permutation_iterator_init(PermutationIterator *it, const int *arr, size_t n,
+                               uint64_t first, uint64_t last) {
+    if (it == NULL || arr == NULL || n == 0 || n > PERMUTATION_MAX_N) return false;
+    uint64_t total = perm_factorial(n);
+    it->arr = arr;
+    it->n = n;
+    it->end = (last < total) ? last : total;
+    it->rank = (first < it->end) ? first : it->end;
+    it->fresh = true;
+    int start[PERMUTATION_MAX_N];
+    permutation_unrank(it->rank < total ? it->rank : 0, n, start);
+    for (size_t i = 0; i < n; i++) it->idx[i] = (unsigned char)start[i];
+    return true;
+}
+
+bool permutation_iterator_next(PermutationIterator *it, int *out) {
+    if (it == NULL || out == NULL || it->rank >= it->end) return false;
+    size_t n = it->n, from = 0;
+    unsigned char *idx = it->idx;
+    if (!it->fresh) {
+        // Proxima em ordem lexicografica: so o sufixo a partir de i muda
+        size_t i = n - 1;
+        while (i > 0 && idx[i - 1] > idx[i]) i--;
+        from = i - 1;                                // existe: rank < n! - 1
+        size_t j = n - 1;
+        while (idx[j] < idx[from]) j--;
+        unsigned char t = idx[from]; idx[from] = idx[j]; idx[j] = t;
+        for (size_t a = from + 1, b = n - 1; a < b; a++, b--) {
+            t = idx[a]; idx[a] = idx[b]; idx[b] = t;
+        }
+    }
+    it->fresh = false;
+    for (size_t k = from; k < n; k++) out[k] = it->arr[idx[k]];
+    it->rank++;
+    return true;
+}
+
+static int perm_stop_requested(atomic_int *stop) {
+    return atomic_load_explicit(stop, memory_order_relaxed);
+}
+
+typedef struct {
+    const int *arr;
+    size_t n;
+    uint64_t chunk;
+    PermutationVisitFn visit;
+    void *user_data;
+    atomic_int stop;
+} PermutationJob;
+
+static void permutation_chunk_range(void *ctx, size_t lo, size_t hi) {
+    PermutationJob *job = ctx;
+    for (size_t c = lo; c < hi; c++) {
+        if (perm_stop_requested(&job->stop)) return;
+        PermutationIterator it;
+        int out[PERMUTATION_MAX_N];
+        uint64_t first = (uint64_t)c * job->chunk;
+        if (!permutation_iterator_init(&it, job->arr, job->n, first, first + job->chunk)) continue;
+        for (uint64_t k = 0; permutation_iterator_next(&it, out); k++) {
+            if ((k & 4095) == 4095 && perm_stop_requested(&job->stop)) break;
+            if (!job->visit(out, job->n, job->user_data)) {
+                atomic_store(&job->stop, 1);
+                break;
+            }
+        }
+    }
+}
+
+bool permutations_for_each(const int *arr, size_t n, PermutationVisitFn visit, void *user_data,
+                           size_t num_threads) {
+    if (arr == NULL || visit == NULL || n == 0 || n > PERMUTATION_MAX_N) return false;
+    uint64_t total = perm_factorial(n);
+
+    size_t threads = ds_parallel_enabled(num_threads) ? ds_resolve_threads(num_threads) : 1;
+    uint64_t chunks = (threads > 1) ? (uint64_t)threads * PERMUTATION_CHUNKS_PER_THREAD : 1;
+    if (chunks > total) chunks = total;
+    PermutationJob job = { .arr = arr, .n = n, .chunk = (total + chunks - 1) / chunks,
+                           .visit = visit, .user_data = user_data };
+    atomic_init(&job.stop, 0);
+
+    ds_parallel_for_threads(threads, 0, (size_t)chunks, 1, permutation_chunk_range, &job);
+    return !atomic_load(&job.stop);
+}
+
 void permutation_result_destroy(PermutationResult *result) {
     if (result == NULL) return;
     for (size_t i = 0; i < result->count; i++) {
@@ -278,3 +585,608 @@ void graph_coloring_result_destroy(GraphColoringResult *result) {
     result->colors = NULL;
     result->solvable = false;
 }
+
+// ============================================================================
+// GRAPH COLORING - DSATUR exato (Brelaz, 1979; San Segundo, 2012)
+// ============================================================================
+
+/*
+ * Representacao interna: listas de vizinhos simetricas, sem lacos e sem
+ * repeticoes. Cada vertice guarda o bitset das cores proibidas (mais um
+ * contador por cor para desfazer) e a saturacao = popcount desse bitset.
+ * Vertices sem cor ficam num heap indexado por (saturacao, grau).
+ */
+
+#define COLORING_NIL SIZE_MAX
+
+/** Vertices a partir dos quais a busca e dividida entre threads */
+#define COLORING_PARALLEL_MIN 24
+
+/** Profundidade maxima do corte em itens de trabalho */
+#define COLORING_SPLIT_MAX 16
+
+/** Vertices de maior grau usados como semente do clique guloso */
+#define COLORING_CLIQUE_STARTS 32
+
+typedef struct {
+    size_t n;
+    size_t m;                   // cores efetivas: min(m, grau maximo + 1)
+    size_t words;               // palavras de 64 bits por bitset de cores
+    size_t *offsets;            // vizinhos de v: nbr[offsets[v] .. offsets[v + 1])
+    size_t *nbr;
+    size_t *clique;             // vertices de um clique (recebem as cores 0..k-1)
+    size_t clique_size;
+} ColoringGraph;
+
+typedef struct {
+    size_t v;
+    size_t color;
+    size_t next;                // proxima cor a tentar
+    size_t prev_used;           // cores em uso antes desta atribuicao
+} ColoringFrame;
+
+typedef struct {
+    const ColoringGraph *g;
+    uint64_t *blocked;          // n * words
+    uint32_t *count;            // n * m: vizinhos com a cor c
+    size_t *sat;
+    size_t *color;              // COLORING_NIL = sem cor
+    size_t *heap, *pos;         // heap de maximo dos vertices sem cor
+    size_t heap_size;
+    size_t used;                // cores 0 .. used - 1 ja usadas
+    ColoringFrame *stack;
+} ColoringState;
+
+static void coloring_graph_free(ColoringGraph *g) {
+    free(g->offsets);
+    free(g->nbr);
+    free(g->clique);
+}
+
+// Compacta as listas (remove repeticoes) a partir de arcos ja simetrizados
+static bool coloring_graph_finish(ColoringGraph *g, int m) {
+    size_t n = g->n;
+    size_t *mark = malloc(n * sizeof(size_t));
+    if (mark == NULL) return false;
+    for (size_t v = 0; v < n; v++) mark[v] = COLORING_NIL;
+    size_t w = 0, max_degree = 0;
+    for (size_t v = 0; v < n; v++) {
+        size_t begin = g->offsets[v], end = g->offsets[v + 1];
+        g->offsets[v] = w;
+        for (size_t k = begin; k < end; k++) {
+            size_t u = g->nbr[k];
+            if (mark[u] == v) continue;
+            mark[u] = v;
+            g->nbr[w++] = u;
+        }
+        if (w - g->offsets[v] > max_degree) max_degree = w - g->offsets[v];
+    }
+    g->offsets[n] = w;
+    free(mark);
+
+    // Com grau maximo D, D + 1 cores sempre bastam (guloso)
+    g->m = ((size_t)m < max_degree + 1) ? (size_t)m : max_degree + 1;
+    g->words = (g->m + 63) / 64;
+    return g->m <= SIZE_MAX / sizeof(uint32_t) / n;
+}
+
+static bool coloring_graph_from_matrix(ColoringGraph *g, const int *adj, size_t n, int m) {
+    g->n = n;
+    g->offsets = calloc(n + 1, sizeof(size_t));
+    g->nbr = NULL;
+    g->clique = NULL;
+    if (g->offsets == NULL) return false;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            if (i != j && (adj[i * n + j] || adj[j * n + i])) g->offsets[i + 1]++;
+        }
+    }
+    for (size_t i = 0; i < n; i++) g->offsets[i + 1] += g->offsets[i];
+    g->nbr = malloc((g->offsets[n] ? g->offsets[n] : 1) * sizeof(size_t));
+    if (g->nbr == NULL) return false;
+    for (size_t i = 0, k = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            if (i != j && (adj[i * n + j] || adj[j * n + i])) g->nbr[k++] = j;
+        }
+    }
+    return coloring_graph_finish(g, m);
+}
+
+// Arcos do CSR nos dois sentidos (digrafos viram grafos simples)
+static bool coloring_graph_from_csr(ColoringGraph *g, const CSRGraph *csr, int m) {
+    size_t n = graph_csr_num_vertices(csr);
+    g->n = n;
+    g->offsets = calloc(n + 1, sizeof(size_t));
+    g->nbr = NULL;
+    g->clique = NULL;
+    if (g->offsets == NULL) return false;
+    size_t arcs = 0;
+    for (size_t v = 0; v < n; v++) {
+        const Vertex *dests;
+        size_t count;
+        if (graph_csr_neighbors(csr, v, &dests, NULL, &count) != DS_SUCCESS) return false;
+        for (size_t k = 0; k < count; k++) {
+            if (dests[k] == v || dests[k] >= n) continue;
+            g->offsets[v + 1]++;
+            g->offsets[dests[k] + 1]++;
+            arcs += 2;
+        }
+    }
+    for (size_t v = 0; v < n; v++) g->offsets[v + 1] += g->offsets[v];
+    size_t *fill = malloc(n * sizeof(size_t));
+    g->nbr = malloc((arcs ? arcs : 1) * sizeof(size_t));
+    if (fill == NULL || g->nbr == NULL) {
+        free(fill);
+        return false;
+    }
+    memcpy(fill, g->offsets, n * sizeof(size_t));
+    for (size_t v = 0; v < n; v++) {
+        const Vertex *dests;
+        size_t count;
+        graph_csr_neighbors(csr, v, &dests, NULL, &count);
+        for (size_t k = 0; k < count; k++) {
+            size_t u = dests[k];
+            if (u == v || u >= n) continue;
+            g->nbr[fill[v]++] = u;
+            g->nbr[fill[u]++] = v;
+        }
+    }
+    free(fill);
+    return coloring_graph_finish(g, m);
+}
+
+static size_t coloring_degree(const ColoringGraph *g, size_t v) {
+    return g->offsets[v + 1] - g->offsets[v];
+}
+
+/*
+ * Clique guloso sobre linhas de adjacencia em bitset: a partir de cada um
+ * dos vertices de maior grau, adiciona o candidato com mais vizinhos entre
+ * os candidatos (popcount de AND palavra a palavra). Um clique de k > m
+ * vertices prova que nao ha coloracao; senao fixa as cores 0..k-1.
+ * So e montado ate GRAPH_COLORING_BITSET_MAX vertices (n^2 bits).
+ */
+static bool coloring_find_clique(ColoringGraph *g) {
+    size_t n = g->n, words = (n + 63) / 64;
+    g->clique_size = 0;
+    g->clique = malloc(n * sizeof(size_t));
+    if (g->clique == NULL) return false;
+    if (n > GRAPH_COLORING_BITSET_MAX) {
+        // Sem bitsets: um vertice qualquer de grau maximo e um clique trivial
+        size_t best = 0;
+        for (size_t v = 1; v < n; v++) {
+            if (coloring_degree(g, v) > coloring_degree(g, best)) best = v;
+        }
+        g->clique[0] = best;
+        g->clique_size = 1;
+        return true;
+    }
+
+    uint64_t *rows = calloc(n * words, sizeof(uint64_t));
+    uint64_t *cand = malloc(words * sizeof(uint64_t));
+    size_t *current = malloc(n * sizeof(size_t));
+    size_t *starts = malloc(n * sizeof(size_t));
+    if (rows == NULL || cand == NULL || current == NULL || starts == NULL) {
+        free(rows); free(cand); free(current); free(starts);
+        return false;
+    }
+    for (size_t v = 0; v < n; v++) {
+        for (size_t k = g->offsets[v]; k < g->offsets[v + 1]; k++) {
+            size_t u = g->nbr[k];
+            rows[v * words + u / 64] |= 1ull << (u % 64);
+        }
+    }
+
+    // Sementes: os COLORING_CLIQUE_STARTS vertices de maior grau
+    size_t num_starts = 0;
+    for (size_t v = 0; v < n; v++) {
+        size_t j;
+        if (num_starts < COLORING_CLIQUE_STARTS) {
+            j = num_starts++;
+        } else if (coloring_degree(g, v) > coloring_degree(g, starts[num_starts - 1])) {
+            j = num_starts - 1;
+        } else {
+            continue;
+        }
+        while (j > 0 && coloring_degree(g, starts[j - 1]) < coloring_degree(g, v)) {
+            starts[j] = starts[j - 1];
+            j--;
+        }
+        starts[j] = v;
+    }
+
+    for (size_t s = 0; s < num_starts && g->clique_size <= g->m; s++) {
+        size_t size = 0, v = starts[s];
+        memcpy(cand, rows + v * words, words * sizeof(uint64_t));
+        current[size++] = v;
+        for (;;) {
+            size_t best = COLORING_NIL, best_score = 0;
+            for (size_t w = 0; w < words; w++) {
+                for (uint64_t bits = cand[w]; bits != 0; bits &= bits - 1) {
+                    size_t u = w * 64 + (size_t)__builtin_ctzll(bits);
+                    size_t score = 0;
+                    const uint64_t *row = rows + u * words;
+                    for (size_t x = 0; x < words; x++) {
+                        score += (size_t)__builtin_popcountll(cand[x] & row[x]);
+                    }
+                    if (best == COLORING_NIL || score > best_score) {
+                        best = u;
+                        best_score = score;
+                    }
+                }
+            }
+            if (best == COLORING_NIL) break;
+            current[size++] = best;
+            const uint64_t *row = rows + best * words;
+            for (size_t x = 0; x < words; x++) cand[x] &= row[x];
+        }
+        if (size > g->clique_size) {
+            memcpy(g->clique, current, size * sizeof(size_t));
+            g->clique_size = size;
+        }
+    }
+    free(rows);
+    free(cand);
+    free(current);
+    free(starts);
+    return true;
+}
+
+// Heap: maior saturacao, depois maior grau, depois menor indice
+static bool coloring_better(const ColoringState *s, size_t a, size_t b) {
+    if (s->sat[a] != s->sat[b]) return s->sat[a] > s->sat[b];
+    size_t da = coloring_degree(s->g, a), db = coloring_degree(s->g, b);
+    if (da != db) return da > db;
+    return a < b;
+}
+
+static void heap_place(ColoringState *s, size_t i, size_t v) {
+    s->heap[i] = v;
+    s->pos[v] = i;
+}
+
+static void heap_sift_up(ColoringState *s, size_t i) {
+    size_t v = s->heap[i];
+    while (i > 0 && coloring_better(s, v, s->heap[(i - 1) / 2])) {
+        heap_place(s, i, s->heap[(i - 1) / 2]);
+        i = (i - 1) / 2;
+    }
+    heap_place(s, i, v);
+}
+
+static void heap_sift_down(ColoringState *s, size_t i) {
+    size_t v = s->heap[i];
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= s->heap_size) break;
+        if (child + 1 < s->heap_size && coloring_better(s, s->heap[child + 1], s->heap[child])) child++;
+        if (!coloring_better(s, s->heap[child], v)) break;
+        heap_place(s, i, s->heap[child]);
+        i = child;
+    }
+    heap_place(s, i, v);
+}
+
+static void heap_insert(ColoringState *s, size_t v) {
+    s->heap[s->heap_size] = v;
+    s->pos[v] = s->heap_size++;
+    heap_sift_up(s, s->pos[v]);
+}
+
+static void heap_remove(ColoringState *s, size_t v) {
+    size_t i = s->pos[v], last = s->heap[--s->heap_size];
+    s->pos[v] = COLORING_NIL;
+    if (i == s->heap_size) return;
+    heap_place(s, i, last);
+    heap_sift_up(s, i);
+    heap_sift_down(s, s->pos[last]);
+}
+
+static void coloring_state_free(ColoringState *s) {
+    free(s->blocked);
+    free(s->count);
+    free(s->sat);
+    free(s->color);
+    free(s->heap);
+    free(s->pos);
+    free(s->stack);
+}
+
+// Atribui c a v; devolve false se algum vizinho sem cor ficou sem opcao
+static bool coloring_assign(ColoringState *s, size_t v, size_t c) {
+    const ColoringGraph *g = s->g;
+    bool alive = true;
+    heap_remove(s, v);
+    s->color[v] = c;
+    for (size_t k = g->offsets[v]; k < g->offsets[v + 1]; k++) {
+        size_t u = g->nbr[k];
+        if (s->count[u * g->m + c]++ != 0) continue;
+        s->blocked[u * g->words + c / 64] |= 1ull << (c % 64);
+        s->sat[u]++;
+        if (s->color[u] == COLORING_NIL) {
+            heap_sift_up(s, s->pos[u]);
+            if (s->sat[u] == g->m) alive = false;
+        }
+    }
+    if (c + 1 > s->used) s->used = c + 1;
+    return alive;
+}
+
+static void coloring_unassign(ColoringState *s, size_t v) {
+    const ColoringGraph *g = s->g;
+    size_t c = s->color[v];
+    for (size_t k = g->offsets[v]; k < g->offsets[v + 1]; k++) {
+        size_t u = g->nbr[k];
+        if (--s->count[u * g->m + c] != 0) continue;
+        s->blocked[u * g->words + c / 64] &= ~(1ull << (c % 64));
+        s->sat[u]--;
+        if (s->color[u] == COLORING_NIL) heap_sift_down(s, s->pos[u]);
+    }
+    s->color[v] = COLORING_NIL;
+    heap_insert(s, v);
+}
+
+// Estado inicial com o clique ja colorido; *alive = false se isso ja falha
+static bool coloring_state_init(ColoringState *s, const ColoringGraph *g, bool *alive) {
+    size_t n = g->n;
+    s->g = g;
+    s->blocked = calloc(n * g->words, sizeof(uint64_t));
+    s->count = calloc(n * g->m, sizeof(uint32_t));
+    s->sat = calloc(n, sizeof(size_t));
+    s->color = malloc(n * sizeof(size_t));
+    s->heap = malloc(n * sizeof(size_t));
+    s->pos = malloc(n * sizeof(size_t));
+    s->stack = malloc(n * sizeof(ColoringFrame));
+    if (!s->blocked || !s->count || !s->sat || !s->color || !s->heap || !s->pos || !s->stack) {
+        coloring_state_free(s);
+        return false;
+    }
+    s->heap_size = 0;
+    s->used = 0;
+    for (size_t v = 0; v < n; v++) {
+        s->color[v] = COLORING_NIL;
+        heap_insert(s, v);
+    }
+    *alive = g->clique_size <= g->m;
+    for (size_t i = 0; *alive && i < g->clique_size; i++) {
+        *alive = coloring_assign(s, g->clique[i], i);
+    }
+    return true;
+}
+
+// Menor cor em [from, limit) livre para v, palavra a palavra
+static size_t coloring_next_free(const ColoringState *s, size_t v, size_t from, size_t limit) {
+    const uint64_t *row = s->blocked + v * s->g->words;
+    for (size_t w = from / 64; w * 64 < limit; w++) {
+        uint64_t free_bits = ~row[w];
+        if (w == from / 64) free_bits &= ~0ull << (from % 64);
+        if (free_bits != 0) {
+            size_t c = w * 64 + (size_t)__builtin_ctzll(free_bits);
+            return (c < limit) ? c : COLORING_NIL;
+        }
+    }
+    return COLORING_NIL;
+}
+
+static int coloring_stop_requested(atomic_int *stop) {
+    return atomic_load_explicit(stop, memory_order_relaxed);
+}
+
+typedef enum { COLORING_FOUND, COLORING_EXHAUSTED, COLORING_STOPPED } ColoringOutcome;
+
+typedef struct {
+    size_t *data;               // split pares (vertice, cor) por item
+    size_t count, capacity, split;
+    bool failed;
+} ColoringItems;
+
+static void coloring_emit(ColoringItems *items, const ColoringFrame *stack) {
+    if (items->failed) return;
+    if (items->count == items->capacity) {
+        size_t cap = items->capacity ? items->capacity * 2 : 64;
+        size_t *grown = realloc(items->data, cap * 2 * items->split * sizeof(size_t));
+        if (grown == NULL) {
+            items->failed = true;
+            return;
+        }
+        items->data = grown;
+        items->capacity = cap;
+    }
+    size_t *dst = items->data + items->count * 2 * items->split;
+    for (size_t d = 0; d < items->split; d++) {
+        dst[2 * d] = stack[d].v;
+        dst[2 * d + 1] = stack[d].color;
+    }
+    items->count++;
+}
+
+/*
+ * DFS iterativa com pilha explicita a partir da profundidade base (as
+ * atribuicoes abaixo dela sao fixas). So abre uma cor nova por vez
+ * (cor <= used): as demais escolhas sao permutacoes de cores. Com items,
+ * os nos na profundidade items->split viram itens em vez de expandidos.
+ */
+static ColoringOutcome coloring_search(ColoringState *s, size_t base, ColoringItems *items,
+                                       atomic_int *stop) {
+    ColoringFrame *st = s->stack;
+    size_t depth = base;
+    if (s->heap_size == 0) return COLORING_FOUND;
+    st[depth] = (ColoringFrame){ s->heap[0], 0, 0, s->used };
+    unsigned long nodes = 0;
+
+    for (;;) {
+        if (stop != NULL && (++nodes & 1023) == 0 && coloring_stop_requested(stop)) {
+            return COLORING_STOPPED;
+        }
+        ColoringFrame *f = &st[depth];
+        size_t limit = (f->prev_used < s->g->m) ? f->prev_used + 1 : s->g->m;
+        size_t c = coloring_next_free(s, f->v, f->next, limit);
+        if (c == COLORING_NIL) {
+            if (depth == base) return COLORING_EXHAUSTED;
+            depth--;
+            coloring_unassign(s, st[depth].v);
+            s->used = st[depth].prev_used;
+            continue;
+        }
+        f->color = c;
+        f->next = c + 1;
+        bool alive = coloring_assign(s, f->v, c);
+        if (alive && items != NULL && depth + 1 == items->split && s->heap_size > 0) {
+            coloring_emit(items, st);
+            alive = false;
+        }
+        if (!alive) {
+            coloring_unassign(s, f->v);
+            s->used = f->prev_used;
+            continue;
+        }
+        if (s->heap_size == 0) return COLORING_FOUND;
+        depth++;
+        st[depth] = (ColoringFrame){ s->heap[0], 0, 0, s->used };
+    }
+}
+
+static void coloring_copy_result(const ColoringState *s, int *colors) {
+    for (size_t v = 0; v < s->g->n; v++) colors[v] = (int)s->color[v] + 1;
+}
+
+// Itens do corte repartidos entre as tarefas do pool; a primeira coloracao
+// completa vence a troca de stop 0 -> 1 e e copiada para colors
+typedef struct {
+    const ColoringGraph *g;
+    const ColoringItems *items;
+    int *colors;
+    atomic_int stop;
+    atomic_bool alloc_failed;
+} ColoringJob;
+
+static void coloring_item_range(void *ctx, size_t lo, size_t hi) {
+    ColoringJob *job = ctx;
+    const ColoringItems *items = job->items;
+    for (size_t i = lo; i < hi; i++) {
+        if (coloring_stop_requested(&job->stop)) return;
+        ColoringState w;
+        bool alive;
+        if (!coloring_state_init(&w, job->g, &alive)) {
+            atomic_store(&job->alloc_failed, true);
+            continue;
+        }
+        const size_t *item = items->data + i * 2 * items->split;
+        for (size_t d = 0; d < items->split; d++) {
+            size_t v = item[2 * d], c = item[2 * d + 1];
+            w.stack[d] = (ColoringFrame){ v, c, c + 1, w.used };
+            coloring_assign(&w, v, c);
+        }
+        if (coloring_search(&w, items->split, NULL, &job->stop) == COLORING_FOUND) {
+            int expected = 0;
+            if (atomic_compare_exchange_strong(&job->stop, &expected, 1)) {
+                coloring_copy_result(&w, job->colors);
+            }
+        }
+        coloring_state_free(&w);
+    }
+}
+
+// Preenche colors (1..m) e devolve true se ha coloracao; *error em falha de alocacao
+static bool coloring_solve(const ColoringGraph *g, int *colors, size_t num_threads, bool *error) {
+    ColoringState s;
+    bool alive;
+    *error = false;
+    if (!coloring_state_init(&s, g, &alive)) {
+        *error = true;
+        return false;
+    }
+    if (!alive) {
+        coloring_state_free(&s);
+        return false;
+    }
+
+    size_t threads = ds_parallel_enabled(num_threads) ? ds_resolve_threads(num_threads) : 1;
+    if (threads <= 1 || s.heap_size < COLORING_PARALLEL_MIN) {
+        bool found = coloring_search(&s, 0, NULL, NULL) == COLORING_FOUND;
+        if (found) coloring_copy_result(&s, colors);
+        coloring_state_free(&s);
+        return found;
+    }
+
+    // Aprofunda o corte ate haver itens suficientes (varios por thread)
+    ColoringItems items = { NULL, 0, 0, 0, false };
+    bool found = false;
+    for (size_t split = 1; split <= COLORING_SPLIT_MAX; split++) {
+        free(items.data);
+        items.data = NULL;
+        items.capacity = 0;
+        items.count = 0;
+        items.split = split;
+        ColoringOutcome r = coloring_search(&s, 0, &items, NULL);
+        if (items.failed) {
+            *error = true;
+            break;
+        }
+        if (r == COLORING_FOUND) {
+            coloring_copy_result(&s, colors);
+            found = true;
+            break;
+        }
+        if (items.count == 0 || items.count >= threads * 8) break;
+    }
+    coloring_state_free(&s);
+    if (found || *error || items.count == 0) {
+        free(items.data);
+        return found;
+    }
+
+    ColoringJob job = { .g = g, .items = &items, .colors = colors };
+    atomic_init(&job.stop, 0);
+    atomic_init(&job.alloc_failed, false);
+    ds_parallel_for_threads(threads, 0, items.count, 1, coloring_item_range, &job);
+    free(items.data);
+    bool stopped = atomic_load(&job.stop) != 0;
+    if (atomic_load(&job.alloc_failed) && !stopped) *error = true;
+    return stopped;
+}
+
+static GraphColoringResult coloring_run(ColoringGraph *g, bool built, size_t num_threads) {
+    GraphColoringResult result = { NULL, g->n, false };
+    if (built && coloring_find_clique(g)) {
+        result.colors = calloc(g->n, sizeof(int));
+        if (result.colors != NULL) {
+            bool error;
+            result.solvable = coloring_solve(g, result.colors, num_threads, &error);
+            if (error) {
+                free(result.colors);
+                result.colors = NULL;
+            }
+        }
+    }
+    coloring_graph_free(g);
+    return result;
+}
+
+GraphColoringResult graph_coloring_dsatur(const int *adj, size_t n, int m, size_t num_threads) {
+    GraphColoringResult result = { NULL, n, false };
+    if (adj == NULL || n == 0 || m <= 0) return result;
+    ColoringGraph g;
+    bool built = coloring_graph_from_matrix(&g, adj, n, m);
+    return coloring_run(&g, built, num_threads);
+}
+
+GraphColoringResult graph_coloring_dsatur_csr(const CSRGraph *csr, int m, size_t num_threads) {
+    GraphColoringResult result = { NULL, 0, false };
+    if (csr == NULL || m <= 0) return result;
+    result.n = graph_csr_num_vertices(csr);
+    if (result.n == 0) return result;
+    ColoringGraph g;
+    bool built = coloring_graph_from_csr(&g, csr, m);
+    return coloring_run(&g, built, num_threads);
+}
+
+GraphColoringResult graph_coloring_dsatur_graph(const Graph *graph, int m, size_t num_threads) {
+    GraphColoringResult result = { NULL, 0, false };
+    if (graph == NULL) return result;
+    CSRGraph *csr = graph_freeze(graph);
+    if (csr == NULL) return result;
+    result = graph_coloring_dsatur_csr(csr, m, num_threads);
+    graph_csr_destroy(csr);
+    return result;
+}
@@ -0,0 +1,488 @@
+/**
+ * @file bigint.c
+ * @brief Schoolbook, Karatsuba e Toom-3 sobre limbs de 64 bits; Montgomery
+ *
+ * Referencias:
+ * - Karatsuba & Ofman (1962); Toom (1963); Cook (1966)
+ * - Bodrato (2007), sequencia de interpolacao do Toom-3
+ * - Montgomery (1985), "Modular Multiplication Without Trial Division"
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "algorithms/bigint.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Menores tamanhos em que cada divisao faz sentido (metades/tercos nao vazios)
+#define KARATSUBA_MIN_LIMBS 2
+#define TOOM3_MIN_LIMBS 5
+
+typedef struct {
+    size_t karatsuba;           // n >= karatsuba: Karatsuba
+    size_t toom3;               // n >= toom3: Toom-3 (testado antes)
+} MulPlan;
+
+static const MulPlan PLAN_AUTO = { BIGINT_KARATSUBA_THRESHOLD, BIGINT_TOOM3_THRESHOLD };
+static const MulPlan PLAN_KARATSUBA = { BIGINT_KARATSUBA_THRESHOLD, SIZE_MAX };
+static const MulPlan PLAN_TOOM3 = { SIZE_MAX, TOOM3_MIN_LIMBS };
+
+// ============================================================================
+// PRIMITIVAS SOBRE LIMBS
+// ============================================================================
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 limb_wide;
+
+static inline uint64_t mul_wide(uint64_t a, uint64_t b, uint64_t *hi) {
+    limb_wide p = (limb_wide)a * b;
+    *hi = (uint64_t)(p >> 64);
+    return (uint64_t)p;
+}
+#else
+static inline uint64_t mul_wide(uint64_t a, uint64_t b, uint64_t *hi) {
+    uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+    uint64_t b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return (mid << 32) | (p00 & 0xFFFFFFFFu);
+}
+#endif
+
+// r[0..n) = a * b; devolve o limb alto
+static uint64_t limb_mul_1(uint64_t *r, const uint64_t *a, size_t n, uint64_t b) {
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t hi;
+        uint64_t lo = mul_wide(a[i], b, &hi);
+        lo += carry;
+        carry = hi + (lo < carry);
+        r[i] = lo;
+    }
+    return carry;
+}
+
+// r[0..n) += a * b; devolve o limb alto
+static uint64_t limb_addmul_1(uint64_t *r, const uint64_t *a, size_t n, uint64_t b) {
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t hi;
+        uint64_t lo = mul_wide(a[i], b, &hi);
+        lo += carry;
+        hi += (lo < carry);
+        uint64_t s = r[i] + lo;
+        carry = hi + (s < lo);
+        r[i] = s;
+    }
+    return carry;
+}
+
+// r[0..n) = a + b; devolve o carry (r pode ser a ou b)
+static uint64_t limb_add_n(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t n) {
+    uint64_t carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t s = a[i] + carry;
+        carry = (s < carry);
+        uint64_t t = s + b[i];
+        carry += (t < s);
+        r[i] = t;
+    }
+    return carry;
+}
+
+// r[0..n) = a - b; devolve o borrow
+static uint64_t limb_sub_n(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t n) {
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t d = a[i] - b[i];
+        uint64_t nb = (a[i] < b[i]);
+        uint64_t e = d - borrow;
+        nb += (d < borrow);
+        r[i] = e;
+        borrow = nb;
+    }
+    return borrow;
+}
+
+// r[0..an) = a + b com bn <= an
+static uint64_t limb_add(uint64_t *r, const uint64_t *a, size_t an, const uint64_t *b, size_t bn) {
+    uint64_t carry = limb_add_n(r, a, b, bn);
+    for (size_t i = bn; i < an; i++) {
+        uint64_t s = a[i] + carry;
+        carry = (s < carry);
+        r[i] = s;
+    }
+    return carry;
+}
+
+// r[0..an) = a - b com bn <= an
+static uint64_t limb_sub(uint64_t *r, const uint64_t *a, size_t an, const uint64_t *b, size_t bn) {
+    uint64_t borrow = limb_sub_n(r, a, b, bn);
+    for (size_t i = bn; i < an; i++) {
+        uint64_t d = a[i] - borrow;
+        borrow = (a[i] < borrow);
+        r[i] = d;
+    }
+    return borrow;
+}
+
+// r = |x - y| com x de xn limbs e y de n limbs (xn <= n); r tem n limbs.
+// Devolve 1 se x < y
+static int limb_abs_diff(uint64_t *r, const uint64_t *x, size_t xn, const uint64_t *y, size_t n) {
+    int less = 0;
+    for (size_t i = n; i > xn; i--) {
+        if (y[i - 1] != 0) { less = 1; break; }
+    }
+    if (!less) less = bigint_compare(x, y, xn) < 0;
+    if (less) {
+        limb_sub(r, y, n, x, xn);
+    } else {
+        limb_sub_n(r, x, y, xn);
+        memset(r + xn, 0, (n - xn) * sizeof(uint64_t));
+    }
+    return less;
+}
+
+// Complemento de dois: x = -x
+static void limb_negate(uint64_t *x, size_t n) {
+    uint64_t carry = 1;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t v = ~x[i] + carry;
+        carry = (v < carry);
+        x[i] = v;
+    }
+}
+
+// Deslocamento aritmetico de 1 bit a direita (complemento de dois)
+static void limb_sar1(uint64_t *x, size_t n) {
+    for (size_t i = 0; i + 1 < n; i++) x[i] = (x[i] >> 1) | (x[i + 1] << 63);
+    x[n - 1] = (x[n - 1] >> 1) | (x[n - 1] & 0x8000000000000000ull);
+}
+
+// Divisao exata por 3 (x multiplo de 3, complemento de dois): x * 3^-1 mod B^n
+static void limb_divexact_3(uint64_t *x, size_t n) {
+    const uint64_t inv3 = 0xAAAAAAAAAAAAAAABull;
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t s = x[i];
+        uint64_t l = s - borrow;
+        borrow = (s < borrow);
+        uint64_t q = l * inv3;
+        x[i] = q;
+        // limb alto de 3q: o que a proxima posicao precisa descontar
+        borrow += (q > 0x5555555555555555ull) + (q > 0xAAAAAAAAAAAAAAAAull);
+    }
+}
+
+int bigint_compare(const uint64_t *a, const uint64_t *b, size_t n) {
+    for (size_t i = n; i > 0; i--) {
+        if (a[i - 1] != b[i - 1]) return (a[i - 1] < b[i - 1]) ? -1 : 1;
+    }
+    return 0;
+}
+
+// ============================================================================
+// SCHOOLBOOK
+// ============================================================================
+
+static void mul_basecase(uint64_t *r, const uint64_t *a, size_t an, const uint64_t *b, size_t bn) {
+    r[an] = limb_mul_1(r, a, an, b[0]);
+    for (size_t j = 1; j < bn; j++) {
+        r[an + j] = limb_addmul_1(r + j, a, an, b[j]);
+    }
+}
+
+// ============================================================================
+// KARATSUBA E TOOM-3 (OPERANDOS BALANCEADOS)
+// ============================================================================
+
+static bool use_toom3(size_t n, const MulPlan *plan) {
+    return n >= plan->toom3 && n >= TOOM3_MIN_LIMBS;
+}
+
+static bool use_karatsuba(size_t n, const MulPlan *plan) {
+    return n >= plan->karatsuba && n >= KARATSUBA_MIN_LIMBS;
+}
+
+static size_t max_size(size_t a, size_t b) { return (a > b) ? a : b; }
+
+// Limbs de trabalho de mul_n para n limbs (maximo sobre as chamadas filhas)
+static size_t mul_scratch(size_t n, const MulPlan *plan) {
+    if (use_toom3(n, plan)) {
+        size_t k = (n + 2) / 3, n2 = n - 2 * k;
+        size_t child = max_size(mul_scratch(k + 1, plan),
+                                max_size(mul_scratch(k, plan), mul_scratch(n2, plan)));
+        return 6 * (k + 1) + 3 * (2 * k + 2) + child;
+    }
+    if (use_karatsuba(n, plan)) {
+        size_t h = n / 2, l = n - h;
+        return 6 * l + 1 + max_size(mul_scratch(l, plan), mul_scratch(h, plan));
+    }
+    return 0;
+}
+
+static void mul_n(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t n,
+                  uint64_t *ws, const MulPlan *plan);
+
+// a = a1 B^h + a0: a0 b0 + ((a0 - a1)(b1 - b0) + a0 b0 + a1 b1) B^h + a1 b1 B^2h
+static void mul_karatsuba(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t n,
+                          uint64_t *ws, const MulPlan *plan) {
+    size_t h = n / 2, l = n - h;
+    uint64_t *da = ws, *db = ws + l, *t = ws + 2 * l, *m = ws + 4 * l, *rest = ws + 6 * l + 1;
+
+    int neg = limb_abs_diff(da, a, h, a + h, l);          // 1 se a0 < a1
+    neg ^= !limb_abs_diff(db, b, h, b + h, l);            // 1 se b1 < b0
+
+    mul_n(r, a, b, h, rest, plan);                        // z0 em r[0..2h)
+    mul_n(r + 2 * h, a + h, b + h, l, rest, plan);        // z2 em r[2h..2n)
+    mul_n(t, da, db, l, rest, plan);
+
+    m[2 * l] = limb_add(m, r + 2 * h, 2 * l, r, 2 * h);
+    if (neg) limb_sub(m, m, 2 * l + 1, t, 2 * l);
+    else limb_add(m, m, 2 * l + 1, t, 2 * l);
+    limb_add(r + h, r + h, 2 * n - h, m, 2 * l + 1);
+}
+
+// Avalia a0 + a1 x + a2 x^2 em 1, -1 e -2 (k + 1 limbs cada; tmp com k + 1)
+static void toom_evaluate(const uint64_t *a, size_t k, size_t n2, uint64_t *e1, uint64_t *em1,
+                          uint64_t *em2, uint64_t *tmp, int *neg_m1, int *neg_m2) {
+    const uint64_t *a0 = a, *a1 = a + k, *a2 = a + 2 * k;
+
+    e1[k] = limb_add(e1, a0, k, a2, n2);                  // a0 + a2
+    *neg_m1 = !limb_abs_diff(em1, a1, k, e1, k + 1);      // (a0 + a2) - a1
+    limb_add(e1, e1, k + 1, a1, k);                       // a(1)
+
+    // a(-2) = (a0 + 4 a2) - 2 a1
+    memset(em2, 0, (k + 1) * sizeof(uint64_t));
+    em2[n2] = a2[n2 - 1] >> 62;
+    for (size_t i = n2; i > 0; i--) {
+        em2[i - 1] = (a2[i - 1] << 2) | ((i > 1) ? a2[i - 2] >> 62 : 0);
+    }
+    limb_add(em2, em2, k + 1, a0, k);
+    tmp[k] = a1[k - 1] >> 63;
+    for (size_t i = k; i > 0; i--) {
+        tmp[i - 1] = (a1[i - 1] << 1) | ((i > 1) ? a1[i - 2] >> 63 : 0);
+    }
+    *neg_m2 = !limb_abs_diff(em2, tmp, k + 1, em2, k + 1);
+}
+
+static void mul_toom3(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t n,
+                      uint64_t *ws, const MulPlan *plan) {
+    size_t k = (n + 2) / 3, n2 = n - 2 * k;
+    size_t kk = k + 1, len = 2 * k + 2;
+    uint64_t *a1 = ws, *am1 = a1 + kk, *am2 = am1 + kk;
+    uint64_t *b1 = am2 + kk, *bm1 = b1 + kk, *bm2 = bm1 + kk;
+    uint64_t *r1 = bm2 + kk, *rm1 = r1 + len, *rm2 = rm1 + len, *rest = rm2 + len;
+    int na1, na2, nb1, nb2;
+
+    toom_evaluate(a, k, n2, a1, am1, am2, r1, &na1, &na2);
+    toom_evaluate(b, k, n2, b1, bm1, bm2, r1, &nb1, &nb2);
+
+    mul_n(r1, a1, b1, kk, rest, plan);
+    mul_n(rm1, am1, bm1, kk, rest, plan);
+    if (na1 ^ nb1) limb_negate(rm1, len);
+    mul_n(rm2, am2, bm2, kk, rest, plan);
+    if (na2 ^ nb2) limb_negate(rm2, len);
+    mul_n(r, a, b, k, rest, plan);                        // r(0) em r[0..2k)
+    mul_n(r + 4 * k, a + 2 * k, b + 2 * k, n2, rest, plan); // r(inf) em r[4k..2n)
+    const uint64_t *r0 = r, *rinf = r + 4 * k;
+
+    // Bodrato: coeficientes c1, c2, c3 em complemento de dois sobre len limbs
+    limb_sub_n(rm2, rm2, r1, len);                        // c3 = (r(-2) - r(1)) / 3
+    limb_divexact_3(rm2, len);
+    limb_sub_n(r1, r1, rm1, len);                         // c1 = (r(1) - r(-1)) / 2
+    limb_sar1(r1, len);
+    limb_sub(rm1, rm1, len, r0, 2 * k);                   // c2 = r(-1) - r(0)
+    limb_sub_n(rm2, rm1, rm2, len);                       // c3 = (c2 - c3) / 2 + 2 r(inf)
+    limb_sar1(rm2, len);
+    limb_add(rm2, rm2, len, rinf, 2 * n2);
+    limb_add(rm2, rm2, len, rinf, 2 * n2);
+    limb_add_n(rm1, rm1, r1, len);                        // c2 = c2 + c1 - r(inf)
+    limb_sub(rm1, rm1, len, rinf, 2 * n2);
+    limb_sub_n(r1, r1, rm2, len);                         // c1 = c1 - c3
+
+    // Recomposicao; os limbs de c3 alem de 2n sao zero
+    memset(r + 2 * k, 0, 2 * k * sizeof(uint64_t));
+    limb_add(r + k, r + k, 2 * n - k, r1, len);
+    limb_add(r + 2 * k, r + 2 * k, 2 * n - 2 * k, rm1, len);
+    size_t top = 2 * n - 3 * k;
+    limb_add(r + 3 * k, r + 3 * k, top, rm2, (len < top) ? len : top);
+}
+
+static void mul_n(uint64_t *r, const uint64_t *a, const uint64_t *b, size_t n,
+                  uint64_t *ws, const MulPlan *plan) {
+    if (use_toom3(n, plan)) mul_toom3(r, a, b, n, ws, plan);
+    else if (use_karatsuba(n, plan)) mul_karatsuba(r, a, b, n, ws, plan);
+    else mul_basecase(r, a, n, b, n);
+}
+
+// ============================================================================
+// MULTIPLICACAO (API)
+// ============================================================================
+
+static void mul_plan(uint64_t *r, const uint64_t *a, size_t an, const uint64_t *b, size_t bn,
+                     const MulPlan *plan) {
+    if (an < bn) {
+        const uint64_t *tp = a; a = b; b = tp;
+        size_t tn = an; an = bn; bn = tn;
+    }
+    if (bn == 0) {
+        memset(r, 0, an * sizeof(uint64_t));
+        return;
+    }
+    if (!use_toom3(bn, plan) && !use_karatsuba(bn, plan)) {
+        mul_basecase(r, a, an, b, bn);
+        return;
+    }
+
+    size_t scratch = mul_scratch(bn, plan);
+    size_t extra = (an == bn) ? 0 : 2 * bn;
+    uint64_t *ws = malloc((scratch + extra + 1) * sizeof(uint64_t));
+    if (ws == NULL) {
+        mul_basecase(r, a, an, b, bn);
+        return;
+    }
+    if (an == bn) {
+        mul_n(r, a, b, bn, ws, plan);
+        free(ws);
+        return;
+    }
+
+    // Desbalanceado: pedacos de bn limbs de a, somados em r com deslocamento
+    uint64_t *tmp = ws + scratch;
+    memset(r, 0, (an + bn) * sizeof(uint64_t));
+    for (size_t i = 0; i < an; i += bn) {
+        size_t len = (an - i < bn) ? an - i : bn;
+        if (len == bn) mul_n(tmp, a + i, b, bn, ws, plan);
+        else mul_plan(tmp, b, bn, a + i, len, plan);
+        limb_add(r + i, r + i, an + bn - i, tmp, len + bn);
+    }
+    free(ws);
+}
+
+void bigint_multiply(uint64_t *r, const uint64_t *a, size_t an, const uint64_t *b, size_t bn) {
+    if (r == NULL || a == NULL || b == NULL) return;
+    mul_plan(r, a, an, b, bn, &PLAN_AUTO);
+}
+
+void bigint_multiply_schoolbook(uint64_t *r, const uint64_t *a, size_t an, const uint64_t *b, size_t bn) {
+    if (r == NULL || a == NULL || b == NULL) return;
+    if (an == 0 || bn == 0) {
+        memset(r, 0, (an + bn) * sizeof(uint64_t));
+        return;
+    }
+    mul_basecase(r, a, an, b, bn);
+}
+
+void bigint_multiply_karatsuba(uint64_t *r, const uint64_t *a, size_t an, const uint64_t *b, size_t bn) {
+    if (r == NULL || a == NULL || b == NULL) return;
+    mul_plan(r, a, an, b, bn, &PLAN_KARATSUBA);
+}
+
+void bigint_multiply_toom3(uint64_t *r, const uint64_t *a, size_t an, const uint64_t *b, size_t bn) {
+    if (r == NULL || a == NULL || b == NULL) return;
+    mul_plan(r, a, an, b, bn, &PLAN_TOOM3);
+}
+
+// ============================================================================
+// EXPONENCIACAO MODULAR (MONTGOMERY)
+// ============================================================================
+
+#define POW_WINDOW_BITS 4
+
+typedef struct {
+    const uint64_t *mod;
+    size_t n;
+    uint64_t ninv;              // -mod^-1 mod 2^64
+    uint64_t *t;                // produto, 2n + 1 limbs
+    uint64_t *ws;               // trabalho de mul_n
+} Montgomery;
+
+// r = a * b * R^-1 mod N (a, b < R; b < N ou a < N); r pode ser a ou b
+static void mont_mul(const Montgomery *mt, uint64_t *r, const uint64_t *a, const uint64_t *b) {
+    size_t n = mt->n;
+    uint64_t *t = mt->t;
+    mul_n(t, a, b, n, mt->ws, &PLAN_AUTO);
+    t[2 * n] = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t c = limb_addmul_1(t + i, mt->mod, n, t[i] * mt->ninv);
+        uint64_t *hi = t + i + n;
+        size_t rem = 2 * n + 1 - i - n;
+        for (size_t j = 0; c != 0 && j < rem; j++) {
+            hi[j] += c;
+            c = (hi[j] < c);
+        }
+    }
+    if (t[2 * n] != 0 || bigint_compare(t + n, mt->mod, n) >= 0) {
+        limb_sub_n(r, t + n, mt->mod, n);
+    } else {
+        memcpy(r, t + n, n * sizeof(uint64_t));
+    }
+}
+
+// x = R^2 mod N por 2 * 64 * n duplicacoes com subtracao condicional
+static void mont_r_squared(uint64_t *x, const uint64_t *mod, size_t n) {
+    memset(x, 0, n * sizeof(uint64_t));
+    x[0] = 1;
+    for (size_t i = 0; i < 2 * 64 * n; i++) {
+        uint64_t out = limb_add_n(x, x, x, n);
+        if (out != 0 || bigint_compare(x, mod, n) >= 0) limb_sub_n(x, x, mod, n);
+    }
+}
+
+bool bigint_pow_mod(uint64_t *result, const uint64_t *base, const uint64_t *exp, size_t exp_limbs,
+                    const uint64_t *mod, size_t n) {
+    if (result == NULL || base == NULL || mod == NULL || n == 0) return false;
+    if (exp == NULL && exp_limbs > 0) return false;
+    if ((mod[0] & 1) == 0) return false;
+
+    size_t top = n;
+    while (top > 1 && mod[top - 1] == 0) top--;
+    if (top == 1 && mod[0] == 1) {
+        memset(result, 0, n * sizeof(uint64_t));
+        return true;
+    }
+
+    const size_t table_size = (size_t)1 << POW_WINDOW_BITS;
+    size_t scratch = mul_scratch(n, &PLAN_AUTO);
+    uint64_t *mem = malloc(((table_size + 3) * n + 2 * n + 1 + scratch) * sizeof(uint64_t));
+    if (mem == NULL) return false;
+    uint64_t *table = mem;
+    uint64_t *acc = table + table_size * n;
+    uint64_t *r2 = acc + n;
+    uint64_t *one = r2 + n;
+
+    uint64_t inv = mod[0];                                // Newton: 3, 6, ..., 96 bits
+    for (int i = 0; i < 5; i++) inv *= 2 - mod[0] * inv;
+    Montgomery mt = { mod, n, (uint64_t)0 - inv, one + n, one + 3 * n + 1 };
+
+    mont_r_squared(r2, mod, n);
+    memset(one, 0, n * sizeof(uint64_t));
+    one[0] = 1;
+    mont_mul(&mt, table, one, r2);                        // R mod N
+    mont_mul(&mt, table + n, base, r2);                   // base R mod N
+    for (size_t i = 2; i < table_size; i++) {
+        mont_mul(&mt, table + i * n, table + (i - 1) * n, table + n);
+    }
+
+    memcpy(acc, table, n * sizeof(uint64_t));
+    bool started = false;
+    for (size_t w = exp_limbs * 64 / POW_WINDOW_BITS; w > 0; w--) {
+        size_t bit = (w - 1) * POW_WINDOW_BITS;
+        size_t digit = (size_t)(exp[bit / 64] >> (bit % 64)) & (table_size - 1);
+        if (started) {
+            for (int s = 0; s < POW_WINDOW_BITS; s++) mont_mul(&mt, acc, acc, acc);
+        }
+        if (digit != 0) {
+            mont_mul(&mt, acc, acc, table + digit * n);
+            started = true;
+        }
+    }
+
+    mont_mul(&mt, result, acc, one);
+    free(mem);
+    return true;
+}
@@ -11,291 +11,872 @@
  */
 
 #include "algorithms/divide_conquer.h"
+#include "algorithms/sorting.h"
+#include "data_structures/thread_pool.h"
 
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <float.h>
 #include <limits.h>
+#include <pthread.h>
+#include <time.h>
 
 // ============================================================================
 // STRASSEN MATRIX MULTIPLICATION - Cormen S4.2
 // ============================================================================
 
-#define STRASSEN_THRESHOLD 64
+// Multiplicacao blocada no esquema de Goto/BLIS: B e empacotado em paineis
+// de KC x NC, A em blocos de MC x KC, e um micro-kernel MR x NR mantem o
+// bloco de C em registradores ao longo de KC passos. MC e NC sao multiplos
+// de todos os MR e NR abaixo.
+#define GEMM_MC 96
+#define GEMM_KC 256
+#define GEMM_NC 2048
+#define GEMM_MR_MAX 8
+#define GEMM_NR_MAX 16
+
+// Micro-kernel: AVX-512 e AVX2 (FMA) escolhidos em tempo de execucao, NEON
+// em tempo de compilacao. Defina DIVIDE_CONQUER_NO_SIMD para o kernel escalar.
+#if !defined(DIVIDE_CONQUER_NO_SIMD) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define DC_USE_AVX 1
+#elif !defined(DIVIDE_CONQUER_NO_SIMD) && defined(__GNUC__) && \
+    defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define DC_USE_NEON 1
+#endif
+
+// c[r * ldc + j] += soma_l a[l * MR + r] * b[l * NR + j], para o bloco
+// MR x NR inteiro (as bordas passam por um bloco temporario)
+typedef void (*GemmKernelFn)(size_t kc, const double *a, const double *b, double *c, size_t ldc);
+
+typedef struct {
+    size_t mr;
+    size_t nr;
+    GemmKernelFn fn;
+} GemmKernel;
+
+static void gemm_kernel_scalar(size_t kc, const double *a, const double *b, double *c, size_t ldc) {
+    double acc[4][4] = {{0.0}};
+    for (size_t l = 0; l < kc; l++) {
+        for (size_t r = 0; r < 4; r++) {
+            for (size_t j = 0; j < 4; j++) acc[r][j] += a[r] * b[j];
+        }
+        a += 4;
+        b += 4;
+    }
+    for (size_t r = 0; r < 4; r++) {
+        for (size_t j = 0; j < 4; j++) c[r * ldc + j] += acc[r][j];
+    }
+}
 
-void matrix_multiply_classic(const double *A, const double *B, double *C, size_t n) {
-    if (A == NULL || B == NULL || C == NULL || n == 0) return;
+#if defined(DC_USE_AVX)
+
+// 6 x 8: 12 acumuladores ymm + 2 de B + 1 broadcast de A
+__attribute__((target("avx2,fma")))
+static void gemm_kernel_avx2(size_t kc, const double *a, const double *b, double *c, size_t ldc) {
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+    for (size_t l = 0; l < kc; l++) {
+        __m256d b0 = _mm256_loadu_pd(b);
+        __m256d b1 = _mm256_loadu_pd(b + 4);
+        __m256d ar;
+        ar = _mm256_broadcast_sd(a + 0); c00 = _mm256_fmadd_pd(ar, b0, c00); c01 = _mm256_fmadd_pd(ar, b1, c01);
+        ar = _mm256_broadcast_sd(a + 1); c10 = _mm256_fmadd_pd(ar, b0, c10); c11 = _mm256_fmadd_pd(ar, b1, c11);
+        ar = _mm256_broadcast_sd(a + 2); c20 = _mm256_fmadd_pd(ar, b0, c20); c21 = _mm256_fmadd_pd(ar, b1, c21);
+        ar = _mm256_broadcast_sd(a + 3); c30 = _mm256_fmadd_pd(ar, b0, c30); c31 = _mm256_fmadd_pd(ar, b1, c31);
+        ar = _mm256_broadcast_sd(a + 4); c40 = _mm256_fmadd_pd(ar, b0, c40); c41 = _mm256_fmadd_pd(ar, b1, c41);
+        ar = _mm256_broadcast_sd(a + 5); c50 = _mm256_fmadd_pd(ar, b0, c50); c51 = _mm256_fmadd_pd(ar, b1, c51);
+        a += 6;
+        b += 8;
+    }
+    const __m256d acc[6][2] = {{c00, c01}, {c10, c11}, {c20, c21}, {c30, c31}, {c40, c41}, {c50, c51}};
+    for (size_t r = 0; r < 6; r++) {
+        double *row = c + r * ldc;
+        _mm256_storeu_pd(row, _mm256_add_pd(_mm256_loadu_pd(row), acc[r][0]));
+        _mm256_storeu_pd(row + 4, _mm256_add_pd(_mm256_loadu_pd(row + 4), acc[r][1]));
+    }
+}
 
-    memset(C, 0, n * n * sizeof(double));
-    for (size_t i = 0; i < n; i++) {
-        for (size_t k = 0; k < n; k++) {
-            double a_ik = A[i * n + k];
-            for (size_t j = 0; j < n; j++) {
-                C[i * n + j] += a_ik * B[k * n + j];
-            }
+// 8 x 16: 16 acumuladores zmm (de 32)
+__attribute__((target("avx512f")))
+static void gemm_kernel_avx512(size_t kc, const double *a, const double *b, double *c, size_t ldc) {
+    __m512d acc[8][2];
+    for (size_t r = 0; r < 8; r++) {
+        acc[r][0] = _mm512_setzero_pd();
+        acc[r][1] = _mm512_setzero_pd();
+    }
+    for (size_t l = 0; l < kc; l++) {
+        __m512d b0 = _mm512_loadu_pd(b);
+        __m512d b1 = _mm512_loadu_pd(b + 8);
+        for (size_t r = 0; r < 8; r++) {
+            __m512d ar = _mm512_set1_pd(a[r]);
+            acc[r][0] = _mm512_fmadd_pd(ar, b0, acc[r][0]);
+            acc[r][1] = _mm512_fmadd_pd(ar, b1, acc[r][1]);
         }
+        a += 8;
+        b += 16;
+    }
+    for (size_t r = 0; r < 8; r++) {
+        double *row = c + r * ldc;
+        _mm512_storeu_pd(row, _mm512_add_pd(_mm512_loadu_pd(row), acc[r][0]));
+        _mm512_storeu_pd(row + 8, _mm512_add_pd(_mm512_loadu_pd(row + 8), acc[r][1]));
     }
 }
 
-static void matrix_add(const double *A, const double *B, double *C, size_t n) {
-    for (size_t i = 0; i < n * n; i++) C[i] = A[i] + B[i];
+#elif defined(DC_USE_NEON)
+
+// 4 x 8: 16 acumuladores float64x2 (de 32)
+static void gemm_kernel_neon(size_t kc, const double *a, const double *b, double *c, size_t ldc) {
+    float64x2_t acc[4][4];
+    for (size_t r = 0; r < 4; r++) {
+        for (size_t j = 0; j < 4; j++) acc[r][j] = vdupq_n_f64(0.0);
+    }
+    for (size_t l = 0; l < kc; l++) {
+        float64x2_t bv[4] = {vld1q_f64(b), vld1q_f64(b + 2), vld1q_f64(b + 4), vld1q_f64(b + 6)};
+        for (size_t r = 0; r < 4; r++) {
+            float64x2_t ar = vdupq_n_f64(a[r]);
+            for (size_t j = 0; j < 4; j++) acc[r][j] = vfmaq_f64(acc[r][j], ar, bv[j]);
+        }
+        a += 4;
+        b += 8;
+    }
+    for (size_t r = 0; r < 4; r++) {
+        double *row = c + r * ldc;
+        for (size_t j = 0; j < 4; j++) vst1q_f64(row + 2 * j, vaddq_f64(vld1q_f64(row + 2 * j), acc[r][j]));
+    }
 }
 
-static void matrix_sub(const double *A, const double *B, double *C, size_t n) {
-    for (size_t i = 0; i < n * n; i++) C[i] = A[i] - B[i];
+#endif
+
+static GemmKernel gemm_select_kernel(void) {
+    GemmKernel k = { 4, 4, gemm_kernel_scalar };
+#if defined(DC_USE_AVX)
+    static int detected = -1;
+    if (detected < 0) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) detected = 2;
+        else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) detected = 1;
+        else detected = 0;
+    }
+    if (detected == 2) {
+        k.mr = 8; k.nr = 16; k.fn = gemm_kernel_avx512;
+    } else if (detected == 1) {
+        k.mr = 6; k.nr = 8; k.fn = gemm_kernel_avx2;
+    }
+#elif defined(DC_USE_NEON)
+    k.mr = 4; k.nr = 8; k.fn = gemm_kernel_neon;
+#endif
+    return k;
 }
 
-static void extract_submatrix(const double *M, double *sub, size_t n, size_t row, size_t col) {
-    size_t half = n / 2;
-    for (size_t i = 0; i < half; i++) {
-        for (size_t j = 0; j < half; j++) {
-            sub[i * half + j] = M[(row + i) * n + (col + j)];
+// Bloco mc x kc de A em paineis de mr linhas (coluna a coluna), com zeros
+// completando o ultimo painel
+static void gemm_pack_a(const double *A, size_t lda, size_t mc, size_t kc, size_t mr, double *out) {
+    for (size_t i = 0; i < mc; i += mr) {
+        size_t rows = (mc - i < mr) ? mc - i : mr;
+        for (size_t l = 0; l < kc; l++) {
+            size_t r = 0;
+            for (; r < rows; r++) *out++ = A[(i + r) * lda + l];
+            for (; r < mr; r++) *out++ = 0.0;
         }
     }
 }
 
-static void place_submatrix(double *M, const double *sub, size_t n, size_t row, size_t col) {
-    size_t half = n / 2;
-    for (size_t i = 0; i < half; i++) {
-        for (size_t j = 0; j < half; j++) {
-            M[(row + i) * n + (col + j)] = sub[i * half + j];
+// Painel kc x nc de B em faixas de nr colunas (linha a linha)
+static void gemm_pack_b(const double *B, size_t ldb, size_t kc, size_t nc, size_t nr, double *out) {
+    for (size_t j = 0; j < nc; j += nr) {
+        size_t cols = (nc - j < nr) ? nc - j : nr;
+        for (size_t l = 0; l < kc; l++) {
+            const double *src = B + l * ldb + j;
+            size_t c = 0;
+            for (; c < cols; c++) *out++ = src[c];
+            for (; c < nr; c++) *out++ = 0.0;
         }
     }
 }
 
-static void strassen_recursive(const double *A, const double *B, double *C, size_t n) {
-    if (n <= STRASSEN_THRESHOLD) {
-        matrix_multiply_classic(A, B, C, n);
-        return;
+// C (m x n, ldc) = A (m x k, lda) * B (k x n, ldb), sem restricao de forma.
+// Devolve false se os buffers de empacotamento nao puderem ser alocados.
+static bool gemm(const double *A, size_t lda, const double *B, size_t ldb, double *C, size_t ldc,
+                 size_t m, size_t k, size_t n) {
+    GemmKernel kern = gemm_select_kernel();
+    size_t mr = kern.mr, nr = kern.nr;
+
+    size_t kc_max = (k < GEMM_KC) ? k : GEMM_KC;
+    size_t mc_max = (m < GEMM_MC) ? m : GEMM_MC;
+    size_t nc_max = (n < GEMM_NC) ? n : GEMM_NC;
+    double *pa = malloc(((mc_max + mr - 1) / mr) * mr * kc_max * sizeof(double));
+    double *pb = malloc(((nc_max + nr - 1) / nr) * nr * kc_max * sizeof(double));
+    if (pa == NULL || pb == NULL) {
+        free(pa);
+        free(pb);
+        return false;
+    }
+
+    for (size_t i = 0; i < m; i++) memset(C + i * ldc, 0, n * sizeof(double));
+
+    double edge[GEMM_MR_MAX * GEMM_NR_MAX];
+    for (size_t jc = 0; jc < n; jc += GEMM_NC) {
+        size_t nc = (n - jc < GEMM_NC) ? n - jc : GEMM_NC;
+        for (size_t pc = 0; pc < k; pc += GEMM_KC) {
+            size_t kc = (k - pc < GEMM_KC) ? k - pc : GEMM_KC;
+            gemm_pack_b(B + pc * ldb + jc, ldb, kc, nc, nr, pb);
+            for (size_t ic = 0; ic < m; ic += GEMM_MC) {
+                size_t mc = (m - ic < GEMM_MC) ? m - ic : GEMM_MC;
+                gemm_pack_a(A + ic * lda + pc, lda, mc, kc, mr, pa);
+                for (size_t jr = 0; jr < nc; jr += nr) {
+                    size_t cols = (nc - jr < nr) ? nc - jr : nr;
+                    const double *bp = pb + (jr / nr) * nr * kc;
+                    for (size_t ir = 0; ir < mc; ir += mr) {
+                        size_t rows = (mc - ir < mr) ? mc - ir : mr;
+                        const double *ap = pa + (ir / mr) * mr * kc;
+                        double *cp = C + (ic + ir) * ldc + jc + jr;
+                        if (rows == mr && cols == nr) {
+                            kern.fn(kc, ap, bp, cp, ldc);
+                            continue;
+                        }
+                        memset(edge, 0, mr * nr * sizeof(double));
+                        kern.fn(kc, ap, bp, edge, nr);
+                        for (size_t r = 0; r < rows; r++) {
+                            for (size_t c = 0; c < cols; c++) cp[r * ldc + c] += edge[r * nr + c];
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    free(pa);
+    free(pb);
+    return true;
+}
+
+// Laco i-k-j direto: matrizes minusculas e falha de alocacao do gemm
+static void gemm_naive(const double *A, const double *B, double *C, size_t m, size_t k, size_t n) {
+    memset(C, 0, m * n * sizeof(double));
+    for (size_t i = 0; i < m; i++) {
+        for (size_t l = 0; l < k; l++) {
+            double a_il = A[i * k + l];
+            for (size_t j = 0; j < n; j++) {
+                C[i * n + j] += a_il * B[l * n + j];
+            }
+        }
     }
+}
 
-    size_t half = n / 2;
-    size_t sub_size = half * half;
-
-    double *A11 = malloc(sub_size * sizeof(double));
-    double *A12 = malloc(sub_size * sizeof(double));
-    double *A21 = malloc(sub_size * sizeof(double));
-    double *A22 = malloc(sub_size * sizeof(double));
-    double *B11 = malloc(sub_size * sizeof(double));
-    double *B12 = malloc(sub_size * sizeof(double));
-    double *B21 = malloc(sub_size * sizeof(double));
-    double *B22 = malloc(sub_size * sizeof(double));
-
-    double *M1 = malloc(sub_size * sizeof(double));
-    double *M2 = malloc(sub_size * sizeof(double));
-    double *M3 = malloc(sub_size * sizeof(double));
-    double *M4 = malloc(sub_size * sizeof(double));
-    double *M5 = malloc(sub_size * sizeof(double));
-    double *M6 = malloc(sub_size * sizeof(double));
-    double *M7 = malloc(sub_size * sizeof(double));
-
-    double *T1 = malloc(sub_size * sizeof(double));
-    double *T2 = malloc(sub_size * sizeof(double));
-
-    if (!A11 || !A12 || !A21 || !A22 || !B11 || !B12 || !B21 || !B22 ||
-        !M1 || !M2 || !M3 || !M4 || !M5 || !M6 || !M7 || !T1 || !T2) {
-        free(A11); free(A12); free(A21); free(A22);
-        free(B11); free(B12); free(B21); free(B22);
-        free(M1); free(M2); free(M3); free(M4); free(M5); free(M6); free(M7);
-        free(T1); free(T2);
-        matrix_multiply_classic(A, B, C, n);
+void matrix_multiply(const double *A, const double *B, double *C, size_t m, size_t k, size_t n) {
+    if (A == NULL || B == NULL || C == NULL || m == 0 || n == 0) return;
+    if (k == 0) {
+        memset(C, 0, m * n * sizeof(double));
         return;
     }
+    if ((m <= 8 && n <= 8 && k <= 8) || !gemm(A, k, B, n, C, n, m, k, n)) {
+        gemm_naive(A, B, C, m, k, n);
+    }
+}
 
-    extract_submatrix(A, A11, n, 0, 0);
-    extract_submatrix(A, A12, n, 0, half);
-    extract_submatrix(A, A21, n, half, 0);
-    extract_submatrix(A, A22, n, half, half);
-    extract_submatrix(B, B11, n, 0, 0);
-    extract_submatrix(B, B12, n, 0, half);
-    extract_submatrix(B, B21, n, half, 0);
-    extract_submatrix(B, B22, n, half, half);
+void matrix_multiply_classic(const double *A, const double *B, double *C, size_t n) {
+    matrix_multiply(A, B, C, n, n, n);
+}
 
-    matrix_add(A11, A22, T1, half);
-    matrix_add(B11, B22, T2, half);
-    strassen_recursive(T1, T2, M1, half);
+// Recursao sobre visoes com stride (quadrantes apontam para dentro de A, B
+// e C, sem copias). Os 7 produtos usam a tabela abaixo: operando esquerdo
+// A[a1] + sa * A[a2], direito B[b1] + sb * B[b2] (indice 2 < 0 = sem soma),
+// e coef[q] e a contribuicao do produto para o quadrante q de C.
+// Quadrantes: 0 = 11, 1 = 12, 2 = 21, 3 = 22.
+typedef struct {
+    int a1, a2, sa;
+    int b1, b2, sb;
+    int coef[4];
+} StrassenProduct;
+
+static const StrassenProduct STRASSEN_PRODUCTS[7] = {
+    { 0,  3,  1,  0,  3,  1, { 1, 0, 0,  1 } },   // M1 = (A11 + A22)(B11 + B22)
+    { 2,  3,  1,  0, -1,  0, { 0, 0, 1, -1 } },   // M2 = (A21 + A22) B11
+    { 0, -1,  0,  1,  3, -1, { 0, 1, 0,  1 } },   // M3 = A11 (B12 - B22)
+    { 3, -1,  0,  2,  0, -1, { 1, 0, 1,  0 } },   // M4 = A22 (B21 - B11)
+    { 0,  1,  1,  3, -1,  0, {-1, 1, 0,  0 } },   // M5 = (A11 + A12) B22
+    { 2,  0, -1,  0,  1,  1, { 0, 0, 0,  1 } },   // M6 = (A21 - A11)(B11 + B12)
+    { 1,  3, -1,  2,  3,  1, { 1, 0, 0,  0 } },   // M7 = (A12 - A22)(B21 + B22)
+};
+
+typedef struct {
+    size_t threshold;
+    size_t depth;       // niveis restantes com os 7 produtos em tarefas
+} StrassenPlan;
+
+// Z (h x h, contiguo) = X + sign * Y
+static void quad_combine(const double *X, size_t ldx, const double *Y, size_t ldy, int sign,
+                         double *Z, size_t h) {
+    for (size_t i = 0; i < h; i++) {
+        const double *x = X + i * ldx, *y = Y + i * ldy;
+        double *z = Z + i * h;
+        if (sign > 0) {
+            for (size_t j = 0; j < h; j++) z[j] = x[j] + y[j];
+        } else {
+            for (size_t j = 0; j < h; j++) z[j] = x[j] - y[j];
+        }
+    }
+}
 
-    matrix_add(A21, A22, T1, half);
-    strassen_recursive(T1, B11, M2, half);
+// C[q] = M (primeira contribuicao) ou C[q] += coef * M
+static void quad_accumulate(double *C, size_t ldc, const double *M, size_t h, int coef, bool first) {
+    for (size_t i = 0; i < h; i++) {
+        double *c = C + i * ldc;
+        const double *m = M + i * h;
+        if (first) {
+            memcpy(c, m, h * sizeof(double));
+        } else if (coef > 0) {
+            for (size_t j = 0; j < h; j++) c[j] += m[j];
+        } else {
+            for (size_t j = 0; j < h; j++) c[j] -= m[j];
+        }
+    }
+}
 
-    matrix_sub(B12, B22, T1, half);
-    strassen_recursive(A11, T1, M3, half);
+static void gemm_strided(const double *A, size_t lda, const double *B, size_t ldb,
+                         double *C, size_t ldc, size_t n) {
+    if (gemm(A, lda, B, ldb, C, ldc, n, n, n)) return;
+    for (size_t i = 0; i < n; i++) {
+        double *c = C + i * ldc;
+        memset(c, 0, n * sizeof(double));
+        for (size_t l = 0; l < n; l++) {
+            double a = A[i * lda + l];
+            for (size_t j = 0; j < n; j++) c[j] += a * B[l * ldb + j];
+        }
+    }
+}
 
-    matrix_sub(B21, B11, T1, half);
-    strassen_recursive(A22, T1, M4, half);
+// Workspace de um nivel: Ta, Tb e M (h x h cada) mais o dos filhos. Nos
+// niveis paralelos cada um dos 7 produtos tem a sua propria fatia.
+static size_t strassen_workspace(size_t n, size_t threshold, size_t depth) {
+    if (n <= threshold) return 0;
+    size_t h = n / 2;
+    size_t slice = 3 * h * h + strassen_workspace(h, threshold, depth > 0 ? depth - 1 : 0);
+    return (depth > 0) ? 7 * slice : slice;
+}
+
+static void strassen_rec(const double *A, size_t lda, const double *B, size_t ldb,
+                         double *C, size_t ldc, size_t n, double *ws, StrassenPlan plan);
+
+// Produto p: monta os operandos em ta/tb e multiplica para m
+static void strassen_product(const StrassenProduct *p, const double *const qa[4], size_t lda,
+                             const double *const qb[4], size_t ldb, size_t h,
+                             double *ta, double *m, StrassenPlan plan) {
+    double *tb = ta + h * h;
+    double *child = m + h * h;
+    const double *left = qa[p->a1], *right = qb[p->b1];
+    size_t ldl = lda, ldr = ldb;
+    if (p->a2 >= 0) {
+        quad_combine(qa[p->a1], lda, qa[p->a2], lda, p->sa, ta, h);
+        left = ta;
+        ldl = h;
+    }
+    if (p->b2 >= 0) {
+        quad_combine(qb[p->b1], ldb, qb[p->b2], ldb, p->sb, tb, h);
+        right = tb;
+        ldr = h;
+    }
+    strassen_rec(left, ldl, right, ldr, m, h, h, child, plan);
+}
+
+// Um dos 7 produtos de um nivel paralelo (tarefa do pool)
+typedef struct {
+    const StrassenProduct *product;
+    const double *const *qa;
+    size_t lda;
+    const double *const *qb;
+    size_t ldb;
+    size_t h;
+    double *ta;
+    double *m;
+    StrassenPlan plan;
+} StrassenProductTask;
+
+static void strassen_product_task(void *arg) {
+    const StrassenProductTask *t = arg;
+    strassen_product(t->product, t->qa, t->lda, t->qb, t->ldb, t->h, t->ta, t->m, t->plan);
+}
+
+static void strassen_rec(const double *A, size_t lda, const double *B, size_t ldb,
+                         double *C, size_t ldc, size_t n, double *ws, StrassenPlan plan) {
+    if (n <= plan.threshold) {
+        gemm_strided(A, lda, B, ldb, C, ldc, n);
+        return;
+    }
 
-    matrix_add(A11, A12, T1, half);
-    strassen_recursive(T1, B22, M5, half);
+    size_t h = n / 2;
+    const double *qa[4] = { A, A + h, A + h * lda, A + h * lda + h };
+    const double *qb[4] = { B, B + h, B + h * ldb, B + h * ldb + h };
+    double *qc[4] = { C, C + h, C + h * ldc, C + h * ldc + h };
+    bool written[4] = { false, false, false, false };
+
+    StrassenPlan child = plan;
+    if (plan.depth > 0) {
+        child.depth = plan.depth - 1;
+        size_t slice = 3 * h * h + strassen_workspace(h, plan.threshold, child.depth);
+        StrassenProductTask tasks[7];
+        DSTaskGroup group;
+        ds_task_group_init(&group);
+        for (size_t i = 0; i < 7; i++) {
+            double *base = ws + i * slice;
+            tasks[i] = (StrassenProductTask){ &STRASSEN_PRODUCTS[i], qa, lda, qb, ldb, h,
+                                              base, base + 2 * h * h, child };
+            if (i < 6) ds_task_spawn(&group, strassen_product_task, &tasks[i]);
+        }
+        strassen_product_task(&tasks[6]);
+        ds_task_wait(&group);
+        for (size_t i = 0; i < 7; i++) {
+            const double *m = ws + i * slice + 2 * h * h;
+            for (size_t q = 0; q < 4; q++) {
+                int coef = STRASSEN_PRODUCTS[i].coef[q];
+                if (coef == 0) continue;
+                quad_accumulate(qc[q], ldc, m, h, coef, !written[q]);
+                written[q] = true;
+            }
+        }
+        return;
+    }
 
-    matrix_sub(A21, A11, T1, half);
-    matrix_add(B11, B12, T2, half);
-    strassen_recursive(T1, T2, M6, half);
+    // Serial: um unico M reaproveitado, somado em C logo apos cada produto
+    double *m = ws + 2 * h * h;
+    for (size_t i = 0; i < 7; i++) {
+        strassen_product(&STRASSEN_PRODUCTS[i], qa, lda, qb, ldb, h, ws, m, child);
+        for (size_t q = 0; q < 4; q++) {
+            int coef = STRASSEN_PRODUCTS[i].coef[q];
+            if (coef == 0) continue;
+            quad_accumulate(qc[q], ldc, m, h, coef, !written[q]);
+            written[q] = true;
+        }
+    }
+}
 
-    matrix_sub(A12, A22, T1, half);
-    matrix_add(B21, B22, T2, half);
-    strassen_recursive(T1, T2, M7, half);
+static double dc_now(void) {
+    struct timespec ts;
+    if (timespec_get(&ts, TIME_UTC) == 0) return 0.0;
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
 
-    matrix_add(M1, M4, T1, half);
-    matrix_sub(T1, M5, T2, half);
-    matrix_add(T2, M7, T1, half);
-    place_submatrix(C, T1, n, 0, 0);
+// Limiar medido uma vez por processo (pthread_once: chamadas concorrentes
+// esperam a primeira em vez de medir de novo)
+static size_t strassen_tuned = STRASSEN_THRESHOLD_DEFAULT;
+static pthread_once_t strassen_tune_once = PTHREAD_ONCE_INIT;
+
+static void strassen_measure(void) {
+    if (dc_now() == 0.0) return;
+
+    size_t big = 2 * STRASSEN_THRESHOLD_MAX;
+    double *A = malloc(big * big * sizeof(double));
+    double *B = malloc(big * big * sizeof(double));
+    double *C = malloc(big * big * sizeof(double));
+    double *ws = malloc(strassen_workspace(big, STRASSEN_THRESHOLD_MIN, 0) * sizeof(double));
+    if (A == NULL || B == NULL || C == NULL || ws == NULL) {
+        free(A); free(B); free(C); free(ws);
+        return;
+    }
+    for (size_t i = 0; i < big * big; i++) {
+        A[i] = (double)(i % 13) * 0.25;
+        B[i] = (double)(i % 7) - 3.0;
+    }
 
-    matrix_add(M3, M5, T1, half);
-    place_submatrix(C, T1, n, 0, half);
+    // Menor s em que um nivel de Strassen sobre 2s (7 produtos s x s) vence
+    // o GEMM direto de 2s. Tamanhos pequenos sao repetidos ate somarem 1/8
+    // do trabalho do maior, e vale o melhor de 3 medicoes
+    size_t result = 0;
+    gemm_strided(A, big, B, big, C, big, big / 2);
+    for (size_t s = STRASSEN_THRESHOLD_MIN; s <= STRASSEN_THRESHOLD_MAX && result == 0; s *= 2) {
+        size_t n = 2 * s;
+        size_t ratio = big / n;
+        size_t reps = (ratio * ratio * ratio) / 8;
+        if (reps == 0) reps = 1;
+        StrassenPlan plan = { s, 0 };
+        double best_gemm = 0.0, best_strassen = 0.0;
+        for (int trial = 0; trial < 3; trial++) {
+            double t0 = dc_now();
+            for (size_t r = 0; r < reps; r++) gemm_strided(A, n, B, n, C, n, n);
+            double t1 = dc_now();
+            for (size_t r = 0; r < reps; r++) strassen_rec(A, n, B, n, C, n, n, ws, plan);
+            double t2 = dc_now();
+            if (trial == 0 || t1 - t0 < best_gemm) best_gemm = t1 - t0;
+            if (trial == 0 || t2 - t1 < best_strassen) best_strassen = t2 - t1;
+        }
+        if (best_strassen < best_gemm) result = s;
+    }
+    if (result == 0) result = STRASSEN_THRESHOLD_MAX;
 
-    matrix_add(M2, M4, T1, half);
-    place_submatrix(C, T1, n, half, 0);
+    free(A); free(B); free(C); free(ws);
+    strassen_tuned = result;
+}
 
-    matrix_sub(M1, M2, T1, half);
-    matrix_add(T1, M3, T2, half);
-    matrix_add(T2, M6, T1, half);
-    place_submatrix(C, T1, n, half, half);
+size_t strassen_autotune(void) {
+    pthread_once(&strassen_tune_once, strassen_measure);
+    return strassen_tuned;
+}
 
-    free(A11); free(A12); free(A21); free(A22);
-    free(B11); free(B12); free(B21); free(B22);
-    free(M1); free(M2); free(M3); free(M4); free(M5); free(M6); free(M7);
-    free(T1); free(T2);
+StrassenConfig strassen_default_config(void) {
+    StrassenConfig config = {
+        .threshold = 0,
+        .parallel_depth = 1,
+        .num_threads = 0
+    };
+    return config;
 }
 
-void strassen_multiply(const double *A, const double *B, double *C, size_t n) {
+void strassen_multiply_ex(const double *A, const double *B, double *C, size_t n,
+                          const StrassenConfig *config) {
     if (A == NULL || B == NULL || C == NULL || n == 0) return;
 
-    size_t padded = 1;
-    while (padded < n) padded <<= 1;
-
-    if (padded == n) {
-        strassen_recursive(A, B, C, n);
+    StrassenConfig cfg = config ? *config : strassen_default_config();
+    size_t threshold = cfg.threshold;
+    if (threshold == 0) {
+        if (n <= STRASSEN_THRESHOLD_MIN) {
+            matrix_multiply(A, B, C, n, n, n);
+            return;
+        }
+        threshold = strassen_autotune();
+    }
+    if (n <= threshold) {
+        matrix_multiply(A, B, C, n, n, n);
         return;
     }
 
-    double *Ap = calloc(padded * padded, sizeof(double));
-    double *Bp = calloc(padded * padded, sizeof(double));
-    double *Cp = calloc(padded * padded, sizeof(double));
-    if (!Ap || !Bp || !Cp) {
-        free(Ap); free(Bp); free(Cp);
-        matrix_multiply_classic(A, B, C, n);
+    size_t depth = ds_parallel_enabled(cfg.num_threads) ? cfg.parallel_depth : 0;
+
+    // Strassen so divide enquanto n > threshold: basta completar n ate um
+    // multiplo de 2^niveis (n = 1025 com limiar 512 vira 1032, nao 2048)
+    size_t unit = 1;
+    while ((n + unit - 1) / unit > threshold) unit <<= 1;
+    size_t padded = (n + unit - 1) / unit * unit;
+
+    StrassenPlan plan = { threshold, depth };
+    double *ws = malloc(strassen_workspace(padded, threshold, depth) * sizeof(double));
+    double *Ap = NULL, *Bp = NULL, *Cp = NULL;
+    if (padded != n) {
+        Ap = calloc(padded * padded, sizeof(double));
+        Bp = calloc(padded * padded, sizeof(double));
+        Cp = malloc(padded * padded * sizeof(double));
+    }
+    if (ws == NULL || (padded != n && (Ap == NULL || Bp == NULL || Cp == NULL))) {
+        free(ws); free(Ap); free(Bp); free(Cp);
+        matrix_multiply(A, B, C, n, n, n);
         return;
     }
 
-    for (size_t i = 0; i < n; i++) {
-        memcpy(Ap + i * padded, A + i * n, n * sizeof(double));
-        memcpy(Bp + i * padded, B + i * n, n * sizeof(double));
+    const double *a = A, *b = B;
+    double *c = C;
+    if (padded != n) {
+        for (size_t i = 0; i < n; i++) {
+            memcpy(Ap + i * padded, A + i * n, n * sizeof(double));
+            memcpy(Bp + i * padded, B + i * n, n * sizeof(double));
+        }
+        a = Ap;
+        b = Bp;
+        c = Cp;
     }
 
-    strassen_recursive(Ap, Bp, Cp, padded);
+    // Garante a deteccao do micro-kernel antes das tarefas
+    (void)gemm_select_kernel();
+    strassen_rec(a, padded, b, padded, c, padded, padded, ws, plan);
 
-    for (size_t i = 0; i < n; i++) {
-        memcpy(C + i * n, Cp + i * padded, n * sizeof(double));
+    if (padded != n) {
+        for (size_t i = 0; i < n; i++) {
+            memcpy(C + i * n, Cp + i * padded, n * sizeof(double));
+        }
     }
+    free(ws); free(Ap); free(Bp); free(Cp);
+}
 
-    free(Ap); free(Bp); free(Cp);
+void strassen_multiply(const double *A, const double *B, double *C, size_t n) {
+    strassen_multiply_ex(A, B, C, n, NULL);
 }
 
 // ============================================================================
 // CLOSEST PAIR OF POINTS - Cormen S33.4
 // ============================================================================
 
-static double point_dist(Point2D a, Point2D b) {
-    double dx = a.x - b.x;
-    double dy = a.y - b.y;
-    return sqrt(dx * dx + dy * dy);
+// Pontos em SoA (x e y em arrays separados), ordenados por x uma unica vez.
+// Cada chamada recebe o segmento [lo, hi) em ordem de x e o devolve em
+// ordem de y (merge das metades, como no merge sort); tx/ty sao o buffer
+// do merge e depois guardam a faixa central. Todos os acessos sao
+// sequenciais.
+typedef struct {
+    double *x;
+    double *y;
+    double *tx;
+    double *ty;
+    bool parallel;      // metades grandes viram tarefas do pool
+} ClosestPairData;
+
+typedef struct {
+    double d2;          // menor distancia ao quadrado
+    double ax, ay, bx, by;
+} ClosestPairBest;
+
+// Abaixo disso o segmento e resolvido por forca bruta
+#define CP_BRUTE_FORCE 8
+// Segmentos menores nao viram tarefas do pool
+#define CP_TASK_MIN 32768
+
+static inline void cp_consider(ClosestPairBest *best, double ax, double ay, double bx, double by) {
+    double dx = ax - bx;
+    double dy = ay - by;
+    double d2 = dx * dx + dy * dy;
+    if (d2 < best->d2) {
+        best->d2 = d2;
+        best->ax = ax;
+        best->ay = ay;
+        best->bx = bx;
+        best->by = by;
+    }
 }
 
-static int cmp_x(const void *a, const void *b) {
-    double diff = ((const Point2D *)a)->x - ((const Point2D *)b)->x;
-    return (diff > 0) ? 1 : (diff < 0) ? -1 : 0;
-}
+static ClosestPairBest cp_rec(const ClosestPairData *data, size_t lo, size_t hi);
 
-static int cmp_y(const void *a, const void *b) {
-    double diff = ((const Point2D *)a)->y - ((const Point2D *)b)->y;
-    return (diff > 0) ? 1 : (diff < 0) ? -1 : 0;
+// Metade esquerda como tarefa do pool
+typedef struct {
+    const ClosestPairData *data;
+    size_t lo, hi;
+    ClosestPairBest best;
+} ClosestPairTask;
+
+static void cp_task(void *arg) {
+    ClosestPairTask *t = arg;
+    t->best = cp_rec(t->data, t->lo, t->hi);
 }
 
-static ClosestPairResult brute_force_closest(Point2D *points, size_t n) {
-    ClosestPairResult best;
-    best.distance = DBL_MAX;
-    for (size_t i = 0; i < n; i++) {
-        for (size_t j = i + 1; j < n; j++) {
-            double d = point_dist(points[i], points[j]);
-            if (d < best.distance) {
-                best.distance = d;
-                best.p1 = points[i];
-                best.p2 = points[j];
+static ClosestPairBest cp_rec(const ClosestPairData *data, size_t lo, size_t hi) {
+    ClosestPairBest best = { DBL_MAX, 0.0, 0.0, 0.0, 0.0 };
+    double *x = data->x, *y = data->y;
+    size_t n = hi - lo;
+    if (n <= CP_BRUTE_FORCE) {
+        for (size_t i = lo; i < hi; i++) {
+            for (size_t j = i + 1; j < hi; j++) cp_consider(&best, x[i], y[i], x[j], y[j]);
+        }
+        // Insercao por y: o segmento sai em ordem de y
+        for (size_t i = lo + 1; i < hi; i++) {
+            double kx = x[i], ky = y[i];
+            size_t j = i;
+            while (j > lo && y[j - 1] > ky) {
+                x[j] = x[j - 1];
+                y[j] = y[j - 1];
+                j--;
             }
+            x[j] = kx;
+            y[j] = ky;
         }
+        return best;
     }
-    return best;
-}
 
-static ClosestPairResult closest_pair_rec(Point2D *px, Point2D *py, Point2D *temp, size_t n) {
-    if (n <= 3) {
-        return brute_force_closest(px, n);
+    size_t mid = lo + n / 2;
+    double xm = x[mid];
+
+    ClosestPairTask left = { data, lo, mid, best };
+    ClosestPairBest br;
+    if (data->parallel && n >= CP_TASK_MIN) {
+        DSTaskGroup group;
+        ds_task_group_init(&group);
+        ds_task_spawn(&group, cp_task, &left);
+        br = cp_rec(data, mid, hi);
+        ds_task_wait(&group);
+    } else {
+        cp_task(&left);
+        br = cp_rec(data, mid, hi);
+    }
+    best = (left.best.d2 <= br.d2) ? left.best : br;
+
+    // Merge por y das metades em tx/ty e de volta
+    double *tx = data->tx, *ty = data->ty;
+    size_t i = lo, j = mid, k = lo;
+    while (i < mid && j < hi) {
+        if (y[j] < y[i]) { tx[k] = x[j]; ty[k++] = y[j++]; }
+        else { tx[k] = x[i]; ty[k++] = y[i++]; }
+    }
+    while (i < mid) { tx[k] = x[i]; ty[k++] = y[i++]; }
+    while (j < hi) { tx[k] = x[j]; ty[k++] = y[j++]; }
+    memcpy(x + lo, tx + lo, n * sizeof(double));
+    memcpy(y + lo, ty + lo, n * sizeof(double));
+
+    // Faixa |x - x_mid| < d, ja em ordem de y; reaproveita tx/ty
+    double d = sqrt(best.d2);
+    double *sx = tx + lo, *sy = ty + lo;
+    size_t count = 0;
+    for (size_t t = lo; t < hi; t++) {
+        if (fabs(x[t] - xm) < d) {
+            sx[count] = x[t];
+            sy[count] = y[t];
+            count++;
+        }
     }
 
-    size_t mid = n / 2;
-    Point2D mid_point = px[mid];
-
-    size_t li = 0, ri = 0;
-    Point2D *pyl = temp;
-    Point2D *pyr = temp + mid;
-    for (size_t i = 0; i < n; i++) {
-        if ((py[i].x < mid_point.x || (py[i].x == mid_point.x && py[i].y < mid_point.y)) && li < mid) {
-            pyl[li++] = py[i];
-        } else {
-            pyr[ri++] = py[i];
+    for (size_t a = 0; a < count; a++) {
+        for (size_t c = a + 1; c < count && sy[c] - sy[a] < d; c++) {
+            double before = best.d2;
+            cp_consider(&best, sx[a], sy[a], sx[c], sy[c]);
+            if (best.d2 < before) d = sqrt(best.d2);
         }
     }
+    return best;
+}
 
-    Point2D *temp_next = temp + n;
-    ClosestPairResult dl = closest_pair_rec(px, pyl, temp_next, mid);
-    ClosestPairResult dr = closest_pair_rec(px + mid, pyr, temp_next, n - mid);
+ClosestPairResult closest_pair_parallel(const Point2D *points, size_t n, size_t num_threads) {
+    ClosestPairResult result = { {0,0}, {0,0}, DBL_MAX };
+    if (points == NULL || n < 2) return result;
 
-    ClosestPairResult best = (dl.distance <= dr.distance) ? dl : dr;
-    double d = best.distance;
+    double *x = malloc(n * sizeof(double));
+    double *y = malloc(n * sizeof(double));
+    double *tx = malloc(n * sizeof(double));
+    double *ty = malloc(n * sizeof(double));
+    if (!x || !y || !tx || !ty) {
+        free(x); free(y); free(tx); free(ty);
+        return result;
+    }
 
-    Point2D *strip = temp;
-    size_t strip_count = 0;
+    // Pre-ordenacao unica por x, radix sobre os bits da coordenada, com y
+    // como valor associado: sai direto em SoA. radix_sort_kv deixa os
+    // arrays intactos se faltar memoria (e NaN nao segue a ordem de <),
+    // por isso a ordem e conferida em O(n).
     for (size_t i = 0; i < n; i++) {
-        if (fabs(py[i].x - mid_point.x) < d) {
-            strip[strip_count++] = py[i];
-        }
+        x[i] = points[i].x;
+        y[i] = points[i].y;
     }
-
-    for (size_t i = 0; i < strip_count; i++) {
-        for (size_t j = i + 1; j < strip_count && (strip[j].y - strip[i].y) < d; j++) {
-            double dist = point_dist(strip[i], strip[j]);
-            if (dist < best.distance) {
-                best.distance = dist;
-                best.p1 = strip[i];
-                best.p2 = strip[j];
-            }
+    radix_sort_kv(RADIX_KEY_DOUBLE, x, y, n, sizeof(double), num_threads);
+    for (size_t i = 1; i < n; i++) {
+        if (!(x[i - 1] <= x[i])) {
+            free(x); free(y); free(tx); free(ty);
+            return result;
         }
     }
 
-    return best;
+    ClosestPairData data = { x, y, tx, ty, ds_parallel_enabled(num_threads) };
+    ClosestPairBest best = cp_rec(&data, 0, n);
+
+    result.p1.x = best.ax;
+    result.p1.y = best.ay;
+    result.p2.x = best.bx;
+    result.p2.y = best.by;
+    result.distance = sqrt(best.d2);
+    free(x); free(y); free(tx); free(ty);
+    return result;
 }
 
 ClosestPairResult closest_pair(Point2D *points, size_t n) {
+    return closest_pair_parallel(points, n, 1);
+}
+
+// Grade uniforme com ~1 ponto por celula; celulas em ordem de linha
+// (contagem + prefixo), pontos em SoA na ordem das celulas.
+#define CP_GRID_MAX_LOAD 32
+
+ClosestPairResult closest_pair_grid(const Point2D *points, size_t n) {
     ClosestPairResult result = { {0,0}, {0,0}, DBL_MAX };
     if (points == NULL || n < 2) return result;
 
-    Point2D *px = malloc(n * sizeof(Point2D));
-    Point2D *py = malloc(n * sizeof(Point2D));
-    Point2D *temp = malloc(2 * n * sizeof(Point2D));
-    if (!px || !py || !temp) {
-        free(px); free(py); free(temp);
-        return brute_force_closest(points, n);
+    double minx = points[0].x, maxx = points[0].x;
+    double miny = points[0].y, maxy = points[0].y;
+    for (size_t i = 1; i < n; i++) {
+        if (points[i].x < minx) minx = points[i].x;
+        if (points[i].x > maxx) maxx = points[i].x;
+        if (points[i].y < miny) miny = points[i].y;
+        if (points[i].y > maxy) maxy = points[i].y;
+    }
+    double w = maxx - minx, h = maxy - miny;
+    if (w == 0.0 && h == 0.0) {
+        result.p1 = points[0];
+        result.p2 = points[1];
+        result.distance = 0.0;
+        return result;
+    }
+
+    // Lado: area/n, mas nunca menor que (lado maior)/n, o que limita a
+    // grade a 3n + 1 celulas mesmo com pontos quase colineares
+    double side = sqrt(w * h / (double)n);
+    double line = ((w > h) ? w : h) / (double)n;
+    if (side < line) side = line;
+    size_t gw = (size_t)(w / side) + 1;
+    size_t gh = (size_t)(h / side) + 1;
+    size_t cells = gw * gh;
+
+    size_t *start = calloc(cells + 1, sizeof(size_t));
+    size_t *cell = malloc(n * sizeof(size_t));
+    double *gx = malloc(n * sizeof(double));
+    double *gy = malloc(n * sizeof(double));
+    if (!start || !cell || !gx || !gy) {
+        free(start); free(cell); free(gx); free(gy);
+        return closest_pair_parallel(points, n, 1);
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        size_t cx = (size_t)((points[i].x - minx) / side);
+        size_t cy = (size_t)((points[i].y - miny) / side);
+        if (cx >= gw) cx = gw - 1;
+        if (cy >= gh) cy = gh - 1;
+        cell[i] = cy * gw + cx;
+        start[cell[i] + 1]++;
+    }
+
+    // Dados muito concentrados degeneram para O(n^2): volta ao D&C
+    size_t load = 0;
+    for (size_t c = 1; c <= cells; c++) load += start[c] * start[c];
+    if (load > CP_GRID_MAX_LOAD * n) {
+        free(start); free(cell); free(gx); free(gy);
+        return closest_pair_parallel(points, n, 1);
     }
 
-    memcpy(px, points, n * sizeof(Point2D));
-    memcpy(py, points, n * sizeof(Point2D));
-    qsort(px, n, sizeof(Point2D), cmp_x);
-    qsort(py, n, sizeof(Point2D), cmp_y);
+    for (size_t c = 0; c < cells; c++) start[c + 1] += start[c];
+    for (size_t i = 0; i < n; i++) {
+        size_t pos = start[cell[i]]++;
+        gx[pos] = points[i].x;
+        gy[pos] = points[i].y;
+    }
+    for (size_t c = cells; c > 0; c--) start[c] = start[c - 1];
+    start[0] = 0;
+
+    // Cada celula contra si mesma e meia vizinhanca (direita e linha de cima)
+    double best = DBL_MAX;
+    size_t ba = 0, bb = 1;
+    for (size_t cy = 0; cy < gh; cy++) {
+        for (size_t cx = 0; cx < gw; cx++) {
+            size_t c = cy * gw + cx;
+            for (size_t i = start[c]; i < start[c + 1]; i++) {
+                for (size_t j = i + 1; j < start[c + 1]; j++) {
+                    double dx = gx[i] - gx[j], dy = gy[i] - gy[j];
+                    double d2 = dx * dx + dy * dy;
+                    if (d2 < best) { best = d2; ba = i; bb = j; }
+                }
+                static const int nb[4][2] = { {1, 0}, {-1, 1}, {0, 1}, {1, 1} };
+                for (int k = 0; k < 4; k++) {
+                    if ((nb[k][0] < 0 && cx == 0) || (nb[k][0] > 0 && cx + 1 >= gw)) continue;
+                    if (nb[k][1] > 0 && cy + 1 >= gh) continue;
+                    size_t o = (cy + (size_t)nb[k][1]) * gw + (size_t)((ptrdiff_t)cx + nb[k][0]);
+                    for (size_t j = start[o]; j < start[o + 1]; j++) {
+                        double dx = gx[i] - gx[j], dy = gy[i] - gy[j];
+                        double d2 = dx * dx + dy * dy;
+                        if (d2 < best) { best = d2; ba = i; bb = j; }
+                    }
+                }
+            }
+        }
+    }
 
-    result = closest_pair_rec(px, py, temp, n);
+    // So e exato se o par cabe na vizinhanca: distancia <= lado da celula
+    if (best > side * side) {
+        free(start); free(cell); free(gx); free(gy);
+        return closest_pair_parallel(points, n, 1);
+    }
 
-    free(px); free(py); free(temp);
+    result.p1.x = gx[ba];
+    result.p1.y = gy[ba];
+    result.p2.x = gx[bb];
+    result.p2.y = gy[bb];
+    result.distance = sqrt(best);
+    free(start); free(cell); free(gx); free(gy);
     return result;
 }
 
@@ -460,8 +1041,14 @@ static size_t partition_qs(int *arr, size_t low, size_t high) {
     return i;
 }
 
+// Subarrays de ate 32 elementos: rede de ordenacao em vez de particionar
+#define QUICK_SELECT_NETWORK_MAX 32
+
 static int quick_select_rec(int *arr, size_t low, size_t high, size_t k) {
-    if (low == high) return arr[low];
+    if (high - low < QUICK_SELECT_NETWORK_MAX) {
+        sort_small_int(arr + low, high - low + 1);
+        return arr[k];
+    }
 
     size_t pivot_idx = partition_qs(arr, low, high);
 
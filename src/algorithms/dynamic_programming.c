@@ -6,17 +6,36 @@
  * - Cormen et al. (2009), Chapters 15.1-15.4
  * - Bellman (1957), "Dynamic Programming"
  * - Levenshtein (1966), "Binary codes capable of correcting deletions"
+ * - Myers (1999), "A fast bit-vector algorithm for approximate string matching"
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
  */
 
 #include "algorithms/dynamic_programming.h"
+#include "data_structures/thread_pool.h"
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <limits.h>
 
+
+// Relaxacao do knapsack: AVX2 escolhido em tempo de execucao; SSE2/NEON em
+// tempo de compilacao. Defina DYNAMIC_PROGRAMMING_NO_SIMD para o laco escalar.
+#if !defined(DYNAMIC_PROGRAMMING_NO_SIMD) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define DP_USE_AVX2 1
+#if defined(__SSE2__)
+#define DP_USE_SSE2 1
+#endif
+#elif !defined(DYNAMIC_PROGRAMMING_NO_SIMD) && defined(__GNUC__) && \
+    defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define DP_USE_NEON 1
+#endif
+
 // ============================================================================
 // FIBONACCI - Cormen S15.1
 // ============================================================================
@@ -68,6 +87,12 @@ size_t dp_lcs_length(const char *x, const char *y) {
 
     if (m == 0 || n == 0) return 0;
 
+    // Linhas sobre a string menor: O(min(m,n)) espaco
+    if (n > m) {
+        const char *ts = x; x = y; y = ts;
+        size_t tn = m; m = n; n = tn;
+    }
+
     size_t *prev = calloc(n + 1, sizeof(size_t));
     size_t *curr = calloc(n + 1, sizeof(size_t));
     if (prev == NULL || curr == NULL) {
@@ -87,7 +112,6 @@ size_t dp_lcs_length(const char *x, const char *y) {
         size_t *tmp = prev;
         prev = curr;
         curr = tmp;
-        memset(curr, 0, (n + 1) * sizeof(size_t));
     }
 
     size_t result = prev[n];
@@ -96,6 +120,95 @@ size_t dp_lcs_length(const char *x, const char *y) {
     return result;
 }
 
+// Bloco (linhas [r0, r1), colunas [c0, c1)) da tabela LCS, 1-based.
+// top[c0..c1) chega com a ultima linha do bloco de cima e sai com a
+// ultima linha deste; left[r0..r1) idem para a ultima coluna. corner e o
+// valor D[r0-1][c0-1]; a saida e D[r0-1][c1-1], o canto do bloco seguinte
+// na mesma faixa de linhas.
+#define LCS_WAVEFRONT_BLOCK 256
+
+static size_t lcs_block(const char *x, const char *y, size_t r0, size_t r1, size_t c0, size_t c1,
+                        size_t *top, size_t *left, size_t corner) {
+    size_t up[LCS_WAVEFRONT_BLOCK + 1];
+    size_t w = c1 - c0;
+    size_t next_corner = top[c1 - 1];
+
+    up[0] = corner;
+    memcpy(up + 1, top + c0, w * sizeof(size_t));
+    for (size_t r = r0; r < r1; r++) {
+        size_t diag = up[0];
+        up[0] = left[r];
+        char c = x[r - 1];
+        for (size_t k = 1; k <= w; k++) {
+            size_t above = up[k];
+            if (c == y[c0 + k - 2]) up[k] = diag + 1;
+            else if (up[k - 1] > above) up[k] = up[k - 1];
+            diag = above;
+        }
+        left[r] = up[w];
+    }
+    memcpy(top + c0, up + 1, w * sizeof(size_t));
+    return next_corner;
+}
+
+typedef struct {
+    const char *x, *y;
+    size_t m, n, d;
+    size_t *top, *left, *corner;
+} LCSWavefrontJob;
+
+// Blocos bi em [lo, hi) da anti-diagonal job->d
+static void lcs_diagonal_range(void *ctx, size_t lo, size_t hi) {
+    const LCSWavefrontJob *job = ctx;
+    size_t B = LCS_WAVEFRONT_BLOCK;
+    for (size_t bi = lo; bi < hi; bi++) {
+        size_t bj = job->d - bi;
+        size_t r0 = bi * B + 1, r1 = (r0 + B <= job->m + 1) ? r0 + B : job->m + 1;
+        size_t c0 = bj * B + 1, c1 = (c0 + B <= job->n + 1) ? c0 + B : job->n + 1;
+        job->corner[bi] = lcs_block(job->x, job->y, r0, r1, c0, c1, job->top, job->left,
+                                    job->corner[bi]);
+    }
+}
+
+size_t dp_lcs_length_wavefront(const char *x, const char *y, size_t num_threads) {
+    if (x == NULL || y == NULL) return 0;
+
+    size_t m = strlen(x);
+    size_t n = strlen(y);
+
+    if (m == 0 || n == 0) return 0;
+
+    size_t B = LCS_WAVEFRONT_BLOCK;
+    size_t rows = (m + B - 1) / B;
+    size_t cols = (n + B - 1) / B;
+
+    size_t *top = calloc(n + 1, sizeof(size_t));
+    size_t *left = calloc(m + 1, sizeof(size_t));
+    size_t *corner = calloc(rows, sizeof(size_t));
+    if (top == NULL || left == NULL || corner == NULL) {
+        free(top);
+        free(left);
+        free(corner);
+        return 0;
+    }
+
+    // Blocos da mesma anti-diagonal (bi + bj = d) tocam faixas disjuntas
+    // de top, left e corner e podem ser calculados em paralelo
+    LCSWavefrontJob job = { x, y, m, n, 0, top, left, corner };
+    for (size_t d = 0; d < rows + cols - 1; d++) {
+        size_t lo = (d >= cols) ? d - cols + 1 : 0;
+        size_t hi = (d < rows) ? d : rows - 1;
+        job.d = d;
+        ds_parallel_for_threads(num_threads, lo, hi + 1, 1, lcs_diagonal_range, &job);
+    }
+
+    size_t result = top[n];
+    free(top);
+    free(left);
+    free(corner);
+    return result;
+}
+
 LCSResult dp_lcs(const char *x, const char *y) {
     LCSResult result = { 0, NULL };
     if (x == NULL || y == NULL) return result;
@@ -155,6 +268,108 @@ LCSResult dp_lcs(const char *x, const char *y) {
     return result;
 }
 
+// Ultima linha da tabela LCS de x[0..m) contra os prefixos de y:
+// row[j] = LCS(x, y[0..j))
+static void lcs_row_forward(const char *x, size_t m, const char *y, size_t n, size_t *row) {
+    memset(row, 0, (n + 1) * sizeof(size_t));
+    for (size_t i = 0; i < m; i++) {
+        size_t diag = 0;
+        for (size_t j = 1; j <= n; j++) {
+            size_t above = row[j];
+            if (x[i] == y[j - 1]) row[j] = diag + 1;
+            else if (row[j - 1] > above) row[j] = row[j - 1];
+            diag = above;
+        }
+    }
+}
+
+// Mesmo calculo sobre as strings invertidas: row[j] = LCS(x, y[n-j..n))
+static void lcs_row_backward(const char *x, size_t m, const char *y, size_t n, size_t *row) {
+    memset(row, 0, (n + 1) * sizeof(size_t));
+    for (size_t i = m; i-- > 0;) {
+        size_t diag = 0;
+        for (size_t j = 1; j <= n; j++) {
+            size_t above = row[j];
+            if (x[i] == y[n - j]) row[j] = diag + 1;
+            else if (row[j - 1] > above) row[j] = row[j - 1];
+            diag = above;
+        }
+    }
+}
+
+// Divide x ao meio e escolhe o corte k de y que maximiza
+// LCS(x1, y[0..k)) + LCS(x2, y[k..n)); escreve a LCS em out e
+// devolve seu comprimento. fwd e bwd (n + 1 posicoes) sao reutilizados
+// em toda a recursao.
+static size_t hirschberg(const char *x, size_t m, const char *y, size_t n,
+                         size_t *fwd, size_t *bwd, char *out) {
+    if (m == 0 || n == 0) return 0;
+    if (m == 1) {
+        if (memchr(y, x[0], n) == NULL) return 0;
+        out[0] = x[0];
+        return 1;
+    }
+    if (n == 1) {
+        if (memchr(x, y[0], m) == NULL) return 0;
+        out[0] = y[0];
+        return 1;
+    }
+
+    size_t mid = m / 2;
+    lcs_row_forward(x, mid, y, n, fwd);
+    lcs_row_backward(x + mid, m - mid, y, n, bwd);
+
+    size_t k = 0, best = 0;
+    for (size_t j = 0; j <= n; j++) {
+        size_t v = fwd[j] + bwd[n - j];
+        if (v > best) {
+            best = v;
+            k = j;
+        }
+    }
+
+    size_t len = hirschberg(x, mid, y, k, fwd, bwd, out);
+    return len + hirschberg(x + mid, m - mid, y + k, n - k, fwd, bwd, out + len);
+}
+
+LCSResult dp_lcs_hirschberg(const char *x, const char *y) {
+    LCSResult result = { 0, NULL };
+    if (x == NULL || y == NULL) return result;
+
+    size_t m = strlen(x);
+    size_t n = strlen(y);
+
+    if (m == 0 || n == 0) return result;
+
+    // x e dividida, y indexa as linhas: y deve ser a menor
+    if (n > m) {
+        const char *ts = x; x = y; y = ts;
+        size_t tn = m; m = n; n = tn;
+    }
+
+    size_t *fwd = malloc((n + 1) * sizeof(size_t));
+    size_t *bwd = malloc((n + 1) * sizeof(size_t));
+    char *sequence = malloc(n + 1);
+    if (fwd == NULL || bwd == NULL || sequence == NULL) {
+        free(fwd);
+        free(bwd);
+        free(sequence);
+        return result;
+    }
+
+    result.length = hirschberg(x, m, y, n, fwd, bwd, sequence);
+    free(fwd);
+    free(bwd);
+
+    if (result.length == 0) {
+        free(sequence);
+        return result;
+    }
+    sequence[result.length] = '\0';
+    result.sequence = sequence;
+    return result;
+}
+
 void dp_lcs_result_destroy(LCSResult *result) {
     if (result == NULL) return;
     free(result->sequence);
@@ -166,33 +381,128 @@ void dp_lcs_result_destroy(LCSResult *result) {
 // KNAPSACK 0/1 - Cormen S16.2 / Kleinberg S6.4
 // ============================================================================
 
+// Relaxacao de um item sobre a linha dp (uma unica linha, in-place):
+// dp[w] = max(dp[w], dp[w - wt] + v) para w de cap ate wt, em ordem
+// decrescente, de modo que dp[w - wt] ainda e o valor sem o item. Um bloco
+// de lanes le a origem (abaixo) antes de gravar, e os blocos seguintes
+// estao todos abaixo do que ja foi gravado: a vetorizacao e segura para
+// qualquer wt. Se take != NULL, o bit w recebe 1 quando o item melhora dp[w].
+
+static inline void put_bits(uint8_t *bits, size_t b, unsigned mask) {
+    unsigned shift = (unsigned)(b & 7);
+    bits[b >> 3] |= (uint8_t)(mask << shift);
+    if (shift != 0 && (mask >> (8 - shift)) != 0) bits[(b >> 3) + 1] |= (uint8_t)(mask >> (8 - shift));
+}
+
+#if defined(DP_USE_AVX2)
+
+#define AVX2_ATTR __attribute__((target("avx2")))
+
+AVX2_ATTR static size_t relax_avx2(int *dp, size_t w, size_t wt, int v, uint8_t *take) {
+    const __m256i vv = _mm256_set1_epi32(v);
+    while (w >= wt + 8) {
+        size_t base = w - 8;
+        __m256i cur = _mm256_loadu_si256((const __m256i *)(dp + base));
+        __m256i cand = _mm256_add_epi32(_mm256_loadu_si256((const __m256i *)(dp + base - wt)), vv);
+        if (take != NULL) {
+            __m256i gt = _mm256_cmpgt_epi32(cand, cur);
+            unsigned mask = (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(gt));
+            if (mask != 0) put_bits(take, base, mask);
+        }
+        _mm256_storeu_si256((__m256i *)(dp + base), _mm256_max_epi32(cur, cand));
+        w = base;
+    }
+    return w;
+}
+
+static bool avx2_available(void) {
+    static int detected = -1;
+    if (detected < 0) {
+        __builtin_cpu_init();
+        detected = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return detected == 1;
+}
+
+#endif
+
+#if defined(DP_USE_SSE2)
+
+// SSE2 nao tem max de int32: selecao por mascara do cmpgt
+static size_t relax_sse2(int *dp, size_t w, size_t wt, int v, uint8_t *take) {
+    const __m128i vv = _mm_set1_epi32(v);
+    while (w >= wt + 4) {
+        size_t base = w - 4;
+        __m128i cur = _mm_loadu_si128((const __m128i *)(dp + base));
+        __m128i cand = _mm_add_epi32(_mm_loadu_si128((const __m128i *)(dp + base - wt)), vv);
+        __m128i gt = _mm_cmpgt_epi32(cand, cur);
+        if (take != NULL) {
+            unsigned mask = (unsigned)_mm_movemask_ps(_mm_castsi128_ps(gt));
+            if (mask != 0) put_bits(take, base, mask);
+        }
+        __m128i best = _mm_or_si128(_mm_and_si128(gt, cand), _mm_andnot_si128(gt, cur));
+        _mm_storeu_si128((__m128i *)(dp + base), best);
+        w = base;
+    }
+    return w;
+}
+
+#elif defined(DP_USE_NEON)
+
+static size_t relax_neon(int *dp, size_t w, size_t wt, int v, uint8_t *take) {
+    const int32x4_t vv = vdupq_n_s32(v);
+    static const uint32_t lane_bits[4] = {1, 2, 4, 8};
+    const uint32x4_t bits = vld1q_u32(lane_bits);
+    while (w >= wt + 4) {
+        size_t base = w - 4;
+        int32x4_t cur = vld1q_s32(dp + base);
+        int32x4_t cand = vaddq_s32(vld1q_s32(dp + base - wt), vv);
+        if (take != NULL) {
+            unsigned mask = vaddvq_u32(vandq_u32(vcgtq_s32(cand, cur), bits));
+            if (mask != 0) put_bits(take, base, mask);
+        }
+        vst1q_s32(dp + base, vmaxq_s32(cur, cand));
+        w = base;
+    }
+    return w;
+}
+
+#endif
+
+static void knapsack_relax(int *dp, size_t cap, size_t wt, int v, uint8_t *take) {
+    if (wt > cap) return;
+    size_t w = cap + 1;
+#if defined(DP_USE_AVX2)
+    if (avx2_available()) w = relax_avx2(dp, w, wt, v, take);
+#endif
+#if defined(DP_USE_SSE2)
+    w = relax_sse2(dp, w, wt, v, take);
+#elif defined(DP_USE_NEON)
+    w = relax_neon(dp, w, wt, v, take);
+#endif
+    while (w > wt) {
+        w--;
+        int with_item = dp[w - wt] + v;
+        if (with_item > dp[w]) {
+            dp[w] = with_item;
+            if (take != NULL) take[w >> 3] |= (uint8_t)(1u << (w & 7));
+        }
+    }
+}
+
 int dp_knapsack_value(const int *weights, const int *values, size_t n, int capacity) {
     if (weights == NULL || values == NULL || n == 0 || capacity <= 0) return 0;
 
-    int *prev = calloc((size_t)(capacity + 1), sizeof(int));
-    int *curr = calloc((size_t)(capacity + 1), sizeof(int));
-    if (prev == NULL || curr == NULL) {
-        free(prev);
-        free(curr);
-        return 0;
-    }
+    size_t cap = (size_t)capacity;
+    int *dp = calloc(cap + 1, sizeof(int));
+    if (dp == NULL) return 0;
 
     for (size_t i = 0; i < n; i++) {
-        for (int w = 0; w <= capacity; w++) {
-            curr[w] = prev[w];
-            if (weights[i] <= w) {
-                int with_item = values[i] + prev[w - weights[i]];
-                if (with_item > curr[w]) curr[w] = with_item;
-            }
-        }
-        int *tmp = prev;
-        prev = curr;
-        curr = tmp;
+        if (weights[i] >= 0) knapsack_relax(dp, cap, (size_t)weights[i], values[i], NULL);
     }
 
-    int result = prev[capacity];
-    free(prev);
-    free(curr);
+    int result = dp[cap];
+    free(dp);
     return result;
 }
 
@@ -200,43 +510,103 @@ KnapsackResult dp_knapsack(const int *weights, const int *values, size_t n, int
     KnapsackResult result = { 0, NULL, n };
     if (weights == NULL || values == NULL || n == 0 || capacity <= 0) return result;
 
-    int **dp = malloc((n + 1) * sizeof(int *));
-    if (dp == NULL) return result;
+    // Um bit de decisao por celula: 1/32 da tabela de int
+    size_t cap = (size_t)capacity;
+    size_t stride = cap / 8 + 1;
+    if (stride > DP_KNAPSACK_BITSET_LIMIT / n) {
+        return dp_knapsack_linear_space(weights, values, n, capacity);
+    }
 
-    for (size_t i = 0; i <= n; i++) {
-        dp[i] = calloc((size_t)(capacity + 1), sizeof(int));
-        if (dp[i] == NULL) {
-            for (size_t k = 0; k < i; k++) free(dp[k]);
-            free(dp);
-            return result;
-        }
+    int *dp = calloc(cap + 1, sizeof(int));
+    uint8_t *take = calloc(n * stride, 1);
+    if (dp == NULL || take == NULL) {
+        free(dp);
+        free(take);
+        return dp_knapsack_linear_space(weights, values, n, capacity);
     }
 
-    for (size_t i = 1; i <= n; i++) {
-        for (int w = 0; w <= capacity; w++) {
-            dp[i][w] = dp[i - 1][w];
-            if (weights[i - 1] <= w) {
-                int with_item = values[i - 1] + dp[i - 1][w - weights[i - 1]];
-                if (with_item > dp[i][w]) dp[i][w] = with_item;
-            }
-        }
+    for (size_t i = 0; i < n; i++) {
+        if (weights[i] >= 0) knapsack_relax(dp, cap, (size_t)weights[i], values[i], take + i * stride);
     }
 
-    result.max_value = dp[n][capacity];
+    result.max_value = dp[cap];
 
     result.selected = calloc(n, sizeof(bool));
     if (result.selected != NULL) {
-        int w = capacity;
+        size_t w = cap;
         for (size_t i = n; i > 0; i--) {
-            if (dp[i][w] != dp[i - 1][w]) {
+            const uint8_t *row = take + (i - 1) * stride;
+            if (row[w >> 3] & (1u << (w & 7))) {
                 result.selected[i - 1] = true;
-                w -= weights[i - 1];
+                w -= (size_t)weights[i - 1];
             }
         }
     }
 
-    for (size_t i = 0; i <= n; i++) free(dp[i]);
     free(dp);
+    free(take);
+    return result;
+}
+
+// Linha de valores dos itens [lo, hi) para capacidades 0..cap
+static void knapsack_row(const int *weights, const int *values, size_t lo, size_t hi,
+                         size_t cap, int *row) {
+    memset(row, 0, (cap + 1) * sizeof(int));
+    for (size_t i = lo; i < hi; i++) {
+        if (weights[i] >= 0) knapsack_relax(row, cap, (size_t)weights[i], values[i], NULL);
+    }
+}
+
+// Divide os itens ao meio e a capacidade no ponto c que maximiza
+// f[c] + g[cap - c]; f e g (cap + 1 posicoes) sao reutilizados na recursao
+static void knapsack_split(const int *weights, const int *values, size_t lo, size_t hi,
+                           size_t cap, int *f, int *g, bool *selected) {
+    if (hi - lo == 1) {
+        if (weights[lo] >= 0 && (size_t)weights[lo] <= cap && values[lo] > 0) selected[lo] = true;
+        return;
+    }
+
+    size_t mid = lo + (hi - lo) / 2;
+    knapsack_row(weights, values, lo, mid, cap, f);
+    knapsack_row(weights, values, mid, hi, cap, g);
+
+    size_t c = 0;
+    int best = f[0] + g[cap];
+    for (size_t k = 1; k <= cap; k++) {
+        int v = f[k] + g[cap - k];
+        if (v > best) {
+            best = v;
+            c = k;
+        }
+    }
+
+    knapsack_split(weights, values, lo, mid, c, f, g, selected);
+    knapsack_split(weights, values, mid, hi, cap - c, f, g, selected);
+}
+
+KnapsackResult dp_knapsack_linear_space(const int *weights, const int *values, size_t n, int capacity) {
+    KnapsackResult result = { 0, NULL, n };
+    if (weights == NULL || values == NULL || n == 0 || capacity <= 0) return result;
+
+    size_t cap = (size_t)capacity;
+    int *f = malloc((cap + 1) * sizeof(int));
+    int *g = malloc((cap + 1) * sizeof(int));
+    bool *selected = calloc(n, sizeof(bool));
+    if (f == NULL || g == NULL || selected == NULL) {
+        free(f);
+        free(g);
+        free(selected);
+        return result;
+    }
+
+    knapsack_split(weights, values, 0, n, cap, f, g, selected);
+    free(f);
+    free(g);
+
+    for (size_t i = 0; i < n; i++) {
+        if (selected[i]) result.max_value += values[i];
+    }
+    result.selected = selected;
     return result;
 }
 
@@ -254,6 +624,12 @@ void dp_knapsack_result_destroy(KnapsackResult *result) {
 size_t dp_edit_distance(const char *s1, const char *s2) {
     if (s1 == NULL || s2 == NULL) return 0;
 
+    // Linhas sobre a string menor: O(min(m, n)) espaco
+    if (strlen(s1) < strlen(s2)) {
+        const char *tmp = s1;
+        s1 = s2;
+        s2 = tmp;
+    }
     size_t m = strlen(s1);
     size_t n = strlen(s2);
 
@@ -295,6 +671,144 @@ size_t dp_edit_distance(const char *s1, const char *s2) {
     return result;
 }
 
+// Um bloco de 64 linhas de uma coluna (Hyyro 2003). hin/retorno: diferenca
+// horizontal (-1, 0, +1) na linha acima do bloco / na linha high do bloco.
+static inline int myers_block(uint64_t *pv, uint64_t *mv, uint64_t eq, int hin, uint64_t high) {
+    uint64_t hin_neg = (hin < 0) ? 1u : 0u;
+    uint64_t hin_pos = (hin > 0) ? 1u : 0u;
+    uint64_t xv = eq | *mv;
+    eq |= hin_neg;
+    uint64_t xh = (((eq & *pv) + *pv) ^ *pv) | eq;
+    uint64_t ph = *mv | ~(xh | *pv);
+    uint64_t mh = *pv & xh;
+    int hout = ((ph & high) != 0) - ((mh & high) != 0);
+    ph = (ph << 1) | hin_pos;
+    mh = (mh << 1) | hin_neg;
+    *pv = mh | ~(xv | ph);
+    *mv = ph & xv;
+    return hout;
+}
+
+size_t dp_edit_distance_myers(const char *s1, size_t m, const char *s2, size_t n) {
+    if ((s1 == NULL && m > 0) || (s2 == NULL && n > 0)) return DP_EDIT_DISTANCE_ERROR;
+
+    // Padrao (vertical) = sequencia menor
+    if (m > n) {
+        const char *tmp = s1;
+        s1 = s2;
+        s2 = tmp;
+        size_t t = m;
+        m = n;
+        n = t;
+    }
+    if (m == 0) return n;
+
+    const unsigned char *p = (const unsigned char *)s1;
+    const unsigned char *t = (const unsigned char *)s2;
+    size_t blocks = (m + 63) / 64;
+    uint64_t last_high = (uint64_t)1 << ((m - 1) % 64);
+
+    if (blocks == 1) {
+        uint64_t peq[256] = {0};
+        for (size_t i = 0; i < m; i++) peq[p[i]] |= (uint64_t)1 << i;
+        uint64_t pv = ~(uint64_t)0, mv = 0;
+        size_t score = m;
+        for (size_t j = 0; j < n; j++) {
+            score += (size_t)(ptrdiff_t)myers_block(&pv, &mv, peq[t[j]], 1, last_high);
+        }
+        return score;
+    }
+
+    // peq[c * blocks + b]: bits das posicoes de c no bloco b; depois pv e mv
+    uint64_t *peq = calloc(256 * blocks + 2 * blocks, sizeof(uint64_t));
+    if (peq == NULL) return DP_EDIT_DISTANCE_ERROR;
+    uint64_t *pv = peq + 256 * blocks;
+    uint64_t *mv = pv + blocks;
+    for (size_t i = 0; i < m; i++) peq[p[i] * blocks + i / 64] |= (uint64_t)1 << (i % 64);
+    for (size_t b = 0; b < blocks; b++) pv[b] = ~(uint64_t)0;
+
+    const uint64_t high = (uint64_t)1 << 63;
+    size_t score = m;
+    for (size_t j = 0; j < n; j++) {
+        const uint64_t *eq = peq + t[j] * blocks;
+        int carry = 1;      // distancia global: D[0][j] = j
+        for (size_t b = 0; b + 1 < blocks; b++) {
+            carry = myers_block(&pv[b], &mv[b], eq[b], carry, high);
+        }
+        carry = myers_block(&pv[blocks - 1], &mv[blocks - 1], eq[blocks - 1], carry, last_high);
+        score += (size_t)(ptrdiff_t)carry;
+    }
+    free(peq);
+    return score;
+}
+
+size_t dp_edit_distance_bounded(const char *s1, size_t m, const char *s2, size_t n, size_t k) {
+    if ((s1 == NULL && m > 0) || (s2 == NULL && n > 0)) return DP_EDIT_DISTANCE_ERROR;
+    if (k >= DP_EDIT_DISTANCE_ERROR - 1) k = DP_EDIT_DISTANCE_ERROR - 2;
+
+    // Colunas = sequencia menor
+    if (m < n) {
+        const char *tmp = s1;
+        s1 = s2;
+        s2 = tmp;
+        size_t t = m;
+        m = n;
+        n = t;
+    }
+    if (m - n > k) return k + 1;
+    if (n == 0) return m;
+
+    const size_t inf = k + 1;
+    size_t *prev = malloc((n + 1) * sizeof(size_t));
+    size_t *curr = malloc((n + 1) * sizeof(size_t));
+    if (prev == NULL || curr == NULL) {
+        free(prev);
+        free(curr);
+        return DP_EDIT_DISTANCE_ERROR;
+    }
+
+    size_t hi = (k < n) ? k : n;
+    for (size_t j = 0; j <= hi; j++) prev[j] = j;
+    if (hi < n) prev[hi + 1] = inf;
+
+    for (size_t i = 1; i <= m; i++) {
+        // Faixa da linha i: j em [i - k, i + k]
+        size_t lo = (i > k) ? i - k : 0;
+        hi = (i + k < n) ? i + k : n;
+        size_t row_min = inf;
+        if (lo == 0) {
+            curr[0] = (i < inf) ? i : inf;
+            row_min = curr[0];
+            lo = 1;
+        } else {
+            curr[lo - 1] = inf;
+        }
+        for (size_t j = lo; j <= hi; j++) {
+            size_t v = prev[j - 1] + (s1[i - 1] != s2[j - 1]);
+            if (prev[j] + 1 < v) v = prev[j] + 1;
+            if (curr[j - 1] + 1 < v) v = curr[j - 1] + 1;
+            if (v > inf) v = inf;
+            curr[j] = v;
+            if (v < row_min) row_min = v;
+        }
+        if (hi < n) curr[hi + 1] = inf;
+
+        size_t *tmp = prev;
+        prev = curr;
+        curr = tmp;
+        if (row_min > k) {
+            free(prev);
+            free(curr);
+            return inf;
+        }
+    }
+
+    size_t result = prev[n];
+    free(prev);
+    free(curr);
+    return (result < inf) ? result : inf;
+}
+
 // ============================================================================
 // LIS - Cormen Problem 15-4
 // ============================================================================
@@ -329,55 +843,112 @@ size_t dp_lis_length(const int *arr, size_t n) {
     return len;
 }
 
-LISResult dp_lis(const int *arr, size_t n) {
+#define LIS_NONE ((size_t)-1)
+
+// Patience sorting com indices: tails[k] e o indice do menor final de uma
+// subsequencia de comprimento k + 1 e parent[i] o elemento anterior a i
+// nessa subsequencia. Devolve o comprimento; a LIS termina em tails[len-1].
+static size_t lis_int_run(const int *arr, size_t n, bool strict, size_t *tails, size_t *parent) {
+    size_t len = 0;
+    for (size_t i = 0; i < n; i++) {
+        int x = arr[i];
+        size_t lo = 0, hi = len;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            int t = arr[tails[mid]];
+            if (t < x || (!strict && t == x)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        parent[i] = (lo > 0) ? tails[lo - 1] : LIS_NONE;
+        tails[lo] = i;
+        if (lo == len) len++;
+    }
+    return len;
+}
+
+static LISResult lis_int(const int *arr, size_t n, bool strict) {
     LISResult result = { 0, NULL, 0 };
     if (arr == NULL || n == 0) return result;
 
-    size_t *dp = malloc(n * sizeof(size_t));
+    size_t *tails = malloc(n * sizeof(size_t));
     size_t *parent = malloc(n * sizeof(size_t));
-    if (dp == NULL || parent == NULL) {
-        free(dp);
+    if (tails == NULL || parent == NULL) {
+        free(tails);
         free(parent);
         return result;
     }
 
-    for (size_t i = 0; i < n; i++) {
-        dp[i] = 1;
-        parent[i] = (size_t)-1;
+    size_t len = lis_int_run(arr, n, strict, tails, parent);
+
+    result.length = len;
+    result.seq_len = len;
+    result.sequence = malloc(len * sizeof(int));
+    if (result.sequence != NULL) {
+        size_t k = tails[len - 1];
+        for (size_t idx = len; idx > 0; idx--) {
+            result.sequence[idx - 1] = arr[k];
+            k = parent[k];
+        }
     }
 
-    size_t max_len = 1;
-    size_t max_idx = 0;
+    free(tails);
+    free(parent);
+    return result;
+}
+
+LISResult dp_lis(const int *arr, size_t n) {
+    return lis_int(arr, n, true);
+}
+
+LISResult dp_lis_non_decreasing(const int *arr, size_t n) {
+    return lis_int(arr, n, false);
+}
+
+size_t dp_lis_generic(const void *base, size_t n, size_t elem_size, CompareFn cmp,
+                      bool strict, size_t *indices) {
+    if (base == NULL || cmp == NULL || elem_size == 0 || n == 0) return 0;
 
-    for (size_t i = 1; i < n; i++) {
-        for (size_t j = 0; j < i; j++) {
-            if (arr[j] < arr[i] && dp[j] + 1 > dp[i]) {
-                dp[i] = dp[j] + 1;
-                parent[i] = j;
+    const char *a = base;
+    size_t *tails = malloc(n * sizeof(size_t));
+    size_t *parent = (indices != NULL) ? malloc(n * sizeof(size_t)) : NULL;
+    if (tails == NULL || (indices != NULL && parent == NULL)) {
+        free(tails);
+        free(parent);
+        return 0;
+    }
+
+    size_t len = 0;
+    for (size_t i = 0; i < n; i++) {
+        const void *x = a + i * elem_size;
+        size_t lo = 0, hi = len;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            int c = cmp(a + tails[mid] * elem_size, x);
+            if (c < 0 || (!strict && c == 0)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
             }
         }
-        if (dp[i] > max_len) {
-            max_len = dp[i];
-            max_idx = i;
-        }
+        if (parent != NULL) parent[i] = (lo > 0) ? tails[lo - 1] : LIS_NONE;
+        tails[lo] = i;
+        if (lo == len) len++;
     }
 
-    result.length = max_len;
-    result.seq_len = max_len;
-    result.sequence = malloc(max_len * sizeof(int));
-    if (result.sequence != NULL) {
-        size_t idx = max_len;
-        size_t k = max_idx;
-        while (k != (size_t)-1 && idx > 0) {
-            idx--;
-            result.sequence[idx] = arr[k];
+    if (indices != NULL) {
+        size_t k = tails[len - 1];
+        for (size_t idx = len; idx > 0; idx--) {
+            indices[idx - 1] = k;
             k = parent[k];
         }
     }
 
-    free(dp);
+    free(tails);
     free(parent);
-    return result;
+    return len;
 }
 
 void dp_lis_result_destroy(LISResult *result) {
@@ -0,0 +1,402 @@
+/**
+ * @file external_sort.c
+ * @brief Ordenacao externa: runs ordenados em memoria + merge k-way com loser tree
+ *
+ * Referencias:
+ * - Knuth (1998), TAOCP Vol 3, S5.4.1 (arvore de perdedores)
+ * - Graefe, G. (2006). "Implementing Sorting in Database Systems"
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "algorithms/external_sort.h"
+#include "algorithms/sorting.h"
+#include "data_structures/thread_pool.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define EXTSORT_DEFAULT_MEMORY   ((size_t)256 << 20)
+#define EXTSORT_DEFAULT_IO_BUF   ((size_t)1 << 20)
+#define EXTSORT_DEFAULT_FAN_IN   128
+
+ExternalSortConfig external_sort_default_config(void) {
+    ExternalSortConfig config = {
+        .memory_bytes = EXTSORT_DEFAULT_MEMORY,
+        .io_buffer_bytes = EXTSORT_DEFAULT_IO_BUF,
+        .max_fan_in = EXTSORT_DEFAULT_FAN_IN,
+        .num_threads = 0,
+        .read_ahead = true,
+        .temp_dir = NULL
+    };
+    return config;
+}
+
+// ============================================================================
+// ARQUIVOS DE RUN
+// ============================================================================
+
+typedef struct {
+    char **paths;
+    size_t count;
+    size_t capacity;
+} RunList;
+
+typedef struct {
+    const char *prefix;         // temp_dir/extsort ou output_path
+    unsigned long tag;          // distingue ordenacoes simultaneas
+    size_t next_id;
+} RunNamer;
+
+static char *run_name_next(RunNamer *namer) {
+    size_t len = strlen(namer->prefix) + 64;
+    char *path = malloc(len);
+    if (path == NULL) return NULL;
+    snprintf(path, len, "%s.%lx.%zu.run", namer->prefix, namer->tag, namer->next_id++);
+    return path;
+}
+
+static bool run_list_push(RunList *list, char *path) {
+    if (list->count == list->capacity) {
+        size_t cap = list->capacity ? list->capacity * 2 : 16;
+        char **grown = realloc(list->paths, cap * sizeof(char *));
+        if (grown == NULL) return false;
+        list->paths = grown;
+        list->capacity = cap;
+    }
+    list->paths[list->count++] = path;
+    return true;
+}
+
+// Remove os arquivos e libera os nomes
+static void run_list_clear(RunList *list) {
+    for (size_t i = 0; i < list->count; i++) {
+        remove(list->paths[i]);
+        free(list->paths[i]);
+    }
+    list->count = 0;
+}
+
+static void run_list_destroy(RunList *list) {
+    run_list_clear(list);
+    free(list->paths);
+    list->paths = NULL;
+    list->capacity = 0;
+}
+
+// Le ate max_records; registro parcial ou erro de leitura marcam *error
+static size_t read_records(FILE *file, unsigned char *buf, size_t max_records,
+                           size_t record_size, bool *error) {
+    size_t bytes = fread(buf, 1, max_records * record_size, file);
+    if (ferror(file) || bytes % record_size != 0) *error = true;
+    return bytes / record_size;
+}
+
+static bool write_file(const char *path, const unsigned char *buf, size_t bytes) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) return false;
+    bool ok = fwrite(buf, 1, bytes, file) == bytes;
+    if (fclose(file) != 0) ok = false;
+    return ok;
+}
+
+// ============================================================================
+// LOSER TREE
+// ============================================================================
+
+typedef struct {
+    FILE *file;
+    unsigned char *buf;
+    size_t count;               // registros validos em buf
+    size_t pos;
+    bool done;
+} RunReader;
+
+typedef struct {
+    RunReader *readers;
+    size_t k;
+    size_t *tree;               // tree[1..k-1]: perdedor de cada no interno
+    size_t record_size;
+    CompareFn cmp;
+} LoserTree;
+
+static bool reader_fill(RunReader *r, size_t capacity, size_t record_size) {
+    bool error = false;
+    r->count = read_records(r->file, r->buf, capacity, record_size, &error);
+    r->pos = 0;
+    r->done = (r->count == 0);
+    return !error;
+}
+
+// a vence b: menor registro; runs esgotados perdem; empate pelo indice do run
+static inline bool lt_beats(const LoserTree *t, size_t a, size_t b) {
+    const RunReader *ra = &t->readers[a];
+    const RunReader *rb = &t->readers[b];
+    if (ra->done) return false;
+    if (rb->done) return true;
+    int c = t->cmp(ra->buf + ra->pos * t->record_size, rb->buf + rb->pos * t->record_size);
+    return c < 0 || (c == 0 && a < b);
+}
+
+// Folhas implicitas em k..2k-1; devolve o vencedor da subarvore de node
+static size_t lt_build(LoserTree *t, size_t node) {
+    if (node >= t->k) return node - t->k;
+    size_t a = lt_build(t, 2 * node);
+    size_t b = lt_build(t, 2 * node + 1);
+    if (lt_beats(t, a, b)) {
+        t->tree[node] = b;
+        return a;
+    }
+    t->tree[node] = a;
+    return b;
+}
+
+// Reconta o caminho da folha w ate a raiz apos w avancar
+static size_t lt_replay(LoserTree *t, size_t w) {
+    for (size_t node = (w + t->k) / 2; node >= 1; node /= 2) {
+        if (lt_beats(t, t->tree[node], w)) {
+            size_t tmp = t->tree[node];
+            t->tree[node] = w;
+            w = tmp;
+        }
+    }
+    return w;
+}
+
+// ============================================================================
+// MERGE K-WAY
+// ============================================================================
+
+static bool merge_runs(char *const *paths, size_t k, const char *out_path,
+                       size_t record_size, CompareFn cmp, size_t buf_records) {
+    RunReader *readers = calloc(k, sizeof(RunReader));
+    size_t *tree = malloc(k * sizeof(size_t));
+    unsigned char *out_buf = malloc(buf_records * record_size);
+    FILE *out = NULL;
+    bool ok = readers != NULL && tree != NULL && out_buf != NULL;
+
+    for (size_t i = 0; ok && i < k; i++) {
+        readers[i].file = fopen(paths[i], "rb");
+        readers[i].buf = malloc(buf_records * record_size);
+        ok = readers[i].file != NULL && readers[i].buf != NULL &&
+             reader_fill(&readers[i], buf_records, record_size);
+    }
+    if (ok) {
+        out = fopen(out_path, "wb");
+        ok = out != NULL;
+    }
+
+    if (ok) {
+        LoserTree t = {readers, k, tree, record_size, cmp};
+        size_t winner = lt_build(&t, 1);
+        size_t out_count = 0;
+
+        while (ok && !readers[winner].done) {
+            RunReader *r = &readers[winner];
+            memcpy(out_buf + out_count * record_size, r->buf + r->pos * record_size, record_size);
+            if (++out_count == buf_records) {
+                ok = fwrite(out_buf, record_size, out_count, out) == out_count;
+                out_count = 0;
+            }
+            if (++r->pos == r->count) {
+                if (!reader_fill(r, buf_records, record_size)) ok = false;
+            }
+            winner = lt_replay(&t, winner);
+        }
+        if (ok && out_count > 0) {
+            ok = fwrite(out_buf, record_size, out_count, out) == out_count;
+        }
+    }
+
+    if (out != NULL && fclose(out) != 0) ok = false;
+    if (readers != NULL) {
+        for (size_t i = 0; i < k; i++) {
+            if (readers[i].file != NULL) fclose(readers[i].file);
+            free(readers[i].buf);
+        }
+    }
+    free(readers);
+    free(tree);
+    free(out_buf);
+    return ok;
+}
+
+// ============================================================================
+// GERACAO DE RUNS
+// ============================================================================
+
+typedef struct {
+    const char *path;
+    const unsigned char *data;
+    size_t bytes;
+    bool ok;
+} RunWriteTask;
+
+typedef struct {
+    FILE *in;
+    unsigned char *buf;
+    size_t capacity, record_size, count;
+    bool *error;
+} BlockReadTask;
+
+static void run_write_task(void *arg) {
+    RunWriteTask *t = arg;
+    t->ok = write_file(t->path, t->data, t->bytes);
+}
+
+static void block_read_task(void *arg) {
+    BlockReadTask *t = arg;
+    t->count = read_records(t->in, t->buf, t->capacity, t->record_size, t->error);
+}
+
+// Grava o run atual enquanto (com read_ahead) le o proximo bloco em *next
+static void write_and_read_next(const char *path, const unsigned char *cur, size_t n,
+                                FILE *in, unsigned char *next, size_t capacity,
+                                size_t record_size, bool read_next, bool overlap,
+                                bool *write_ok, size_t *next_n, bool *read_error) {
+    if (!overlap || !read_next) {
+        *write_ok = write_file(path, cur, n * record_size);
+        if (read_next) *next_n = read_records(in, next, capacity, record_size, read_error);
+        return;
+    }
+
+    RunWriteTask w = { path, cur, n * record_size, false };
+    BlockReadTask r = { in, next, capacity, record_size, 0, read_error };
+    ds_parallel_invoke(block_read_task, &r, run_write_task, &w);
+    *write_ok = w.ok;
+    *next_n = r.count;
+}
+
+// Gera os runs iniciais; se a entrada cabe num bloco, grava direto em output_path
+static bool generate_runs(FILE *in, const char *output_path, size_t record_size,
+                          CompareFn cmp, const ExternalSortConfig *cfg,
+                          RunNamer *namer, RunList *runs, ExternalSortStats *stats) {
+    size_t slots = cfg->read_ahead ? 2 : 1;
+    size_t capacity = cfg->memory_bytes / slots / record_size;
+    if (capacity == 0) capacity = 1;
+
+    unsigned char *bufs[2] = {NULL, NULL};
+    bool ok = true;
+    for (size_t s = 0; s < slots && ok; s++) {
+        bufs[s] = malloc(capacity * record_size);
+        ok = bufs[s] != NULL;
+    }
+
+    bool read_error = false;
+    size_t cur = 0;
+    size_t n = ok ? read_records(in, bufs[0], capacity, record_size, &read_error) : 0;
+    ok = ok && !read_error;
+
+    if (ok && n < capacity) {
+        // Cabe em memoria: sem runs temporarios
+        parallel_sample_sort(bufs[0], n, record_size, cmp, cfg->num_threads);
+        ok = write_file(output_path, bufs[0], n * record_size);
+        stats->records = n;
+        stats->runs = (n > 0) ? 1 : 0;
+        n = 0;
+    }
+
+    while (ok && n > 0) {
+        parallel_sample_sort(bufs[cur], n, record_size, cmp, cfg->num_threads);
+        stats->records += n;
+
+        char *path = run_name_next(namer);
+        if (path == NULL || !run_list_push(runs, path)) {
+            free(path);
+            ok = false;
+            break;
+        }
+
+        size_t nxt = cfg->read_ahead ? 1 - cur : cur;
+        bool read_next = (n == capacity);
+        bool write_ok = false;
+        size_t next_n = 0;
+        write_and_read_next(path, bufs[cur], n, in, bufs[nxt], capacity, record_size,
+                            read_next, cfg->read_ahead, &write_ok, &next_n, &read_error);
+        ok = write_ok && !read_error;
+        n = next_n;
+        cur = nxt;
+    }
+    stats->runs = (runs->count > 0) ? runs->count : stats->runs;
+
+    free(bufs[0]);
+    free(bufs[1]);
+    return ok;
+}
+
+// ============================================================================
+// API
+// ============================================================================
+
+bool external_sort(const char *input_path, const char *output_path,
+                   size_t record_size, CompareFn cmp,
+                   const ExternalSortConfig *config, ExternalSortStats *stats) {
+    if (input_path == NULL || output_path == NULL || record_size == 0 || cmp == NULL) {
+        return false;
+    }
+    if (strcmp(input_path, output_path) == 0) return false;
+
+    ExternalSortConfig cfg = config ? *config : external_sort_default_config();
+    if (cfg.max_fan_in < 2) cfg.max_fan_in = 2;
+    size_t buf_records = cfg.io_buffer_bytes / record_size;
+    if (buf_records == 0) buf_records = 1;
+
+    ExternalSortStats local = {0, 0, 0};
+    FILE *in = fopen(input_path, "rb");
+    if (in == NULL) return false;
+
+    // Prefixo dos runs: temp_dir/extsort ou o proprio arquivo de saida
+    char *prefix = NULL;
+    if (cfg.temp_dir != NULL) {
+        size_t len = strlen(cfg.temp_dir) + sizeof("/extsort");
+        prefix = malloc(len);
+        if (prefix == NULL) {
+            fclose(in);
+            return false;
+        }
+        snprintf(prefix, len, "%s/extsort", cfg.temp_dir);
+    }
+    RunNamer namer = {
+        prefix ? prefix : output_path,
+        (unsigned long)((uintptr_t)&local ^ (uintptr_t)time(NULL)),
+        0
+    };
+    RunList runs = {NULL, 0, 0};
+
+    bool ok = generate_runs(in, output_path, record_size, cmp, &cfg, &namer, &runs, &local);
+    fclose(in);
+
+    // Passes intermediarios ate restarem max_fan_in runs
+    while (ok && runs.count > cfg.max_fan_in) {
+        RunList next = {NULL, 0, 0};
+        for (size_t first = 0; ok && first < runs.count; first += cfg.max_fan_in) {
+            size_t k = runs.count - first;
+            if (k > cfg.max_fan_in) k = cfg.max_fan_in;
+            char *path = run_name_next(&namer);
+            if (path == NULL || !run_list_push(&next, path)) {
+                free(path);
+                ok = false;
+                break;
+            }
+            ok = merge_runs(runs.paths + first, k, path, record_size, cmp, buf_records);
+        }
+        run_list_destroy(&runs);
+        runs = next;
+        local.merge_passes++;
+    }
+
+    if (ok && runs.count > 0) {
+        ok = merge_runs(runs.paths, runs.count, output_path, record_size, cmp, buf_records);
+        local.merge_passes++;
+    }
+
+    run_list_destroy(&runs);
+    free(prefix);
+    if (!ok) remove(output_path);
+    if (stats) *stats = local;
+    return ok;
+}
@@ -1,7 +1,8 @@
 /**
  * @file graph_algorithms.c
  * @brief Implementacao de algoritmos de grafos: Dijkstra, Bellman-Ford,
- *        Floyd-Warshall, Kruskal, Prim
+ *        Floyd-Warshall, delta-stepping, Kruskal, Filter-Kruskal, Boruvka,
+ *        Prim, BFS com troca de direcao, construcao de CSR em lote e PageRank
  *
  * Referencias:
  * - Cormen et al. (2009), Chapters 23-25
@@ -12,11 +13,31 @@
  */
 
 #include "algorithms/graph_algorithms.h"
+#include "algorithms/sorting.h"
+#include "data_structures/large_alloc.h"
+#include "data_structures/pdqsort.h"
+#include "data_structures/queue.h"
+#include "data_structures/thread_pool.h"
 #include "data_structures/union_find.h"
 
+#include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
+// Floyd-Warshall em blocos: clone AVX2 do kernel min-plus, escolhido por
+// __builtin_cpu_supports. Defina GRAPH_NO_SIMD para usar so o kernel base.
+#if !defined(GRAPH_NO_SIMD) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define GRAPH_USE_AVX2 1
+#endif
+
+/** Abaixo disso as arestas do Kruskal sao ordenadas com qsort */
+#define MST_RADIX_MIN_EDGES 1024
+
+/** Particoes do Filter-Kruskal ate este tamanho sao ordenadas direto */
+#define FILTER_KRUSKAL_BASE_EDGES 4096
+
 // ============================================================================
 // HELPERS
 // ============================================================================
@@ -39,12 +60,28 @@ void all_pairs_free(AllPairsResult *result) {
     free(result);
 }
 
+void all_pairs_matrix_free(AllPairsMatrix *result) {
+    if (result == NULL) return;
+    size_t cells = result->stride * result->stride;
+    ds_large_free(result->dist, cells, sizeof(double));
+    ds_large_free(result->dist_f, cells, sizeof(float));
+    ds_large_free(result->next, cells, sizeof(uint32_t));
+    free(result);
+}
+
 void mst_free(MSTResult *result) {
     if (result == NULL) return;
     free(result->edges);
     free(result);
 }
 
+void bfs_free(BFSResult *result) {
+    if (result == NULL) return;
+    free(result->dist);
+    free(result->parent);
+    free(result);
+}
+
 static ShortestPathResult* create_sp_result(size_t n) {
     ShortestPathResult *r = (ShortestPathResult *)malloc(sizeof(ShortestPathResult));
     if (r == NULL) return NULL;
@@ -64,13 +101,95 @@ static ShortestPathResult* create_sp_result(size_t n) {
 }
 
 // ============================================================================
-// DIJKSTRA - Cormen S24.3 (min-heap via array simples)
+// DIJKSTRA - Cormen S24.3
 // ============================================================================
 
-ShortestPathResult* dijkstra(const Graph *graph, Vertex source) {
-    if (graph == NULL) return NULL;
+#define HEAP_NOT_IN ((size_t)-1)
+
+/**
+ * Heap binario minimo indexado por vertice: heap[] guarda vertices,
+ * pos[v] guarda o indice de v em heap[] (HEAP_NOT_IN se ausente) e a
+ * chave de cada vertice e lida diretamente de dist[]. Isso permite
+ * DECREASE-KEY em O(log V) sem buscar o elemento no array.
+ */
+typedef struct {
+    Vertex *heap;
+    size_t *pos;
+    size_t size;
+    const double *key;
+} IndexedMinHeap;
+
+static void imh_swap(IndexedMinHeap *h, size_t i, size_t j) {
+    Vertex tmp = h->heap[i];
+    h->heap[i] = h->heap[j];
+    h->heap[j] = tmp;
+    h->pos[h->heap[i]] = i;
+    h->pos[h->heap[j]] = j;
+}
+
+static void imh_up(IndexedMinHeap *h, size_t i) {
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (h->key[h->heap[i]] >= h->key[h->heap[parent]]) break;
+        imh_swap(h, i, parent);
+        i = parent;
+    }
+}
+
+static void imh_down(IndexedMinHeap *h, size_t i) {
+    while (1) {
+        size_t left = 2 * i + 1;
+        size_t right = left + 1;
+        size_t smallest = i;
+        if (left < h->size && h->key[h->heap[left]] < h->key[h->heap[smallest]])
+            smallest = left;
+        if (right < h->size && h->key[h->heap[right]] < h->key[h->heap[smallest]])
+            smallest = right;
+        if (smallest == i) break;
+        imh_swap(h, i, smallest);
+        i = smallest;
+    }
+}
+
+/** Insere v ou, se ja presente, aplica DECREASE-KEY (key[v] ja atualizado). */
+static void imh_push_or_decrease(IndexedMinHeap *h, Vertex v) {
+    if (h->pos[v] == HEAP_NOT_IN) {
+        h->heap[h->size] = v;
+        h->pos[v] = h->size;
+        h->size++;
+    }
+    imh_up(h, h->pos[v]);
+}
+
+static Vertex imh_pop(IndexedMinHeap *h) {
+    Vertex top = h->heap[0];
+    h->size--;
+    h->pos[top] = HEAP_NOT_IN;
+    if (h->size > 0) {
+        h->heap[0] = h->heap[h->size];
+        h->pos[h->heap[0]] = 0;
+        imh_down(h, 0);
+    }
+    return top;
+}
+
+static void dijkstra_relax_neighbors(const Graph *graph, ShortestPathResult *r,
+                                     Vertex u, IndexedMinHeap *h) {
+    GraphNeighborIter it;
+    Vertex v;
+    double w;
+    graph_neighbor_iter_begin(graph, u, &it);
+    while (graph_neighbor_iter_next(&it, &v, &w)) {
+        if (r->dist[u] + w < r->dist[v]) {
+            r->dist[v] = r->dist[u] + w;
+            r->parent[v] = u;
+            if (h != NULL) imh_push_or_decrease(h, v);
+        }
+    }
+}
+
+static ShortestPathResult* dijkstra_dense(const Graph *graph, Vertex source) {
     size_t n = graph_num_vertices(graph);
-    if (source >= n) return NULL;
 
     ShortestPathResult *r = create_sp_result(n);
     if (r == NULL) return NULL;
@@ -92,25 +211,72 @@ ShortestPathResult* dijkstra(const Graph *graph, Vertex source) {
         if (u == (size_t)-1) break;
         visited[u] = true;
 
-        Vertex *neighbors = NULL;
-        size_t count = 0;
-        graph_neighbors(graph, u, &neighbors, &count);
-
-        for (size_t i = 0; i < count; i++) {
-            Vertex v = neighbors[i];
-            double w = graph_edge_weight(graph, u, v);
-            if (r->dist[u] + w < r->dist[v]) {
-                r->dist[v] = r->dist[u] + w;
-                r->parent[v] = u;
-            }
-        }
-        free(neighbors);
+        dijkstra_relax_neighbors(graph, r, u, NULL);
     }
 
     free(visited);
     return r;
 }
 
+static ShortestPathResult* dijkstra_binary_heap(const Graph *graph, Vertex source) {
+    size_t n = graph_num_vertices(graph);
+
+    ShortestPathResult *r = create_sp_result(n);
+    if (r == NULL) return NULL;
+
+    IndexedMinHeap h;
+    h.heap = (Vertex *)malloc(n * sizeof(Vertex));
+    h.pos = (size_t *)malloc(n * sizeof(size_t));
+    h.size = 0;
+    h.key = r->dist;
+    if (h.heap == NULL || h.pos == NULL) {
+        free(h.heap); free(h.pos);
+        shortest_path_free(r);
+        return NULL;
+    }
+    for (size_t i = 0; i < n; i++) h.pos[i] = HEAP_NOT_IN;
+
+    r->dist[source] = 0.0;
+    imh_push_or_decrease(&h, source);
+
+    while (h.size > 0) {
+        Vertex u = imh_pop(&h);
+        dijkstra_relax_neighbors(graph, r, u, &h);
+    }
+
+    free(h.heap);
+    free(h.pos);
+    return r;
+}
+
+/**
+ * Heap compensa quando o custo E log V das operacoes de heap fica
+ * abaixo das V^2 comparacoes da varredura linear.
+ */
+static bool dijkstra_prefers_heap(const Graph *graph) {
+    size_t n = graph_num_vertices(graph);
+    size_t e = graph_num_edges(graph);
+    size_t log_n = 1;
+    while (((size_t)1 << log_n) < n) log_n++;
+    return e * log_n < n * n;
+}
+
+ShortestPathResult* dijkstra_with_strategy(const Graph *graph, Vertex source,
+                                           DijkstraStrategy strategy) {
+    if (graph == NULL) return NULL;
+    if (source >= graph_num_vertices(graph)) return NULL;
+
+    if (strategy == DIJKSTRA_AUTO)
+        strategy = dijkstra_prefers_heap(graph) ? DIJKSTRA_BINARY_HEAP : DIJKSTRA_DENSE;
+
+    if (strategy == DIJKSTRA_BINARY_HEAP) return dijkstra_binary_heap(graph, source);
+    return dijkstra_dense(graph, source);
+}
+
+ShortestPathResult* dijkstra(const Graph *graph, Vertex source) {
+    return dijkstra_with_strategy(graph, source, DIJKSTRA_AUTO);
+}
+
 // ============================================================================
 // BELLMAN-FORD - Cormen S24.1
 // ============================================================================
@@ -157,6 +323,76 @@ ShortestPathResult* bellman_ford(const Graph *graph, Vertex source) {
     return r;
 }
 
+/**
+ * SPFA: so vertices cuja distancia acabou de cair voltam a relaxar seus
+ * arcos (cada um no maximo uma vez na fila). hops[v] conta os arcos do
+ * caminho atual ate v; um caminho simples tem ate V - 1 arcos, entao
+ * hops[v] >= V implica um ciclo na arvore de pais, necessariamente negativo.
+ */
+ShortestPathResult* bellman_ford_spfa_csr(const CSRGraph *csr, Vertex source) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    if (source >= n) return NULL;
+
+    ShortestPathResult *r = create_sp_result(n);
+    size_t *hops = (size_t *)calloc(n, sizeof(size_t));
+    bool *queued = (bool *)calloc(n, sizeof(bool));
+    Queue *queue = queue_create(sizeof(Vertex), QUEUE_ARRAY, n, NULL);
+    if (r == NULL || hops == NULL || queued == NULL || queue == NULL) {
+        shortest_path_free(r);
+        free(hops);
+        free(queued);
+        queue_destroy(queue);
+        return NULL;
+    }
+
+    r->dist[source] = 0.0;
+    queue_enqueue(queue, &source);
+    queued[source] = true;
+
+    while (!r->has_negative_cycle && !queue_is_empty(queue)) {
+        Vertex u;
+        queue_dequeue(queue, &u);
+        queued[u] = false;
+
+        const Vertex *dests;
+        const double *weights;
+        size_t count;
+        graph_csr_neighbors(csr, u, &dests, &weights, &count);
+        for (size_t i = 0; i < count; i++) {
+            Vertex v = dests[i];
+            if (r->dist[u] + weights[i] >= r->dist[v]) continue;
+            r->dist[v] = r->dist[u] + weights[i];
+            r->parent[v] = u;
+            hops[v] = hops[u] + 1;
+            if (hops[v] >= n) {
+                r->has_negative_cycle = true;
+                break;
+            }
+            if (!queued[v]) {
+                queue_enqueue(queue, &v);
+                queued[v] = true;
+            }
+        }
+    }
+
+    free(hops);
+    free(queued);
+    queue_destroy(queue);
+    return r;
+}
+
+// Listas encadeadas espalham os vizinhos pela memoria: o SPFA roda sobre
+// um snapshot CSR (custo de montagem semelhante ao graph_edges do bellman_ford)
+ShortestPathResult* bellman_ford_spfa(const Graph *graph, Vertex source) {
+    if (graph == NULL || source >= graph_num_vertices(graph)) return NULL;
+    CSRGraph *csr = graph_freeze(graph);
+    if (csr == NULL) return NULL;
+    ShortestPathResult *r = bellman_ford_spfa_csr(csr, source);
+    graph_csr_destroy(csr);
+    return r;
+}
+
 // ============================================================================
 // FLOYD-WARSHALL - Cormen S25.2
 // ============================================================================
@@ -194,15 +430,14 @@ AllPairsResult* floyd_warshall(const Graph *graph) {
     }
 
     for (size_t u = 0; u < n; u++) {
-        Vertex *neighbors = NULL;
-        size_t count = 0;
-        graph_neighbors(graph, u, &neighbors, &count);
-        for (size_t i = 0; i < count; i++) {
-            Vertex v = neighbors[i];
-            r->dist[u][v] = graph_edge_weight(graph, u, v);
+        GraphNeighborIter it;
+        Vertex v;
+        double w;
+        graph_neighbor_iter_begin(graph, u, &it);
+        while (graph_neighbor_iter_next(&it, &v, &w)) {
+            r->dist[u][v] = w;
             r->next[u][v] = v;
         }
-        free(neighbors);
     }
 
     for (size_t k = 0; k < n; k++) {
@@ -222,6 +457,306 @@ AllPairsResult* floyd_warshall(const Graph *graph) {
     return r;
 }
 
+// ============================================================================
+// FLOYD-WARSHALL EM BLOCOS (Venkataraman, Sahni & Mukhopadhyaya, 2003)
+// ============================================================================
+
+/** Lado do bloco: tres blocos double ocupam 96 KB (cabem no L2) */
+#define FW_BLOCK 64
+
+/**
+ * Kernel de um bloco: c = min(c, a (min-plus) b), e (variante _paths) next
+ * de c copia next de a quando melhora. O dependente (fases 1 e 2) tem k por
+ * fora porque c pode ser o proprio a ou b; o independente (fase 3) recebe
+ * tres blocos distintos e usa a ordem i, k, j com restrict (em parametros:
+ * o gcc ignora restrict em variaveis locais), e o laco em j, sem desvios,
+ * e vetorizado pelo compilador.
+ */
+typedef void (*FWTileFn)(void *c, const void *a, const void *b, uint32_t *nc,
+                         const uint32_t *na, size_t stride);
+
+// Linha i do bloco c contra a linha k de b, com a[i][k] = aik
+#define FW_ROW_DIST(T) \
+    for (size_t j = 0; j < FW_BLOCK; j++) { \
+        T t = aik + bk[j]; \
+        ci[j] = (t < ci[j]) ? t : ci[j]; \
+    }
+
+#define FW_ROW_PATHS(T) \
+    for (size_t j = 0; j < FW_BLOCK; j++) { \
+        T t = aik + bk[j]; \
+        T old = ci[j]; \
+        uint32_t take = 0u - (uint32_t)(t < old); \
+        ci[j] = (t < old) ? t : old; \
+        ni[j] = (ni[j] & ~take) | (nik & take); \
+    }
+
+#define FW_DEFINE_TILES(SUF, T, ATTR) \
+ATTR static void fw_dependent_##SUF(void *c_, const void *a_, const void *b_, uint32_t *nc, \
+                                    const uint32_t *na, size_t s) { \
+    (void)nc; (void)na; \
+    T *c = (T *)c_; \
+    const T *a = (const T *)a_; \
+    const T *b = (const T *)b_; \
+    for (size_t k = 0; k < FW_BLOCK; k++) { \
+        const T *bk = b + k * s; \
+        for (size_t i = 0; i < FW_BLOCK; i++) { \
+            T aik = a[i * s + k]; \
+            T *ci = c + i * s; \
+            FW_ROW_DIST(T) \
+        } \
+    } \
+} \
+ATTR static void fw_dependent_paths_##SUF(void *c_, const void *a_, const void *b_, uint32_t *nc, \
+                                          const uint32_t *na, size_t s) { \
+    T *c = (T *)c_; \
+    const T *a = (const T *)a_; \
+    const T *b = (const T *)b_; \
+    for (size_t k = 0; k < FW_BLOCK; k++) { \
+        const T *bk = b + k * s; \
+        for (size_t i = 0; i < FW_BLOCK; i++) { \
+            T aik = a[i * s + k]; \
+            uint32_t nik = na[i * s + k]; \
+            T *ci = c + i * s; \
+            uint32_t *ni = nc + i * s; \
+            FW_ROW_PATHS(T) \
+        } \
+    } \
+} \
+ATTR static inline void fw_independent_rows_##SUF(T *restrict c, const T *restrict a, \
+                                                  const T *restrict b, size_t s) { \
+    for (size_t i = 0; i < FW_BLOCK; i++) { \
+        T *ci = c + i * s; \
+        for (size_t k = 0; k < FW_BLOCK; k++) { \
+            T aik = a[i * s + k]; \
+            const T *bk = b + k * s; \
+            FW_ROW_DIST(T) \
+        } \
+    } \
+} \
+ATTR static inline void fw_independent_paths_rows_##SUF(T *restrict c, const T *restrict a, \
+                                                        const T *restrict b, uint32_t *restrict nc, \
+                                                        const uint32_t *restrict na, size_t s) { \
+    for (size_t i = 0; i < FW_BLOCK; i++) { \
+        T *ci = c + i * s; \
+        uint32_t *ni = nc + i * s; \
+        for (size_t k = 0; k < FW_BLOCK; k++) { \
+            T aik = a[i * s + k]; \
+            uint32_t nik = na[i * s + k]; \
+            const T *bk = b + k * s; \
+            FW_ROW_PATHS(T) \
+        } \
+    } \
+} \
+ATTR static void fw_independent_##SUF(void *c, const void *a, const void *b, uint32_t *nc, \
+                                      const uint32_t *na, size_t s) { \
+    (void)nc; (void)na; \
+    fw_independent_rows_##SUF((T *)c, (const T *)a, (const T *)b, s); \
+} \
+ATTR static void fw_independent_paths_##SUF(void *c, const void *a, const void *b, uint32_t *nc, \
+                                            const uint32_t *na, size_t s) { \
+    fw_independent_paths_rows_##SUF((T *)c, (const T *)a, (const T *)b, nc, na, s); \
+}
+
+FW_DEFINE_TILES(double, double, )
+FW_DEFINE_TILES(float, float, )
+
+#if defined(GRAPH_USE_AVX2)
+#define FW_AVX2_ATTR __attribute__((target("avx2")))
+FW_DEFINE_TILES(double_avx2, double, FW_AVX2_ATTR)
+FW_DEFINE_TILES(float_avx2, float, FW_AVX2_ATTR)
+
+static bool fw_cpu_has_avx2(void) {
+    static int detected = -1;
+    if (detected < 0) {
+        __builtin_cpu_init();
+        detected = __builtin_cpu_supports("avx2") ? 1 : 0;
+    }
+    return detected == 1;
+}
+#endif
+
+static FWTileFn fw_pick_kernel(bool independent, bool use_float, bool with_paths) {
+#if defined(GRAPH_USE_AVX2)
+    if (fw_cpu_has_avx2()) {
+        if (independent) {
+            if (use_float) return with_paths ? fw_independent_paths_float_avx2 : fw_independent_float_avx2;
+            return with_paths ? fw_independent_paths_double_avx2 : fw_independent_double_avx2;
+        }
+        if (use_float) return with_paths ? fw_dependent_paths_float_avx2 : fw_dependent_float_avx2;
+        return with_paths ? fw_dependent_paths_double_avx2 : fw_dependent_double_avx2;
+    }
+#endif
+    if (independent) {
+        if (use_float) return with_paths ? fw_independent_paths_float : fw_independent_float;
+        return with_paths ? fw_independent_paths_double : fw_independent_double;
+    }
+    if (use_float) return with_paths ? fw_dependent_paths_float : fw_dependent_float;
+    return with_paths ? fw_dependent_paths_double : fw_dependent_double;
+}
+
+typedef struct {
+    char *dist;
+    uint32_t *next;
+    size_t elem_size;
+    size_t stride;
+    FWTileFn dependent;
+    FWTileFn independent;
+} FWMatrix;
+
+static inline void *fw_tile(const FWMatrix *m, size_t ib, size_t jb) {
+    return m->dist + (ib * FW_BLOCK * m->stride + jb * FW_BLOCK) * m->elem_size;
+}
+
+static inline uint32_t *fw_next_tile(const FWMatrix *m, size_t ib, size_t jb) {
+    return (m->next == NULL) ? NULL : m->next + ib * FW_BLOCK * m->stride + jb * FW_BLOCK;
+}
+
+typedef struct {
+    const FWMatrix *m;
+    size_t nb, kb;
+    void *diag;
+    uint32_t *ndiag;
+} FWPhase;
+
+// Fase 2: linha kb (a = diagonal) e coluna kb (b = diagonal)
+static void fw_phase2_range(void *ctx, size_t lo, size_t hi) {
+    const FWPhase *p = ctx;
+    const FWMatrix *m = p->m;
+    size_t s = m->stride;
+    for (size_t t = lo; t < hi; t++) {
+        size_t x = t % p->nb;
+        if (x == p->kb) continue;
+        if (t < p->nb) {
+            void *c = fw_tile(m, p->kb, x);
+            m->dependent(c, p->diag, c, fw_next_tile(m, p->kb, x), p->ndiag, s);
+        } else {
+            void *c = fw_tile(m, x, p->kb);
+            uint32_t *nc = fw_next_tile(m, x, p->kb);
+            m->dependent(c, c, p->diag, nc, nc, s);
+        }
+    }
+}
+
+// Fase 3: demais blocos, (i, j) = min(i, j) + (i, kb) x (kb, j)
+static void fw_phase3_range(void *ctx, size_t lo, size_t hi) {
+    const FWPhase *p = ctx;
+    const FWMatrix *m = p->m;
+    size_t kb = p->kb;
+    for (size_t t = lo; t < hi; t++) {
+        size_t ib = t / p->nb, jb = t % p->nb;
+        if (ib == kb || jb == kb) continue;
+        m->independent(fw_tile(m, ib, jb), fw_tile(m, ib, kb), fw_tile(m, kb, jb),
+                       fw_next_tile(m, ib, jb), fw_next_tile(m, ib, kb), m->stride);
+    }
+}
+
+static void fw_blocked_run(const FWMatrix *m, size_t threads) {
+    size_t nb = m->stride / FW_BLOCK;
+    FWPhase p = { m, nb, 0, NULL, NULL };
+    for (size_t kb = 0; kb < nb; kb++) {
+        p.kb = kb;
+        p.diag = fw_tile(m, kb, kb);
+        p.ndiag = fw_next_tile(m, kb, kb);
+        m->dependent(p.diag, p.diag, p.diag, p.ndiag, p.ndiag, m->stride);
+        ds_parallel_for_threads(threads, 0, 2 * nb, 1, fw_phase2_range, &p);
+        ds_parallel_for_threads(threads, 0, nb * nb, 0, fw_phase3_range, &p);
+    }
+}
+
+typedef struct {
+    AllPairsMatrix *r;
+    bool use_float, with_paths;
+} FWInit;
+
+static void fw_init_rows(void *ctx, size_t lo, size_t hi) {
+    const FWInit *f = ctx;
+    AllPairsMatrix *r = f->r;
+    size_t stride = r->stride;
+    for (size_t row = lo; row < hi; row++) {
+        size_t base = row * stride;
+        for (size_t j = 0; j < stride; j++) {
+            if (f->use_float) r->dist_f[base + j] = INFINITY;
+            else r->dist[base + j] = INFINITY;
+            if (f->with_paths) r->next[base + j] = GRAPH_NO_NEXT;
+        }
+        if (f->use_float) r->dist_f[base + row] = 0.0f;
+        else r->dist[base + row] = 0.0;
+    }
+}
+
+AllPairsMatrix* floyd_warshall_blocked(const Graph *graph, APSPPrecision precision,
+                                       bool with_paths, size_t num_threads) {
+    if (graph == NULL) return NULL;
+    size_t n = graph_num_vertices(graph);
+    if (n == 0 || (with_paths && n >= (size_t)GRAPH_NO_NEXT)) return NULL;
+
+    bool use_float = (precision == APSP_FLOAT);
+    size_t stride = (n + FW_BLOCK - 1) / FW_BLOCK * FW_BLOCK;
+    size_t elem_size = use_float ? sizeof(float) : sizeof(double);
+    if (stride > SIZE_MAX / stride / elem_size) return NULL;
+    size_t cells = stride * stride;
+
+    size_t threads = ds_resolve_threads(num_threads);
+
+    AllPairsMatrix *r = (AllPairsMatrix *)calloc(1, sizeof(AllPairsMatrix));
+    if (r == NULL) return NULL;
+    r->num_vertices = n;
+    r->stride = stride;
+
+    // Huge pages sem intercalar: vale o first-touch da inicializacao abaixo
+    unsigned flags = ds_get_large_alloc_flags() & ~DS_LARGE_INTERLEAVE;
+    if (use_float) r->dist_f = (float *)ds_large_calloc_flags(cells, sizeof(float), flags);
+    else r->dist = (double *)ds_large_calloc_flags(cells, sizeof(double), flags);
+    if (with_paths) r->next = (uint32_t *)ds_large_calloc_flags(cells, sizeof(uint32_t), flags);
+    if ((r->dist == NULL && r->dist_f == NULL) || (with_paths && r->next == NULL)) {
+        all_pairs_matrix_free(r);
+        return NULL;
+    }
+
+    // INFINITY (e nao DBL_MAX) durante o calculo: inf + w = inf sem testes.
+    // Em paralelo, em faixas de linhas como as da fase 3: cada pagina tende
+    // a nascer no no NUMA de uma thread que vai atualiza-la
+    FWInit init = { r, use_float, with_paths };
+    ds_parallel_for_threads(threads, 0, stride, 0, fw_init_rows, &init);
+    for (size_t u = 0; u < n; u++) {
+        GraphNeighborIter it;
+        Vertex v;
+        double w;
+        graph_neighbor_iter_begin(graph, u, &it);
+        while (graph_neighbor_iter_next(&it, &v, &w)) {
+            size_t cell = u * stride + v;
+            bool better = use_float ? ((float)w < r->dist_f[cell]) : (w < r->dist[cell]);
+            if (!better) continue;
+            if (use_float) r->dist_f[cell] = (float)w;
+            else r->dist[cell] = w;
+            if (with_paths) r->next[cell] = (uint32_t)v;
+        }
+    }
+
+    FWMatrix m;
+    m.dist = use_float ? (char *)r->dist_f : (char *)r->dist;
+    m.next = r->next;
+    m.elem_size = elem_size;
+    m.stride = stride;
+    m.dependent = fw_pick_kernel(false, use_float, with_paths);
+    m.independent = fw_pick_kernel(true, use_float, with_paths);
+    fw_blocked_run(&m, threads);
+
+    for (size_t i = 0; i < cells; i++) {
+        if (use_float) {
+            if (isinf(r->dist_f[i]) && r->dist_f[i] > 0) r->dist_f[i] = GRAPH_INFINITY_F;
+        } else if (isinf(r->dist[i]) && r->dist[i] > 0) {
+            r->dist[i] = GRAPH_INFINITY;
+        }
+    }
+    for (size_t i = 0; i < n; i++) {
+        double d = use_float ? (double)r->dist_f[i * stride + i] : r->dist[i * stride + i];
+        if (d < 0.0) r->has_negative_cycle = true;
+    }
+    return r;
+}
+
 // ============================================================================
 // KRUSKAL - Cormen S23.2 (Union-Find)
 // ============================================================================
@@ -234,6 +769,43 @@ static int compare_mst_edge(const void *a, const void *b) {
     return 0;
 }
 
+/*
+ * Ordena as arestas por peso com radix sort LSD sobre os bits do double
+ * (sorting.h), levando a aresta inteira como valor. Se o radix nao puder
+ * alocar, os arrays voltam intactos e cai no qsort.
+ */
+static void mst_sort_edges(Edge *edges, size_t m) {
+    if (m < MST_RADIX_MIN_EDGES) {
+        qsort(edges, m, sizeof(Edge), compare_mst_edge);
+        return;
+    }
+    double *keys = (double *)malloc(m * sizeof(double));
+    if (keys != NULL) {
+        for (size_t i = 0; i < m; i++) keys[i] = edges[i].weight;
+        radix_sort_kv(RADIX_KEY_DOUBLE, keys, edges, m, sizeof(Edge), 0);
+        free(keys);
+    }
+    for (size_t i = 1; i < m; i++) {
+        if (edges[i].weight < edges[i - 1].weight) {
+            qsort(edges, m, sizeof(Edge), compare_mst_edge);
+            return;
+        }
+    }
+}
+
+// Passo de Kruskal sobre arestas ja ordenadas (ate completar n - 1)
+static void mst_kruskal_scan(const Edge *edges, size_t m, UnionFind *uf, MSTResult *r, size_t n) {
+    for (size_t i = 0; i < m && r->num_edges + 1 < n; i++) {
+        if (uf_union(uf, edges[i].src, edges[i].dest)) {
+            r->edges[r->num_edges].u = edges[i].src;
+            r->edges[r->num_edges].v = edges[i].dest;
+            r->edges[r->num_edges].weight = edges[i].weight;
+            r->total_weight += edges[i].weight;
+            r->num_edges++;
+        }
+    }
+}
+
 MSTResult* kruskal(const Graph *graph) {
     if (graph == NULL) return NULL;
     size_t n = graph_num_vertices(graph);
@@ -248,7 +820,7 @@ MSTResult* kruskal(const Graph *graph) {
         return r;
     }
 
-    qsort(edges, num_edges, sizeof(Edge), compare_mst_edge);
+    mst_sort_edges(edges, num_edges);
 
     UnionFind *uf = uf_create(n);
     if (uf == NULL) { free(edges); return NULL; }
@@ -260,16 +832,7 @@ MSTResult* kruskal(const Graph *graph) {
     r->total_weight = 0.0;
     if (r->edges == NULL) { free(edges); uf_destroy(uf); free(r); return NULL; }
 
-    for (size_t i = 0; i < num_edges && r->num_edges < n - 1; i++) {
-        if (!uf_connected(uf, edges[i].src, edges[i].dest)) {
-            uf_union(uf, edges[i].src, edges[i].dest);
-            r->edges[r->num_edges].u = edges[i].src;
-            r->edges[r->num_edges].v = edges[i].dest;
-            r->edges[r->num_edges].weight = edges[i].weight;
-            r->total_weight += edges[i].weight;
-            r->num_edges++;
-        }
-    }
+    mst_kruskal_scan(edges, num_edges, uf, r, n);
 
     free(edges);
     uf_destroy(uf);
@@ -311,18 +874,16 @@ MSTResult* prim(const Graph *graph) {
         if (u == (size_t)-1) break;
         in_mst[u] = true;
 
-        Vertex *neighbors = NULL;
-        size_t count = 0;
-        graph_neighbors(graph, u, &neighbors, &count);
-        for (size_t i = 0; i < count; i++) {
-            Vertex v = neighbors[i];
-            double w = graph_edge_weight(graph, u, v);
+        GraphNeighborIter it;
+        Vertex v;
+        double w;
+        graph_neighbor_iter_begin(graph, u, &it);
+        while (graph_neighbor_iter_next(&it, &v, &w)) {
             if (!in_mst[v] && w < key[v]) {
                 key[v] = w;
                 parent[v] = u;
             }
         }
-        free(neighbors);
     }
 
     MSTResult *r = (MSTResult *)malloc(sizeof(MSTResult));
@@ -351,3 +912,2461 @@ MSTResult* prim(const Graph *graph) {
     free(in_mst);
     return r;
 }
+
+// ============================================================================
+// VARIANTES CSR
+// ============================================================================
+
+ShortestPathResult* dijkstra_csr(const CSRGraph *csr, Vertex source) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    if (source >= n) return NULL;
+
+    ShortestPathResult *r = create_sp_result(n);
+    if (r == NULL) return NULL;
+
+    IndexedMinHeap h;
+    h.heap = (Vertex *)malloc(n * sizeof(Vertex));
+    h.pos = (size_t *)malloc(n * sizeof(size_t));
+    h.size = 0;
+    h.key = r->dist;
+    if (h.heap == NULL || h.pos == NULL) {
+        free(h.heap); free(h.pos);
+        shortest_path_free(r);
+        return NULL;
+    }
+    for (size_t i = 0; i < n; i++) h.pos[i] = HEAP_NOT_IN;
+
+    r->dist[source] = 0.0;
+    imh_push_or_decrease(&h, source);
+
+    while (h.size > 0) {
+        Vertex u = imh_pop(&h);
+        const Vertex *dests;
+        const double *weights;
+        size_t count;
+        graph_csr_neighbors(csr, u, &dests, &weights, &count);
+        for (size_t i = 0; i < count; i++) {
+            Vertex v = dests[i];
+            if (r->dist[u] + weights[i] < r->dist[v]) {
+                r->dist[v] = r->dist[u] + weights[i];
+                r->parent[v] = u;
+                imh_push_or_decrease(&h, v);
+            }
+        }
+    }
+
+    free(h.heap);
+    free(h.pos);
+    return r;
+}
+
+ShortestPathResult* bellman_ford_csr(const CSRGraph *csr, Vertex source) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    if (source >= n) return NULL;
+
+    ShortestPathResult *r = create_sp_result(n);
+    if (r == NULL) return NULL;
+    r->dist[source] = 0.0;
+
+    for (size_t iter = 0; iter < n; iter++) {
+        bool changed = false;
+        for (Vertex u = 0; u < n; u++) {
+            if (r->dist[u] == GRAPH_INFINITY) continue;
+            const Vertex *dests;
+            const double *weights;
+            size_t count;
+            graph_csr_neighbors(csr, u, &dests, &weights, &count);
+            for (size_t i = 0; i < count; i++) {
+                Vertex v = dests[i];
+                if (r->dist[u] + weights[i] < r->dist[v]) {
+                    r->dist[v] = r->dist[u] + weights[i];
+                    r->parent[v] = u;
+                    changed = true;
+                }
+            }
+        }
+        if (!changed) break;
+        // Uma V-esima rodada com relaxamento implica ciclo negativo
+        if (iter == n - 1) r->has_negative_cycle = true;
+    }
+
+    return r;
+}
+
+// Arestas do snapshot (grafos nao-direcionados: cada aresta uma vez)
+static Edge *mst_csr_edges(const CSRGraph *csr, size_t *num_edges) {
+    size_t n = graph_csr_num_vertices(csr);
+    bool directed = graph_csr_is_directed(csr);
+    size_t num_arcs = 0;
+    for (Vertex u = 0; u < n; u++) num_arcs += graph_csr_out_degree(csr, u);
+
+    Edge *edges = (Edge *)malloc((num_arcs > 0 ? num_arcs : 1) * sizeof(Edge));
+    if (edges == NULL) return NULL;
+    size_t m = 0;
+    for (Vertex u = 0; u < n; u++) {
+        const Vertex *dests;
+        const double *weights;
+        size_t count;
+        graph_csr_neighbors(csr, u, &dests, &weights, &count);
+        for (size_t i = 0; i < count; i++) {
+            if (!directed && dests[i] < u) continue;
+            edges[m].src = u;
+            edges[m].dest = dests[i];
+            edges[m].weight = weights[i];
+            m++;
+        }
+    }
+    *num_edges = m;
+    return edges;
+}
+
+static MSTResult *mst_result_create(size_t n) {
+    MSTResult *r = (MSTResult *)calloc(1, sizeof(MSTResult));
+    if (r == NULL) return NULL;
+    r->edges = (MSTEdge *)malloc((n > 1 ? n - 1 : 1) * sizeof(MSTEdge));
+    if (r->edges == NULL) { free(r); return NULL; }
+    return r;
+}
+
+MSTResult* kruskal_csr(const CSRGraph *csr) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    if (n == 0) return NULL;
+
+    size_t num_edges = 0;
+    Edge *edges = mst_csr_edges(csr, &num_edges);
+    MSTResult *r = mst_result_create(n);
+    UnionFind *uf = uf_create(n);
+    if (edges == NULL || r == NULL || uf == NULL) {
+        free(edges); uf_destroy(uf); mst_free(r);
+        return NULL;
+    }
+
+    mst_sort_edges(edges, num_edges);
+    mst_kruskal_scan(edges, num_edges, uf, r, n);
+
+    free(edges);
+    uf_destroy(uf);
+    return r;
+}
+
+// ============================================================================
+// FILTER-KRUSKAL - Osipov, Sanders & Singler (2009)
+// ============================================================================
+
+static void filter_kruskal_rec(Edge *edges, size_t m, UnionFind *uf, MSTResult *r, size_t n,
+                               uint64_t *rng) {
+    if (m == 0 || r->num_edges + 1 >= n) return;
+    if (m <= FILTER_KRUSKAL_BASE_EDGES) {
+        mst_sort_edges(edges, m);
+        mst_kruskal_scan(edges, m, uf, r, n);
+        return;
+    }
+
+    *rng ^= *rng << 13;
+    *rng ^= *rng >> 7;
+    *rng ^= *rng << 17;
+    double pivot = edges[*rng % m].weight;
+
+    // Tres vias: [0, lt) < pivo, [lt, gt) == pivo, [gt, m) > pivo
+    size_t lt = 0, i = 0, gt = m;
+    while (i < gt) {
+        if (edges[i].weight < pivot) {
+            Edge t = edges[lt]; edges[lt++] = edges[i]; edges[i++] = t;
+        } else if (edges[i].weight > pivot) {
+            Edge t = edges[--gt]; edges[gt] = edges[i]; edges[i] = t;
+        } else {
+            i++;
+        }
+    }
+
+    filter_kruskal_rec(edges, lt, uf, r, n, rng);
+    mst_kruskal_scan(edges + lt, gt - lt, uf, r, n);      // mesmo peso: sem ordenar
+
+    // Filtro: descarta as pesadas cujas pontas ja estao conectadas
+    size_t kept = 0;
+    for (size_t k = gt; k < m && r->num_edges + 1 < n; k++) {
+        if (uf_find(uf, edges[k].src) != uf_find(uf, edges[k].dest)) edges[gt + kept++] = edges[k];
+    }
+    filter_kruskal_rec(edges + gt, kept, uf, r, n, rng);
+}
+
+MSTResult* filter_kruskal_csr(const CSRGraph *csr) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    if (n == 0) return NULL;
+
+    size_t num_edges = 0;
+    Edge *edges = mst_csr_edges(csr, &num_edges);
+    MSTResult *r = mst_result_create(n);
+    UnionFind *uf = uf_create(n);
+    if (edges == NULL || r == NULL || uf == NULL) {
+        free(edges); uf_destroy(uf); mst_free(r);
+        return NULL;
+    }
+
+    uint64_t rng = 0x9E3779B97F4A7C15ull;
+    filter_kruskal_rec(edges, num_edges, uf, r, n, &rng);
+
+    free(edges);
+    uf_destroy(uf);
+    return r;
+}
+
+// ============================================================================
+// BORUVKA PARALELO - Boruvka (1926); Chung & Condon (1996)
+// ============================================================================
+
+/*
+ * Ordem total das arestas: (peso, menor ponta, maior ponta). Com ela a
+ * aresta minima de cada componente e unica e os ganchos so formam ciclos
+ * de tamanho 2 (duas componentes que escolheram a mesma aresta).
+ */
+typedef struct {
+    double weight;
+    Vertex lo, hi;               // lo == GRAPH_NO_PARENT: sem aresta
+} BoruvkaEdge;
+
+static bool boruvka_less(const BoruvkaEdge *a, const BoruvkaEdge *b) {
+    if (b->lo == GRAPH_NO_PARENT) return a->lo != GRAPH_NO_PARENT;
+    if (a->lo == GRAPH_NO_PARENT) return false;
+    if (a->weight != b->weight) return a->weight < b->weight;
+    if (a->lo != b->lo) return a->lo < b->lo;
+    return a->hi < b->hi;
+}
+
+typedef struct {
+    size_t *comp;                // componente de cada vertice
+    size_t *order;               // vertices agrupados por componente
+    size_t *start;
+    size_t *hook;                // componente alvo de cada componente
+    size_t *label;
+    BoruvkaEdge *vbest;
+    BoruvkaEdge *cbest;
+    const CSRGraph *csr;
+} BoruvkaWork;
+
+// Aresta minima saindo de cada vertice de [lo, hi)
+static void boruvka_vertex_best(void *ctx, size_t lo, size_t hi) {
+    const BoruvkaWork *w = ctx;
+    const size_t *comp = w->comp;
+    for (size_t v = lo; v < hi; v++) {
+        BoruvkaEdge best = { 0.0, GRAPH_NO_PARENT, GRAPH_NO_PARENT };
+        const Vertex *dests;
+        const double *weights;
+        size_t count;
+        graph_csr_neighbors(w->csr, (Vertex)v, &dests, &weights, &count);
+        for (size_t k = 0; k < count; k++) {
+            Vertex u = dests[k];
+            if (comp[u] == comp[v]) continue;
+            BoruvkaEdge e = { weights[k], (u < v) ? u : (Vertex)v, (u < v) ? (Vertex)v : u };
+            if (boruvka_less(&e, &best)) best = e;
+        }
+        w->vbest[v] = best;
+    }
+}
+
+// Aresta minima e gancho de cada componente de [lo, hi)
+static void boruvka_component_best(void *ctx, size_t lo, size_t hi) {
+    const BoruvkaWork *w = ctx;
+    const size_t *comp = w->comp, *order = w->order, *start = w->start;
+    for (size_t k = lo; k < hi; k++) {
+        BoruvkaEdge best = { 0.0, GRAPH_NO_PARENT, GRAPH_NO_PARENT };
+        for (size_t p = start[k]; p < start[k + 1]; p++) {
+            if (boruvka_less(&w->vbest[order[p]], &best)) best = w->vbest[order[p]];
+        }
+        w->cbest[k] = best;
+        if (best.lo == GRAPH_NO_PARENT) {
+            w->hook[k] = k;
+        } else {
+            w->hook[k] = (comp[best.lo] == k) ? comp[best.hi] : comp[best.lo];
+        }
+    }
+}
+
+static void boruvka_relabel(void *ctx, size_t lo, size_t hi) {
+    const BoruvkaWork *w = ctx;
+    for (size_t v = lo; v < hi; v++) w->comp[v] = w->label[w->comp[v]];
+}
+
+static void boruvka_rounds(size_t n, size_t threads, const BoruvkaWork *w, MSTResult *r) {
+    size_t *comp = w->comp, *order = w->order, *start = w->start, *hook = w->hook, *label = w->label;
+    BoruvkaEdge *cbest = w->cbest;
+
+    for (size_t v = 0; v < n; v++) comp[v] = v;
+    size_t c = n;
+
+    while (c > 1) {
+        // 1. Aresta minima saindo de cada vertice (sem disputa entre threads)
+        ds_parallel_for_threads(threads, 0, n, 1024, boruvka_vertex_best, (void *)w);
+
+        // 2. Agrupa os vertices por componente (contagem) e reduz por componente
+        memset(start, 0, (c + 1) * sizeof(size_t));
+        for (size_t v = 0; v < n; v++) start[comp[v] + 1]++;
+        for (size_t k = 0; k < c; k++) start[k + 1] += start[k];
+        memcpy(label, start, c * sizeof(size_t));
+        for (size_t v = 0; v < n; v++) order[label[comp[v]]++] = v;
+
+        ds_parallel_for_threads(threads, 0, c, 256, boruvka_component_best, (void *)w);
+
+        // 3. Ciclos de 2: a menor componente vira raiz; as demais levam sua aresta
+        size_t added = 0;
+        for (size_t k = 0; k < c; k++) {
+            size_t d = hook[k];
+            if (d == k) continue;
+            if (hook[d] == k && k < d) continue;
+            r->edges[r->num_edges].u = cbest[k].lo;
+            r->edges[r->num_edges].v = cbest[k].hi;
+            r->edges[r->num_edges].weight = cbest[k].weight;
+            r->total_weight += cbest[k].weight;
+            r->num_edges++;
+            added++;
+        }
+        if (added == 0) break;
+        for (size_t k = 0; k < c; k++) {
+            if (hook[k] != k && hook[hook[k]] == k && k < hook[k]) hook[k] = k;
+        }
+
+        // 4. Raiz de cada arvore de ganchos (compressao de caminho) e novos rotulos
+        size_t next = 0;
+        for (size_t k = 0; k < c; k++) label[k] = GRAPH_NO_PARENT;
+        for (size_t k = 0; k < c; k++) {
+            size_t root = k;
+            while (hook[root] != root) root = hook[root];
+            for (size_t x = k; hook[x] != root && x != root;) {
+                size_t up = hook[x];
+                hook[x] = root;
+                x = up;
+            }
+            if (label[root] == GRAPH_NO_PARENT) label[root] = next++;
+            label[k] = label[root];
+        }
+        ds_parallel_for_threads(threads, 0, n, 0, boruvka_relabel, (void *)w);
+        c = next;
+    }
+}
+
+MSTResult* boruvka_csr(const CSRGraph *csr, size_t num_threads) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    if (n == 0) return NULL;
+
+    size_t threads = ds_resolve_threads(num_threads);
+
+    MSTResult *r = mst_result_create(n);
+    BoruvkaWork w;
+    w.csr = csr;
+    w.comp = (size_t *)malloc(n * sizeof(size_t));
+    w.order = (size_t *)malloc(n * sizeof(size_t));
+    w.start = (size_t *)malloc((n + 1) * sizeof(size_t));
+    w.hook = (size_t *)malloc(n * sizeof(size_t));
+    w.label = (size_t *)malloc(n * sizeof(size_t));
+    w.vbest = (BoruvkaEdge *)malloc(n * sizeof(BoruvkaEdge));
+    w.cbest = (BoruvkaEdge *)malloc(n * sizeof(BoruvkaEdge));
+    if (r == NULL || w.comp == NULL || w.order == NULL || w.start == NULL || w.hook == NULL ||
+        w.label == NULL || w.vbest == NULL || w.cbest == NULL) {
+        mst_free(r);
+        r = NULL;
+    } else {
+        boruvka_rounds(n, threads, &w, r);
+    }
+
+    free(w.comp);
+    free(w.order);
+    free(w.start);
+    free(w.hook);
+    free(w.label);
+    free(w.vbest);
+    free(w.cbest);
+    return r;
+}
+
+MSTResult* prim_csr(const CSRGraph *csr) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    if (n == 0) return NULL;
+
+    double *key = (double *)malloc(n * sizeof(double));
+    size_t *parent = (size_t *)malloc(n * sizeof(size_t));
+    bool *in_mst = (bool *)calloc(n, sizeof(bool));
+    IndexedMinHeap h;
+    h.heap = (Vertex *)malloc(n * sizeof(Vertex));
+    h.pos = (size_t *)malloc(n * sizeof(size_t));
+    h.size = 0;
+    h.key = key;
+    MSTResult *r = (MSTResult *)calloc(1, sizeof(MSTResult));
+    if (r != NULL) r->edges = (MSTEdge *)malloc((n > 1 ? n - 1 : 1) * sizeof(MSTEdge));
+    if (key == NULL || parent == NULL || in_mst == NULL || h.heap == NULL ||
+        h.pos == NULL || r == NULL || r->edges == NULL) {
+        free(key); free(parent); free(in_mst); free(h.heap); free(h.pos);
+        mst_free(r);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        key[i] = GRAPH_INFINITY;
+        parent[i] = GRAPH_NO_PARENT;
+        h.pos[i] = HEAP_NOT_IN;
+    }
+    key[0] = 0.0;
+    imh_push_or_decrease(&h, 0);
+
+    while (h.size > 0) {
+        Vertex u = imh_pop(&h);
+        in_mst[u] = true;
+
+        const Vertex *dests;
+        const double *weights;
+        size_t count;
+        graph_csr_neighbors(csr, u, &dests, &weights, &count);
+        for (size_t i = 0; i < count; i++) {
+            Vertex v = dests[i];
+            if (!in_mst[v] && weights[i] < key[v]) {
+                key[v] = weights[i];
+                parent[v] = u;
+                imh_push_or_decrease(&h, v);
+            }
+        }
+    }
+
+    for (size_t i = 1; i < n; i++) {
+        if (parent[i] != GRAPH_NO_PARENT) {
+            r->edges[r->num_edges].u = parent[i];
+            r->edges[r->num_edges].v = i;
+            r->edges[r->num_edges].weight = key[i];
+            r->total_weight += key[i];
+            r->num_edges++;
+        }
+    }
+
+    free(key);
+    free(parent);
+    free(in_mst);
+    free(h.heap);
+    free(h.pos);
+    return r;
+}
+
+// ============================================================================
+// BFS COM TROCA DE DIRECAO (Beamer et al., 2012)
+// ============================================================================
+
+/** Top-down -> bottom-up quando arcos da fronteira > arcos nao explorados / ALPHA */
+#define BFS_ALPHA 15
+
+/** Bottom-up -> top-down quando a fronteira cai abaixo de V / BETA */
+#define BFS_BETA 18
+
+/** Vertices descobertos que cada thread acumula antes de reservar espaco na fila */
+#define BFS_LOCAL_QUEUE 256
+
+typedef struct {
+    const CSRGraph *csr;
+    size_t n;
+    size_t threads;
+    size_t level;           // nivel sendo expandido
+    size_t tail;            // proxima posicao livre de next
+    size_t discovered;      // soma (atomica) das tarefas do nivel
+    size_t *dist;
+    size_t *parent;
+    Vertex *queue;          // fronteira (top-down)
+    Vertex *next;
+    size_t queue_size;
+    uint64_t *front;        // fronteira em bitmap (bottom-up)
+    uint64_t *front_next;
+    size_t words;
+    size_t *in_offsets;     // transposta; so digrafos, montada sob demanda
+    Vertex *in_sources;
+    bool no_transpose;      // digrafo cuja transposta nao pode ser alocada
+} BFSWork;
+
+static void bfs_flush(Vertex *next, size_t *tail, const Vertex *local, size_t count) {
+    if (count == 0) return;
+    size_t at = __atomic_fetch_add(tail, count, __ATOMIC_RELAXED);
+    memcpy(next + at, local, count * sizeof(Vertex));
+}
+
+static void bfs_top_down_range(void *ctx, size_t lo, size_t hi) {
+    BFSWork *w = ctx;
+    Vertex local[BFS_LOCAL_QUEUE];
+    size_t count = 0, scout = 0;
+    for (size_t qi = lo; qi < hi; qi++) {
+        Vertex u = w->queue[qi];
+        const Vertex *dests;
+        size_t deg;
+        graph_csr_neighbors(w->csr, u, &dests, NULL, &deg);
+        for (size_t i = 0; i < deg; i++) {
+            Vertex v = dests[i];
+            size_t expected = GRAPH_UNREACHED;
+            if (__atomic_load_n(&w->dist[v], __ATOMIC_RELAXED) != GRAPH_UNREACHED ||
+                !__atomic_compare_exchange_n(&w->dist[v], &expected, w->level + 1, false,
+                                             __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                continue;
+            }
+            w->parent[v] = u;
+            scout += graph_csr_out_degree(w->csr, v);
+            local[count++] = v;
+            if (count == BFS_LOCAL_QUEUE) {
+                bfs_flush(w->next, &w->tail, local, count);
+                count = 0;
+            }
+        }
+    }
+    bfs_flush(w->next, &w->tail, local, count);
+    __atomic_fetch_add(&w->discovered, scout, __ATOMIC_RELAXED);
+}
+
+static size_t bfs_top_down(BFSWork *w, size_t level) {
+    w->level = level;
+    w->tail = 0;
+    w->discovered = 0;
+    ds_parallel_for_threads(w->threads, 0, w->queue_size, 64, bfs_top_down_range, w);
+
+    Vertex *tmp = w->queue;
+    w->queue = w->next;
+    w->next = tmp;
+    w->queue_size = w->tail;
+    return w->discovered;
+}
+
+static void bfs_in_neighbors(const BFSWork *w, Vertex v, const Vertex **sources, size_t *deg) {
+    if (w->in_offsets == NULL) {
+        graph_csr_neighbors(w->csr, v, sources, NULL, deg);
+        return;
+    }
+    *sources = w->in_sources + w->in_offsets[v];
+    *deg = w->in_offsets[v + 1] - w->in_offsets[v];
+}
+
+/** Transposta de csr por contagem: sources[offsets[v] .. offsets[v + 1]) entram em v. */
+static bool csr_transpose(const CSRGraph *csr, size_t **in_offsets, Vertex **in_sources) {
+    size_t n = graph_csr_num_vertices(csr), arcs = 0;
+    for (Vertex u = 0; u < n; u++) arcs += graph_csr_out_degree(csr, u);
+    size_t *offsets = (size_t *)calloc(n + 1, sizeof(size_t));
+    size_t *cursor = (size_t *)malloc((n > 0 ? n : 1) * sizeof(size_t));
+    Vertex *sources = (Vertex *)malloc((arcs > 0 ? arcs : 1) * sizeof(Vertex));
+    if (offsets == NULL || cursor == NULL || sources == NULL) {
+        free(offsets);
+        free(cursor);
+        free(sources);
+        return false;
+    }
+
+    for (Vertex u = 0; u < n; u++) {
+        const Vertex *dests;
+        size_t deg;
+        graph_csr_neighbors(csr, u, &dests, NULL, &deg);
+        for (size_t i = 0; i < deg; i++) offsets[dests[i] + 1]++;
+    }
+    for (size_t v = 0; v < n; v++) {
+        offsets[v + 1] += offsets[v];
+        cursor[v] = offsets[v];
+    }
+    for (Vertex u = 0; u < n; u++) {
+        const Vertex *dests;
+        size_t deg;
+        graph_csr_neighbors(csr, u, &dests, NULL, &deg);
+        for (size_t i = 0; i < deg; i++) sources[cursor[dests[i]]++] = u;
+    }
+    free(cursor);
+    *in_offsets = offsets;
+    *in_sources = sources;
+    return true;
+}
+
+// Digrafos: o bottom-up precisa dos predecessores (transposta sob demanda)
+static bool bfs_has_in_neighbors(BFSWork *w) {
+    if (!graph_csr_is_directed(w->csr) || w->in_offsets != NULL) return true;
+    if (w->no_transpose) return false;
+    if (!csr_transpose(w->csr, &w->in_offsets, &w->in_sources)) w->no_transpose = true;
+    return !w->no_transpose;
+}
+
+static void bfs_bottom_up_range(void *ctx, size_t w0, size_t w1) {
+    BFSWork *w = ctx;
+    size_t awake = 0;
+    for (size_t wi = w0; wi < w1; wi++) {
+        uint64_t bits = 0;
+        size_t lo = wi * 64;
+        size_t hi = (lo + 64 < w->n) ? lo + 64 : w->n;
+        for (Vertex v = lo; v < hi; v++) {
+            if (w->dist[v] != GRAPH_UNREACHED) continue;
+            const Vertex *sources;
+            size_t deg;
+            bfs_in_neighbors(w, v, &sources, &deg);
+            for (size_t i = 0; i < deg; i++) {
+                Vertex u = sources[i];
+                if ((w->front[u >> 6] >> (u & 63)) & 1) {
+                    w->dist[v] = w->level + 1;
+                    w->parent[v] = u;
+                    bits |= UINT64_C(1) << (v & 63);
+                    awake++;
+                    break;
+                }
+            }
+        }
+        w->front_next[wi] = bits;
+    }
+    __atomic_fetch_add(&w->discovered, awake, __ATOMIC_RELAXED);
+}
+
+static size_t bfs_bottom_up(BFSWork *w, size_t level) {
+    w->level = level;
+    w->discovered = 0;
+    ds_parallel_for_threads(w->threads, 0, w->words, 16, bfs_bottom_up_range, w);
+
+    uint64_t *tmp = w->front;
+    w->front = w->front_next;
+    w->front_next = tmp;
+    return w->discovered;
+}
+
+static void bfs_queue_to_bitmap(BFSWork *w) {
+    memset(w->front, 0, w->words * sizeof(uint64_t));
+    for (size_t i = 0; i < w->queue_size; i++) {
+        Vertex v = w->queue[i];
+        w->front[v >> 6] |= UINT64_C(1) << (v & 63);
+    }
+}
+
+static void bfs_bitmap_to_queue(BFSWork *w) {
+    w->queue_size = 0;
+    for (size_t wi = 0; wi < w->words; wi++) {
+        for (uint64_t bits = w->front[wi]; bits != 0; bits &= bits - 1) {
+            w->queue[w->queue_size++] = wi * 64 + (size_t)__builtin_ctzll(bits);
+        }
+    }
+}
+
+/**
+ * Laco de Beamer et al.: scout = arcos saindo da fronteira recem-descoberta,
+ * unexplored = arcos de vertices ainda nao expandidos pelo top-down.
+ */
+static size_t bfs_search(BFSWork *w, Vertex source) {
+    size_t unexplored = 0;
+    for (Vertex u = 0; u < w->n; u++) unexplored += graph_csr_out_degree(w->csr, u);
+
+    w->dist[source] = 0;
+    w->queue[0] = source;
+    w->queue_size = 1;
+    size_t scout = graph_csr_out_degree(w->csr, source);
+    size_t level = 0, reached = 1;
+
+    while (w->queue_size > 0) {
+        if (scout > unexplored / BFS_ALPHA && bfs_has_in_neighbors(w)) {
+            bfs_queue_to_bitmap(w);
+            size_t awake = w->queue_size, old;
+            do {
+                old = awake;
+                awake = bfs_bottom_up(w, level++);
+                reached += awake;
+            } while (awake >= old || awake > w->n / BFS_BETA);
+            bfs_bitmap_to_queue(w);
+            scout = 1;
+        } else {
+            unexplored = (scout < unexplored) ? unexplored - scout : 0;
+            scout = bfs_top_down(w, level++);
+            reached += w->queue_size;
+        }
+    }
+    return reached;
+}
+
+BFSResult* bfs_csr(const CSRGraph *csr, Vertex source, size_t num_threads) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    if (source >= n) return NULL;
+
+    BFSWork w;
+    memset(&w, 0, sizeof(w));
+    w.csr = csr;
+    w.n = n;
+    w.threads = ds_resolve_threads(num_threads);
+    w.words = (n + 63) / 64;
+
+    BFSResult *r = (BFSResult *)calloc(1, sizeof(BFSResult));
+    w.dist = (size_t *)malloc(n * sizeof(size_t));
+    w.parent = (size_t *)malloc(n * sizeof(size_t));
+    w.queue = (Vertex *)malloc(n * sizeof(Vertex));
+    w.next = (Vertex *)malloc(n * sizeof(Vertex));
+    w.front = (uint64_t *)malloc(w.words * sizeof(uint64_t));
+    w.front_next = (uint64_t *)malloc(w.words * sizeof(uint64_t));
+    if (r == NULL || w.dist == NULL || w.parent == NULL || w.queue == NULL ||
+        w.next == NULL || w.front == NULL || w.front_next == NULL) {
+        free(w.dist);
+        free(w.parent);
+        free(r);
+        r = NULL;
+    } else {
+        for (size_t v = 0; v < n; v++) {
+            w.dist[v] = GRAPH_UNREACHED;
+            w.parent[v] = GRAPH_NO_PARENT;
+        }
+        r->dist = w.dist;
+        r->parent = w.parent;
+        r->num_vertices = n;
+        r->num_reached = bfs_search(&w, source);
+    }
+
+    free(w.queue);
+    free(w.next);
+    free(w.front);
+    free(w.front_next);
+    free(w.in_offsets);
+    free(w.in_sources);
+    return r;
+}
+
+// ============================================================================
+// SCC PARALELO: TRIM + FORWARD-BACKWARD + COLORACAO
+// (Fleischer, Hendrickson & Pinar, 2000; Orzan, 2004; Hong et al., 2013)
+// ============================================================================
+
+#define SCC_NONE ((size_t)-1)
+
+/** Passadas de trim antes e depois do forward-backward (param se nada sai) */
+#define SCC_TRIM_ROUNDS 8
+
+/**
+ * comp[v] guarda o representante do componente de v (SCC_NONE enquanto v
+ * esta ativo); os representantes viram 0 .. k - 1 no final, em ordem do
+ * menor vertice de cada componente.
+ */
+typedef struct {
+    const CSRGraph *csr;
+    size_t n;
+    size_t threads;
+    size_t *in_offsets;     // transposta; NULL em grafos nao direcionados
+    Vertex *in_sources;
+    size_t *comp;
+    size_t *color;          // coloracao: maior vertice que alcanca v
+    unsigned char *mark;    // forward-backward: bit 1 alcancado, bit 2 alcanca o pivo
+    Vertex *frontier;
+    Vertex *next;
+    size_t tail;            // scc_bfs: proxima posicao livre de next
+    size_t removed;         // scc_trim: vertices removidos na passada
+    bool backward;          // scc_bfs: segue arcos de entrada
+    unsigned char bit;      // scc_bfs: bit de mark (0 = reivindica pela cor)
+    bool changed;           // scc_coloring: alguma cor subiu na passada
+    Vertex pivot;
+} SCCWork;
+
+static void scc_arcs(const SCCWork *w, Vertex u, bool backward, const Vertex **arcs, size_t *deg) {
+    if (!backward || w->in_offsets == NULL) {
+        graph_csr_neighbors(w->csr, u, arcs, NULL, deg);
+        return;
+    }
+    *arcs = w->in_sources + w->in_offsets[u];
+    *deg = w->in_offsets[u + 1] - w->in_offsets[u];
+}
+
+static bool scc_active(const SCCWork *w, Vertex v) {
+    return __atomic_load_n(&w->comp[v], __ATOMIC_RELAXED) == SCC_NONE;
+}
+
+/**
+ * Remove (como componente unitario) vertices ativos sem arco de entrada ou
+ * de saida vindo de outro vertice ativo. Leituras desatualizadas so deixam
+ * de remover, nunca removem errado.
+ */
+static void scc_trim_range(void *ctx, size_t lo, size_t hi) {
+    SCCWork *w = ctx;
+    size_t removed = 0;
+    for (Vertex v = lo; v < hi; v++) {
+        if (!scc_active(w, v)) continue;
+        bool linked[2] = {false, false};
+        for (int dir = 0; dir < 2; dir++) {
+            const Vertex *arcs;
+            size_t deg;
+            scc_arcs(w, v, dir == 1, &arcs, &deg);
+            for (size_t i = 0; i < deg && !linked[dir]; i++) {
+                if (arcs[i] != v && scc_active(w, arcs[i])) linked[dir] = true;
+            }
+        }
+        if (!linked[0] || !linked[1]) {
+            __atomic_store_n(&w->comp[v], v, __ATOMIC_RELAXED);
+            removed++;
+        }
+    }
+    if (removed > 0) __atomic_fetch_add(&w->removed, removed, __ATOMIC_RELAXED);
+}
+
+static void scc_trim(SCCWork *w) {
+    for (size_t round = 0; round < SCC_TRIM_ROUNDS; round++) {
+        w->removed = 0;
+        ds_parallel_for_threads(w->threads, 0, w->n, 256, scc_trim_range, w);
+        if (w->removed == 0) break;
+    }
+}
+
+/**
+ * BFS em niveis a partir de w->frontier (size vertices) so por vertices
+ * ativos. Com bit != 0 marca mark[v] |= bit; com bit == 0 reivindica v para
+ * o componente color[u] quando color[v] == color[u] (CAS em comp).
+ */
+static void scc_bfs_range(void *ctx, size_t lo, size_t hi) {
+    SCCWork *w = ctx;
+    unsigned char bit = w->bit;
+    Vertex local[BFS_LOCAL_QUEUE];
+    size_t count = 0;
+    for (size_t qi = lo; qi < hi; qi++) {
+        Vertex u = w->frontier[qi];
+        const Vertex *arcs;
+        size_t deg;
+        scc_arcs(w, u, w->backward, &arcs, &deg);
+        for (size_t i = 0; i < deg; i++) {
+            Vertex v = arcs[i];
+            if (!scc_active(w, v)) continue;
+            if (bit != 0) {
+                if (__atomic_load_n(&w->mark[v], __ATOMIC_RELAXED) & bit) continue;
+                if (__atomic_fetch_or(&w->mark[v], bit, __ATOMIC_RELAXED) & bit) continue;
+            } else {
+                size_t expected = SCC_NONE;
+                if (w->color[v] != w->color[u] ||
+                    !__atomic_compare_exchange_n(&w->comp[v], &expected, w->color[u], false,
+                                                 __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                    continue;
+                }
+            }
+            local[count++] = v;
+            if (count == BFS_LOCAL_QUEUE) {
+                bfs_flush(w->next, &w->tail, local, count);
+                count = 0;
+            }
+        }
+    }
+    bfs_flush(w->next, &w->tail, local, count);
+}
+
+static void scc_bfs(SCCWork *w, size_t size, bool backward, unsigned char bit) {
+    w->backward = backward;
+    w->bit = bit;
+    while (size > 0) {
+        w->tail = 0;
+        ds_parallel_for_threads(w->threads, 0, size, 64, scc_bfs_range, w);
+        Vertex *tmp = w->frontier;
+        w->frontier = w->next;
+        w->next = tmp;
+        size = w->tail;
+    }
+}
+
+static void scc_claim_marked(void *ctx, size_t lo, size_t hi) {
+    SCCWork *w = ctx;
+    for (size_t v = lo; v < hi; v++) {
+        if (w->mark[v] == 3) w->comp[v] = w->pivot;
+    }
+}
+
+// Um passo forward-backward a partir do vertice ativo de maior grau (o
+// componente gigante costuma sair inteiro aqui)
+static void scc_forward_backward(SCCWork *w) {
+    Vertex pivot = SCC_NONE;
+    size_t best = 0;
+    for (Vertex v = 0; v < w->n; v++) {
+        if (!scc_active(w, v)) continue;
+        const Vertex *arcs;
+        size_t out, in;
+        scc_arcs(w, v, false, &arcs, &out);
+        scc_arcs(w, v, true, &arcs, &in);
+        if (pivot == SCC_NONE || (out + 1) * (in + 1) > best) {
+            pivot = v;
+            best = (out + 1) * (in + 1);
+        }
+    }
+    if (pivot == SCC_NONE) return;
+
+    memset(w->mark, 0, w->n);
+    for (int dir = 0; dir < 2; dir++) {
+        unsigned char bit = (unsigned char)(1u << dir);
+        w->mark[pivot] |= bit;
+        w->frontier[0] = pivot;
+        scc_bfs(w, 1, dir == 1, bit);
+    }
+
+    w->pivot = pivot;
+    ds_parallel_for_threads(w->threads, 0, w->n, 0, scc_claim_marked, w);
+}
+
+/**
+ * Coloracao: color[v] converge para o maior vertice ativo que alcanca v;
+ * cada v com color[v] == v e raiz, e seu componente sao os vertices da
+ * mesma cor que alcancam v (BFS reversa restrita a cor). Cada rodada fecha
+ * ao menos o componente do maior vertice ativo.
+ */
+static void scc_color_range(void *ctx, size_t lo, size_t hi) {
+    SCCWork *w = ctx;
+    for (Vertex v = lo; v < hi; v++) {
+        if (!scc_active(w, v)) continue;
+        size_t c = __atomic_load_n(&w->color[v], __ATOMIC_RELAXED);
+        size_t best = c;
+        const Vertex *arcs;
+        size_t deg;
+        scc_arcs(w, v, true, &arcs, &deg);
+        for (size_t i = 0; i < deg; i++) {
+            if (!scc_active(w, arcs[i])) continue;
+            size_t cu = __atomic_load_n(&w->color[arcs[i]], __ATOMIC_RELAXED);
+            if (cu > best) best = cu;
+        }
+        if (best != c) {
+            __atomic_store_n(&w->color[v], best, __ATOMIC_RELAXED);
+            __atomic_store_n(&w->changed, true, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+static void scc_coloring(SCCWork *w) {
+    while (1) {
+        size_t roots = 0;
+        for (Vertex v = 0; v < w->n; v++) {
+            if (scc_active(w, v)) w->color[v] = v;
+        }
+
+        w->changed = true;
+        while (w->changed) {
+            w->changed = false;
+            ds_parallel_for_threads(w->threads, 0, w->n, 256, scc_color_range, w);
+        }
+
+        for (Vertex v = 0; v < w->n; v++) {
+            if (scc_active(w, v) && w->color[v] == v) w->frontier[roots++] = v;
+        }
+        if (roots == 0) return;
+        for (size_t k = 0; k < roots; k++) w->comp[w->frontier[k]] = w->frontier[k];
+        scc_bfs(w, roots, true, 0);
+    }
+}
+
+void scc_free(SCCResult *result) {
+    if (result == NULL) return;
+    free(result->component);
+    free(result);
+}
+
+SCCResult* scc_csr_parallel(const CSRGraph *csr, size_t num_threads) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    size_t cap = (n > 0) ? n : 1;
+
+    SCCWork w;
+    memset(&w, 0, sizeof(w));
+    w.csr = csr;
+    w.n = n;
+    w.threads = ds_resolve_threads(num_threads);
+
+    SCCResult *r = (SCCResult *)calloc(1, sizeof(SCCResult));
+    w.comp = (size_t *)malloc(cap * sizeof(size_t));
+    w.color = (size_t *)malloc(cap * sizeof(size_t));
+    w.mark = (unsigned char *)malloc(cap);
+    w.frontier = (Vertex *)malloc(cap * sizeof(Vertex));
+    w.next = (Vertex *)malloc(cap * sizeof(Vertex));
+    bool ok = r != NULL && w.comp != NULL && w.color != NULL && w.mark != NULL &&
+              w.frontier != NULL && w.next != NULL;
+    if (ok && graph_csr_is_directed(csr)) ok = csr_transpose(csr, &w.in_offsets, &w.in_sources);
+
+    if (ok) {
+        for (size_t v = 0; v < n; v++) w.comp[v] = SCC_NONE;
+        scc_trim(&w);
+        scc_forward_backward(&w);
+        scc_trim(&w);
+        scc_coloring(&w);
+
+        // Representantes -> 0 .. k - 1 (color vira o mapa)
+        for (size_t v = 0; v < n; v++) w.color[v] = SCC_NONE;
+        for (size_t v = 0; v < n; v++) {
+            size_t rep = w.comp[v];
+            if (w.color[rep] == SCC_NONE) w.color[rep] = r->num_components++;
+            w.comp[v] = w.color[rep];
+        }
+        r->component = w.comp;
+        r->num_vertices = n;
+        w.comp = NULL;
+    }
+
+    free(w.comp);
+    free(w.color);
+    free(w.mark);
+    free(w.frontier);
+    free(w.next);
+    free(w.in_offsets);
+    free(w.in_sources);
+    if (!ok) {
+        free(r);
+        return NULL;
+    }
+    return r;
+}
+
+// ============================================================================
+// DELTA-STEPPING (Meyer & Sanders, 2003)
+// ============================================================================
+
+/**
+ * Distancias nao negativas guardadas como bits IEEE 754 em uint64_t: para
+ * double >= 0 a ordem dos bits como inteiro sem sinal e a ordem dos valores,
+ * entao o minimo atomico e um CAS de 64 bits comum.
+ */
+static inline uint64_t delta_bits(double d) {
+    uint64_t b;
+    memcpy(&b, &d, sizeof(b));
+    return b;
+}
+
+static inline double delta_value(uint64_t b) {
+    double d;
+    memcpy(&d, &b, sizeof(d));
+    return d;
+}
+
+typedef struct {
+    Vertex *items;
+    size_t size;
+    size_t capacity;
+} DeltaBucket;
+
+// Baldes locais de uma thread, indexados por floor(dist / delta)
+typedef struct {
+    DeltaBucket *buckets;
+    size_t num_buckets;
+} DeltaBuckets;
+
+static bool delta_push(DeltaBuckets *b, size_t index, Vertex v) {
+    if (index >= b->num_buckets) {
+        size_t count = (index + 1 > 2 * b->num_buckets) ? index + 1 : 2 * b->num_buckets;
+        if (count > SIZE_MAX / sizeof(DeltaBucket)) return false;
+        DeltaBucket *grown = (DeltaBucket *)realloc(b->buckets, count * sizeof(DeltaBucket));
+        if (grown == NULL) return false;
+        memset(grown + b->num_buckets, 0, (count - b->num_buckets) * sizeof(DeltaBucket));
+        b->buckets = grown;
+        b->num_buckets = count;
+    }
+    DeltaBucket *bk = &b->buckets[index];
+    if (bk->size == bk->capacity) {
+        size_t capacity = bk->capacity ? 2 * bk->capacity : 16;
+        Vertex *items = (Vertex *)realloc(bk->items, capacity * sizeof(Vertex));
+        if (items == NULL) return false;
+        bk->items = items;
+        bk->capacity = capacity;
+    }
+    bk->items[bk->size++] = v;
+    return true;
+}
+
+typedef struct {
+    const CSRGraph *csr;
+    double delta;
+    size_t threads;
+    size_t slots;            // ds_get_num_threads(): indices de ds_thread_index()
+    uint64_t *dist;
+    DeltaBuckets *local;     // um conjunto de baldes por thread do pool
+    Vertex *frontier;
+    size_t frontier_size;
+    size_t frontier_capacity;
+    size_t current;
+    bool failed;
+} DeltaWork;
+
+static inline size_t delta_bucket_of(const DeltaWork *w, double d) {
+    double q = d / w->delta;
+    return (q < (double)(SIZE_MAX / 2)) ? (size_t)q : SIZE_MAX / 2;
+}
+
+static void delta_relax_range(void *ctx, size_t lo, size_t hi) {
+    DeltaWork *w = ctx;
+    DeltaBuckets *mine = &w->local[ds_thread_index()];
+    for (size_t fi = lo; fi < hi; fi++) {
+        Vertex u = w->frontier[fi];
+        double du = delta_value(__atomic_load_n(&w->dist[u], __ATOMIC_RELAXED));
+        // Entrada obsoleta: u melhorou e ja foi expandido num balde anterior
+        if (delta_bucket_of(w, du) < w->current) continue;
+
+        const Vertex *dests;
+        const double *weights;
+        size_t count;
+        graph_csr_neighbors(w->csr, u, &dests, &weights, &count);
+        for (size_t i = 0; i < count; i++) {
+            double nd = du + weights[i];
+            uint64_t nb = delta_bits(nd);
+            uint64_t old = __atomic_load_n(&w->dist[dests[i]], __ATOMIC_RELAXED);
+            while (nb < old) {
+                if (__atomic_compare_exchange_n(&w->dist[dests[i]], &old, nb, true,
+                                                __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                    if (!delta_push(mine, delta_bucket_of(w, nd), dests[i])) {
+                        __atomic_store_n(&w->failed, true, __ATOMIC_RELAXED);
+                    }
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Relaxa todos os arcos da fronteira; melhorias vao para os baldes locais
+static bool delta_relax_frontier(DeltaWork *w, size_t current) {
+    w->current = current;
+    w->failed = false;
+    ds_parallel_for_threads(w->threads, 0, w->frontier_size, 64, delta_relax_range, w);
+    return !w->failed;
+}
+
+/**
+ * Menor balde nao vazio (>= current) entre todas as threads; junta o
+ * conteudo dele de todas as threads na fronteira compartilhada.
+ */
+static bool delta_next_frontier(DeltaWork *w, size_t current, size_t *next) {
+    size_t best = SIZE_MAX;
+    for (size_t t = 0; t < w->slots; t++) {
+        const DeltaBuckets *b = &w->local[t];
+        for (size_t k = current; k < b->num_buckets && k < best; k++) {
+            if (b->buckets[k].size > 0) {
+                best = k;
+                break;
+            }
+        }
+    }
+    if (best == SIZE_MAX) return false;
+
+    size_t total = 0;
+    for (size_t t = 0; t < w->slots; t++) {
+        if (best < w->local[t].num_buckets) total += w->local[t].buckets[best].size;
+    }
+    if (total > w->frontier_capacity) {
+        Vertex *grown = (Vertex *)realloc(w->frontier, total * sizeof(Vertex));
+        if (grown == NULL) return false;
+        w->frontier = grown;
+        w->frontier_capacity = total;
+    }
+    w->frontier_size = 0;
+    for (size_t t = 0; t < w->slots; t++) {
+        if (best >= w->local[t].num_buckets || w->local[t].buckets[best].size == 0) continue;
+        DeltaBucket *bk = &w->local[t].buckets[best];
+        memcpy(w->frontier + w->frontier_size, bk->items, bk->size * sizeof(Vertex));
+        w->frontier_size += bk->size;
+        bk->size = 0;
+    }
+    *next = best;
+    return true;
+}
+
+/**
+ * Pais a partir das distancias finais: parent[v] = menor u com
+ * dist[u] + w(u,v) == dist[v] e dist[u] < dist[v] (minimo atomico, logo
+ * deterministico). A desigualdade estrita impede ciclos; vertices que so
+ * tem arcos justos de mesma distancia (pesos zero) recebem o pai numa
+ * busca serial por esses arcos a partir dos que ja tem pai.
+ * Devolve false so se a fila dessa busca nao puder ser alocada.
+ */
+typedef struct {
+    const CSRGraph *csr;
+    ShortestPathResult *r;
+} DeltaParentsJob;
+
+static void delta_parents_range(void *ctx, size_t lo, size_t hi) {
+    const DeltaParentsJob *job = ctx;
+    const CSRGraph *csr = job->csr;
+    const double *dist = job->r->dist;
+    size_t *parent = job->r->parent;
+    for (Vertex u = lo; u < hi; u++) {
+        if (dist[u] == GRAPH_INFINITY) continue;
+        const Vertex *dests;
+        const double *weights;
+        size_t count;
+        graph_csr_neighbors(csr, u, &dests, &weights, &count);
+        for (size_t i = 0; i < count; i++) {
+            Vertex v = dests[i];
+            if (!(dist[u] < dist[v]) || dist[u] + weights[i] != dist[v]) continue;
+            size_t old = __atomic_load_n(&parent[v], __ATOMIC_RELAXED);
+            while (u < old && !__atomic_compare_exchange_n(&parent[v], &old, u, true,
+                                                           __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            }
+        }
+    }
+}
+
+static bool delta_parents(const CSRGraph *csr, size_t n, Vertex source, size_t threads,
+                          ShortestPathResult *r) {
+    const double *dist = r->dist;
+    size_t *parent = r->parent;
+    size_t orphans = 0;
+    DeltaParentsJob job = { csr, r };
+    ds_parallel_for_threads(threads, 0, n, 256, delta_parents_range, &job);
+
+    for (Vertex v = 0; v < n; v++) {
+        if (v != source && dist[v] != GRAPH_INFINITY && parent[v] == GRAPH_NO_PARENT) orphans++;
+    }
+    if (orphans == 0) return true;
+
+    Vertex *queue = (Vertex *)malloc(n * sizeof(Vertex));
+    if (queue == NULL) return false;
+    size_t head = 0, tail = 0;
+    for (Vertex v = 0; v < n; v++) {
+        if (v == source || (dist[v] != GRAPH_INFINITY && parent[v] != GRAPH_NO_PARENT)) queue[tail++] = v;
+    }
+    while (head < tail) {
+        Vertex u = queue[head++];
+        const Vertex *dests;
+        const double *weights;
+        size_t count;
+        graph_csr_neighbors(csr, u, &dests, &weights, &count);
+        for (size_t i = 0; i < count; i++) {
+            Vertex v = dests[i];
+            if (v != source && parent[v] == GRAPH_NO_PARENT && dist[v] == dist[u] &&
+                dist[u] + weights[i] == dist[v]) {
+                parent[v] = u;
+                queue[tail++] = v;
+            }
+        }
+    }
+    free(queue);
+    return true;
+}
+
+ShortestPathResult* delta_stepping_csr(const CSRGraph *csr, Vertex source, double delta,
+                                       size_t num_threads) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    if (source >= n) return NULL;
+
+    // Pesos negativos nao sao suportados; delta <= 0 escolhe max_w / grau medio
+    size_t arcs = 0;
+    double max_weight = 0.0;
+    for (Vertex u = 0; u < n; u++) {
+        const Vertex *dests;
+        const double *weights;
+        size_t count;
+        graph_csr_neighbors(csr, u, &dests, &weights, &count);
+        for (size_t i = 0; i < count; i++) {
+            if (!(weights[i] >= 0.0)) return NULL;
+            if (weights[i] > max_weight) max_weight = weights[i];
+        }
+        arcs += count;
+    }
+    if (!(delta > 0.0)) {
+        double avg_degree = (double)arcs / (double)n;
+        delta = (max_weight > 0.0) ? max_weight / (avg_degree > 1.0 ? avg_degree : 1.0) : 1.0;
+    }
+
+    DeltaWork w;
+    memset(&w, 0, sizeof(w));
+    w.csr = csr;
+    w.delta = delta;
+    w.threads = ds_resolve_threads(num_threads);
+    w.slots = ds_get_num_threads();
+
+    ShortestPathResult *r = create_sp_result(n);
+    w.dist = (uint64_t *)malloc(n * sizeof(uint64_t));
+    w.local = (DeltaBuckets *)calloc(w.slots, sizeof(DeltaBuckets));
+    w.frontier = (Vertex *)malloc(sizeof(Vertex));
+    w.frontier_capacity = 1;
+    bool ok = r != NULL && w.dist != NULL && w.local != NULL && w.frontier != NULL;
+
+    if (ok) {
+        uint64_t unreached = delta_bits(GRAPH_INFINITY);
+        for (size_t v = 0; v < n; v++) w.dist[v] = unreached;
+        w.dist[source] = delta_bits(0.0);
+        w.frontier[0] = source;
+        w.frontier_size = 1;
+
+        size_t current = 0;
+        do {
+            ok = delta_relax_frontier(&w, current);
+        } while (ok && delta_next_frontier(&w, current, &current));
+        // delta_next_frontier tambem para se a fronteira nao puder crescer
+        for (size_t t = 0; ok && t < w.slots; t++) {
+            for (size_t k = 0; k < w.local[t].num_buckets; k++) {
+                if (w.local[t].buckets[k].size > 0) ok = false;
+            }
+        }
+    }
+
+    if (ok) {
+        for (size_t v = 0; v < n; v++) r->dist[v] = delta_value(w.dist[v]);
+        ok = delta_parents(csr, n, source, w.threads, r);
+    }
+
+    if (w.local != NULL) {
+        for (size_t t = 0; t < w.slots; t++) {
+            for (size_t k = 0; k < w.local[t].num_buckets; k++) free(w.local[t].buckets[k].items);
+            free(w.local[t].buckets);
+        }
+    }
+    free(w.local);
+    free(w.dist);
+    free(w.frontier);
+    if (!ok) {
+        shortest_path_free(r);
+        return NULL;
+    }
+    return r;
+}
+
+// ============================================================================
+// CAMINHO MINIMO PONTO A PONTO (Pohl, 1971; Hart, Nilsson & Raphael, 1968)
+// ============================================================================
+
+/**
+ * Um lado da busca. seen[v] == stamp indica que dist, parent e a posicao
+ * no heap de v pertencem a consulta atual; done[v] == stamp, que v ja saiu
+ * do heap. Entradas com marca antiga valem como nao visitadas.
+ */
+typedef struct {
+    double *dist;
+    size_t *parent;
+    uint32_t *seen;
+    uint32_t *done;
+    IndexedMinHeap heap;
+} SearchSide;
+
+struct PathSearch {
+    const CSRGraph *csr;
+    size_t n;
+    size_t *in_offsets;     // transposta; so digrafos
+    Vertex *in_sources;
+    double *in_weights;
+    SearchSide side[2];     // 0: a partir da origem; 1: reversa (bidirecional)
+    double *key;            // A*: dist + h
+    double *h;              // A*: heuristica, avaliada uma vez por vertice
+    uint32_t stamp;
+    Vertex source;
+    Vertex meet;            // fim do lado 0 no caminho (GRAPH_NO_PARENT sem caminho)
+    bool bidirectional;
+    size_t settled;
+};
+
+static void search_side_free(SearchSide *s) {
+    free(s->dist);
+    free(s->parent);
+    free(s->seen);
+    free(s->done);
+    free(s->heap.heap);
+    free(s->heap.pos);
+}
+
+static bool search_side_init(SearchSide *s, size_t n) {
+    size_t cap = (n > 0) ? n : 1;
+    s->dist = (double *)malloc(cap * sizeof(double));
+    s->parent = (size_t *)malloc(cap * sizeof(size_t));
+    s->seen = (uint32_t *)calloc(cap, sizeof(uint32_t));
+    s->done = (uint32_t *)calloc(cap, sizeof(uint32_t));
+    s->heap.heap = (Vertex *)malloc(cap * sizeof(Vertex));
+    s->heap.pos = (size_t *)malloc(cap * sizeof(size_t));
+    s->heap.size = 0;
+    s->heap.key = s->dist;
+    return s->dist != NULL && s->parent != NULL && s->seen != NULL && s->done != NULL &&
+           s->heap.heap != NULL && s->heap.pos != NULL;
+}
+
+// Transposta com pesos, por contagem (mesmo esquema de bfs_has_in_neighbors)
+static bool path_search_transpose(PathSearch *ps) {
+    size_t n = ps->n, arcs = 0;
+    for (Vertex u = 0; u < n; u++) arcs += graph_csr_out_degree(ps->csr, u);
+    size_t *cursor = (size_t *)malloc((n > 0 ? n : 1) * sizeof(size_t));
+    ps->in_offsets = (size_t *)calloc(n + 1, sizeof(size_t));
+    ps->in_sources = (Vertex *)malloc((arcs > 0 ? arcs : 1) * sizeof(Vertex));
+    ps->in_weights = (double *)malloc((arcs > 0 ? arcs : 1) * sizeof(double));
+    if (cursor == NULL || ps->in_offsets == NULL || ps->in_sources == NULL || ps->in_weights == NULL) {
+        free(cursor);
+        return false;
+    }
+
+    for (Vertex u = 0; u < n; u++) {
+        const Vertex *dests;
+        size_t deg;
+        graph_csr_neighbors(ps->csr, u, &dests, NULL, &deg);
+        for (size_t i = 0; i < deg; i++) ps->in_offsets[dests[i] + 1]++;
+    }
+    for (size_t v = 0; v < n; v++) {
+        ps->in_offsets[v + 1] += ps->in_offsets[v];
+        cursor[v] = ps->in_offsets[v];
+    }
+    for (Vertex u = 0; u < n; u++) {
+        const Vertex *dests;
+        const double *weights;
+        size_t deg;
+        graph_csr_neighbors(ps->csr, u, &dests, &weights, &deg);
+        for (size_t i = 0; i < deg; i++) {
+            size_t at = cursor[dests[i]]++;
+            ps->in_sources[at] = u;
+            ps->in_weights[at] = weights[i];
+        }
+    }
+    free(cursor);
+    return true;
+}
+
+PathSearch* path_search_create(const CSRGraph *csr) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    for (Vertex u = 0; u < n; u++) {
+        const Vertex *dests;
+        const double *weights;
+        size_t deg;
+        graph_csr_neighbors(csr, u, &dests, &weights, &deg);
+        for (size_t i = 0; i < deg; i++) {
+            if (weights[i] < 0.0) return NULL;
+        }
+    }
+
+    PathSearch *ps = (PathSearch *)calloc(1, sizeof(PathSearch));
+    if (ps == NULL) return NULL;
+    ps->csr = csr;
+    ps->n = n;
+    ps->meet = GRAPH_NO_PARENT;
+    size_t cap = (n > 0) ? n : 1;
+    ps->key = (double *)malloc(cap * sizeof(double));
+    ps->h = (double *)malloc(cap * sizeof(double));
+    bool ok = ps->key != NULL && ps->h != NULL;
+    ok = search_side_init(&ps->side[0], n) && ok;
+    ok = search_side_init(&ps->side[1], n) && ok;
+    if (ok && graph_csr_is_directed(csr)) ok = path_search_transpose(ps);
+    if (!ok) {
+        path_search_destroy(ps);
+        return NULL;
+    }
+    return ps;
+}
+
+void path_search_destroy(PathSearch *search) {
+    if (search == NULL) return;
+    search_side_free(&search->side[0]);
+    search_side_free(&search->side[1]);
+    free(search->in_offsets);
+    free(search->in_sources);
+    free(search->in_weights);
+    free(search->key);
+    free(search->h);
+    free(search);
+}
+
+// Nova consulta: so as marcas mudam (zeradas de fato a cada 2^32 - 1 consultas)
+static uint32_t search_next_stamp(uint32_t stamp, SearchSide *sides, size_t count, size_t n) {
+    if (++stamp != 0) return stamp;
+    for (size_t k = 0; k < count; k++) {
+        memset(sides[k].seen, 0, n * sizeof(uint32_t));
+        memset(sides[k].done, 0, n * sizeof(uint32_t));
+    }
+    return 1;
+}
+
+static void path_search_begin(PathSearch *ps, Vertex source, bool bidirectional) {
+    ps->stamp = search_next_stamp(ps->stamp, ps->side, 2, ps->n);
+    ps->side[0].heap.size = 0;
+    ps->side[1].heap.size = 0;
+    ps->source = source;
+    ps->meet = GRAPH_NO_PARENT;
+    ps->bidirectional = bidirectional;
+    ps->settled = 0;
+}
+
+/** Traz v para a consulta atual; devolve true se ja tinha sido tocado. */
+static bool search_touch(SearchSide *s, Vertex v, uint32_t stamp) {
+    if (s->seen[v] == stamp) return true;
+    s->seen[v] = stamp;
+    s->dist[v] = GRAPH_INFINITY;
+    s->parent[v] = GRAPH_NO_PARENT;
+    s->heap.pos[v] = HEAP_NOT_IN;
+    return false;
+}
+
+static void search_arcs(const PathSearch *ps, size_t side, Vertex u,
+                        const Vertex **dests, const double **weights, size_t *deg) {
+    if (side == 0 || ps->in_offsets == NULL) {
+        graph_csr_neighbors(ps->csr, u, dests, weights, deg);
+        return;
+    }
+    *dests = ps->in_sources + ps->in_offsets[u];
+    *weights = ps->in_weights + ps->in_offsets[u];
+    *deg = ps->in_offsets[u + 1] - ps->in_offsets[u];
+}
+
+double path_search_bidirectional(PathSearch *search, Vertex source, Vertex target) {
+    if (search == NULL || source >= search->n || target >= search->n) return GRAPH_INFINITY;
+    PathSearch *ps = search;
+    path_search_begin(ps, source, true);
+    uint32_t stamp = ps->stamp;
+    SearchSide *side = ps->side;
+    side[0].heap.key = side[0].dist;
+
+    search_touch(&side[0], source, stamp);
+    side[0].dist[source] = 0.0;
+    imh_push_or_decrease(&side[0].heap, source);
+    search_touch(&side[1], target, stamp);
+    side[1].dist[target] = 0.0;
+    imh_push_or_decrease(&side[1].heap, target);
+
+    double best = GRAPH_INFINITY;
+    if (source == target) {
+        best = 0.0;
+        ps->meet = source;
+    }
+
+    while (side[0].heap.size > 0 && side[1].heap.size > 0) {
+        double top0 = side[0].dist[side[0].heap.heap[0]];
+        double top1 = side[1].dist[side[1].heap.heap[0]];
+        if (top0 + top1 >= best) break;
+
+        size_t k = (top0 <= top1) ? 0 : 1;
+        SearchSide *s = &side[k];
+        const SearchSide *other = &side[1 - k];
+        Vertex u = imh_pop(&s->heap);
+        s->done[u] = stamp;
+        ps->settled++;
+
+        const Vertex *dests;
+        const double *weights;
+        size_t deg;
+        search_arcs(ps, k, u, &dests, &weights, &deg);
+        for (size_t i = 0; i < deg; i++) {
+            Vertex v = dests[i];
+            double d = s->dist[u] + weights[i];
+            search_touch(s, v, stamp);
+            if (d >= s->dist[v]) continue;
+            s->dist[v] = d;
+            s->parent[v] = u;
+            imh_push_or_decrease(&s->heap, v);
+            if (other->seen[v] == stamp && d + other->dist[v] < best) {
+                best = d + other->dist[v];
+                ps->meet = v;
+            }
+        }
+    }
+    return best;
+}
+
+double path_search_astar(PathSearch *search, Vertex source, Vertex target,
+                         PathHeuristicFn heuristic, void *user_data) {
+    if (search == NULL || source >= search->n || target >= search->n) return GRAPH_INFINITY;
+    PathSearch *ps = search;
+    path_search_begin(ps, source, false);
+    uint32_t stamp = ps->stamp;
+    SearchSide *s = &ps->side[0];
+    s->heap.key = ps->key;
+
+    search_touch(s, source, stamp);
+    s->dist[source] = 0.0;
+    ps->h[source] = (heuristic != NULL) ? heuristic(source, target, user_data) : 0.0;
+    ps->key[source] = ps->h[source];
+    imh_push_or_decrease(&s->heap, source);
+
+    while (s->heap.size > 0) {
+        Vertex u = imh_pop(&s->heap);
+        s->done[u] = stamp;
+        ps->settled++;
+        if (u == target) {
+            ps->meet = target;
+            return s->dist[target];
+        }
+
+        const Vertex *dests;
+        const double *weights;
+        size_t deg;
+        graph_csr_neighbors(ps->csr, u, &dests, &weights, &deg);
+        for (size_t i = 0; i < deg; i++) {
+            Vertex v = dests[i];
+            double d = s->dist[u] + weights[i];
+            if (!search_touch(s, v, stamp))
+                ps->h[v] = (heuristic != NULL) ? heuristic(v, target, user_data) : 0.0;
+            // Heuristica consistente: vertice fechado nao melhora mais
+            if (s->done[v] == stamp || d >= s->dist[v]) continue;
+            s->dist[v] = d;
+            s->parent[v] = u;
+            ps->key[v] = d + ps->h[v];
+            imh_push_or_decrease(&s->heap, v);
+        }
+    }
+    return GRAPH_INFINITY;
+}
+
+size_t path_search_path(const PathSearch *search, Vertex *path, size_t capacity) {
+    if (search == NULL || search->meet == GRAPH_NO_PARENT) return 0;
+    const SearchSide *fwd = &search->side[0];
+    const SearchSide *bwd = &search->side[1];
+
+    size_t head = 1;                                  // source ... meet
+    for (Vertex v = search->meet; v != search->source; v = fwd->parent[v]) head++;
+    size_t count = head;
+    if (search->bidirectional) {                      // meet ... target
+        for (Vertex v = search->meet; bwd->parent[v] != GRAPH_NO_PARENT; v = bwd->parent[v]) count++;
+    }
+    if (path == NULL || capacity < count) return count;
+
+    size_t at = head;
+    for (Vertex v = search->meet; at > 0; v = fwd->parent[v]) path[--at] = v;
+    at = head;
+    if (search->bidirectional) {
+        for (Vertex v = bwd->parent[search->meet]; v != GRAPH_NO_PARENT; v = bwd->parent[v]) path[at++] = v;
+    }
+    return count;
+}
+
+size_t path_search_settled(const PathSearch *search) {
+    return (search != NULL) ? search->settled : 0;
+}
+
+// ============================================================================
+// CONTRACTION HIERARCHIES (Geisberger et al., 2008)
+// ============================================================================
+
+typedef struct {
+    Vertex other;           // destino (saida / para cima) ou origem (entrada / para baixo)
+    double weight;
+    Vertex middle;          // vertice contraido pelo atalho; GRAPH_NO_PARENT se arco original
+} CHArc;
+
+typedef struct {
+    CHArc *items;
+    size_t size;
+    size_t capacity;
+} CHArcList;
+
+typedef struct {
+    Vertex from;
+    Vertex to;
+    double weight;
+} CHShortcut;
+
+struct ContractionHierarchy {
+    size_t n;
+    size_t *up_offsets;     // v -> x com x contraido depois de v
+    CHArc *up;
+    size_t *down_offsets;   // u -> v com u contraido depois de v (other = u)
+    CHArc *down;
+    size_t num_shortcuts;
+    SearchSide side[2];     // 0: origem, para cima; 1: destino, para baixo
+    uint32_t stamp;
+    Vertex source;
+    Vertex meet;
+    size_t settled;
+};
+
+/**
+ * Grafo restante durante a contracao: out[v] e in[v] so tem vizinhos ainda
+ * nao contraidos. Ao contrair v suas listas congelam e viram up/down de v.
+ */
+typedef struct {
+    size_t n;
+    CHArcList *out;
+    CHArcList *in;
+    size_t *deleted;        // vizinhos ja contraidos (termo da prioridade)
+    SearchSide witness;
+    uint32_t stamp;
+    CHShortcut *pending;    // atalhos que a contracao do vertice atual cria
+    size_t num_pending;
+    size_t pending_capacity;
+} CHBuild;
+
+/** Insere o arco ou, se ja existe para other, fica com o menor peso. */
+static bool ch_list_relax(CHArcList *list, Vertex other, double weight, Vertex middle) {
+    for (size_t i = 0; i < list->size; i++) {
+        if (list->items[i].other != other) continue;
+        if (weight < list->items[i].weight) {
+            list->items[i].weight = weight;
+            list->items[i].middle = middle;
+        }
+        return true;
+    }
+    if (list->size == list->capacity) {
+        size_t cap = (list->capacity > 0) ? 2 * list->capacity : 4;
+        CHArc *items = (CHArc *)realloc(list->items, cap * sizeof(CHArc));
+        if (items == NULL) return false;
+        list->items = items;
+        list->capacity = cap;
+    }
+    list->items[list->size].other = other;
+    list->items[list->size].weight = weight;
+    list->items[list->size].middle = middle;
+    list->size++;
+    return true;
+}
+
+static void ch_list_remove(CHArcList *list, Vertex other) {
+    for (size_t i = 0; i < list->size; i++) {
+        if (list->items[i].other == other) {
+            list->items[i] = list->items[--list->size];
+            return;
+        }
+    }
+}
+
+/**
+ * Dijkstra local a partir de u sem passar por v, ate a distancia limit ou
+ * ate assentar todos os vizinhos de saida de v (marcados em done[])
+ */
+static void ch_witness_search(CHBuild *b, Vertex u, Vertex v, double limit) {
+    SearchSide *w = &b->witness;
+    const CHArcList *targets = &b->out[v];
+    b->stamp = search_next_stamp(b->stamp, w, 1, b->n);
+    size_t remaining = 0;
+    for (size_t j = 0; j < targets->size; j++) {
+        if (targets->items[j].other == u) continue;
+        w->done[targets->items[j].other] = b->stamp;
+        remaining++;
+    }
+    w->heap.size = 0;
+    search_touch(w, u, b->stamp);
+    w->dist[u] = 0.0;
+    imh_push_or_decrease(&w->heap, u);
+
+    size_t settled = 0;
+    while (remaining > 0 && w->heap.size > 0 && w->dist[w->heap.heap[0]] <= limit &&
+           settled < CH_WITNESS_SETTLE_LIMIT) {
+        Vertex x = imh_pop(&w->heap);
+        settled++;
+        if (w->done[x] == b->stamp) remaining--;
+        const CHArcList *arcs = &b->out[x];
+        for (size_t i = 0; i < arcs->size; i++) {
+            Vertex y = arcs->items[i].other;
+            if (y == v) continue;
+            double d = w->dist[x] + arcs->items[i].weight;
+            search_touch(w, y, b->stamp);
+            if (d < w->dist[y]) {
+                w->dist[y] = d;
+                imh_push_or_decrease(&w->heap, y);
+            }
+        }
+    }
+}
+
+/**
+ * Junta em pending os atalhos u -> x que contrair v exigiria. Distancias
+ * provisorias da busca ja sao caminhos reais, entao servem de testemunha.
+ */
+static bool ch_collect_shortcuts(CHBuild *b, Vertex v) {
+    b->num_pending = 0;
+    const CHArcList *in = &b->in[v];
+    const CHArcList *out = &b->out[v];
+    for (size_t i = 0; i < in->size; i++) {
+        Vertex u = in->items[i].other;
+        double w1 = in->items[i].weight;
+        double limit = -1.0;
+        for (size_t j = 0; j < out->size; j++) {
+            if (out->items[j].other != u && w1 + out->items[j].weight > limit)
+                limit = w1 + out->items[j].weight;
+        }
+        if (limit < 0.0) continue;
+        ch_witness_search(b, u, v, limit);
+
+        for (size_t j = 0; j < out->size; j++) {
+            Vertex x = out->items[j].other;
+            double d = w1 + out->items[j].weight;
+            if (x == u) continue;
+            if (b->witness.seen[x] == b->stamp && b->witness.dist[x] <= d) continue;
+            if (b->num_pending == b->pending_capacity) {
+                size_t cap = (b->pending_capacity > 0) ? 2 * b->pending_capacity : 16;
+                CHShortcut *p = (CHShortcut *)realloc(b->pending, cap * sizeof(CHShortcut));
+                if (p == NULL) return false;
+                b->pending = p;
+                b->pending_capacity = cap;
+            }
+            b->pending[b->num_pending].from = u;
+            b->pending[b->num_pending].to = x;
+            b->pending[b->num_pending].weight = d;
+            b->num_pending++;
+        }
+    }
+    return true;
+}
+
+/**
+ * 2 * diferenca de arestas + vizinhos ja contraidos (espalha a contracao).
+ * O peso 2 foi o melhor em grades de 40k vertices: com peso 1 o
+ * pre-processamento fica 2x mais lento e cria 10% mais atalhos.
+ */
+static double ch_priority(const CHBuild *b, Vertex v) {
+    return 2.0 * ((double)b->num_pending - (double)(b->in[v].size + b->out[v].size)) +
+           (double)b->deleted[v];
+}
+
+// Aplica os atalhos de pending e tira v das listas dos vizinhos
+static bool ch_contract(CHBuild *b, Vertex v) {
+    for (size_t i = 0; i < b->num_pending; i++) {
+        const CHShortcut *s = &b->pending[i];
+        if (!ch_list_relax(&b->out[s->from], s->to, s->weight, v) ||
+            !ch_list_relax(&b->in[s->to], s->from, s->weight, v)) {
+            return false;
+        }
+    }
+    for (size_t i = 0; i < b->in[v].size; i++) {
+        Vertex u = b->in[v].items[i].other;
+        ch_list_remove(&b->out[u], v);
+        b->deleted[u]++;
+    }
+    for (size_t i = 0; i < b->out[v].size; i++) {
+        Vertex x = b->out[v].items[i].other;
+        ch_list_remove(&b->in[x], v);
+        b->deleted[x]++;
+    }
+    return true;
+}
+
+static bool ch_flatten(const CHArcList *lists, size_t n, size_t **offsets, CHArc **arcs) {
+    *offsets = (size_t *)malloc((n + 1) * sizeof(size_t));
+    if (*offsets == NULL) return false;
+    (*offsets)[0] = 0;
+    for (size_t v = 0; v < n; v++) (*offsets)[v + 1] = (*offsets)[v] + lists[v].size;
+    *arcs = (CHArc *)malloc(((*offsets)[n] > 0 ? (*offsets)[n] : 1) * sizeof(CHArc));
+    if (*arcs == NULL) return false;
+    for (size_t v = 0; v < n; v++) {
+        if (lists[v].size > 0)
+            memcpy(*arcs + (*offsets)[v], lists[v].items, lists[v].size * sizeof(CHArc));
+    }
+    return true;
+}
+
+static void ch_build_free(CHBuild *b) {
+    if (b->out != NULL) {
+        for (size_t v = 0; v < b->n; v++) free(b->out[v].items);
+    }
+    if (b->in != NULL) {
+        for (size_t v = 0; v < b->n; v++) free(b->in[v].items);
+    }
+    free(b->out);
+    free(b->in);
+    free(b->deleted);
+    free(b->pending);
+    search_side_free(&b->witness);
+}
+
+// Ordem de contracao por prioridade com atualizacao preguicosa do topo
+static bool ch_contract_all(CHBuild *b, ContractionHierarchy *ch) {
+    size_t n = b->n;
+    double *priority = (double *)malloc((n > 0 ? n : 1) * sizeof(double));
+    IndexedMinHeap h;
+    h.heap = (Vertex *)malloc((n > 0 ? n : 1) * sizeof(Vertex));
+    h.pos = (size_t *)malloc((n > 0 ? n : 1) * sizeof(size_t));
+    h.size = 0;
+    h.key = priority;
+    bool ok = priority != NULL && h.heap != NULL && h.pos != NULL;
+
+    for (Vertex v = 0; ok && v < n; v++) {
+        ok = ch_collect_shortcuts(b, v);
+        priority[v] = ch_priority(b, v);
+        h.pos[v] = HEAP_NOT_IN;
+        imh_push_or_decrease(&h, v);
+    }
+    while (ok && h.size > 0) {
+        Vertex v = h.heap[0];
+        if (!ch_collect_shortcuts(b, v)) {
+            ok = false;
+            break;
+        }
+        double p = ch_priority(b, v);
+        if (p > priority[v]) {
+            priority[v] = p;
+            imh_down(&h, 0);
+            if (h.heap[0] != v) continue;
+        }
+        imh_pop(&h);
+        ok = ch_contract(b, v);
+        ch->num_shortcuts += b->num_pending;
+    }
+
+    free(priority);
+    free(h.heap);
+    free(h.pos);
+    return ok;
+}
+
+ContractionHierarchy* contraction_hierarchy_build(const CSRGraph *csr) {
+    if (csr == NULL) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+
+    ContractionHierarchy *ch = (ContractionHierarchy *)calloc(1, sizeof(ContractionHierarchy));
+    CHBuild b;
+    memset(&b, 0, sizeof(b));
+    b.n = n;
+    if (ch == NULL) return NULL;
+    ch->n = n;
+    ch->meet = GRAPH_NO_PARENT;
+
+    b.out = (CHArcList *)calloc(n > 0 ? n : 1, sizeof(CHArcList));
+    b.in = (CHArcList *)calloc(n > 0 ? n : 1, sizeof(CHArcList));
+    b.deleted = (size_t *)calloc(n > 0 ? n : 1, sizeof(size_t));
+    bool ok = search_side_init(&b.witness, n) && b.out != NULL && b.in != NULL && b.deleted != NULL;
+    ok = search_side_init(&ch->side[0], n) && ok;
+    ok = search_side_init(&ch->side[1], n) && ok;
+
+    for (Vertex u = 0; ok && u < n; u++) {
+        const Vertex *dests;
+        const double *weights;
+        size_t deg;
+        graph_csr_neighbors(csr, u, &dests, &weights, &deg);
+        for (size_t i = 0; ok && i < deg; i++) {
+            if (weights[i] < 0.0) ok = false;
+            else if (dests[i] != u) {
+                ok = ch_list_relax(&b.out[u], dests[i], weights[i], GRAPH_NO_PARENT) &&
+                     ch_list_relax(&b.in[dests[i]], u, weights[i], GRAPH_NO_PARENT);
+            }
+        }
+    }
+
+    ok = ok && ch_contract_all(&b, ch);
+    ok = ok && ch_flatten(b.out, n, &ch->up_offsets, &ch->up);
+    ok = ok && ch_flatten(b.in, n, &ch->down_offsets, &ch->down);
+    ch_build_free(&b);
+    if (!ok) {
+        contraction_hierarchy_destroy(ch);
+        return NULL;
+    }
+    return ch;
+}
+
+void contraction_hierarchy_destroy(ContractionHierarchy *ch) {
+    if (ch == NULL) return;
+    free(ch->up_offsets);
+    free(ch->up);
+    free(ch->down_offsets);
+    free(ch->down);
+    search_side_free(&ch->side[0]);
+    search_side_free(&ch->side[1]);
+    free(ch);
+}
+
+double contraction_hierarchy_query(ContractionHierarchy *ch, Vertex source, Vertex target) {
+    if (ch == NULL || source >= ch->n || target >= ch->n) return GRAPH_INFINITY;
+    ch->stamp = search_next_stamp(ch->stamp, ch->side, 2, ch->n);
+    uint32_t stamp = ch->stamp;
+    SearchSide *side = ch->side;
+    ch->source = source;
+    ch->meet = GRAPH_NO_PARENT;
+    ch->settled = 0;
+
+    Vertex ends[2] = {source, target};
+    for (size_t k = 0; k < 2; k++) {
+        side[k].heap.size = 0;
+        search_touch(&side[k], ends[k], stamp);
+        side[k].dist[ends[k]] = 0.0;
+        imh_push_or_decrease(&side[k].heap, ends[k]);
+    }
+    double best = GRAPH_INFINITY;
+    if (source == target) {
+        best = 0.0;
+        ch->meet = source;
+    }
+
+    while (1) {
+        double top0 = (side[0].heap.size > 0) ? side[0].dist[side[0].heap.heap[0]] : GRAPH_INFINITY;
+        double top1 = (side[1].heap.size > 0) ? side[1].dist[side[1].heap.heap[0]] : GRAPH_INFINITY;
+        size_t k = (top0 <= top1) ? 0 : 1;
+        if ((k == 0 ? top0 : top1) >= best) break;
+
+        SearchSide *s = &side[k];
+        const SearchSide *other = &side[1 - k];
+        Vertex u = imh_pop(&s->heap);
+        ch->settled++;
+
+        const size_t *offsets = (k == 0) ? ch->up_offsets : ch->down_offsets;
+        const CHArc *arcs = (k == 0) ? ch->up : ch->down;
+        for (size_t i = offsets[u]; i < offsets[u + 1]; i++) {
+            Vertex v = arcs[i].other;
+            double d = s->dist[u] + arcs[i].weight;
+            search_touch(s, v, stamp);
+            if (d >= s->dist[v]) continue;
+            s->dist[v] = d;
+            s->parent[v] = u;
+            imh_push_or_decrease(&s->heap, v);
+            if (other->seen[v] == stamp && d + other->dist[v] < best) {
+                best = d + other->dist[v];
+                ch->meet = v;
+            }
+        }
+    }
+    return best;
+}
+
+static const CHArc* ch_find_arc(const size_t *offsets, const CHArc *arcs, Vertex v, Vertex other) {
+    for (size_t i = offsets[v]; i < offsets[v + 1]; i++) {
+        if (arcs[i].other == other) return &arcs[i];
+    }
+    return NULL;
+}
+
+/**
+ * Expande o arco u -> x, emitindo os vertices depois de u ate x. Os dois
+ * arcos de um atalho com meio m estao em down[m] (u -> m) e up[m] (m -> x).
+ */
+static void ch_unpack(const ContractionHierarchy *ch, Vertex u, Vertex x, Vertex middle,
+                      Vertex *path, size_t *count) {
+    if (middle == GRAPH_NO_PARENT) {
+        if (path != NULL) path[*count] = x;
+        (*count)++;
+        return;
+    }
+    const CHArc *first = ch_find_arc(ch->down_offsets, ch->down, middle, u);
+    const CHArc *second = ch_find_arc(ch->up_offsets, ch->up, middle, x);
+    ch_unpack(ch, u, middle, first->middle, path, count);
+    ch_unpack(ch, middle, x, second->middle, path, count);
+}
+
+// source ... v pela arvore do lado para cima (profundidade = arcos da hierarquia)
+static void ch_unpack_upward(const ContractionHierarchy *ch, Vertex v, Vertex *path, size_t *count) {
+    if (v == ch->source) {
+        if (path != NULL) path[*count] = v;
+        (*count)++;
+        return;
+    }
+    Vertex p = ch->side[0].parent[v];
+    ch_unpack_upward(ch, p, path, count);
+    ch_unpack(ch, p, v, ch_find_arc(ch->up_offsets, ch->up, p, v)->middle, path, count);
+}
+
+static size_t ch_unpack_path(const ContractionHierarchy *ch, Vertex *path) {
+    size_t count = 0;
+    ch_unpack_upward(ch, ch->meet, path, &count);
+    for (Vertex v = ch->meet; ch->side[1].parent[v] != GRAPH_NO_PARENT; v = ch->side[1].parent[v]) {
+        Vertex q = ch->side[1].parent[v];
+        ch_unpack(ch, v, q, ch_find_arc(ch->down_offsets, ch->down, q, v)->middle, path, &count);
+    }
+    return count;
+}
+
+size_t contraction_hierarchy_path(const ContractionHierarchy *ch, Vertex *path, size_t capacity) {
+    if (ch == NULL || ch->meet == GRAPH_NO_PARENT) return 0;
+    size_t count = ch_unpack_path(ch, NULL);
+    if (path != NULL && capacity >= count) ch_unpack_path(ch, path);
+    return count;
+}
+
+size_t contraction_hierarchy_num_shortcuts(const ContractionHierarchy *ch) {
+    return (ch != NULL) ? ch->num_shortcuts : 0;
+}
+
+size_t contraction_hierarchy_settled(const ContractionHierarchy *ch) {
+    return (ch != NULL) ? ch->settled : 0;
+}
+
+// ============================================================================
+// CONSTRUCAO EM LOTE A PARTIR DE LISTA DE ARESTAS
+// ============================================================================
+
+/** Abaixo disso a soma de prefixos dos graus e serial */
+#define BUILD_SCAN_MIN_BLOCK 4096
+
+typedef struct {
+    Vertex dest;
+    double weight;
+} BuildArc;
+
+// Reserva uma posicao no contador; atomico so com mais de uma thread
+// (lock xadd serializa as faltas de cache e triplica o espalhamento serial)
+static inline size_t build_reserve(size_t *counter, bool shared) {
+    if (shared) return __atomic_fetch_add(counter, 1, __ATOMIC_RELAXED);
+    return (*counter)++;
+}
+
+static int compare_build_arc(const void *a, const void *b) {
+    const BuildArc *x = (const BuildArc *)a;
+    const BuildArc *y = (const BuildArc *)b;
+    if (x->dest != y->dest) return (x->dest < y->dest) ? -1 : 1;
+    return (x->weight > y->weight) - (x->weight < y->weight);
+}
+
+typedef struct {
+    size_t *a;
+    size_t n, chunk;
+    size_t *base;
+} PrefixSumJob;
+
+static void prefix_block_scan(void *ctx, size_t b0, size_t b1) {
+    const PrefixSumJob *job = ctx;
+    for (size_t b = b0; b < b1; b++) {
+        size_t lo = b * job->chunk, hi = (lo + job->chunk < job->n) ? lo + job->chunk : job->n;
+        for (size_t i = lo + 1; i < hi; i++) job->a[i] += job->a[i - 1];
+        job->base[b] = (lo < hi) ? job->a[hi - 1] : 0;
+    }
+}
+
+static void prefix_block_add(void *ctx, size_t b0, size_t b1) {
+    const PrefixSumJob *job = ctx;
+    for (size_t b = b0; b < b1; b++) {
+        size_t lo = b * job->chunk, hi = (lo + job->chunk < job->n) ? lo + job->chunk : job->n;
+        for (size_t i = lo; i < hi; i++) job->a[i] += job->base[b];
+    }
+}
+
+// Soma de prefixos inclusiva de a[0..n): somas por bloco, prefixo serial
+// das somas e depois cada bloco soma sua base
+static bool build_prefix_sum(size_t *a, size_t n, size_t threads) {
+    size_t blocks = threads;
+    if (blocks > n / BUILD_SCAN_MIN_BLOCK) blocks = n / BUILD_SCAN_MIN_BLOCK;
+    if (blocks <= 1) {
+        for (size_t i = 1; i < n; i++) a[i] += a[i - 1];
+        return true;
+    }
+
+    PrefixSumJob job = { a, n, (n + blocks - 1) / blocks, NULL };
+    job.base = (size_t *)malloc(blocks * sizeof(size_t));
+    if (job.base == NULL) return false;
+    ds_parallel_for_threads(threads, 0, blocks, 1, prefix_block_scan, &job);
+    size_t carry = 0;
+    for (size_t b = 0; b < blocks; b++) {
+        size_t sum = job.base[b];
+        job.base[b] = carry;
+        carry += sum;
+    }
+    ds_parallel_for_threads(threads, 1, blocks, 1, prefix_block_add, &job);
+    free(job.base);
+    return true;
+}
+
+typedef struct {
+    const Edge *edges;
+    size_t n;
+    bool undirected, dedup, drop_self_loops;
+    bool shared;             // contadores atomicos (mais de uma thread)
+    size_t *offsets;
+    size_t *cursor;
+    BuildArc *staged;
+    size_t *final_offsets;
+    Vertex *dest;
+    double *weight;
+    size_t invalid;
+    size_t loops;
+} GraphBuildJob;
+
+static void build_check_range(void *ctx, size_t lo, size_t hi) {
+    GraphBuildJob *job = ctx;
+    size_t invalid = 0;
+    for (size_t i = lo; i < hi; i++) {
+        if (job->edges[i].src >= job->n || job->edges[i].dest >= job->n) invalid++;
+    }
+    if (invalid > 0) __atomic_fetch_add(&job->invalid, invalid, __ATOMIC_RELAXED);
+}
+
+static void build_count_range(void *ctx, size_t lo, size_t hi) {
+    const GraphBuildJob *job = ctx;
+    for (size_t i = lo; i < hi; i++) {
+        Vertex u = job->edges[i].src, v = job->edges[i].dest;
+        if (u == v && job->drop_self_loops) continue;
+        build_reserve(&job->offsets[u + 1], job->shared);
+        if (job->undirected && u != v) build_reserve(&job->offsets[v + 1], job->shared);
+    }
+}
+
+static void build_scatter_range(void *ctx, size_t lo, size_t hi) {
+    const GraphBuildJob *job = ctx;
+    for (size_t i = lo; i < hi; i++) {
+        Vertex u = job->edges[i].src, v = job->edges[i].dest;
+        if (u == v && job->drop_self_loops) continue;
+        size_t slot = build_reserve(&job->cursor[u], job->shared);
+        job->staged[slot].dest = v;
+        job->staged[slot].weight = job->edges[i].weight;
+        if (job->undirected && u != v) {
+            slot = build_reserve(&job->cursor[v], job->shared);
+            job->staged[slot].dest = u;
+            job->staged[slot].weight = job->edges[i].weight;
+        }
+    }
+}
+
+// Ordena cada linha; com dedup compacta no lugar (o primeiro de cada
+// destino e o de menor peso). cursor[u] passa a ser o grau final.
+static void build_sort_rows(void *ctx, size_t lo, size_t hi) {
+    GraphBuildJob *job = ctx;
+    size_t loops = 0;
+    for (Vertex u = lo; u < hi; u++) {
+        BuildArc *row = job->staged + job->offsets[u];
+        size_t deg = job->offsets[u + 1] - job->offsets[u];
+        ds_pdqsort(row, deg, sizeof(BuildArc), compare_build_arc);
+        if (job->dedup && deg > 1) {
+            size_t w = 1;
+            for (size_t i = 1; i < deg; i++) {
+                if (row[i].dest != row[w - 1].dest) row[w++] = row[i];
+            }
+            deg = w;
+        }
+        job->cursor[u] = deg;
+        for (size_t i = 0; i < deg; i++) loops += (row[i].dest == u);
+    }
+    if (loops > 0) __atomic_fetch_add(&job->loops, loops, __ATOMIC_RELAXED);
+}
+
+static void build_copy_rows(void *ctx, size_t lo, size_t hi) {
+    const GraphBuildJob *job = ctx;
+    for (size_t u = lo; u < hi; u++) {
+        const BuildArc *row = job->staged + job->offsets[u];
+        size_t out = job->final_offsets[u];
+        for (size_t i = 0; i < job->cursor[u]; i++) {
+            job->dest[out + i] = row[i].dest;
+            job->weight[out + i] = row[i].weight;
+        }
+    }
+}
+
+CSRGraph* graph_build_from_edges(const Edge *edges, size_t m, size_t num_vertices,
+                                 GraphType type, bool dedup, bool drop_self_loops,
+                                 size_t num_threads) {
+    if (edges == NULL && m > 0) return NULL;
+    size_t n = num_vertices;
+    bool undirected = (type == GRAPH_UNDIRECTED);
+
+    size_t threads = ds_resolve_threads(num_threads);
+    GraphBuildJob job = { .edges = edges, .n = n, .undirected = undirected, .dedup = dedup,
+                          .drop_self_loops = drop_self_loops,
+                          .shared = ds_parallel_enabled(threads) };
+
+    ds_parallel_for_threads(threads, 0, m, 0, build_check_range, &job);
+    if (job.invalid > 0) return NULL;
+
+    // offsets[u + 1] = grau de u; o prefixo transforma em inicio das linhas
+    size_t *offsets = (size_t *)calloc(n + 1, sizeof(size_t));
+    size_t *cursor = (size_t *)malloc((n > 0 ? n : 1) * sizeof(size_t));
+    if (offsets == NULL || cursor == NULL) {
+        free(offsets);
+        free(cursor);
+        return NULL;
+    }
+    job.offsets = offsets;
+    job.cursor = cursor;
+    ds_parallel_for_threads(threads, 0, m, 0, build_count_range, &job);
+    size_t arcs = 0;
+    BuildArc *staged = NULL;
+    if (build_prefix_sum(offsets + 1, n, threads)) {
+        arcs = offsets[n];
+        staged = (BuildArc *)malloc((arcs > 0 ? arcs : 1) * sizeof(BuildArc));
+    }
+    if (staged == NULL) {
+        free(offsets);
+        free(cursor);
+        return NULL;
+    }
+
+    memcpy(cursor, offsets, n * sizeof(size_t));
+    job.staged = staged;
+    ds_parallel_for_threads(threads, 0, m, 0, build_scatter_range, &job);
+
+    ds_parallel_for_threads(threads, 0, n, 256, build_sort_rows, &job);
+    size_t loops = job.loops;
+
+    size_t *final_offsets = offsets;
+    if (dedup) {
+        final_offsets = (size_t *)malloc((n + 1) * sizeof(size_t));
+        if (final_offsets != NULL) {
+            final_offsets[0] = 0;
+            memcpy(final_offsets + 1, cursor, n * sizeof(size_t));
+            if (!build_prefix_sum(final_offsets + 1, n, threads)) {
+                free(final_offsets);
+                final_offsets = NULL;
+            }
+        }
+    }
+    size_t final_arcs = (final_offsets != NULL) ? final_offsets[n] : 0;
+    Vertex *dest = (Vertex *)malloc((final_arcs > 0 ? final_arcs : 1) * sizeof(Vertex));
+    double *weight = (double *)malloc((final_arcs > 0 ? final_arcs : 1) * sizeof(double));
+    if (final_offsets == NULL || dest == NULL || weight == NULL) {
+        if (final_offsets != offsets) free(final_offsets);
+        free(offsets);
+        free(cursor);
+        free(staged);
+        free(dest);
+        free(weight);
+        return NULL;
+    }
+
+    job.final_offsets = final_offsets;
+    job.dest = dest;
+    job.weight = weight;
+    ds_parallel_for_threads(threads, 0, n, 256, build_copy_rows, &job);
+    free(staged);
+    free(cursor);
+    if (final_offsets != offsets) free(offsets);
+
+    // Mesma contagem de graph_num_edges: auto-laco ocupa uma entrada so
+    size_t num_edges = undirected ? (final_arcs - loops) / 2 + loops : final_arcs;
+    CSRGraph *csr = graph_csr_from_arrays(n, num_edges, type, final_offsets, dest, weight);
+    if (csr == NULL) {
+        free(final_offsets);
+        free(dest);
+        free(weight);
+    }
+    return csr;
+}
+
+// ============================================================================
+// PAGERANK E SpMV (Page et al., 1999)
+// ============================================================================
+
+/** Vertices por bloco dos lacos do PageRank (uma soma parcial por bloco) */
+#define PR_BLOCK 1024
+
+// Predecessores de v: transposta em digrafos, a propria CSR nos demais
+typedef struct {
+    const CSRGraph *csr;
+    size_t *in_offsets;
+    Vertex *in_sources;
+    size_t threads;
+    double *partial;        // uma soma por bloco de PR_BLOCK vertices
+} PRWork;
+
+static inline void pr_in_neighbors(const PRWork *w, Vertex v, const Vertex **sources, size_t *deg) {
+    if (w->in_offsets == NULL) {
+        graph_csr_neighbors(w->csr, v, sources, NULL, deg);
+        return;
+    }
+    *sources = w->in_sources + w->in_offsets[v];
+    *deg = w->in_offsets[v + 1] - w->in_offsets[v];
+}
+
+static double pr_sum_partials(const PRWork *w, size_t blocks) {
+    double sum = 0.0;
+    for (size_t b = 0; b < blocks; b++) sum += w->partial[b];
+    return sum;
+}
+
+/**
+ * Kernels por tipo do vetor: SpMV por linha e uma iteracao do PageRank
+ * (contribuicoes + pull). Somas de cada vertice acumulam em T; dangling e
+ * residuo (somas por bloco, reduzidas em ordem fixa) sempre em double.
+ */
+#define PR_DEFINE_KERNELS(SUF, T) \
+typedef struct { \
+    const CSRGraph *csr; \
+    const T *x; \
+    T *y; \
+} SpMVJob_##SUF; \
+static void spmv_range_##SUF(void *ctx, size_t lo, size_t hi) { \
+    const SpMVJob_##SUF *job = ctx; \
+    for (size_t u = lo; u < hi; u++) { \
+        const Vertex *dests; \
+        const double *weights; \
+        size_t deg; \
+        graph_csr_neighbors(job->csr, (Vertex)u, &dests, &weights, &deg); \
+        T sum = 0; \
+        for (size_t i = 0; i < deg; i++) sum += (T)weights[i] * job->x[dests[i]]; \
+        job->y[u] = sum; \
+    } \
+} \
+static void spmv_rows_##SUF(const CSRGraph *csr, const T *x, T *y, size_t threads) { \
+    SpMVJob_##SUF job = { csr, x, y }; \
+    ds_parallel_for_threads(threads, 0, graph_csr_num_vertices(csr), 1024, spmv_range_##SUF, &job); \
+} \
+typedef struct { \
+    const PRWork *w; \
+    size_t n; \
+    const T *rank; \
+    T *next; \
+    T *contrib; \
+    T base, d; \
+} PRStep_##SUF; \
+static void pr_contrib_blocks_##SUF(void *ctx, size_t b0, size_t b1) { \
+    const PRStep_##SUF *st = ctx; \
+    for (size_t b = b0; b < b1; b++) { \
+        size_t hi = (b + 1) * PR_BLOCK < st->n ? (b + 1) * PR_BLOCK : st->n; \
+        double dangling = 0.0; \
+        for (size_t u = b * PR_BLOCK; u < hi; u++) { \
+            size_t deg = graph_csr_out_degree(st->w->csr, (Vertex)u); \
+            if (deg == 0) dangling += (double)st->rank[u]; \
+            st->contrib[u] = (deg == 0) ? (T)0 : st->rank[u] / (T)deg; \
+        } \
+        st->w->partial[b] = dangling; \
+    } \
+} \
+static void pr_pull_blocks_##SUF(void *ctx, size_t b0, size_t b1) { \
+    const PRStep_##SUF *st = ctx; \
+    for (size_t b = b0; b < b1; b++) { \
+        size_t hi = (b + 1) * PR_BLOCK < st->n ? (b + 1) * PR_BLOCK : st->n; \
+        double residual = 0.0; \
+        for (size_t v = b * PR_BLOCK; v < hi; v++) { \
+            const Vertex *sources; \
+            size_t deg; \
+            pr_in_neighbors(st->w, (Vertex)v, &sources, &deg); \
+            T sum = 0; \
+            for (size_t i = 0; i < deg; i++) sum += st->contrib[sources[i]]; \
+            st->next[v] = st->base + st->d * sum; \
+            residual += fabs((double)st->next[v] - (double)st->rank[v]); \
+        } \
+        st->w->partial[b] = residual; \
+    } \
+} \
+static double pagerank_step_##SUF(const PRWork *w, const T *rank, T *next, T *contrib, \
+                                  double damping) { \
+    size_t n = graph_csr_num_vertices(w->csr); \
+    size_t blocks = (n + PR_BLOCK - 1) / PR_BLOCK; \
+    PRStep_##SUF st = { w, n, rank, next, contrib, 0, (T)damping }; \
+    ds_parallel_for_threads(w->threads, 0, blocks, 1, pr_contrib_blocks_##SUF, &st); \
+    double dangling = pr_sum_partials(w, blocks); \
+    st.base = (T)((1.0 - damping) / (double)n + damping * dangling / (double)n); \
+    ds_parallel_for_threads(w->threads, 0, blocks, 1, pr_pull_blocks_##SUF, &st); \
+    return pr_sum_partials(w, blocks); \
+}
+
+PR_DEFINE_KERNELS(double, double)
+PR_DEFINE_KERNELS(float, float)
+
+bool spmv_csr(const CSRGraph *csr, const double *x, double *y, size_t num_threads) {
+    if (csr == NULL || x == NULL || y == NULL) return false;
+    spmv_rows_double(csr, x, y, ds_resolve_threads(num_threads));
+    return true;
+}
+
+bool spmv_csr_f(const CSRGraph *csr, const float *x, float *y, size_t num_threads) {
+    if (csr == NULL || x == NULL || y == NULL) return false;
+    spmv_rows_float(csr, x, y, ds_resolve_threads(num_threads));
+    return true;
+}
+
+void pagerank_free(PageRankResult *result) {
+    if (result == NULL) return;
+    free(result->rank);
+    free(result->rank_f);
+    free(result);
+}
+
+PageRankResult* pagerank_csr(const CSRGraph *csr, double damping, double tolerance,
+                             size_t max_iterations, APSPPrecision precision,
+                             size_t num_threads) {
+    if (csr == NULL || !(damping >= 0.0 && damping <= 1.0) || !(tolerance >= 0.0)) return NULL;
+    size_t n = graph_csr_num_vertices(csr);
+    if (n == 0) return NULL;
+
+    PRWork w = { csr, NULL, NULL, ds_resolve_threads(num_threads), NULL };
+    if (graph_csr_is_directed(csr) && !csr_transpose(csr, &w.in_offsets, &w.in_sources)) return NULL;
+
+    bool single = (precision == APSP_FLOAT);
+    size_t elem = single ? sizeof(float) : sizeof(double);
+    PageRankResult *result = (PageRankResult *)calloc(1, sizeof(PageRankResult));
+    void *rank = malloc(n * elem);
+    void *next = malloc(n * elem);
+    void *contrib = malloc(n * elem);
+    w.partial = (double *)malloc((n + PR_BLOCK - 1) / PR_BLOCK * sizeof(double));
+    if (result == NULL || rank == NULL || next == NULL || contrib == NULL || w.partial == NULL) {
+        free(result);
+        free(rank);
+        free(next);
+        free(contrib);
+        free(w.partial);
+        free(w.in_offsets);
+        free(w.in_sources);
+        return NULL;
+    }
+
+    for (size_t v = 0; v < n; v++) {
+        if (single) ((float *)rank)[v] = 1.0f / (float)n;
+        else ((double *)rank)[v] = 1.0 / (double)n;
+    }
+    result->num_vertices = n;
+    while (result->iterations < max_iterations) {
+        result->residual = single
+            ? pagerank_step_float(&w, (const float *)rank, (float *)next, (float *)contrib, damping)
+            : pagerank_step_double(&w, (const double *)rank, (double *)next, (double *)contrib, damping);
+        result->iterations++;
+        void *tmp = rank;
+        rank = next;
+        next = tmp;
+        if (result->residual < tolerance) {
+            result->converged = true;
+            break;
+        }
+    }
+
+    if (single) result->rank_f = (float *)rank;
+    else result->rank = (double *)rank;
+    free(next);
+    free(contrib);
+    free(w.partial);
+    free(w.in_offsets);
+    free(w.in_sources);
+    return result;
+}
@@ -12,6 +12,8 @@
 
 #include "algorithms/greedy.h"
 
+#include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -247,6 +249,270 @@ void huffman_result_destroy(HuffmanResult *result) {
     }
 }
 
+// ============================================================================
+// HUFFMAN CANONICO - van Leeuwen (1976); JPEG Annex K.3; DEFLATE (RFC 1951)
+// ============================================================================
+
+struct HuffmanCodec {
+    uint8_t lengths[256];
+    uint16_t codes[256];                     // codigos canonicos com bits invertidos (LSB-first)
+    uint16_t table[1u << HUFFMAN_LOOKUP_BITS]; // (simbolo << 4) | comprimento; 0 = longo/invalido
+    uint8_t max_length;
+    uint32_t first[HUFFMAN_MAX_CODE_LENGTH + 1];  // primeiro codigo canonico de cada comprimento
+    uint16_t count[HUFFMAN_MAX_CODE_LENGTH + 1];
+    uint16_t offset[HUFFMAN_MAX_CODE_LENGTH + 1]; // inicio de cada comprimento em sorted
+    uint8_t sorted[256];                     // simbolos por (comprimento, simbolo)
+};
+
+bool huffman_lengths_sorted(const uint64_t *freqs, size_t n, uint32_t *lengths) {
+    if (freqs == NULL || lengths == NULL || n == 0) return false;
+    for (size_t i = 1; i < n; i++) {
+        if (freqs[i] < freqs[i - 1]) return false;
+    }
+    if (n == 1) {
+        lengths[0] = 1;
+        return true;
+    }
+
+    // Nos internos 0..n-2 em ordem de criacao: pesos nao decrescentes
+    uint64_t *weight = malloc((n - 1) * sizeof(uint64_t));
+    size_t *parent = malloc((2 * n - 1) * sizeof(size_t));  // folhas, depois internos
+    if (weight == NULL || parent == NULL) {
+        free(weight);
+        free(parent);
+        return false;
+    }
+    size_t leaf = 0, front = 0;
+    for (size_t node = 0; node < n - 1; node++) {
+        uint64_t w = 0;
+        for (int k = 0; k < 2; k++) {
+            if (leaf < n && (front == node || freqs[leaf] <= weight[front])) {
+                w += freqs[leaf];
+                parent[leaf++] = node;
+            } else {
+                w += weight[front];
+                parent[n + front++] = node;
+            }
+        }
+        weight[node] = w;
+    }
+
+    // Profundidades de cima para baixo (o pai e criado depois do filho)
+    uint64_t *depth = weight;
+    depth[n - 2] = 0;
+    for (size_t node = n - 2; node-- > 0;) depth[node] = depth[parent[n + node]] + 1;
+    for (size_t i = 0; i < n; i++) lengths[i] = (uint32_t)depth[parent[i]] + 1;
+    free(weight);
+    free(parent);
+    return true;
+}
+
+static uint16_t huffman_reverse_bits(uint32_t code, unsigned length) {
+    uint32_t r = 0;
+    for (unsigned i = 0; i < length; i++) {
+        r = (r << 1) | (code & 1u);
+        code >>= 1;
+    }
+    return (uint16_t)r;
+}
+
+HuffmanCodec *huffman_codec_from_lengths(const uint8_t lengths[256]) {
+    if (lengths == NULL) return NULL;
+    uint32_t count[HUFFMAN_MAX_CODE_LENGTH + 1] = { 0 };
+    for (int s = 0; s < 256; s++) {
+        if (lengths[s] > HUFFMAN_MAX_CODE_LENGTH) return NULL;
+        count[lengths[s]]++;
+    }
+    count[0] = 0;
+
+    // Kraft: sum 2^-len <= 1 (codigos incompletos ficam com prefixos invalidos)
+    uint32_t kraft = 0, used = 0;
+    for (unsigned len = 1; len <= HUFFMAN_MAX_CODE_LENGTH; len++) {
+        kraft += count[len] << (HUFFMAN_MAX_CODE_LENGTH - len);
+        used += count[len];
+    }
+    if (used == 0 || kraft > (1u << HUFFMAN_MAX_CODE_LENGTH)) return NULL;
+
+    HuffmanCodec *codec = calloc(1, sizeof(HuffmanCodec));
+    if (codec == NULL) return NULL;
+    memcpy(codec->lengths, lengths, 256);
+
+    uint32_t code = 0, next[HUFFMAN_MAX_CODE_LENGTH + 1];
+    uint16_t offset = 0;
+    for (unsigned len = 1; len <= HUFFMAN_MAX_CODE_LENGTH; len++) {
+        code = (code + count[len - 1]) << 1;
+        next[len] = code;
+        codec->first[len] = code;
+        codec->count[len] = (uint16_t)count[len];
+        codec->offset[len] = offset;
+        offset = (uint16_t)(offset + count[len]);
+        if (count[len] != 0) codec->max_length = (uint8_t)len;
+    }
+    for (int s = 0; s < 256; s++) {
+        unsigned len = lengths[s];
+        if (len == 0) continue;
+        uint32_t c = next[len]++;
+        codec->sorted[codec->offset[len] + (c - codec->first[len])] = (uint8_t)s;
+        codec->codes[s] = huffman_reverse_bits(c, len);
+        if (len <= HUFFMAN_LOOKUP_BITS) {
+            uint16_t entry = (uint16_t)((s << 4) | len);
+            for (uint32_t r = codec->codes[s]; r < (1u << HUFFMAN_LOOKUP_BITS); r += 1u << len) {
+                codec->table[r] = entry;
+            }
+        }
+    }
+    return codec;
+}
+
+typedef struct {
+    uint64_t freq;
+    int symbol;
+} HuffmanSymbol;
+
+static int compare_huffman_symbols(const void *a, const void *b) {
+    const HuffmanSymbol *x = a, *y = b;
+    if (x->freq != y->freq) return (x->freq < y->freq) ? -1 : 1;
+    return x->symbol - y->symbol;
+}
+
+HuffmanCodec *huffman_codec_create(const uint64_t freqs[256]) {
+    if (freqs == NULL) return NULL;
+    HuffmanSymbol symbols[256];
+    size_t k = 0;
+    for (int s = 0; s < 256; s++) {
+        if (freqs[s] > 0) symbols[k++] = (HuffmanSymbol){ freqs[s], s };
+    }
+    if (k == 0) return NULL;
+    qsort(symbols, k, sizeof(HuffmanSymbol), compare_huffman_symbols);
+
+    uint64_t sorted[256];
+    uint32_t depth[256];
+    for (size_t i = 0; i < k; i++) sorted[i] = symbols[i].freq;
+    if (!huffman_lengths_sorted(sorted, k, depth)) return NULL;
+
+    // Quantos codigos de cada comprimento; arvore de Huffman tem altura < k
+    uint32_t bits[257] = { 0 };
+    unsigned max_len = 0;
+    for (size_t i = 0; i < k; i++) {
+        bits[depth[i]]++;
+        if (depth[i] > max_len) max_len = depth[i];
+    }
+
+    // JPEG Annex K.3: sobe pares de folhas profundas mantendo a arvore completa
+    for (unsigned i = max_len; i > HUFFMAN_MAX_CODE_LENGTH; i--) {
+        while (bits[i] > 0) {
+            unsigned j = i - 2;
+            while (bits[j] == 0) j--;
+            bits[i] -= 2;
+            bits[i - 1] += 1;
+            bits[j + 1] += 2;
+            bits[j] -= 1;
+        }
+    }
+
+    // Os mais frequentes (fim de symbols) recebem os codigos mais curtos
+    uint8_t lengths[256] = { 0 };
+    size_t next = k;
+    for (unsigned len = 1; len <= HUFFMAN_MAX_CODE_LENGTH; len++) {
+        for (uint32_t c = 0; c < bits[len]; c++) lengths[symbols[--next].symbol] = (uint8_t)len;
+    }
+    return huffman_codec_from_lengths(lengths);
+}
+
+const uint8_t *huffman_codec_lengths(const HuffmanCodec *codec) {
+    return (codec != NULL) ? codec->lengths : NULL;
+}
+
+void huffman_codec_destroy(HuffmanCodec *codec) {
+    free(codec);
+}
+
+size_t huffman_encoded_size(const HuffmanCodec *codec, const unsigned char *in, size_t n) {
+    if (codec == NULL || (in == NULL && n > 0)) return SIZE_MAX;
+    uint64_t bits = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (codec->lengths[in[i]] == 0) return SIZE_MAX;
+        bits += codec->lengths[in[i]];
+    }
+    return (size_t)((bits + 7) / 8);
+}
+
+size_t huffman_encode(const HuffmanCodec *codec, const unsigned char *in, size_t n,
+                      unsigned char *out, size_t out_capacity) {
+    if (codec == NULL || in == NULL || out == NULL) return 0;
+    uint64_t buffer = 0;
+    unsigned bits = 0;
+    size_t pos = 0;
+    for (size_t i = 0; i < n; i++) {
+        unsigned len = codec->lengths[in[i]];
+        if (len == 0) return 0;
+        buffer |= (uint64_t)codec->codes[in[i]] << bits;
+        bits += len;
+        if (bits >= 32) {
+            if (out_capacity - pos < 4) return 0;
+            out[pos] = (unsigned char)buffer;
+            out[pos + 1] = (unsigned char)(buffer >> 8);
+            out[pos + 2] = (unsigned char)(buffer >> 16);
+            out[pos + 3] = (unsigned char)(buffer >> 24);
+            pos += 4;
+            buffer >>= 32;
+            bits -= 32;
+        }
+    }
+    while (bits > 0) {
+        if (pos == out_capacity) return 0;
+        out[pos++] = (unsigned char)buffer;
+        buffer >>= 8;
+        bits = (bits > 8) ? bits - 8 : 0;
+    }
+    return pos;
+}
+
+bool huffman_decode(const HuffmanCodec *codec, const unsigned char *in, size_t in_size,
+                    unsigned char *out, size_t n) {
+    if (codec == NULL || (out == NULL && n > 0) || (in == NULL && in_size > 0)) return false;
+    const uint64_t mask = (1u << HUFFMAN_LOOKUP_BITS) - 1;
+    uint64_t buffer = 0;
+    unsigned bits = 0;
+    size_t pos = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (bits < HUFFMAN_MAX_CODE_LENGTH) {
+            if (in_size - pos >= 8) {
+                // Recarga sem laco (Giesen): le 8 bytes, consome os que cabem
+                uint64_t word = 0;
+                for (unsigned k = 0; k < 8; k++) word |= (uint64_t)in[pos + k] << (8 * k);
+                buffer |= word << bits;
+                pos += (63 - bits) >> 3;
+                bits |= 56;
+            } else {
+                while (bits <= 56 && pos < in_size) {
+                    buffer |= (uint64_t)in[pos++] << bits;
+                    bits += 8;
+                }
+            }
+        }
+        unsigned entry = codec->table[buffer & mask], len, symbol;
+        if (entry != 0) {
+            len = entry & 15u;
+            symbol = entry >> 4;
+        } else {
+            // Codigo longo (ou invalido): canonico, um bit por vez
+            uint32_t code = 0;
+            for (len = 1; len <= codec->max_length; len++) {
+                code = (code << 1) | (uint32_t)((buffer >> (len - 1)) & 1u);
+                if (code - codec->first[len] < codec->count[len]) break;
+            }
+            if (len > codec->max_length) return false;
+            symbol = codec->sorted[codec->offset[len] + (code - codec->first[len])];
+        }
+        if (len > bits) return false;                    // passou do fim de in
+        out[i] = (unsigned char)symbol;
+        buffer >>= len;
+        bits -= len;
+    }
+    return true;
+}
+
 // ============================================================================
 // FRACTIONAL KNAPSACK - Cormen S16.2
 // ============================================================================
@@ -341,6 +607,208 @@ FractionalKnapsackResult greedy_fractional_knapsack(const double *weights, const
     return result;
 }
 
+// ----------------------------------------------------------------------------
+// Selecao linear (Balas-Zemel) e versao em fluxo
+// ----------------------------------------------------------------------------
+
+/** Itens acumulados alem do dobro da solucao antes de compactar o fluxo */
+#define FRAC_STREAM_COMPACT_MIN 4096
+
+// Copia os itens validos; peso 0 com valor positivo tem razao infinita
+static size_t frac_collect(FracItem *items, const double *weights, const double *values,
+                           size_t n, size_t first_index) {
+    size_t count = 0;
+    for (size_t i = 0; i < n; i++) {
+        double w = weights[i], v = values[i];
+        if (!(v > 0.0) || !(w >= 0.0)) continue;
+        items[count].weight = w;
+        items[count].value = v;
+        items[count].ratio = (w > 0.0) ? v / w : INFINITY;
+        items[count].original_index = first_index + i;
+        count++;
+    }
+    return count;
+}
+
+static void frac_swap(FracItem *a, FracItem *b) {
+    FracItem tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+/*
+ * Rearranja items para que [0, *full) entrem inteiros e, se *fraction > 0,
+ * items[*full] entre com essa fracao; o resto fica fora. Devolve o valor.
+ */
+static double frac_select(FracItem *items, size_t n, double capacity, size_t *full, double *fraction) {
+    size_t lo = 0, hi = n;
+    double remaining = capacity, value = 0.0;
+    uint64_t rng = 0x9E3779B97F4A7C15ull ^ n;
+    *fraction = 0.0;
+
+    while (lo < hi && remaining > 0.0) {
+        rng ^= rng << 13;
+        rng ^= rng >> 7;
+        rng ^= rng << 17;
+        double pivot = items[lo + (size_t)(rng % (hi - lo))].ratio;
+
+        // Tres vias (Dijkstra): [lo, gt) > pivo, [gt, i) == pivo, [lt, hi) < pivo
+        size_t gt = lo, i = lo, lt = hi;
+        while (i < lt) {
+            if (items[i].ratio > pivot) frac_swap(&items[gt++], &items[i++]);
+            else if (items[i].ratio < pivot) frac_swap(&items[i], &items[--lt]);
+            else i++;
+        }
+        double high_weight = 0.0, high_value = 0.0, equal_weight = 0.0, equal_value = 0.0;
+        for (size_t k = lo; k < gt; k++) {
+            high_weight += items[k].weight;
+            high_value += items[k].value;
+        }
+        if (high_weight > remaining) {
+            hi = gt;                                       // o corte esta entre os maiores
+            continue;
+        }
+        for (size_t k = gt; k < lt; k++) {
+            equal_weight += items[k].weight;
+            equal_value += items[k].value;
+        }
+        value += high_value;
+        remaining -= high_weight;
+        if (equal_weight > remaining) {
+            // O corte esta entre os de razao igual: enche na ordem
+            size_t k = gt;
+            while (k < lt && items[k].weight <= remaining) {
+                value += items[k].value;
+                remaining -= items[k].weight;
+                k++;
+            }
+            *full = k;
+            if (k < lt && remaining > 0.0) {
+                *fraction = remaining / items[k].weight;
+                value += items[k].ratio * remaining;
+            }
+            return value;
+        }
+        value += equal_value;
+        remaining -= equal_weight;
+        lo = lt;
+    }
+    *full = lo;
+    return value;
+}
+
+FractionalKnapsackResult greedy_fractional_knapsack_linear(const double *weights, const double *values,
+                                                            size_t n, double capacity) {
+    FractionalKnapsackResult result = { 0.0, NULL, n };
+    if (weights == NULL || values == NULL || n == 0 || capacity <= 0.0) return result;
+
+    FracItem *items = malloc(n * sizeof(FracItem));
+    result.fractions = calloc(n, sizeof(double));
+    if (items == NULL || result.fractions == NULL) {
+        free(items);
+        free(result.fractions);
+        result.fractions = NULL;
+        return result;
+    }
+    size_t count = frac_collect(items, weights, values, n, 0), full;
+    double fraction;
+    result.max_value = frac_select(items, count, capacity, &full, &fraction);
+    for (size_t i = 0; i < full; i++) result.fractions[items[i].original_index] = 1.0;
+    if (fraction > 0.0) result.fractions[items[full].original_index] = fraction;
+    free(items);
+    return result;
+}
+
+double greedy_fractional_knapsack_value_linear(const double *weights, const double *values,
+                                               size_t n, double capacity) {
+    if (weights == NULL || values == NULL || n == 0 || capacity <= 0.0) return 0.0;
+    FracItem *items = malloc(n * sizeof(FracItem));
+    if (items == NULL) return 0.0;
+    size_t count = frac_collect(items, weights, values, n, 0), full;
+    double fraction;
+    double value = frac_select(items, count, capacity, &full, &fraction);
+    free(items);
+    return value;
+}
+
+struct FractionalKnapsackStream {
+    double capacity;
+    FracItem *items;
+    size_t count;
+    size_t allocated;
+    size_t kept;                 // itens apos a ultima compactacao
+    size_t seen;                 // itens recebidos (indices globais)
+    double value;
+    size_t full;
+    double fraction;
+    bool compact;                // items ja esta compactado e value vale
+};
+
+FractionalKnapsackStream *fractional_knapsack_stream_create(double capacity) {
+    if (!(capacity > 0.0)) return NULL;
+    FractionalKnapsackStream *stream = calloc(1, sizeof(FractionalKnapsackStream));
+    if (stream == NULL) return NULL;
+    stream->capacity = capacity;
+    stream->compact = true;
+    return stream;
+}
+
+// Descarta os itens fora da solucao atual
+static void frac_stream_compact(FractionalKnapsackStream *stream) {
+    if (stream->compact) return;
+    stream->value = frac_select(stream->items, stream->count, stream->capacity,
+                                &stream->full, &stream->fraction);
+    stream->count = stream->full + (stream->fraction > 0.0 ? 1 : 0);
+    stream->kept = stream->count;
+    stream->compact = true;
+}
+
+bool fractional_knapsack_stream_add(FractionalKnapsackStream *stream, const double *weights,
+                                    const double *values, size_t count) {
+    if (stream == NULL || (count > 0 && (weights == NULL || values == NULL))) return false;
+    if (stream->count + count > stream->allocated) {
+        size_t cap = stream->allocated ? stream->allocated : 1024;
+        while (cap < stream->count + count) cap *= 2;
+        FracItem *grown = realloc(stream->items, cap * sizeof(FracItem));
+        if (grown == NULL) return false;
+        stream->items = grown;
+        stream->allocated = cap;
+    }
+    size_t added = frac_collect(stream->items + stream->count, weights, values, count, stream->seen);
+    stream->count += added;
+    stream->seen += count;
+    if (added > 0) stream->compact = false;
+    if (stream->count >= 2 * stream->kept + FRAC_STREAM_COMPACT_MIN) frac_stream_compact(stream);
+    return true;
+}
+
+double fractional_knapsack_stream_value(FractionalKnapsackStream *stream) {
+    if (stream == NULL) return 0.0;
+    frac_stream_compact(stream);
+    return stream->value;
+}
+
+FractionalKnapsackResult fractional_knapsack_stream_result(FractionalKnapsackStream *stream) {
+    FractionalKnapsackResult result = { 0.0, NULL, 0 };
+    if (stream == NULL || stream->seen == 0) return result;
+    frac_stream_compact(stream);
+    result.n = stream->seen;
+    result.fractions = calloc(stream->seen, sizeof(double));
+    if (result.fractions == NULL) return result;
+    result.max_value = stream->value;
+    for (size_t i = 0; i < stream->full; i++) result.fractions[stream->items[i].original_index] = 1.0;
+    if (stream->fraction > 0.0) {
+        result.fractions[stream->items[stream->full].original_index] = stream->fraction;
+    }
+    return result;
+}
+
+void fractional_knapsack_stream_destroy(FractionalKnapsackStream *stream) {
+    if (stream == NULL) return;
+    free(stream->items);
+    free(stream);
+}
+
 void fractional_knapsack_result_destroy(FractionalKnapsackResult *result) {
     if (result == NULL) return;
     free(result->fractions);
@@ -0,0 +1,259 @@
+/**
+ * @file learned_index.c
+ * @brief Indice PGM estatico: segmentos lineares com erro limitado, em niveis
+ *
+ * Referencias:
+ * - Ferragina & Vinciguerra (2020). "The PGM-index"
+ * - Galakatos et al. (2019). "FITing-Tree" (shrinking cone)
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "algorithms/learned_index.h"
+#include "algorithms/searching.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef struct {
+    int64_t key;                // primeira chave coberta
+    size_t pos;                 // posicao prevista para key (exata)
+    double slope;               // posicoes por unidade de chave
+} LearnedSegment;
+
+typedef struct {
+    LearnedSegment *segs;
+    size_t count;
+    size_t capacity;
+} SegmentLevel;
+
+struct LearnedIndex {
+    const int *keys;
+    size_t n;
+    size_t epsilon;
+    SegmentLevel *levels;       // levels[0] sobre as chaves; o ultimo tem 1 segmento
+    size_t num_levels;
+    size_t levels_capacity;
+};
+
+// ============================================================================
+// CONSTRUCAO: SHRINKING CONE
+// ============================================================================
+
+typedef struct {
+    SegmentLevel *out;
+    double eps;
+    int64_t x0;
+    size_t y0;
+    double slope_lo;
+    double slope_hi;
+    bool open;
+    bool failed;
+} ConeBuilder;
+
+static void cone_emit(ConeBuilder *b) {
+    if (!b->open || b->failed) return;
+    SegmentLevel *lv = b->out;
+    if (lv->count == lv->capacity) {
+        size_t cap = lv->capacity ? lv->capacity * 2 : 16;
+        LearnedSegment *grown = realloc(lv->segs, cap * sizeof(LearnedSegment));
+        if (grown == NULL) {
+            b->failed = true;
+            return;
+        }
+        lv->segs = grown;
+        lv->capacity = cap;
+    }
+    double slope = (b->slope_hi > 1e300) ? b->slope_lo : 0.5 * (b->slope_lo + b->slope_hi);
+    lv->segs[lv->count++] = (LearnedSegment){b->x0, b->y0, slope};
+}
+
+// Pontos com x estritamente crescente e y nao decrescente
+static void cone_add(ConeBuilder *b, int64_t x, size_t y) {
+    if (b->open) {
+        double dx = (double)(x - b->x0);
+        double dy = (double)y - (double)b->y0;
+        double lo = (dy - b->eps) / dx;
+        double hi = (dy + b->eps) / dx;
+        if (lo < b->slope_lo) lo = b->slope_lo;
+        if (hi > b->slope_hi) hi = b->slope_hi;
+        if (lo <= hi) {
+            b->slope_lo = lo;
+            b->slope_hi = hi;
+            return;
+        }
+        cone_emit(b);
+    }
+    b->x0 = x;
+    b->y0 = y;
+    b->slope_lo = 0.0;
+    b->slope_hi = 1e308;
+    b->open = true;
+}
+
+static bool build_key_level(SegmentLevel *lv, const int *keys, size_t n, size_t epsilon) {
+    ConeBuilder b = {lv, (double)epsilon, 0, 0, 0.0, 0.0, false, false};
+    size_t i = 0;
+    while (i < n) {
+        size_t j = i + 1;
+        while (j < n && keys[j] == keys[i]) j++;
+        if (j < n && keys[j] < keys[i]) return false;       // fora de ordem
+
+        cone_add(&b, keys[i], i);
+        // Fim de uma sequencia de repetidos: chaves em (keys[i], keys[j]) tem lower_bound j
+        if (j < n && j - i > 1 && (int64_t)keys[i] + 1 < (int64_t)keys[j]) {
+            cone_add(&b, (int64_t)keys[i] + 1, j);
+        }
+        i = j;
+    }
+    cone_emit(&b);
+    return !b.failed;
+}
+
+static bool build_upper_level(SegmentLevel *lv, const SegmentLevel *below) {
+    ConeBuilder b = {lv, (double)LEARNED_INDEX_EPSILON_INTERNAL, 0, 0, 0.0, 0.0, false, false};
+    for (size_t j = 0; j < below->count; j++) cone_add(&b, below->segs[j].key, j);
+    cone_emit(&b);
+    return !b.failed;
+}
+
+LearnedIndex *learned_index_build(const int *keys, size_t n, size_t epsilon) {
+    if (keys == NULL && n > 0) return NULL;
+
+    LearnedIndex *index = calloc(1, sizeof(LearnedIndex));
+    if (index == NULL) return NULL;
+    index->keys = keys;
+    index->n = n;
+    index->epsilon = epsilon;
+    if (n == 0) return index;
+
+    index->levels_capacity = 4;
+    index->levels = calloc(index->levels_capacity, sizeof(SegmentLevel));
+    if (index->levels == NULL || !build_key_level(&index->levels[0], keys, n, epsilon)) {
+        learned_index_destroy(index);
+        return NULL;
+    }
+    index->num_levels = 1;
+
+    while (index->levels[index->num_levels - 1].count > 1) {
+        size_t cap = index->levels_capacity;
+        if (index->num_levels == cap) {
+            SegmentLevel *grown = realloc(index->levels, 2 * cap * sizeof(SegmentLevel));
+            if (grown == NULL) {
+                learned_index_destroy(index);
+                return NULL;
+            }
+            for (size_t l = cap; l < 2 * cap; l++) grown[l] = (SegmentLevel){NULL, 0, 0};
+            index->levels = grown;
+            index->levels_capacity = 2 * cap;
+        }
+        SegmentLevel *next = &index->levels[index->num_levels];
+        index->num_levels++;
+        if (!build_upper_level(next, &index->levels[index->num_levels - 2])) {
+            learned_index_destroy(index);
+            return NULL;
+        }
+    }
+    return index;
+}
+
+void learned_index_destroy(LearnedIndex *index) {
+    if (index == NULL) return;
+    if (index->levels != NULL) {
+        for (size_t l = 0; l < index->levels_capacity; l++) free(index->levels[l].segs);
+        free(index->levels);
+    }
+    free(index);
+}
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+
+// Posicao prevista pelo segmento seg para key (key >= sua primeira chave).
+// Limitada pela posicao do segmento seguinte: apos o ultimo ponto do
+// segmento o lower_bound e exatamente essa posicao, e a reta nao extrapola.
+static inline size_t segment_predict(const SegmentLevel *lv, size_t seg, int64_t key, size_t max) {
+    const LearnedSegment *s = &lv->segs[seg];
+    if (seg + 1 < lv->count && lv->segs[seg + 1].pos < max) max = lv->segs[seg + 1].pos;
+    double p = (double)s->pos + s->slope * (double)(key - s->key);
+    if (p <= 0.0) return 0;
+    if (p >= (double)max) return max;
+    return (size_t)(p + 0.5);
+}
+
+// Ultimo segmento j com segs[j].key <= key, procurado na janela de pred
+static size_t segment_find(const SegmentLevel *lv, int64_t key, size_t pred, size_t eps) {
+    size_t lo = (pred > eps + 1) ? pred - eps - 1 : 0;
+    size_t hi = (pred + eps + 1 < lv->count) ? pred + eps + 1 : lv->count - 1;
+
+    // Fora da janela (so acontece por arredondamento): estende ate a borda
+    if (lv->segs[lo].key > key) {
+        hi = lo;
+        lo = 0;
+    } else if (hi + 1 < lv->count && lv->segs[hi + 1].key <= key) {
+        lo = hi + 1;
+        hi = lv->count - 1;
+    }
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo + 1) / 2;
+        if (lv->segs[mid].key <= key) lo = mid;
+        else hi = mid - 1;
+    }
+    return lo;
+}
+
+size_t learned_index_lower_bound(const LearnedIndex *index, int key) {
+    if (index == NULL) return SEARCH_NOT_FOUND;
+    const int *keys = index->keys;
+    size_t n = index->n;
+    if (n == 0 || key <= keys[0]) return 0;
+    if (key > keys[n - 1]) return n;
+
+    // Desce da raiz: keys[0] < key garante um segmento com primeira chave <= key
+    size_t seg = 0;
+    for (size_t l = index->num_levels - 1; l > 0; l--) {
+        const SegmentLevel *below = &index->levels[l - 1];
+        size_t pred = segment_predict(&index->levels[l], seg, key, below->count - 1);
+        seg = segment_find(below, key, pred, LEARNED_INDEX_EPSILON_INTERNAL);
+    }
+
+    size_t pred = segment_predict(&index->levels[0], seg, key, n);
+    size_t eps = index->epsilon + 1;
+    size_t lo = (pred > eps) ? pred - eps : 0;
+    size_t hi = (pred + eps < n) ? pred + eps : n;
+
+    // Resposta em [lo, hi] sse keys[lo-1] < key <= keys[hi]
+    if (lo > 0 && keys[lo - 1] >= key) {
+        hi = lo - 1;
+        lo = 0;
+    } else if (hi < n && keys[hi] < key) {
+        lo = hi + 1;
+        hi = n;
+    }
+    return lo + lower_bound_int(keys + lo, hi - lo, key);
+}
+
+size_t learned_index_find(const LearnedIndex *index, int key) {
+    size_t i = learned_index_lower_bound(index, key);
+    if (i == SEARCH_NOT_FOUND || i >= index->n || index->keys[i] != key) return SEARCH_NOT_FOUND;
+    return i;
+}
+
+size_t learned_index_segments(const LearnedIndex *index) {
+    return (index != NULL && index->num_levels > 0) ? index->levels[0].count : 0;
+}
+
+size_t learned_index_levels(const LearnedIndex *index) {
+    return (index != NULL) ? index->num_levels : 0;
+}
+
+size_t learned_index_memory(const LearnedIndex *index) {
+    if (index == NULL) return 0;
+    size_t bytes = sizeof(LearnedIndex);
+    for (size_t l = 0; l < index->num_levels; l++) {
+        bytes += sizeof(SegmentLevel) + index->levels[l].count * sizeof(LearnedSegment);
+    }
+    return bytes;
+}
@@ -11,10 +11,14 @@
  */
 
 #include "algorithms/numerical.h"
+#include "data_structures/thread_pool.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
+#include <stdatomic.h>
+
 // ============================================================================
 // GCD - Cormen S31.2
 // ============================================================================
@@ -90,23 +94,109 @@ ExtendedGCDResult extended_gcd(long long a, long long b) {
 // FAST EXPONENTIATION - Cormen S31.6
 // ============================================================================
 
+// Produto 64 x 64 -> 128 bits: devolve o limb baixo, *hi recebe o alto
+static inline uint64_t mul_u64_wide(uint64_t a, uint64_t b, uint64_t *hi) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 wide;
+    wide p = (wide)a * b;
+    *hi = (uint64_t)(p >> 64);
+    return (uint64_t)p;
+#else
+    uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+    uint64_t b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+    uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+    *hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return (mid << 32) | (p00 & 0xFFFFFFFFu);
+#endif
+}
+
+// (a * b) mod m sem overflow (a, b < m)
+static uint64_t mul_mod_u64(uint64_t a, uint64_t b, uint64_t m) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 wide;
+    return (uint64_t)(((wide)a * b) % m);
+#else
+    if (m <= 0xFFFFFFFFull) return (a * b) % m;
+    uint64_t r = 0;
+    while (b > 0) {
+        if (b & 1) r = (r >= m - a) ? r - (m - a) : r + a;
+        a = (a >= m - a) ? a - (m - a) : a + a;
+        b >>= 1;
+    }
+    return r;
+#endif
+}
+
+/*
+ * Montgomery em 64 bits para modulo impar n: x <-> x * 2^64 mod n. O
+ * produto vira uma multiplicacao 64x64 -> 128 e uma REDC (duas
+ * multiplicacoes e uma subtracao), sem a divisao de 128 bits de mul_mod_u64.
+ */
+typedef struct {
+    uint64_t n;
+    uint64_t inv;               // n^-1 mod 2^64
+    uint64_t one;               // 2^64 mod n (1 em forma de Montgomery)
+    uint64_t r2;                // 2^128 mod n
+} Mont64;
+
+static void mont64_init(Mont64 *m, uint64_t n) {
+    uint64_t inv = n;                                     // Newton: 3, 6, ..., 96 bits
+    for (int i = 0; i < 5; i++) inv *= 2 - n * inv;
+    m->n = n;
+    m->inv = inv;
+    m->one = (0 - n) % n;
+    m->r2 = mul_mod_u64(m->one, m->one, n);
+}
+
+// a * b * 2^-64 mod n (a, b < n): (T - (T_lo * n^-1 mod 2^64) * n) / 2^64
+static inline uint64_t mont64_mul(const Mont64 *m, uint64_t a, uint64_t b) {
+    uint64_t hi, mh;
+    uint64_t lo = mul_u64_wide(a, b, &hi);
+    mul_u64_wide(lo * m->inv, m->n, &mh);
+    uint64_t r = hi - mh;
+    return (hi < mh) ? r + m->n : r;
+}
+
+static inline uint64_t mont64_to(const Mont64 *m, uint64_t x) {
+    return mont64_mul(m, x % m->n, m->r2);
+}
+
+// base_m^exp com base_m e resultado em forma de Montgomery
+static uint64_t mont64_pow(const Mont64 *m, uint64_t base_m, uint64_t exp) {
+    uint64_t result = m->one;
+    while (exp > 0) {
+        if (exp & 1) result = mont64_mul(m, result, base_m);
+        exp >>= 1;
+        base_m = mont64_mul(m, base_m, base_m);
+    }
+    return result;
+}
+
 long long fast_pow_mod(long long base, long long exp, long long mod) {
     if (mod <= 0) return 0;
     if (mod == 1) return 0;
     if (exp < 0) return 0;
 
-    long long result = 1;
     base = base % mod;
     if (base < 0) base += mod;
 
+    if (mod & 1) {
+        Mont64 m;
+        mont64_init(&m, (uint64_t)mod);
+        uint64_t r = mont64_pow(&m, mont64_to(&m, (uint64_t)base), (uint64_t)exp);
+        return (long long)mont64_mul(&m, r, 1);
+    }
+
+    uint64_t result = 1, b = (uint64_t)base, m = (uint64_t)mod;
     while (exp > 0) {
         if (exp & 1) {
-            result = (result * base) % mod;
+            result = mul_mod_u64(result, b, m);
         }
         exp >>= 1;
-        base = (base * base) % mod;
+        b = mul_mod_u64(b, b, m);
     }
-    return result;
+    return (long long)result;
 }
 
 long long fast_pow(long long base, long long exp) {
@@ -171,17 +261,77 @@ SieveResult sieve_of_eratosthenes(size_t limit) {
     return result;
 }
 
-bool is_prime(long long n) {
-    if (n <= 1) return false;
-    if (n <= 3) return true;
-    if (n % 2 == 0 || n % 3 == 0) return false;
+// ============================================================================
+// MILLER-RABIN DETERMINISTICO - Cormen S31.8
+// ============================================================================
 
-    for (long long i = 5; i * i <= n; i += 6) {
-        if (n % i == 0 || n % (i + 2) == 0) return false;
+static const uint8_t SMALL_PRIMES[] = {
+    2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61
+};
+
+// Bases de Sinclair: testemunhas para todo n < 2^64. Abaixo de 4759123141
+// bastam 2, 7 e 61 (Jaeschke, 1993)
+static const uint64_t MR_BASES[7] = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+static const uint64_t MR_BASES_32[3] = {2, 7, 61};
+
+// n impar, sem fatores pequenos
+static bool miller_rabin_u64(uint64_t n) {
+    Mont64 m;
+    mont64_init(&m, n);
+    uint64_t d = n - 1;
+    int s = 0;
+    while ((d & 1) == 0) { d >>= 1; s++; }
+    uint64_t minus_one = n - m.one;
+    const uint64_t *bases = (n < 4759123141ull) ? MR_BASES_32 : MR_BASES;
+    int num_bases = (n < 4759123141ull) ? 3 : 7;
+
+    for (int k = 0; k < num_bases; k++) {
+        uint64_t a = bases[k] % n;
+        if (a == 0) continue;
+        uint64_t x = mont64_pow(&m, mont64_to(&m, a), d);
+        if (x == m.one || x == minus_one) continue;
+        int r = 1;
+        for (; r < s; r++) {
+            x = mont64_mul(&m, x, x);
+            if (x == minus_one) break;
+        }
+        if (r == s) return false;
     }
     return true;
 }
 
+bool is_prime_u64(uint64_t n) {
+    if (n < 2) return false;
+    for (size_t i = 0; i < sizeof(SMALL_PRIMES); i++) {
+        uint64_t p = SMALL_PRIMES[i];
+        if (n % p == 0) return n == p;
+    }
+    if (n < 67 * 67) return true;
+    return miller_rabin_u64(n);
+}
+
+bool is_prime(long long n) {
+    if (n <= 1) return false;
+    return is_prime_u64((uint64_t)n);
+}
+
+typedef struct {
+    const uint64_t *values;
+    bool *out;
+} PrimeBatchJob;
+
+static void prime_batch_range(void *ctx, size_t lo, size_t hi) {
+    const PrimeBatchJob *job = ctx;
+    for (size_t i = lo; i < hi; i++) job->out[i] = is_prime_u64(job->values[i]);
+}
+
+void is_prime_batch(const uint64_t *values, size_t n, bool *out, size_t num_threads) {
+    if (values == NULL || out == NULL) return;
+    PrimeBatchJob job = { values, out };
+    if (n < 4096) num_threads = 1;
+    ds_parallel_for_threads(num_threads, 0, n, 0, prime_batch_range, &job);
+}
+
 void sieve_result_destroy(SieveResult *result) {
     if (result == NULL) return;
     free(result->is_prime);
@@ -190,3 +340,363 @@ void sieve_result_destroy(SieveResult *result) {
     result->primes = NULL;
     result->count = 0;
 }
+
+// ============================================================================
+// SEGMENTED SIEVE - Bays & Hudson (1977), roda mod 30
+// ============================================================================
+
+static const uint8_t WHEEL_RESIDUE[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+
+// Inverso modulo 30 de cada resto coprimo (indice = resto)
+static const uint8_t WHEEL_INVERSE[30] = {
+    0, 1, 0, 0, 0, 0, 0, 13, 0, 0, 0, 11, 0, 7, 0, 0, 0, 23, 0, 19,
+    0, 0, 0, 17, 0, 0, 0, 0, 0, 29
+};
+
+typedef struct {
+    uint64_t next[8];           // proximo byte a marcar, um por resto do multiplo
+    uint32_t p;
+} SievePrime;
+
+typedef struct {
+    SievePrime *primes;         // primos base >= 7, em ordem crescente
+    size_t num_primes;
+    size_t active;              // primos com p^2 < fim do segmento atual
+    unsigned char *seg;
+    size_t seg_bytes;
+    uint64_t lo, hi;            // intervalo pedido
+    uint64_t byte, end_byte;    // proximo segmento e fim (bytes absolutos)
+} SegmentSieve;
+
+static uint64_t isqrt_u64(uint64_t x) {
+    uint64_t r = (uint64_t)sqrt((double)x);
+    while (r > 0 && r * r > x) r--;
+    while ((r + 1) * (r + 1) <= x) r++;
+    return r;
+}
+
+// Potencia de 2 >= sqrt(hi) / 2, limitada a [L1, L2]
+static size_t sieve_segment_bytes(uint64_t hi) {
+    uint64_t want = isqrt_u64(hi) / 2;
+    size_t bytes = SIEVE_SEGMENT_BYTES;
+    while (bytes < want && bytes < SIEVE_SEGMENT_MAX_BYTES) bytes *= 2;
+    return bytes;
+}
+
+// Primos 7 <= p <= limit por um crivo simples sobre os impares
+static uint32_t *sieve_base_primes(uint64_t limit, size_t *count) {
+    *count = 0;
+    if (limit < 7) return NULL;
+    size_t half = (size_t)(limit / 2) + 1;                // impar i <-> indice i / 2
+    unsigned char *composite = calloc(half, 1);
+    if (composite == NULL) return NULL;
+    for (uint64_t i = 3; i * i <= limit; i += 2) {
+        if (composite[i / 2]) continue;
+        for (uint64_t j = i * i; j <= limit; j += 2 * i) composite[j / 2] = 1;
+    }
+    size_t n = 0;
+    for (uint64_t i = 7; i <= limit; i += 2) n += !composite[i / 2];
+    uint32_t *primes = malloc((n ? n : 1) * sizeof(uint32_t));
+    if (primes != NULL) {
+        for (uint64_t i = 7; i <= limit; i += 2) {
+            if (!composite[i / 2]) primes[(*count)++] = (uint32_t)i;
+        }
+    }
+    free(composite);
+    return primes;
+}
+
+// Prepara o crivo para os bytes [first_byte, end_byte) de [lo, hi)
+static bool segment_sieve_init(SegmentSieve *s, const uint32_t *base, size_t num_base,
+                               uint64_t lo, uint64_t hi, uint64_t first_byte, uint64_t end_byte) {
+    s->seg_bytes = sieve_segment_bytes(hi);
+    s->primes = malloc((num_base ? num_base : 1) * sizeof(SievePrime));
+    s->seg = malloc(s->seg_bytes);
+    if (s->primes == NULL || s->seg == NULL) {
+        free(s->primes);
+        free(s->seg);
+        return false;
+    }
+    s->num_primes = num_base;
+    s->active = 0;
+    s->lo = lo;
+    s->hi = hi;
+    s->byte = first_byte;
+    s->end_byte = end_byte;
+
+    uint64_t start = first_byte * 30;
+    for (size_t k = 0; k < num_base; k++) {
+        uint64_t p = base[k];
+        uint64_t q0 = (start + p - 1) / p;
+        if (q0 < p) q0 = p;
+        SievePrime *sp = &s->primes[k];
+        sp->p = (uint32_t)p;
+        for (int i = 0; i < 8; i++) {
+            // q tal que p*q tenha o resto WHEEL_RESIDUE[i]
+            uint64_t t = (uint64_t)WHEEL_RESIDUE[i] * WHEEL_INVERSE[p % 30] % 30;
+            uint64_t q = q0 + (t + 30 - q0 % 30) % 30;
+            sp->next[i] = p * q / 30;
+        }
+    }
+    return true;
+}
+
+static void segment_sieve_free(SegmentSieve *s) {
+    free(s->primes);
+    free(s->seg);
+}
+
+// Crivo do proximo segmento; *base_byte e *len descrevem seg
+static bool segment_sieve_next(SegmentSieve *s, uint64_t *base_byte, size_t *len) {
+    if (s->byte >= s->end_byte) return false;
+    uint64_t b0 = s->byte;
+    size_t n = (s->end_byte - b0 < s->seg_bytes) ? (size_t)(s->end_byte - b0) : s->seg_bytes;
+    uint64_t b1 = b0 + n;
+    unsigned char *seg = s->seg;
+    memset(seg, 0xFF, n);
+
+    while (s->active < s->num_primes) {
+        uint64_t p = s->primes[s->active].p;
+        if (p * p >= b1 * 30) break;
+        s->active++;
+    }
+    for (size_t k = 0; k < s->active; k++) {
+        SievePrime *sp = &s->primes[k];
+        uint64_t p = sp->p;
+        for (int i = 0; i < 8; i++) {
+            unsigned char mask = (unsigned char)~(1u << i);
+            uint64_t j = sp->next[i];
+            for (; j < b1; j += p) seg[j - b0] &= mask;
+            sp->next[i] = j;
+        }
+    }
+
+    // Bordas: o 1 e os inteiros fora de [lo, hi)
+    if (b0 == 0) seg[0] &= 0xFE;
+    for (int i = 0; i < 8; i++) {
+        if (b0 * 30 + WHEEL_RESIDUE[i] < s->lo) seg[0] &= (unsigned char)~(1u << i);
+        if ((b1 - 1) * 30 + WHEEL_RESIDUE[i] >= s->hi) seg[n - 1] &= (unsigned char)~(1u << i);
+    }
+
+    s->byte = b1;
+    *base_byte = b0;
+    *len = n;
+    return true;
+}
+
+static size_t popcount_bytes(const unsigned char *p, size_t n) {
+    size_t count = 0, i = 0;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w;
+        memcpy(&w, p + i, 8);
+#if defined(__GNUC__)
+        count += (size_t)__builtin_popcountll(w);
+#else
+        w = w - ((w >> 1) & 0x5555555555555555ull);
+        w = (w & 0x3333333333333333ull) + ((w >> 2) & 0x3333333333333333ull);
+        w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+        count += (size_t)((w * 0x0101010101010101ull) >> 56);
+#endif
+    }
+    for (; i < n; i++) {
+        for (unsigned v = p[i]; v != 0; v &= v - 1) count++;
+    }
+    return count;
+}
+
+// Primos 2, 3 e 5 (fora da roda) em [lo, hi)
+static size_t wheel_small_primes(uint64_t lo, uint64_t hi, uint64_t *out) {
+    static const uint64_t small[3] = {2, 3, 5};
+    size_t n = 0;
+    for (int i = 0; i < 3; i++) {
+        if (small[i] >= lo && small[i] < hi) {
+            if (out != NULL) out[n] = small[i];
+            n++;
+        }
+    }
+    return n;
+}
+
+struct PrimeIterator {
+    SegmentSieve sieve;
+    uint64_t small[3];
+    size_t num_small, small_pos;
+    uint64_t base_byte;         // segmento corrente
+    size_t len, pos;            // bytes validos e proximo byte a examinar
+    unsigned bits;              // bits restantes do byte pos - 1
+};
+
+PrimeIterator *prime_iterator_create(uint64_t lo, uint64_t hi) {
+    if (hi > SIEVE_SEGMENTED_MAX) return NULL;
+    if (hi < lo) hi = lo;
+    PrimeIterator *it = calloc(1, sizeof(PrimeIterator));
+    if (it == NULL) return NULL;
+
+    size_t num_base = 0;
+    uint32_t *base = sieve_base_primes((hi > 0) ? isqrt_u64(hi - 1) : 0, &num_base);
+    if (base == NULL && num_base > 0) { free(it); return NULL; }
+    uint64_t first = lo / 30, end = (hi + 29) / 30;
+    if (lo >= hi) first = end = 0;
+    bool ok = segment_sieve_init(&it->sieve, base, num_base, lo, hi, first, end);
+    free(base);
+    if (!ok) { free(it); return NULL; }
+    it->num_small = wheel_small_primes(lo, hi, it->small);
+    return it;
+}
+
+bool prime_iterator_next(PrimeIterator *it, uint64_t *prime) {
+    if (it == NULL) return false;
+    if (it->small_pos < it->num_small) {
+        if (prime != NULL) *prime = it->small[it->small_pos];
+        it->small_pos++;
+        return true;
+    }
+    while (it->bits == 0) {
+        while (it->pos < it->len && it->sieve.seg[it->pos] == 0) it->pos++;
+        if (it->pos < it->len) {
+            it->bits = it->sieve.seg[it->pos++];
+            break;
+        }
+        if (!segment_sieve_next(&it->sieve, &it->base_byte, &it->len)) return false;
+        it->pos = 0;
+    }
+    int i = 0;
+    while (!(it->bits & (1u << i))) i++;
+    it->bits &= it->bits - 1;
+    if (prime != NULL) *prime = (it->base_byte + it->pos - 1) * 30 + WHEEL_RESIDUE[i];
+    return true;
+}
+
+void prime_iterator_destroy(PrimeIterator *it) {
+    if (it == NULL) return;
+    segment_sieve_free(&it->sieve);
+    free(it);
+}
+
+typedef struct {
+    const uint32_t *base;
+    size_t num_base;
+    uint64_t lo, hi, first, end;
+    uint64_t seg_bytes, per_block;
+    uint64_t *counts;
+    uint64_t **lists;
+    atomic_bool failed;
+} SieveBlocksJob;
+
+static void sieve_block_range(void *ctx, size_t t0, size_t t1) {
+    SieveBlocksJob *job = ctx;
+    const uint32_t *base = job->base;
+    size_t num_base = job->num_base;
+    uint64_t lo = job->lo, hi = job->hi, end = job->end;
+    uint64_t *counts = job->counts;
+    uint64_t **lists = job->lists;
+    for (size_t t = t0; t < t1; t++) {
+        uint64_t b0 = job->first + (uint64_t)t * job->per_block * job->seg_bytes;
+        uint64_t b1 = b0 + job->per_block * job->seg_bytes;
+        if (b0 > end) b0 = end;
+        if (b1 > end) b1 = end;
+        uint64_t local = 0, *list = NULL;
+        size_t capacity = 0;
+        SegmentSieve s;
+        if (b0 < b1 && segment_sieve_init(&s, base, num_base, lo, hi, b0, b1)) {
+            uint64_t seg_byte;
+            size_t len;
+            while (!atomic_load_explicit(&job->failed, memory_order_relaxed) &&
+                   segment_sieve_next(&s, &seg_byte, &len)) {
+                size_t found = popcount_bytes(s.seg, len);
+                if (lists == NULL) {
+                    local += found;
+                    continue;
+                }
+                if (local + found > capacity) {
+                    size_t grown = (capacity * 2 > local + found) ? capacity * 2 : (size_t)local + found;
+                    uint64_t *bigger = realloc(list, grown * sizeof(uint64_t));
+                    if (bigger == NULL) { atomic_store(&job->failed, true); break; }
+                    list = bigger;
+                    capacity = grown;
+                }
+                for (size_t j = 0; j < len; j++) {
+                    for (unsigned v = s.seg[j]; v != 0; v &= v - 1) {
+                        int i = 0;
+                        while (!(v & (1u << i))) i++;
+                        list[local++] = (seg_byte + j) * 30 + WHEEL_RESIDUE[i];
+                    }
+                }
+            }
+            segment_sieve_free(&s);
+        } else if (b0 < b1) {
+            atomic_store(&job->failed, true);
+        }
+        counts[t] = local;
+        if (lists != NULL) lists[t] = list;
+    }
+}
+
+// Percorre [lo, hi) em um bloco de segmentos contiguos por thread. Conta os
+// primos de cada bloco em counts[t]; se lists != NULL, tambem os guarda em
+// lists[t] (alocado aqui)
+static bool sieve_range_blocks(uint64_t lo, uint64_t hi, int threads,
+                               uint64_t *counts, uint64_t **lists) {
+    size_t num_base = 0;
+    uint32_t *base = sieve_base_primes(isqrt_u64(hi - 1), &num_base);
+    if (base == NULL && num_base > 0) return false;
+
+    SieveBlocksJob job = { .base = base, .num_base = num_base, .lo = lo, .hi = hi,
+                           .first = lo / 30, .end = (hi + 29) / 30,
+                           .seg_bytes = sieve_segment_bytes(hi),
+                           .counts = counts, .lists = lists };
+    uint64_t segments = (job.end - job.first + job.seg_bytes - 1) / job.seg_bytes;
+    job.per_block = (segments + (uint64_t)threads - 1) / (uint64_t)threads;
+    atomic_init(&job.failed, false);
+
+    ds_parallel_for_threads((size_t)threads, 0, (size_t)threads, 1, sieve_block_range, &job);
+    free(base);
+    return !atomic_load(&job.failed);
+}
+
+static int sieve_threads(size_t num_threads) {
+    return ds_parallel_enabled(num_threads) ? (int)ds_resolve_threads(num_threads) : 1;
+}
+
+bool prime_count_range(uint64_t lo, uint64_t hi, size_t num_threads, uint64_t *count) {
+    if (count == NULL || hi > SIEVE_SEGMENTED_MAX) return false;
+    *count = 0;
+    if (lo >= hi) return true;
+    int threads = sieve_threads(num_threads);
+    uint64_t *counts = calloc((size_t)threads, sizeof(uint64_t));
+    if (counts == NULL) return false;
+    bool ok = sieve_range_blocks(lo, hi, threads, counts, NULL);
+    uint64_t total = wheel_small_primes(lo, hi, NULL);
+    for (int t = 0; t < threads; t++) total += counts[t];
+    free(counts);
+    if (ok) *count = total;
+    return ok;
+}
+
+uint64_t *primes_in_range(uint64_t lo, uint64_t hi, size_t num_threads, size_t *count) {
+    if (count == NULL) return NULL;
+    *count = 0;
+    if (lo >= hi || hi > SIEVE_SEGMENTED_MAX) return NULL;
+
+    int threads = sieve_threads(num_threads);
+    uint64_t *counts = calloc((size_t)threads, sizeof(uint64_t));
+    uint64_t **lists = calloc((size_t)threads, sizeof(uint64_t *));
+    uint64_t *out = NULL;
+    if (counts != NULL && lists != NULL && sieve_range_blocks(lo, hi, threads, counts, lists)) {
+        size_t total = wheel_small_primes(lo, hi, NULL);
+        for (int t = 0; t < threads; t++) total += (size_t)counts[t];
+        out = (total > 0) ? malloc(total * sizeof(uint64_t)) : NULL;
+        if (out != NULL) {
+            size_t pos = wheel_small_primes(lo, hi, out);
+            for (int t = 0; t < threads; t++) {
+                if (counts[t] > 0) memcpy(out + pos, lists[t], (size_t)counts[t] * sizeof(uint64_t));
+                pos += (size_t)counts[t];
+            }
+            *count = total;
+        }
+    }
+    for (int t = 0; lists != NULL && t < threads; t++) free(lists[t]);
+    free(lists);
+    free(counts);
+    return out;
+}
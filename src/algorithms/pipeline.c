@@ -0,0 +1,631 @@
+/**
+ * @file pipeline.c
+ * @brief Pipeline em lotes: uma thread por etapa, aneis SPSC e back-pressure
+ *
+ * Aresta: queue_depth lotes num unico bloco. O anel full leva ponteiros de
+ * lotes cheios ao consumidor, e um ponteiro NULL marca o fim do fluxo; o
+ * anel empty devolve os lotes ao produtor. Como os lotes sao um conjunto
+ * fechado, os enqueues nunca encontram anel cheio; so os dequeues esperam.
+ *
+ * Espera: cada aresta tem um contador de eventos. Quem espera incrementa
+ * waiters, le epoch e tenta o anel de novo antes de dormir ate epoch
+ * mudar; quem publica incrementa epoch e depois le waiters (os dois
+ * seq_cst), entao pelo menos um dos lados ve o outro e nenhuma publicacao
+ * se perde. O mutex so e tocado quando alguem de fato dorme.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+// pthreads/sched_yield (POSIX) com CMAKE_C_EXTENSIONS OFF
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "algorithms/pipeline.h"
+#include "algorithms/sorting.h"
+#include "data_structures/hash_table.h"
+#include "data_structures/queue.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PIPELINE_DEFAULT_BATCH  1024
+#define PIPELINE_DEFAULT_DEPTH  4
+
+/** Tentativas com sched_yield antes de dormir no contador de eventos */
+#define PIPELINE_SPIN 64
+
+PipelineConfig pipeline_default_config(void) {
+    PipelineConfig config = {
+        .batch_size = PIPELINE_DEFAULT_BATCH,
+        .queue_depth = PIPELINE_DEFAULT_DEPTH
+    };
+    return config;
+}
+
+// ============================================================================
+// ARESTAS
+// ============================================================================
+
+typedef struct {
+    size_t count;
+    unsigned char *items;
+} PipelineBatch;
+
+typedef struct {
+    SPSCQueue *full;            // produtor -> consumidor
+    SPSCQueue *empty;           // consumidor -> produtor
+    PipelineBatch *batches;
+    unsigned char *slab;
+    size_t item_size;
+    atomic_uint epoch;
+    atomic_uint waiters;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+} PipelineEdge;
+
+typedef struct {
+    PipelineEdge *edges;        // num_stages - 1
+    size_t num_stages;
+    size_t batch_size;
+    atomic_bool failed;
+} Pipeline;
+
+struct PipelineEmitter {
+    Pipeline *pipeline;
+    PipelineEdge *edge;         // NULL na ultima etapa
+    PipelineBatch *batch;       // lote sendo preenchido
+    PipelineStageStats *stats;
+};
+
+typedef struct {
+    Pipeline *pipeline;
+    const PipelineStage *stage;
+    PipelineEdge *input;        // NULL na fonte
+    PipelineEmitter out;
+    PipelineStageStats stats;
+    pthread_t thread;
+} PipelineWorker;
+
+static bool edge_init(PipelineEdge *edge, size_t item_size, size_t batch_size, size_t depth) {
+    memset(edge, 0, sizeof(*edge));
+    edge->item_size = item_size;
+    atomic_init(&edge->epoch, 0);
+    atomic_init(&edge->waiters, 0);
+    pthread_mutex_init(&edge->lock, NULL);
+    pthread_cond_init(&edge->wake, NULL);
+    if (batch_size > SIZE_MAX / item_size || batch_size * item_size > SIZE_MAX / depth) {
+        return false;
+    }
+
+    edge->full = spsc_queue_create(sizeof(PipelineBatch *), depth + 1);
+    edge->empty = spsc_queue_create(sizeof(PipelineBatch *), depth);
+    edge->batches = (PipelineBatch *)malloc(depth * sizeof(PipelineBatch));
+    edge->slab = (unsigned char *)malloc(depth * batch_size * item_size);
+    if (edge->full == NULL || edge->empty == NULL || edge->batches == NULL || edge->slab == NULL) {
+        return false;
+    }
+    for (size_t i = 0; i < depth; i++) {
+        PipelineBatch *batch = &edge->batches[i];
+        batch->count = 0;
+        batch->items = edge->slab + i * batch_size * item_size;
+        spsc_queue_enqueue(edge->empty, &batch);
+    }
+    return true;
+}
+
+static void edge_destroy(PipelineEdge *edge) {
+    pthread_cond_destroy(&edge->wake);
+    pthread_mutex_destroy(&edge->lock);
+    spsc_queue_destroy(edge->full);
+    spsc_queue_destroy(edge->empty);
+    free(edge->batches);
+    free(edge->slab);
+}
+
+static void edge_notify(PipelineEdge *edge) {
+    atomic_fetch_add(&edge->epoch, 1);
+    if (atomic_load(&edge->waiters) > 0) {
+        pthread_mutex_lock(&edge->lock);
+        pthread_cond_broadcast(&edge->wake);
+        pthread_mutex_unlock(&edge->lock);
+    }
+}
+
+static void pipeline_fail(Pipeline *p) {
+    atomic_store(&p->failed, true);
+    for (size_t i = 0; i + 1 < p->num_stages; i++) {
+        edge_notify(&p->edges[i]);
+    }
+}
+
+// Retira um lote de ring, esperando se preciso; false se o pipeline abortou
+static bool edge_take(Pipeline *p, PipelineEdge *edge, SPSCQueue *ring,
+                      PipelineBatch **batch, size_t *stalls) {
+    if (spsc_queue_dequeue(ring, batch) == DS_SUCCESS) return true;
+    (*stalls)++;
+    for (unsigned spin = 0;; spin++) {
+        if (atomic_load(&p->failed)) return false;
+        if (spin < PIPELINE_SPIN) {
+            sched_yield();
+            if (spsc_queue_dequeue(ring, batch) == DS_SUCCESS) return true;
+            continue;
+        }
+        atomic_fetch_add(&edge->waiters, 1);
+        unsigned epoch = atomic_load(&edge->epoch);
+        bool taken = spsc_queue_dequeue(ring, batch) == DS_SUCCESS;
+        if (!taken && !atomic_load(&p->failed)) {
+            pthread_mutex_lock(&edge->lock);
+            while (atomic_load(&edge->epoch) == epoch) {
+                pthread_cond_wait(&edge->wake, &edge->lock);
+            }
+            pthread_mutex_unlock(&edge->lock);
+        }
+        atomic_fetch_sub(&edge->waiters, 1);
+        if (taken) return true;
+        spin = 0;
+    }
+}
+
+static void edge_put(PipelineEdge *edge, SPSCQueue *ring, PipelineBatch *batch) {
+    spsc_queue_enqueue(ring, &batch);   // nunca cheio: os lotes sao um conjunto fechado
+    edge_notify(edge);
+}
+
+// ============================================================================
+// EMISSAO
+// ============================================================================
+
+static void emitter_push(PipelineEmitter *out) {
+    out->stats->batches_out++;
+    edge_put(out->edge, out->edge->full, out->batch);
+    out->batch = NULL;
+}
+
+bool pipeline_emit_n(PipelineEmitter *out, const void *items, size_t count) {
+    if (out == NULL || out->edge == NULL || (items == NULL && count > 0)) return false;
+    const unsigned char *src = (const unsigned char *)items;
+    size_t item_size = out->edge->item_size;
+    size_t batch_size = out->pipeline->batch_size;
+
+    while (count > 0) {
+        if (out->batch == NULL) {
+            if (!edge_take(out->pipeline, out->edge, out->edge->empty, &out->batch,
+                           &out->stats->output_stalls)) {
+                return false;
+            }
+            out->batch->count = 0;
+        }
+        size_t room = batch_size - out->batch->count;
+        size_t n = count < room ? count : room;
+        memcpy(out->batch->items + out->batch->count * item_size, src, n * item_size);
+        out->batch->count += n;
+        out->stats->items_out += n;
+        src += n * item_size;
+        count -= n;
+        if (out->batch->count == batch_size) emitter_push(out);
+    }
+    return !atomic_load(&out->pipeline->failed);
+}
+
+bool pipeline_emit(PipelineEmitter *out, const void *item) {
+    return pipeline_emit_n(out, item, 1);
+}
+
+// ============================================================================
+// EXECUCAO DAS ETAPAS
+// ============================================================================
+
+// Flush, lote parcial e marca de fim para a proxima etapa
+static void worker_finish(PipelineWorker *w) {
+    if (w->stage->flush != NULL && !atomic_load(&w->pipeline->failed) &&
+        !w->stage->flush(w->stage->ctx, &w->out)) {
+        pipeline_fail(w->pipeline);
+    }
+    if (w->out.edge == NULL || atomic_load(&w->pipeline->failed)) return;
+    if (w->out.batch != NULL && w->out.batch->count > 0) {
+        emitter_push(&w->out);
+    } else if (w->out.batch != NULL) {
+        edge_put(w->out.edge, w->out.edge->empty, w->out.batch);
+        w->out.batch = NULL;
+    }
+    edge_put(w->out.edge, w->out.edge->full, NULL);
+}
+
+static void worker_run(PipelineWorker *w) {
+    Pipeline *p = w->pipeline;
+    const PipelineStage *stage = w->stage;
+    PipelineStatus status = PIPELINE_CONTINUE;
+
+    if (w->input == NULL) {
+        while (status == PIPELINE_CONTINUE && !atomic_load(&p->failed)) {
+            status = stage->process(stage->ctx, NULL, 0, &w->out);
+        }
+        if (status == PIPELINE_ERROR) pipeline_fail(p);
+        worker_finish(w);
+        return;
+    }
+
+    for (;;) {
+        PipelineBatch *batch;
+        if (!edge_take(p, w->input, w->input->full, &batch, &w->stats.input_stalls)) return;
+        if (batch == NULL) break;   // fim do fluxo
+
+        w->stats.items_in += batch->count;
+        w->stats.batches_in++;
+        if (status == PIPELINE_CONTINUE) {
+            status = stage->process(stage->ctx, batch->items, batch->count, &w->out);
+            if (status == PIPELINE_ERROR) pipeline_fail(p);
+            if (status == PIPELINE_DONE) worker_finish(w);   // o resto da entrada e descartado
+        }
+        edge_put(w->input, w->input->empty, batch);
+        if (status == PIPELINE_ERROR) return;
+    }
+    if (status == PIPELINE_CONTINUE) worker_finish(w);
+}
+
+static void* worker_main(void *arg) {
+    worker_run((PipelineWorker *)arg);
+    return NULL;
+}
+
+bool pipeline_run(const PipelineStage *stages, size_t num_stages,
+                  const PipelineConfig *config, PipelineStageStats *stats) {
+    if (stages == NULL || num_stages == 0) return false;
+    PipelineConfig cfg = config != NULL ? *config : pipeline_default_config();
+    if (cfg.batch_size == 0) cfg.batch_size = PIPELINE_DEFAULT_BATCH;
+    if (cfg.queue_depth < 2) cfg.queue_depth = 2;
+    for (size_t i = 0; i < num_stages; i++) {
+        if (stages[i].process == NULL) return false;
+        if (i + 1 < num_stages && stages[i].out_item_size == 0) return false;
+    }
+
+    Pipeline p;
+    p.num_stages = num_stages;
+    p.batch_size = cfg.batch_size;
+    atomic_init(&p.failed, false);
+    p.edges = (PipelineEdge *)calloc(num_stages > 1 ? num_stages - 1 : 1, sizeof(PipelineEdge));
+    PipelineWorker *workers = (PipelineWorker *)calloc(num_stages, sizeof(PipelineWorker));
+    bool ok = p.edges != NULL && workers != NULL;
+
+    size_t edges_ready = 0;
+    while (ok && edges_ready + 1 < num_stages) {
+        ok = edge_init(&p.edges[edges_ready], stages[edges_ready].out_item_size,
+                       cfg.batch_size, cfg.queue_depth);
+        edges_ready++;   // uma aresta parcialmente criada tambem e destruida
+    }
+
+    size_t started = 0;
+    if (ok) {
+        for (size_t i = 0; i < num_stages; i++) {
+            PipelineWorker *w = &workers[i];
+            w->pipeline = &p;
+            w->stage = &stages[i];
+            w->input = i > 0 ? &p.edges[i - 1] : NULL;
+            w->out.pipeline = &p;
+            w->out.edge = i + 1 < num_stages ? &p.edges[i] : NULL;
+            w->out.stats = &w->stats;
+        }
+        // A ultima etapa roda na thread chamadora
+        for (; started + 1 < num_stages; started++) {
+            if (pthread_create(&workers[started].thread, NULL, worker_main, &workers[started]) != 0) {
+                pipeline_fail(&p);
+                break;
+            }
+        }
+        if (started + 1 == num_stages) worker_run(&workers[num_stages - 1]);
+        for (size_t i = 0; i < started; i++) {
+            pthread_join(workers[i].thread, NULL);
+        }
+        ok = !atomic_load(&p.failed);
+        if (stats != NULL) {
+            for (size_t i = 0; i < num_stages; i++) stats[i] = workers[i].stats;
+        }
+    }
+
+    for (size_t i = 0; i < edges_ready; i++) {
+        edge_destroy(&p.edges[i]);
+    }
+    free(p.edges);
+    free(workers);
+    return ok;
+}
+
+// ============================================================================
+// FILTRO POR SUBSTRING
+// ============================================================================
+
+struct PipelineFilter {
+    StringPattern *pattern;
+    size_t item_size;
+    size_t field_offset;
+    size_t field_size;
+    bool inverted;
+};
+
+PipelineFilter *pipeline_filter_create(size_t item_size, size_t field_offset, size_t field_size,
+                                       const void *pattern, size_t m,
+                                       StringSearchAlgorithm algo) {
+    if (item_size == 0 || field_offset > item_size || field_size > item_size - field_offset) {
+        return NULL;
+    }
+    PipelineFilter *filter = (PipelineFilter *)calloc(1, sizeof(PipelineFilter));
+    if (filter == NULL) return NULL;
+    filter->pattern = string_pattern_compile(pattern, m, algo);
+    if (filter->pattern == NULL) {
+        free(filter);
+        return NULL;
+    }
+    filter->item_size = item_size;
+    filter->field_offset = field_offset;
+    filter->field_size = field_size;
+    return filter;
+}
+
+void pipeline_filter_destroy(PipelineFilter *filter) {
+    if (filter == NULL) return;
+    string_pattern_destroy(filter->pattern);
+    free(filter);
+}
+
+static PipelineStatus filter_process(void *ctx, const void *items, size_t count,
+                                     PipelineEmitter *out) {
+    PipelineFilter *filter = (PipelineFilter *)ctx;
+    const unsigned char *item = (const unsigned char *)items;
+    const unsigned char *run = NULL;   // itens aceitos consecutivos saem num unico emit
+    size_t run_length = 0;
+
+    for (size_t i = 0; i < count; i++, item += filter->item_size) {
+        const unsigned char *field = item + filter->field_offset;
+        const unsigned char *end = memchr(field, '\0', filter->field_size);
+        size_t length = end != NULL ? (size_t)(end - field) : filter->field_size;
+        bool found = string_pattern_search(filter->pattern, field, length) != SM_NOT_FOUND;
+        if (found != filter->inverted) {
+            if (run_length == 0) run = item;
+            run_length++;
+        } else if (run_length > 0) {
+            if (!pipeline_emit_n(out, run, run_length)) return PIPELINE_ERROR;
+            run_length = 0;
+        }
+    }
+    if (run_length > 0 && !pipeline_emit_n(out, run, run_length)) return PIPELINE_ERROR;
+    return PIPELINE_CONTINUE;
+}
+
+PipelineStage pipeline_filter_stage(PipelineFilter *filter, bool inverted) {
+    if (filter != NULL) filter->inverted = inverted;
+    PipelineStage stage = {
+        .name = "filter",
+        .process = filter_process,
+        .flush = NULL,
+        .ctx = filter,
+        .out_item_size = filter != NULL ? filter->item_size : 0
+    };
+    return stage;
+}
+
+// ============================================================================
+// AGREGACAO POR CHAVE
+// ============================================================================
+
+struct PipelineAggregate {
+    HashTable *table;           // chave -> uint64_t
+    size_t item_size;
+    size_t key_offset;
+    size_t key_size;
+};
+
+size_t pipeline_group_size(size_t key_size) {
+    return PIPELINE_GROUP_COUNT_OFFSET(key_size) + sizeof(uint64_t);
+}
+
+PipelineAggregate *pipeline_aggregate_create(size_t item_size, size_t key_offset, size_t key_size,
+                                             HashFn hash_fn, CompareFn compare_fn) {
+    if (key_size == 0 || key_offset > item_size || key_size > item_size - key_offset ||
+        hash_fn == NULL || compare_fn == NULL) {
+        return NULL;
+    }
+    PipelineAggregate *agg = (PipelineAggregate *)calloc(1, sizeof(PipelineAggregate));
+    if (agg == NULL) return NULL;
+    agg->table = hashtable_create(key_size, sizeof(uint64_t), 1024, hash_fn, compare_fn,
+                                  HASH_FLAT, NULL, NULL);
+    if (agg->table == NULL) {
+        free(agg);
+        return NULL;
+    }
+    agg->item_size = item_size;
+    agg->key_offset = key_offset;
+    agg->key_size = key_size;
+    return agg;
+}
+
+void pipeline_aggregate_destroy(PipelineAggregate *agg) {
+    if (agg == NULL) return;
+    hashtable_destroy(agg->table);
+    free(agg);
+}
+
+size_t pipeline_aggregate_groups(const PipelineAggregate *agg) {
+    return agg != NULL ? hashtable_size(agg->table) : 0;
+}
+
+static PipelineStatus aggregate_process(void *ctx, const void *items, size_t count,
+                                        PipelineEmitter *out) {
+    (void)out;
+    PipelineAggregate *agg = (PipelineAggregate *)ctx;
+    const unsigned char *item = (const unsigned char *)items;
+    for (size_t i = 0; i < count; i++, item += agg->item_size) {
+        const void *key = item + agg->key_offset;
+        uint64_t *counter = (uint64_t *)hashtable_get_ptr(agg->table, key);
+        if (counter != NULL) {
+            (*counter)++;
+        } else {
+            uint64_t one = 1;
+            if (hashtable_put(agg->table, key, &one) != DS_SUCCESS) return PIPELINE_ERROR;
+        }
+    }
+    return PIPELINE_CONTINUE;
+}
+
+static bool aggregate_flush(void *ctx, PipelineEmitter *out) {
+    PipelineAggregate *agg = (PipelineAggregate *)ctx;
+    size_t count_offset = PIPELINE_GROUP_COUNT_OFFSET(agg->key_size);
+    unsigned char *group = (unsigned char *)calloc(1, pipeline_group_size(agg->key_size));
+    HashTableIterator *it = hashtable_iterator(agg->table);
+    bool ok = group != NULL && it != NULL;
+
+    while (ok && hashtable_iterator_has_next(it)) {
+        HashTableEntry *entry = hashtable_iterator_next(it);
+        memcpy(group, entry->key, agg->key_size);
+        memcpy(group + count_offset, entry->value, sizeof(uint64_t));
+        ok = pipeline_emit(out, group);
+    }
+    hashtable_iterator_destroy(it);
+    free(group);
+    return ok;
+}
+
+PipelineStage pipeline_aggregate_stage(PipelineAggregate *agg) {
+    PipelineStage stage = {
+        .name = "aggregate",
+        .process = aggregate_process,
+        .flush = aggregate_flush,
+        .ctx = agg,
+        .out_item_size = agg != NULL ? pipeline_group_size(agg->key_size) : 0
+    };
+    return stage;
+}
+
+// ============================================================================
+// ORDENACAO POR RUNS
+// ============================================================================
+
+struct PipelineSort {
+    unsigned char *data;
+    size_t count;
+    size_t capacity;
+    size_t *run_ends;           // fim (exclusivo) de cada run
+    size_t num_runs;
+    size_t runs_capacity;
+    size_t item_size;
+    CompareFn cmp;
+};
+
+PipelineSort *pipeline_sort_create(size_t item_size, CompareFn cmp) {
+    if (item_size == 0 || cmp == NULL) return NULL;
+    PipelineSort *sort = (PipelineSort *)calloc(1, sizeof(PipelineSort));
+    if (sort == NULL) return NULL;
+    sort->item_size = item_size;
+    sort->cmp = cmp;
+    return sort;
+}
+
+void pipeline_sort_destroy(PipelineSort *sort) {
+    if (sort == NULL) return;
+    free(sort->data);
+    free(sort->run_ends);
+    free(sort);
+}
+
+static bool sort_reserve(PipelineSort *sort, size_t extra) {
+    if (sort->count + extra > sort->capacity) {
+        size_t capacity = sort->capacity > 0 ? sort->capacity : 1024;
+        while (capacity < sort->count + extra) capacity *= 2;
+        if (capacity > SIZE_MAX / sort->item_size) return false;
+        unsigned char *data = (unsigned char *)realloc(sort->data, capacity * sort->item_size);
+        if (data == NULL) return false;
+        sort->data = data;
+        sort->capacity = capacity;
+    }
+    if (sort->num_runs == sort->runs_capacity) {
+        size_t capacity = sort->runs_capacity > 0 ? 2 * sort->runs_capacity : 64;
+        size_t *run_ends = (size_t *)realloc(sort->run_ends, capacity * sizeof(size_t));
+        if (run_ends == NULL) return false;
+        sort->run_ends = run_ends;
+        sort->runs_capacity = capacity;
+    }
+    return true;
+}
+
+static PipelineStatus sort_process(void *ctx, const void *items, size_t count,
+                                   PipelineEmitter *out) {
+    (void)out;
+    PipelineSort *sort = (PipelineSort *)ctx;
+    if (count == 0) return PIPELINE_CONTINUE;
+    if (!sort_reserve(sort, count)) return PIPELINE_ERROR;
+
+    unsigned char *run = sort->data + sort->count * sort->item_size;
+    memcpy(run, items, count * sort->item_size);
+    quick_sort(run, count, sort->item_size, sort->cmp);
+    sort->count += count;
+    sort->run_ends[sort->num_runs++] = sort->count;
+    return PIPELINE_CONTINUE;
+}
+
+static void merge_runs(const unsigned char *a, size_t na, const unsigned char *b, size_t nb,
+                       unsigned char *dst, size_t item_size, CompareFn cmp) {
+    size_t i = 0, j = 0;
+    while (i < na && j < nb) {
+        if (cmp(b + j * item_size, a + i * item_size) < 0) {
+            memcpy(dst, b + j * item_size, item_size);
+            j++;
+        } else {
+            memcpy(dst, a + i * item_size, item_size);
+            i++;
+        }
+        dst += item_size;
+    }
+    memcpy(dst, a + i * item_size, (na - i) * item_size);
+    memcpy(dst + (na - i) * item_size, b + j * item_size, (nb - j) * item_size);
+}
+
+static bool sort_flush(void *ctx, PipelineEmitter *out) {
+    PipelineSort *sort = (PipelineSort *)ctx;
+    size_t item_size = sort->item_size;
+
+    if (sort->num_runs > 1) {
+        unsigned char *src = sort->data;
+        unsigned char *dst = (unsigned char *)malloc(sort->count * item_size);
+        if (dst == NULL) return false;
+        // Intercala runs vizinhos dois a dois; run_ends e compactado em cada passe
+        while (sort->num_runs > 1) {
+            size_t merged = 0;
+            for (size_t r = 0; r < sort->num_runs; r += 2) {
+                size_t lo = r > 0 ? sort->run_ends[r - 1] : 0;
+                size_t mid = sort->run_ends[r];
+                size_t hi = r + 1 < sort->num_runs ? sort->run_ends[r + 1] : mid;
+                merge_runs(src + lo * item_size, mid - lo, src + mid * item_size, hi - mid,
+                           dst + lo * item_size, item_size, sort->cmp);
+                sort->run_ends[merged++] = hi;
+            }
+            sort->num_runs = merged;
+            unsigned char *tmp = src;
+            src = dst;
+            dst = tmp;
+        }
+        free(dst);
+        sort->data = src;
+        sort->capacity = sort->count;
+    }
+
+    bool ok = pipeline_emit_n(out, sort->data, sort->count);
+    sort->count = 0;
+    sort->num_runs = 0;
+    return ok;
+}
+
+PipelineStage pipeline_sort_stage(PipelineSort *sort) {
+    PipelineStage stage = {
+        .name = "sort",
+        .process = sort_process,
+        .flush = sort_flush,
+        .ctx = sort,
+        .out_item_size = sort != NULL ? sort->item_size : 0
+    };
+    return stage;
+}
@@ -14,6 +14,28 @@
 #include "algorithms/searching.h"
 
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__)
+#define SEARCH_PREFETCH(p) __builtin_prefetch((p))
+#else
+#define SEARCH_PREFETCH(p) ((void)(p))
+#endif
+
+// Busca linear vetorizada (16 elementos de 32 bits ou 8 de 64 por iteracao).
+// Defina SEARCH_NO_SIMD para forcar o laco escalar.
+#if !defined(SEARCH_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define SEARCH_USE_SSE2 1
+#elif !defined(SEARCH_NO_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SEARCH_USE_NEON 1
+#endif
+
+// Abaixo disso jump/exponential search com compare_int fazem varredura linear
+#define SEARCH_SIMD_SMALL_N 256
 
 static inline const void *celem_at(const void *arr, size_t i, size_t size) {
     return (const unsigned char *)arr + i * size;
@@ -23,9 +45,17 @@ static inline const void *celem_at(const void *arr, size_t i, size_t size) {
 // LINEAR SEARCH - Cormen S2.1
 // ============================================================================
 
+// compare_int sobre int32: igualdade de compare_int == igualdade de bits
+static inline bool is_int32_compare(size_t elem_size, CompareFn cmp) {
+    return cmp == compare_int && elem_size == sizeof(int32_t) && sizeof(int) == sizeof(int32_t);
+}
+
 size_t linear_search(const void *arr, size_t n, size_t elem_size,
                      const void *target, CompareFn cmp) {
     if (arr == NULL || target == NULL || cmp == NULL) return SEARCH_NOT_FOUND;
+    if (is_int32_compare(elem_size, cmp)) {
+        return linear_search_int32(arr, n, *(const int32_t *)target);
+    }
 
     for (size_t i = 0; i < n; i++) {
         if (cmp(celem_at(arr, i, elem_size), target) == 0)
@@ -130,6 +160,11 @@ size_t jump_search(const void *arr, size_t n, size_t elem_size,
     if (arr == NULL || target == NULL || cmp == NULL || n == 0)
         return SEARCH_NOT_FOUND;
 
+    bool typed = is_int32_compare(elem_size, cmp);
+    if (typed && n <= SEARCH_SIMD_SMALL_N) {
+        return linear_search_int32(arr, n, *(const int32_t *)target);
+    }
+
     size_t step = (size_t)sqrt((double)n);
     size_t prev = 0;
     size_t curr = step;
@@ -139,6 +174,12 @@ size_t jump_search(const void *arr, size_t n, size_t elem_size,
         curr += step;
     }
 
+    if (typed && prev < n) {
+        size_t len = ((curr < n) ? curr + 1 : n) - prev;
+        size_t i = linear_search_int32((const int32_t *)arr + prev, len, *(const int32_t *)target);
+        return (i == SEARCH_NOT_FOUND) ? SEARCH_NOT_FOUND : prev + i;
+    }
+
     for (size_t i = prev; i < n && i <= curr; i++) {
         if (cmp(celem_at(arr, i, elem_size), target) == 0)
             return i;
@@ -155,6 +196,10 @@ size_t exponential_search(const void *arr, size_t n, size_t elem_size,
     if (arr == NULL || target == NULL || cmp == NULL || n == 0)
         return SEARCH_NOT_FOUND;
 
+    if (n <= SEARCH_SIMD_SMALL_N && is_int32_compare(elem_size, cmp)) {
+        return linear_search_int32(arr, n, *(const int32_t *)target);
+    }
+
     if (cmp(celem_at(arr, 0, elem_size), target) == 0) return 0;
 
     size_t bound = 1;
@@ -177,3 +222,378 @@ size_t exponential_search(const void *arr, size_t n, size_t elem_size,
     }
     return SEARCH_NOT_FOUND;
 }
+
+// ============================================================================
+// BUSCA LINEAR VETORIZADA
+// ============================================================================
+
+static inline unsigned search_ctz(unsigned mask) {
+#if defined(__GNUC__)
+    return (unsigned)__builtin_ctz(mask);
+#else
+    unsigned i = 0;
+    while (!(mask & 1u)) { mask >>= 1; i++; }
+    return i;
+#endif
+}
+
+size_t linear_search_int32(const int32_t *arr, size_t n, int32_t target) {
+    if (arr == NULL) return SEARCH_NOT_FOUND;
+    size_t i = 0;
+
+#if defined(SEARCH_USE_SSE2)
+    __m128i key = _mm_set1_epi32(target);
+    for (; i + 16 <= n; i += 16) {
+        __m128i e0 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(arr + i)), key);
+        __m128i e1 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(arr + i + 4)), key);
+        __m128i e2 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(arr + i + 8)), key);
+        __m128i e3 = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(arr + i + 12)), key);
+        __m128i any = _mm_or_si128(_mm_or_si128(e0, e1), _mm_or_si128(e2, e3));
+        if (_mm_movemask_epi8(any) != 0) {
+            unsigned mask = (unsigned)_mm_movemask_ps(_mm_castsi128_ps(e0))
+                          | (unsigned)_mm_movemask_ps(_mm_castsi128_ps(e1)) << 4
+                          | (unsigned)_mm_movemask_ps(_mm_castsi128_ps(e2)) << 8
+                          | (unsigned)_mm_movemask_ps(_mm_castsi128_ps(e3)) << 12;
+            return i + search_ctz(mask);
+        }
+    }
+#elif defined(SEARCH_USE_NEON)
+    int32x4_t key = vdupq_n_s32(target);
+    for (; i + 16 <= n; i += 16) {
+        uint32x4_t any = vorrq_u32(vorrq_u32(vceqq_s32(vld1q_s32(arr + i), key),
+                                             vceqq_s32(vld1q_s32(arr + i + 4), key)),
+                                   vorrq_u32(vceqq_s32(vld1q_s32(arr + i + 8), key),
+                                             vceqq_s32(vld1q_s32(arr + i + 12), key)));
+        if (vmaxvq_u32(any) != 0) break;    // posicao exata pelo laco escalar
+    }
+#endif
+
+    for (; i < n; i++) {
+        if (arr[i] == target) return i;
+    }
+    return SEARCH_NOT_FOUND;
+}
+
+size_t linear_search_int64(const int64_t *arr, size_t n, int64_t target) {
+    if (arr == NULL) return SEARCH_NOT_FOUND;
+    size_t i = 0;
+
+#if defined(SEARCH_USE_SSE2)
+    // SSE2 nao tem cmpeq_epi64: as duas metades de 32 bits devem ser iguais
+    __m128i key = _mm_set1_epi64x(target);
+    for (; i + 8 <= n; i += 8) {
+        unsigned mask = 0;
+        for (unsigned v = 0; v < 4; v++) {
+            __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(arr + i + 2 * v)), key);
+            eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+            mask |= (unsigned)_mm_movemask_pd(_mm_castsi128_pd(eq)) << (2 * v);
+        }
+        if (mask != 0) return i + search_ctz(mask);
+    }
+#elif defined(SEARCH_USE_NEON)
+    int64x2_t key = vdupq_n_s64(target);
+    for (; i + 8 <= n; i += 8) {
+        uint64x2_t any = vorrq_u64(vorrq_u64(vceqq_s64(vld1q_s64(arr + i), key),
+                                             vceqq_s64(vld1q_s64(arr + i + 2), key)),
+                                   vorrq_u64(vceqq_s64(vld1q_s64(arr + i + 4), key),
+                                             vceqq_s64(vld1q_s64(arr + i + 6), key)));
+        if ((vgetq_lane_u64(any, 0) | vgetq_lane_u64(any, 1)) != 0) break;
+    }
+#endif
+
+    for (; i < n; i++) {
+        if (arr[i] == target) return i;
+    }
+    return SEARCH_NOT_FOUND;
+}
+
+size_t linear_search_float(const float *arr, size_t n, float target) {
+    if (arr == NULL) return SEARCH_NOT_FOUND;
+    size_t i = 0;
+
+#if defined(SEARCH_USE_SSE2)
+    __m128 key = _mm_set1_ps(target);
+    for (; i + 16 <= n; i += 16) {
+        unsigned mask = (unsigned)_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(arr + i), key))
+                      | (unsigned)_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(arr + i + 4), key)) << 4
+                      | (unsigned)_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(arr + i + 8), key)) << 8
+                      | (unsigned)_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(arr + i + 12), key)) << 12;
+        if (mask != 0) return i + search_ctz(mask);
+    }
+#elif defined(SEARCH_USE_NEON)
+    float32x4_t key = vdupq_n_f32(target);
+    for (; i + 16 <= n; i += 16) {
+        uint32x4_t any = vorrq_u32(vorrq_u32(vceqq_f32(vld1q_f32(arr + i), key),
+                                             vceqq_f32(vld1q_f32(arr + i + 4), key)),
+                                   vorrq_u32(vceqq_f32(vld1q_f32(arr + i + 8), key),
+                                             vceqq_f32(vld1q_f32(arr + i + 12), key)));
+        if (vmaxvq_u32(any) != 0) break;
+    }
+#endif
+
+    for (; i < n; i++) {
+        if (arr[i] == target) return i;
+    }
+    return SEARCH_NOT_FOUND;
+}
+
+// ============================================================================
+// LOWER BOUND SEM DESVIOS - Khuong & Morin (2017)
+// ============================================================================
+
+size_t lower_bound_branchless(const void *arr, size_t n, size_t elem_size,
+                              const void *target, CompareFn cmp) {
+    if (arr == NULL || target == NULL || cmp == NULL) return SEARCH_NOT_FOUND;
+    if (n == 0) return 0;
+
+    // Invariante: a resposta esta em [base, base + len]
+    const unsigned char *base = arr;
+    size_t len = n;
+    while (len > 1) {
+        size_t half = len / 2;
+        size_t next = (len - half) / 2;
+        SEARCH_PREFETCH(base + next * elem_size);
+        SEARCH_PREFETCH(base + (half + next) * elem_size);
+        base = (cmp(base + half * elem_size, target) < 0) ? base + half * elem_size : base;
+        len -= half;
+    }
+    size_t i = (size_t)(base - (const unsigned char *)arr) / elem_size;
+    return i + (cmp(base, target) < 0 ? 1 : 0);
+}
+
+size_t lower_bound_int(const int *arr, size_t n, int target) {
+    if (arr == NULL) return SEARCH_NOT_FOUND;
+    if (n == 0) return 0;
+
+    const int *base = arr;
+    size_t len = n;
+    while (len > 1) {
+        size_t half = len / 2;
+        size_t next = (len - half) / 2;
+        SEARCH_PREFETCH(base + next);
+        SEARCH_PREFETCH(base + half + next);
+        base = (base[half] < target) ? base + half : base;
+        len -= half;
+    }
+    return (size_t)(base - arr) + (*base < target ? 1 : 0);
+}
+
+// Nucleo dos lotes: exact = true devolve SEARCH_NOT_FOUND quando arr[lb] != chave
+static void batch_lower_bound_int(const int *arr, size_t n, const int *targets, size_t m,
+                                  size_t *out, bool exact) {
+    for (size_t j0 = 0; j0 < m; j0 += SEARCH_BATCH_WIDTH) {
+        size_t w = (m - j0 < SEARCH_BATCH_WIDTH) ? m - j0 : SEARCH_BATCH_WIDTH;
+        const int *key = targets + j0;
+        size_t pos[SEARCH_BATCH_WIDTH] = {0};
+        if (n == 0) {
+            for (size_t t = 0; t < w; t++) out[j0 + t] = exact ? SEARCH_NOT_FOUND : 0;
+            continue;
+        }
+
+        // Todas as chaves do grupo tem o mesmo numero de passos
+        size_t len = n;
+        while (len > 1) {
+            size_t half = len / 2;
+            size_t next = (len - half) / 2;
+            for (size_t t = 0; t < w; t++) {
+                pos[t] = (arr[pos[t] + half] < key[t]) ? pos[t] + half : pos[t];
+                SEARCH_PREFETCH(arr + pos[t] + next);
+            }
+            len -= half;
+        }
+        for (size_t t = 0; t < w; t++) {
+            size_t lb = pos[t] + (arr[pos[t]] < key[t] ? 1 : 0);
+            if (exact) lb = (lb < n && arr[lb] == key[t]) ? lb : SEARCH_NOT_FOUND;
+            out[j0 + t] = lb;
+        }
+    }
+}
+
+static void batch_lower_bound(const void *arr, size_t n, size_t elem_size,
+                              const void *targets, size_t m, CompareFn cmp,
+                              size_t *out, bool exact) {
+    for (size_t j0 = 0; j0 < m; j0 += SEARCH_BATCH_WIDTH) {
+        size_t w = (m - j0 < SEARCH_BATCH_WIDTH) ? m - j0 : SEARCH_BATCH_WIDTH;
+        const void *key[SEARCH_BATCH_WIDTH];
+        size_t pos[SEARCH_BATCH_WIDTH];
+        for (size_t t = 0; t < w; t++) {
+            key[t] = celem_at(targets, j0 + t, elem_size);
+            pos[t] = 0;
+        }
+        if (n == 0) {
+            for (size_t t = 0; t < w; t++) out[j0 + t] = exact ? SEARCH_NOT_FOUND : 0;
+            continue;
+        }
+
+        size_t len = n;
+        while (len > 1) {
+            size_t half = len / 2;
+            size_t next = (len - half) / 2;
+            for (size_t t = 0; t < w; t++) {
+                const void *probe = celem_at(arr, pos[t] + half, elem_size);
+                pos[t] = (cmp(probe, key[t]) < 0) ? pos[t] + half : pos[t];
+                SEARCH_PREFETCH(celem_at(arr, pos[t] + next, elem_size));
+            }
+            len -= half;
+        }
+        for (size_t t = 0; t < w; t++) {
+            int c = cmp(celem_at(arr, pos[t], elem_size), key[t]);
+            size_t lb = pos[t] + (c < 0 ? 1 : 0);
+            if (exact) {
+                if (c < 0 && lb < n) c = cmp(celem_at(arr, lb, elem_size), key[t]);
+                lb = (lb < n && c == 0) ? lb : SEARCH_NOT_FOUND;
+            }
+            out[j0 + t] = lb;
+        }
+    }
+}
+
+void lower_bound_int_batch(const int *arr, size_t n, const int *targets, size_t m,
+                           size_t *out) {
+    if (arr == NULL || targets == NULL || out == NULL) return;
+    batch_lower_bound_int(arr, n, targets, m, out, false);
+}
+
+void lower_bound_batch(const void *arr, size_t n, size_t elem_size,
+                       const void *targets, size_t m, CompareFn cmp, size_t *out) {
+    if (arr == NULL || targets == NULL || cmp == NULL || out == NULL) return;
+    batch_lower_bound(arr, n, elem_size, targets, m, cmp, out, false);
+}
+
+void binary_search_batch(const void *arr, size_t n, size_t elem_size,
+                         const void *queries, size_t m, CompareFn cmp, size_t *out) {
+    if (out == NULL) return;
+    if (arr == NULL || queries == NULL || cmp == NULL) {
+        for (size_t j = 0; j < m && queries != NULL; j++) out[j] = SEARCH_NOT_FOUND;
+        return;
+    }
+    batch_lower_bound(arr, n, elem_size, queries, m, cmp, out, true);
+}
+
+void binary_search_int_batch(const int *arr, size_t n, const int *queries, size_t m,
+                             size_t *out) {
+    if (out == NULL) return;
+    if (arr == NULL || queries == NULL) {
+        for (size_t j = 0; j < m && queries != NULL; j++) out[j] = SEARCH_NOT_FOUND;
+        return;
+    }
+    batch_lower_bound_int(arr, n, queries, m, out, true);
+}
+
+// ============================================================================
+// LAYOUT DE EYTZINGER - Khuong & Morin (2017), S3
+// ============================================================================
+
+// Percurso em ordem da arvore implicita (no k base 1): o i-esimo menor vai para o no k
+static size_t eytzinger_fill(const unsigned char *src, unsigned char *dst, size_t elem_size,
+                             size_t n, size_t i, size_t k) {
+    if (k <= n) {
+        i = eytzinger_fill(src, dst, elem_size, n, i, 2 * k);
+        memcpy(dst + (k - 1) * elem_size, src + i * elem_size, elem_size);
+        i++;
+        i = eytzinger_fill(src, dst, elem_size, n, i, 2 * k + 1);
+    }
+    return i;
+}
+
+void *eytzinger_build(const void *sorted, size_t n, size_t elem_size) {
+    if (sorted == NULL || n == 0 || elem_size == 0) return NULL;
+    unsigned char *eyt = malloc(n * elem_size);
+    if (eyt == NULL) return NULL;
+    eytzinger_fill(sorted, eyt, elem_size, n, 0, 1);
+    return eyt;
+}
+
+// Sobe ate o ultimo no em que a busca desceu para a esquerda (arr[k] >= target)
+static inline size_t eytzinger_unwind(size_t k) {
+#if defined(__GNUC__)
+    return k >> (__builtin_ctzll(~(unsigned long long)k) + 1);
+#else
+    while (k & 1) k >>= 1;
+    return k >> 1;
+#endif
+}
+
+size_t eytzinger_lower_bound(const void *eyt, size_t n, size_t elem_size,
+                             const void *target, CompareFn cmp) {
+    if (eyt == NULL || target == NULL || cmp == NULL) return SEARCH_NOT_FOUND;
+
+    size_t k = 1;
+    while (k <= n) {
+        // 16 descendentes 4 niveis abaixo sao contiguos
+        if (16 * k <= n) SEARCH_PREFETCH(celem_at(eyt, 16 * k - 1, elem_size));
+        k = 2 * k + (cmp(celem_at(eyt, k - 1, elem_size), target) < 0 ? 1 : 0);
+    }
+    k = eytzinger_unwind(k);
+    return (k == 0) ? SEARCH_NOT_FOUND : k - 1;
+}
+
+void eytzinger_lower_bound_batch(const void *eyt, size_t n, size_t elem_size,
+                                 const void *targets, size_t m, CompareFn cmp,
+                                 size_t *out) {
+    if (eyt == NULL || targets == NULL || cmp == NULL || out == NULL) return;
+
+    size_t depth = 0;
+    for (size_t v = n; v > 0; v >>= 1) depth++;
+
+    for (size_t j0 = 0; j0 < m; j0 += SEARCH_BATCH_WIDTH) {
+        size_t w = (m - j0 < SEARCH_BATCH_WIDTH) ? m - j0 : SEARCH_BATCH_WIDTH;
+        const void *key[SEARCH_BATCH_WIDTH];
+        size_t k[SEARCH_BATCH_WIDTH];
+        for (size_t t = 0; t < w; t++) {
+            key[t] = celem_at(targets, j0 + t, elem_size);
+            k[t] = 1;
+        }
+
+        // Folhas ficam em dois niveis: no ultimo, parte das chaves ja saiu
+        for (size_t level = 0; level < depth; level++) {
+            for (size_t t = 0; t < w; t++) {
+                if (k[t] > n) continue;
+                k[t] = 2 * k[t] + (cmp(celem_at(eyt, k[t] - 1, elem_size), key[t]) < 0 ? 1 : 0);
+                if (k[t] <= n) SEARCH_PREFETCH(celem_at(eyt, k[t] - 1, elem_size));
+            }
+        }
+        for (size_t t = 0; t < w; t++) {
+            size_t r = eytzinger_unwind(k[t]);
+            out[j0 + t] = (r == 0) ? SEARCH_NOT_FOUND : r - 1;
+        }
+    }
+}
+
+size_t eytzinger_lower_bound_int(const int *eyt, size_t n, int target) {
+    if (eyt == NULL) return SEARCH_NOT_FOUND;
+
+    size_t k = 1;
+    while (k <= n) {
+        if (16 * k <= n) SEARCH_PREFETCH(eyt + 16 * k - 1);
+        k = 2 * k + (eyt[k - 1] < target ? 1 : 0);
+    }
+    k = eytzinger_unwind(k);
+    return (k == 0) ? SEARCH_NOT_FOUND : k - 1;
+}
+
+void eytzinger_lower_bound_int_batch(const int *eyt, size_t n, const int *targets,
+                                     size_t m, size_t *out) {
+    if (eyt == NULL || targets == NULL || out == NULL) return;
+
+    size_t depth = 0;
+    for (size_t v = n; v > 0; v >>= 1) depth++;
+
+    for (size_t j0 = 0; j0 < m; j0 += SEARCH_BATCH_WIDTH) {
+        size_t w = (m - j0 < SEARCH_BATCH_WIDTH) ? m - j0 : SEARCH_BATCH_WIDTH;
+        size_t k[SEARCH_BATCH_WIDTH];
+        for (size_t t = 0; t < w; t++) k[t] = 1;
+
+        for (size_t level = 0; level < depth; level++) {
+            for (size_t t = 0; t < w; t++) {
+                if (k[t] > n) continue;
+                k[t] = 2 * k[t] + (eyt[k[t] - 1] < targets[j0 + t] ? 1 : 0);
+                if (k[t] <= n) SEARCH_PREFETCH(eyt + k[t] - 1);
+            }
+        }
+        for (size_t t = 0; t < w; t++) {
+            size_t r = eytzinger_unwind(k[t]);
+            out[j0 + t] = (r == 0) ? SEARCH_NOT_FOUND : r - 1;
+        }
+    }
+}
@@ -12,8 +12,12 @@
  */
 
 #include "algorithms/sorting.h"
+#include "data_structures/pdqsort.h"
+#include "data_structures/instrument.h"
+#include "data_structures/thread_pool.h"
 
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <math.h>
 
@@ -21,7 +25,11 @@
 // HELPERS INTERNOS
 // ============================================================================
 
+// Comparação contada como SORTING.comparisons (instrument.h)
+#define SORT_CMP(a, b) (DS_COUNT(SORTING, COMPARISONS, 1), cmp((a), (b)))
+
 static inline void swap_elements(void *a, void *b, size_t size) {
+    DS_COUNT(SORTING, SWAPS, 1);
     unsigned char tmp[size];
     memcpy(tmp, a, size);
     memcpy(a, b, size);
@@ -42,13 +50,14 @@ static inline const void *celem_at(const void *arr, size_t i, size_t size) {
 
 void bubble_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
     if (arr == NULL || cmp == NULL || n <= 1) return;
+    DS_TIMER_SCOPE(SORT);
 
     for (size_t i = 0; i < n - 1; i++) {
         bool swapped = false;
         for (size_t j = 0; j < n - 1 - i; j++) {
             void *a = elem_at(arr, j, elem_size);
             void *b = elem_at(arr, j + 1, elem_size);
-            if (cmp(a, b) > 0) {
+            if (SORT_CMP(a, b) > 0) {
                 swap_elements(a, b, elem_size);
                 swapped = true;
             }
@@ -63,11 +72,12 @@ void bubble_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
 
 void selection_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
     if (arr == NULL || cmp == NULL || n <= 1) return;
+    DS_TIMER_SCOPE(SORT);
 
     for (size_t i = 0; i < n - 1; i++) {
         size_t min_idx = i;
         for (size_t j = i + 1; j < n; j++) {
-            if (cmp(elem_at(arr, j, elem_size), elem_at(arr, min_idx, elem_size)) < 0) {
+            if (SORT_CMP(elem_at(arr, j, elem_size), elem_at(arr, min_idx, elem_size)) < 0) {
                 min_idx = j;
             }
         }
@@ -83,13 +93,14 @@ void selection_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
 
 void insertion_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
     if (arr == NULL || cmp == NULL || n <= 1) return;
+    DS_TIMER_SCOPE(SORT);
 
     unsigned char key[elem_size];
 
     for (size_t i = 1; i < n; i++) {
         memcpy(key, elem_at(arr, i, elem_size), elem_size);
         size_t j = i;
-        while (j > 0 && cmp(elem_at(arr, j - 1, elem_size), key) > 0) {
+        while (j > 0 && SORT_CMP(elem_at(arr, j - 1, elem_size), key) > 0) {
             memcpy(elem_at(arr, j, elem_size), elem_at(arr, j - 1, elem_size), elem_size);
             j--;
         }
@@ -103,6 +114,7 @@ void insertion_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
 
 void shell_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
     if (arr == NULL || cmp == NULL || n <= 1) return;
+    DS_TIMER_SCOPE(SORT);
 
     size_t gap = 1;
     while (gap < n / 3) gap = gap * 3 + 1;
@@ -113,7 +125,7 @@ void shell_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
         for (size_t i = gap; i < n; i++) {
             memcpy(key, elem_at(arr, i, elem_size), elem_size);
             size_t j = i;
-            while (j >= gap && cmp(elem_at(arr, j - gap, elem_size), key) > 0) {
+            while (j >= gap && SORT_CMP(elem_at(arr, j - gap, elem_size), key) > 0) {
                 memcpy(elem_at(arr, j, elem_size), elem_at(arr, j - gap, elem_size), elem_size);
                 j -= gap;
             }
@@ -140,7 +152,7 @@ static void merge(void *arr, size_t left, size_t mid, size_t right,
 
     size_t i = 0, j = 0, k = left;
     while (i < n1 && j < n2) {
-        if (cmp(L + i * elem_size, R + j * elem_size) <= 0) {
+        if (SORT_CMP(L + i * elem_size, R + j * elem_size) <= 0) {
             memcpy(elem_at(arr, k, elem_size), L + i * elem_size, elem_size);
             i++;
         } else {
@@ -171,6 +183,7 @@ static void merge_sort_recursive(void *arr, size_t left, size_t right,
 
 void merge_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
     if (arr == NULL || cmp == NULL || n <= 1) return;
+    DS_TIMER_SCOPE(SORT);
 
     void *temp = malloc(n * elem_size);
     if (temp == NULL) return;
@@ -180,59 +193,23 @@ void merge_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
 }
 
 // ============================================================================
-// QUICK SORT - Cormen S7 (PARTITION p. 171, median-of-three)
+// QUICK SORT - pdqsort (Peters 2021) sobre Cormen S7
 // ============================================================================
 
-static size_t median_of_three(void *arr, size_t lo, size_t hi,
-                               size_t elem_size, CompareFn cmp) {
-    size_t mid = lo + (hi - lo) / 2;
-    if (cmp(elem_at(arr, lo, elem_size), elem_at(arr, mid, elem_size)) > 0)
-        swap_elements(elem_at(arr, lo, elem_size), elem_at(arr, mid, elem_size), elem_size);
-    if (cmp(elem_at(arr, lo, elem_size), elem_at(arr, hi, elem_size)) > 0)
-        swap_elements(elem_at(arr, lo, elem_size), elem_at(arr, hi, elem_size), elem_size);
-    if (cmp(elem_at(arr, mid, elem_size), elem_at(arr, hi, elem_size)) > 0)
-        swap_elements(elem_at(arr, mid, elem_size), elem_at(arr, hi, elem_size), elem_size);
-    return mid;
-}
-
-static size_t partition(void *arr, size_t lo, size_t hi,
-                        size_t elem_size, CompareFn cmp) {
-    size_t pivot_idx = median_of_three(arr, lo, hi, elem_size, cmp);
-    swap_elements(elem_at(arr, pivot_idx, elem_size), elem_at(arr, hi, elem_size), elem_size);
-
-    void *pivot = elem_at(arr, hi, elem_size);
-    size_t i = lo;
-
-    for (size_t j = lo; j < hi; j++) {
-        if (cmp(elem_at(arr, j, elem_size), pivot) <= 0) {
-            swap_elements(elem_at(arr, i, elem_size), elem_at(arr, j, elem_size), elem_size);
-            i++;
-        }
-    }
-    swap_elements(elem_at(arr, i, elem_size), elem_at(arr, hi, elem_size), elem_size);
-    return i;
-}
-
-static void quick_sort_recursive(void *arr, size_t lo, size_t hi,
-                                  size_t elem_size, CompareFn cmp) {
-    if (lo >= hi) return;
-
-    if (hi - lo < 16) {
-        unsigned char *sub = (unsigned char *)arr + lo * elem_size;
-        insertion_sort(sub, hi - lo + 1, elem_size, cmp);
-        return;
-    }
-
-    size_t p = partition(arr, lo, hi, elem_size, cmp);
-    if (p > 0) quick_sort_recursive(arr, lo, p - 1, elem_size, cmp);
-    quick_sort_recursive(arr, p + 1, hi, elem_size, cmp);
-}
-
 void quick_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
     if (arr == NULL || cmp == NULL || n <= 1) return;
-    quick_sort_recursive(arr, 0, n - 1, elem_size, cmp);
+    ds_pdqsort(arr, n, elem_size, cmp);
 }
 
+// ============================================================================
+// KERNELS ESPECIALIZADOS POR TIPO
+// ============================================================================
+
+// Particoes abaixo de 24 elementos: rede de ordenacao (sorting_network.c)
+SORT_DEFINE_WITH_BASE(int, int, SORT_LESS_DEFAULT, sort_small_int)
+SORT_DEFINE(double)
+SORT_DEFINE(uint64_t)
+
 // ============================================================================
 // HEAP SORT - Cormen S6.4 (HEAPSORT p. 160)
 // ============================================================================
@@ -245,9 +222,9 @@ static void sift_down(void *arr, size_t n, size_t i, size_t elem_size, CompareFn
         size_t right = 2 * largest + 2;
         size_t next = largest;
 
-        if (left < n && cmp(elem_at(arr, left, elem_size), elem_at(arr, next, elem_size)) > 0)
+        if (left < n && SORT_CMP(elem_at(arr, left, elem_size), elem_at(arr, next, elem_size)) > 0)
             next = left;
-        if (right < n && cmp(elem_at(arr, right, elem_size), elem_at(arr, next, elem_size)) > 0)
+        if (right < n && SORT_CMP(elem_at(arr, right, elem_size), elem_at(arr, next, elem_size)) > 0)
             next = right;
 
         if (next == largest) break;
@@ -258,6 +235,7 @@ static void sift_down(void *arr, size_t n, size_t i, size_t elem_size, CompareFn
 
 void heap_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp) {
     if (arr == NULL || cmp == NULL || n <= 1) return;
+    DS_TIMER_SCOPE(SORT);
 
     for (size_t i = n / 2; i > 0; i--) {
         sift_down(arr, n, i - 1, elem_size, cmp);
@@ -339,6 +317,176 @@ void radix_sort(int *arr, size_t n) {
     }
 }
 
+// ============================================================================
+// RADIX SORT LSD BASE 256 - chaves de 32/64 bits, float/double, chave-valor
+// ============================================================================
+
+#define RADIX_PARALLEL_MIN ((size_t)1 << 16)   // histograma paralelo a partir daqui
+
+// Histogramas por bloco (radix_hist_range_T): bloco b cobre
+// [b * n / blocks, (b + 1) * n / blocks) e escreve em hists[b]
+typedef struct {
+    const unsigned char *keys;
+    size_t n;
+    size_t blocks;
+    size_t *hists;                  // blocks x bytes x 256
+} RadixHistJob;
+
+#define RADIX_SIGN32 ((uint32_t)1 << 31)
+#define RADIX_SIGN64 ((uint64_t)1 << 63)
+
+// Transformacoes para ordem de inteiro sem sinal (aplicadas in-place via
+// memcpy: o array original pode ser de float/double)
+static void radix_encode(RadixKeyType type, unsigned char *keys, size_t n, bool decode) {
+    for (size_t i = 0; i < n; i++) {
+        if (type == RADIX_KEY_FLOAT) {
+            uint32_t b;
+            memcpy(&b, keys + i * 4, 4);
+            if (!decode) b = (b & RADIX_SIGN32) ? ~b : (b ^ RADIX_SIGN32);
+            else b = (b & RADIX_SIGN32) ? (b ^ RADIX_SIGN32) : ~b;
+            memcpy(keys + i * 4, &b, 4);
+        } else {
+            uint64_t b;
+            memcpy(&b, keys + i * 8, 8);
+            if (type == RADIX_KEY_I64) {
+                b ^= RADIX_SIGN64;
+            } else if (!decode) {
+                b = (b & RADIX_SIGN64) ? ~b : (b ^ RADIX_SIGN64);
+            } else {
+                b = (b & RADIX_SIGN64) ? (b ^ RADIX_SIGN64) : ~b;
+            }
+            memcpy(keys + i * 8, &b, 8);
+        }
+    }
+}
+
+// Nucleo para chaves sem sinal de tipo T: um passo de contagem para todos os
+// digitos, passos com digito constante pulados, buffers alternados.
+// Cargas e escritas por memcpy (sem violar aliasing do array do chamador).
+#define RADIX_DEFINE_CORE(T)                                                    \
+static void radix_hist_range_##T(void *ctx, size_t lo, size_t hi) {             \
+    const RadixHistJob *job = ctx;                                              \
+    for (size_t b = lo; b < hi; b++) {                                          \
+        size_t (*local)[256] = (size_t (*)[256])(job->hists + b * sizeof(T) * 256); \
+        for (size_t i = b * job->n / job->blocks; i < (b + 1) * job->n / job->blocks; i++) { \
+            T k;                                                                \
+            memcpy(&k, job->keys + i * sizeof(T), sizeof(T));                   \
+            for (size_t d = 0; d < sizeof(T); d++) {                            \
+                local[d][(k >> (8 * d)) & 0xFF]++;                              \
+            }                                                                   \
+        }                                                                       \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+static void radix_histograms_##T(const unsigned char *keys, size_t n,            \
+                                 size_t (*hist)[256], size_t threads) {          \
+    size_t blocks = (ds_parallel_enabled(threads) && n >= RADIX_PARALLEL_MIN) ? threads : 1; \
+    size_t *hists = (blocks > 1) ? (size_t *)calloc(blocks * sizeof(T) * 256, sizeof(size_t)) : NULL; \
+    if (hists == NULL) {                                                        \
+        RadixHistJob job = { keys, n, 1, &hist[0][0] };                         \
+        radix_hist_range_##T(&job, 0, 1);                                       \
+        return;                                                                 \
+    }                                                                           \
+    RadixHistJob job = { keys, n, blocks, hists };                              \
+    ds_parallel_for_threads(threads, 0, blocks, 1, radix_hist_range_##T, &job); \
+    for (size_t b = 0; b < blocks; b++) {                                       \
+        const size_t *local = hists + b * sizeof(T) * 256;                      \
+        for (size_t i = 0; i < sizeof(T) * 256; i++) (&hist[0][0])[i] += local[i]; \
+    }                                                                           \
+    free(hists);                                                                \
+}                                                                               \
+                                                                                \
+static void radix_core_##T(unsigned char *keys, unsigned char *values, size_t n, \
+                           size_t value_size, size_t threads) {                 \
+    size_t (*hist)[256] = (size_t (*)[256])calloc(sizeof(T), sizeof(*hist));   \
+    unsigned char *kbuf = (unsigned char *)malloc(n * sizeof(T));               \
+    unsigned char *vbuf = (values != NULL) ? (unsigned char *)malloc(n * value_size) : NULL; \
+    if (hist == NULL || kbuf == NULL || (values != NULL && vbuf == NULL)) {     \
+        free(hist);                                                             \
+        free(kbuf);                                                             \
+        free(vbuf);                                                             \
+        return;                                                                 \
+    }                                                                           \
+                                                                                \
+    radix_histograms_##T(keys, n, hist, threads);                               \
+                                                                                \
+    T first;                                                                    \
+    memcpy(&first, keys, sizeof(T));                                            \
+    unsigned char *ksrc = keys, *kdst = kbuf;                                   \
+    unsigned char *vsrc = values, *vdst = vbuf;                                 \
+    for (size_t d = 0; d < sizeof(T); d++) {                                    \
+        /* Todas as chaves com o mesmo byte d: passo nao altera a ordem */     \
+        if (hist[d][(first >> (8 * d)) & 0xFF] == n) continue;                  \
+                                                                                \
+        size_t offset[256];                                                     \
+        size_t sum = 0;                                                         \
+        for (size_t b = 0; b < 256; b++) {                                      \
+            offset[b] = sum;                                                    \
+            sum += hist[d][b];                                                  \
+        }                                                                       \
+        for (size_t i = 0; i < n; i++) {                                        \
+            T k;                                                                \
+            memcpy(&k, ksrc + i * sizeof(T), sizeof(T));                        \
+            size_t pos = offset[(k >> (8 * d)) & 0xFF]++;                       \
+            memcpy(kdst + pos * sizeof(T), &k, sizeof(T));                      \
+            if (vsrc != NULL) {                                                 \
+                memcpy(vdst + pos * value_size, vsrc + i * value_size, value_size); \
+            }                                                                   \
+        }                                                                       \
+        unsigned char *t = ksrc; ksrc = kdst; kdst = t;                         \
+        t = vsrc; vsrc = vdst; vdst = t;                                        \
+    }                                                                           \
+                                                                                \
+    if (ksrc != keys) {                                                         \
+        memcpy(keys, ksrc, n * sizeof(T));                                      \
+        if (values != NULL) memcpy(values, vsrc, n * value_size);               \
+    }                                                                           \
+    free(hist);                                                                 \
+    free(kbuf);                                                                 \
+    free(vbuf);                                                                 \
+}
+
+RADIX_DEFINE_CORE(uint32_t)
+RADIX_DEFINE_CORE(uint64_t)
+
+void radix_sort_kv(RadixKeyType type, void *keys, void *values, size_t n,
+                   size_t value_size, size_t num_threads) {
+    if (keys == NULL || n <= 1 || (values != NULL && value_size == 0)) return;
+
+    size_t threads = ds_resolve_threads(num_threads);
+
+    unsigned char *k = (unsigned char *)keys;
+    bool transform = (type == RADIX_KEY_I64 || type == RADIX_KEY_FLOAT ||
+                      type == RADIX_KEY_DOUBLE);
+    if (transform) radix_encode(type, k, n, false);
+    if (type == RADIX_KEY_U32 || type == RADIX_KEY_FLOAT) {
+        radix_core_uint32_t(k, (unsigned char *)values, n, value_size, threads);
+    } else {
+        radix_core_uint64_t(k, (unsigned char *)values, n, value_size, threads);
+    }
+    if (transform) radix_encode(type, k, n, true);
+}
+
+void radix_sort_u32(uint32_t *keys, size_t n, size_t num_threads) {
+    radix_sort_kv(RADIX_KEY_U32, keys, NULL, n, 0, num_threads);
+}
+
+void radix_sort_u64(uint64_t *keys, size_t n, size_t num_threads) {
+    radix_sort_kv(RADIX_KEY_U64, keys, NULL, n, 0, num_threads);
+}
+
+void radix_sort_i64(int64_t *keys, size_t n, size_t num_threads) {
+    radix_sort_kv(RADIX_KEY_I64, keys, NULL, n, 0, num_threads);
+}
+
+void radix_sort_float(float *keys, size_t n, size_t num_threads) {
+    radix_sort_kv(RADIX_KEY_FLOAT, keys, NULL, n, 0, num_threads);
+}
+
+void radix_sort_double(double *keys, size_t n, size_t num_threads) {
+    radix_sort_kv(RADIX_KEY_DOUBLE, keys, NULL, n, 0, num_threads);
+}
+
 // ============================================================================
 // BUCKET SORT - Cormen S8.4 (para doubles em [0.0, 1.0))
 // ============================================================================
@@ -394,6 +542,301 @@ void bucket_sort(double *arr, size_t n) {
     free(buckets);
 }
 
+// ============================================================================
+// ORDENACAO PARALELA - merge sort com intercalacao paralela e sample sort
+// ============================================================================
+
+#define PAR_SORT_GRAIN 8192             // folhas do merge sort: serial
+#define PAR_MERGE_GRAIN 8192            // intercalacoes menores: serial
+#define SAMPLE_SORT_MIN ((size_t)1 << 16)  // abaixo disso: ds_pdqsort serial
+#define SAMPLE_OVERSAMPLING 32          // amostras por bucket
+#define SAMPLE_MAX_BUCKETS 1024         // intervalos entre splitters
+
+// Primeiro i com !(a[i] < key)
+static size_t lower_bound_elem(const void *a, size_t n, const void *key,
+                               size_t elem_size, CompareFn cmp) {
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (SORT_CMP(celem_at(a, mid, elem_size), key) < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// Primeiro i com key < a[i]
+static size_t upper_bound_elem(const void *a, size_t n, const void *key,
+                               size_t elem_size, CompareFn cmp) {
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (SORT_CMP(key, celem_at(a, mid, elem_size)) < 0) hi = mid;
+        else lo = mid + 1;
+    }
+    return lo;
+}
+
+// Intercala a e b em out; empates saem de a (estavel)
+static void merge_into(const unsigned char *a, size_t na, const unsigned char *b, size_t nb,
+                       unsigned char *out, size_t elem_size, CompareFn cmp) {
+    size_t i = 0, j = 0;
+    while (i < na && j < nb) {
+        if (SORT_CMP(b + j * elem_size, a + i * elem_size) < 0) {
+            memcpy(out, b + j * elem_size, elem_size);
+            j++;
+        } else {
+            memcpy(out, a + i * elem_size, elem_size);
+            i++;
+        }
+        out += elem_size;
+    }
+    memcpy(out, a + i * elem_size, (na - i) * elem_size);
+    out += (na - i) * elem_size;
+    memcpy(out, b + j * elem_size, (nb - j) * elem_size);
+}
+
+// Argumentos de uma tarefa de intercalacao (merge_task)
+typedef struct {
+    const unsigned char *a;
+    size_t na;
+    const unsigned char *b;
+    size_t nb;
+    unsigned char *out;
+    size_t elem_size;
+    CompareFn cmp;
+} MergeJob;
+
+static void merge_task(void *arg);
+
+// Divide a maior sequencia ao meio e a outra por busca binaria: as duas
+// metades da saida sao independentes (Cormen S27.3, P-MERGE)
+static void merge_parallel(const MergeJob *job) {
+    const unsigned char *a = job->a, *b = job->b;
+    size_t na = job->na, nb = job->nb;
+    size_t elem_size = job->elem_size;
+    CompareFn cmp = job->cmp;
+    if (na + nb <= PAR_MERGE_GRAIN) {
+        merge_into(a, na, b, nb, job->out, elem_size, cmp);
+        return;
+    }
+
+    // Empates: os de a ficam antes dos de b nas duas escolhas
+    size_t ia, ib;
+    if (na >= nb) {
+        ia = na / 2;
+        ib = lower_bound_elem(b, nb, a + ia * elem_size, elem_size, cmp);
+    } else {
+        ib = nb / 2;
+        ia = upper_bound_elem(a, na, b + ib * elem_size, elem_size, cmp);
+    }
+
+    MergeJob low = { a, ia, b, ib, job->out, elem_size, cmp };
+    MergeJob high = { a + ia * elem_size, na - ia, b + ib * elem_size, nb - ib,
+                      job->out + (ia + ib) * elem_size, elem_size, cmp };
+    ds_parallel_invoke(merge_task, &high, merge_task, &low);
+}
+
+static void merge_task(void *arg) {
+    merge_parallel(arg);
+}
+
+// Argumentos de uma tarefa de ordenacao (merge_sort_task)
+typedef struct {
+    unsigned char *src;
+    unsigned char *dst;
+    size_t n;
+    bool to_src;
+    size_t elem_size;
+    CompareFn cmp;
+} MergeSortJob;
+
+// Ordena src[0, n); o resultado fica em src (to_src) ou em dst. As metades
+// alternam entre os dois buffers: cada nivel faz uma unica intercalacao.
+static void merge_sort_task(void *arg) {
+    const MergeSortJob *job = arg;
+    unsigned char *src = job->src, *dst = job->dst;
+    size_t n = job->n, elem_size = job->elem_size;
+    CompareFn cmp = job->cmp;
+    if (n <= PAR_SORT_GRAIN) {
+        if (n > 1) merge_sort_recursive(src, 0, n - 1, elem_size, cmp, dst);
+        if (!job->to_src) memcpy(dst, src, n * elem_size);
+        return;
+    }
+
+    size_t h = n / 2;
+    MergeSortJob low = { src, dst, h, !job->to_src, elem_size, cmp };
+    MergeSortJob high = { src + h * elem_size, dst + h * elem_size, n - h, !job->to_src,
+                          elem_size, cmp };
+    ds_parallel_invoke(merge_sort_task, &high, merge_sort_task, &low);
+
+    MergeJob merge = job->to_src
+        ? (MergeJob){ dst, h, dst + h * elem_size, n - h, src, elem_size, cmp }
+        : (MergeJob){ src, h, src + h * elem_size, n - h, dst, elem_size, cmp };
+    merge_parallel(&merge);
+}
+
+// Estado compartilhado pelas fases do sample sort
+typedef struct {
+    unsigned char *arr;
+    unsigned char *out;
+    size_t n;
+    size_t elem_size;
+    CompareFn cmp;
+    const unsigned char *splitters;
+    size_t num_splitters;
+    size_t num_buckets;
+    size_t blocks;
+    uint16_t *ids;
+    size_t *counts;                 // blocks x num_buckets
+    const size_t *bucket_start;
+} SampleSortJob;
+
+// Fase 1: classifica cada bloco e conta por bucket
+static void sample_classify_range(void *ctx, size_t lo, size_t hi) {
+    const SampleSortJob *job = ctx;
+    CompareFn cmp = job->cmp;
+    size_t n = job->n, elem_size = job->elem_size, num_splitters = job->num_splitters;
+    for (size_t b = lo; b < hi; b++) {
+        size_t *cnt = job->counts + b * job->num_buckets;
+        for (size_t i = b * n / job->blocks; i < (b + 1) * n / job->blocks; i++) {
+            const unsigned char *e = job->arr + i * elem_size;
+            size_t j = lower_bound_elem(job->splitters, num_splitters, e, elem_size, cmp);
+            size_t id = (j < num_splitters &&
+                         SORT_CMP(e, job->splitters + j * elem_size) >= 0) ? 2 * j + 1 : 2 * j;
+            job->ids[i] = (uint16_t)id;
+            cnt[id]++;
+        }
+    }
+}
+
+// Fase 3: distribui cada bloco a partir das suas posicoes de escrita
+static void sample_scatter_range(void *ctx, size_t lo, size_t hi) {
+    const SampleSortJob *job = ctx;
+    size_t n = job->n, elem_size = job->elem_size;
+    for (size_t b = lo; b < hi; b++) {
+        size_t *next = job->counts + b * job->num_buckets;
+        for (size_t i = b * n / job->blocks; i < (b + 1) * n / job->blocks; i++) {
+            memcpy(job->out + (next[job->ids[i]]++) * elem_size, job->arr + i * elem_size,
+                   elem_size);
+        }
+    }
+}
+
+// Fase 4: ordena os buckets (os de chaves iguais ja estao prontos) e devolve
+static void sample_bucket_range(void *ctx, size_t lo, size_t hi) {
+    const SampleSortJob *job = ctx;
+    size_t elem_size = job->elem_size;
+    for (size_t bk = lo; bk < hi; bk++) {
+        size_t first = job->bucket_start[bk];
+        size_t len = job->bucket_start[bk + 1] - first;
+        if (bk % 2 == 0) ds_pdqsort(job->out + first * elem_size, len, elem_size, job->cmp);
+        memcpy(job->arr + first * elem_size, job->out + first * elem_size, len * elem_size);
+    }
+}
+
+// Sample sort; false = falha de alocacao (arr intacto)
+static bool sample_sort_run(unsigned char *arr, size_t n, size_t elem_size, CompareFn cmp,
+                            size_t threads) {
+    size_t k = 4 * threads;
+    if (k > SAMPLE_MAX_BUCKETS) k = SAMPLE_MAX_BUCKETS;
+    size_t num_splitters = k - 1;
+    size_t num_buckets = 2 * k - 1;     // pares: entre splitters; impares: iguais ao splitter
+    size_t num_samples = k * SAMPLE_OVERSAMPLING;
+    size_t blocks = threads;
+
+    unsigned char *samples = (unsigned char *)malloc(num_samples * elem_size);
+    unsigned char *out = (unsigned char *)malloc(n * elem_size);
+    uint16_t *ids = (uint16_t *)malloc(n * sizeof(uint16_t));
+    size_t *counts = (size_t *)calloc(blocks * num_buckets, sizeof(size_t));
+    size_t *bucket_start = (size_t *)malloc((num_buckets + 1) * sizeof(size_t));
+    if (samples == NULL || out == NULL || ids == NULL || counts == NULL || bucket_start == NULL) {
+        free(samples);
+        free(out);
+        free(ids);
+        free(counts);
+        free(bucket_start);
+        return false;
+    }
+
+    // Amostra pseudoaleatoria deterministica (xorshift64) e splitters
+    uint64_t x = 0x9E3779B97F4A7C15ull ^ (uint64_t)n;
+    for (size_t i = 0; i < num_samples; i++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        memcpy(samples + i * elem_size, arr + (size_t)(x % n) * elem_size, elem_size);
+    }
+    ds_pdqsort(samples, num_samples, elem_size, cmp);
+    unsigned char *splitters = samples;
+    for (size_t j = 0; j < num_splitters; j++) {
+        memmove(splitters + j * elem_size,
+                samples + (j + 1) * SAMPLE_OVERSAMPLING * elem_size, elem_size);
+    }
+
+    SampleSortJob job = {
+        .arr = arr, .out = out, .n = n, .elem_size = elem_size, .cmp = cmp,
+        .splitters = splitters, .num_splitters = num_splitters,
+        .num_buckets = num_buckets, .blocks = blocks,
+        .ids = ids, .counts = counts, .bucket_start = bucket_start
+    };
+
+    // 1. Classifica e conta (um bloco por thread)
+    ds_parallel_for_threads(threads, 0, blocks, 1, sample_classify_range, &job);
+
+    // 2. Posicao de escrita de cada (bloco, bucket)
+    size_t pos = 0;
+    for (size_t bk = 0; bk < num_buckets; bk++) {
+        bucket_start[bk] = pos;
+        for (size_t b = 0; b < blocks; b++) {
+            size_t c = counts[b * num_buckets + bk];
+            counts[b * num_buckets + bk] = pos;
+            pos += c;
+        }
+    }
+    bucket_start[num_buckets] = n;
+
+    // 3. Distribui; 4. ordena os buckets (um por tarefa: tamanhos variam)
+    ds_parallel_for_threads(threads, 0, blocks, 1, sample_scatter_range, &job);
+    ds_parallel_for_threads(threads, 0, num_buckets, 1, sample_bucket_range, &job);
+
+    free(samples);
+    free(out);
+    free(ids);
+    free(counts);
+    free(bucket_start);
+    return true;
+}
+
+void parallel_merge_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp,
+                         size_t num_threads) {
+    if (arr == NULL || cmp == NULL || n <= 1) return;
+
+    if (ds_parallel_enabled(num_threads) && n > PAR_SORT_GRAIN) {
+        void *temp = malloc(n * elem_size);
+        if (temp == NULL) return;
+
+        MergeSortJob job = { (unsigned char *)arr, (unsigned char *)temp, n, true,
+                             elem_size, cmp };
+        merge_sort_task(&job);
+
+        free(temp);
+        return;
+    }
+    merge_sort(arr, n, elem_size, cmp);
+}
+
+void parallel_sample_sort(void *arr, size_t n, size_t elem_size, CompareFn cmp,
+                          size_t num_threads) {
+    if (arr == NULL || cmp == NULL || n <= 1) return;
+
+    size_t threads = ds_resolve_threads(num_threads);
+    if (ds_parallel_enabled(threads) && n >= SAMPLE_SORT_MIN &&
+        sample_sort_run((unsigned char *)arr, n, elem_size, cmp, threads)) {
+        return;
+    }
+    ds_pdqsort(arr, n, elem_size, cmp);
+}
+
 // ============================================================================
 // IS_SORTED - Utilidade
 // ============================================================================
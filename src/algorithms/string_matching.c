@@ -1,12 +1,14 @@
 /**
  * @file string_matching.c
- * @brief Implementacao de 4 algoritmos classicos de busca em strings
+ * @brief Implementacao de 4 algoritmos classicos de busca em strings, busca SIMD e Aho-Corasick
  *
  * Referencias:
  * - Cormen et al. (2009), Chapters 32.1-32.4
  * - Knuth, Morris, Pratt (1977), "Fast pattern matching in strings"
  * - Boyer, Moore (1977), "A fast string searching algorithm"
  * - Karp, Rabin (1987), "Efficient randomized pattern-matching algorithms"
+ * - Aho, Corasick (1975), "Efficient string matching: an aid to bibliographic search"
+ * - Mula, W. (2016), "SIMD-friendly algorithms for substring searching"
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
@@ -14,6 +16,7 @@
 
 #include "algorithms/string_matching.h"
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -21,6 +24,28 @@
 #define RK_BASE 256
 #define RK_PRIME 101
 
+// Selecao automatica (string_search_choose): limites medidos em texto
+// aleatorio de alfabetos 2, 4 e 90, com e sem kernel vetorial
+#define SM_SMALL_ALPHABET 4
+#define SM_SMALL_ALPHABET_MIN_LEN 8
+#define SM_BNDM_MIN_LEN 32
+#define SM_HORSPOOL_MIN_LEN 32
+
+// Busca SIMD: AVX2 escolhido em tempo de execucao; SSE2/NEON em tempo de
+// compilacao. Defina STRING_MATCHING_NO_SIMD para forcar o laco escalar.
+#if !defined(STRING_MATCHING_NO_SIMD) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SM_USE_AVX2 1
+#if defined(__SSE2__)
+#define SM_USE_SSE2 1
+#endif
+#elif !defined(STRING_MATCHING_NO_SIMD) && defined(__GNUC__) && \
+    defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SM_USE_NEON 1
+#endif
+
 // ============================================================================
 // MATCH RESULT
 // ============================================================================
@@ -117,46 +142,11 @@ void kmp_compute_failure(const char *pattern, size_t m, size_t *failure) {
     }
 }
 
-size_t kmp_search(const char *text, const char *pattern) {
-    if (text == NULL || pattern == NULL) return SM_NOT_FOUND;
-
-    size_t n = strlen(text);
-    size_t m = strlen(pattern);
-
-    if (m == 0) return 0;
-    if (m > n) return SM_NOT_FOUND;
-
-    size_t *failure = malloc(m * sizeof(size_t));
-    if (failure == NULL) return SM_NOT_FOUND;
-
-    kmp_compute_failure(pattern, m, failure);
-
-    size_t q = 0;
-    for (size_t i = 0; i < n; i++) {
-        while (q > 0 && pattern[q] != text[i]) {
-            q = failure[q - 1];
-        }
-        if (pattern[q] == text[i]) {
-            q++;
-        }
-        if (q == m) {
-            free(failure);
-            return i - m + 1;
-        }
-    }
-
-    free(failure);
-    return SM_NOT_FOUND;
-}
-
-MatchResult kmp_search_all(const char *text, const char *pattern) {
+// Automato KMP: first != 0 para na primeira ocorrencia
+static MatchResult kmp_run(const char *text, size_t n, const char *pattern, size_t m,
+                           bool first, size_t *found) {
     MatchResult result = match_result_create();
-    if (text == NULL || pattern == NULL) return result;
-
-    size_t n = strlen(text);
-    size_t m = strlen(pattern);
-
-    if (m == 0 || m > n) return result;
+    *found = SM_NOT_FOUND;
 
     size_t *failure = malloc(m * sizeof(size_t));
     if (failure == NULL) return result;
@@ -172,6 +162,10 @@ MatchResult kmp_search_all(const char *text, const char *pattern) {
             q++;
         }
         if (q == m) {
+            if (first) {
+                *found = i - m + 1;
+                break;
+            }
             match_result_append(&result, i - m + 1);
             q = failure[q - 1];
         }
@@ -181,57 +175,42 @@ MatchResult kmp_search_all(const char *text, const char *pattern) {
     return result;
 }
 
-// ============================================================================
-// RABIN-KARP - Cormen S32.2
-// ============================================================================
-
-size_t rabin_karp_search(const char *text, const char *pattern) {
+size_t kmp_search_mem(const void *text, size_t n, const void *pattern, size_t m) {
     if (text == NULL || pattern == NULL) return SM_NOT_FOUND;
-
-    size_t n = strlen(text);
-    size_t m = strlen(pattern);
-
     if (m == 0) return 0;
     if (m > n) return SM_NOT_FOUND;
 
-    long long h = 1;
-    for (size_t i = 0; i < m - 1; i++) {
-        h = (h * RK_BASE) % RK_PRIME;
-    }
-
-    long long p_hash = 0;
-    long long t_hash = 0;
-
-    for (size_t i = 0; i < m; i++) {
-        p_hash = (RK_BASE * p_hash + (unsigned char)pattern[i]) % RK_PRIME;
-        t_hash = (RK_BASE * t_hash + (unsigned char)text[i]) % RK_PRIME;
-    }
+    size_t found;
+    kmp_run(text, n, pattern, m, true, &found);
+    return found;
+}
 
-    for (size_t s = 0; s <= n - m; s++) {
-        if (p_hash == t_hash) {
-            if (memcmp(text + s, pattern, m) == 0) {
-                return s;
-            }
-        }
+MatchResult kmp_search_all_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    if (text == NULL || pattern == NULL || m == 0 || m > n) return match_result_create();
 
-        if (s < n - m) {
-            t_hash = (RK_BASE * (t_hash - (unsigned char)text[s] * h) +
-                       (unsigned char)text[s + m]) % RK_PRIME;
-            if (t_hash < 0) t_hash += RK_PRIME;
-        }
-    }
+    size_t found;
+    return kmp_run(text, n, pattern, m, false, &found);
+}
 
-    return SM_NOT_FOUND;
+size_t kmp_search(const char *text, const char *pattern) {
+    if (text == NULL || pattern == NULL) return SM_NOT_FOUND;
+    return kmp_search_mem(text, strlen(text), pattern, strlen(pattern));
 }
 
-MatchResult rabin_karp_search_all(const char *text, const char *pattern) {
-    MatchResult result = match_result_create();
-    if (text == NULL || pattern == NULL) return result;
+MatchResult kmp_search_all(const char *text, const char *pattern) {
+    if (text == NULL || pattern == NULL) return match_result_create();
+    return kmp_search_all_mem(text, strlen(text), pattern, strlen(pattern));
+}
 
-    size_t n = strlen(text);
-    size_t m = strlen(pattern);
+// ============================================================================
+// RABIN-KARP - Cormen S32.2
+// ============================================================================
 
-    if (m == 0 || m > n) return result;
+static MatchResult rabin_karp_run(const unsigned char *text, size_t n,
+                                  const unsigned char *pattern, size_t m,
+                                  bool first, size_t *found) {
+    MatchResult result = match_result_create();
+    *found = SM_NOT_FOUND;
 
     long long h = 1;
     for (size_t i = 0; i < m - 1; i++) {
@@ -242,20 +221,23 @@ MatchResult rabin_karp_search_all(const char *text, const char *pattern) {
     long long t_hash = 0;
 
     for (size_t i = 0; i < m; i++) {
-        p_hash = (RK_BASE * p_hash + (unsigned char)pattern[i]) % RK_PRIME;
-        t_hash = (RK_BASE * t_hash + (unsigned char)text[i]) % RK_PRIME;
+        p_hash = (RK_BASE * p_hash + pattern[i]) % RK_PRIME;
+        t_hash = (RK_BASE * t_hash + text[i]) % RK_PRIME;
     }
 
     for (size_t s = 0; s <= n - m; s++) {
         if (p_hash == t_hash) {
             if (memcmp(text + s, pattern, m) == 0) {
+                if (first) {
+                    *found = s;
+                    break;
+                }
                 match_result_append(&result, s);
             }
         }
 
         if (s < n - m) {
-            t_hash = (RK_BASE * (t_hash - (unsigned char)text[s] * h) +
-                       (unsigned char)text[s + m]) % RK_PRIME;
+            t_hash = (RK_BASE * (t_hash - text[s] * h) + text[s + m]) % RK_PRIME;
             if (t_hash < 0) t_hash += RK_PRIME;
         }
     }
@@ -263,153 +245,881 @@ MatchResult rabin_karp_search_all(const char *text, const char *pattern) {
     return result;
 }
 
+size_t rabin_karp_search_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    if (text == NULL || pattern == NULL) return SM_NOT_FOUND;
+    if (m == 0) return 0;
+    if (m > n) return SM_NOT_FOUND;
+
+    size_t found;
+    rabin_karp_run(text, n, pattern, m, true, &found);
+    return found;
+}
+
+MatchResult rabin_karp_search_all_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    if (text == NULL || pattern == NULL || m == 0 || m > n) return match_result_create();
+
+    size_t found;
+    return rabin_karp_run(text, n, pattern, m, false, &found);
+}
+
+size_t rabin_karp_search(const char *text, const char *pattern) {
+    if (text == NULL || pattern == NULL) return SM_NOT_FOUND;
+    return rabin_karp_search_mem(text, strlen(text), pattern, strlen(pattern));
+}
+
+MatchResult rabin_karp_search_all(const char *text, const char *pattern) {
+    if (text == NULL || pattern == NULL) return match_result_create();
+    return rabin_karp_search_all_mem(text, strlen(text), pattern, strlen(pattern));
+}
+
 // ============================================================================
 // BOYER-MOORE - Cormen S32.3
 // ============================================================================
 
-static void compute_bad_char(const char *pattern, size_t m, int bad_char[ALPHABET_SIZE]) {
+static void compute_bad_char(const unsigned char *pattern, size_t m, ptrdiff_t bad_char[ALPHABET_SIZE]) {
     for (int i = 0; i < ALPHABET_SIZE; i++) {
         bad_char[i] = -1;
     }
     for (size_t i = 0; i < m; i++) {
-        bad_char[(unsigned char)pattern[i]] = (int)i;
+        bad_char[pattern[i]] = (ptrdiff_t)i;
     }
 }
 
-static void compute_good_suffix(const char *pattern, size_t m, size_t *good_suffix) {
-    size_t *suffix = malloc(m * sizeof(size_t));
-    if (suffix == NULL) {
-        for (size_t i = 0; i < m; i++) good_suffix[i] = m;
-        return;
-    }
-
+// suffix[i] = comprimento do maior sufixo de pattern[0..i] que e sufixo do
+// padrao (Charras & Lecroq, "Handbook of Exact String Matching"), O(m)
+static void compute_suffixes(const unsigned char *pattern, ptrdiff_t m, ptrdiff_t *suffix) {
     suffix[m - 1] = m;
-    size_t g = m - 1;
-    size_t f = 0;
-
-    for (size_t i = m - 1; i > 0; i--) {
-        size_t idx = i - 1;
-        if (idx > g && suffix[idx + m - 1 - f] < idx - g) {
-            suffix[idx] = suffix[idx + m - 1 - f];
+    ptrdiff_t g = m - 1;
+    ptrdiff_t f = m - 1;
+    for (ptrdiff_t i = m - 2; i >= 0; i--) {
+        if (i > g && suffix[i + m - 1 - f] < i - g) {
+            suffix[i] = suffix[i + m - 1 - f];
         } else {
-            if (idx < g) g = idx;
-            f = idx;
-            while (g < m && pattern[g] == pattern[g + m - 1 - f]) {
-                if (g == 0) { g--; break; }
-                g--;
-            }
-            suffix[idx] = f - g;
+            if (i < g) g = i;
+            f = i;
+            while (g >= 0 && pattern[g] == pattern[g + m - 1 - f]) g--;
+            suffix[i] = f - g;
         }
     }
+}
+
+// Regra completa do bom sufixo: good_suffix[j] = deslocamento seguro quando
+// pattern[j] falha apos pattern[j+1..m) casar. good_suffix[0] e o periodo
+// do padrao (deslocamento apos uma ocorrencia completa).
+static bool compute_good_suffix(const unsigned char *pattern, size_t m, size_t *good_suffix) {
+    ptrdiff_t *suffix = malloc(m * sizeof(ptrdiff_t));
+    if (suffix == NULL) return false;
+
+    ptrdiff_t pm = (ptrdiff_t)m;
+    compute_suffixes(pattern, pm, suffix);
 
     for (size_t i = 0; i < m; i++) {
         good_suffix[i] = m;
     }
 
+    // Caso 2: so um prefixo do padrao casa com parte do bom sufixo
     size_t j = 0;
-    for (size_t i = m; i > 0; i--) {
-        size_t idx = i - 1;
-        if (suffix[idx] == idx + 1) {
-            while (j < m - 1 - idx) {
-                if (good_suffix[j] == m) {
-                    good_suffix[j] = m - 1 - idx;
-                }
-                j++;
+    for (ptrdiff_t i = pm - 1; i >= 0; i--) {
+        if (suffix[i] == i + 1) {
+            for (; j < (size_t)(pm - 1 - i); j++) {
+                if (good_suffix[j] == m) good_suffix[j] = (size_t)(pm - 1 - i);
             }
         }
     }
 
-    for (size_t i = 0; i < m - 1; i++) {
-        good_suffix[m - 1 - suffix[i]] = m - 1 - i;
+    // Caso 1: o bom sufixo reaparece no padrao precedido de outro caractere
+    for (ptrdiff_t i = 0; i <= pm - 2; i++) {
+        good_suffix[pm - 1 - suffix[i]] = (size_t)(pm - 1 - i);
     }
 
     free(suffix);
+    return true;
 }
 
-size_t boyer_moore_search(const char *text, const char *pattern) {
-    if (text == NULL || pattern == NULL) return SM_NOT_FOUND;
+// Primeira ocorrencia em s >= start com as tabelas ja calculadas
+static size_t bm_find(const unsigned char *text, size_t n, const unsigned char *pattern, size_t m,
+                      const ptrdiff_t *bad_char, const size_t *good_suffix, size_t s) {
+    while (s + m <= n) {
+        size_t j = m;
+        while (j > 0 && pattern[j - 1] == text[s + j - 1]) {
+            j--;
+        }
+        if (j == 0) return s;
 
-    size_t n = strlen(text);
-    size_t m = strlen(pattern);
+        ptrdiff_t bc = (ptrdiff_t)(j - 1) - bad_char[text[s + j - 1]];
+        size_t bc_shift = (bc > 0) ? (size_t)bc : 1;
+        size_t gs_shift = good_suffix[j - 1];
+        s += (bc_shift > gs_shift) ? bc_shift : gs_shift;
+    }
+    return SM_NOT_FOUND;
+}
 
-    if (m == 0) return 0;
-    if (m > n) return SM_NOT_FOUND;
+static MatchResult boyer_moore_run(const unsigned char *text, size_t n,
+                                   const unsigned char *pattern, size_t m,
+                                   bool first, size_t *found) {
+    MatchResult result = match_result_create();
+    *found = SM_NOT_FOUND;
 
-    int bad_char[ALPHABET_SIZE];
+    ptrdiff_t bad_char[ALPHABET_SIZE];
     compute_bad_char(pattern, m, bad_char);
 
     size_t *good_suffix = malloc(m * sizeof(size_t));
-    if (good_suffix == NULL) return SM_NOT_FOUND;
-    compute_good_suffix(pattern, m, good_suffix);
+    if (good_suffix == NULL || !compute_good_suffix(pattern, m, good_suffix)) {
+        free(good_suffix);
+        return result;
+    }
 
-    size_t s = 0;
-    while (s <= n - m) {
-        size_t j = m;
-        while (j > 0 && pattern[j - 1] == text[s + j - 1]) {
-            j--;
+    size_t s = bm_find(text, n, pattern, m, bad_char, good_suffix, 0);
+    if (first) {
+        *found = s;
+    } else {
+        while (s != SM_NOT_FOUND) {
+            match_result_append(&result, s);
+            s = bm_find(text, n, pattern, m, bad_char, good_suffix, s + good_suffix[0]);
         }
+    }
+
+    free(good_suffix);
+    return result;
+}
+
+size_t boyer_moore_search_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    if (text == NULL || pattern == NULL) return SM_NOT_FOUND;
+    if (m == 0) return 0;
+    if (m > n) return SM_NOT_FOUND;
+
+    size_t found;
+    boyer_moore_run(text, n, pattern, m, true, &found);
+    return found;
+}
+
+MatchResult boyer_moore_search_all_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    if (text == NULL || pattern == NULL || m == 0 || m > n) return match_result_create();
+
+    size_t found;
+    return boyer_moore_run(text, n, pattern, m, false, &found);
+}
+
+size_t boyer_moore_search(const char *text, const char *pattern) {
+    if (text == NULL || pattern == NULL) return SM_NOT_FOUND;
+    return boyer_moore_search_mem(text, strlen(text), pattern, strlen(pattern));
+}
+
+MatchResult boyer_moore_search_all(const char *text, const char *pattern) {
+    if (text == NULL || pattern == NULL) return match_result_create();
+    return boyer_moore_search_all_mem(text, strlen(text), pattern, strlen(pattern));
+}
 
-        if (j == 0) {
-            free(good_suffix);
-            return s;
+// ============================================================================
+// SIMD - Mula (2016), filtro de primeiro e ultimo byte
+// ============================================================================
+
+// Todas as funcoes abaixo: m >= 2, busca a partir de i, resultado <= n - m.
+
+// Laco escalar: memchr pelo primeiro byte, depois ultimo byte e memcmp
+static size_t simd_find_scalar(const char *text, size_t n, const char *pattern,
+                               size_t m, size_t i) {
+    while (i + m <= n) {
+        const char *hit = memchr(text + i, pattern[0], n - m + 1 - i);
+        if (hit == NULL) return SM_NOT_FOUND;
+        i = (size_t)(hit - text);
+        if (text[i + m - 1] == pattern[m - 1] &&
+            memcmp(text + i + 1, pattern + 1, m - 2) == 0) {
+            return i;
         }
+        i++;
+    }
+    return SM_NOT_FOUND;
+}
 
-        size_t bc_shift = 0;
-        int bc_val = bad_char[(unsigned char)text[s + j - 1]];
-        if ((int)(j - 1) > bc_val) {
-            bc_shift = (size_t)((int)(j - 1) - bc_val);
-        } else {
-            bc_shift = 1;
+#if defined(SM_USE_AVX2)
+
+#define AVX2_ATTR __attribute__((target("avx2")))
+
+AVX2_ATTR static size_t simd_find_avx2(const char *text, size_t n, const char *pattern,
+                                       size_t m, size_t i) {
+    const __m256i first = _mm256_set1_epi8(pattern[0]);
+    const __m256i last = _mm256_set1_epi8(pattern[m - 1]);
+    for (; i + m + 31 <= n; i += 32) {
+        __m256i bf = _mm256_loadu_si256((const __m256i *)(text + i));
+        __m256i bl = _mm256_loadu_si256((const __m256i *)(text + i + m - 1));
+        __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi8(bf, first), _mm256_cmpeq_epi8(bl, last));
+        uint32_t mask = (uint32_t)_mm256_movemask_epi8(eq);
+        while (mask != 0) {
+            size_t b = (size_t)__builtin_ctz(mask);
+            if (memcmp(text + i + b + 1, pattern + 1, m - 2) == 0) return i + b;
+            mask &= mask - 1;
         }
+    }
+    return simd_find_scalar(text, n, pattern, m, i);
+}
 
-        size_t gs_shift = good_suffix[j - 1];
-        s += (bc_shift > gs_shift) ? bc_shift : gs_shift;
+static bool avx2_available(void) {
+    static int detected = -1;
+    if (detected < 0) {
+        __builtin_cpu_init();
+        detected = __builtin_cpu_supports("avx2") ? 1 : 0;
     }
+    return detected == 1;
+}
 
-    free(good_suffix);
-    return SM_NOT_FOUND;
+#endif
+
+#if defined(SM_USE_SSE2)
+
+static size_t simd_find_sse2(const char *text, size_t n, const char *pattern,
+                             size_t m, size_t i) {
+    const __m128i first = _mm_set1_epi8(pattern[0]);
+    const __m128i last = _mm_set1_epi8(pattern[m - 1]);
+    for (; i + m + 15 <= n; i += 16) {
+        __m128i bf = _mm_loadu_si128((const __m128i *)(text + i));
+        __m128i bl = _mm_loadu_si128((const __m128i *)(text + i + m - 1));
+        __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(bf, first), _mm_cmpeq_epi8(bl, last));
+        unsigned mask = (unsigned)_mm_movemask_epi8(eq);
+        while (mask != 0) {
+            size_t b = (size_t)__builtin_ctz(mask);
+            if (memcmp(text + i + b + 1, pattern + 1, m - 2) == 0) return i + b;
+            mask &= mask - 1;
+        }
+    }
+    return simd_find_scalar(text, n, pattern, m, i);
 }
 
-MatchResult boyer_moore_search_all(const char *text, const char *pattern) {
+#elif defined(SM_USE_NEON)
+
+static size_t simd_find_neon(const char *text, size_t n, const char *pattern,
+                             size_t m, size_t i) {
+    const uint8x16_t first = vdupq_n_u8((uint8_t)pattern[0]);
+    const uint8x16_t last = vdupq_n_u8((uint8_t)pattern[m - 1]);
+    for (; i + m + 15 <= n; i += 16) {
+        uint8x16_t bf = vld1q_u8((const uint8_t *)text + i);
+        uint8x16_t bl = vld1q_u8((const uint8_t *)text + i + m - 1);
+        uint8x16_t eq = vandq_u8(vceqq_u8(bf, first), vceqq_u8(bl, last));
+        // 4 bits por byte: bit b*4 indica a posicao b
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        while (mask != 0) {
+            size_t b = (size_t)__builtin_ctzll(mask) / 4;
+            if (memcmp(text + i + b + 1, pattern + 1, m - 2) == 0) return i + b;
+            mask &= ~(0xFull << (4 * b));
+        }
+    }
+    return simd_find_scalar(text, n, pattern, m, i);
+}
+
+#endif
+
+// Primeira ocorrencia em text[i..n) com o melhor kernel disponivel
+static size_t simd_find(const char *text, size_t n, const char *pattern, size_t m, size_t i) {
+    if (m > n || i > n - m) return SM_NOT_FOUND;
+    if (m == 1) {
+        const char *hit = memchr(text + i, pattern[0], n - i);
+        return (hit != NULL) ? (size_t)(hit - text) : SM_NOT_FOUND;
+    }
+#if defined(SM_USE_AVX2)
+    if (avx2_available()) return simd_find_avx2(text, n, pattern, m, i);
+#endif
+#if defined(SM_USE_SSE2)
+    return simd_find_sse2(text, n, pattern, m, i);
+#elif defined(SM_USE_NEON)
+    return simd_find_neon(text, n, pattern, m, i);
+#else
+    return simd_find_scalar(text, n, pattern, m, i);
+#endif
+}
+
+size_t simd_search_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    if (text == NULL || pattern == NULL) return SM_NOT_FOUND;
+    if (m == 0) return 0;
+    return simd_find(text, n, pattern, m, 0);
+}
+
+MatchResult simd_search_all_mem(const void *text, size_t n, const void *pattern, size_t m) {
     MatchResult result = match_result_create();
-    if (text == NULL || pattern == NULL) return result;
+    if (text == NULL || pattern == NULL || m == 0 || m > n) return result;
 
-    size_t n = strlen(text);
-    size_t m = strlen(pattern);
+    size_t i = simd_find(text, n, pattern, m, 0);
+    while (i != SM_NOT_FOUND) {
+        if (!match_result_append(&result, i)) break;
+        i = simd_find(text, n, pattern, m, i + 1);
+    }
+    return result;
+}
 
-    if (m == 0 || m > n) return result;
+size_t simd_search(const char *text, const char *pattern) {
+    if (text == NULL || pattern == NULL) return SM_NOT_FOUND;
+    return simd_search_mem(text, strlen(text), pattern, strlen(pattern));
+}
 
-    int bad_char[ALPHABET_SIZE];
-    compute_bad_char(pattern, m, bad_char);
+MatchResult simd_search_all(const char *text, const char *pattern) {
+    if (text == NULL || pattern == NULL) return match_result_create();
+    return simd_search_all_mem(text, strlen(text), pattern, strlen(pattern));
+}
 
-    size_t *good_suffix = malloc(m * sizeof(size_t));
-    if (good_suffix == NULL) return result;
-    compute_good_suffix(pattern, m, good_suffix);
+// ============================================================================
+// HORSPOOL, BNDM, SHIFT-OR E PADROES PRE-COMPILADOS
+// ============================================================================
 
-    size_t s = 0;
-    while (s <= n - m) {
+#define SM_BITS 64
+
+struct StringPattern {
+    unsigned char *bytes;
+    size_t m;
+    StringSearchAlgorithm algorithm;
+    size_t *table;              // KMP: falha; Boyer-Moore: bom sufixo
+    union {
+        size_t shift[ALPHABET_SIZE];        // Horspool
+        uint64_t masks[ALPHABET_SIZE];      // BNDM e Shift-Or
+        ptrdiff_t bad_char[ALPHABET_SIZE];  // Boyer-Moore
+    } u;
+};
+
+// Horspool: desloca pelo ultimo byte da janela
+static size_t horspool_find(const StringPattern *sp, const unsigned char *t, size_t n, size_t s) {
+    const unsigned char *p = sp->bytes;
+    size_t m = sp->m;
+    unsigned char last = p[m - 1];
+    while (s + m <= n) {
+        unsigned char c = t[s + m - 1];
+        if (c == last && memcmp(t + s, p, m - 1) == 0) return s;
+        s += sp->u.shift[c];
+    }
+    return SM_NOT_FOUND;
+}
+
+// BNDM: automato de fatores do padrao reverso simulado com bits; le a
+// janela da direita para a esquerda e salta ate o ultimo prefixo visto
+static size_t bndm_find(const StringPattern *sp, const unsigned char *t, size_t n, size_t s) {
+    size_t m = sp->m;
+    const uint64_t high = (uint64_t)1 << (m - 1);
+    while (s + m <= n) {
         size_t j = m;
-        while (j > 0 && pattern[j - 1] == text[s + j - 1]) {
+        size_t last = m;
+        uint64_t d = ~(uint64_t)0;
+        while (d != 0 && j > 0) {
+            d &= sp->u.masks[t[s + j - 1]];
             j--;
+            if (d & high) {
+                if (j == 0) return s;
+                last = j;
+            }
+            d <<= 1;
         }
+        s += last;
+    }
+    return SM_NOT_FOUND;
+}
 
-        if (j == 0) {
-            match_result_append(&result, s);
-            s += good_suffix[0];
-        } else {
-            size_t bc_shift = 0;
-            int bc_val = bad_char[(unsigned char)text[s + j - 1]];
-            if ((int)(j - 1) > bc_val) {
-                bc_shift = (size_t)((int)(j - 1) - bc_val);
-            } else {
-                bc_shift = 1;
+// Shift-Or: um bit por prefixo do padrao, 0 = prefixo casando
+static size_t shift_or_find(const StringPattern *sp, const unsigned char *t, size_t n, size_t s) {
+    size_t m = sp->m;
+    const uint64_t high = (uint64_t)1 << (m - 1);
+    uint64_t d = ~(uint64_t)0;
+    for (size_t i = s; i < n; i++) {
+        d = (d << 1) | sp->u.masks[t[i]];
+        if ((d & high) == 0) return i + 1 - m;
+    }
+    return SM_NOT_FOUND;
+}
+
+static size_t kmp_find(const StringPattern *sp, const unsigned char *t, size_t n, size_t s) {
+    const unsigned char *p = sp->bytes;
+    size_t m = sp->m;
+    size_t q = 0;
+    for (size_t i = s; i < n; i++) {
+        while (q > 0 && p[q] != t[i]) q = sp->table[q - 1];
+        if (p[q] == t[i]) q++;
+        if (q == m) return i + 1 - m;
+    }
+    return SM_NOT_FOUND;
+}
+
+static size_t pattern_find(const StringPattern *sp, const unsigned char *t, size_t n, size_t s) {
+    if (s > n || n - s < sp->m) return SM_NOT_FOUND;
+    switch (sp->algorithm) {
+        case SM_ALGO_KMP:
+            return kmp_find(sp, t, n, s);
+        case SM_ALGO_BOYER_MOORE:
+            return bm_find(t, n, sp->bytes, sp->m, sp->u.bad_char, sp->table, s);
+        case SM_ALGO_HORSPOOL:
+            return horspool_find(sp, t, n, s);
+        case SM_ALGO_BNDM:
+            return bndm_find(sp, t, n, s);
+        case SM_ALGO_SHIFT_OR:
+            return shift_or_find(sp, t, n, s);
+        default:
+            return simd_find((const char *)t, n, (const char *)sp->bytes, sp->m, s);
+    }
+}
+
+// Ha kernel vetorial para simd_find (senao ele cai no laco com memchr)
+static bool simd_vectorized(void) {
+#if defined(SM_USE_SSE2) || defined(SM_USE_NEON)
+    return true;
+#elif defined(SM_USE_AVX2)
+    return avx2_available();
+#else
+    return false;
+#endif
+}
+
+StringSearchAlgorithm string_search_choose(const void *pattern, size_t m) {
+    if (pattern == NULL || m < SM_SMALL_ALPHABET_MIN_LEN) return SM_ALGO_SIMD;
+
+    const unsigned char *p = pattern;
+    bool seen[ALPHABET_SIZE] = {false};
+    size_t distinct = 0;
+    for (size_t i = 0; i < m; i++) {
+        if (!seen[p[i]]) {
+            seen[p[i]] = true;
+            distinct++;
+        }
+    }
+    bool vectorized = simd_vectorized();
+
+    if (distinct > SM_SMALL_ALPHABET) {
+        return (!vectorized && m >= SM_HORSPOOL_MIN_LEN) ? SM_ALGO_HORSPOOL : SM_ALGO_SIMD;
+    }
+
+    // Alfabeto pequeno (DNA, binario): primeiro e ultimo byte casam com
+    // frequencia e a verificacao domina o filtro SIMD
+    if (m >= SM_BNDM_MIN_LEN && m <= SM_BITS) return SM_ALGO_BNDM;
+    if (vectorized) {
+        return (distinct <= 2 && m < SM_BNDM_MIN_LEN) ? SM_ALGO_SHIFT_OR : SM_ALGO_SIMD;
+    }
+    return (m < SM_BNDM_MIN_LEN) ? SM_ALGO_SHIFT_OR : SM_ALGO_BOYER_MOORE;
+}
+
+void string_pattern_destroy(StringPattern *sp) {
+    if (sp == NULL) return;
+    free(sp->bytes);
+    free(sp->table);
+    free(sp);
+}
+
+StringPattern *string_pattern_compile(const void *pattern, size_t m, StringSearchAlgorithm algo) {
+    if (pattern == NULL || m == 0) return NULL;
+    if (algo == SM_ALGO_AUTO) algo = string_search_choose(pattern, m);
+    if ((algo == SM_ALGO_BNDM || algo == SM_ALGO_SHIFT_OR) && m > SM_BITS) return NULL;
+    if (algo < SM_ALGO_KMP || algo > SM_ALGO_SIMD) return NULL;
+
+    StringPattern *sp = calloc(1, sizeof(StringPattern));
+    if (sp == NULL) return NULL;
+    sp->bytes = malloc(m);
+    if (sp->bytes == NULL) {
+        string_pattern_destroy(sp);
+        return NULL;
+    }
+    memcpy(sp->bytes, pattern, m);
+    sp->m = m;
+    sp->algorithm = algo;
+    const unsigned char *p = sp->bytes;
+
+    switch (algo) {
+        case SM_ALGO_KMP:
+        case SM_ALGO_BOYER_MOORE:
+            sp->table = malloc(m * sizeof(size_t));
+            if (sp->table == NULL) break;
+            if (algo == SM_ALGO_KMP) {
+                kmp_compute_failure((const char *)p, m, sp->table);
+                return sp;
             }
+            compute_bad_char(p, m, sp->u.bad_char);
+            if (compute_good_suffix(p, m, sp->table)) return sp;
+            break;
+        case SM_ALGO_HORSPOOL:
+            for (size_t c = 0; c < ALPHABET_SIZE; c++) sp->u.shift[c] = m;
+            for (size_t i = 0; i + 1 < m; i++) sp->u.shift[p[i]] = m - 1 - i;
+            return sp;
+        case SM_ALGO_BNDM:
+            for (size_t i = 0; i < m; i++) sp->u.masks[p[i]] |= (uint64_t)1 << (m - 1 - i);
+            return sp;
+        case SM_ALGO_SHIFT_OR:
+            for (size_t c = 0; c < ALPHABET_SIZE; c++) sp->u.masks[c] = ~(uint64_t)0;
+            for (size_t i = 0; i < m; i++) sp->u.masks[p[i]] &= ~((uint64_t)1 << i);
+            return sp;
+        default:
+            return sp;
+    }
+    string_pattern_destroy(sp);
+    return NULL;
+}
 
-            size_t gs_shift = good_suffix[j - 1];
-            s += (bc_shift > gs_shift) ? bc_shift : gs_shift;
+StringSearchAlgorithm string_pattern_algorithm(const StringPattern *sp) {
+    return (sp != NULL) ? sp->algorithm : SM_ALGO_AUTO;
+}
+
+size_t string_pattern_search(const StringPattern *sp, const void *text, size_t n) {
+    if (sp == NULL || text == NULL) return SM_NOT_FOUND;
+    return pattern_find(sp, text, n, 0);
+}
+
+bool string_pattern_search_into(const StringPattern *sp, const void *text, size_t n,
+                                MatchResult *result) {
+    if (result == NULL) return false;
+    result->count = 0;
+    if (sp == NULL || text == NULL) return false;
+
+    size_t i = pattern_find(sp, text, n, 0);
+    while (i != SM_NOT_FOUND) {
+        if (!match_result_append(result, i)) return false;
+        i = pattern_find(sp, text, n, i + 1);
+    }
+    return true;
+}
+
+MatchResult string_pattern_search_all(const StringPattern *sp, const void *text, size_t n) {
+    MatchResult result = match_result_create();
+    string_pattern_search_into(sp, text, n, &result);
+    return result;
+}
+
+StringPattern *kmp_compile(const void *pattern, size_t m) {
+    return string_pattern_compile(pattern, m, SM_ALGO_KMP);
+}
+
+StringPattern *bm_compile(const void *pattern, size_t m) {
+    return string_pattern_compile(pattern, m, SM_ALGO_BOYER_MOORE);
+}
+
+// Busca avulsa: compila, busca e libera
+static size_t search_once(const void *text, size_t n, const void *pattern, size_t m,
+                          StringSearchAlgorithm algo) {
+    if (text == NULL || pattern == NULL) return SM_NOT_FOUND;
+    if (m == 0) return 0;
+    if (m > n) return SM_NOT_FOUND;
+    StringPattern *sp = string_pattern_compile(pattern, m, algo);
+    size_t pos = string_pattern_search(sp, text, n);
+    string_pattern_destroy(sp);
+    return pos;
+}
+
+static MatchResult search_all_once(const void *text, size_t n, const void *pattern, size_t m,
+                                   StringSearchAlgorithm algo) {
+    if (text == NULL || pattern == NULL || m == 0 || m > n) return match_result_create();
+    StringPattern *sp = string_pattern_compile(pattern, m, algo);
+    MatchResult result = string_pattern_search_all(sp, text, n);
+    string_pattern_destroy(sp);
+    return result;
+}
+
+size_t string_search_auto(const void *text, size_t n, const void *pattern, size_t m) {
+    return search_once(text, n, pattern, m, SM_ALGO_AUTO);
+}
+
+size_t horspool_search_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    return search_once(text, n, pattern, m, SM_ALGO_HORSPOOL);
+}
+
+MatchResult horspool_search_all_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    return search_all_once(text, n, pattern, m, SM_ALGO_HORSPOOL);
+}
+
+size_t bndm_search_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    return search_once(text, n, pattern, m, SM_ALGO_BNDM);
+}
+
+MatchResult bndm_search_all_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    return search_all_once(text, n, pattern, m, SM_ALGO_BNDM);
+}
+
+size_t shift_or_search_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    return search_once(text, n, pattern, m, SM_ALGO_SHIFT_OR);
+}
+
+MatchResult shift_or_search_all_mem(const void *text, size_t n, const void *pattern, size_t m) {
+    return search_all_once(text, n, pattern, m, SM_ALGO_SHIFT_OR);
+}
+
+// ============================================================================
+// AHO-CORASICK - Aho & Corasick (1975)
+// ============================================================================
+
+#define AC_NONE UINT32_MAX
+#define AHO_STREAM_BUFFER (64 * 1024)
+
+struct AhoCorasick {
+    uint32_t *delta;            // num_states x stride; valores = estado * stride
+    uint32_t *out_head;         // por estado: primeiro padrao terminado nele
+    uint32_t *dict_link;        // por estado: proximo estado com saida na cadeia de falha
+    uint32_t *next_pattern;     // por padrao: proximo padrao no mesmo estado
+    size_t *lengths;
+    size_t num_patterns;
+    size_t num_states;
+    size_t stride;
+    uint32_t match_start;       // linhas >= match_start tem algo a reportar
+    uint8_t classes[ALPHABET_SIZE];
+};
+
+void aho_corasick_destroy(AhoCorasick *ac) {
+    if (ac == NULL) return;
+    free(ac->delta);
+    free(ac->out_head);
+    free(ac->dict_link);
+    free(ac->next_pattern);
+    free(ac->lengths);
+    free(ac);
+}
+
+// Trie com transicoes por classe; 0 = sem filho (a raiz nunca e filho)
+static bool ac_build_trie(AhoCorasick *ac, const char *const *patterns, size_t max_states,
+                          uint32_t **delta, uint32_t **out_head) {
+    size_t stride = ac->stride;
+    *delta = calloc(max_states * stride, sizeof(uint32_t));
+    *out_head = malloc(max_states * sizeof(uint32_t));
+    if (*delta == NULL || *out_head == NULL) return false;
+    (*out_head)[0] = AC_NONE;
+    size_t states = 1;
+
+    // Insere do ultimo para o primeiro: a lista de cada estado fica em ordem crescente
+    for (size_t p = ac->num_patterns; p-- > 0;) {
+        const unsigned char *str = (const unsigned char *)patterns[p];
+        uint32_t s = 0;
+        for (size_t i = 0; i < ac->lengths[p]; i++) {
+            uint32_t *edge = &(*delta)[(size_t)s * stride + ac->classes[str[i]]];
+            if (*edge == 0) {
+                (*out_head)[states] = AC_NONE;
+                *edge = (uint32_t)states++;
+            }
+            s = *edge;
         }
+        ac->next_pattern[p] = (*out_head)[s];
+        (*out_head)[s] = (uint32_t)p;
     }
+    ac->num_states = states;
+    return true;
+}
 
-    free(good_suffix);
+// BFS: completa as transicoes pelas falhas e calcula os dict links
+static bool ac_resolve_failures(AhoCorasick *ac, uint32_t *delta, const uint32_t *out_head,
+                                uint32_t *dict_link, uint32_t *order) {
+    size_t stride = ac->stride;
+    uint32_t *fail = malloc(ac->num_states * sizeof(uint32_t));
+    if (fail == NULL) return false;
+
+    size_t head = 0, tail = 0;
+    fail[0] = 0;
+    dict_link[0] = AC_NONE;
+    for (size_t c = 0; c < stride; c++) {
+        uint32_t u = delta[c];
+        if (u != 0) {
+            fail[u] = 0;
+            dict_link[u] = AC_NONE;
+            order[tail++] = u;
+        }
+    }
+    while (head < tail) {
+        uint32_t s = order[head++];
+        uint32_t *row = &delta[(size_t)s * stride];
+        const uint32_t *fail_row = &delta[(size_t)fail[s] * stride];
+        for (size_t c = 0; c < stride; c++) {
+            uint32_t u = row[c];
+            if (u == 0) {
+                row[c] = fail_row[c];
+                continue;
+            }
+            uint32_t f = fail_row[c];
+            fail[u] = f;
+            dict_link[u] = (out_head[f] != AC_NONE) ? f : dict_link[f];
+            order[tail++] = u;
+        }
+    }
+    free(fail);
+    return true;
+}
+
+AhoCorasick *aho_corasick_create(const char *const *patterns, size_t k) {
+    if (patterns == NULL || k == 0 || k >= AC_NONE) return NULL;
+
+    AhoCorasick *ac = calloc(1, sizeof(AhoCorasick));
+    if (ac == NULL) return NULL;
+    ac->num_patterns = k;
+    ac->lengths = malloc(k * sizeof(size_t));
+    ac->next_pattern = malloc(k * sizeof(uint32_t));
+    if (ac->lengths == NULL || ac->next_pattern == NULL) {
+        aho_corasick_destroy(ac);
+        return NULL;
+    }
+
+    // Classes: 0 para bytes ausentes dos padroes, 1.. para os presentes
+    bool used[ALPHABET_SIZE] = {false};
+    size_t total = 0;
+    for (size_t p = 0; p < k; p++) {
+        if (patterns[p] == NULL || patterns[p][0] == '\0') {
+            aho_corasick_destroy(ac);
+            return NULL;
+        }
+        ac->lengths[p] = strlen(patterns[p]);
+        total += ac->lengths[p];
+        for (const unsigned char *c = (const unsigned char *)patterns[p]; *c; c++) used[*c] = true;
+    }
+    size_t stride = 1;
+    for (size_t b = 0; b < ALPHABET_SIZE; b++) {
+        ac->classes[b] = used[b] ? (uint8_t)stride++ : 0;
+    }
+    ac->stride = stride;
+
+    size_t max_states = total + 1;
+    if (max_states > (AC_NONE - 1) / stride) {
+        aho_corasick_destroy(ac);
+        return NULL;
+    }
+
+    uint32_t *delta = NULL, *out_head = NULL, *dict_link = NULL, *order = NULL;
+    bool ok = ac_build_trie(ac, patterns, max_states, &delta, &out_head);
+    if (ok) {
+        dict_link = malloc(ac->num_states * sizeof(uint32_t));
+        order = malloc(ac->num_states * sizeof(uint32_t));
+        ok = dict_link != NULL && order != NULL &&
+             ac_resolve_failures(ac, delta, out_head, dict_link, order);
+    }
+
+    // Renumera: estados sem saida primeiro (raiz = 0), em ordem de BFS
+    size_t n = ac->num_states;
+    uint32_t *rank = ok ? malloc(n * sizeof(uint32_t)) : NULL;
+    ac->delta = ok ? malloc(n * stride * sizeof(uint32_t)) : NULL;
+    ac->out_head = ok ? malloc(n * sizeof(uint32_t)) : NULL;
+    ac->dict_link = ok ? malloc(n * sizeof(uint32_t)) : NULL;
+    if (rank == NULL || ac->delta == NULL || ac->out_head == NULL || ac->dict_link == NULL) {
+        free(rank);
+        free(delta);
+        free(out_head);
+        free(dict_link);
+        free(order);
+        aho_corasick_destroy(ac);
+        return NULL;
+    }
+
+    size_t next = 0;
+    rank[0] = (uint32_t)next++;
+    for (int pass = 0; pass < 2; pass++) {
+        if (pass == 1) ac->match_start = (uint32_t)(next * stride);
+        for (size_t i = 0; i + 1 < n; i++) {
+            uint32_t s = order[i];
+            bool reports = out_head[s] != AC_NONE || dict_link[s] != AC_NONE;
+            if (reports == (pass == 1)) rank[s] = (uint32_t)next++;
+        }
+    }
+    for (size_t s = 0; s < n; s++) {
+        uint32_t r = rank[s];
+        const uint32_t *row = &delta[s * stride];
+        uint32_t *dst = &ac->delta[(size_t)r * stride];
+        for (size_t c = 0; c < stride; c++) dst[c] = rank[row[c]] * (uint32_t)stride;
+        ac->out_head[r] = out_head[s];
+        ac->dict_link[r] = (dict_link[s] != AC_NONE) ? rank[dict_link[s]] : AC_NONE;
+    }
+
+    free(rank);
+    free(delta);
+    free(out_head);
+    free(dict_link);
+    free(order);
+    return ac;
+}
+
+size_t aho_corasick_states(const AhoCorasick *ac) {
+    return (ac != NULL) ? ac->num_states : 0;
+}
+
+// Consome n bytes a partir do estado *state; posicoes relativas a base.
+// *stopped indica se fn interrompeu a busca.
+static size_t ac_run(const AhoCorasick *ac, uint32_t *state, const unsigned char *t, size_t n,
+                     size_t base, AhoMatchFn fn, void *ctx, bool *stopped) {
+    const uint32_t *delta = ac->delta;
+    const uint8_t *classes = ac->classes;
+    uint32_t match_start = ac->match_start;
+    size_t found = 0;
+    uint32_t s = *state;
+
+    for (size_t i = 0; i < n; i++) {
+        s = delta[s + classes[t[i]]];
+        if (s < match_start) continue;
+
+        // Estado corrente e sua cadeia de dict links: do padrao mais longo ao mais curto
+        uint32_t st = s / (uint32_t)ac->stride;
+        if (ac->out_head[st] == AC_NONE) st = ac->dict_link[st];
+        for (; st != AC_NONE; st = ac->dict_link[st]) {
+            for (uint32_t p = ac->out_head[st]; p != AC_NONE; p = ac->next_pattern[p]) {
+                found++;
+                if (fn != NULL && !fn(p, base + i + 1 - ac->lengths[p], ctx)) {
+                    *state = s;
+                    *stopped = true;
+                    return found;
+                }
+            }
+        }
+    }
+    *state = s;
+    return found;
+}
+
+size_t aho_corasick_scan(const AhoCorasick *ac, const char *text, size_t n,
+                         AhoMatchFn fn, void *ctx) {
+    if (ac == NULL || text == NULL) return 0;
+    uint32_t state = 0;
+    bool stopped = false;
+    return ac_run(ac, &state, (const unsigned char *)text, n, 0, fn, ctx, &stopped);
+}
+
+void aho_stream_init(AhoStream *stream, const AhoCorasick *ac) {
+    if (stream == NULL) return;
+    stream->ac = ac;
+    stream->state = 0;
+    stream->offset = 0;
+    stream->stopped = false;
+}
+
+size_t aho_stream_feed(AhoStream *stream, const char *chunk, size_t n,
+                       AhoMatchFn fn, void *ctx) {
+    if (stream == NULL || stream->ac == NULL || stream->stopped) return 0;
+    if (chunk == NULL || n == 0) return 0;
+
+    size_t found = ac_run(stream->ac, &stream->state, (const unsigned char *)chunk, n,
+                          stream->offset, fn, ctx, &stream->stopped);
+    stream->offset += n;
+    return found;
+}
+
+size_t aho_corasick_scan_file(const AhoCorasick *ac, FILE *file, AhoMatchFn fn, void *ctx) {
+    if (ac == NULL || file == NULL) return 0;
+
+    char *buffer = malloc(AHO_STREAM_BUFFER);
+    if (buffer == NULL) return 0;
+
+    AhoStream stream;
+    aho_stream_init(&stream, ac);
+    size_t found = 0;
+    size_t got;
+    while (!stream.stopped && (got = fread(buffer, 1, AHO_STREAM_BUFFER, file)) > 0) {
+        found += aho_stream_feed(&stream, buffer, got, fn, ctx);
+    }
+    free(buffer);
+    return found;
+}
+
+static bool aho_collect(size_t pattern, size_t position, void *ctx) {
+    AhoMatchResult *result = ctx;
+    if (result->count == result->capacity) {
+        size_t new_cap = (result->capacity == 0) ? 8 : result->capacity * 2;
+        AhoMatch *new_arr = realloc(result->matches, new_cap * sizeof(AhoMatch));
+        if (new_arr == NULL) return false;
+        result->matches = new_arr;
+        result->capacity = new_cap;
+    }
+    result->matches[result->count++] = (AhoMatch){pattern, position};
+    return true;
+}
+
+AhoMatchResult aho_corasick_search_all(const AhoCorasick *ac, const char *text) {
+    AhoMatchResult result = { NULL, 0, 0 };
+    if (ac == NULL || text == NULL) return result;
+    aho_corasick_scan(ac, text, strlen(text), aho_collect, &result);
     return result;
 }
+
+void aho_match_result_destroy(AhoMatchResult *result) {
+    if (result == NULL) return;
+    free(result->matches);
+    result->matches = NULL;
+    result->count = 0;
+    result->capacity = 0;
+}
@@ -0,0 +1,418 @@
+/**
+ * @file suffix_array.c
+ * @brief Suffix array por SA-IS, LCP por Kasai, busca binaria e serializacao
+ *
+ * Referencias:
+ * - Nong, Zhang & Chan (2009). "Linear Suffix Array Construction by Almost
+ *   Pure Induced-Sorting"
+ * - Kasai et al. (2001). "Linear-Time Longest-Common-Prefix Computation"
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+// mmap/munmap (POSIX) com CMAKE_C_EXTENSIONS OFF
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "algorithms/suffix_array.h"
+#include "algorithms/sorting.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SA_USE_MMAP 1
+#endif
+
+#define SA_EMPTY UINT32_MAX
+#define SA_MAGIC "SUFARRAY"
+#define SA_BYTE_ORDER 0x01020304u
+#define SA_VERSION 1u
+
+// Cabecalho do arquivo: 24 bytes, SA e LCP comecam alinhados a 8
+typedef struct {
+    char magic[8];
+    uint64_t n;
+    uint32_t version;
+    uint32_t byte_order;
+} SuffixArrayHeader;
+
+struct SuffixArray {
+    const unsigned char *text;
+    size_t n;
+    const uint32_t *sa;
+    const uint32_t *lcp;
+    uint32_t *owned;            // SA e LCP alocados (build ou leitura sem mmap)
+    void *map;                  // regiao mapeada por suffix_array_load
+    size_t map_size;
+};
+
+// ============================================================================
+// SA-IS
+// ============================================================================
+
+// Tipos: 1 = S (sufixo menor que o seguinte), 0 = L
+#define SAIS_LMS(t, i) ((i) > 0 && (t)[i] && !(t)[(i) - 1])
+
+static void sais_buckets(const uint32_t *s, size_t n, size_t K, uint32_t *bkt, bool end) {
+    memset(bkt, 0, K * sizeof(uint32_t));
+    for (size_t i = 0; i < n; i++) bkt[s[i]]++;
+    uint32_t sum = 0;
+    for (size_t c = 0; c < K; c++) {
+        sum += bkt[c];
+        bkt[c] = end ? sum : sum - bkt[c];
+    }
+}
+
+// Induz os L a partir dos LMS posicionados, depois os S a partir dos L
+static void sais_induce(const uint32_t *s, uint32_t *sa, const uint8_t *t,
+                        uint32_t *bkt, size_t n, size_t K) {
+    sais_buckets(s, n, K, bkt, false);
+    for (size_t i = 0; i < n; i++) {
+        uint32_t j = sa[i];
+        if (j != SA_EMPTY && j > 0 && !t[j - 1]) sa[bkt[s[j - 1]]++] = j - 1;
+    }
+    sais_buckets(s, n, K, bkt, true);
+    for (size_t i = n; i-- > 0;) {
+        uint32_t j = sa[i];
+        if (j != SA_EMPTY && j > 0 && t[j - 1]) sa[--bkt[s[j - 1]]] = j - 1;
+    }
+}
+
+// s[0..n) sobre o alfabeto [0, K), com s[n-1] = 0 como sentinela unico
+static bool sais(const uint32_t *s, uint32_t *sa, size_t n, size_t K) {
+    uint8_t *t = malloc(n);
+    uint32_t *bkt = malloc(K * sizeof(uint32_t));
+    if (t == NULL || bkt == NULL) {
+        free(t);
+        free(bkt);
+        return false;
+    }
+
+    t[n - 1] = 1;
+    for (size_t i = n - 1; i > 0; i--) {
+        t[i - 1] = (s[i - 1] < s[i] || (s[i - 1] == s[i] && t[i])) ? 1 : 0;
+    }
+
+    // 1. Ordena as substrings LMS por inducao a partir de posicoes arbitrarias
+    sais_buckets(s, n, K, bkt, true);
+    for (size_t i = 0; i < n; i++) sa[i] = SA_EMPTY;
+    for (size_t i = 1; i < n; i++) {
+        if (SAIS_LMS(t, i)) sa[--bkt[s[i]]] = (uint32_t)i;
+    }
+    sais_induce(s, sa, t, bkt, n, K);
+
+    // 2. Compacta as LMS ordenadas e da nomes (iguais para substrings iguais)
+    size_t n1 = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (SAIS_LMS(t, sa[i])) sa[n1++] = sa[i];
+    }
+    for (size_t i = n1; i < n; i++) sa[i] = SA_EMPTY;
+
+    uint32_t name = 0;
+    uint32_t prev = SA_EMPTY;
+    for (size_t i = 0; i < n1; i++) {
+        uint32_t pos = sa[i];
+        bool diff = false;
+        for (size_t d = 0;; d++) {
+            if (prev == SA_EMPTY || s[pos + d] != s[prev + d] || t[pos + d] != t[prev + d]) {
+                diff = true;
+                break;
+            }
+            if (d > 0 && (SAIS_LMS(t, pos + d) || SAIS_LMS(t, prev + d))) break;
+        }
+        if (diff) {
+            name++;
+            prev = pos;
+        }
+        sa[n1 + pos / 2] = name - 1;
+    }
+    for (size_t i = n, j = n; i-- > n1;) {
+        if (sa[i] != SA_EMPTY) sa[--j] = sa[i];
+    }
+
+    // 3. Ordena os sufixos LMS: recursao se ha nomes repetidos
+    uint32_t *s1 = sa + n - n1;
+    uint32_t *sa1 = sa;
+    if (name < n1) {
+        if (!sais(s1, sa1, n1, name)) {
+            free(t);
+            free(bkt);
+            return false;
+        }
+    } else {
+        for (size_t i = 0; i < n1; i++) sa1[s1[i]] = (uint32_t)i;
+    }
+
+    // 4. Posiciona os LMS na ordem final e induz o restante
+    sais_buckets(s, n, K, bkt, true);
+    for (size_t i = 1, j = 0; i < n; i++) {
+        if (SAIS_LMS(t, i)) s1[j++] = (uint32_t)i;
+    }
+    for (size_t i = 0; i < n1; i++) sa1[i] = s1[sa1[i]];
+    for (size_t i = n1; i < n; i++) sa[i] = SA_EMPTY;
+    for (size_t i = n1; i-- > 0;) {
+        uint32_t j = sa[i];
+        sa[i] = SA_EMPTY;
+        sa[--bkt[s[j]]] = j;
+    }
+    sais_induce(s, sa, t, bkt, n, K);
+
+    free(t);
+    free(bkt);
+    return true;
+}
+
+// ============================================================================
+// CONSTRUCAO
+// ============================================================================
+
+// LCP de Kasai: h cai no maximo 1 por sufixo, O(n)
+static void kasai_lcp(const unsigned char *text, size_t n, const uint32_t *sa,
+                      uint32_t *rank, uint32_t *lcp) {
+    for (size_t i = 0; i < n; i++) rank[sa[i]] = (uint32_t)i;
+    size_t h = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (rank[i] == 0) {
+            lcp[0] = 0;
+            h = 0;
+            continue;
+        }
+        size_t j = sa[rank[i] - 1];
+        while (i + h < n && j + h < n && text[i + h] == text[j + h]) h++;
+        lcp[rank[i]] = (uint32_t)h;
+        if (h > 0) h--;
+    }
+}
+
+SuffixArray *suffix_array_build(const void *text, size_t n) {
+    if (text == NULL && n > 0) return NULL;
+    if (n >= UINT32_MAX - 1) return NULL;
+
+    SuffixArray *sa = calloc(1, sizeof(SuffixArray));
+    if (sa == NULL) return NULL;
+    sa->text = text;
+    sa->n = n;
+    if (n == 0) return sa;
+
+    // Bytes + 1 e sentinela 0 no fim; owned = SA (n + 1 durante o SA-IS) + LCP
+    size_t N = n + 1;
+    uint32_t *s = malloc(N * sizeof(uint32_t));
+    sa->owned = malloc((2 * n + 1) * sizeof(uint32_t));
+    if (s == NULL || sa->owned == NULL) {
+        free(s);
+        suffix_array_destroy(sa);
+        return NULL;
+    }
+    for (size_t i = 0; i < n; i++) s[i] = (uint32_t)sa->text[i] + 1;
+    s[n] = 0;
+
+    if (!sais(s, sa->owned, N, 257)) {
+        free(s);
+        suffix_array_destroy(sa);
+        return NULL;
+    }
+    // owned[0] e o sentinela
+    memmove(sa->owned, sa->owned + 1, n * sizeof(uint32_t));
+    kasai_lcp(sa->text, n, sa->owned, s, sa->owned + n);
+    free(s);
+
+    sa->sa = sa->owned;
+    sa->lcp = sa->owned + n;
+    return sa;
+}
+
+void suffix_array_destroy(SuffixArray *sa) {
+    if (sa == NULL) return;
+#if defined(SA_USE_MMAP)
+    if (sa->map != NULL) munmap(sa->map, sa->map_size);
+#endif
+    free(sa->owned);
+    free(sa);
+}
+
+size_t suffix_array_length(const SuffixArray *sa) {
+    return (sa != NULL) ? sa->n : 0;
+}
+
+const uint32_t *suffix_array_data(const SuffixArray *sa) {
+    return (sa != NULL) ? sa->sa : NULL;
+}
+
+const uint32_t *suffix_array_lcp(const SuffixArray *sa) {
+    return (sa != NULL) ? sa->lcp : NULL;
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+// < 0, 0 ou > 0: sufixo em pos comparado a pattern truncado em m bytes
+static int suffix_compare(const SuffixArray *sa, size_t pos, const unsigned char *pattern, size_t m) {
+    size_t avail = sa->n - pos;
+    size_t len = (avail < m) ? avail : m;
+    int r = memcmp(sa->text + pos, pattern, len);
+    if (r != 0) return r;
+    return (len < m) ? -1 : 0;
+}
+
+bool suffix_array_range(const SuffixArray *sa, const void *pattern, size_t m,
+                        size_t *first, size_t *last) {
+    if (sa == NULL || (pattern == NULL && m > 0)) return false;
+
+    // Primeiro sufixo >= pattern
+    size_t lo = 0, hi = sa->n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (suffix_compare(sa, sa->sa[mid], pattern, m) < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    size_t begin = lo;
+
+    // Primeiro sufixo cujo prefixo de m bytes e > pattern
+    hi = sa->n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (suffix_compare(sa, sa->sa[mid], pattern, m) <= 0) lo = mid + 1;
+        else hi = mid;
+    }
+
+    if (first != NULL) *first = begin;
+    if (last != NULL) *last = lo;
+    return lo > begin;
+}
+
+size_t suffix_array_count(const SuffixArray *sa, const void *pattern, size_t m) {
+    size_t first, last;
+    if (!suffix_array_range(sa, pattern, m, &first, &last)) return 0;
+    return last - first;
+}
+
+MatchResult suffix_array_locate(const SuffixArray *sa, const void *pattern, size_t m) {
+    MatchResult result = match_result_create();
+    size_t first, last;
+    if (m == 0 || !suffix_array_range(sa, pattern, m, &first, &last)) return result;
+
+    size_t occ = last - first;
+    uint32_t *sorted = malloc(occ * sizeof(uint32_t));
+    result.positions = malloc(occ * sizeof(size_t));
+    if (sorted == NULL || result.positions == NULL) {
+        free(sorted);
+        match_result_destroy(&result);
+        return result;
+    }
+    memcpy(sorted, sa->sa + first, occ * sizeof(uint32_t));
+    radix_sort_u32(sorted, occ, 1);
+    for (size_t i = 0; i < occ; i++) result.positions[i] = sorted[i];
+    free(sorted);
+    result.count = occ;
+    result.capacity = occ;
+    return result;
+}
+
+size_t suffix_array_longest_repeat(const SuffixArray *sa, size_t *position) {
+    if (sa == NULL || sa->n == 0) return 0;
+    size_t best = 0;
+    for (size_t i = 1; i < sa->n; i++) {
+        if (sa->lcp[i] > sa->lcp[best]) best = i;
+    }
+    if (position != NULL) *position = sa->sa[best];
+    return sa->lcp[best];
+}
+
+// ============================================================================
+// SERIALIZACAO
+// ============================================================================
+
+bool suffix_array_save(const SuffixArray *sa, const char *path) {
+    if (sa == NULL || path == NULL) return false;
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) return false;
+
+    SuffixArrayHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SA_MAGIC, sizeof(header.magic));
+    header.n = sa->n;
+    header.version = SA_VERSION;
+    header.byte_order = SA_BYTE_ORDER;
+
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    if (ok && sa->n > 0) {
+        ok = fwrite(sa->sa, sizeof(uint32_t), sa->n, f) == sa->n &&
+             fwrite(sa->lcp, sizeof(uint32_t), sa->n, f) == sa->n;
+    }
+    if (fclose(f) != 0) ok = false;
+    if (!ok) remove(path);
+    return ok;
+}
+
+SuffixArray *suffix_array_from_buffer(const void *buffer, size_t size, const void *text, size_t n) {
+    if (buffer == NULL || (text == NULL && n > 0) || size < sizeof(SuffixArrayHeader)) return NULL;
+    if (((uintptr_t)buffer % sizeof(uint32_t)) != 0) return NULL;
+
+    SuffixArrayHeader header;
+    memcpy(&header, buffer, sizeof(header));
+    if (memcmp(header.magic, SA_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != SA_VERSION || header.byte_order != SA_BYTE_ORDER ||
+        header.n != (uint64_t)n || n >= UINT32_MAX - 1 ||
+        size != sizeof(header) + 2 * n * sizeof(uint32_t)) {
+        return NULL;
+    }
+
+    SuffixArray *sa = calloc(1, sizeof(SuffixArray));
+    if (sa == NULL) return NULL;
+    const uint32_t *data = (const uint32_t *)((const unsigned char *)buffer + sizeof(header));
+    sa->text = text;
+    sa->n = n;
+    sa->sa = data;
+    sa->lcp = data + n;
+    return sa;
+}
+
+SuffixArray *suffix_array_load(const char *path, const void *text, size_t n) {
+    if (path == NULL || (text == NULL && n > 0)) return NULL;
+
+#if defined(SA_USE_MMAP)
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(SuffixArrayHeader)) {
+        close(fd);
+        return NULL;
+    }
+    size_t size = (size_t)st.st_size;
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return NULL;
+
+    SuffixArray *sa = suffix_array_from_buffer(map, size, text, n);
+    if (sa == NULL) {
+        munmap(map, size);
+        return NULL;
+    }
+    sa->map = map;
+    sa->map_size = size;
+    return sa;
+#else
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return NULL;
+    size_t size = sizeof(SuffixArrayHeader) + 2 * n * sizeof(uint32_t);
+    uint32_t *buffer = malloc(size);
+    bool ok = buffer != NULL && fread(buffer, 1, size, f) == size && fgetc(f) == EOF;
+    fclose(f);
+    SuffixArray *sa = ok ? suffix_array_from_buffer(buffer, size, text, n) : NULL;
+    if (sa == NULL) {
+        free(buffer);
+        return NULL;
+    }
+    sa->owned = buffer;
+    return sa;
+#endif
+}
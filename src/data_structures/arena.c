@@ -0,0 +1,256 @@
+/**
+ * @file arena.c
+ * @brief Implementação da arena com free-lists por classe de tamanho
+ *
+ * Layout: lista encadeada de chunks; cada chunk tem um cabeçalho seguido
+ * da área de dados alinhada a max_align_t. Alocações avançam o offset do
+ * chunk corrente (bump pointer). Blocos liberados de até
+ * DS_ARENA_MAX_POOLED bytes são empilhados (LIFO) na free-list da classe,
+ * reaproveitando o próprio bloco para guardar o ponteiro "next".
+ *
+ * Referências:
+ * - Hanson, D. R. (1990). "Fast Allocation and Deallocation of Memory
+ *   Based on Object Lifetimes"
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/arena.h"
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+// ============================================================================
+// ESTRUTURAS INTERNAS
+// ============================================================================
+
+#define ARENA_ALIGN _Alignof(max_align_t)
+#define ARENA_GRANULE (ARENA_ALIGN < 16 ? 16 : ARENA_ALIGN)
+#define ARENA_NUM_CLASSES (DS_ARENA_MAX_POOLED / ARENA_GRANULE)
+
+typedef struct ArenaChunk {
+    struct ArenaChunk *next;
+    size_t capacity;
+    size_t offset;
+    max_align_t data[];
+} ArenaChunk;
+
+typedef struct FreeBlock {
+    struct FreeBlock *next;
+} FreeBlock;
+
+struct DSArena {
+    ArenaChunk *chunks;       // Chunk corrente na cabeça
+    size_t chunk_size;
+    size_t bytes_used;
+    size_t bytes_reserved;
+    FreeBlock *free_lists[ARENA_NUM_CLASSES];
+};
+
+// ============================================================================
+// FUNÇÕES AUXILIARES
+// ============================================================================
+
+static size_t round_up(size_t size) {
+    if (size == 0) size = 1;
+    return (size + ARENA_GRANULE - 1) & ~((size_t)ARENA_GRANULE - 1);
+}
+
+static ArenaChunk* chunk_new(DSArena *arena, size_t capacity) {
+    if (capacity > SIZE_MAX - sizeof(ArenaChunk)) return NULL;
+
+    ArenaChunk *chunk = (ArenaChunk*)malloc(sizeof(ArenaChunk) + capacity);
+    if (chunk == NULL) return NULL;
+
+    chunk->capacity = capacity;
+    chunk->offset = 0;
+    arena->bytes_reserved += capacity;
+    return chunk;
+}
+
+static void clear_free_lists(DSArena *arena) {
+    for (size_t i = 0; i < ARENA_NUM_CLASSES; i++) {
+        arena->free_lists[i] = NULL;
+    }
+}
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+DSArena* ds_arena_create(size_t chunk_size) {
+    DSArena *arena = (DSArena*)malloc(sizeof(DSArena));
+    if (arena == NULL) return NULL;
+
+    arena->chunks = NULL;
+    arena->chunk_size = round_up(chunk_size == 0 ? DS_ARENA_DEFAULT_CHUNK : chunk_size);
+    arena->bytes_used = 0;
+    arena->bytes_reserved = 0;
+    clear_free_lists(arena);
+
+    return arena;
+}
+
+void ds_arena_destroy(DSArena *arena) {
+    if (arena == NULL) return;
+
+    ArenaChunk *chunk = arena->chunks;
+    while (chunk != NULL) {
+        ArenaChunk *next = chunk->next;
+        free(chunk);
+        chunk = next;
+    }
+    free(arena);
+}
+
+// ============================================================================
+// ALOCAÇÃO
+// ============================================================================
+
+void* ds_arena_alloc(DSArena *arena, size_t size) {
+    if (arena == NULL) return NULL;
+    if (size > SIZE_MAX - ARENA_GRANULE) return NULL;
+
+    size_t rounded = round_up(size);
+
+    if (rounded <= DS_ARENA_MAX_POOLED) {
+        size_t cls = rounded / ARENA_GRANULE - 1;
+        FreeBlock *block = arena->free_lists[cls];
+        if (block != NULL) {
+            arena->free_lists[cls] = block->next;
+            arena->bytes_used += rounded;
+            return block;
+        }
+    }
+
+    ArenaChunk *chunk = arena->chunks;
+    if (chunk == NULL || chunk->capacity - chunk->offset < rounded) {
+        if (rounded > arena->chunk_size) {
+            // Bloco grande: chunk dedicado inserido atrás do corrente,
+            // preservando o espaço livre do chunk corrente
+            ArenaChunk *big = chunk_new(arena, rounded);
+            if (big == NULL) return NULL;
+            big->offset = rounded;
+            if (chunk != NULL) {
+                big->next = chunk->next;
+                chunk->next = big;
+            } else {
+                big->next = NULL;
+                arena->chunks = big;
+            }
+            arena->bytes_used += rounded;
+            return big->data;
+        }
+
+        chunk = chunk_new(arena, arena->chunk_size);
+        if (chunk == NULL) return NULL;
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+    }
+
+    void *ptr = (unsigned char*)chunk->data + chunk->offset;
+    chunk->offset += rounded;
+    arena->bytes_used += rounded;
+    return ptr;
+}
+
+void* ds_arena_realloc(DSArena *arena, void *ptr, size_t old_size, size_t new_size) {
+    if (arena == NULL) return NULL;
+    if (ptr == NULL) return ds_arena_alloc(arena, new_size);
+
+    size_t old_rounded = round_up(old_size);
+    size_t new_rounded = round_up(new_size);
+    if (new_rounded == old_rounded) return ptr;
+
+    // Último bloco do chunk corrente: cresce/encolhe no lugar
+    ArenaChunk *chunk = arena->chunks;
+    unsigned char *end = chunk != NULL ? (unsigned char*)chunk->data + chunk->offset : NULL;
+    if (end != NULL && (unsigned char*)ptr + old_rounded == end &&
+        new_rounded <= chunk->capacity - (chunk->offset - old_rounded)) {
+        chunk->offset = chunk->offset - old_rounded + new_rounded;
+        arena->bytes_used = arena->bytes_used - old_rounded + new_rounded;
+        return ptr;
+    }
+
+    if (new_rounded < old_rounded) {
+        // Encolher fora do topo: mantém o bloco, a cauda só volta no reset
+        arena->bytes_used -= old_rounded - new_rounded;
+        return ptr;
+    }
+
+    void *fresh = ds_arena_alloc(arena, new_size);
+    if (fresh == NULL) return NULL;
+    memcpy(fresh, ptr, old_size < new_size ? old_size : new_size);
+    ds_arena_free(arena, ptr, old_size);
+    return fresh;
+}
+
+void ds_arena_free(DSArena *arena, void *ptr, size_t size) {
+    if (arena == NULL || ptr == NULL) return;
+
+    size_t rounded = round_up(size);
+    arena->bytes_used -= rounded;
+
+    if (rounded <= DS_ARENA_MAX_POOLED) {
+        size_t cls = rounded / ARENA_GRANULE - 1;
+        FreeBlock *block = (FreeBlock*)ptr;
+        block->next = arena->free_lists[cls];
+        arena->free_lists[cls] = block;
+    }
+}
+
+void ds_arena_reset(DSArena *arena) {
+    if (arena == NULL) return;
+
+    ArenaChunk *keep = NULL;
+    ArenaChunk *chunk = arena->chunks;
+    while (chunk != NULL) {
+        ArenaChunk *next = chunk->next;
+        if (keep == NULL && chunk->capacity == arena->chunk_size) {
+            keep = chunk;
+        } else {
+            free(chunk);
+        }
+        chunk = next;
+    }
+
+    arena->chunks = keep;
+    arena->bytes_reserved = 0;
+    if (keep != NULL) {
+        keep->next = NULL;
+        keep->offset = 0;
+        arena->bytes_reserved = keep->capacity;
+    }
+    arena->bytes_used = 0;
+    clear_free_lists(arena);
+}
+
+// ============================================================================
+// ESTATÍSTICAS E ADAPTADOR
+// ============================================================================
+
+size_t ds_arena_bytes_used(const DSArena *arena) {
+    return arena == NULL ? 0 : arena->bytes_used;
+}
+
+size_t ds_arena_bytes_reserved(const DSArena *arena) {
+    return arena == NULL ? 0 : arena->bytes_reserved;
+}
+
+static void* arena_alloc_fn(void *ctx, size_t size) {
+    return ds_arena_alloc((DSArena*)ctx, size);
+}
+
+static void* arena_realloc_fn(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    return ds_arena_realloc((DSArena*)ctx, ptr, old_size, new_size);
+}
+
+static void arena_free_fn(void *ctx, void *ptr, size_t size) {
+    ds_arena_free((DSArena*)ctx, ptr, size);
+}
+
+DSAllocator ds_arena_allocator(DSArena *arena) {
+    DSAllocator allocator = { arena_alloc_fn, arena_realloc_fn, arena_free_fn, arena };
+    return allocator;
+}
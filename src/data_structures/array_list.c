@@ -5,6 +5,11 @@
  * Array dinâmico com crescimento automático. Oferece acesso O(1) por índice
  * e inserção O(1) amortizada no final.
  *
+ * Listas criadas com arraylist_create_small guardam os primeiros elementos
+ * num buffer embutido na mesma alocação do cabeçalho. Buffers grandes do
+ * alocador padrão vêm de mmap e crescem com mremap (Linux), que remapeia
+ * as páginas em vez de copiá-las.
+ *
  * Referências:
  * - Goodrich et al. (2011), Chapter 7 - Lists and Iterators
  * - Cormen et al. (2009), Chapter 17 - Amortized Analysis
@@ -13,12 +18,36 @@
  * @date 2025
  */
 
+#if defined(__linux__)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // mremap
+#endif
+#endif
+
 #include "data_structures/array_list.h"
+#include "data_structures/pdqsort.h"
 
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+// MREMAP_MAYMOVE some se <features.h> já foi lido sem _GNU_SOURCE
+#if defined(__linux__) && defined(MREMAP_MAYMOVE)
+#define ARRAYLIST_USE_MREMAP 1
+#else
+#define ARRAYLIST_USE_MREMAP 0
+#endif
+
+/** Buffers a partir deste tamanho (bytes) vão para mmap/mremap */
+#define ARRAYLIST_MREMAP_THRESHOLD ((size_t)1 << 20)
+
 // ============================================================================
 // ESTRUTURA INTERNA DO ARRAYLIST
 // ============================================================================
@@ -30,8 +59,15 @@ struct ArrayList {
     size_t capacity;          // Capacidade atual
     GrowthStrategy growth;    // Estratégia de crescimento
     DestroyFn destroy;        // Função de destruição
+    DSAllocator allocator;    // Origem do cabeçalho e do buffer
+    size_t inline_capacity;   // Elementos do buffer embutido (0 = sem buffer)
+    bool mapped;              // array veio de mmap (ARRAYLIST_USE_MREMAP)
 };
 
+/** Início do buffer embutido, logo após o cabeçalho */
+#define ARRAYLIST_HEADER_SIZE \
+    ((sizeof(ArrayList) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t))
+
 // ============================================================================
 // FUNÇÕES AUXILIARES PRIVADAS
 // ============================================================================
@@ -40,19 +76,85 @@ struct ArrayList {
  * @brief Calcula nova capacidade baseada na estratégia
  */
 static size_t calculate_new_capacity(size_t current, GrowthStrategy growth) {
+    size_t next;
     switch (growth) {
         case GROWTH_DOUBLE:
-            return current * 2;
+            next = current * 2;
+            break;
 
         case GROWTH_1_5:
-            return current + (current / 2);
+            next = current + (current / 2);
+            break;
+
+        case GROWTH_GOLDEN:
+            // 1 + 1/2 + 1/8 = 1.625 ≈ φ, sem multiplicar (e estourar) current
+            next = current + (current / 2) + (current / 8);
+            break;
 
         case GROWTH_FIXED:
-            return current + 16;  // Incremento fixo
+            next = current + 16;  // Incremento fixo
+            break;
 
         default:
-            return current * 2;
+            next = current * 2;
+            break;
     }
+
+    // Capacidades 0 e 1 não crescem com os fatores fracionários
+    return next > current ? next : current + 1;
+}
+
+static void* inline_buffer(const ArrayList *list) {
+    return (char*)list + ARRAYLIST_HEADER_SIZE;
+}
+
+static bool is_inline(const ArrayList *list) {
+    return list->inline_capacity > 0 && list->array == inline_buffer(list);
+}
+
+#if ARRAYLIST_USE_MREMAP
+static size_t mapped_bytes(size_t bytes) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    return (bytes + page - 1) / page * page;
+}
+#endif
+
+/**
+ * @brief Libera o buffer atual (embutido, mapeado ou do alocador)
+ */
+static void release_buffer(ArrayList *list) {
+    if (is_inline(list)) {
+        return;
+    }
+#if ARRAYLIST_USE_MREMAP
+    if (list->mapped) {
+        munmap(list->array, mapped_bytes(list->capacity * list->element_size));
+        return;
+    }
+#endif
+    ds_free(&list->allocator, list->array, list->capacity * list->element_size);
+}
+
+/**
+ * @brief Novo buffer de bytes bytes, sem copiar; *mapped indica a origem
+ *
+ * Só o alocador padrão usa mmap: alocadores customizados (arena, pool)
+ * precisam ver toda a memória da lista.
+ */
+static void* allocate_buffer(ArrayList *list, size_t bytes, bool *mapped) {
+    *mapped = false;
+#if ARRAYLIST_USE_MREMAP
+    if (bytes >= ARRAYLIST_MREMAP_THRESHOLD &&
+        list->allocator.alloc == ds_default_allocator()->alloc) {
+        void *p = mmap(NULL, mapped_bytes(bytes), PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p != MAP_FAILED) {
+            *mapped = true;
+            return p;
+        }
+    }
+#endif
+    return ds_alloc(&list->allocator, bytes);
 }
 
 /**
@@ -68,18 +170,88 @@ static DataStructureError arraylist_resize(ArrayList *list, size_t new_capacity)
     if (new_capacity < list->size) {
         return DS_ERROR_INVALID_PARAM;
     }
+    if (new_capacity > SIZE_MAX / list->element_size) {
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
 
-    void *new_array = realloc(list->array, new_capacity * list->element_size);
+    size_t old_bytes = list->capacity * list->element_size;
+    size_t new_bytes = new_capacity * list->element_size;
+    size_t used_bytes = list->size * list->element_size;
+
+    // Encolheu até caber no buffer embutido: volta para ele
+    if (new_capacity <= list->inline_capacity) {
+        if (!is_inline(list)) {
+            memcpy(inline_buffer(list), list->array, used_bytes);
+            release_buffer(list);
+            list->array = inline_buffer(list);
+            list->capacity = list->inline_capacity;
+            list->mapped = false;
+        }
+        return DS_SUCCESS;
+    }
+
+#if ARRAYLIST_USE_MREMAP
+    // Mapeado continua mapeado: o kernel move as páginas, sem cópia
+    if (list->mapped && new_bytes >= ARRAYLIST_MREMAP_THRESHOLD) {
+        void *p = mremap(list->array, mapped_bytes(old_bytes), mapped_bytes(new_bytes),
+                         MREMAP_MAYMOVE);
+        if (p == MAP_FAILED) {
+            return DS_ERROR_OUT_OF_MEMORY;
+        }
+        list->array = p;
+        list->capacity = new_capacity;
+        return DS_SUCCESS;
+    }
+#endif
+
+    // Realloc no lugar quando o buffer é do alocador e continua nele
+    bool mapped;
+    if (!is_inline(list) && !list->mapped &&
+        (!ARRAYLIST_USE_MREMAP || new_bytes < ARRAYLIST_MREMAP_THRESHOLD ||
+         list->allocator.alloc != ds_default_allocator()->alloc)) {
+        void *new_array = ds_realloc(&list->allocator, list->array, old_bytes, new_bytes);
+        if (new_array == NULL) {
+            return DS_ERROR_OUT_OF_MEMORY;
+        }
+        list->array = new_array;
+        list->capacity = new_capacity;
+        return DS_SUCCESS;
+    }
+
+    // Troca de origem (embutido -> heap, heap <-> mmap): copia os elementos
+    void *new_array = allocate_buffer(list, new_bytes, &mapped);
     if (new_array == NULL) {
         return DS_ERROR_OUT_OF_MEMORY;
     }
+    memcpy(new_array, list->array, used_bytes);
+    release_buffer(list);
 
     list->array = new_array;
     list->capacity = new_capacity;
+    list->mapped = mapped;
 
     return DS_SUCCESS;
 }
 
+/**
+ * @brief Garante espaço para mais extra elementos, crescendo no máximo uma vez
+ */
+static DataStructureError arraylist_grow_for(ArrayList *list, size_t extra) {
+    if (extra > SIZE_MAX - list->size) {
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+    size_t needed = list->size + extra;
+    if (needed <= list->capacity) {
+        return DS_SUCCESS;
+    }
+
+    size_t new_capacity = calculate_new_capacity(list->capacity, list->growth);
+    if (new_capacity < needed) {
+        new_capacity = needed;
+    }
+    return arraylist_resize(list, new_capacity);
+}
+
 // ============================================================================
 // CRIAÇÃO E DESTRUIÇÃO
 // ============================================================================
@@ -90,40 +262,86 @@ ArrayList* arraylist_create(size_t element_size, size_t initial_capacity, Destro
 
 ArrayList* arraylist_create_with_growth(size_t element_size, size_t initial_capacity,
                                         GrowthStrategy growth, DestroyFn destroy) {
-    if (element_size == 0) {
-        return NULL;
-    }
+    return arraylist_create_with_allocator(element_size, initial_capacity, growth,
+                                           destroy, NULL);
+}
 
-    if (initial_capacity == 0) initial_capacity = 16;
+/**
+ * @brief Tamanho da alocação do cabeçalho (com o buffer embutido, se houver)
+ */
+static size_t header_bytes(size_t element_size, size_t inline_capacity) {
+    return inline_capacity > 0 ? ARRAYLIST_HEADER_SIZE + inline_capacity * element_size
+                               : sizeof(ArrayList);
+}
 
-    ArrayList *list = (ArrayList*)malloc(sizeof(ArrayList));
-    if (list == NULL) {
+static ArrayList* arraylist_create_impl(size_t element_size, size_t initial_capacity,
+                                        size_t inline_capacity, GrowthStrategy growth,
+                                        DestroyFn destroy, const DSAllocator *allocator) {
+    if (element_size == 0 ||
+        inline_capacity > (SIZE_MAX - ARRAYLIST_HEADER_SIZE) / element_size) {
         return NULL;
     }
+    if (allocator == NULL) allocator = ds_default_allocator();
 
-    list->array = malloc(initial_capacity * element_size);
-    if (list->array == NULL) {
-        free(list);
+    ArrayList *list = (ArrayList*)ds_alloc(allocator, header_bytes(element_size, inline_capacity));
+    if (list == NULL) {
         return NULL;
     }
 
+    list->allocator = *allocator;
     list->element_size = element_size;
     list->size = 0;
-    list->capacity = initial_capacity;
     list->growth = growth;
     list->destroy = destroy;
+    list->inline_capacity = inline_capacity;
+    list->mapped = false;
+
+    if (inline_capacity > 0) {
+        list->array = inline_buffer(list);
+        list->capacity = inline_capacity;
+    } else {
+        if (initial_capacity == 0) initial_capacity = 16;
+        list->array = allocate_buffer(list, initial_capacity * element_size, &list->mapped);
+        list->capacity = initial_capacity;
+        if (list->array == NULL) {
+            ds_free(allocator, list, sizeof(ArrayList));
+            return NULL;
+        }
+    }
+
+    if (initial_capacity > list->capacity &&
+        arraylist_resize(list, initial_capacity) != DS_SUCCESS) {
+        ds_free(allocator, list, header_bytes(element_size, inline_capacity));
+        return NULL;
+    }
 
     return list;
 }
 
+ArrayList* arraylist_create_with_allocator(size_t element_size, size_t initial_capacity,
+                                           GrowthStrategy growth, DestroyFn destroy,
+                                           const DSAllocator *allocator) {
+    return arraylist_create_impl(element_size, initial_capacity, 0, growth, destroy, allocator);
+}
+
+ArrayList* arraylist_create_small(size_t element_size, size_t inline_capacity,
+                                  GrowthStrategy growth, DestroyFn destroy,
+                                  const DSAllocator *allocator) {
+    if (inline_capacity == 0) {
+        return NULL;
+    }
+    return arraylist_create_impl(element_size, 0, inline_capacity, growth, destroy, allocator);
+}
+
 void arraylist_destroy(ArrayList *list) {
     if (list == NULL) {
         return;
     }
 
     arraylist_clear(list);
-    free(list->array);
-    free(list);
+    release_buffer(list);
+    DSAllocator allocator = list->allocator;
+    ds_free(&allocator, list, header_bytes(list->element_size, list->inline_capacity));
 }
 
 // ============================================================================
@@ -212,6 +430,46 @@ DataStructureError arraylist_insert(ArrayList *list, size_t index, const void *d
     return DS_SUCCESS;
 }
 
+DataStructureError arraylist_append_n(ArrayList *list, const void *data, size_t count) {
+    return arraylist_insert_range(list, list != NULL ? list->size : 0, data, count);
+}
+
+/**
+ * @brief Insere um intervalo em posição específica
+ *
+ * Complexidade: O(n + count)
+ */
+DataStructureError arraylist_insert_range(ArrayList *list, size_t index,
+                                          const void *data, size_t count) {
+    if (list == NULL || (data == NULL && count > 0)) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    if (index > list->size) {
+        return DS_ERROR_INVALID_INDEX;
+    }
+
+    if (count == 0) {
+        return DS_SUCCESS;
+    }
+
+    DataStructureError err = arraylist_grow_for(list, count);
+    if (err != DS_SUCCESS) {
+        return err;
+    }
+
+    // Um único deslocamento da cauda para abrir count posições
+    char *at = (char*)list->array + (index * list->element_size);
+    if (index < list->size) {
+        memmove(at + count * list->element_size, at,
+                (list->size - index) * list->element_size);
+    }
+    memcpy(at, data, count * list->element_size);
+
+    list->size += count;
+    return DS_SUCCESS;
+}
+
 // ============================================================================
 // REMOÇÃO
 // ============================================================================
@@ -275,6 +533,71 @@ DataStructureError arraylist_remove_at(ArrayList *list, size_t index, void *outp
     return DS_SUCCESS;
 }
 
+DataStructureError arraylist_erase_range(ArrayList *list, size_t first, size_t count) {
+    if (list == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    if (first > list->size || count > list->size - first) {
+        return DS_ERROR_INVALID_INDEX;
+    }
+
+    char *at = (char*)list->array + (first * list->element_size);
+
+    if (list->destroy != NULL) {
+        for (size_t i = 0; i < count; i++) {
+            list->destroy(at + i * list->element_size);
+        }
+    }
+
+    size_t tail = list->size - first - count;
+    if (count > 0 && tail > 0) {
+        memmove(at, at + count * list->element_size, tail * list->element_size);
+    }
+
+    list->size -= count;
+    return DS_SUCCESS;
+}
+
+/**
+ * @brief Remove os elementos que satisfazem pred (compactação estável)
+ *
+ * Percorre a lista uma vez; cada bloco contíguo de elementos mantidos é
+ * movido com um memmove para logo após o último mantido. O fim da lista
+ * (i == size) fecha o último bloco.
+ *
+ * Complexidade: O(n)
+ */
+size_t arraylist_erase_if(ArrayList *list, ArrayListPredicateFn pred, void *ctx) {
+    if (list == NULL || pred == NULL) {
+        return 0;
+    }
+
+    size_t esz = list->element_size;
+    char *base = (char*)list->array;
+    size_t write = 0;   // Próxima posição final livre
+    size_t run = 0;     // Início do bloco de mantidos atual
+
+    // pred é chamado exatamente uma vez por elemento, em ordem
+    for (size_t i = 0; i <= list->size; i++) {
+        if (i < list->size && !pred(base + i * esz, ctx)) {
+            continue;
+        }
+        if (i > run && write != run) {
+            memmove(base + write * esz, base + run * esz, (i - run) * esz);
+        }
+        write += i - run;
+        if (i < list->size && list->destroy != NULL) {
+            list->destroy(base + i * esz);
+        }
+        run = i + 1;
+    }
+
+    size_t removed = list->size - write;
+    list->size = write;
+    return removed;
+}
+
 DataStructureError arraylist_remove(ArrayList *list, const void *data, CompareFn compare) {
     if (list == NULL || data == NULL || compare == NULL) {
         return DS_ERROR_NULL_POINTER;
@@ -410,6 +733,27 @@ size_t arraylist_capacity(const ArrayList *list) {
     return (list == NULL) ? 0 : list->capacity;
 }
 
+size_t arraylist_memory_usage(const ArrayList *list) {
+    if (list == NULL) {
+        return 0;
+    }
+    size_t bytes = header_bytes(list->element_size, list->inline_capacity);
+    if (is_inline(list)) {
+        return bytes;
+    }
+    size_t buffer = list->capacity * list->element_size;
+#if ARRAYLIST_USE_MREMAP
+    if (list->mapped) {
+        buffer = mapped_bytes(buffer);
+    }
+#endif
+    return bytes + buffer;
+}
+
+bool arraylist_is_inline(const ArrayList *list) {
+    return list != NULL && is_inline(list);
+}
+
 void arraylist_clear(ArrayList *list) {
     if (list == NULL) {
         return;
@@ -458,7 +802,8 @@ void arraylist_print(const ArrayList *list, PrintFn print) {
     printf("ArrayList(size=%zu, capacity=%zu, growth=%s) [",
            list->size, list->capacity,
            list->growth == GROWTH_DOUBLE ? "2x" :
-           list->growth == GROWTH_1_5 ? "1.5x" : "FIXED");
+           list->growth == GROWTH_1_5 ? "1.5x" :
+           list->growth == GROWTH_GOLDEN ? "1.625x" : "FIXED");
 
     for (size_t i = 0; i < list->size; i++) {
         if (i > 0) printf(", ");
@@ -507,8 +852,9 @@ ArrayList* arraylist_clone(const ArrayList *list, CopyFn copy) {
         return NULL;
     }
 
-    ArrayList *new_list = arraylist_create_with_growth(
-        list->element_size, list->capacity, list->growth, list->destroy);
+    ArrayList *new_list = arraylist_create_impl(
+        list->element_size, list->capacity, list->inline_capacity, list->growth,
+        list->destroy, &list->allocator);
 
     if (new_list == NULL) {
         return NULL;
@@ -537,8 +883,7 @@ void arraylist_sort(ArrayList *list, CompareFn compare) {
         return;
     }
 
-    // Usar qsort da stdlib
-    qsort(list->array, list->size, list->element_size, compare);
+    ds_pdqsort(list->array, list->size, list->element_size, compare);
 }
 
 void* arraylist_data(const ArrayList *list) {
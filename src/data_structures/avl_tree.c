@@ -22,6 +22,8 @@
  */
 
 #include "data_structures/avl_tree.h"
+#include "data_structures/instrument.h"
+#include "data_structures/thread_pool.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -34,7 +36,8 @@ struct AVLNode {
     void *data;
     AVLNode *left;
     AVLNode *right;
-    int height;
+    ds_index_t size;    /**< Nós da subárvore (order statistics) */
+    int height;         /**< Com DS_COMPACT_INDEX, size + height cabem em 8 bytes */
 };
 
 struct AVLTree {
@@ -43,6 +46,7 @@ struct AVLTree {
     size_t size;
     CompareFn compare;
     DestroyFn destroy;
+    DSAllocator allocator;
 };
 
 // ============================================================================
@@ -57,11 +61,17 @@ static int balance_factor(const AVLNode *node) {
     return node == NULL ? 0 : node_height(node->left) - node_height(node->right);
 }
 
+static size_t node_size(const AVLNode *node) {
+    return node == NULL ? 0 : node->size;
+}
+
+/* Recalcula altura e tamanho da subárvore a partir dos filhos */
 static void update_height(AVLNode *node) {
     if (node == NULL) return;
     int lh = node_height(node->left);
     int rh = node_height(node->right);
     node->height = 1 + (lh > rh ? lh : rh);
+    node->size = (ds_index_t)(1 + node_size(node->left) + node_size(node->right));
 }
 
 /**
@@ -76,6 +86,7 @@ static void update_height(AVLNode *node) {
 static AVLNode* rotate_right(AVLNode *y) {
     AVLNode *x = y->left;
     AVLNode *B = x->right;
+    DS_COUNT(AVL_TREE, ROTATIONS, 1);
 
     x->right = y;
     y->left = B;
@@ -98,6 +109,7 @@ static AVLNode* rotate_right(AVLNode *y) {
 static AVLNode* rotate_left(AVLNode *x) {
     AVLNode *y = x->right;
     AVLNode *B = y->left;
+    DS_COUNT(AVL_TREE, ROTATIONS, 1);
 
     y->left = x;
     x->right = B;
@@ -139,40 +151,41 @@ static AVLNode* balance(AVLNode *node) {
     return node;
 }
 
-static AVLNode* create_node(const void *data, size_t element_size) {
-    AVLNode *node = (AVLNode*)malloc(sizeof(AVLNode));
+static AVLNode* create_node(AVLTree *tree, const void *data) {
+    AVLNode *node = (AVLNode*)ds_alloc(&tree->allocator, sizeof(AVLNode));
     if (node == NULL) return NULL;
 
-    node->data = malloc(element_size);
+    node->data = ds_alloc(&tree->allocator, tree->element_size);
     if (node->data == NULL) {
-        free(node);
+        ds_free(&tree->allocator, node, sizeof(AVLNode));
         return NULL;
     }
 
-    memcpy(node->data, data, element_size);
+    memcpy(node->data, data, tree->element_size);
     node->left = NULL;
     node->right = NULL;
     node->height = 0;
+    node->size = 1;
     return node;
 }
 
-static void destroy_node(AVLNode *node, DestroyFn destroy) {
+static void destroy_node(AVLTree *tree, AVLNode *node) {
     if (node == NULL) return;
 
-    if (destroy != NULL && node->data != NULL) {
-        destroy(node->data);
+    if (tree->destroy != NULL && node->data != NULL) {
+        tree->destroy(node->data);
     }
 
-    free(node->data);
-    free(node);
+    ds_free(&tree->allocator, node->data, tree->element_size);
+    ds_free(&tree->allocator, node, sizeof(AVLNode));
 }
 
-static void destroy_recursive(AVLNode *node, DestroyFn destroy) {
+static void destroy_recursive(AVLTree *tree, AVLNode *node) {
     if (node == NULL) return;
 
-    destroy_recursive(node->left, destroy);
-    destroy_recursive(node->right, destroy);
-    destroy_node(node, destroy);
+    destroy_recursive(tree, node->left);
+    destroy_recursive(tree, node->right);
+    destroy_node(tree, node);
 }
 
 static AVLNode* find_min_node(AVLNode *node) {
@@ -191,43 +204,42 @@ static AVLNode* find_max_node(AVLNode *node) {
     return node;
 }
 
-static AVLNode* insert_recursive(AVLNode *node, const void *data,
-                                 size_t element_size, CompareFn compare,
-                                 bool *success) {
+static AVLNode* insert_recursive(AVLTree *tree, AVLNode *node,
+                                 const void *data, bool *success) {
     if (node == NULL) {
-        AVLNode *new_node = create_node(data, element_size);
+        AVLNode *new_node = create_node(tree, data);
         if (new_node == NULL) {
             *success = false;
         }
         return new_node;
     }
 
-    int cmp = compare(data, node->data);
+    int cmp = tree->compare(data, node->data);
     if (cmp < 0) {
-        node->left = insert_recursive(node->left, data, element_size, compare, success);
+        node->left = insert_recursive(tree, node->left, data, success);
     } else if (cmp > 0) {
-        node->right = insert_recursive(node->right, data, element_size, compare, success);
+        node->right = insert_recursive(tree, node->right, data, success);
     } else {
-        node->right = insert_recursive(node->right, data, element_size, compare, success);
+        node->right = insert_recursive(tree, node->right, data, success);
     }
 
     return balance(node);
 }
 
-static AVLNode* remove_recursive(AVLNode *node, const void *key,
-                                 CompareFn compare, DestroyFn destroy,
-                                 size_t element_size, bool *found) {
+static AVLNode* remove_recursive(AVLTree *tree, AVLNode *node,
+                                 const void *key, bool *found) {
     if (node == NULL) {
         *found = false;
         return NULL;
     }
 
-    int cmp = compare(key, node->data);
+    int cmp = tree->compare(key, node->data);
+    size_t element_size = tree->element_size;
 
     if (cmp < 0) {
-        node->left = remove_recursive(node->left, key, compare, destroy, element_size, found);
+        node->left = remove_recursive(tree, node->left, key, found);
     } else if (cmp > 0) {
-        node->right = remove_recursive(node->right, key, compare, destroy, element_size, found);
+        node->right = remove_recursive(tree, node->right, key, found);
     } else {
         *found = true;
 
@@ -235,10 +247,10 @@ static AVLNode* remove_recursive(AVLNode *node, const void *key,
             AVLNode *child = node->left ? node->left : node->right;
 
             if (child == NULL) {
-                destroy_node(node, destroy);
+                destroy_node(tree, node);
                 return NULL;
             } else {
-                destroy_node(node, destroy);
+                destroy_node(tree, node);
                 return child;
             }
         } else {
@@ -248,15 +260,14 @@ static AVLNode* remove_recursive(AVLNode *node, const void *key,
             if (temp_data != NULL) {
                 memcpy(temp_data, successor->data, element_size);
 
-                if (destroy != NULL && node->data != NULL) {
-                    destroy(node->data);
+                if (tree->destroy != NULL && node->data != NULL) {
+                    tree->destroy(node->data);
                 }
                 memcpy(node->data, temp_data, element_size);
                 free(temp_data);
 
                 bool successor_found = false;
-                node->right = remove_recursive(node->right, successor->data,
-                                               compare, destroy, element_size,
+                node->right = remove_recursive(tree, node->right, successor->data,
                                                &successor_found);
             }
         }
@@ -265,25 +276,241 @@ static AVLNode* remove_recursive(AVLNode *node, const void *key,
     return balance(node);
 }
 
-static void inorder_recursive(const AVLNode *node, AVLTraversalFn callback, void *user_data) {
-    if (node == NULL) return;
-    inorder_recursive(node->left, callback, user_data);
-    callback(node->data, user_data);
-    inorder_recursive(node->right, callback, user_data);
+// ============================================================================
+// JOIN / SPLIT
+// ============================================================================
+
+/**
+ * join(L, m, R): todos de L <= m <= todos de R. Se as alturas diferem em
+ * mais de 1, desce pela espinha da árvore mais alta até uma subárvore com
+ * altura próxima da outra, pendura m ali e rebalanceia na volta.
+ *
+ * Complexidade: O(|h(L) - h(R)| + 1)
+ * Referência: Blelloch, Ferizovic & Sun (2016), "Just Join for Parallel
+ * Ordered Sets". SPAA
+ */
+static AVLNode* join_nodes(AVLNode *left, AVLNode *mid, AVLNode *right) {
+    int hl = node_height(left);
+    int hr = node_height(right);
+    if (hl > hr + 1) {
+        left->right = join_nodes(left->right, mid, right);
+        return balance(left);
+    }
+    if (hr > hl + 1) {
+        right->left = join_nodes(left, mid, right->left);
+        return balance(right);
+    }
+    mid->left = left;
+    mid->right = right;
+    update_height(mid);
+    return mid;
 }
 
-static void preorder_recursive(const AVLNode *node, AVLTraversalFn callback, void *user_data) {
-    if (node == NULL) return;
-    callback(node->data, user_data);
-    preorder_recursive(node->left, callback, user_data);
-    preorder_recursive(node->right, callback, user_data);
+// Separa o maior nó de node: *rest recebe os demais
+static AVLNode* split_last(AVLNode *node, AVLNode **rest) {
+    if (node->right == NULL) {
+        *rest = node->left;
+        return node;
+    }
+    AVLNode *right_rest;
+    AVLNode *last = split_last(node->right, &right_rest);
+    *rest = join_nodes(node->left, node, right_rest);
+    return last;
 }
 
-static void postorder_recursive(const AVLNode *node, AVLTraversalFn callback, void *user_data) {
-    if (node == NULL) return;
-    postorder_recursive(node->left, callback, user_data);
-    postorder_recursive(node->right, callback, user_data);
-    callback(node->data, user_data);
+// join sem nó do meio: o maior de L vira o meio
+static AVLNode* join2(AVLNode *left, AVLNode *right) {
+    if (left == NULL) return right;
+    AVLNode *rest;
+    AVLNode *last = split_last(left, &rest);
+    return join_nodes(rest, last, right);
+}
+
+/**
+ * split(node, key): *less recebe os < key, *greater os > key, e o retorno
+ * é o nó igual a key mais próximo da raiz (NULL se não houver). Com
+ * repetidos, as demais cópias ficam em less/greater.
+ *
+ * Complexidade: O(log n)
+ */
+static AVLNode* split_node(const AVLTree *tree, AVLNode *node, const void *key,
+                           AVLNode **less, AVLNode **greater) {
+    if (node == NULL) {
+        *less = NULL;
+        *greater = NULL;
+        return NULL;
+    }
+    int cmp = tree->compare(key, node->data);
+    AVLNode *left = node->left;
+    AVLNode *right = node->right;
+    if (cmp == 0) {
+        *less = left;
+        *greater = right;
+        node->left = node->right = NULL;
+        update_height(node);
+        return node;
+    }
+    AVLNode *found;
+    if (cmp < 0) {
+        AVLNode *inner;
+        found = split_node(tree, left, key, less, &inner);
+        *greater = join_nodes(inner, node, right);
+    } else {
+        AVLNode *inner;
+        found = split_node(tree, right, key, &inner, greater);
+        *less = join_nodes(left, node, inner);
+    }
+    return found;
+}
+
+/*
+ * Operações de conjunto: dst é consumida e reconstruída, src (other) é só
+ * lida. Cada nível divide dst pela raiz de src e resolve as duas metades de
+ * forma independente (as chamadas recursivas não compartilham nós); o custo
+ * total é O(m log(n/m + 1)), com m <= n os tamanhos das duas árvores.
+ *
+ * Com o alocador padrão (thread-safe) e mais de uma thread, metades com
+ * pelo menos AVL_SET_PARALLEL_MIN nós somados rodam em paralelo no pool
+ * global (ds_parallel_invoke), com profundidade O(log^2 n). Com alocador
+ * customizado (uma arena, p.ex.) tudo roda em série.
+ */
+
+/** Nós (dst + src) abaixo dos quais as duas metades rodam em série */
+#define AVL_SET_PARALLEL_MIN 4096
+
+typedef enum {
+    SET_UNION,
+    SET_INTERSECTION,
+    SET_DIFFERENCE
+} SetOp;
+
+typedef struct {
+    AVLTree *tree;
+    SetOp op;
+    CopyFn copy_fn;         // só na união
+    bool parallel;
+} SetOpCtx;
+
+typedef struct {
+    const SetOpCtx *ctx;
+    AVLNode *node;
+    const AVLNode *other;
+    AVLNode *result;
+    bool ok;                // falso se a união ficou sem memória
+} SetOpHalf;
+
+static AVLNode* set_op_nodes(const SetOpCtx *ctx, AVLNode *node, const AVLNode *other,
+                             bool *ok);
+
+static void set_op_task(void *arg) {
+    SetOpHalf *half = arg;
+    half->result = set_op_nodes(half->ctx, half->node, half->other, &half->ok);
+}
+
+// Resolve (less, other->left) e (greater, other->right); *ok fica falso se
+// alguma metade falhar
+static void set_op_halves(const SetOpCtx *ctx, AVLNode *less, AVLNode *greater,
+                          const AVLNode *other, AVLNode **left, AVLNode **right,
+                          bool *ok) {
+    SetOpHalf lo = { ctx, less, other->left, NULL, true };
+    SetOpHalf hi = { ctx, greater, other->right, NULL, true };
+    if (ctx->parallel &&
+        node_size(less) + node_size(greater) + node_size(other) >= AVL_SET_PARALLEL_MIN) {
+        ds_parallel_invoke(set_op_task, &lo, set_op_task, &hi);
+    } else {
+        set_op_task(&lo);
+        set_op_task(&hi);
+    }
+    *left = lo.result;
+    *right = hi.result;
+    if (!lo.ok || !hi.ok) *ok = false;
+}
+
+static AVLNode* union_nodes(const SetOpCtx *ctx, AVLNode *node, const AVLNode *other,
+                            bool *ok) {
+    if (other == NULL) return node;
+    AVLTree *tree = ctx->tree;
+    AVLNode *less, *greater, *left, *right;
+    AVLNode *mid = split_node(tree, node, other->data, &less, &greater);
+    set_op_halves(ctx, less, greater, other, &left, &right, ok);
+    if (mid == NULL) {
+        if (ctx->copy_fn != NULL) {
+            void *copied = ctx->copy_fn(other->data);
+            mid = (copied != NULL) ? create_node(tree, copied) : NULL;
+            free(copied);
+        } else {
+            mid = create_node(tree, other->data);
+        }
+        if (mid == NULL) {
+            *ok = false;
+            return join2(left, right);
+        }
+    }
+    return join_nodes(left, mid, right);
+}
+
+static AVLNode* intersection_nodes(const SetOpCtx *ctx, AVLNode *node, const AVLNode *other,
+                                   bool *ok) {
+    if (node == NULL) return NULL;
+    if (other == NULL) {
+        destroy_recursive(ctx->tree, node);
+        return NULL;
+    }
+    AVLNode *less, *greater, *left, *right;
+    AVLNode *mid = split_node(ctx->tree, node, other->data, &less, &greater);
+    set_op_halves(ctx, less, greater, other, &left, &right, ok);
+    return (mid != NULL) ? join_nodes(left, mid, right) : join2(left, right);
+}
+
+static AVLNode* difference_nodes(const SetOpCtx *ctx, AVLNode *node, const AVLNode *other,
+                                 bool *ok) {
+    if (node == NULL || other == NULL) return node;
+    AVLNode *less, *greater, *left, *right;
+    AVLNode *mid = split_node(ctx->tree, node, other->data, &less, &greater);
+    set_op_halves(ctx, less, greater, other, &left, &right, ok);
+    destroy_node(ctx->tree, mid);
+    return join2(left, right);
+}
+
+static AVLNode* set_op_nodes(const SetOpCtx *ctx, AVLNode *node, const AVLNode *other,
+                             bool *ok) {
+    switch (ctx->op) {
+        case SET_UNION:        return union_nodes(ctx, node, other, ok);
+        case SET_INTERSECTION: return intersection_nodes(ctx, node, other, ok);
+        case SET_DIFFERENCE:
+        default:               return difference_nodes(ctx, node, other, ok);
+    }
+}
+
+// Aplica op sobre tree->root; paraleliza só com o alocador padrão
+static bool set_op_run(AVLTree *tree, const AVLTree *other, SetOp op, CopyFn copy_fn) {
+    SetOpCtx ctx = {
+        .tree = tree,
+        .op = op,
+        .copy_fn = copy_fn,
+        .parallel = tree->allocator.alloc == ds_default_allocator()->alloc &&
+                    ds_get_num_threads() > 1
+    };
+    bool ok = true;
+    tree->root = set_op_nodes(&ctx, tree->root, other->root, &ok);
+    tree->size = node_size(tree->root);
+    return ok;
+}
+
+// Árvore perfeitamente balanceada sobre array[lo, hi)
+static AVLNode* build_recursive(AVLTree *tree, const unsigned char *array,
+                                size_t lo, size_t hi, bool *ok) {
+    if (lo >= hi || !*ok) return NULL;
+    size_t mid = lo + (hi - lo) / 2;
+    AVLNode *node = create_node(tree, array + mid * tree->element_size);
+    if (node == NULL) {
+        *ok = false;
+        return NULL;
+    }
+    node->left = build_recursive(tree, array, lo, mid, ok);
+    node->right = build_recursive(tree, array, mid + 1, hi, ok);
+    update_height(node);
+    return node;
 }
 
 static bool is_valid_recursive(const AVLNode *node, const void *min, const void *max,
@@ -306,39 +533,30 @@ static bool is_valid_recursive(const AVLNode *node, const void *min, const void
 
     int bf = left_height - right_height;
     if (bf < -1 || bf > 1) return false;
+    if (node->size != 1 + node_size(node->left) + node_size(node->right)) return false;
 
     *computed_height = expected_height;
     return true;
 }
 
-static AVLNode* clone_recursive(const AVLNode *node, size_t element_size, CopyFn copy_fn) {
+static AVLNode* clone_recursive(AVLTree *dst, const AVLNode *node, CopyFn copy_fn) {
     if (node == NULL) return NULL;
 
-    AVLNode *new_node = (AVLNode*)malloc(sizeof(AVLNode));
-    if (new_node == NULL) return NULL;
-
-    new_node->data = malloc(element_size);
-    if (new_node->data == NULL) {
-        free(new_node);
-        return NULL;
-    }
-
+    AVLNode *new_node;
     if (copy_fn != NULL) {
         void *copied = copy_fn(node->data);
-        if (copied == NULL) {
-            free(new_node->data);
-            free(new_node);
-            return NULL;
-        }
-        memcpy(new_node->data, copied, element_size);
+        if (copied == NULL) return NULL;
+        new_node = create_node(dst, copied);
         free(copied);
     } else {
-        memcpy(new_node->data, node->data, element_size);
+        new_node = create_node(dst, node->data);
     }
+    if (new_node == NULL) return NULL;
 
     new_node->height = node->height;
-    new_node->left = clone_recursive(node->left, element_size, copy_fn);
-    new_node->right = clone_recursive(node->right, element_size, copy_fn);
+    new_node->size = node->size;
+    new_node->left = clone_recursive(dst, node->left, copy_fn);
+    new_node->right = clone_recursive(dst, node->right, copy_fn);
 
     return new_node;
 }
@@ -393,6 +611,22 @@ static void range_count_nodes(const AVLNode *node, const void *min, const void *
     }
 }
 
+/* Elementos < key (ou <= key com inclusive), descendo um único caminho */
+static size_t count_less(const AVLTree *tree, const void *key, bool inclusive) {
+    size_t count = 0;
+    const AVLNode *node = tree->root;
+    while (node != NULL) {
+        int cmp = tree->compare(node->data, key);
+        if (cmp < 0 || (inclusive && cmp == 0)) {
+            count += node_size(node->left) + 1;
+            node = node->right;
+        } else {
+            node = node->left;
+        }
+    }
+    return count;
+}
+
 static void print_recursive(const AVLNode *node, PrintFn print, int depth) {
     if (node == NULL) return;
 
@@ -412,11 +646,18 @@ static void print_recursive(const AVLNode *node, PrintFn print, int depth) {
 // ============================================================================
 
 AVLTree* avl_create(size_t element_size, CompareFn compare, DestroyFn destroy) {
+    return avl_create_with_allocator(element_size, compare, destroy, NULL);
+}
+
+AVLTree* avl_create_with_allocator(size_t element_size, CompareFn compare,
+                                   DestroyFn destroy, const DSAllocator *allocator) {
     if (element_size == 0 || compare == NULL) return NULL;
+    if (allocator == NULL) allocator = ds_default_allocator();
 
-    AVLTree *tree = (AVLTree*)malloc(sizeof(AVLTree));
+    AVLTree *tree = (AVLTree*)ds_alloc(allocator, sizeof(AVLTree));
     if (tree == NULL) return NULL;
 
+    tree->allocator = *allocator;
     tree->root = NULL;
     tree->element_size = element_size;
     tree->size = 0;
@@ -426,19 +667,43 @@ AVLTree* avl_create(size_t element_size, CompareFn compare, DestroyFn destroy) {
     return tree;
 }
 
+AVLTree* avl_from_sorted_array(size_t element_size, const void *array, size_t size,
+                               CompareFn compare, DestroyFn destroy) {
+    if ((array == NULL && size > 0) || size > DS_INDEX_MAX) return NULL;
+    const unsigned char *bytes = (const unsigned char*)array;
+    for (size_t i = 1; i < size && compare != NULL; i++) {
+        if (compare(bytes + (i - 1) * element_size, bytes + i * element_size) > 0) return NULL;
+    }
+
+    AVLTree *tree = avl_create(element_size, compare, destroy);
+    if (tree == NULL) return NULL;
+
+    bool ok = true;
+    tree->root = build_recursive(tree, bytes, 0, size, &ok);
+    tree->size = size;
+    if (!ok) {
+        // As cópias rasas ainda pertencem ao chamador
+        tree->destroy = NULL;
+        avl_destroy(tree);
+        return NULL;
+    }
+    return tree;
+}
+
 void avl_destroy(AVLTree *tree) {
     if (tree == NULL) return;
 
-    destroy_recursive(tree->root, tree->destroy);
-    free(tree);
+    destroy_recursive(tree, tree->root);
+    DSAllocator allocator = tree->allocator;
+    ds_free(&allocator, tree, sizeof(AVLTree));
 }
 
 DataStructureError avl_insert(AVLTree *tree, const void *data) {
     if (tree == NULL || data == NULL) return DS_ERROR_NULL_POINTER;
+    if (tree->size >= DS_INDEX_MAX) return DS_ERROR_FULL;
 
     bool success = true;
-    tree->root = insert_recursive(tree->root, data, tree->element_size,
-                                  tree->compare, &success);
+    tree->root = insert_recursive(tree, tree->root, data, &success);
 
     if (!success) return DS_ERROR_OUT_OF_MEMORY;
 
@@ -480,8 +745,7 @@ DataStructureError avl_remove(AVLTree *tree, const void *data) {
     if (tree->root == NULL) return DS_ERROR_EMPTY;
 
     bool found = true;
-    tree->root = remove_recursive(tree->root, data, tree->compare,
-                                  tree->destroy, tree->element_size, &found);
+    tree->root = remove_recursive(tree, tree->root, data, &found);
 
     if (!found) return DS_ERROR_NOT_FOUND;
 
@@ -540,19 +804,159 @@ DataStructureError avl_range_search(const AVLTree *tree, const void *min,
     return DS_SUCCESS;
 }
 
-void avl_inorder(const AVLTree *tree, AVLTraversalFn callback, void *user_data) {
+DataStructureError avl_select(const AVLTree *tree, size_t k, void *output) {
+    if (tree == NULL || output == NULL) return DS_ERROR_NULL_POINTER;
+    if (k == 0 || k > tree->size) return DS_ERROR_INVALID_INDEX;
+
+    const AVLNode *node = tree->root;
+    while (node != NULL) {
+        size_t left = node_size(node->left);
+        if (k <= left) {
+            node = node->left;
+        } else if (k == left + 1) {
+            memcpy(output, node->data, tree->element_size);
+            return DS_SUCCESS;
+        } else {
+            k -= left + 1;
+            node = node->right;
+        }
+    }
+    return DS_ERROR_NOT_FOUND;
+}
+
+size_t avl_rank(const AVLTree *tree, const void *data) {
+    if (tree == NULL || data == NULL) return 0;
+    return count_less(tree, data, false);
+}
+
+size_t avl_range_count(const AVLTree *tree, const void *min, const void *max) {
+    if (tree == NULL || min == NULL || max == NULL) return 0;
+    if (tree->compare(min, max) > 0) return 0;
+    return count_less(tree, max, true) - count_less(tree, min, false);
+}
+
+DataStructureError avl_union(AVLTree *tree, const AVLTree *other, CopyFn copy_fn) {
+    if (tree == NULL || other == NULL) return DS_ERROR_NULL_POINTER;
+    if (tree == other) return DS_SUCCESS;
+    if (other->size > DS_INDEX_MAX - tree->size) return DS_ERROR_FULL;
+
+    return set_op_run(tree, other, SET_UNION, copy_fn) ? DS_SUCCESS : DS_ERROR_OUT_OF_MEMORY;
+}
+
+DataStructureError avl_intersection(AVLTree *tree, const AVLTree *other) {
+    if (tree == NULL || other == NULL) return DS_ERROR_NULL_POINTER;
+    if (tree == other) return DS_SUCCESS;
+
+    set_op_run(tree, other, SET_INTERSECTION, NULL);
+    return DS_SUCCESS;
+}
+
+DataStructureError avl_difference(AVLTree *tree, const AVLTree *other) {
+    if (tree == NULL || other == NULL) return DS_ERROR_NULL_POINTER;
+
+    if (tree == other) {
+        avl_clear(tree);
+        return DS_SUCCESS;
+    }
+    set_op_run(tree, other, SET_DIFFERENCE, NULL);
+    return DS_SUCCESS;
+}
+
+// Empilha node e a descida à esquerda (inorder) ou "esquerda, senão
+// direita" (primeiro nó em pós-ordem)
+static void iter_push_left(AVLIter *it, const AVLNode *node) {
+    while (node != NULL) {
+        it->stack[it->depth++] = node;
+        node = node->left;
+    }
+}
+
+static void iter_push_postorder(AVLIter *it, const AVLNode *node) {
+    while (node != NULL) {
+        it->stack[it->depth++] = node;
+        node = (node->left != NULL) ? node->left : node->right;
+    }
+}
+
+void avl_iter_begin(const AVLTree *tree, AVLOrder order, AVLIter *it) {
+    if (it == NULL) return;
+
+    it->depth = 0;
+    it->order = order;
+    if (tree == NULL || tree->root == NULL) return;
+    switch (order) {
+        case AVL_INORDER:   iter_push_left(it, tree->root); break;
+        case AVL_PREORDER:  it->stack[it->depth++] = tree->root; break;
+        case AVL_POSTORDER: iter_push_postorder(it, tree->root); break;
+    }
+}
+
+void avl_iter_seek(const AVLTree *tree, const void *key, AVLIter *it) {
+    if (it == NULL) return;
+
+    it->depth = 0;
+    it->order = AVL_INORDER;
+    if (tree == NULL || key == NULL) return;
+
+    // Empilha os nós >= key da descida: exatamente os pendentes da ordem
+    const AVLNode *node = tree->root;
+    while (node != NULL) {
+        if (tree->compare(node->data, key) >= 0) {
+            it->stack[it->depth++] = node;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+}
+
+bool avl_iter_next(AVLIter *it, void **data) {
+    if (it == NULL || it->depth == 0) return false;
+
+    const AVLNode *node = it->stack[--it->depth];
+    switch (it->order) {
+        case AVL_INORDER:
+            iter_push_left(it, node->right);
+            break;
+        case AVL_PREORDER:
+            if (node->right != NULL) it->stack[it->depth++] = node->right;
+            if (node->left != NULL) it->stack[it->depth++] = node->left;
+            break;
+        case AVL_POSTORDER:
+            if (it->depth > 0) {
+                const AVLNode *parent = it->stack[it->depth - 1];
+                if (parent->left == node && parent->right != NULL) {
+                    iter_push_postorder(it, parent->right);
+                }
+            }
+            break;
+    }
+    if (data != NULL) *data = node->data;
+    return true;
+}
+
+static void walk(const AVLTree *tree, AVLOrder order, AVLTraversalFn callback,
+                 void *user_data) {
     if (tree == NULL || callback == NULL) return;
-    inorder_recursive(tree->root, callback, user_data);
+
+    AVLIter it;
+    void *data;
+    avl_iter_begin(tree, order, &it);
+    while (avl_iter_next(&it, &data)) {
+        callback(data, user_data);
+    }
+}
+
+void avl_inorder(const AVLTree *tree, AVLTraversalFn callback, void *user_data) {
+    walk(tree, AVL_INORDER, callback, user_data);
 }
 
 void avl_preorder(const AVLTree *tree, AVLTraversalFn callback, void *user_data) {
-    if (tree == NULL || callback == NULL) return;
-    preorder_recursive(tree->root, callback, user_data);
+    walk(tree, AVL_PREORDER, callback, user_data);
 }
 
 void avl_postorder(const AVLTree *tree, AVLTraversalFn callback, void *user_data) {
-    if (tree == NULL || callback == NULL) return;
-    postorder_recursive(tree->root, callback, user_data);
+    walk(tree, AVL_POSTORDER, callback, user_data);
 }
 
 bool avl_is_empty(const AVLTree *tree) {
@@ -568,6 +972,11 @@ int avl_height(const AVLTree *tree) {
     return node_height(tree->root);
 }
 
+size_t avl_memory_usage(const AVLTree *tree) {
+    if (tree == NULL) return 0;
+    return sizeof(AVLTree) + tree->size * (sizeof(AVLNode) + tree->element_size);
+}
+
 bool avl_is_valid(const AVLTree *tree) {
     if (tree == NULL) return false;
 
@@ -582,7 +991,7 @@ bool avl_is_valid(const AVLTree *tree) {
 void avl_clear(AVLTree *tree) {
     if (tree == NULL) return;
 
-    destroy_recursive(tree->root, tree->destroy);
+    destroy_recursive(tree, tree->root);
     tree->root = NULL;
     tree->size = 0;
 }
@@ -590,10 +999,11 @@ void avl_clear(AVLTree *tree) {
 AVLTree* avl_clone(const AVLTree *tree, CopyFn copy_fn) {
     if (tree == NULL) return NULL;
 
-    AVLTree *new_tree = avl_create(tree->element_size, tree->compare, tree->destroy);
+    AVLTree *new_tree = avl_create_with_allocator(tree->element_size, tree->compare,
+                                                  tree->destroy, &tree->allocator);
     if (new_tree == NULL) return NULL;
 
-    new_tree->root = clone_recursive(tree->root, tree->element_size, copy_fn);
+    new_tree->root = clone_recursive(new_tree, tree->root, copy_fn);
     new_tree->size = tree->size;
 
     return new_tree;
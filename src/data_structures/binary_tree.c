@@ -5,7 +5,8 @@
  * Estrutura hierárquica onde cada nó tem no máximo dois filhos.
  * Implementa travessias (inorder, preorder, postorder, levelorder),
  * propriedades (altura, tamanho, completa, cheia, perfeita) e
- * operações avançadas (LCA, diâmetro, distância).
+ * operações avançadas (LCA, diâmetro, distância), além de um índice de
+ * LCA em O(1) por consulta para árvores estáticas.
  *
  * Referências:
  * - Cormen et al. (2009), Chapter 12 - Binary Search Trees
@@ -18,6 +19,7 @@
 #include "data_structures/binary_tree.h"
 #include "data_structures/queue.h"  // Para levelorder
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -46,6 +48,7 @@ struct BinaryTree {
     size_t element_size;
     CompareFn compare;
     DestroyFn destroy;
+    DSAllocator allocator;
 };
 
 // ============================================================================
@@ -55,19 +58,19 @@ struct BinaryTree {
 /**
  * @brief Cria um nó alocando memória
  */
-static TreeNode* create_tree_node(size_t element_size, const void *data) {
-    TreeNode *node = (TreeNode*)malloc(sizeof(TreeNode));
+static TreeNode* create_tree_node(BinaryTree *tree, const void *data) {
+    TreeNode *node = (TreeNode*)ds_alloc(&tree->allocator, sizeof(TreeNode));
     if (node == NULL) {
         return NULL;
     }
 
-    node->data = malloc(element_size);
+    node->data = ds_alloc(&tree->allocator, tree->element_size);
     if (node->data == NULL) {
-        free(node);
+        ds_free(&tree->allocator, node, sizeof(TreeNode));
         return NULL;
     }
 
-    memcpy(node->data, data, element_size);
+    memcpy(node->data, data, tree->element_size);
     node->left = NULL;
     node->right = NULL;
     node->parent = NULL;
@@ -76,22 +79,92 @@ static TreeNode* create_tree_node(size_t element_size, const void *data) {
 }
 
 /**
- * @brief Destrói um nó recursivamente (pós-ordem)
+ * @brief Libera um único nó (dados e estrutura)
  */
-static void destroy_node_recursive(TreeNode *node, DestroyFn destroy) {
-    if (node == NULL) {
-        return;
+static void free_tree_node(BinaryTree *tree, TreeNode *node) {
+    if (tree->destroy != NULL) {
+        tree->destroy(node->data);
     }
+    ds_free(&tree->allocator, node->data, tree->element_size);
+    ds_free(&tree->allocator, node, sizeof(TreeNode));
+}
 
-    // Pós-ordem: esquerda → direita → raiz
-    destroy_node_recursive(node->left, destroy);
-    destroy_node_recursive(node->right, destroy);
+/*
+ * Travessias iterativas pelos ponteiros de pai: cada aresta é percorrida
+ * duas vezes (descida e subida), sem recursão nem pilha. Equivalem a
+ * INORDER-TREE-WALK (Cormen p. 288) e às variantes pré/pós-ordem.
+ */
 
-    if (destroy != NULL) {
-        destroy(node->data);
+static const TreeNode* leftmost(const TreeNode *node) {
+    while (node->left != NULL) {
+        node = node->left;
+    }
+    return node;
+}
+
+// Primeiro nó em pós-ordem da subárvore: desce preferindo a esquerda
+static const TreeNode* first_postorder(const TreeNode *node) {
+    for (;;) {
+        if (node->left != NULL) {
+            node = node->left;
+        } else if (node->right != NULL) {
+            node = node->right;
+        } else {
+            return node;
+        }
+    }
+}
+
+static const TreeNode* next_inorder(const TreeNode *node) {
+    if (node->right != NULL) {
+        return leftmost(node->right);
+    }
+    while (node->parent != NULL && node == node->parent->right) {
+        node = node->parent;
+    }
+    return node->parent;
+}
+
+static const TreeNode* next_preorder(const TreeNode *node) {
+    if (node->left != NULL) {
+        return node->left;
+    }
+    if (node->right != NULL) {
+        return node->right;
+    }
+    while (node->parent != NULL) {
+        const TreeNode *parent = node->parent;
+        if (parent->right != NULL && parent->right != node) {
+            return parent->right;
+        }
+        node = parent;
+    }
+    return NULL;
+}
+
+static const TreeNode* next_postorder(const TreeNode *node) {
+    const TreeNode *parent = node->parent;
+    if (parent != NULL && node == parent->left && parent->right != NULL) {
+        return first_postorder(parent->right);
+    }
+    return parent;
+}
+
+/**
+ * @brief Destrói a subárvore de root em pós-ordem, sem recursão
+ */
+static void destroy_subtree(BinaryTree *tree, TreeNode *root) {
+    if (root == NULL) {
+        return;
+    }
+
+    // Esquerda → direita → raiz; o sucessor é lido antes de liberar o nó
+    TreeNode *node = (TreeNode *)first_postorder(root);
+    while (node != NULL) {
+        TreeNode *next = (node == root) ? NULL : (TreeNode *)next_postorder(node);
+        free_tree_node(tree, node);
+        node = next;
     }
-    free(node->data);
-    free(node);
 }
 
 /**
@@ -138,15 +211,25 @@ static size_t count_leaves_recursive(const TreeNode *node) {
 // ============================================================================
 
 BinaryTree* btree_create(size_t element_size, CompareFn compare, DestroyFn destroy) {
+    return btree_create_with_allocator(element_size, compare, destroy, NULL);
+}
+
+BinaryTree* btree_create_with_allocator(size_t element_size, CompareFn compare,
+                                        DestroyFn destroy,
+                                        const DSAllocator *allocator) {
     if (element_size == 0) {
         return NULL;
     }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
 
-    BinaryTree *tree = (BinaryTree*)malloc(sizeof(BinaryTree));
+    BinaryTree *tree = (BinaryTree*)ds_alloc(allocator, sizeof(BinaryTree));
     if (tree == NULL) {
         return NULL;
     }
 
+    tree->allocator = *allocator;
     tree->root = NULL;
     tree->size = 0;
     tree->element_size = element_size;
@@ -161,8 +244,9 @@ void btree_destroy(BinaryTree *tree) {
         return;
     }
 
-    destroy_node_recursive(tree->root, tree->destroy);
-    free(tree);
+    destroy_subtree(tree, tree->root);
+    DSAllocator allocator = tree->allocator;
+    ds_free(&allocator, tree, sizeof(BinaryTree));
 }
 
 // ============================================================================
@@ -174,7 +258,7 @@ TreeNode* btree_create_node(BinaryTree *tree, const void *data) {
         return NULL;
     }
 
-    TreeNode *node = create_tree_node(tree->element_size, data);
+    TreeNode *node = create_tree_node(tree, data);
     if (node != NULL) {
         tree->size++;
     }
@@ -246,74 +330,118 @@ bool btree_is_leaf(const TreeNode *node) {
 // TRAVESSIAS
 // ============================================================================
 
-/**
- * @brief Travessia inorder recursiva
- *
- * Pseudocódigo (Cormen p. 288):
- * INORDER-TREE-WALK(x)
- *   if x ≠ NIL
- *       INORDER-TREE-WALK(x.left)
- *       print x.key
- *       INORDER-TREE-WALK(x.right)
- */
-static void inorder_recursive(const TreeNode *node, TraversalFn callback, void *user_data) {
-    if (node == NULL) {
-        return;
+static void iter_push(BTreeIter *it, const TreeNode *node) {
+    it->stack[it->top++ % BTREE_ITER_STACK] = node;
+    if (it->count < BTREE_ITER_STACK) {
+        it->count++;
+    } else {
+        it->truncated = true;
     }
+}
 
-    inorder_recursive(node->left, callback, user_data);
-    callback(node->data, user_data);
-    inorder_recursive(node->right, callback, user_data);
+static const TreeNode* iter_pop(BTreeIter *it) {
+    if (it->count == 0) {
+        return NULL;
+    }
+    it->count--;
+    return it->stack[--it->top % BTREE_ITER_STACK];
 }
 
-void btree_inorder(const BinaryTree *tree, TraversalFn callback, void *user_data) {
-    if (tree == NULL || callback == NULL) {
+static void iter_push_left(BTreeIter *it, const TreeNode *node) {
+    while (node != NULL) {
+        iter_push(it, node);
+        node = node->left;
+    }
+}
+
+void btree_iter_begin(const BinaryTree *tree, BTreeOrder order, BTreeIter *it) {
+    if (it == NULL) {
         return;
     }
 
-    inorder_recursive(tree->root, callback, user_data);
+    it->top = 0;
+    it->count = 0;
+    it->truncated = false;
+    it->last = NULL;
+    it->order = order;
+    if (tree == NULL || tree->root == NULL) {
+        return;
+    }
+    switch (order) {
+        case BTREE_INORDER:   iter_push_left(it, tree->root); break;
+        case BTREE_PREORDER:  iter_push(it, tree->root); break;
+        case BTREE_POSTORDER: iter_push(it, first_postorder(tree->root)); break;
+    }
 }
 
-/**
- * @brief Travessia preorder recursiva
- */
-static void preorder_recursive(const TreeNode *node, TraversalFn callback, void *user_data) {
+bool btree_iter_next(BTreeIter *it, void **data) {
+    if (it == NULL) {
+        return false;
+    }
+
+    const TreeNode *node = iter_pop(it);
+    if (node == NULL && it->truncated && it->last != NULL) {
+        // Pendente descartado: com a pilha vazia, last não tem filhos a
+        // visitar e o próximo nó é achado subindo pelos pais
+        node = (it->order == BTREE_INORDER) ? next_inorder(it->last)
+                                            : next_preorder(it->last);
+    }
     if (node == NULL) {
-        return;
+        return false;
     }
 
-    callback(node->data, user_data);
-    preorder_recursive(node->left, callback, user_data);
-    preorder_recursive(node->right, callback, user_data);
+    switch (it->order) {
+        case BTREE_INORDER:
+            iter_push_left(it, node->right);
+            break;
+        case BTREE_PREORDER:
+            if (node->right != NULL) {
+                iter_push(it, node->right);
+            }
+            if (node->left != NULL) {
+                iter_push(it, node->left);
+            }
+            break;
+        case BTREE_POSTORDER: {
+            // Pelos pais: cada subida já chega ao próximo da ordem
+            const TreeNode *next = next_postorder(node);
+            if (next != NULL) {
+                iter_push(it, next);
+            }
+            break;
+        }
+    }
+    it->last = node;
+    if (data != NULL) {
+        *data = node->data;
+    }
+    return true;
 }
 
-void btree_preorder(const BinaryTree *tree, TraversalFn callback, void *user_data) {
+static void walk(const BinaryTree *tree, BTreeOrder order, TraversalFn callback,
+                 void *user_data) {
     if (tree == NULL || callback == NULL) {
         return;
     }
 
-    preorder_recursive(tree->root, callback, user_data);
+    BTreeIter it;
+    void *data;
+    btree_iter_begin(tree, order, &it);
+    while (btree_iter_next(&it, &data)) {
+        callback(data, user_data);
+    }
 }
 
-/**
- * @brief Travessia postorder recursiva
- */
-static void postorder_recursive(const TreeNode *node, TraversalFn callback, void *user_data) {
-    if (node == NULL) {
-        return;
-    }
+void btree_inorder(const BinaryTree *tree, TraversalFn callback, void *user_data) {
+    walk(tree, BTREE_INORDER, callback, user_data);
+}
 
-    postorder_recursive(node->left, callback, user_data);
-    postorder_recursive(node->right, callback, user_data);
-    callback(node->data, user_data);
+void btree_preorder(const BinaryTree *tree, TraversalFn callback, void *user_data) {
+    walk(tree, BTREE_PREORDER, callback, user_data);
 }
 
 void btree_postorder(const BinaryTree *tree, TraversalFn callback, void *user_data) {
-    if (tree == NULL || callback == NULL) {
-        return;
-    }
-
-    postorder_recursive(tree->root, callback, user_data);
+    walk(tree, BTREE_POSTORDER, callback, user_data);
 }
 
 /**
@@ -367,6 +495,13 @@ size_t btree_size(const BinaryTree *tree) {
     return tree->size;
 }
 
+size_t btree_memory_usage(const BinaryTree *tree) {
+    if (tree == NULL) {
+        return 0;
+    }
+    return sizeof(BinaryTree) + tree->size * (sizeof(TreeNode) + tree->element_size);
+}
+
 int btree_height(const BinaryTree *tree) {
     if (tree == NULL) {
         return -1;
@@ -529,11 +664,7 @@ DataStructureError btree_remove_node(BinaryTree *tree, TreeNode *node) {
             node->parent->right = NULL;
         }
 
-        if (tree->destroy != NULL) {
-            tree->destroy(node->data);
-        }
-        free(node->data);
-        free(node);
+        free_tree_node(tree, node);
         tree->size--;
         return DS_SUCCESS;
     }
@@ -552,11 +683,7 @@ DataStructureError btree_remove_node(BinaryTree *tree, TreeNode *node) {
         child->parent = node->parent;
     }
 
-    if (tree->destroy != NULL) {
-        tree->destroy(node->data);
-    }
-    free(node->data);
-    free(node);
+    free_tree_node(tree, node);
     tree->size--;
 
     return DS_SUCCESS;
@@ -567,7 +694,7 @@ void btree_clear(BinaryTree *tree) {
         return;
     }
 
-    destroy_node_recursive(tree->root, tree->destroy);
+    destroy_subtree(tree, tree->root);
     tree->root = NULL;
     tree->size = 0;
 }
@@ -575,32 +702,28 @@ void btree_clear(BinaryTree *tree) {
 /**
  * @brief Clona árvore recursivamente
  */
-static TreeNode* clone_recursive(const TreeNode *node, size_t element_size, CopyFn copy_fn) {
+static TreeNode* clone_recursive(BinaryTree *dst, const TreeNode *node, CopyFn copy_fn) {
     if (node == NULL) {
         return NULL;
     }
 
-    TreeNode *new_node = (TreeNode*)malloc(sizeof(TreeNode));
-    if (new_node == NULL) {
-        return NULL;
-    }
-
-    new_node->data = malloc(element_size);
-    if (new_node->data == NULL) {
-        free(new_node);
-        return NULL;
-    }
-
+    TreeNode *new_node;
     if (copy_fn != NULL) {
         void *copied = copy_fn(node->data);
-        memcpy(new_node->data, copied, element_size);
+        if (copied == NULL) {
+            return NULL;
+        }
+        new_node = create_tree_node(dst, copied);
         free(copied);
     } else {
-        memcpy(new_node->data, node->data, element_size);
+        new_node = create_tree_node(dst, node->data);
+    }
+    if (new_node == NULL) {
+        return NULL;
     }
 
-    new_node->left = clone_recursive(node->left, element_size, copy_fn);
-    new_node->right = clone_recursive(node->right, element_size, copy_fn);
+    new_node->left = clone_recursive(dst, node->left, copy_fn);
+    new_node->right = clone_recursive(dst, node->right, copy_fn);
     new_node->parent = NULL;
 
     if (new_node->left != NULL) {
@@ -618,12 +741,13 @@ BinaryTree* btree_clone(const BinaryTree *tree, CopyFn copy_fn) {
         return NULL;
     }
 
-    BinaryTree *new_tree = btree_create(tree->element_size, tree->compare, tree->destroy);
+    BinaryTree *new_tree = btree_create_with_allocator(tree->element_size, tree->compare,
+                                                       tree->destroy, &tree->allocator);
     if (new_tree == NULL) {
         return NULL;
     }
 
-    new_tree->root = clone_recursive(tree->root, tree->element_size, copy_fn);
+    new_tree->root = clone_recursive(new_tree, tree->root, copy_fn);
     new_tree->size = tree->size;
 
     return new_tree;
@@ -793,3 +917,244 @@ int btree_diameter(const BinaryTree *tree) {
     diameter_recursive(tree->root, &diameter);
     return diameter;
 }
+
+// ============================================================================
+// ÍNDICE DE LCA (ÁRVORE ESTÁTICA)
+// ============================================================================
+
+/** Posições por bloco do RMQ (bits de uma máscara) */
+#define LCA_BLOCK 64
+
+struct BTreeLCAIndex {
+    uint32_t *depth;            // por índice de pré-ordem
+    const TreeNode **nodes;     // pré-ordem -> nó
+    uint64_t *keys;             // keys[i] = depth(pai) << 32 | pre(pai); keys[0] sentinela
+    uint64_t *masks;            // pilha de mínimos do bloco até a posição i
+    uint64_t *sparse;           // levels * num_blocks mínimos de blocos
+    size_t num_blocks;
+    size_t levels;
+    size_t n;
+
+    // Tabela nó -> pré-ordem (endereçamento aberto, sondagem linear)
+    const TreeNode **slot_node;
+    uint32_t *slot_id;
+    unsigned slot_bits;
+
+    DSAllocator allocator;
+};
+
+static inline size_t lca_slot(const BTreeLCAIndex *index, const TreeNode *node) {
+    uint64_t h = (uint64_t)(uintptr_t)node * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(h >> (64 - index->slot_bits));
+}
+
+static void lca_map_put(BTreeLCAIndex *index, const TreeNode *node, uint32_t id) {
+    size_t mask = ((size_t)1 << index->slot_bits) - 1;
+    size_t s = lca_slot(index, node);
+    while (index->slot_node[s] != NULL) {
+        s = (s + 1) & mask;
+    }
+    index->slot_node[s] = node;
+    index->slot_id[s] = id;
+}
+
+static bool lca_map_get(const BTreeLCAIndex *index, const TreeNode *node, uint32_t *id) {
+    if (node == NULL) {
+        return false;
+    }
+    size_t mask = ((size_t)1 << index->slot_bits) - 1;
+    for (size_t s = lca_slot(index, node); index->slot_node[s] != NULL; s = (s + 1) & mask) {
+        if (index->slot_node[s] == node) {
+            *id = index->slot_id[s];
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint64_t lca_in_block(const BTreeLCAIndex *index, size_t l, size_t r) {
+    uint64_t m = index->masks[r] & (~0ULL << (l % LCA_BLOCK));
+    return index->keys[(r - r % LCA_BLOCK) + (size_t)__builtin_ctzll(m)];
+}
+
+static inline uint64_t min_u64(uint64_t a, uint64_t b) {
+    return a < b ? a : b;
+}
+
+/**
+ * Menor chave em keys[l..r] (inclusivo)
+ */
+static uint64_t lca_rmq(const BTreeLCAIndex *index, size_t l, size_t r) {
+    size_t bl = l / LCA_BLOCK;
+    size_t br = r / LCA_BLOCK;
+    if (bl == br) {
+        return lca_in_block(index, l, r);
+    }
+
+    uint64_t best = min_u64(lca_in_block(index, l, bl * LCA_BLOCK + LCA_BLOCK - 1),
+                            lca_in_block(index, br * LCA_BLOCK, r));
+    if (bl + 1 < br) {
+        size_t span = br - bl - 1;
+        size_t k = (size_t)(63 - __builtin_clzll((unsigned long long)span));
+        const uint64_t *level = index->sparse + k * index->num_blocks;
+        best = min_u64(best, min_u64(level[bl + 1], level[br - ((size_t)1 << k)]));
+    }
+    return best;
+}
+
+static void lca_index_free(BTreeLCAIndex *index) {
+    DSAllocator allocator = index->allocator;
+    size_t n = index->n;
+    size_t slots = index->slot_bits ? (size_t)1 << index->slot_bits : 0;
+    ds_free(&allocator, index->depth, n * sizeof(uint32_t));
+    ds_free(&allocator, index->nodes, n * sizeof(TreeNode*));
+    ds_free(&allocator, index->keys, n * sizeof(uint64_t));
+    ds_free(&allocator, index->masks, n * sizeof(uint64_t));
+    ds_free(&allocator, index->sparse, index->levels * index->num_blocks * sizeof(uint64_t));
+    ds_free(&allocator, index->slot_node, slots * sizeof(TreeNode*));
+    ds_free(&allocator, index->slot_id, slots * sizeof(uint32_t));
+    ds_free(&allocator, index, sizeof(BTreeLCAIndex));
+}
+
+BTreeLCAIndex* btree_lca_index_create(const BinaryTree *tree) {
+    if (tree == NULL || tree->root == NULL) {
+        return NULL;
+    }
+
+    // Conta os nós alcançáveis (não depende de tree->size)
+    size_t n = 0;
+    for (const TreeNode *v = tree->root; v != NULL; v = next_preorder(v)) {
+        n++;
+    }
+    if (n >= UINT32_MAX) {
+        return NULL;
+    }
+
+    const DSAllocator *allocator = &tree->allocator;
+    BTreeLCAIndex *index = (BTreeLCAIndex *)ds_calloc(allocator, 1, sizeof(BTreeLCAIndex));
+    if (index == NULL) {
+        return NULL;
+    }
+    index->allocator = tree->allocator;
+    index->n = n;
+    index->num_blocks = (n + LCA_BLOCK - 1) / LCA_BLOCK;
+    index->levels = 1;
+    while (((size_t)1 << index->levels) <= index->num_blocks) {
+        index->levels++;
+    }
+    index->slot_bits = 1;
+    while (((size_t)1 << index->slot_bits) < 2 * n) {
+        index->slot_bits++;
+    }
+    size_t slots = (size_t)1 << index->slot_bits;
+
+    index->depth = (uint32_t *)ds_alloc(allocator, n * sizeof(uint32_t));
+    index->nodes = (const TreeNode **)ds_alloc(allocator, n * sizeof(TreeNode*));
+    index->keys = (uint64_t *)ds_alloc(allocator, n * sizeof(uint64_t));
+    index->masks = (uint64_t *)ds_alloc(allocator, n * sizeof(uint64_t));
+    index->sparse = (uint64_t *)ds_alloc(allocator,
+                                         index->levels * index->num_blocks * sizeof(uint64_t));
+    index->slot_node = (const TreeNode **)ds_calloc(allocator, slots, sizeof(TreeNode*));
+    index->slot_id = (uint32_t *)ds_alloc(allocator, slots * sizeof(uint32_t));
+    if (index->depth == NULL || index->nodes == NULL || index->keys == NULL ||
+        index->masks == NULL || index->sparse == NULL || index->slot_node == NULL ||
+        index->slot_id == NULL) {
+        lca_index_free(index);
+        return NULL;
+    }
+
+    // Numeração em pré-ordem e chave (profundidade do pai, pai) de cada nó
+    size_t id = 0;
+    for (const TreeNode *v = tree->root; v != NULL; v = next_preorder(v)) {
+        index->nodes[id] = v;
+        lca_map_put(index, v, (uint32_t)id);
+        if (id == 0) {
+            index->depth[0] = 0;
+            index->keys[0] = UINT64_MAX;
+        } else {
+            uint32_t parent = 0;
+            lca_map_get(index, v->parent, &parent);
+            index->depth[id] = index->depth[parent] + 1;
+            index->keys[id] = ((uint64_t)index->depth[parent] << 32) | parent;
+        }
+        id++;
+    }
+
+    // Máscaras dos blocos: bit j ligado se keys[j] é o mínimo de [j, i]
+    for (size_t b = 0; b < index->num_blocks; b++) {
+        size_t start = b * LCA_BLOCK;
+        size_t end = start + LCA_BLOCK < n ? start + LCA_BLOCK : n;
+        uint64_t stack = 0;
+        uint64_t block_min = UINT64_MAX;
+        for (size_t i = start; i < end; i++) {
+            while (stack != 0 &&
+                   index->keys[start + (size_t)(63 - __builtin_clzll(stack))] > index->keys[i]) {
+                stack &= ~(1ULL << (63 - __builtin_clzll(stack)));
+            }
+            stack |= 1ULL << (i - start);
+            index->masks[i] = stack;
+            block_min = min_u64(block_min, index->keys[i]);
+        }
+        index->sparse[b] = block_min;
+    }
+
+    for (size_t k = 1; k < index->levels; k++) {
+        const uint64_t *prev = index->sparse + (k - 1) * index->num_blocks;
+        uint64_t *level = index->sparse + k * index->num_blocks;
+        size_t half = (size_t)1 << (k - 1);
+        for (size_t b = 0; b + 2 * half <= index->num_blocks; b++) {
+            level[b] = min_u64(prev[b], prev[b + half]);
+        }
+    }
+    return index;
+}
+
+void btree_lca_index_destroy(BTreeLCAIndex *index) {
+    if (index == NULL) {
+        return;
+    }
+    lca_index_free(index);
+}
+
+/**
+ * LCA por índice de pré-ordem: pai do nó de menor profundidade de pai
+ * em (min(a, b), max(a, b)]
+ */
+static uint32_t lca_query_ids(const BTreeLCAIndex *index, uint32_t a, uint32_t b) {
+    if (a == b) {
+        return a;
+    }
+    if (a > b) {
+        uint32_t t = a;
+        a = b;
+        b = t;
+    }
+    return (uint32_t)(lca_rmq(index, (size_t)a + 1, b) & 0xFFFFFFFFu);
+}
+
+TreeNode* btree_lca_index_query(const BTreeLCAIndex *index, const TreeNode *node1,
+                                const TreeNode *node2) {
+    uint32_t a, b;
+    if (index == NULL || !lca_map_get(index, node1, &a) || !lca_map_get(index, node2, &b)) {
+        return NULL;
+    }
+    return (TreeNode *)index->nodes[lca_query_ids(index, a, b)];
+}
+
+int btree_lca_index_distance(const BTreeLCAIndex *index, const TreeNode *node1,
+                             const TreeNode *node2) {
+    uint32_t a, b;
+    if (index == NULL || !lca_map_get(index, node1, &a) || !lca_map_get(index, node2, &b)) {
+        return -1;
+    }
+    uint32_t lca = lca_query_ids(index, a, b);
+    return (int)(index->depth[a] + index->depth[b] - 2 * index->depth[lca]);
+}
+
+int btree_lca_index_depth(const BTreeLCAIndex *index, const TreeNode *node) {
+    uint32_t id;
+    if (index == NULL || !lca_map_get(index, node, &id)) {
+        return -1;
+    }
+    return (int)index->depth[id];
+}
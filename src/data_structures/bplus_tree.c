@@ -0,0 +1,801 @@
+/**
+ * @file bplus_tree.c
+ * @brief Implementação de Árvore B+ com folhas encadeadas
+ *
+ * Cada nó é um único bloco: cabeçalho, depois (nos internos) o array de
+ * filhos e o array contíguo de elementos/separadores. Todo nó tem uma
+ * posição de folga além da capacidade: a inserção grava primeiro e divide
+ * depois, e os nós novos que a divisão vai precisar são alocados antes de
+ * qualquer alteração, então falta de memória nunca deixa a árvore pela
+ * metade.
+ *
+ * Invariante dos separadores: em um nó interno, k[i-1] é uma cópia byte a
+ * byte do menor elemento do filho i. Com isso os separadores nunca guardam
+ * um elemento já destruído (a remoção do menor de uma subárvore atualiza a
+ * cópia no caminho de volta) e elementos iguais podem ficar em folhas
+ * vizinhas: a busca desce pelo lower bound e, se a folha terminar antes,
+ * continua na seguinte.
+ *
+ * Referências:
+ * - Bayer, R. & McCreight, E. (1972). "Organization and Maintenance of
+ *   Large Ordered Indexes". Acta Informatica 1(3), 173-189.
+ * - Comer, D. (1979). "The Ubiquitous B-Tree". ACM Computing Surveys 11(2)
+ * - Khuong, P.-V. & Morin, P. (2017). "Array Layouts for Comparison-Based
+ *   Searching". ACM JEA 22 - busca binária sem desvios dentro do nó
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/bplus_tree.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// ESTRUTURAS INTERNAS
+// ============================================================================
+
+/** Altura máxima suportada (cada nível ao menos triplica o número de folhas) */
+#define BPTREE_MAX_HEIGHT 64
+
+typedef struct BPTreeNode BPTreeNode;
+
+/**
+ * @brief Cabeçalho de um nó
+ *
+ * Folha: count elementos a partir de NODE_DATA_OFFSET e next aponta para a
+ * próxima folha. Interno: count separadores em inner_keys_offset e
+ * count + 1 filhos a partir de NODE_DATA_OFFSET.
+ */
+struct BPTreeNode {
+    BPTreeNode *next;
+    uint32_t count;
+    uint32_t leaf;
+};
+
+/** Início dos dados do nó, alinhado como os blocos de ds_alloc */
+#define NODE_DATA_OFFSET \
+    ((sizeof(BPTreeNode) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t))
+
+struct BPlusTree {
+    BPTreeNode *root;
+    size_t element_size;
+    size_t size;
+    CompareFn compare;
+    DestroyFn destroy;
+    DSAllocator allocator;
+    size_t leaf_cap;            /**< Elementos por folha (sem a folga) */
+    size_t inner_cap;           /**< Separadores por nó interno (sem a folga) */
+    size_t leaf_bytes;
+    size_t inner_bytes;
+    size_t inner_keys_offset;
+    int height;
+};
+
+// ============================================================================
+// FUNÇÕES AUXILIARES PRIVADAS
+// ============================================================================
+
+static inline unsigned char* node_keys(const BPlusTree *tree, const BPTreeNode *node) {
+    return (unsigned char*)node + (node->leaf ? NODE_DATA_OFFSET : tree->inner_keys_offset);
+}
+
+static inline unsigned char* key_at(const BPlusTree *tree, const BPTreeNode *node, size_t i) {
+    return node_keys(tree, node) + i * tree->element_size;
+}
+
+static inline BPTreeNode** node_children(const BPTreeNode *node) {
+    return (BPTreeNode**)((unsigned char*)node + NODE_DATA_OFFSET);
+}
+
+static BPTreeNode* node_create(BPlusTree *tree, bool leaf) {
+    BPTreeNode *node = (BPTreeNode*)ds_alloc(&tree->allocator,
+                                             leaf ? tree->leaf_bytes : tree->inner_bytes);
+    if (node == NULL) return NULL;
+    node->next = NULL;
+    node->count = 0;
+    node->leaf = leaf;
+    return node;
+}
+
+static void node_free(BPlusTree *tree, BPTreeNode *node) {
+    ds_free(&tree->allocator, node, node->leaf ? tree->leaf_bytes : tree->inner_bytes);
+}
+
+static size_t memory_recursive(const BPlusTree *tree, const BPTreeNode *node) {
+    if (node->leaf) return tree->leaf_bytes;
+    size_t bytes = tree->inner_bytes;
+    BPTreeNode **children = node_children(node);
+    for (size_t i = 0; i <= node->count; i++) {
+        bytes += memory_recursive(tree, children[i]);
+    }
+    return bytes;
+}
+
+static void destroy_recursive(BPlusTree *tree, BPTreeNode *node, bool destroy_elements) {
+    if (node == NULL) return;
+    if (node->leaf) {
+        if (destroy_elements && tree->destroy != NULL) {
+            for (size_t i = 0; i < node->count; i++) tree->destroy(key_at(tree, node, i));
+        }
+    } else {
+        BPTreeNode **children = node_children(node);
+        for (size_t i = 0; i <= node->count; i++) {
+            destroy_recursive(tree, children[i], destroy_elements);
+        }
+    }
+    node_free(tree, node);
+}
+
+/**
+ * Lower bound sem desvios no nó: número de chaves < key (ou <= key com
+ * upper). A escolha de metade vira cmov e o laço faz sempre ceil(log2 n)
+ * comparações, sem erros de predição.
+ */
+static size_t node_search(const BPlusTree *tree, const BPTreeNode *node,
+                          const void *key, bool upper) {
+    size_t n = node->count;
+    if (n == 0) return 0;
+    const size_t es = tree->element_size;
+    const unsigned char *first = node_keys(tree, node);
+    const unsigned char *base = first;
+    int bound = upper ? 1 : 0;
+    while (n > 1) {
+        size_t half = n / 2;
+        base = (tree->compare(base + half * es, key) < bound) ? base + half * es : base;
+        n -= half;
+    }
+    return (size_t)(base - first) / es + (tree->compare(base, key) < bound);
+}
+
+static const BPTreeNode* leftmost_leaf(const BPTreeNode *node) {
+    while (!node->leaf) node = node_children(node)[0];
+    return node;
+}
+
+static const BPTreeNode* rightmost_leaf(const BPTreeNode *node) {
+    while (!node->leaf) node = node_children(node)[node->count];
+    return node;
+}
+
+/**
+ * Folha e posição do primeiro elemento >= key. Retorna false se todos os
+ * elementos forem menores.
+ */
+static bool find_lower_bound(const BPlusTree *tree, const void *key,
+                             const BPTreeNode **leaf_out, size_t *pos_out) {
+    const BPTreeNode *node = tree->root;
+    if (node == NULL) return false;
+    while (!node->leaf) {
+        node = node_children(node)[node_search(tree, node, key, false)];
+    }
+    size_t pos = node_search(tree, node, key, false);
+    if (pos == node->count) {
+        // Igual ao separador da direita: o lower bound abre a próxima folha
+        node = node->next;
+        pos = 0;
+        if (node == NULL) return false;
+    }
+    *leaf_out = node;
+    *pos_out = pos;
+    return true;
+}
+
+// Insere key em node na posição i, com o filho child à direita (nó interno)
+static void inner_insert_at(BPlusTree *tree, BPTreeNode *node, size_t i,
+                            const void *key, BPTreeNode *child) {
+    const size_t es = tree->element_size;
+    unsigned char *keys = node_keys(tree, node);
+    BPTreeNode **children = node_children(node);
+    memmove(keys + (i + 1) * es, keys + i * es, (node->count - i) * es);
+    memcpy(keys + i * es, key, es);
+    memmove(children + i + 2, children + i + 1, (node->count - i) * sizeof(BPTreeNode*));
+    children[i + 1] = child;
+    node->count++;
+}
+
+// Remove o separador i e o filho i + 1 de node (nó interno)
+static void inner_remove_at(BPlusTree *tree, BPTreeNode *node, size_t i) {
+    const size_t es = tree->element_size;
+    unsigned char *keys = node_keys(tree, node);
+    BPTreeNode **children = node_children(node);
+    memmove(keys + i * es, keys + (i + 1) * es, (node->count - i - 1) * es);
+    memmove(children + i + 1, children + i + 2, (node->count - i - 1) * sizeof(BPTreeNode*));
+    node->count--;
+}
+
+/**
+ * Funde o filho j + 1 de parent no filho j (os dois cabem em um nó porque
+ * um está abaixo do mínimo e o outro no mínimo).
+ */
+static void merge_children(BPlusTree *tree, BPTreeNode *parent, size_t j) {
+    const size_t es = tree->element_size;
+    BPTreeNode **children = node_children(parent);
+    BPTreeNode *left = children[j];
+    BPTreeNode *right = children[j + 1];
+    if (left->leaf) {
+        memcpy(key_at(tree, left, left->count), node_keys(tree, right), right->count * es);
+        left->next = right->next;
+    } else {
+        memcpy(key_at(tree, left, left->count), key_at(tree, parent, j), es);
+        memcpy(key_at(tree, left, left->count + 1), node_keys(tree, right), right->count * es);
+        memcpy(node_children(left) + left->count + 1, node_children(right),
+               (right->count + 1) * sizeof(BPTreeNode*));
+        left->count++;
+    }
+    left->count += right->count;
+    node_free(tree, right);
+    inner_remove_at(tree, parent, j);
+}
+
+// Corrige o filho i de parent se ficou abaixo da ocupação mínima
+static void rebalance_child(BPlusTree *tree, BPTreeNode *parent, size_t i) {
+    const size_t es = tree->element_size;
+    BPTreeNode **children = node_children(parent);
+    BPTreeNode *child = children[i];
+    size_t min = (child->leaf ? tree->leaf_cap : tree->inner_cap) / 2;
+    if (child->count >= min) return;
+
+    BPTreeNode *left = (i > 0) ? children[i - 1] : NULL;
+    BPTreeNode *right = (i < parent->count) ? children[i + 1] : NULL;
+    unsigned char *keys = node_keys(tree, child);
+
+    if (left != NULL && left->count > min) {
+        // Empresta o maior do irmão esquerdo
+        memmove(keys + es, keys, child->count * es);
+        if (child->leaf) {
+            memcpy(keys, key_at(tree, left, left->count - 1), es);
+            memcpy(key_at(tree, parent, i - 1), keys, es);
+        } else {
+            BPTreeNode **cc = node_children(child);
+            memmove(cc + 1, cc, (child->count + 1) * sizeof(BPTreeNode*));
+            cc[0] = node_children(left)[left->count];
+            memcpy(keys, key_at(tree, parent, i - 1), es);
+            memcpy(key_at(tree, parent, i - 1), key_at(tree, left, left->count - 1), es);
+        }
+        left->count--;
+        child->count++;
+    } else if (right != NULL && right->count > min) {
+        // Empresta o menor do irmão direito
+        unsigned char *rkeys = node_keys(tree, right);
+        if (child->leaf) {
+            memcpy(keys + child->count * es, rkeys, es);
+            memmove(rkeys, rkeys + es, (right->count - 1) * es);
+            memcpy(key_at(tree, parent, i), rkeys, es);
+        } else {
+            BPTreeNode **rc = node_children(right);
+            memcpy(keys + child->count * es, key_at(tree, parent, i), es);
+            node_children(child)[child->count + 1] = rc[0];
+            memcpy(key_at(tree, parent, i), rkeys, es);
+            memmove(rkeys, rkeys + es, (right->count - 1) * es);
+            memmove(rc, rc + 1, right->count * sizeof(BPTreeNode*));
+        }
+        right->count--;
+        child->count++;
+    } else if (left != NULL) {
+        merge_children(tree, parent, i - 1);
+    } else {
+        merge_children(tree, parent, i);
+    }
+}
+
+static bool remove_recursive(BPlusTree *tree, BPTreeNode *node, const void *key) {
+    const size_t es = tree->element_size;
+    if (node->leaf) {
+        size_t pos = node_search(tree, node, key, false);
+        if (pos == node->count || tree->compare(key_at(tree, node, pos), key) != 0) return false;
+        if (tree->destroy != NULL) tree->destroy(key_at(tree, node, pos));
+        memmove(key_at(tree, node, pos), key_at(tree, node, pos + 1), (node->count - pos - 1) * es);
+        node->count--;
+        return true;
+    }
+
+    BPTreeNode **children = node_children(node);
+    size_t i = node_search(tree, node, key, false);
+    while (!remove_recursive(tree, children[i], key)) {
+        // Cópias iguais podem continuar no filho seguinte
+        if (i == node->count || tree->compare(key_at(tree, node, i), key) != 0) return false;
+        i++;
+    }
+    if (i > 0) {
+        // O menor do filho i pode ter sido o removido
+        memcpy(key_at(tree, node, i - 1), node_keys(tree, leftmost_leaf(children[i])), es);
+    }
+    rebalance_child(tree, node, i);
+    return true;
+}
+
+/**
+ * Monta a árvore sobre elementos já ordenados (tree vazia). Cada nível
+ * distribui os nós de baixo igualmente entre ceil(m / capacidade) pais, o
+ * que deixa todos acima da ocupação mínima.
+ */
+static bool build_from_sorted(BPlusTree *tree, const unsigned char *array, size_t size) {
+    if (size == 0) return true;
+    const size_t es = tree->element_size;
+
+    size_t count = (size + tree->leaf_cap - 1) / tree->leaf_cap;
+    BPTreeNode **level = (BPTreeNode**)malloc(count * sizeof(BPTreeNode*));
+    if (level == NULL) return false;
+
+    size_t offset = 0;
+    for (size_t j = 0; j < count; j++) {
+        BPTreeNode *leaf = node_create(tree, true);
+        if (leaf == NULL) {
+            for (size_t k = 0; k < j; k++) node_free(tree, level[k]);
+            free(level);
+            return false;
+        }
+        leaf->count = (uint32_t)(size / count + (j < size % count));
+        memcpy(node_keys(tree, leaf), array + offset * es, leaf->count * es);
+        offset += leaf->count;
+        if (j > 0) level[j - 1]->next = leaf;
+        level[j] = leaf;
+    }
+
+    int height = 0;
+    const size_t fanout = tree->inner_cap + 1;
+    while (count > 1) {
+        size_t parents = (count + fanout - 1) / fanout;
+        BPTreeNode **next = (BPTreeNode**)malloc(parents * sizeof(BPTreeNode*));
+        size_t built = 0;
+        if (next != NULL) {
+            size_t first = 0;
+            for (; built < parents; built++) {
+                BPTreeNode *node = node_create(tree, false);
+                if (node == NULL) break;
+                size_t m = count / parents + (built < count % parents);
+                memcpy(node_children(node), level + first, m * sizeof(BPTreeNode*));
+                for (size_t c = 1; c < m; c++) {
+                    memcpy(key_at(tree, node, c - 1),
+                           node_keys(tree, leftmost_leaf(level[first + c])), es);
+                }
+                node->count = (uint32_t)(m - 1);
+                next[built] = node;
+                first += m;
+            }
+        }
+        if (next == NULL || built < parents) {
+            for (size_t k = 0; k < built; k++) node_free(tree, next[k]);
+            for (size_t k = 0; k < count; k++) destroy_recursive(tree, level[k], false);
+            free(next);
+            free(level);
+            return false;
+        }
+        free(level);
+        level = next;
+        count = parents;
+        height++;
+    }
+
+    tree->root = level[0];
+    tree->height = height;
+    tree->size = size;
+    free(level);
+    return true;
+}
+
+static bool is_valid_recursive(const BPlusTree *tree, const BPTreeNode *node, int depth,
+                               bool is_root, const BPTreeNode **prev_leaf, size_t *count) {
+    const size_t es = tree->element_size;
+    if (node->leaf) {
+        if (depth != tree->height || node->count == 0 || node->count > tree->leaf_cap) return false;
+        if (!is_root && node->count < tree->leaf_cap / 2) return false;
+        for (size_t i = 1; i < node->count; i++) {
+            if (tree->compare(key_at(tree, node, i - 1), key_at(tree, node, i)) > 0) return false;
+        }
+        // A DFS visita as folhas na ordem da lista encadeada
+        if (*prev_leaf != NULL) {
+            if ((*prev_leaf)->next != node) return false;
+            const BPTreeNode *prev = *prev_leaf;
+            if (tree->compare(key_at(tree, prev, prev->count - 1), key_at(tree, node, 0)) > 0) {
+                return false;
+            }
+        }
+        *prev_leaf = node;
+        *count += node->count;
+        return true;
+    }
+
+    if (node->count == 0 || node->count > tree->inner_cap) return false;
+    if (!is_root && node->count < tree->inner_cap / 2) return false;
+    BPTreeNode **children = node_children(node);
+    for (size_t i = 0; i <= node->count; i++) {
+        if (!is_valid_recursive(tree, children[i], depth + 1, false, prev_leaf, count)) return false;
+        if (i > 0 && memcmp(key_at(tree, node, i - 1),
+                            node_keys(tree, leftmost_leaf(children[i])), es) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void print_recursive(const BPlusTree *tree, const BPTreeNode *node, PrintFn print, int depth) {
+    for (int i = 0; i < depth; i++) printf("    ");
+    printf(node->leaf ? "leaf [" : "[");
+    for (size_t i = 0; i < node->count; i++) {
+        if (i > 0) printf(" ");
+        print(key_at(tree, node, i));
+    }
+    printf("]\n");
+    if (node->leaf) return;
+    for (size_t i = 0; i <= node->count; i++) {
+        print_recursive(tree, node_children(node)[i], print, depth + 1);
+    }
+}
+
+// ============================================================================
+// FUNÇÕES PÚBLICAS
+// ============================================================================
+
+BPlusTree* bptree_create(size_t element_size, CompareFn compare, DestroyFn destroy) {
+    return bptree_create_with_allocator(element_size, compare, destroy, NULL);
+}
+
+BPlusTree* bptree_create_with_allocator(size_t element_size, CompareFn compare,
+                                        DestroyFn destroy, const DSAllocator *allocator) {
+    if (element_size == 0 || compare == NULL) return NULL;
+    if (element_size > (SIZE_MAX - BPTREE_NODE_BYTES) / (2 * BPTREE_MIN_FANOUT + 4)) return NULL;
+    if (allocator == NULL) allocator = ds_default_allocator();
+
+    BPlusTree *tree = (BPlusTree*)ds_alloc(allocator, sizeof(BPlusTree));
+    if (tree == NULL) return NULL;
+
+    tree->allocator = *allocator;
+    tree->root = NULL;
+    tree->element_size = element_size;
+    tree->size = 0;
+    tree->compare = compare;
+    tree->destroy = destroy;
+    tree->height = -1;
+
+    // Folha: cabeçalho + (cap + 1) elementos
+    size_t space = BPTREE_NODE_BYTES - NODE_DATA_OFFSET;
+    size_t slots = space / element_size;
+    tree->leaf_cap = (slots > BPTREE_MIN_FANOUT + 1) ? slots - 1 : BPTREE_MIN_FANOUT;
+    tree->leaf_bytes = NODE_DATA_OFFSET + (tree->leaf_cap + 1) * element_size;
+
+    // Interno: cabeçalho + (cap + 2) filhos + (cap + 1) separadores
+    size_t align = _Alignof(max_align_t);
+    slots = (space - 2 * sizeof(BPTreeNode*) - align) / (element_size + sizeof(BPTreeNode*));
+    tree->inner_cap = (slots > BPTREE_MIN_FANOUT + 1) ? slots - 1 : BPTREE_MIN_FANOUT;
+    size_t children_end = NODE_DATA_OFFSET + (tree->inner_cap + 2) * sizeof(BPTreeNode*);
+    tree->inner_keys_offset = (children_end + align - 1) / align * align;
+    tree->inner_bytes = tree->inner_keys_offset + (tree->inner_cap + 1) * element_size;
+
+    return tree;
+}
+
+BPlusTree* bptree_from_sorted_array(size_t element_size, const void *array, size_t size,
+                                    CompareFn compare, DestroyFn destroy) {
+    if (array == NULL && size > 0) return NULL;
+    const unsigned char *bytes = (const unsigned char*)array;
+    for (size_t i = 1; i < size && compare != NULL; i++) {
+        if (compare(bytes + (i - 1) * element_size, bytes + i * element_size) > 0) return NULL;
+    }
+
+    BPlusTree *tree = bptree_create(element_size, compare, destroy);
+    if (tree == NULL) return NULL;
+    if (!build_from_sorted(tree, bytes, size)) {
+        bptree_destroy(tree);
+        return NULL;
+    }
+    return tree;
+}
+
+void bptree_destroy(BPlusTree *tree) {
+    if (tree == NULL) return;
+
+    destroy_recursive(tree, tree->root, true);
+    DSAllocator allocator = tree->allocator;
+    ds_free(&allocator, tree, sizeof(BPlusTree));
+}
+
+DataStructureError bptree_insert(BPlusTree *tree, const void *data) {
+    if (tree == NULL || data == NULL) return DS_ERROR_NULL_POINTER;
+    const size_t es = tree->element_size;
+
+    if (tree->root == NULL) {
+        BPTreeNode *leaf = node_create(tree, true);
+        if (leaf == NULL) return DS_ERROR_OUT_OF_MEMORY;
+        memcpy(node_keys(tree, leaf), data, es);
+        leaf->count = 1;
+        tree->root = leaf;
+        tree->height = 0;
+        tree->size = 1;
+        return DS_SUCCESS;
+    }
+
+    // Desce pelo upper bound: iguais entram depois dos existentes
+    BPTreeNode *path[BPTREE_MAX_HEIGHT];
+    size_t index[BPTREE_MAX_HEIGHT];
+    int depth = 0;
+    BPTreeNode *node = tree->root;
+    while (!node->leaf) {
+        size_t i = node_search(tree, node, data, true);
+        path[depth] = node;
+        index[depth] = i;
+        depth++;
+        node = node_children(node)[i];
+    }
+
+    // Reserva os nós das divisões (e da nova raiz) antes de alterar algo
+    BPTreeNode *spare[BPTREE_MAX_HEIGHT + 1];
+    int needed = 0;
+    if (node->count == tree->leaf_cap) {
+        needed = 1;
+        int d = depth - 1;
+        while (d >= 0 && path[d]->count == tree->inner_cap) {
+            needed++;
+            d--;
+        }
+        if (d < 0) needed++;
+    }
+    if (needed > 0 && tree->height + 1 >= BPTREE_MAX_HEIGHT) return DS_ERROR_FULL;
+    for (int s = 0; s < needed; s++) {
+        spare[s] = node_create(tree, s == 0);
+        if (spare[s] == NULL) {
+            for (int k = 0; k < s; k++) node_free(tree, spare[k]);
+            return DS_ERROR_OUT_OF_MEMORY;
+        }
+    }
+
+    size_t pos = node_search(tree, node, data, true);
+    memmove(key_at(tree, node, pos + 1), key_at(tree, node, pos), (node->count - pos) * es);
+    memcpy(key_at(tree, node, pos), data, es);
+    node->count++;
+    tree->size++;
+    if (needed == 0) return DS_SUCCESS;
+
+    // Divide a folha: o separador é o menor da metade direita
+    BPTreeNode *right = spare[0];
+    size_t mid = node->count / 2;
+    right->count = node->count - (uint32_t)mid;
+    memcpy(node_keys(tree, right), key_at(tree, node, mid), right->count * es);
+    node->count = (uint32_t)mid;
+    right->next = node->next;
+    node->next = right;
+    const unsigned char *separator = node_keys(tree, right);
+
+    int s = 1;
+    for (int d = depth - 1; d >= 0; d--) {
+        BPTreeNode *parent = path[d];
+        inner_insert_at(tree, parent, index[d], separator, right);
+        if (parent->count <= tree->inner_cap) return DS_SUCCESS;
+
+        // Divide o interno: o separador do meio sobe
+        right = spare[s++];
+        mid = parent->count / 2;
+        right->count = parent->count - (uint32_t)mid - 1;
+        memcpy(node_keys(tree, right), key_at(tree, parent, mid + 1), right->count * es);
+        memcpy(node_children(right), node_children(parent) + mid + 1,
+               (right->count + 1) * sizeof(BPTreeNode*));
+        parent->count = (uint32_t)mid;
+        separator = key_at(tree, parent, mid);
+    }
+
+    BPTreeNode *root = spare[s];
+    node_children(root)[0] = tree->root;
+    node_children(root)[1] = right;
+    memcpy(node_keys(tree, root), separator, es);
+    root->count = 1;
+    tree->root = root;
+    tree->height++;
+    return DS_SUCCESS;
+}
+
+DataStructureError bptree_search(const BPlusTree *tree, const void *data, void *output) {
+    if (tree == NULL || data == NULL || output == NULL) return DS_ERROR_NULL_POINTER;
+
+    const BPTreeNode *leaf;
+    size_t pos;
+    if (!find_lower_bound(tree, data, &leaf, &pos)) return DS_ERROR_NOT_FOUND;
+    if (tree->compare(key_at(tree, leaf, pos), data) != 0) return DS_ERROR_NOT_FOUND;
+    memcpy(output, key_at(tree, leaf, pos), tree->element_size);
+    return DS_SUCCESS;
+}
+
+bool bptree_contains(const BPlusTree *tree, const void *data) {
+    if (tree == NULL || data == NULL) return false;
+
+    const BPTreeNode *leaf;
+    size_t pos;
+    if (!find_lower_bound(tree, data, &leaf, &pos)) return false;
+    return tree->compare(key_at(tree, leaf, pos), data) == 0;
+}
+
+DataStructureError bptree_remove(BPlusTree *tree, const void *data) {
+    if (tree == NULL || data == NULL) return DS_ERROR_NULL_POINTER;
+    if (tree->root == NULL) return DS_ERROR_NOT_FOUND;
+
+    if (!remove_recursive(tree, tree->root, data)) return DS_ERROR_NOT_FOUND;
+    tree->size--;
+
+    BPTreeNode *root = tree->root;
+    if (root->leaf && root->count == 0) {
+        node_free(tree, root);
+        tree->root = NULL;
+        tree->height = -1;
+    } else if (!root->leaf && root->count == 0) {
+        tree->root = node_children(root)[0];
+        node_free(tree, root);
+        tree->height--;
+    }
+    return DS_SUCCESS;
+}
+
+DataStructureError bptree_min(const BPlusTree *tree, void *output) {
+    if (tree == NULL || output == NULL) return DS_ERROR_NULL_POINTER;
+    if (tree->root == NULL) return DS_ERROR_EMPTY;
+
+    const BPTreeNode *leaf = leftmost_leaf(tree->root);
+    memcpy(output, key_at(tree, leaf, 0), tree->element_size);
+    return DS_SUCCESS;
+}
+
+DataStructureError bptree_max(const BPlusTree *tree, void *output) {
+    if (tree == NULL || output == NULL) return DS_ERROR_NULL_POINTER;
+    if (tree->root == NULL) return DS_ERROR_EMPTY;
+
+    const BPTreeNode *leaf = rightmost_leaf(tree->root);
+    memcpy(output, key_at(tree, leaf, leaf->count - 1), tree->element_size);
+    return DS_SUCCESS;
+}
+
+DataStructureError bptree_range_search(const BPlusTree *tree, const void *min,
+                                       const void *max, void **results, size_t *count) {
+    if (tree == NULL || min == NULL || max == NULL || results == NULL || count == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    *results = NULL;
+    *count = 0;
+
+    const BPTreeNode *first;
+    size_t first_pos;
+    if (tree->compare(min, max) > 0 || !find_lower_bound(tree, min, &first, &first_pos)) {
+        return DS_SUCCESS;
+    }
+
+    // Primeira passada conta, a segunda copia as fatias de cada folha
+    size_t total = 0;
+    const BPTreeNode *leaf = first;
+    size_t pos = first_pos;
+    const BPTreeNode *last = NULL;
+    size_t last_end = 0;
+    while (leaf != NULL) {
+        size_t end = leaf->count;
+        if (tree->compare(key_at(tree, leaf, end - 1), max) > 0) {
+            end = node_search(tree, leaf, max, true);
+        }
+        total += end - pos;
+        if (end < leaf->count) {
+            last = leaf;
+            last_end = end;
+            break;
+        }
+        leaf = leaf->next;
+        pos = 0;
+    }
+    if (total == 0) return DS_SUCCESS;
+
+    unsigned char *array = (unsigned char*)malloc(total * tree->element_size);
+    if (array == NULL) return DS_ERROR_OUT_OF_MEMORY;
+
+    size_t collected = 0;
+    for (leaf = first, pos = first_pos; leaf != NULL; leaf = leaf->next, pos = 0) {
+        size_t end = (leaf == last) ? last_end : leaf->count;
+        memcpy(array + collected * tree->element_size, key_at(tree, leaf, pos),
+               (end - pos) * tree->element_size);
+        collected += end - pos;
+        if (leaf == last) break;
+    }
+
+    *results = array;
+    *count = collected;
+    return DS_SUCCESS;
+}
+
+void bptree_inorder(const BPlusTree *tree, BPTreeTraversalFn callback, void *user_data) {
+    if (tree == NULL || callback == NULL || tree->root == NULL) return;
+
+    for (const BPTreeNode *leaf = leftmost_leaf(tree->root); leaf != NULL; leaf = leaf->next) {
+        for (size_t i = 0; i < leaf->count; i++) callback(key_at(tree, leaf, i), user_data);
+    }
+}
+
+bool bptree_is_empty(const BPlusTree *tree) {
+    return tree == NULL || tree->root == NULL;
+}
+
+size_t bptree_size(const BPlusTree *tree) {
+    return tree == NULL ? 0 : tree->size;
+}
+
+int bptree_height(const BPlusTree *tree) {
+    return tree == NULL ? -1 : tree->height;
+}
+
+size_t bptree_leaf_capacity(const BPlusTree *tree) {
+    return tree == NULL ? 0 : tree->leaf_cap;
+}
+
+size_t bptree_memory_usage(const BPlusTree *tree) {
+    if (tree == NULL) return 0;
+    size_t bytes = sizeof(BPlusTree);
+    if (tree->root != NULL) bytes += memory_recursive(tree, tree->root);
+    return bytes;
+}
+
+bool bptree_is_valid(const BPlusTree *tree) {
+    if (tree == NULL) return false;
+    if (tree->root == NULL) return tree->size == 0 && tree->height == -1;
+
+    const BPTreeNode *prev_leaf = NULL;
+    size_t count = 0;
+    if (!is_valid_recursive(tree, tree->root, 0, true, &prev_leaf, &count)) return false;
+    return prev_leaf->next == NULL && count == tree->size;
+}
+
+void bptree_clear(BPlusTree *tree) {
+    if (tree == NULL) return;
+
+    destroy_recursive(tree, tree->root, true);
+    tree->root = NULL;
+    tree->size = 0;
+    tree->height = -1;
+}
+
+BPlusTree* bptree_clone(const BPlusTree *tree, CopyFn copy_fn) {
+    if (tree == NULL) return NULL;
+
+    BPlusTree *new_tree = bptree_create_with_allocator(tree->element_size, tree->compare,
+                                                       tree->destroy, &tree->allocator);
+    if (new_tree == NULL || tree->size == 0) return new_tree;
+
+    // Copia em ordem e reconstrói por bulk loading (nós cheios e compactos)
+    const size_t es = tree->element_size;
+    unsigned char *array = (unsigned char*)malloc(tree->size * es);
+    if (array == NULL) {
+        bptree_destroy(new_tree);
+        return NULL;
+    }
+    size_t n = 0;
+    bool ok = true;
+    for (const BPTreeNode *leaf = leftmost_leaf(tree->root); leaf != NULL && ok; leaf = leaf->next) {
+        for (size_t i = 0; i < leaf->count; i++) {
+            if (copy_fn == NULL) {
+                memcpy(array + n * es, key_at(tree, leaf, i), es);
+            } else {
+                void *copied = copy_fn(key_at(tree, leaf, i));
+                if (copied == NULL) {
+                    ok = false;
+                    break;
+                }
+                memcpy(array + n * es, copied, es);
+                free(copied);
+            }
+            n++;
+        }
+    }
+
+    if (!ok || !build_from_sorted(new_tree, array, n)) {
+        if (copy_fn != NULL && tree->destroy != NULL) {
+            for (size_t i = 0; i < n; i++) tree->destroy(array + i * es);
+        }
+        free(array);
+        bptree_destroy(new_tree);
+        return NULL;
+    }
+    free(array);
+    return new_tree;
+}
+
+void bptree_print(const BPlusTree *tree, PrintFn print) {
+    if (tree == NULL || print == NULL) return;
+
+    printf("B+ Tree (size=%zu, height=%d, leaf capacity=%zu):\n",
+           tree->size, tree->height, tree->leaf_cap);
+    if (tree->root != NULL) print_recursive(tree, tree->root, print, 0);
+}
@@ -41,46 +41,39 @@ struct BST {
     size_t size;
     CompareFn compare;
     DestroyFn destroy;
+    DSAllocator allocator;
 };
 
 // ============================================================================
 // FUNÇÕES AUXILIARES PRIVADAS
 // ============================================================================
 
-static BSTNode* create_node(const void *data, size_t element_size) {
-    BSTNode *node = (BSTNode*)malloc(sizeof(BSTNode));
+static BSTNode* create_node(BST *bst, const void *data) {
+    BSTNode *node = (BSTNode*)ds_alloc(&bst->allocator, sizeof(BSTNode));
     if (node == NULL) return NULL;
     
-    node->data = malloc(element_size);
+    node->data = ds_alloc(&bst->allocator, bst->element_size);
     if (node->data == NULL) {
-        free(node);
+        ds_free(&bst->allocator, node, sizeof(BSTNode));
         return NULL;
     }
     
-    memcpy(node->data, data, element_size);
+    memcpy(node->data, data, bst->element_size);
     node->left = NULL;
     node->right = NULL;
     node->parent = NULL;
     return node;
 }
 
-static void destroy_node(BSTNode *node, DestroyFn destroy) {
+static void destroy_node(BST *bst, BSTNode *node) {
     if (node == NULL) return;
     
-    if (destroy != NULL && node->data != NULL) {
-        destroy(node->data);
+    if (bst->destroy != NULL && node->data != NULL) {
+        bst->destroy(node->data);
     }
     
-    free(node->data);
-    free(node);
-}
-
-static void destroy_tree_recursive(BSTNode *node, DestroyFn destroy) {
-    if (node == NULL) return;
-    
-    destroy_tree_recursive(node->left, destroy);
-    destroy_tree_recursive(node->right, destroy);
-    destroy_node(node, destroy);
+    ds_free(&bst->allocator, node->data, bst->element_size);
+    ds_free(&bst->allocator, node, sizeof(BSTNode));
 }
 
 static BSTNode* tree_minimum(BSTNode *node) {
@@ -129,6 +122,52 @@ static BSTNode* tree_predecessor(BSTNode *node) {
     return parent;
 }
 
+// Primeiro nó em pós-ordem da subárvore: desce preferindo a esquerda
+static BSTNode* first_postorder(BSTNode *node) {
+    for (;;) {
+        if (node->left != NULL) {
+            node = node->left;
+        } else if (node->right != NULL) {
+            node = node->right;
+        } else {
+            return node;
+        }
+    }
+}
+
+static BSTNode* next_preorder(BSTNode *node) {
+    if (node->left != NULL) return node->left;
+    if (node->right != NULL) return node->right;
+    while (node->parent != NULL) {
+        BSTNode *parent = node->parent;
+        if (parent->right != NULL && parent->right != node) {
+            return parent->right;
+        }
+        node = parent;
+    }
+    return NULL;
+}
+
+static BSTNode* next_postorder(BSTNode *node) {
+    BSTNode *parent = node->parent;
+    if (parent != NULL && node == parent->left && parent->right != NULL) {
+        return first_postorder(parent->right);
+    }
+    return parent;
+}
+
+// Pós-ordem iterativa: o sucessor é lido antes de liberar o nó
+static void destroy_tree(BST *bst, BSTNode *root) {
+    if (root == NULL) return;
+
+    BSTNode *node = first_postorder(root);
+    while (node != NULL) {
+        BSTNode *next = (node == root) ? NULL : next_postorder(node);
+        destroy_node(bst, node);
+        node = next;
+    }
+}
+
 static void transplant(BST *bst, BSTNode *u, BSTNode *v) {
     if (u->parent == NULL) {
         bst->root = v;
@@ -194,54 +233,22 @@ static bool is_balanced_recursive(BSTNode *node, int *height) {
     return diff <= 1;
 }
 
-static void inorder_recursive(BSTNode *node, BSTTraversalFn callback, void *user_data) {
-    if (node == NULL) return;
-    inorder_recursive(node->left, callback, user_data);
-    callback(node->data, user_data);
-    inorder_recursive(node->right, callback, user_data);
-}
-
-static void preorder_recursive(BSTNode *node, BSTTraversalFn callback, void *user_data) {
-    if (node == NULL) return;
-    callback(node->data, user_data);
-    preorder_recursive(node->left, callback, user_data);
-    preorder_recursive(node->right, callback, user_data);
-}
-
-static void postorder_recursive(BSTNode *node, BSTTraversalFn callback, void *user_data) {
-    if (node == NULL) return;
-    postorder_recursive(node->left, callback, user_data);
-    postorder_recursive(node->right, callback, user_data);
-    callback(node->data, user_data);
-}
-
-static BSTNode* clone_recursive(BSTNode *node, size_t element_size, CopyFn copy_fn) {
+static BSTNode* clone_recursive(BST *dst, BSTNode *node, CopyFn copy_fn) {
     if (node == NULL) return NULL;
     
-    BSTNode *new_node = (BSTNode*)malloc(sizeof(BSTNode));
-    if (new_node == NULL) return NULL;
-    
-    new_node->data = malloc(element_size);
-    if (new_node->data == NULL) {
-        free(new_node);
-        return NULL;
-    }
-    
+    BSTNode *new_node;
     if (copy_fn != NULL) {
         void *copied = copy_fn(node->data);
-        if (copied == NULL) {
-            free(new_node->data);
-            free(new_node);
-            return NULL;
-        }
-        memcpy(new_node->data, copied, element_size);
+        if (copied == NULL) return NULL;
+        new_node = create_node(dst, copied);
         free(copied);
     } else {
-        memcpy(new_node->data, node->data, element_size);
+        new_node = create_node(dst, node->data);
     }
+    if (new_node == NULL) return NULL;
     
-    new_node->left = clone_recursive(node->left, element_size, copy_fn);
-    new_node->right = clone_recursive(node->right, element_size, copy_fn);
+    new_node->left = clone_recursive(dst, node->left, copy_fn);
+    new_node->right = clone_recursive(dst, node->right, copy_fn);
     new_node->parent = NULL;
     
     if (new_node->left != NULL) new_node->left->parent = new_node;
@@ -250,16 +257,41 @@ static BSTNode* clone_recursive(BSTNode *node, size_t element_size, CopyFn copy_
     return new_node;
 }
 
+/**
+ * @brief Constrói uma subárvore balanceada a partir de array[left, right)
+ */
+static BSTNode* build_balanced(BST *bst, const char *array, size_t left,
+                               size_t right, BSTNode *parent) {
+    if (left >= right) return NULL;
+    
+    size_t mid = left + (right - left) / 2;
+    BSTNode *node = create_node(bst, array + mid * bst->element_size);
+    if (node == NULL) return NULL;
+    
+    node->parent = parent;
+    node->left = build_balanced(bst, array, left, mid, node);
+    node->right = build_balanced(bst, array, mid + 1, right, node);
+    
+    return node;
+}
+
 // ============================================================================
 // FUNÇÕES PÚBLICAS
 // ============================================================================
 
 BST* bst_create(size_t element_size, CompareFn compare, DestroyFn destroy) {
+    return bst_create_with_allocator(element_size, compare, destroy, NULL);
+}
+
+BST* bst_create_with_allocator(size_t element_size, CompareFn compare,
+                               DestroyFn destroy, const DSAllocator *allocator) {
     if (element_size == 0 || compare == NULL) return NULL;
+    if (allocator == NULL) allocator = ds_default_allocator();
     
-    BST *bst = (BST*)malloc(sizeof(BST));
+    BST *bst = (BST*)ds_alloc(allocator, sizeof(BST));
     if (bst == NULL) return NULL;
     
+    bst->allocator = *allocator;
     bst->root = NULL;
     bst->element_size = element_size;
     bst->size = 0;
@@ -272,14 +304,15 @@ BST* bst_create(size_t element_size, CompareFn compare, DestroyFn destroy) {
 void bst_destroy(BST *bst) {
     if (bst == NULL) return;
     
-    destroy_tree_recursive(bst->root, bst->destroy);
-    free(bst);
+    destroy_tree(bst, bst->root);
+    DSAllocator allocator = bst->allocator;
+    ds_free(&allocator, bst, sizeof(BST));
 }
 
 DataStructureError bst_insert(BST *bst, const void *data) {
     if (bst == NULL || data == NULL) return DS_ERROR_NULL_POINTER;
     
-    BSTNode *new_node = create_node(data, bst->element_size);
+    BSTNode *new_node = create_node(bst, data);
     if (new_node == NULL) return DS_ERROR_OUT_OF_MEMORY;
     
     BSTNode *parent = NULL;
@@ -354,7 +387,7 @@ DataStructureError bst_remove(BST *bst, const void *data) {
         successor->left->parent = successor;
     }
     
-    destroy_node(node, bst->destroy);
+    destroy_node(bst, node);
     bst->size--;
     return DS_SUCCESS;
 }
@@ -411,6 +444,11 @@ size_t bst_size(const BST *bst) {
     return bst == NULL ? 0 : bst->size;
 }
 
+size_t bst_memory_usage(const BST *bst) {
+    if (bst == NULL) return 0;
+    return sizeof(BST) + bst->size * (sizeof(BSTNode) + bst->element_size);
+}
+
 int bst_height(const BST *bst) {
     if (bst == NULL) return -1;
     return height_recursive(bst->root);
@@ -430,24 +468,124 @@ bool bst_is_balanced(const BST *bst) {
 void bst_clear(BST *bst) {
     if (bst == NULL) return;
     
-    destroy_tree_recursive(bst->root, bst->destroy);
+    destroy_tree(bst, bst->root);
     bst->root = NULL;
     bst->size = 0;
 }
 
-void bst_inorder(const BST *bst, BSTTraversalFn callback, void *user_data) {
+static void iter_push(BSTIter *it, const BSTNode *node) {
+    it->stack[it->top++ % BST_ITER_STACK] = node;
+    if (it->count < BST_ITER_STACK) {
+        it->count++;
+    } else {
+        it->truncated = true;
+    }
+}
+
+static const BSTNode* iter_pop(BSTIter *it) {
+    if (it->count == 0) return NULL;
+    it->count--;
+    return it->stack[--it->top % BST_ITER_STACK];
+}
+
+static void iter_push_left(BSTIter *it, const BSTNode *node) {
+    while (node != NULL) {
+        iter_push(it, node);
+        node = node->left;
+    }
+}
+
+static void iter_reset(BSTIter *it, BSTOrder order) {
+    it->top = 0;
+    it->count = 0;
+    it->truncated = false;
+    it->last = NULL;
+    it->order = order;
+}
+
+void bst_iter_begin(const BST *bst, BSTOrder order, BSTIter *it) {
+    if (it == NULL) return;
+
+    iter_reset(it, order);
+    if (bst == NULL || bst->root == NULL) return;
+    switch (order) {
+        case BST_INORDER:   iter_push_left(it, bst->root); break;
+        case BST_PREORDER:  iter_push(it, bst->root); break;
+        case BST_POSTORDER: iter_push(it, first_postorder(bst->root)); break;
+    }
+}
+
+void bst_iter_seek(const BST *bst, const void *key, BSTIter *it) {
+    if (it == NULL) return;
+
+    iter_reset(it, BST_INORDER);
+    if (bst == NULL || key == NULL) return;
+
+    // Empilha os nós >= key da descida: exatamente os pendentes da ordem
+    const BSTNode *current = bst->root;
+    while (current != NULL) {
+        if (bst->compare(current->data, key) >= 0) {
+            iter_push(it, current);
+            current = current->left;
+        } else {
+            current = current->right;
+        }
+    }
+}
+
+bool bst_iter_next(BSTIter *it, void **data) {
+    if (it == NULL) return false;
+
+    const BSTNode *node = iter_pop(it);
+    if (node == NULL && it->truncated && it->last != NULL) {
+        // Pendente descartado: a pilha vazia implica que last não tem
+        // filhos a visitar, então o próximo vem da subida pelos pais
+        node = (it->order == BST_INORDER) ? tree_successor((BSTNode *)it->last)
+                                          : next_preorder((BSTNode *)it->last);
+    }
+    if (node == NULL) return false;
+
+    switch (it->order) {
+        case BST_INORDER:
+            iter_push_left(it, node->right);
+            break;
+        case BST_PREORDER:
+            if (node->right != NULL) iter_push(it, node->right);
+            if (node->left != NULL) iter_push(it, node->left);
+            break;
+        case BST_POSTORDER: {
+            // Pelos pais: cada subida já chega ao próximo da ordem
+            const BSTNode *next = next_postorder((BSTNode *)node);
+            if (next != NULL) iter_push(it, next);
+            break;
+        }
+    }
+    it->last = node;
+    if (data != NULL) *data = node->data;
+    return true;
+}
+
+static void walk(const BST *bst, BSTOrder order, BSTTraversalFn callback, void *user_data) {
     if (bst == NULL || callback == NULL) return;
-    inorder_recursive(bst->root, callback, user_data);
+
+    BSTIter it;
+    void *data;
+    bst_iter_begin(bst, order, &it);
+    while (bst_iter_next(&it, &data)) {
+        callback(data, user_data);
+    }
+}
+
+void bst_inorder(const BST *bst, BSTTraversalFn callback, void *user_data) {
+    walk(bst, BST_INORDER, callback, user_data);
 }
 
 void bst_preorder(const BST *bst, BSTTraversalFn callback, void *user_data) {
-    if (bst == NULL || callback == NULL) return;
-    preorder_recursive(bst->root, callback, user_data);
+    walk(bst, BST_PREORDER, callback, user_data);
 }
 
 void bst_postorder(const BST *bst, BSTTraversalFn callback, void *user_data) {
-    if (bst == NULL || callback == NULL) return;
-    postorder_recursive(bst->root, callback, user_data);
+    walk(bst, BST_POSTORDER, callback, user_data);
 }
 
 void bst_levelorder(const BST *bst, BSTTraversalFn callback, void *user_data) {
@@ -473,10 +611,11 @@ void bst_levelorder(const BST *bst, BSTTraversalFn callback, void *user_data) {
 BST* bst_clone(const BST *bst, CopyFn copy_fn) {
     if (bst == NULL) return NULL;
     
-    BST *new_bst = bst_create(bst->element_size, bst->compare, bst->destroy);
+    BST *new_bst = bst_create_with_allocator(bst->element_size, bst->compare,
+                                             bst->destroy, &bst->allocator);
     if (new_bst == NULL) return NULL;
     
-    new_bst->root = clone_recursive(bst->root, bst->element_size, copy_fn);
+    new_bst->root = clone_recursive(new_bst, bst->root, copy_fn);
     new_bst->size = bst->size;
     
     return new_bst;
@@ -503,15 +642,14 @@ DataStructureError bst_to_array(const BST *bst, void **array, size_t *size) {
     if (result == NULL) return DS_ERROR_OUT_OF_MEMORY;
     
     size_t index = 0;
-    
-    void collect_inorder(void *data, void *user_data) {
-        size_t *idx = (size_t*)user_data;
-        memcpy((char*)result + (*idx * bst->element_size), data, bst->element_size);
-        (*idx)++;
+    BSTIter it;
+    void *data;
+    bst_iter_begin(bst, BST_INORDER, &it);
+    while (bst_iter_next(&it, &data)) {
+        memcpy((char*)result + (index * bst->element_size), data, bst->element_size);
+        index++;
     }
     
-    bst_inorder(bst, collect_inorder, &index);
-    
     *array = result;
     *size = bst->size;
     return DS_SUCCESS;
@@ -527,24 +665,25 @@ DataStructureError bst_range_search(const BST *bst, const void *min, const void
     void *array = malloc(capacity * bst->element_size);
     if (array == NULL) return DS_ERROR_OUT_OF_MEMORY;
     
+    // Só visita [min, max]: O(h + k) em vez de percorrer a árvore inteira
     size_t result_count = 0;
-    
-    void collect_range(void *data, void *user_data) {
-        (void)user_data;
-        if (bst->compare(data, min) >= 0 && bst->compare(data, max) <= 0) {
-            if (result_count >= capacity) {
-                capacity *= 2;
-                void *new_array = realloc(array, capacity * bst->element_size);
-                if (new_array == NULL) return;
-                array = new_array;
+    BSTIter it;
+    void *data;
+    bst_iter_seek(bst, min, &it);
+    while (bst_iter_next(&it, &data) && bst->compare(data, max) <= 0) {
+        if (result_count >= capacity) {
+            capacity *= 2;
+            void *new_array = realloc(array, capacity * bst->element_size);
+            if (new_array == NULL) {
+                free(array);
+                return DS_ERROR_OUT_OF_MEMORY;
             }
-            memcpy((char*)array + (result_count * bst->element_size), data, bst->element_size);
-            result_count++;
+            array = new_array;
         }
+        memcpy((char*)array + (result_count * bst->element_size), data, bst->element_size);
+        result_count++;
     }
     
-    bst_inorder(bst, collect_range, NULL);
-    
     *results = array;
     *count = result_count;
     return DS_SUCCESS;
@@ -554,14 +693,12 @@ size_t bst_range_count(const BST *bst, const void *min, const void *max) {
     if (bst == NULL || min == NULL || max == NULL) return 0;
     
     size_t count = 0;
-    
-    void count_range(void *data, void *user_data) {
-        if (bst->compare(data, min) >= 0 && bst->compare(data, max) <= 0) {
-            (*(size_t*)user_data)++;
-        }
+    BSTIter it;
+    void *data;
+    bst_iter_seek(bst, min, &it);
+    while (bst_iter_next(&it, &data) && bst->compare(data, max) <= 0) {
+        count++;
     }
-    
-    bst_inorder(bst, count_range, &count);
     return count;
 }
 
@@ -569,39 +706,29 @@ DataStructureError bst_select(const BST *bst, size_t k, void *output) {
     if (bst == NULL || output == NULL) return DS_ERROR_NULL_POINTER;
     if (k == 0 || k > bst->size) return DS_ERROR_INVALID_INDEX;
     
-    size_t index = 0;
-    DataStructureError result = DS_ERROR_NOT_FOUND;
-    
-    void select_kth(void *data, void *user_data) {
-        size_t *idx = (size_t*)user_data;
-        (*idx)++;
-        if (*idx == k) {
+    BSTIter it;
+    void *data;
+    bst_iter_begin(bst, BST_INORDER, &it);
+    for (size_t index = 1; bst_iter_next(&it, &data); index++) {
+        if (index == k) {
             memcpy(output, data, bst->element_size);
-            result = DS_SUCCESS;
+            return DS_SUCCESS;
         }
     }
-    
-    bst_inorder(bst, select_kth, &index);
-    return result;
+    return DS_ERROR_NOT_FOUND;
 }
 
 size_t bst_rank(const BST *bst, const void *data) {
     if (bst == NULL || data == NULL) return 0;
     
+    // Elementos menores que data vêm primeiro na ordem
     size_t rank = 0;
-    bool found = false;
-    
-    void count_smaller(void *node_data, void *user_data) {
-        if (found) return;
-        
-        if (bst->compare(node_data, data) < 0) {
-            (*(size_t*)user_data)++;
-        } else if (bst->compare(node_data, data) == 0) {
-            found = true;
-        }
+    BSTIter it;
+    void *node_data;
+    bst_iter_begin(bst, BST_INORDER, &it);
+    while (bst_iter_next(&it, &node_data) && bst->compare(node_data, data) < 0) {
+        rank++;
     }
-    
-    bst_inorder(bst, count_smaller, &rank);
     return rank;
 }
 
@@ -612,23 +739,7 @@ BST* bst_from_sorted_array(size_t element_size, const void *array, size_t size,
     BST *bst = bst_create(element_size, compare, destroy);
     if (bst == NULL) return NULL;
     
-    BSTNode* build_balanced(size_t left, size_t right, BSTNode *parent) {
-        if (left > right) return NULL;
-        
-        size_t mid = left + (right - left) / 2;
-        const void *mid_data = (const char*)array + (mid * element_size);
-        
-        BSTNode *node = create_node(mid_data, element_size);
-        if (node == NULL) return NULL;
-        
-        node->parent = parent;
-        node->left = build_balanced(left, mid - 1, node);
-        node->right = build_balanced(mid + 1, right, node);
-        
-        return node;
-    }
-    
-    bst->root = build_balanced(0, size - 1, NULL);
+    bst->root = build_balanced(bst, (const char*)array, 0, size, NULL);
     bst->size = size;
     
     return bst;
@@ -643,17 +754,15 @@ DataStructureError bst_balance(BST *bst) {
     DataStructureError err = bst_to_array(bst, &array, &size);
     if (err != DS_SUCCESS) return err;
     
+    // Nós liberados sem destroy: os elementos migram para a nova árvore
+    DestroyFn destroy = bst->destroy;
+    bst->destroy = NULL;
     bst_clear(bst);
+    bst->destroy = destroy;
     
-    BST *balanced = bst_from_sorted_array(bst->element_size, array, size,
-                                          bst->compare, bst->destroy);
+    bst->root = build_balanced(bst, (const char*)array, 0, size, NULL);
+    bst->size = size;
     free(array);
     
-    if (balanced == NULL) return DS_ERROR_OUT_OF_MEMORY;
-    
-    bst->root = balanced->root;
-    bst->size = balanced->size;
-    free(balanced);
-    
     return DS_SUCCESS;
 }
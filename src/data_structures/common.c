@@ -11,16 +11,91 @@
  * - Knuth TAOCP Vol 3, Section 6.4 (Hash Functions)
  * - http://www.cse.yorku.ca/~oz/hash.html (djb2)
  * - http://www.isthe.com/chongo/tech/comp/fnv/ (FNV-1a)
+ * - https://github.com/wangyi-fudan/wyhash (wyhash)
  *
  * @author Algoritmos e Heurísticas
  * @date 2025
  */
 
 #include "data_structures/common.h"
+#include "data_structures/instrument.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <stdint.h>
+#include <time.h>
+
+// ============================================================================
+// ALOCADOR PADRÃO
+// ============================================================================
+
+static void* libc_alloc(void *ctx, size_t size) {
+    (void)ctx;
+    return malloc(size);
+}
+
+static void* libc_realloc(void *ctx, void *ptr, size_t old_size, size_t new_size) {
+    (void)ctx;
+    (void)old_size;
+    return realloc(ptr, new_size);
+}
+
+static void libc_free(void *ctx, void *ptr, size_t size) {
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
+
+static const DSAllocator DEFAULT_ALLOCATOR = { libc_alloc, libc_realloc, libc_free, NULL };
+
+const DSAllocator* ds_default_allocator(void) {
+    return &DEFAULT_ALLOCATOR;
+}
+
+void* ds_alloc(const DSAllocator *allocator, size_t size) {
+    if (allocator == NULL) allocator = &DEFAULT_ALLOCATOR;
+    DS_COUNT(ALLOCATOR, ALLOCATIONS, 1);
+    DS_COUNT(ALLOCATOR, ALLOCATED_BYTES, size);
+    return allocator->alloc(allocator->ctx, size);
+}
+
+void* ds_calloc(const DSAllocator *allocator, size_t count, size_t size) {
+    if (size != 0 && count > (size_t)-1 / size) return NULL;
+    if (allocator == NULL) allocator = &DEFAULT_ALLOCATOR;
+    // calloc recebe páginas já zeradas do sistema em blocos grandes, sem memset
+    if (allocator->alloc == libc_alloc) {
+        DS_COUNT(ALLOCATOR, ALLOCATIONS, 1);
+        DS_COUNT(ALLOCATOR, ALLOCATED_BYTES, count * size);
+        return calloc(count, size);
+    }
+    void *ptr = ds_alloc(allocator, count * size);
+    if (ptr != NULL) memset(ptr, 0, count * size);
+    return ptr;
+}
+
+void* ds_realloc(const DSAllocator *allocator, void *ptr, size_t old_size, size_t new_size) {
+    if (ptr == NULL) return ds_alloc(allocator, new_size);
+    if (allocator == NULL) allocator = &DEFAULT_ALLOCATOR;
+    DS_COUNT(ALLOCATOR, ALLOCATIONS, 1);
+    DS_COUNT(ALLOCATOR, ALLOCATED_BYTES, new_size);
+    if (allocator->realloc != NULL) {
+        return allocator->realloc(allocator->ctx, ptr, old_size, new_size);
+    }
+
+    void *fresh = allocator->alloc(allocator->ctx, new_size);
+    if (fresh == NULL) return NULL;
+    memcpy(fresh, ptr, old_size < new_size ? old_size : new_size);
+    if (allocator->free != NULL) allocator->free(allocator->ctx, ptr, old_size);
+    return fresh;
+}
+
+void ds_free(const DSAllocator *allocator, void *ptr, size_t size) {
+    if (ptr == NULL) return;
+    if (allocator == NULL) allocator = &DEFAULT_ALLOCATOR;
+    DS_COUNT(ALLOCATOR, FREES, 1);
+    if (allocator->free != NULL) allocator->free(allocator->ctx, ptr, size);
+}
 
 // ============================================================================
 // FUNÇÕES DE COMPARAÇÃO
@@ -346,6 +421,172 @@ size_t hash_fnv1a(const void *data, size_t size) {
     return hash;
 }
 
+// ----------------------------------------------------------------------------
+// wyhash: palavra a palavra, com semente
+// ----------------------------------------------------------------------------
+
+/** Constantes ímpares de wyhash (final v4, segredo padrão) */
+static const uint64_t WYHASH_SECRET[4] = {
+    0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL,
+    0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL
+};
+
+/** Semente global usada por hash_wyhash_string */
+static uint64_t g_hash_seed = 0;
+
+/**
+ * Produto 64x64 -> 128 bits: *a recebe a metade baixa e *b a alta
+ */
+static inline void wy_mum(uint64_t *a, uint64_t *b) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 wide;
+    wide r = (wide)*a * *b;
+    *a = (uint64_t)r;
+    *b = (uint64_t)(r >> 64);
+#else
+    uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a, lb = (uint32_t)*b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32);
+    uint64_t carry = t < rl;
+    uint64_t lo = t + (rm1 << 32);
+    carry += lo < t;
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+static inline uint64_t wy_mix(uint64_t a, uint64_t b) {
+    wy_mum(&a, &b);
+    return a ^ b;
+}
+
+// Leituras desalinhadas via memcpy (ordem de bytes nativa)
+static inline uint64_t wy_read8(const unsigned char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t wy_read4(const unsigned char *p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t wy_read3(const unsigned char *p, size_t k) {
+    return ((uint64_t)p[0] << 16) | ((uint64_t)p[k >> 1] << 8) | p[k - 1];
+}
+
+/**
+ * @brief Hash wyhash (final v4) para dados binários com semente
+ *
+ * Consome 8 bytes por leitura e, acima de 48 bytes, três cadeias de
+ * multiplicação independentes por iteração, que a CPU executa em paralelo.
+ * Chaves de até 16 bytes são lidas com no máximo quatro loads, sem laço.
+ * Cada passo mistura dois words com um produto 64x64 -> 128 bits e XOR
+ * das metades.
+ *
+ * Referência: https://github.com/wangyi-fudan/wyhash (domínio público)
+ *
+ * Complexidade: O(size)
+ */
+size_t hash_wyhash(const void *data, size_t size, uint64_t seed) {
+    if (data == NULL && size > 0) {
+        return 0;
+    }
+
+    const unsigned char *p = (const unsigned char*)data;
+    const uint64_t *s = WYHASH_SECRET;
+    uint64_t a, b;
+
+    seed ^= wy_mix(seed ^ s[0], s[1]);
+    if (size <= 16) {
+        if (size >= 4) {
+            size_t mid = (size >> 3) << 2;
+            a = (wy_read4(p) << 32) | wy_read4(p + mid);
+            b = (wy_read4(p + size - 4) << 32) | wy_read4(p + size - 4 - mid);
+        } else if (size > 0) {
+            a = wy_read3(p, size);
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t i = size;
+        if (i >= 48) {
+            uint64_t see1 = seed, see2 = seed;
+            do {
+                seed = wy_mix(wy_read8(p) ^ s[1], wy_read8(p + 8) ^ seed);
+                see1 = wy_mix(wy_read8(p + 16) ^ s[2], wy_read8(p + 24) ^ see1);
+                see2 = wy_mix(wy_read8(p + 32) ^ s[3], wy_read8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i >= 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = wy_mix(wy_read8(p) ^ s[1], wy_read8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = wy_read8(p + i - 16);
+        b = wy_read8(p + i - 8);
+    }
+
+    a ^= s[1];
+    b ^= seed;
+    wy_mum(&a, &b);
+    return (size_t)wy_mix(a ^ s[0] ^ size, b ^ s[1]);
+}
+
+/**
+ * @brief wyhash para strings (char*) com a semente global
+ *
+ * Mesma convenção de hash_string: data aponta para um char*.
+ *
+ * Complexidade: O(n) onde n = strlen(string)
+ */
+size_t hash_wyhash_string(const void *data) {
+    if (data == NULL) {
+        return 0;
+    }
+
+    const char *str = *(const char**)data;
+    if (str == NULL) {
+        return 0;
+    }
+
+    return hash_wyhash(str, strlen(str), g_hash_seed);
+}
+
+void hash_set_seed(uint64_t seed) {
+    g_hash_seed = seed;
+}
+
+uint64_t hash_get_seed(void) {
+    return g_hash_seed;
+}
+
+/**
+ * @brief Semente imprevisível para o processo
+ *
+ * Mistura o relógio de parede (ns), o tempo de CPU, o endereço de um
+ * objeto estático e de um local (variam com ASLR) e um contador de chamadas.
+ * Não é criptográfica, mas impede que um atacante pré-calcule colisões.
+ */
+uint64_t hash_random_seed(void) {
+    static uint64_t calls = 0;
+    struct timespec ts = {0, 0};
+    int local = 0;
+
+    timespec_get(&ts, TIME_UTC);
+    uint64_t h = wy_mix((uint64_t)ts.tv_sec ^ WYHASH_SECRET[0],
+                        (uint64_t)ts.tv_nsec ^ WYHASH_SECRET[1]);
+    h = wy_mix(h ^ (uint64_t)clock(), (uint64_t)(uintptr_t)&calls ^ WYHASH_SECRET[2]);
+    h = wy_mix(h ^ (uint64_t)(uintptr_t)&local, ++calls ^ WYHASH_SECRET[3]);
+    return h;
+}
+
 /**
  * @brief Hash multiplicativa (Knuth)
  *
@@ -0,0 +1,325 @@
+/**
+ * @file cuckoo_filter.c
+ * @brief Implementação do cuckoo filter (fingerprints de 16 bits, buckets de 4)
+ *
+ * Cada bucket é um uint64_t com 4 fingerprints de 16 bits; 0 marca posição
+ * vazia (fingerprints nulos viram 1). Do hash de 64 bits da chave, os bits
+ * baixos dão i1 e os 16 altos o fingerprint; i2 = i1 ^ (fp · constante),
+ * uma involução, então alt(alt(i, fp), fp) == i.
+ *
+ * A busca em um bucket usa o teste SWAR "alguma palavra de 16 bits é zero"
+ * sobre bucket ^ (fp repetido 4 vezes).
+ *
+ * Referências:
+ * - Fan, B. et al. (2014). "Cuckoo Filter: Practically Better Than Bloom".
+ *   CoNEXT '14
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/cuckoo_filter.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/** Bits por fingerprint */
+#define CUCKOO_FP_BITS 16
+
+/** Constantes SWAR para 4 palavras de 16 bits */
+#define CUCKOO_LANES_LOW  0x0001000100010001ULL
+#define CUCKOO_LANES_HIGH 0x8000800080008000ULL
+
+// ============================================================================
+// ESTRUTURA INTERNA
+// ============================================================================
+
+struct CuckooFilter {
+    uint64_t *buckets;
+    size_t num_buckets;     // potência de 2
+    size_t size;
+    uint64_t rng;           // xorshift64 para escolher as vítimas
+
+    // Fingerprint que sobrou da última inserção sem espaço
+    bool has_victim;
+    size_t victim_index;
+    uint16_t victim_fp;
+
+    HashFn hash_fn;
+    DSAllocator allocator;
+};
+
+// ============================================================================
+// FUNÇÕES AUXILIARES PRIVADAS
+// ============================================================================
+
+/**
+ * Finalizador do MurmurHash3: espalha hashes fracos (hash_int) pelos 64 bits
+ */
+static inline uint64_t cuckoo_mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static inline size_t cuckoo_alt(const CuckooFilter *filter, size_t index, uint16_t fp) {
+    return (index ^ (size_t)((uint64_t)fp * 0x5bd1e995ULL)) & (filter->num_buckets - 1);
+}
+
+static void cuckoo_locate(const CuckooFilter *filter, const void *key,
+                          uint16_t *fp, size_t *i1, size_t *i2) {
+    uint64_t h = cuckoo_mix((uint64_t)filter->hash_fn(key));
+    *fp = (uint16_t)(h >> (64 - CUCKOO_FP_BITS));
+    if (*fp == 0) {
+        *fp = 1;
+    }
+    *i1 = (size_t)(h & (uint64_t)(filter->num_buckets - 1));
+    *i2 = cuckoo_alt(filter, *i1, *fp);
+}
+
+static inline uint16_t slot_get(uint64_t bucket, size_t slot) {
+    return (uint16_t)(bucket >> (slot * CUCKOO_FP_BITS));
+}
+
+static inline uint64_t slot_set(uint64_t bucket, size_t slot, uint16_t fp) {
+    size_t shift = slot * CUCKOO_FP_BITS;
+    return (bucket & ~((uint64_t)0xFFFF << shift)) | ((uint64_t)fp << shift);
+}
+
+/**
+ * true se alguma das 4 posições do bucket vale fp (as 4 comparadas juntas)
+ */
+static inline bool bucket_has(uint64_t bucket, uint16_t fp) {
+    uint64_t v = bucket ^ (CUCKOO_LANES_LOW * fp);
+    return ((v - CUCKOO_LANES_LOW) & ~v & CUCKOO_LANES_HIGH) != 0;
+}
+
+static bool bucket_insert(CuckooFilter *filter, size_t index, uint16_t fp) {
+    uint64_t bucket = filter->buckets[index];
+    if (!bucket_has(bucket, 0)) {
+        return false;
+    }
+    for (size_t s = 0; s < CUCKOO_BUCKET_SLOTS; s++) {
+        if (slot_get(bucket, s) == 0) {
+            filter->buckets[index] = slot_set(bucket, s, fp);
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool bucket_delete(CuckooFilter *filter, size_t index, uint16_t fp) {
+    uint64_t bucket = filter->buckets[index];
+    if (!bucket_has(bucket, fp)) {
+        return false;
+    }
+    for (size_t s = 0; s < CUCKOO_BUCKET_SLOTS; s++) {
+        if (slot_get(bucket, s) == fp) {
+            filter->buckets[index] = slot_set(bucket, s, 0);
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint64_t cuckoo_random(CuckooFilter *filter) {
+    filter->rng ^= filter->rng << 13;
+    filter->rng ^= filter->rng >> 7;
+    filter->rng ^= filter->rng << 17;
+    return filter->rng;
+}
+
+/**
+ * Coloca fp no bucket index ou no alternativo, deslocando fingerprints
+ * aleatórios por até CUCKOO_MAX_KICKS passos. Sem espaço, o fingerprint
+ * que ficou de fora vira a vítima.
+ */
+static void cuckoo_place(CuckooFilter *filter, size_t index, uint16_t fp) {
+    if (bucket_insert(filter, index, fp)) {
+        return;
+    }
+    index = cuckoo_alt(filter, index, fp);
+    if (bucket_insert(filter, index, fp)) {
+        return;
+    }
+
+    for (int kick = 0; kick < CUCKOO_MAX_KICKS; kick++) {
+        size_t s = (size_t)(cuckoo_random(filter) % CUCKOO_BUCKET_SLOTS);
+        uint16_t evicted = slot_get(filter->buckets[index], s);
+        filter->buckets[index] = slot_set(filter->buckets[index], s, fp);
+        fp = evicted;
+        index = cuckoo_alt(filter, index, fp);
+        if (bucket_insert(filter, index, fp)) {
+            return;
+        }
+    }
+
+    filter->has_victim = true;
+    filter->victim_index = index;
+    filter->victim_fp = fp;
+}
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+CuckooFilter* cuckoo_filter_create(size_t capacity, HashFn hash_fn) {
+    return cuckoo_filter_create_with_allocator(capacity, hash_fn, NULL);
+}
+
+CuckooFilter* cuckoo_filter_create_with_allocator(size_t capacity, HashFn hash_fn,
+                                                  const DSAllocator *allocator) {
+    if (capacity == 0 || hash_fn == NULL || capacity > SIZE_MAX / 4) {
+        return NULL;
+    }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
+
+    // Slots para 95% de ocupação, arredondados para buckets em potência de 2
+    size_t slots = capacity + capacity / 19 + 1;
+    size_t wanted = (slots + CUCKOO_BUCKET_SLOTS - 1) / CUCKOO_BUCKET_SLOTS;
+    size_t num_buckets = 2;
+    while (num_buckets < wanted) {
+        num_buckets *= 2;
+    }
+    if (num_buckets > SIZE_MAX / sizeof(uint64_t)) {
+        return NULL;
+    }
+
+    CuckooFilter *filter = (CuckooFilter *)ds_alloc(allocator, sizeof(CuckooFilter));
+    if (filter == NULL) {
+        return NULL;
+    }
+    filter->buckets = (uint64_t *)ds_calloc(allocator, num_buckets, sizeof(uint64_t));
+    if (filter->buckets == NULL) {
+        ds_free(allocator, filter, sizeof(CuckooFilter));
+        return NULL;
+    }
+
+    filter->num_buckets = num_buckets;
+    filter->size = 0;
+    filter->rng = 0x9E3779B97F4A7C15ULL;
+    filter->has_victim = false;
+    filter->victim_index = 0;
+    filter->victim_fp = 0;
+    filter->hash_fn = hash_fn;
+    filter->allocator = *allocator;
+    return filter;
+}
+
+void cuckoo_filter_destroy(CuckooFilter *filter) {
+    if (filter == NULL) {
+        return;
+    }
+
+    DSAllocator allocator = filter->allocator;
+    ds_free(&allocator, filter->buckets, filter->num_buckets * sizeof(uint64_t));
+    ds_free(&allocator, filter, sizeof(CuckooFilter));
+}
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+DataStructureError cuckoo_filter_add(CuckooFilter *filter, const void *key) {
+    if (filter == NULL || key == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (filter->has_victim) {
+        return DS_ERROR_FULL;
+    }
+
+    uint16_t fp;
+    size_t i1, i2;
+    cuckoo_locate(filter, key, &fp, &i1, &i2);
+
+    // Começa por um dos dois buckets ao acaso, para equilibrar a ocupação
+    cuckoo_place(filter, (cuckoo_random(filter) & 1) ? i2 : i1, fp);
+    filter->size++;
+    return DS_SUCCESS;
+}
+
+bool cuckoo_filter_contains(const CuckooFilter *filter, const void *key) {
+    if (filter == NULL || key == NULL) {
+        return false;
+    }
+
+    uint16_t fp;
+    size_t i1, i2;
+    cuckoo_locate(filter, key, &fp, &i1, &i2);
+
+    if (bucket_has(filter->buckets[i1], fp) || bucket_has(filter->buckets[i2], fp)) {
+        return true;
+    }
+    return filter->has_victim && filter->victim_fp == fp &&
+           (filter->victim_index == i1 || filter->victim_index == i2);
+}
+
+DataStructureError cuckoo_filter_remove(CuckooFilter *filter, const void *key) {
+    if (filter == NULL || key == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    uint16_t fp;
+    size_t i1, i2;
+    cuckoo_locate(filter, key, &fp, &i1, &i2);
+
+    if (filter->has_victim && filter->victim_fp == fp &&
+        (filter->victim_index == i1 || filter->victim_index == i2)) {
+        filter->has_victim = false;
+        filter->size--;
+        return DS_SUCCESS;
+    }
+    if (!bucket_delete(filter, i1, fp) && !bucket_delete(filter, i2, fp)) {
+        return DS_ERROR_NOT_FOUND;
+    }
+    filter->size--;
+
+    // Há uma posição livre agora: tenta reacomodar a vítima
+    if (filter->has_victim) {
+        filter->has_victim = false;
+        cuckoo_place(filter, filter->victim_index, filter->victim_fp);
+    }
+    return DS_SUCCESS;
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+size_t cuckoo_filter_size(const CuckooFilter *filter) {
+    return filter ? filter->size : 0;
+}
+
+size_t cuckoo_filter_capacity(const CuckooFilter *filter) {
+    return filter ? filter->num_buckets * CUCKOO_BUCKET_SLOTS : 0;
+}
+
+double cuckoo_filter_load_factor(const CuckooFilter *filter) {
+    if (filter == NULL) {
+        return 0.0;
+    }
+    return (double)filter->size / (double)(filter->num_buckets * CUCKOO_BUCKET_SLOTS);
+}
+
+size_t cuckoo_filter_size_bytes(const CuckooFilter *filter) {
+    return filter ? filter->num_buckets * sizeof(uint64_t) : 0;
+}
+
+size_t cuckoo_filter_memory_usage(const CuckooFilter *filter) {
+    return filter ? sizeof(CuckooFilter) + filter->num_buckets * sizeof(uint64_t) : 0;
+}
+
+void cuckoo_filter_clear(CuckooFilter *filter) {
+    if (filter == NULL) {
+        return;
+    }
+
+    memset(filter->buckets, 0, filter->num_buckets * sizeof(uint64_t));
+    filter->size = 0;
+    filter->has_victim = false;
+}
@@ -0,0 +1,474 @@
+/**
+ * @file double_array_trie.c
+ * @brief Implementação da trie estática em double array
+ *
+ * Construção (Aoe, 1989): cada nó cobre um intervalo [lo, hi) da lista
+ * ordenada cujas chaves compartilham os primeiros depth bytes. Os bytes na
+ * posição depth dividem o intervalo em grupos contíguos (um por filho); o
+ * nó recebe a menor base b tal que as células b + c de todos os filhos c
+ * estão livres. A busca por b começa na primeira célula livre e pula
+ * regiões quase cheias, como no darts de Kudo.
+ *
+ * Referências:
+ * - Aoe, J. (1989). "An Efficient Digital Search Algorithm by Using a
+ *   Double-Array Structure". IEEE Trans. Software Engineering 15(9)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+// mmap/munmap (POSIX) com CMAKE_C_EXTENSIONS OFF
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "data_structures/double_array_trie.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DATRIE_USE_MMAP 1
+#endif
+
+// ============================================================================
+// ESTRUTURAS INTERNAS
+// ============================================================================
+
+#define DATRIE_MAGIC "DATRIE01"
+#define DATRIE_BYTE_ORDER 0x01020304u
+#define DATRIE_VERSION 1u
+
+#define FREE_CELL (-1)
+#define ROOT 0
+
+// Região de busca por base considerada cheia a partir desta ocupação
+#define DENSE_REGION 0.95
+
+// Cabeçalho do arquivo: 40 bytes, as células começam alinhadas a 8
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint64_t num_keys;
+    uint64_t num_units;
+    uint64_t max_length;
+} DATFileHeader;
+
+// base e check lado a lado: uma transição lê uma só célula
+typedef struct {
+    int32_t base;               // terminal: índice da chave
+    int32_t check;              // estado pai, FREE_CELL se livre
+} DATUnit;
+
+struct DoubleArrayTrie {
+    const DATUnit *units;
+    size_t num_units;
+    size_t size;
+    size_t max_length;
+    DATUnit *owned;             // array construído em memória
+    void *buffer;               // arquivo lido para a memória (sem mmap)
+    void *map;                  // região mapeada por datrie_mmap_open
+    size_t map_size;
+};
+
+// Estado da construção
+typedef struct {
+    DATUnit *units;
+    size_t capacity;
+    size_t used;                // 1 + maior célula ocupada
+    size_t next_check;          // início da busca por células livres
+} DATBuilder;
+
+// Nó pendente: chaves [lo, hi) compartilham depth bytes
+typedef struct {
+    int32_t state;
+    size_t lo;
+    size_t hi;
+    size_t depth;
+} DATFrame;
+
+// ============================================================================
+// CONSTRUÇÃO
+// ============================================================================
+
+static bool builder_reserve(DATBuilder *b, size_t needed) {
+    if (needed <= b->capacity) return true;
+    if (needed > (size_t)INT32_MAX) return false;
+    size_t capacity = b->capacity * 2;
+    if (capacity < needed) capacity = needed;
+    if (capacity > (size_t)INT32_MAX) capacity = (size_t)INT32_MAX;
+    DATUnit *units = (DATUnit*)realloc(b->units, capacity * sizeof(DATUnit));
+    if (units == NULL) return false;
+    for (size_t i = b->capacity; i < capacity; i++) {
+        units[i].base = 0;
+        units[i].check = FREE_CELL;
+    }
+    b->units = units;
+    b->capacity = capacity;
+    return true;
+}
+
+// Menor base a partir de next_check com as células base + codes[i] livres; -1 sem memória
+static int64_t find_base(DATBuilder *b, const unsigned char *codes, size_t num_codes) {
+    size_t start = b->next_check > (size_t)codes[0] + 1 ? b->next_check : (size_t)codes[0] + 1;
+    size_t occupied = 0;
+    for (size_t pos = start;; pos++) {
+        if (!builder_reserve(b, pos + 1)) return -1;
+        if (b->units[pos].check != FREE_CELL) {
+            occupied++;
+            continue;
+        }
+        size_t base = pos - codes[0];
+        if (!builder_reserve(b, base + codes[num_codes - 1] + 1)) return -1;
+        bool fits = true;
+        for (size_t i = 1; i < num_codes && fits; i++) {
+            fits = b->units[base + codes[i]].check == FREE_CELL;
+        }
+        if (fits) {
+            // Região varrida quase cheia: as próximas buscas começam depois dela
+            if ((double)occupied >= DENSE_REGION * (double)(pos - start + 1)) b->next_check = pos;
+            return (int64_t)base;
+        }
+    }
+}
+
+DoubleArrayTrie* datrie_from_sorted_array(const char *const *strings, size_t count) {
+    if (strings == NULL && count > 0) return NULL;
+
+    size_t max_length = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (strings[i] == NULL) return NULL;
+        if (i > 0 && strcmp(strings[i - 1], strings[i]) >= 0) return NULL;
+        size_t len = strlen(strings[i]);
+        if (len > max_length) max_length = len;
+    }
+    if (count > (size_t)INT32_MAX) return NULL;
+
+    DoubleArrayTrie *trie = (DoubleArrayTrie*)calloc(1, sizeof(DoubleArrayTrie));
+    DATBuilder b = {NULL, 0, 1, 1};
+    size_t stack_capacity = 64, top = 0;
+    DATFrame *stack = (DATFrame*)malloc(stack_capacity * sizeof(DATFrame));
+    bool ok = trie != NULL && stack != NULL && builder_reserve(&b, 256);
+    if (ok && count > 0) stack[top++] = (DATFrame){ROOT, 0, count, 0};
+
+    unsigned char codes[256];
+    size_t starts[257];
+    while (ok && top > 0) {
+        DATFrame f = stack[--top];
+
+        // Grupos de chaves com o mesmo byte na posição depth
+        size_t num_codes = 0;
+        for (size_t i = f.lo; i < f.hi; i++) {
+            unsigned char c = (unsigned char)strings[i][f.depth];
+            if (num_codes == 0 || codes[num_codes - 1] != c) {
+                codes[num_codes] = c;
+                starts[num_codes++] = i;
+            }
+        }
+        starts[num_codes] = f.hi;
+
+        int64_t base = find_base(&b, codes, num_codes);
+        if (base < 0) {
+            ok = false;
+            break;
+        }
+        b.units[f.state].base = (int32_t)base;
+        for (size_t k = 0; k < num_codes; k++) {
+            size_t t = (size_t)base + codes[k];
+            b.units[t].check = f.state;
+            if (t + 1 > b.used) b.used = t + 1;
+        }
+
+        // Filhos em ordem decrescente na pilha: o menor é construído primeiro
+        for (size_t k = num_codes; k-- > 0;) {
+            int32_t t = (int32_t)(base + codes[k]);
+            if (codes[k] == 0) {
+                b.units[t].base = (int32_t)starts[k];
+                continue;
+            }
+            if (top == stack_capacity) {
+                DATFrame *grown = (DATFrame*)realloc(stack, 2 * stack_capacity * sizeof(DATFrame));
+                if (grown == NULL) {
+                    ok = false;
+                    break;
+                }
+                stack = grown;
+                stack_capacity *= 2;
+            }
+            stack[top++] = (DATFrame){t, starts[k], starts[k + 1], f.depth + 1};
+        }
+    }
+    free(stack);
+
+    if (!ok) {
+        free(b.units);
+        free(trie);
+        return NULL;
+    }
+
+    // Devolve a folga do crescimento geométrico
+    DATUnit *units = (DATUnit*)realloc(b.units, b.used * sizeof(DATUnit));
+    trie->owned = units != NULL ? units : b.units;
+    trie->units = trie->owned;
+    trie->num_units = b.used;
+    trie->size = count;
+    trie->max_length = max_length;
+    return trie;
+}
+
+DoubleArrayTrie* datrie_from_trie(const Trie *trie) {
+    if (trie == NULL) return NULL;
+    char **strings = NULL;
+    size_t count = 0;
+    if (trie_to_array(trie, &strings, &count) != DS_SUCCESS) return NULL;
+    DoubleArrayTrie *result = datrie_from_sorted_array((const char *const *)strings, count);
+    for (size_t i = 0; i < count; i++) free(strings[i]);
+    free(strings);
+    return result;
+}
+
+void datrie_destroy(DoubleArrayTrie *trie) {
+    if (trie == NULL) return;
+    free(trie->owned);
+    free(trie->buffer);
+#if defined(DATRIE_USE_MMAP)
+    if (trie->map != NULL) munmap(trie->map, trie->map_size);
+#endif
+    free(trie);
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+// Transição de state pelo código c; -1 se não existir
+static inline int64_t transition(const DoubleArrayTrie *trie, int32_t state, unsigned char c) {
+    size_t t = (size_t)(uint32_t)trie->units[state].base + c;
+    if (t >= trie->num_units || trie->units[t].check != state) return -1;
+    return (int64_t)t;
+}
+
+// Estado após consumir prefix; -1 se o caminho não existir
+static int64_t walk(const DoubleArrayTrie *trie, const char *prefix) {
+    int32_t state = ROOT;
+    for (const unsigned char *p = (const unsigned char*)prefix; *p != '\0'; p++) {
+        int64_t t = transition(trie, state, *p);
+        if (t < 0) return -1;
+        state = (int32_t)t;
+    }
+    return state;
+}
+
+bool datrie_lookup(const DoubleArrayTrie *trie, const char *str, size_t *index) {
+    if (trie == NULL || str == NULL || trie->size == 0) return false;
+    int64_t state = walk(trie, str);
+    if (state < 0) return false;
+    int64_t t = transition(trie, (int32_t)state, 0);
+    if (t < 0) return false;
+    if (index != NULL) *index = (size_t)(uint32_t)trie->units[t].base;
+    return true;
+}
+
+bool datrie_search(const DoubleArrayTrie *trie, const char *str) {
+    return datrie_lookup(trie, str, NULL);
+}
+
+bool datrie_starts_with(const DoubleArrayTrie *trie, const char *prefix) {
+    if (trie == NULL || prefix == NULL || trie->size == 0) return false;
+    return walk(trie, prefix) >= 0;
+}
+
+typedef struct {
+    char **items;
+    size_t count;
+    size_t capacity;
+    bool failed;
+} StringList;
+
+static void string_list_push(StringList *list, const char *str, size_t len) {
+    if (list->failed) return;
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity == 0 ? 16 : list->capacity * 2;
+        char **items = (char**)realloc(list->items, capacity * sizeof(char*));
+        if (items == NULL) {
+            list->failed = true;
+            return;
+        }
+        list->items = items;
+        list->capacity = capacity;
+    }
+    char *copy = (char*)malloc(len + 1);
+    if (copy == NULL) {
+        list->failed = true;
+        return;
+    }
+    memcpy(copy, str, len);
+    copy[len] = '\0';
+    list->items[list->count++] = copy;
+}
+
+// Filhos em ordem crescente de código: o terminal (0) vem antes, como em strcmp
+static void collect(const DoubleArrayTrie *trie, int32_t state, char *buffer, size_t depth,
+                    StringList *list) {
+    for (unsigned c = 0; c < 256 && !list->failed; c++) {
+        int64_t t = transition(trie, state, (unsigned char)c);
+        if (t < 0) continue;
+        if (c == 0) {
+            string_list_push(list, buffer, depth);
+        } else if (depth < trie->max_length) {
+            buffer[depth] = (char)c;
+            collect(trie, (int32_t)t, buffer, depth + 1, list);
+        }
+    }
+}
+
+DataStructureError datrie_autocomplete(const DoubleArrayTrie *trie, const char *prefix,
+                                       char ***results, size_t *count) {
+    if (trie == NULL || prefix == NULL || results == NULL || count == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    *results = NULL;
+    *count = 0;
+
+    size_t prefix_len = strlen(prefix);
+    int64_t state = trie->size > 0 && prefix_len <= trie->max_length ? walk(trie, prefix) : -1;
+    if (state < 0) return DS_SUCCESS;
+
+    char *buffer = (char*)malloc(trie->max_length + 1);
+    if (buffer == NULL) return DS_ERROR_OUT_OF_MEMORY;
+    memcpy(buffer, prefix, prefix_len);
+
+    StringList list = {NULL, 0, 0, false};
+    collect(trie, (int32_t)state, buffer, prefix_len, &list);
+    free(buffer);
+
+    if (list.failed) {
+        for (size_t i = 0; i < list.count; i++) free(list.items[i]);
+        free(list.items);
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+    *results = list.items;
+    *count = list.count;
+    return DS_SUCCESS;
+}
+
+size_t datrie_size(const DoubleArrayTrie *trie) {
+    return trie != NULL ? trie->size : 0;
+}
+
+size_t datrie_memory_usage(const DoubleArrayTrie *trie) {
+    return trie != NULL ? trie->num_units * sizeof(DATUnit) : 0;
+}
+
+// ============================================================================
+// SERIALIZAÇÃO
+// ============================================================================
+
+// Tamanho do arquivo para o cabeçalho dado; 0 se não couber em size_t
+static size_t datrie_file_size(const DATFileHeader *header) {
+    const size_t limit = (SIZE_MAX - sizeof(DATFileHeader)) / sizeof(DATUnit);
+    if (header->num_units >= limit) return 0;
+    return sizeof(DATFileHeader) + (size_t)header->num_units * sizeof(DATUnit);
+}
+
+bool datrie_save(const DoubleArrayTrie *trie, const char *path) {
+    if (trie == NULL || path == NULL) return false;
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) return false;
+
+    DATFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, DATRIE_MAGIC, sizeof(header.magic));
+    header.version = DATRIE_VERSION;
+    header.byte_order = DATRIE_BYTE_ORDER;
+    header.num_keys = trie->size;
+    header.num_units = trie->num_units;
+    header.max_length = trie->max_length;
+
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              fwrite(trie->units, sizeof(DATUnit), trie->num_units, f) == trie->num_units;
+    if (fclose(f) != 0) ok = false;
+    if (!ok) remove(path);
+    return ok;
+}
+
+DoubleArrayTrie* datrie_from_buffer(const void *buffer, size_t size) {
+    if (buffer == NULL || size < sizeof(DATFileHeader)) return NULL;
+    if (((uintptr_t)buffer % sizeof(uint64_t)) != 0) return NULL;
+
+    DATFileHeader header;
+    memcpy(&header, buffer, sizeof(header));
+    if (memcmp(header.magic, DATRIE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != DATRIE_VERSION || header.byte_order != DATRIE_BYTE_ORDER ||
+        header.num_units == 0 || header.num_units > (uint64_t)INT32_MAX ||
+        header.num_keys > (uint64_t)INT32_MAX || header.max_length >= (uint64_t)SIZE_MAX ||
+        datrie_file_size(&header) != size) {
+        return NULL;
+    }
+
+    const DATUnit *units = (const DATUnit*)((const unsigned char*)buffer + sizeof(header));
+    if (units[ROOT].check != FREE_CELL) return NULL;
+
+    DoubleArrayTrie *trie = (DoubleArrayTrie*)calloc(1, sizeof(DoubleArrayTrie));
+    if (trie == NULL) return NULL;
+    trie->units = units;
+    trie->num_units = (size_t)header.num_units;
+    trie->size = (size_t)header.num_keys;
+    trie->max_length = (size_t)header.max_length;
+    return trie;
+}
+
+DoubleArrayTrie* datrie_mmap_open(const char *path) {
+    if (path == NULL) return NULL;
+
+#if defined(DATRIE_USE_MMAP)
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(DATFileHeader)) {
+        close(fd);
+        return NULL;
+    }
+    size_t size = (size_t)st.st_size;
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return NULL;
+
+    DoubleArrayTrie *trie = datrie_from_buffer(map, size);
+    if (trie == NULL) {
+        munmap(map, size);
+        return NULL;
+    }
+    trie->map = map;
+    trie->map_size = size;
+    return trie;
+#else
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return NULL;
+    DATFileHeader header;
+    size_t size = 0;
+    if (fread(&header, sizeof(header), 1, f) == 1) size = datrie_file_size(&header);
+    uint64_t *buffer = size > 0 ? (uint64_t*)malloc(size) : NULL;
+    bool ok = buffer != NULL;
+    if (ok) {
+        memcpy(buffer, &header, sizeof(header));
+        size_t rest = size - sizeof(header);
+        ok = fread((unsigned char*)buffer + sizeof(header), 1, rest, f) == rest && fgetc(f) == EOF;
+    }
+    fclose(f);
+    DoubleArrayTrie *trie = ok ? datrie_from_buffer(buffer, size) : NULL;
+    if (trie == NULL) {
+        free(buffer);
+        return NULL;
+    }
+    trie->buffer = buffer;
+    return trie;
+#endif
+}
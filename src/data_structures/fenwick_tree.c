@@ -0,0 +1,182 @@
+/**
+ * @file fenwick_tree.c
+ * @brief Implementação da Fenwick tree (Binary Indexed Tree)
+ *
+ * O array interno é base 1: tree[i] = soma de values[i - (i & -i), i).
+ * - Atualização em i: sobe por i += i & -i
+ * - Prefixo até i: desce por i -= i & -i
+ * - Construção O(n): cada posição repassa sua soma ao pai i + (i & -i)
+ *
+ * Referências:
+ * - Fenwick, P. M. (1994). "A New Data Structure for Cumulative Frequency
+ *   Tables". Software: Practice and Experience 24(3): 327–336
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/fenwick_tree.h"
+
+#include <string.h>
+
+// ============================================================================
+// ESTRUTURA INTERNA
+// ============================================================================
+
+struct FenwickTree {
+    int64_t *tree;          // n + 1 posições, tree[0] não usado
+    size_t n;
+    size_t top_bit;         // maior potência de 2 <= n (para lower_bound)
+    DSAllocator allocator;
+};
+
+static inline size_t lowbit(size_t i) {
+    return i & (~i + 1);
+}
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+FenwickTree* fenwick_create(const int64_t *values, size_t n) {
+    return fenwick_create_with_allocator(values, n, NULL);
+}
+
+FenwickTree* fenwick_create_with_allocator(const int64_t *values, size_t n,
+                                           const DSAllocator *allocator) {
+    if (n == 0 || n > SIZE_MAX / sizeof(int64_t) - 1) {
+        return NULL;
+    }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
+
+    FenwickTree *tree = (FenwickTree *)ds_alloc(allocator, sizeof(FenwickTree));
+    if (tree == NULL) {
+        return NULL;
+    }
+    tree->tree = (int64_t *)ds_calloc(allocator, n + 1, sizeof(int64_t));
+    if (tree->tree == NULL) {
+        ds_free(allocator, tree, sizeof(FenwickTree));
+        return NULL;
+    }
+
+    tree->n = n;
+    tree->allocator = *allocator;
+    tree->top_bit = 1;
+    while (tree->top_bit <= n / 2) {
+        tree->top_bit *= 2;
+    }
+
+    if (values != NULL) {
+        memcpy(tree->tree + 1, values, n * sizeof(int64_t));
+        for (size_t i = 1; i <= n; i++) {
+            size_t parent = i + lowbit(i);
+            if (parent <= n) {
+                tree->tree[parent] += tree->tree[i];
+            }
+        }
+    }
+    return tree;
+}
+
+void fenwick_destroy(FenwickTree *tree) {
+    if (tree == NULL) {
+        return;
+    }
+
+    DSAllocator allocator = tree->allocator;
+    ds_free(&allocator, tree->tree, (tree->n + 1) * sizeof(int64_t));
+    ds_free(&allocator, tree, sizeof(FenwickTree));
+}
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+DataStructureError fenwick_add(FenwickTree *tree, size_t index, int64_t delta) {
+    if (tree == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (index >= tree->n) {
+        return DS_ERROR_INVALID_INDEX;
+    }
+
+    for (size_t i = index + 1; i <= tree->n; i += lowbit(i)) {
+        tree->tree[i] += delta;
+    }
+    return DS_SUCCESS;
+}
+
+DataStructureError fenwick_set(FenwickTree *tree, size_t index, int64_t value) {
+    if (tree == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (index >= tree->n) {
+        return DS_ERROR_INVALID_INDEX;
+    }
+    return fenwick_add(tree, index, value - fenwick_get(tree, index));
+}
+
+int64_t fenwick_get(const FenwickTree *tree, size_t index) {
+    if (tree == NULL || index >= tree->n) {
+        return 0;
+    }
+
+    // tree[i] cobre [i - lowbit(i), i): subtrai os nós que descem até lá
+    size_t i = index + 1;
+    size_t stop = i - lowbit(i);
+    int64_t value = tree->tree[i];
+    for (size_t j = i - 1; j > stop; j -= lowbit(j)) {
+        value -= tree->tree[j];
+    }
+    return value;
+}
+
+int64_t fenwick_prefix_sum(const FenwickTree *tree, size_t count) {
+    if (tree == NULL) {
+        return 0;
+    }
+    if (count > tree->n) {
+        count = tree->n;
+    }
+
+    int64_t sum = 0;
+    for (size_t i = count; i > 0; i -= lowbit(i)) {
+        sum += tree->tree[i];
+    }
+    return sum;
+}
+
+int64_t fenwick_range_sum(const FenwickTree *tree, size_t lo, size_t hi) {
+    if (lo >= hi) {
+        return 0;
+    }
+    return fenwick_prefix_sum(tree, hi) - fenwick_prefix_sum(tree, lo);
+}
+
+size_t fenwick_lower_bound(const FenwickTree *tree, int64_t target) {
+    if (tree == NULL) {
+        return 0;
+    }
+
+    // Desce pelos bits: pos é o maior prefixo com soma < target
+    size_t pos = 0;
+    int64_t remaining = target;
+    for (size_t step = tree->top_bit; step > 0; step /= 2) {
+        size_t next = pos + step;
+        if (next <= tree->n && tree->tree[next] < remaining) {
+            pos = next;
+            remaining -= tree->tree[next];
+        }
+    }
+    return pos;
+}
+
+size_t fenwick_size(const FenwickTree *tree) {
+    return tree ? tree->n : 0;
+}
+
+size_t fenwick_memory_usage(const FenwickTree *tree) {
+    return tree ? sizeof(FenwickTree) + (tree->n + 1) * sizeof(int64_t) : 0;
+}
@@ -10,14 +10,28 @@
  * @date 2025
  */
 
+// mmap/munmap (POSIX) com CMAKE_C_EXTENSIONS OFF
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "data_structures/graph.h"
 #include "data_structures/queue.h"
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <float.h>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define GRAPH_USE_MMAP 1
+#endif
+
 // ============================================================================
 // ESTRUTURAS INTERNAS
 // ============================================================================
@@ -25,6 +39,22 @@
 #define NO_EDGE 0.0
 #define DEFAULT_WEIGHT 1.0
 
+#define CSR_MAGIC "GRAPHCSR"
+#define CSR_BYTE_ORDER 0x01020304u
+#define CSR_VERSION 1u
+
+// Cabeçalho do arquivo CSR: 48 bytes, os três arrays começam alinhados a 8
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t type;
+    uint32_t index_size;        // sizeof(size_t) de quem gravou
+    uint64_t num_vertices;
+    uint64_t num_edges;
+    uint64_t num_arcs;
+} CSRFileHeader;
+
 typedef struct AdjNode {
     Vertex dest;
     double weight;
@@ -40,14 +70,30 @@ struct Graph {
     bool weighted;
     AdjNode **adj_list;
     double **adj_matrix;
+    uint64_t *adj_bits;     // bitset: capacity linhas de words palavras
+    size_t words;
+    DSAllocator allocator;
+};
+
+struct CSRGraph {
+    size_t num_vertices;
+    size_t num_edges;
+    GraphType type;
+    size_t *offsets;
+    Vertex *dest;
+    double *weight;
+    bool view;                  // arrays apontam para um arquivo serializado
+    void *buffer;               // arquivo lido para a memória (sem mmap)
+    void *map;                  // região mapeada por graph_mmap_open
+    size_t map_size;
 };
 
 // ============================================================================
 // HELPERS INTERNOS
 // ============================================================================
 
-static AdjNode* create_adj_node(Vertex dest, double weight) {
-    AdjNode *node = (AdjNode*)malloc(sizeof(AdjNode));
+static AdjNode* create_adj_node(Graph *graph, Vertex dest, double weight) {
+    AdjNode *node = (AdjNode*)ds_alloc(&graph->allocator, sizeof(AdjNode));
     if (node == NULL) return NULL;
     node->dest = dest;
     node->weight = weight;
@@ -55,37 +101,72 @@ static AdjNode* create_adj_node(Vertex dest, double weight) {
     return node;
 }
 
-static double** alloc_matrix(size_t n) {
-    double **matrix = (double**)calloc(n, sizeof(double*));
+static void free_adj_node(Graph *graph, AdjNode *node) {
+    ds_free(&graph->allocator, node, sizeof(AdjNode));
+}
+
+static double** alloc_matrix(const DSAllocator *allocator, size_t n) {
+    double **matrix = (double**)ds_calloc(allocator, n, sizeof(double*));
     if (matrix == NULL) return NULL;
     for (size_t i = 0; i < n; i++) {
-        matrix[i] = (double*)calloc(n, sizeof(double));
+        matrix[i] = (double*)ds_calloc(allocator, n, sizeof(double));
         if (matrix[i] == NULL) {
-            for (size_t j = 0; j < i; j++) free(matrix[j]);
-            free(matrix);
+            for (size_t j = 0; j < i; j++) ds_free(allocator, matrix[j], n * sizeof(double));
+            ds_free(allocator, matrix, n * sizeof(double*));
             return NULL;
         }
     }
     return matrix;
 }
 
-static void free_matrix(double **matrix, size_t n) {
+static void free_matrix(const DSAllocator *allocator, double **matrix, size_t n) {
     if (matrix == NULL) return;
-    for (size_t i = 0; i < n; i++) free(matrix[i]);
-    free(matrix);
+    for (size_t i = 0; i < n; i++) ds_free(allocator, matrix[i], n * sizeof(double));
+    ds_free(allocator, matrix, n * sizeof(double*));
 }
 
-static void free_adj_list(AdjNode **list, size_t n) {
-    if (list == NULL) return;
-    for (size_t i = 0; i < n; i++) {
-        AdjNode *curr = list[i];
+static size_t bits_words(size_t capacity) {
+    return (capacity + 63) / 64;
+}
+
+// Linhas de um bitset com capacity linhas (pelo menos uma palavra alocada)
+static uint64_t* alloc_bits(const DSAllocator *allocator, size_t capacity) {
+    size_t count = capacity * bits_words(capacity);
+    return (uint64_t*)ds_calloc(allocator, count > 0 ? count : 1, sizeof(uint64_t));
+}
+
+static void free_bits(Graph *graph) {
+    size_t count = graph->capacity * graph->words;
+    ds_free(&graph->allocator, graph->adj_bits, (count > 0 ? count : 1) * sizeof(uint64_t));
+}
+
+static uint64_t* bits_row(const Graph *graph, Vertex u) {
+    return graph->adj_bits + u * graph->words;
+}
+
+static bool bits_test(const Graph *graph, Vertex u, Vertex v) {
+    return (bits_row(graph, u)[v / 64] >> (v % 64)) & 1u;
+}
+
+static void bits_set(Graph *graph, Vertex u, Vertex v) {
+    bits_row(graph, u)[v / 64] |= (uint64_t)1 << (v % 64);
+}
+
+static void bits_clear(Graph *graph, Vertex u, Vertex v) {
+    bits_row(graph, u)[v / 64] &= ~((uint64_t)1 << (v % 64));
+}
+
+static void free_adj_list(Graph *graph) {
+    if (graph->adj_list == NULL) return;
+    for (size_t i = 0; i < graph->capacity; i++) {
+        AdjNode *curr = graph->adj_list[i];
         while (curr != NULL) {
             AdjNode *tmp = curr;
             curr = curr->next;
-            free(tmp);
+            free_adj_node(graph, tmp);
         }
     }
-    free(list);
+    ds_free(&graph->allocator, graph->adj_list, graph->capacity * sizeof(AdjNode*));
 }
 
 // ============================================================================
@@ -94,9 +175,19 @@ static void free_adj_list(AdjNode **list, size_t n) {
 
 Graph* graph_create(size_t num_vertices, GraphType type,
                     GraphRepresentation representation, bool weighted) {
-    Graph *g = (Graph*)malloc(sizeof(Graph));
+    return graph_create_with_allocator(num_vertices, type, representation,
+                                       weighted, NULL);
+}
+
+Graph* graph_create_with_allocator(size_t num_vertices, GraphType type,
+                                   GraphRepresentation representation, bool weighted,
+                                   const DSAllocator *allocator) {
+    if (allocator == NULL) allocator = ds_default_allocator();
+
+    Graph *g = (Graph*)ds_alloc(allocator, sizeof(Graph));
     if (g == NULL) return NULL;
 
+    g->allocator = *allocator;
     g->num_vertices = num_vertices;
     g->num_edges = 0;
     g->capacity = num_vertices;
@@ -105,17 +196,25 @@ Graph* graph_create(size_t num_vertices, GraphType type,
     g->weighted = weighted;
     g->adj_list = NULL;
     g->adj_matrix = NULL;
+    g->adj_bits = NULL;
+    g->words = bits_words(num_vertices);
 
     if (representation == GRAPH_ADJACENCY_LIST) {
-        g->adj_list = (AdjNode**)calloc(num_vertices, sizeof(AdjNode*));
+        g->adj_list = (AdjNode**)ds_calloc(allocator, num_vertices, sizeof(AdjNode*));
         if (g->adj_list == NULL) {
-            free(g);
+            ds_free(allocator, g, sizeof(Graph));
+            return NULL;
+        }
+    } else if (representation == GRAPH_ADJACENCY_BITSET) {
+        g->adj_bits = weighted ? NULL : alloc_bits(allocator, num_vertices);
+        if (g->adj_bits == NULL) {
+            ds_free(allocator, g, sizeof(Graph));
             return NULL;
         }
     } else {
-        g->adj_matrix = alloc_matrix(num_vertices);
+        g->adj_matrix = alloc_matrix(allocator, num_vertices);
         if (g->adj_matrix == NULL) {
-            free(g);
+            ds_free(allocator, g, sizeof(Graph));
             return NULL;
         }
     }
@@ -127,12 +226,15 @@ void graph_destroy(Graph *graph) {
     if (graph == NULL) return;
 
     if (graph->representation == GRAPH_ADJACENCY_LIST) {
-        free_adj_list(graph->adj_list, graph->capacity);
+        free_adj_list(graph);
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        free_bits(graph);
     } else {
-        free_matrix(graph->adj_matrix, graph->capacity);
+        free_matrix(&graph->allocator, graph->adj_matrix, graph->capacity);
     }
 
-    free(graph);
+    DSAllocator allocator = graph->allocator;
+    ds_free(&allocator, graph, sizeof(Graph));
 }
 
 // ============================================================================
@@ -148,17 +250,29 @@ Vertex graph_add_vertex(Graph *graph) {
         size_t new_cap = graph->capacity == 0 ? 4 : graph->capacity * 2;
 
         if (graph->representation == GRAPH_ADJACENCY_LIST) {
-            AdjNode **new_list = (AdjNode**)realloc(graph->adj_list, new_cap * sizeof(AdjNode*));
+            AdjNode **new_list = (AdjNode**)ds_realloc(&graph->allocator, graph->adj_list,
+                                                       graph->capacity * sizeof(AdjNode*),
+                                                       new_cap * sizeof(AdjNode*));
             if (new_list == NULL) return (Vertex)-1;
             memset(new_list + graph->capacity, 0, (new_cap - graph->capacity) * sizeof(AdjNode*));
             graph->adj_list = new_list;
+        } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+            uint64_t *new_bits = alloc_bits(&graph->allocator, new_cap);
+            if (new_bits == NULL) return (Vertex)-1;
+            size_t new_words = bits_words(new_cap);
+            for (size_t i = 0; i < graph->num_vertices; i++) {
+                memcpy(new_bits + i * new_words, bits_row(graph, i), graph->words * sizeof(uint64_t));
+            }
+            free_bits(graph);
+            graph->adj_bits = new_bits;
+            graph->words = new_words;
         } else {
-            double **new_matrix = alloc_matrix(new_cap);
+            double **new_matrix = alloc_matrix(&graph->allocator, new_cap);
             if (new_matrix == NULL) return (Vertex)-1;
             for (size_t i = 0; i < graph->num_vertices; i++) {
                 memcpy(new_matrix[i], graph->adj_matrix[i], graph->num_vertices * sizeof(double));
             }
-            free_matrix(graph->adj_matrix, graph->capacity);
+            free_matrix(&graph->allocator, graph->adj_matrix, graph->capacity);
             graph->adj_matrix = new_matrix;
         }
 
@@ -186,7 +300,7 @@ DataStructureError graph_remove_vertex(Graph *graph, Vertex v) {
                     if (node->dest == v) {
                         if (prev == NULL) *head = node->next;
                         else prev->next = node->next;
-                        free(node);
+                        free_adj_node(graph, node);
                         break;
                     }
                     prev = node;
@@ -194,7 +308,7 @@ DataStructureError graph_remove_vertex(Graph *graph, Vertex v) {
                 }
             }
             graph->num_edges--;
-            free(tmp);
+            free_adj_node(graph, tmp);
         }
         graph->adj_list[v] = NULL;
 
@@ -209,7 +323,7 @@ DataStructureError graph_remove_vertex(Graph *graph, Vertex v) {
                     else prev->next = node->next;
                     AdjNode *tmp = node;
                     node = node->next;
-                    free(tmp);
+                    free_adj_node(graph, tmp);
                     if (graph->type == GRAPH_DIRECTED) graph->num_edges--;
                     continue;
                 }
@@ -217,6 +331,18 @@ DataStructureError graph_remove_vertex(Graph *graph, Vertex v) {
                 node = node->next;
             }
         }
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        uint64_t *row = bits_row(graph, v);
+        for (size_t w = 0; w < graph->words; w++) {
+            graph->num_edges -= (size_t)__builtin_popcountll(row[w]);
+            row[w] = 0;
+        }
+        for (size_t i = 0; i < graph->num_vertices; i++) {
+            if (i != v && bits_test(graph, i, v)) {
+                bits_clear(graph, i, v);
+                if (graph->type == GRAPH_DIRECTED) graph->num_edges--;
+            }
+        }
     } else {
         for (size_t i = 0; i < graph->num_vertices; i++) {
             if (graph->adj_matrix[v][i] != NO_EDGE) {
@@ -266,17 +392,22 @@ DataStructureError graph_add_edge(Graph *graph, Vertex src, Vertex dest, double
             curr = curr->next;
         }
 
-        AdjNode *node = create_adj_node(dest, weight);
+        AdjNode *node = create_adj_node(graph, dest, weight);
         if (node == NULL) return DS_ERROR_OUT_OF_MEMORY;
         node->next = graph->adj_list[src];
         graph->adj_list[src] = node;
 
-        if (graph->type == GRAPH_UNDIRECTED) {
-            AdjNode *rev = create_adj_node(src, weight);
+        // Auto-laco nao direcionado ocupa uma unica entrada (como na matriz)
+        if (graph->type == GRAPH_UNDIRECTED && src != dest) {
+            AdjNode *rev = create_adj_node(graph, src, weight);
             if (rev == NULL) return DS_ERROR_OUT_OF_MEMORY;
             rev->next = graph->adj_list[dest];
             graph->adj_list[dest] = rev;
         }
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        if (bits_test(graph, src, dest)) return DS_SUCCESS;
+        bits_set(graph, src, dest);
+        if (graph->type == GRAPH_UNDIRECTED) bits_set(graph, dest, src);
     } else {
         graph->adj_matrix[src][dest] = weight;
         if (graph->type == GRAPH_UNDIRECTED)
@@ -302,7 +433,7 @@ DataStructureError graph_remove_edge(Graph *graph, Vertex src, Vertex dest) {
             if (curr->dest == dest) {
                 if (prev == NULL) *head = curr->next;
                 else prev->next = curr->next;
-                free(curr);
+                free_adj_node(graph, curr);
                 found = true;
                 break;
             }
@@ -320,13 +451,17 @@ DataStructureError graph_remove_edge(Graph *graph, Vertex src, Vertex dest) {
                 if (curr->dest == src) {
                     if (prev == NULL) *head = curr->next;
                     else prev->next = curr->next;
-                    free(curr);
+                    free_adj_node(graph, curr);
                     break;
                 }
                 prev = curr;
                 curr = curr->next;
             }
         }
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        if (!bits_test(graph, src, dest)) return DS_ERROR_NOT_FOUND;
+        bits_clear(graph, src, dest);
+        if (graph->type == GRAPH_UNDIRECTED) bits_clear(graph, dest, src);
     } else {
         if (graph->adj_matrix[src][dest] == NO_EDGE) return DS_ERROR_NOT_FOUND;
         graph->adj_matrix[src][dest] = NO_EDGE;
@@ -349,6 +484,8 @@ bool graph_has_edge(const Graph *graph, Vertex src, Vertex dest) {
             curr = curr->next;
         }
         return false;
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        return bits_test(graph, src, dest);
     } else {
         return graph->adj_matrix[src][dest] != NO_EDGE;
     }
@@ -365,6 +502,8 @@ double graph_edge_weight(const Graph *graph, Vertex src, Vertex dest) {
             curr = curr->next;
         }
         return 0.0;
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        return bits_test(graph, src, dest) ? DEFAULT_WEIGHT : NO_EDGE;
     } else {
         return graph->adj_matrix[src][dest];
     }
@@ -374,6 +513,26 @@ size_t graph_num_edges(const Graph *graph) {
     if (graph == NULL) return 0;
     return graph->num_edges;
 }
+size_t graph_memory_usage(const Graph *graph) {
+    if (graph == NULL) return 0;
+
+    size_t bytes = sizeof(Graph);
+    if (graph->representation == GRAPH_ADJACENCY_LIST) {
+        bytes += graph->capacity * sizeof(AdjNode*);
+        for (size_t u = 0; u < graph->num_vertices; u++) {
+            for (const AdjNode *curr = graph->adj_list[u]; curr != NULL; curr = curr->next) {
+                bytes += sizeof(AdjNode);
+            }
+        }
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        size_t count = graph->capacity * graph->words;
+        bytes += (count > 0 ? count : 1) * sizeof(uint64_t);
+    } else {
+        bytes += graph->capacity * (sizeof(double*) + graph->capacity * sizeof(double));
+    }
+    return bytes;
+}
+
 // ============================================================================
 // GRAU DOS VERTICES
 // ============================================================================
@@ -389,6 +548,11 @@ size_t graph_out_degree(const Graph *graph, Vertex v) {
             curr = curr->next;
         }
         return count;
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        size_t count = 0;
+        const uint64_t *row = bits_row(graph, v);
+        for (size_t w = 0; w < graph->words; w++) count += (size_t)__builtin_popcountll(row[w]);
+        return count;
     } else {
         size_t count = 0;
         for (size_t i = 0; i < graph->num_vertices; i++) {
@@ -413,6 +577,10 @@ size_t graph_in_degree(const Graph *graph, Vertex v) {
             }
         }
         return count;
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        size_t count = 0;
+        for (size_t i = 0; i < graph->num_vertices; i++) count += bits_test(graph, i, v);
+        return count;
     } else {
         size_t count = 0;
         for (size_t i = 0; i < graph->num_vertices; i++) {
@@ -457,10 +625,9 @@ DataStructureError graph_neighbors(const Graph *graph, Vertex v,
             curr = curr->next;
         }
     } else {
-        for (size_t i = 0; i < graph->num_vertices; i++) {
-            if (graph->adj_matrix[v][i] != NO_EDGE)
-                (*neighbors)[idx++] = i;
-        }
+        GraphNeighborIter it;
+        graph_neighbor_iter_begin(graph, v, &it);
+        while (graph_neighbor_iter_next(&it, &(*neighbors)[idx], NULL)) idx++;
     }
 
     return DS_SUCCESS;
@@ -493,6 +660,19 @@ DataStructureError graph_edges(const Graph *graph, Edge **edges, size_t *count)
                 curr = curr->next;
             }
         }
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        for (size_t i = 0; i < graph->num_vertices; i++) {
+            GraphNeighborIter it;
+            Vertex j;
+            graph_neighbor_iter_begin(graph, i, &it);
+            if (graph->type == GRAPH_UNDIRECTED) it.column = i;
+            while (graph_neighbor_iter_next(&it, &j, NULL)) {
+                (*edges)[idx].src = i;
+                (*edges)[idx].dest = j;
+                (*edges)[idx].weight = DEFAULT_WEIGHT;
+                idx++;
+            }
+        }
     } else {
         for (size_t i = 0; i < graph->num_vertices; i++) {
             size_t start = (graph->type == GRAPH_UNDIRECTED) ? i : 0;
@@ -511,6 +691,70 @@ DataStructureError graph_edges(const Graph *graph, Edge **edges, size_t *count)
     return DS_SUCCESS;
 }
 
+DataStructureError graph_neighbor_iter_begin(const Graph *graph, Vertex v,
+                                             GraphNeighborIter *it) {
+    if (it == NULL) return DS_ERROR_NULL_POINTER;
+
+    it->graph = graph;
+    it->source = v;
+    it->node = NULL;
+    it->column = 0;
+
+    if (graph == NULL) return DS_ERROR_NULL_POINTER;
+    if (v >= graph->num_vertices) {
+        it->graph = NULL;
+        return DS_ERROR_INVALID_INDEX;
+    }
+
+    if (graph->representation == GRAPH_ADJACENCY_LIST)
+        it->node = graph->adj_list[v];
+    return DS_SUCCESS;
+}
+
+bool graph_neighbor_iter_next(GraphNeighborIter *it, Vertex *dest, double *weight) {
+    if (it == NULL || it->graph == NULL) return false;
+    const Graph *graph = it->graph;
+
+    if (graph->representation == GRAPH_ADJACENCY_LIST) {
+        const AdjNode *node = (const AdjNode*)it->node;
+        if (node == NULL) return false;
+        if (dest != NULL) *dest = node->dest;
+        if (weight != NULL) *weight = node->weight;
+        it->node = node->next;
+        return true;
+    }
+
+    if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        // Pula 64 colunas por palavra vazia; ctz acha o próximo bit
+        const uint64_t *bits = bits_row(graph, it->source);
+        size_t j = it->column;
+        while (j < graph->num_vertices) {
+            uint64_t word = bits[j / 64] >> (j % 64);
+            if (word != 0) {
+                j += (size_t)__builtin_ctzll(word);
+                it->column = j + 1;
+                if (dest != NULL) *dest = j;
+                if (weight != NULL) *weight = DEFAULT_WEIGHT;
+                return true;
+            }
+            j = (j / 64 + 1) * 64;
+        }
+        it->column = graph->num_vertices;
+        return false;
+    }
+
+    const double *row = graph->adj_matrix[it->source];
+    while (it->column < graph->num_vertices) {
+        size_t j = it->column++;
+        if (row[j] != NO_EDGE) {
+            if (dest != NULL) *dest = j;
+            if (weight != NULL) *weight = row[j];
+            return true;
+        }
+    }
+    return false;
+}
+
 // ============================================================================
 // TRAVESSIAS - BFS
 // ============================================================================
@@ -535,22 +779,13 @@ void graph_bfs(const Graph *graph, Vertex start, VertexVisitFn visit, void *user
         queue_dequeue(queue, &u);
         visit(u, user_data);
 
-        if (graph->representation == GRAPH_ADJACENCY_LIST) {
-            AdjNode *curr = graph->adj_list[u];
-            while (curr != NULL) {
-                if (!visited[curr->dest]) {
-                    visited[curr->dest] = true;
-                    queue_enqueue(queue, &curr->dest);
-                }
-                curr = curr->next;
-            }
-        } else {
-            for (size_t i = 0; i < graph->num_vertices; i++) {
-                if (graph->adj_matrix[u][i] != NO_EDGE && !visited[i]) {
-                    visited[i] = true;
-                    Vertex vi = i;
-                    queue_enqueue(queue, &vi);
-                }
+        GraphNeighborIter it;
+        Vertex w;
+        graph_neighbor_iter_begin(graph, u, &it);
+        while (graph_neighbor_iter_next(&it, &w, NULL)) {
+            if (!visited[w]) {
+                visited[w] = true;
+                queue_enqueue(queue, &w);
             }
         }
     }
@@ -568,18 +803,12 @@ static void dfs_visit(const Graph *graph, Vertex u, bool *visited,
     visited[u] = true;
     if (visit != NULL) visit(u, user_data);
 
-    if (graph->representation == GRAPH_ADJACENCY_LIST) {
-        AdjNode *curr = graph->adj_list[u];
-        while (curr != NULL) {
-            if (!visited[curr->dest])
-                dfs_visit(graph, curr->dest, visited, visit, user_data);
-            curr = curr->next;
-        }
-    } else {
-        for (size_t i = 0; i < graph->num_vertices; i++) {
-            if (graph->adj_matrix[u][i] != NO_EDGE && !visited[i])
-                dfs_visit(graph, i, visited, visit, user_data);
-        }
+    GraphNeighborIter it;
+    Vertex w;
+    graph_neighbor_iter_begin(graph, u, &it);
+    while (graph_neighbor_iter_next(&it, &w, NULL)) {
+        if (!visited[w])
+            dfs_visit(graph, w, visited, visit, user_data);
     }
 }
 
@@ -593,6 +822,42 @@ void graph_dfs(const Graph *graph, Vertex start, VertexVisitFn visit, void *user
 
     free(visited);
 }
+
+#define DFS_WHITE 0
+#define DFS_GRAY 1
+#define DFS_BLACK 2
+
+/**
+ * DFS iterativa a partir de root com pilha explícita de iteradores (um por
+ * nível, n no máximo): sem recursão, não estoura a pilha em grafos grandes.
+ * Vértices terminados vão para out[(*idx)++] (pós-ordem; out pode ser NULL).
+ * Com stop_at_gray, retorna true e para ao achar arco para um vértice
+ * cinza (ciclo dirigido).
+ */
+static bool dfs_postorder(const Graph *graph, Vertex root, unsigned char *state,
+                          GraphNeighborIter *iters, Vertex *out, size_t *idx,
+                          bool stop_at_gray) {
+    size_t top = 0;
+    state[root] = DFS_GRAY;
+    graph_neighbor_iter_begin(graph, root, &iters[top++]);
+
+    while (top > 0) {
+        GraphNeighborIter *it = &iters[top - 1];
+        Vertex w;
+        if (!graph_neighbor_iter_next(it, &w, NULL)) {
+            state[it->source] = DFS_BLACK;
+            if (out != NULL) out[(*idx)++] = it->source;
+            top--;
+            continue;
+        }
+        if (state[w] == DFS_GRAY && stop_at_gray) return true;
+        if (state[w] == DFS_WHITE) {
+            state[w] = DFS_GRAY;
+            graph_neighbor_iter_begin(graph, w, &iters[top++]);
+        }
+    }
+    return false;
+}
 // ============================================================================
 // PROPRIEDADES DO GRAFO
 // ============================================================================
@@ -627,10 +892,12 @@ bool graph_is_connected(const Graph *graph) {
                 curr = curr->next;
             }
         } else {
-            for (size_t i = 0; i < graph->num_vertices; i++) {
-                if (graph->adj_matrix[u][i] != NO_EDGE && !visited[i]) {
-                    visited[i] = true;
-                    Vertex vi = i;
+            GraphNeighborIter it;
+            Vertex vi;
+            graph_neighbor_iter_begin(graph, u, &it);
+            while (graph_neighbor_iter_next(&it, &vi, NULL)) {
+                if (!visited[vi]) {
+                    visited[vi] = true;
                     queue_enqueue(queue, &vi);
                 }
             }
@@ -670,10 +937,12 @@ bool graph_is_strongly_connected(const Graph *graph) {
                 curr = curr->next;
             }
         } else {
-            for (size_t i = 0; i < graph->num_vertices; i++) {
-                if (graph->adj_matrix[u][i] != NO_EDGE && !visited[i]) {
-                    visited[i] = true;
-                    Vertex vi = i;
+            GraphNeighborIter it;
+            Vertex vi;
+            graph_neighbor_iter_begin(graph, u, &it);
+            while (graph_neighbor_iter_next(&it, &vi, NULL)) {
+                if (!visited[vi]) {
+                    visited[vi] = true;
                     queue_enqueue(queue, &vi);
                 }
             }
@@ -709,10 +978,12 @@ bool graph_is_strongly_connected(const Graph *graph) {
                 curr = curr->next;
             }
         } else {
-            for (size_t i = 0; i < t->num_vertices; i++) {
-                if (t->adj_matrix[u][i] != NO_EDGE && !visited[i]) {
-                    visited[i] = true;
-                    Vertex vi = i;
+            GraphNeighborIter it;
+            Vertex vi;
+            graph_neighbor_iter_begin(t, u, &it);
+            while (graph_neighbor_iter_next(&it, &vi, NULL)) {
+                if (!visited[vi]) {
+                    visited[vi] = true;
                     queue_enqueue(queue, &vi);
                 }
             }
@@ -725,31 +996,6 @@ bool graph_is_strongly_connected(const Graph *graph) {
     return count == graph->num_vertices;
 }
 
-static bool has_cycle_directed_dfs(const Graph *graph, Vertex u, int *color) {
-    color[u] = 1; // GRAY
-
-    if (graph->representation == GRAPH_ADJACENCY_LIST) {
-        AdjNode *curr = graph->adj_list[u];
-        while (curr != NULL) {
-            if (color[curr->dest] == 1) return true;
-            if (color[curr->dest] == 0 && has_cycle_directed_dfs(graph, curr->dest, color))
-                return true;
-            curr = curr->next;
-        }
-    } else {
-        for (size_t i = 0; i < graph->num_vertices; i++) {
-            if (graph->adj_matrix[u][i] != NO_EDGE) {
-                if (color[i] == 1) return true;
-                if (color[i] == 0 && has_cycle_directed_dfs(graph, i, color))
-                    return true;
-            }
-        }
-    }
-
-    color[u] = 2; // BLACK
-    return false;
-}
-
 static bool has_cycle_undirected_dfs(const Graph *graph, Vertex u,
                                      bool *visited, Vertex parent) {
     visited[u] = true;
@@ -766,14 +1012,15 @@ static bool has_cycle_undirected_dfs(const Graph *graph, Vertex u,
             curr = curr->next;
         }
     } else {
-        for (size_t i = 0; i < graph->num_vertices; i++) {
-            if (graph->adj_matrix[u][i] != NO_EDGE) {
-                if (!visited[i]) {
-                    if (has_cycle_undirected_dfs(graph, i, visited, u))
-                        return true;
-                } else if (i != parent) {
+        GraphNeighborIter it;
+        Vertex i;
+        graph_neighbor_iter_begin(graph, u, &it);
+        while (graph_neighbor_iter_next(&it, &i, NULL)) {
+            if (!visited[i]) {
+                if (has_cycle_undirected_dfs(graph, i, visited, u))
                     return true;
-                }
+            } else if (i != parent) {
+                return true;
             }
         }
     }
@@ -785,19 +1032,17 @@ bool graph_has_cycle(const Graph *graph) {
     if (graph == NULL || graph->num_vertices == 0) return false;
 
     if (graph->type == GRAPH_DIRECTED) {
-        int *color = (int*)calloc(graph->num_vertices, sizeof(int));
-        if (color == NULL) return false;
-
-        for (size_t i = 0; i < graph->num_vertices; i++) {
-            if (color[i] == 0) {
-                if (has_cycle_directed_dfs(graph, i, color)) {
-                    free(color);
-                    return true;
-                }
-            }
+        unsigned char *state = (unsigned char*)calloc(graph->num_vertices, 1);
+        GraphNeighborIter *iters = (GraphNeighborIter*)malloc(graph->num_vertices *
+                                                              sizeof(GraphNeighborIter));
+        bool found = false;
+        for (size_t i = 0; state != NULL && iters != NULL && !found && i < graph->num_vertices; i++) {
+            if (state[i] == DFS_WHITE)
+                found = dfs_postorder(graph, i, state, iters, NULL, NULL, true);
         }
-        free(color);
-        return false;
+        free(state);
+        free(iters);
+        return found;
     } else {
         bool *visited = (bool*)calloc(graph->num_vertices, sizeof(bool));
         if (visited == NULL) return false;
@@ -853,17 +1098,17 @@ bool graph_is_bipartite(const Graph *graph) {
                     curr = curr->next;
                 }
             } else {
-                for (size_t i = 0; i < graph->num_vertices; i++) {
-                    if (graph->adj_matrix[u][i] != NO_EDGE) {
-                        if (color[i] == -1) {
-                            color[i] = 1 - color[u];
-                            Vertex vi = i;
-                            queue_enqueue(queue, &vi);
-                        } else if (color[i] == color[u]) {
-                            queue_destroy(queue);
-                            free(color);
-                            return false;
-                        }
+                GraphNeighborIter it;
+                Vertex vi;
+                graph_neighbor_iter_begin(graph, u, &it);
+                while (graph_neighbor_iter_next(&it, &vi, NULL)) {
+                    if (color[vi] == -1) {
+                        color[vi] = 1 - color[u];
+                        queue_enqueue(queue, &vi);
+                    } else if (color[vi] == color[u]) {
+                        queue_destroy(queue);
+                        free(color);
+                        return false;
                     }
                 }
             }
@@ -879,27 +1124,6 @@ bool graph_is_bipartite(const Graph *graph) {
 // ORDENACAO TOPOLOGICA
 // ============================================================================
 
-static void topo_dfs(const Graph *graph, Vertex u, bool *visited,
-                     Vertex *stack, size_t *stack_idx) {
-    visited[u] = true;
-
-    if (graph->representation == GRAPH_ADJACENCY_LIST) {
-        AdjNode *curr = graph->adj_list[u];
-        while (curr != NULL) {
-            if (!visited[curr->dest])
-                topo_dfs(graph, curr->dest, visited, stack, stack_idx);
-            curr = curr->next;
-        }
-    } else {
-        for (size_t i = 0; i < graph->num_vertices; i++) {
-            if (graph->adj_matrix[u][i] != NO_EDGE && !visited[i])
-                topo_dfs(graph, i, visited, stack, stack_idx);
-        }
-    }
-
-    stack[(*stack_idx)++] = u;
-}
-
 DataStructureError graph_topological_sort(const Graph *graph, Vertex **order, size_t *size) {
     if (graph == NULL || order == NULL || size == NULL)
         return DS_ERROR_NULL_POINTER;
@@ -909,32 +1133,31 @@ DataStructureError graph_topological_sort(const Graph *graph, Vertex **order, si
     size_t n = graph->num_vertices;
     *size = n;
 
-    bool *visited = (bool*)calloc(n, sizeof(bool));
+    unsigned char *state = (unsigned char*)calloc(n, 1);
+    GraphNeighborIter *iters = (GraphNeighborIter*)malloc(n * sizeof(GraphNeighborIter));
     Vertex *stack = (Vertex*)malloc(n * sizeof(Vertex));
-    if (visited == NULL || stack == NULL) {
-        free(visited);
+    *order = (Vertex*)malloc(n * sizeof(Vertex));
+    if (state == NULL || iters == NULL || stack == NULL || *order == NULL) {
+        free(state);
+        free(iters);
         free(stack);
+        free(*order);
+        *order = NULL;
         return DS_ERROR_OUT_OF_MEMORY;
     }
 
     size_t stack_idx = 0;
     for (size_t i = 0; i < n; i++) {
-        if (!visited[i])
-            topo_dfs(graph, i, visited, stack, &stack_idx);
-    }
-
-    *order = (Vertex*)malloc(n * sizeof(Vertex));
-    if (*order == NULL) {
-        free(visited);
-        free(stack);
-        return DS_ERROR_OUT_OF_MEMORY;
+        if (state[i] == DFS_WHITE)
+            dfs_postorder(graph, i, state, iters, stack, &stack_idx, false);
     }
 
     for (size_t i = 0; i < n; i++) {
         (*order)[i] = stack[n - 1 - i];
     }
 
-    free(visited);
+    free(state);
+    free(iters);
     free(stack);
     return DS_SUCCESS;
 }
@@ -972,10 +1195,12 @@ size_t graph_num_connected_components(const Graph *graph) {
                         curr = curr->next;
                     }
                 } else {
-                    for (size_t j = 0; j < graph->num_vertices; j++) {
-                        if (graph->adj_matrix[u][j] != NO_EDGE && !visited[j]) {
-                            visited[j] = true;
-                            Vertex vj = j;
+                    GraphNeighborIter it;
+                    Vertex vj;
+                    graph_neighbor_iter_begin(graph, u, &it);
+                    while (graph_neighbor_iter_next(&it, &vj, NULL)) {
+                        if (!visited[vj]) {
+                            visited[vj] = true;
                             queue_enqueue(queue, &vj);
                         }
                     }
@@ -989,47 +1214,6 @@ size_t graph_num_connected_components(const Graph *graph) {
     return components;
 }
 
-static void kosaraju_dfs1(const Graph *graph, Vertex u, bool *visited,
-                          Vertex *finish_order, size_t *idx) {
-    visited[u] = true;
-
-    if (graph->representation == GRAPH_ADJACENCY_LIST) {
-        AdjNode *curr = graph->adj_list[u];
-        while (curr != NULL) {
-            if (!visited[curr->dest])
-                kosaraju_dfs1(graph, curr->dest, visited, finish_order, idx);
-            curr = curr->next;
-        }
-    } else {
-        for (size_t i = 0; i < graph->num_vertices; i++) {
-            if (graph->adj_matrix[u][i] != NO_EDGE && !visited[i])
-                kosaraju_dfs1(graph, i, visited, finish_order, idx);
-        }
-    }
-
-    finish_order[(*idx)++] = u;
-}
-
-static void kosaraju_dfs2(const Graph *graph, Vertex u, bool *visited, size_t comp_id,
-                          size_t *comp_map) {
-    visited[u] = true;
-    comp_map[u] = comp_id;
-
-    if (graph->representation == GRAPH_ADJACENCY_LIST) {
-        AdjNode *curr = graph->adj_list[u];
-        while (curr != NULL) {
-            if (!visited[curr->dest])
-                kosaraju_dfs2(graph, curr->dest, visited, comp_id, comp_map);
-            curr = curr->next;
-        }
-    } else {
-        for (size_t i = 0; i < graph->num_vertices; i++) {
-            if (graph->adj_matrix[u][i] != NO_EDGE && !visited[i])
-                kosaraju_dfs2(graph, i, visited, comp_id, comp_map);
-        }
-    }
-}
-
 DataStructureError graph_strongly_connected_components(const Graph *graph,
                                                        size_t **components,
                                                        size_t *num_components) {
@@ -1037,44 +1221,45 @@ DataStructureError graph_strongly_connected_components(const Graph *graph,
         return DS_ERROR_NULL_POINTER;
 
     size_t n = graph->num_vertices;
-    bool *visited = (bool*)calloc(n, sizeof(bool));
+    unsigned char *state = (unsigned char*)calloc(n, 1);
+    GraphNeighborIter *iters = (GraphNeighborIter*)malloc(n * sizeof(GraphNeighborIter));
     Vertex *finish_order = (Vertex*)malloc(n * sizeof(Vertex));
-    if (visited == NULL || finish_order == NULL) {
-        free(visited); free(finish_order);
+    Vertex *members = (Vertex*)malloc(n * sizeof(Vertex));
+    Graph *t = graph_transpose(graph);
+    *components = (size_t*)malloc(n * sizeof(size_t));
+    if (state == NULL || iters == NULL || finish_order == NULL || members == NULL ||
+        t == NULL || *components == NULL) {
+        free(state); free(iters); free(finish_order); free(members);
+        graph_destroy(t);
+        free(*components);
+        *components = NULL;
         return DS_ERROR_OUT_OF_MEMORY;
     }
 
     size_t idx = 0;
     for (size_t i = 0; i < n; i++) {
-        if (!visited[i])
-            kosaraju_dfs1(graph, i, visited, finish_order, &idx);
+        if (state[i] == DFS_WHITE)
+            dfs_postorder(graph, i, state, iters, finish_order, &idx, false);
     }
 
-    Graph *t = graph_transpose(graph);
-    if (t == NULL) {
-        free(visited); free(finish_order);
-        return DS_ERROR_OUT_OF_MEMORY;
-    }
-
-    *components = (size_t*)malloc(n * sizeof(size_t));
-    if (*components == NULL) {
-        free(visited); free(finish_order); graph_destroy(t);
-        return DS_ERROR_OUT_OF_MEMORY;
-    }
-
-    memset(visited, 0, n * sizeof(bool));
+    // Segunda passada no transposto: cada árvore da DFS é um componente
+    memset(state, DFS_WHITE, n);
     *num_components = 0;
 
     for (size_t i = n; i > 0; i--) {
         Vertex u = finish_order[i - 1];
-        if (!visited[u]) {
-            kosaraju_dfs2(t, u, visited, *num_components, *components);
+        if (state[u] == DFS_WHITE) {
+            size_t count = 0;
+            dfs_postorder(t, u, state, iters, members, &count, false);
+            for (size_t k = 0; k < count; k++) (*components)[members[k]] = *num_components;
             (*num_components)++;
         }
     }
 
-    free(visited);
+    free(state);
+    free(iters);
     free(finish_order);
+    free(members);
     graph_destroy(t);
     return DS_SUCCESS;
 }
@@ -1086,12 +1271,19 @@ DataStructureError graph_strongly_connected_components(const Graph *graph,
 double** graph_to_adjacency_matrix(const Graph *graph) {
     if (graph == NULL) return NULL;
 
-    double **matrix = alloc_matrix(graph->num_vertices);
+    double **matrix = alloc_matrix(NULL, graph->num_vertices);
     if (matrix == NULL) return NULL;
 
     if (graph->representation == GRAPH_ADJACENCY_MATRIX) {
         for (size_t i = 0; i < graph->num_vertices; i++)
             memcpy(matrix[i], graph->adj_matrix[i], graph->num_vertices * sizeof(double));
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        for (size_t i = 0; i < graph->num_vertices; i++) {
+            GraphNeighborIter it;
+            Vertex j;
+            graph_neighbor_iter_begin(graph, i, &it);
+            while (graph_neighbor_iter_next(&it, &j, NULL)) matrix[i][j] = DEFAULT_WEIGHT;
+        }
     } else {
         for (size_t i = 0; i < graph->num_vertices; i++) {
             AdjNode *curr = graph->adj_list[i];
@@ -1105,6 +1297,13 @@ double** graph_to_adjacency_matrix(const Graph *graph) {
     return matrix;
 }
 
+const uint64_t* graph_adjacency_bits(const Graph *graph, Vertex v, size_t *num_words) {
+    if (graph == NULL || graph->representation != GRAPH_ADJACENCY_BITSET ||
+        v >= graph->num_vertices) return NULL;
+    if (num_words != NULL) *num_words = graph->words;
+    return bits_row(graph, v);
+}
+
 void graph_print(const Graph *graph) {
     if (graph == NULL) {
         printf("Graph: NULL\n");
@@ -1113,7 +1312,8 @@ void graph_print(const Graph *graph) {
 
     printf("Graph(%s, %s, V=%zu, E=%zu):\n",
            graph->type == GRAPH_DIRECTED ? "directed" : "undirected",
-           graph->representation == GRAPH_ADJACENCY_LIST ? "adj_list" : "adj_matrix",
+           graph->representation == GRAPH_ADJACENCY_LIST ? "adj_list" :
+           graph->representation == GRAPH_ADJACENCY_BITSET ? "adj_bitset" : "adj_matrix",
            graph->num_vertices, graph->num_edges);
 
     for (size_t i = 0; i < graph->num_vertices; i++) {
@@ -1128,13 +1328,15 @@ void graph_print(const Graph *graph) {
                 curr = curr->next;
             }
         } else {
-            for (size_t j = 0; j < graph->num_vertices; j++) {
-                if (graph->adj_matrix[i][j] != NO_EDGE) {
-                    if (graph->weighted)
-                        printf("%zu(%.1f) ", j, graph->adj_matrix[i][j]);
-                    else
-                        printf("%zu ", j);
-                }
+            GraphNeighborIter it;
+            Vertex j;
+            double w;
+            graph_neighbor_iter_begin(graph, i, &it);
+            while (graph_neighbor_iter_next(&it, &j, &w)) {
+                if (graph->weighted)
+                    printf("%zu(%.1f) ", j, w);
+                else
+                    printf("%zu ", j);
             }
         }
         printf("\n");
@@ -1144,8 +1346,9 @@ void graph_print(const Graph *graph) {
 Graph* graph_clone(const Graph *graph) {
     if (graph == NULL) return NULL;
 
-    Graph *clone = graph_create(graph->num_vertices, graph->type,
-                                graph->representation, graph->weighted);
+    Graph *clone = graph_create_with_allocator(graph->num_vertices, graph->type,
+                                               graph->representation, graph->weighted,
+                                               &graph->allocator);
     if (clone == NULL) return NULL;
 
     if (graph->representation == GRAPH_ADJACENCY_LIST) {
@@ -1153,13 +1356,16 @@ Graph* graph_clone(const Graph *graph) {
             AdjNode *curr = graph->adj_list[i];
             AdjNode **tail = &clone->adj_list[i];
             while (curr != NULL) {
-                AdjNode *node = create_adj_node(curr->dest, curr->weight);
+                AdjNode *node = create_adj_node(clone, curr->dest, curr->weight);
                 if (node == NULL) { graph_destroy(clone); return NULL; }
                 *tail = node;
                 tail = &node->next;
                 curr = curr->next;
             }
         }
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        memcpy(clone->adj_bits, graph->adj_bits,
+               graph->num_vertices * graph->words * sizeof(uint64_t));
     } else {
         for (size_t i = 0; i < graph->num_vertices; i++)
             memcpy(clone->adj_matrix[i], graph->adj_matrix[i],
@@ -1173,8 +1379,9 @@ Graph* graph_clone(const Graph *graph) {
 Graph* graph_transpose(const Graph *graph) {
     if (graph == NULL) return NULL;
 
-    Graph *t = graph_create(graph->num_vertices, graph->type,
-                            graph->representation, graph->weighted);
+    Graph *t = graph_create_with_allocator(graph->num_vertices, graph->type,
+                                           graph->representation, graph->weighted,
+                                           &graph->allocator);
     if (t == NULL) return NULL;
 
     if (graph->type == GRAPH_UNDIRECTED) {
@@ -1183,12 +1390,15 @@ Graph* graph_transpose(const Graph *graph) {
                 AdjNode *curr = graph->adj_list[i];
                 AdjNode **tail = &t->adj_list[i];
                 while (curr != NULL) {
-                    AdjNode *node = create_adj_node(curr->dest, curr->weight);
+                    AdjNode *node = create_adj_node(t, curr->dest, curr->weight);
                     *tail = node;
                     tail = &node->next;
                     curr = curr->next;
                 }
             }
+        } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+            memcpy(t->adj_bits, graph->adj_bits,
+                   graph->num_vertices * graph->words * sizeof(uint64_t));
         } else {
             for (size_t i = 0; i < graph->num_vertices; i++)
                 memcpy(t->adj_matrix[i], graph->adj_matrix[i],
@@ -1202,12 +1412,19 @@ Graph* graph_transpose(const Graph *graph) {
         for (size_t i = 0; i < graph->num_vertices; i++) {
             AdjNode *curr = graph->adj_list[i];
             while (curr != NULL) {
-                AdjNode *node = create_adj_node(i, curr->weight);
+                AdjNode *node = create_adj_node(t, i, curr->weight);
                 node->next = t->adj_list[curr->dest];
                 t->adj_list[curr->dest] = node;
                 curr = curr->next;
             }
         }
+    } else if (graph->representation == GRAPH_ADJACENCY_BITSET) {
+        for (size_t i = 0; i < graph->num_vertices; i++) {
+            GraphNeighborIter it;
+            Vertex j;
+            graph_neighbor_iter_begin(graph, i, &it);
+            while (graph_neighbor_iter_next(&it, &j, NULL)) bits_set(t, j, i);
+        }
     } else {
         for (size_t i = 0; i < graph->num_vertices; i++)
             for (size_t j = 0; j < graph->num_vertices; j++)
@@ -1217,3 +1434,432 @@ Graph* graph_transpose(const Graph *graph) {
     t->num_edges = graph->num_edges;
     return t;
 }
+
+// ============================================================================
+// SNAPSHOT CSR
+// ============================================================================
+
+CSRGraph* graph_freeze(const Graph *graph) {
+    if (graph == NULL) return NULL;
+
+    size_t n = graph->num_vertices;
+    CSRGraph *csr = (CSRGraph*)calloc(1, sizeof(CSRGraph));
+    if (csr == NULL) return NULL;
+
+    csr->num_vertices = n;
+    csr->num_edges = graph->num_edges;
+    csr->type = graph->type;
+    csr->offsets = (size_t*)calloc(n + 1, sizeof(size_t));
+    if (csr->offsets == NULL) { free(csr); return NULL; }
+
+    for (size_t u = 0; u < n; u++)
+        csr->offsets[u + 1] = csr->offsets[u] + graph_out_degree(graph, u);
+
+    size_t arcs = csr->offsets[n];
+    csr->dest = (Vertex*)malloc((arcs > 0 ? arcs : 1) * sizeof(Vertex));
+    csr->weight = (double*)malloc((arcs > 0 ? arcs : 1) * sizeof(double));
+    if (csr->dest == NULL || csr->weight == NULL) {
+        graph_csr_destroy(csr);
+        return NULL;
+    }
+
+    for (size_t u = 0; u < n; u++) {
+        size_t idx = csr->offsets[u];
+        if (graph->representation == GRAPH_ADJACENCY_LIST) {
+            for (AdjNode *curr = graph->adj_list[u]; curr != NULL; curr = curr->next) {
+                csr->dest[idx] = curr->dest;
+                csr->weight[idx] = curr->weight;
+                idx++;
+            }
+        } else {
+            GraphNeighborIter it;
+            graph_neighbor_iter_begin(graph, u, &it);
+            while (graph_neighbor_iter_next(&it, &csr->dest[idx], &csr->weight[idx])) idx++;
+        }
+    }
+
+    return csr;
+}
+
+void graph_csr_destroy(CSRGraph *csr) {
+    if (csr == NULL) return;
+    if (!csr->view) {
+        free(csr->offsets);
+        free(csr->dest);
+        free(csr->weight);
+    }
+    free(csr->buffer);
+#if defined(GRAPH_USE_MMAP)
+    if (csr->map != NULL) munmap(csr->map, csr->map_size);
+#endif
+    free(csr);
+}
+
+// ============================================================================
+// SERIALIZAÇÃO CSR
+// ============================================================================
+
+// Tamanho do arquivo para o cabeçalho dado; 0 se não couber em size_t
+static size_t csr_file_size(const CSRFileHeader *header) {
+    const size_t limit = (SIZE_MAX - sizeof(CSRFileHeader)) / 16 - 1;
+    if (header->num_vertices >= limit || header->num_arcs >= limit) return 0;
+    return sizeof(CSRFileHeader) + ((size_t)header->num_vertices + 1) * sizeof(size_t) +
+           (size_t)header->num_arcs * (sizeof(Vertex) + sizeof(double));
+}
+
+bool graph_csr_save(const CSRGraph *csr, const char *path) {
+    if (csr == NULL || path == NULL) return false;
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) return false;
+
+    size_t n = csr->num_vertices;
+    size_t arcs = csr->offsets[n];
+    CSRFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CSR_MAGIC, sizeof(header.magic));
+    header.version = CSR_VERSION;
+    header.byte_order = CSR_BYTE_ORDER;
+    header.type = (uint32_t)csr->type;
+    header.index_size = (uint32_t)sizeof(size_t);
+    header.num_vertices = n;
+    header.num_edges = csr->num_edges;
+    header.num_arcs = arcs;
+
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              fwrite(csr->offsets, sizeof(size_t), n + 1, f) == n + 1;
+    if (ok && arcs > 0) {
+        ok = fwrite(csr->dest, sizeof(Vertex), arcs, f) == arcs &&
+             fwrite(csr->weight, sizeof(double), arcs, f) == arcs;
+    }
+    if (fclose(f) != 0) ok = false;
+    if (!ok) remove(path);
+    return ok;
+}
+
+bool graph_save(const Graph *graph, const char *path) {
+    CSRGraph *csr = graph_freeze(graph);
+    if (csr == NULL) return false;
+    bool ok = graph_csr_save(csr, path);
+    graph_csr_destroy(csr);
+    return ok;
+}
+
+CSRGraph* graph_csr_from_buffer(const void *buffer, size_t size) {
+    if (buffer == NULL || size < sizeof(CSRFileHeader)) return NULL;
+    if (((uintptr_t)buffer % sizeof(uint64_t)) != 0) return NULL;
+
+    CSRFileHeader header;
+    memcpy(&header, buffer, sizeof(header));
+    if (memcmp(header.magic, CSR_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != CSR_VERSION || header.byte_order != CSR_BYTE_ORDER ||
+        header.index_size != sizeof(size_t) ||
+        (header.type != GRAPH_DIRECTED && header.type != GRAPH_UNDIRECTED) ||
+        csr_file_size(&header) != size) {
+        return NULL;
+    }
+
+    // Só as pontas de offsets são conferidas: abrir não percorre o arquivo
+    size_t n = (size_t)header.num_vertices;
+    size_t arcs = (size_t)header.num_arcs;
+    size_t *offsets = (size_t*)((unsigned char*)buffer + sizeof(header));
+    if (offsets[0] != 0 || offsets[n] != arcs) return NULL;
+
+    CSRGraph *csr = (CSRGraph*)calloc(1, sizeof(CSRGraph));
+    if (csr == NULL) return NULL;
+    csr->num_vertices = n;
+    csr->num_edges = (size_t)header.num_edges;
+    csr->type = (GraphType)header.type;
+    csr->offsets = offsets;
+    csr->dest = (Vertex*)(offsets + n + 1);
+    csr->weight = (double*)(csr->dest + arcs);
+    csr->view = true;
+    return csr;
+}
+
+CSRGraph* graph_mmap_open(const char *path) {
+    if (path == NULL) return NULL;
+
+#if defined(GRAPH_USE_MMAP)
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(CSRFileHeader)) {
+        close(fd);
+        return NULL;
+    }
+    size_t size = (size_t)st.st_size;
+    void *map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return NULL;
+
+    CSRGraph *csr = graph_csr_from_buffer(map, size);
+    if (csr == NULL) {
+        munmap(map, size);
+        return NULL;
+    }
+    csr->map = map;
+    csr->map_size = size;
+    return csr;
+#else
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return NULL;
+    CSRFileHeader header;
+    size_t size = 0;
+    if (fread(&header, sizeof(header), 1, f) == 1) size = csr_file_size(&header);
+    uint64_t *buffer = size > 0 ? (uint64_t*)malloc(size) : NULL;
+    bool ok = buffer != NULL;
+    if (ok) {
+        memcpy(buffer, &header, sizeof(header));
+        size_t rest = size - sizeof(header);
+        ok = fread((unsigned char*)buffer + sizeof(header), 1, rest, f) == rest && fgetc(f) == EOF;
+    }
+    fclose(f);
+    CSRGraph *csr = ok ? graph_csr_from_buffer(buffer, size) : NULL;
+    if (csr == NULL) {
+        free(buffer);
+        return NULL;
+    }
+    csr->buffer = buffer;
+    return csr;
+#endif
+}
+
+CSRGraph* graph_csr_from_arrays(size_t num_vertices, size_t num_edges, GraphType type,
+                                size_t *offsets, Vertex *dest, double *weight) {
+    if (offsets == NULL || dest == NULL || weight == NULL) return NULL;
+    CSRGraph *csr = (CSRGraph*)calloc(1, sizeof(CSRGraph));
+    if (csr == NULL) return NULL;
+    csr->num_vertices = num_vertices;
+    csr->num_edges = num_edges;
+    csr->type = type;
+    csr->offsets = offsets;
+    csr->dest = dest;
+    csr->weight = weight;
+    return csr;
+}
+
+size_t graph_csr_num_vertices(const CSRGraph *csr) {
+    if (csr == NULL) return 0;
+    return csr->num_vertices;
+}
+
+size_t graph_csr_num_edges(const CSRGraph *csr) {
+    if (csr == NULL) return 0;
+    return csr->num_edges;
+}
+
+size_t graph_csr_memory_usage(const CSRGraph *csr) {
+    if (csr == NULL) return 0;
+    size_t arcs = csr->offsets[csr->num_vertices];
+    size_t bytes = sizeof(CSRGraph) + (csr->num_vertices + 1) * sizeof(size_t) +
+                   arcs * (sizeof(Vertex) + sizeof(double));
+    if (csr->view) bytes += sizeof(CSRFileHeader);
+    return bytes;
+}
+
+bool graph_csr_is_directed(const CSRGraph *csr) {
+    if (csr == NULL) return false;
+    return csr->type == GRAPH_DIRECTED;
+}
+
+size_t graph_csr_out_degree(const CSRGraph *csr, Vertex v) {
+    if (csr == NULL || v >= csr->num_vertices) return 0;
+    return csr->offsets[v + 1] - csr->offsets[v];
+}
+
+DataStructureError graph_csr_neighbors(const CSRGraph *csr, Vertex v,
+                                       const Vertex **dests,
+                                       const double **weights, size_t *count) {
+    if (csr == NULL || dests == NULL || count == NULL)
+        return DS_ERROR_NULL_POINTER;
+    if (v >= csr->num_vertices) return DS_ERROR_INVALID_INDEX;
+
+    *dests = csr->dest + csr->offsets[v];
+    if (weights != NULL) *weights = csr->weight + csr->offsets[v];
+    *count = csr->offsets[v + 1] - csr->offsets[v];
+    return DS_SUCCESS;
+}
+
+void graph_csr_bfs(const CSRGraph *csr, Vertex start, VertexVisitFn visit, void *user_data) {
+    if (csr == NULL || start >= csr->num_vertices || visit == NULL) return;
+
+    size_t n = csr->num_vertices;
+    bool *visited = (bool*)calloc(n, sizeof(bool));
+    Vertex *fifo = (Vertex*)malloc(n * sizeof(Vertex));
+    if (visited == NULL || fifo == NULL) {
+        free(visited); free(fifo);
+        return;
+    }
+
+    // Cada vértice entra na fila no máximo uma vez: array de tamanho V basta
+    size_t head = 0, tail = 0;
+    visited[start] = true;
+    fifo[tail++] = start;
+
+    while (head < tail) {
+        Vertex u = fifo[head++];
+        visit(u, user_data);
+
+        for (size_t i = csr->offsets[u]; i < csr->offsets[u + 1]; i++) {
+            Vertex v = csr->dest[i];
+            if (!visited[v]) {
+                visited[v] = true;
+                fifo[tail++] = v;
+            }
+        }
+    }
+
+    free(fifo);
+    free(visited);
+}
+
+void graph_csr_dfs(const CSRGraph *csr, Vertex start, VertexVisitFn visit, void *user_data) {
+    if (csr == NULL || start >= csr->num_vertices || visit == NULL) return;
+
+    size_t n = csr->num_vertices;
+    bool *visited = (bool*)calloc(n, sizeof(bool));
+    Vertex *stack = (Vertex*)malloc(n * sizeof(Vertex));
+    size_t *cursor = (size_t*)malloc(n * sizeof(size_t));
+    if (visited == NULL || stack == NULL || cursor == NULL) {
+        free(visited); free(stack); free(cursor);
+        return;
+    }
+
+    // cursor[k] = próximo arco a examinar do vértice stack[k]
+    size_t top = 0;
+    visited[start] = true;
+    visit(start, user_data);
+    stack[top] = start;
+    cursor[top] = csr->offsets[start];
+    top++;
+
+    while (top > 0) {
+        Vertex u = stack[top - 1];
+        if (cursor[top - 1] == csr->offsets[u + 1]) {
+            top--;
+            continue;
+        }
+        Vertex v = csr->dest[cursor[top - 1]++];
+        if (!visited[v]) {
+            visited[v] = true;
+            visit(v, user_data);
+            stack[top] = v;
+            cursor[top] = csr->offsets[v];
+            top++;
+        }
+    }
+
+    free(cursor);
+    free(stack);
+    free(visited);
+}
+
+DataStructureError graph_csr_topological_sort(const CSRGraph *csr, Vertex **order, size_t *size) {
+    if (csr == NULL || order == NULL || size == NULL)
+        return DS_ERROR_NULL_POINTER;
+    if (csr->type != GRAPH_DIRECTED) return DS_ERROR_INVALID_PARAM;
+
+    size_t n = csr->num_vertices;
+    size_t *in_degree = (size_t*)calloc(n > 0 ? n : 1, sizeof(size_t));
+    Vertex *out = (Vertex*)malloc((n > 0 ? n : 1) * sizeof(Vertex));
+    if (in_degree == NULL || out == NULL) {
+        free(in_degree);
+        free(out);
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (size_t a = 0; a < csr->offsets[n]; a++) in_degree[csr->dest[a]]++;
+
+    // Kahn: out[head..tail) é a fila de vértices sem arcos de entrada restantes
+    size_t tail = 0;
+    for (Vertex v = 0; v < n; v++) {
+        if (in_degree[v] == 0) out[tail++] = v;
+    }
+    for (size_t head = 0; head < tail; head++) {
+        Vertex u = out[head];
+        for (size_t a = csr->offsets[u]; a < csr->offsets[u + 1]; a++) {
+            if (--in_degree[csr->dest[a]] == 0) out[tail++] = csr->dest[a];
+        }
+    }
+
+    free(in_degree);
+    if (tail < n) {                         // sobrou ciclo
+        free(out);
+        return DS_ERROR_INVALID_PARAM;
+    }
+    *order = out;
+    *size = n;
+    return DS_SUCCESS;
+}
+
+DataStructureError graph_csr_strongly_connected_components(const CSRGraph *csr,
+                                                           size_t **components,
+                                                           size_t *num_components) {
+    if (csr == NULL || components == NULL || num_components == NULL)
+        return DS_ERROR_NULL_POINTER;
+
+    size_t n = csr->num_vertices;
+    size_t cap = (n > 0) ? n : 1;
+    size_t *index = (size_t*)malloc(cap * sizeof(size_t));
+    size_t *low = (size_t*)malloc(cap * sizeof(size_t));
+    Vertex *call = (Vertex*)malloc(cap * sizeof(Vertex));
+    size_t *cursor = (size_t*)malloc(cap * sizeof(size_t));
+    Vertex *open = (Vertex*)malloc(cap * sizeof(Vertex));
+    size_t *comp = (size_t*)malloc(cap * sizeof(size_t));
+    if (index == NULL || low == NULL || call == NULL || cursor == NULL || open == NULL || comp == NULL) {
+        free(index); free(low); free(call); free(cursor); free(open); free(comp);
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+
+    // comp[v] == NONE enquanto v não fecha componente; v está na pilha de
+    // abertos sse index[v] != NONE e comp[v] == NONE
+    const size_t NONE = (size_t)-1;
+    for (size_t v = 0; v < n; v++) {
+        index[v] = NONE;
+        comp[v] = NONE;
+    }
+
+    size_t counter = 0, open_top = 0, count = 0;
+    for (Vertex root = 0; root < n; root++) {
+        if (index[root] != NONE) continue;
+
+        // call/cursor: pilha de chamadas explícita (cursor = próximo arco)
+        size_t top = 0;
+        index[root] = low[root] = counter++;
+        open[open_top++] = root;
+        call[top] = root;
+        cursor[top++] = csr->offsets[root];
+
+        while (top > 0) {
+            Vertex u = call[top - 1];
+            if (cursor[top - 1] < csr->offsets[u + 1]) {
+                Vertex v = csr->dest[cursor[top - 1]++];
+                if (index[v] == NONE) {
+                    index[v] = low[v] = counter++;
+                    open[open_top++] = v;
+                    call[top] = v;
+                    cursor[top++] = csr->offsets[v];
+                } else if (comp[v] == NONE && index[v] < low[u]) {
+                    low[u] = index[v];
+                }
+                continue;
+            }
+
+            top--;
+            if (top > 0 && low[u] < low[call[top - 1]]) low[call[top - 1]] = low[u];
+            if (low[u] == index[u]) {
+                Vertex w;
+                do {
+                    w = open[--open_top];
+                    comp[w] = count;
+                } while (w != u);
+                count++;
+            }
+        }
+    }
+
+    free(index); free(low); free(call); free(cursor); free(open);
+    *components = comp;
+    *num_components = count;
+    return DS_SUCCESS;
+}
@@ -7,6 +7,7 @@
  * 2. Linear Probing
  * 3. Quadratic Probing
  * 4. Double Hashing
+ * 5. Flat (slots inline + bytes de controle, estilo Swiss Table)
  *
  * Referências:
  * - Cormen et al. (2009), Chapter 11 - Hash Tables
@@ -17,11 +18,38 @@
  */
 
 #include "data_structures/hash_table.h"
+#include "data_structures/instrument.h"
 
+#include <stdatomic.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <stddef.h>
 #include <math.h>
+#include <time.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sched.h>
+#define CHT_USE_SCHED_YIELD 1
+#endif
+
+// Sondagem por grupos de 16 bytes de controle (HASH_FLAT).
+// Defina HASH_FLAT_NO_SIMD para forçar o fallback escalar portável.
+#if !defined(HASH_FLAT_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define FLAT_USE_SSE2 1
+#elif !defined(HASH_FLAT_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define FLAT_USE_NEON 1
+#endif
+
+#if defined(__GNUC__)
+#define HASH_PREFETCH(p) __builtin_prefetch((p))
+#else
+#define HASH_PREFETCH(p) ((void)(p))
+#endif
 
 // ============================================================================
 // ESTRUTURAS INTERNAS
@@ -38,14 +66,22 @@ typedef struct ChainNode {
 
 /**
  * @brief Entry para open addressing
+ *
+ * O estado de cada slot fica num array de bytes à parte (oa_state): com
+ * os dois flags dentro da entrada, o padding levava cada slot a 24 bytes.
  */
 typedef struct {
     void *key;
     void *value;
-    bool occupied;      // Slot está ocupado?
-    bool deleted;       // Slot foi deletado? (para probing)
 } OpenAddressEntry;
 
+/** Estados de slot em open addressing (OA_DELETED mantém os buffers) */
+enum {
+    OA_EMPTY = 0,
+    OA_LIVE = 1,
+    OA_DELETED = 2      // Lápide: não quebra as cadeias de probing
+};
+
 /**
  * @brief Estrutura da Hash Table
  */
@@ -64,8 +100,25 @@ struct HashTable {
     // Para CHAINING
     ChainNode **buckets;
 
+    // Rehash incremental (só CHAINING): enquanto old_buckets != NULL, os
+    // buckets [rehash_index, old_capacity) de old_buckets ainda não migraram
+    ChainNode **old_buckets;
+    size_t old_capacity;
+    size_t rehash_index;
+    size_t rehash_step;    // Buckets migrados por put/remove (0 = tudo de uma vez)
+
     // Para OPEN ADDRESSING
     OpenAddressEntry *entries;
+    uint8_t *oa_state;     // OA_EMPTY, OA_LIVE ou OA_DELETED por slot
+
+    // Para FLAT: ctrl[i] é EMPTY, DELETED ou a tag de 7 bits do slot i
+    uint8_t *ctrl;
+    unsigned char *slots;  // capacity * slot_size bytes: [chave | valor]
+    size_t slot_size;
+    size_t value_offset;
+    size_t tombstones;     // Slots DELETED (contam para o load factor)
+
+    DSAllocator allocator; // Origem de cabeçalho, arrays, nós e entradas
 };
 
 /**
@@ -133,25 +186,25 @@ static size_t hash_primary(const HashTable *table, const void *key) {
 }
 
 /**
- * @brief Hash secundário para double hashing
+ * @brief Hash secundário para double hashing, a partir de h = hash_fn(k)
  *
  * h2(k) = 1 + (k mod (m-1))
  * Garante que h2(k) seja relativamente primo com m
  */
-static size_t hash_secondary(const HashTable *table, const void *key) {
-    size_t h = table->hash_fn(key);
+static size_t hash_secondary(const HashTable *table, size_t h) {
     return 1 + (h % (table->capacity - 1));
 }
 
 /**
- * @brief Calcula índice para probing
+ * @brief Calcula índice para probing a partir de h = hash_fn(key)
  *
  * Linear Probing: h(k, i) = (h1(k) + i) mod m
  * Quadratic Probing: h(k, i) = (h1(k) + c1*i + c2*i²) mod m
  * Double Hashing: h(k, i) = (h1(k) + i*h2(k)) mod m
  */
-static size_t probe_index(const HashTable *table, const void *key, size_t i) {
-    size_t h1 = hash_primary(table, key);
+static size_t probe_index_hashed(const HashTable *table, size_t h, size_t i) {
+    size_t h1 = h % table->capacity;
+    DS_COUNT(HASH_TABLE, PROBES, 1);
 
     switch (table->strategy) {
         case HASH_LINEAR_PROBING:
@@ -162,7 +215,7 @@ static size_t probe_index(const HashTable *table, const void *key, size_t i) {
             return (h1 + i + i*i) % table->capacity;
 
         case HASH_DOUBLE_HASHING: {
-            size_t h2 = hash_secondary(table, key);
+            size_t h2 = hash_secondary(table, h);
             return (h1 + i * h2) % table->capacity;
         }
 
@@ -171,6 +224,297 @@ static size_t probe_index(const HashTable *table, const void *key, size_t i) {
     }
 }
 
+static size_t probe_index(const HashTable *table, const void *key, size_t i) {
+    return probe_index_hashed(table, table->hash_fn(key), i);
+}
+
+// ============================================================================
+// FUNÇÕES AUXILIARES - FLAT (SLOTS INLINE)
+// ============================================================================
+
+#define FLAT_CTRL_EMPTY   ((uint8_t)0x80)
+#define FLAT_CTRL_DELETED ((uint8_t)0xFE)
+#define FLAT_MIN_CAPACITY 16  // Um grupo de controle completo
+#define FLAT_MAX_LOAD_NUM 7   // load máximo = 7/8 = 0.875
+#define FLAT_MAX_LOAD_DEN 8
+
+static bool flat_is_full(uint8_t c) {
+    return (c & 0x80) == 0;
+}
+
+/**
+ * @brief Alinhamento natural para um campo de 'size' bytes
+ *
+ * Maior potência de 2 que divide size, limitada a max_align_t, para que
+ * hashtable_get_ptr() devolva ponteiros utilizáveis como o tipo original.
+ */
+static size_t flat_field_align(size_t size) {
+    size_t align = 1;
+    while (align < _Alignof(max_align_t) && size % (align * 2) == 0) {
+        align *= 2;
+    }
+    return align;
+}
+
+static size_t flat_round_up(size_t n, size_t align) {
+    return (n + align - 1) / align * align;
+}
+
+static size_t flat_next_pow2(size_t n) {
+    size_t cap = FLAT_MIN_CAPACITY;
+    while (cap < n) cap *= 2;
+    return cap;
+}
+
+/**
+ * @brief Mistura o hash do usuário (Fibonacci hashing, Knuth 6.4)
+ *
+ * Os bits baixos indexam a tabela e os 7 bits altos formam a tag, então
+ * ambos precisam depender de todos os bits de hash_fn(key).
+ */
+static size_t flat_mix(size_t h) {
+    uint64_t x = (uint64_t)h * UINT64_C(0x9E3779B97F4A7C15);
+    return (size_t)(x ^ (x >> 32));
+}
+
+static uint8_t flat_tag(size_t mixed) {
+    return (uint8_t)(mixed >> (sizeof(size_t) * 8 - 7));
+}
+
+static unsigned char* flat_slot_key(const HashTable *table, size_t index) {
+    return table->slots + index * table->slot_size;
+}
+
+static unsigned char* flat_slot_value(const HashTable *table, size_t index) {
+    return table->slots + index * table->slot_size + table->value_offset;
+}
+
+static void flat_release(HashTable *table, uint8_t *ctrl, unsigned char *slots,
+                         size_t capacity) {
+    ds_free(&table->allocator, ctrl, capacity);
+    ds_free(&table->allocator, slots, capacity * table->slot_size);
+}
+
+static DataStructureError flat_alloc(HashTable *table, size_t capacity) {
+    uint8_t *ctrl = (uint8_t*)ds_alloc(&table->allocator, capacity);
+    unsigned char *slots = (unsigned char*)ds_alloc(&table->allocator,
+                                                    capacity * table->slot_size);
+    if (ctrl == NULL || slots == NULL) {
+        ds_free(&table->allocator, ctrl, capacity);
+        ds_free(&table->allocator, slots, capacity * table->slot_size);
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+    memset(ctrl, FLAT_CTRL_EMPTY, capacity);
+    table->ctrl = ctrl;
+    table->slots = slots;
+    table->capacity = capacity;
+    table->tombstones = 0;
+    return DS_SUCCESS;
+}
+
+/*
+ * Grupos de controle
+ *
+ * A tabela é dividida em grupos alinhados de FLAT_GROUP_WIDTH bytes de
+ * controle. Cada operação de grupo devolve uma máscara com um bit (SSE2,
+ * escalar) ou um nibble (NEON) por slot; FLAT_MASK_STRIDE converte a
+ * posição do bit em índice do slot dentro do grupo.
+ */
+#define FLAT_GROUP_WIDTH 16
+
+typedef uint64_t FlatMask;
+
+#if defined(FLAT_USE_NEON)
+#define FLAT_MASK_STRIDE 4
+
+static FlatMask flat_neon_to_mask(uint8x16_t eq) {
+    // Estreita cada byte 0x00/0xFF para um nibble (truque shrn)
+    uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(eq), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & UINT64_C(0x8888888888888888);
+}
+
+static FlatMask flat_group_match(const uint8_t *group, uint8_t tag) {
+    return flat_neon_to_mask(vceqq_u8(vld1q_u8(group), vdupq_n_u8(tag)));
+}
+
+static FlatMask flat_group_match_empty(const uint8_t *group) {
+    return flat_neon_to_mask(vceqq_u8(vld1q_u8(group), vdupq_n_u8(FLAT_CTRL_EMPTY)));
+}
+
+static FlatMask flat_group_match_free(const uint8_t *group) {
+    // EMPTY e DELETED têm o bit alto ligado
+    return flat_neon_to_mask(vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(group)), vdupq_n_s8(0)));
+}
+
+#elif defined(FLAT_USE_SSE2)
+#define FLAT_MASK_STRIDE 1
+
+static FlatMask flat_group_match(const uint8_t *group, uint8_t tag) {
+    __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (FlatMask)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)tag)));
+}
+
+static FlatMask flat_group_match_empty(const uint8_t *group) {
+    __m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+    return (FlatMask)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8((char)FLAT_CTRL_EMPTY)));
+}
+
+static FlatMask flat_group_match_free(const uint8_t *group) {
+    // EMPTY e DELETED têm o bit alto ligado: movemask extrai exatamente ele
+    return (FlatMask)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)group));
+}
+
+#else
+#define FLAT_MASK_STRIDE 1
+
+static FlatMask flat_group_match(const uint8_t *group, uint8_t tag) {
+    FlatMask mask = 0;
+    for (size_t i = 0; i < FLAT_GROUP_WIDTH; i++) {
+        mask |= (FlatMask)(group[i] == tag) << i;
+    }
+    return mask;
+}
+
+static FlatMask flat_group_match_empty(const uint8_t *group) {
+    return flat_group_match(group, FLAT_CTRL_EMPTY);
+}
+
+static FlatMask flat_group_match_free(const uint8_t *group) {
+    FlatMask mask = 0;
+    for (size_t i = 0; i < FLAT_GROUP_WIDTH; i++) {
+        mask |= (FlatMask)(group[i] >> 7) << i;
+    }
+    return mask;
+}
+#endif
+
+/** Índice (dentro do grupo) do bit menos significativo da máscara. */
+static size_t flat_mask_lowest(FlatMask mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (size_t)__builtin_ctzll(mask) / FLAT_MASK_STRIDE;
+#else
+    size_t bit = 0;
+    while ((mask & 1) == 0) {
+        mask >>= 1;
+        bit++;
+    }
+    return bit / FLAT_MASK_STRIDE;
+#endif
+}
+
+/** Remove o bit (ou nibble) menos significativo. */
+static FlatMask flat_mask_clear_lowest(FlatMask mask) {
+    return mask & (mask - 1);
+}
+
+/**
+ * @brief Localiza o slot de uma chave
+ *
+ * Sondagem triangular sobre grupos (g, g+1, g+3, g+6, ...), que visita
+ * todos os grupos quando o número de grupos é potência de 2. Em cada
+ * grupo, compara as 16 tags de uma vez; a busca termina no primeiro
+ * grupo que contém um slot EMPTY.
+ *
+ * @return Índice do slot ou SIZE_MAX se ausente. Em *insert_at (se não
+ *         NULL) devolve o primeiro slot DELETED/EMPTY da sequência.
+ */
+static size_t flat_find_hashed(const HashTable *table, const void *key, size_t mixed,
+                               size_t *insert_at) {
+    size_t num_groups = table->capacity / FLAT_GROUP_WIDTH;
+    uint8_t tag = flat_tag(mixed);
+    size_t group = (mixed & (table->capacity - 1)) / FLAT_GROUP_WIDTH;
+    size_t first_free = SIZE_MAX;
+
+    for (size_t step = 0; step < num_groups; step++) {
+        size_t base = group * FLAT_GROUP_WIDTH;
+        const uint8_t *ctrl = table->ctrl + base;
+        DS_COUNT(HASH_TABLE, PROBES, 1);
+
+        for (FlatMask m = flat_group_match(ctrl, tag); m != 0; m = flat_mask_clear_lowest(m)) {
+            size_t index = base + flat_mask_lowest(m);
+            if (table->compare_fn(flat_slot_key(table, index), key) == 0) {
+                return index;
+            }
+        }
+
+        if (first_free == SIZE_MAX) {
+            FlatMask free_mask = flat_group_match_free(ctrl);
+            if (free_mask != 0) first_free = base + flat_mask_lowest(free_mask);
+        }
+
+        if (flat_group_match_empty(ctrl) != 0) {
+            break;
+        }
+
+        group = (group + step + 1) & (num_groups - 1);
+    }
+
+    if (insert_at != NULL) *insert_at = first_free;
+    return SIZE_MAX;
+}
+
+static size_t flat_find(const HashTable *table, const void *key, size_t *insert_at) {
+    return flat_find_hashed(table, key, flat_mix(table->hash_fn(key)), insert_at);
+}
+
+static DataStructureError hashtable_put_flat_hashed(HashTable *table, const void *key,
+                                                    const void *value, size_t mixed) {
+    size_t insert_at = SIZE_MAX;
+    size_t index = flat_find_hashed(table, key, mixed, &insert_at);
+
+    if (index != SIZE_MAX) {
+        if (table->destroy_value != NULL) {
+            table->destroy_value(flat_slot_value(table, index));
+        }
+        memcpy(flat_slot_value(table, index), value, table->value_size);
+        return DS_SUCCESS;
+    }
+
+    if (insert_at == SIZE_MAX) {
+        return DS_ERROR_FULL;
+    }
+
+    if (table->ctrl[insert_at] == FLAT_CTRL_DELETED) {
+        table->tombstones--;
+    }
+    table->ctrl[insert_at] = flat_tag(mixed);
+    memcpy(flat_slot_key(table, insert_at), key, table->key_size);
+    memcpy(flat_slot_value(table, insert_at), value, table->value_size);
+    table->size++;
+    return DS_SUCCESS;
+}
+
+static DataStructureError hashtable_put_flat(HashTable *table, const void *key, const void *value) {
+    return hashtable_put_flat_hashed(table, key, value, flat_mix(table->hash_fn(key)));
+}
+
+static DataStructureError hashtable_remove_flat(HashTable *table, const void *key, void *old_value) {
+    size_t index = flat_find(table, key, NULL);
+    if (index == SIZE_MAX) {
+        return DS_ERROR_NOT_FOUND;
+    }
+
+    if (old_value != NULL) {
+        memcpy(old_value, flat_slot_value(table, index), table->value_size);
+    }
+
+    // Se o grupo já tem um EMPTY, nenhuma sondagem continua além dele
+    const uint8_t *group = table->ctrl + (index / FLAT_GROUP_WIDTH) * FLAT_GROUP_WIDTH;
+    if (flat_group_match_empty(group) != 0) {
+        table->ctrl[index] = FLAT_CTRL_EMPTY;
+    } else {
+        table->ctrl[index] = FLAT_CTRL_DELETED;
+        table->tombstones++;
+    }
+    table->size--;
+    return DS_SUCCESS;
+}
+
+static bool flat_needs_grow(const HashTable *table) {
+    return (table->size + table->tombstones + 1) * FLAT_MAX_LOAD_DEN >
+           table->capacity * FLAT_MAX_LOAD_NUM;
+}
+
 // ============================================================================
 // FUNÇÕES AUXILIARES - CHAINING
 // ============================================================================
@@ -179,18 +523,18 @@ static size_t probe_index(const HashTable *table, const void *key, size_t i) {
  * @brief Cria um nó de chain
  */
 static ChainNode* chainnode_create(const HashTable *table, const void *key, const void *value) {
-    ChainNode *node = (ChainNode*)malloc(sizeof(ChainNode));
+    ChainNode *node = (ChainNode*)ds_alloc(&table->allocator, sizeof(ChainNode));
     if (node == NULL) {
         return NULL;
     }
 
-    node->key = malloc(table->key_size);
-    node->value = malloc(table->value_size);
+    node->key = ds_alloc(&table->allocator, table->key_size);
+    node->value = ds_alloc(&table->allocator, table->value_size);
 
     if (node->key == NULL || node->value == NULL) {
-        free(node->key);
-        free(node->value);
-        free(node);
+        ds_free(&table->allocator, node->key, table->key_size);
+        ds_free(&table->allocator, node->value, table->value_size);
+        ds_free(&table->allocator, node, sizeof(ChainNode));
         return NULL;
     }
 
@@ -201,24 +545,138 @@ static ChainNode* chainnode_create(const HashTable *table, const void *key, cons
     return node;
 }
 
+/** Buckets vazios visitados por bucket migrado antes de encerrar um passo */
+#define HASH_REHASH_EMPTY_VISITS 10
+
+/**
+ * @brief Número de buckets visíveis: os de old_buckets (se migrando) e depois os atuais
+ */
+static size_t chain_total_buckets(const HashTable *table) {
+    return table->capacity + (table->old_buckets != NULL ? table->old_capacity : 0);
+}
+
+/**
+ * @brief Bucket i do espaço [old_buckets | buckets] usado por clear, iterador e cópias
+ */
+static ChainNode** chain_bucket_ref(const HashTable *table, size_t i) {
+    if (table->old_buckets != NULL) {
+        if (i < table->old_capacity) {
+            return &table->old_buckets[i];
+        }
+        i -= table->old_capacity;
+    }
+    return &table->buckets[i];
+}
+
+/**
+ * @brief Link (ponteiro que aponta para o nó) da chave, ou NULL se ausente
+ *
+ * Durante a migração a chave pode estar no bucket antigo (ainda não
+ * migrado) ou no novo; buckets antigos já migrados estão vazios.
+ */
+static ChainNode** chain_find_link_hashed(const HashTable *table, const void *key, size_t h) {
+    if (table->old_buckets != NULL) {
+        for (ChainNode **link = &table->old_buckets[h % table->old_capacity];
+             *link != NULL; link = &(*link)->next) {
+            DS_COUNT(HASH_TABLE, PROBES, 1);
+            if (table->compare_fn((*link)->key, key) == 0) {
+                return link;
+            }
+        }
+    }
+
+    for (ChainNode **link = &table->buckets[h % table->capacity];
+         *link != NULL; link = &(*link)->next) {
+        DS_COUNT(HASH_TABLE, PROBES, 1);
+        if (table->compare_fn((*link)->key, key) == 0) {
+            return link;
+        }
+    }
+    return NULL;
+}
+
+static ChainNode** chain_find_link(const HashTable *table, const void *key) {
+    return chain_find_link_hashed(table, key, table->hash_fn(key));
+}
+
+/**
+ * @brief Migra até `buckets` buckets não vazios de old_buckets
+ *
+ * Como no dict do Redis, visita no máximo HASH_REHASH_EMPTY_VISITS
+ * buckets vazios por bucket pedido, para que um passo tenha custo
+ * limitado mesmo em trechos esparsos. Os nós são religados (sem cópia).
+ * Ao terminar libera o array antigo.
+ */
+static void chain_migrate(HashTable *table, size_t buckets) {
+    size_t empty_visits = buckets > SIZE_MAX / HASH_REHASH_EMPTY_VISITS
+                        ? SIZE_MAX : buckets * HASH_REHASH_EMPTY_VISITS;
+
+    while (buckets > 0 && table->rehash_index < table->old_capacity) {
+        ChainNode *current = table->old_buckets[table->rehash_index];
+        if (current == NULL) {
+            table->rehash_index++;
+            if (--empty_visits == 0) {
+                break;
+            }
+            continue;
+        }
+
+        while (current != NULL) {
+            ChainNode *next = current->next;
+            size_t index = hash_primary(table, current->key);
+            current->next = table->buckets[index];
+            table->buckets[index] = current;
+            current = next;
+        }
+        table->old_buckets[table->rehash_index++] = NULL;
+        buckets--;
+    }
+
+    if (table->rehash_index == table->old_capacity) {
+        ds_free(&table->allocator, table->old_buckets,
+                table->old_capacity * sizeof(ChainNode*));
+        table->old_buckets = NULL;
+        table->old_capacity = 0;
+        table->rehash_index = 0;
+    }
+}
+
+/**
+ * @brief Inicia a migração para new_capacity buckets (a anterior deve ter terminado)
+ */
+static DataStructureError chain_start_migration(HashTable *table, size_t new_capacity) {
+    ChainNode **buckets = (ChainNode**)ds_calloc(&table->allocator, new_capacity,
+                                                 sizeof(ChainNode*));
+    if (buckets == NULL) {
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+
+    table->old_buckets = table->buckets;
+    table->old_capacity = table->capacity;
+    table->rehash_index = 0;
+    table->buckets = buckets;
+    table->capacity = new_capacity;
+    return DS_SUCCESS;
+}
+
 /**
  * @brief Destrói um nó de chain
  */
-static void chainnode_destroy(ChainNode *node, DestroyFn destroy_key, DestroyFn destroy_value) {
+static void chainnode_destroy(const HashTable *table, ChainNode *node) {
     if (node == NULL) {
         return;
     }
 
-    if (destroy_key != NULL) {
-        destroy_key(node->key);
+    if (table->destroy_key != NULL) {
+        table->destroy_key(node->key);
     }
-    if (destroy_value != NULL) {
-        destroy_value(node->value);
+    if (table->destroy_value != NULL) {
+        table->destroy_value(node->value);
     }
 
-    free(node->key);
-    free(node->value);
-    free(node);
+    ds_free(&table->allocator, node->key, table->key_size);
+    ds_free(&table->allocator, node->value, table->value_size);
+    ds_free(&table->allocator, node, sizeof(ChainNode));
 }
 
 // ============================================================================
@@ -229,18 +687,35 @@ HashTable* hashtable_create(size_t key_size, size_t value_size, size_t initial_c
                             HashFn hash_fn, CompareFn compare_fn,
                             CollisionStrategy strategy,
                             DestroyFn destroy_key, DestroyFn destroy_value) {
+    return hashtable_create_with_allocator(key_size, value_size, initial_capacity,
+                                           hash_fn, compare_fn, strategy,
+                                           destroy_key, destroy_value, NULL);
+}
+
+HashTable* hashtable_create_with_allocator(size_t key_size, size_t value_size,
+                                           size_t initial_capacity,
+                                           HashFn hash_fn, CompareFn compare_fn,
+                                           CollisionStrategy strategy,
+                                           DestroyFn destroy_key, DestroyFn destroy_value,
+                                           const DSAllocator *allocator) {
     if (key_size == 0 || value_size == 0 || hash_fn == NULL || compare_fn == NULL) {
         return NULL;
     }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
 
-    HashTable *table = (HashTable*)malloc(sizeof(HashTable));
+    HashTable *table = (HashTable*)ds_alloc(allocator, sizeof(HashTable));
     if (table == NULL) {
         return NULL;
     }
 
-    // Capacidade deve ser prima
-    size_t capacity = next_prime(initial_capacity > 0 ? initial_capacity : 17);
+    // Capacidade deve ser prima (potência de 2 para HASH_FLAT)
+    size_t capacity = (strategy == HASH_FLAT)
+                    ? flat_next_pow2(initial_capacity)
+                    : next_prime(initial_capacity > 0 ? initial_capacity : 17);
 
+    table->allocator = *allocator;
     table->key_size = key_size;
     table->value_size = value_size;
     table->size = 0;
@@ -250,21 +725,49 @@ HashTable* hashtable_create(size_t key_size, size_t value_size, size_t initial_c
     table->compare_fn = compare_fn;
     table->destroy_key = destroy_key;
     table->destroy_value = destroy_value;
+    table->ctrl = NULL;
+    table->slots = NULL;
+    table->slot_size = 0;
+    table->value_offset = 0;
+    table->tombstones = 0;
+    table->old_buckets = NULL;
+    table->old_capacity = 0;
+    table->rehash_index = 0;
+    table->rehash_step = 0;
+
+    if (strategy == HASH_FLAT) {
+        size_t key_align = flat_field_align(key_size);
+        size_t value_align = flat_field_align(value_size);
+        table->value_offset = flat_round_up(key_size, value_align);
+        table->slot_size = flat_round_up(table->value_offset + value_size,
+                                         key_align > value_align ? key_align : value_align);
+        table->buckets = NULL;
+        table->entries = NULL;
+        table->oa_state = NULL;
 
-    if (strategy == HASH_CHAINING) {
-        table->buckets = (ChainNode**)calloc(capacity, sizeof(ChainNode*));
+        if (flat_alloc(table, capacity) != DS_SUCCESS) {
+            ds_free(allocator, table, sizeof(HashTable));
+            return NULL;
+        }
+    } else if (strategy == HASH_CHAINING) {
+        table->buckets = (ChainNode**)ds_calloc(allocator, capacity, sizeof(ChainNode*));
         table->entries = NULL;
+        table->oa_state = NULL;
 
         if (table->buckets == NULL) {
-            free(table);
+            ds_free(allocator, table, sizeof(HashTable));
             return NULL;
         }
     } else {
         table->buckets = NULL;
-        table->entries = (OpenAddressEntry*)calloc(capacity, sizeof(OpenAddressEntry));
-
-        if (table->entries == NULL) {
-            free(table);
+        table->entries = (OpenAddressEntry*)ds_calloc(allocator, capacity,
+                                                      sizeof(OpenAddressEntry));
+        table->oa_state = (uint8_t*)ds_calloc(allocator, capacity, sizeof(uint8_t));
+
+        if (table->entries == NULL || table->oa_state == NULL) {
+            ds_free(allocator, table->entries, capacity * sizeof(OpenAddressEntry));
+            ds_free(allocator, table->oa_state, capacity * sizeof(uint8_t));
+            ds_free(allocator, table, sizeof(HashTable));
             return NULL;
         }
     }
@@ -279,13 +782,18 @@ void hashtable_destroy(HashTable *table) {
 
     hashtable_clear(table);
 
-    if (table->strategy == HASH_CHAINING) {
-        free(table->buckets);
+    if (table->strategy == HASH_FLAT) {
+        flat_release(table, table->ctrl, table->slots, table->capacity);
+    } else if (table->strategy == HASH_CHAINING) {
+        ds_free(&table->allocator, table->buckets, table->capacity * sizeof(ChainNode*));
     } else {
-        free(table->entries);
+        ds_free(&table->allocator, table->entries,
+                table->capacity * sizeof(OpenAddressEntry));
+        ds_free(&table->allocator, table->oa_state, table->capacity * sizeof(uint8_t));
     }
 
-    free(table);
+    DSAllocator allocator = table->allocator;
+    ds_free(&allocator, table, sizeof(HashTable));
 }
 
 // ============================================================================
@@ -299,29 +807,26 @@ void hashtable_destroy(HashTable *table) {
  * CHAINED-HASH-INSERT(T, x)
  *   insert x at the head of list T[h(x.key)]
  */
-static DataStructureError hashtable_put_chaining(HashTable *table, const void *key, const void *value) {
-    size_t index = hash_primary(table, key);
-
-    // Verificar se chave já existe
-    ChainNode *current = table->buckets[index];
-    while (current != NULL) {
-        if (table->compare_fn(current->key, key) == 0) {
-            // Atualizar valor existente
-            if (table->destroy_value != NULL) {
-                table->destroy_value(current->value);
-            }
-            memcpy(current->value, value, table->value_size);
-            return DS_SUCCESS;
+static DataStructureError hashtable_put_chaining_hashed(HashTable *table, const void *key,
+                                                        const void *value, size_t h) {
+    // Verificar se chave já existe (nas duas tabelas, se migrando)
+    ChainNode **link = chain_find_link_hashed(table, key, h);
+    if (link != NULL) {
+        // Atualizar valor existente
+        if (table->destroy_value != NULL) {
+            table->destroy_value((*link)->value);
         }
-        current = current->next;
+        memcpy((*link)->value, value, table->value_size);
+        return DS_SUCCESS;
     }
 
-    // Inserir novo nó no início da lista
+    // Inserir novo nó no início da lista (sempre na tabela nova)
     ChainNode *new_node = chainnode_create(table, key, value);
     if (new_node == NULL) {
         return DS_ERROR_OUT_OF_MEMORY;
     }
 
+    size_t index = h % table->capacity;
     new_node->next = table->buckets[index];
     table->buckets[index] = new_node;
     table->size++;
@@ -329,59 +834,48 @@ static DataStructureError hashtable_put_chaining(HashTable *table, const void *k
     return DS_SUCCESS;
 }
 
+static DataStructureError hashtable_put_chaining(HashTable *table, const void *key, const void *value) {
+    return hashtable_put_chaining_hashed(table, key, value, table->hash_fn(key));
+}
+
 /**
  * @brief Busca em chaining
  */
 static DataStructureError hashtable_get_chaining(const HashTable *table, const void *key, void *value) {
-    size_t index = hash_primary(table, key);
-
-    ChainNode *current = table->buckets[index];
-    while (current != NULL) {
-        if (table->compare_fn(current->key, key) == 0) {
-            if (value != NULL) {
-                memcpy(value, current->value, table->value_size);
-            }
-            return DS_SUCCESS;
-        }
-        current = current->next;
+    ChainNode **link = chain_find_link(table, key);
+    if (link == NULL) {
+        return DS_ERROR_NOT_FOUND;
     }
 
-    return DS_ERROR_NOT_FOUND;
+    if (value != NULL) {
+        memcpy(value, (*link)->value, table->value_size);
+    }
+    return DS_SUCCESS;
 }
 
 /**
  * @brief Remove em chaining
  */
 static DataStructureError hashtable_remove_chaining(HashTable *table, const void *key, void *old_value) {
-    size_t index = hash_primary(table, key);
-
-    ChainNode *current = table->buckets[index];
-    ChainNode *prev = NULL;
-
-    while (current != NULL) {
-        if (table->compare_fn(current->key, key) == 0) {
-            // Encontrado
-            if (old_value != NULL) {
-                memcpy(old_value, current->value, table->value_size);
-            }
-
-            // Remover da lista
-            if (prev == NULL) {
-                table->buckets[index] = current->next;
-            } else {
-                prev->next = current->next;
-            }
+    if (table->old_buckets != NULL) {
+        chain_migrate(table, table->rehash_step);
+    }
 
-            chainnode_destroy(current, table->destroy_key, table->destroy_value);
-            table->size--;
-            return DS_SUCCESS;
-        }
+    ChainNode **link = chain_find_link(table, key);
+    if (link == NULL) {
+        return DS_ERROR_NOT_FOUND;
+    }
 
-        prev = current;
-        current = current->next;
+    ChainNode *current = *link;
+    if (old_value != NULL) {
+        memcpy(old_value, current->value, table->value_size);
     }
 
-    return DS_ERROR_NOT_FOUND;
+    // Remover da lista
+    *link = current->next;
+    chainnode_destroy(table, current);
+    table->size--;
+    return DS_SUCCESS;
 }
 
 // ============================================================================
@@ -402,29 +896,29 @@ static DataStructureError hashtable_remove_chaining(HashTable *table, const void
  *       else i = i + 1
  *   until i == m
  */
-static DataStructureError hashtable_put_open(HashTable *table, const void *key, const void *value) {
+static DataStructureError hashtable_put_open_hashed(HashTable *table, const void *key,
+                                                    const void *value, size_t h) {
     // Verificar se chave já existe ou encontrar slot vazio
     for (size_t i = 0; i < table->capacity; i++) {
-        size_t index = probe_index(table, key, i);
+        size_t index = probe_index_hashed(table, h, i);
         OpenAddressEntry *entry = &table->entries[index];
 
-        if (!entry->occupied || entry->deleted) {
+        if (table->oa_state[index] != OA_LIVE) {
             // Slot disponível: vazio ou deletado
-            if (!entry->occupied) {
-                entry->key = malloc(table->key_size);
-                entry->value = malloc(table->value_size);
+            if (table->oa_state[index] == OA_EMPTY) {
+                entry->key = ds_alloc(&table->allocator, table->key_size);
+                entry->value = ds_alloc(&table->allocator, table->value_size);
 
                 if (entry->key == NULL || entry->value == NULL) {
-                    free(entry->key);
-                    free(entry->value);
+                    ds_free(&table->allocator, entry->key, table->key_size);
+                    ds_free(&table->allocator, entry->value, table->value_size);
                     return DS_ERROR_OUT_OF_MEMORY;
                 }
             }
 
             memcpy(entry->key, key, table->key_size);
             memcpy(entry->value, value, table->value_size);
-            entry->occupied = true;
-            entry->deleted = false;
+            table->oa_state[index] = OA_LIVE;
             table->size++;
             return DS_SUCCESS;
         }
@@ -443,29 +937,42 @@ static DataStructureError hashtable_put_open(HashTable *table, const void *key,
     return DS_ERROR_FULL;
 }
 
+static DataStructureError hashtable_put_open(HashTable *table, const void *key, const void *value) {
+    return hashtable_put_open_hashed(table, key, value, table->hash_fn(key));
+}
+
 /**
- * @brief Busca em open addressing
+ * @brief Índice da chave em open addressing, ou SIZE_MAX se ausente
  */
-static DataStructureError hashtable_get_open(const HashTable *table, const void *key, void *value) {
+static size_t open_find_hashed(const HashTable *table, const void *key, size_t h) {
     for (size_t i = 0; i < table->capacity; i++) {
-        size_t index = probe_index(table, key, i);
-        const OpenAddressEntry *entry = &table->entries[index];
+        size_t index = probe_index_hashed(table, h, i);
+        uint8_t state = table->oa_state[index];
 
-        if (!entry->occupied && !entry->deleted) {
-            // Slot vazio: chave não existe
-            return DS_ERROR_NOT_FOUND;
+        if (state == OA_EMPTY) {
+            break;
         }
 
-        if (entry->occupied && !entry->deleted &&
-            table->compare_fn(entry->key, key) == 0) {
-            if (value != NULL) {
-                memcpy(value, entry->value, table->value_size);
-            }
-            return DS_SUCCESS;
+        if (state == OA_LIVE && table->compare_fn(table->entries[index].key, key) == 0) {
+            return index;
         }
     }
+    return SIZE_MAX;
+}
 
-    return DS_ERROR_NOT_FOUND;
+/**
+ * @brief Busca em open addressing
+ */
+static DataStructureError hashtable_get_open(const HashTable *table, const void *key, void *value) {
+    size_t index = open_find_hashed(table, key, table->hash_fn(key));
+    if (index == SIZE_MAX) {
+        return DS_ERROR_NOT_FOUND;
+    }
+
+    if (value != NULL) {
+        memcpy(value, table->entries[index].value, table->value_size);
+    }
+    return DS_SUCCESS;
 }
 
 /**
@@ -478,18 +985,18 @@ static DataStructureError hashtable_remove_open(HashTable *table, const void *ke
         size_t index = probe_index(table, key, i);
         OpenAddressEntry *entry = &table->entries[index];
 
-        if (!entry->occupied && !entry->deleted) {
+        if (table->oa_state[index] == OA_EMPTY) {
             return DS_ERROR_NOT_FOUND;
         }
 
-        if (entry->occupied && !entry->deleted &&
+        if (table->oa_state[index] == OA_LIVE &&
             table->compare_fn(entry->key, key) == 0) {
             if (old_value != NULL) {
                 memcpy(old_value, entry->value, table->value_size);
             }
 
             // Lazy deletion
-            entry->deleted = true;
+            table->oa_state[index] = OA_DELETED;
             table->size--;
             return DS_SUCCESS;
         }
@@ -507,10 +1014,43 @@ DataStructureError hashtable_put(HashTable *table, const void *key, const void *
         return DS_ERROR_NULL_POINTER;
     }
 
+    if (table->strategy == HASH_FLAT) {
+        if (flat_needs_grow(table) && flat_find(table, key, NULL) == SIZE_MAX) {
+            // Muitos DELETED: rehash na mesma capacidade basta para limpá-los
+            size_t new_capacity = (table->size + 1) * 2 * FLAT_MAX_LOAD_DEN >
+                                  table->capacity * FLAT_MAX_LOAD_NUM
+                                ? table->capacity * 2 : table->capacity;
+            DataStructureError err = hashtable_rehash(table, new_capacity);
+            if (err != DS_SUCCESS) {
+                return err;
+            }
+        }
+        return hashtable_put_flat(table, key, value);
+    }
+
     // Verificar se precisa rehash
     double load = hashtable_load_factor(table);
     double threshold = (table->strategy == HASH_CHAINING) ? 0.75 : 0.5;
 
+    if (table->strategy == HASH_CHAINING && table->rehash_step > 0) {
+        if (table->old_buckets != NULL) {
+            chain_migrate(table, table->rehash_step);
+        }
+        if (load > threshold) {
+            // Crescimento mais rápido que a migração: termina a anterior
+            if (table->old_buckets != NULL) {
+                chain_migrate(table, SIZE_MAX);
+            }
+            DataStructureError err = chain_start_migration(table,
+                                                           next_prime(table->capacity * 2));
+            if (err != DS_SUCCESS) {
+                return err;
+            }
+            chain_migrate(table, table->rehash_step);
+        }
+        return hashtable_put_chaining(table, key, value);
+    }
+
     if (load > threshold) {
         size_t new_capacity = next_prime(table->capacity * 2);
         DataStructureError err = hashtable_rehash(table, new_capacity);
@@ -531,6 +1071,17 @@ DataStructureError hashtable_get(const HashTable *table, const void *key, void *
         return DS_ERROR_NULL_POINTER;
     }
 
+    if (table->strategy == HASH_FLAT) {
+        size_t index = flat_find(table, key, NULL);
+        if (index == SIZE_MAX) {
+            return DS_ERROR_NOT_FOUND;
+        }
+        if (value != NULL) {
+            memcpy(value, flat_slot_value(table, index), table->value_size);
+        }
+        return DS_SUCCESS;
+    }
+
     if (table->strategy == HASH_CHAINING) {
         return hashtable_get_chaining(table, key, value);
     } else {
@@ -538,38 +1089,30 @@ DataStructureError hashtable_get(const HashTable *table, const void *key, void *
     }
 }
 
-void* hashtable_get_ptr(const HashTable *table, const void *key) {
-    if (table == NULL || key == NULL) {
-        return NULL;
+/**
+ * @brief Ponteiro para o valor da chave (qualquer estratégia), ou NULL
+ */
+static void* lookup_hashed(const HashTable *table, const void *key, size_t h) {
+    if (table->strategy == HASH_FLAT) {
+        size_t index = flat_find_hashed(table, key, flat_mix(h), NULL);
+        return (index == SIZE_MAX) ? NULL : flat_slot_value(table, index);
     }
 
     if (table->strategy == HASH_CHAINING) {
-        size_t index = hash_primary(table, key);
-        ChainNode *current = table->buckets[index];
+        ChainNode **link = chain_find_link_hashed(table, key, h);
+        return (link != NULL) ? (*link)->value : NULL;
+    }
 
-        while (current != NULL) {
-            if (table->compare_fn(current->key, key) == 0) {
-                return current->value;
-            }
-            current = current->next;
-        }
-    } else {
-        for (size_t i = 0; i < table->capacity; i++) {
-            size_t index = probe_index(table, key, i);
-            OpenAddressEntry *entry = &table->entries[index];
-
-            if (!entry->occupied && !entry->deleted) {
-                break;
-            }
+    size_t index = open_find_hashed(table, key, h);
+    return (index == SIZE_MAX) ? NULL : table->entries[index].value;
+}
 
-            if (entry->occupied && !entry->deleted &&
-                table->compare_fn(entry->key, key) == 0) {
-                return entry->value;
-            }
-        }
+void* hashtable_get_ptr(const HashTable *table, const void *key) {
+    if (table == NULL || key == NULL) {
+        return NULL;
     }
 
-    return NULL;
+    return lookup_hashed(table, key, table->hash_fn(key));
 }
 
 DataStructureError hashtable_remove(HashTable *table, const void *key, void *old_value) {
@@ -577,6 +1120,10 @@ DataStructureError hashtable_remove(HashTable *table, const void *key, void *old
         return DS_ERROR_NULL_POINTER;
     }
 
+    if (table->strategy == HASH_FLAT) {
+        return hashtable_remove_flat(table, key, old_value);
+    }
+
     if (table->strategy == HASH_CHAINING) {
         return hashtable_remove_chaining(table, key, old_value);
     } else {
@@ -588,6 +1135,183 @@ bool hashtable_contains(const HashTable *table, const void *key) {
     return (hashtable_get(table, key, NULL) == DS_SUCCESS);
 }
 
+// ============================================================================
+// OPERAÇÕES EM LOTE (PREFETCH)
+// ============================================================================
+
+/** Chaves por grupo: hash, prefetch e resolução andam grupo a grupo */
+#define HASH_BATCH_WIDTH 16
+
+/** Níveis de indireção pré-carregados (bucket -> nó -> chave em chaining) */
+#define HASH_BATCH_STAGES 3
+
+/**
+ * @brief Pré-carrega o nível `stage` do caminho de busca de h
+ *
+ * Cada nível só lê o que o anterior já trouxe para o cache, então os
+ * HASH_BATCH_WIDTH misses de um nível ficam em voo ao mesmo tempo.
+ */
+static void batch_prefetch(const HashTable *table, size_t h, int stage) {
+    if (table->strategy == HASH_FLAT) {
+        if (stage == 0) {
+            size_t base = (flat_mix(h) & (table->capacity - 1)) & ~(size_t)(FLAT_GROUP_WIDTH - 1);
+            HASH_PREFETCH(table->ctrl + base);
+            HASH_PREFETCH(flat_slot_key(table, base));
+        }
+        return;
+    }
+
+    if (table->strategy == HASH_CHAINING) {
+        ChainNode *const *bucket = &table->buckets[h % table->capacity];
+        if (stage == 0) {
+            HASH_PREFETCH(bucket);
+            if (table->old_buckets != NULL) {
+                HASH_PREFETCH(&table->old_buckets[h % table->old_capacity]);
+            }
+        } else if (*bucket != NULL) {
+            if (stage == 1) {
+                HASH_PREFETCH(*bucket);
+            } else {
+                HASH_PREFETCH((*bucket)->key);
+            }
+        }
+        return;
+    }
+
+    size_t index = h % table->capacity;
+    const OpenAddressEntry *entry = &table->entries[index];
+    if (stage == 0) {
+        HASH_PREFETCH(entry);
+        HASH_PREFETCH(&table->oa_state[index]);
+    } else if (stage == 1 && table->oa_state[index] != OA_EMPTY) {
+        HASH_PREFETCH(entry->key);
+    }
+}
+
+/**
+ * @brief Calcula os hashes de um grupo e pré-carrega seus caminhos
+ */
+static void batch_prepare(const HashTable *table, const unsigned char *keys, size_t width,
+                          size_t *hashes) {
+    for (size_t j = 0; j < width; j++) {
+        hashes[j] = table->hash_fn(keys + j * table->key_size);
+    }
+    for (int stage = 0; stage < HASH_BATCH_STAGES; stage++) {
+        for (size_t j = 0; j < width; j++) {
+            batch_prefetch(table, hashes[j], stage);
+        }
+    }
+}
+
+/**
+ * @brief Garante capacidade para n inserções sem rehash no meio do lote
+ *
+ * Usa os mesmos limites de hashtable_put (0.75 chaining, 0.5 open
+ * addressing, 0.875 HASH_FLAT contando DELETED), supondo chaves novas.
+ */
+static DataStructureError batch_reserve(HashTable *table, size_t n) {
+    if (n > SIZE_MAX / 4 - table->size) {
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+    size_t total = table->size + n;
+
+    if (table->strategy == HASH_FLAT) {
+        if ((total + table->tombstones) * FLAT_MAX_LOAD_DEN > table->capacity * FLAT_MAX_LOAD_NUM) {
+            return hashtable_rehash(table, total * FLAT_MAX_LOAD_DEN / FLAT_MAX_LOAD_NUM + 1);
+        }
+        return DS_SUCCESS;
+    }
+
+    size_t needed = (table->strategy == HASH_CHAINING) ? total + total / 3 + 1 : 2 * total + 1;
+    return (needed > table->capacity) ? hashtable_rehash(table, needed) : DS_SUCCESS;
+}
+
+DataStructureError hashtable_get_batch(const HashTable *table, const void *keys, size_t n,
+                                       void *values, bool *found) {
+    if (table == NULL || (n > 0 && keys == NULL)) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    const unsigned char *key_bytes = (const unsigned char*)keys;
+    unsigned char *value_bytes = (unsigned char*)values;
+    size_t hashes[HASH_BATCH_WIDTH];
+    size_t missing = 0;
+
+    for (size_t start = 0; start < n; start += HASH_BATCH_WIDTH) {
+        size_t width = (n - start < HASH_BATCH_WIDTH) ? n - start : HASH_BATCH_WIDTH;
+        const unsigned char *group = key_bytes + start * table->key_size;
+        batch_prepare(table, group, width, hashes);
+
+        for (size_t j = 0; j < width; j++) {
+            const void *value = lookup_hashed(table, group + j * table->key_size, hashes[j]);
+            if (found != NULL) {
+                found[start + j] = (value != NULL);
+            }
+            if (value == NULL) {
+                missing++;
+            } else if (value_bytes != NULL) {
+                memcpy(value_bytes + (start + j) * table->value_size, value, table->value_size);
+            }
+        }
+    }
+
+    return (missing == 0) ? DS_SUCCESS : DS_ERROR_NOT_FOUND;
+}
+
+DataStructureError hashtable_put_batch(HashTable *table, const void *keys, const void *values,
+                                       size_t n) {
+    if (table == NULL || (n > 0 && (keys == NULL || values == NULL))) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (n == 0) {
+        return DS_SUCCESS;
+    }
+
+    const unsigned char *key_bytes = (const unsigned char*)keys;
+    const unsigned char *value_bytes = (const unsigned char*)values;
+
+    // Reservar faria um rehash bloqueante: mantém a migração incremental
+    if (table->strategy == HASH_CHAINING && table->rehash_step > 0) {
+        for (size_t i = 0; i < n; i++) {
+            DataStructureError err = hashtable_put(table, key_bytes + i * table->key_size,
+                                                   value_bytes + i * table->value_size);
+            if (err != DS_SUCCESS) {
+                return err;
+            }
+        }
+        return DS_SUCCESS;
+    }
+
+    DataStructureError err = batch_reserve(table, n);
+    if (err != DS_SUCCESS) {
+        return err;
+    }
+
+    size_t hashes[HASH_BATCH_WIDTH];
+    for (size_t start = 0; start < n; start += HASH_BATCH_WIDTH) {
+        size_t width = (n - start < HASH_BATCH_WIDTH) ? n - start : HASH_BATCH_WIDTH;
+        const unsigned char *group = key_bytes + start * table->key_size;
+        batch_prepare(table, group, width, hashes);
+
+        for (size_t j = 0; j < width; j++) {
+            const void *key = group + j * table->key_size;
+            const void *value = value_bytes + (start + j) * table->value_size;
+            if (table->strategy == HASH_FLAT) {
+                err = hashtable_put_flat_hashed(table, key, value, flat_mix(hashes[j]));
+            } else if (table->strategy == HASH_CHAINING) {
+                err = hashtable_put_chaining_hashed(table, key, value, hashes[j]);
+            } else {
+                err = hashtable_put_open_hashed(table, key, value, hashes[j]);
+            }
+            if (err != DS_SUCCESS) {
+                return err;
+            }
+        }
+    }
+
+    return DS_SUCCESS;
+}
+
 // ============================================================================
 // CONSULTAS
 // ============================================================================
@@ -611,35 +1335,76 @@ double hashtable_load_factor(const HashTable *table) {
     return (double)table->size / (double)table->capacity;
 }
 
+size_t hashtable_memory_usage(const HashTable *table) {
+    if (table == NULL) {
+        return 0;
+    }
+
+    size_t bytes = sizeof(HashTable);
+    size_t pair = table->key_size + table->value_size;
+    if (table->strategy == HASH_FLAT) {
+        bytes += table->capacity * (1 + table->slot_size);
+    } else if (table->strategy == HASH_CHAINING) {
+        bytes += (table->capacity + table->old_capacity) * sizeof(ChainNode*);
+        bytes += table->size * (sizeof(ChainNode) + pair);
+    } else {
+        bytes += table->capacity * (sizeof(OpenAddressEntry) + sizeof(uint8_t));
+        for (size_t i = 0; i < table->capacity; i++) {
+            if (table->oa_state[i] != OA_EMPTY) {
+                bytes += pair;   // lápides mantêm os buffers até o rehash
+            }
+        }
+    }
+    return bytes;
+}
+
 void hashtable_clear(HashTable *table) {
     if (table == NULL) {
         return;
     }
 
-    if (table->strategy == HASH_CHAINING) {
+    if (table->strategy == HASH_FLAT) {
         for (size_t i = 0; i < table->capacity; i++) {
-            ChainNode *current = table->buckets[i];
+            if (flat_is_full(table->ctrl[i])) {
+                if (table->destroy_key != NULL) {
+                    table->destroy_key(flat_slot_key(table, i));
+                }
+                if (table->destroy_value != NULL) {
+                    table->destroy_value(flat_slot_value(table, i));
+                }
+            }
+        }
+        memset(table->ctrl, FLAT_CTRL_EMPTY, table->capacity);
+        table->tombstones = 0;
+    } else if (table->strategy == HASH_CHAINING) {
+        for (size_t i = 0; i < chain_total_buckets(table); i++) {
+            ChainNode **bucket = chain_bucket_ref(table, i);
+            ChainNode *current = *bucket;
             while (current != NULL) {
                 ChainNode *next = current->next;
-                chainnode_destroy(current, table->destroy_key, table->destroy_value);
+                chainnode_destroy(table, current);
                 current = next;
             }
-            table->buckets[i] = NULL;
+            *bucket = NULL;
+        }
+        if (table->old_buckets != NULL) {
+            // Todos os buckets antigos já estão vazios: encerra a migração
+            table->rehash_index = table->old_capacity;
+            chain_migrate(table, 0);
         }
     } else {
         for (size_t i = 0; i < table->capacity; i++) {
             OpenAddressEntry *entry = &table->entries[i];
-            if (entry->occupied) {
+            if (table->oa_state[i] != OA_EMPTY) {
                 if (table->destroy_key != NULL) {
                     table->destroy_key(entry->key);
                 }
                 if (table->destroy_value != NULL) {
                     table->destroy_value(entry->value);
                 }
-                free(entry->key);
-                free(entry->value);
-                entry->occupied = false;
-                entry->deleted = false;
+                ds_free(&table->allocator, entry->key, table->key_size);
+                ds_free(&table->allocator, entry->value, table->value_size);
+                table->oa_state[i] = OA_EMPTY;
             }
         }
     }
@@ -655,12 +1420,56 @@ DataStructureError hashtable_rehash(HashTable *table, size_t new_capacity) {
     if (table == NULL) {
         return DS_ERROR_NULL_POINTER;
     }
+    DS_TIMER_SCOPE(HASH_REHASH);
+    DS_COUNT(HASH_TABLE, REHASHES, 1);
+
+    if (table->strategy == HASH_FLAT) {
+        // Nunca abaixo do necessário para manter load <= 0.875
+        size_t min_capacity = (table->size * FLAT_MAX_LOAD_DEN) / FLAT_MAX_LOAD_NUM + 1;
+        new_capacity = flat_next_pow2(new_capacity > min_capacity ? new_capacity : min_capacity);
+
+        uint8_t *old_ctrl = table->ctrl;
+        unsigned char *old_slots = table->slots;
+        size_t old_capacity = table->capacity;
+        size_t old_tombstones = table->tombstones;
+        size_t old_size = table->size;
+
+        if (flat_alloc(table, new_capacity) != DS_SUCCESS) {
+            return DS_ERROR_OUT_OF_MEMORY;
+        }
+        table->size = 0;
+
+        // Slots são copiados byte a byte: nada a destruir nos antigos
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (flat_is_full(old_ctrl[i])) {
+                unsigned char *slot = old_slots + i * table->slot_size;
+                if (hashtable_put_flat(table, slot, slot + table->value_offset) != DS_SUCCESS) {
+                    flat_release(table, table->ctrl, table->slots, table->capacity);
+                    table->ctrl = old_ctrl;
+                    table->slots = old_slots;
+                    table->capacity = old_capacity;
+                    table->tombstones = old_tombstones;
+                    table->size = old_size;
+                    return DS_ERROR_OUT_OF_MEMORY;
+                }
+            }
+        }
+
+        flat_release(table, old_ctrl, old_slots, old_capacity);
+        return DS_SUCCESS;
+    }
 
     new_capacity = next_prime(new_capacity);
 
+    // Rehash explícito interrompe a migração incremental em andamento
+    if (table->old_buckets != NULL) {
+        chain_migrate(table, SIZE_MAX);
+    }
+
     // Salvar estado antigo
     ChainNode **old_buckets = table->buckets;
     OpenAddressEntry *old_entries = table->entries;
+    uint8_t *old_state = table->oa_state;
     size_t old_capacity = table->capacity;
 
     // Criar novo estado
@@ -668,57 +1477,100 @@ DataStructureError hashtable_rehash(HashTable *table, size_t new_capacity) {
     table->size = 0;
 
     if (table->strategy == HASH_CHAINING) {
-        table->buckets = (ChainNode**)calloc(new_capacity, sizeof(ChainNode*));
+        table->buckets = (ChainNode**)ds_calloc(&table->allocator, new_capacity,
+                                                sizeof(ChainNode*));
         if (table->buckets == NULL) {
             table->buckets = old_buckets;
             table->capacity = old_capacity;
             return DS_ERROR_OUT_OF_MEMORY;
         }
 
-        // Reinserir elementos
+        // Religar os nós existentes: nenhuma alocação nem cópia de chave/valor
         for (size_t i = 0; i < old_capacity; i++) {
             ChainNode *current = old_buckets[i];
             while (current != NULL) {
-                hashtable_put_chaining(table, current->key, current->value);
                 ChainNode *next = current->next;
-                chainnode_destroy(current, table->destroy_key, table->destroy_value);
+                size_t index = hash_primary(table, current->key);
+                current->next = table->buckets[index];
+                table->buckets[index] = current;
+                table->size++;
                 current = next;
             }
         }
 
-        free(old_buckets);
+        ds_free(&table->allocator, old_buckets, old_capacity * sizeof(ChainNode*));
 
     } else {
-        table->entries = (OpenAddressEntry*)calloc(new_capacity, sizeof(OpenAddressEntry));
-        if (table->entries == NULL) {
+        table->entries = (OpenAddressEntry*)ds_calloc(&table->allocator, new_capacity,
+                                                      sizeof(OpenAddressEntry));
+        table->oa_state = (uint8_t*)ds_calloc(&table->allocator, new_capacity, sizeof(uint8_t));
+        if (table->entries == NULL || table->oa_state == NULL) {
+            ds_free(&table->allocator, table->entries, new_capacity * sizeof(OpenAddressEntry));
+            ds_free(&table->allocator, table->oa_state, new_capacity * sizeof(uint8_t));
             table->entries = old_entries;
+            table->oa_state = old_state;
             table->capacity = old_capacity;
             return DS_ERROR_OUT_OF_MEMORY;
         }
 
-        // Reinserir elementos
+        // Mover entradas vivas: os buffers de chave/valor trocam de slot
         for (size_t i = 0; i < old_capacity; i++) {
             OpenAddressEntry *entry = &old_entries[i];
-            if (entry->occupied && !entry->deleted) {
-                hashtable_put_open(table, entry->key, entry->value);
+            if (old_state[i] == OA_EMPTY) continue;
 
-                if (table->destroy_key != NULL) {
-                    table->destroy_key(entry->key);
-                }
-                if (table->destroy_value != NULL) {
-                    table->destroy_value(entry->value);
+            if (old_state[i] == OA_DELETED) {
+                ds_free(&table->allocator, entry->key, table->key_size);
+                ds_free(&table->allocator, entry->value, table->value_size);
+                continue;
+            }
+
+            size_t h = table->hash_fn(entry->key);
+            for (size_t probe = 0; probe < new_capacity; probe++) {
+                size_t index = probe_index_hashed(table, h, probe);
+                if (table->oa_state[index] == OA_EMPTY) {
+                    table->entries[index] = *entry;
+                    table->oa_state[index] = OA_LIVE;
+                    table->size++;
+                    break;
                 }
-                free(entry->key);
-                free(entry->value);
             }
         }
 
-        free(old_entries);
+        ds_free(&table->allocator, old_entries, old_capacity * sizeof(OpenAddressEntry));
+        ds_free(&table->allocator, old_state, old_capacity * sizeof(uint8_t));
+    }
+
+    return DS_SUCCESS;
+}
+
+DataStructureError hashtable_set_incremental_rehash(HashTable *table, size_t buckets_per_step) {
+    if (table == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (buckets_per_step > 0 && table->strategy != HASH_CHAINING) {
+        return DS_ERROR_INVALID_PARAM;
     }
 
+    if (buckets_per_step == 0 && table->old_buckets != NULL) {
+        chain_migrate(table, SIZE_MAX);
+    }
+    table->rehash_step = buckets_per_step;
     return DS_SUCCESS;
 }
 
+bool hashtable_is_rehashing(const HashTable *table) {
+    return table != NULL && table->old_buckets != NULL;
+}
+
+bool hashtable_rehash_step(HashTable *table, size_t buckets) {
+    if (table == NULL || table->old_buckets == NULL) {
+        return false;
+    }
+
+    chain_migrate(table, buckets);
+    return table->old_buckets != NULL;
+}
+
 // ============================================================================
 // ITERADOR
 // ============================================================================
@@ -739,9 +1591,10 @@ HashTableIterator* hashtable_iterator(const HashTable *table) {
 
     // Para chaining, posicionar no primeiro nó não-vazio
     if (table->strategy == HASH_CHAINING) {
-        while (iter->current_bucket < table->capacity) {
-            if (table->buckets[iter->current_bucket] != NULL) {
-                iter->current_node = table->buckets[iter->current_bucket];
+        while (iter->current_bucket < chain_total_buckets(table)) {
+            ChainNode *head = *chain_bucket_ref(table, iter->current_bucket);
+            if (head != NULL) {
+                iter->current_node = head;
                 break;
             }
             iter->current_bucket++;
@@ -756,13 +1609,19 @@ bool hashtable_iterator_has_next(HashTableIterator *iter) {
         return false;
     }
 
-    if (iter->table->strategy == HASH_CHAINING) {
-        return (iter->current_bucket < iter->table->capacity);
+    if (iter->table->strategy == HASH_FLAT) {
+        for (size_t i = iter->current_bucket; i < iter->table->capacity; i++) {
+            if (flat_is_full(iter->table->ctrl[i])) {
+                return true;
+            }
+        }
+        return false;
+    } else if (iter->table->strategy == HASH_CHAINING) {
+        return (iter->current_bucket < chain_total_buckets(iter->table));
     } else {
         // Open addressing: encontrar próximo slot ocupado
         for (size_t i = iter->current_bucket; i < iter->table->capacity; i++) {
-            const OpenAddressEntry *entry = &iter->table->entries[i];
-            if (entry->occupied && !entry->deleted) {
+            if (iter->table->oa_state[i] == OA_LIVE) {
                 return true;
             }
         }
@@ -775,7 +1634,16 @@ HashTableEntry* hashtable_iterator_next(HashTableIterator *iter) {
         return NULL;
     }
 
-    if (iter->table->strategy == HASH_CHAINING) {
+    if (iter->table->strategy == HASH_FLAT) {
+        for (size_t i = iter->current_bucket; i < iter->table->capacity; i++) {
+            if (flat_is_full(iter->table->ctrl[i])) {
+                iter->entry.key = flat_slot_key(iter->table, i);
+                iter->entry.value = flat_slot_value(iter->table, i);
+                iter->current_bucket = i + 1;
+                return &iter->entry;
+            }
+        }
+    } else if (iter->table->strategy == HASH_CHAINING) {
         if (iter->current_node != NULL) {
             iter->entry.key = iter->current_node->key;
             iter->entry.value = iter->current_node->value;
@@ -786,9 +1654,10 @@ HashTableEntry* hashtable_iterator_next(HashTableIterator *iter) {
             // Se fim da chain, próximo bucket
             if (iter->current_node == NULL) {
                 iter->current_bucket++;
-                while (iter->current_bucket < iter->table->capacity) {
-                    if (iter->table->buckets[iter->current_bucket] != NULL) {
-                        iter->current_node = iter->table->buckets[iter->current_bucket];
+                while (iter->current_bucket < chain_total_buckets(iter->table)) {
+                    ChainNode *head = *chain_bucket_ref(iter->table, iter->current_bucket);
+                    if (head != NULL) {
+                        iter->current_node = head;
                         break;
                     }
                     iter->current_bucket++;
@@ -802,7 +1671,7 @@ HashTableEntry* hashtable_iterator_next(HashTableIterator *iter) {
         // Open addressing
         for (size_t i = iter->current_bucket; i < iter->table->capacity; i++) {
             const OpenAddressEntry *entry = &iter->table->entries[i];
-            if (entry->occupied && !entry->deleted) {
+            if (iter->table->oa_state[i] == OA_LIVE) {
                 iter->entry.key = entry->key;
                 iter->entry.value = entry->value;
                 iter->current_bucket = i + 1;
@@ -833,9 +1702,22 @@ HashTableStats hashtable_stats(const HashTable *table) {
     stats.capacity = table->capacity;
     stats.load_factor = hashtable_load_factor(table);
 
-    if (table->strategy == HASH_CHAINING) {
+    if (table->strategy == HASH_FLAT) {
+        // Colisão = elemento fora do seu grupo inicial
         for (size_t i = 0; i < table->capacity; i++) {
-            ChainNode *current = table->buckets[i];
+            if (table->ctrl[i] == FLAT_CTRL_EMPTY) {
+                stats.empty_buckets++;
+            } else if (flat_is_full(table->ctrl[i])) {
+                size_t home = flat_mix(table->hash_fn(flat_slot_key(table, i))) &
+                              (table->capacity - 1);
+                if (home / FLAT_GROUP_WIDTH != i / FLAT_GROUP_WIDTH) {
+                    stats.collisions++;
+                }
+            }
+        }
+    } else if (table->strategy == HASH_CHAINING) {
+        for (size_t i = 0; i < chain_total_buckets(table); i++) {
+            ChainNode *current = *chain_bucket_ref(table, i);
             size_t chain_length = 0;
 
             while (current != NULL) {
@@ -855,7 +1737,7 @@ HashTableStats hashtable_stats(const HashTable *table) {
         }
     } else {
         for (size_t i = 0; i < table->capacity; i++) {
-            if (!table->entries[i].occupied) {
+            if (table->oa_state[i] == OA_EMPTY) {
                 stats.empty_buckets++;
             }
         }
@@ -864,6 +1746,66 @@ HashTableStats hashtable_stats(const HashTable *table) {
     return stats;
 }
 
+/** Chamadas de hash_fn cronometradas no mínimo por hashtable_hash_quality */
+#define HASH_QUALITY_MIN_CALLS ((size_t)1 << 20)
+
+static double quality_now_ns(void) {
+    struct timespec ts = {0, 0};
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+DataStructureError hashtable_hash_quality(const void *keys, size_t count, size_t key_size,
+                                          HashFn hash_fn, CompareFn compare_fn,
+                                          size_t capacity, HashQualityReport *report) {
+    if (keys == NULL || hash_fn == NULL || compare_fn == NULL || report == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (count == 0 || key_size == 0) {
+        return DS_ERROR_INVALID_PARAM;
+    }
+
+    // Só a distribuição interessa: valor de um byte
+    HashTable *table = hashtable_create(key_size, 1, capacity ? capacity : count,
+                                        hash_fn, compare_fn, HASH_CHAINING, NULL, NULL);
+    if (table == NULL) {
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+
+    const unsigned char *bytes = (const unsigned char*)keys;
+    const unsigned char dummy = 0;
+    for (size_t i = 0; i < count; i++) {
+        DataStructureError err = hashtable_put(table, bytes + i * key_size, &dummy);
+        if (err != DS_SUCCESS) {
+            hashtable_destroy(table);
+            return err;
+        }
+    }
+    report->stats = hashtable_stats(table);
+    hashtable_destroy(table);
+
+    double n = (double)report->stats.size;
+    double m = (double)report->stats.capacity;
+    report->expected_empty_buckets = m * pow(1.0 - 1.0 / m, n);
+    report->expected_collisions = n - (m - report->expected_empty_buckets);
+
+    size_t rounds = (HASH_QUALITY_MIN_CALLS + count - 1) / count;
+    volatile size_t sink = 0;
+    double start = quality_now_ns();
+    for (size_t r = 0; r < rounds; r++) {
+        size_t acc = 0;
+        for (size_t i = 0; i < count; i++) {
+            acc ^= hash_fn(bytes + i * key_size);
+        }
+        sink ^= acc;
+    }
+    double elapsed = quality_now_ns() - start;
+    (void)sink;
+    report->ns_per_key = elapsed / ((double)rounds * (double)count);
+
+    return DS_SUCCESS;
+}
+
 // ============================================================================
 // KEYS E VALUES
 // ============================================================================
@@ -886,9 +1828,17 @@ DataStructureError hashtable_keys(const HashTable *table, void **keys, size_t *s
 
     size_t count = 0;
 
-    if (table->strategy == HASH_CHAINING) {
+    if (table->strategy == HASH_FLAT) {
         for (size_t i = 0; i < table->capacity; i++) {
-            ChainNode *current = table->buckets[i];
+            if (flat_is_full(table->ctrl[i])) {
+                void *dest = (char*)key_array + (count * table->key_size);
+                memcpy(dest, flat_slot_key(table, i), table->key_size);
+                count++;
+            }
+        }
+    } else if (table->strategy == HASH_CHAINING) {
+        for (size_t i = 0; i < chain_total_buckets(table); i++) {
+            ChainNode *current = *chain_bucket_ref(table, i);
             while (current != NULL) {
                 void *dest = (char*)key_array + (count * table->key_size);
                 memcpy(dest, current->key, table->key_size);
@@ -899,7 +1849,7 @@ DataStructureError hashtable_keys(const HashTable *table, void **keys, size_t *s
     } else {
         for (size_t i = 0; i < table->capacity; i++) {
             const OpenAddressEntry *entry = &table->entries[i];
-            if (entry->occupied && !entry->deleted) {
+            if (table->oa_state[i] == OA_LIVE) {
                 void *dest = (char*)key_array + (count * table->key_size);
                 memcpy(dest, entry->key, table->key_size);
                 count++;
@@ -930,9 +1880,17 @@ DataStructureError hashtable_values(const HashTable *table, void **values, size_
 
     size_t count = 0;
 
-    if (table->strategy == HASH_CHAINING) {
+    if (table->strategy == HASH_FLAT) {
         for (size_t i = 0; i < table->capacity; i++) {
-            ChainNode *current = table->buckets[i];
+            if (flat_is_full(table->ctrl[i])) {
+                void *dest = (char*)value_array + (count * table->value_size);
+                memcpy(dest, flat_slot_value(table, i), table->value_size);
+                count++;
+            }
+        }
+    } else if (table->strategy == HASH_CHAINING) {
+        for (size_t i = 0; i < chain_total_buckets(table); i++) {
+            ChainNode *current = *chain_bucket_ref(table, i);
             while (current != NULL) {
                 void *dest = (char*)value_array + (count * table->value_size);
                 memcpy(dest, current->value, table->value_size);
@@ -943,7 +1901,7 @@ DataStructureError hashtable_values(const HashTable *table, void **values, size_
     } else {
         for (size_t i = 0; i < table->capacity; i++) {
             const OpenAddressEntry *entry = &table->entries[i];
-            if (entry->occupied && !entry->deleted) {
+            if (table->oa_state[i] == OA_LIVE) {
                 void *dest = (char*)value_array + (count * table->value_size);
                 memcpy(dest, entry->value, table->value_size);
                 count++;
@@ -955,3 +1913,254 @@ DataStructureError hashtable_values(const HashTable *table, void **values, size_
     *size = count;
     return DS_SUCCESS;
 }
+
+// ============================================================================
+// TABELA HASH CONCORRENTE
+// ============================================================================
+
+/** Linha de cache usada para separar os segmentos */
+#define CHT_CACHE_LINE 64
+
+/** Capacidade inicial da HashTable de cada segmento */
+#define CHT_SEGMENT_CAPACITY 16
+
+/** Buckets migrados por escrita no rehash incremental de um segmento */
+#define CHT_REHASH_STEP 4
+
+/** Bit de escritor do lock; os bits abaixo contam leitores */
+#define CHT_WRITER 0x80000000u
+
+/** Voltas de espera ativa antes de ceder a CPU (dono do lock pode estar preemptado) */
+#define CHT_SPIN_LIMIT 64
+
+typedef struct {
+    _Alignas(CHT_CACHE_LINE) atomic_uint lock;
+    atomic_size_t size;     // Publicado após cada escrita, lido sem lock
+    HashTable *table;
+} CHTSegment;
+
+struct ConcurrentHashTable {
+    CHTSegment *segments;
+    size_t num_segments;
+    unsigned shift;         // 64 - log2(num_segments)
+    HashFn hash_fn;
+};
+
+static void cht_relax(unsigned *spins) {
+    if (++*spins < CHT_SPIN_LIMIT) {
+        return;
+    }
+    *spins = 0;
+#if defined(CHT_USE_SCHED_YIELD)
+    sched_yield();
+#endif
+}
+
+static void cht_read_lock(CHTSegment *segment) {
+    unsigned spins = 0;
+    for (;;) {
+        unsigned state = atomic_load_explicit(&segment->lock, memory_order_relaxed);
+        if ((state & CHT_WRITER) == 0 &&
+            atomic_compare_exchange_weak_explicit(&segment->lock, &state, state + 1,
+                                                  memory_order_acquire,
+                                                  memory_order_relaxed)) {
+            return;
+        }
+        cht_relax(&spins);
+    }
+}
+
+static void cht_read_unlock(CHTSegment *segment) {
+    atomic_fetch_sub_explicit(&segment->lock, 1, memory_order_release);
+}
+
+/**
+ * Marca o bit de escritor (barrando novos leitores) e espera os leitores
+ * que já estavam dentro saírem
+ */
+static void cht_write_lock(CHTSegment *segment) {
+    unsigned spins = 0;
+    for (;;) {
+        unsigned state = atomic_load_explicit(&segment->lock, memory_order_relaxed);
+        if ((state & CHT_WRITER) == 0 &&
+            atomic_compare_exchange_weak_explicit(&segment->lock, &state, state | CHT_WRITER,
+                                                  memory_order_acquire,
+                                                  memory_order_relaxed)) {
+            break;
+        }
+        cht_relax(&spins);
+    }
+    while (atomic_load_explicit(&segment->lock, memory_order_acquire) != CHT_WRITER) {
+        cht_relax(&spins);
+    }
+}
+
+static void cht_write_unlock(CHTSegment *segment) {
+    atomic_store_explicit(&segment->lock, 0, memory_order_release);
+}
+
+/**
+ * Segmento pelos bits altos do hash multiplicado pela constante de ouro:
+ * os bits baixos já escolhem o bucket dentro da HashTable do segmento
+ */
+static CHTSegment* cht_segment(const ConcurrentHashTable *table, const void *key) {
+    uint64_t mixed = (uint64_t)table->hash_fn(key) * 0x9E3779B97F4A7C15ULL;
+    size_t index = table->shift >= 64 ? 0 : (size_t)(mixed >> table->shift);
+    return &table->segments[index];
+}
+
+static void cht_free(ConcurrentHashTable *table, size_t created) {
+    for (size_t i = 0; i < created; i++) {
+        hashtable_destroy(table->segments[i].table);
+    }
+    free(table->segments);
+    free(table);
+}
+
+ConcurrentHashTable* cht_create(size_t key_size, size_t value_size, size_t num_segments,
+                                HashFn hash_fn, CompareFn compare_fn,
+                                DestroyFn destroy_key, DestroyFn destroy_value) {
+    if (key_size == 0 || value_size == 0 || hash_fn == NULL || compare_fn == NULL) {
+        return NULL;
+    }
+    if (num_segments == 0) {
+        num_segments = CHT_DEFAULT_SEGMENTS;
+    }
+    if (num_segments > ((size_t)1 << 20)) {
+        return NULL;
+    }
+
+    unsigned bits = 0;
+    while (((size_t)1 << bits) < num_segments) {
+        bits++;
+    }
+    num_segments = (size_t)1 << bits;
+
+    ConcurrentHashTable *table = (ConcurrentHashTable*)malloc(sizeof(ConcurrentHashTable));
+    if (table == NULL) {
+        return NULL;
+    }
+    // sizeof(CHTSegment) é múltiplo da linha de cache, como exige aligned_alloc
+    table->segments = (CHTSegment*)aligned_alloc(CHT_CACHE_LINE,
+                                                 num_segments * sizeof(CHTSegment));
+    if (table->segments == NULL) {
+        free(table);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < num_segments; i++) {
+        CHTSegment *segment = &table->segments[i];
+        segment->table = hashtable_create(key_size, value_size, CHT_SEGMENT_CAPACITY,
+                                          hash_fn, compare_fn, HASH_CHAINING,
+                                          destroy_key, destroy_value);
+        if (segment->table == NULL) {
+            cht_free(table, i);
+            return NULL;
+        }
+        hashtable_set_incremental_rehash(segment->table, CHT_REHASH_STEP);
+        atomic_init(&segment->lock, 0);
+        atomic_init(&segment->size, 0);
+    }
+
+    table->num_segments = num_segments;
+    table->shift = 64 - bits;
+    table->hash_fn = hash_fn;
+    return table;
+}
+
+void cht_destroy(ConcurrentHashTable *table) {
+    if (table == NULL) {
+        return;
+    }
+
+    cht_free(table, table->num_segments);
+}
+
+DataStructureError cht_put(ConcurrentHashTable *table, const void *key, const void *value) {
+    if (table == NULL || key == NULL || value == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    CHTSegment *segment = cht_segment(table, key);
+    cht_write_lock(segment);
+    DataStructureError err = hashtable_put(segment->table, key, value);
+    atomic_store_explicit(&segment->size, hashtable_size(segment->table),
+                          memory_order_relaxed);
+    cht_write_unlock(segment);
+    return err;
+}
+
+DataStructureError cht_get(const ConcurrentHashTable *table, const void *key, void *value) {
+    if (table == NULL || key == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    CHTSegment *segment = cht_segment(table, key);
+    cht_read_lock(segment);
+    DataStructureError err = hashtable_get(segment->table, key, value);
+    cht_read_unlock(segment);
+    return err;
+}
+
+DataStructureError cht_remove(ConcurrentHashTable *table, const void *key, void *old_value) {
+    if (table == NULL || key == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    CHTSegment *segment = cht_segment(table, key);
+    cht_write_lock(segment);
+    DataStructureError err = hashtable_remove(segment->table, key, old_value);
+    atomic_store_explicit(&segment->size, hashtable_size(segment->table),
+                          memory_order_relaxed);
+    cht_write_unlock(segment);
+    return err;
+}
+
+bool cht_contains(const ConcurrentHashTable *table, const void *key) {
+    return cht_get(table, key, NULL) == DS_SUCCESS;
+}
+
+size_t cht_size(const ConcurrentHashTable *table) {
+    if (table == NULL) {
+        return 0;
+    }
+
+    size_t total = 0;
+    for (size_t i = 0; i < table->num_segments; i++) {
+        total += atomic_load_explicit(&table->segments[i].size, memory_order_relaxed);
+    }
+    return total;
+}
+
+size_t cht_memory_usage(const ConcurrentHashTable *table) {
+    if (table == NULL) {
+        return 0;
+    }
+
+    size_t bytes = sizeof(ConcurrentHashTable) + table->num_segments * sizeof(CHTSegment);
+    for (size_t i = 0; i < table->num_segments; i++) {
+        CHTSegment *segment = &table->segments[i];
+        cht_read_lock(segment);
+        bytes += hashtable_memory_usage(segment->table);
+        cht_read_unlock(segment);
+    }
+    return bytes;
+}
+
+size_t cht_num_segments(const ConcurrentHashTable *table) {
+    return (table == NULL) ? 0 : table->num_segments;
+}
+
+void cht_clear(ConcurrentHashTable *table) {
+    if (table == NULL) {
+        return;
+    }
+
+    for (size_t i = 0; i < table->num_segments; i++) {
+        CHTSegment *segment = &table->segments[i];
+        cht_write_lock(segment);
+        hashtable_clear(segment->table);
+        atomic_store_explicit(&segment->size, 0, memory_order_relaxed);
+        cht_write_unlock(segment);
+    }
+}
@@ -2,8 +2,15 @@
  * @file heap.c
  * @brief Implementação de Heap Binário (Binary Heap) genérico
  *
- * Implementa heap binário como array implícito com suporte a Min-Heap e Max-Heap.
- * Para índice i: parent = (i-1)/2, left = 2i+1, right = 2i+2
+ * Implementa heap d-ário (binário por padrão) como array implícito com
+ * suporte a Min-Heap e Max-Heap.
+ * Para índice i: parent = (i-1)/d, filhos = d*i+1 .. d*i+d
+ *
+ * A remoção da raiz é bottom-up (Floyd; Wegener, 1993): o buraco desce sempre
+ * para o melhor filho até uma folha, sem comparar com o elemento que vai
+ * ocupá-lo, e só então o último elemento sobe dali. Como esse elemento
+ * veio de uma folha, quase sempre para logo: cerca de metade das
+ * comparações do heapify clássico.
  *
  * Referências:
  * - Cormen, T. H., et al. (2009). "Introduction to Algorithms" (3rd ed.),
@@ -12,6 +19,10 @@
  *   Communications of the ACM 7(6): 347–348
  * - Floyd, R. W. (1964). "Algorithm 245: Treesort 3",
  *   Communications of the ACM 7(12): 701
+ * - Johnson, D. B. (1975). "Priority queues with update and finding
+ *   minimum spanning trees". Information Processing Letters 4(3)
+ * - Wegener, I. (1993). "Bottom-up heapsort, a new variant of heapsort
+ *   beating, on an average, quicksort". Theoretical Computer Science 118(1)
  *
  * @author Algoritmos e Heurísticas
  * @date 2025
@@ -35,6 +46,8 @@ struct Heap {
     HeapType type;
     CompareFn compare;
     DestroyFn destroy;
+    DSAllocator allocator;
+    size_t arity;              // Filhos por nó (2 = heap binário)
 };
 
 #define HEAP_MIN_CAPACITY 16
@@ -77,11 +90,11 @@ static int heap_compare(const Heap *heap, const void *a, const void *b) {
  *     exchange A[i] with A[PARENT(i)]
  *     i = PARENT(i)
  *
- * Complexidade: O(log n)
+ * Complexidade: O(log_d n)
  */
 static void heap_up(Heap *heap, size_t index) {
     while (index > 0) {
-        size_t parent = (index - 1) / 2;
+        size_t parent = (index - 1) / heap->arity;
         if (heap_compare(heap, heap_element_at(heap, index),
                          heap_element_at(heap, parent)) > 0) {
             heap_swap(heap_element_at(heap, index),
@@ -109,27 +122,29 @@ static void heap_up(Heap *heap, size_t index) {
  *       exchange A[i] with A[largest]
  *       MAX-HEAPIFY(A, largest)
  *
- * Complexidade: O(log n)
+ * Com d filhos, o melhor deles é escolhido com d - 1 comparações e
+ * comparado uma vez com A[i].
+ *
+ * Complexidade: O(d log_d n)
  */
 static void heap_down(Heap *heap, size_t index) {
     while (1) {
-        size_t left = 2 * index + 1;
-        size_t right = 2 * index + 2;
-        size_t target = index;
-
-        if (left < heap->size &&
-            heap_compare(heap, heap_element_at(heap, left),
-                         heap_element_at(heap, target)) > 0) {
-            target = left;
+        size_t first = heap->arity * index + 1;
+        if (first >= heap->size) {
+            break;
         }
 
-        if (right < heap->size &&
-            heap_compare(heap, heap_element_at(heap, right),
-                         heap_element_at(heap, target)) > 0) {
-            target = right;
+        size_t end = (heap->size - first < heap->arity) ? heap->size : first + heap->arity;
+        size_t target = first;
+        for (size_t child = first + 1; child < end; child++) {
+            if (heap_compare(heap, heap_element_at(heap, child),
+                             heap_element_at(heap, target)) > 0) {
+                target = child;
+            }
         }
 
-        if (target == index) {
+        if (heap_compare(heap, heap_element_at(heap, target),
+                         heap_element_at(heap, index)) <= 0) {
             break;
         }
 
@@ -140,6 +155,43 @@ static void heap_down(Heap *heap, size_t index) {
     }
 }
 
+/**
+ * @brief Remoção bottom-up da raiz (extração)
+ *
+ * Pré-condição: heap->size já foi decrementado e o elemento que ocupará
+ * a raiz está em A[size], fora do heap. O buraco desce pelo melhor filho
+ * até uma folha (d - 1 comparações por nível, cópias em vez de trocas) e
+ * A[size] é colocado ali e sobe com heap_up.
+ *
+ * Complexidade: O(d log_d n), tipicamente ~(d - 1) log_d n comparações
+ */
+static void heap_remove_root(Heap *heap) {
+    size_t n = heap->size;
+    size_t hole = 0;
+
+    while (1) {
+        size_t first = heap->arity * hole + 1;
+        if (first >= n) {
+            break;
+        }
+
+        size_t end = (n - first < heap->arity) ? n : first + heap->arity;
+        size_t best = first;
+        for (size_t child = first + 1; child < end; child++) {
+            if (heap_compare(heap, heap_element_at(heap, child),
+                             heap_element_at(heap, best)) > 0) {
+                best = child;
+            }
+        }
+
+        memcpy(heap_element_at(heap, hole), heap_element_at(heap, best), heap->element_size);
+        hole = best;
+    }
+
+    memcpy(heap_element_at(heap, hole), heap_element_at(heap, n), heap->element_size);
+    heap_up(heap, hole);
+}
+
 static DataStructureError heap_ensure_capacity(Heap *heap) {
     if (heap->size < heap->capacity) {
         return DS_SUCCESS;
@@ -150,7 +202,9 @@ static DataStructureError heap_ensure_capacity(Heap *heap) {
         new_capacity = HEAP_MIN_CAPACITY;
     }
 
-    void *new_array = realloc(heap->array, new_capacity * heap->element_size);
+    void *new_array = ds_realloc(&heap->allocator, heap->array,
+                                 heap->capacity * heap->element_size,
+                                 new_capacity * heap->element_size);
     if (new_array == NULL) {
         return DS_ERROR_OUT_OF_MEMORY;
     }
@@ -167,11 +221,28 @@ static DataStructureError heap_ensure_capacity(Heap *heap) {
 
 Heap* heap_create(size_t element_size, size_t initial_capacity,
                   HeapType type, CompareFn compare, DestroyFn destroy) {
-    if (element_size == 0 || compare == NULL) {
+    return heap_create_with_allocator(element_size, initial_capacity, type,
+                                      compare, destroy, NULL);
+}
+
+Heap* heap_create_with_allocator(size_t element_size, size_t initial_capacity,
+                                 HeapType type, CompareFn compare, DestroyFn destroy,
+                                 const DSAllocator *allocator) {
+    return heap_create_with_arity(element_size, initial_capacity, 2, type, compare,
+                                  destroy, allocator);
+}
+
+Heap* heap_create_with_arity(size_t element_size, size_t initial_capacity, size_t arity,
+                             HeapType type, CompareFn compare, DestroyFn destroy,
+                             const DSAllocator *allocator) {
+    if (element_size == 0 || compare == NULL || arity < 2) {
         return NULL;
     }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
 
-    Heap *heap = (Heap *)malloc(sizeof(Heap));
+    Heap *heap = (Heap *)ds_alloc(allocator, sizeof(Heap));
     if (heap == NULL) {
         return NULL;
     }
@@ -180,9 +251,10 @@ Heap* heap_create(size_t element_size, size_t initial_capacity,
         initial_capacity = HEAP_MIN_CAPACITY;
     }
 
-    heap->array = malloc(initial_capacity * element_size);
+    heap->allocator = *allocator;
+    heap->array = ds_alloc(allocator, initial_capacity * element_size);
     if (heap->array == NULL) {
-        free(heap);
+        ds_free(allocator, heap, sizeof(Heap));
         return NULL;
     }
 
@@ -192,6 +264,7 @@ Heap* heap_create(size_t element_size, size_t initial_capacity,
     heap->type = type;
     heap->compare = compare;
     heap->destroy = destroy;
+    heap->arity = arity;
 
     return heap;
 }
@@ -207,8 +280,9 @@ void heap_destroy(Heap *heap) {
         }
     }
 
-    free(heap->array);
-    free(heap);
+    DSAllocator allocator = heap->allocator;
+    ds_free(&allocator, heap->array, heap->capacity * heap->element_size);
+    ds_free(&allocator, heap, sizeof(Heap));
 }
 
 // ============================================================================
@@ -248,10 +322,7 @@ DataStructureError heap_extract(Heap *heap, void *output) {
     heap->size--;
 
     if (heap->size > 0) {
-        memcpy(heap_element_at(heap, 0),
-               heap_element_at(heap, heap->size),
-               heap->element_size);
-        heap_down(heap, 0);
+        heap_remove_root(heap);
     }
 
     return DS_SUCCESS;
@@ -326,6 +397,7 @@ Heap* heap_build(size_t element_size, const void *array, size_t size,
         return NULL;
     }
 
+    heap->allocator = *ds_default_allocator();
     memcpy(heap->array, array, size * element_size);
     heap->element_size = element_size;
     heap->size = size;
@@ -333,6 +405,7 @@ Heap* heap_build(size_t element_size, const void *array, size_t size,
     heap->type = type;
     heap->compare = compare;
     heap->destroy = destroy;
+    heap->arity = 2;
 
     /* BUILD-HEAP (Cormen et al., 2009, p. 157):
      * for i = floor(n/2) - 1 downto 0
@@ -363,6 +436,14 @@ size_t heap_capacity(const Heap *heap) {
     return (heap == NULL) ? 0 : heap->capacity;
 }
 
+size_t heap_arity(const Heap *heap) {
+    return (heap == NULL) ? 0 : heap->arity;
+}
+
+size_t heap_memory_usage(const Heap *heap) {
+    return (heap == NULL) ? 0 : sizeof(Heap) + heap->capacity * heap->element_size;
+}
+
 void heap_clear(Heap *heap) {
     if (heap == NULL) {
         return;
@@ -396,6 +477,7 @@ void heap_sort(void *array, size_t element_size, size_t size, CompareFn compare)
     temp.type = HEAP_MAX;
     temp.compare = compare;
     temp.destroy = NULL;
+    temp.arity = 2;
 
     /* BUILD-MAX-HEAP (Cormen et al., 2009, p. 157) */
     for (size_t i = size / 2; i > 0; i--) {
@@ -449,6 +531,8 @@ DataStructureError heap_to_array(const Heap *heap, void **array, size_t *size) {
     clone->type = heap->type;
     clone->compare = heap->compare;
     clone->destroy = NULL;
+    clone->allocator = *ds_default_allocator();
+    clone->arity = heap->arity;
 
     void *result = malloc(heap->size * heap->element_size);
     if (result == NULL) {
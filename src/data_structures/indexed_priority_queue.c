@@ -0,0 +1,358 @@
+/**
+ * @file indexed_priority_queue.c
+ * @brief Implementação da fila de prioridade indexada
+ *
+ * Três arrays de tamanho max_handles (heap e pos em ds_index_t, de 32 bits
+ * com DS_COMPACT_INDEX):
+ * - heap[i]: handle na posição i do heap binário (i < size)
+ * - pos[h]: posição do handle h em heap[] (IPQ_NOT_IN se ausente)
+ * - keys[h * element_size]: chave do handle h
+ *
+ * Invariante: pos[heap[i]] == i para todo i < size. As trocas movem apenas
+ * handles e atualizam pos; as chaves nunca mudam de lugar.
+ *
+ * Referências:
+ * - Sedgewick, R. & Wayne, K. (2011). "Algorithms" (4th ed.),
+ *   Section 2.4 - IndexMinPQ
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/indexed_priority_queue.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/** Marca de pos[] para handles fora da fila */
+#define IPQ_NOT_IN ((ds_index_t)DS_INDEX_MAX)
+
+// ============================================================================
+// ESTRUTURA INTERNA
+// ============================================================================
+
+struct IndexedPriorityQueue {
+    ds_index_t *heap;
+    ds_index_t *pos;
+    unsigned char *keys;
+    size_t size;
+    size_t max_handles;
+    size_t element_size;
+    PriorityQueueType type;
+    CompareFn compare;
+    DSAllocator allocator;
+};
+
+// ============================================================================
+// FUNÇÕES AUXILIARES PRIVADAS
+// ============================================================================
+
+static inline void *ipq_key_ptr(const IndexedPriorityQueue *ipq, size_t handle) {
+    return ipq->keys + handle * ipq->element_size;
+}
+
+/**
+ * true se a chave a tem prioridade estritamente maior que b
+ */
+static inline bool ipq_before_keys(const IndexedPriorityQueue *ipq,
+                                   const void *a, const void *b) {
+    int cmp = ipq->compare(a, b);
+    return (ipq->type == PQ_MIN) ? (cmp < 0) : (cmp > 0);
+}
+
+static inline bool ipq_before(const IndexedPriorityQueue *ipq, size_t i, size_t j) {
+    return ipq_before_keys(ipq, ipq_key_ptr(ipq, ipq->heap[i]),
+                           ipq_key_ptr(ipq, ipq->heap[j]));
+}
+
+static inline void ipq_place(IndexedPriorityQueue *ipq, size_t i, size_t handle) {
+    ipq->heap[i] = (ds_index_t)handle;
+    ipq->pos[handle] = (ds_index_t)i;
+}
+
+/**
+ * Sobe a posição i; o handle é movido uma única vez ao final (sem swaps)
+ */
+static void ipq_up(IndexedPriorityQueue *ipq, size_t i) {
+    size_t handle = ipq->heap[i];
+    const void *key = ipq_key_ptr(ipq, handle);
+
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (!ipq_before_keys(ipq, key, ipq_key_ptr(ipq, ipq->heap[parent]))) {
+            break;
+        }
+        ipq_place(ipq, i, ipq->heap[parent]);
+        i = parent;
+    }
+    ipq_place(ipq, i, handle);
+}
+
+static void ipq_down(IndexedPriorityQueue *ipq, size_t i) {
+    size_t handle = ipq->heap[i];
+    const void *key = ipq_key_ptr(ipq, handle);
+
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= ipq->size) {
+            break;
+        }
+        if (child + 1 < ipq->size && ipq_before(ipq, child + 1, child)) {
+            child++;
+        }
+        if (!ipq_before_keys(ipq, ipq_key_ptr(ipq, ipq->heap[child]), key)) {
+            break;
+        }
+        ipq_place(ipq, i, ipq->heap[child]);
+        i = child;
+    }
+    ipq_place(ipq, i, handle);
+}
+
+/**
+ * Retira a posição i do heap, preenchendo-a com o último handle
+ */
+static void ipq_remove_at(IndexedPriorityQueue *ipq, size_t i) {
+    size_t handle = ipq->heap[i];
+    ipq->size--;
+    ipq->pos[handle] = IPQ_NOT_IN;
+
+    if (i == ipq->size) {
+        return;
+    }
+    ipq_place(ipq, i, ipq->heap[ipq->size]);
+    if (i > 0 && ipq_before(ipq, i, (i - 1) / 2)) {
+        ipq_up(ipq, i);
+    } else {
+        ipq_down(ipq, i);
+    }
+}
+
+static inline bool ipq_has(const IndexedPriorityQueue *ipq, size_t handle) {
+    return handle < ipq->max_handles && ipq->pos[handle] != IPQ_NOT_IN;
+}
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+IndexedPriorityQueue* ipq_create(size_t max_handles, size_t element_size,
+                                 PriorityQueueType type, CompareFn compare) {
+    return ipq_create_with_allocator(max_handles, element_size, type, compare, NULL);
+}
+
+IndexedPriorityQueue* ipq_create_with_allocator(size_t max_handles, size_t element_size,
+                                                PriorityQueueType type, CompareFn compare,
+                                                const DSAllocator *allocator) {
+    if (max_handles == 0 || element_size == 0 || compare == NULL) {
+        return NULL;
+    }
+    if (max_handles > DS_INDEX_MAX || max_handles > SIZE_MAX / sizeof(ds_index_t) ||
+        max_handles > SIZE_MAX / element_size) {
+        return NULL;
+    }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
+
+    IndexedPriorityQueue *ipq =
+        (IndexedPriorityQueue *)ds_alloc(allocator, sizeof(IndexedPriorityQueue));
+    if (ipq == NULL) {
+        return NULL;
+    }
+
+    ipq->allocator = *allocator;
+    ipq->heap = (ds_index_t *)ds_alloc(allocator, max_handles * sizeof(ds_index_t));
+    ipq->pos = (ds_index_t *)ds_alloc(allocator, max_handles * sizeof(ds_index_t));
+    ipq->keys = (unsigned char *)ds_alloc(allocator, max_handles * element_size);
+    if (ipq->heap == NULL || ipq->pos == NULL || ipq->keys == NULL) {
+        ds_free(allocator, ipq->keys, max_handles * element_size);
+        ds_free(allocator, ipq->pos, max_handles * sizeof(ds_index_t));
+        ds_free(allocator, ipq->heap, max_handles * sizeof(ds_index_t));
+        ds_free(allocator, ipq, sizeof(IndexedPriorityQueue));
+        return NULL;
+    }
+
+    for (size_t h = 0; h < max_handles; h++) {
+        ipq->pos[h] = IPQ_NOT_IN;
+    }
+    ipq->size = 0;
+    ipq->max_handles = max_handles;
+    ipq->element_size = element_size;
+    ipq->type = type;
+    ipq->compare = compare;
+    return ipq;
+}
+
+void ipq_destroy(IndexedPriorityQueue *ipq) {
+    if (ipq == NULL) {
+        return;
+    }
+
+    DSAllocator allocator = ipq->allocator;
+    ds_free(&allocator, ipq->keys, ipq->max_handles * ipq->element_size);
+    ds_free(&allocator, ipq->pos, ipq->max_handles * sizeof(ds_index_t));
+    ds_free(&allocator, ipq->heap, ipq->max_handles * sizeof(ds_index_t));
+    ds_free(&allocator, ipq, sizeof(IndexedPriorityQueue));
+}
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+DataStructureError ipq_insert(IndexedPriorityQueue *ipq, size_t handle, const void *key) {
+    if (ipq == NULL || key == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (handle >= ipq->max_handles) {
+        return DS_ERROR_INVALID_INDEX;
+    }
+    if (ipq->pos[handle] != IPQ_NOT_IN) {
+        return DS_ERROR_INVALID_PARAM;
+    }
+
+    memcpy(ipq_key_ptr(ipq, handle), key, ipq->element_size);
+    ipq_place(ipq, ipq->size, handle);
+    ipq->size++;
+    ipq_up(ipq, ipq->size - 1);
+    return DS_SUCCESS;
+}
+
+DataStructureError ipq_extract(IndexedPriorityQueue *ipq, size_t *handle, void *key) {
+    if (ipq == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (ipq->size == 0) {
+        return DS_ERROR_EMPTY;
+    }
+
+    size_t top = ipq->heap[0];
+    if (handle != NULL) {
+        *handle = top;
+    }
+    if (key != NULL) {
+        memcpy(key, ipq_key_ptr(ipq, top), ipq->element_size);
+    }
+    ipq_remove_at(ipq, 0);
+    return DS_SUCCESS;
+}
+
+DataStructureError ipq_peek(const IndexedPriorityQueue *ipq, size_t *handle, void *key) {
+    if (ipq == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (ipq->size == 0) {
+        return DS_ERROR_EMPTY;
+    }
+
+    size_t top = ipq->heap[0];
+    if (handle != NULL) {
+        *handle = top;
+    }
+    if (key != NULL) {
+        memcpy(key, ipq_key_ptr(ipq, top), ipq->element_size);
+    }
+    return DS_SUCCESS;
+}
+
+DataStructureError ipq_decrease_key(IndexedPriorityQueue *ipq, size_t handle,
+                                    const void *key) {
+    if (ipq == NULL || key == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (!ipq_has(ipq, handle)) {
+        return DS_ERROR_NOT_FOUND;
+    }
+
+    void *slot = ipq_key_ptr(ipq, handle);
+    if (ipq_before_keys(ipq, slot, key)) {
+        return DS_ERROR_INVALID_PARAM;
+    }
+
+    memcpy(slot, key, ipq->element_size);
+    ipq_up(ipq, ipq->pos[handle]);
+    return DS_SUCCESS;
+}
+
+DataStructureError ipq_change_key(IndexedPriorityQueue *ipq, size_t handle,
+                                  const void *key) {
+    if (ipq == NULL || key == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (!ipq_has(ipq, handle)) {
+        return DS_ERROR_NOT_FOUND;
+    }
+
+    void *slot = ipq_key_ptr(ipq, handle);
+    bool worse = ipq_before_keys(ipq, slot, key);
+    memcpy(slot, key, ipq->element_size);
+    if (worse) {
+        ipq_down(ipq, ipq->pos[handle]);
+    } else {
+        ipq_up(ipq, ipq->pos[handle]);
+    }
+    return DS_SUCCESS;
+}
+
+DataStructureError ipq_remove(IndexedPriorityQueue *ipq, size_t handle) {
+    if (ipq == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (!ipq_has(ipq, handle)) {
+        return DS_ERROR_NOT_FOUND;
+    }
+
+    ipq_remove_at(ipq, ipq->pos[handle]);
+    return DS_SUCCESS;
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+bool ipq_contains(const IndexedPriorityQueue *ipq, size_t handle) {
+    return ipq != NULL && ipq_has(ipq, handle);
+}
+
+DataStructureError ipq_key_of(const IndexedPriorityQueue *ipq, size_t handle, void *key) {
+    if (ipq == NULL || key == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (!ipq_has(ipq, handle)) {
+        return DS_ERROR_NOT_FOUND;
+    }
+
+    memcpy(key, ipq_key_ptr(ipq, handle), ipq->element_size);
+    return DS_SUCCESS;
+}
+
+bool ipq_is_empty(const IndexedPriorityQueue *ipq) {
+    return ipq == NULL || ipq->size == 0;
+}
+
+size_t ipq_size(const IndexedPriorityQueue *ipq) {
+    return ipq ? ipq->size : 0;
+}
+
+size_t ipq_max_handles(const IndexedPriorityQueue *ipq) {
+    return ipq ? ipq->max_handles : 0;
+}
+
+size_t ipq_memory_usage(const IndexedPriorityQueue *ipq) {
+    if (ipq == NULL) {
+        return 0;
+    }
+    return sizeof(IndexedPriorityQueue) +
+           ipq->max_handles * (2 * sizeof(ds_index_t) + ipq->element_size);
+}
+
+void ipq_clear(IndexedPriorityQueue *ipq) {
+    if (ipq == NULL) {
+        return;
+    }
+
+    for (size_t i = 0; i < ipq->size; i++) {
+        ipq->pos[ipq->heap[i]] = IPQ_NOT_IN;
+    }
+    ipq->size = 0;
+}
@@ -0,0 +1,178 @@
+/**
+ * @file instrument.c
+ * @brief Registro por thread, snapshot e relatório da instrumentação
+ *
+ * Os blocos das threads formam uma lista com inserção lock-free na cabeça
+ * e nunca são liberados: os contadores de uma thread encerrada continuam
+ * no total. O reset guarda a soma atual como linha de base em vez de
+ * escrever nos blocos, que só a thread dona escreve.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+// clock_gettime/CLOCK_MONOTONIC (POSIX) com CMAKE_C_EXTENSIONS OFF
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "data_structures/instrument.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static const char *const COMPONENT_NAMES[DS_COMPONENT_COUNT] = {
+    "allocator", "hash_table", "avl_tree", "sorting", "optimization"
+};
+
+static const char *const COUNTER_NAMES[DS_COUNTER_COUNT] = {
+    "comparisons", "swaps", "allocations", "allocated_bytes", "frees",
+    "probes", "rotations", "rehashes", "evaluations"
+};
+
+static const char *const TIMER_NAMES[DS_TIMER_COUNT] = {
+    "hash_rehash", "sort", "opt_run"
+};
+
+const char* ds_instrument_component_name(DSComponent component) {
+    return ((unsigned)component < DS_COMPONENT_COUNT) ? COMPONENT_NAMES[component] : "?";
+}
+
+const char* ds_instrument_counter_name(DSCounter counter) {
+    return ((unsigned)counter < DS_COUNTER_COUNT) ? COUNTER_NAMES[counter] : "?";
+}
+
+const char* ds_instrument_timer_name(DSTimer timer) {
+    return ((unsigned)timer < DS_TIMER_COUNT) ? TIMER_NAMES[timer] : "?";
+}
+
+#ifdef DS_INSTRUMENT
+
+_Thread_local DSInstrumentBlock *ds_instrument_local = NULL;
+
+static _Atomic(DSInstrumentBlock *) blocks = NULL;
+static DSInstrumentStats baseline;
+
+bool ds_instrument_enabled(void) {
+    return true;
+}
+
+DSInstrumentBlock* ds_instrument_register(void) {
+    // calloc, e não ds_alloc: alocar aqui contaria a si mesmo
+    DSInstrumentBlock *block = calloc(1, sizeof(DSInstrumentBlock));
+    if (block == NULL) return NULL;
+
+    DSInstrumentBlock *head = atomic_load_explicit(&blocks, memory_order_relaxed);
+    do {
+        block->next = head;
+    } while (!atomic_compare_exchange_weak_explicit(&blocks, &head, block,
+                                                    memory_order_release,
+                                                    memory_order_relaxed));
+    ds_instrument_local = block;
+    return block;
+}
+
+static uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Mede a frequência do TSC contra o relógio monotônico (~2 ms, uma vez)
+static double calibrate_ns_per_tick(void) {
+#ifdef DS_INSTRUMENT_RDTSC
+    static double cached = 0.0;
+    if (cached == 0.0) {
+        uint64_t ns0 = monotonic_ns();
+        uint64_t t0 = ds_instrument_ticks();
+        while (monotonic_ns() - ns0 < 2000000ULL) {
+        }
+        uint64_t ns1 = monotonic_ns();
+        uint64_t t1 = ds_instrument_ticks();
+        cached = (t1 > t0) ? (double)(ns1 - ns0) / (double)(t1 - t0) : 1.0;
+    }
+    return cached;
+#else
+    return 1.0;
+#endif
+}
+
+static void sum_blocks(DSInstrumentStats *stats) {
+    memset(stats, 0, sizeof(DSInstrumentStats));
+    for (DSInstrumentBlock *b = atomic_load_explicit(&blocks, memory_order_acquire);
+         b != NULL; b = b->next) {
+        for (size_t c = 0; c < DS_COMPONENT_COUNT; c++) {
+            for (size_t k = 0; k < DS_COUNTER_COUNT; k++) {
+                stats->counters[c][k] +=
+                    atomic_load_explicit(&b->counters[c][k], memory_order_relaxed);
+            }
+        }
+        for (size_t t = 0; t < DS_TIMER_COUNT; t++) {
+            stats->timer_ticks[t] += atomic_load_explicit(&b->timer_ticks[t], memory_order_relaxed);
+            stats->timer_calls[t] += atomic_load_explicit(&b->timer_calls[t], memory_order_relaxed);
+        }
+    }
+}
+
+void ds_instrument_reset(void) {
+    sum_blocks(&baseline);
+}
+
+void ds_instrument_snapshot(DSInstrumentStats *stats) {
+    if (stats == NULL) return;
+
+    sum_blocks(stats);
+    for (size_t c = 0; c < DS_COMPONENT_COUNT; c++) {
+        for (size_t k = 0; k < DS_COUNTER_COUNT; k++) {
+            stats->counters[c][k] -= baseline.counters[c][k];
+        }
+    }
+    for (size_t t = 0; t < DS_TIMER_COUNT; t++) {
+        stats->timer_ticks[t] -= baseline.timer_ticks[t];
+        stats->timer_calls[t] -= baseline.timer_calls[t];
+    }
+    stats->ns_per_tick = calibrate_ns_per_tick();
+}
+
+#else // !DS_INSTRUMENT
+
+bool ds_instrument_enabled(void) {
+    return false;
+}
+
+void ds_instrument_reset(void) {
+}
+
+void ds_instrument_snapshot(DSInstrumentStats *stats) {
+    if (stats != NULL) memset(stats, 0, sizeof(DSInstrumentStats));
+}
+
+#endif // DS_INSTRUMENT
+
+void ds_instrument_dump(FILE *out) {
+    if (out == NULL) return;
+    if (!ds_instrument_enabled()) {
+        fprintf(out, "instrumentação desligada (compile com -DENABLE_INSTRUMENTATION=ON)\n");
+        return;
+    }
+
+    DSInstrumentStats stats;
+    ds_instrument_snapshot(&stats);
+
+    fprintf(out, "=== instrumentação ===\n");
+    for (size_t c = 0; c < DS_COMPONENT_COUNT; c++) {
+        for (size_t k = 0; k < DS_COUNTER_COUNT; k++) {
+            if (stats.counters[c][k] != 0) {
+                fprintf(out, "%s.%s %llu\n", COMPONENT_NAMES[c], COUNTER_NAMES[k],
+                        (unsigned long long)stats.counters[c][k]);
+            }
+        }
+    }
+    for (size_t t = 0; t < DS_TIMER_COUNT; t++) {
+        if (stats.timer_calls[t] == 0) continue;
+        double total_ns = (double)stats.timer_ticks[t] * stats.ns_per_tick;
+        fprintf(out, "timer.%s %llu chamadas, %.3f ms total, %.3f us/chamada\n",
+                TIMER_NAMES[t], (unsigned long long)stats.timer_calls[t],
+                total_ns / 1e6, total_ns / 1e3 / (double)stats.timer_calls[t]);
+    }
+}
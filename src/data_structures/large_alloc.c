@@ -0,0 +1,204 @@
+/**
+ * @file large_alloc.c
+ * @brief Implementação da alocação de buffers grandes (huge pages + NUMA)
+ *
+ * O bloco mapeado ocupa count * size bytes arredondados para cima a
+ * DS_HUGE_PAGE_SIZE. Para alinhá-lo, mapeia-se uma huge page a mais e
+ * devolvem-se ao kernel as sobras antes e depois; ds_large_free recalcula
+ * o mesmo tamanho arredondado para o munmap. Páginas não tocadas não
+ * ocupam memória, então o arredondamento custa só espaço de endereçamento.
+ *
+ * O mbind vai por syscall, sem depender da libnuma; os nós online vêm de
+ * /sys/devices/system/node/online e ficam em cache após a primeira leitura.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#if defined(__linux__)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // MAP_ANONYMOUS, MADV_HUGEPAGE e syscall
+#endif
+#endif
+
+#include "data_structures/large_alloc.h"
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(MAP_ANONYMOUS)
+#define LARGE_USE_MMAP 1
+#else
+#define LARGE_USE_MMAP 0
+#endif
+
+#if LARGE_USE_MMAP && defined(SYS_mbind)
+#define LARGE_USE_MBIND 1
+#define LARGE_MPOL_INTERLEAVE 3   // <linux/mempolicy.h>
+#else
+#define LARGE_USE_MBIND 0
+#endif
+
+/** Máscara com bits para 64 nós (suficiente para os servidores atuais) */
+#define LARGE_MAX_NODES 64
+
+static atomic_uint g_flags = DS_LARGE_DEFAULT_FLAGS;
+static atomic_ullong g_node_mask = 0;   // 0 = ainda não lida
+
+// ============================================================================
+// FUNÇÕES AUXILIARES PRIVADAS
+// ============================================================================
+
+// Lê uma lista de nós no formato do sysfs ("0", "0-1", "0,2-3")
+static unsigned long long read_node_mask(void) {
+    unsigned long long mask = 0;
+#if defined(__linux__)
+    FILE *f = fopen("/sys/devices/system/node/online", "r");
+    if (f != NULL) {
+        unsigned lo, hi;
+        int c = 0;
+        while (fscanf(f, "%u", &lo) == 1) {
+            hi = lo;
+            c = fgetc(f);
+            if (c == '-') {
+                if (fscanf(f, "%u", &hi) != 1) break;
+                c = fgetc(f);
+            }
+            for (unsigned node = lo; node <= hi && node < LARGE_MAX_NODES; node++) {
+                mask |= 1ULL << node;
+            }
+            if (c != ',') break;
+        }
+        fclose(f);
+    }
+#endif
+    return mask != 0 ? mask : 1ULL;
+}
+
+static unsigned long long node_mask(void) {
+    unsigned long long mask = atomic_load_explicit(&g_node_mask, memory_order_relaxed);
+    if (mask == 0) {
+        mask = read_node_mask();   // corrida inofensiva: todos leem o mesmo valor
+        atomic_store_explicit(&g_node_mask, mask, memory_order_relaxed);
+    }
+    return mask;
+}
+
+#if LARGE_USE_MMAP
+static size_t mapped_bytes(size_t bytes) {
+    return (bytes + DS_HUGE_PAGE_SIZE - 1) / DS_HUGE_PAGE_SIZE * DS_HUGE_PAGE_SIZE;
+}
+
+static void* map_aligned(size_t bytes) {
+    size_t span = bytes + DS_HUGE_PAGE_SIZE;
+    void *raw = mmap(NULL, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) return NULL;
+
+    uintptr_t start = (uintptr_t)raw;
+    uintptr_t aligned = (start + DS_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(DS_HUGE_PAGE_SIZE - 1);
+    size_t head = (size_t)(aligned - start);
+    size_t tail = span - head - bytes;
+    if (head > 0) munmap(raw, head);
+    if (tail > 0) munmap((void *)(aligned + bytes), tail);
+    return (void *)aligned;
+}
+
+static void advise(void *block, size_t bytes, unsigned flags) {
+#if defined(MADV_HUGEPAGE)
+    if (flags & DS_LARGE_HUGE_PAGES) madvise(block, bytes, MADV_HUGEPAGE);
+#endif
+#if LARGE_USE_MBIND
+    if (flags & DS_LARGE_INTERLEAVE) {
+        unsigned long mask[LARGE_MAX_NODES / (8 * sizeof(unsigned long))];
+        unsigned long long nodes = node_mask();
+        if ((nodes & (nodes - 1)) != 0) {   // mais de um nó
+            for (size_t w = 0; w < sizeof(mask) / sizeof(mask[0]); w++) {
+                mask[w] = (unsigned long)(nodes >> (w * 8 * sizeof(unsigned long)));
+            }
+            syscall(SYS_mbind, block, bytes, LARGE_MPOL_INTERLEAVE, mask,
+                    (unsigned long)LARGE_MAX_NODES + 1, 0UL);
+        }
+    }
+#endif
+#if !defined(MADV_HUGEPAGE) && !LARGE_USE_MBIND
+    (void)block;
+    (void)bytes;
+    (void)flags;
+#endif
+}
+#endif
+
+// ============================================================================
+// POLÍTICA GLOBAL
+// ============================================================================
+
+void ds_set_large_alloc_flags(unsigned flags) {
+    atomic_store(&g_flags, flags);
+}
+
+unsigned ds_get_large_alloc_flags(void) {
+    return atomic_load(&g_flags);
+}
+
+size_t ds_numa_num_nodes(void) {
+    unsigned long long mask = node_mask();
+    size_t count = 0;
+    for (; mask != 0; mask &= mask - 1) count++;
+    return count;
+}
+
+// ============================================================================
+// ALOCAÇÃO
+// ============================================================================
+
+bool ds_large_is_mapped(size_t count, size_t size) {
+#if LARGE_USE_MMAP
+    return size > 0 && count <= SIZE_MAX / size && count * size >= DS_LARGE_ALLOC_THRESHOLD &&
+           count * size <= SIZE_MAX - 2 * DS_HUGE_PAGE_SIZE;
+#else
+    (void)count;
+    (void)size;
+    return false;
+#endif
+}
+
+void* ds_large_calloc(size_t count, size_t size) {
+    return ds_large_calloc_flags(count, size, ds_get_large_alloc_flags());
+}
+
+void* ds_large_calloc_flags(size_t count, size_t size, unsigned flags) {
+    if (size > 0 && count > SIZE_MAX / size) return NULL;
+#if LARGE_USE_MMAP
+    if (ds_large_is_mapped(count, size)) {
+        size_t bytes = mapped_bytes(count * size);
+        void *block = map_aligned(bytes);
+        if (block != NULL) advise(block, bytes, flags);
+        return block;
+    }
+#else
+    (void)flags;
+#endif
+    return calloc(count > 0 ? count : 1, size > 0 ? size : 1);
+}
+
+void ds_large_free(void *ptr, size_t count, size_t size) {
+    if (ptr == NULL) return;
+#if LARGE_USE_MMAP
+    if (ds_large_is_mapped(count, size)) {
+        munmap(ptr, mapped_bytes(count * size));
+        return;
+    }
+#else
+    (void)count;
+    (void)size;
+#endif
+    free(ptr);
+}
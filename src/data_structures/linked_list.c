@@ -6,10 +6,13 @@
  * - LIST_SINGLY: Lista simplesmente encadeada
  * - LIST_DOUBLY: Lista duplamente encadeada
  * - LIST_CIRCULAR: Lista circular (duplamente encadeada)
+ * - LIST_UNROLLED: Lista duplamente encadeada de blocos de elementos
  *
  * Referências:
  * - Knuth TAOCP Vol 1, Section 2.2 - Linear Lists
  * - Cormen et al. (2009), Chapter 10.2 - Linked Lists
+ * - Shao, Z., Reppy, J. H., & Appel, A. W. (1994). "Unrolling Lists".
+ *   ACM Conference on LISP and Functional Programming
  *
  * @author Algoritmos e Heurísticas
  * @date 2025
@@ -21,17 +24,27 @@
 #include <stdlib.h>
 #include <string.h>
 
+/** Bytes de elementos por bloco de LIST_UNROLLED (uma linha de cache) */
+#define LIST_UNROLLED_CHUNK_BYTES 64
+
+/** Mínimo de elementos por bloco, para elementos maiores que o bloco */
+#define LIST_UNROLLED_MIN_ELEMENTS 4
+
 // ============================================================================
 // ESTRUTURA INTERNA DA LINKED LIST
 // ============================================================================
 
 /**
  * @brief Nó da lista encadeada
+ *
+ * Em LIST_UNROLLED o nó é um bloco: data aponta para count elementos
+ * contíguos alocados junto com o próprio nó.
  */
 struct ListNode {
     void *data;
     struct ListNode *next;
     struct ListNode *prev;  // NULL para LIST_SINGLY
+    size_t count;           // Elementos no nó (1 exceto em LIST_UNROLLED)
 };
 
 /**
@@ -45,6 +58,9 @@ struct LinkedList {
 
     ListNode *head;          // Primeiro nó
     ListNode *tail;          // Último nó
+    size_t chunk_capacity;   // Elementos por nó (1 exceto em LIST_UNROLLED)
+
+    DSAllocator allocator;   // Origem da memória de nós e cabeçalho
 };
 
 // ============================================================================
@@ -54,21 +70,22 @@ struct LinkedList {
 /**
  * @brief Cria um novo nó
  */
-static ListNode* create_node(size_t element_size, const void *data) {
-    ListNode *node = (ListNode*)malloc(sizeof(ListNode));
+static ListNode* create_node(LinkedList *list, const void *data) {
+    ListNode *node = (ListNode*)ds_alloc(&list->allocator, sizeof(ListNode));
     if (node == NULL) {
         return NULL;
     }
 
-    node->data = malloc(element_size);
+    node->data = ds_alloc(&list->allocator, list->element_size);
     if (node->data == NULL) {
-        free(node);
+        ds_free(&list->allocator, node, sizeof(ListNode));
         return NULL;
     }
 
-    memcpy(node->data, data, element_size);
+    memcpy(node->data, data, list->element_size);
     node->next = NULL;
     node->prev = NULL;
+    node->count = 1;
 
     return node;
 }
@@ -85,8 +102,8 @@ static void destroy_node(LinkedList *list, ListNode *node) {
         list->destroy(node->data);
     }
 
-    free(node->data);
-    free(node);
+    ds_free(&list->allocator, node->data, list->element_size);
+    ds_free(&list->allocator, node, sizeof(ListNode));
 }
 
 /**
@@ -117,6 +134,253 @@ static ListNode* get_node_at(const LinkedList *list, size_t index) {
     return current;
 }
 
+// ============================================================================
+// LIST_UNROLLED (BLOCOS DE ELEMENTOS)
+// ============================================================================
+
+/*
+ * Cada nó guarda até chunk_capacity elementos contíguos, então percorrer a
+ * lista toca um ponteiro por bloco em vez de um por elemento e cada bloco
+ * custa uma única alocação. Inserir no meio de um bloco cheio o divide
+ * ao meio; remover funde o bloco com um vizinho quando os dois cabem em
+ * um só, para que blocos quase vazios não se acumulem.
+ */
+
+static void* chunk_slot(const LinkedList *list, const ListNode *chunk, size_t offset) {
+    return (char*)chunk->data + offset * list->element_size;
+}
+
+static size_t chunk_bytes(const LinkedList *list) {
+    return sizeof(ListNode) + list->chunk_capacity * list->element_size;
+}
+
+static ListNode* unrolled_new_chunk(LinkedList *list) {
+    ListNode *chunk = (ListNode*)ds_alloc(&list->allocator, chunk_bytes(list));
+    if (chunk == NULL) {
+        return NULL;
+    }
+    chunk->data = chunk + 1;
+    chunk->next = NULL;
+    chunk->prev = NULL;
+    chunk->count = 0;
+    return chunk;
+}
+
+/**
+ * @brief Liga chunk depois de pos (pos NULL = no início)
+ */
+static void unrolled_link_after(LinkedList *list, ListNode *pos, ListNode *chunk) {
+    chunk->prev = pos;
+    chunk->next = (pos != NULL) ? pos->next : list->head;
+    if (chunk->next != NULL) {
+        chunk->next->prev = chunk;
+    } else {
+        list->tail = chunk;
+    }
+    if (pos != NULL) {
+        pos->next = chunk;
+    } else {
+        list->head = chunk;
+    }
+}
+
+/**
+ * @brief Desliga e libera um bloco (sem chamar destroy nos elementos)
+ */
+static void unrolled_release(LinkedList *list, ListNode *chunk) {
+    if (chunk->prev != NULL) {
+        chunk->prev->next = chunk->next;
+    } else {
+        list->head = chunk->next;
+    }
+    if (chunk->next != NULL) {
+        chunk->next->prev = chunk->prev;
+    } else {
+        list->tail = chunk->prev;
+    }
+    ds_free(&list->allocator, chunk, chunk_bytes(list));
+}
+
+/**
+ * @brief Bloco e posição dentro dele do elemento index (index < size)
+ *
+ * Complexidade: O(n / chunk_capacity)
+ */
+static ListNode* unrolled_locate(const LinkedList *list, size_t index, size_t *offset) {
+    if (index < list->size / 2) {
+        ListNode *chunk = list->head;
+        while (index >= chunk->count) {
+            index -= chunk->count;
+            chunk = chunk->next;
+        }
+        *offset = index;
+        return chunk;
+    }
+
+    ListNode *chunk = list->tail;
+    size_t from_end = list->size - 1 - index;
+    while (from_end >= chunk->count) {
+        from_end -= chunk->count;
+        chunk = chunk->prev;
+    }
+    *offset = chunk->count - 1 - from_end;
+    return chunk;
+}
+
+/**
+ * @brief Insere data na posição offset de chunk (chunk NULL = lista vazia)
+ *
+ * Num bloco cheio, inserções nas pontas vão para o vizinho (ou um bloco
+ * novo) e as do meio dividem o bloco ao meio.
+ *
+ * Complexidade: O(chunk_capacity)
+ */
+static DataStructureError unrolled_insert(LinkedList *list, ListNode *chunk, size_t offset,
+                                          const void *data) {
+    size_t cap = list->chunk_capacity;
+    size_t esz = list->element_size;
+
+    if (chunk == NULL) {
+        chunk = unrolled_new_chunk(list);
+        if (chunk == NULL) {
+            return DS_ERROR_OUT_OF_MEMORY;
+        }
+        unrolled_link_after(list, NULL, chunk);
+        offset = 0;
+    } else if (chunk->count == cap) {
+        if (offset == 0 && chunk->prev != NULL && chunk->prev->count < cap) {
+            chunk = chunk->prev;
+            offset = chunk->count;
+        } else if (offset == cap && chunk->next != NULL && chunk->next->count < cap) {
+            chunk = chunk->next;
+            offset = 0;
+        } else {
+            ListNode *fresh = unrolled_new_chunk(list);
+            if (fresh == NULL) {
+                return DS_ERROR_OUT_OF_MEMORY;
+            }
+            if (offset == 0) {
+                unrolled_link_after(list, chunk->prev, fresh);
+                chunk = fresh;
+            } else if (offset == cap) {
+                unrolled_link_after(list, chunk, fresh);
+                chunk = fresh;
+                offset = 0;
+            } else {
+                size_t keep = cap / 2;
+                unrolled_link_after(list, chunk, fresh);
+                memcpy(fresh->data, chunk_slot(list, chunk, keep), (cap - keep) * esz);
+                fresh->count = cap - keep;
+                chunk->count = keep;
+                if (offset > keep) {
+                    chunk = fresh;
+                    offset -= keep;
+                }
+            }
+        }
+    }
+
+    char *slot = chunk_slot(list, chunk, offset);
+    memmove(slot + esz, slot, (chunk->count - offset) * esz);
+    memcpy(slot, data, esz);
+    chunk->count++;
+    list->size++;
+    return DS_SUCCESS;
+}
+
+/**
+ * @brief Remove o elemento offset de chunk, fundindo blocos esvaziados
+ *
+ * Complexidade: O(chunk_capacity)
+ */
+static void unrolled_remove(LinkedList *list, ListNode *chunk, size_t offset, void *output) {
+    size_t esz = list->element_size;
+    char *slot = chunk_slot(list, chunk, offset);
+
+    if (output != NULL) {
+        memcpy(output, slot, esz);
+    }
+    if (list->destroy != NULL) {
+        list->destroy(slot);
+    }
+    memmove(slot, slot + esz, (chunk->count - offset - 1) * esz);
+    chunk->count--;
+    list->size--;
+
+    if (chunk->count == 0) {
+        unrolled_release(list, chunk);
+        return;
+    }
+
+    ListNode *next = chunk->next;
+    ListNode *prev = chunk->prev;
+    if (next != NULL && chunk->count + next->count <= list->chunk_capacity) {
+        memcpy(chunk_slot(list, chunk, chunk->count), next->data, next->count * esz);
+        chunk->count += next->count;
+        unrolled_release(list, next);
+    } else if (prev != NULL && prev->count + chunk->count <= list->chunk_capacity) {
+        memcpy(chunk_slot(list, prev, prev->count), chunk->data, chunk->count * esz);
+        prev->count += chunk->count;
+        unrolled_release(list, chunk);
+    }
+}
+
+/**
+ * @brief Primeiro elemento igual a data, como (bloco, posição)
+ */
+static ListNode* unrolled_find(const LinkedList *list, const void *data, CompareFn compare,
+                               size_t *offset) {
+    for (ListNode *chunk = list->head; chunk != NULL; chunk = chunk->next) {
+        for (size_t i = 0; i < chunk->count; i++) {
+            if (compare(chunk_slot(list, chunk, i), data) == 0) {
+                *offset = i;
+                return chunk;
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Remove um bloco inteiro, chamando destroy em cada elemento
+ */
+static void unrolled_remove_chunk(LinkedList *list, ListNode *chunk) {
+    if (list->destroy != NULL) {
+        for (size_t i = 0; i < chunk->count; i++) {
+            list->destroy(chunk_slot(list, chunk, i));
+        }
+    }
+    list->size -= chunk->count;
+    unrolled_release(list, chunk);
+}
+
+static void unrolled_reverse(LinkedList *list) {
+    size_t esz = list->element_size;
+    ListNode *chunk = list->head;
+
+    while (chunk != NULL) {
+        // Inverte os elementos do bloco, byte a byte
+        for (size_t i = 0, j = chunk->count - 1; i < j; i++, j--) {
+            unsigned char *a = chunk_slot(list, chunk, i);
+            unsigned char *b = chunk_slot(list, chunk, j);
+            for (size_t k = 0; k < esz; k++) {
+                unsigned char t = a[k];
+                a[k] = b[k];
+                b[k] = t;
+            }
+        }
+
+        ListNode *next = chunk->next;
+        chunk->next = chunk->prev;
+        chunk->prev = next;
+        chunk = next;
+    }
+
+    ListNode *temp = list->head;
+    list->head = list->tail;
+    list->tail = temp;
+}
+
 // ============================================================================
 // CRIAÇÃO E DESTRUIÇÃO
 // ============================================================================
@@ -127,21 +391,44 @@ static ListNode* get_node_at(const LinkedList *list, size_t index) {
  * Complexidade: O(1)
  */
 LinkedList* list_create(size_t element_size, ListType type, DestroyFn destroy) {
+    return list_create_with_allocator(element_size, type, destroy, NULL);
+}
+
+/**
+ * @brief Cria uma lista cujos nós vêm de um alocador customizado
+ *
+ * Complexidade: O(1)
+ */
+LinkedList* list_create_with_allocator(size_t element_size, ListType type,
+                                       DestroyFn destroy,
+                                       const DSAllocator *allocator) {
     if (element_size == 0) {
         return NULL;
     }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
 
-    LinkedList *list = (LinkedList*)malloc(sizeof(LinkedList));
+    LinkedList *list = (LinkedList*)ds_alloc(allocator, sizeof(LinkedList));
     if (list == NULL) {
         return NULL;
     }
 
+    list->allocator = *allocator;
+
     list->element_size = element_size;
     list->type = type;
     list->size = 0;
     list->destroy = destroy;
     list->head = NULL;
     list->tail = NULL;
+    list->chunk_capacity = 1;
+    if (type == LIST_UNROLLED) {
+        list->chunk_capacity = LIST_UNROLLED_CHUNK_BYTES / element_size;
+        if (list->chunk_capacity < LIST_UNROLLED_MIN_ELEMENTS) {
+            list->chunk_capacity = LIST_UNROLLED_MIN_ELEMENTS;
+        }
+    }
 
     return list;
 }
@@ -157,7 +444,8 @@ void list_destroy(LinkedList *list) {
     }
 
     list_clear(list);
-    free(list);
+    DSAllocator allocator = list->allocator;
+    ds_free(&allocator, list, sizeof(LinkedList));
 }
 
 // ============================================================================
@@ -182,7 +470,11 @@ DataStructureError list_push_front(LinkedList *list, const void *data) {
         return DS_ERROR_NULL_POINTER;
     }
 
-    ListNode *node = create_node(list->element_size, data);
+    if (list->type == LIST_UNROLLED) {
+        return unrolled_insert(list, list->head, 0, data);
+    }
+
+    ListNode *node = create_node(list, data);
     if (node == NULL) {
         return DS_ERROR_OUT_OF_MEMORY;
     }
@@ -224,7 +516,11 @@ DataStructureError list_push_back(LinkedList *list, const void *data) {
         return DS_ERROR_NULL_POINTER;
     }
 
-    ListNode *node = create_node(list->element_size, data);
+    if (list->type == LIST_UNROLLED) {
+        return unrolled_insert(list, list->tail, list->tail != NULL ? list->tail->count : 0, data);
+    }
+
+    ListNode *node = create_node(list, data);
     if (node == NULL) {
         return DS_ERROR_OUT_OF_MEMORY;
     }
@@ -277,6 +573,12 @@ DataStructureError list_insert_at(LinkedList *list, size_t index, const void *da
         return list_push_back(list, data);
     }
 
+    if (list->type == LIST_UNROLLED) {
+        size_t offset;
+        ListNode *chunk = unrolled_locate(list, index, &offset);
+        return unrolled_insert(list, chunk, offset, data);
+    }
+
     // Inserir no meio
     ListNode *current = get_node_at(list, index);
     if (current == NULL) {
@@ -296,7 +598,11 @@ DataStructureError list_insert_after(LinkedList *list, ListNode *node, const voi
         return DS_ERROR_NULL_POINTER;
     }
 
-    ListNode *new_node = create_node(list->element_size, data);
+    if (list->type == LIST_UNROLLED) {
+        return unrolled_insert(list, node, node->count, data);
+    }
+
+    ListNode *new_node = create_node(list, data);
     if (new_node == NULL) {
         return DS_ERROR_OUT_OF_MEMORY;
     }
@@ -334,7 +640,11 @@ DataStructureError list_insert_before(LinkedList *list, ListNode *node, const vo
         return DS_ERROR_NULL_POINTER;
     }
 
-    ListNode *new_node = create_node(list->element_size, data);
+    if (list->type == LIST_UNROLLED) {
+        return unrolled_insert(list, node, 0, data);
+    }
+
+    ListNode *new_node = create_node(list, data);
     if (new_node == NULL) {
         return DS_ERROR_OUT_OF_MEMORY;
     }
@@ -398,6 +708,11 @@ DataStructureError list_pop_front(LinkedList *list, void *output) {
         return DS_ERROR_EMPTY;
     }
 
+    if (list->type == LIST_UNROLLED) {
+        unrolled_remove(list, list->head, 0, output);
+        return DS_SUCCESS;
+    }
+
     ListNode *node = list->head;
 
     if (output != NULL) {
@@ -439,6 +754,11 @@ DataStructureError list_pop_back(LinkedList *list, void *output) {
         return DS_ERROR_EMPTY;
     }
 
+    if (list->type == LIST_UNROLLED) {
+        unrolled_remove(list, list->tail, list->tail->count - 1, output);
+        return DS_SUCCESS;
+    }
+
     ListNode *node = list->tail;
 
     if (output != NULL) {
@@ -487,6 +807,13 @@ DataStructureError list_remove_at(LinkedList *list, size_t index, void *output)
         return DS_ERROR_INVALID_INDEX;
     }
 
+    if (list->type == LIST_UNROLLED) {
+        size_t offset;
+        ListNode *chunk = unrolled_locate(list, index, &offset);
+        unrolled_remove(list, chunk, offset, output);
+        return DS_SUCCESS;
+    }
+
     if (index == 0) {
         return list_pop_front(list, output);
     }
@@ -525,6 +852,11 @@ DataStructureError list_remove_node(LinkedList *list, ListNode *node) {
         return DS_ERROR_NULL_POINTER;
     }
 
+    if (list->type == LIST_UNROLLED) {
+        unrolled_remove_chunk(list, node);
+        return DS_SUCCESS;
+    }
+
     // Casos especiais
     if (node == list->head) {
         return list_pop_front(list, NULL);
@@ -574,6 +906,16 @@ DataStructureError list_remove(LinkedList *list, const void *data, CompareFn com
         return DS_ERROR_NULL_POINTER;
     }
 
+    if (list->type == LIST_UNROLLED) {
+        size_t offset;
+        ListNode *chunk = unrolled_find(list, data, compare, &offset);
+        if (chunk == NULL) {
+            return DS_ERROR_NOT_FOUND;
+        }
+        unrolled_remove(list, chunk, offset, NULL);
+        return DS_SUCCESS;
+    }
+
     ListNode *node = list_find(list, data, compare);
     if (node == NULL) {
         return DS_ERROR_NOT_FOUND;
@@ -591,6 +933,16 @@ DataStructureError list_get(const LinkedList *list, size_t index, void *output)
         return DS_ERROR_NULL_POINTER;
     }
 
+    if (list->type == LIST_UNROLLED) {
+        if (index >= list->size) {
+            return DS_ERROR_INVALID_INDEX;
+        }
+        size_t offset;
+        ListNode *chunk = unrolled_locate(list, index, &offset);
+        memcpy(output, chunk_slot(list, chunk, offset), list->element_size);
+        return DS_SUCCESS;
+    }
+
     ListNode *node = get_node_at(list, index);
     if (node == NULL) {
         return DS_ERROR_INVALID_INDEX;
@@ -605,17 +957,28 @@ DataStructureError list_set(LinkedList *list, size_t index, const void *data) {
         return DS_ERROR_NULL_POINTER;
     }
 
-    ListNode *node = get_node_at(list, index);
-    if (node == NULL) {
-        return DS_ERROR_INVALID_INDEX;
+    void *slot;
+    if (list->type == LIST_UNROLLED) {
+        if (index >= list->size) {
+            return DS_ERROR_INVALID_INDEX;
+        }
+        size_t offset;
+        ListNode *chunk = unrolled_locate(list, index, &offset);
+        slot = chunk_slot(list, chunk, offset);
+    } else {
+        ListNode *node = get_node_at(list, index);
+        if (node == NULL) {
+            return DS_ERROR_INVALID_INDEX;
+        }
+        slot = node->data;
     }
 
     // Destruir dado antigo se necessário
     if (list->destroy != NULL) {
-        list->destroy(node->data);
+        list->destroy(slot);
     }
 
-    memcpy(node->data, data, list->element_size);
+    memcpy(slot, data, list->element_size);
     return DS_SUCCESS;
 }
 
@@ -624,6 +987,11 @@ ListNode* list_find(const LinkedList *list, const void *data, CompareFn compare)
         return NULL;
     }
 
+    if (list->type == LIST_UNROLLED) {
+        size_t offset;
+        return unrolled_find(list, data, compare, &offset);
+    }
+
     ListNode *current = list->head;
     size_t count = 0;
 
@@ -648,6 +1016,18 @@ ssize_t list_index_of(const LinkedList *list, const void *data, CompareFn compar
         return -1;
     }
 
+    if (list->type == LIST_UNROLLED) {
+        size_t index = 0;
+        for (ListNode *chunk = list->head; chunk != NULL; chunk = chunk->next) {
+            for (size_t i = 0; i < chunk->count; i++, index++) {
+                if (compare(chunk_slot(list, chunk, i), data) == 0) {
+                    return (ssize_t)index;
+                }
+            }
+        }
+        return -1;
+    }
+
     ListNode *current = list->head;
     for (size_t i = 0; i < list->size; i++) {
         if (compare(current->data, data) == 0) {
@@ -671,11 +1051,33 @@ size_t list_size(const LinkedList *list) {
     return (list == NULL) ? 0 : list->size;
 }
 
+size_t list_memory_usage(const LinkedList *list) {
+    if (list == NULL) {
+        return 0;
+    }
+    if (list->type != LIST_UNROLLED) {
+        return sizeof(LinkedList) + list->size * (sizeof(ListNode) + list->element_size);
+    }
+
+    size_t chunks = 0;
+    for (const ListNode *chunk = list->head; chunk != NULL; chunk = chunk->next) {
+        chunks++;
+    }
+    return sizeof(LinkedList) + chunks * chunk_bytes(list);
+}
+
 void list_clear(LinkedList *list) {
     if (list == NULL) {
         return;
     }
 
+    if (list->type == LIST_UNROLLED) {
+        while (list->head != NULL) {
+            unrolled_remove_chunk(list, list->head);
+        }
+        return;
+    }
+
     while (!list_is_empty(list)) {
         list_pop_front(list, NULL);
     }
@@ -688,9 +1090,22 @@ void list_print(const LinkedList *list, PrintFn print) {
 
     printf("LinkedList(%s, size=%zu) [",
            (list->type == LIST_SINGLY ? "SINGLY" :
-            list->type == LIST_DOUBLY ? "DOUBLY" : "CIRCULAR"),
+            list->type == LIST_DOUBLY ? "DOUBLY" :
+            list->type == LIST_CIRCULAR ? "CIRCULAR" : "UNROLLED"),
            list->size);
 
+    if (list->type == LIST_UNROLLED) {
+        size_t count = 0;
+        for (ListNode *chunk = list->head; chunk != NULL; chunk = chunk->next) {
+            for (size_t i = 0; i < chunk->count; i++, count++) {
+                if (count > 0) printf(i == 0 ? " | " : " <-> ");
+                print(chunk_slot(list, chunk, i));
+            }
+        }
+        printf("]\n");
+        return;
+    }
+
     ListNode *current = list->head;
     size_t count = 0;
 
@@ -713,6 +1128,11 @@ void list_reverse(LinkedList *list) {
         return;
     }
 
+    if (list->type == LIST_UNROLLED) {
+        unrolled_reverse(list);
+        return;
+    }
+
     ListNode *current = list->head;
     ListNode *temp = NULL;
 
@@ -761,6 +1181,10 @@ void* list_node_data(const ListNode *node) {
     return (node == NULL) ? NULL : node->data;
 }
 
+size_t list_node_count(const ListNode *node) {
+    return (node == NULL) ? 0 : node->count;
+}
+
 // TODO: Implementar operações avançadas quando necessário
 LinkedList* list_clone(const LinkedList *list, CopyFn copy) {
     (void)list;
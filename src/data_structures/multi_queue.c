@@ -0,0 +1,298 @@
+/**
+ * @file multi_queue.c
+ * @brief Implementação da MultiQueue (heaps com try-lock e duas escolhas)
+ *
+ * Cada heap vive em um slot alinhado a uma linha de cache com:
+ * - lock: atomic_flag usado só como try-lock (nenhuma thread espera
+ *   segurando outro lock, então não há deadlock)
+ * - size: tamanho publicado para que threads descartem heaps vazios sem
+ *   tocar no lock
+ * - top: cópia do topo, atualizada após cada modificação, para comparar
+ *   dois heaps sem depender do layout interno do Heap
+ *
+ * Referências:
+ * - Rihani, H., Sanders, P. & Dementiev, R. (2015). "MultiQueues: Simple
+ *   Relaxed Concurrent Priority Queues". SPAA '15
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/multi_queue.h"
+#include "data_structures/heap.h"
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/** Linha de cache usada para separar os slots */
+#define MULTIQUEUE_CACHE_LINE 64
+
+/** Capacidade inicial de cada heap */
+#define MULTIQUEUE_INITIAL_CAPACITY 16
+
+// ============================================================================
+// ESTRUTURA INTERNA
+// ============================================================================
+
+typedef struct {
+    _Alignas(MULTIQUEUE_CACHE_LINE) atomic_flag lock;
+    atomic_size_t size;
+    Heap *heap;
+    unsigned char *top;     // válido com o lock e size > 0
+} MQSlot;
+
+struct MultiQueue {
+    MQSlot *slots;
+    size_t num_queues;
+    size_t element_size;
+    PriorityQueueType type;
+    CompareFn compare;
+};
+
+// ============================================================================
+// FUNÇÕES AUXILIARES PRIVADAS
+// ============================================================================
+
+// Gerador xorshift64* por thread; cada thread recebe uma semente distinta
+static _Thread_local uint64_t t_mq_rng = 0;
+static atomic_uint_fast64_t mq_seed_sequence = 0;
+
+static uint64_t mq_random(void) {
+    if (t_mq_rng == 0) {
+        uint64_t z = (uint64_t)atomic_fetch_add_explicit(&mq_seed_sequence, 1,
+                                                         memory_order_relaxed);
+        z = (z + 1) * 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        t_mq_rng = (z ^ (z >> 31)) | 1;
+    }
+    t_mq_rng ^= t_mq_rng >> 12;
+    t_mq_rng ^= t_mq_rng << 25;
+    t_mq_rng ^= t_mq_rng >> 27;
+    return t_mq_rng * 0x2545F4914F6CDD1DULL;
+}
+
+static inline MQSlot *mq_pick(const MultiQueue *mq) {
+    return &mq->slots[mq_random() % mq->num_queues];
+}
+
+static inline bool slot_try_lock(MQSlot *slot) {
+    return !atomic_flag_test_and_set_explicit(&slot->lock, memory_order_acquire);
+}
+
+static inline void slot_unlock(MQSlot *slot) {
+    atomic_flag_clear_explicit(&slot->lock, memory_order_release);
+}
+
+static inline size_t slot_size(const MQSlot *slot) {
+    return atomic_load_explicit(&slot->size, memory_order_relaxed);
+}
+
+/**
+ * Republica size e top após modificar o heap (com o lock)
+ */
+static void slot_refresh(MQSlot *slot) {
+    size_t size = heap_size(slot->heap);
+    if (size > 0) {
+        heap_peek(slot->heap, slot->top);
+    }
+    atomic_store_explicit(&slot->size, size, memory_order_relaxed);
+}
+
+/**
+ * Entre dois slots travados, o não vazio de melhor topo (NULL se ambos vazios)
+ */
+static MQSlot *slot_better(const MultiQueue *mq, MQSlot *a, MQSlot *b) {
+    bool a_has = heap_size(a->heap) > 0;
+    bool b_has = heap_size(b->heap) > 0;
+    if (!a_has || !b_has) {
+        return a_has ? a : (b_has ? b : NULL);
+    }
+
+    int cmp = mq->compare(a->top, b->top);
+    bool a_first = (mq->type == PQ_MIN) ? (cmp <= 0) : (cmp >= 0);
+    return a_first ? a : b;
+}
+
+static MultiQueue *mq_free(MultiQueue *mq, size_t created) {
+    for (size_t i = 0; i < created; i++) {
+        heap_destroy(mq->slots[i].heap);
+        free(mq->slots[i].top);
+    }
+    free(mq->slots);
+    free(mq);
+    return NULL;
+}
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+MultiQueue* multiqueue_create(size_t element_size, size_t num_queues,
+                              PriorityQueueType type, CompareFn compare, DestroyFn destroy) {
+    if (element_size == 0 || num_queues == 0 || compare == NULL ||
+        num_queues > SIZE_MAX / sizeof(MQSlot)) {
+        return NULL;
+    }
+
+    MultiQueue *mq = (MultiQueue *)malloc(sizeof(MultiQueue));
+    if (mq == NULL) {
+        return NULL;
+    }
+    // sizeof(MQSlot) é múltiplo da linha de cache, como exige aligned_alloc
+    mq->slots = (MQSlot *)aligned_alloc(MULTIQUEUE_CACHE_LINE, num_queues * sizeof(MQSlot));
+    if (mq->slots == NULL) {
+        free(mq);
+        return NULL;
+    }
+
+    HeapType heap_type = (type == PQ_MIN) ? HEAP_MIN : HEAP_MAX;
+    for (size_t i = 0; i < num_queues; i++) {
+        MQSlot *slot = &mq->slots[i];
+        slot->heap = heap_create(element_size, MULTIQUEUE_INITIAL_CAPACITY,
+                                 heap_type, compare, destroy);
+        slot->top = (unsigned char *)malloc(element_size);
+        if (slot->heap == NULL || slot->top == NULL) {
+            heap_destroy(slot->heap);
+            free(slot->top);
+            return mq_free(mq, i);
+        }
+        atomic_flag_clear(&slot->lock);
+        atomic_init(&slot->size, 0);
+    }
+
+    mq->num_queues = num_queues;
+    mq->element_size = element_size;
+    mq->type = type;
+    mq->compare = compare;
+    return mq;
+}
+
+void multiqueue_destroy(MultiQueue *mq) {
+    if (mq == NULL) {
+        return;
+    }
+
+    mq_free(mq, mq->num_queues);
+}
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+DataStructureError multiqueue_insert(MultiQueue *mq, const void *data) {
+    if (mq == NULL || data == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    MQSlot *slot = mq_pick(mq);
+    while (!slot_try_lock(slot)) {
+        slot = mq_pick(mq);
+    }
+
+    DataStructureError err = heap_insert(slot->heap, data);
+    if (err == DS_SUCCESS) {
+        slot_refresh(slot);
+    }
+    slot_unlock(slot);
+    return err;
+}
+
+/**
+ * Sorteia pares de heaps até extrair de um deles. Pares com os dois heaps
+ * vazios contam como falha; após num_queues falhas, varre todos os heaps
+ * em ordem (esperando pelos locks) antes de concluir que a fila está vazia.
+ */
+DataStructureError multiqueue_extract(MultiQueue *mq, void *output) {
+    if (mq == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    size_t misses = 0;
+    while (misses < mq->num_queues) {
+        MQSlot *a = mq_pick(mq);
+        MQSlot *b = mq_pick(mq);
+        if (slot_size(a) == 0 && slot_size(b) == 0) {
+            misses++;
+            continue;
+        }
+        if (!slot_try_lock(a)) {
+            continue;
+        }
+        if (b != a && !slot_try_lock(b)) {
+            slot_unlock(a);
+            continue;
+        }
+
+        MQSlot *best = slot_better(mq, a, b);
+        if (best != NULL) {
+            heap_extract(best->heap, output);
+            slot_refresh(best);
+        }
+        if (b != a) {
+            slot_unlock(b);
+        }
+        slot_unlock(a);
+        if (best != NULL) {
+            return DS_SUCCESS;
+        }
+        misses++;
+    }
+
+    for (size_t i = 0; i < mq->num_queues; i++) {
+        MQSlot *slot = &mq->slots[i];
+        if (slot_size(slot) == 0) {
+            continue;
+        }
+        while (!slot_try_lock(slot)) {
+        }
+        bool found = heap_size(slot->heap) > 0;
+        if (found) {
+            heap_extract(slot->heap, output);
+            slot_refresh(slot);
+        }
+        slot_unlock(slot);
+        if (found) {
+            return DS_SUCCESS;
+        }
+    }
+    return DS_ERROR_EMPTY;
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+size_t multiqueue_size(const MultiQueue *mq) {
+    if (mq == NULL) {
+        return 0;
+    }
+
+    size_t total = 0;
+    for (size_t i = 0; i < mq->num_queues; i++) {
+        total += slot_size(&mq->slots[i]);
+    }
+    return total;
+}
+
+size_t multiqueue_memory_usage(const MultiQueue *mq) {
+    if (mq == NULL) {
+        return 0;
+    }
+
+    size_t bytes = sizeof(MultiQueue) + mq->num_queues * (sizeof(MQSlot) + mq->element_size);
+    for (size_t i = 0; i < mq->num_queues; i++) {
+        bytes += heap_memory_usage(mq->slots[i].heap);
+    }
+    return bytes;
+}
+
+size_t multiqueue_num_queues(const MultiQueue *mq) {
+    return mq ? mq->num_queues : 0;
+}
+
+bool multiqueue_is_empty(const MultiQueue *mq) {
+    return multiqueue_size(mq) == 0;
+}
@@ -0,0 +1,289 @@
+/**
+ * @file pairing_heap.c
+ * @brief Implementação do pairing heap (filho-esquerdo/irmão-direito)
+ *
+ * Cada nó é uma única alocação: cabeçalho {child, sibling} seguido do dado,
+ * alinhado a max_align_t. A extração usa a junção em duas passadas de
+ * Fredman et al., de forma iterativa (a lista de filhos pode ter O(n) nós).
+ *
+ * Referências:
+ * - Fredman, M. L. et al. (1986). "The Pairing Heap: A New Form of
+ *   Self-Adjusting Heap". Algorithmica 1(1)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/pairing_heap.h"
+
+#include <stdint.h>
+#include <string.h>
+
+// ============================================================================
+// ESTRUTURA INTERNA
+// ============================================================================
+
+typedef struct PairingNode {
+    struct PairingNode *child;
+    struct PairingNode *sibling;
+} PairingNode;
+
+/** Cabeçalho do nó arredondado para o alinhamento máximo do dado */
+#define PAIRING_NODE_HEADER \
+    ((sizeof(PairingNode) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t))
+
+struct PairingHeap {
+    PairingNode *root;
+    size_t size;
+    size_t element_size;
+    HeapType type;
+    CompareFn compare;
+    DestroyFn destroy;
+    DSAllocator allocator;
+};
+
+// ============================================================================
+// FUNÇÕES AUXILIARES PRIVADAS
+// ============================================================================
+
+static inline void *node_data(const PairingNode *node) {
+    return (char *)node + PAIRING_NODE_HEADER;
+}
+
+static inline size_t node_bytes(const PairingHeap *heap) {
+    return PAIRING_NODE_HEADER + heap->element_size;
+}
+
+/**
+ * true se o dado de a deve ficar acima do de b
+ */
+static inline bool node_before(const PairingHeap *heap, const PairingNode *a,
+                               const PairingNode *b) {
+    int cmp = heap->compare(node_data(a), node_data(b));
+    return (heap->type == HEAP_MIN) ? (cmp < 0) : (cmp > 0);
+}
+
+/**
+ * Liga duas raízes (sem irmãos): a perdedora vira o primeiro filho da vencedora
+ */
+static PairingNode *pairing_link(const PairingHeap *heap, PairingNode *a, PairingNode *b) {
+    if (a == NULL) {
+        return b;
+    }
+    if (b == NULL) {
+        return a;
+    }
+    if (node_before(heap, b, a)) {
+        PairingNode *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    b->sibling = a->child;
+    a->child = b;
+    return a;
+}
+
+/**
+ * Junção em duas passadas da lista de irmãos first
+ *
+ * 1ª passada: liga pares da esquerda para a direita, empilhando os
+ *             resultados (pelo campo sibling) em ordem inversa
+ * 2ª passada: desempilha ligando cada par ao acumulado
+ */
+static PairingNode *pairing_merge_pairs(const PairingHeap *heap, PairingNode *first) {
+    PairingNode *pairs = NULL;
+
+    while (first != NULL) {
+        PairingNode *a = first;
+        PairingNode *b = a->sibling;
+        if (b == NULL) {
+            a->sibling = pairs;
+            pairs = a;
+            break;
+        }
+        first = b->sibling;
+        a->sibling = NULL;
+        b->sibling = NULL;
+        PairingNode *linked = pairing_link(heap, a, b);
+        linked->sibling = pairs;
+        pairs = linked;
+    }
+
+    PairingNode *result = NULL;
+    while (pairs != NULL) {
+        PairingNode *next = pairs->sibling;
+        pairs->sibling = NULL;
+        result = pairing_link(heap, result, pairs);
+        pairs = next;
+    }
+    return result;
+}
+
+/**
+ * Libera todos os nós em O(n) sem pilha: rotaciona cada filho para a
+ * cadeia de irmãos até que o nó corrente não tenha filhos
+ */
+static void pairing_free_all(PairingHeap *heap) {
+    PairingNode *node = heap->root;
+
+    while (node != NULL) {
+        if (node->child != NULL) {
+            PairingNode *child = node->child;
+            node->child = child->sibling;
+            child->sibling = node;
+            node = child;
+            continue;
+        }
+        PairingNode *next = node->sibling;
+        if (heap->destroy != NULL) {
+            heap->destroy(node_data(node));
+        }
+        ds_free(&heap->allocator, node, node_bytes(heap));
+        node = next;
+    }
+
+    heap->root = NULL;
+    heap->size = 0;
+}
+
+static bool same_allocator(const DSAllocator *a, const DSAllocator *b) {
+    return a->alloc == b->alloc && a->realloc == b->realloc &&
+           a->free == b->free && a->ctx == b->ctx;
+}
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+PairingHeap* pairing_heap_create(size_t element_size, HeapType type,
+                                 CompareFn compare, DestroyFn destroy) {
+    return pairing_heap_create_with_allocator(element_size, type, compare, destroy, NULL);
+}
+
+PairingHeap* pairing_heap_create_with_allocator(size_t element_size, HeapType type,
+                                                CompareFn compare, DestroyFn destroy,
+                                                const DSAllocator *allocator) {
+    if (element_size == 0 || compare == NULL ||
+        element_size > SIZE_MAX - PAIRING_NODE_HEADER) {
+        return NULL;
+    }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
+
+    PairingHeap *heap = (PairingHeap *)ds_alloc(allocator, sizeof(PairingHeap));
+    if (heap == NULL) {
+        return NULL;
+    }
+
+    heap->root = NULL;
+    heap->size = 0;
+    heap->element_size = element_size;
+    heap->type = type;
+    heap->compare = compare;
+    heap->destroy = destroy;
+    heap->allocator = *allocator;
+    return heap;
+}
+
+void pairing_heap_destroy(PairingHeap *heap) {
+    if (heap == NULL) {
+        return;
+    }
+
+    pairing_free_all(heap);
+    DSAllocator allocator = heap->allocator;
+    ds_free(&allocator, heap, sizeof(PairingHeap));
+}
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+DataStructureError pairing_heap_insert(PairingHeap *heap, const void *data) {
+    if (heap == NULL || data == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    PairingNode *node = (PairingNode *)ds_alloc(&heap->allocator, node_bytes(heap));
+    if (node == NULL) {
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+    node->child = NULL;
+    node->sibling = NULL;
+    memcpy(node_data(node), data, heap->element_size);
+
+    heap->root = pairing_link(heap, heap->root, node);
+    heap->size++;
+    return DS_SUCCESS;
+}
+
+DataStructureError pairing_heap_extract(PairingHeap *heap, void *output) {
+    if (heap == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (heap->root == NULL) {
+        return DS_ERROR_EMPTY;
+    }
+
+    PairingNode *root = heap->root;
+    if (output != NULL) {
+        memcpy(output, node_data(root), heap->element_size);
+    }
+    heap->root = pairing_merge_pairs(heap, root->child);
+    heap->size--;
+    ds_free(&heap->allocator, root, node_bytes(heap));
+    return DS_SUCCESS;
+}
+
+DataStructureError pairing_heap_peek(const PairingHeap *heap, void *output) {
+    if (heap == NULL || output == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (heap->root == NULL) {
+        return DS_ERROR_EMPTY;
+    }
+
+    memcpy(output, node_data(heap->root), heap->element_size);
+    return DS_SUCCESS;
+}
+
+DataStructureError pairing_heap_meld(PairingHeap *dst, PairingHeap *src) {
+    if (dst == NULL || src == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (dst == src || dst->element_size != src->element_size || dst->type != src->type ||
+        dst->compare != src->compare || !same_allocator(&dst->allocator, &src->allocator)) {
+        return DS_ERROR_INVALID_PARAM;
+    }
+
+    dst->root = pairing_link(dst, dst->root, src->root);
+    dst->size += src->size;
+    src->root = NULL;
+    src->size = 0;
+    return DS_SUCCESS;
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+bool pairing_heap_is_empty(const PairingHeap *heap) {
+    return heap == NULL || heap->size == 0;
+}
+
+size_t pairing_heap_size(const PairingHeap *heap) {
+    return heap ? heap->size : 0;
+}
+
+size_t pairing_heap_memory_usage(const PairingHeap *heap) {
+    return heap ? sizeof(PairingHeap) + heap->size * node_bytes(heap) : 0;
+}
+
+void pairing_heap_clear(PairingHeap *heap) {
+    if (heap == NULL) {
+        return;
+    }
+
+    pairing_free_all(heap);
+}
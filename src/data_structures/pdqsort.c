@@ -0,0 +1,522 @@
+/**
+ * @file pdqsort.c
+ * @brief Implementação do pattern-defeating quicksort genérico
+ *
+ * Tradução para void* do pdqsort de Orson Peters. Intervalos são
+ * [begin, end) em ponteiros de byte; o laço principal recorre na partição
+ * menor e itera na maior (pilha O(log n)). Partições que não são a mais à
+ * esquerda têm um elemento <= a todos os seus logo antes de begin, o que
+ * permite a insertion sort sem checagem de limite.
+ *
+ * Referências:
+ * - Peters, O. R. L. (2021). "Pattern-defeating Quicksort"
+ * - Edelkamp, S. & Weiss, A. (2016). "BlockQuicksort"
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/pdqsort.h"
+#include "data_structures/instrument.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// PARÂMETROS
+// ============================================================================
+
+#define PDQ_INSERTION_THRESHOLD 24      // partições menores: insertion sort
+#define PDQ_NINTHER_THRESHOLD 128       // partições maiores: ninther de Tukey
+#define PDQ_PARTIAL_INSERTION_LIMIT 8   // movimentos da insertion sort parcial
+#define PDQ_BLOCK 64                    // offsets por bloco (cabe em unsigned char)
+#define PDQ_STACK_ELEM 64               // maior elemento com buffers na pilha
+
+typedef struct {
+    size_t es;              // tamanho do elemento
+    CompareFn cmp;
+    unsigned char *pivot;   // cópia do pivô durante a partição
+    unsigned char *tmp;     // buraco da insertion sort / ciclo de trocas
+} PdqSort;
+
+// ============================================================================
+// MOVIMENTAÇÃO DE ELEMENTOS
+// ============================================================================
+
+static inline void pdq_move(void *dst, const void *src, size_t es) {
+    switch (es) {
+        case 4: { uint32_t t; memcpy(&t, src, 4); memcpy(dst, &t, 4); return; }
+        case 8: { uint64_t t; memcpy(&t, src, 8); memcpy(dst, &t, 8); return; }
+        case 16: { uint64_t t[2]; memcpy(t, src, 16); memcpy(dst, t, 16); return; }
+        default: memmove(dst, src, es); return;
+    }
+}
+
+static inline void pdq_swap(void *a, void *b, size_t es) {
+    DS_COUNT(SORTING, SWAPS, 1);
+    switch (es) {
+        case 4: {
+            uint32_t x, y;
+            memcpy(&x, a, 4); memcpy(&y, b, 4);
+            memcpy(a, &y, 4); memcpy(b, &x, 4);
+            return;
+        }
+        case 8: {
+            uint64_t x, y;
+            memcpy(&x, a, 8); memcpy(&y, b, 8);
+            memcpy(a, &y, 8); memcpy(b, &x, 8);
+            return;
+        }
+        case 16: {
+            uint64_t x[2], y[2];
+            memcpy(x, a, 16); memcpy(y, b, 16);
+            memcpy(a, y, 16); memcpy(b, x, 16);
+            return;
+        }
+        default: break;
+    }
+    if (a == b) return;
+    unsigned char *p = (unsigned char *)a;
+    unsigned char *q = (unsigned char *)b;
+    unsigned char t[32];
+    while (es > 0) {
+        size_t k = (es < sizeof(t)) ? es : sizeof(t);
+        memcpy(t, p, k);
+        memcpy(p, q, k);
+        memcpy(q, t, k);
+        p += k;
+        q += k;
+        es -= k;
+    }
+}
+
+static inline bool pdq_less(const PdqSort *s, const void *a, const void *b) {
+    DS_COUNT(SORTING, COMPARISONS, 1);
+    return s->cmp(a, b) < 0;
+}
+
+static inline size_t pdq_count(const unsigned char *begin, const unsigned char *end, size_t es) {
+    return (size_t)(end - begin) / es;
+}
+
+// ============================================================================
+// INSERTION SORT
+// ============================================================================
+
+static void pdq_insertion_sort(const PdqSort *s, unsigned char *begin, unsigned char *end) {
+    size_t es = s->es;
+    if (begin == end) return;
+
+    for (unsigned char *cur = begin + es; cur < end; cur += es) {
+        if (!pdq_less(s, cur, cur - es)) continue;
+        unsigned char *sift = cur;
+        pdq_move(s->tmp, cur, es);
+        do {
+            pdq_move(sift, sift - es, es);
+            sift -= es;
+        } while (sift != begin && pdq_less(s, s->tmp, sift - es));
+        pdq_move(sift, s->tmp, es);
+    }
+}
+
+// Exige begin[-1] <= todo elemento de [begin, end)
+static void pdq_unguarded_insertion_sort(const PdqSort *s, unsigned char *begin,
+                                         unsigned char *end) {
+    size_t es = s->es;
+    if (begin == end) return;
+
+    for (unsigned char *cur = begin + es; cur < end; cur += es) {
+        if (!pdq_less(s, cur, cur - es)) continue;
+        unsigned char *sift = cur;
+        pdq_move(s->tmp, cur, es);
+        do {
+            pdq_move(sift, sift - es, es);
+            sift -= es;
+        } while (pdq_less(s, s->tmp, sift - es));
+        pdq_move(sift, s->tmp, es);
+    }
+}
+
+// Ordena se bastarem poucos movimentos; false = desistiu (intervalo alterado)
+static bool pdq_partial_insertion_sort(const PdqSort *s, unsigned char *begin,
+                                       unsigned char *end) {
+    size_t es = s->es;
+    if (begin == end) return true;
+
+    size_t limit = 0;
+    for (unsigned char *cur = begin + es; cur < end; cur += es) {
+        if (!pdq_less(s, cur, cur - es)) continue;
+        unsigned char *sift = cur;
+        pdq_move(s->tmp, cur, es);
+        do {
+            pdq_move(sift, sift - es, es);
+            sift -= es;
+        } while (sift != begin && pdq_less(s, s->tmp, sift - es));
+        pdq_move(sift, s->tmp, es);
+
+        limit += pdq_count(sift, cur, es);
+        if (limit > PDQ_PARTIAL_INSERTION_LIMIT) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// HEAPSORT (FALLBACK)
+// ============================================================================
+
+static void pdq_sift_down(unsigned char *base, size_t n, size_t i, size_t es, CompareFn cmp) {
+    for (;;) {
+        size_t largest = i;
+        size_t left = 2 * i + 1;
+        size_t right = left + 1;
+        DS_COUNT(SORTING, COMPARISONS, (left < n) + (right < n));
+        if (left < n && cmp(base + left * es, base + largest * es) > 0) largest = left;
+        if (right < n && cmp(base + right * es, base + largest * es) > 0) largest = right;
+        if (largest == i) return;
+        pdq_swap(base + i * es, base + largest * es, es);
+        i = largest;
+    }
+}
+
+static void pdq_heapsort(unsigned char *base, size_t n, size_t es, CompareFn cmp) {
+    for (size_t i = n / 2; i > 0; i--) {
+        pdq_sift_down(base, n, i - 1, es, cmp);
+    }
+    for (size_t i = n - 1; i > 0; i--) {
+        pdq_swap(base, base + i * es, es);
+        pdq_sift_down(base, i, 0, es, cmp);
+    }
+}
+
+// ============================================================================
+// PIVÔ
+// ============================================================================
+
+static inline void pdq_sort2(const PdqSort *s, unsigned char *a, unsigned char *b) {
+    if (pdq_less(s, b, a)) pdq_swap(a, b, s->es);
+}
+
+static inline void pdq_sort3(const PdqSort *s, unsigned char *a, unsigned char *b,
+                             unsigned char *c) {
+    pdq_sort2(s, a, b);
+    pdq_sort2(s, b, c);
+    pdq_sort2(s, a, b);
+}
+
+// ============================================================================
+// PARTICIONAMENTO
+// ============================================================================
+
+// Troca num pares (first + offsets_l[i], last - offsets_r[i]). Com mais
+// elementos de um lado que do outro, um único ciclo de movimentos substitui
+// as trocas; com contagens iguais as trocas são necessárias para manter
+// O(n) em entradas decrescentes.
+static void pdq_swap_offsets(const PdqSort *s, unsigned char *first, unsigned char *last,
+                             const unsigned char *offsets_l, const unsigned char *offsets_r,
+                             size_t num, bool use_swaps) {
+    size_t es = s->es;
+    if (use_swaps) {
+        for (size_t i = 0; i < num; i++) {
+            pdq_swap(first + offsets_l[i] * es, last - offsets_r[i] * es, es);
+        }
+    } else if (num > 0) {
+        unsigned char *l = first + offsets_l[0] * es;
+        unsigned char *r = last - offsets_r[0] * es;
+        pdq_move(s->tmp, l, es);
+        pdq_move(l, r, es);
+        for (size_t i = 1; i < num; i++) {
+            l = first + offsets_l[i] * es;
+            pdq_move(r, l, es);
+            r = last - offsets_r[i] * es;
+            pdq_move(l, r, es);
+        }
+        pdq_move(r, s->tmp, es);
+    }
+}
+
+// Particiona [begin, end) em torno de *begin: [< pivo] pivo [>= pivo].
+// *already_partitioned indica que nenhuma troca foi necessária.
+static unsigned char* pdq_partition_right(const PdqSort *s, unsigned char *begin,
+                                          unsigned char *end, bool *already_partitioned) {
+    size_t es = s->es;
+    pdq_move(s->pivot, begin, es);
+
+    unsigned char *first = begin;
+    unsigned char *last = end;
+
+    // A mediana garante um elemento >= pivo e as partições à direita um < pivo
+    do first += es; while (pdq_less(s, first, s->pivot));
+    if (first - es == begin) {
+        while (first < last) {
+            last -= es;
+            if (pdq_less(s, last, s->pivot)) break;
+        }
+    } else {
+        do last -= es; while (!pdq_less(s, last, s->pivot));
+    }
+
+    *already_partitioned = first >= last;
+    if (!*already_partitioned) {
+        pdq_swap(first, last, es);
+        first += es;
+
+        // Blocos: registra sem desvios os offsets dos elementos fora do lugar
+        unsigned char offsets_l[PDQ_BLOCK];
+        unsigned char offsets_r[PDQ_BLOCK];
+        size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+        while (pdq_count(first, last, es) > 2 * PDQ_BLOCK) {
+            if (num_l == 0) {
+                start_l = 0;
+                unsigned char *it = first;
+                for (size_t i = 0; i < PDQ_BLOCK; i++, it += es) {
+                    offsets_l[num_l] = (unsigned char)i;
+                    num_l += !pdq_less(s, it, s->pivot);
+                }
+            }
+            if (num_r == 0) {
+                start_r = 0;
+                unsigned char *it = last;
+                for (size_t i = 0; i < PDQ_BLOCK; i++) {
+                    it -= es;
+                    offsets_r[num_r] = (unsigned char)(i + 1);
+                    num_r += pdq_less(s, it, s->pivot);
+                }
+            }
+
+            size_t num = (num_l < num_r) ? num_l : num_r;
+            pdq_swap_offsets(s, first, last, offsets_l + start_l, offsets_r + start_r,
+                             num, num_l == num_r);
+            num_l -= num;
+            num_r -= num;
+            start_l += num;
+            start_r += num;
+            if (num_l == 0) first += PDQ_BLOCK * es;
+            if (num_r == 0) last -= PDQ_BLOCK * es;
+        }
+
+        // Resto: divide os elementos ainda não classificados entre os lados
+        size_t l_size, r_size;
+        size_t unknown_left = pdq_count(first, last, es) - ((num_r || num_l) ? PDQ_BLOCK : 0);
+        if (num_r) {
+            l_size = unknown_left;
+            r_size = PDQ_BLOCK;
+        } else if (num_l) {
+            l_size = PDQ_BLOCK;
+            r_size = unknown_left;
+        } else {
+            l_size = unknown_left / 2;
+            r_size = unknown_left - l_size;
+        }
+
+        if (unknown_left && !num_l) {
+            start_l = 0;
+            unsigned char *it = first;
+            for (size_t i = 0; i < l_size; i++, it += es) {
+                offsets_l[num_l] = (unsigned char)i;
+                num_l += !pdq_less(s, it, s->pivot);
+            }
+        }
+        if (unknown_left && !num_r) {
+            start_r = 0;
+            unsigned char *it = last;
+            for (size_t i = 0; i < r_size; i++) {
+                it -= es;
+                offsets_r[num_r] = (unsigned char)(i + 1);
+                num_r += pdq_less(s, it, s->pivot);
+            }
+        }
+
+        size_t num = (num_l < num_r) ? num_l : num_r;
+        pdq_swap_offsets(s, first, last, offsets_l + start_l, offsets_r + start_r,
+                         num, num_l == num_r);
+        num_l -= num;
+        num_r -= num;
+        start_l += num;
+        start_r += num;
+        if (num_l == 0) first += l_size * es;
+        if (num_r == 0) last -= r_size * es;
+
+        // Sobrou um lado: leva seus elementos para a fronteira
+        if (num_l) {
+            const unsigned char *offsets = offsets_l + start_l;
+            while (num_l--) {
+                last -= es;
+                pdq_swap(first + offsets[num_l] * es, last, es);
+            }
+            first = last;
+        }
+        if (num_r) {
+            const unsigned char *offsets = offsets_r + start_r;
+            while (num_r--) {
+                pdq_swap(last - offsets[num_r] * es, first, es);
+                first += es;
+            }
+            last = first;
+        }
+    }
+
+    unsigned char *pivot_pos = first - es;
+    pdq_move(begin, pivot_pos, es);
+    pdq_move(pivot_pos, s->pivot, es);
+    return pivot_pos;
+}
+
+// Particiona [begin, end) em [<= pivo] pivo [> pivo]. Usada quando o
+// elemento anterior é igual ao pivo: todos os iguais vão à esquerda e
+// nunca mais são tocados.
+static unsigned char* pdq_partition_left(const PdqSort *s, unsigned char *begin,
+                                         unsigned char *end) {
+    size_t es = s->es;
+    pdq_move(s->pivot, begin, es);
+
+    unsigned char *first = begin;
+    unsigned char *last = end;
+
+    do last -= es; while (pdq_less(s, s->pivot, last));
+    if (last + es == end) {
+        while (first < last) {
+            first += es;
+            if (pdq_less(s, s->pivot, first)) break;
+        }
+    } else {
+        do first += es; while (!pdq_less(s, s->pivot, first));
+    }
+
+    while (first < last) {
+        pdq_swap(first, last, es);
+        do last -= es; while (pdq_less(s, s->pivot, last));
+        do first += es; while (!pdq_less(s, s->pivot, first));
+    }
+
+    unsigned char *pivot_pos = last;
+    pdq_move(begin, pivot_pos, es);
+    pdq_move(pivot_pos, s->pivot, es);
+    return pivot_pos;
+}
+
+// ============================================================================
+// LAÇO PRINCIPAL
+// ============================================================================
+
+static void pdq_loop(const PdqSort *s, unsigned char *begin, unsigned char *end,
+                     int bad_allowed, bool leftmost) {
+    size_t es = s->es;
+
+    for (;;) {
+        size_t size = pdq_count(begin, end, es);
+
+        if (size < PDQ_INSERTION_THRESHOLD) {
+            if (leftmost) pdq_insertion_sort(s, begin, end);
+            else pdq_unguarded_insertion_sort(s, begin, end);
+            return;
+        }
+
+        // Pivô vai para begin
+        size_t s2 = size / 2;
+        if (size > PDQ_NINTHER_THRESHOLD) {
+            pdq_sort3(s, begin, begin + s2 * es, end - es);
+            pdq_sort3(s, begin + es, begin + (s2 - 1) * es, end - 2 * es);
+            pdq_sort3(s, begin + 2 * es, begin + (s2 + 1) * es, end - 3 * es);
+            pdq_sort3(s, begin + (s2 - 1) * es, begin + s2 * es, begin + (s2 + 1) * es);
+            pdq_swap(begin, begin + s2 * es, es);
+        } else {
+            pdq_sort3(s, begin + s2 * es, begin, end - es);
+        }
+
+        // Pivô igual ao elemento anterior: o intervalo começa com uma
+        // sequência de chaves iguais, separada de uma vez
+        if (!leftmost && !pdq_less(s, begin - es, begin)) {
+            begin = pdq_partition_left(s, begin, end) + es;
+            continue;
+        }
+
+        bool already_partitioned;
+        unsigned char *pivot_pos = pdq_partition_right(s, begin, end, &already_partitioned);
+
+        size_t l_size = pdq_count(begin, pivot_pos, es);
+        size_t r_size = pdq_count(pivot_pos + es, end, es);
+        bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced) {
+            // Muitas partições ruins: heapsort garante O(n log n)
+            if (--bad_allowed == 0) {
+                pdq_heapsort(begin, size, es, s->cmp);
+                return;
+            }
+
+            // Embaralha alguns elementos para quebrar o padrão adversário
+            if (l_size >= PDQ_INSERTION_THRESHOLD) {
+                size_t q = l_size / 4;
+                pdq_swap(begin, begin + q * es, es);
+                pdq_swap(pivot_pos - es, pivot_pos - q * es, es);
+                if (l_size > PDQ_NINTHER_THRESHOLD) {
+                    pdq_swap(begin + es, begin + (q + 1) * es, es);
+                    pdq_swap(begin + 2 * es, begin + (q + 2) * es, es);
+                    pdq_swap(pivot_pos - 2 * es, pivot_pos - (q + 1) * es, es);
+                    pdq_swap(pivot_pos - 3 * es, pivot_pos - (q + 2) * es, es);
+                }
+            }
+            if (r_size >= PDQ_INSERTION_THRESHOLD) {
+                size_t q = r_size / 4;
+                pdq_swap(pivot_pos + es, pivot_pos + (1 + q) * es, es);
+                pdq_swap(end - es, end - q * es, es);
+                if (r_size > PDQ_NINTHER_THRESHOLD) {
+                    pdq_swap(pivot_pos + 2 * es, pivot_pos + (2 + q) * es, es);
+                    pdq_swap(pivot_pos + 3 * es, pivot_pos + (3 + q) * es, es);
+                    pdq_swap(end - 2 * es, end - (1 + q) * es, es);
+                    pdq_swap(end - 3 * es, end - (2 + q) * es, es);
+                }
+            }
+        } else if (already_partitioned &&
+                   pdq_partial_insertion_sort(s, begin, pivot_pos) &&
+                   pdq_partial_insertion_sort(s, pivot_pos + es, end)) {
+            // Partição balanceada sem trocas: provavelmente já ordenado
+            return;
+        }
+
+        // Recorre na menor partição, itera na maior
+        if (l_size < r_size) {
+            pdq_loop(s, begin, pivot_pos, bad_allowed, leftmost);
+            begin = pivot_pos + es;
+            leftmost = false;
+        } else {
+            pdq_loop(s, pivot_pos + es, end, bad_allowed, false);
+            end = pivot_pos;
+        }
+    }
+}
+
+// ============================================================================
+// API
+// ============================================================================
+
+void ds_pdqsort(void *base, size_t n, size_t elem_size, CompareFn cmp) {
+    if (base == NULL || cmp == NULL || n <= 1 || elem_size == 0) return;
+    DS_TIMER_SCOPE(SORT);
+
+    unsigned char *data = (unsigned char *)base;
+    unsigned char stack_buf[2 * PDQ_STACK_ELEM];
+    unsigned char *buf = stack_buf;
+    if (elem_size > PDQ_STACK_ELEM) {
+        buf = (unsigned char *)malloc(2 * elem_size);
+        if (buf == NULL) {
+            pdq_heapsort(data, n, elem_size, cmp);
+            return;
+        }
+    }
+
+    PdqSort s;
+    s.es = elem_size;
+    s.cmp = cmp;
+    s.pivot = buf;
+    s.tmp = buf + elem_size;
+
+    int log2n = 0;
+    for (size_t m = n; m > 1; m >>= 1) log2n++;
+
+    pdq_loop(&s, data, data + n * elem_size, log2n, true);
+
+    if (buf != stack_buf) free(buf);
+}
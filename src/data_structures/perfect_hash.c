@@ -0,0 +1,729 @@
+/**
+ * @file perfect_hash.c
+ * @brief Implementação do mapa com hash perfeito mínimo (PTHash particionado)
+ *
+ * Do hash de 64 bits de uma chave (wyhash com a semente do mapa):
+ * - 32 bits altos: partição, por redução multiplicativa
+ * - 32 bits baixos: bucket dentro da partição
+ * - posição: mix(h ^ pilot') reduzido ao tamanho m da partição
+ *
+ * Cada partição só usa suas próprias posições [key_offset, key_offset + m),
+ * então as partições são construídas de forma independente. O mapa
+ * construído e o aberto de um arquivo usam o mesmo bloco: cabeçalho e
+ * seções em offsets fixos, sem ponteiros.
+ *
+ * Se algum bucket esgota PHMAP_MAX_PILOT tentativas (ou duas chaves
+ * distintas têm o mesmo hash de 64 bits), a construção recomeça com outra
+ * semente.
+ *
+ * Referências:
+ * - Pibiri, G. E. & Trani, R. (2021). "PTHash: Revisiting FCH Minimal
+ *   Perfect Hashing". SIGIR '21
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+// mmap/munmap (POSIX) com CMAKE_C_EXTENSIONS OFF
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(_POSIX_C_SOURCE)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "data_structures/perfect_hash.h"
+#include "data_structures/hash_table.h"
+#include "data_structures/thread_pool.h"
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define PHMAP_USE_MMAP 1
+#endif
+
+#if defined(__GNUC__)
+#define PHMAP_PREFETCH(p) __builtin_prefetch((p))
+#else
+#define PHMAP_PREFETCH(p) ((void)(p))
+#endif
+
+// ============================================================================
+// ESTRUTURAS INTERNAS
+// ============================================================================
+
+#define PHMAP_MAGIC "PHMAP001"
+#define PHMAP_BYTE_ORDER 0x01020304u
+#define PHMAP_VERSION 1u
+
+/** Chaves por partição (em média) */
+#define PHMAP_PARTITION_KEYS 2048
+
+/** Chaves por bucket (em média) */
+#define PHMAP_BUCKET_KEYS 4
+
+/** Pilots tentados por bucket antes de trocar a semente */
+#define PHMAP_MAX_PILOT ((uint32_t)1 << 24)
+
+/** Sementes tentadas antes de desistir */
+#define PHMAP_MAX_SEEDS 16
+
+#define PHMAP_FIRST_SEED 0x2545F4914F6CDD1DULL
+
+// Cabeçalho do arquivo: 64 bytes, as seções começam alinhadas a 8
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint64_t seed;
+    uint64_t num_keys;
+    uint64_t num_partitions;
+    uint64_t num_buckets;
+    uint64_t value_size;
+    uint64_t key_bytes;
+} PHFileHeader;
+
+// Início da partição; a partição p ocupa [part[p], part[p + 1])
+typedef struct {
+    uint64_t key_offset;
+    uint64_t bucket_offset;
+} PHPartition;
+
+// Offsets das seções dentro do bloco
+typedef struct {
+    size_t partitions;
+    size_t pilots;
+    size_t key_offsets;
+    size_t values;
+    size_t key_bytes;
+    size_t total;
+} PHLayout;
+
+struct PerfectHashMap {
+    const PHPartition *partitions;     // num_partitions + 1 entradas
+    const uint32_t *pilots;
+    const uint64_t *key_offsets;       // size + 1 entradas, em ordem de índice
+    const unsigned char *values;
+    const unsigned char *key_bytes;
+    size_t size;
+    size_t num_partitions;
+    size_t value_size;
+    size_t key_bytes_size;
+    uint64_t seed;
+
+    const void *blob;
+    size_t blob_size;
+    void *owned;                       // bloco construído ou lido (sem mmap)
+    void *map;                         // região mapeada por phmap_mmap_open
+    size_t map_size;
+};
+
+typedef enum {
+    PH_BUILD_OK,
+    PH_BUILD_RETRY,       // troca a semente
+    PH_BUILD_DUPLICATE,   // chaves repetidas: desiste
+    PH_BUILD_NO_MEMORY
+} PHBuildStatus;
+
+// ============================================================================
+// HASH E POSIÇÕES
+// ============================================================================
+
+static inline uint64_t ph_mix(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static inline uint64_t ph_key_hash(const void *key, size_t len, uint64_t seed) {
+#if SIZE_MAX == UINT64_MAX
+    return (uint64_t)hash_wyhash(key, len, seed);
+#else
+    // size_t de 32 bits: espalha o hash pelos 64 bits usados no mapa
+    return ph_mix((uint64_t)hash_wyhash(key, len, seed) ^ seed);
+#endif
+}
+
+// Redução multiplicativa de 32 bits de x para [0, range)
+static inline size_t ph_reduce(uint32_t x, size_t range) {
+    return (size_t)(((uint64_t)x * (uint64_t)range) >> 32);
+}
+
+static inline size_t ph_partition(uint64_t h, size_t num_partitions) {
+    return ph_reduce((uint32_t)(h >> 32), num_partitions);
+}
+
+static inline size_t ph_bucket(uint64_t h, size_t num_buckets) {
+    return ph_reduce((uint32_t)h, num_buckets);
+}
+
+static inline size_t ph_position(uint64_t h, uint32_t pilot, size_t m) {
+    uint64_t x = ph_mix(h ^ (((uint64_t)pilot + 1) * 0x9E3779B97F4A7C15ULL));
+    return ph_reduce((uint32_t)(x >> 32), m);
+}
+
+static inline size_t ph_buckets_for(size_t m) {
+    return (m + PHMAP_BUCKET_KEYS - 1) / PHMAP_BUCKET_KEYS;
+}
+
+// ============================================================================
+// LAYOUT DO BLOCO
+// ============================================================================
+
+// Reserva count * elem bytes a partir de *offset, arredondando para 8
+static bool layout_section(size_t *offset, uint64_t count, size_t elem, size_t *start) {
+    if (elem != 0 && count > (SIZE_MAX - 7 - *offset) / elem) return false;
+    *start = *offset;
+    size_t bytes = (size_t)count * elem;
+    *offset += (bytes + 7) & ~(size_t)7;
+    return true;
+}
+
+static bool phmap_layout(const PHFileHeader *header, PHLayout *layout) {
+    if (header->num_keys >= SIZE_MAX || header->num_partitions >= SIZE_MAX) return false;
+    size_t offset = sizeof(PHFileHeader);
+    if (!layout_section(&offset, header->num_partitions + 1, sizeof(PHPartition),
+                        &layout->partitions) ||
+        !layout_section(&offset, header->num_buckets, sizeof(uint32_t), &layout->pilots) ||
+        !layout_section(&offset, header->num_keys + 1, sizeof(uint64_t), &layout->key_offsets) ||
+        header->value_size >= SIZE_MAX ||
+        !layout_section(&offset, header->num_keys, (size_t)header->value_size, &layout->values) ||
+        !layout_section(&offset, header->key_bytes, 1, &layout->key_bytes)) {
+        return false;
+    }
+    layout->total = offset;
+    return true;
+}
+
+// Liga os ponteiros do mapa às seções de um bloco já validado
+static void phmap_attach(PerfectHashMap *map, const void *blob, const PHFileHeader *header,
+                         const PHLayout *layout) {
+    const unsigned char *base = (const unsigned char*)blob;
+    map->partitions = (const PHPartition*)(base + layout->partitions);
+    map->pilots = (const uint32_t*)(base + layout->pilots);
+    map->key_offsets = (const uint64_t*)(base + layout->key_offsets);
+    map->values = base + layout->values;
+    map->key_bytes = base + layout->key_bytes;
+    map->size = (size_t)header->num_keys;
+    map->num_partitions = (size_t)header->num_partitions;
+    map->value_size = (size_t)header->value_size;
+    map->key_bytes_size = (size_t)header->key_bytes;
+    map->seed = header->seed;
+    map->blob = blob;
+    map->blob_size = layout->total;
+}
+
+// ============================================================================
+// CONSTRUÇÃO
+// ============================================================================
+
+typedef struct {
+    const void *const *keys;
+    const size_t *key_lengths;
+    const uint64_t *hashes;
+    const size_t *order;        // chaves agrupadas por partição
+    const size_t *part_start;   // num_partitions + 1
+    const size_t *bucket_start; // num_partitions + 1
+    uint32_t *pilots;
+    size_t *slot_key;           // posição global -> índice da chave
+} PHBuilder;
+
+static bool same_key(const PHBuilder *b, size_t x, size_t y) {
+    return b->key_lengths[x] == b->key_lengths[y] &&
+           (b->key_lengths[x] == 0 ||
+            memcmp(b->keys[x], b->keys[y], b->key_lengths[x]) == 0);
+}
+
+/**
+ * Procura os pilots da partição p: buckets do maior para o menor, cada um
+ * com o menor pilot que leva todas as suas chaves a posições livres
+ */
+static PHBuildStatus build_partition(const PHBuilder *b, size_t p) {
+    size_t base = b->part_start[p];
+    size_t m = b->part_start[p + 1] - base;
+    size_t nb = b->bucket_start[p + 1] - b->bucket_start[p];
+    uint32_t *pilots = b->pilots + b->bucket_start[p];
+    memset(pilots, 0, nb * sizeof(uint32_t));
+    if (m == 0) return PH_BUILD_OK;
+
+    size_t *bucket_pos = calloc(nb + 1, sizeof(size_t));
+    size_t *members = malloc(m * sizeof(size_t));
+    size_t *by_size = malloc(nb * sizeof(size_t));
+    size_t *size_count = calloc(m + 2, sizeof(size_t));
+    size_t *positions = malloc(m * sizeof(size_t));
+    unsigned char *taken = calloc(m, 1);
+    PHBuildStatus status = PH_BUILD_OK;
+    if (bucket_pos == NULL || members == NULL || by_size == NULL ||
+        size_count == NULL || positions == NULL || taken == NULL) {
+        status = PH_BUILD_NO_MEMORY;
+        goto done;
+    }
+
+    // Agrupa as chaves por bucket (counting sort)
+    const size_t *keys = b->order + base;
+    for (size_t i = 0; i < m; i++) {
+        bucket_pos[ph_bucket(b->hashes[keys[i]], nb) + 1]++;
+    }
+    for (size_t k = 0; k < nb; k++) {
+        bucket_pos[k + 1] += bucket_pos[k];
+    }
+    for (size_t i = 0; i < m; i++) {
+        size_t k = ph_bucket(b->hashes[keys[i]], nb);
+        size_t slot = bucket_pos[k + 1] - 1;
+        bucket_pos[k + 1] = slot;
+        members[slot] = keys[i];
+    }
+    // bucket_pos[k + 1] agora é o início do bucket k: desloca uma posição
+    for (size_t k = 0; k < nb; k++) {
+        bucket_pos[k] = bucket_pos[k + 1];
+    }
+    bucket_pos[nb] = m;
+
+    // Buckets em ordem decrescente de tamanho (counting sort estável)
+    for (size_t k = 0; k < nb; k++) {
+        size_count[m - (bucket_pos[k + 1] - bucket_pos[k]) + 1]++;
+    }
+    for (size_t s = 0; s <= m; s++) {
+        size_count[s + 1] += size_count[s];
+    }
+    for (size_t k = 0; k < nb; k++) {
+        by_size[size_count[m - (bucket_pos[k + 1] - bucket_pos[k])]++] = k;
+    }
+
+    for (size_t r = 0; r < nb; r++) {
+        size_t k = by_size[r];
+        const size_t *bucket = members + bucket_pos[k];
+        size_t count = bucket_pos[k + 1] - bucket_pos[k];
+        if (count == 0) break;  // os demais também estão vazios
+
+        // Hashes iguais colidem para qualquer pilot
+        for (size_t x = 0; x < count; x++) {
+            for (size_t y = x + 1; y < count; y++) {
+                if (b->hashes[bucket[x]] == b->hashes[bucket[y]]) {
+                    status = same_key(b, bucket[x], bucket[y]) ? PH_BUILD_DUPLICATE
+                                                               : PH_BUILD_RETRY;
+                    goto done;
+                }
+            }
+        }
+
+        uint32_t pilot = 0;
+        for (; pilot < PHMAP_MAX_PILOT; pilot++) {
+            size_t placed = 0;
+            for (; placed < count; placed++) {
+                size_t pos = ph_position(b->hashes[bucket[placed]], pilot, m);
+                if (taken[pos]) break;
+                taken[pos] = 1;
+                positions[placed] = pos;
+            }
+            if (placed == count) break;
+            while (placed > 0) {
+                taken[positions[--placed]] = 0;
+            }
+        }
+        if (pilot == PHMAP_MAX_PILOT) {
+            status = PH_BUILD_RETRY;
+            goto done;
+        }
+
+        pilots[k] = pilot;
+        for (size_t x = 0; x < count; x++) {
+            b->slot_key[base + positions[x]] = bucket[x];
+        }
+    }
+
+done:
+    free(bucket_pos);
+    free(members);
+    free(by_size);
+    free(size_count);
+    free(positions);
+    free(taken);
+    return status;
+}
+
+typedef struct {
+    const PHBuilder *b;
+    uint64_t seed;
+    uint64_t *hashes;
+    atomic_int worst;           // maior PHBuildStatus entre as partições
+} PHSeedJob;
+
+static void hash_keys_range(void *ctx, size_t lo, size_t hi) {
+    PHSeedJob *job = ctx;
+    for (size_t i = lo; i < hi; i++) {
+        job->hashes[i] = ph_key_hash(job->b->keys[i], job->b->key_lengths[i], job->seed);
+    }
+}
+
+static void build_partitions_range(void *ctx, size_t lo, size_t hi) {
+    PHSeedJob *job = ctx;
+    int worst = PH_BUILD_OK;
+    for (size_t p = lo; p < hi; p++) {
+        int status = (int)build_partition(job->b, p);
+        if (status > worst) worst = status;
+    }
+    int seen = atomic_load(&job->worst);
+    while (worst > seen && !atomic_compare_exchange_weak(&job->worst, &seen, worst)) {
+    }
+}
+
+/**
+ * Tenta uma semente: hashes, partições e pilots de todas as partições
+ */
+static PHBuildStatus build_with_seed(PHBuilder *b, size_t n, size_t num_partitions,
+                                     uint64_t seed, uint64_t *hashes, size_t *order,
+                                     size_t *part_start, size_t *bucket_start,
+                                     size_t threads) {
+    PHSeedJob job = { .b = b, .seed = seed, .hashes = hashes };
+    atomic_init(&job.worst, PH_BUILD_OK);
+    ds_parallel_for_threads(n >= 4096 ? threads : 1, 0, n, 0, hash_keys_range, &job);
+
+    memset(part_start, 0, (num_partitions + 1) * sizeof(size_t));
+    for (size_t i = 0; i < n; i++) {
+        part_start[ph_partition(hashes[i], num_partitions) + 1]++;
+    }
+    bucket_start[0] = 0;
+    for (size_t p = 0; p < num_partitions; p++) {
+        bucket_start[p + 1] = bucket_start[p] + ph_buckets_for(part_start[p + 1]);
+        part_start[p + 1] += part_start[p];
+    }
+
+    // Espalha as chaves por partição usando part_start[p] como cursor
+    for (size_t i = 0; i < n; i++) {
+        order[part_start[ph_partition(hashes[i], num_partitions)]++] = i;
+    }
+    for (size_t p = num_partitions; p > 0; p--) {
+        part_start[p] = part_start[p - 1];
+    }
+    part_start[0] = 0;
+
+    b->pilots = realloc(b->pilots, (bucket_start[num_partitions] + 1) * sizeof(uint32_t));
+    if (b->pilots == NULL) return PH_BUILD_NO_MEMORY;
+
+    ds_parallel_for_threads(threads, 0, num_partitions, 1, build_partitions_range, &job);
+    return (PHBuildStatus)atomic_load(&job.worst);
+}
+
+/**
+ * Monta o bloco final (cabeçalho + seções) a partir dos pilots encontrados
+ */
+static PerfectHashMap* phmap_assemble(const PHBuilder *b, size_t n, size_t num_partitions,
+                                      const void *values, size_t value_size, uint64_t seed) {
+    PHFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PHMAP_MAGIC, sizeof(header.magic));
+    header.version = PHMAP_VERSION;
+    header.byte_order = PHMAP_BYTE_ORDER;
+    header.seed = seed;
+    header.num_keys = n;
+    header.num_partitions = num_partitions;
+    header.num_buckets = b->bucket_start[num_partitions];
+    header.value_size = value_size;
+    for (size_t i = 0; i < n; i++) {
+        if (b->key_lengths[i] > UINT64_MAX - header.key_bytes) return NULL;
+        header.key_bytes += b->key_lengths[i];
+    }
+
+    PHLayout layout;
+    if (!phmap_layout(&header, &layout)) return NULL;
+    PerfectHashMap *map = calloc(1, sizeof(PerfectHashMap));
+    uint64_t *blob = calloc(layout.total / sizeof(uint64_t), sizeof(uint64_t));
+    if (map == NULL || blob == NULL) {
+        free(map);
+        free(blob);
+        return NULL;
+    }
+
+    unsigned char *base = (unsigned char*)blob;
+    memcpy(base, &header, sizeof(header));
+    PHPartition *partitions = (PHPartition*)(base + layout.partitions);
+    for (size_t p = 0; p <= num_partitions; p++) {
+        partitions[p].key_offset = b->part_start[p];
+        partitions[p].bucket_offset = b->bucket_start[p];
+    }
+    memcpy(base + layout.pilots, b->pilots, (size_t)header.num_buckets * sizeof(uint32_t));
+
+    uint64_t *key_offsets = (uint64_t*)(base + layout.key_offsets);
+    unsigned char *key_bytes = base + layout.key_bytes;
+    unsigned char *value_bytes = base + layout.values;
+    uint64_t offset = 0;
+    for (size_t s = 0; s < n; s++) {
+        size_t k = b->slot_key[s];
+        key_offsets[s] = offset;
+        if (b->key_lengths[k] > 0) {
+            memcpy(key_bytes + offset, b->keys[k], b->key_lengths[k]);
+        }
+        offset += b->key_lengths[k];
+        if (value_size > 0) {
+            memcpy(value_bytes + s * value_size,
+                   (const unsigned char*)values + k * value_size, value_size);
+        }
+    }
+    key_offsets[n] = offset;
+
+    phmap_attach(map, blob, &header, &layout);
+    map->owned = blob;
+    return map;
+}
+
+PerfectHashMap* phmap_build(const void *const *keys, const size_t *key_lengths, size_t n,
+                            const void *values, size_t value_size, size_t num_threads) {
+    if (n > 0 && (keys == NULL || key_lengths == NULL || (value_size > 0 && values == NULL))) {
+        return NULL;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (keys[i] == NULL && key_lengths[i] > 0) return NULL;
+    }
+    if (value_size > 0 && n > SIZE_MAX / value_size) return NULL;
+
+    size_t threads = ds_resolve_threads(num_threads);
+
+    size_t num_partitions = n / PHMAP_PARTITION_KEYS + 1;
+    uint64_t *hashes = malloc((n + 1) * sizeof(uint64_t));
+    size_t *order = malloc((n + 1) * sizeof(size_t));
+    size_t *slot_key = malloc((n + 1) * sizeof(size_t));
+    size_t *part_start = malloc((num_partitions + 1) * sizeof(size_t));
+    size_t *bucket_start = malloc((num_partitions + 1) * sizeof(size_t));
+    PHBuilder b = {keys, key_lengths, hashes, order, part_start, bucket_start, NULL, slot_key};
+    PerfectHashMap *map = NULL;
+
+    if (hashes != NULL && order != NULL && slot_key != NULL &&
+        part_start != NULL && bucket_start != NULL) {
+        uint64_t seed = PHMAP_FIRST_SEED;
+        for (int attempt = 0; attempt < PHMAP_MAX_SEEDS; attempt++) {
+            PHBuildStatus status = build_with_seed(&b, n, num_partitions, seed, hashes, order,
+                                                   part_start, bucket_start, threads);
+            if (status == PH_BUILD_OK) {
+                map = phmap_assemble(&b, n, num_partitions, values, value_size, seed);
+                break;
+            }
+            if (status != PH_BUILD_RETRY) break;
+            seed = ph_mix(seed + (uint64_t)attempt + 1);
+        }
+    }
+
+    free(hashes);
+    free(order);
+    free(slot_key);
+    free(part_start);
+    free(bucket_start);
+    free(b.pilots);
+    return map;
+}
+
+PerfectHashMap* phmap_build_strings(const char *const *keys, size_t n,
+                                    const void *values, size_t value_size,
+                                    size_t num_threads) {
+    if (n > 0 && keys == NULL) return NULL;
+    size_t *lengths = malloc((n + 1) * sizeof(size_t));
+    if (lengths == NULL) return NULL;
+    for (size_t i = 0; i < n; i++) {
+        if (keys[i] == NULL) {
+            free(lengths);
+            return NULL;
+        }
+        lengths[i] = strlen(keys[i]);
+    }
+
+    PerfectHashMap *map = phmap_build((const void *const *)keys, lengths, n,
+                                      values, value_size, num_threads);
+    free(lengths);
+    return map;
+}
+
+void phmap_destroy(PerfectHashMap *map) {
+    if (map == NULL) return;
+    free(map->owned);
+#if defined(PHMAP_USE_MMAP)
+    if (map->map != NULL) munmap(map->map, map->map_size);
+#endif
+    free(map);
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+size_t phmap_index(const PerfectHashMap *map, const void *key, size_t key_len) {
+    if (map == NULL || (key == NULL && key_len > 0) || map->size == 0) {
+        return PHMAP_NOT_FOUND;
+    }
+
+    uint64_t h = ph_key_hash(key, key_len, map->seed);
+    const PHPartition *part = &map->partitions[ph_partition(h, map->num_partitions)];
+    size_t base = (size_t)part[0].key_offset;
+    size_t m = (size_t)(part[1].key_offset - part[0].key_offset);
+    if (m == 0) return PHMAP_NOT_FOUND;
+
+    size_t nb = (size_t)(part[1].bucket_offset - part[0].bucket_offset);
+    uint32_t pilot = map->pilots[part[0].bucket_offset + ph_bucket(h, nb)];
+    size_t pos = base + ph_position(h, pilot, m);
+
+    // O valor é buscado junto com a chave, não depois da comparação
+    PHMAP_PREFETCH(map->values + pos * map->value_size);
+    // Offsets conferidos: o bloco pode vir de um arquivo
+    uint64_t start = map->key_offsets[pos];
+    uint64_t end = map->key_offsets[pos + 1];
+    if (end < start || end > map->key_bytes_size || end - start != key_len) {
+        return PHMAP_NOT_FOUND;
+    }
+    if (key_len > 0 && memcmp(map->key_bytes + start, key, key_len) != 0) {
+        return PHMAP_NOT_FOUND;
+    }
+    return pos;
+}
+
+DataStructureError phmap_get(const PerfectHashMap *map, const void *key, size_t key_len,
+                             void *value) {
+    if (map == NULL || (key == NULL && key_len > 0)) return DS_ERROR_NULL_POINTER;
+
+    size_t index = phmap_index(map, key, key_len);
+    if (index == PHMAP_NOT_FOUND) return DS_ERROR_NOT_FOUND;
+    if (value != NULL && map->value_size > 0) {
+        memcpy(value, map->values + index * map->value_size, map->value_size);
+    }
+    return DS_SUCCESS;
+}
+
+const void* phmap_get_ptr(const PerfectHashMap *map, const void *key, size_t key_len) {
+    size_t index = phmap_index(map, key, key_len);
+    if (index == PHMAP_NOT_FOUND || map->value_size == 0) return NULL;
+    return map->values + index * map->value_size;
+}
+
+bool phmap_contains(const PerfectHashMap *map, const void *key, size_t key_len) {
+    return phmap_index(map, key, key_len) != PHMAP_NOT_FOUND;
+}
+
+const void* phmap_key_at(const PerfectHashMap *map, size_t index, size_t *key_len) {
+    if (map == NULL || index >= map->size) return NULL;
+    uint64_t start = map->key_offsets[index];
+    uint64_t end = map->key_offsets[index + 1];
+    if (end < start || end > map->key_bytes_size) return NULL;
+    if (key_len != NULL) *key_len = (size_t)(end - start);
+    return map->key_bytes + start;
+}
+
+size_t phmap_size(const PerfectHashMap *map) {
+    return map != NULL ? map->size : 0;
+}
+
+size_t phmap_value_size(const PerfectHashMap *map) {
+    return map != NULL ? map->value_size : 0;
+}
+
+size_t phmap_memory_usage(const PerfectHashMap *map) {
+    return map != NULL ? map->blob_size : 0;
+}
+
+// ============================================================================
+// SERIALIZAÇÃO
+// ============================================================================
+
+bool phmap_save(const PerfectHashMap *map, const char *path) {
+    if (map == NULL || path == NULL) return false;
+    FILE *f = fopen(path, "wb");
+    if (f == NULL) return false;
+
+    bool ok = fwrite(map->blob, 1, map->blob_size, f) == map->blob_size;
+    if (fclose(f) != 0) ok = false;
+    if (!ok) remove(path);
+    return ok;
+}
+
+PerfectHashMap* phmap_from_buffer(const void *buffer, size_t size) {
+    if (buffer == NULL || size < sizeof(PHFileHeader)) return NULL;
+    if (((uintptr_t)buffer % sizeof(uint64_t)) != 0) return NULL;
+
+    PHFileHeader header;
+    PHLayout layout;
+    memcpy(&header, buffer, sizeof(header));
+    if (memcmp(header.magic, PHMAP_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != PHMAP_VERSION || header.byte_order != PHMAP_BYTE_ORDER ||
+        header.num_partitions == 0 || header.num_partitions > ((uint64_t)1 << 32) ||
+        !phmap_layout(&header, &layout) || layout.total != size) {
+        return NULL;
+    }
+
+    // Partições em ordem, cobrindo exatamente as chaves e os buckets
+    const PHPartition *part = (const PHPartition*)((const unsigned char*)buffer +
+                                                   layout.partitions);
+    if (part[0].key_offset != 0 || part[0].bucket_offset != 0 ||
+        part[header.num_partitions].key_offset != header.num_keys ||
+        part[header.num_partitions].bucket_offset != header.num_buckets) {
+        return NULL;
+    }
+    for (size_t p = 0; p < (size_t)header.num_partitions; p++) {
+        uint64_t m = part[p + 1].key_offset - part[p].key_offset;
+        if (part[p + 1].key_offset < part[p].key_offset ||
+            part[p + 1].bucket_offset < part[p].bucket_offset || m > UINT32_MAX ||
+            (m > 0 && part[p + 1].bucket_offset == part[p].bucket_offset)) {
+            return NULL;
+        }
+    }
+
+    PerfectHashMap *map = calloc(1, sizeof(PerfectHashMap));
+    if (map == NULL) return NULL;
+    phmap_attach(map, buffer, &header, &layout);
+    return map;
+}
+
+PerfectHashMap* phmap_mmap_open(const char *path) {
+    if (path == NULL) return NULL;
+
+#if defined(PHMAP_USE_MMAP)
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(PHFileHeader)) {
+        close(fd);
+        return NULL;
+    }
+    size_t size = (size_t)st.st_size;
+    void *region = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (region == MAP_FAILED) return NULL;
+
+    PerfectHashMap *map = phmap_from_buffer(region, size);
+    if (map == NULL) {
+        munmap(region, size);
+        return NULL;
+    }
+    map->map = region;
+    map->map_size = size;
+    return map;
+#else
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return NULL;
+    PHFileHeader header;
+    PHLayout layout;
+    size_t size = 0;
+    if (fread(&header, sizeof(header), 1, f) == 1 && phmap_layout(&header, &layout)) {
+        size = layout.total;
+    }
+    uint64_t *buffer = size > 0 ? (uint64_t*)malloc(size) : NULL;
+    bool ok = buffer != NULL;
+    if (ok) {
+        memcpy(buffer, &header, sizeof(header));
+        size_t rest = size - sizeof(header);
+        ok = fread((unsigned char*)buffer + sizeof(header), 1, rest, f) == rest && fgetc(f) == EOF;
+    }
+    fclose(f);
+    PerfectHashMap *map = ok ? phmap_from_buffer(buffer, size) : NULL;
+    if (map == NULL) {
+        free(buffer);
+        return NULL;
+    }
+    map->owned = buffer;
+    return map;
+#endif
+}
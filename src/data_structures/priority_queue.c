@@ -31,6 +31,7 @@ struct PriorityQueue {
     PriorityQueueType type;
     size_t element_size;
     CompareFn compare;
+    DSAllocator allocator;
 };
 
 // ============================================================================
@@ -47,19 +48,31 @@ static HeapType pq_type_to_heap_type(PriorityQueueType type) {
 
 PriorityQueue* pq_create(size_t element_size, size_t initial_capacity,
                          PriorityQueueType type, CompareFn compare, DestroyFn destroy) {
+    return pq_create_with_allocator(element_size, initial_capacity, type,
+                                    compare, destroy, NULL);
+}
+
+PriorityQueue* pq_create_with_allocator(size_t element_size, size_t initial_capacity,
+                                        PriorityQueueType type, CompareFn compare,
+                                        DestroyFn destroy, const DSAllocator *allocator) {
     if (element_size == 0 || compare == NULL) {
         return NULL;
     }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
 
-    PriorityQueue *pq = (PriorityQueue *)malloc(sizeof(PriorityQueue));
+    PriorityQueue *pq = (PriorityQueue *)ds_alloc(allocator, sizeof(PriorityQueue));
     if (pq == NULL) {
         return NULL;
     }
 
-    pq->heap = heap_create(element_size, initial_capacity,
-                           pq_type_to_heap_type(type), compare, destroy);
+    pq->allocator = *allocator;
+    pq->heap = heap_create_with_allocator(element_size, initial_capacity,
+                                          pq_type_to_heap_type(type), compare,
+                                          destroy, allocator);
     if (pq->heap == NULL) {
-        free(pq);
+        ds_free(allocator, pq, sizeof(PriorityQueue));
         return NULL;
     }
 
@@ -75,7 +88,8 @@ void pq_destroy(PriorityQueue *pq) {
     }
 
     heap_destroy(pq->heap);
-    free(pq);
+    DSAllocator allocator = pq->allocator;
+    ds_free(&allocator, pq, sizeof(PriorityQueue));
 }
 
 // ============================================================================
@@ -171,6 +185,14 @@ size_t pq_size(const PriorityQueue *pq) {
     return heap_size(pq->heap);
 }
 
+size_t pq_memory_usage(const PriorityQueue *pq) {
+    if (pq == NULL) {
+        return 0;
+    }
+
+    return sizeof(PriorityQueue) + heap_memory_usage(pq->heap);
+}
+
 void pq_clear(PriorityQueue *pq) {
     if (pq == NULL) {
         return;
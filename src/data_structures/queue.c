@@ -6,6 +6,8 @@
  * - QUEUE_ARRAY: Circular buffer (array dinâmico)
  * - QUEUE_LINKED: Lista encadeada
  *
+ * E as filas concorrentes limitadas SPSC e MPMC (ring buffers sem lock).
+ *
  * Referências:
  * - Cormen et al. (2009), Chapter 10.1 - Stacks and Queues
  * - Knuth TAOCP Vol 1, Section 2.2.1
@@ -16,6 +18,8 @@
 
 #include "data_structures/queue.h"
 
+#include <stdatomic.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -50,40 +54,60 @@ struct Queue {
     // Para QUEUE_LINKED
     QueueNode *front;         // Primeiro nó (para dequeue)
     QueueNode *rear;          // Último nó (para enqueue)
+
+    DSAllocator allocator;    // Origem de cabeçalho, buffer e nós
 };
 
 // ============================================================================
 // FUNÇÕES AUXILIARES PRIVADAS
 // ============================================================================
 
+/**
+ * @brief Copia count elementos do circular buffer a partir do índice start
+ *
+ * O trecho pode dar a volta no fim do array: no máximo dois memcpy.
+ */
+static void queue_copy_out(const Queue *queue, size_t start, void *dest, size_t count) {
+    size_t first = queue->capacity - start < count ? queue->capacity - start : count;
+    memcpy(dest, (const char*)queue->array + start * queue->element_size,
+           first * queue->element_size);
+    memcpy((char*)dest + first * queue->element_size, queue->array,
+           (count - first) * queue->element_size);
+}
+
+static void queue_copy_in(Queue *queue, size_t start, const void *src, size_t count) {
+    size_t first = queue->capacity - start < count ? queue->capacity - start : count;
+    memcpy((char*)queue->array + start * queue->element_size, src,
+           first * queue->element_size);
+    memcpy(queue->array, (const char*)src + first * queue->element_size,
+           (count - first) * queue->element_size);
+}
+
 /**
  * @brief Redimensiona o array da fila (circular buffer)
  *
- * Dobra a capacidade e reorganiza os elementos.
+ * Dobra a capacidade (ou vai direto a min_capacity, se maior) e reorganiza
+ * os elementos a partir do índice 0.
  *
  * Complexidade: O(n)
  */
-static DataStructureError queue_resize_array(Queue *queue) {
+static DataStructureError queue_resize_array(Queue *queue, size_t min_capacity) {
     size_t new_capacity = queue->capacity * 2;
     if (new_capacity < 4) new_capacity = 4;  // Capacidade mínima
+    if (new_capacity < min_capacity) new_capacity = min_capacity;
+    if (new_capacity > SIZE_MAX / queue->element_size) {
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
 
-    void *new_array = malloc(new_capacity * queue->element_size);
+    void *new_array = ds_alloc(&queue->allocator, new_capacity * queue->element_size);
     if (new_array == NULL) {
         return DS_ERROR_OUT_OF_MEMORY;
     }
 
-    // Copiar elementos do array antigo para o novo
     // Elementos podem estar "quebrados" no circular buffer
-    size_t count = 0;
-    for (size_t i = 0; i < queue->size; i++) {
-        size_t idx = (queue->head + i) % queue->capacity;
-        void *src = (char*)queue->array + (idx * queue->element_size);
-        void *dest = (char*)new_array + (count * queue->element_size);
-        memcpy(dest, src, queue->element_size);
-        count++;
-    }
+    queue_copy_out(queue, queue->head, new_array, queue->size);
 
-    free(queue->array);
+    ds_free(&queue->allocator, queue->array, queue->capacity * queue->element_size);
     queue->array = new_array;
     queue->capacity = new_capacity;
     queue->head = 0;
@@ -105,15 +129,31 @@ static DataStructureError queue_resize_array(Queue *queue) {
  * Complexidade: O(1) para LINKED, O(capacity) para ARRAY
  */
 Queue* queue_create(size_t element_size, QueueType type, size_t initial_capacity, DestroyFn destroy) {
+    return queue_create_with_allocator(element_size, type, initial_capacity, destroy, NULL);
+}
+
+/**
+ * @brief Cria uma fila com alocador customizado
+ *
+ * Complexidade: O(1) para LINKED, O(capacity) para ARRAY
+ */
+Queue* queue_create_with_allocator(size_t element_size, QueueType type,
+                                   size_t initial_capacity, DestroyFn destroy,
+                                   const DSAllocator *allocator) {
     if (element_size == 0) {
         return NULL;
     }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
 
-    Queue *queue = (Queue*)malloc(sizeof(Queue));
+    Queue *queue = (Queue*)ds_alloc(allocator, sizeof(Queue));
     if (queue == NULL) {
         return NULL;
     }
 
+    queue->allocator = *allocator;
+
     queue->element_size = element_size;
     queue->type = type;
     queue->size = 0;
@@ -123,9 +163,9 @@ Queue* queue_create(size_t element_size, QueueType type, size_t initial_capacity
         // Circular buffer
         if (initial_capacity == 0) initial_capacity = 16;  // Padrão
 
-        queue->array = malloc(initial_capacity * element_size);
+        queue->array = ds_alloc(allocator, initial_capacity * element_size);
         if (queue->array == NULL) {
-            free(queue);
+            ds_free(allocator, queue, sizeof(Queue));
             return NULL;
         }
 
@@ -159,11 +199,12 @@ void queue_destroy(Queue *queue) {
 
     queue_clear(queue);
 
+    DSAllocator allocator = queue->allocator;
     if (queue->type == QUEUE_ARRAY && queue->array != NULL) {
-        free(queue->array);
+        ds_free(&allocator, queue->array, queue->capacity * queue->element_size);
     }
 
-    free(queue);
+    ds_free(&allocator, queue, sizeof(Queue));
 }
 
 // ============================================================================
@@ -185,7 +226,7 @@ void queue_destroy(Queue *queue) {
 static DataStructureError queue_enqueue_array(Queue *queue, const void *data) {
     // Verificar se precisa redimensionar
     if (queue->size >= queue->capacity) {
-        DataStructureError err = queue_resize_array(queue);
+        DataStructureError err = queue_resize_array(queue, 0);
         if (err != DS_SUCCESS) {
             return err;
         }
@@ -265,14 +306,14 @@ static DataStructureError queue_front_array(const Queue *queue, void *output) {
  */
 static DataStructureError queue_enqueue_linked(Queue *queue, const void *data) {
     // Criar novo nó
-    QueueNode *node = (QueueNode*)malloc(sizeof(QueueNode));
+    QueueNode *node = (QueueNode*)ds_alloc(&queue->allocator, sizeof(QueueNode));
     if (node == NULL) {
         return DS_ERROR_OUT_OF_MEMORY;
     }
 
-    node->data = malloc(queue->element_size);
+    node->data = ds_alloc(&queue->allocator, queue->element_size);
     if (node->data == NULL) {
-        free(node);
+        ds_free(&queue->allocator, node, sizeof(QueueNode));
         return DS_ERROR_OUT_OF_MEMORY;
     }
 
@@ -320,8 +361,8 @@ static DataStructureError queue_dequeue_linked(Queue *queue, void *output) {
         queue->rear = NULL;  // Fila ficou vazia
     }
 
-    free(node->data);
-    free(node);
+    ds_free(&queue->allocator, node->data, queue->element_size);
+    ds_free(&queue->allocator, node, sizeof(QueueNode));
     queue->size--;
 
     return DS_SUCCESS;
@@ -381,6 +422,111 @@ DataStructureError queue_front(const Queue *queue, void *output) {
     }
 }
 
+// ============================================================================
+// OPERAÇÕES EM LOTE E ACESSO SEM CÓPIA
+// ============================================================================
+
+DataStructureError queue_enqueue_n(Queue *queue, const void *data, size_t count) {
+    if (queue == NULL || (data == NULL && count > 0)) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (count == 0) {
+        return DS_SUCCESS;
+    }
+
+    if (queue->type == QUEUE_ARRAY) {
+        if (count > SIZE_MAX - queue->size) {
+            return DS_ERROR_OUT_OF_MEMORY;
+        }
+        if (queue->size + count > queue->capacity) {
+            DataStructureError err = queue_resize_array(queue, queue->size + count);
+            if (err != DS_SUCCESS) {
+                return err;
+            }
+        }
+        queue_copy_in(queue, queue->tail, data, count);
+        queue->tail = (queue->tail + count) % queue->capacity;
+        queue->size += count;
+        return DS_SUCCESS;
+    }
+
+    // QUEUE_LINKED: monta a cadeia à parte e só a liga se tudo foi alocado
+    QueueNode *first = NULL;
+    QueueNode *last = NULL;
+    for (size_t i = 0; i < count; i++) {
+        QueueNode *node = (QueueNode*)ds_alloc(&queue->allocator, sizeof(QueueNode));
+        void *node_data = node != NULL ? ds_alloc(&queue->allocator, queue->element_size) : NULL;
+        if (node_data == NULL) {
+            ds_free(&queue->allocator, node, sizeof(QueueNode));
+            while (first != NULL) {
+                QueueNode *next = first->next;
+                ds_free(&queue->allocator, first->data, queue->element_size);
+                ds_free(&queue->allocator, first, sizeof(QueueNode));
+                first = next;
+            }
+            return DS_ERROR_OUT_OF_MEMORY;
+        }
+        node->data = node_data;
+        memcpy(node->data, (const char*)data + i * queue->element_size, queue->element_size);
+        node->next = NULL;
+        if (last == NULL) {
+            first = node;
+        } else {
+            last->next = node;
+        }
+        last = node;
+    }
+
+    if (queue->rear == NULL) {
+        queue->front = first;
+    } else {
+        queue->rear->next = first;
+    }
+    queue->rear = last;
+    queue->size += count;
+    return DS_SUCCESS;
+}
+
+size_t queue_dequeue_n(Queue *queue, void *output, size_t max) {
+    if (queue == NULL) {
+        return 0;
+    }
+    size_t n = max < queue->size ? max : queue->size;
+    if (n == 0) {
+        return 0;
+    }
+
+    if (queue->type == QUEUE_LINKED) {
+        for (size_t i = 0; i < n; i++) {
+            queue_dequeue_linked(queue, output != NULL ? (char*)output + i * queue->element_size
+                                                       : NULL);
+        }
+        return n;
+    }
+
+    if (output != NULL) {
+        queue_copy_out(queue, queue->head, output, n);
+    } else if (queue->destroy != NULL) {
+        for (size_t i = 0; i < n; i++) {
+            size_t idx = (queue->head + i) % queue->capacity;
+            queue->destroy((char*)queue->array + idx * queue->element_size);
+        }
+    }
+    queue->head = (queue->head + n) % queue->capacity;
+    queue->size -= n;
+    return n;
+}
+
+const void* queue_front_ptr(const Queue *queue) {
+    if (queue == NULL || queue->size == 0) {
+        return NULL;
+    }
+    if (queue->type == QUEUE_ARRAY) {
+        return (const char*)queue->array + queue->head * queue->element_size;
+    }
+    return queue->front->data;
+}
+
 // ============================================================================
 // CONSULTAS E UTILITÁRIOS
 // ============================================================================
@@ -400,6 +546,16 @@ size_t queue_capacity(const Queue *queue) {
     return queue->capacity;
 }
 
+size_t queue_memory_usage(const Queue *queue) {
+    if (queue == NULL) {
+        return 0;
+    }
+    if (queue->type == QUEUE_ARRAY) {
+        return sizeof(Queue) + queue->capacity * queue->element_size;
+    }
+    return sizeof(Queue) + queue->size * (sizeof(QueueNode) + queue->element_size);
+}
+
 void queue_clear(Queue *queue) {
     if (queue == NULL) {
         return;
@@ -469,3 +625,369 @@ DataStructureError queue_to_array(const Queue *queue, void **array, size_t *size
     // TODO: Implementar
     return DS_ERROR_NOT_FOUND;
 }
+
+// ============================================================================
+// FILAS CONCORRENTES (RING BUFFERS SEM LOCK)
+// ============================================================================
+
+/*
+ * Índices são contadores que só crescem (a posição no anel é pos & mask);
+ * diferenças entre eles continuam corretas quando o size_t dá a volta.
+ */
+
+struct SPSCQueue {
+    unsigned char *buffer;
+    size_t element_size;
+    size_t mask;
+
+    // Produtor: publica tail com release, cached_head é a última leitura de head
+    _Alignas(QUEUE_CACHE_LINE) atomic_size_t tail;
+    size_t cached_head;
+
+    // Consumidor: publica head com release, cached_tail é a última leitura de tail
+    _Alignas(QUEUE_CACHE_LINE) atomic_size_t head;
+    size_t cached_tail;
+};
+
+struct MPMCQueue {
+    unsigned char *cells;       // por posição: sequência atômica + elemento
+    size_t cell_size;
+    size_t element_size;
+    size_t mask;
+
+    _Alignas(QUEUE_CACHE_LINE) atomic_size_t enqueue_pos;
+    _Alignas(QUEUE_CACHE_LINE) atomic_size_t dequeue_pos;
+};
+
+// Menor potência de 2 >= n (mínimo 2); 0 se não couber em size_t
+static size_t ring_capacity(size_t n) {
+    size_t capacity = 2;
+    while (capacity < n) {
+        if (capacity > SIZE_MAX / 2) {
+            return 0;
+        }
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+// aligned_alloc exige tamanho múltiplo do alinhamento
+static void* cache_aligned_alloc(size_t size) {
+    if (size > SIZE_MAX - QUEUE_CACHE_LINE) {
+        return NULL;
+    }
+    size_t rounded = (size + QUEUE_CACHE_LINE - 1) / QUEUE_CACHE_LINE * QUEUE_CACHE_LINE;
+    return aligned_alloc(QUEUE_CACHE_LINE, rounded);
+}
+
+// Copia n elementos de/para o anel a partir de pos (no máximo duas partes)
+static void ring_copy_in(unsigned char *buffer, size_t mask, size_t element_size,
+                         size_t pos, const unsigned char *src, size_t n) {
+    size_t start = pos & mask;
+    size_t first = mask + 1 - start < n ? mask + 1 - start : n;
+    memcpy(buffer + start * element_size, src, first * element_size);
+    memcpy(buffer, src + first * element_size, (n - first) * element_size);
+}
+
+static void ring_copy_out(const unsigned char *buffer, size_t mask, size_t element_size,
+                          size_t pos, unsigned char *dst, size_t n) {
+    size_t start = pos & mask;
+    size_t first = mask + 1 - start < n ? mask + 1 - start : n;
+    memcpy(dst, buffer + start * element_size, first * element_size);
+    memcpy(dst + first * element_size, buffer, (n - first) * element_size);
+}
+
+SPSCQueue* spsc_queue_create(size_t element_size, size_t capacity) {
+    if (element_size == 0 || capacity == 0) {
+        return NULL;
+    }
+    capacity = ring_capacity(capacity);
+    if (capacity == 0 || capacity > SIZE_MAX / element_size) {
+        return NULL;
+    }
+
+    SPSCQueue *queue = (SPSCQueue *)cache_aligned_alloc(sizeof(SPSCQueue));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->buffer = (unsigned char *)cache_aligned_alloc(capacity * element_size);
+    if (queue->buffer == NULL) {
+        free(queue);
+        return NULL;
+    }
+
+    queue->element_size = element_size;
+    queue->mask = capacity - 1;
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->head, 0);
+    queue->cached_head = 0;
+    queue->cached_tail = 0;
+    return queue;
+}
+
+void spsc_queue_destroy(SPSCQueue *queue) {
+    if (queue == NULL) {
+        return;
+    }
+    free(queue->buffer);
+    free(queue);
+}
+
+// Posições livres vistas pelo produtor; relê head só se a cópia não bastar
+static size_t spsc_free_slots(SPSCQueue *queue, size_t tail, size_t wanted) {
+    size_t capacity = queue->mask + 1;
+    size_t free_slots = capacity - (tail - queue->cached_head);
+    if (free_slots < wanted) {
+        queue->cached_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+        free_slots = capacity - (tail - queue->cached_head);
+    }
+    return free_slots;
+}
+
+// Elementos disponíveis vistos pelo consumidor; relê tail só se a cópia não bastar
+static size_t spsc_ready_slots(SPSCQueue *queue, size_t head, size_t wanted) {
+    size_t ready = queue->cached_tail - head;
+    if (ready < wanted) {
+        queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        ready = queue->cached_tail - head;
+    }
+    return ready;
+}
+
+DataStructureError spsc_queue_enqueue(SPSCQueue *queue, const void *data) {
+    if (queue == NULL || data == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if (spsc_free_slots(queue, tail, 1) == 0) {
+        return DS_ERROR_FULL;
+    }
+    memcpy(queue->buffer + (tail & queue->mask) * queue->element_size, data,
+           queue->element_size);
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    return DS_SUCCESS;
+}
+
+DataStructureError spsc_queue_dequeue(SPSCQueue *queue, void *output) {
+    if (queue == NULL || output == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if (spsc_ready_slots(queue, head, 1) == 0) {
+        return DS_ERROR_EMPTY;
+    }
+    memcpy(output, queue->buffer + (head & queue->mask) * queue->element_size,
+           queue->element_size);
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    return DS_SUCCESS;
+}
+
+size_t spsc_queue_enqueue_batch(SPSCQueue *queue, const void *data, size_t count) {
+    if (queue == NULL || data == NULL || count == 0) {
+        return 0;
+    }
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t free_slots = spsc_free_slots(queue, tail, count);
+    size_t n = count < free_slots ? count : free_slots;
+    if (n == 0) {
+        return 0;
+    }
+    ring_copy_in(queue->buffer, queue->mask, queue->element_size, tail,
+                 (const unsigned char *)data, n);
+    atomic_store_explicit(&queue->tail, tail + n, memory_order_release);
+    return n;
+}
+
+size_t spsc_queue_dequeue_batch(SPSCQueue *queue, void *output, size_t max) {
+    if (queue == NULL || output == NULL || max == 0) {
+        return 0;
+    }
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t ready = spsc_ready_slots(queue, head, max);
+    size_t n = max < ready ? max : ready;
+    if (n == 0) {
+        return 0;
+    }
+    ring_copy_out(queue->buffer, queue->mask, queue->element_size, head,
+                  (unsigned char *)output, n);
+    atomic_store_explicit(&queue->head, head + n, memory_order_release);
+    return n;
+}
+
+size_t spsc_queue_size(const SPSCQueue *queue) {
+    if (queue == NULL) {
+        return 0;
+    }
+    // head antes de tail: tail lido depois nunca fica atrás
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    return tail - head;
+}
+
+size_t spsc_queue_capacity(const SPSCQueue *queue) {
+    return queue != NULL ? queue->mask + 1 : 0;
+}
+
+size_t spsc_queue_memory_usage(const SPSCQueue *queue) {
+    if (queue == NULL) {
+        return 0;
+    }
+    return sizeof(SPSCQueue) + (queue->mask + 1) * queue->element_size;
+}
+
+/*
+ * Sequência da posição i (Vyukov): igual a pos quando livre para o
+ * produtor que reservar pos, pos + 1 quando ocupada pelo elemento de pos,
+ * e pos + capacidade depois de consumida (livre para a volta seguinte).
+ */
+static inline atomic_size_t* mpmc_sequence(const MPMCQueue *queue, size_t pos) {
+    return (atomic_size_t *)(queue->cells + (pos & queue->mask) * queue->cell_size);
+}
+
+static inline unsigned char* mpmc_slot(const MPMCQueue *queue, size_t pos) {
+    return queue->cells + (pos & queue->mask) * queue->cell_size + sizeof(atomic_size_t);
+}
+
+MPMCQueue* mpmc_queue_create(size_t element_size, size_t capacity) {
+    if (element_size == 0 || capacity == 0) {
+        return NULL;
+    }
+    capacity = ring_capacity(capacity);
+    if (capacity == 0 || element_size > SIZE_MAX / 2 - sizeof(atomic_size_t)) {
+        return NULL;
+    }
+
+    // Alinha cada posição para a sequência atômica da seguinte
+    size_t align = _Alignof(atomic_size_t);
+    size_t cell_size = (sizeof(atomic_size_t) + element_size + align - 1) / align * align;
+    if (capacity > SIZE_MAX / cell_size) {
+        return NULL;
+    }
+
+    MPMCQueue *queue = (MPMCQueue *)cache_aligned_alloc(sizeof(MPMCQueue));
+    if (queue == NULL) {
+        return NULL;
+    }
+    queue->cells = (unsigned char *)cache_aligned_alloc(capacity * cell_size);
+    if (queue->cells == NULL) {
+        free(queue);
+        return NULL;
+    }
+
+    queue->cell_size = cell_size;
+    queue->element_size = element_size;
+    queue->mask = capacity - 1;
+    for (size_t i = 0; i < capacity; i++) {
+        atomic_init(mpmc_sequence(queue, i), i);
+    }
+    atomic_init(&queue->enqueue_pos, 0);
+    atomic_init(&queue->dequeue_pos, 0);
+    return queue;
+}
+
+void mpmc_queue_destroy(MPMCQueue *queue) {
+    if (queue == NULL) {
+        return;
+    }
+    free(queue->cells);
+    free(queue);
+}
+
+/*
+ * Reserva até max posições consecutivas a partir de *pos_index, cada uma com
+ * sequência pos + offset; devolve quantas (0 = fila cheia/vazia) e a
+ * primeira em *first. Só a primeira posição pode estar em disputa: as
+ * seguintes só mudam de estado depois de reservadas.
+ */
+static size_t mpmc_claim(MPMCQueue *queue, atomic_size_t *pos_index, size_t offset,
+                         size_t max, size_t *first) {
+    size_t pos = atomic_load_explicit(pos_index, memory_order_relaxed);
+    for (;;) {
+        size_t seq = atomic_load_explicit(mpmc_sequence(queue, pos), memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + offset);
+        if (diff < 0) {
+            return 0;
+        }
+        if (diff > 0) {
+            // Outra thread reservou pos: recomeça do índice atual
+            pos = atomic_load_explicit(pos_index, memory_order_relaxed);
+            continue;
+        }
+
+        size_t n = 1;
+        while (n < max &&
+               atomic_load_explicit(mpmc_sequence(queue, pos + n), memory_order_acquire) ==
+                   pos + n + offset) {
+            n++;
+        }
+        if (atomic_compare_exchange_weak_explicit(pos_index, &pos, pos + n,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+            *first = pos;
+            return n;
+        }
+    }
+}
+
+size_t mpmc_queue_enqueue_batch(MPMCQueue *queue, const void *data, size_t count) {
+    if (queue == NULL || data == NULL || count == 0) {
+        return 0;
+    }
+    size_t pos;
+    size_t n = mpmc_claim(queue, &queue->enqueue_pos, 0, count, &pos);
+    const unsigned char *src = (const unsigned char *)data;
+    for (size_t i = 0; i < n; i++) {
+        memcpy(mpmc_slot(queue, pos + i), src + i * queue->element_size, queue->element_size);
+        atomic_store_explicit(mpmc_sequence(queue, pos + i), pos + i + 1, memory_order_release);
+    }
+    return n;
+}
+
+size_t mpmc_queue_dequeue_batch(MPMCQueue *queue, void *output, size_t max) {
+    if (queue == NULL || output == NULL || max == 0) {
+        return 0;
+    }
+    size_t pos;
+    size_t n = mpmc_claim(queue, &queue->dequeue_pos, 1, max, &pos);
+    unsigned char *dst = (unsigned char *)output;
+    for (size_t i = 0; i < n; i++) {
+        memcpy(dst + i * queue->element_size, mpmc_slot(queue, pos + i), queue->element_size);
+        atomic_store_explicit(mpmc_sequence(queue, pos + i), pos + i + queue->mask + 1,
+                              memory_order_release);
+    }
+    return n;
+}
+
+DataStructureError mpmc_queue_enqueue(MPMCQueue *queue, const void *data) {
+    if (queue == NULL || data == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    return mpmc_queue_enqueue_batch(queue, data, 1) == 1 ? DS_SUCCESS : DS_ERROR_FULL;
+}
+
+DataStructureError mpmc_queue_dequeue(MPMCQueue *queue, void *output) {
+    if (queue == NULL || output == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    return mpmc_queue_dequeue_batch(queue, output, 1) == 1 ? DS_SUCCESS : DS_ERROR_EMPTY;
+}
+
+size_t mpmc_queue_size(const MPMCQueue *queue) {
+    if (queue == NULL) {
+        return 0;
+    }
+    size_t dequeued = atomic_load_explicit(&queue->dequeue_pos, memory_order_acquire);
+    size_t enqueued = atomic_load_explicit(&queue->enqueue_pos, memory_order_acquire);
+    size_t size = enqueued - dequeued;
+    return size <= queue->mask + 1 ? size : queue->mask + 1;
+}
+
+size_t mpmc_queue_capacity(const MPMCQueue *queue) {
+    return queue != NULL ? queue->mask + 1 : 0;
+}
+
+size_t mpmc_queue_memory_usage(const MPMCQueue *queue) {
+    if (queue == NULL) {
+        return 0;
+    }
+    return sizeof(MPMCQueue) + (queue->mask + 1) * queue->cell_size;
+}
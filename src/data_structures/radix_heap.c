@@ -0,0 +1,267 @@
+/**
+ * @file radix_heap.c
+ * @brief Implementação do radix heap com 65 baldes
+ *
+ * Cada balde é um array dinâmico de pares {key, value}. Um elemento de chave
+ * k fica no balde radix_bucket(k, last) = 0 se k == last, ou 1 + o índice do
+ * bit mais alto de k ^ last. Como last só cresce e nunca passa das chaves
+ * presentes, o índice do balde de um elemento nunca aumenta.
+ *
+ * Referências:
+ * - Ahuja, R. K., Mehlhorn, K., Orlin, J. B. & Tarjan, R. E. (1990).
+ *   "Faster Algorithms for the Shortest Path Problem". JACM 37(2)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/radix_heap.h"
+
+/** Um balde para chaves iguais a last e um para cada bit de uint64_t */
+#define RADIX_HEAP_BUCKETS 65
+
+/** Capacidade do primeiro bloco alocado para um balde */
+#define RADIX_HEAP_MIN_BUCKET 8
+
+// ============================================================================
+// ESTRUTURA INTERNA
+// ============================================================================
+
+typedef struct {
+    uint64_t key;
+    size_t value;
+} RadixEntry;
+
+typedef struct {
+    RadixEntry *items;
+    size_t size;
+    size_t capacity;
+} RadixBucket;
+
+struct RadixHeap {
+    RadixBucket buckets[RADIX_HEAP_BUCKETS];
+    uint64_t last;
+    size_t size;
+    DSAllocator allocator;
+};
+
+// ============================================================================
+// FUNÇÕES AUXILIARES PRIVADAS
+// ============================================================================
+
+static inline size_t radix_bucket(uint64_t key, uint64_t last) {
+    uint64_t diff = key ^ last;
+    return diff ? (size_t)(64 - __builtin_clzll((unsigned long long)diff)) : 0;
+}
+
+static bool bucket_reserve(RadixHeap *heap, RadixBucket *bucket, size_t needed) {
+    if (needed <= bucket->capacity) {
+        return true;
+    }
+
+    size_t new_capacity = bucket->capacity ? bucket->capacity : RADIX_HEAP_MIN_BUCKET;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+    RadixEntry *items = (RadixEntry *)ds_realloc(&heap->allocator, bucket->items,
+                                                 bucket->capacity * sizeof(RadixEntry),
+                                                 new_capacity * sizeof(RadixEntry));
+    if (items == NULL) {
+        return false;
+    }
+    bucket->items = items;
+    bucket->capacity = new_capacity;
+    return true;
+}
+
+static size_t first_nonempty(const RadixHeap *heap) {
+    size_t b = 0;
+    while (heap->buckets[b].size == 0) {
+        b++;
+    }
+    return b;
+}
+
+static size_t bucket_min(const RadixBucket *bucket) {
+    size_t best = 0;
+    for (size_t i = 1; i < bucket->size; i++) {
+        if (bucket->items[i].key < bucket->items[best].key) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+/**
+ * Garante o balde 0 não vazio: move last para o mínimo do primeiro balde
+ * não vazio e redistribui esse balde (todos os destinos têm índice menor).
+ * A capacidade dos destinos é reservada antes de mover qualquer elemento,
+ * então uma falha de memória deixa o heap intacto.
+ */
+static bool radix_refill(RadixHeap *heap) {
+    if (heap->buckets[0].size > 0) {
+        return true;
+    }
+
+    size_t b = first_nonempty(heap);
+    RadixBucket *src = &heap->buckets[b];
+    uint64_t last = src->items[bucket_min(src)].key;
+
+    size_t counts[RADIX_HEAP_BUCKETS] = {0};
+    for (size_t i = 0; i < src->size; i++) {
+        counts[radix_bucket(src->items[i].key, last)]++;
+    }
+    for (size_t t = 0; t < b; t++) {
+        if (!bucket_reserve(heap, &heap->buckets[t], counts[t])) {
+            return false;
+        }
+    }
+
+    heap->last = last;
+    for (size_t i = 0; i < src->size; i++) {
+        RadixBucket *dst = &heap->buckets[radix_bucket(src->items[i].key, last)];
+        dst->items[dst->size++] = src->items[i];
+    }
+    src->size = 0;
+    return true;
+}
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+RadixHeap* radix_heap_create(void) {
+    return radix_heap_create_with_allocator(NULL);
+}
+
+RadixHeap* radix_heap_create_with_allocator(const DSAllocator *allocator) {
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
+
+    RadixHeap *heap = (RadixHeap *)ds_calloc(allocator, 1, sizeof(RadixHeap));
+    if (heap == NULL) {
+        return NULL;
+    }
+
+    heap->allocator = *allocator;
+    return heap;
+}
+
+void radix_heap_destroy(RadixHeap *heap) {
+    if (heap == NULL) {
+        return;
+    }
+
+    DSAllocator allocator = heap->allocator;
+    for (size_t b = 0; b < RADIX_HEAP_BUCKETS; b++) {
+        ds_free(&allocator, heap->buckets[b].items,
+                heap->buckets[b].capacity * sizeof(RadixEntry));
+    }
+    ds_free(&allocator, heap, sizeof(RadixHeap));
+}
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+DataStructureError radix_heap_push(RadixHeap *heap, uint64_t key, size_t value) {
+    if (heap == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (key < heap->last) {
+        return DS_ERROR_INVALID_PARAM;
+    }
+
+    RadixBucket *bucket = &heap->buckets[radix_bucket(key, heap->last)];
+    if (!bucket_reserve(heap, bucket, bucket->size + 1)) {
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+    bucket->items[bucket->size].key = key;
+    bucket->items[bucket->size].value = value;
+    bucket->size++;
+    heap->size++;
+    return DS_SUCCESS;
+}
+
+DataStructureError radix_heap_pop(RadixHeap *heap, uint64_t *key, size_t *value) {
+    if (heap == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (heap->size == 0) {
+        return DS_ERROR_EMPTY;
+    }
+    if (!radix_refill(heap)) {
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+
+    RadixBucket *zero = &heap->buckets[0];
+    RadixEntry e = zero->items[--zero->size];
+    if (key != NULL) {
+        *key = e.key;
+    }
+    if (value != NULL) {
+        *value = e.value;
+    }
+    heap->size--;
+    return DS_SUCCESS;
+}
+
+DataStructureError radix_heap_peek(const RadixHeap *heap, uint64_t *key, size_t *value) {
+    if (heap == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (heap->size == 0) {
+        return DS_ERROR_EMPTY;
+    }
+
+    const RadixBucket *bucket = &heap->buckets[first_nonempty(heap)];
+    const RadixEntry *e = &bucket->items[bucket == &heap->buckets[0] ? bucket->size - 1
+                                                                       : bucket_min(bucket)];
+    if (key != NULL) {
+        *key = e->key;
+    }
+    if (value != NULL) {
+        *value = e->value;
+    }
+    return DS_SUCCESS;
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+uint64_t radix_heap_last(const RadixHeap *heap) {
+    return heap ? heap->last : 0;
+}
+
+bool radix_heap_is_empty(const RadixHeap *heap) {
+    return heap == NULL || heap->size == 0;
+}
+
+size_t radix_heap_size(const RadixHeap *heap) {
+    return heap ? heap->size : 0;
+}
+
+size_t radix_heap_memory_usage(const RadixHeap *heap) {
+    if (heap == NULL) {
+        return 0;
+    }
+    size_t bytes = sizeof(RadixHeap);
+    for (size_t b = 0; b < RADIX_HEAP_BUCKETS; b++) {
+        bytes += heap->buckets[b].capacity * sizeof(RadixEntry);
+    }
+    return bytes;
+}
+
+void radix_heap_clear(RadixHeap *heap) {
+    if (heap == NULL) {
+        return;
+    }
+
+    for (size_t b = 0; b < RADIX_HEAP_BUCKETS; b++) {
+        heap->buckets[b].size = 0;
+    }
+    heap->size = 0;
+    heap->last = 0;
+}
@@ -0,0 +1,818 @@
+/**
+ * @file radix_trie.c
+ * @brief Implementação da trie compactada com nós adaptativos (ART)
+ *
+ * As chaves são comparadas incluindo o '\0' final: nenhuma chave é prefixo
+ * de outra, então toda chave termina em uma folha e um nó interno nunca é
+ * "fim de palavra". Folhas são distinguidas dos nós internos pelo bit
+ * baixo do ponteiro.
+ *
+ * Prefixo híbrido (Leis et al., 2013, S-III.E): o nó guarda o tamanho total
+ * do caminho comprimido e só os primeiros RADIX_MAX_PREFIX bytes; na busca
+ * o resto é pulado e a folha final confere a chave inteira. Quando uma
+ * inserção precisa dos bytes não guardados, eles vêm da menor folha da
+ * subárvore, que tem o mesmo caminho.
+ *
+ * Referências:
+ * - Leis, V., Kemper, A. & Neumann, T. (2013). "The Adaptive Radix Tree:
+ *   ARTful Indexing for Main-Memory Databases". ICDE, 38-49.
+ * - Morrison, D. R. (1968). "PATRICIA". J. ACM 15(4), 514-534.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/radix_trie.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Busca no Node16 por 16 bytes de uma vez.
+// Defina RADIX_NO_SIMD para forçar o fallback escalar portável.
+#if !defined(RADIX_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define RADIX_USE_SSE2 1
+#elif !defined(RADIX_NO_SIMD) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#include <arm_neon.h>
+#define RADIX_USE_NEON 1
+#endif
+
+// ============================================================================
+// ESTRUTURAS INTERNAS
+// ============================================================================
+
+enum { NODE4 = 1, NODE16, NODE48, NODE256 };
+
+/**
+ * @brief Cabeçalho comum dos nós internos
+ *
+ * prefix_len é o tamanho do caminho comprimido; só os primeiros
+ * RADIX_MAX_PREFIX bytes ficam em prefix.
+ */
+typedef struct {
+    uint8_t type;
+    uint16_t num_children;
+    uint32_t prefix_len;
+    unsigned char prefix[RADIX_MAX_PREFIX];
+} RTNode;
+
+// Filhos são RTNode* ou folhas marcadas (LEAF_TAG)
+typedef struct {
+    RTNode n;
+    unsigned char keys[4];
+    RTNode *children[4];
+} RTNode4;
+
+typedef struct {
+    RTNode n;
+    unsigned char keys[16];
+    RTNode *children[16];
+} RTNode16;
+
+typedef struct {
+    RTNode n;
+    unsigned char child_index[256];     /**< 0 = sem filho; i + 1 = children[i] */
+    RTNode *children[48];
+} RTNode48;
+
+typedef struct {
+    RTNode n;
+    RTNode *children[256];
+} RTNode256;
+
+/**
+ * @brief Folha: a chave completa, com o '\0' (len bytes)
+ */
+typedef struct {
+    size_t len;
+    unsigned char key[];
+} RTLeaf;
+
+struct RadixTrie {
+    RTNode *root;
+    size_t size;
+    size_t memory;
+    DSAllocator allocator;
+};
+
+#define IS_LEAF(p) (((uintptr_t)(p) & 1u) != 0)
+#define AS_LEAF(p) ((RTLeaf*)((uintptr_t)(p) & ~(uintptr_t)1u))
+#define LEAF_TAG(l) ((RTNode*)((uintptr_t)(l) | 1u))
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+// ============================================================================
+// FUNÇÕES AUXILIARES PRIVADAS
+// ============================================================================
+
+static size_t node_bytes(uint8_t type) {
+    switch (type) {
+        case NODE4: return sizeof(RTNode4);
+        case NODE16: return sizeof(RTNode16);
+        case NODE48: return sizeof(RTNode48);
+        default: return sizeof(RTNode256);
+    }
+}
+
+static RTNode* node_create(RadixTrie *trie, uint8_t type) {
+    size_t bytes = node_bytes(type);
+    RTNode *node = (RTNode*)ds_calloc(&trie->allocator, 1, bytes);
+    if (node == NULL) return NULL;
+    node->type = type;
+    trie->memory += bytes;
+    return node;
+}
+
+static void node_free(RadixTrie *trie, RTNode *node) {
+    size_t bytes = node_bytes(node->type);
+    trie->memory -= bytes;
+    ds_free(&trie->allocator, node, bytes);
+}
+
+static RTLeaf* leaf_create(RadixTrie *trie, const unsigned char *key, size_t len) {
+    RTLeaf *leaf = (RTLeaf*)ds_alloc(&trie->allocator, sizeof(RTLeaf) + len);
+    if (leaf == NULL) return NULL;
+    leaf->len = len;
+    memcpy(leaf->key, key, len);
+    trie->memory += sizeof(RTLeaf) + len;
+    return leaf;
+}
+
+static void leaf_free(RadixTrie *trie, RTLeaf *leaf) {
+    trie->memory -= sizeof(RTLeaf) + leaf->len;
+    ds_free(&trie->allocator, leaf, sizeof(RTLeaf) + leaf->len);
+}
+
+static bool leaf_matches(const RTLeaf *leaf, const unsigned char *key, size_t len) {
+    return leaf->len == len && memcmp(leaf->key, key, len) == 0;
+}
+
+static void node_destroy(RadixTrie *trie, RTNode *node) {
+    if (node == NULL) return;
+    if (IS_LEAF(node)) {
+        leaf_free(trie, AS_LEAF(node));
+        return;
+    }
+    switch (node->type) {
+        case NODE4:
+            for (size_t i = 0; i < node->num_children; i++) {
+                node_destroy(trie, ((RTNode4*)node)->children[i]);
+            }
+            break;
+        case NODE16:
+            for (size_t i = 0; i < node->num_children; i++) {
+                node_destroy(trie, ((RTNode16*)node)->children[i]);
+            }
+            break;
+        case NODE48:
+            for (size_t i = 0; i < 48; i++) node_destroy(trie, ((RTNode48*)node)->children[i]);
+            break;
+        default:
+            for (size_t i = 0; i < 256; i++) node_destroy(trie, ((RTNode256*)node)->children[i]);
+            break;
+    }
+    node_free(trie, node);
+}
+
+// Posição de c entre as num chaves do Node16 (ou -1)
+static int node16_find(const RTNode16 *node, unsigned char c) {
+    unsigned num = node->n.num_children;
+#if defined(RADIX_USE_SSE2)
+    __m128i keys = _mm_loadu_si128((const __m128i*)node->keys);
+    unsigned mask = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(keys, _mm_set1_epi8((char)c)));
+    mask &= (1u << num) - 1u;
+    return mask ? __builtin_ctz(mask) : -1;
+#elif defined(RADIX_USE_NEON)
+    // Um nibble por byte (truque shrn), como em hash_table.c
+    uint8x16_t eq = vceqq_u8(vld1q_u8(node->keys), vdupq_n_u8(c));
+    uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+    if (num < 16) mask &= (UINT64_C(1) << (4 * num)) - 1u;
+    return mask ? __builtin_ctzll(mask) / 4 : -1;
+#else
+    for (unsigned i = 0; i < num; i++) {
+        if (node->keys[i] == c) return (int)i;
+    }
+    return -1;
+#endif
+}
+
+// Endereço do ponteiro para o filho do byte c (NULL se não houver)
+static RTNode** find_child(RTNode *node, unsigned char c) {
+    switch (node->type) {
+        case NODE4: {
+            RTNode4 *n = (RTNode4*)node;
+            for (size_t i = 0; i < node->num_children; i++) {
+                if (n->keys[i] == c) return &n->children[i];
+            }
+            return NULL;
+        }
+        case NODE16: {
+            RTNode16 *n = (RTNode16*)node;
+            int i = node16_find(n, c);
+            return (i >= 0) ? &n->children[i] : NULL;
+        }
+        case NODE48: {
+            RTNode48 *n = (RTNode48*)node;
+            unsigned char i = n->child_index[c];
+            return i ? &n->children[i - 1] : NULL;
+        }
+        default: {
+            RTNode256 *n = (RTNode256*)node;
+            return n->children[c] ? &n->children[c] : NULL;
+        }
+    }
+}
+
+// Filho de menor (ou maior) byte
+static RTNode* edge_child(const RTNode *node, bool last) {
+    switch (node->type) {
+        case NODE4:
+            return ((const RTNode4*)node)->children[last ? node->num_children - 1 : 0];
+        case NODE16:
+            return ((const RTNode16*)node)->children[last ? node->num_children - 1 : 0];
+        case NODE48: {
+            const RTNode48 *n = (const RTNode48*)node;
+            for (int i = 0; i < 256; i++) {
+                int c = last ? 255 - i : i;
+                if (n->child_index[c]) return n->children[n->child_index[c] - 1];
+            }
+            return NULL;
+        }
+        default: {
+            const RTNode256 *n = (const RTNode256*)node;
+            for (int i = 0; i < 256; i++) {
+                int c = last ? 255 - i : i;
+                if (n->children[c]) return n->children[c];
+            }
+            return NULL;
+        }
+    }
+}
+
+static const RTLeaf* edge_leaf(const RTNode *node, bool last) {
+    while (!IS_LEAF(node)) node = edge_child(node, last);
+    return AS_LEAF(node);
+}
+
+static void copy_header(RTNode *dst, const RTNode *src) {
+    dst->num_children = src->num_children;
+    dst->prefix_len = src->prefix_len;
+    memcpy(dst->prefix, src->prefix, MIN(src->prefix_len, RADIX_MAX_PREFIX));
+}
+
+/**
+ * Adiciona o filho child no byte c, trocando o nó por um maior se cheio
+ * (*ref passa a apontar para o novo). Falha só na falta de memória, sem
+ * alterar nada.
+ */
+static bool add_child(RadixTrie *trie, RTNode **ref, RTNode *node, unsigned char c, RTNode *child) {
+    switch (node->type) {
+        case NODE4:
+        case NODE16: {
+            size_t cap = (node->type == NODE4) ? 4 : 16;
+            unsigned char *keys = (node->type == NODE4) ? ((RTNode4*)node)->keys
+                                                        : ((RTNode16*)node)->keys;
+            RTNode **children = (node->type == NODE4) ? ((RTNode4*)node)->children
+                                                      : ((RTNode16*)node)->children;
+            if (node->num_children < cap) {
+                size_t pos = 0;
+                while (pos < node->num_children && keys[pos] < c) pos++;
+                memmove(keys + pos + 1, keys + pos, node->num_children - pos);
+                memmove(children + pos + 1, children + pos,
+                        (node->num_children - pos) * sizeof(RTNode*));
+                keys[pos] = c;
+                children[pos] = child;
+                node->num_children++;
+                return true;
+            }
+            RTNode *grown = node_create(trie, (node->type == NODE4) ? NODE16 : NODE48);
+            if (grown == NULL) return false;
+            copy_header(grown, node);
+            if (node->type == NODE4) {
+                memcpy(((RTNode16*)grown)->keys, keys, 4);
+                memcpy(((RTNode16*)grown)->children, children, 4 * sizeof(RTNode*));
+            } else {
+                RTNode48 *n48 = (RTNode48*)grown;
+                for (size_t i = 0; i < 16; i++) {
+                    n48->child_index[keys[i]] = (unsigned char)(i + 1);
+                    n48->children[i] = children[i];
+                }
+            }
+            node_free(trie, node);
+            *ref = grown;
+            return add_child(trie, ref, grown, c, child);
+        }
+        case NODE48: {
+            RTNode48 *n = (RTNode48*)node;
+            if (node->num_children < 48) {
+                size_t pos = 0;
+                while (n->children[pos] != NULL) pos++;
+                n->children[pos] = child;
+                n->child_index[c] = (unsigned char)(pos + 1);
+                node->num_children++;
+                return true;
+            }
+            RTNode256 *grown = (RTNode256*)node_create(trie, NODE256);
+            if (grown == NULL) return false;
+            copy_header(&grown->n, node);
+            for (int b = 0; b < 256; b++) {
+                if (n->child_index[b]) grown->children[b] = n->children[n->child_index[b] - 1];
+            }
+            node_free(trie, node);
+            *ref = &grown->n;
+            return add_child(trie, ref, &grown->n, c, child);
+        }
+        default: {
+            ((RTNode256*)node)->children[c] = child;
+            node->num_children++;
+            return true;
+        }
+    }
+}
+
+/**
+ * Remove o filho do byte c (que existe). Nós esvaziados voltam ao tipo
+ * menor, com folga para não alternar (Node256 em 37, Node48 em 12, Node16
+ * em 3); Node4 com um filho é fundido a ele. Se a troca não conseguir
+ * memória, o nó fica como está, ainda válido.
+ */
+static void remove_child(RadixTrie *trie, RTNode **ref, RTNode *node, unsigned char c) {
+    switch (node->type) {
+        case NODE256: {
+            RTNode256 *n = (RTNode256*)node;
+            n->children[c] = NULL;
+            node->num_children--;
+            if (node->num_children != 37) return;
+            RTNode48 *shrunk = (RTNode48*)node_create(trie, NODE48);
+            if (shrunk == NULL) return;
+            copy_header(&shrunk->n, node);
+            size_t pos = 0;
+            for (int b = 0; b < 256; b++) {
+                if (n->children[b] == NULL) continue;
+                shrunk->children[pos] = n->children[b];
+                shrunk->child_index[b] = (unsigned char)(++pos);
+            }
+            node_free(trie, node);
+            *ref = &shrunk->n;
+            return;
+        }
+        case NODE48: {
+            RTNode48 *n = (RTNode48*)node;
+            n->children[n->child_index[c] - 1] = NULL;
+            n->child_index[c] = 0;
+            node->num_children--;
+            if (node->num_children != 12) return;
+            RTNode16 *shrunk = (RTNode16*)node_create(trie, NODE16);
+            if (shrunk == NULL) return;
+            copy_header(&shrunk->n, node);
+            size_t k = 0;
+            for (int b = 0; b < 256; b++) {
+                if (n->child_index[b] == 0) continue;
+                shrunk->keys[k] = (unsigned char)b;
+                shrunk->children[k++] = n->children[n->child_index[b] - 1];
+            }
+            node_free(trie, node);
+            *ref = &shrunk->n;
+            return;
+        }
+        default: {
+            unsigned char *keys = (node->type == NODE4) ? ((RTNode4*)node)->keys
+                                                        : ((RTNode16*)node)->keys;
+            RTNode **children = (node->type == NODE4) ? ((RTNode4*)node)->children
+                                                      : ((RTNode16*)node)->children;
+            size_t pos = 0;
+            while (keys[pos] != c) pos++;
+            memmove(keys + pos, keys + pos + 1, node->num_children - pos - 1);
+            memmove(children + pos, children + pos + 1,
+                    (node->num_children - pos - 1) * sizeof(RTNode*));
+            node->num_children--;
+
+            if (node->type == NODE16 && node->num_children == 3) {
+                RTNode4 *shrunk = (RTNode4*)node_create(trie, NODE4);
+                if (shrunk == NULL) return;
+                copy_header(&shrunk->n, node);
+                memcpy(shrunk->keys, keys, 3);
+                memcpy(shrunk->children, children, 3 * sizeof(RTNode*));
+                node_free(trie, node);
+                *ref = &shrunk->n;
+            } else if (node->type == NODE4 && node->num_children == 1) {
+                RTNode *child = children[0];
+                if (!IS_LEAF(child)) {
+                    // Prefixo do filho = prefixo do nó + byte da aresta + prefixo do filho
+                    unsigned char merged[RADIX_MAX_PREFIX];
+                    size_t len = MIN(node->prefix_len, RADIX_MAX_PREFIX);
+                    memcpy(merged, node->prefix, len);
+                    if (len < RADIX_MAX_PREFIX) merged[len++] = keys[0];
+                    size_t rest = MIN(child->prefix_len, RADIX_MAX_PREFIX - len);
+                    memcpy(merged + len, child->prefix, rest);
+                    memcpy(child->prefix, merged, len + rest);
+                    child->prefix_len += node->prefix_len + 1;
+                }
+                node_free(trie, node);
+                *ref = child;
+            }
+            return;
+        }
+    }
+}
+
+/**
+ * Quantos bytes do prefixo comprimido de node coincidem com key[depth..].
+ * Além dos RADIX_MAX_PREFIX guardados, compara com a menor folha.
+ */
+static size_t prefix_mismatch(const RTNode *node, const unsigned char *key, size_t len, size_t depth) {
+    size_t max = MIN(MIN(node->prefix_len, RADIX_MAX_PREFIX), len - depth);
+    size_t i = 0;
+    for (; i < max; i++) {
+        if (node->prefix[i] != key[depth + i]) return i;
+    }
+    if (node->prefix_len > RADIX_MAX_PREFIX) {
+        const RTLeaf *leaf = edge_leaf(node, false);
+        max = MIN(MIN(leaf->len, len) - depth, node->prefix_len);
+        for (; i < max; i++) {
+            if (leaf->key[depth + i] != key[depth + i]) return i;
+        }
+    }
+    return i;
+}
+
+// *inserted fica false se a chave já existia
+static DataStructureError insert_recursive(RadixTrie *trie, RTNode **ref, const unsigned char *key,
+                                           size_t len, size_t depth, bool *inserted) {
+    RTNode *node = *ref;
+    if (node == NULL) {
+        RTLeaf *leaf = leaf_create(trie, key, len);
+        if (leaf == NULL) return DS_ERROR_OUT_OF_MEMORY;
+        *ref = LEAF_TAG(leaf);
+        return DS_SUCCESS;
+    }
+
+    if (IS_LEAF(node)) {
+        const RTLeaf *existing = AS_LEAF(node);
+        if (leaf_matches(existing, key, len)) {
+            *inserted = false;
+            return DS_SUCCESS;
+        }
+
+        // Duas folhas: Node4 com o prefixo comum a partir de depth
+        size_t common = 0;
+        while (existing->key[depth + common] == key[depth + common]) common++;
+        RTLeaf *leaf = leaf_create(trie, key, len);
+        if (leaf == NULL) return DS_ERROR_OUT_OF_MEMORY;
+        RTNode4 *split = (RTNode4*)node_create(trie, NODE4);
+        if (split == NULL) {
+            leaf_free(trie, leaf);
+            return DS_ERROR_OUT_OF_MEMORY;
+        }
+        split->n.prefix_len = (uint32_t)common;
+        memcpy(split->n.prefix, key + depth, MIN(common, RADIX_MAX_PREFIX));
+        add_child(trie, NULL, &split->n, existing->key[depth + common], node);
+        add_child(trie, NULL, &split->n, key[depth + common], LEAF_TAG(leaf));
+        *ref = &split->n;
+        return DS_SUCCESS;
+    }
+
+    if (node->prefix_len > 0) {
+        size_t match = prefix_mismatch(node, key, len, depth);
+        if (match < node->prefix_len) {
+            // Divergência dentro do prefixo: Node4 no ponto de divergência
+            RTLeaf *leaf = leaf_create(trie, key, len);
+            if (leaf == NULL) return DS_ERROR_OUT_OF_MEMORY;
+            RTNode4 *split = (RTNode4*)node_create(trie, NODE4);
+            if (split == NULL) {
+                leaf_free(trie, leaf);
+                return DS_ERROR_OUT_OF_MEMORY;
+            }
+            split->n.prefix_len = (uint32_t)match;
+            memcpy(split->n.prefix, node->prefix, MIN(match, RADIX_MAX_PREFIX));
+
+            unsigned char edge;
+            size_t rest = node->prefix_len - match - 1;
+            if (node->prefix_len <= RADIX_MAX_PREFIX) {
+                edge = node->prefix[match];
+                memmove(node->prefix, node->prefix + match + 1, rest);
+            } else {
+                const RTLeaf *min_leaf = edge_leaf(node, false);
+                edge = min_leaf->key[depth + match];
+                memcpy(node->prefix, min_leaf->key + depth + match + 1, MIN(rest, RADIX_MAX_PREFIX));
+            }
+            node->prefix_len = (uint32_t)rest;
+            add_child(trie, NULL, &split->n, edge, node);
+            add_child(trie, NULL, &split->n, key[depth + match], LEAF_TAG(leaf));
+            *ref = &split->n;
+            return DS_SUCCESS;
+        }
+        depth += node->prefix_len;
+    }
+
+    RTNode **child = find_child(node, key[depth]);
+    if (child != NULL) return insert_recursive(trie, child, key, len, depth + 1, inserted);
+
+    RTLeaf *leaf = leaf_create(trie, key, len);
+    if (leaf == NULL) return DS_ERROR_OUT_OF_MEMORY;
+    if (!add_child(trie, ref, node, key[depth], LEAF_TAG(leaf))) {
+        leaf_free(trie, leaf);
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+    return DS_SUCCESS;
+}
+
+static bool remove_recursive(RadixTrie *trie, RTNode **ref, const unsigned char *key,
+                             size_t len, size_t depth) {
+    RTNode *node = *ref;
+    if (IS_LEAF(node)) {
+        // Só a raiz chega aqui como folha
+        if (!leaf_matches(AS_LEAF(node), key, len)) return false;
+        leaf_free(trie, AS_LEAF(node));
+        *ref = NULL;
+        return true;
+    }
+
+    if (node->prefix_len > 0) {
+        size_t stored = MIN(node->prefix_len, RADIX_MAX_PREFIX);
+        if (depth + node->prefix_len >= len) return false;
+        if (memcmp(node->prefix, key + depth, stored) != 0) return false;
+        depth += node->prefix_len;
+    }
+
+    RTNode **child = find_child(node, key[depth]);
+    if (child == NULL) return false;
+    if (IS_LEAF(*child)) {
+        RTLeaf *leaf = AS_LEAF(*child);
+        if (!leaf_matches(leaf, key, len)) return false;
+        leaf_free(trie, leaf);
+        remove_child(trie, ref, node, key[depth]);
+        return true;
+    }
+    return remove_recursive(trie, child, key, len, depth + 1);
+}
+
+/**
+ * Raiz da subárvore com todas as chaves que começam com prefix, ou NULL.
+ * Bytes pulados nos prefixos otimistas são conferidos em uma folha: todas
+ * as folhas da subárvore compartilham o caminho.
+ */
+static const RTNode* find_prefix_root(const RadixTrie *trie, const unsigned char *prefix, size_t len) {
+    const RTNode *node = trie->root;
+    size_t depth = 0;
+    while (node != NULL && !IS_LEAF(node)) {
+        depth += node->prefix_len;
+        if (depth >= len) break;
+        RTNode **child = find_child((RTNode*)node, prefix[depth]);
+        node = (child != NULL) ? *child : NULL;
+        depth++;
+    }
+    if (node == NULL) return NULL;
+    const RTLeaf *leaf = edge_leaf(node, false);
+    if (leaf->len <= len || memcmp(leaf->key, prefix, len) != 0) return NULL;
+    return node;
+}
+
+typedef struct {
+    char **items;
+    size_t count;
+    size_t capacity;
+    bool failed;
+} KeyList;
+
+static void collect_keys(const RTNode *node, KeyList *list) {
+    if (node == NULL || list->failed) return;
+    if (IS_LEAF(node)) {
+        const RTLeaf *leaf = AS_LEAF(node);
+        if (list->count == list->capacity) {
+            size_t capacity = (list->capacity == 0) ? 16 : list->capacity * 2;
+            char **items = (char**)realloc(list->items, capacity * sizeof(char*));
+            if (items == NULL) {
+                list->failed = true;
+                return;
+            }
+            list->items = items;
+            list->capacity = capacity;
+        }
+        char *copy = (char*)malloc(leaf->len);
+        if (copy == NULL) {
+            list->failed = true;
+            return;
+        }
+        memcpy(copy, leaf->key, leaf->len);
+        list->items[list->count++] = copy;
+        return;
+    }
+    switch (node->type) {
+        case NODE4:
+            for (size_t i = 0; i < node->num_children; i++) {
+                collect_keys(((const RTNode4*)node)->children[i], list);
+            }
+            break;
+        case NODE16:
+            for (size_t i = 0; i < node->num_children; i++) {
+                collect_keys(((const RTNode16*)node)->children[i], list);
+            }
+            break;
+        case NODE48: {
+            const RTNode48 *n = (const RTNode48*)node;
+            for (int b = 0; b < 256; b++) {
+                if (n->child_index[b]) collect_keys(n->children[n->child_index[b] - 1], list);
+            }
+            break;
+        }
+        default:
+            for (int b = 0; b < 256; b++) collect_keys(((const RTNode256*)node)->children[b], list);
+            break;
+    }
+}
+
+static DataStructureError collect_results(const RTNode *node, char ***results, size_t *count) {
+    KeyList list = {NULL, 0, 0, false};
+    collect_keys(node, &list);
+    if (list.failed) {
+        for (size_t i = 0; i < list.count; i++) free(list.items[i]);
+        free(list.items);
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
+    *results = list.items;
+    *count = list.count;
+    return DS_SUCCESS;
+}
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+RadixTrie* radix_trie_create(void) {
+    return radix_trie_create_with_allocator(NULL);
+}
+
+RadixTrie* radix_trie_create_with_allocator(const DSAllocator *allocator) {
+    if (allocator == NULL) allocator = ds_default_allocator();
+
+    RadixTrie *trie = (RadixTrie*)ds_alloc(allocator, sizeof(RadixTrie));
+    if (trie == NULL) return NULL;
+
+    trie->allocator = *allocator;
+    trie->root = NULL;
+    trie->size = 0;
+    trie->memory = 0;
+    return trie;
+}
+
+void radix_trie_destroy(RadixTrie *trie) {
+    if (trie == NULL) return;
+
+    node_destroy(trie, trie->root);
+    DSAllocator allocator = trie->allocator;
+    ds_free(&allocator, trie, sizeof(RadixTrie));
+}
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+DataStructureError radix_trie_insert(RadixTrie *trie, const char *str) {
+    if (trie == NULL || str == NULL) return DS_ERROR_NULL_POINTER;
+
+    bool inserted = true;
+    DataStructureError err = insert_recursive(trie, &trie->root, (const unsigned char*)str,
+                                              strlen(str) + 1, 0, &inserted);
+    if (err == DS_SUCCESS && inserted) trie->size++;
+    return err;
+}
+
+bool radix_trie_search(const RadixTrie *trie, const char *str) {
+    if (trie == NULL || str == NULL) return false;
+
+    const unsigned char *key = (const unsigned char*)str;
+    size_t len = strlen(str) + 1;
+    const RTNode *node = trie->root;
+    size_t depth = 0;
+    while (node != NULL) {
+        if (IS_LEAF(node)) return leaf_matches(AS_LEAF(node), key, len);
+        if (node->prefix_len > 0) {
+            if (depth + node->prefix_len >= len) return false;
+            if (memcmp(node->prefix, key + depth, MIN(node->prefix_len, RADIX_MAX_PREFIX)) != 0) {
+                return false;
+            }
+            depth += node->prefix_len;
+        }
+        RTNode **child = find_child((RTNode*)node, key[depth]);
+        node = (child != NULL) ? *child : NULL;
+        depth++;
+    }
+    return false;
+}
+
+bool radix_trie_starts_with(const RadixTrie *trie, const char *prefix) {
+    if (trie == NULL || prefix == NULL) return false;
+    if (trie->root == NULL) return false;
+    return find_prefix_root(trie, (const unsigned char*)prefix, strlen(prefix)) != NULL;
+}
+
+DataStructureError radix_trie_remove(RadixTrie *trie, const char *str) {
+    if (trie == NULL || str == NULL) return DS_ERROR_NULL_POINTER;
+    if (trie->root == NULL) return DS_ERROR_NOT_FOUND;
+
+    if (!remove_recursive(trie, &trie->root, (const unsigned char*)str, strlen(str) + 1, 0)) {
+        return DS_ERROR_NOT_FOUND;
+    }
+    trie->size--;
+    return DS_SUCCESS;
+}
+
+// ============================================================================
+// AUTOCOMPLETE E PREFIXOS
+// ============================================================================
+
+DataStructureError radix_trie_autocomplete(const RadixTrie *trie, const char *prefix,
+                                           char ***results, size_t *count) {
+    if (trie == NULL || prefix == NULL || results == NULL || count == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    *results = NULL;
+    *count = 0;
+    if (trie->root == NULL) return DS_SUCCESS;
+
+    const RTNode *node = find_prefix_root(trie, (const unsigned char*)prefix, strlen(prefix));
+    if (node == NULL) return DS_SUCCESS;
+    return collect_results(node, results, count);
+}
+
+char* radix_trie_longest_common_prefix(const RadixTrie *trie) {
+    if (trie == NULL) return NULL;
+
+    if (trie->root == NULL) {
+        char *empty = (char*)malloc(1);
+        if (empty != NULL) empty[0] = '\0';
+        return empty;
+    }
+
+    // Em ordem lexicográfica, o prefixo comum a todas é o da menor com a maior
+    const RTLeaf *first = edge_leaf(trie->root, false);
+    const RTLeaf *last = edge_leaf(trie->root, true);
+    size_t common = 0;
+    while (common + 1 < first->len && first->key[common] == last->key[common]) common++;
+
+    char *result = (char*)malloc(common + 1);
+    if (result == NULL) return NULL;
+    memcpy(result, first->key, common);
+    result[common] = '\0';
+    return result;
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+size_t radix_trie_size(const RadixTrie *trie) {
+    return (trie == NULL) ? 0 : trie->size;
+}
+
+bool radix_trie_is_empty(const RadixTrie *trie) {
+    return trie == NULL || trie->size == 0;
+}
+
+size_t radix_trie_memory_usage(const RadixTrie *trie) {
+    return (trie == NULL) ? 0 : trie->memory;
+}
+
+void radix_trie_clear(RadixTrie *trie) {
+    if (trie == NULL) return;
+
+    node_destroy(trie, trie->root);
+    trie->root = NULL;
+    trie->size = 0;
+}
+
+// ============================================================================
+// CONVERSÕES
+// ============================================================================
+
+DataStructureError radix_trie_to_array(const RadixTrie *trie, char ***strings, size_t *count) {
+    if (trie == NULL || strings == NULL || count == NULL) return DS_ERROR_NULL_POINTER;
+
+    *strings = NULL;
+    *count = 0;
+    if (trie->root == NULL) return DS_SUCCESS;
+    return collect_results(trie->root, strings, count);
+}
+
+// ============================================================================
+// IMPRESSÃO
+// ============================================================================
+
+void radix_trie_print(const RadixTrie *trie) {
+    if (trie == NULL) return;
+
+    printf("RadixTrie(size=%zu, memory=%zu bytes):\n", trie->size, trie->memory);
+    char **strings = NULL;
+    size_t count = 0;
+    if (radix_trie_to_array(trie, &strings, &count) != DS_SUCCESS) return;
+    for (size_t i = 0; i < count; i++) {
+        printf("  %s\n", strings[i]);
+        free(strings[i]);
+    }
+    free(strings);
+}
@@ -0,0 +1,269 @@
+/**
+ * @file segment_tree.c
+ * @brief Implementação da segment tree iterativa com range add preguiçoso
+ *
+ * Invariante: nodes[p] é o agregado do segmento de p já com os adds
+ * aplicados em p e abaixo, mas sem os adds pendentes nos ancestrais
+ * (pending[a] de cada ancestral a). Assim:
+ * - range_add aplica nos nós canônicos e recompõe só os ancestrais das
+ *   duas bordas (o add é comutativo, nada precisa descer antes)
+ * - query empurra os pendentes do topo até as duas folhas das bordas e
+ *   combina os nós canônicos
+ *
+ * As folhas de preenchimento [n, N) têm soma 0, mín INT64_MAX e máx
+ * INT64_MIN. Como um add só é aplicado a nós contidos em [0, n), um nó que
+ * cobre preenchimento nunca tem add pendente e os sentinelas não estouram.
+ *
+ * Referências:
+ * - Al.Cash (2015). "Efficient and easy segment trees", Codeforces blog
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/segment_tree.h"
+
+#include <string.h>
+
+// ============================================================================
+// ESTRUTURA INTERNA
+// ============================================================================
+
+struct SegmentTree {
+    RangeAggregate *nodes;  // 2N nós; folhas em [N, 2N)
+    int64_t *pending;       // N adds pendentes dos nós internos
+    size_t n;
+    size_t leaves;          // N: potência de 2 >= n
+    unsigned height;        // log2(N)
+    DSAllocator allocator;
+};
+
+// ============================================================================
+// FUNÇÕES AUXILIARES PRIVADAS
+// ============================================================================
+
+static inline RangeAggregate combine(RangeAggregate a, RangeAggregate b) {
+    RangeAggregate r;
+    r.sum = a.sum + b.sum;
+    r.min = a.min < b.min ? a.min : b.min;
+    r.max = a.max > b.max ? a.max : b.max;
+    return r;
+}
+
+/**
+ * Soma delta a todos os elementos de p (segmento de length folhas)
+ */
+static inline void apply(SegmentTree *tree, size_t p, int64_t delta, size_t length) {
+    tree->nodes[p].sum += delta * (int64_t)length;
+    tree->nodes[p].min += delta;
+    tree->nodes[p].max += delta;
+    if (p < tree->leaves) {
+        tree->pending[p] += delta;
+    }
+}
+
+/**
+ * Recompõe os ancestrais da folha p a partir dos filhos e do pendente
+ */
+static void rebuild_up(SegmentTree *tree, size_t p) {
+    size_t length = 1;
+    while (p > 1) {
+        p /= 2;
+        length *= 2;
+        RangeAggregate r = combine(tree->nodes[2 * p], tree->nodes[2 * p + 1]);
+        int64_t d = tree->pending[p];
+        r.sum += d * (int64_t)length;
+        r.min += d;
+        r.max += d;
+        tree->nodes[p] = r;
+    }
+}
+
+/**
+ * Empurra os adds pendentes do topo até a folha p
+ */
+static void push_down(SegmentTree *tree, size_t p) {
+    for (unsigned s = tree->height; s > 0; s--) {
+        size_t i = p >> s;
+        int64_t d = tree->pending[i];
+        if (d != 0) {
+            size_t child_length = (size_t)1 << (s - 1);
+            apply(tree, 2 * i, d, child_length);
+            apply(tree, 2 * i + 1, d, child_length);
+            tree->pending[i] = 0;
+        }
+    }
+}
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+SegmentTree* segment_tree_create(const int64_t *values, size_t n) {
+    return segment_tree_create_with_allocator(values, n, NULL);
+}
+
+SegmentTree* segment_tree_create_with_allocator(const int64_t *values, size_t n,
+                                                const DSAllocator *allocator) {
+    if (n == 0 || n > SIZE_MAX / (4 * sizeof(RangeAggregate))) {
+        return NULL;
+    }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
+
+    size_t leaves = 1;
+    unsigned height = 0;
+    while (leaves < n) {
+        leaves *= 2;
+        height++;
+    }
+
+    SegmentTree *tree = (SegmentTree *)ds_alloc(allocator, sizeof(SegmentTree));
+    if (tree == NULL) {
+        return NULL;
+    }
+    tree->nodes = (RangeAggregate *)ds_alloc(allocator, 2 * leaves * sizeof(RangeAggregate));
+    tree->pending = (int64_t *)ds_calloc(allocator, leaves, sizeof(int64_t));
+    if (tree->nodes == NULL || tree->pending == NULL) {
+        ds_free(allocator, tree->nodes, 2 * leaves * sizeof(RangeAggregate));
+        ds_free(allocator, tree->pending, leaves * sizeof(int64_t));
+        ds_free(allocator, tree, sizeof(SegmentTree));
+        return NULL;
+    }
+
+    tree->n = n;
+    tree->leaves = leaves;
+    tree->height = height;
+    tree->allocator = *allocator;
+
+    for (size_t i = 0; i < leaves; i++) {
+        RangeAggregate *leaf = &tree->nodes[leaves + i];
+        if (i < n) {
+            int64_t v = values != NULL ? values[i] : 0;
+            leaf->sum = v;
+            leaf->min = v;
+            leaf->max = v;
+        } else {
+            leaf->sum = 0;
+            leaf->min = INT64_MAX;
+            leaf->max = INT64_MIN;
+        }
+    }
+    for (size_t p = leaves - 1; p > 0; p--) {
+        tree->nodes[p] = combine(tree->nodes[2 * p], tree->nodes[2 * p + 1]);
+    }
+    return tree;
+}
+
+void segment_tree_destroy(SegmentTree *tree) {
+    if (tree == NULL) {
+        return;
+    }
+
+    DSAllocator allocator = tree->allocator;
+    ds_free(&allocator, tree->nodes, 2 * tree->leaves * sizeof(RangeAggregate));
+    ds_free(&allocator, tree->pending, tree->leaves * sizeof(int64_t));
+    ds_free(&allocator, tree, sizeof(SegmentTree));
+}
+
+// ============================================================================
+// OPERAÇÕES PRINCIPAIS
+// ============================================================================
+
+DataStructureError segment_tree_range_add(SegmentTree *tree, size_t lo, size_t hi,
+                                          int64_t delta) {
+    if (tree == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (lo > hi || hi > tree->n) {
+        return DS_ERROR_INVALID_INDEX;
+    }
+    if (lo == hi || delta == 0) {
+        return DS_SUCCESS;
+    }
+
+    size_t l = lo + tree->leaves;
+    size_t r = hi + tree->leaves;
+    for (size_t length = 1; l < r; l /= 2, r /= 2, length *= 2) {
+        if (l & 1) {
+            apply(tree, l++, delta, length);
+        }
+        if (r & 1) {
+            apply(tree, --r, delta, length);
+        }
+    }
+    rebuild_up(tree, lo + tree->leaves);
+    rebuild_up(tree, hi - 1 + tree->leaves);
+    return DS_SUCCESS;
+}
+
+DataStructureError segment_tree_set(SegmentTree *tree, size_t index, int64_t value) {
+    if (tree == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (index >= tree->n) {
+        return DS_ERROR_INVALID_INDEX;
+    }
+
+    size_t p = index + tree->leaves;
+    push_down(tree, p);
+    tree->nodes[p].sum = value;
+    tree->nodes[p].min = value;
+    tree->nodes[p].max = value;
+    rebuild_up(tree, p);
+    return DS_SUCCESS;
+}
+
+DataStructureError segment_tree_query(SegmentTree *tree, size_t lo, size_t hi,
+                                      RangeAggregate *out) {
+    if (tree == NULL || out == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (lo >= hi || hi > tree->n) {
+        return DS_ERROR_INVALID_INDEX;
+    }
+
+    size_t l = lo + tree->leaves;
+    size_t r = hi + tree->leaves;
+    push_down(tree, l);
+    push_down(tree, r - 1);
+
+    RangeAggregate result = {0, INT64_MAX, INT64_MIN};
+    for (; l < r; l /= 2, r /= 2) {
+        if (l & 1) {
+            result = combine(result, tree->nodes[l++]);
+        }
+        if (r & 1) {
+            result = combine(result, tree->nodes[--r]);
+        }
+    }
+    *out = result;
+    return DS_SUCCESS;
+}
+
+DataStructureError segment_tree_get(SegmentTree *tree, size_t index, int64_t *value) {
+    if (tree == NULL || value == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (index >= tree->n) {
+        return DS_ERROR_INVALID_INDEX;
+    }
+
+    size_t p = index + tree->leaves;
+    push_down(tree, p);
+    *value = tree->nodes[p].sum;
+    return DS_SUCCESS;
+}
+
+size_t segment_tree_size(const SegmentTree *tree) {
+    return tree ? tree->n : 0;
+}
+
+size_t segment_tree_memory_usage(const SegmentTree *tree) {
+    if (tree == NULL) {
+        return 0;
+    }
+    return sizeof(SegmentTree) + 2 * tree->leaves * sizeof(RangeAggregate) +
+           tree->leaves * sizeof(int64_t);
+}
@@ -16,6 +16,7 @@
 
 #include "data_structures/stack.h"
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -48,6 +49,8 @@ struct Stack {
 
     // Para STACK_LINKED
     StackNode *head;          // Topo da pilha (primeiro nó)
+
+    DSAllocator allocator;    // Origem de cabeçalho, buffer e nós
 };
 
 // ============================================================================
@@ -57,15 +60,22 @@ struct Stack {
 /**
  * @brief Redimensiona o array da pilha
  *
- * Dobra a capacidade quando necessário.
+ * Dobra a capacidade quando necessário (ou vai direto a min_capacity, se
+ * maior, para que um lote grande cresça uma vez só).
  *
  * Complexidade: O(n)
  */
-static DataStructureError stack_resize_array(Stack *stack) {
+static DataStructureError stack_resize_array(Stack *stack, size_t min_capacity) {
     size_t new_capacity = stack->capacity * 2;
     if (new_capacity < 4) new_capacity = 4;
+    if (new_capacity < min_capacity) new_capacity = min_capacity;
+    if (new_capacity > SIZE_MAX / stack->element_size) {
+        return DS_ERROR_OUT_OF_MEMORY;
+    }
 
-    void *new_array = realloc(stack->array, new_capacity * stack->element_size);
+    void *new_array = ds_realloc(&stack->allocator, stack->array,
+                                 stack->capacity * stack->element_size,
+                                 new_capacity * stack->element_size);
     if (new_array == NULL) {
         return DS_ERROR_OUT_OF_MEMORY;
     }
@@ -89,15 +99,31 @@ static DataStructureError stack_resize_array(Stack *stack) {
  * Complexidade: O(1) para LINKED, O(capacity) para ARRAY
  */
 Stack* stack_create(size_t element_size, StackType type, size_t initial_capacity, DestroyFn destroy) {
+    return stack_create_with_allocator(element_size, type, initial_capacity, destroy, NULL);
+}
+
+/**
+ * @brief Cria uma pilha com alocador customizado
+ *
+ * Complexidade: O(1) para LINKED, O(capacity) para ARRAY
+ */
+Stack* stack_create_with_allocator(size_t element_size, StackType type,
+                                   size_t initial_capacity, DestroyFn destroy,
+                                   const DSAllocator *allocator) {
     if (element_size == 0) {
         return NULL;
     }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
 
-    Stack *stack = (Stack*)malloc(sizeof(Stack));
+    Stack *stack = (Stack*)ds_alloc(allocator, sizeof(Stack));
     if (stack == NULL) {
         return NULL;
     }
 
+    stack->allocator = *allocator;
+
     stack->element_size = element_size;
     stack->type = type;
     stack->size = 0;
@@ -106,9 +132,9 @@ Stack* stack_create(size_t element_size, StackType type, size_t initial_capacity
     if (type == STACK_ARRAY) {
         if (initial_capacity == 0) initial_capacity = 16;
 
-        stack->array = malloc(initial_capacity * element_size);
+        stack->array = ds_alloc(allocator, initial_capacity * element_size);
         if (stack->array == NULL) {
-            free(stack);
+            ds_free(allocator, stack, sizeof(Stack));
             return NULL;
         }
 
@@ -138,11 +164,12 @@ void stack_destroy(Stack *stack) {
 
     stack_clear(stack);
 
+    DSAllocator allocator = stack->allocator;
     if (stack->type == STACK_ARRAY && stack->array != NULL) {
-        free(stack->array);
+        ds_free(&allocator, stack->array, stack->capacity * stack->element_size);
     }
 
-    free(stack);
+    ds_free(&allocator, stack, sizeof(Stack));
 }
 
 // ============================================================================
@@ -162,7 +189,7 @@ void stack_destroy(Stack *stack) {
 static DataStructureError stack_push_array(Stack *stack, const void *data) {
     // Verificar se precisa redimensionar
     if (stack->size >= stack->capacity) {
-        DataStructureError err = stack_resize_array(stack);
+        DataStructureError err = stack_resize_array(stack, 0);
         if (err != DS_SUCCESS) {
             return err;
         }
@@ -245,14 +272,14 @@ static DataStructureError stack_top_array(const Stack *stack, void *output) {
  */
 static DataStructureError stack_push_linked(Stack *stack, const void *data) {
     // Criar novo nó
-    StackNode *node = (StackNode*)malloc(sizeof(StackNode));
+    StackNode *node = (StackNode*)ds_alloc(&stack->allocator, sizeof(StackNode));
     if (node == NULL) {
         return DS_ERROR_OUT_OF_MEMORY;
     }
 
-    node->data = malloc(stack->element_size);
+    node->data = ds_alloc(&stack->allocator, stack->element_size);
     if (node->data == NULL) {
-        free(node);
+        ds_free(&stack->allocator, node, sizeof(StackNode));
         return DS_ERROR_OUT_OF_MEMORY;
     }
 
@@ -293,8 +320,8 @@ static DataStructureError stack_pop_linked(Stack *stack, void *output) {
     // Remover nó
     stack->head = node->next;
 
-    free(node->data);
-    free(node);
+    ds_free(&stack->allocator, node->data, stack->element_size);
+    ds_free(&stack->allocator, node, sizeof(StackNode));
     stack->size--;
 
     return DS_SUCCESS;
@@ -354,6 +381,110 @@ DataStructureError stack_top(const Stack *stack, void *output) {
     }
 }
 
+// ============================================================================
+// OPERAÇÕES EM LOTE E ACESSO SEM CÓPIA
+// ============================================================================
+
+DataStructureError stack_push_n(Stack *stack, const void *data, size_t count) {
+    if (stack == NULL || (data == NULL && count > 0)) {
+        return DS_ERROR_NULL_POINTER;
+    }
+    if (count == 0) {
+        return DS_SUCCESS;
+    }
+
+    if (stack->type == STACK_ARRAY) {
+        if (count > SIZE_MAX - stack->size) {
+            return DS_ERROR_OUT_OF_MEMORY;
+        }
+        if (stack->size + count > stack->capacity) {
+            DataStructureError err = stack_resize_array(stack, stack->size + count);
+            if (err != DS_SUCCESS) {
+                return err;
+            }
+        }
+        memcpy((char*)stack->array + stack->size * stack->element_size, data,
+               count * stack->element_size);
+        stack->size += count;
+        stack->top = stack->size - 1;
+        return DS_SUCCESS;
+    }
+
+    // STACK_LINKED: monta a cadeia à parte (data[count - 1] fica no topo)
+    // e só a liga se tudo foi alocado
+    StackNode *chain = NULL;
+    StackNode *bottom = NULL;
+    for (size_t i = 0; i < count; i++) {
+        StackNode *node = (StackNode*)ds_alloc(&stack->allocator, sizeof(StackNode));
+        void *node_data = node != NULL ? ds_alloc(&stack->allocator, stack->element_size) : NULL;
+        if (node_data == NULL) {
+            ds_free(&stack->allocator, node, sizeof(StackNode));
+            while (chain != NULL) {
+                StackNode *next = chain->next;
+                ds_free(&stack->allocator, chain->data, stack->element_size);
+                ds_free(&stack->allocator, chain, sizeof(StackNode));
+                chain = next;
+            }
+            return DS_ERROR_OUT_OF_MEMORY;
+        }
+        node->data = node_data;
+        memcpy(node->data, (const char*)data + i * stack->element_size, stack->element_size);
+        node->next = chain;
+        chain = node;
+        if (bottom == NULL) {
+            bottom = node;
+        }
+    }
+
+    bottom->next = stack->head;
+    stack->head = chain;
+    stack->size += count;
+    return DS_SUCCESS;
+}
+
+size_t stack_pop_n(Stack *stack, void *output, size_t max) {
+    if (stack == NULL) {
+        return 0;
+    }
+    size_t n = max < stack->size ? max : stack->size;
+    if (n == 0) {
+        return 0;
+    }
+
+    if (stack->type == STACK_LINKED) {
+        // O topo vai para a última posição de output
+        for (size_t i = 0; i < n; i++) {
+            stack_pop_linked(stack, output != NULL
+                                    ? (char*)output + (n - 1 - i) * stack->element_size
+                                    : NULL);
+        }
+        return n;
+    }
+
+    char *first = (char*)stack->array + (stack->size - n) * stack->element_size;
+    if (output != NULL) {
+        memcpy(output, first, n * stack->element_size);
+    }
+    if (stack->destroy != NULL) {
+        for (size_t i = 0; i < n; i++) {
+            stack->destroy(first + i * stack->element_size);
+        }
+    }
+    stack->size -= n;
+    stack->top = stack->size > 0 ? stack->size - 1 : 0;
+    return n;
+}
+
+const void* stack_top_ptr(const Stack *stack) {
+    if (stack == NULL || stack->size == 0) {
+        return NULL;
+    }
+    if (stack->type == STACK_ARRAY) {
+        return (const char*)stack->array + stack->top * stack->element_size;
+    }
+    return stack->head->data;
+}
+
 // ============================================================================
 // CONSULTAS E UTILITÁRIOS
 // ============================================================================
@@ -373,6 +504,16 @@ size_t stack_capacity(const Stack *stack) {
     return stack->capacity;
 }
 
+size_t stack_memory_usage(const Stack *stack) {
+    if (stack == NULL) {
+        return 0;
+    }
+    if (stack->type == STACK_ARRAY) {
+        return sizeof(Stack) + stack->capacity * stack->element_size;
+    }
+    return sizeof(Stack) + stack->size * (sizeof(StackNode) + stack->element_size);
+}
+
 void stack_clear(Stack *stack) {
     if (stack == NULL) {
         return;
@@ -0,0 +1,254 @@
+/**
+ * @file static_bst.c
+ * @brief Árvore de busca estática em layout Eytzinger ou van Emde Boas
+ *
+ * Referências:
+ * - Brodal, Fagerberg & Jacob (2002), S3 - navegação no layout vEB
+ * - Khuong & Morin (2017), S3 - Eytzinger sem desvios com prefetch
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/static_bst.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// ESTRUTURAS INTERNAS
+// ============================================================================
+
+/** Altura máxima da árvore perfeita do vEB (índices BFS em size_t) */
+#define VEB_MAX_HEIGHT 63
+
+/**
+ * @brief Árvore estática
+ *
+ * Eytzinger: data[k] é o nó k (base 1, data[0] sem uso), n posições úteis.
+ * vEB: data[p] é o nó na posição p (base 0) da árvore perfeita de altura
+ * height; um nó com ordem simétrica >= n é só enchimento. Para um nó de
+ * profundidade d > 0, raiz de uma subárvore de baixo no corte recursivo,
+ * top_depth[d] é a profundidade da raiz da subárvore de cima, top_size[d]
+ * seu tamanho e bottom_size[d] o tamanho de cada subárvore de baixo.
+ */
+struct StaticBST {
+    unsigned char *data;
+    size_t size;
+    size_t slots;
+    size_t element_size;
+    CompareFn compare;
+    StaticBSTLayout layout;
+    unsigned height;
+    unsigned top_depth[VEB_MAX_HEIGHT];
+    size_t top_size[VEB_MAX_HEIGHT];
+    size_t bottom_size[VEB_MAX_HEIGHT];
+};
+
+// ============================================================================
+// FUNÇÕES AUXILIARES PRIVADAS
+// ============================================================================
+
+static inline const unsigned char* slot_at(const StaticBST *tree, size_t p) {
+    return tree->data + p * tree->element_size;
+}
+
+/**
+ * Preenche o Eytzinger percorrendo a árvore implícita em ordem simétrica:
+ * o i-ésimo nó visitado recebe o i-ésimo elemento. Retorna o próximo i.
+ */
+static size_t eytzinger_fill(StaticBST *tree, const unsigned char *sorted, size_t i, size_t k) {
+    if (k > tree->size) return i;
+    i = eytzinger_fill(tree, sorted, i, 2 * k);
+    memcpy(tree->data + k * tree->element_size, sorted + i * tree->element_size,
+           tree->element_size);
+    return eytzinger_fill(tree, sorted, i + 1, 2 * k + 1);
+}
+
+/**
+ * Tabelas do corte vEB de uma subárvore com raiz na profundidade depth e
+ * altura height: a metade de cima fica com floor(height / 2) níveis.
+ */
+static void veb_tables(StaticBST *tree, unsigned depth, unsigned height) {
+    if (height <= 1) return;
+    unsigned top = height / 2;
+    unsigned bottom = height - top;
+    tree->top_depth[depth + top] = depth;
+    tree->top_size[depth + top] = ((size_t)1 << top) - 1;
+    tree->bottom_size[depth + top] = ((size_t)1 << bottom) - 1;
+    veb_tables(tree, depth, top);
+    veb_tables(tree, depth + top, bottom);
+}
+
+/**
+ * Posição vEB do nó BFS i (base 1) na profundidade d, dadas as posições dos
+ * seus ancestrais em pos[0 .. d): o nó está na subárvore de baixo número
+ * (i & top_size), gravada depois da subárvore de cima.
+ */
+static inline size_t veb_position(const StaticBST *tree, const size_t *pos, size_t i, unsigned d) {
+    if (d == 0) return 0;
+    size_t top = tree->top_size[d];
+    return pos[tree->top_depth[d]] + top + (i & top) * tree->bottom_size[d];
+}
+
+// Ordem simétrica do nó BFS i (base 1) na profundidade d
+static inline size_t veb_rank(const StaticBST *tree, size_t i, unsigned d) {
+    return ((((i - ((size_t)1 << d)) << 1) | 1) << (tree->height - 1 - d)) - 1;
+}
+
+static void veb_fill(StaticBST *tree, const unsigned char *sorted, size_t *pos, size_t i, unsigned d) {
+    pos[d] = veb_position(tree, pos, i, d);
+    size_t r = veb_rank(tree, i, d);
+    if (r < tree->size) {
+        memcpy(tree->data + pos[d] * tree->element_size, sorted + r * tree->element_size,
+               tree->element_size);
+    }
+    if (d + 1 < tree->height) {
+        veb_fill(tree, sorted, pos, 2 * i, d + 1);
+        veb_fill(tree, sorted, pos, 2 * i + 1, d + 1);
+    }
+}
+
+/**
+ * Lower bound: posição do menor elemento >= key, ou SIZE_MAX. Com exact,
+ * para no primeiro nó igual.
+ */
+static size_t eytzinger_find(const StaticBST *tree, const void *key, bool exact) {
+    size_t k = 1;
+    while (k <= tree->size) {
+        // Os 16 descendentes 4 níveis abaixo são contíguos
+        __builtin_prefetch(tree->data + 16 * k * tree->element_size);
+        int c = tree->compare(slot_at(tree, k), key);
+        if (exact && c == 0) return k;
+        k = 2 * k + (c < 0);
+    }
+    // Desfaz as viradas à direita finais: o último desvio à esquerda é a resposta
+    k >>= __builtin_ctzll(~(unsigned long long)k) + 1;
+    return (k == 0 || exact) ? SIZE_MAX : k;
+}
+
+static size_t veb_find(const StaticBST *tree, const void *key, bool exact) {
+    size_t pos[VEB_MAX_HEIGHT];
+    size_t best = SIZE_MAX;
+    size_t i = 1;
+    for (unsigned d = 0; d < tree->height; d++) {
+        pos[d] = veb_position(tree, pos, i, d);
+        bool right = false;
+        if (veb_rank(tree, i, d) < tree->size) {
+            int c = tree->compare(slot_at(tree, pos[d]), key);
+            if (c == 0 && exact) return pos[d];
+            if (c < 0) right = true;
+            else best = pos[d];
+        }
+        i = 2 * i + right;
+    }
+    return exact ? SIZE_MAX : best;
+}
+
+static size_t static_bst_find(const StaticBST *tree, const void *key, bool exact) {
+    if (tree->layout == STATIC_BST_VEB) return veb_find(tree, key, exact);
+    return eytzinger_find(tree, key, exact);
+}
+
+// ============================================================================
+// CRIAÇÃO E DESTRUIÇÃO
+// ============================================================================
+
+StaticBST* static_bst_create(const void *sorted, size_t size, size_t element_size,
+                             CompareFn compare, StaticBSTLayout layout) {
+    if ((sorted == NULL && size > 0) || element_size == 0 || compare == NULL) return NULL;
+    if (layout != STATIC_BST_EYTZINGER && layout != STATIC_BST_VEB) return NULL;
+
+    StaticBST *tree = (StaticBST*)calloc(1, sizeof(StaticBST));
+    if (tree == NULL) return NULL;
+    tree->size = size;
+    tree->element_size = element_size;
+    tree->compare = compare;
+    tree->layout = layout;
+
+    size_t allocated;
+    if (layout == STATIC_BST_EYTZINGER) {
+        tree->slots = size;
+        allocated = size + 1;
+    } else {
+        while (tree->height < VEB_MAX_HEIGHT && (((size_t)1 << tree->height) - 1) < size)
+            tree->height++;
+        tree->slots = ((size_t)1 << tree->height) - 1;
+        allocated = (tree->slots > 0) ? tree->slots : 1;
+    }
+    if (allocated > SIZE_MAX / element_size) {
+        free(tree);
+        return NULL;
+    }
+    tree->data = (unsigned char*)calloc(allocated, element_size);
+    if (tree->data == NULL) {
+        free(tree);
+        return NULL;
+    }
+
+    if (layout == STATIC_BST_EYTZINGER) {
+        eytzinger_fill(tree, (const unsigned char*)sorted, 0, 1);
+    } else if (tree->height > 0) {
+        size_t pos[VEB_MAX_HEIGHT];
+        veb_tables(tree, 0, tree->height);
+        veb_fill(tree, (const unsigned char*)sorted, pos, 1, 0);
+    }
+    return tree;
+}
+
+void static_bst_destroy(StaticBST *tree) {
+    if (tree == NULL) return;
+    free(tree->data);
+    free(tree);
+}
+
+// ============================================================================
+// BUSCA
+// ============================================================================
+
+DataStructureError static_bst_search(const StaticBST *tree, const void *key, void *output) {
+    if (tree == NULL || key == NULL || output == NULL) return DS_ERROR_NULL_POINTER;
+    size_t p = static_bst_find(tree, key, true);
+    if (p == SIZE_MAX) return DS_ERROR_NOT_FOUND;
+    memcpy(output, slot_at(tree, p), tree->element_size);
+    return DS_SUCCESS;
+}
+
+bool static_bst_contains(const StaticBST *tree, const void *key) {
+    if (tree == NULL || key == NULL) return false;
+    return static_bst_find(tree, key, true) != SIZE_MAX;
+}
+
+DataStructureError static_bst_lower_bound(const StaticBST *tree, const void *key, void *output) {
+    if (tree == NULL || key == NULL || output == NULL) return DS_ERROR_NULL_POINTER;
+    size_t p = static_bst_find(tree, key, false);
+    if (p == SIZE_MAX) return DS_ERROR_NOT_FOUND;
+    memcpy(output, slot_at(tree, p), tree->element_size);
+    return DS_SUCCESS;
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+size_t static_bst_size(const StaticBST *tree) {
+    return (tree != NULL) ? tree->size : 0;
+}
+
+size_t static_bst_memory_usage(const StaticBST *tree) {
+    if (tree == NULL) return 0;
+    size_t allocated = (tree->layout == STATIC_BST_EYTZINGER) ? tree->slots + 1
+                     : (tree->slots > 0) ? tree->slots : 1;
+    return sizeof(StaticBST) + allocated * tree->element_size;
+}
+
+StaticBSTLayout static_bst_layout(const StaticBST *tree) {
+    return (tree != NULL) ? tree->layout : STATIC_BST_EYTZINGER;
+}
+
+const void* static_bst_data(const StaticBST *tree, size_t *slots) {
+    if (tree == NULL) return NULL;
+    if (slots != NULL) *slots = tree->slots;
+    if (tree->layout == STATIC_BST_EYTZINGER) return tree->data + tree->element_size;
+    return tree->data;
+}
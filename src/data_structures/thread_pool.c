@@ -0,0 +1,589 @@
+/**
+ * @file thread_pool.c
+ * @brief Implementação do pool global com deques de Chase-Lev
+ *
+ * Deque: versão de Lê et al. (2013) com os atômicos do C11. bottom só é
+ * escrito pelo dono; top avança por CAS (roubo, ou pop do último
+ * elemento). Ao crescer, o buffer antigo não pode ser liberado porque um
+ * ladrão pode estar lendo dele: fica encadeado no novo e só é liberado no
+ * encerramento do pool (no máximo O(log tarefas) buffers por worker).
+ *
+ * Sono: o worker sem trabalho incrementa sleeping sob o mutex e relê
+ * queued antes de esperar; quem publica incrementa queued e depois lê
+ * sleeping. Com as duas operações seq_cst, pelo menos um dos lados vê o
+ * outro, então nenhuma tarefa fica sem acordar alguém.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+// pthreads/sysconf/sched_yield (POSIX) com CMAKE_C_EXTENSIONS OFF
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "data_structures/thread_pool.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/** Capacidade inicial (potência de 2) da deque de cada worker */
+#define POOL_DEQUE_INITIAL_CAPACITY 256
+
+/** Tentativas de achar trabalho antes de um worker dormir */
+#define POOL_SPIN_ROUNDS 64
+
+/** Blocos por thread quando ds_parallel_for recebe grain = 0 */
+#define POOL_CHUNKS_PER_THREAD 8
+
+/** Linha de cache usada para separar top e bottom */
+#define POOL_CACHE_LINE 64
+
+// ============================================================================
+// ESTRUTURAS INTERNAS
+// ============================================================================
+
+typedef struct DSTask {
+    DSTaskFn fn;                // NULL: bloco de ds_parallel_for
+    void *arg;
+    DSRangeFn range_fn;
+    size_t lo, hi, grain;
+    DSTaskGroup *group;
+    struct DSTask *next;        // fila de injeção
+} DSTask;
+
+typedef struct DequeBuffer {
+    int64_t mask;
+    struct DequeBuffer *retired;    // buffer anterior, liberado no shutdown
+    _Atomic(DSTask *) slots[];
+} DequeBuffer;
+
+typedef struct {
+    _Alignas(POOL_CACHE_LINE) _Atomic int64_t top;
+    _Alignas(POOL_CACHE_LINE) _Atomic int64_t bottom;
+    _Atomic(DequeBuffer *) buffer;
+} Deque;
+
+typedef struct Pool Pool;
+
+typedef struct {
+    Deque deque;
+    pthread_t thread;
+    size_t index;               // 1..num_workers
+    uint64_t rng;
+    Pool *pool;
+} Worker;
+
+struct Pool {
+    Worker *workers;
+    size_t num_workers;
+    size_t num_threads;         // workers + thread que espera
+
+    pthread_mutex_t lock;       // fila de injeção e sono
+    pthread_cond_t wake;
+    DSTask *inject_head;
+    DSTask *inject_tail;
+    atomic_size_t inject_count;
+
+    atomic_size_t queued;       // tarefas publicadas e ainda não retiradas
+    atomic_size_t sleeping;
+    atomic_bool stop;
+};
+
+static atomic_size_t configured_threads = 0;        // 0 = núcleos disponíveis
+static _Atomic(Pool *) global_pool = NULL;
+static atomic_bool pool_failed = false;             // não tenta recriar a cada chamada
+static pthread_mutex_t pool_init_lock = PTHREAD_MUTEX_INITIALIZER;
+static _Thread_local Worker *t_worker = NULL;
+static _Thread_local unsigned t_region_depth = 0;   // dentro de ds_parallel_for/invoke/wait
+
+// ============================================================================
+// DEQUE DE CHASE-LEV
+// ============================================================================
+
+static DequeBuffer* buffer_create(int64_t capacity) {
+    DequeBuffer *buf = malloc(sizeof(DequeBuffer) + (size_t)capacity * sizeof(_Atomic(DSTask *)));
+    if (buf == NULL) return NULL;
+    buf->mask = capacity - 1;
+    buf->retired = NULL;
+    for (int64_t i = 0; i < capacity; i++) {
+        atomic_init(&buf->slots[i], NULL);
+    }
+    return buf;
+}
+
+static bool deque_init(Deque *q) {
+    DequeBuffer *buf = buffer_create(POOL_DEQUE_INITIAL_CAPACITY);
+    if (buf == NULL) return false;
+    atomic_init(&q->top, 0);
+    atomic_init(&q->bottom, 0);
+    atomic_init(&q->buffer, buf);
+    return true;
+}
+
+static void deque_destroy(Deque *q) {
+    DequeBuffer *buf = atomic_load_explicit(&q->buffer, memory_order_relaxed);
+    while (buf != NULL) {
+        DequeBuffer *prev = buf->retired;
+        free(buf);
+        buf = prev;
+    }
+}
+
+// Só o dono; false sem memória para crescer
+static bool deque_push(Deque *q, DSTask *task) {
+    int64_t b = atomic_load_explicit(&q->bottom, memory_order_relaxed);
+    int64_t t = atomic_load_explicit(&q->top, memory_order_acquire);
+    DequeBuffer *buf = atomic_load_explicit(&q->buffer, memory_order_relaxed);
+
+    if (b - t > buf->mask) {
+        DequeBuffer *grown = buffer_create((buf->mask + 1) * 2);
+        if (grown == NULL) return false;
+        for (int64_t i = t; i < b; i++) {
+            atomic_store_explicit(&grown->slots[i & grown->mask],
+                                  atomic_load_explicit(&buf->slots[i & buf->mask],
+                                                       memory_order_relaxed),
+                                  memory_order_relaxed);
+        }
+        grown->retired = buf;
+        atomic_store_explicit(&q->buffer, grown, memory_order_release);
+        buf = grown;
+    }
+
+    atomic_store_explicit(&buf->slots[b & buf->mask], task, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed);
+    return true;
+}
+
+// Só o dono; LIFO
+static DSTask* deque_pop(Deque *q) {
+    int64_t b = atomic_load_explicit(&q->bottom, memory_order_relaxed) - 1;
+    DequeBuffer *buf = atomic_load_explicit(&q->buffer, memory_order_relaxed);
+    atomic_store_explicit(&q->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t t = atomic_load_explicit(&q->top, memory_order_relaxed);
+
+    DSTask *task = NULL;
+    if (t <= b) {
+        task = atomic_load_explicit(&buf->slots[b & buf->mask], memory_order_relaxed);
+        if (t == b) {
+            // Último elemento: disputa com os ladrões pelo top
+            if (!atomic_compare_exchange_strong_explicit(&q->top, &t, t + 1,
+                                                         memory_order_seq_cst,
+                                                         memory_order_relaxed)) {
+                task = NULL;
+            }
+            atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed);
+        }
+    } else {
+        atomic_store_explicit(&q->bottom, b + 1, memory_order_relaxed);
+    }
+    return task;
+}
+
+// Qualquer thread; FIFO. NULL se vazia ou se perdeu a disputa
+static DSTask* deque_steal(Deque *q) {
+    int64_t t = atomic_load_explicit(&q->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t b = atomic_load_explicit(&q->bottom, memory_order_acquire);
+    if (t >= b) return NULL;
+
+    DequeBuffer *buf = atomic_load_explicit(&q->buffer, memory_order_acquire);
+    DSTask *task = atomic_load_explicit(&buf->slots[t & buf->mask], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&q->top, &t, t + 1,
+                                                 memory_order_seq_cst,
+                                                 memory_order_relaxed)) {
+        return NULL;
+    }
+    return task;
+}
+
+// ============================================================================
+// AGENDAMENTO
+// ============================================================================
+
+static uint64_t next_random(uint64_t *state) {
+    uint64_t x = *state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+static void wake_one(Pool *pool) {
+    if (atomic_load(&pool->sleeping) > 0) {
+        pthread_mutex_lock(&pool->lock);
+        pthread_cond_signal(&pool->wake);
+        pthread_mutex_unlock(&pool->lock);
+    }
+}
+
+static void inject(Pool *pool, DSTask *task) {
+    task->next = NULL;
+    pthread_mutex_lock(&pool->lock);
+    if (pool->inject_tail != NULL) {
+        pool->inject_tail->next = task;
+    } else {
+        pool->inject_head = task;
+    }
+    pool->inject_tail = task;
+    atomic_fetch_add_explicit(&pool->inject_count, 1, memory_order_release);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static DSTask* take_injected(Pool *pool) {
+    if (atomic_load_explicit(&pool->inject_count, memory_order_acquire) == 0) return NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    DSTask *task = pool->inject_head;
+    if (task != NULL) {
+        pool->inject_head = task->next;
+        if (pool->inject_head == NULL) pool->inject_tail = NULL;
+        atomic_fetch_sub_explicit(&pool->inject_count, 1, memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return task;
+}
+
+// Publica; false se não houve memória (o chamador executa na hora)
+static bool publish(Pool *pool, DSTask *task) {
+    atomic_fetch_add(&pool->queued, 1);
+    Worker *self = t_worker;
+    if (self != NULL && self->pool == pool) {
+        if (!deque_push(&self->deque, task)) {
+            atomic_fetch_sub(&pool->queued, 1);
+            return false;
+        }
+    } else {
+        inject(pool, task);
+    }
+    wake_one(pool);
+    return true;
+}
+
+// Própria deque, depois fila de injeção, depois roubo a partir de vítima aleatória
+static DSTask* find_task(Pool *pool, Worker *self, uint64_t *rng) {
+    DSTask *task = NULL;
+    if (self != NULL) task = deque_pop(&self->deque);
+    if (task == NULL) task = take_injected(pool);
+    if (task == NULL && pool->num_workers > 0) {
+        size_t start = (size_t)(next_random(rng) % pool->num_workers);
+        for (size_t k = 0; k < pool->num_workers && task == NULL; k++) {
+            Worker *victim = &pool->workers[(start + k) % pool->num_workers];
+            if (victim != self) task = deque_steal(&victim->deque);
+        }
+    }
+    if (task != NULL) atomic_fetch_sub(&pool->queued, 1);
+    return task;
+}
+
+static void spawn_range(DSTaskGroup *group, DSRangeFn fn, void *ctx,
+                        size_t lo, size_t hi, size_t grain);
+
+// Divide [lo, hi) ao meio lançando a metade de cima até sobrar um bloco
+static void run_range(DSTaskGroup *group, DSRangeFn fn, void *ctx,
+                      size_t lo, size_t hi, size_t grain) {
+    while (hi - lo > grain) {
+        size_t mid = lo + (hi - lo) / 2;
+        spawn_range(group, fn, ctx, mid, hi, grain);
+        hi = mid;
+    }
+    fn(ctx, lo, hi);
+}
+
+static void run_task(DSTask *task) {
+    DSTaskGroup *group = task->group;
+    if (task->fn != NULL) {
+        task->fn(task->arg);
+    } else {
+        run_range(group, task->range_fn, task->arg, task->lo, task->hi, task->grain);
+    }
+    free(task);
+    atomic_fetch_sub_explicit(&group->pending, 1, memory_order_release);
+}
+
+static void* worker_main(void *arg) {
+    Worker *self = arg;
+    Pool *pool = self->pool;
+    t_worker = self;
+
+    while (!atomic_load_explicit(&pool->stop, memory_order_acquire)) {
+        DSTask *task = NULL;
+        for (int round = 0; round < POOL_SPIN_ROUNDS && task == NULL; round++) {
+            task = find_task(pool, self, &self->rng);
+            if (task == NULL) sched_yield();
+        }
+        if (task != NULL) {
+            run_task(task);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->lock);
+        atomic_fetch_add(&pool->sleeping, 1);
+        while (!atomic_load(&pool->stop) && atomic_load(&pool->queued) == 0) {
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        }
+        atomic_fetch_sub(&pool->sleeping, 1);
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    t_worker = NULL;
+    return NULL;
+}
+
+// ============================================================================
+// CICLO DE VIDA DO POOL
+// ============================================================================
+
+static size_t hardware_threads(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (size_t)n : 1;
+}
+
+static void pool_destroy(Pool *pool, size_t started) {
+    pthread_mutex_lock(&pool->lock);
+    atomic_store(&pool->stop, true);
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+    for (size_t i = 0; i < pool->num_workers; i++) {
+        deque_destroy(&pool->workers[i].deque);
+    }
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->workers);
+    free(pool);
+}
+
+static Pool* pool_create(size_t num_threads) {
+    Pool *pool = calloc(1, sizeof(Pool));
+    if (pool == NULL) return NULL;
+
+    pool->num_threads = num_threads;
+    pool->num_workers = num_threads - 1;
+    pool->workers = calloc(pool->num_workers, sizeof(Worker));
+    if (pool->workers == NULL) {
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    atomic_init(&pool->inject_count, 0);
+    atomic_init(&pool->queued, 0);
+    atomic_init(&pool->sleeping, 0);
+    atomic_init(&pool->stop, false);
+
+    for (size_t i = 0; i < pool->num_workers; i++) {
+        Worker *w = &pool->workers[i];
+        w->index = i + 1;
+        w->rng = 0x9E3779B97F4A7C15ULL * (i + 1);
+        w->pool = pool;
+        if (!deque_init(&w->deque)) {
+            pool->num_workers = i;
+            pool_destroy(pool, 0);
+            return NULL;
+        }
+    }
+    for (size_t i = 0; i < pool->num_workers; i++) {
+        if (pthread_create(&pool->workers[i].thread, NULL, worker_main, &pool->workers[i]) != 0) {
+            pool_destroy(pool, i);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+// Pool em vigor; NULL com uma thread ou se não deu para criar
+static Pool* get_pool(void) {
+    Pool *pool = atomic_load_explicit(&global_pool, memory_order_acquire);
+    if (pool != NULL) return pool;
+    if (ds_get_num_threads() <= 1 || atomic_load(&pool_failed)) return NULL;
+
+    pthread_mutex_lock(&pool_init_lock);
+    pool = atomic_load_explicit(&global_pool, memory_order_relaxed);
+    if (pool == NULL && !atomic_load(&pool_failed)) {
+        pool = pool_create(ds_get_num_threads());
+        if (pool == NULL) {
+            atomic_store(&pool_failed, true);
+        } else {
+            atomic_store_explicit(&global_pool, pool, memory_order_release);
+        }
+    }
+    pthread_mutex_unlock(&pool_init_lock);
+    return pool;
+}
+
+// ============================================================================
+// API PÚBLICA
+// ============================================================================
+
+void ds_set_num_threads(size_t num_threads) {
+    pthread_mutex_lock(&pool_init_lock);
+    atomic_store(&configured_threads, num_threads);
+    atomic_store(&pool_failed, false);
+
+    Pool *pool = atomic_load_explicit(&global_pool, memory_order_relaxed);
+    if (pool != NULL && pool->num_threads != ds_get_num_threads()) {
+        atomic_store_explicit(&global_pool, NULL, memory_order_release);
+        pool_destroy(pool, pool->num_workers);
+    }
+    pthread_mutex_unlock(&pool_init_lock);
+}
+
+size_t ds_get_num_threads(void) {
+    size_t n = atomic_load_explicit(&configured_threads, memory_order_relaxed);
+    return (n == 0) ? hardware_threads() : n;
+}
+
+size_t ds_resolve_threads(size_t requested) {
+    return (requested == 0) ? ds_get_num_threads() : requested;
+}
+
+bool ds_parallel_enabled(size_t num_threads) {
+    return ds_resolve_threads(num_threads) > 1 && ds_get_num_threads() > 1;
+}
+
+bool ds_in_task(void) {
+    return t_worker != NULL || t_region_depth > 0;
+}
+
+size_t ds_region_threads(size_t requested) {
+    return ds_in_task() ? 1 : ds_resolve_threads(requested);
+}
+
+size_t ds_thread_index(void) {
+    Worker *self = t_worker;
+    return (self != NULL) ? self->index : 0;
+}
+
+void ds_thread_pool_shutdown(void) {
+    pthread_mutex_lock(&pool_init_lock);
+    Pool *pool = atomic_load_explicit(&global_pool, memory_order_relaxed);
+    atomic_store_explicit(&global_pool, NULL, memory_order_release);
+    if (pool != NULL) pool_destroy(pool, pool->num_workers);
+    pthread_mutex_unlock(&pool_init_lock);
+}
+
+void ds_task_group_init(DSTaskGroup *group) {
+    if (group != NULL) atomic_init(&group->pending, 0);
+}
+
+void ds_task_spawn(DSTaskGroup *group, DSTaskFn fn, void *arg) {
+    if (group == NULL || fn == NULL) return;
+
+    Pool *pool = get_pool();
+    DSTask *task = (pool != NULL) ? malloc(sizeof(DSTask)) : NULL;
+    if (task == NULL) {
+        fn(arg);
+        return;
+    }
+    task->fn = fn;
+    task->arg = arg;
+    task->group = group;
+    atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+    if (!publish(pool, task)) {
+        free(task);
+        atomic_fetch_sub_explicit(&group->pending, 1, memory_order_relaxed);
+        fn(arg);
+    }
+}
+
+static void spawn_range(DSTaskGroup *group, DSRangeFn fn, void *ctx,
+                        size_t lo, size_t hi, size_t grain) {
+    Pool *pool = atomic_load_explicit(&global_pool, memory_order_acquire);
+    DSTask *task = (pool != NULL) ? malloc(sizeof(DSTask)) : NULL;
+    if (task != NULL) {
+        task->fn = NULL;
+        task->arg = ctx;
+        task->range_fn = fn;
+        task->lo = lo;
+        task->hi = hi;
+        task->grain = grain;
+        task->group = group;
+        atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+        if (publish(pool, task)) return;
+        free(task);
+        atomic_fetch_sub_explicit(&group->pending, 1, memory_order_relaxed);
+    }
+    run_range(group, fn, ctx, lo, hi, hi - lo);
+}
+
+void ds_task_wait(DSTaskGroup *group) {
+    if (group == NULL) return;
+
+    Pool *pool = atomic_load_explicit(&global_pool, memory_order_acquire);
+    Worker *self = t_worker;
+    uint64_t rng = (uint64_t)(uintptr_t)group | 1;
+    unsigned idle = 0;
+
+    t_region_depth++;
+    while (atomic_load_explicit(&group->pending, memory_order_acquire) > 0) {
+        DSTask *task = (pool != NULL) ? find_task(pool, self, &rng) : NULL;
+        if (task != NULL) {
+            run_task(task);
+            idle = 0;
+        } else if (++idle > POOL_SPIN_ROUNDS) {
+            sched_yield();
+        }
+    }
+    t_region_depth--;
+}
+
+void ds_parallel_invoke(DSTaskFn fa, void *arg_a, DSTaskFn fb, void *arg_b) {
+    DSTaskGroup group;
+    ds_task_group_init(&group);
+    t_region_depth++;
+    if (fb != NULL) ds_task_spawn(&group, fb, arg_b);
+    if (fa != NULL) fa(arg_a);
+    ds_task_wait(&group);
+    t_region_depth--;
+}
+
+void ds_parallel_for(size_t begin, size_t end, size_t grain, DSRangeFn fn, void *ctx) {
+    if (fn == NULL || begin >= end) return;
+
+    size_t n = end - begin;
+    Pool *pool = get_pool();
+    if (pool == NULL) {
+        t_region_depth++;
+        fn(ctx, begin, end);
+        t_region_depth--;
+        return;
+    }
+    if (grain == 0) {
+        grain = n / (pool->num_threads * POOL_CHUNKS_PER_THREAD);
+        if (grain == 0) grain = 1;
+    }
+
+    DSTaskGroup group;
+    ds_task_group_init(&group);
+    t_region_depth++;
+    run_range(&group, fn, ctx, begin, end, grain);
+    ds_task_wait(&group);
+    t_region_depth--;
+}
+
+void ds_parallel_for_threads(size_t num_threads, size_t begin, size_t end, size_t grain,
+                             DSRangeFn fn, void *ctx) {
+    if (fn == NULL || begin >= end) return;
+
+    size_t threads = ds_resolve_threads(num_threads);
+    if (!ds_parallel_enabled(threads)) {
+        fn(ctx, begin, end);
+        return;
+    }
+    if (threads < ds_get_num_threads()) {
+        size_t block = (end - begin + threads - 1) / threads;
+        if (grain < block) grain = block;
+    }
+    ds_parallel_for(begin, end, grain, fn, ctx);
+}
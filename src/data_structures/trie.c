@@ -17,7 +17,10 @@
  */
 
 #include "data_structures/trie.h"
+#include "data_structures/heap.h"
 
+#include <float.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -26,16 +29,21 @@
 // ESTRUTURAS INTERNAS
 // ============================================================================
 
+// children só é alocado com o primeiro filho: as folhas, a maioria dos
+// nós, não pagam alphabet_size ponteiros
 typedef struct TrieNode {
     struct TrieNode **children;
+    double score;               // pontuação da palavra (se is_end_of_word)
+    double best_score;          // maior pontuação na subárvore, -DBL_MAX se nenhuma
+    uint32_t alphabet_size;     // posições de children (0 enquanto NULL)
     bool is_end_of_word;
-    size_t alphabet_size;
 } TrieNode;
 
 struct Trie {
     TrieNode *root;
     size_t size;
     size_t alphabet_size;
+    DSAllocator allocator;
 };
 
 #define DEFAULT_ALPHABET_SIZE 26
@@ -44,34 +52,51 @@ struct Trie {
 // FUNÇÕES AUXILIARES PRIVADAS
 // ============================================================================
 
-static TrieNode* trie_node_create(size_t alphabet_size) {
-    TrieNode *node = (TrieNode *)malloc(sizeof(TrieNode));
+static TrieNode* trie_node_create(const DSAllocator *allocator) {
+    TrieNode *node = (TrieNode *)ds_alloc(allocator, sizeof(TrieNode));
     if (node == NULL) {
         return NULL;
     }
 
-    node->children = (TrieNode **)calloc(alphabet_size, sizeof(TrieNode *));
+    node->children = NULL;
+    node->alphabet_size = 0;
+    node->is_end_of_word = false;
+    node->score = 0.0;
+    node->best_score = -DBL_MAX;
+    return node;
+}
+
+static bool trie_node_reserve_children(const DSAllocator *allocator, TrieNode *node,
+                                       size_t alphabet_size) {
+    if (node->children != NULL) {
+        return true;
+    }
+    node->children = (TrieNode **)ds_calloc(allocator, alphabet_size, sizeof(TrieNode *));
     if (node->children == NULL) {
-        free(node);
-        return NULL;
+        return false;
     }
+    node->alphabet_size = (uint32_t)alphabet_size;
+    return true;
+}
 
-    node->is_end_of_word = false;
-    node->alphabet_size = alphabet_size;
-    return node;
+// Devolve o array de filhos de um nó que ficou sem filhos
+static void trie_node_release_children(const DSAllocator *allocator, TrieNode *node) {
+    ds_free(allocator, node->children, node->alphabet_size * sizeof(TrieNode *));
+    node->children = NULL;
+    node->alphabet_size = 0;
 }
 
-static void trie_node_destroy(TrieNode *node) {
+static void trie_node_destroy(const DSAllocator *allocator, TrieNode *node) {
     if (node == NULL) {
         return;
     }
 
     for (size_t i = 0; i < node->alphabet_size; i++) {
-        trie_node_destroy(node->children[i]);
+        trie_node_destroy(allocator, node->children[i]);
     }
 
-    free(node->children);
-    free(node);
+    ds_free(allocator, node->children, node->alphabet_size * sizeof(TrieNode *));
+    ds_free(allocator, node, sizeof(TrieNode));
 }
 
 static bool trie_node_has_children(const TrieNode *node) {
@@ -87,6 +112,25 @@ static size_t trie_char_index(char c) {
     return (size_t)(c - 'a');
 }
 
+// Recalcula best_score a partir da própria pontuação e da dos filhos
+static void trie_node_refresh_best(TrieNode *node) {
+    double best = node->is_end_of_word ? node->score : -DBL_MAX;
+    for (size_t i = 0; i < node->alphabet_size; i++) {
+        if (node->children[i] != NULL && node->children[i]->best_score > best) {
+            best = node->children[i]->best_score;
+        }
+    }
+    node->best_score = best;
+}
+
+// Recalcula best_score de baixo para cima no caminho de str
+static void trie_refresh_path(TrieNode *node, const char *str, size_t depth) {
+    if (str[depth] != '\0') {
+        trie_refresh_path(node->children[trie_char_index(str[depth])], str, depth + 1);
+    }
+    trie_node_refresh_best(node);
+}
+
 /**
  * Recursive removal returning true if caller should delete this node.
  *
@@ -95,8 +139,8 @@ static size_t trie_char_index(char c) {
  * 2. Unmark end_of_word
  * 3. On backtrack, delete nodes that have no children and are not end_of_word
  */
-static bool trie_remove_recursive(TrieNode *node, const char *str, size_t depth,
-                                  bool *found) {
+static bool trie_remove_recursive(Trie *trie, TrieNode *node, const char *str,
+                                  size_t depth, bool *found) {
     if (node == NULL) {
         return false;
     }
@@ -105,6 +149,7 @@ static bool trie_remove_recursive(TrieNode *node, const char *str, size_t depth,
         if (node->is_end_of_word) {
             node->is_end_of_word = false;
             *found = true;
+            trie_node_refresh_best(node);
         }
         return !trie_node_has_children(node);
     }
@@ -114,16 +159,21 @@ static bool trie_remove_recursive(TrieNode *node, const char *str, size_t depth,
         return false;
     }
 
-    bool should_delete = trie_remove_recursive(node->children[index], str,
+    bool should_delete = trie_remove_recursive(trie, node->children[index], str,
                                                depth + 1, found);
 
     if (should_delete) {
-        trie_node_destroy(node->children[index]);
+        trie_node_destroy(&trie->allocator, node->children[index]);
         node->children[index] = NULL;
-        return !node->is_end_of_word && !trie_node_has_children(node);
+        if (!trie_node_has_children(node)) {
+            trie_node_release_children(&trie->allocator, node);
+        }
+    }
+    if (*found) {
+        trie_node_refresh_best(node);
     }
 
-    return false;
+    return should_delete && !node->is_end_of_word && !trie_node_has_children(node);
 }
 
 static void trie_collect_words(const TrieNode *node, char *buffer, size_t depth,
@@ -185,18 +235,29 @@ static void trie_print_words(const TrieNode *node, char *buffer, size_t depth) {
 // ============================================================================
 
 Trie* trie_create(size_t alphabet_size) {
+    return trie_create_with_allocator(alphabet_size, NULL);
+}
+
+Trie* trie_create_with_allocator(size_t alphabet_size, const DSAllocator *allocator) {
     if (alphabet_size == 0) {
         alphabet_size = DEFAULT_ALPHABET_SIZE;
     }
+    if (alphabet_size > UINT32_MAX) {
+        return NULL;
+    }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
 
-    Trie *trie = (Trie *)malloc(sizeof(Trie));
+    Trie *trie = (Trie *)ds_alloc(allocator, sizeof(Trie));
     if (trie == NULL) {
         return NULL;
     }
 
-    trie->root = trie_node_create(alphabet_size);
+    trie->allocator = *allocator;
+    trie->root = trie_node_create(allocator);
     if (trie->root == NULL) {
-        free(trie);
+        ds_free(allocator, trie, sizeof(Trie));
         return NULL;
     }
 
@@ -210,15 +271,18 @@ void trie_destroy(Trie *trie) {
         return;
     }
 
-    trie_node_destroy(trie->root);
-    free(trie);
+    trie_node_destroy(&trie->allocator, trie->root);
+    DSAllocator allocator = trie->allocator;
+    ds_free(&allocator, trie, sizeof(Trie));
 }
 
 // ============================================================================
 // OPERAÇÕES PRINCIPAIS
 // ============================================================================
 
-DataStructureError trie_insert(Trie *trie, const char *str) {
+// replace = false mantém a pontuação de uma string já existente
+static DataStructureError trie_insert_scored(Trie *trie, const char *str, double score,
+                                             bool replace) {
     if (trie == NULL || str == NULL) {
         return DS_ERROR_NULL_POINTER;
     }
@@ -231,8 +295,11 @@ DataStructureError trie_insert(Trie *trie, const char *str) {
             return DS_ERROR_INVALID_PARAM;
         }
 
+        if (!trie_node_reserve_children(&trie->allocator, current, trie->alphabet_size)) {
+            return DS_ERROR_OUT_OF_MEMORY;
+        }
         if (current->children[index] == NULL) {
-            current->children[index] = trie_node_create(trie->alphabet_size);
+            current->children[index] = trie_node_create(&trie->allocator);
             if (current->children[index] == NULL) {
                 return DS_ERROR_OUT_OF_MEMORY;
             }
@@ -241,14 +308,45 @@ DataStructureError trie_insert(Trie *trie, const char *str) {
         current = current->children[index];
     }
 
+    if (current->is_end_of_word && !replace) {
+        return DS_SUCCESS;
+    }
+
+    bool decreased = current->is_end_of_word && score < current->score;
     if (!current->is_end_of_word) {
         current->is_end_of_word = true;
         trie->size++;
     }
+    current->score = score;
+
+    if (decreased) {
+        trie_refresh_path(trie->root, str, 0);
+        return DS_SUCCESS;
+    }
+
+    // Pontuação nova ou maior: basta elevar o máximo ao longo do caminho
+    current = trie->root;
+    for (size_t i = 0;; i++) {
+        if (score > current->best_score) {
+            current->best_score = score;
+        }
+        if (str[i] == '\0') {
+            break;
+        }
+        current = current->children[trie_char_index(str[i])];
+    }
 
     return DS_SUCCESS;
 }
 
+DataStructureError trie_insert(Trie *trie, const char *str) {
+    return trie_insert_scored(trie, str, 0.0, false);
+}
+
+DataStructureError trie_insert_weighted(Trie *trie, const char *str, double score) {
+    return trie_insert_scored(trie, str, score, true);
+}
+
 bool trie_search(const Trie *trie, const char *str) {
     if (trie == NULL || str == NULL) {
         return false;
@@ -258,7 +356,7 @@ bool trie_search(const Trie *trie, const char *str) {
 
     for (size_t i = 0; str[i] != '\0'; i++) {
         size_t index = trie_char_index(str[i]);
-        if (index >= trie->alphabet_size || current->children[index] == NULL) {
+        if (index >= current->alphabet_size || current->children[index] == NULL) {
             return false;
         }
         current = current->children[index];
@@ -276,7 +374,7 @@ bool trie_starts_with(const Trie *trie, const char *prefix) {
 
     for (size_t i = 0; prefix[i] != '\0'; i++) {
         size_t index = trie_char_index(prefix[i]);
-        if (index >= trie->alphabet_size || current->children[index] == NULL) {
+        if (index >= current->alphabet_size || current->children[index] == NULL) {
             return false;
         }
         current = current->children[index];
@@ -291,7 +389,7 @@ DataStructureError trie_remove(Trie *trie, const char *str) {
     }
 
     bool found = false;
-    trie_remove_recursive(trie->root, str, 0, &found);
+    trie_remove_recursive(trie, trie->root, str, 0, &found);
 
     if (!found) {
         return DS_ERROR_NOT_FOUND;
@@ -317,7 +415,7 @@ DataStructureError trie_autocomplete(const Trie *trie, const char *prefix,
     const TrieNode *current = trie->root;
     for (size_t i = 0; prefix[i] != '\0'; i++) {
         size_t index = trie_char_index(prefix[i]);
-        if (index >= trie->alphabet_size || current->children[index] == NULL) {
+        if (index >= current->alphabet_size || current->children[index] == NULL) {
             return DS_SUCCESS;
         }
         current = current->children[index];
@@ -378,6 +476,205 @@ char* trie_longest_common_prefix(const Trie *trie) {
     return result;
 }
 
+// ============================================================================
+// PONTUAÇÕES E AUTOCOMPLETE TOP-K
+// ============================================================================
+
+// Nó visitado pela busca top-k; parent/c reconstroem a string sem copiá-la
+typedef struct {
+    const TrieNode *node;
+    size_t parent;
+    size_t depth;
+    char c;
+} TopKEntry;
+
+typedef struct {
+    TopKEntry *entries;
+    size_t count;
+    size_t capacity;
+} TopKEntries;
+
+// Elemento do heap: um nó (chave = best_score) ou uma palavra (chave = score)
+typedef struct {
+    double key;
+    size_t entry;
+    bool word;
+    const TopKEntries *entries;  // o array cresce durante a busca
+} TopKItem;
+
+// Ordem lexicográfica das strings de duas entradas, subindo até o ancestral comum
+static int topk_entry_order(const TopKEntry *entries, size_t a, size_t b) {
+    int prefix_order = 0;
+    while (entries[a].depth > entries[b].depth) {
+        a = entries[a].parent;
+        prefix_order = 1;
+    }
+    while (entries[b].depth > entries[a].depth) {
+        b = entries[b].parent;
+        prefix_order = -1;
+    }
+    if (a == b) {
+        return prefix_order;
+    }
+    while (entries[a].parent != entries[b].parent) {
+        a = entries[a].parent;
+        b = entries[b].parent;
+    }
+    return (unsigned char)entries[a].c < (unsigned char)entries[b].c ? -1 : 1;
+}
+
+/*
+ * Empates de chave saem em ordem lexicográfica. Um nó pendente com a mesma
+ * chave de uma palavra só passa à frente dela se sua string for menor, e
+ * então todas as palavras dele também são menores.
+ */
+static int topk_item_compare(const void *a, const void *b) {
+    const TopKItem *x = (const TopKItem *)a;
+    const TopKItem *y = (const TopKItem *)b;
+    if (x->key != y->key) {
+        return x->key < y->key ? -1 : 1;
+    }
+    return -topk_entry_order(x->entries->entries, x->entry, y->entry);
+}
+
+static const TrieNode* trie_find_node(const Trie *trie, const char *prefix) {
+    const TrieNode *current = trie->root;
+    for (size_t i = 0; prefix[i] != '\0'; i++) {
+        size_t index = trie_char_index(prefix[i]);
+        if (index >= current->alphabet_size || current->children[index] == NULL) {
+            return NULL;
+        }
+        current = current->children[index];
+    }
+    return current;
+}
+
+static char* topk_build_string(const TopKEntry *entries, size_t entry,
+                               const char *prefix, size_t prefix_len) {
+    size_t depth = entries[entry].depth;
+    char *str = (char *)malloc(prefix_len + depth + 1);
+    if (str == NULL) {
+        return NULL;
+    }
+    memcpy(str, prefix, prefix_len);
+    str[prefix_len + depth] = '\0';
+    for (size_t e = entry; e != 0; e = entries[e].parent) {
+        str[prefix_len + --depth] = entries[e].c;
+    }
+    return str;
+}
+
+DataStructureError trie_get_score(const Trie *trie, const char *str, double *score) {
+    if (trie == NULL || str == NULL || score == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    const TrieNode *node = trie_find_node(trie, str);
+    if (node == NULL || !node->is_end_of_word) {
+        return DS_ERROR_NOT_FOUND;
+    }
+
+    *score = node->score;
+    return DS_SUCCESS;
+}
+
+DataStructureError trie_autocomplete_topk(const Trie *trie, const char *prefix, size_t k,
+                                          char ***results, double *scores, size_t *count) {
+    if (trie == NULL || prefix == NULL || results == NULL || count == NULL) {
+        return DS_ERROR_NULL_POINTER;
+    }
+
+    *results = NULL;
+    *count = 0;
+
+    const TrieNode *start = trie_find_node(trie, prefix);
+    if (k == 0 || start == NULL || start->best_score == -DBL_MAX) {
+        return DS_SUCCESS;
+    }
+    if (k > trie->size) {
+        k = trie->size;
+    }
+
+    size_t prefix_len = strlen(prefix);
+    TopKEntries entries = {(TopKEntry *)malloc(64 * sizeof(TopKEntry)), 1, 64};
+    char **found = (char **)malloc(k * sizeof(char *));
+    Heap *heap = heap_create(sizeof(TopKItem), 64, HEAP_MAX, topk_item_compare, NULL);
+    DataStructureError status = DS_SUCCESS;
+
+    if (entries.entries == NULL || found == NULL || heap == NULL) {
+        status = DS_ERROR_OUT_OF_MEMORY;
+    } else {
+        entries.entries[0] = (TopKEntry){start, 0, 0, '\0'};
+        TopKItem root_item = {start->best_score, 0, false, &entries};
+        status = heap_insert(heap, &root_item);
+    }
+
+    size_t n = 0;
+    while (status == DS_SUCCESS && n < k && !heap_is_empty(heap)) {
+        TopKItem item;
+        heap_extract(heap, &item);
+
+        if (item.word) {
+            found[n] = topk_build_string(entries.entries, item.entry, prefix, prefix_len);
+            if (found[n] == NULL) {
+                status = DS_ERROR_OUT_OF_MEMORY;
+                break;
+            }
+            if (scores != NULL) {
+                scores[n] = item.key;
+            }
+            n++;
+            continue;
+        }
+
+        const TrieNode *node = entries.entries[item.entry].node;
+        size_t depth = entries.entries[item.entry].depth;
+        for (size_t i = 0; i < node->alphabet_size && status == DS_SUCCESS; i++) {
+            const TrieNode *child = node->children[i];
+            if (child == NULL || child->best_score == -DBL_MAX) {
+                continue;
+            }
+            if (entries.count == entries.capacity) {
+                TopKEntry *grown = (TopKEntry *)realloc(entries.entries,
+                                                        2 * entries.capacity * sizeof(TopKEntry));
+                if (grown == NULL) {
+                    status = DS_ERROR_OUT_OF_MEMORY;
+                    break;
+                }
+                entries.entries = grown;
+                entries.capacity *= 2;
+            }
+            entries.entries[entries.count] = (TopKEntry){child, item.entry, depth + 1,
+                                                         (char)('a' + i)};
+            TopKItem child_item = {child->best_score, entries.count++, false, &entries};
+            status = heap_insert(heap, &child_item);
+        }
+        if (status == DS_SUCCESS && node->is_end_of_word) {
+            TopKItem word_item = {node->score, item.entry, true, &entries};
+            status = heap_insert(heap, &word_item);
+        }
+    }
+
+    heap_destroy(heap);
+    free(entries.entries);
+
+    if (status != DS_SUCCESS) {
+        for (size_t i = 0; i < n; i++) {
+            free(found[i]);
+        }
+        free(found);
+        return status;
+    }
+
+    if (n == 0) {
+        free(found);
+        found = NULL;
+    }
+    *results = found;
+    *count = n;
+    return DS_SUCCESS;
+}
+
 // ============================================================================
 // CONSULTAS
 // ============================================================================
@@ -393,13 +690,32 @@ bool trie_is_empty(const Trie *trie) {
     return (trie == NULL || trie->size == 0);
 }
 
+static size_t trie_node_memory(const TrieNode *node) {
+    if (node == NULL) {
+        return 0;
+    }
+
+    size_t bytes = sizeof(TrieNode) + node->alphabet_size * sizeof(TrieNode *);
+    for (size_t i = 0; i < node->alphabet_size; i++) {
+        bytes += trie_node_memory(node->children[i]);
+    }
+    return bytes;
+}
+
+size_t trie_memory_usage(const Trie *trie) {
+    if (trie == NULL) {
+        return 0;
+    }
+    return sizeof(Trie) + trie_node_memory(trie->root);
+}
+
 void trie_clear(Trie *trie) {
     if (trie == NULL) {
         return;
     }
 
-    trie_node_destroy(trie->root);
-    trie->root = trie_node_create(trie->alphabet_size);
+    trie_node_destroy(&trie->allocator, trie->root);
+    trie->root = trie_node_create(&trie->allocator);
     trie->size = 0;
 }
 
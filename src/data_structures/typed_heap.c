@@ -0,0 +1,12 @@
+/**
+ * @file typed_heap.c
+ * @brief Instâncias de int_min_heap e double_min_heap (typed_heap.h)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/typed_heap.h"
+
+TYPED_HEAP_DEFINE(int_min, int, TYPED_HEAP_DEFAULT_ARITY, TYPED_HEAP_LESS)
+TYPED_HEAP_DEFINE(double_min, double, TYPED_HEAP_DEFAULT_ARITY, TYPED_HEAP_LESS)
@@ -23,6 +23,8 @@
 
 #include "data_structures/union_find.h"
 
+#include <stdatomic.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -31,12 +33,14 @@
 // ESTRUTURA INTERNA
 // ============================================================================
 
+// rank <= log2(n) cabe num byte; parent e set_size são ds_index_t
 struct UnionFind {
-    size_t *parent;
-    size_t *rank;
-    size_t *set_size;
+    ds_index_t *parent;
+    uint8_t *rank;
+    ds_index_t *set_size;
     size_t num_elements;
     size_t num_sets;
+    DSAllocator allocator;
 };
 
 // ============================================================================
@@ -44,30 +48,38 @@ struct UnionFind {
 // ============================================================================
 
 UnionFind* uf_create(size_t n) {
-    if (n == 0) {
+    return uf_create_with_allocator(n, NULL);
+}
+
+UnionFind* uf_create_with_allocator(size_t n, const DSAllocator *allocator) {
+    if (n == 0 || n > DS_INDEX_MAX) {
         return NULL;
     }
+    if (allocator == NULL) {
+        allocator = ds_default_allocator();
+    }
 
-    UnionFind *uf = (UnionFind *)malloc(sizeof(UnionFind));
+    UnionFind *uf = (UnionFind *)ds_alloc(allocator, sizeof(UnionFind));
     if (uf == NULL) {
         return NULL;
     }
 
-    uf->parent = (size_t *)malloc(n * sizeof(size_t));
-    uf->rank = (size_t *)malloc(n * sizeof(size_t));
-    uf->set_size = (size_t *)malloc(n * sizeof(size_t));
+    uf->allocator = *allocator;
+    uf->parent = (ds_index_t *)ds_alloc(allocator, n * sizeof(ds_index_t));
+    uf->rank = (uint8_t *)ds_alloc(allocator, n * sizeof(uint8_t));
+    uf->set_size = (ds_index_t *)ds_alloc(allocator, n * sizeof(ds_index_t));
 
     if (uf->parent == NULL || uf->rank == NULL || uf->set_size == NULL) {
-        free(uf->parent);
-        free(uf->rank);
-        free(uf->set_size);
-        free(uf);
+        ds_free(allocator, uf->parent, n * sizeof(ds_index_t));
+        ds_free(allocator, uf->rank, n * sizeof(uint8_t));
+        ds_free(allocator, uf->set_size, n * sizeof(ds_index_t));
+        ds_free(allocator, uf, sizeof(UnionFind));
         return NULL;
     }
 
     /* MAKE-SET(x): x.p = x, x.rank = 0 (Cormen et al., 2009, p. 562) */
     for (size_t i = 0; i < n; i++) {
-        uf->parent[i] = i;
+        uf->parent[i] = (ds_index_t)i;
         uf->rank[i] = 0;
         uf->set_size[i] = 1;
     }
@@ -82,10 +94,12 @@ void uf_destroy(UnionFind *uf) {
         return;
     }
 
-    free(uf->parent);
-    free(uf->rank);
-    free(uf->set_size);
-    free(uf);
+    DSAllocator allocator = uf->allocator;
+    size_t n = uf->num_elements;
+    ds_free(&allocator, uf->parent, n * sizeof(ds_index_t));
+    ds_free(&allocator, uf->rank, n * sizeof(uint8_t));
+    ds_free(&allocator, uf->set_size, n * sizeof(ds_index_t));
+    ds_free(&allocator, uf, sizeof(UnionFind));
 }
 
 // ============================================================================
@@ -140,13 +154,13 @@ bool uf_union(UnionFind *uf, size_t x, size_t y) {
     }
 
     if (uf->rank[root_x] > uf->rank[root_y]) {
-        uf->parent[root_y] = root_x;
+        uf->parent[root_y] = (ds_index_t)root_x;
         uf->set_size[root_x] += uf->set_size[root_y];
     } else if (uf->rank[root_x] < uf->rank[root_y]) {
-        uf->parent[root_x] = root_y;
+        uf->parent[root_x] = (ds_index_t)root_y;
         uf->set_size[root_y] += uf->set_size[root_x];
     } else {
-        uf->parent[root_y] = root_x;
+        uf->parent[root_y] = (ds_index_t)root_x;
         uf->set_size[root_x] += uf->set_size[root_y];
         uf->rank[root_x]++;
     }
@@ -229,6 +243,179 @@ size_t* uf_get_components(UnionFind *uf) {
     return components;
 }
 
+size_t uf_memory_usage(const UnionFind *uf) {
+    if (uf == NULL) {
+        return 0;
+    }
+    return sizeof(UnionFind) +
+           uf->num_elements * (2 * sizeof(ds_index_t) + sizeof(uint8_t));
+}
+
+// ============================================================================
+// UNION-FIND CONCORRENTE
+// ============================================================================
+
+/** Bits baixos da palavra de cada elemento que guardam o pai */
+#define CUF_PARENT_BITS 58
+#define CUF_PARENT_MASK ((UINT64_C(1) << CUF_PARENT_BITS) - 1)
+#define CUF_RANK_MAX ((UINT64_C(1) << (64 - CUF_PARENT_BITS)) - 1)
+
+struct ConcurrentUnionFind {
+    _Atomic uint64_t *node;     // (rank << CUF_PARENT_BITS) | pai
+    size_t num_elements;
+    atomic_size_t num_sets;
+};
+
+static inline size_t cuf_parent(uint64_t word) {
+    return (size_t)(word & CUF_PARENT_MASK);
+}
+
+static inline uint64_t cuf_rank(uint64_t word) {
+    return word >> CUF_PARENT_BITS;
+}
+
+static inline uint64_t cuf_word(size_t parent, uint64_t rank) {
+    return (rank << CUF_PARENT_BITS) | (uint64_t)parent;
+}
+
+ConcurrentUnionFind* cuf_create(size_t n) {
+    if (n == 0 || (uint64_t)n > CUF_PARENT_MASK) {
+        return NULL;
+    }
+
+    ConcurrentUnionFind *uf = (ConcurrentUnionFind *)malloc(sizeof(ConcurrentUnionFind));
+    if (uf == NULL) {
+        return NULL;
+    }
+    uf->node = (_Atomic uint64_t *)malloc(n * sizeof(_Atomic uint64_t));
+    if (uf->node == NULL) {
+        free(uf);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        atomic_init(&uf->node[i], cuf_word(i, 0));
+    }
+    uf->num_elements = n;
+    atomic_init(&uf->num_sets, n);
+    return uf;
+}
+
+void cuf_destroy(ConcurrentUnionFind *uf) {
+    if (uf == NULL) {
+        return;
+    }
+    free((void *)uf->node);
+    free(uf);
+}
+
+/**
+ * Path splitting: x.p = x.p.p por CAS e avanca para o pai antigo.
+ * O rank de um no que nao e raiz nunca muda, entao a palavra nova preserva
+ * os bits de rank lidos; se o CAS falhar, outro find ja encurtou o caminho.
+ */
+size_t cuf_find(ConcurrentUnionFind *uf, size_t x) {
+    if (uf == NULL || x >= uf->num_elements) {
+        return x;
+    }
+
+    for (;;) {
+        uint64_t word = atomic_load_explicit(&uf->node[x], memory_order_acquire);
+        size_t parent = cuf_parent(word);
+        if (parent == x) {
+            return x;
+        }
+        size_t grandparent = cuf_parent(atomic_load_explicit(&uf->node[parent], memory_order_acquire));
+        if (grandparent != parent) {
+            atomic_compare_exchange_weak_explicit(&uf->node[x], &word,
+                                                  cuf_word(grandparent, cuf_rank(word)),
+                                                  memory_order_acq_rel, memory_order_relaxed);
+        }
+        x = parent;
+    }
+}
+
+/**
+ * LINK por (rank, indice): a raiz menor nessa ordem passa a apontar para a
+ * maior. O CAS exige que a raiz menor siga raiz e com o rank que foi
+ * comparado; se falhar (outra thread a ligou ou subiu seu rank), recomeca
+ * dos finds.
+ */
+bool cuf_union(ConcurrentUnionFind *uf, size_t x, size_t y) {
+    if (uf == NULL || x >= uf->num_elements || y >= uf->num_elements) {
+        return false;
+    }
+
+    for (;;) {
+        size_t root_x = cuf_find(uf, x);
+        size_t root_y = cuf_find(uf, y);
+        if (root_x == root_y) {
+            return false;
+        }
+
+        uint64_t word_x = atomic_load_explicit(&uf->node[root_x], memory_order_acquire);
+        uint64_t word_y = atomic_load_explicit(&uf->node[root_y], memory_order_acquire);
+        if (cuf_parent(word_x) != root_x || cuf_parent(word_y) != root_y) {
+            continue;
+        }
+
+        uint64_t rank_x = cuf_rank(word_x);
+        uint64_t rank_y = cuf_rank(word_y);
+        bool x_below = rank_x < rank_y || (rank_x == rank_y && root_x < root_y);
+        size_t child = x_below ? root_x : root_y;
+        size_t root = x_below ? root_y : root_x;
+        uint64_t child_word = x_below ? word_x : word_y;
+        uint64_t root_word = x_below ? word_y : word_x;
+
+        if (!atomic_compare_exchange_strong_explicit(&uf->node[child], &child_word,
+                                                     cuf_word(root, cuf_rank(child_word)),
+                                                     memory_order_acq_rel, memory_order_relaxed)) {
+            continue;
+        }
+
+        if (rank_x == rank_y && rank_x < CUF_RANK_MAX) {
+            atomic_compare_exchange_strong_explicit(&uf->node[root], &root_word,
+                                                    cuf_word(root, rank_x + 1),
+                                                    memory_order_acq_rel, memory_order_relaxed);
+        }
+        atomic_fetch_sub_explicit(&uf->num_sets, 1, memory_order_relaxed);
+        return true;
+    }
+}
+
+bool cuf_connected(ConcurrentUnionFind *uf, size_t x, size_t y) {
+    if (uf == NULL || x >= uf->num_elements || y >= uf->num_elements) {
+        return false;
+    }
+
+    for (;;) {
+        size_t root_x = cuf_find(uf, x);
+        size_t root_y = cuf_find(uf, y);
+        if (root_x == root_y) {
+            return true;
+        }
+        // root_x ainda raiz depois de achar root_y: havia duas raizes distintas
+        uint64_t word = atomic_load_explicit(&uf->node[root_x], memory_order_acquire);
+        if (cuf_parent(word) == root_x) {
+            return false;
+        }
+    }
+}
+
+size_t cuf_count(const ConcurrentUnionFind *uf) {
+    if (uf == NULL) {
+        return 0;
+    }
+    return atomic_load_explicit(&uf->num_sets, memory_order_relaxed);
+}
+
+size_t cuf_memory_usage(const ConcurrentUnionFind *uf) {
+    if (uf == NULL) {
+        return 0;
+    }
+    return sizeof(ConcurrentUnionFind) + uf->num_elements * sizeof(uint64_t);
+}
+
 // ============================================================================
 // UTILITÁRIOS
 // ============================================================================
@@ -259,15 +446,15 @@ void uf_print(const UnionFind *uf) {
     }
     printf("\n  Parent: ");
     for (size_t i = 0; i < uf->num_elements; i++) {
-        printf("%3zu ", uf->parent[i]);
+        printf("%3zu ", (size_t)uf->parent[i]);
     }
     printf("\n  Rank:   ");
     for (size_t i = 0; i < uf->num_elements; i++) {
-        printf("%3zu ", uf->rank[i]);
+        printf("%3zu ", (size_t)uf->rank[i]);
     }
     printf("\n  Size:   ");
     for (size_t i = 0; i < uf->num_elements; i++) {
-        printf("%3zu ", uf->set_size[i]);
+        printf("%3zu ", (size_t)uf->set_size[i]);
     }
     printf("\n");
 }
@@ -0,0 +1,258 @@
+/**
+ * @file anytime.c
+ * @brief Implementacao do modo servico (thread de fundo + melhor publicado)
+ *
+ * A melhor solucao, sua versao e o estado de termino ficam sob um mutex;
+ * uma variavel de condicao acorda quem espera a cada melhoria e no fim da
+ * execucao. O custo da melhor tambem fica num atomico lido sem lock, entao
+ * a avaliacao que nao melhora (o caso comum) nao disputa o mutex.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+// pthread_create/pthread_cond_timedwait e clock_gettime (POSIX) com
+// CMAKE_C_EXTENSIONS OFF
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "optimization/anytime.h"
+#include <float.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+struct OptAnytime {
+    OptAnytimeConfig config;
+    OptAnytimeSolveFn solve;
+    void *user_data;
+    double start_ms;
+
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;         // nova melhoria ou fim da execucao
+
+    atomic_bool cancel;
+    atomic_size_t evaluations;
+    _Atomic double best_cost;       // leitura sem lock no caminho comum
+
+    void *best;                     // sob lock
+    uint64_t version;
+    double best_elapsed_ms;
+    bool finished;
+    bool joined;
+    bool result_taken;
+    OptResult result;
+};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static bool anytime_better(const OptAnytime *s, double a, double b) {
+    return (s->config.direction == OPT_MINIMIZE) ? (a < b) : (a > b);
+}
+
+static void* anytime_main(void *arg) {
+    OptAnytime *s = arg;
+    OptResult result = s->solve(s, s->user_data);
+
+    pthread_mutex_lock(&s->lock);
+    s->result = result;
+    s->finished = true;
+    pthread_cond_broadcast(&s->changed);
+    pthread_mutex_unlock(&s->lock);
+    return NULL;
+}
+
+// Prazo absoluto no relogio de pthread_cond_timedwait (CLOCK_REALTIME)
+static struct timespec deadline_after(double timeout_ms) {
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    double ns = (double)ts.tv_nsec + timeout_ms * 1e6;
+    time_t extra = (time_t)(ns / 1e9);
+    ts.tv_sec += extra;
+    ts.tv_nsec = (long)(ns - (double)extra * 1e9);
+    if (ts.tv_nsec >= 1000000000L) {
+        ts.tv_sec++;
+        ts.tv_nsec -= 1000000000L;
+    }
+    return ts;
+}
+
+// ============================================================================
+// CONFIGURACAO
+// ============================================================================
+
+OptAnytimeConfig opt_anytime_default_config(size_t data_size, ObjectiveFn objective,
+                                            const void *context) {
+    OptAnytimeConfig config;
+    config.data_size = data_size;
+    config.objective = objective;
+    config.context = context;
+    config.direction = OPT_MINIMIZE;
+    config.on_improvement = NULL;
+    config.user_data = NULL;
+    return config;
+}
+
+// ============================================================================
+// CICLO DE VIDA
+// ============================================================================
+
+OptAnytime* opt_anytime_start(const OptAnytimeConfig *config, OptAnytimeSolveFn solve,
+                              void *user_data) {
+    if (config == NULL || solve == NULL || config->data_size == 0) return NULL;
+
+    OptAnytime *s = calloc(1, sizeof(OptAnytime));
+    if (s == NULL) return NULL;
+    s->best = malloc(config->data_size);
+    if (s->best == NULL) {
+        free(s);
+        return NULL;
+    }
+    if (pthread_mutex_init(&s->lock, NULL) != 0) {
+        free(s->best);
+        free(s);
+        return NULL;
+    }
+    if (pthread_cond_init(&s->changed, NULL) != 0) {
+        pthread_mutex_destroy(&s->lock);
+        free(s->best);
+        free(s);
+        return NULL;
+    }
+
+    s->config = *config;
+    s->solve = solve;
+    s->user_data = user_data;
+    atomic_init(&s->cancel, false);
+    atomic_init(&s->evaluations, 0);
+    atomic_init(&s->best_cost, (config->direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX);
+    s->start_ms = opt_monotonic_time_ms();
+
+    if (pthread_create(&s->thread, NULL, anytime_main, s) != 0) {
+        pthread_cond_destroy(&s->changed);
+        pthread_mutex_destroy(&s->lock);
+        free(s->best);
+        free(s);
+        return NULL;
+    }
+    return s;
+}
+
+void opt_anytime_stop(OptAnytime *solver) {
+    if (solver != NULL) atomic_store(&solver->cancel, true);
+}
+
+OptResult opt_anytime_join(OptAnytime *solver) {
+    OptResult empty = {0};
+    if (solver == NULL) return empty;
+
+    if (!solver->joined) {
+        pthread_join(solver->thread, NULL);
+        solver->joined = true;
+    }
+    if (solver->result_taken) return empty;
+    solver->result_taken = true;
+    return solver->result;
+}
+
+void opt_anytime_destroy(OptAnytime *solver) {
+    if (solver == NULL) return;
+    opt_anytime_stop(solver);
+    OptResult result = opt_anytime_join(solver);
+    opt_result_destroy(&result);
+
+    pthread_cond_destroy(&solver->changed);
+    pthread_mutex_destroy(&solver->lock);
+    free(solver->best);
+    free(solver);
+}
+
+// ============================================================================
+// CONSULTA
+// ============================================================================
+
+bool opt_anytime_poll(OptAnytime *solver, void *best, OptAnytimeStatus *status) {
+    if (solver == NULL) return false;
+
+    pthread_mutex_lock(&solver->lock);
+    bool have = solver->version > 0;
+    if (have && best != NULL) memcpy(best, solver->best, solver->config.data_size);
+    if (status != NULL) {
+        status->version = solver->version;
+        status->cost = atomic_load(&solver->best_cost);
+        status->evaluations = atomic_load(&solver->evaluations);
+        status->best_elapsed_ms = solver->best_elapsed_ms;
+        status->finished = solver->finished;
+    }
+    pthread_mutex_unlock(&solver->lock);
+    return have;
+}
+
+bool opt_anytime_wait(OptAnytime *solver, uint64_t version, double timeout_ms) {
+    if (solver == NULL) return false;
+
+    struct timespec deadline = {0, 0};
+    if (timeout_ms >= 0.0) deadline = deadline_after(timeout_ms);
+
+    pthread_mutex_lock(&solver->lock);
+    while (solver->version <= version && !solver->finished) {
+        if (timeout_ms < 0.0) {
+            pthread_cond_wait(&solver->changed, &solver->lock);
+        } else if (pthread_cond_timedwait(&solver->changed, &solver->lock, &deadline) != 0) {
+            break;
+        }
+    }
+    bool newer = solver->version > version;
+    pthread_mutex_unlock(&solver->lock);
+    return newer;
+}
+
+// ============================================================================
+// INTEGRACAO COM OS ALGORITMOS
+// ============================================================================
+
+bool opt_anytime_offer(OptAnytime *solver, const void *solution, double cost) {
+    size_t evaluations = atomic_fetch_add(&solver->evaluations, 1) + 1;
+
+    // Filtro sem lock: a maioria das avaliacoes nao melhora
+    if (!anytime_better(solver, cost, atomic_load_explicit(&solver->best_cost,
+                                                           memory_order_relaxed))) {
+        return false;
+    }
+
+    pthread_mutex_lock(&solver->lock);
+    bool improved = anytime_better(solver, cost, atomic_load(&solver->best_cost));
+    if (improved) {
+        memcpy(solver->best, solution, solver->config.data_size);
+        atomic_store(&solver->best_cost, cost);
+        solver->version++;
+        solver->best_elapsed_ms = opt_monotonic_time_ms() - solver->start_ms;
+        if (solver->config.on_improvement != NULL) {
+            solver->config.on_improvement(solver->best, cost, evaluations,
+                                          solver->best_elapsed_ms, solver->config.user_data);
+        }
+        pthread_cond_broadcast(&solver->changed);
+    }
+    pthread_mutex_unlock(&solver->lock);
+    return improved;
+}
+
+double opt_anytime_objective(const void *solution, size_t size, const void *context) {
+    OptAnytime *solver = (OptAnytime*)context;
+    double cost = solver->config.objective(solution, size, solver->config.context);
+    opt_anytime_offer(solver, solution, cost);
+    return cost;
+}
+
+const atomic_bool* opt_anytime_cancel_flag(OptAnytime *solver) {
+    return &solver->cancel;
+}
+
+bool opt_anytime_stop_requested(const OptAnytime *solver) {
+    return atomic_load(&solver->cancel);
+}
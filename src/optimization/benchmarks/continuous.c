@@ -71,10 +71,10 @@ void continuous_instance_destroy(ContinuousInstance *inst) {
 }
 
 // ============================================================================
-// FUNCOES OBJETIVO
+// FUNCOES OBJETIVO (REFERENCIA ESCALAR)
 // ============================================================================
 
-double continuous_sphere(const double *x, size_t d) {
+static double scalar_sphere(const double *x, size_t d) {
     double sum = 0.0;
     for (size_t i = 0; i < d; i++) {
         sum += x[i] * x[i];
@@ -82,7 +82,7 @@ double continuous_sphere(const double *x, size_t d) {
     return sum;
 }
 
-double continuous_rastrigin(const double *x, size_t d) {
+static double scalar_rastrigin(const double *x, size_t d) {
     double sum = 10.0 * (double)d;
     for (size_t i = 0; i < d; i++) {
         sum += x[i] * x[i] - 10.0 * cos(2.0 * M_PI * x[i]);
@@ -90,7 +90,9 @@ double continuous_rastrigin(const double *x, size_t d) {
     return sum;
 }
 
-double continuous_rosenbrock(const double *x, size_t d) {
+static double scalar_rosenbrock(const double *x, size_t d) {
+    if (d < 2) return 0.0;
+
     double sum = 0.0;
     for (size_t i = 0; i < d - 1; i++) {
         double t1 = x[i + 1] - x[i] * x[i];
@@ -100,7 +102,7 @@ double continuous_rosenbrock(const double *x, size_t d) {
     return sum;
 }
 
-double continuous_ackley(const double *x, size_t d) {
+static double scalar_ackley(const double *x, size_t d) {
     double sum_sq = 0.0;
     double sum_cos = 0.0;
     for (size_t i = 0; i < d; i++) {
@@ -114,7 +116,7 @@ double continuous_ackley(const double *x, size_t d) {
            + 20.0 + M_E;
 }
 
-double continuous_schwefel(const double *x, size_t d) {
+static double scalar_schwefel(const double *x, size_t d) {
     double sum = 0.0;
     for (size_t i = 0; i < d; i++) {
         sum += x[i] * sin(sqrt(fabs(x[i])));
@@ -122,22 +124,291 @@ double continuous_schwefel(const double *x, size_t d) {
     return 418.9829 * (double)d - sum;
 }
 
+// ============================================================================
+// KERNELS SIMD E DESPACHO EM RUNTIME
+// ============================================================================
+
+typedef double (*ContinuousKernelFn)(const double *x, size_t d);
+
+typedef struct {
+    ContinuousKernelFn sphere;
+    ContinuousKernelFn rastrigin;
+    ContinuousKernelFn rosenbrock;
+    ContinuousKernelFn ackley;
+    ContinuousKernelFn schwefel;
+} ContinuousKernels;
+
+static const ContinuousKernels kernels_scalar = {
+    scalar_sphere, scalar_rastrigin, scalar_rosenbrock, scalar_ackley, scalar_schwefel
+};
+
+// Defina CONTINUOUS_NO_SIMD para compilar apenas a referencia escalar.
+// x86: AVX2/AVX-512 via atributo target, escolhidos por __builtin_cpu_supports
+// (o binario roda em qualquer x86-64). AArch64: NEON faz parte da base.
+#if !defined(CONTINUOUS_NO_SIMD) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define CONTINUOUS_USE_X86 1
+#include <immintrin.h>
+#elif !defined(CONTINUOUS_NO_SIMD) && defined(__aarch64__) && defined(__ARM_NEON)
+#define CONTINUOUS_USE_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(CONTINUOUS_USE_X86) || defined(CONTINUOUS_USE_NEON)
+
+// Abaixo deste limite a reducao de Cody-Waite e exata o bastante; acima
+// (|2*pi*x| > 1e6, fora de todos os dominios padrao) usa a libm
+#define SIMD_TRIG_MAX 1e6
+
+#define INV_PI     0.31830988618379067154
+#define PI_PART_A  3.14159265358979311600e+00
+#define PI_PART_B  1.22464679914735320717e-16
+#define PI_PART_C -2.99476980971833966743e-33
+
+// Coeficientes de Taylor de sin: (-1)^k / (2k+1)!
+#define SIN_C3  (-1.0 / 6.0)
+#define SIN_C5  ( 1.0 / 120.0)
+#define SIN_C7  (-1.0 / 5040.0)
+#define SIN_C9  ( 1.0 / 362880.0)
+#define SIN_C11 (-1.0 / 39916800.0)
+#define SIN_C13 ( 1.0 / 6227020800.0)
+#define SIN_C15 (-1.0 / 1307674368000.0)
+#define SIN_C17 ( 1.0 / 355687428096000.0)
+#define SIN_C19 (-1.0 / 121645100408832000.0)
+#define SIN_C21 ( 1.0 / 51090942171709440000.0)
+#define SIN_C23 (-1.0 / 25852016738884976640000.0)
+
+#endif
+
+#if defined(CONTINUOUS_USE_X86)
+
+// --- AVX2 + FMA (4 lanes) ---
+#define SIMD_SUFFIX avx2
+#define SIMD_ATTR __attribute__((target("avx2,fma")))
+#define VT __m256d
+#define W 4
+#define V_LOAD(p)      _mm256_loadu_pd(p)
+#define V_SET1(v)      _mm256_set1_pd(v)
+#define V_ADD(a, b)    _mm256_add_pd(a, b)
+#define V_SUB(a, b)    _mm256_sub_pd(a, b)
+#define V_MUL(a, b)    _mm256_mul_pd(a, b)
+#define V_FMA(a, b, c) _mm256_fmadd_pd(a, b, c)
+#define V_ABS(a)       _mm256_andnot_pd(_mm256_set1_pd(-0.0), a)
+#define V_SQRT(a)      _mm256_sqrt_pd(a)
+#define V_ROUND(a)     _mm256_round_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define V_HSUM(a)      avx2_hsum(a)
+#define V_ANY_GT(a, b) (_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ)) != 0)
+
+SIMD_ATTR static inline double avx2_hsum(__m256d a) {
+    __m128d lo = _mm256_castpd256_pd128(a);
+    __m128d hi = _mm256_extractf128_pd(a, 1);
+    lo = _mm_add_pd(lo, hi);
+    return _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+}
+
+#include "continuous_simd.inc"
+
+#undef SIMD_SUFFIX
+#undef SIMD_ATTR
+#undef VT
+#undef W
+#undef V_LOAD
+#undef V_SET1
+#undef V_ADD
+#undef V_SUB
+#undef V_MUL
+#undef V_FMA
+#undef V_ABS
+#undef V_SQRT
+#undef V_ROUND
+#undef V_HSUM
+#undef V_ANY_GT
+
+// --- AVX-512F (8 lanes) ---
+#define SIMD_SUFFIX avx512
+#define SIMD_ATTR __attribute__((target("avx512f")))
+#define VT __m512d
+#define W 8
+#define V_LOAD(p)      _mm512_loadu_pd(p)
+#define V_SET1(v)      _mm512_set1_pd(v)
+#define V_ADD(a, b)    _mm512_add_pd(a, b)
+#define V_SUB(a, b)    _mm512_sub_pd(a, b)
+#define V_MUL(a, b)    _mm512_mul_pd(a, b)
+#define V_FMA(a, b, c) _mm512_fmadd_pd(a, b, c)
+#define V_ABS(a)       _mm512_abs_pd(a)
+#define V_SQRT(a)      _mm512_sqrt_pd(a)
+#define V_ROUND(a)     _mm512_roundscale_pd(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#define V_HSUM(a)      _mm512_reduce_add_pd(a)
+#define V_ANY_GT(a, b) (_mm512_cmp_pd_mask(a, b, _CMP_GT_OQ) != 0)
+
+#include "continuous_simd.inc"
+
+#elif defined(CONTINUOUS_USE_NEON)
+
+// --- NEON (2 lanes) ---
+#define SIMD_SUFFIX neon
+#define SIMD_ATTR
+#define VT float64x2_t
+#define W 2
+#define V_LOAD(p)      vld1q_f64(p)
+#define V_SET1(v)      vdupq_n_f64(v)
+#define V_ADD(a, b)    vaddq_f64(a, b)
+#define V_SUB(a, b)    vsubq_f64(a, b)
+#define V_MUL(a, b)    vmulq_f64(a, b)
+#define V_FMA(a, b, c) vfmaq_f64(c, a, b)
+#define V_ABS(a)       vabsq_f64(a)
+#define V_SQRT(a)      vsqrtq_f64(a)
+#define V_ROUND(a)     vrndnq_f64(a)
+#define V_HSUM(a)      vaddvq_f64(a)
+#define V_ANY_GT(a, b) (vmaxvq_u64(vcgtq_f64(a, b)) != 0)
+
+#include "continuous_simd.inc"
+
+#endif
+
+#if defined(CONTINUOUS_USE_X86) || defined(CONTINUOUS_USE_NEON)
+#undef SIMD_SUFFIX
+#undef SIMD_ATTR
+#undef VT
+#undef W
+#undef V_LOAD
+#undef V_SET1
+#undef V_ADD
+#undef V_SUB
+#undef V_MUL
+#undef V_FMA
+#undef V_ABS
+#undef V_SQRT
+#undef V_ROUND
+#undef V_HSUM
+#undef V_ANY_GT
+#endif
+
+// Teto definido por continuous_set_simd_level (padrao: sem teto)
+static ContinuousSimdLevel simd_cap = CONTINUOUS_SIMD_AVX512;
+
+static ContinuousSimdLevel simd_detect(void) {
+#if defined(CONTINUOUS_USE_X86)
+    static int detected = -1;
+    if (detected < 0) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            detected = CONTINUOUS_SIMD_AVX512;
+        } else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+            detected = CONTINUOUS_SIMD_AVX2;
+        } else {
+            detected = CONTINUOUS_SIMD_SCALAR;
+        }
+    }
+    return (ContinuousSimdLevel)detected;
+#elif defined(CONTINUOUS_USE_NEON)
+    return CONTINUOUS_SIMD_NEON;
+#else
+    return CONTINUOUS_SIMD_SCALAR;
+#endif
+}
+
+ContinuousSimdLevel continuous_simd_level(void) {
+    ContinuousSimdLevel hw = simd_detect();
+    if (simd_cap < hw) {
+        // AVX-512 limitado a AVX2 ainda usa AVX2; qualquer outro teto abaixo
+        // do hardware cai na referencia escalar
+        if (hw == CONTINUOUS_SIMD_AVX512 && simd_cap == CONTINUOUS_SIMD_AVX2) {
+            return CONTINUOUS_SIMD_AVX2;
+        }
+        return CONTINUOUS_SIMD_SCALAR;
+    }
+    return hw;
+}
+
+ContinuousSimdLevel continuous_set_simd_level(ContinuousSimdLevel max_level) {
+    simd_cap = max_level;
+    return continuous_simd_level();
+}
+
+static const ContinuousKernels* simd_kernels(void) {
+    switch (continuous_simd_level()) {
+#if defined(CONTINUOUS_USE_X86)
+        case CONTINUOUS_SIMD_AVX512: return &kernels_avx512;
+        case CONTINUOUS_SIMD_AVX2:   return &kernels_avx2;
+#elif defined(CONTINUOUS_USE_NEON)
+        case CONTINUOUS_SIMD_NEON:   return &kernels_neon;
+#endif
+        default:                     return &kernels_scalar;
+    }
+}
+
+// ============================================================================
+// FUNCOES OBJETIVO
+// ============================================================================
+
+double continuous_sphere(const double *x, size_t d) {
+    return simd_kernels()->sphere(x, d);
+}
+
+double continuous_rastrigin(const double *x, size_t d) {
+    return simd_kernels()->rastrigin(x, d);
+}
+
+double continuous_rosenbrock(const double *x, size_t d) {
+    return simd_kernels()->rosenbrock(x, d);
+}
+
+double continuous_ackley(const double *x, size_t d) {
+    return simd_kernels()->ackley(x, d);
+}
+
+double continuous_schwefel(const double *x, size_t d) {
+    return simd_kernels()->schwefel(x, d);
+}
+
 double continuous_evaluate(const void *solution_data, size_t size, const void *context) {
     if (solution_data == NULL || context == NULL || size == 0) return 1e18;
 
     const double *x = (const double*)solution_data;
     const ContinuousInstance *inst = (const ContinuousInstance*)context;
+    const ContinuousKernels *k = simd_kernels();
 
     switch (inst->fn_type) {
-        case CONTINUOUS_SPHERE:     return continuous_sphere(x, size);
-        case CONTINUOUS_RASTRIGIN:  return continuous_rastrigin(x, size);
-        case CONTINUOUS_ROSENBROCK: return continuous_rosenbrock(x, size);
-        case CONTINUOUS_ACKLEY:     return continuous_ackley(x, size);
-        case CONTINUOUS_SCHWEFEL:   return continuous_schwefel(x, size);
+        case CONTINUOUS_SPHERE:     return k->sphere(x, size);
+        case CONTINUOUS_RASTRIGIN:  return k->rastrigin(x, size);
+        case CONTINUOUS_ROSENBROCK: return k->rosenbrock(x, size);
+        case CONTINUOUS_ACKLEY:     return k->ackley(x, size);
+        case CONTINUOUS_SCHWEFEL:   return k->schwefel(x, size);
         default:                    return 1e18;
     }
 }
 
+void continuous_evaluate_batch(const void *solutions, size_t count, size_t stride,
+                               size_t size, double *costs, const void *context) {
+    if (costs == NULL || count == 0) return;
+
+    const ContinuousInstance *inst = (const ContinuousInstance*)context;
+    if (solutions == NULL || inst == NULL || size == 0) {
+        for (size_t i = 0; i < count; i++) costs[i] = 1e18;
+        return;
+    }
+
+    // Tabela de kernels e funcao resolvidas uma vez por lote
+    const ContinuousKernels *k = simd_kernels();
+    ContinuousKernelFn fn;
+    switch (inst->fn_type) {
+        case CONTINUOUS_SPHERE:     fn = k->sphere; break;
+        case CONTINUOUS_RASTRIGIN:  fn = k->rastrigin; break;
+        case CONTINUOUS_ROSENBROCK: fn = k->rosenbrock; break;
+        case CONTINUOUS_ACKLEY:     fn = k->ackley; break;
+        case CONTINUOUS_SCHWEFEL:   fn = k->schwefel; break;
+        default:
+            for (size_t i = 0; i < count; i++) costs[i] = 1e18;
+            return;
+    }
+
+    const unsigned char *row = (const unsigned char*)solutions;
+    for (size_t i = 0; i < count; i++, row += stride) {
+        costs[i] = fn((const double*)row, size);
+    }
+}
+
 // ============================================================================
 // VIZINHANCA
 // ============================================================================
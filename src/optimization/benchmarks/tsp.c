@@ -2,14 +2,20 @@
  * @file tsp.c
  * @brief Implementacao do benchmark TSP para algoritmos de otimizacao
  *
- * Instancias hardcoded (5, 10, 20 cidades) e aleatorias,
- * funcao de custo, vizinhancas swap/2-opt, perturbacao double-bridge,
- * e geracao aleatoria via Fisher-Yates shuffle.
+ * Instancias hardcoded (5, 10, 20 cidades), aleatorias e lidas de
+ * arquivos TSPLIB (EUC_2D, CEIL_2D, ATT, GEO, EXPLICIT), matriz de
+ * distancias contigua (double/float) ou calculo sob demanda, listas de
+ * k vizinhos mais proximos, funcao de custo, vizinhancas swap/2-opt,
+ * avaliacao incremental (delta O(1)) de 2-opt/swap/or-opt, busca local
+ * 2-opt/or-opt com listas de candidatos e don't-look bits, perturbacao
+ * double-bridge, e geracao aleatoria via Fisher-Yates shuffle.
  *
  * Referencias:
  * - Reinelt, G. (1991). "TSPLIB - A Traveling Salesman Problem Library"
  * - Croes, G. A. (1958). "A Method for Solving Traveling-Salesman Problems"
  * - Lin, S. & Kernighan, B. W. (1973). "An effective heuristic algorithm for the TSP"
+ * - Bentley, J. L. (1992). "Fast Algorithms for Geometric Traveling
+ *   Salesman Problems"
  * - Martin, O., Otto, S. W. & Felten, E. W. (1991). "Large-step Markov chains
  *   for the traveling salesman problem"
  * - Fisher, R. A. & Yates, F. (1938). Statistical Tables
@@ -19,7 +25,9 @@
  */
 
 #include "optimization/benchmarks/tsp.h"
+#include "data_structures/large_alloc.h"
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <stdio.h>
 #include <math.h>
@@ -32,25 +40,40 @@
 // HELPERS INTERNOS
 // ============================================================================
 
-static TSPInstance* tsp_alloc_instance(size_t n) {
+static TSPInstance* tsp_alloc_instance(size_t n, TSPDistStorage storage) {
+    if (storage == TSP_DIST_AUTO) {
+        storage = (n > TSP_MATRIX_MAX_CITIES) ? TSP_DIST_COORDS : TSP_DIST_DOUBLE;
+    }
+
     TSPInstance *inst = calloc(1, sizeof(TSPInstance));
     if (inst == NULL) return NULL;
 
     inst->n_cities = n;
+    inst->storage = storage;
     inst->known_optimum = -1.0;
 
     inst->x = calloc(n, sizeof(double));
     inst->y = calloc(n, sizeof(double));
-    inst->dist_matrix = calloc(n, sizeof(double*));
-
-    if (inst->x == NULL || inst->y == NULL || inst->dist_matrix == NULL) {
+    if (inst->x == NULL || inst->y == NULL) {
         tsp_instance_destroy(inst);
         return NULL;
     }
 
-    for (size_t i = 0; i < n; i++) {
-        inst->dist_matrix[i] = calloc(n, sizeof(double));
-        if (inst->dist_matrix[i] == NULL) {
+    // Bloco unico n x n: uma indirecao a menos e linhas contiguas. Lido por
+    // todas as threads: huge pages e paginas intercaladas entre os nos NUMA
+    if (storage != TSP_DIST_COORDS && n > SIZE_MAX / n) {
+        tsp_instance_destroy(inst);
+        return NULL;
+    }
+    if (storage == TSP_DIST_DOUBLE) {
+        inst->dist_matrix = ds_large_calloc(n * n, sizeof(double));
+        if (inst->dist_matrix == NULL) {
+            tsp_instance_destroy(inst);
+            return NULL;
+        }
+    } else if (storage == TSP_DIST_FLOAT) {
+        inst->dist_matrix_f32 = ds_large_calloc(n * n, sizeof(float));
+        if (inst->dist_matrix_f32 == NULL) {
             tsp_instance_destroy(inst);
             return NULL;
         }
@@ -61,14 +84,22 @@ static TSPInstance* tsp_alloc_instance(size_t n) {
 
 static void tsp_compute_distances(TSPInstance *inst) {
     size_t n = inst->n_cities;
+    double *md = inst->dist_matrix;
+    float *mf = inst->dist_matrix_f32;
+    if (md == NULL && mf == NULL) return;
+
     for (size_t i = 0; i < n; i++) {
-        inst->dist_matrix[i][i] = 0.0;
+        if (md != NULL) md[i * n + i] = 0.0;
+        else mf[i * n + i] = 0.0f;
         for (size_t j = i + 1; j < n; j++) {
-            double dx = inst->x[i] - inst->x[j];
-            double dy = inst->y[i] - inst->y[j];
-            double d = sqrt(dx * dx + dy * dy);
-            inst->dist_matrix[i][j] = d;
-            inst->dist_matrix[j][i] = d;
+            double d = tsp_dist_metric(inst, i, j);
+            if (md != NULL) {
+                md[i * n + j] = d;
+                md[j * n + i] = d;
+            } else {
+                mf[i * n + j] = (float)d;
+                mf[j * n + i] = (float)d;
+            }
         }
     }
 }
@@ -78,7 +109,7 @@ static void tsp_compute_distances(TSPInstance *inst) {
 // ============================================================================
 
 TSPInstance* tsp_create_example_5(void) {
-    TSPInstance *inst = tsp_alloc_instance(5);
+    TSPInstance *inst = tsp_alloc_instance(5, TSP_DIST_DOUBLE);
     if (inst == NULL) return NULL;
 
     double radius = 10.0;
@@ -97,7 +128,7 @@ TSPInstance* tsp_create_example_5(void) {
 }
 
 TSPInstance* tsp_create_example_10(void) {
-    TSPInstance *inst = tsp_alloc_instance(10);
+    TSPInstance *inst = tsp_alloc_instance(10, TSP_DIST_DOUBLE);
     if (inst == NULL) return NULL;
 
     double coords[][2] = {
@@ -117,7 +148,7 @@ TSPInstance* tsp_create_example_10(void) {
 }
 
 TSPInstance* tsp_create_example_20(void) {
-    TSPInstance *inst = tsp_alloc_instance(20);
+    TSPInstance *inst = tsp_alloc_instance(20, TSP_DIST_DOUBLE);
     if (inst == NULL) return NULL;
 
     double coords[][2] = {
@@ -139,17 +170,22 @@ TSPInstance* tsp_create_example_20(void) {
 }
 
 TSPInstance* tsp_create_random(size_t n, unsigned seed) {
+    return tsp_create_random_with_storage(n, seed, TSP_DIST_DOUBLE);
+}
+
+TSPInstance* tsp_create_random_with_storage(size_t n, unsigned seed, TSPDistStorage storage) {
     if (n < 2) return NULL;
 
-    TSPInstance *inst = tsp_alloc_instance(n);
+    TSPInstance *inst = tsp_alloc_instance(n, storage);
     if (inst == NULL) return NULL;
 
-    unsigned saved_seed = seed;
-    srand(saved_seed);
+    // Stream local: nao altera o estado de rand() nem o stream da thread
+    OptRng rng;
+    opt_rng_seed(&rng, seed);
 
     for (size_t i = 0; i < n; i++) {
-        inst->x[i] = (double)rand() / RAND_MAX * 100.0;
-        inst->y[i] = (double)rand() / RAND_MAX * 100.0;
+        inst->x[i] = opt_rng_uniform(&rng) * 100.0;
+        inst->y[i] = opt_rng_uniform(&rng) * 100.0;
     }
 
     tsp_compute_distances(inst);
@@ -158,19 +194,452 @@ TSPInstance* tsp_create_random(size_t n, unsigned seed) {
     return inst;
 }
 
+TSPInstance* tsp_create_from_coords(const double *x, const double *y, size_t n,
+                                    TSPDistStorage storage) {
+    if (x == NULL || y == NULL || n < 2) return NULL;
+
+    TSPInstance *inst = tsp_alloc_instance(n, storage);
+    if (inst == NULL) return NULL;
+
+    memcpy(inst->x, x, n * sizeof(double));
+    memcpy(inst->y, y, n * sizeof(double));
+    tsp_compute_distances(inst);
+
+    return inst;
+}
+
 void tsp_instance_destroy(TSPInstance *inst) {
     if (inst == NULL) return;
 
+    size_t n = inst->n_cities;
+    ds_large_free(inst->dist_matrix, n * n, sizeof(double));
+    ds_large_free(inst->dist_matrix_f32, n * n, sizeof(float));
+    free(inst->neighbors);
+    free(inst->x);
+    free(inst->y);
+    free(inst);
+}
+
+// ============================================================================
+// METRICAS TSPLIB
+// ============================================================================
+
+// Reinelt (1995), secao 2: nint, ceil e a pseudo-euclidiana do ATT
+static double tsplib_nint(double v) {
+    return (double)(long long)(v + 0.5);
+}
+
+// DDD.MM -> radianos (graus inteiros truncados, como nas solucoes de referencia)
+static double tsplib_geo_radians(double v) {
+    const double pi = 3.141592;
+    double deg = (double)(long long)v;
+    double min = v - deg;
+    return pi * (deg + 5.0 * min / 3.0) / 180.0;
+}
+
+double tsp_dist_metric(const TSPInstance *inst, size_t i, size_t j) {
+    if (inst->metric == TSP_METRIC_EXPLICIT) return 0.0;
+
+    double dx = inst->x[i] - inst->x[j];
+    double dy = inst->y[i] - inst->y[j];
+    switch (inst->metric) {
+        case TSP_METRIC_EUC_2D:
+            return tsplib_nint(sqrt(dx * dx + dy * dy));
+        case TSP_METRIC_CEIL_2D:
+            return ceil(sqrt(dx * dx + dy * dy));
+        case TSP_METRIC_ATT: {
+            double r = sqrt((dx * dx + dy * dy) / 10.0);
+            double t = tsplib_nint(r);
+            return (t < r) ? t + 1.0 : t;
+        }
+        case TSP_METRIC_GEO: {
+            if (i == j) return 0.0;
+            const double rrr = 6378.388;
+            double lat_i = tsplib_geo_radians(inst->x[i]);
+            double lon_i = tsplib_geo_radians(inst->y[i]);
+            double lat_j = tsplib_geo_radians(inst->x[j]);
+            double lon_j = tsplib_geo_radians(inst->y[j]);
+            double q1 = cos(lon_i - lon_j);
+            double q2 = cos(lat_i - lat_j);
+            double q3 = cos(lat_i + lat_j);
+            return (double)(long long)(rrr * acos(0.5 * ((1.0 + q1) * q2 - (1.0 - q1) * q3)) + 1.0);
+        }
+        default:
+            return sqrt(dx * dx + dy * dy);
+    }
+}
+
+// ============================================================================
+// LEITURA TSPLIB
+// ============================================================================
+
+/** Bytes lidos do arquivo por vez */
+#define TSPLIB_READ_CHUNK 65536
+
+/** Maior linha de cabecalho considerada (o resto da linha e descartado) */
+#define TSPLIB_MAX_LINE 256
+
+typedef struct {
+    FILE *in;
+    size_t pos;
+    size_t len;
+    char buf[TSPLIB_READ_CHUNK];
+} TSPLibReader;
+
+typedef enum {
+    TSPLIB_FULL_MATRIX,
+    TSPLIB_UPPER_ROW,
+    TSPLIB_LOWER_ROW,
+    TSPLIB_UPPER_DIAG_ROW,
+    TSPLIB_LOWER_DIAG_ROW,
+    TSPLIB_FORMAT_UNKNOWN
+} TSPLibFormat;
+
+// Proximo byte sem consumir; EOF no fim do arquivo
+static int reader_peek(TSPLibReader *r) {
+    if (r->pos == r->len) {
+        r->len = fread(r->buf, 1, sizeof(r->buf), r->in);
+        r->pos = 0;
+        if (r->len == 0) return EOF;
+    }
+    return (unsigned char)r->buf[r->pos];
+}
+
+static int reader_get(TSPLibReader *r) {
+    int c = reader_peek(r);
+    if (c != EOF) r->pos++;
+    return c;
+}
+
+static bool is_blank(int c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+}
+
+// Le a proxima linha nao vazia (sem o '\n'); false no fim do arquivo
+static bool reader_line(TSPLibReader *r, char *line, size_t cap) {
+    int c;
+    while ((c = reader_peek(r)) != EOF && is_blank(c)) r->pos++;
+    if (c == EOF) return false;
+
+    size_t len = 0;
+    while ((c = reader_get(r)) != EOF && c != '\n') {
+        if (len + 1 < cap) line[len++] = (char)c;
+    }
+    while (len > 0 && is_blank((unsigned char)line[len - 1])) len--;
+    line[len] = '\0';
+    return true;
+}
+
+// Le o proximo token separado por espaco; 0 no fim do arquivo
+static size_t reader_token(TSPLibReader *r, char *tok, size_t cap) {
+    int c;
+    while ((c = reader_peek(r)) != EOF && is_blank(c)) r->pos++;
+
+    size_t len = 0;
+    while ((c = reader_peek(r)) != EOF && !is_blank(c)) {
+        if (len + 1 < cap) tok[len++] = (char)c;
+        r->pos++;
+    }
+    tok[len] = '\0';
+    return len;
+}
+
+// Numero decimal independente do locale. Caminho exato de Clinger
+// (mantissa < 2^53, |expoente| <= 22); o resto cai em strtod.
+static bool parse_number(const char *s, double *out) {
+    static const double pow10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    const char *p = s;
+    bool negative = (*p == '-');
+    if (*p == '-' || *p == '+') p++;
+
+    uint64_t mantissa = 0;
+    int digits = 0, exponent = 0;
+    bool any = false;
+    for (; *p >= '0' && *p <= '9'; p++, any = true) {
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            if (mantissa != 0) digits++;
+        } else {
+            exponent++;
+        }
+    }
+    if (*p == '.') {
+        for (p++; *p >= '0' && *p <= '9'; p++, any = true) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                if (mantissa != 0) digits++;
+                exponent--;
+            }
+        }
+    }
+    if (!any) return false;
+    if (*p == 'e' || *p == 'E') {
+        p++;
+        bool exp_negative = (*p == '-');
+        if (*p == '-' || *p == '+') p++;
+        if (*p < '0' || *p > '9') return false;
+        int e = 0;
+        for (; *p >= '0' && *p <= '9'; p++) {
+            if (e < 10000) e = e * 10 + (*p - '0');
+        }
+        exponent += exp_negative ? -e : e;
+    }
+    if (*p != '\0') return false;
+
+    if (mantissa < (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+        double v = (double)mantissa;
+        v = (exponent < 0) ? v / pow10[-exponent] : v * pow10[exponent];
+        *out = negative ? -v : v;
+        return true;
+    }
+    char *end;
+    *out = strtod(s, &end);
+    return true;
+}
+
+static bool reader_number(TSPLibReader *r, double *out) {
+    char tok[64];
+    return reader_token(r, tok, sizeof(tok)) > 0 && parse_number(tok, out);
+}
+
+static TSPMetric parse_metric(const char *v, bool *ok) {
+    *ok = true;
+    if (strcmp(v, "EUC_2D") == 0) return TSP_METRIC_EUC_2D;
+    if (strcmp(v, "CEIL_2D") == 0) return TSP_METRIC_CEIL_2D;
+    if (strcmp(v, "ATT") == 0) return TSP_METRIC_ATT;
+    if (strcmp(v, "GEO") == 0) return TSP_METRIC_GEO;
+    if (strcmp(v, "EXPLICIT") == 0) return TSP_METRIC_EXPLICIT;
+    *ok = false;
+    return TSP_METRIC_EUCLIDEAN;
+}
+
+// Formatos por coluna sao os por linha do outro triangulo (matriz simetrica)
+static TSPLibFormat parse_format(const char *v) {
+    if (strcmp(v, "FULL_MATRIX") == 0) return TSPLIB_FULL_MATRIX;
+    if (strcmp(v, "UPPER_ROW") == 0 || strcmp(v, "LOWER_COL") == 0) return TSPLIB_UPPER_ROW;
+    if (strcmp(v, "LOWER_ROW") == 0 || strcmp(v, "UPPER_COL") == 0) return TSPLIB_LOWER_ROW;
+    if (strcmp(v, "UPPER_DIAG_ROW") == 0 || strcmp(v, "LOWER_DIAG_COL") == 0) {
+        return TSPLIB_UPPER_DIAG_ROW;
+    }
+    if (strcmp(v, "LOWER_DIAG_ROW") == 0 || strcmp(v, "UPPER_DIAG_COL") == 0) {
+        return TSPLIB_LOWER_DIAG_ROW;
+    }
+    return TSPLIB_FORMAT_UNKNOWN;
+}
+
+static void set_weight(TSPInstance *inst, size_t i, size_t j, double w) {
+    size_t n = inst->n_cities;
     if (inst->dist_matrix != NULL) {
-        for (size_t i = 0; i < inst->n_cities; i++) {
-            free(inst->dist_matrix[i]);
+        inst->dist_matrix[i * n + j] = w;
+    } else {
+        inst->dist_matrix_f32[i * n + j] = (float)w;
+    }
+}
+
+// "i x y" por cidade, indices de 1 a n em qualquer ordem
+static bool read_coords(TSPLibReader *r, size_t n, double *x, double *y) {
+    for (size_t k = 0; k < n; k++) {
+        double id, cx, cy;
+        if (!reader_number(r, &id) || !reader_number(r, &cx) || !reader_number(r, &cy)) {
+            return false;
         }
-        free(inst->dist_matrix);
+        if (id < 1.0 || id > (double)n || id != (double)(size_t)id) return false;
+        size_t i = (size_t)id - 1;
+        x[i] = cx;
+        y[i] = cy;
     }
+    return true;
+}
 
-    free(inst->x);
-    free(inst->y);
-    free(inst);
+static bool read_weights(TSPLibReader *r, TSPInstance *inst, TSPLibFormat format) {
+    size_t n = inst->n_cities;
+    for (size_t i = 0; i < n; i++) {
+        size_t lo = 0, hi = n;
+        switch (format) {
+            case TSPLIB_UPPER_ROW:      lo = i + 1; break;
+            case TSPLIB_LOWER_ROW:      hi = i;     break;
+            case TSPLIB_UPPER_DIAG_ROW: lo = i;     break;
+            case TSPLIB_LOWER_DIAG_ROW: hi = i + 1; break;
+            default: break;
+        }
+        for (size_t j = lo; j < hi; j++) {
+            double w;
+            if (!reader_number(r, &w)) return false;
+            set_weight(inst, i, j, w);
+            if (format != TSPLIB_FULL_MATRIX) set_weight(inst, j, i, w);
+        }
+        if (format == TSPLIB_UPPER_ROW || format == TSPLIB_LOWER_ROW) {
+            set_weight(inst, i, i, 0.0);
+        }
+    }
+    return true;
+}
+
+TSPInstance* tsp_read_tsplib(FILE *in, TSPDistStorage storage) {
+    if (in == NULL) return NULL;
+
+    TSPLibReader *r = malloc(sizeof(TSPLibReader));
+    if (r == NULL) return NULL;
+    r->in = in;
+    r->pos = r->len = 0;
+
+    char line[TSPLIB_MAX_LINE];
+    size_t n = 0;
+    bool have_metric = false, have_coords = false, have_weights = false, ok = true;
+    TSPMetric metric = TSP_METRIC_EUCLIDEAN;
+    TSPLibFormat format = TSPLIB_FORMAT_UNKNOWN;
+    TSPInstance *inst = NULL;
+
+    while (ok && reader_line(r, line, sizeof(line))) {
+        // "CHAVE : valor", "CHAVE: valor" ou so "CHAVE" (secoes)
+        char *value = strchr(line, ':');
+        if (value != NULL) {
+            char *end = value;
+            while (end > line && is_blank((unsigned char)end[-1])) end--;
+            *end = '\0';
+            for (value++; is_blank((unsigned char)*value); value++) {
+            }
+        }
+        const char *key = line;
+
+        if (strcmp(key, "EOF") == 0) {
+            break;
+        } else if (value != NULL) {
+            if (strcmp(key, "TYPE") == 0) {
+                ok = (strcmp(value, "TSP") == 0);
+            } else if (strcmp(key, "DIMENSION") == 0) {
+                double d;
+                ok = (inst == NULL) && parse_number(value, &d) && d >= 2.0 &&
+                     d == (double)(size_t)d;
+                n = ok ? (size_t)d : 0;
+            } else if (strcmp(key, "EDGE_WEIGHT_TYPE") == 0) {
+                metric = parse_metric(value, &ok);
+                have_metric = ok;
+            } else if (strcmp(key, "EDGE_WEIGHT_FORMAT") == 0 && strcmp(value, "FUNCTION") != 0) {
+                format = parse_format(value);
+                ok = (format != TSPLIB_FORMAT_UNKNOWN);
+            }
+            // NAME, COMMENT, NODE_COORD_TYPE, DISPLAY_DATA_TYPE...: ignorados
+        } else {
+            bool coords = (strcmp(key, "NODE_COORD_SECTION") == 0);
+            bool display = (strcmp(key, "DISPLAY_DATA_SECTION") == 0);
+            bool weights = (strcmp(key, "EDGE_WEIGHT_SECTION") == 0);
+            if (!(coords || display || weights) || n == 0 || !have_metric) {
+                ok = false;
+                break;
+            }
+            if (inst == NULL) {
+                TSPDistStorage s = storage;
+                if (metric == TSP_METRIC_EXPLICIT && s != TSP_DIST_FLOAT) s = TSP_DIST_DOUBLE;
+                inst = tsp_alloc_instance(n, s);
+                if (inst == NULL) {
+                    ok = false;
+                    break;
+                }
+                inst->metric = metric;
+            }
+            if (weights) {
+                ok = (metric == TSP_METRIC_EXPLICIT) && inst->storage != TSP_DIST_COORDS &&
+                     read_weights(r, inst, format == TSPLIB_FORMAT_UNKNOWN ? TSPLIB_FULL_MATRIX
+                                                                          : format);
+                have_weights = ok;
+            } else {
+                // Coordenadas de exibicao de instancias EXPLICIT servem so para as listas kNN
+                ok = read_coords(r, n, inst->x, inst->y);
+                have_coords = ok;
+            }
+        }
+    }
+
+    free(r);
+    if (ok && ferror(in)) ok = false;
+    if (ok && inst != NULL) {
+        ok = (metric == TSP_METRIC_EXPLICIT) ? have_weights : have_coords;
+    }
+    if (!ok || inst == NULL) {
+        tsp_instance_destroy(inst);
+        return NULL;
+    }
+
+    if (metric != TSP_METRIC_EXPLICIT) tsp_compute_distances(inst);
+    return inst;
+}
+
+TSPInstance* tsp_load_tsplib(const char *path, TSPDistStorage storage) {
+    if (path == NULL) return NULL;
+
+    FILE *in = fopen(path, "r");
+    if (in == NULL) return NULL;
+    TSPInstance *inst = tsp_read_tsplib(in, storage);
+    fclose(in);
+    return inst;
+}
+
+// ============================================================================
+// LISTAS DE VIZINHOS
+// ============================================================================
+
+// Listas n x k (k <= n - 1) dos vizinhos mais proximos; NULL em falha
+static int* knn_lists(const TSPInstance *inst, size_t k) {
+    size_t n = inst->n_cities;
+    if (n > SIZE_MAX / k / sizeof(int)) return NULL;
+
+    int *lists = malloc(n * k * sizeof(int));
+    double *best = malloc(k * sizeof(double));
+    if (lists == NULL || best == NULL) {
+        free(lists);
+        free(best);
+        return NULL;
+    }
+
+    // Por cidade, mantem os k melhores em ordem crescente por insercao;
+    // metricas planas usam a distancia ao quadrado nas coordenadas (mesma
+    // ordem, sem sqrt nem arredondamento), GEO e EXPLICIT a propria tsp_dist
+    bool planar = inst->metric != TSP_METRIC_GEO && inst->metric != TSP_METRIC_EXPLICIT;
+    for (size_t i = 0; i < n; i++) {
+        int *row = lists + i * k;
+        size_t filled = 0;
+        for (size_t j = 0; j < n; j++) {
+            if (j == i) continue;
+            double d2;
+            if (planar) {
+                double dx = inst->x[i] - inst->x[j];
+                double dy = inst->y[i] - inst->y[j];
+                d2 = dx * dx + dy * dy;
+            } else {
+                d2 = tsp_dist(inst, i, j);
+            }
+            if (filled == k && d2 >= best[k - 1]) continue;
+
+            size_t pos = filled < k ? filled++ : k - 1;
+            while (pos > 0 && best[pos - 1] > d2) {
+                best[pos] = best[pos - 1];
+                row[pos] = row[pos - 1];
+                pos--;
+            }
+            best[pos] = d2;
+            row[pos] = (int)j;
+        }
+    }
+
+    free(best);
+    return lists;
+}
+
+bool tsp_build_neighbor_lists(TSPInstance *inst, size_t k) {
+    if (inst == NULL || inst->n_cities < 2 || k == 0) return false;
+
+    if (k > inst->n_cities - 1) k = inst->n_cities - 1;
+    int *lists = knn_lists(inst, k);
+    if (lists == NULL) return false;
+
+    free(inst->neighbors);
+    inst->neighbors = lists;
+    inst->n_neighbors = k;
+    return true;
 }
 
 // ============================================================================
@@ -185,9 +654,9 @@ double tsp_tour_cost(const void *tour_data, size_t n, const void *context) {
 
     double cost = 0.0;
     for (size_t i = 0; i < n - 1; i++) {
-        cost += inst->dist_matrix[tour[i]][tour[i + 1]];
+        cost += tsp_dist(inst, (size_t)tour[i], (size_t)tour[i + 1]);
     }
-    cost += inst->dist_matrix[tour[n - 1]][tour[0]];
+    cost += tsp_dist(inst, (size_t)tour[n - 1], (size_t)tour[0]);
 
     return cost;
 }
@@ -231,6 +700,609 @@ void tsp_neighbor_2opt(const void *current, void *neighbor, size_t n, const void
     }
 }
 
+// ============================================================================
+// AVALIACAO INCREMENTAL
+// ============================================================================
+
+static double tour_edge(const TSPInstance *inst, const int *tour, size_t p, size_t q) {
+    return tsp_dist(inst, (size_t)tour[p], (size_t)tour[q]);
+}
+
+double tsp_delta_2opt(const TSPInstance *inst, const int *tour, size_t n,
+                      size_t i, size_t j) {
+    if (i >= j || j >= n || n < 3) return 0.0;
+    // Inverter o tour inteiro so muda a orientacao
+    if (i == 0 && j == n - 1) return 0.0;
+
+    size_t a = (i + n - 1) % n;
+    size_t d = (j + 1) % n;
+    return tour_edge(inst, tour, a, j) + tour_edge(inst, tour, i, d)
+         - tour_edge(inst, tour, a, i) - tour_edge(inst, tour, j, d);
+}
+
+// Cidade na posicao p do tour apos trocar as posicoes i e j
+static size_t swapped_city(const int *tour, size_t p, size_t i, size_t j) {
+    if (p == i) return (size_t)tour[j];
+    if (p == j) return (size_t)tour[i];
+    return (size_t)tour[p];
+}
+
+double tsp_delta_swap(const TSPInstance *inst, const int *tour, size_t n,
+                      size_t i, size_t j) {
+    if (i == j || i >= n || j >= n || n < 2) return 0.0;
+
+    // Arestas p -> p+1 afetadas; posicoes adjacentes compartilham arestas
+    size_t edges[4] = { (i + n - 1) % n, i, (j + n - 1) % n, j };
+    double delta = 0.0;
+    for (int e = 0; e < 4; e++) {
+        bool seen = false;
+        for (int f = 0; f < e; f++) {
+            if (edges[f] == edges[e]) seen = true;
+        }
+        if (seen) continue;
+
+        size_t p = edges[e];
+        size_t q = (p + 1) % n;
+        delta += tsp_dist(inst, swapped_city(tour, p, i, j), swapped_city(tour, q, i, j))
+               - tour_edge(inst, tour, p, q);
+    }
+    return delta;
+}
+
+double tsp_delta_or_opt(const TSPInstance *inst, const int *tour, size_t n,
+                        size_t i, size_t len, size_t j) {
+    if (len == 0 || i + len > n || j >= n || n < len + 2) return 0.0;
+
+    size_t last = i + len - 1;
+    size_t a = (i + n - 1) % n;
+    size_t b = (last + 1) % n;
+    if (j == a || (j >= i && j <= last)) return 0.0;
+
+    size_t v = (j + 1) % n;
+    return tour_edge(inst, tour, a, b) - tour_edge(inst, tour, a, i)
+         - tour_edge(inst, tour, last, b)
+         + tour_edge(inst, tour, j, i) + tour_edge(inst, tour, last, v)
+         - tour_edge(inst, tour, j, v);
+}
+
+static void reverse_range(int *tour, size_t lo, size_t hi) {
+    while (lo < hi) {
+        int tmp = tour[lo];
+        tour[lo] = tour[hi];
+        tour[hi] = tmp;
+        lo++;
+        hi--;
+    }
+}
+
+void tsp_apply_2opt(int *tour, size_t i, size_t j) {
+    if (i < j) reverse_range(tour, i, j);
+}
+
+void tsp_apply_swap(int *tour, size_t i, size_t j) {
+    int tmp = tour[i];
+    tour[i] = tour[j];
+    tour[j] = tmp;
+}
+
+void tsp_apply_or_opt(int *tour, size_t n, size_t i, size_t len, size_t j) {
+    if (len == 0 || i + len > n || n < len + 2) return;
+
+    size_t last = i + len - 1;
+    if (j == (i + n - 1) % n || (j >= i && j <= last)) return;
+
+    // Rotacao por tres inversoes do intervalo entre segmento e insercao
+    if (j > last) {
+        reverse_range(tour, i, last);
+        reverse_range(tour, last + 1, j);
+        reverse_range(tour, i, j);
+    } else {
+        reverse_range(tour, j + 1, i - 1);
+        reverse_range(tour, i, last);
+        reverse_range(tour, j + 1, last);
+    }
+}
+
+double tsp_move_2opt(const void *current, size_t n, OptMove *move, const void *context) {
+    move->type = TSP_MOVE_2OPT;
+    move->i = 0;
+    move->j = 0;
+    move->k = 0;
+    if (current == NULL || context == NULL || n < 3) return 0.0;
+
+    int i = opt_random_int(0, (int)n - 2);
+    int j = opt_random_int(i + 1, (int)n - 1);
+    move->i = (size_t)i;
+    move->j = (size_t)j;
+    return tsp_delta_2opt((const TSPInstance*)context, (const int*)current, n,
+                          move->i, move->j);
+}
+
+double tsp_move_swap(const void *current, size_t n, OptMove *move, const void *context) {
+    move->type = TSP_MOVE_SWAP;
+    move->i = 0;
+    move->j = 0;
+    move->k = 0;
+    if (current == NULL || context == NULL || n < 2) return 0.0;
+
+    int i = opt_random_int(0, (int)n - 1);
+    int j = opt_random_int(0, (int)n - 2);
+    if (j >= i) j++;
+    move->i = (size_t)i;
+    move->j = (size_t)j;
+    return tsp_delta_swap((const TSPInstance*)context, (const int*)current, n,
+                          move->i, move->j);
+}
+
+double tsp_move_or_opt(const void *current, size_t n, OptMove *move, const void *context) {
+    move->type = TSP_MOVE_OR_OPT;
+    move->i = 0;
+    move->j = 0;
+    move->k = 0;
+    if (current == NULL || context == NULL || n < 3) return 0.0;
+
+    size_t max_len = n - 2 < 3 ? n - 2 : 3;
+    size_t len = (size_t)opt_random_int(1, (int)max_len);
+    size_t i = (size_t)opt_random_int(0, (int)(n - len));
+
+    // n - len - 1 posicoes validas, comecando logo apos o segmento
+    size_t r = (size_t)opt_random_int(0, (int)(n - len - 2));
+    move->i = i;
+    move->k = len;
+    move->j = (i + len + r) % n;
+    return tsp_delta_or_opt((const TSPInstance*)context, (const int*)current, n,
+                            i, len, move->j);
+}
+
+void tsp_move_apply(void *tour, size_t n, const OptMove *move, const void *context) {
+    (void)context;
+    if (tour == NULL || move == NULL) return;
+
+    int *t = (int*)tour;
+    switch ((TSPMoveType)move->type) {
+        case TSP_MOVE_2OPT:   tsp_apply_2opt(t, move->i, move->j); break;
+        case TSP_MOVE_SWAP:   tsp_apply_swap(t, move->i, move->j); break;
+        case TSP_MOVE_OR_OPT: tsp_apply_or_opt(t, n, move->i, move->k, move->j); break;
+        default: break;
+    }
+}
+
+/** Melhora minima para a varredura aceitar um movimento (evita ciclar em ruido de ponto flutuante) */
+#define TSP_SCAN_EPSILON 1e-9
+
+bool tsp_scan_2opt(const void *current, size_t n, OptScan *scan, const void *context) {
+    const TSPInstance *inst = (const TSPInstance*)context;
+    const int *tour = (const int*)current;
+    scan->evaluations = 0;
+    scan->delta = 0.0;
+    if (tour == NULL || inst == NULL || n < 4) return false;
+
+    // Minimiza sign * delta: um unico laco serve aos dois sentidos
+    double sign = (scan->direction == OPT_MINIMIZE) ? 1.0 : -1.0;
+    double best = -TSP_SCAN_EPSILON;
+    bool found = false;
+
+    for (size_t step = 0; step < n - 1; step++) {
+        size_t i = (scan->start + step) % (n - 1);
+        for (size_t j = i + 1; j < n; j++) {
+            if (i == 0 && j == n - 1) continue;
+            double delta = tsp_delta_2opt(inst, tour, n, i, j);
+            scan->evaluations++;
+            if (sign * delta < best) {
+                best = sign * delta;
+                scan->move.type = TSP_MOVE_2OPT;
+                scan->move.i = i;
+                scan->move.j = j;
+                scan->move.k = 0;
+                scan->delta = delta;
+                found = true;
+                if (scan->first_improvement) return true;
+            }
+        }
+    }
+    return found;
+}
+
+// ============================================================================
+// BUSCA LOCAL (2-OPT / OR-OPT COM LISTAS DE CANDIDATOS)
+// ============================================================================
+
+#define TSP_LS_DEFAULT_K 8
+#define TSP_LS_EPS 1e-9
+
+// Profundidade maxima da cadeia LK e largura nos primeiros niveis
+#define TSP_LK_MAX_DEPTH 10
+#define TSP_LK_BREADTH_LEVELS 2
+static const size_t lk_breadth[TSP_LK_BREADTH_LEVELS] = {5, 3};
+
+// Movimentos habilitados em tsp_local_search_run
+#define LS_MOVE_2OPT   1u
+#define LS_MOVE_OR_OPT 2u
+#define LS_MOVE_LK     4u
+
+typedef struct {
+    const TSPInstance *inst;
+    int *tour;
+    size_t n;
+    size_t *pos;        // pos[cidade] = posicao no tour
+    const int *cand;    // Listas de candidatos (n x k)
+    size_t k;
+    int *queue;         // Fila circular das cidades ativas
+    bool *active;       // Don't-look bit invertido: true = cidade na fila
+    size_t head;
+    size_t count;
+} TSPLocalSearch;
+
+static int ls_succ(const TSPLocalSearch *ls, int city) {
+    size_t p = ls->pos[city] + 1;
+    return ls->tour[p == ls->n ? 0 : p];
+}
+
+static int ls_pred(const TSPLocalSearch *ls, int city) {
+    size_t p = ls->pos[city];
+    return ls->tour[p == 0 ? ls->n - 1 : p - 1];
+}
+
+static int ls_next(const TSPLocalSearch *ls, int city, bool forward) {
+    return forward ? ls_succ(ls, city) : ls_pred(ls, city);
+}
+
+static int ls_prev(const TSPLocalSearch *ls, int city, bool forward) {
+    return forward ? ls_pred(ls, city) : ls_succ(ls, city);
+}
+
+static double ls_d(const TSPLocalSearch *ls, int a, int b) {
+    return tsp_dist(ls->inst, (size_t)a, (size_t)b);
+}
+
+static void ls_push(TSPLocalSearch *ls, int city) {
+    if (ls->active[city]) return;
+    ls->active[city] = true;
+    ls->queue[(ls->head + ls->count) % ls->n] = city;
+    ls->count++;
+}
+
+static int ls_pop(TSPLocalSearch *ls) {
+    int city = ls->queue[ls->head];
+    ls->head = (ls->head + 1) % ls->n;
+    ls->count--;
+    ls->active[city] = false;
+    return city;
+}
+
+// Inverte o caminho tour[i..j] (circular); inverte o complemento quando
+// ele e menor, o que gera o mesmo ciclo
+static void ls_reverse_path(TSPLocalSearch *ls, size_t i, size_t j) {
+    size_t n = ls->n;
+    size_t len = (j + n - i) % n + 1;
+    if (2 * len > n) {
+        size_t lo = (j + 1) % n;
+        j = (i + n - 1) % n;
+        i = lo;
+        len = n - len;
+    }
+
+    for (size_t s = 0; s < len / 2; s++) {
+        int a = ls->tour[i];
+        int b = ls->tour[j];
+        ls->tour[i] = b;
+        ls->tour[j] = a;
+        ls->pos[b] = i;
+        ls->pos[a] = j;
+        i = (i + 1 == n) ? 0 : i + 1;
+        j = (j == 0) ? n - 1 : j - 1;
+    }
+}
+
+// 2-opt sobre cidades: remove (t1,t2),(t3,t4) e adiciona (t1,t3),(t2,t4).
+// Requer t2 e t4 do mesmo lado de t1 e t3 (ambos sucessores ou predecessores)
+static void ls_move2(TSPLocalSearch *ls, int t1, int t2, int t3, int t4) {
+    (void)t4;
+    if (ls_succ(ls, t1) == t2) {
+        ls_reverse_path(ls, ls->pos[t2], ls->pos[t3]);
+    } else {
+        ls_reverse_path(ls, ls->pos[t3], ls->pos[t2]);
+    }
+}
+
+// Primeiro 2-opt de melhoria com (a, vizinho de a) como aresta nova
+static bool ls_improve_2opt(TSPLocalSearch *ls, int a) {
+    const int *cand = ls->cand + (size_t)a * ls->k;
+
+    for (int side = 0; side < 2; side++) {
+        bool forward = (side == 0);
+        int t2 = ls_next(ls, a, forward);
+        double d12 = ls_d(ls, a, t2);
+
+        for (size_t c = 0; c < ls->k; c++) {
+            int t3 = cand[c];
+            double g1 = d12 - ls_d(ls, a, t3);
+            if (g1 <= TSP_LS_EPS) break;
+
+            int t4 = ls_next(ls, t3, forward);
+            if (t3 == t2 || t4 == a) continue;
+
+            double gain = g1 + ls_d(ls, t3, t4) - ls_d(ls, t2, t4);
+            if (gain > TSP_LS_EPS) {
+                ls_move2(ls, a, t2, t3, t4);
+                ls_push(ls, a);
+                ls_push(ls, t2);
+                ls_push(ls, t3);
+                ls_push(ls, t4);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Move o segmento sf..sl (entre p e nx) para a aresta (x,y), com a ordem
+// de leitura p sf..sl nx ... x y; reversed insere x sl..sf y
+static void ls_apply_segment_move(TSPLocalSearch *ls, int p, int sf, int sl, int nx,
+                                  int x, int y, bool reversed) {
+    if (y == p) {
+        // Lido no sentido oposto: insercao logo apos o novo nx
+        int t = p; p = nx; nx = t;
+        t = sf; sf = sl; sl = t;
+        t = x; x = y; y = t;
+    }
+
+    ls_move2(ls, p, sf, x, y);              // p x ... nx sl..sf y
+    if (x != nx) ls_move2(ls, p, x, nx, sl); // p nx ... x sl..sf y
+    if (!reversed && sf != sl) ls_move2(ls, x, sl, sf, y);
+}
+
+static bool ls_in_segment(const int *seg, size_t len, int city) {
+    for (size_t s = 0; s < len; s++) {
+        if (seg[s] == city) return true;
+    }
+    return false;
+}
+
+// Primeiro or-opt de melhoria para segmentos de 1 a 3 cidades que comecam
+// em a (nos dois sentidos), reinseridos junto a candidatos das pontas
+static bool ls_improve_or_opt(TSPLocalSearch *ls, int a) {
+    for (int side = 0; side < 2; side++) {
+        bool forward = (side == 0);
+        int seg[3];
+        seg[0] = a;
+
+        for (size_t len = 1; len <= 3 && ls->n >= len + 3; len++) {
+            if (len > 1) seg[len - 1] = ls_next(ls, seg[len - 2], forward);
+            int e = seg[len - 1];
+            int p = ls_prev(ls, a, forward);
+            int nx = ls_next(ls, e, forward);
+
+            double g0 = ls_d(ls, p, a) + ls_d(ls, e, nx) - ls_d(ls, p, nx);
+            if (g0 <= TSP_LS_EPS) continue;
+
+            for (int end = 0; end < 2; end++) {
+                int from = (end == 0) ? a : e;
+                const int *cand = ls->cand + (size_t)from * ls->k;
+
+                for (size_t c = 0; c < ls->k; c++) {
+                    int city = cand[c];
+                    double d_from = ls_d(ls, from, city);
+                    if (g0 - d_from <= TSP_LS_EPS) break;
+                    if (ls_in_segment(seg, len, city)) continue;
+
+                    // city antes de from (x = city) ou depois (y = city);
+                    // reversed quando a ponta que encosta em x e e
+                    for (int after = 0; after < 2; after++) {
+                        int x, y;
+                        if (after == 0) {
+                            if (city == p) continue;
+                            x = city;
+                            y = ls_next(ls, city, forward);
+                        } else {
+                            if (city == nx) continue;
+                            y = city;
+                            x = ls_prev(ls, city, forward);
+                        }
+                        bool reversed = (end == 0) == (after == 1);
+                        int at_x = reversed ? e : a;
+                        int at_y = reversed ? a : e;
+
+                        double added = ls_d(ls, x, at_x) + ls_d(ls, at_y, y) - ls_d(ls, x, y);
+                        if (g0 - added > TSP_LS_EPS) {
+                            ls_apply_segment_move(ls, p, a, e, nx, x, y, reversed);
+                            ls_push(ls, p);
+                            ls_push(ls, nx);
+                            ls_push(ls, a);
+                            ls_push(ls, e);
+                            ls_push(ls, x);
+                            ls_push(ls, y);
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return false;
+}
+
+// Passo da cadeia LK (flips 2-opt sequenciais): (t1,t2) e a aresta aberta;
+// escolhe t3 entre os candidatos de t2 e quebra (t4,t3), t4 antes de t3
+typedef struct {
+    int t1, t2, t3, t4;
+} LKFlip;
+
+typedef struct {
+    int t3;
+    int t4;
+    double score;
+} LKCandidate;
+
+static bool lk_edge_added(const LKFlip *log, size_t depth, int a, int b) {
+    for (size_t s = 0; s < depth; s++) {
+        if ((log[s].t2 == a && log[s].t3 == b) || (log[s].t2 == b && log[s].t3 == a)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// cum = ganho real acumulado (tour fechado por (t1,t2)); mantem a cadeia
+// assim que um fechamento melhora o tour e retorna seu comprimento (0 = nada)
+static size_t lk_step(TSPLocalSearch *ls, LKFlip *log, size_t depth,
+                      int t1, int t2, double cum) {
+    if (depth == TSP_LK_MAX_DEPTH) return 0;
+
+    bool forward = (ls_succ(ls, t1) == t2);
+    double d12 = ls_d(ls, t1, t2);
+    double open = cum + d12;
+    size_t breadth = depth < TSP_LK_BREADTH_LEVELS ? lk_breadth[depth] : 1;
+
+    // Melhores candidatos por |x_{i+1}| - |y_i| (ordem decrescente)
+    LKCandidate best[5] = {{0, 0, 0.0}};
+    size_t count = 0;
+    const int *cand = ls->cand + (size_t)t2 * ls->k;
+    for (size_t c = 0; c < ls->k; c++) {
+        int t3 = cand[c];
+        double d23 = ls_d(ls, t2, t3);
+        if (open - d23 <= TSP_LS_EPS) break;
+        if (t3 == t1) continue;
+
+        int t4 = ls_prev(ls, t3, forward);
+        if (t4 == t2 || lk_edge_added(log, depth, t4, t3)) continue;
+
+        double score = ls_d(ls, t4, t3) - d23;
+        if (count == breadth && score <= best[count - 1].score) continue;
+        size_t pos = count < breadth ? count++ : breadth - 1;
+        while (pos > 0 && best[pos - 1].score < score) {
+            best[pos] = best[pos - 1];
+            pos--;
+        }
+        best[pos].t3 = t3;
+        best[pos].t4 = t4;
+        best[pos].score = score;
+    }
+
+    for (size_t b = 0; b < count; b++) {
+        int t3 = best[b].t3;
+        int t4 = best[b].t4;
+        ls_move2(ls, t1, t2, t4, t3);   // t1 t4 ... t2 t3
+        log[depth].t1 = t1;
+        log[depth].t2 = t2;
+        log[depth].t3 = t3;
+        log[depth].t4 = t4;
+
+        double next_cum = cum + d12 + best[b].score - ls_d(ls, t1, t4);
+        if (next_cum > TSP_LS_EPS) return depth + 1;
+
+        size_t kept = lk_step(ls, log, depth + 1, t1, t4, next_cum);
+        if (kept > 0) return kept;
+        ls_move2(ls, t1, t4, t2, t3);   // desfaz
+    }
+    return 0;
+}
+
+// Cadeia LK a partir de (a, vizinho de a), nos dois sentidos
+static bool ls_improve_lk(TSPLocalSearch *ls, int a) {
+    LKFlip log[TSP_LK_MAX_DEPTH];
+
+    for (int side = 0; side < 2; side++) {
+        int t2 = ls_next(ls, a, side == 0);
+        size_t kept = lk_step(ls, log, 0, a, t2, 0.0);
+        if (kept == 0) continue;
+
+        ls_push(ls, a);
+        for (size_t s = 0; s < kept; s++) {
+            ls_push(ls, log[s].t2);
+            ls_push(ls, log[s].t3);
+            ls_push(ls, log[s].t4);
+        }
+        return true;
+    }
+    return false;
+}
+
+// Motor comum: fila de cidades ativas (don't-look bits) ate nenhuma
+// cidade ativa encontrar movimento de melhoria
+static double tsp_local_search_run(void *tour_data, size_t n, ObjectiveFn objective,
+                                   const void *context, unsigned moves) {
+    const TSPInstance *inst = (const TSPInstance*)context;
+    int *tour = (int*)tour_data;
+    ObjectiveFn cost_fn = objective != NULL ? objective : tsp_tour_cost;
+    if (inst == NULL || tour == NULL || n < 5 || n != inst->n_cities) {
+        return cost_fn(tour_data, n, context);
+    }
+
+    TSPLocalSearch ls;
+    ls.inst = inst;
+    ls.tour = tour;
+    ls.n = n;
+    ls.head = 0;
+    ls.count = 0;
+
+    int *own_cand = NULL;
+    if (inst->neighbors != NULL && inst->n_neighbors > 0) {
+        ls.cand = inst->neighbors;
+        ls.k = inst->n_neighbors;
+    } else {
+        // Sem listas na instancia: listas temporarias, O(n^2) por chamada
+        ls.k = TSP_LS_DEFAULT_K < n - 1 ? TSP_LS_DEFAULT_K : n - 1;
+        own_cand = knn_lists(inst, ls.k);
+        ls.cand = own_cand;
+    }
+
+    ls.pos = malloc(n * sizeof(size_t));
+    ls.queue = malloc(n * sizeof(int));
+    ls.active = calloc(n, sizeof(bool));
+    if (ls.cand == NULL || ls.pos == NULL || ls.queue == NULL || ls.active == NULL) {
+        free(own_cand);
+        free(ls.pos);
+        free(ls.queue);
+        free(ls.active);
+        return cost_fn(tour_data, n, context);
+    }
+
+    for (size_t p = 0; p < n; p++) {
+        ls.pos[tour[p]] = p;
+    }
+
+    // Listas de candidatos assimetricas deixam movimentos sem cidade ativa;
+    // repete com todas as cidades ativas ate uma rodada sem melhoria
+    bool improved = true;
+    while (improved) {
+        improved = false;
+        for (size_t p = 0; p < n; p++) {
+            ls_push(&ls, tour[p]);
+        }
+        while (ls.count > 0) {
+            int city = ls_pop(&ls);
+            if (((moves & LS_MOVE_2OPT) && ls_improve_2opt(&ls, city)) ||
+                ((moves & LS_MOVE_LK) && ls_improve_lk(&ls, city)) ||
+                ((moves & LS_MOVE_OR_OPT) && ls_improve_or_opt(&ls, city))) {
+                improved = true;
+            }
+        }
+    }
+
+    free(own_cand);
+    free(ls.pos);
+    free(ls.queue);
+    free(ls.active);
+    return cost_fn(tour_data, n, context);
+}
+
+double tsp_local_search_2opt(void *tour, size_t n, ObjectiveFn objective, const void *context) {
+    return tsp_local_search_run(tour, n, objective, context, LS_MOVE_2OPT);
+}
+
+double tsp_local_search_or_opt(void *tour, size_t n, ObjectiveFn objective, const void *context) {
+    return tsp_local_search_run(tour, n, objective, context, LS_MOVE_OR_OPT);
+}
+
+double tsp_local_search(void *tour, size_t n, ObjectiveFn objective, const void *context) {
+    return tsp_local_search_run(tour, n, objective, context, LS_MOVE_2OPT | LS_MOVE_OR_OPT);
+}
+
+double tsp_local_search_lk(void *tour, size_t n, ObjectiveFn objective, const void *context) {
+    return tsp_local_search_run(tour, n, objective, context, LS_MOVE_LK | LS_MOVE_OR_OPT);
+}
+
 // ============================================================================
 // PERTURBACAO
 // ============================================================================
@@ -0,0 +1,251 @@
+/**
+ * @file checkpoint.c
+ * @brief Implementacao do formato de checkpoint
+ *
+ * A gravacao acumula o FNV-1a de cada bloco ao passar por fwrite, entao o
+ * estado nunca e montado em memoria. A leitura carrega o arquivo inteiro e
+ * confere o checksum antes de entregar qualquer byte ao algoritmo.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "optimization/checkpoint.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define CKPT_MAGIC "OPTCKPT1"
+#define CKPT_BYTE_ORDER 0x01020304u
+#define CKPT_VERSION 1u
+
+#define FNV_OFFSET 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+// Cabecalho do checkpoint: 40 bytes, seguido do estado e do checksum
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t algorithm;
+    uint32_t index_size;        // sizeof(size_t) de quem gravou
+    uint64_t fingerprint;
+    uint64_t iteration;
+} CheckpointHeader;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static uint64_t fnv_update(uint64_t hash, const void *data, size_t bytes) {
+    const unsigned char *p = data;
+    for (size_t i = 0; i < bytes; i++) {
+        hash ^= p[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+// ============================================================================
+// CONFIGURACAO
+// ============================================================================
+
+OptCheckpointConfig opt_checkpoint_none(void) {
+    OptCheckpointConfig config;
+    config.path = NULL;
+    config.interval = 0;
+    config.resume = false;
+    return config;
+}
+
+bool opt_checkpoint_due(const OptCheckpointConfig *config, size_t iteration,
+                        size_t *last_saved, bool last) {
+    if (config == NULL || config->path == NULL) return false;
+    bool due = last || (config->interval > 0 && iteration - *last_saved >= config->interval);
+    if (due) *last_saved = iteration;
+    return due;
+}
+
+uint64_t opt_checkpoint_fingerprint(const size_t *values, size_t count) {
+    uint64_t hash = FNV_OFFSET;
+    for (size_t i = 0; i < count; i++) {
+        uint64_t v = (uint64_t)values[i];
+        hash = fnv_update(hash, &v, sizeof(v));
+    }
+    return hash;
+}
+
+// ============================================================================
+// GRAVACAO
+// ============================================================================
+
+bool opt_checkpoint_write_begin(OptCheckpoint *ck, const char *path,
+                                OptCheckpointAlgorithm algorithm,
+                                uint64_t fingerprint, size_t iteration) {
+    memset(ck, 0, sizeof(OptCheckpoint));
+    if (path == NULL) return false;
+
+    size_t len = strlen(path);
+    ck->tmp_path = malloc(len + 5);
+    if (ck->tmp_path == NULL) return false;
+    memcpy(ck->tmp_path, path, len);
+    memcpy(ck->tmp_path + len, ".tmp", 5);
+
+    ck->file = fopen(ck->tmp_path, "wb");
+    if (ck->file == NULL) {
+        free(ck->tmp_path);
+        ck->tmp_path = NULL;
+        return false;
+    }
+
+    CheckpointHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CKPT_MAGIC, sizeof(header.magic));
+    header.version = CKPT_VERSION;
+    header.byte_order = CKPT_BYTE_ORDER;
+    header.algorithm = (uint32_t)algorithm;
+    header.index_size = (uint32_t)sizeof(size_t);
+    header.fingerprint = fingerprint;
+    header.iteration = iteration;
+
+    ck->ok = true;
+    ck->hash = FNV_OFFSET;
+    opt_checkpoint_write(ck, &header, sizeof(header));
+    return true;
+}
+
+void opt_checkpoint_write(OptCheckpoint *ck, const void *data, size_t bytes) {
+    if (!ck->ok || bytes == 0) return;
+    if (fwrite(data, 1, bytes, ck->file) != bytes) {
+        ck->ok = false;
+        return;
+    }
+    ck->hash = fnv_update(ck->hash, data, bytes);
+}
+
+void opt_checkpoint_write_rng(OptCheckpoint *ck, const OptRng *rng) {
+    int32_t has_spare = (int32_t)rng->has_spare;
+    opt_checkpoint_write(ck, rng->s, sizeof(rng->s));
+    opt_checkpoint_write(ck, &rng->spare, sizeof(rng->spare));
+    opt_checkpoint_write(ck, &has_spare, sizeof(has_spare));
+}
+
+void opt_checkpoint_write_history(OptCheckpoint *ck, const OptResult *result,
+                                  size_t iterations) {
+    size_t n = 0;
+    if (result->convergence != NULL && result->convergence_iterations == NULL) {
+        n = iterations < result->convergence_size ? iterations : result->convergence_size;
+    }
+    opt_checkpoint_write(ck, &n, sizeof(n));
+    if (n > 0) opt_checkpoint_write(ck, result->convergence, n * sizeof(double));
+}
+
+bool opt_checkpoint_write_end(OptCheckpoint *ck, const char *path) {
+    if (ck->file == NULL) return false;
+
+    uint64_t checksum = ck->hash;
+    bool ok = ck->ok && fwrite(&checksum, sizeof(checksum), 1, ck->file) == 1;
+    if (fclose(ck->file) != 0) ok = false;
+    ck->file = NULL;
+
+    // rename nao substitui um destino existente em todas as plataformas
+    if (ok && rename(ck->tmp_path, path) != 0) {
+        remove(path);
+        ok = rename(ck->tmp_path, path) == 0;
+    }
+    if (!ok) remove(ck->tmp_path);
+
+    free(ck->tmp_path);
+    ck->tmp_path = NULL;
+    ck->ok = ok;
+    return ok;
+}
+
+// ============================================================================
+// LEITURA
+// ============================================================================
+
+bool opt_checkpoint_read_begin(OptCheckpoint *ck, const char *path,
+                               OptCheckpointAlgorithm algorithm,
+                               uint64_t fingerprint, size_t *iteration) {
+    memset(ck, 0, sizeof(OptCheckpoint));
+    if (path == NULL) return false;
+
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return false;
+
+    long end = -1;
+    if (fseek(f, 0, SEEK_END) == 0) end = ftell(f);
+    size_t size = end > 0 ? (size_t)end : 0;
+    bool ok = size >= sizeof(CheckpointHeader) + sizeof(uint64_t) && fseek(f, 0, SEEK_SET) == 0;
+
+    unsigned char *buffer = ok ? malloc(size) : NULL;
+    ok = buffer != NULL && fread(buffer, 1, size, f) == size;
+    fclose(f);
+
+    CheckpointHeader header;
+    uint64_t checksum = 0;
+    if (ok) {
+        memcpy(&header, buffer, sizeof(header));
+        memcpy(&checksum, buffer + size - sizeof(checksum), sizeof(checksum));
+        ok = memcmp(header.magic, CKPT_MAGIC, sizeof(header.magic)) == 0 &&
+             header.version == CKPT_VERSION && header.byte_order == CKPT_BYTE_ORDER &&
+             header.index_size == sizeof(size_t) &&
+             header.algorithm == (uint32_t)algorithm &&
+             header.fingerprint == fingerprint &&
+             fnv_update(FNV_OFFSET, buffer, size - sizeof(checksum)) == checksum;
+    }
+    if (!ok) {
+        free(buffer);
+        return false;
+    }
+
+    ck->buffer = buffer;
+    ck->pos = sizeof(CheckpointHeader);
+    ck->size = size - sizeof(checksum);
+    ck->ok = true;
+    if (iteration != NULL) *iteration = (size_t)header.iteration;
+    return true;
+}
+
+bool opt_checkpoint_read(OptCheckpoint *ck, void *data, size_t bytes) {
+    if (!ck->ok || bytes > ck->size - ck->pos) {
+        ck->ok = false;
+        return false;
+    }
+    memcpy(data, ck->buffer + ck->pos, bytes);
+    ck->pos += bytes;
+    return true;
+}
+
+bool opt_checkpoint_read_rng(OptCheckpoint *ck, OptRng *rng) {
+    OptRng r;
+    int32_t has_spare = 0;
+    if (!opt_checkpoint_read(ck, r.s, sizeof(r.s)) ||
+        !opt_checkpoint_read(ck, &r.spare, sizeof(r.spare)) ||
+        !opt_checkpoint_read(ck, &has_spare, sizeof(has_spare))) {
+        return false;
+    }
+    r.has_spare = (int)has_spare;
+    *rng = r;
+    return true;
+}
+
+bool opt_checkpoint_read_history(OptCheckpoint *ck, OptResult *result) {
+    size_t n = 0;
+    if (!opt_checkpoint_read(ck, &n, sizeof(n))) return false;
+    bool full = result->convergence != NULL && result->convergence_iterations == NULL;
+    for (size_t i = 0; i < n; i++) {
+        double v;
+        if (!opt_checkpoint_read(ck, &v, sizeof(v))) return false;
+        if (full && i < result->convergence_size) result->convergence[i] = v;
+    }
+    return true;
+}
+
+bool opt_checkpoint_read_end(OptCheckpoint *ck) {
+    bool ok = ck->ok && ck->buffer != NULL && ck->pos == ck->size;
+    free(ck->buffer);
+    ck->buffer = NULL;
+    ck->ok = ok;
+    return ok;
+}
@@ -2,28 +2,33 @@
  * @file common.c
  * @brief Implementacao da infraestrutura generica para otimizacao
  *
- * Implementa criacao/destruicao de OptSolution e OptResult,
- * e utilitarios de geracao de numeros aleatorios (RNG) usando
- * estado global com srand/rand e Box-Muller para gaussianos.
+ * Implementa criacao/destruicao de OptSolution e OptResult, o pool de
+ * buffers de solucao (OptSolutionPool) e o gerador xoshiro256** (OptRng)
+ * com um stream por thread para as funcoes opt_random_*. Gaussianos pelo metodo polar de Marsaglia.
  *
  * Referencias:
- * - Box, G. E. P. & Muller, M. E. (1958). "A Note on the Generation
- *   of Random Normal Deviates"
+ * - Blackman, D. & Vigna, S. (2021). "Scrambled Linear Pseudorandom
+ *   Number Generators"
+ * - Marsaglia, G. & Bray, T. A. (1964). "A Convenient Method for
+ *   Generating Normal Variables"
  * - Knuth, D. E. (1997). TAOCP Vol. 2, Ch. 3 - Random Numbers
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
  */
 
+// clock_gettime/CLOCK_MONOTONIC (POSIX) com CMAKE_C_EXTENSIONS OFF
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "optimization/common.h"
+#include "data_structures/instrument.h"
 #include <stdlib.h>
 #include <string.h>
 #include <float.h>
 #include <math.h>
-
-#ifndef M_PI
-#define M_PI 3.14159265358979323846
-#endif
+#include <time.h>
 
 // ============================================================================
 // SOLUCAO
@@ -73,6 +78,80 @@ void opt_solution_destroy(OptSolution *sol) {
     sol->cost = DBL_MAX;
 }
 
+bool opt_solution_copy_into(OptSolution *dst, const OptSolution *src) {
+    if (dst == NULL || src == NULL || dst->data_size != src->data_size) return false;
+    if (src->data_size > 0) {
+        if (dst->data == NULL || src->data == NULL) return false;
+        memcpy(dst->data, src->data, src->data_size);
+    }
+    dst->cost = src->cost;
+    return true;
+}
+
+// ============================================================================
+// POOL DE SOLUCOES
+// ============================================================================
+
+OptSolutionPool opt_solution_pool_create(size_t data_size, size_t initial) {
+    OptSolutionPool pool;
+    memset(&pool, 0, sizeof(OptSolutionPool));
+    if (data_size == 0) return pool;
+
+    pool.capacity = (initial > 4) ? initial : 4;
+    pool.free_buffers = (void**)malloc(pool.capacity * sizeof(void*));
+    if (pool.free_buffers == NULL) {
+        pool.capacity = 0;
+        return pool;
+    }
+    pool.data_size = data_size;
+
+    for (size_t i = 0; i < initial; i++) {
+        void *buf = malloc(data_size);
+        if (buf == NULL) break;
+        pool.free_buffers[pool.num_free++] = buf;
+        pool.num_allocated++;
+    }
+    return pool;
+}
+
+void* opt_solution_pool_acquire(OptSolutionPool *pool) {
+    if (pool == NULL || pool->data_size == 0) return NULL;
+    if (pool->num_free > 0) {
+        return pool->free_buffers[--pool->num_free];
+    }
+    void *buf = malloc(pool->data_size);
+    if (buf != NULL) pool->num_allocated++;
+    return buf;
+}
+
+void opt_solution_pool_release(OptSolutionPool *pool, void *data) {
+    if (data == NULL) return;
+    if (pool == NULL || pool->data_size == 0) {
+        free(data);
+        return;
+    }
+    if (pool->num_free == pool->capacity) {
+        size_t new_cap = pool->capacity * 2;
+        void **grown = (void**)realloc(pool->free_buffers, new_cap * sizeof(void*));
+        if (grown == NULL) {
+            free(data);
+            return;
+        }
+        pool->free_buffers = grown;
+        pool->capacity = new_cap;
+    }
+    pool->free_buffers[pool->num_free++] = data;
+}
+
+void opt_solution_pool_destroy(OptSolutionPool *pool) {
+    if (pool == NULL) return;
+    for (size_t i = 0; i < pool->num_free; i++) {
+        free(pool->free_buffers[i]);
+    }
+    free(pool->free_buffers);
+    memset(pool, 0, sizeof(OptSolutionPool));
+}
+
 // ============================================================================
 // RESULTADO
 // ============================================================================
@@ -93,46 +172,411 @@ void opt_result_destroy(OptResult *result) {
     if (result == NULL) return;
     opt_solution_destroy(&result->best);
     free(result->convergence);
+    free(result->convergence_iterations);
+    free(result->island_convergence);
+    free(result->operator_stats);
     result->convergence = NULL;
+    result->convergence_iterations = NULL;
+    result->island_convergence = NULL;
+    result->operator_stats = NULL;
     result->convergence_size = 0;
+    result->num_islands = 0;
+    result->num_operators = 0;
 }
 
 // ============================================================================
-// RNG
+// AVALIACAO EM LOTE
 // ============================================================================
 
-static int g_rng_has_spare = 0;
-static double g_rng_spare = 0.0;
+size_t opt_evaluate_batch(BatchObjectiveFn batch, ObjectiveFn objective,
+                          const void *solutions, size_t count, size_t stride,
+                          size_t size, double *costs, const void *context) {
+    if (count == 0) return 0;
 
-void opt_set_seed(unsigned seed) {
-    srand(seed);
-    g_rng_has_spare = 0;
+    if (batch != NULL) {
+        batch(solutions, count, stride, size, costs, context);
+        return count;
+    }
+
+    const unsigned char *row = (const unsigned char*)solutions;
+    for (size_t i = 0; i < count; i++, row += stride) {
+        costs[i] = objective(row, size, context);
+    }
+    return count;
 }
 
-double opt_random_uniform(void) {
-    return (double)rand() / ((double)RAND_MAX + 1.0);
+double opt_wall_time_ms(void) {
+    struct timespec ts;
+    if (timespec_get(&ts, TIME_UTC) == 0) return 0.0;
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
 }
 
-int opt_random_int(int min, int max) {
+double opt_monotonic_time_ms(void) {
+#ifdef CLOCK_MONOTONIC
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) return opt_wall_time_ms();
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec / 1.0e6;
+#else
+    return opt_wall_time_ms();
+#endif
+}
+
+// ============================================================================
+// CRITERIOS DE PARADA
+// ============================================================================
+
+// Modo adaptativo: intervalo entre leituras do relogio mirando ~0.5 ms
+#define OPT_STOP_READ_PERIOD_MS 0.5
+#define OPT_STOP_MAX_INTERVAL 4096
+
+OptStopCriteria opt_stop_none(void) {
+    OptStopCriteria criteria;
+    memset(&criteria, 0, sizeof(OptStopCriteria));
+    return criteria;
+}
+
+OptStopState opt_stop_begin(const OptStopCriteria *criteria, OptDirection direction) {
+    OptStopState state;
+    memset(&state, 0, sizeof(OptStopState));
+    if (criteria != NULL) state.criteria = *criteria;
+    state.direction = direction;
+    state.interval = (state.criteria.check_interval > 0) ? state.criteria.check_interval : 1;
+    state.countdown = state.interval;
+    if (state.criteria.time_limit_ms > 0.0) {
+        state.last_read_ms = opt_monotonic_time_ms();
+        state.deadline_ms = state.last_read_ms + state.criteria.time_limit_ms;
+    }
+    return state;
+}
+
+bool opt_stop_check(OptStopState *state, size_t evaluations, double best_cost) {
+    if (state->stopped) return true;
+    const OptStopCriteria *c = &state->criteria;
+
+    if (c->max_evaluations > 0 && evaluations >= c->max_evaluations) {
+        state->stopped = true;
+    } else if (c->cancel != NULL && atomic_load_explicit(c->cancel, memory_order_relaxed)) {
+        state->stopped = true;
+    } else if (c->use_target &&
+               ((state->direction == OPT_MINIMIZE) ? (best_cost <= c->target_cost)
+                                                   : (best_cost >= c->target_cost))) {
+        state->stopped = true;
+    } else if (c->time_limit_ms > 0.0 && --state->countdown == 0) {
+        double now = opt_monotonic_time_ms();
+        if (now >= state->deadline_ms) state->stopped = true;
+
+        if (c->check_interval == 0) {
+            double gap = now - state->last_read_ms;
+            if (gap > OPT_STOP_READ_PERIOD_MS) {
+                state->interval = 1;
+            } else if (gap < 0.5 * OPT_STOP_READ_PERIOD_MS &&
+                       state->interval < OPT_STOP_MAX_INTERVAL) {
+                state->interval *= 2;
+            }
+        }
+        state->last_read_ms = now;
+        state->countdown = state->interval;
+    }
+    return state->stopped;
+}
+
+// ============================================================================
+// PROGRESSO E AMOSTRAGEM DA CONVERGENCIA
+// ============================================================================
+
+#define OPT_TRACE_DEFAULT_CAPACITY 1024
+
+OptTraceConfig opt_trace_default(void) {
+    OptTraceConfig config;
+    memset(&config, 0, sizeof(OptTraceConfig));
+    config.mode = OPT_TRACE_FULL;
+    return config;
+}
+
+OptTracer opt_tracer_begin(const OptTraceConfig *config, OptDirection direction) {
+    OptTracer tracer;
+    memset(&tracer, 0, sizeof(OptTracer));
+    tracer.config = (config != NULL) ? *config : opt_trace_default();
+    if (tracer.config.capacity == 0) tracer.config.capacity = OPT_TRACE_DEFAULT_CAPACITY;
+    tracer.direction = direction;
+    tracer.start_ms = opt_monotonic_time_ms();
+#ifdef DS_INSTRUMENT
+    tracer.start_ticks = ds_instrument_ticks();
+#endif
+    return tracer;
+}
+
+OptResult opt_tracer_create_result(const OptTracer *tracer, size_t max_iterations) {
+    switch (tracer->config.mode) {
+        case OPT_TRACE_RING: {
+            OptResult result = opt_result_create(tracer->config.capacity);
+            result.convergence_iterations = calloc(tracer->config.capacity, sizeof(size_t));
+            if (result.convergence_iterations == NULL) {
+                free(result.convergence);
+                result.convergence = NULL;
+                result.convergence_size = 0;
+            }
+            return result;
+        }
+        case OPT_TRACE_NONE:
+            return opt_result_create(0);
+        case OPT_TRACE_FULL:
+        default:
+            return opt_result_create(max_iterations);
+    }
+}
+
+static void tracer_sample(OptTracer *t, OptResult *r, size_t iteration,
+                          double best_cost, size_t evaluations) {
+    t->last_best = best_cost;
+    t->sampled_any = true;
+    t->last_sampled = true;
+
+    if (t->config.mode == OPT_TRACE_RING && r->convergence_iterations != NULL) {
+        r->convergence[t->head] = best_cost;
+        r->convergence_iterations[t->head] = iteration;
+        t->head = (t->head + 1) % t->config.capacity;
+        if (t->count < t->config.capacity) t->count++;
+    }
+
+    if (t->config.callback != NULL) {
+        OptProgress progress;
+        progress.iteration = iteration;
+        progress.evaluations = evaluations;
+        progress.best_cost = best_cost;
+        progress.elapsed_ms = opt_monotonic_time_ms() - t->start_ms;
+        t->config.callback(&progress, t->config.user_data);
+    }
+}
+
+void opt_tracer_record(OptTracer *tracer, OptResult *result, size_t iteration,
+                       double best_cost, size_t evaluations) {
+    const OptTraceConfig *c = &tracer->config;
+    if (c->mode == OPT_TRACE_FULL && result->convergence != NULL &&
+        iteration < result->convergence_size) {
+        result->convergence[iteration] = best_cost;
+    }
+
+    tracer->seen = true;
+    tracer->last_iteration = iteration;
+    tracer->last_evaluations = evaluations;
+    tracer->last_cost = best_cost;
+    tracer->last_sampled = false;
+    if (c->mode == OPT_TRACE_FULL && c->callback == NULL) return;
+
+    bool sample;
+    if (c->on_improvement) {
+        sample = !tracer->sampled_any ||
+                 ((tracer->direction == OPT_MINIMIZE) ? (best_cost < tracer->last_best)
+                                                      : (best_cost > tracer->last_best));
+    } else {
+        sample = c->every <= 1 || (iteration + 1) % c->every == 0;
+    }
+    if (sample) tracer_sample(tracer, result, iteration, best_cost, evaluations);
+}
+
+// Inverte [lo, hi) dos dois arrays do anel
+static void ring_reverse(double *costs, size_t *iters, size_t lo, size_t hi) {
+    while (lo + 1 < hi) {
+        hi--;
+        double c = costs[lo]; costs[lo] = costs[hi]; costs[hi] = c;
+        size_t it = iters[lo]; iters[lo] = iters[hi]; iters[hi] = it;
+        lo++;
+    }
+}
+
+void opt_tracer_finish(OptTracer *tracer, OptResult *result) {
+    const OptTraceConfig *c = &tracer->config;
+    DS_COUNT(OPTIMIZATION, EVALUATIONS, tracer->last_evaluations);
+    DS_TIMER_END(OPT_RUN, tracer->start_ticks);
+    if (tracer->seen && !tracer->last_sampled &&
+        (c->mode != OPT_TRACE_FULL || c->callback != NULL)) {
+        tracer_sample(tracer, result, tracer->last_iteration,
+                      tracer->last_cost, tracer->last_evaluations);
+    }
+
+    if (c->mode != OPT_TRACE_RING || result->convergence_iterations == NULL) return;
+
+    // Anel cheio: rotaciona para a amostra mais antiga ficar em [0]
+    if (tracer->count == c->capacity && tracer->head != 0) {
+        ring_reverse(result->convergence, result->convergence_iterations, 0, tracer->head);
+        ring_reverse(result->convergence, result->convergence_iterations,
+                     tracer->head, c->capacity);
+        ring_reverse(result->convergence, result->convergence_iterations, 0, c->capacity);
+    }
+    tracer->head = tracer->count % c->capacity;
+    result->convergence_size = tracer->count;
+}
+
+// ============================================================================
+// RNG (xoshiro256**)
+// ============================================================================
+
+static inline uint64_t rotl64(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void opt_rng_seed(OptRng *rng, uint64_t seed) {
+    if (rng == NULL) return;
+    uint64_t sm = seed;
+    for (int i = 0; i < 4; i++) {
+        rng->s[i] = splitmix64(&sm);
+    }
+    rng->spare = 0.0;
+    rng->has_spare = 0;
+}
+
+uint64_t opt_rng_next(OptRng *rng) {
+    uint64_t *s = rng->s;
+    const uint64_t result = rotl64(s[1] * 5, 7) * 9;
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl64(s[3], 45);
+
+    return result;
+}
+
+void opt_rng_jump(OptRng *rng) {
+    static const uint64_t JUMP[4] = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+        0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+    };
+
+    uint64_t acc[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+            if (JUMP[i] & ((uint64_t)1 << b)) {
+                for (int k = 0; k < 4; k++) acc[k] ^= rng->s[k];
+            }
+            opt_rng_next(rng);
+        }
+    }
+    memcpy(rng->s, acc, sizeof(acc));
+    rng->has_spare = 0;
+}
+
+double opt_rng_uniform(OptRng *rng) {
+    return (double)(opt_rng_next(rng) >> 11) * 0x1.0p-53;
+}
+
+int opt_rng_int(OptRng *rng, int min, int max) {
     if (min >= max) return min;
-    return min + (int)(opt_random_uniform() * (max - min + 1));
+
+    // Lemire: multiplicacao 64x64->128 so com rejeicao no intervalo enviesado
+    uint64_t range = (uint64_t)((int64_t)max - (int64_t)min) + 1;
+    uint64_t x = opt_rng_next(rng) >> 32;
+    if (range > UINT32_MAX) return (int)((int64_t)min + (int64_t)x);
+
+    uint64_t m = x * range;
+    uint32_t low = (uint32_t)m;
+    if (low < range) {
+        uint32_t threshold = (uint32_t)(-(uint32_t)range) % (uint32_t)range;
+        while (low < threshold) {
+            x = opt_rng_next(rng) >> 32;
+            m = x * range;
+            low = (uint32_t)m;
+        }
+    }
+    return (int)((int64_t)min + (int64_t)(m >> 32));
 }
 
-double opt_random_gaussian(void) {
-    if (g_rng_has_spare) {
-        g_rng_has_spare = 0;
-        return g_rng_spare;
+double opt_rng_gaussian(OptRng *rng) {
+    if (rng->has_spare) {
+        rng->has_spare = 0;
+        return rng->spare;
     }
 
     double u, v, s;
     do {
-        u = opt_random_uniform() * 2.0 - 1.0;
-        v = opt_random_uniform() * 2.0 - 1.0;
+        u = opt_rng_uniform(rng) * 2.0 - 1.0;
+        v = opt_rng_uniform(rng) * 2.0 - 1.0;
         s = u * u + v * v;
     } while (s >= 1.0 || s == 0.0);
 
     double mul = sqrt(-2.0 * log(s) / s);
-    g_rng_spare = v * mul;
-    g_rng_has_spare = 1;
+    rng->spare = v * mul;
+    rng->has_spare = 1;
     return u * mul;
 }
+
+void opt_rng_fill_uniform(OptRng *rng, double *out, size_t n, double lo, double hi) {
+    if (rng == NULL || out == NULL) return;
+    double range = hi - lo;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = lo + (double)(opt_rng_next(rng) >> 11) * 0x1.0p-53 * range;
+    }
+}
+
+void opt_rng_fill_gaussian(OptRng *rng, double *out, size_t n) {
+    if (rng == NULL || out == NULL) return;
+    size_t i = 0;
+    if (n > 0 && rng->has_spare) {
+        out[i++] = opt_rng_gaussian(rng);
+    }
+
+    // Usa os dois valores de cada par polar diretamente
+    for (; i + 1 < n; i += 2) {
+        double u, v, s;
+        do {
+            u = opt_rng_uniform(rng) * 2.0 - 1.0;
+            v = opt_rng_uniform(rng) * 2.0 - 1.0;
+            s = u * u + v * v;
+        } while (s >= 1.0 || s == 0.0);
+
+        double mul = sqrt(-2.0 * log(s) / s);
+        out[i] = u * mul;
+        out[i + 1] = v * mul;
+    }
+    if (i < n) {
+        out[i] = opt_rng_gaussian(rng);
+    }
+}
+
+// ============================================================================
+// STREAM DA THREAD
+// ============================================================================
+
+static _Thread_local OptRng t_rng;
+static _Thread_local int t_rng_ready = 0;
+
+OptRng* opt_rng_thread(void) {
+    if (!t_rng_ready) {
+        opt_rng_seed(&t_rng, 1);
+        t_rng_ready = 1;
+    }
+    return &t_rng;
+}
+
+OptRng* opt_rng_select(OptRng *rng, unsigned seed) {
+    opt_set_seed(seed);
+    return rng != NULL ? rng : opt_rng_thread();
+}
+
+void opt_set_seed(unsigned seed) {
+    opt_rng_seed(&t_rng, seed);
+    t_rng_ready = 1;
+}
+
+double opt_random_uniform(void) {
+    return opt_rng_uniform(opt_rng_thread());
+}
+
+int opt_random_int(int min, int max) {
+    return opt_rng_int(opt_rng_thread(), min, max);
+}
+
+double opt_random_gaussian(void) {
+    return opt_rng_gaussian(opt_rng_thread());
+}
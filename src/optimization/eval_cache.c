@@ -0,0 +1,270 @@
+/**
+ * @file eval_cache.c
+ * @brief Implementacao do cache LRU de avaliacoes
+ *
+ * As entradas ficam em vetores de tamanho fixo (capacity), com as copias
+ * das solucoes num unico bloco contiguo. Cada entrada pertence a uma
+ * cadeia de colisao (buckets em potencia de 2, indexados pelos bits baixos
+ * do hash) e a lista duplamente encadeada de recencia (head = mais
+ * recente, tail = proxima a sair). Nenhuma alocacao apos a criacao.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "optimization/eval_cache.h"
+#include "optimization/metaheuristics/tabu_search.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CACHE_NONE ((size_t)-1)
+
+// ============================================================================
+// ESTRUTURA
+// ============================================================================
+
+typedef struct {
+    uint64_t hash;
+    double cost;
+    size_t chain_next;    // proxima entrada do mesmo bucket
+    size_t prev;          // mais recente
+    size_t next;          // menos recente
+} CacheEntry;
+
+struct OptEvalCache {
+    ObjectiveFn objective;
+    const void *context;
+    size_t data_size;
+    size_t capacity;
+    size_t count;
+    CacheEntry *entries;
+    unsigned char *data;  // capacity * data_size
+    size_t *buckets;      // cabeca da cadeia de cada bucket
+    size_t bucket_mask;
+    size_t head;
+    size_t tail;
+    size_t hits;
+    size_t misses;
+    pthread_mutex_t lock;
+};
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static void cache_lock(OptEvalCache *c) {
+    pthread_mutex_lock(&c->lock);
+}
+
+static void cache_unlock(OptEvalCache *c) {
+    pthread_mutex_unlock(&c->lock);
+}
+
+static unsigned char* entry_data(const OptEvalCache *c, size_t idx) {
+    return c->data + idx * c->data_size;
+}
+
+static void lru_unlink(OptEvalCache *c, size_t idx) {
+    CacheEntry *e = &c->entries[idx];
+    if (e->prev != CACHE_NONE) c->entries[e->prev].next = e->next;
+    else c->head = e->next;
+    if (e->next != CACHE_NONE) c->entries[e->next].prev = e->prev;
+    else c->tail = e->prev;
+}
+
+static void lru_push_front(OptEvalCache *c, size_t idx) {
+    CacheEntry *e = &c->entries[idx];
+    e->prev = CACHE_NONE;
+    e->next = c->head;
+    if (c->head != CACHE_NONE) c->entries[c->head].prev = idx;
+    c->head = idx;
+    if (c->tail == CACHE_NONE) c->tail = idx;
+}
+
+static void chain_remove(OptEvalCache *c, size_t idx) {
+    size_t *link = &c->buckets[c->entries[idx].hash & c->bucket_mask];
+    while (*link != idx) {
+        link = &c->entries[*link].chain_next;
+    }
+    *link = c->entries[idx].chain_next;
+}
+
+// Entrada com o mesmo hash e os mesmos bytes, ou CACHE_NONE
+static size_t cache_find(const OptEvalCache *c, uint64_t hash, const void *solution) {
+    size_t idx = c->buckets[hash & c->bucket_mask];
+    while (idx != CACHE_NONE) {
+        const CacheEntry *e = &c->entries[idx];
+        if (e->hash == hash && memcmp(entry_data(c, idx), solution, c->data_size) == 0) {
+            return idx;
+        }
+        idx = e->chain_next;
+    }
+    return CACHE_NONE;
+}
+
+// Insere no topo; cheio, reaproveita a entrada menos recente
+static void cache_insert(OptEvalCache *c, uint64_t hash, const void *solution, double cost) {
+    size_t idx;
+    if (c->count < c->capacity) {
+        idx = c->count++;
+    } else {
+        idx = c->tail;
+        lru_unlink(c, idx);
+        chain_remove(c, idx);
+    }
+
+    CacheEntry *e = &c->entries[idx];
+    e->hash = hash;
+    e->cost = cost;
+    memcpy(entry_data(c, idx), solution, c->data_size);
+
+    size_t bucket = hash & c->bucket_mask;
+    e->chain_next = c->buckets[bucket];
+    c->buckets[bucket] = idx;
+    lru_push_front(c, idx);
+}
+
+// ============================================================================
+// CRIACAO E DESTRUICAO
+// ============================================================================
+
+OptEvalCache* opt_eval_cache_create(size_t capacity, size_t data_size,
+                                    ObjectiveFn objective, const void *context) {
+    if (capacity == 0 || data_size == 0 || objective == NULL) return NULL;
+
+    OptEvalCache *c = (OptEvalCache*)calloc(1, sizeof(OptEvalCache));
+    if (c == NULL) return NULL;
+
+    // Fator de carga <= 1/2
+    size_t num_buckets = 2;
+    while (num_buckets < 2 * capacity) num_buckets <<= 1;
+
+    c->entries = (CacheEntry*)malloc(capacity * sizeof(CacheEntry));
+    c->data = (unsigned char*)malloc(capacity * data_size);
+    c->buckets = (size_t*)malloc(num_buckets * sizeof(size_t));
+    if (c->entries == NULL || c->data == NULL || c->buckets == NULL ||
+        pthread_mutex_init(&c->lock, NULL) != 0) {
+        free(c->entries);
+        free(c->data);
+        free(c->buckets);
+        free(c);
+        return NULL;
+    }
+
+    c->objective = objective;
+    c->context = context;
+    c->data_size = data_size;
+    c->capacity = capacity;
+    c->bucket_mask = num_buckets - 1;
+    opt_eval_cache_clear(c);
+    return c;
+}
+
+void opt_eval_cache_destroy(OptEvalCache *cache) {
+    if (cache == NULL) return;
+    pthread_mutex_destroy(&cache->lock);
+    free(cache->entries);
+    free(cache->data);
+    free(cache->buckets);
+    free(cache);
+}
+
+void opt_eval_cache_clear(OptEvalCache *cache) {
+    if (cache == NULL) return;
+    for (size_t b = 0; b <= cache->bucket_mask; b++) {
+        cache->buckets[b] = CACHE_NONE;
+    }
+    cache->count = 0;
+    cache->head = CACHE_NONE;
+    cache->tail = CACHE_NONE;
+    cache->hits = 0;
+    cache->misses = 0;
+}
+
+// ============================================================================
+// AVALIACAO
+// ============================================================================
+
+double opt_eval_cache_objective(const void *solution_data, size_t size,
+                                const void *cache) {
+    OptEvalCache *c = (OptEvalCache*)cache;
+    uint64_t hash = ts_hash_bytes(solution_data, c->data_size);
+
+    cache_lock(c);
+    size_t idx = cache_find(c, hash, solution_data);
+    if (idx != CACHE_NONE) {
+        double cost = c->entries[idx].cost;
+        lru_unlink(c, idx);
+        lru_push_front(c, idx);
+        c->hits++;
+        cache_unlock(c);
+        return cost;
+    }
+    c->misses++;
+    cache_unlock(c);
+
+    // Avaliacao fora do lock: outras threads seguem consultando o cache
+    double cost = c->objective(solution_data, size, c->context);
+
+    cache_lock(c);
+    // Outra thread pode ter inserido a mesma solucao enquanto avaliavamos
+    if (cache_find(c, hash, solution_data) == CACHE_NONE) {
+        cache_insert(c, hash, solution_data, cost);
+    }
+    cache_unlock(c);
+    return cost;
+}
+
+bool opt_eval_cache_lookup(OptEvalCache *cache, const void *solution_data, double *cost) {
+    if (cache == NULL || solution_data == NULL) return false;
+    uint64_t hash = ts_hash_bytes(solution_data, cache->data_size);
+
+    cache_lock(cache);
+    size_t idx = cache_find(cache, hash, solution_data);
+    if (idx != CACHE_NONE) {
+        if (cost != NULL) *cost = cache->entries[idx].cost;
+        lru_unlink(cache, idx);
+        lru_push_front(cache, idx);
+    }
+    cache_unlock(cache);
+    return idx != CACHE_NONE;
+}
+
+void opt_eval_cache_store(OptEvalCache *cache, const void *solution_data, double cost) {
+    if (cache == NULL || solution_data == NULL) return;
+    uint64_t hash = ts_hash_bytes(solution_data, cache->data_size);
+
+    cache_lock(cache);
+    size_t idx = cache_find(cache, hash, solution_data);
+    if (idx != CACHE_NONE) {
+        cache->entries[idx].cost = cost;
+        lru_unlink(cache, idx);
+        lru_push_front(cache, idx);
+    } else {
+        cache_insert(cache, hash, solution_data, cost);
+    }
+    cache_unlock(cache);
+}
+
+// ============================================================================
+// ESTATISTICAS
+// ============================================================================
+
+size_t opt_eval_cache_hits(const OptEvalCache *cache) {
+    return (cache != NULL) ? cache->hits : 0;
+}
+
+size_t opt_eval_cache_misses(const OptEvalCache *cache) {
+    return (cache != NULL) ? cache->misses : 0;
+}
+
+size_t opt_eval_cache_size(const OptEvalCache *cache) {
+    return (cache != NULL) ? cache->count : 0;
+}
+
+void opt_eval_cache_report(const OptEvalCache *cache, OptResult *result) {
+    if (cache == NULL || result == NULL) return;
+    result->num_evaluations = cache->misses;
+    result->num_cache_hits = cache->hits;
+}
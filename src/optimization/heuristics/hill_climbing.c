@@ -4,6 +4,9 @@
  *
  * Quatro variantes: Steepest, First Improvement, Random Restart, Stochastic.
  * Todas genericas via void* + ObjectiveFn + NeighborFn + GenerateFn.
+ * Steepest e first improvement avaliam a vizinhanca por amostragem (com
+ * saida antecipada para n grande) ou por varredura completa de deltas
+ * (NeighborhoodScanFn).
  *
  * Referencias:
  * - Russell, S. & Norvig, P. (2010). Artificial Intelligence, Ch. 4.1
@@ -28,6 +31,55 @@ static bool is_better(double a, double b, OptDirection dir) {
     return (dir == OPT_MINIMIZE) ? (a < b) : (a > b);
 }
 
+static bool uses_moves(const HCConfig *config) {
+    return config->move_delta != NULL && config->move_apply != NULL;
+}
+
+static bool uses_scan(const HCConfig *config) {
+    return config->neighborhood_scan != NULL && config->move_apply != NULL;
+}
+
+// Amostras grandes o bastante para pagar a saida antecipada
+static bool early_exit(const HCConfig *config, size_t solution_size) {
+    return config->early_exit_min_size > 0 && solution_size >= config->early_exit_min_size;
+}
+
+static void record_iteration(OptResult *result, size_t iter) {
+    if (result->convergence != NULL && iter < result->convergence_size) {
+        result->convergence[iter] = result->best.cost;
+    }
+    result->num_iterations = iter + 1;
+}
+
+// Uma varredura de neighborhood_scan; aplica o movimento se melhorar.
+// cursor guarda onde a proxima varredura first-improvement recomeca.
+static bool scan_step(const HCConfig *config, void *current, size_t solution_size,
+                      double *current_cost, bool first_improvement, size_t *cursor,
+                      OptResult *result, const void *context) {
+    OptScan scan;
+    memset(&scan, 0, sizeof(scan));
+    scan.direction = config->direction;
+    scan.first_improvement = first_improvement;
+    scan.start = *cursor;
+
+    bool improved = config->neighborhood_scan(current, solution_size, &scan, context);
+    result->num_evaluations += scan.evaluations;
+    if (!improved) return false;
+
+    config->move_apply(current, solution_size, &scan.move, context);
+    *current_cost += scan.delta;
+    *cursor = scan.move.i;
+    return true;
+}
+
+// Custo acumulado por deltas deriva; recalcula o da melhor solucao no fim
+static void resync_best_cost(OptResult *result, size_t solution_size,
+                             ObjectiveFn objective, const void *context) {
+    if (result->best.data == NULL) return;
+    result->best.cost = objective(result->best.data, solution_size, context);
+    result->num_evaluations++;
+}
+
 // ============================================================================
 // CONFIGURACAO
 // ============================================================================
@@ -39,8 +91,13 @@ HCConfig hc_default_config(void) {
     config.neighbors_per_iter = 20;
     config.num_restarts = 10;
     config.stochastic_temperature = 1.0;
+    config.move_delta = NULL;
+    config.move_apply = NULL;
+    config.neighborhood_scan = NULL;
+    config.early_exit_min_size = 1000;
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
     return config;
 }
 
@@ -77,11 +134,44 @@ OptResult hc_steepest(const HCConfig *config,
     memcpy(result.best.data, current, element_size);
     result.best.cost = current_cost;
 
+    bool moves = uses_moves(config);
+    bool scan = uses_scan(config);
+    bool exit_early = early_exit(config, solution_size);
+    size_t cursor = 0;
+    OptMove best_move = {0, 0, 0, 0};
+
     for (size_t iter = 0; iter < config->max_iterations; iter++) {
+        if (scan) {
+            bool improved = scan_step(config, current, solution_size, &current_cost,
+                                      exit_early, &cursor, &result, context);
+            if (improved && is_better(current_cost, result.best.cost, config->direction)) {
+                memcpy(result.best.data, current, element_size);
+                result.best.cost = current_cost;
+            }
+            record_iteration(&result, iter);
+            if (!improved) break;
+            continue;
+        }
+
         double best_nb_cost = (config->direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
         bool found_better = false;
 
         for (size_t k = 0; k < config->neighbors_per_iter; k++) {
+            if (moves) {
+                OptMove move;
+                double cand_cost = current_cost +
+                                   config->move_delta(current, solution_size, &move, context);
+                result.num_evaluations++;
+
+                if (is_better(cand_cost, best_nb_cost, config->direction)) {
+                    best_nb_cost = cand_cost;
+                    best_move = move;
+                    found_better = true;
+                }
+                if (exit_early && is_better(best_nb_cost, current_cost, config->direction)) break;
+                continue;
+            }
+
             neighbor(current, candidate, solution_size, context);
             double cand_cost = objective(candidate, solution_size, context);
             result.num_evaluations++;
@@ -91,10 +181,15 @@ OptResult hc_steepest(const HCConfig *config,
                 memcpy(best_neighbor_data, candidate, element_size);
                 found_better = true;
             }
+            if (exit_early && is_better(best_nb_cost, current_cost, config->direction)) break;
         }
 
         if (found_better && is_better(best_nb_cost, current_cost, config->direction)) {
-            memcpy(current, best_neighbor_data, element_size);
+            if (moves) {
+                config->move_apply(current, solution_size, &best_move, context);
+            } else {
+                memcpy(current, best_neighbor_data, element_size);
+            }
             current_cost = best_nb_cost;
 
             if (is_better(current_cost, result.best.cost, config->direction)) {
@@ -102,19 +197,15 @@ OptResult hc_steepest(const HCConfig *config,
                 result.best.cost = current_cost;
             }
         } else {
-            if (result.convergence != NULL && iter < result.convergence_size) {
-                result.convergence[iter] = result.best.cost;
-            }
-            result.num_iterations = iter + 1;
+            record_iteration(&result, iter);
             break;
         }
 
-        if (result.convergence != NULL && iter < result.convergence_size) {
-            result.convergence[iter] = result.best.cost;
-        }
-        result.num_iterations = iter + 1;
+        record_iteration(&result, iter);
     }
 
+    if (moves || scan) resync_best_cost(&result, solution_size, objective, context);
+
     free(current);
     free(candidate);
     free(best_neighbor_data);
@@ -152,10 +243,33 @@ OptResult hc_first_improvement(const HCConfig *config,
     memcpy(result.best.data, current, element_size);
     result.best.cost = current_cost;
 
+    bool moves = uses_moves(config);
+    bool scan = uses_scan(config);
+    size_t cursor = 0;
+
     for (size_t iter = 0; iter < config->max_iterations; iter++) {
         bool improved = false;
 
-        for (size_t k = 0; k < config->neighbors_per_iter; k++) {
+        if (scan) {
+            improved = scan_step(config, current, solution_size, &current_cost,
+                                 true, &cursor, &result, context);
+        }
+        for (size_t k = 0; !scan && k < config->neighbors_per_iter; k++) {
+            if (moves) {
+                OptMove move;
+                double cand_cost = current_cost +
+                                   config->move_delta(current, solution_size, &move, context);
+                result.num_evaluations++;
+
+                if (is_better(cand_cost, current_cost, config->direction)) {
+                    config->move_apply(current, solution_size, &move, context);
+                    current_cost = cand_cost;
+                    improved = true;
+                    break;
+                }
+                continue;
+            }
+
             neighbor(current, candidate, solution_size, context);
             double cand_cost = objective(candidate, solution_size, context);
             result.num_evaluations++;
@@ -169,10 +283,7 @@ OptResult hc_first_improvement(const HCConfig *config,
         }
 
         if (!improved) {
-            if (result.convergence != NULL && iter < result.convergence_size) {
-                result.convergence[iter] = result.best.cost;
-            }
-            result.num_iterations = iter + 1;
+            record_iteration(&result, iter);
             break;
         }
 
@@ -181,12 +292,11 @@ OptResult hc_first_improvement(const HCConfig *config,
             result.best.cost = current_cost;
         }
 
-        if (result.convergence != NULL && iter < result.convergence_size) {
-            result.convergence[iter] = result.best.cost;
-        }
-        result.num_iterations = iter + 1;
+        record_iteration(&result, iter);
     }
 
+    if (moves || scan) resync_best_cost(&result, solution_size, objective, context);
+
     free(current);
     free(candidate);
     return result;
@@ -257,7 +367,7 @@ OptResult hc_stochastic(const HCConfig *config,
                         GenerateFn generate,
                         const void *context) {
     OptResult result = opt_result_create(config->max_iterations);
-    opt_set_seed(config->seed);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
 
     void *current = malloc(element_size);
     void *candidate = malloc(element_size);
@@ -278,9 +388,17 @@ OptResult hc_stochastic(const HCConfig *config,
 
     double temp = config->stochastic_temperature;
 
+    bool moves = uses_moves(config);
+    OptMove move = {0, 0, 0, 0};
+
     for (size_t iter = 0; iter < config->max_iterations; iter++) {
-        neighbor(current, candidate, solution_size, context);
-        double cand_cost = objective(candidate, solution_size, context);
+        double cand_cost;
+        if (moves) {
+            cand_cost = current_cost + config->move_delta(current, solution_size, &move, context);
+        } else {
+            neighbor(current, candidate, solution_size, context);
+            cand_cost = objective(candidate, solution_size, context);
+        }
         result.num_evaluations++;
 
         bool accept = false;
@@ -289,13 +407,17 @@ OptResult hc_stochastic(const HCConfig *config,
         } else if (temp > 1e-15) {
             double delta = fabs(cand_cost - current_cost);
             double prob = exp(-delta / temp);
-            if (opt_random_uniform() < prob) {
+            if (opt_rng_uniform(rng) < prob) {
                 accept = true;
             }
         }
 
         if (accept) {
-            memcpy(current, candidate, element_size);
+            if (moves) {
+                config->move_apply(current, solution_size, &move, context);
+            } else {
+                memcpy(current, candidate, element_size);
+            }
             current_cost = cand_cost;
 
             if (is_better(current_cost, result.best.cost, config->direction)) {
@@ -304,12 +426,11 @@ OptResult hc_stochastic(const HCConfig *config,
             }
         }
 
-        if (result.convergence != NULL && iter < result.convergence_size) {
-            result.convergence[iter] = result.best.cost;
-        }
-        result.num_iterations = iter + 1;
+        record_iteration(&result, iter);
     }
 
+    if (moves) resync_best_cost(&result, solution_size, objective, context);
+
     free(current);
     free(candidate);
     return result;
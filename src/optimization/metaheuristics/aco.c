@@ -3,7 +3,11 @@
  * @brief Implementacao do Ant Colony Optimization (ACO)
  *
  * ACO com variantes AS, Elitist AS e MAX-MIN AS.
- * Solucoes construidas probabilisticamente usando feromonio + heuristica.
+ * Solucoes construidas probabilisticamente usando feromonio + heuristica,
+ * com a matriz choice-info (tau^alpha * eta^beta) em cache e formigas
+ * construidas em paralelo (pool global), cada uma com seu stream. Para
+ * instancias grandes, listas de candidatos restringem construcao,
+ * feromonio e memoria a O(n*k).
  *
  * Referencias:
  * - Dorigo, M. & Stutzle, T. (2004). Ant Colony Optimization. MIT Press.
@@ -15,10 +19,14 @@
 
 #include "optimization/metaheuristics/aco.h"
 #include "optimization/benchmarks/tsp.h"
+#include "data_structures/large_alloc.h"
+#include "data_structures/thread_pool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <float.h>
+#include <stdint.h>
+
 
 // ============================================================================
 // HELPERS
@@ -28,69 +36,253 @@ static bool aco_is_better(double a, double b, OptDirection dir) {
     return (dir == OPT_MINIMIZE) ? (a < b) : (a > b);
 }
 
-static void construct_solution(int *tour, size_t n, double **tau,
-                               ACOHeuristicFn heuristic, double alpha,
-                               double beta, const void *context) {
-    bool *visited = calloc(n, sizeof(bool));
-    if (visited == NULL) {
-        for (size_t i = 0; i < n; i++) tour[i] = (int)i;
-        return;
+// Modelo de feromonio: n linhas de cols entradas em buffers contiguos.
+// Varredura completa: cols = n e a coluna j e o proprio destino. Listas de
+// candidatos: cols = k e a coluna c da linha i vai para cand[i*k + c].
+// choice = tau^alpha * eta^beta e recalculada uma vez por iteracao (apos o
+// deposito), tirando pow() e heuristic() da construcao. As tres matrizes
+// sao lidas por todas as formigas: huge pages e paginas intercaladas.
+typedef struct {
+    size_t n;
+    size_t cols;
+    const int *cand;     // NULL = varredura completa
+    int *own_cand;       // Listas construidas por eta (liberadas no fim)
+    double *tau;
+    double *eta_beta;
+    double *choice;
+} ACOModel;
+
+static void model_free(ACOModel *m) {
+    size_t count = m->n * m->cols;
+    free(m->own_cand);
+    ds_large_free(m->tau, count, sizeof(double));
+    ds_large_free(m->eta_beta, count, sizeof(double));
+    ds_large_free(m->choice, count, sizeof(double));
+}
+
+typedef struct {
+    size_t n, k;
+    ACOHeuristicFn heuristic;
+    const void *context;
+    double *eta;
+    int *lists;
+} CandidateJob;
+
+static void candidates_range(void *ctx, size_t lo, size_t hi) {
+    const CandidateJob *job = ctx;
+    size_t n = job->n, k = job->k;
+    for (size_t i = lo; i < hi; i++) {
+        int *list = job->lists + i * k;
+        double *best = job->eta + i * k;
+        size_t count = 0;
+        for (size_t j = 0; j < n; j++) {
+            if (j == i) continue;
+            double e = job->heuristic(i, j, job->context);
+            if (count == k && e <= best[k - 1]) continue;
+            size_t pos = (count < k) ? count++ : k - 1;
+            while (pos > 0 && best[pos - 1] < e) {
+                best[pos] = best[pos - 1];
+                list[pos] = list[pos - 1];
+                pos--;
+            }
+            best[pos] = e;
+            list[pos] = (int)j;
+        }
     }
+}
 
-    int start = opt_random_int(0, (int)(n - 1));
-    tour[0] = start;
-    visited[start] = true;
+// k destinos de maior eta(i, .) por linha, em ordem decrescente; eta sai em
+// eta[i*k + c]
+static int* candidates_by_eta(size_t n, size_t k, ACOHeuristicFn heuristic,
+                              const void *context, double *eta, size_t threads) {
+    int *lists = malloc(n * k * sizeof(int));
+    if (lists == NULL) return NULL;
 
-    double *probs = malloc(n * sizeof(double));
-    if (probs == NULL) {
-        for (size_t i = 1; i < n; i++) {
+    CandidateJob job = { n, k, heuristic, context, eta, lists };
+    ds_parallel_for_threads(threads, 0, n, 64, candidates_range, &job);
+    return lists;
+}
+
+static bool model_init(ACOModel *m, const ACOConfig *config, size_t n,
+                       ACOHeuristicFn heuristic, const void *context, size_t threads) {
+    memset(m, 0, sizeof(ACOModel));
+    m->n = n;
+    m->cols = n;
+
+    size_t k = config->candidate_k;
+    if (k > n - 1) k = n - 1;
+    if (k > 0 && k < n - 1) m->cols = k;
+
+    size_t count = n * m->cols;
+    m->tau = ds_large_calloc(count, sizeof(double));
+    m->eta_beta = ds_large_calloc(count, sizeof(double));
+    m->choice = ds_large_calloc(count, sizeof(double));
+    if (m->tau == NULL || m->eta_beta == NULL || m->choice == NULL) {
+        model_free(m);
+        return false;
+    }
+
+    if (m->cols < n) {
+        if (config->candidate_lists != NULL && config->candidate_k == m->cols) {
+            m->cand = config->candidate_lists;
+            for (size_t i = 0; i < n; i++) {
+                for (size_t c = 0; c < k; c++) {
+                    m->eta_beta[i * k + c] = heuristic(i, (size_t)m->cand[i * k + c], context);
+                }
+            }
+        } else {
+            m->own_cand = candidates_by_eta(n, k, heuristic, context, m->eta_beta, threads);
+            if (m->own_cand == NULL) {
+                model_free(m);
+                return false;
+            }
+            m->cand = m->own_cand;
+        }
+        for (size_t i = 0; i < count; i++) {
+            m->eta_beta[i] = pow(m->eta_beta[i], config->beta);
+        }
+    } else {
+        for (size_t i = 0; i < n; i++) {
             for (size_t j = 0; j < n; j++) {
-                if (!visited[j]) { tour[i] = (int)j; visited[j] = true; break; }
+                m->eta_beta[i * n + j] = (i == j) ? 0.0 : pow(heuristic(i, j, context), config->beta);
             }
         }
-        free(visited);
-        return;
     }
 
+    for (size_t i = 0; i < count; i++) {
+        m->tau[i] = config->tau_0;
+    }
+    return true;
+}
+
+// Coluna da aresta (from, to) na linha from, ou SIZE_MAX fora da lista
+static size_t model_slot(const ACOModel *m, size_t from, size_t to) {
+    if (m->cand == NULL) return from * m->n + to;
+    const int *list = m->cand + from * m->cols;
+    for (size_t c = 0; c < m->cols; c++) {
+        if ((size_t)list[c] == to) return from * m->cols + c;
+    }
+    return SIZE_MAX;
+}
+
+// Arestas fora das listas de candidatos nao guardam feromonio
+static void deposit_tour(ACOModel *m, const int *tour, double amount) {
+    size_t n = m->n;
+    for (size_t s = 0; s < n; s++) {
+        size_t from = (size_t)tour[s];
+        size_t to = (size_t)tour[(s + 1) % n];
+        size_t a = model_slot(m, from, to);
+        size_t b = model_slot(m, to, from);
+        if (a != SIZE_MAX) m->tau[a] += amount;
+        if (b != SIZE_MAX) m->tau[b] += amount;
+    }
+}
+
+// Roleta sobre probs[0..count); -1 se a soma e nula
+static int roulette(OptRng *rng, const double *probs, size_t count, double total) {
+    if (total <= 1e-15) return -1;
+    double r = opt_rng_uniform(rng) * total;
+    double cum = 0;
+    for (size_t c = 0; c < count; c++) {
+        if (probs[c] > 0) {
+            cum += probs[c];
+            if (cum >= r) return (int)c;
+        }
+    }
+    return -1;
+}
+
+// Constroi um tour pela roleta sobre as linhas de choice. Com listas de
+// candidatos, se todos os candidatos ja foram visitados vai para o nao
+// visitado de maior heuristica (varredura O(n), como no MMAS/ACS).
+// probs (cols doubles) e visited (n bytes) sao scratch da formiga.
+static void construct_solution(OptRng *rng, int *tour, const ACOModel *m,
+                               double *probs, unsigned char *visited,
+                               ACOHeuristicFn heuristic, const void *context) {
+    size_t n = m->n;
+    size_t cols = m->cols;
+    memset(visited, 0, n);
+
+    int start = opt_rng_int(rng, 0, (int)(n - 1));
+    tour[0] = start;
+    visited[start] = 1;
+
     for (size_t step = 1; step < n; step++) {
-        int current = tour[step - 1];
+        size_t current = (size_t)tour[step - 1];
+        const double *row = m->choice + current * cols;
         double total = 0;
+        int chosen;
 
-        for (size_t j = 0; j < n; j++) {
-            if (visited[j]) {
-                probs[j] = 0;
-            } else {
-                double t = pow(tau[current][j], alpha);
-                double h = pow(heuristic((size_t)current, j, context), beta);
-                probs[j] = t * h;
+        if (m->cand == NULL) {
+            for (size_t j = 0; j < n; j++) {
+                probs[j] = visited[j] ? 0.0 : row[j];
                 total += probs[j];
             }
-        }
-
-        int chosen = -1;
-        if (total > 1e-15) {
-            double r = opt_random_uniform() * total;
-            double cum = 0;
-            for (size_t j = 0; j < n; j++) {
-                if (probs[j] > 0) {
-                    cum += probs[j];
-                    if (cum >= r) { chosen = (int)j; break; }
+            chosen = roulette(rng, probs, n, total);
+            if (chosen < 0) {
+                for (size_t j = 0; j < n; j++) {
+                    if (!visited[j]) { chosen = (int)j; break; }
                 }
             }
-        }
-
-        if (chosen < 0) {
-            for (size_t j = 0; j < n; j++) {
-                if (!visited[j]) { chosen = (int)j; break; }
+        } else {
+            const int *list = m->cand + current * cols;
+            for (size_t c = 0; c < cols; c++) {
+                probs[c] = visited[list[c]] ? 0.0 : row[c];
+                total += probs[c];
+            }
+            int c = roulette(rng, probs, cols, total);
+            chosen = (c >= 0) ? list[c] : -1;
+            if (chosen < 0) {
+                double best = -DBL_MAX;
+                for (size_t j = 0; j < n; j++) {
+                    if (visited[j]) continue;
+                    double e = heuristic(current, j, context);
+                    if (chosen < 0 || e > best) { best = e; chosen = (int)j; }
+                }
             }
         }
 
         tour[step] = chosen;
-        visited[chosen] = true;
+        visited[chosen] = 1;
     }
+}
 
-    free(probs);
-    free(visited);
+static void evaporate(double *tau, size_t count, double factor) {
+#ifdef HAVE_OMP_SIMD
+    #pragma omp simd
+#endif
+    for (size_t i = 0; i < count; i++) {
+        tau[i] *= factor;
+    }
+}
+
+// Limites do MMAS (se clamp) e choice = tau^alpha * eta^beta
+static void update_choice_info(ACOModel *m, double alpha, bool clamp,
+                               double tau_min, double tau_max) {
+    size_t count = m->n * m->cols;
+    double *tau = m->tau;
+    double *choice = m->choice;
+    const double *eta_beta = m->eta_beta;
+
+    if (clamp) {
+        for (size_t i = 0; i < count; i++) {
+            if (tau[i] < tau_min) tau[i] = tau_min;
+            if (tau[i] > tau_max) tau[i] = tau_max;
+        }
+    }
+
+    if (alpha == 1.0) {
+#ifdef HAVE_OMP_SIMD
+        #pragma omp simd
+#endif
+        for (size_t i = 0; i < count; i++) {
+            choice[i] = tau[i] * eta_beta[i];
+        }
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            choice[i] = pow(tau[i], alpha) * eta_beta[i];
+        }
+    }
 }
 
 // ============================================================================
@@ -110,11 +302,45 @@ ACOConfig aco_default_config(void) {
     config.elitist_weight = 2.0;
     config.tau_min = 0.001;
     config.tau_max = 10.0;
+    config.stop = opt_stop_none();
+    config.trace = opt_trace_default();
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
+    config.batch_objective = NULL;
+    config.num_threads = 1;
+    config.candidate_k = 0;
+    config.candidate_lists = NULL;
     return config;
 }
 
+// Formigas de [lo, hi) de uma iteracao; sem batch_objective ja avaliadas
+typedef struct {
+    const ACOModel *model;
+    int *tours;
+    double *costs;
+    double *probs;
+    unsigned char *visited;
+    OptRng *rngs;
+    bool inline_eval;
+    ObjectiveFn objective;
+    ACOHeuristicFn heuristic;
+    const void *context;
+} ACOAntsJob;
+
+static void ants_range(void *ctx, size_t lo, size_t hi) {
+    const ACOAntsJob *job = ctx;
+    size_t n = job->model->n, cols = job->model->cols;
+    for (size_t k = lo; k < hi; k++) {
+        int *tour = job->tours + k * n;
+        construct_solution(&job->rngs[k], tour, job->model, job->probs + k * cols,
+                           job->visited + k * n, job->heuristic, job->context);
+        if (job->inline_eval) {
+            job->costs[k] = job->objective(tour, n, job->context);
+        }
+    }
+}
+
 // ============================================================================
 // ACO PRINCIPAL
 // ============================================================================
@@ -124,60 +350,70 @@ OptResult aco_run(const ACOConfig *config,
                   ObjectiveFn objective,
                   ACOHeuristicFn heuristic,
                   const void *context) {
-    OptResult result = opt_result_create(config->max_iterations);
-    opt_set_seed(config->seed);
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_iterations);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
 
     size_t n = n_nodes;
+    size_t n_ants = config->n_ants;
     size_t tour_bytes = n * sizeof(int);
+    if (n == 0) return result;
 
-    double **tau = malloc(n * sizeof(double*));
-    if (tau == NULL) return result;
-    for (size_t i = 0; i < n; i++) {
-        tau[i] = malloc(n * sizeof(double));
-        if (tau[i] == NULL) {
-            for (size_t k = 0; k < i; k++) free(tau[k]);
-            free(tau);
-            return result;
-        }
-        for (size_t j = 0; j < n; j++) {
-            tau[i][j] = config->tau_0;
-        }
-    }
+    size_t threads = ds_resolve_threads(config->num_threads);
+
+    ACOModel model;
+    if (!model_init(&model, config, n, heuristic, context, threads)) return result;
+    update_choice_info(&model, config->alpha, false, 0.0, 0.0);
+
+    // Tours das formigas contiguos: n_ants x n (avaliacao em lote)
+    int *tours_data = malloc(n_ants * tour_bytes);
+    double *ant_costs = malloc(n_ants * sizeof(double));
+    double *probs = malloc(n_ants * model.cols * sizeof(double));
+    unsigned char *visited = malloc(n_ants * n);
+    OptRng *ant_rngs = malloc(n_ants * sizeof(OptRng));
 
-    int **ant_tours = malloc(config->n_ants * sizeof(int*));
-    double *ant_costs = malloc(config->n_ants * sizeof(double));
-    if (ant_tours == NULL || ant_costs == NULL) {
-        for (size_t i = 0; i < n; i++) free(tau[i]);
-        free(tau);
-        free(ant_tours);
+    if (tours_data == NULL || ant_costs == NULL || probs == NULL ||
+        visited == NULL || ant_rngs == NULL) {
+        model_free(&model);
+        free(tours_data);
         free(ant_costs);
+        free(probs);
+        free(visited);
+        free(ant_rngs);
         return result;
     }
-    for (size_t k = 0; k < config->n_ants; k++) {
-        ant_tours[k] = malloc(tour_bytes);
-        if (ant_tours[k] == NULL) {
-            for (size_t j = 0; j < k; j++) free(ant_tours[j]);
-            for (size_t i = 0; i < n; i++) free(tau[i]);
-            free(tau);
-            free(ant_tours);
-            free(ant_costs);
-            return result;
-        }
+
+    // Stream nao sobreposto por formiga: a construcao nao depende da thread
+    OptRng base = *rng;
+    for (size_t k = 0; k < n_ants; k++) {
+        opt_rng_jump(&base);
+        ant_rngs[k] = base;
     }
 
+    bool inline_eval = config->batch_objective == NULL;
+    ACOAntsJob ants = { &model, tours_data, ant_costs, probs, visited, ant_rngs,
+                        inline_eval, objective, heuristic, context };
+
     result.best = opt_solution_create(tour_bytes);
     result.best.cost = (config->direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
 
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
+
     for (size_t iter = 0; iter < config->max_iterations; iter++) {
         size_t best_ant = 0;
         double best_ant_cost = (config->direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
 
-        for (size_t k = 0; k < config->n_ants; k++) {
-            construct_solution(ant_tours[k], n, tau, heuristic,
-                               config->alpha, config->beta, context);
-            ant_costs[k] = objective(ant_tours[k], n, context);
-            result.num_evaluations++;
+        ds_parallel_for_threads(threads, 0, n_ants, 1, ants_range, &ants);
 
+        if (inline_eval) {
+            result.num_evaluations += n_ants;
+        } else {
+            result.num_evaluations += opt_evaluate_batch(config->batch_objective, objective,
+                                                         tours_data, n_ants,
+                                                         tour_bytes, n, ant_costs, context);
+        }
+
+        for (size_t k = 0; k < n_ants; k++) {
             if (aco_is_better(ant_costs[k], best_ant_cost, config->direction)) {
                 best_ant_cost = ant_costs[k];
                 best_ant = k;
@@ -185,89 +421,62 @@ OptResult aco_run(const ACOConfig *config,
         }
 
         if (aco_is_better(best_ant_cost, result.best.cost, config->direction)) {
-            memcpy(result.best.data, ant_tours[best_ant], tour_bytes);
+            memcpy(result.best.data, tours_data + best_ant * n, tour_bytes);
             result.best.cost = best_ant_cost;
         }
 
-        for (size_t i = 0; i < n; i++) {
-            for (size_t j = 0; j < n; j++) {
-                tau[i][j] *= (1.0 - config->rho);
-            }
-        }
+        evaporate(model.tau, n * model.cols, 1.0 - config->rho);
 
         switch (config->variant) {
             case ACO_ANT_SYSTEM:
-                for (size_t k = 0; k < config->n_ants; k++) {
+                for (size_t k = 0; k < n_ants; k++) {
                     double deposit = config->q / (ant_costs[k] > 1e-15 ? ant_costs[k] : 1e-15);
-                    for (size_t s = 0; s < n; s++) {
-                        int from = ant_tours[k][s];
-                        int to = ant_tours[k][(s + 1) % n];
-                        tau[from][to] += deposit;
-                        tau[to][from] += deposit;
-                    }
+                    deposit_tour(&model, tours_data + k * n, deposit);
                 }
                 break;
 
             case ACO_ELITIST: {
-                for (size_t k = 0; k < config->n_ants; k++) {
+                for (size_t k = 0; k < n_ants; k++) {
                     double deposit = config->q / (ant_costs[k] > 1e-15 ? ant_costs[k] : 1e-15);
-                    for (size_t s = 0; s < n; s++) {
-                        int from = ant_tours[k][s];
-                        int to = ant_tours[k][(s + 1) % n];
-                        tau[from][to] += deposit;
-                        tau[to][from] += deposit;
-                    }
+                    deposit_tour(&model, tours_data + k * n, deposit);
                 }
                 double elite_deposit = config->elitist_weight * config->q
                                      / (result.best.cost > 1e-15 ? result.best.cost : 1e-15);
-                int *best_tour = (int*)result.best.data;
-                for (size_t s = 0; s < n; s++) {
-                    int from = best_tour[s];
-                    int to = best_tour[(s + 1) % n];
-                    tau[from][to] += elite_deposit;
-                    tau[to][from] += elite_deposit;
-                }
+                deposit_tour(&model, (const int*)result.best.data, elite_deposit);
                 break;
             }
 
             case ACO_MAX_MIN: {
-                int *depositor;
+                const int *depositor;
                 double dep_cost;
                 if (iter % 5 == 0) {
-                    depositor = (int*)result.best.data;
+                    depositor = (const int*)result.best.data;
                     dep_cost = result.best.cost;
                 } else {
-                    depositor = ant_tours[best_ant];
+                    depositor = tours_data + best_ant * n;
                     dep_cost = best_ant_cost;
                 }
                 double deposit = config->q / (dep_cost > 1e-15 ? dep_cost : 1e-15);
-                for (size_t s = 0; s < n; s++) {
-                    int from = depositor[s];
-                    int to = depositor[(s + 1) % n];
-                    tau[from][to] += deposit;
-                    tau[to][from] += deposit;
-                }
-                for (size_t i = 0; i < n; i++) {
-                    for (size_t j = 0; j < n; j++) {
-                        if (tau[i][j] < config->tau_min) tau[i][j] = config->tau_min;
-                        if (tau[i][j] > config->tau_max) tau[i][j] = config->tau_max;
-                    }
-                }
+                deposit_tour(&model, depositor, deposit);
                 break;
             }
         }
 
-        if (result.convergence != NULL && iter < result.convergence_size) {
-            result.convergence[iter] = result.best.cost;
-        }
+        update_choice_info(&model, config->alpha, config->variant == ACO_MAX_MIN,
+                           config->tau_min, config->tau_max);
+
+        opt_tracer_record(&tracer, &result, iter, result.best.cost, result.num_evaluations);
         result.num_iterations = iter + 1;
+        if (opt_stop_check(&stop, result.num_evaluations, result.best.cost)) break;
     }
 
-    for (size_t k = 0; k < config->n_ants; k++) free(ant_tours[k]);
-    free(ant_tours);
+    model_free(&model);
+    free(tours_data);
     free(ant_costs);
-    for (size_t i = 0; i < n; i++) free(tau[i]);
-    free(tau);
+    free(probs);
+    free(visited);
+    free(ant_rngs);
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
 
@@ -277,6 +486,6 @@ OptResult aco_run(const ACOConfig *config,
 
 double aco_heuristic_tsp(size_t i, size_t j, const void *context) {
     const TSPInstance *tsp = (const TSPInstance *)context;
-    double d = tsp->dist_matrix[i][j];
+    double d = tsp_dist(tsp, i, j);
     return (d > 1e-12) ? 1.0 / d : 1e12;
 }
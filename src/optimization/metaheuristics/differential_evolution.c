@@ -13,11 +13,13 @@
  */
 
 #include "optimization/metaheuristics/differential_evolution.h"
+#include "data_structures/thread_pool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <float.h>
 
+
 // ============================================================================
 // HELPERS
 // ============================================================================
@@ -26,19 +28,12 @@ static int is_better(double a, double b, OptDirection dir) {
     return (dir == OPT_MINIMIZE) ? (a < b) : (a > b);
 }
 
-static void clamp_vector(double *v, size_t D, double lb, double ub) {
-    for (size_t i = 0; i < D; i++) {
-        if (v[i] < lb) v[i] = lb;
-        if (v[i] > ub) v[i] = ub;
-    }
-}
-
-static int select_random_distinct(int *indices, int count, int NP, int exclude) {
+static int select_random_distinct(OptRng *rng, int *indices, int count, int NP, int exclude) {
     for (int c = 0; c < count; c++) {
         int r;
         int ok;
         do {
-            r = opt_random_int(0, NP - 1);
+            r = opt_rng_int(rng, 0, NP - 1);
             ok = (r != exclude);
             for (int j = 0; j < c && ok; j++) {
                 if (indices[j] == r) ok = 0;
@@ -50,58 +45,72 @@ static int select_random_distinct(int *indices, int count, int NP, int exclude)
 }
 
 // ============================================================================
-// MUTACAO
+// MUTACAO E CROSSOVER
 // ============================================================================
 
-static void mutation_rand_1(double *donor, const double *const *pop,
-                            size_t D, double F, int NP, int i) {
-    int idx[3];
-    select_random_distinct(idx, 3, NP, i);
-    for (size_t d = 0; d < D; d++) {
-        donor[d] = pop[idx[0]][d] + F * (pop[idx[1]][d] - pop[idx[2]][d]);
-    }
-}
-
-static void mutation_best_1(double *donor, const double *const *pop,
-                            const double *best, size_t D, double F, int NP, int i) {
-    int idx[2];
-    select_random_distinct(idx, 2, NP, i);
-    for (size_t d = 0; d < D; d++) {
-        donor[d] = best[d] + F * (pop[idx[0]][d] - pop[idx[1]][d]);
-    }
-}
-
-static void mutation_current_to_best_1(double *donor, const double *const *pop,
-                                       const double *best, size_t D, double F,
-                                       int NP, int i) {
-    int idx[2];
-    select_random_distinct(idx, 2, NP, i);
-    for (size_t d = 0; d < D; d++) {
-        donor[d] = pop[i][d] + F * (best[d] - pop[i][d])
-                   + F * (pop[idx[0]][d] - pop[idx[1]][d]);
+// Vetores da mutacao: donor = v[0] + F*(v[1] - v[2]) + F*(v[3] - v[4]).
+// Estrategias com uma diferenca repetem v[0] em v[3] e v[4] (termo 0 exato).
+static void mutation_vectors(OptRng *rng, const double *v[5], const double *const *pop,
+                             const double *best, DEStrategy strategy, int NP, int i) {
+    int idx[5];
+    switch (strategy) {
+        case DE_BEST_1:
+            select_random_distinct(rng, idx, 2, NP, i);
+            v[0] = best; v[1] = pop[idx[0]]; v[2] = pop[idx[1]];
+            v[3] = v[4] = best;
+            break;
+        case DE_CURRENT_TO_BEST_1:
+            select_random_distinct(rng, idx, 2, NP, i);
+            v[0] = pop[i]; v[1] = best; v[2] = pop[i];
+            v[3] = pop[idx[0]]; v[4] = pop[idx[1]];
+            break;
+        case DE_RAND_2:
+            select_random_distinct(rng, idx, 5, NP, i);
+            v[0] = pop[idx[0]]; v[1] = pop[idx[1]]; v[2] = pop[idx[2]];
+            v[3] = pop[idx[3]]; v[4] = pop[idx[4]];
+            break;
+        case DE_BEST_2:
+            select_random_distinct(rng, idx, 4, NP, i);
+            v[0] = best; v[1] = pop[idx[0]]; v[2] = pop[idx[1]];
+            v[3] = pop[idx[2]]; v[4] = pop[idx[3]];
+            break;
+        case DE_RAND_1:
+        default:
+            select_random_distinct(rng, idx, 3, NP, i);
+            v[0] = pop[idx[0]]; v[1] = pop[idx[1]]; v[2] = pop[idx[2]];
+            v[3] = v[4] = pop[idx[0]];
+            break;
     }
 }
 
-static void mutation_rand_2(double *donor, const double *const *pop,
-                            size_t D, double F, int NP, int i) {
-    int idx[5];
-    select_random_distinct(idx, 5, NP, i);
+// Mutacao, clamp e crossover binomial fundidos num laco sem desvios
+// (vetorizavel): trial chega com os D uniformes do crossover e sai com o
+// vetor teste
+static void trial_kernel(double *restrict trial, const double *x, const double *const v[5],
+                         double F, double CR, size_t j_rand, size_t D,
+                         double lb, double ub) {
+    const double *v0 = v[0], *v1 = v[1], *v2 = v[2], *v3 = v[3], *v4 = v[4];
+#ifdef HAVE_OMP_SIMD
+    #pragma omp simd
+#endif
     for (size_t d = 0; d < D; d++) {
-        donor[d] = pop[idx[0]][d]
-                   + F * (pop[idx[1]][d] - pop[idx[2]][d])
-                   + F * (pop[idx[3]][d] - pop[idx[4]][d]);
+        double m = v0[d] + F * (v1[d] - v2[d]) + F * (v3[d] - v4[d]);
+        m = (m < lb) ? lb : m;
+        m = (m > ub) ? ub : m;
+        trial[d] = (trial[d] < CR || d == j_rand) ? m : x[d];
     }
 }
 
-static void mutation_best_2(double *donor, const double *const *pop,
-                            const double *best, size_t D, double F, int NP, int i) {
-    int idx[4];
-    select_random_distinct(idx, 4, NP, i);
-    for (size_t d = 0; d < D; d++) {
-        donor[d] = best[d]
-                   + F * (pop[idx[0]][d] - pop[idx[1]][d])
-                   + F * (pop[idx[2]][d] - pop[idx[3]][d]);
-    }
+// Sorteios na ordem: indices da mutacao, j_rand, D uniformes do crossover
+static void build_trial(OptRng *rng, double *trial, const double *const *pop,
+                        const double *best, const DEConfig *config,
+                        size_t D, size_t NP, size_t i) {
+    const double *v[5];
+    mutation_vectors(rng, v, pop, best, config->strategy, (int)NP, (int)i);
+    size_t j_rand = (size_t)opt_rng_int(rng, 0, (int)D - 1);
+    opt_rng_fill_uniform(rng, trial, D, 0.0, 1.0);
+    trial_kernel(trial, pop[i], v, config->F, config->CR, j_rand, D,
+                 config->lower_bound, config->upper_bound);
 }
 
 // ============================================================================
@@ -117,8 +126,14 @@ DEConfig de_default_config(void) {
     config.strategy = DE_RAND_1;
     config.lower_bound = -5.12;
     config.upper_bound = 5.12;
+    config.stop = opt_stop_none();
+    config.trace = opt_trace_default();
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
+    config.batch_objective = NULL;
+    config.parallel_generation = false;
+    config.num_threads = 1;
     return config;
 }
 
@@ -126,6 +141,43 @@ DEConfig de_default_config(void) {
 // ALGORITMO PRINCIPAL
 // ============================================================================
 
+// Geracao sincrona vista pelas tarefas do pool; rngs = NULL usa rng
+// (serial, na ordem dos individuos)
+typedef struct {
+    double **pop;
+    double *fitness;
+    double *trials;
+    double *trial_fitness;
+    const double *best;
+    OptRng *rng;
+    OptRng *rngs;
+    const DEConfig *config;
+    size_t D, NP;
+    bool inline_eval;
+    ObjectiveFn objective;
+    const void *context;
+} DEGenerationJob;
+
+static void de_init_range(void *ctx, size_t lo, size_t hi) {
+    const DEGenerationJob *job = ctx;
+    for (size_t i = lo; i < hi; i++) {
+        opt_rng_fill_uniform(&job->rngs[i], job->pop[i], job->D,
+                             job->config->lower_bound, job->config->upper_bound);
+        if (job->inline_eval) job->fitness[i] = job->objective(job->pop[i], job->D, job->context);
+    }
+}
+
+static void de_trial_range(void *ctx, size_t lo, size_t hi) {
+    const DEGenerationJob *job = ctx;
+    const double *const *cpop = (const double *const *)job->pop;
+    for (size_t i = lo; i < hi; i++) {
+        double *trial = job->trials + i * job->D;
+        build_trial(job->rngs != NULL ? &job->rngs[i] : job->rng, trial, cpop, job->best,
+                    job->config, job->D, job->NP, i);
+        if (job->inline_eval) job->trial_fitness[i] = job->objective(trial, job->D, job->context);
+    }
+}
+
 OptResult de_run(const DEConfig *config,
                  size_t solution_size,
                  ObjectiveFn objective,
@@ -137,114 +189,142 @@ OptResult de_run(const DEConfig *config,
 
     size_t NP = config->population_size;
     size_t D = solution_size;
-    double F = config->F;
-    double CR = config->CR;
     double lb = config->lower_bound;
     double ub = config->upper_bound;
 
     if (NP < 4) NP = 4;
 
-    opt_set_seed(config->seed);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
 
-    OptResult result = opt_result_create(config->max_generations);
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_generations);
     result.num_iterations = 0;
     result.num_evaluations = 0;
 
+    // Selecao sincrona so com lote ou geracao paralela; sem eles mantem a
+    // selecao assincrona classica (um trial por vez)
+    bool parallel = config->parallel_generation;
+    bool synchronous = parallel || config->batch_objective != NULL;
+    size_t num_trials = synchronous ? NP : 1;
+
+    // Populacao e trials em matrizes contiguas (avaliacao em lote)
+    size_t row_bytes = D * sizeof(double);
     double **pop = malloc(NP * sizeof(double *));
+    double *pop_data = malloc(NP * row_bytes);
     double *fitness = malloc(NP * sizeof(double));
-    if (pop == NULL || fitness == NULL) {
+    double *trials = malloc(num_trials * row_bytes);
+    double *trial_fitness = malloc(num_trials * sizeof(double));
+    OptRng *ind_rngs = parallel ? malloc(NP * sizeof(OptRng)) : NULL;
+    if (pop == NULL || pop_data == NULL || fitness == NULL || trials == NULL ||
+        trial_fitness == NULL || (parallel && ind_rngs == NULL)) {
         free(pop);
+        free(pop_data);
         free(fitness);
+        free(trials);
+        free(trial_fitness);
+        free(ind_rngs);
         return result;
     }
 
     for (size_t i = 0; i < NP; i++) {
-        pop[i] = malloc(D * sizeof(double));
-        if (pop[i] == NULL) {
-            for (size_t j = 0; j < i; j++) free(pop[j]);
-            free(pop);
-            free(fitness);
-            return result;
-        }
+        pop[i] = pop_data + i * D;
     }
 
     size_t best_idx = 0;
     double best_fitness = (config->direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
 
-    for (size_t i = 0; i < NP; i++) {
-        for (size_t d = 0; d < D; d++) {
-            pop[i][d] = lb + opt_random_uniform() * (ub - lb);
+    // Modo paralelo: stream nao sobreposto por individuo, avaliacao por
+    // objective dentro do laco paralelo (sem batch_objective)
+    bool inline_eval = parallel && config->batch_objective == NULL;
+    size_t threads = parallel ? ds_resolve_threads(config->num_threads) : 1;
+    DEGenerationJob job = { pop, fitness, trials, trial_fitness, NULL, rng,
+                            parallel ? ind_rngs : NULL, config, D, NP, inline_eval,
+                            objective, context };
+
+    if (parallel) {
+        OptRng base = *rng;
+        for (size_t i = 0; i < NP; i++) {
+            opt_rng_jump(&base);
+            ind_rngs[i] = base;
         }
-        fitness[i] = objective(pop[i], D, context);
-        result.num_evaluations++;
+        ds_parallel_for_threads(threads, 0, NP, 0, de_init_range, &job);
+    } else {
+        opt_rng_fill_uniform(rng, pop_data, NP * D, lb, ub);
+    }
+
+    if (inline_eval) {
+        result.num_evaluations += NP;
+    } else {
+        result.num_evaluations += opt_evaluate_batch(config->batch_objective, objective,
+                                                     pop_data, NP, row_bytes, D,
+                                                     fitness, context);
+    }
 
+    for (size_t i = 0; i < NP; i++) {
         if (is_better(fitness[i], best_fitness, config->direction)) {
             best_fitness = fitness[i];
             best_idx = i;
         }
     }
 
-    double *donor = malloc(D * sizeof(double));
-    double *trial = malloc(D * sizeof(double));
-    if (donor == NULL || trial == NULL) {
-        for (size_t i = 0; i < NP; i++) free(pop[i]);
-        free(pop);
-        free(fitness);
-        free(donor);
-        free(trial);
-        return result;
-    }
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
 
     for (size_t gen = 0; gen < config->max_generations; gen++) {
-        for (size_t i = 0; i < NP; i++) {
-            switch (config->strategy) {
-                case DE_RAND_1:
-                    mutation_rand_1(donor, (const double *const *)pop, D, F, (int)NP, (int)i);
-                    break;
-                case DE_BEST_1:
-                    mutation_best_1(donor, (const double *const *)pop, pop[best_idx], D, F, (int)NP, (int)i);
-                    break;
-                case DE_CURRENT_TO_BEST_1:
-                    mutation_current_to_best_1(donor, (const double *const *)pop, pop[best_idx], D, F, (int)NP, (int)i);
-                    break;
-                case DE_RAND_2:
-                    mutation_rand_2(donor, (const double *const *)pop, D, F, (int)NP, (int)i);
-                    break;
-                case DE_BEST_2:
-                    mutation_best_2(donor, (const double *const *)pop, pop[best_idx], D, F, (int)NP, (int)i);
-                    break;
+        const double *const *cpop = (const double *const *)pop;
+
+        if (!synchronous) {
+            // Selecao assincrona: o trial aceito ja entra na populacao (e no
+            // melhor) usada pelos individuos seguintes da mesma geracao
+            for (size_t i = 0; i < NP; i++) {
+                build_trial(rng, trials, cpop, pop[best_idx], config, D, NP, i);
+                double f = objective(trials, D, context);
+                result.num_evaluations++;
+
+                if (is_better(f, fitness[i], config->direction) || f == fitness[i]) {
+                    memcpy(pop[i], trials, row_bytes);
+                    fitness[i] = f;
+
+                    if (is_better(f, best_fitness, config->direction)) {
+                        best_fitness = f;
+                        best_idx = i;
+                    }
+                }
             }
 
-            clamp_vector(donor, D, lb, ub);
+            result.num_iterations = gen + 1;
+            opt_tracer_record(&tracer, &result, gen, best_fitness, result.num_evaluations);
+            if (opt_stop_check(&stop, result.num_evaluations, best_fitness)) break;
+            continue;
+        }
 
-            int j_rand = opt_random_int(0, (int)D - 1);
-            for (size_t d = 0; d < D; d++) {
-                if (opt_random_uniform() < CR || (int)d == j_rand) {
-                    trial[d] = donor[d];
-                } else {
-                    trial[d] = pop[i][d];
-                }
-            }
+        job.best = pop[best_idx];
+        ds_parallel_for_threads(threads, 0, NP, 0, de_trial_range, &job);
 
-            double trial_fitness = objective(trial, D, context);
-            result.num_evaluations++;
+        // Selecao sincrona: todos os trials da geracao avaliados de uma vez
+        if (inline_eval) {
+            result.num_evaluations += NP;
+        } else {
+            result.num_evaluations += opt_evaluate_batch(config->batch_objective, objective,
+                                                         trials, NP, row_bytes, D,
+                                                         trial_fitness, context);
+        }
 
-            if (is_better(trial_fitness, fitness[i], config->direction) ||
-                trial_fitness == fitness[i]) {
-                memcpy(pop[i], trial, D * sizeof(double));
-                fitness[i] = trial_fitness;
+        for (size_t i = 0; i < NP; i++) {
+            if (is_better(trial_fitness[i], fitness[i], config->direction) ||
+                trial_fitness[i] == fitness[i]) {
+                memcpy(pop[i], trials + i * D, row_bytes);
+                fitness[i] = trial_fitness[i];
 
-                if (is_better(trial_fitness, best_fitness, config->direction)) {
-                    best_fitness = trial_fitness;
+                if (is_better(trial_fitness[i], best_fitness, config->direction)) {
+                    best_fitness = trial_fitness[i];
                     best_idx = i;
                 }
             }
         }
 
         result.num_iterations = gen + 1;
-        if (gen < result.convergence_size) {
-            result.convergence[gen] = best_fitness;
-        }
+        opt_tracer_record(&tracer, &result, gen, best_fitness, result.num_evaluations);
+        if (opt_stop_check(&stop, result.num_evaluations, best_fitness)) break;
     }
 
     result.best = opt_solution_create(D * sizeof(double));
@@ -253,11 +333,13 @@ OptResult de_run(const DEConfig *config,
         result.best.cost = best_fitness;
     }
 
-    free(donor);
-    free(trial);
-    for (size_t i = 0; i < NP; i++) free(pop[i]);
+    free(ind_rngs);
+    free(trials);
+    free(trial_fitness);
     free(pop);
+    free(pop_data);
     free(fitness);
 
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
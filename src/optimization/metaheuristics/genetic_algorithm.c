@@ -4,13 +4,15 @@
  *
  * GA classico com selecao (tournament/roulette/rank), elitismo,
  * crossover e mutacao genericos, busca local opcional (memetico),
- * e taxas adaptativas.
+ * taxas adaptativas, avaliacao da populacao em paralelo (pool global) e
+ * modelo de ilhas com migracao (uma ilha por thread).
  *
  * Referencias:
  * - Holland, J. H. (1975). Adaptation in Natural and Artificial Systems
  * - Goldberg, D. E. (1989). Genetic Algorithms in Search, Optimization, and ML
  * - Davis, L. (1985). "Applying Adaptive Algorithms to Epistatic Domains" (OX)
  * - Goldberg, D. E. & Lingle, R. (1985). "Alleles, Loci, and the TSP" (PMX)
+ * - Cantu-Paz, E. (1998). "A Survey of Parallel Genetic Algorithms" (ilhas)
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
@@ -18,11 +20,14 @@
 
 #include "optimization/metaheuristics/genetic_algorithm.h"
 #include "optimization/benchmarks/continuous.h"
+#include "data_structures/large_alloc.h"
+#include "data_structures/thread_pool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <float.h>
 
+
 // ============================================================================
 // HELPERS
 // ============================================================================
@@ -52,15 +57,64 @@ static int cmp_fitness_desc(const void *a, const void *b) {
     return 0;
 }
 
+typedef struct {
+    unsigned char *rows;
+    double *costs;
+    size_t element_size, solution_size;
+    ObjectiveFn objective;
+    LocalSearchFn local_search;
+    const void *context;
+} GARowsJob;
+
+static void objective_rows(void *ctx, size_t lo, size_t hi) {
+    const GARowsJob *job = ctx;
+    for (size_t i = lo; i < hi; i++) {
+        job->costs[i] = job->objective(job->rows + i * job->element_size,
+                                       job->solution_size, job->context);
+    }
+}
+
+static void local_search_rows(void *ctx, size_t lo, size_t hi) {
+    const GARowsJob *job = ctx;
+    for (size_t i = lo; i < hi; i++) {
+        job->costs[i] = job->local_search(job->rows + i * job->element_size,
+                                          job->solution_size, job->objective, job->context);
+    }
+}
+
+// Avalia count solucoes contiguas (lote ou objective por linha) e aplica
+// local_search opcional. Nao sorteia nada e cada linha e independente:
+// seguro distribuir entre threads. Retorna o numero de avaliacoes.
+static size_t evaluate_rows(unsigned char *rows, double *costs, size_t count,
+                            size_t element_size, size_t solution_size,
+                            ObjectiveFn objective, BatchObjectiveFn batch,
+                            LocalSearchFn local_search, const void *context,
+                            size_t num_threads) {
+    if (count == 0) return 0;
+
+    GARowsJob job = { rows, costs, element_size, solution_size, objective, local_search, context };
+    if (batch != NULL) {
+        batch(rows, count, element_size, solution_size, costs, context);
+    } else {
+        ds_parallel_for_threads(num_threads, 0, count, 1, objective_rows, &job);
+    }
+
+    if (local_search != NULL) {
+        ds_parallel_for_threads(num_threads, 0, count, 1, local_search_rows, &job);
+    }
+
+    return count * (local_search != NULL ? 2 : 1);
+}
+
 // ============================================================================
 // SELECTION
 // ============================================================================
 
-static size_t select_tournament(const Individual *pop, size_t pop_size,
+static size_t select_tournament(OptRng *rng, const Individual *pop, size_t pop_size,
                                 size_t k, OptDirection dir) {
-    size_t best = (size_t)opt_random_int(0, (int)pop_size - 1);
+    size_t best = (size_t)opt_rng_int(rng, 0, (int)pop_size - 1);
     for (size_t i = 1; i < k; i++) {
-        size_t idx = (size_t)opt_random_int(0, (int)pop_size - 1);
+        size_t idx = (size_t)opt_rng_int(rng, 0, (int)pop_size - 1);
         if (ga_is_better(pop[idx].fitness, pop[best].fitness, dir)) {
             best = idx;
         }
@@ -68,7 +122,7 @@ static size_t select_tournament(const Individual *pop, size_t pop_size,
     return best;
 }
 
-static size_t select_roulette(const Individual *pop, size_t pop_size,
+static size_t select_roulette(OptRng *rng, const Individual *pop, size_t pop_size,
                               OptDirection dir) {
     double worst = pop[0].fitness;
     for (size_t i = 1; i < pop_size; i++) {
@@ -87,9 +141,9 @@ static size_t select_roulette(const Individual *pop, size_t pop_size,
         }
     }
 
-    if (total <= 0.0) return (size_t)opt_random_int(0, (int)pop_size - 1);
+    if (total <= 0.0) return (size_t)opt_rng_int(rng, 0, (int)pop_size - 1);
 
-    double r = opt_random_uniform() * total;
+    double r = opt_rng_uniform(rng) * total;
     double acc = 0.0;
     for (size_t i = 0; i < pop_size; i++) {
         if (dir == OPT_MINIMIZE) {
@@ -102,10 +156,10 @@ static size_t select_roulette(const Individual *pop, size_t pop_size,
     return pop_size - 1;
 }
 
-static size_t select_rank(const Individual *sorted_pop, size_t pop_size) {
+static size_t select_rank(OptRng *rng, const Individual *sorted_pop, size_t pop_size) {
     (void)sorted_pop;
     double total = (double)pop_size * ((double)pop_size + 1.0) / 2.0;
-    double r = opt_random_uniform() * total;
+    double r = opt_rng_uniform(rng) * total;
     double acc = 0.0;
     for (size_t i = 0; i < pop_size; i++) {
         acc += (double)(pop_size - i);
@@ -114,18 +168,18 @@ static size_t select_rank(const Individual *sorted_pop, size_t pop_size) {
     return pop_size - 1;
 }
 
-static size_t ga_select(const Individual *pop, size_t pop_size,
+static size_t ga_select(OptRng *rng, const Individual *pop, size_t pop_size,
                         const GAConfig *config) {
     switch (config->selection) {
         case GA_SELECT_TOURNAMENT:
-            return select_tournament(pop, pop_size, config->tournament_size,
+            return select_tournament(rng, pop, pop_size, config->tournament_size,
                                      config->direction);
         case GA_SELECT_ROULETTE:
-            return select_roulette(pop, pop_size, config->direction);
+            return select_roulette(rng, pop, pop_size, config->direction);
         case GA_SELECT_RANK:
-            return select_rank(pop, pop_size);
+            return select_rank(rng, pop, pop_size);
         default:
-            return select_tournament(pop, pop_size, 3, config->direction);
+            return select_tournament(rng, pop, pop_size, 3, config->direction);
     }
 }
 
@@ -145,13 +199,24 @@ GAConfig ga_default_config(void) {
     config.tournament_size = 3;
 
     config.enable_local_search = false;
+    config.num_threads = 1;
+
+    config.num_islands = 1;
+    config.migration_interval = 25;
+    config.migration_count = 2;
+    config.migration_topology = GA_MIGRATION_RING;
 
     config.enable_adaptive_rates = false;
     config.adaptive_min_mutation = 0.01;
     config.adaptive_max_mutation = 0.3;
 
+    config.stop = opt_stop_none();
+    config.trace = opt_trace_default();
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
+    config.batch_objective = NULL;
+    config.checkpoint = opt_checkpoint_none();
     return config;
 }
 
@@ -360,169 +425,557 @@ void ga_mutation_gaussian(void *solution, size_t size,
 // GA PRINCIPAL
 // ============================================================================
 
-OptResult ga_run(const GAConfig *config,
-                 size_t element_size,
-                 size_t solution_size,
-                 ObjectiveFn objective,
-                 GenerateFn generate,
-                 CrossoverFn crossover,
-                 MutationFn mutate,
-                 LocalSearchFn local_search,
-                 const void *context) {
-    OptResult result = opt_result_create(config->max_generations);
-    opt_set_seed(config->seed);
+// Callbacks e dimensoes do problema, comuns a todas as ilhas
+typedef struct {
+    size_t element_size;
+    size_t solution_size;
+    ObjectiveFn objective;
+    GenerateFn generate;
+    CrossoverFn crossover;
+    MutationFn mutate;
+    LocalSearchFn local_search;
+    const void *context;
+} GAProblem;
+
+// Populacao (ordenada do melhor ao pior) e buffers de uma ilha
+typedef struct {
+    Individual *pop;
+    Individual *new_pop;
+    unsigned char *genes;   // Dados de pop e new_pop num bloco (2 * pop_size linhas)
+    unsigned char *offspring;
+    double *offspring_cost;
+    size_t pop_size;
+    size_t element_size;
+    double current_mutation;
+    OptRng *rng;            // Selecao e sorteio de crossover
+    OptRng own_rng;         // Stream proprio (modelo de ilhas)
+    OptRng op_rng;          // Stream de opt_random_* dos operadores (ilhas)
+    void *best_data;        // Melhor individuo ja visto pela ilha
+    double best_cost;
+    size_t evaluations;
+} GAIsland;
+
+static void island_free(GAIsland *isl) {
+    ds_large_free(isl->genes, 2 * isl->pop_size, isl->element_size);
+    ds_large_free(isl->offspring, isl->pop_size + 1, isl->element_size);
+    free(isl->pop);
+    free(isl->new_pop);
+    free(isl->offspring_cost);
+    free(isl->best_data);
+    isl->best_data = NULL;
+    isl->pop = NULL;
+    isl->new_pop = NULL;
+    isl->genes = NULL;
+    isl->offspring = NULL;
+    isl->offspring_cost = NULL;
+}
 
-    size_t pop_size = config->population_size;
-    if (pop_size < 4) pop_size = 4;
-    if (pop_size % 2 != 0) pop_size++;
+static bool island_alloc(GAIsland *isl, size_t pop_size, size_t element_size) {
+    memset(isl, 0, sizeof(GAIsland));
+    isl->pop_size = pop_size;
+    isl->element_size = element_size;
+    isl->pop = calloc(pop_size, sizeof(Individual));
+    isl->new_pop = calloc(pop_size, sizeof(Individual));
+
+    // Populacoes grandes sao lidas pelas threads da avaliacao: os genes
+    // ficam num bloco so (huge pages, paginas intercaladas entre os nos).
+    // Filhos sao gerados em linhas contiguas para permitir avaliacao em lote
+    // (+1 linha: o segundo filho do ultimo par pode nao caber na populacao)
+    isl->genes = ds_large_calloc(2 * pop_size, element_size);
+    isl->offspring = ds_large_calloc(pop_size + 1, element_size);
+    isl->offspring_cost = malloc((pop_size + 1) * sizeof(double));
+    isl->best_data = malloc(element_size);
+    if (isl->pop == NULL || isl->new_pop == NULL || isl->genes == NULL ||
+        isl->offspring == NULL || isl->offspring_cost == NULL || isl->best_data == NULL) {
+        island_free(isl);
+        return false;
+    }
 
-    Individual *pop = calloc(pop_size, sizeof(Individual));
-    Individual *new_pop = calloc(pop_size, sizeof(Individual));
+    for (size_t i = 0; i < pop_size; i++) {
+        isl->pop[i].data = isl->genes + i * element_size;
+        isl->new_pop[i].data = isl->genes + (pop_size + i) * element_size;
+    }
+    return true;
+}
+
+// Ordena do melhor ao pior e atualiza o melhor ja visto
+static void island_sort(GAIsland *isl, OptDirection dir, size_t element_size) {
+    if (dir == OPT_MINIMIZE) {
+        qsort(isl->pop, isl->pop_size, sizeof(Individual), cmp_fitness_asc);
+    } else {
+        qsort(isl->pop, isl->pop_size, sizeof(Individual), cmp_fitness_desc);
+    }
+    if (ga_is_better(isl->pop[0].fitness, isl->best_cost, dir)) {
+        memcpy(isl->best_data, isl->pop[0].data, element_size);
+        isl->best_cost = isl->pop[0].fitness;
+    }
+}
 
-    if (pop == NULL || new_pop == NULL) {
-        free(pop);
-        free(new_pop);
-        return result;
+// Gera, avalia e ordena a populacao inicial
+static void island_init_population(GAIsland *isl, const GAConfig *config,
+                                   const GAProblem *prob, size_t num_threads) {
+    size_t es = prob->element_size;
+    for (size_t i = 0; i < isl->pop_size; i++) {
+        prob->generate(isl->offspring + i * es, prob->solution_size, prob->context);
+    }
+    isl->evaluations += evaluate_rows(isl->offspring, isl->offspring_cost, isl->pop_size,
+                                      es, prob->solution_size,
+                                      prob->objective, config->batch_objective,
+                                      prob->local_search, prob->context, num_threads);
+    for (size_t i = 0; i < isl->pop_size; i++) {
+        memcpy(isl->pop[i].data, isl->offspring + i * es, es);
+        isl->pop[i].fitness = isl->offspring_cost[i];
     }
 
-    for (size_t i = 0; i < pop_size; i++) {
-        pop[i].data = malloc(element_size);
-        new_pop[i].data = malloc(element_size);
-        if (pop[i].data == NULL || new_pop[i].data == NULL) {
-            for (size_t j = 0; j <= i; j++) {
-                free(pop[j].data);
-                free(new_pop[j].data);
-            }
-            free(pop);
-            free(new_pop);
-            return result;
-        }
+    isl->best_cost = (config->direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
+    island_sort(isl, config->direction, es);
+    isl->current_mutation = config->mutation_rate;
+}
+
+// Uma geracao: elitismo, reproducao, avaliacao, ordenacao e taxa adaptativa
+static void island_generation(GAIsland *isl, const GAConfig *config,
+                              const GAProblem *prob, size_t num_threads) {
+    size_t es = prob->element_size;
+    size_t pop_size = isl->pop_size;
+    Individual *pop = isl->pop;
+    Individual *new_pop = isl->new_pop;
+
+    size_t elite = config->elitism_count;
+    if (elite > pop_size) elite = pop_size;
+
+    for (size_t i = 0; i < elite; i++) {
+        memcpy(new_pop[i].data, pop[i].data, es);
+        new_pop[i].fitness = pop[i].fitness;
     }
 
-    for (size_t i = 0; i < pop_size; i++) {
-        generate(pop[i].data, solution_size, context);
-        pop[i].fitness = objective(pop[i].data, solution_size, context);
-        result.num_evaluations++;
-
-        if (config->enable_local_search && local_search != NULL) {
-            pop[i].fitness = local_search(pop[i].data, solution_size,
-                                          objective, context);
-            result.num_evaluations++;
+    for (size_t i = elite; i < pop_size; i += 2) {
+        size_t p1_idx = ga_select(isl->rng, pop, pop_size, config);
+        size_t p2_idx = ga_select(isl->rng, pop, pop_size, config);
+
+        unsigned char *child1 = isl->offspring + (i - elite) * es;
+        unsigned char *child2 = child1 + es;
+
+        if (opt_rng_uniform(isl->rng) < config->crossover_rate) {
+            prob->crossover(pop[p1_idx].data, pop[p2_idx].data,
+                            child1, child2,
+                            prob->solution_size, prob->context);
+        } else {
+            memcpy(child1, pop[p1_idx].data, es);
+            memcpy(child2, pop[p2_idx].data, es);
         }
+
+        prob->mutate(child1, prob->solution_size, isl->current_mutation, prob->context);
+        prob->mutate(child2, prob->solution_size, isl->current_mutation, prob->context);
     }
 
-    if (config->direction == OPT_MINIMIZE) {
-        qsort(pop, pop_size, sizeof(Individual), cmp_fitness_asc);
-    } else {
-        qsort(pop, pop_size, sizeof(Individual), cmp_fitness_desc);
+    size_t n_children = pop_size - elite;
+    isl->evaluations += evaluate_rows(isl->offspring, isl->offspring_cost, n_children,
+                                      es, prob->solution_size,
+                                      prob->objective, config->batch_objective,
+                                      prob->local_search, prob->context, num_threads);
+    for (size_t k = 0; k < n_children; k++) {
+        memcpy(new_pop[elite + k].data, isl->offspring + k * es, es);
+        new_pop[elite + k].fitness = isl->offspring_cost[k];
     }
 
-    result.best = opt_solution_create(element_size);
-    memcpy(result.best.data, pop[0].data, element_size);
-    result.best.cost = pop[0].fitness;
+    isl->pop = new_pop;
+    isl->new_pop = pop;
+    pop = isl->pop;
+    island_sort(isl, config->direction, es);
 
-    void *child1_buf = malloc(element_size);
-    void *child2_buf = malloc(element_size);
+    if (config->enable_adaptive_rates) {
+        double diversity = 0.0;
+        for (size_t i = 1; i < pop_size; i++) {
+            diversity += fabs(pop[i].fitness - pop[0].fitness);
+        }
+        diversity /= (double)pop_size;
 
-    double current_mutation = config->mutation_rate;
+        if (diversity < 1e-6) {
+            isl->current_mutation = config->adaptive_max_mutation;
+        } else {
+            double ratio = diversity / (fabs(pop[0].fitness) + 1e-15);
+            isl->current_mutation = config->adaptive_min_mutation +
+                (config->adaptive_max_mutation - config->adaptive_min_mutation) *
+                (1.0 / (1.0 + ratio));
+        }
+    }
+}
 
-    for (size_t gen = 0; gen < config->max_generations; gen++) {
-        size_t elite = config->elitism_count;
-        if (elite > pop_size) elite = pop_size;
+// Troca o stream de opt_random_* da thread pelo da ilha (e de volta)
+static void island_swap_op_rng(GAIsland *isl) {
+    OptRng *thread_rng = opt_rng_thread();
+    OptRng tmp = *thread_rng;
+    *thread_rng = isl->op_rng;
+    isl->op_rng = tmp;
+}
+
+// Copia os migration_count melhores de cada ilha sobre os piores dos
+// destinos. Emigrantes sao copiados antes de qualquer substituicao.
+static bool islands_migrate(GAIsland *islands, size_t num_islands,
+                            const GAConfig *config, size_t element_size) {
+    size_t pop_size = islands[0].pop_size;
+    size_t keep = config->elitism_count > 0 ? config->elitism_count : 1;
+    if (keep > pop_size) keep = pop_size;
+    size_t senders = (config->migration_topology == GA_MIGRATION_FULL) ? num_islands - 1 : 1;
+
+    // Nunca substitui a elite (ou o melhor) do destino
+    size_t m = config->migration_count;
+    if (m * senders > pop_size - keep) m = (pop_size - keep) / senders;
+    if (m == 0) return true;
+
+    unsigned char *emigrants = malloc(num_islands * m * element_size);
+    double *emigrant_cost = malloc(num_islands * m * sizeof(double));
+    if (emigrants == NULL || emigrant_cost == NULL) {
+        free(emigrants);
+        free(emigrant_cost);
+        return false;
+    }
 
-        for (size_t i = 0; i < elite; i++) {
-            memcpy(new_pop[i].data, pop[i].data, element_size);
-            new_pop[i].fitness = pop[i].fitness;
+    for (size_t i = 0; i < num_islands; i++) {
+        for (size_t k = 0; k < m; k++) {
+            memcpy(emigrants + (i * m + k) * element_size, islands[i].pop[k].data, element_size);
+            emigrant_cost[i * m + k] = islands[i].pop[k].fitness;
         }
+    }
 
-        for (size_t i = elite; i < pop_size; i += 2) {
-            size_t p1_idx = ga_select(pop, pop_size, config);
-            size_t p2_idx = ga_select(pop, pop_size, config);
-
-            if (opt_random_uniform() < config->crossover_rate) {
-                crossover(pop[p1_idx].data, pop[p2_idx].data,
-                          child1_buf, child2_buf,
-                          solution_size, context);
-            } else {
-                memcpy(child1_buf, pop[p1_idx].data, element_size);
-                memcpy(child2_buf, pop[p2_idx].data, element_size);
+    for (size_t dst = 0; dst < num_islands; dst++) {
+        GAIsland *isl = &islands[dst];
+        size_t slot = pop_size;
+        for (size_t s = 1; s <= senders; s++) {
+            size_t src = (dst + num_islands - s) % num_islands;
+            for (size_t k = 0; k < m; k++) {
+                slot--;
+                memcpy(isl->pop[slot].data, emigrants + (src * m + k) * element_size, element_size);
+                isl->pop[slot].fitness = emigrant_cost[src * m + k];
             }
+        }
+        island_sort(isl, config->direction, element_size);
+    }
 
-            mutate(child1_buf, solution_size, current_mutation, context);
-            mutate(child2_buf, solution_size, current_mutation, context);
+    free(emigrants);
+    free(emigrant_cost);
+    return true;
+}
 
-            memcpy(new_pop[i].data, child1_buf, element_size);
-            new_pop[i].fitness = objective(new_pop[i].data, solution_size, context);
-            result.num_evaluations++;
+// ============================================================================
+// CHECKPOINT
+// ============================================================================
 
-            if (config->enable_local_search && local_search != NULL) {
-                new_pop[i].fitness = local_search(new_pop[i].data, solution_size,
-                                                  objective, context);
-                result.num_evaluations++;
-            }
+// Dimensoes que um checkpoint precisa reencontrar para ser retomado
+static uint64_t ga_fingerprint(const GAConfig *config, const GAProblem *prob,
+                               size_t pop_size, size_t num_islands) {
+    size_t dims[5] = {prob->element_size, prob->solution_size, pop_size,
+                      num_islands, (size_t)config->direction};
+    return opt_checkpoint_fingerprint(dims, 5);
+}
 
-            if (i + 1 < pop_size) {
-                memcpy(new_pop[i + 1].data, child2_buf, element_size);
-                new_pop[i + 1].fitness = objective(new_pop[i + 1].data,
-                                                   solution_size, context);
-                result.num_evaluations++;
-
-                if (config->enable_local_search && local_search != NULL) {
-                    new_pop[i + 1].fitness = local_search(new_pop[i + 1].data,
-                                                          solution_size,
-                                                          objective, context);
-                    result.num_evaluations++;
-                }
-            }
+// Stream de opt_random_* da ilha fora de uma epoca: o da thread no
+// modo panmitico, o guardado em op_rng nas ilhas
+static OptRng* island_op_rng(GAIsland *isl, size_t num_islands) {
+    return num_islands > 1 ? &isl->op_rng : opt_rng_thread();
+}
+
+// Grava o estado apos gen geracoes; pending_migration marca uma migracao
+// de fim de epoca que foi pulada so porque max_generations chegou
+static void ga_save(const GAConfig *config, GAIsland *islands, size_t num_islands,
+                    size_t element_size, uint64_t fingerprint, const OptResult *result,
+                    size_t gen, bool pending_migration) {
+    OptCheckpoint ck;
+    if (!opt_checkpoint_write_begin(&ck, config->checkpoint.path, OPT_CHECKPOINT_GA,
+                                    fingerprint, gen)) {
+        return;
+    }
+
+    unsigned char pending = pending_migration ? 1 : 0;
+    opt_checkpoint_write(&ck, &pending, sizeof(pending));
+    for (size_t i = 0; i < num_islands; i++) {
+        GAIsland *isl = &islands[i];
+        for (size_t k = 0; k < isl->pop_size; k++) {
+            opt_checkpoint_write(&ck, isl->pop[k].data, element_size);
+            opt_checkpoint_write(&ck, &isl->pop[k].fitness, sizeof(double));
         }
+        opt_checkpoint_write(&ck, isl->best_data, element_size);
+        opt_checkpoint_write(&ck, &isl->best_cost, sizeof(double));
+        opt_checkpoint_write(&ck, &isl->current_mutation, sizeof(double));
+        opt_checkpoint_write(&ck, &isl->evaluations, sizeof(size_t));
+        opt_checkpoint_write_rng(&ck, isl->rng);
+        opt_checkpoint_write_rng(&ck, island_op_rng(isl, num_islands));
+    }
+
+    opt_checkpoint_write_history(&ck, result, gen);
+    size_t rows = result->num_islands > 0 ? gen : 0;
+    opt_checkpoint_write(&ck, &rows, sizeof(rows));
+    for (size_t i = 0; i < result->num_islands; i++) {
+        opt_checkpoint_write(&ck, result->island_convergence + i * config->max_generations,
+                             rows * sizeof(double));
+    }
+    opt_checkpoint_write_end(&ck, config->checkpoint.path);
+}
 
-        Individual *tmp = pop;
-        pop = new_pop;
-        new_pop = tmp;
+// Restaura o estado gravado por ga_save. Os streams so sao aplicados com o
+// arquivo lido por inteiro; em falha as ilhas voltam a zero avaliacoes e
+// o chamador inicializa as populacoes normalmente.
+static bool ga_load(const GAConfig *config, GAIsland *islands, size_t num_islands,
+                    size_t element_size, uint64_t fingerprint, OptResult *result,
+                    size_t *gen, bool *pending_migration) {
+    OptCheckpoint ck;
+    size_t saved_gen = 0;
+    if (!opt_checkpoint_read_begin(&ck, config->checkpoint.path, OPT_CHECKPOINT_GA,
+                                   fingerprint, &saved_gen)) {
+        return false;
+    }
 
-        if (config->direction == OPT_MINIMIZE) {
-            qsort(pop, pop_size, sizeof(Individual), cmp_fitness_asc);
-        } else {
-            qsort(pop, pop_size, sizeof(Individual), cmp_fitness_desc);
+    OptRng *rngs = malloc(2 * num_islands * sizeof(OptRng));
+    unsigned char pending = 0;
+    bool ok = rngs != NULL && opt_checkpoint_read(&ck, &pending, sizeof(pending));
+    for (size_t i = 0; ok && i < num_islands; i++) {
+        GAIsland *isl = &islands[i];
+        for (size_t k = 0; ok && k < isl->pop_size; k++) {
+            ok = opt_checkpoint_read(&ck, isl->pop[k].data, element_size) &&
+                 opt_checkpoint_read(&ck, &isl->pop[k].fitness, sizeof(double));
         }
+        ok = ok && opt_checkpoint_read(&ck, isl->best_data, element_size) &&
+             opt_checkpoint_read(&ck, &isl->best_cost, sizeof(double)) &&
+             opt_checkpoint_read(&ck, &isl->current_mutation, sizeof(double)) &&
+             opt_checkpoint_read(&ck, &isl->evaluations, sizeof(size_t)) &&
+             opt_checkpoint_read_rng(&ck, &rngs[2 * i]) &&
+             opt_checkpoint_read_rng(&ck, &rngs[2 * i + 1]);
+    }
 
-        if (ga_is_better(pop[0].fitness, result.best.cost, config->direction)) {
-            memcpy(result.best.data, pop[0].data, element_size);
-            result.best.cost = pop[0].fitness;
+    ok = ok && opt_checkpoint_read_history(&ck, result);
+    size_t rows = 0;
+    ok = ok && opt_checkpoint_read(&ck, &rows, sizeof(rows));
+    for (size_t i = 0; ok && i < num_islands && rows > 0; i++) {
+        for (size_t g = 0; ok && g < rows; g++) {
+            double c;
+            ok = opt_checkpoint_read(&ck, &c, sizeof(c));
+            if (ok && result->num_islands > 0 && g < config->max_generations) {
+                result->island_convergence[i * config->max_generations + g] = c;
+            }
         }
+    }
+    ok = opt_checkpoint_read_end(&ck) && ok;
 
-        if (config->enable_adaptive_rates) {
-            double diversity = 0.0;
-            for (size_t i = 1; i < pop_size; i++) {
-                diversity += fabs(pop[i].fitness - pop[0].fitness);
+    if (ok) {
+        for (size_t i = 0; i < num_islands; i++) {
+            *islands[i].rng = rngs[2 * i];
+            *island_op_rng(&islands[i], num_islands) = rngs[2 * i + 1];
+        }
+        *gen = saved_gen;
+        *pending_migration = pending != 0;
+    } else {
+        for (size_t i = 0; i < num_islands; i++) islands[i].evaluations = 0;
+    }
+    free(rngs);
+    return ok;
+}
+
+typedef struct {
+    GAIsland *islands;
+    const GAConfig *config;
+    const GAProblem *prob;
+    OptResult *result;
+    size_t gen, epoch_end, max_gen;
+    bool init;
+} GAEpoch;
+
+// Ilhas de [lo, hi) evoluem [gen, epoch_end) (ou so inicializam)
+static void epoch_range(void *ctx, size_t lo, size_t hi) {
+    const GAEpoch *e = ctx;
+    for (size_t i = lo; i < hi; i++) {
+        GAIsland *isl = &e->islands[i];
+        island_swap_op_rng(isl);
+        if (e->init) island_init_population(isl, e->config, e->prob, 1);
+        for (size_t g = e->gen; g < e->epoch_end; g++) {
+            island_generation(isl, e->config, e->prob, 1);
+            if (e->result->num_islands > 0) {
+                e->result->island_convergence[i * e->max_gen + g] = isl->best_cost;
             }
-            diversity /= (double)pop_size;
-
-            if (diversity < 1e-6) {
-                current_mutation = config->adaptive_max_mutation;
-            } else {
-                double ratio = diversity / (fabs(pop[0].fitness) + 1e-15);
-                current_mutation = config->adaptive_min_mutation +
-                    (config->adaptive_max_mutation - config->adaptive_min_mutation) *
-                    (1.0 / (1.0 + ratio));
+        }
+        island_swap_op_rng(isl);
+    }
+}
+
+// Modelo de ilhas: epocas de migration_interval geracoes em paralelo,
+// separadas por migracoes seriais
+static OptResult ga_run_islands(const GAConfig *config, const GAProblem *prob, size_t pop_size) {
+    size_t K = config->num_islands;
+    size_t max_gen = config->max_generations;
+    size_t es = prob->element_size;
+
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, max_gen);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
+
+    GAIsland *islands = calloc(K, sizeof(GAIsland));
+    if (islands == NULL) return result;
+    for (size_t i = 0; i < K; i++) {
+        if (!island_alloc(&islands[i], pop_size, es)) {
+            for (size_t j = 0; j < i; j++) island_free(&islands[j]);
+            free(islands);
+            return result;
+        }
+    }
+
+    // Curvas por ilha so no historico completo (K * max_gen doubles)
+    if (max_gen > 0 && config->trace.mode == OPT_TRACE_FULL) {
+        result.island_convergence = calloc(K * max_gen, sizeof(double));
+        if (result.island_convergence != NULL) result.num_islands = K;
+    }
+
+    // Streams nao sobrepostos por ilha: selecao e operadores
+    OptRng base = *rng;
+    for (size_t i = 0; i < K; i++) {
+        islands[i].own_rng = base;
+        opt_rng_jump(&base);
+        islands[i].op_rng = base;
+        opt_rng_jump(&base);
+        islands[i].rng = &islands[i].own_rng;
+    }
+
+    size_t interval = config->migration_interval > 0 ? config->migration_interval : max_gen;
+
+    size_t threads = (config->num_threads == 0) ? K : config->num_threads;
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
+
+    uint64_t fingerprint = ga_fingerprint(config, prob, pop_size, K);
+    size_t gen = 0;
+    size_t saved = 0;
+    bool pending = false;
+    bool resumed = config->checkpoint.resume &&
+                   ga_load(config, islands, K, es, fingerprint, &result, &gen, &pending);
+    if (resumed) {
+        saved = gen;
+        if (pending && gen < max_gen) islands_migrate(islands, K, config, es);
+    }
+
+    // Epoca 0 so inicializa; as demais evoluem [gen, epoch_end) e migram
+    for (bool init = !resumed; init || gen < max_gen; init = false) {
+        size_t epoch_end = init ? 0 : (gen + interval < max_gen ? gen + interval : max_gen);
+
+        GAEpoch epoch = { islands, config, prob, &result, gen, epoch_end, max_gen, init };
+        ds_parallel_for_threads(threads, 0, K, 1, epoch_range, &epoch);
+
+        bool migrate = !init && epoch_end < max_gen;
+        if (migrate) islands_migrate(islands, K, config, es);
+        gen = epoch_end;
+
+        // Checagem no fim da epoca (ilhas sincronizadas)
+        size_t evals = 0;
+        double best = islands[0].best_cost;
+        for (size_t i = 0; i < K; i++) {
+            evals += islands[i].evaluations;
+            if (ga_is_better(islands[i].best_cost, best, config->direction)) {
+                best = islands[i].best_cost;
             }
         }
+        // Uma amostra por epoca; no modo FULL a agregacao abaixo preenche o resto
+        if (!init) opt_tracer_record(&tracer, &result, gen - 1, best, evals);
+        bool stopped = opt_stop_check(&stop, evals, best);
+        if (!init && opt_checkpoint_due(&config->checkpoint, gen, &saved,
+                                        stopped || gen >= max_gen)) {
+            ga_save(config, islands, K, es, fingerprint, &result, gen,
+                    !migrate && config->migration_interval > 0 && gen % interval == 0);
+        }
+        if (stopped) break;
+    }
 
-        if (result.convergence != NULL && gen < result.convergence_size) {
-            result.convergence[gen] = result.best.cost;
+    size_t best_idx = 0;
+    for (size_t i = 0; i < K; i++) {
+        result.num_evaluations += islands[i].evaluations;
+        if (ga_is_better(islands[i].best_cost, islands[best_idx].best_cost, config->direction)) {
+            best_idx = i;
         }
-        result.num_iterations = gen + 1;
     }
 
-    free(child1_buf);
-    free(child2_buf);
+    result.best = opt_solution_create(es);
+    memcpy(result.best.data, islands[best_idx].best_data, es);
+    result.best.cost = islands[best_idx].best_cost;
 
-    for (size_t i = 0; i < pop_size; i++) {
-        free(pop[i].data);
-        free(new_pop[i].data);
+    if (result.convergence != NULL && result.num_islands > 0) {
+        for (size_t g = 0; g < gen; g++) {
+            double best = result.island_convergence[g];
+            for (size_t i = 1; i < K; i++) {
+                double c = result.island_convergence[i * max_gen + g];
+                if (ga_is_better(c, best, config->direction)) best = c;
+            }
+            result.convergence[g] = best;
+        }
+    }
+    result.num_iterations = gen;
+
+    for (size_t i = 0; i < K; i++) island_free(&islands[i]);
+    free(islands);
+    opt_tracer_finish(&tracer, &result);
+    return result;
+}
+
+OptResult ga_run(const GAConfig *config,
+                 size_t element_size,
+                 size_t solution_size,
+                 ObjectiveFn objective,
+                 GenerateFn generate,
+                 CrossoverFn crossover,
+                 MutationFn mutate,
+                 LocalSearchFn local_search,
+                 const void *context) {
+    size_t pop_size = config->population_size;
+    if (pop_size < 4) pop_size = 4;
+    if (pop_size % 2 != 0) pop_size++;
+
+    GAProblem prob;
+    prob.element_size = element_size;
+    prob.solution_size = solution_size;
+    prob.objective = objective;
+    prob.generate = generate;
+    prob.crossover = crossover;
+    prob.mutate = mutate;
+    prob.local_search = config->enable_local_search ? local_search : NULL;
+    prob.context = context;
+
+    if (config->num_islands > 1) {
+        return ga_run_islands(config, &prob, pop_size);
+    }
+
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_generations);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
+
+    GAIsland isl;
+    if (!island_alloc(&isl, pop_size, element_size)) return result;
+    isl.rng = rng;
+
+    uint64_t fingerprint = ga_fingerprint(config, &prob, pop_size, 1);
+    size_t start = 0;
+    bool pending = false;
+    if (config->checkpoint.resume &&
+        ga_load(config, &isl, 1, element_size, fingerprint, &result, &start, &pending)) {
+        result.num_iterations = start;
+    } else {
+        island_init_population(&isl, config, &prob, config->num_threads);
     }
-    free(pop);
-    free(new_pop);
+    size_t saved = start;
+
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
 
+    for (size_t gen = start; gen < config->max_generations; gen++) {
+        island_generation(&isl, config, &prob, config->num_threads);
+
+        opt_tracer_record(&tracer, &result, gen, isl.best_cost, isl.evaluations);
+        result.num_iterations = gen + 1;
+        bool stopped = opt_stop_check(&stop, isl.evaluations, isl.best_cost);
+        if (opt_checkpoint_due(&config->checkpoint, gen + 1, &saved,
+                               stopped || gen + 1 == config->max_generations)) {
+            ga_save(config, &isl, 1, element_size, fingerprint, &result, gen + 1, false);
+        }
+        if (stopped) break;
+    }
+
+    result.best = opt_solution_create(element_size);
+    memcpy(result.best.data, isl.best_data, element_size);
+    result.best.cost = isl.best_cost;
+    result.num_evaluations = isl.evaluations;
+    island_free(&isl);
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
@@ -4,6 +4,8 @@
  *
  * GRASP multi-start: cada iteracao constroi solucao com RCL
  * e aplica busca local. Variante reativa ajusta alpha dinamicamente.
+ * Opcionalmente mantem um pool de elite com path-relinking e distribui as
+ * iteracoes no pool global de threads.
  *
  * Referencias:
  * - Feo, T. A. & Resende, M. G. C. (1995). "Greedy Randomized Adaptive
@@ -14,9 +16,17 @@
  * @date 2025
  */
 
+// pthread_mutex (POSIX) com CMAKE_C_EXTENSIONS OFF
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "optimization/metaheuristics/grasp.h"
 #include "optimization/benchmarks/tsp.h"
 #include "optimization/benchmarks/continuous.h"
+#include "data_structures/thread_pool.h"
+#include <pthread.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
@@ -26,16 +36,34 @@
 // HELPERS
 // ============================================================================
 
+/** Iteracoes por thread em cada rodada do modo paralelo */
+#define GRASP_ROUND_PER_THREAD 2
+
 static bool grasp_is_better(double a, double b, OptDirection dir) {
     return (dir == OPT_MINIMIZE) ? (a < b) : (a > b);
 }
 
+static double grasp_worst(OptDirection dir) {
+    return (dir == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
+}
+
+// Busca local: LocalSearchFn externa, se configurada; senao, melhor de
+// local_search_neighbors vizinhos aleatorios por iteracao
 static void grasp_local_search(void *solution, double *cost,
                                size_t element_size, size_t solution_size,
-                               size_t max_iter, size_t neighbors_per_iter,
+                               const GRASPConfig *config,
                                ObjectiveFn objective, NeighborFn neighbor,
-                               OptDirection direction, const void *context,
-                               size_t *eval_count) {
+                               const void *context, size_t *eval_count) {
+    if (config->local_search != NULL) {
+        *cost = config->local_search(solution, solution_size, objective, context);
+        (*eval_count)++;
+        return;
+    }
+    if (neighbor == NULL) return;
+
+    size_t max_iter = config->local_search_iterations;
+    size_t neighbors_per_iter = config->local_search_neighbors;
+    OptDirection direction = config->direction;
     void *candidate = malloc(element_size);
     void *best_neighbor = malloc(element_size);
     if (candidate == NULL || best_neighbor == NULL) {
@@ -72,6 +100,246 @@ static void grasp_local_search(void *solution, double *cost,
     free(best_neighbor);
 }
 
+// ============================================================================
+// POOL DE ELITE
+// ============================================================================
+
+typedef struct {
+    unsigned char *data;       // capacity x element_size
+    double *cost;
+    size_t count;
+    size_t capacity;
+    size_t element_size;
+    OptDirection direction;
+    pthread_mutex_t lock;      // iteracoes paralelas leem e oferecem sob ele
+} GRASPElitePool;
+
+static bool elite_init(GRASPElitePool *pool, size_t capacity, size_t element_size,
+                       OptDirection direction) {
+    pool->data = malloc(capacity * element_size);
+    pool->cost = malloc(capacity * sizeof(double));
+    pool->count = 0;
+    pool->capacity = capacity;
+    pool->element_size = element_size;
+    pool->direction = direction;
+    if (pool->data == NULL || pool->cost == NULL ||
+        pthread_mutex_init(&pool->lock, NULL) != 0) {
+        free(pool->data);
+        free(pool->cost);
+        return false;
+    }
+    return true;
+}
+
+static void elite_destroy(GRASPElitePool *pool) {
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->data);
+    free(pool->cost);
+}
+
+// Sem duplicatas; cheio, o novo entra no lugar do pior se for melhor.
+// Chamar com o lock
+static void elite_offer(GRASPElitePool *pool, const void *solution, double cost) {
+    size_t worst = 0;
+    for (size_t i = 0; i < pool->count; i++) {
+        if (memcmp(pool->data + i * pool->element_size, solution, pool->element_size) == 0) return;
+        if (grasp_is_better(pool->cost[worst], pool->cost[i], pool->direction)) worst = i;
+    }
+
+    size_t slot;
+    if (pool->count < pool->capacity) {
+        slot = pool->count++;
+    } else if (grasp_is_better(cost, pool->cost[worst], pool->direction)) {
+        slot = worst;
+    } else {
+        return;
+    }
+    memcpy(pool->data + slot * pool->element_size, solution, pool->element_size);
+    pool->cost[slot] = cost;
+}
+
+// ============================================================================
+// ITERACAO (CONSTRUCAO + BUSCA LOCAL + RELINKING)
+// ============================================================================
+
+// Estado de uma iteracao: otimo local, elite guia e intermediaria religada
+typedef struct {
+    unsigned char *current;
+    unsigned char *guide;
+    unsigned char *relinked;
+    double alpha;
+    size_t alpha_idx;
+    uint64_t seed;             // semente do stream da thread (modo paralelo)
+    double cost;
+    size_t evaluations;
+} GRASPSlot;
+
+typedef struct {
+    const GRASPConfig *config;
+    size_t element_size;
+    size_t solution_size;
+    ObjectiveFn objective;
+    GRASPConstructFn construct;
+    NeighborFn neighbor;
+    const void *context;
+    GRASPElitePool *pool;      // NULL = sem pool de elite
+    GRASPSlot *slots;
+    const size_t *pairs;       // pos-otimizacao: pares (a, b) do pool
+} GRASPShared;
+
+// Religa from -> to e, havendo intermediaria, aplica busca local nela.
+// Retorna o custo em out (pior valor da direcao se nao houve)
+static double relink_and_search(const GRASPShared *sh, const void *from, const void *to,
+                                void *out, size_t *evaluations) {
+    const GRASPConfig *config = sh->config;
+    double cost = config->relink(from, to, out, sh->solution_size, sh->objective,
+                                 config->direction, sh->context, evaluations);
+    if (!grasp_is_better(cost, grasp_worst(config->direction), config->direction)) return cost;
+    grasp_local_search(out, &cost, sh->element_size, sh->solution_size, config,
+                       sh->objective, sh->neighbor, sh->context, evaluations);
+    return cost;
+}
+
+// Backward relinking com uma elite sorteada: parte da melhor das duas
+static void relink_with_elite(const GRASPShared *sh, GRASPSlot *slot) {
+    GRASPElitePool *pool = sh->pool;
+    OptDirection direction = sh->config->direction;
+    double guide_cost = 0.0;
+
+    pthread_mutex_lock(&pool->lock);
+    bool has_guide = pool->count > 0;
+    if (has_guide) {
+        size_t g = (size_t)opt_random_int(0, (int)pool->count - 1);
+        memcpy(slot->guide, pool->data + g * sh->element_size, sh->element_size);
+        guide_cost = pool->cost[g];
+    }
+    pthread_mutex_unlock(&pool->lock);
+    if (!has_guide) return;
+
+    const void *from = slot->current;
+    const void *to = slot->guide;
+    if (grasp_is_better(guide_cost, slot->cost, direction)) {
+        from = slot->guide;
+        to = slot->current;
+    }
+    double cost = relink_and_search(sh, from, to, slot->relinked, &slot->evaluations);
+    if (grasp_is_better(cost, slot->cost, direction)) {
+        memcpy(slot->current, slot->relinked, sh->element_size);
+        slot->cost = cost;
+    }
+}
+
+static void grasp_iteration(const GRASPShared *sh, GRASPSlot *slot) {
+    const GRASPConfig *config = sh->config;
+    sh->construct(slot->current, sh->solution_size, slot->alpha, sh->context);
+    slot->cost = sh->objective(slot->current, sh->solution_size, sh->context);
+    slot->evaluations = 1;
+
+    grasp_local_search(slot->current, &slot->cost, sh->element_size, sh->solution_size,
+                       config, sh->objective, sh->neighbor, sh->context, &slot->evaluations);
+    if (sh->pool == NULL) return;
+
+    if (config->relink != NULL) relink_with_elite(sh, slot);
+    pthread_mutex_lock(&sh->pool->lock);
+    elite_offer(sh->pool, slot->current, slot->cost);
+    pthread_mutex_unlock(&sh->pool->lock);
+}
+
+// Cada iteracao semeia o stream da thread com a sua semente (restaurado ao
+// fim): construcao e busca nao dependem de qual thread executa
+static void grasp_round_range(void *ctx, size_t lo, size_t hi) {
+    const GRASPShared *sh = ctx;
+    OptRng *thread_rng = opt_rng_thread();
+    for (size_t i = lo; i < hi; i++) {
+        OptRng saved = *thread_rng;
+        opt_rng_seed(thread_rng, sh->slots[i].seed);
+        grasp_iteration(sh, &sh->slots[i]);
+        *thread_rng = saved;
+    }
+}
+
+// Relinking do par i do pool (congelado durante a pos-otimizacao)
+static void relink_pair(const GRASPShared *sh, size_t i) {
+    const GRASPElitePool *pool = sh->pool;
+    GRASPSlot *slot = &sh->slots[i];
+    size_t a = sh->pairs[2 * i];
+    size_t b = sh->pairs[2 * i + 1];
+    if (grasp_is_better(pool->cost[b], pool->cost[a], pool->direction)) {
+        size_t t = a;
+        a = b;
+        b = t;
+    }
+    slot->evaluations = 0;
+    slot->cost = relink_and_search(sh, pool->data + a * pool->element_size,
+                                   pool->data + b * pool->element_size,
+                                   slot->current, &slot->evaluations);
+}
+
+static void relink_pair_range(void *ctx, size_t lo, size_t hi) {
+    const GRASPShared *sh = ctx;
+    OptRng *thread_rng = opt_rng_thread();
+    for (size_t i = lo; i < hi; i++) {
+        OptRng saved = *thread_rng;
+        opt_rng_seed(thread_rng, sh->slots[i].seed);
+        relink_pair(sh, i);
+        *thread_rng = saved;
+    }
+}
+
+// Pos-otimizacao: religa todos os pares de elite e oferece o melhor
+// resultado a best. Retorna as avaliacoes gastas
+static size_t elite_post_relink(const GRASPShared *base, OptRng *rng, bool parallel,
+                                OptSolution *best) {
+    const GRASPElitePool *pool = base->pool;
+    size_t k = pool->count;
+    size_t num_pairs = k * (k - 1) / 2;
+    if (k < 2) return 0;
+
+    size_t es = base->element_size;
+    GRASPSlot *slots = malloc(num_pairs * sizeof(GRASPSlot));
+    size_t *pairs = malloc(2 * num_pairs * sizeof(size_t));
+    unsigned char *buffers = malloc(num_pairs * es);
+    if (slots == NULL || pairs == NULL || buffers == NULL) {
+        free(slots);
+        free(pairs);
+        free(buffers);
+        return 0;
+    }
+
+    size_t p = 0;
+    for (size_t a = 0; a < k; a++) {
+        for (size_t b = a + 1; b < k; b++, p++) {
+            pairs[2 * p] = a;
+            pairs[2 * p + 1] = b;
+            slots[p].current = buffers + p * es;
+            slots[p].seed = parallel ? opt_rng_next(rng) : 0;
+        }
+    }
+
+    GRASPShared sh = *base;
+    sh.slots = slots;
+    sh.pairs = pairs;
+    if (parallel) {
+        ds_parallel_for(0, num_pairs, 1, relink_pair_range, &sh);
+    } else {
+        for (size_t i = 0; i < num_pairs; i++) relink_pair(&sh, i);
+    }
+
+    size_t evaluations = 0;
+    for (size_t i = 0; i < num_pairs; i++) {
+        evaluations += slots[i].evaluations;
+        if (grasp_is_better(slots[i].cost, best->cost, pool->direction)) {
+            memcpy(best->data, slots[i].current, es);
+            best->cost = slots[i].cost;
+        }
+    }
+
+    free(slots);
+    free(pairs);
+    free(buffers);
+    return evaluations;
+}
+
 // ============================================================================
 // CONFIGURACAO
 // ============================================================================
@@ -82,11 +350,19 @@ GRASPConfig grasp_default_config(void) {
     config.alpha = 0.3;
     config.local_search_iterations = 100;
     config.local_search_neighbors = 20;
+    config.local_search = NULL;
     config.enable_reactive = false;
     config.reactive_num_alphas = 5;
     config.reactive_block_size = 50;
+    config.elite_size = 0;
+    config.relink = NULL;
+    config.relink_elite_pairs = true;
+    config.num_threads = 1;
+    config.stop = opt_stop_none();
+    config.trace = opt_trace_default();
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
     return config;
 }
 
@@ -101,14 +377,43 @@ OptResult grasp_run(const GRASPConfig *config,
                     GRASPConstructFn construct,
                     NeighborFn neighbor,
                     const void *context) {
-    OptResult result = opt_result_create(config->max_iterations);
-    opt_set_seed(config->seed);
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_iterations);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
+
+    // Modo paralelo: rodadas de GRASP_ROUND_PER_THREAD iteracoes por thread
+    bool parallel = ds_resolve_threads(config->num_threads) > 1;
+    size_t round_size = parallel ? GRASP_ROUND_PER_THREAD * ds_get_num_threads() : 1;
+    bool use_pool = config->elite_size > 0;
+
+    GRASPSlot *slots = malloc(round_size * sizeof(GRASPSlot));
+    unsigned char *buffers = malloc(round_size * 3 * element_size);
+    if (slots == NULL || buffers == NULL) {
+        free(slots);
+        free(buffers);
+        return result;
+    }
+    for (size_t r = 0; r < round_size; r++) {
+        slots[r].current = buffers + (3 * r) * element_size;
+        slots[r].guide = buffers + (3 * r + 1) * element_size;
+        slots[r].relinked = buffers + (3 * r + 2) * element_size;
+    }
+
+    GRASPElitePool pool;
+    if (use_pool && !elite_init(&pool, config->elite_size, element_size, config->direction)) {
+        free(slots);
+        free(buffers);
+        return result;
+    }
 
-    void *current = malloc(element_size);
-    if (current == NULL) return result;
+    GRASPShared shared = {
+        .config = config, .element_size = element_size, .solution_size = solution_size,
+        .objective = objective, .construct = construct, .neighbor = neighbor,
+        .context = context, .pool = use_pool ? &pool : NULL, .slots = slots, .pairs = NULL
+    };
 
     result.best = opt_solution_create(element_size);
-    result.best.cost = (config->direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
+    result.best.cost = grasp_worst(config->direction);
 
     double *alphas = NULL;
     double *alpha_scores = NULL;
@@ -123,7 +428,9 @@ OptResult grasp_run(const GRASPConfig *config,
             free(alphas);
             free(alpha_scores);
             free(alpha_counts);
-            free(current);
+            free(slots);
+            free(buffers);
+            if (use_pool) elite_destroy(&pool);
             return result;
         }
         for (size_t i = 0; i < num_alphas; i++) {
@@ -131,78 +438,101 @@ OptResult grasp_run(const GRASPConfig *config,
         }
     }
 
-    for (size_t iter = 0; iter < config->max_iterations; iter++) {
-        double alpha = config->alpha;
-        size_t alpha_idx = 0;
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
+    bool stopped = false;
 
-        if (config->enable_reactive && alphas != NULL) {
-            if (iter > 0 && iter % config->reactive_block_size == 0) {
-                double total_score = 0;
-                for (size_t i = 0; i < num_alphas; i++) {
-                    if (alpha_counts[i] > 0) {
-                        alpha_scores[i] = alpha_scores[i] / (double)alpha_counts[i];
+    for (size_t base = 0; base < config->max_iterations && !stopped; base += round_size) {
+        size_t round = config->max_iterations - base;
+        if (round > round_size) round = round_size;
+
+        // Sorteios da rodada na thread chamadora, na ordem das iteracoes
+        for (size_t r = 0; r < round; r++) {
+            size_t iter = base + r;
+            double alpha = config->alpha;
+            size_t alpha_idx = 0;
+
+            if (config->enable_reactive && alphas != NULL) {
+                if (iter > 0 && iter % config->reactive_block_size == 0) {
+                    double total_score = 0;
+                    for (size_t i = 0; i < num_alphas; i++) {
+                        if (alpha_counts[i] > 0) {
+                            alpha_scores[i] = alpha_scores[i] / (double)alpha_counts[i];
+                        }
+                        total_score += alpha_scores[i];
+                    }
+                    if (total_score > 1e-12) {
+                        for (size_t i = 0; i < num_alphas; i++) {
+                            alpha_scores[i] /= total_score;
+                        }
                     }
-                    total_score += alpha_scores[i];
-                }
-                if (total_score > 1e-12) {
                     for (size_t i = 0; i < num_alphas; i++) {
-                        alpha_scores[i] /= total_score;
+                        alpha_scores[i] = 0;
+                        alpha_counts[i] = 0;
                     }
                 }
+
+                double r_alpha = opt_rng_uniform(rng);
+                double cum = 0;
+                alpha_idx = num_alphas - 1;
+                double prob_each = 1.0 / (double)num_alphas;
                 for (size_t i = 0; i < num_alphas; i++) {
-                    alpha_scores[i] = 0;
-                    alpha_counts[i] = 0;
+                    cum += prob_each;
+                    if (r_alpha < cum) {
+                        alpha_idx = i;
+                        break;
+                    }
                 }
+                alpha = alphas[alpha_idx];
             }
 
-            double r = opt_random_uniform();
-            double cum = 0;
-            alpha_idx = num_alphas - 1;
-            double prob_each = 1.0 / (double)num_alphas;
-            for (size_t i = 0; i < num_alphas; i++) {
-                cum += prob_each;
-                if (r < cum) {
-                    alpha_idx = i;
-                    break;
-                }
-            }
-            alpha = alphas[alpha_idx];
+            slots[r].alpha = alpha;
+            slots[r].alpha_idx = alpha_idx;
+            if (parallel) slots[r].seed = opt_rng_next(rng);
         }
 
-        construct(current, solution_size, alpha, context);
-        double current_cost = objective(current, solution_size, context);
-        result.num_evaluations++;
-
-        grasp_local_search(current, &current_cost,
-                           element_size, solution_size,
-                           config->local_search_iterations,
-                           config->local_search_neighbors,
-                           objective, neighbor, config->direction, context,
-                           &result.num_evaluations);
-
-        if (config->enable_reactive && alpha_scores != NULL) {
-            double score = (config->direction == OPT_MINIMIZE)
-                           ? 1.0 / (1.0 + current_cost)
-                           : current_cost;
-            alpha_scores[alpha_idx] += score;
-            alpha_counts[alpha_idx]++;
+        if (parallel) {
+            ds_parallel_for(0, round, 1, grasp_round_range, &shared);
+        } else {
+            grasp_iteration(&shared, &slots[0]);
         }
 
-        if (grasp_is_better(current_cost, result.best.cost, config->direction)) {
-            memcpy(result.best.data, current, element_size);
-            result.best.cost = current_cost;
-        }
+        for (size_t r = 0; r < round; r++) {
+            size_t iter = base + r;
+            const GRASPSlot *slot = &slots[r];
+            result.num_evaluations += slot->evaluations;
+
+            if (config->enable_reactive && alpha_scores != NULL) {
+                double score = (config->direction == OPT_MINIMIZE)
+                               ? 1.0 / (1.0 + slot->cost)
+                               : slot->cost;
+                alpha_scores[slot->alpha_idx] += score;
+                alpha_counts[slot->alpha_idx]++;
+            }
+
+            if (grasp_is_better(slot->cost, result.best.cost, config->direction)) {
+                memcpy(result.best.data, slot->current, element_size);
+                result.best.cost = slot->cost;
+            }
 
-        if (result.convergence != NULL && iter < result.convergence_size) {
-            result.convergence[iter] = result.best.cost;
+            stopped = opt_stop_check(&stop, result.num_evaluations, result.best.cost);
+            bool last = stopped || iter + 1 == config->max_iterations;
+            if (last && use_pool && config->relink != NULL && config->relink_elite_pairs) {
+                result.num_evaluations += elite_post_relink(&shared, rng, parallel, &result.best);
+            }
+
+            opt_tracer_record(&tracer, &result, iter, result.best.cost, result.num_evaluations);
+            result.num_iterations = iter + 1;
+            if (stopped) break;
         }
-        result.num_iterations = iter + 1;
     }
 
-    free(current);
+    free(slots);
+    free(buffers);
+    if (use_pool) elite_destroy(&pool);
     free(alphas);
     free(alpha_scores);
     free(alpha_counts);
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
 
@@ -233,7 +563,7 @@ void grasp_construct_tsp_nn(void *solution, size_t size,
 
         for (size_t j = 0; j < n; j++) {
             if (!visited[j]) {
-                double d = tsp->dist_matrix[current][j];
+                double d = tsp_dist(tsp, (size_t)current, j);
                 if (d < d_min) d_min = d;
                 if (d > d_max) d_max = d;
             }
@@ -251,7 +581,7 @@ void grasp_construct_tsp_nn(void *solution, size_t size,
         }
 
         for (size_t j = 0; j < n; j++) {
-            if (!visited[j] && tsp->dist_matrix[current][j] <= threshold + 1e-9) {
+            if (!visited[j] && tsp_dist(tsp, (size_t)current, j) <= threshold + 1e-9) {
                 rcl[rcl_size++] = (int)j;
             }
         }
@@ -291,3 +621,88 @@ void grasp_construct_continuous(void *solution, size_t size,
         x[d] = greedy + alpha * (random_val - greedy);
     }
 }
+
+// ============================================================================
+// PATH-RELINKING BUILTIN
+// ============================================================================
+
+// Guarda em best a intermediaria corrente se ela superar best_cost
+static void relink_consider(const void *current, void *best, size_t bytes, double cost,
+                            double *best_cost, OptDirection direction) {
+    if (grasp_is_better(cost, *best_cost, direction)) {
+        memcpy(best, current, bytes);
+        *best_cost = cost;
+    }
+}
+
+double grasp_relink_permutation(const void *initial, const void *guide, void *best,
+                                size_t size, ObjectiveFn objective,
+                                OptDirection direction, const void *context,
+                                size_t *evaluations) {
+    const int *target = (const int *)guide;
+    double best_cost = grasp_worst(direction);
+    size_t bytes = size * sizeof(int);
+
+    int *current = malloc(bytes);
+    size_t *pos = malloc(size * sizeof(size_t));
+    if (current == NULL || pos == NULL) {
+        free(current);
+        free(pos);
+        return best_cost;
+    }
+    memcpy(current, initial, bytes);
+    for (size_t i = 0; i < size; i++) pos[current[i]] = i;
+
+    // Cada troca fixa ao menos uma posicao; a ultima leva ao guia e nao conta
+    size_t remaining = 0;
+    for (size_t i = 0; i < size; i++) remaining += (current[i] != target[i]);
+
+    for (size_t i = 0; i < size && remaining > 0; i++) {
+        if (current[i] == target[i]) continue;
+        size_t j = pos[target[i]];
+        int displaced = current[i];
+        current[i] = target[i];
+        current[j] = displaced;
+        pos[displaced] = j;
+        pos[target[i]] = i;
+        remaining -= 1 + (current[j] == target[j]);
+        if (remaining == 0) break;
+
+        double cost = objective(current, size, context);
+        (*evaluations)++;
+        relink_consider(current, best, bytes, cost, &best_cost, direction);
+    }
+
+    free(current);
+    free(pos);
+    return best_cost;
+}
+
+double grasp_relink_continuous(const void *initial, const void *guide, void *best,
+                               size_t size, ObjectiveFn objective,
+                               OptDirection direction, const void *context,
+                               size_t *evaluations) {
+    const double *target = (const double *)guide;
+    double best_cost = grasp_worst(direction);
+    size_t bytes = size * sizeof(double);
+
+    double *current = malloc(bytes);
+    if (current == NULL) return best_cost;
+    memcpy(current, initial, bytes);
+
+    size_t remaining = 0;
+    for (size_t d = 0; d < size; d++) remaining += (current[d] != target[d]);
+
+    for (size_t d = 0; d < size && remaining > 1; d++) {
+        if (current[d] == target[d]) continue;
+        current[d] = target[d];
+        remaining--;
+
+        double cost = objective(current, size, context);
+        (*evaluations)++;
+        relink_consider(current, best, bytes, cost, &best_cost, direction);
+    }
+
+    free(current);
+    return best_cost;
+}
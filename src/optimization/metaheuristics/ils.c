@@ -16,6 +16,7 @@
  */
 
 #include "optimization/metaheuristics/ils.h"
+#include "optimization/eval_cache.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
@@ -29,17 +30,29 @@ static bool ils_is_better(double a, double b, OptDirection dir) {
     return (dir == OPT_MINIMIZE) ? (a < b) : (a > b);
 }
 
+// Busca local: LocalSearchFn externa, se configurada; senao, melhor de
+// local_search_neighbors vizinhos aleatorios por iteracao. Os buffers de
+// trabalho vem do pool da execucao (sem malloc por chamada)
 static void local_search(void *solution, double *cost,
                          size_t element_size, size_t solution_size,
-                         size_t max_iter, size_t neighbors_per_iter,
+                         const ILSConfig *config,
                          ObjectiveFn objective, NeighborFn neighbor,
-                         OptDirection direction, const void *context,
-                         size_t *eval_count) {
-    void *candidate = malloc(element_size);
-    void *best_neighbor = malloc(element_size);
+                         const void *context, size_t *eval_count,
+                         OptSolutionPool *pool) {
+    if (config->local_search != NULL) {
+        *cost = config->local_search(solution, solution_size, objective, context);
+        (*eval_count)++;
+        return;
+    }
+
+    size_t max_iter = config->local_search_iterations;
+    size_t neighbors_per_iter = config->local_search_neighbors;
+    OptDirection direction = config->direction;
+    void *candidate = opt_solution_pool_acquire(pool);
+    void *best_neighbor = opt_solution_pool_acquire(pool);
     if (candidate == NULL || best_neighbor == NULL) {
-        free(candidate);
-        free(best_neighbor);
+        opt_solution_pool_release(pool, candidate);
+        opt_solution_pool_release(pool, best_neighbor);
         return;
     }
 
@@ -67,8 +80,8 @@ static void local_search(void *solution, double *cost,
         }
     }
 
-    free(candidate);
-    free(best_neighbor);
+    opt_solution_pool_release(pool, candidate);
+    opt_solution_pool_release(pool, best_neighbor);
 }
 
 // ============================================================================
@@ -80,13 +93,22 @@ ILSConfig ils_default_config(void) {
     config.max_iterations = 1000;
     config.local_search_iterations = 200;
     config.local_search_neighbors = 20;
+    config.local_search = NULL;
     config.perturbation_strength = 1;
     config.acceptance = ILS_ACCEPT_BETTER;
     config.sa_initial_temp = 10.0;
     config.sa_alpha = 0.95;
     config.restart_threshold = 50;
+    config.history_length = 50;
+    config.lsmc_temperature = 1.0;
+    config.adaptive_perturbation = false;
+    config.perturbation_max_strength = 10;
+    config.visited_capacity = 0;
+    config.stop = opt_stop_none();
+    config.trace = opt_trace_default();
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
     return config;
 }
 
@@ -102,16 +124,31 @@ OptResult ils_run(const ILSConfig *config,
                   PerturbFn perturb,
                   GenerateFn generate,
                   const void *context) {
-    OptResult result = opt_result_create(config->max_iterations);
-    opt_set_seed(config->seed);
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_iterations);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
 
-    void *current = malloc(element_size);
-    void *perturbed = malloc(element_size);
-    void *ls_buffer = malloc(element_size);
-    if (current == NULL || perturbed == NULL || ls_buffer == NULL) {
+    // current, perturbed, ls_buffer + 2 buffers da busca local
+    OptSolutionPool pool = opt_solution_pool_create(element_size, 5);
+    void *current = opt_solution_pool_acquire(&pool);
+    void *perturbed = opt_solution_pool_acquire(&pool);
+    void *ls_buffer = opt_solution_pool_acquire(&pool);
+    size_t history_length = config->history_length > 0 ? config->history_length : 1;
+    double *history = (config->acceptance == ILS_ACCEPT_LATE)
+                      ? malloc(history_length * sizeof(double)) : NULL;
+    OptEvalCache *visited = (config->visited_capacity > 0)
+                            ? opt_eval_cache_create(config->visited_capacity, element_size,
+                                                    objective, context)
+                            : NULL;
+    if (current == NULL || perturbed == NULL || ls_buffer == NULL ||
+        (config->acceptance == ILS_ACCEPT_LATE && history == NULL) ||
+        (config->visited_capacity > 0 && visited == NULL)) {
         free(current);
         free(perturbed);
         free(ls_buffer);
+        free(history);
+        opt_eval_cache_destroy(visited);
+        opt_solution_pool_destroy(&pool);
         return result;
     }
 
@@ -120,40 +157,65 @@ OptResult ils_run(const ILSConfig *config,
     result.num_evaluations = 1;
 
     local_search(current, &current_cost,
-                 element_size, solution_size,
-                 config->local_search_iterations,
-                 config->local_search_neighbors,
-                 objective, neighbor, config->direction, context,
-                 &result.num_evaluations);
+                 element_size, solution_size, config,
+                 objective, neighbor, context,
+                 &result.num_evaluations, &pool);
 
     result.best = opt_solution_create(element_size);
     memcpy(result.best.data, current, element_size);
     result.best.cost = current_cost;
 
+    opt_eval_cache_store(visited, current, current_cost);
+    for (size_t h = 0; history != NULL && h < history_length; h++) history[h] = current_cost;
+
     double sa_temp = config->sa_initial_temp;
     size_t no_improve_count = 0;
+    int base_strength = config->perturbation_strength;
+    int max_strength = config->perturbation_max_strength > base_strength
+                       ? config->perturbation_max_strength : base_strength;
+    int strength = base_strength;
+
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
 
     for (size_t iter = 0; iter < config->max_iterations; iter++) {
         if (perturb != NULL) {
-            perturb(current, perturbed, solution_size,
-                    config->perturbation_strength, context);
+            perturb(current, perturbed, solution_size, strength, context);
         } else {
             memcpy(perturbed, current, element_size);
-            for (int s = 0; s < config->perturbation_strength; s++) {
+            for (int s = 0; s < strength; s++) {
                 neighbor(perturbed, perturbed, solution_size, context);
             }
         }
-        double perturbed_cost = objective(perturbed, solution_size, context);
-        result.num_evaluations++;
 
+        // Caiu num otimo visitado: custo guardado, sem avaliacao nem busca
+        double ls_cost;
+        bool revisit = opt_eval_cache_lookup(visited, perturbed, &ls_cost);
         memcpy(ls_buffer, perturbed, element_size);
-        double ls_cost = perturbed_cost;
-        local_search(ls_buffer, &ls_cost,
-                     element_size, solution_size,
-                     config->local_search_iterations,
-                     config->local_search_neighbors,
-                     objective, neighbor, config->direction, context,
-                     &result.num_evaluations);
+        if (revisit) {
+            result.num_cache_hits++;
+        } else {
+            ls_cost = objective(perturbed, solution_size, context);
+            result.num_evaluations++;
+            local_search(ls_buffer, &ls_cost,
+                         element_size, solution_size, config,
+                         objective, neighbor, context,
+                         &result.num_evaluations, &pool);
+            if (visited != NULL) {
+                revisit = opt_eval_cache_lookup(visited, ls_buffer, NULL);
+                if (!revisit) opt_eval_cache_store(visited, ls_buffer, ls_cost);
+            }
+        }
+
+        bool improved = ils_is_better(ls_cost, current_cost, config->direction);
+        if (config->adaptive_perturbation) {
+            if (revisit) {
+                if (strength < max_strength) strength++;
+            } else if (improved) {
+                strength = base_strength;
+            } else if (strength > base_strength) {
+                strength--;
+            }
+        }
 
         bool accept = false;
         switch (config->acceptance) {
@@ -172,12 +234,25 @@ OptResult ils_run(const ILSConfig *config,
                                    : (current_cost - ls_cost);
                     if (sa_temp > 1e-12) {
                         double prob = exp(-delta / sa_temp);
-                        accept = (opt_random_uniform() < prob);
+                        accept = (opt_rng_uniform(rng) < prob);
                     }
                     sa_temp *= config->sa_alpha;
                 }
                 break;
             }
+            case ILS_ACCEPT_LATE: {
+                size_t slot = iter % history_length;
+                accept = improved || !ils_is_better(history[slot], ls_cost, config->direction);
+                break;
+            }
+            case ILS_ACCEPT_LSMC:
+                if (improved) {
+                    accept = true;
+                } else if (config->lsmc_temperature > 1e-12) {
+                    double delta = fabs(ls_cost - current_cost);
+                    accept = opt_rng_uniform(rng) < exp(-delta / config->lsmc_temperature);
+                }
+                break;
             case ILS_ACCEPT_RESTART:
                 accept = ils_is_better(ls_cost, current_cost, config->direction);
                 if (!accept) {
@@ -197,20 +272,24 @@ OptResult ils_run(const ILSConfig *config,
             memcpy(current, ls_buffer, element_size);
             current_cost = ls_cost;
         }
+        if (history != NULL) history[iter % history_length] = current_cost;
 
         if (ils_is_better(current_cost, result.best.cost, config->direction)) {
             memcpy(result.best.data, current, element_size);
             result.best.cost = current_cost;
         }
 
-        if (result.convergence != NULL && iter < result.convergence_size) {
-            result.convergence[iter] = result.best.cost;
-        }
+        opt_tracer_record(&tracer, &result, iter, result.best.cost, result.num_evaluations);
         result.num_iterations = iter + 1;
+        if (opt_stop_check(&stop, result.num_evaluations, result.best.cost)) break;
     }
 
-    free(current);
-    free(perturbed);
-    free(ls_buffer);
+    opt_solution_pool_release(&pool, current);
+    opt_solution_pool_release(&pool, perturbed);
+    opt_solution_pool_release(&pool, ls_buffer);
+    opt_solution_pool_destroy(&pool);
+    free(history);
+    opt_eval_cache_destroy(visited);
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
@@ -18,6 +18,7 @@
 #include <string.h>
 #include <math.h>
 #include <float.h>
+#include <stdbool.h>
 
 // ============================================================================
 // HELPERS
@@ -27,7 +28,7 @@ static int is_better(double a, double b, OptDirection dir) {
     return (dir == OPT_MINIMIZE) ? (a < b) : (a > b);
 }
 
-static int sa_accept(double current_cost, double new_cost, double temp,
+static int sa_accept(OptRng *rng, double current_cost, double new_cost, double temp,
                      OptDirection direction) {
     double delta;
     if (direction == OPT_MINIMIZE) {
@@ -38,21 +39,58 @@ static int sa_accept(double current_cost, double new_cost, double temp,
     if (delta <= 0.0) return 1;
     if (temp <= 0.0) return 0;
     double prob = exp(-delta / temp);
-    return opt_random_uniform() < prob;
+    return opt_rng_uniform(rng) < prob;
 }
 
-static size_t roulette_select_weighted(const double *weights, size_t n) {
+// ============================================================================
+// ROLETA SOBRE ARVORE DE FENWICK
+// ============================================================================
+
+// Somas parciais dos pesos (1-indexada): sorteio em O(log k) e
+// reconstrucao em O(k) quando os pesos mudam
+typedef struct {
+    double *tree;
+    size_t n;
+    size_t top;    // Maior potencia de 2 <= n
+} WeightTree;
+
+static bool weight_tree_init(WeightTree *wt, size_t n) {
+    wt->tree = calloc(n + 1, sizeof(double));
+    wt->n = n;
+    wt->top = 1;
+    while (wt->top * 2 <= n) wt->top *= 2;
+    return wt->tree != NULL;
+}
+
+static void weight_tree_build(WeightTree *wt, const double *weights) {
+    wt->tree[0] = 0.0;
+    for (size_t i = 1; i <= wt->n; i++) wt->tree[i] = weights[i - 1];
+    for (size_t i = 1; i <= wt->n; i++) {
+        size_t parent = i + (i & (~i + 1));
+        if (parent <= wt->n) wt->tree[parent] += wt->tree[i];
+    }
+}
+
+static double weight_tree_total(const WeightTree *wt) {
     double total = 0.0;
-    for (size_t i = 0; i < n; i++) total += weights[i];
-    if (total <= 0.0) return (size_t)opt_random_int(0, (int)n - 1);
+    for (size_t i = wt->n; i > 0; i -= i & (~i + 1)) total += wt->tree[i];
+    return total;
+}
 
-    double r = opt_random_uniform() * total;
-    double cum = 0.0;
-    for (size_t i = 0; i < n; i++) {
-        cum += weights[i];
-        if (cum >= r) return i;
+// Primeiro indice cuja soma acumulada atinge r (mesma regra da roleta linear)
+static size_t weight_tree_sample(const WeightTree *wt, OptRng *rng) {
+    double total = weight_tree_total(wt);
+    if (total <= 0.0) return (size_t)opt_rng_int(rng, 0, (int)wt->n - 1);
+
+    double r = opt_rng_uniform(rng) * total;
+    size_t pos = 0;
+    for (size_t step = wt->top; step > 0; step >>= 1) {
+        if (pos + step <= wt->n && wt->tree[pos + step] < r) {
+            pos += step;
+            r -= wt->tree[pos];
+        }
     }
-    return n - 1;
+    return (pos < wt->n) ? pos : wt->n - 1;
 }
 
 // ============================================================================
@@ -98,7 +136,8 @@ void lns_destroy_tsp_worst(const void *solution, void *destroyed, size_t size,
         int prev = tour[(i - 1 + n) % n];
         int curr = tour[i];
         int next = tour[(i + 1) % n];
-        costs[i] = tsp->dist_matrix[prev][curr] + tsp->dist_matrix[curr][next];
+        costs[i] = tsp_dist(tsp, (size_t)prev, (size_t)curr) +
+                   tsp_dist(tsp, (size_t)curr, (size_t)next);
     }
 
     for (int r = 0; r < to_remove; r++) {
@@ -188,9 +227,9 @@ void lns_repair_tsp_greedy(const void *destroyed, void *repaired, size_t size,
                 next_city = partial[p];
             }
 
-            double old_cost = tsp->dist_matrix[prev_city][next_city];
-            double new_cost = tsp->dist_matrix[prev_city][city] +
-                              tsp->dist_matrix[city][next_city];
+            double old_cost = tsp_dist(tsp, (size_t)prev_city, (size_t)next_city);
+            double new_cost = tsp_dist(tsp, (size_t)prev_city, (size_t)city) +
+                              tsp_dist(tsp, (size_t)city, (size_t)next_city);
             double increase = new_cost - old_cost;
 
             if (increase < best_cost_increase) {
@@ -213,6 +252,405 @@ void lns_repair_tsp_greedy(const void *destroyed, void *repaired, size_t size,
     free(present);
 }
 
+// ============================================================================
+// REPAIR REGRET-K - TSP
+// ============================================================================
+
+#define LNS_REGRET_MAX_K 3
+
+// Entrada da fila de prioridade; version invalida entradas antigas
+typedef struct {
+    double regret;
+    double best;
+    int city;
+    unsigned version;
+} RegretEntry;
+
+// Maior regret primeiro; empate: menor custo de insercao, menor cidade
+static bool regret_before(const RegretEntry *x, const RegretEntry *y) {
+    if (x->regret != y->regret) return x->regret > y->regret;
+    if (x->best != y->best) return x->best < y->best;
+    return x->city < y->city;
+}
+
+// Max-heap binario de RegretEntry (entradas antigas sao descartadas no pop)
+typedef struct {
+    RegretEntry *items;
+    size_t size;
+    size_t capacity;
+} RegretHeap;
+
+static bool regret_heap_push(RegretHeap *h, RegretEntry e) {
+    if (h->size == h->capacity) {
+        size_t cap = (h->capacity > 0) ? 2 * h->capacity : 64;
+        RegretEntry *items = realloc(h->items, cap * sizeof(RegretEntry));
+        if (items == NULL) return false;
+        h->items = items;
+        h->capacity = cap;
+    }
+    size_t i = h->size++;
+    while (i > 0 && regret_before(&e, &h->items[(i - 1) / 2])) {
+        h->items[i] = h->items[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    h->items[i] = e;
+    return true;
+}
+
+static RegretEntry regret_heap_pop(RegretHeap *h) {
+    RegretEntry top = h->items[0];
+    RegretEntry last = h->items[--h->size];
+    size_t i = 0;
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= h->size) break;
+        if (child + 1 < h->size && regret_before(&h->items[child + 1], &h->items[child])) {
+            child++;
+        }
+        if (!regret_before(&h->items[child], &last)) break;
+        h->items[i] = h->items[child];
+        i = child;
+    }
+    if (h->size > 0) h->items[i] = last;
+    return top;
+}
+
+// Tour parcial como lista circular (next/prev) e as k melhores arestas
+// (u, next[u]) de insercao de cada cidade pendente, ordenadas por custo.
+//
+// Com listas de vizinhos, o cache de uma cidade y so guarda arestas que
+// tocam vizinhos de y (exceto as cidades "wide", que cairam na varredura
+// completa); assim uma insercao em (u, w) so afeta y com u, x ou w entre
+// seus vizinhos (indice reverso rev) ou y wide.
+typedef struct {
+    const TSPInstance *tsp;
+    size_t k;
+    int *next;
+    int *prev;
+    bool *present;      // Cidade ja no tour parcial
+    double *cost;       // n x k
+    int *edge;          // n x k: u da aresta (u, next[u])
+    size_t *count;      // Entradas validas por cidade
+    unsigned *version;
+    int anchor;         // Uma cidade do tour parcial
+    const int *nb;      // Listas de vizinhos (NULL = sem listas)
+    size_t nk;
+    int *rev_start;     // rev[c] = cidades com c na lista: rev_items[rev_start[c]..)
+    int *rev_items;
+    int *wide;          // Pendentes com cache da varredura completa
+    int *wide_slot;     // Posicao em wide (-1 = nao wide)
+    size_t n_wide;
+    unsigned *stamp;    // Dedup das cidades tocadas por insercao
+    unsigned stamp_now;
+} RegretState;
+
+static double insertion_cost(const TSPInstance *tsp, int u, int w, int x) {
+    double add = tsp_dist(tsp, (size_t)u, (size_t)x) + tsp_dist(tsp, (size_t)x, (size_t)w);
+    return (u == w) ? add : add - tsp_dist(tsp, (size_t)u, (size_t)w);
+}
+
+// Oferece a aresta u -> next[u] as k melhores de x; true se a lista mudou
+static bool regret_offer(RegretState *st, int x, int u) {
+    double c = insertion_cost(st->tsp, u, st->next[u], x);
+    double *cost = st->cost + (size_t)x * st->k;
+    int *edge = st->edge + (size_t)x * st->k;
+    size_t cnt = st->count[x];
+    if (cnt == st->k && c >= cost[cnt - 1]) return false;
+    for (size_t h = 0; h < cnt; h++) {
+        if (edge[h] == u) return false;
+    }
+
+    size_t pos = (cnt < st->k) ? cnt++ : cnt - 1;
+    while (pos > 0 && cost[pos - 1] > c) {
+        cost[pos] = cost[pos - 1];
+        edge[pos] = edge[pos - 1];
+        pos--;
+    }
+    cost[pos] = c;
+    edge[pos] = u;
+    st->count[x] = cnt;
+    return true;
+}
+
+static void regret_set_wide(RegretState *st, int x, bool wide) {
+    if (wide && st->wide_slot[x] < 0) {
+        st->wide_slot[x] = (int)st->n_wide;
+        st->wide[st->n_wide++] = x;
+    } else if (!wide && st->wide_slot[x] >= 0) {
+        int moved = st->wide[--st->n_wide];
+        st->wide[st->wide_slot[x]] = moved;
+        st->wide_slot[moved] = st->wide_slot[x];
+        st->wide_slot[x] = -1;
+    }
+}
+
+// Candidatas: arestas que tocam vizinhos ja no tour; sem listas, ou com
+// menos de k delas, percorre o tour parcial inteiro
+static void regret_recompute(RegretState *st, int x) {
+    st->count[x] = 0;
+    if (st->nb != NULL) {
+        const int *nb = st->nb + (size_t)x * st->nk;
+        for (size_t h = 0; h < st->nk; h++) {
+            int c = nb[h];
+            if (!st->present[c]) continue;
+            regret_offer(st, x, c);
+            regret_offer(st, x, st->prev[c]);
+        }
+        if (st->count[x] >= st->k) {
+            regret_set_wide(st, x, false);
+            return;
+        }
+        st->count[x] = 0;
+        regret_set_wide(st, x, true);
+    }
+
+    int u = st->anchor;
+    do {
+        regret_offer(st, x, u);
+        u = st->next[u];
+    } while (u != st->anchor);
+}
+
+static RegretEntry regret_entry(const RegretState *st, int x) {
+    const double *cost = st->cost + (size_t)x * st->k;
+    RegretEntry e;
+    e.regret = 0.0;
+    for (size_t h = 1; h < st->count[x]; h++) e.regret += cost[h] - cost[0];
+    e.best = cost[0];
+    e.city = x;
+    e.version = st->version[x];
+    return e;
+}
+
+#define REGRET_OFFER_UX 1u
+#define REGRET_OFFER_XW 2u
+
+// Atualiza o cache de y apos inserir x em (u, w): recalcula se (u, w)
+// estava entre as k melhores, senao testa as arestas novas permitidas
+static bool regret_touch(RegretState *st, RegretHeap *heap, int y, int u, int x,
+                         unsigned offers) {
+    bool stale = false;
+    for (size_t h = 0; h < st->count[y]; h++) {
+        if (st->edge[(size_t)y * st->k + h] == u) stale = true;
+    }
+    bool changed;
+    if (stale) {
+        regret_recompute(st, y);
+        changed = true;
+    } else {
+        bool c1 = (offers & REGRET_OFFER_UX) && regret_offer(st, y, u);
+        bool c2 = (offers & REGRET_OFFER_XW) && regret_offer(st, y, x);
+        changed = c1 || c2;
+    }
+    if (!changed) return true;
+    st->version[y]++;
+    return regret_heap_push(heap, regret_entry(st, y));
+}
+
+// Pendentes y com c entre seus vizinhos, apos inserir x entre u e next[x].
+// So oferece arestas novas que tocam nb(y), preservando o invariante do cache
+static void regret_touch_rev(RegretState *st, RegretHeap *heap, bool *heap_ok,
+                             int c, int u, int x) {
+    int w = st->next[x];
+    for (int r = st->rev_start[c]; r < st->rev_start[c + 1]; r++) {
+        int y = st->rev_items[r];
+        if (st->present[y] || st->stamp[y] == st->stamp_now) continue;
+        st->stamp[y] = st->stamp_now;
+
+        const int *nb = st->nb + (size_t)y * st->nk;
+        bool has_u = false, has_x = false, has_w = false;
+        for (size_t h = 0; h < st->nk; h++) {
+            has_u = has_u || nb[h] == u;
+            has_x = has_x || nb[h] == x;
+            has_w = has_w || nb[h] == w;
+        }
+        unsigned offers = (has_u || has_x) ? REGRET_OFFER_UX : 0u;
+        if (has_x || has_w) offers |= REGRET_OFFER_XW;
+        *heap_ok = regret_touch(st, heap, y, u, x, offers) && *heap_ok;
+    }
+}
+
+static bool regret_build_reverse(RegretState *st, int n) {
+    st->rev_start = calloc((size_t)n + 1, sizeof(int));
+    st->rev_items = malloc((size_t)n * st->nk * sizeof(int));
+    if (st->rev_start == NULL || st->rev_items == NULL) return false;
+
+    for (size_t i = 0; i < (size_t)n * st->nk; i++) st->rev_start[st->nb[i] + 1]++;
+    for (int c = 0; c < n; c++) st->rev_start[c + 1] += st->rev_start[c];
+    int *fill = malloc((size_t)n * sizeof(int));
+    if (fill == NULL) return false;
+    memcpy(fill, st->rev_start, (size_t)n * sizeof(int));
+    for (int y = 0; y < n; y++) {
+        for (size_t h = 0; h < st->nk; h++) {
+            int c = st->nb[(size_t)y * st->nk + h];
+            st->rev_items[fill[c]++] = y;
+        }
+    }
+    free(fill);
+    return true;
+}
+
+// Insere as cidades ausentes de d no tour parcial por ordem de regret
+static void regret_insert_all(RegretState *st, const int *d, int *out, int n,
+                              int *pending, int *slot) {
+    size_t k = st->k;
+    bool *present = st->present;
+
+    // Tour parcial na ordem de destroyed; cidades ausentes ficam pendentes
+    int first = -1;
+    int last = -1;
+    for (int i = 0; i < n; i++) {
+        int c = d[i];
+        if (c < 0 || c >= n || present[c]) continue;
+        present[c] = true;
+        if (first < 0) first = c; else st->next[last] = c;
+        st->prev[c] = last;
+        last = c;
+    }
+    size_t n_pending = 0;
+    for (int c = 0; c < n; c++) {
+        if (!present[c]) {
+            slot[c] = (int)n_pending;
+            pending[n_pending++] = c;
+        }
+    }
+    if (first < 0) {
+        // Tudo removido: a ultima pendente vira um laco proprio
+        first = last = pending[--n_pending];
+        present[first] = true;
+    }
+    st->next[last] = first;
+    st->prev[first] = last;
+    st->anchor = first;
+
+    RegretHeap heap = {NULL, 0, 0};
+    bool heap_ok = true;
+    for (size_t i = 0; i < n_pending; i++) {
+        regret_recompute(st, pending[i]);
+        heap_ok = heap_ok && regret_heap_push(&heap, regret_entry(st, pending[i]));
+    }
+
+    while (n_pending > 0) {
+        int x;
+        if (heap_ok) {
+            RegretEntry e = regret_heap_pop(&heap);
+            x = e.city;
+            if (present[x] || e.version != st->version[x]) continue;
+        } else {
+            // Sem memoria para a fila: insercao mais barata na ordem das pendentes
+            x = pending[n_pending - 1];
+        }
+
+        // Insere x na melhor aresta (u, w)
+        int u = st->edge[(size_t)x * k];
+        int w = st->next[u];
+        st->next[u] = x;
+        st->next[x] = w;
+        st->prev[x] = u;
+        st->prev[w] = x;
+        present[x] = true;
+        int moved = pending[--n_pending];
+        pending[slot[x]] = moved;
+        slot[moved] = slot[x];
+        if (st->nb != NULL) regret_set_wide(st, x, false);
+
+        // So a aresta (u, w) deixou de existir e so (u, x), (x, w) surgiram
+        if (st->nb == NULL) {
+            for (size_t i = 0; i < n_pending; i++) {
+                heap_ok = regret_touch(st, &heap, pending[i], u, x,
+                                       REGRET_OFFER_UX | REGRET_OFFER_XW) && heap_ok;
+            }
+            continue;
+        }
+        st->stamp_now++;
+        // De tras para frente: regret_touch pode tirar y de wide (swap com o ultimo)
+        for (size_t i = st->n_wide; i > 0; i--) {
+            int y = st->wide[i - 1];
+            st->stamp[y] = st->stamp_now;
+            heap_ok = regret_touch(st, &heap, y, u, x,
+                                   REGRET_OFFER_UX | REGRET_OFFER_XW) && heap_ok;
+        }
+        regret_touch_rev(st, &heap, &heap_ok, u, u, x);
+        regret_touch_rev(st, &heap, &heap_ok, x, u, x);
+        regret_touch_rev(st, &heap, &heap_ok, w, u, x);
+    }
+    free(heap.items);
+
+    int c = first;
+    for (int i = 0; i < n; i++) {
+        out[i] = c;
+        c = st->next[c];
+    }
+}
+
+static void repair_tsp_regret(const void *destroyed, void *repaired, size_t size,
+                              size_t k, const TSPInstance *tsp) {
+    int n = (int)size;
+    if (n == 0) return;
+
+    RegretState st;
+    memset(&st, 0, sizeof(RegretState));
+    st.tsp = tsp;
+    st.k = k;
+    st.next = malloc((size_t)n * sizeof(int));
+    st.prev = malloc((size_t)n * sizeof(int));
+    st.present = calloc((size_t)n, sizeof(bool));
+    st.cost = malloc((size_t)n * k * sizeof(double));
+    st.edge = malloc((size_t)n * k * sizeof(int));
+    st.count = calloc((size_t)n, sizeof(size_t));
+    st.version = calloc((size_t)n, sizeof(unsigned));
+    int *pending = malloc((size_t)n * sizeof(int));
+    int *slot = malloc((size_t)n * sizeof(int));
+    bool ok = st.next != NULL && st.prev != NULL && st.present != NULL &&
+              st.cost != NULL && st.edge != NULL && st.count != NULL &&
+              st.version != NULL && pending != NULL && slot != NULL;
+
+    if (ok && tsp_neighbor_list(tsp, 0) != NULL && tsp->n_cities == size) {
+        st.nb = tsp_neighbor_list(tsp, 0);
+        st.nk = tsp->n_neighbors;
+        st.wide = malloc((size_t)n * sizeof(int));
+        st.wide_slot = malloc((size_t)n * sizeof(int));
+        st.stamp = calloc((size_t)n, sizeof(unsigned));
+        ok = st.wide != NULL && st.wide_slot != NULL && st.stamp != NULL &&
+             regret_build_reverse(&st, n);
+        if (ok) {
+            for (int c = 0; c < n; c++) st.wide_slot[c] = -1;
+        }
+    }
+
+    if (ok) {
+        regret_insert_all(&st, (const int *)destroyed, (int *)repaired, n,
+                          pending, slot);
+    } else {
+        lns_repair_tsp_greedy(destroyed, repaired, size, tsp);
+    }
+
+    free(st.next);
+    free(st.prev);
+    free(st.present);
+    free(st.cost);
+    free(st.edge);
+    free(st.count);
+    free(st.version);
+    free(st.rev_start);
+    free(st.rev_items);
+    free(st.wide);
+    free(st.wide_slot);
+    free(st.stamp);
+    free(pending);
+    free(slot);
+}
+
+void lns_repair_tsp_regret2(const void *destroyed, void *repaired, size_t size,
+                            const void *context) {
+    repair_tsp_regret(destroyed, repaired, size, 2, (const TSPInstance *)context);
+}
+
+void lns_repair_tsp_regret3(const void *destroyed, void *repaired, size_t size,
+                            const void *context) {
+    repair_tsp_regret(destroyed, repaired, size, LNS_REGRET_MAX_K, (const TSPInstance *)context);
+}
+
 void lns_repair_tsp_random(const void *destroyed, void *repaired, size_t size,
                            const void *context) {
     (void)context;
@@ -293,8 +731,12 @@ LNSConfig lns_default_config(void) {
     config.reward_accepted = 1.0;
     config.weight_update_interval = 50;
     config.weight_decay = 0.8;
+    config.stop = opt_stop_none();
+    config.trace = opt_trace_default();
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
+    config.checkpoint = opt_checkpoint_none();
     return config;
 }
 
@@ -316,10 +758,11 @@ OptResult lns_run(const LNSConfig *config,
         return empty;
     }
 
-    opt_set_seed(config->seed);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
 
     size_t data_size = element_size * solution_size;
-    OptResult result = opt_result_create(config->max_iterations);
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_iterations);
     result.num_iterations = 0;
     result.num_evaluations = 0;
 
@@ -344,6 +787,8 @@ OptResult lns_run(const LNSConfig *config,
 
     double temp = config->sa_initial_temp;
 
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
+
     for (size_t iter = 0; iter < config->max_iterations; iter++) {
         destroy(current, destroyed, solution_size, config->destroy_degree, context);
         repair(destroyed, repaired, solution_size, context);
@@ -353,7 +798,7 @@ OptResult lns_run(const LNSConfig *config,
 
         int accepted = 0;
         if (config->acceptance == LNS_ACCEPT_SA_LIKE) {
-            accepted = sa_accept(current_cost, repaired_cost, temp, config->direction);
+            accepted = sa_accept(rng, current_cost, repaired_cost, temp, config->direction);
             temp *= config->sa_alpha;
         } else {
             accepted = is_better(repaired_cost, current_cost, config->direction);
@@ -370,9 +815,8 @@ OptResult lns_run(const LNSConfig *config,
         }
 
         result.num_iterations = iter + 1;
-        if (iter < result.convergence_size) {
-            result.convergence[iter] = best_cost;
-        }
+        opt_tracer_record(&tracer, &result, iter, best_cost, result.num_evaluations);
+        if (opt_stop_check(&stop, result.num_evaluations, best_cost)) break;
     }
 
     result.best = opt_solution_create(data_size);
@@ -386,6 +830,7 @@ OptResult lns_run(const LNSConfig *config,
     free(repaired);
     free(best_data);
 
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
 
@@ -393,6 +838,108 @@ OptResult lns_run(const LNSConfig *config,
 // ALNS (ADAPTIVE)
 // ============================================================================
 
+// Media movel dos scores por uso no periodo; zera scores e usos
+static void alns_update_weights(const LNSConfig *config, double *weights, double *scores,
+                                size_t *usage, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (usage[i] > 0) {
+            weights[i] = config->weight_decay * weights[i] +
+                         (1.0 - config->weight_decay) * (scores[i] / (double)usage[i]);
+        }
+        if (weights[i] < 0.01) weights[i] = 0.01;
+        scores[i] = 0.0;
+        usage[i] = 0;
+    }
+}
+
+// Estado do laco do ALNS gravado no checkpoint (aponta para as variaveis
+// de alns_run)
+typedef struct {
+    void *current;
+    double *current_cost;
+    void *best_data;
+    double *best_cost;
+    double *temp;
+    double *weights_d, *weights_r;
+    double *scores_d, *scores_r;
+    size_t *usage_d, *usage_r;
+    size_t nd, nr;
+    size_t data_size;
+} ALNSCheckpointState;
+
+static uint64_t alns_fingerprint(const LNSConfig *config, size_t element_size,
+                                 size_t solution_size) {
+    size_t dims[5] = {element_size, solution_size, config->num_destroy_ops,
+                      config->num_repair_ops, (size_t)config->direction};
+    return opt_checkpoint_fingerprint(dims, 5);
+}
+
+static void alns_save(const LNSConfig *config, const ALNSCheckpointState *st,
+                      const OptResult *result, const OptRng *rng,
+                      uint64_t fingerprint, size_t iterations) {
+    OptCheckpoint ck;
+    if (!opt_checkpoint_write_begin(&ck, config->checkpoint.path, OPT_CHECKPOINT_ALNS,
+                                    fingerprint, iterations)) {
+        return;
+    }
+    opt_checkpoint_write(&ck, st->current, st->data_size);
+    opt_checkpoint_write(&ck, st->current_cost, sizeof(double));
+    opt_checkpoint_write(&ck, st->best_data, st->data_size);
+    opt_checkpoint_write(&ck, st->best_cost, sizeof(double));
+    opt_checkpoint_write(&ck, st->temp, sizeof(double));
+    opt_checkpoint_write(&ck, st->weights_d, st->nd * sizeof(double));
+    opt_checkpoint_write(&ck, st->weights_r, st->nr * sizeof(double));
+    opt_checkpoint_write(&ck, st->scores_d, st->nd * sizeof(double));
+    opt_checkpoint_write(&ck, st->scores_r, st->nr * sizeof(double));
+    opt_checkpoint_write(&ck, st->usage_d, st->nd * sizeof(size_t));
+    opt_checkpoint_write(&ck, st->usage_r, st->nr * sizeof(size_t));
+    opt_checkpoint_write(&ck, result->operator_stats,
+                         result->num_operators * sizeof(OptOperatorStats));
+    opt_checkpoint_write(&ck, &result->num_evaluations, sizeof(size_t));
+    opt_checkpoint_write_rng(&ck, rng);
+    opt_checkpoint_write_rng(&ck, opt_rng_thread());
+    opt_checkpoint_write_history(&ck, result, iterations);
+    opt_checkpoint_write_end(&ck, config->checkpoint.path);
+}
+
+// Os streams so sao aplicados com o arquivo lido por inteiro; em falha o
+// chamador reinicializa todo o estado
+static bool alns_load(const LNSConfig *config, const ALNSCheckpointState *st,
+                      OptResult *result, OptRng *rng, uint64_t fingerprint,
+                      size_t *iterations) {
+    OptCheckpoint ck;
+    size_t saved = 0;
+    if (!opt_checkpoint_read_begin(&ck, config->checkpoint.path, OPT_CHECKPOINT_ALNS,
+                                   fingerprint, &saved)) {
+        return false;
+    }
+    OptRng run_rng, op_rng;
+    bool ok = opt_checkpoint_read(&ck, st->current, st->data_size) &&
+              opt_checkpoint_read(&ck, st->current_cost, sizeof(double)) &&
+              opt_checkpoint_read(&ck, st->best_data, st->data_size) &&
+              opt_checkpoint_read(&ck, st->best_cost, sizeof(double)) &&
+              opt_checkpoint_read(&ck, st->temp, sizeof(double)) &&
+              opt_checkpoint_read(&ck, st->weights_d, st->nd * sizeof(double)) &&
+              opt_checkpoint_read(&ck, st->weights_r, st->nr * sizeof(double)) &&
+              opt_checkpoint_read(&ck, st->scores_d, st->nd * sizeof(double)) &&
+              opt_checkpoint_read(&ck, st->scores_r, st->nr * sizeof(double)) &&
+              opt_checkpoint_read(&ck, st->usage_d, st->nd * sizeof(size_t)) &&
+              opt_checkpoint_read(&ck, st->usage_r, st->nr * sizeof(size_t)) &&
+              opt_checkpoint_read(&ck, result->operator_stats,
+                                  result->num_operators * sizeof(OptOperatorStats)) &&
+              opt_checkpoint_read(&ck, &result->num_evaluations, sizeof(size_t)) &&
+              opt_checkpoint_read_rng(&ck, &run_rng) &&
+              opt_checkpoint_read_rng(&ck, &op_rng) &&
+              opt_checkpoint_read_history(&ck, result);
+    ok = opt_checkpoint_read_end(&ck) && ok;
+    if (ok) {
+        *rng = run_rng;
+        *opt_rng_thread() = op_rng;
+        *iterations = saved;
+    }
+    return ok;
+}
+
 OptResult alns_run(const LNSConfig *config,
                    size_t element_size,
                    size_t solution_size,
@@ -408,13 +955,14 @@ OptResult alns_run(const LNSConfig *config,
         return empty;
     }
 
-    opt_set_seed(config->seed);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
 
     size_t nd = config->num_destroy_ops;
     size_t nr = config->num_repair_ops;
     size_t data_size = element_size * solution_size;
 
-    OptResult result = opt_result_create(config->max_iterations);
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_iterations);
     result.num_iterations = 0;
     result.num_evaluations = 0;
 
@@ -424,71 +972,118 @@ OptResult alns_run(const LNSConfig *config,
     double *scores_r = calloc(nr, sizeof(double));
     size_t *usage_d = calloc(nd, sizeof(size_t));
     size_t *usage_r = calloc(nr, sizeof(size_t));
-    if (weights_d == NULL || weights_r == NULL || scores_d == NULL ||
-        scores_r == NULL || usage_d == NULL || usage_r == NULL) {
-        free(weights_d); free(weights_r);
-        free(scores_d); free(scores_r);
-        free(usage_d); free(usage_r);
-        return result;
-    }
-
-    for (size_t i = 0; i < nd; i++) weights_d[i] = 1.0;
-    for (size_t i = 0; i < nr; i++) weights_r[i] = 1.0;
+    WeightTree tree_d = {NULL, 0, 0};
+    WeightTree tree_r = {NULL, 0, 0};
+    bool trees = weight_tree_init(&tree_d, nd) && weight_tree_init(&tree_r, nr);
+    result.operator_stats = calloc(nd + nr, sizeof(OptOperatorStats));
 
     void *current = malloc(data_size);
     void *destroyed = malloc(data_size);
     void *repaired = malloc(data_size);
     void *best_data = malloc(data_size);
-    if (current == NULL || destroyed == NULL || repaired == NULL || best_data == NULL) {
+    if (weights_d == NULL || weights_r == NULL || scores_d == NULL ||
+        scores_r == NULL || usage_d == NULL || usage_r == NULL || !trees ||
+        result.operator_stats == NULL ||
+        current == NULL || destroyed == NULL || repaired == NULL || best_data == NULL) {
         free(current); free(destroyed); free(repaired); free(best_data);
         free(weights_d); free(weights_r);
         free(scores_d); free(scores_r);
         free(usage_d); free(usage_r);
+        free(tree_d.tree); free(tree_r.tree);
+        free(result.operator_stats);
+        result.operator_stats = NULL;
         return result;
     }
 
-    generate(current, solution_size, context);
-    double current_cost = objective(current, solution_size, context);
-    result.num_evaluations++;
-
-    double best_cost = current_cost;
-    memcpy(best_data, current, data_size);
+    // operator_stats: destroy em [0, nd), repair em [nd, nd + nr)
+    result.num_operators = nd + nr;
+    OptOperatorStats *stats_d = result.operator_stats;
+    OptOperatorStats *stats_r = result.operator_stats + nd;
 
+    double current_cost = 0.0;
+    double best_cost = 0.0;
     double temp = config->sa_initial_temp;
+    ALNSCheckpointState ck_state = {current, &current_cost, best_data, &best_cost, &temp,
+                                    weights_d, weights_r, scores_d, scores_r,
+                                    usage_d, usage_r, nd, nr, data_size};
+    uint64_t fingerprint = alns_fingerprint(config, element_size, solution_size);
+    size_t start = 0;
+
+    if (config->checkpoint.resume &&
+        alns_load(config, &ck_state, &result, rng, fingerprint, &start)) {
+        result.num_iterations = start;
+    } else {
+        for (size_t i = 0; i < nd; i++) weights_d[i] = 1.0;
+        for (size_t i = 0; i < nr; i++) weights_r[i] = 1.0;
+        memset(scores_d, 0, nd * sizeof(double));
+        memset(scores_r, 0, nr * sizeof(double));
+        memset(usage_d, 0, nd * sizeof(size_t));
+        memset(usage_r, 0, nr * sizeof(size_t));
+        memset(result.operator_stats, 0, (nd + nr) * sizeof(OptOperatorStats));
+        temp = config->sa_initial_temp;
+
+        generate(current, solution_size, context);
+        current_cost = objective(current, solution_size, context);
+        result.num_evaluations = 1;
+
+        best_cost = current_cost;
+        memcpy(best_data, current, data_size);
+    }
+    weight_tree_build(&tree_d, weights_d);
+    weight_tree_build(&tree_r, weights_r);
+    size_t saved = start;
 
-    for (size_t iter = 0; iter < config->max_iterations; iter++) {
-        size_t d_idx = roulette_select_weighted(weights_d, nd);
-        size_t r_idx = roulette_select_weighted(weights_r, nr);
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
+
+    for (size_t iter = start; iter < config->max_iterations; iter++) {
+        size_t d_idx = weight_tree_sample(&tree_d, rng);
+        size_t r_idx = weight_tree_sample(&tree_r, rng);
 
+        double t0 = opt_wall_time_ms();
         destroy_ops[d_idx](current, destroyed, solution_size, config->destroy_degree, context);
+        double t1 = opt_wall_time_ms();
         repair_ops[r_idx](destroyed, repaired, solution_size, context);
+        double t2 = opt_wall_time_ms();
+        stats_d[d_idx].total_time_ms += t1 - t0;
+        stats_r[r_idx].total_time_ms += t2 - t1;
 
         double repaired_cost = objective(repaired, solution_size, context);
         result.num_evaluations++;
 
         usage_d[d_idx]++;
         usage_r[r_idx]++;
+        stats_d[d_idx].calls++;
+        stats_r[r_idx].calls++;
 
         int accepted = 0;
         if (config->acceptance == LNS_ACCEPT_SA_LIKE) {
-            accepted = sa_accept(current_cost, repaired_cost, temp, config->direction);
+            accepted = sa_accept(rng, current_cost, repaired_cost, temp, config->direction);
             temp *= config->sa_alpha;
         } else {
             accepted = is_better(repaired_cost, current_cost, config->direction);
         }
 
+        bool improved = is_better(repaired_cost, current_cost, config->direction);
         if (is_better(repaired_cost, best_cost, config->direction)) {
             scores_d[d_idx] += config->reward_best;
             scores_r[r_idx] += config->reward_best;
-        } else if (is_better(repaired_cost, current_cost, config->direction)) {
+            stats_d[d_idx].new_best++;
+            stats_r[r_idx].new_best++;
+        } else if (improved) {
             scores_d[d_idx] += config->reward_better;
             scores_r[r_idx] += config->reward_better;
         } else if (accepted) {
             scores_d[d_idx] += config->reward_accepted;
             scores_r[r_idx] += config->reward_accepted;
         }
+        if (improved) {
+            stats_d[d_idx].improvements++;
+            stats_r[r_idx].improvements++;
+        }
 
         if (accepted) {
+            stats_d[d_idx].accepted++;
+            stats_r[r_idx].accepted++;
             memcpy(current, repaired, data_size);
             current_cost = repaired_cost;
 
@@ -500,32 +1095,25 @@ OptResult alns_run(const LNSConfig *config,
 
         if (config->weight_update_interval > 0 &&
             (iter + 1) % config->weight_update_interval == 0) {
-            for (size_t i = 0; i < nd; i++) {
-                if (usage_d[i] > 0) {
-                    weights_d[i] = config->weight_decay * weights_d[i] +
-                                   (1.0 - config->weight_decay) * (scores_d[i] / (double)usage_d[i]);
-                }
-                if (weights_d[i] < 0.01) weights_d[i] = 0.01;
-                scores_d[i] = 0.0;
-                usage_d[i] = 0;
-            }
-            for (size_t i = 0; i < nr; i++) {
-                if (usage_r[i] > 0) {
-                    weights_r[i] = config->weight_decay * weights_r[i] +
-                                   (1.0 - config->weight_decay) * (scores_r[i] / (double)usage_r[i]);
-                }
-                if (weights_r[i] < 0.01) weights_r[i] = 0.01;
-                scores_r[i] = 0.0;
-                usage_r[i] = 0;
-            }
+            alns_update_weights(config, weights_d, scores_d, usage_d, nd);
+            alns_update_weights(config, weights_r, scores_r, usage_r, nr);
+            weight_tree_build(&tree_d, weights_d);
+            weight_tree_build(&tree_r, weights_r);
         }
 
         result.num_iterations = iter + 1;
-        if (iter < result.convergence_size) {
-            result.convergence[iter] = best_cost;
+        opt_tracer_record(&tracer, &result, iter, best_cost, result.num_evaluations);
+        bool stopped = opt_stop_check(&stop, result.num_evaluations, best_cost);
+        if (opt_checkpoint_due(&config->checkpoint, iter + 1, &saved,
+                               stopped || iter + 1 == config->max_iterations)) {
+            alns_save(config, &ck_state, &result, rng, fingerprint, iter + 1);
         }
+        if (stopped) break;
     }
 
+    for (size_t i = 0; i < nd; i++) stats_d[i].weight = weights_d[i];
+    for (size_t i = 0; i < nr; i++) stats_r[i].weight = weights_r[i];
+
     result.best = opt_solution_create(data_size);
     if (result.best.data != NULL) {
         memcpy(result.best.data, best_data, data_size);
@@ -536,6 +1124,8 @@ OptResult alns_run(const LNSConfig *config,
     free(weights_d); free(weights_r);
     free(scores_d); free(scores_r);
     free(usage_d); free(usage_r);
+    free(tree_d.tree); free(tree_r.tree);
 
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
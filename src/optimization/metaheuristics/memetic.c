@@ -13,9 +13,12 @@
  */
 
 #include "optimization/metaheuristics/memetic.h"
+#include "data_structures/thread_pool.h"
 #include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 #include <float.h>
+#include <math.h>
 
 // ============================================================================
 // HELPERS
@@ -25,94 +28,163 @@ static int is_better(double a, double b, OptDirection dir) {
     return (dir == OPT_MINIMIZE) ? (a < b) : (a > b);
 }
 
-static void apply_local_search(void *solution, size_t element_size, size_t solution_size,
-                               ObjectiveFn objective, NeighborFn neighbor,
-                               const void *context, OptDirection direction,
-                               size_t max_iter, size_t num_neighbors,
-                               double *cost, size_t *evaluations,
-                               MALearningType learning) {
-    size_t data_size = element_size * solution_size;
-
+// LocalSearchFn externa: lamarckiana no lugar; baldwiniana numa copia,
+// mantendo so o custo
+static void apply_external_local_search(void *solution, size_t data_size, size_t solution_size,
+                                        LocalSearchFn local_search, ObjectiveFn objective,
+                                        const void *context, double *cost,
+                                        size_t *evaluations, MALearningType learning) {
     if (learning == MA_BALDWINIAN) {
         void *temp = malloc(data_size);
         if (temp == NULL) return;
         memcpy(temp, solution, data_size);
+        *cost = local_search(temp, solution_size, objective, context);
+        free(temp);
+    } else {
+        *cost = local_search(solution, solution_size, objective, context);
+    }
+    (*evaluations)++;
+}
 
-        void *candidate = malloc(data_size);
-        void *best_n = malloc(data_size);
-        if (candidate == NULL || best_n == NULL) {
-            free(temp);
-            free(candidate);
-            free(best_n);
-            return;
-        }
+// Best improvement amostrada; para ao nao melhorar, em ls_iterations ou ao
+// gastar ls_budget avaliacoes (o melhor vizinho ja visto ainda e aceito)
+static void apply_local_search(void *solution, size_t element_size, size_t solution_size,
+                               const MAConfig *config, ObjectiveFn objective,
+                               NeighborFn neighbor, const void *context,
+                               double *cost, size_t *evaluations) {
+    size_t data_size = element_size * solution_size;
+    MALearningType learning = config->learning;
 
-        double temp_cost = *cost;
-        for (size_t iter = 0; iter < max_iter; iter++) {
-            double best_nc = (direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
-            int improved = 0;
-
-            for (size_t n = 0; n < num_neighbors; n++) {
-                neighbor(temp, candidate, solution_size, context);
-                double c = objective(candidate, solution_size, context);
-                (*evaluations)++;
-                if (is_better(c, best_nc, direction)) {
-                    memcpy(best_n, candidate, data_size);
-                    best_nc = c;
-                }
-            }
-            if (is_better(best_nc, temp_cost, direction)) {
-                memcpy(temp, best_n, data_size);
-                temp_cost = best_nc;
-                improved = 1;
-            }
-            if (!improved) break;
-        }
+    if (config->local_search != NULL) {
+        apply_external_local_search(solution, data_size, solution_size, config->local_search,
+                                    objective, context, cost, evaluations, learning);
+        return;
+    }
+
+    OptDirection direction = config->direction;
+    size_t max_iter = config->ls_iterations;
+    size_t num_neighbors = config->ls_neighbors;
+    size_t budget = (config->ls_budget == 0) ? SIZE_MAX : config->ls_budget;
+
+    // Baldwiniana trabalha numa copia e devolve so o custo
+    void *temp = NULL;
+    void *work = solution;
+    if (learning == MA_BALDWINIAN) {
+        temp = malloc(data_size);
+        if (temp == NULL) return;
+        memcpy(temp, solution, data_size);
+        work = temp;
+    }
 
-        *cost = temp_cost;
+    void *candidate = malloc(data_size);
+    void *best_n = malloc(data_size);
+    if (candidate == NULL || best_n == NULL) {
         free(temp);
         free(candidate);
         free(best_n);
-    } else {
-        void *candidate = malloc(data_size);
-        void *best_n = malloc(data_size);
-        if (candidate == NULL || best_n == NULL) {
-            free(candidate);
-            free(best_n);
-            return;
-        }
+        return;
+    }
 
-        for (size_t iter = 0; iter < max_iter; iter++) {
-            double best_nc = (direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
-            int improved = 0;
-
-            for (size_t n = 0; n < num_neighbors; n++) {
-                neighbor(solution, candidate, solution_size, context);
-                double c = objective(candidate, solution_size, context);
-                (*evaluations)++;
-                if (is_better(c, best_nc, direction)) {
-                    memcpy(best_n, candidate, data_size);
-                    best_nc = c;
-                }
+    double work_cost = *cost;
+    size_t used = 0;
+    for (size_t iter = 0; iter < max_iter && used < budget; iter++) {
+        double best_nc = (direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
+
+        for (size_t n = 0; n < num_neighbors && used < budget; n++) {
+            neighbor(work, candidate, solution_size, context);
+            double c = objective(candidate, solution_size, context);
+            used++;
+            if (is_better(c, best_nc, direction)) {
+                memcpy(best_n, candidate, data_size);
+                best_nc = c;
             }
-            if (is_better(best_nc, *cost, direction)) {
-                memcpy(solution, best_n, data_size);
-                *cost = best_nc;
-                improved = 1;
-            }
-            if (!improved) break;
         }
+        if (!is_better(best_nc, work_cost, direction)) break;
+        memcpy(work, best_n, data_size);
+        work_cost = best_nc;
+    }
 
-        free(candidate);
-        free(best_n);
+    *cost = work_cost;
+    *evaluations += used;
+    free(temp);
+    free(candidate);
+    free(best_n);
+}
+
+// Mantem em flags so os ceil(p * n) melhores de fitness[0..n); order e
+// rascunho de n indices
+static void keep_top_fraction(const double *fitness, size_t n, double p,
+                              OptDirection direction, bool *flags, size_t *order) {
+    if (p >= 1.0 || n == 0) return;
+    size_t keep = (p <= 0.0) ? 0 : (size_t)ceil(p * (double)n - 1e-9);
+
+    for (size_t i = 0; i < n; i++) {
+        size_t v = i;
+        size_t j = i;
+        while (j > 0 && is_better(fitness[v], fitness[order[j - 1]], direction)) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = v;
+    }
+    for (size_t r = keep; r < n; r++) flags[order[r]] = false;
+}
+
+// Busca local de um lote de individuos. Com seeds, roda no pool: cada
+// individuo semeia o stream da thread com seeds[i] (restaurado ao fim), entao
+// o resultado nao depende de quantas threads ha nem de quem rouba o que
+typedef struct {
+    void **rows;
+    double *fitness;
+    const bool *flags;
+    const uint64_t *seeds;
+    size_t *evaluations;
+    size_t element_size;
+    size_t solution_size;
+    const MAConfig *config;
+    ObjectiveFn objective;
+    NeighborFn neighbor;
+    const void *context;
+} MALocalSearchBatch;
+
+static void local_search_range(void *ctx, size_t lo, size_t hi) {
+    const MALocalSearchBatch *b = ctx;
+    OptRng *thread_rng = opt_rng_thread();
+    for (size_t i = lo; i < hi; i++) {
+        b->evaluations[i] = 0;
+        if (!b->flags[i]) continue;
+        OptRng saved = *thread_rng;
+        opt_rng_seed(thread_rng, b->seeds[i]);
+        apply_local_search(b->rows[i], b->element_size, b->solution_size, b->config,
+                           b->objective, b->neighbor, b->context, &b->fitness[i],
+                           &b->evaluations[i]);
+        *thread_rng = saved;
+    }
+}
+
+static size_t local_search_batch(MALocalSearchBatch *b, size_t count) {
+    if (b->seeds == NULL) {
+        size_t evaluations = 0;
+        for (size_t i = 0; i < count; i++) {
+            if (!b->flags[i]) continue;
+            apply_local_search(b->rows[i], b->element_size, b->solution_size, b->config,
+                               b->objective, b->neighbor, b->context, &b->fitness[i],
+                               &evaluations);
+        }
+        return evaluations;
     }
+
+    ds_parallel_for(0, count, 1, local_search_range, b);
+    size_t evaluations = 0;
+    for (size_t i = 0; i < count; i++) evaluations += b->evaluations[i];
+    return evaluations;
 }
 
-static int tournament_select(const double *fitness, size_t pop_size,
+static int tournament_select(OptRng *rng, const double *fitness, size_t pop_size,
                              size_t k, OptDirection direction) {
-    int best = opt_random_int(0, (int)pop_size - 1);
+    int best = opt_rng_int(rng, 0, (int)pop_size - 1);
     for (size_t t = 1; t < k; t++) {
-        int r = opt_random_int(0, (int)pop_size - 1);
+        int r = opt_rng_int(rng, 0, (int)pop_size - 1);
         if (is_better(fitness[r], fitness[best], direction)) {
             best = r;
         }
@@ -120,7 +192,7 @@ static int tournament_select(const double *fitness, size_t pop_size,
     return best;
 }
 
-static int roulette_select(const double *fitness, size_t pop_size,
+static int roulette_select(OptRng *rng, const double *fitness, size_t pop_size,
                            OptDirection direction) {
     double worst = fitness[0];
     for (size_t i = 1; i < pop_size; i++) {
@@ -139,9 +211,9 @@ static int roulette_select(const double *fitness, size_t pop_size,
         }
     }
 
-    if (total <= 0.0) return opt_random_int(0, (int)pop_size - 1);
+    if (total <= 0.0) return opt_rng_int(rng, 0, (int)pop_size - 1);
 
-    double r = opt_random_uniform() * total;
+    double r = opt_rng_uniform(rng) * total;
     double cumulative = 0.0;
     for (size_t i = 0; i < pop_size; i++) {
         if (direction == OPT_MINIMIZE) {
@@ -154,9 +226,9 @@ static int roulette_select(const double *fitness, size_t pop_size,
     return (int)pop_size - 1;
 }
 
-static int rank_select(size_t pop_size) {
+static int rank_select(OptRng *rng, size_t pop_size) {
     double total = (double)(pop_size * (pop_size + 1)) / 2.0;
-    double r = opt_random_uniform() * total;
+    double r = opt_rng_uniform(rng) * total;
     double cumulative = 0.0;
     for (size_t i = 0; i < pop_size; i++) {
         cumulative += (double)(pop_size - i);
@@ -165,16 +237,16 @@ static int rank_select(size_t pop_size) {
     return (int)pop_size - 1;
 }
 
-static int select_parent(const MAConfig *config, const double *fitness,
+static int select_parent(OptRng *rng, const MAConfig *config, const double *fitness,
                          const int *sorted_indices, size_t pop_size) {
     switch (config->selection) {
         case MA_SELECT_ROULETTE:
-            return roulette_select(fitness, pop_size, config->direction);
+            return roulette_select(rng, fitness, pop_size, config->direction);
         case MA_SELECT_RANK:
-            return sorted_indices[rank_select(pop_size)];
+            return sorted_indices[rank_select(rng, pop_size)];
         case MA_SELECT_TOURNAMENT:
         default:
-            return tournament_select(fitness, pop_size, config->tournament_size, config->direction);
+            return tournament_select(rng, fitness, pop_size, config->tournament_size, config->direction);
     }
 }
 
@@ -206,10 +278,18 @@ MAConfig ma_default_config(void) {
     config.learning = MA_LAMARCKIAN;
     config.ls_iterations = 50;
     config.ls_neighbors = 10;
+    config.local_search = NULL;
     config.ls_probability = 1.0;
     config.ls_on_initial = true;
+    config.ls_budget = 0;
+    config.ls_top_fraction = 1.0;
+    config.num_threads = 1;
+    config.stop = opt_stop_none();
+    config.trace = opt_trace_default();
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
+    config.batch_objective = NULL;
     return config;
 }
 
@@ -227,7 +307,8 @@ OptResult ma_run(const MAConfig *config,
                  NeighborFn neighbor,
                  const void *context) {
     if (config == NULL || objective == NULL || generate == NULL ||
-        crossover == NULL || mutate == NULL || neighbor == NULL) {
+        crossover == NULL || mutate == NULL ||
+        (neighbor == NULL && config->local_search == NULL)) {
         OptResult empty = {0};
         return empty;
     }
@@ -236,31 +317,47 @@ OptResult ma_run(const MAConfig *config,
     if (NP < 4) NP = 4;
     size_t data_size = element_size * solution_size;
 
-    opt_set_seed(config->seed);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
 
-    OptResult result = opt_result_create(config->max_generations);
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_generations);
     result.num_iterations = 0;
     result.num_evaluations = 0;
 
+    // Populacoes em blocos contiguos NP x data_size (avaliacao em lote)
+    unsigned char *pop_data = malloc(NP * data_size);
+    unsigned char *new_data = malloc(NP * data_size);
     void **pop = malloc(NP * sizeof(void *));
+    void **new_pop = malloc(NP * sizeof(void *));
     double *fitness = malloc(NP * sizeof(double));
+    double *new_fitness = malloc(NP * sizeof(double));
     int *sorted_idx = malloc(NP * sizeof(int));
-    if (pop == NULL || fitness == NULL || sorted_idx == NULL) {
+    bool *ls_flag = malloc(NP * sizeof(bool));
+    size_t *ls_order = malloc(NP * sizeof(size_t));
+    // Com o pool, sementes por individuo e contadores de avaliacao por tarefa
+    bool parallel = ds_resolve_threads(config->num_threads) > 1;
+    uint64_t *ls_seeds = parallel ? malloc(NP * sizeof(uint64_t)) : NULL;
+    size_t *ls_evals = parallel ? malloc(NP * sizeof(size_t)) : NULL;
+    if (pop_data == NULL || new_data == NULL || pop == NULL || new_pop == NULL ||
+        fitness == NULL || new_fitness == NULL || sorted_idx == NULL || ls_flag == NULL ||
+        ls_order == NULL || (parallel && (ls_seeds == NULL || ls_evals == NULL))) {
+        free(pop_data);
+        free(new_data);
         free(pop);
+        free(new_pop);
         free(fitness);
+        free(new_fitness);
         free(sorted_idx);
+        free(ls_flag);
+        free(ls_order);
+        free(ls_seeds);
+        free(ls_evals);
         return result;
     }
 
     for (size_t i = 0; i < NP; i++) {
-        pop[i] = malloc(data_size);
-        if (pop[i] == NULL) {
-            for (size_t j = 0; j < i; j++) free(pop[j]);
-            free(pop);
-            free(fitness);
-            free(sorted_idx);
-            return result;
-        }
+        pop[i] = pop_data + i * data_size;
+        new_pop[i] = new_data + i * data_size;
     }
 
     size_t best_idx = 0;
@@ -268,16 +365,31 @@ OptResult ma_run(const MAConfig *config,
 
     for (size_t i = 0; i < NP; i++) {
         generate(pop[i], solution_size, context);
-        fitness[i] = objective(pop[i], solution_size, context);
-        result.num_evaluations++;
-
-        if (config->ls_on_initial) {
-            apply_local_search(pop[i], element_size, solution_size, objective, neighbor,
-                               context, config->direction, config->ls_iterations,
-                               config->ls_neighbors, &fitness[i], &result.num_evaluations,
-                               config->learning);
+    }
+    result.num_evaluations += opt_evaluate_batch(config->batch_objective, objective,
+                                                 pop_data, NP, data_size, solution_size,
+                                                 fitness, context);
+
+    MALocalSearchBatch batch = {
+        .seeds = ls_seeds, .evaluations = ls_evals,
+        .element_size = element_size, .solution_size = solution_size, .config = config,
+        .objective = objective, .neighbor = neighbor, .context = context
+    };
+
+    if (config->ls_on_initial) {
+        for (size_t i = 0; i < NP; i++) {
+            ls_flag[i] = true;
+            if (parallel) ls_seeds[i] = opt_rng_next(rng);
         }
+        keep_top_fraction(fitness, NP, config->ls_top_fraction, config->direction,
+                          ls_flag, ls_order);
+        batch.rows = pop;
+        batch.fitness = fitness;
+        batch.flags = ls_flag;
+        result.num_evaluations += local_search_batch(&batch, NP);
+    }
 
+    for (size_t i = 0; i < NP; i++) {
         if (is_better(fitness[i], best_fitness, config->direction)) {
             best_fitness = fitness[i];
             best_idx = i;
@@ -287,37 +399,7 @@ OptResult ma_run(const MAConfig *config,
 
     sort_indices(sorted_idx, NP, fitness);
 
-    void *child1 = malloc(data_size);
-    void *child2 = malloc(data_size);
-    void **new_pop = malloc(NP * sizeof(void *));
-    double *new_fitness = malloc(NP * sizeof(double));
-    if (child1 == NULL || child2 == NULL || new_pop == NULL || new_fitness == NULL) {
-        free(child1);
-        free(child2);
-        free(new_pop);
-        free(new_fitness);
-        for (size_t i = 0; i < NP; i++) free(pop[i]);
-        free(pop);
-        free(fitness);
-        free(sorted_idx);
-        return result;
-    }
-
-    for (size_t i = 0; i < NP; i++) {
-        new_pop[i] = malloc(data_size);
-        if (new_pop[i] == NULL) {
-            for (size_t j = 0; j < i; j++) free(new_pop[j]);
-            free(new_pop);
-            free(new_fitness);
-            free(child1);
-            free(child2);
-            for (size_t j = 0; j < NP; j++) free(pop[j]);
-            free(pop);
-            free(fitness);
-            free(sorted_idx);
-            return result;
-        }
-    }
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
 
     for (size_t gen = 0; gen < config->max_generations; gen++) {
         size_t new_count = 0;
@@ -328,11 +410,16 @@ OptResult ma_run(const MAConfig *config,
             new_count++;
         }
 
+        // Filhos aos pares direto nas linhas de new_pop; sorteios de busca
+        // local feitos aqui para manter a ordem do RNG
+        size_t children_begin = new_count;
         while (new_count + 1 < NP) {
-            int p1 = select_parent(config, fitness, sorted_idx, NP);
-            int p2 = select_parent(config, fitness, sorted_idx, NP);
+            void *child1 = new_pop[new_count];
+            void *child2 = new_pop[new_count + 1];
+            int p1 = select_parent(rng, config, fitness, sorted_idx, NP);
+            int p2 = select_parent(rng, config, fitness, sorted_idx, NP);
 
-            if (opt_random_uniform() < config->crossover_rate) {
+            if (opt_rng_uniform(rng) < config->crossover_rate) {
                 crossover(pop[p1], pop[p2], child1, child2, solution_size, context);
             } else {
                 memcpy(child1, pop[p1], data_size);
@@ -342,36 +429,33 @@ OptResult ma_run(const MAConfig *config,
             mutate(child1, solution_size, config->mutation_rate, context);
             mutate(child2, solution_size, config->mutation_rate, context);
 
-            double c1_cost = objective(child1, solution_size, context);
-            double c2_cost = objective(child2, solution_size, context);
-            result.num_evaluations += 2;
-
-            if (opt_random_uniform() < config->ls_probability) {
-                apply_local_search(child1, element_size, solution_size, objective, neighbor,
-                                   context, config->direction, config->ls_iterations,
-                                   config->ls_neighbors, &c1_cost, &result.num_evaluations,
-                                   config->learning);
-            }
-            if (opt_random_uniform() < config->ls_probability) {
-                apply_local_search(child2, element_size, solution_size, objective, neighbor,
-                                   context, config->direction, config->ls_iterations,
-                                   config->ls_neighbors, &c2_cost, &result.num_evaluations,
-                                   config->learning);
-            }
-
-            memcpy(new_pop[new_count], child1, data_size);
-            new_fitness[new_count] = c1_cost;
-            new_count++;
-
-            if (new_count < NP) {
-                memcpy(new_pop[new_count], child2, data_size);
-                new_fitness[new_count] = c2_cost;
-                new_count++;
+            ls_flag[new_count] = opt_rng_uniform(rng) < config->ls_probability;
+            ls_flag[new_count + 1] = opt_rng_uniform(rng) < config->ls_probability;
+            if (parallel) {
+                ls_seeds[new_count] = opt_rng_next(rng);
+                ls_seeds[new_count + 1] = opt_rng_next(rng);
             }
+            new_count += 2;
         }
 
+        size_t n_children = new_count - children_begin;
+        result.num_evaluations += opt_evaluate_batch(config->batch_objective, objective,
+                                                     new_pop[children_begin], n_children,
+                                                     data_size, solution_size,
+                                                     new_fitness + children_begin, context);
+
+        // Refinamento so nos ceil(p * filhos) melhores, depois da avaliacao
+        keep_top_fraction(new_fitness + children_begin, n_children, config->ls_top_fraction,
+                          config->direction, ls_flag + children_begin, ls_order);
+        batch.rows = new_pop + children_begin;
+        batch.fitness = new_fitness + children_begin;
+        batch.flags = ls_flag + children_begin;
+        batch.seeds = parallel ? ls_seeds + children_begin : NULL;
+        batch.evaluations = ls_evals;
+        result.num_evaluations += local_search_batch(&batch, n_children);
+
         if (new_count < NP) {
-            int p = select_parent(config, fitness, sorted_idx, NP);
+            int p = select_parent(rng, config, fitness, sorted_idx, NP);
             memcpy(new_pop[new_count], pop[p], data_size);
             new_fitness[new_count] = fitness[p];
             new_count++;
@@ -391,9 +475,8 @@ OptResult ma_run(const MAConfig *config,
         sort_indices(sorted_idx, NP, fitness);
 
         result.num_iterations = gen + 1;
-        if (gen < result.convergence_size) {
-            result.convergence[gen] = best_fitness;
-        }
+        opt_tracer_record(&tracer, &result, gen, best_fitness, result.num_evaluations);
+        if (opt_stop_check(&stop, result.num_evaluations, best_fitness)) break;
     }
 
     result.best = opt_solution_create(data_size);
@@ -402,17 +485,18 @@ OptResult ma_run(const MAConfig *config,
         result.best.cost = best_fitness;
     }
 
-    free(child1);
-    free(child2);
-    for (size_t i = 0; i < NP; i++) {
-        free(pop[i]);
-        free(new_pop[i]);
-    }
+    free(pop_data);
+    free(new_data);
     free(pop);
     free(new_pop);
     free(fitness);
     free(new_fitness);
     free(sorted_idx);
+    free(ls_flag);
+    free(ls_order);
+    free(ls_seeds);
+    free(ls_evals);
 
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
@@ -4,6 +4,8 @@
  *
  * PSO classico com inercia constante, linear decreasing ou
  * constriction factor. Velocity clamping e position clamping.
+ * pso_run_parallel: motor de alto throughput (stream por particula,
+ * atualizacao vetorizada por blocos e avaliacao paralela).
  *
  * Referencias:
  * - Kennedy, J. & Eberhart, R. (1995). "Particle Swarm Optimization".
@@ -15,11 +17,13 @@
  */
 
 #include "optimization/metaheuristics/pso.h"
+#include "data_structures/thread_pool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <float.h>
 
+
 // ============================================================================
 // HELPERS
 // ============================================================================
@@ -28,12 +32,54 @@ static bool pso_is_better(double a, double b, OptDirection dir) {
     return (dir == OPT_MINIMIZE) ? (a < b) : (a > b);
 }
 
+// Atualiza o pbest da particula i com x (custo cost) e, se for o caso, o
+// gbest e result.best
+static void accept_particle(size_t i, double cost, const double *x, size_t D,
+                            double *pbest_pos, double *pbest_cost,
+                            double *gbest_pos, double *gbest_cost,
+                            OptResult *result, OptDirection dir) {
+    if (!pso_is_better(cost, pbest_cost[i], dir)) return;
+    memcpy(pbest_pos + i * D, x, D * sizeof(double));
+    pbest_cost[i] = cost;
+
+    if (pso_is_better(cost, *gbest_cost, dir)) {
+        memcpy(gbest_pos, x, D * sizeof(double));
+        *gbest_cost = cost;
+        memcpy(result->best.data, x, D * sizeof(double));
+        result->best.cost = cost;
+    }
+}
+
 static double clamp(double val, double lo, double hi) {
     if (val < lo) return lo;
     if (val > hi) return hi;
     return val;
 }
 
+static double constriction_chi(const PSOConfig *config) {
+    double chi = 1.0;
+    if (config->inertia_type == PSO_INERTIA_CONSTRICTION) {
+        double phi = config->c1 + config->c2;
+        if (phi > 4.0) {
+            chi = 2.0 / fabs(2.0 - phi - sqrt(phi * phi - 4.0 * phi));
+        }
+    }
+    return chi;
+}
+
+static double inertia_weight(const PSOConfig *config, size_t iter, double chi) {
+    switch (config->inertia_type) {
+        case PSO_INERTIA_LINEAR_DECREASING:
+            return config->w - (config->w - config->w_min) *
+                   ((double)iter / (double)config->max_iterations);
+        case PSO_INERTIA_CONSTRICTION:
+            return chi;
+        case PSO_INERTIA_CONSTANT:
+        default:
+            return config->w;
+    }
+}
+
 // ============================================================================
 // CONFIGURACAO
 // ============================================================================
@@ -50,8 +96,13 @@ PSOConfig pso_default_config(void) {
     config.inertia_type = PSO_INERTIA_LINEAR_DECREASING;
     config.lower_bound = -5.12;
     config.upper_bound = 5.12;
+    config.stop = opt_stop_none();
+    config.trace = opt_trace_default();
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
+    config.batch_objective = NULL;
+    config.num_threads = 0;
     return config;
 }
 
@@ -63,8 +114,9 @@ OptResult pso_run(const PSOConfig *config,
                   size_t solution_size,
                   ObjectiveFn objective,
                   const void *context) {
-    OptResult result = opt_result_create(config->max_iterations);
-    opt_set_seed(config->seed);
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_iterations);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
 
     size_t D = solution_size;
     size_t N = config->num_particles;
@@ -77,14 +129,16 @@ OptResult pso_run(const PSOConfig *config,
     double *pbest_pos = malloc(N * element_size);
     double *pbest_cost = malloc(N * sizeof(double));
     double *gbest_pos = malloc(element_size);
+    double *costs = malloc(N * sizeof(double));
 
     if (positions == NULL || velocities == NULL || pbest_pos == NULL ||
-        pbest_cost == NULL || gbest_pos == NULL) {
+        pbest_cost == NULL || gbest_pos == NULL || costs == NULL) {
         free(positions);
         free(velocities);
         free(pbest_pos);
         free(pbest_cost);
         free(gbest_pos);
+        free(costs);
         return result;
     }
 
@@ -94,19 +148,20 @@ OptResult pso_run(const PSOConfig *config,
         double *xi = positions + i * D;
         double *vi = velocities + i * D;
         for (size_t d = 0; d < D; d++) {
-            xi[d] = config->lower_bound + opt_random_uniform() * range;
-            vi[d] = -v_max + opt_random_uniform() * 2.0 * v_max;
+            xi[d] = config->lower_bound + opt_rng_uniform(rng) * range;
+            vi[d] = -v_max + opt_rng_uniform(rng) * 2.0 * v_max;
         }
+    }
 
-        double cost = objective(xi, D, context);
-        result.num_evaluations++;
-
-        memcpy(pbest_pos + i * D, xi, element_size);
-        pbest_cost[i] = cost;
+    result.num_evaluations += opt_evaluate_batch(config->batch_objective, objective,
+                                                 positions, N, element_size, D,
+                                                 pbest_cost, context);
+    memcpy(pbest_pos, positions, N * element_size);
 
-        if (pso_is_better(cost, gbest_cost, config->direction)) {
-            memcpy(gbest_pos, xi, element_size);
-            gbest_cost = cost;
+    for (size_t i = 0; i < N; i++) {
+        if (pso_is_better(pbest_cost[i], gbest_cost, config->direction)) {
+            memcpy(gbest_pos, positions + i * D, element_size);
+            gbest_cost = pbest_cost[i];
         }
     }
 
@@ -114,32 +169,16 @@ OptResult pso_run(const PSOConfig *config,
     memcpy(result.best.data, gbest_pos, element_size);
     result.best.cost = gbest_cost;
 
-    double w_max = config->w;
-    double w_min = config->w_min;
-    double chi = 1.0;
-    if (config->inertia_type == PSO_INERTIA_CONSTRICTION) {
-        double phi = config->c1 + config->c2;
-        if (phi > 4.0) {
-            chi = 2.0 / fabs(2.0 - phi - sqrt(phi * phi - 4.0 * phi));
-        }
-    }
+    double chi = constriction_chi(config);
+
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
+
+    // Sem batch_objective o gbest e assincrono (PSO classico): cada
+    // particula e avaliada logo apos mover e as seguintes ja veem o novo gbest
+    bool synchronous = config->batch_objective != NULL;
 
     for (size_t iter = 0; iter < config->max_iterations; iter++) {
-        double w;
-        switch (config->inertia_type) {
-            case PSO_INERTIA_CONSTANT:
-                w = config->w;
-                break;
-            case PSO_INERTIA_LINEAR_DECREASING:
-                w = w_max - (w_max - w_min) * ((double)iter / (double)config->max_iterations);
-                break;
-            case PSO_INERTIA_CONSTRICTION:
-                w = chi;
-                break;
-            default:
-                w = config->w;
-                break;
-        }
+        double w = inertia_weight(config, iter, chi);
 
         for (size_t i = 0; i < N; i++) {
             double *xi = positions + i * D;
@@ -147,8 +186,8 @@ OptResult pso_run(const PSOConfig *config,
             double *pi = pbest_pos + i * D;
 
             for (size_t d = 0; d < D; d++) {
-                double r1 = opt_random_uniform();
-                double r2 = opt_random_uniform();
+                double r1 = opt_rng_uniform(rng);
+                double r2 = opt_rng_uniform(rng);
 
                 vi[d] = w * vi[d]
                       + config->c1 * r1 * (pi[d] - xi[d])
@@ -160,32 +199,235 @@ OptResult pso_run(const PSOConfig *config,
                 xi[d] = clamp(xi[d], config->lower_bound, config->upper_bound);
             }
 
-            double cost = objective(xi, D, context);
-            result.num_evaluations++;
+            if (!synchronous) {
+                costs[i] = objective(xi, D, context);
+                result.num_evaluations++;
+                accept_particle(i, costs[i], xi, D, pbest_pos, pbest_cost,
+                                gbest_pos, &gbest_cost, &result, config->direction);
+            }
+        }
+
+        if (synchronous) {
+            // gbest sincrono: o enxame inteiro move e so entao e avaliado
+            result.num_evaluations += opt_evaluate_batch(config->batch_objective, objective,
+                                                         positions, N, element_size, D,
+                                                         costs, context);
+            for (size_t i = 0; i < N; i++) {
+                accept_particle(i, costs[i], positions + i * D, D, pbest_pos, pbest_cost,
+                                gbest_pos, &gbest_cost, &result, config->direction);
+            }
+        }
+
+        opt_tracer_record(&tracer, &result, iter, result.best.cost, result.num_evaluations);
+        result.num_iterations = iter + 1;
+        if (opt_stop_check(&stop, result.num_evaluations, result.best.cost)) break;
+    }
+
+    free(positions);
+    free(velocities);
+    free(pbest_pos);
+    free(pbest_cost);
+    free(gbest_pos);
+    free(costs);
+    opt_tracer_finish(&tracer, &result);
+    return result;
+}
+
+// ============================================================================
+// PSO DE ALTO THROUGHPUT
+// ============================================================================
+
+// Dimensoes por bloco: uniformes r1/r2 do bloco ficam na pilha
+#define PSO_BLOCK 256
 
-            if (pso_is_better(cost, pbest_cost[i], config->direction)) {
-                memcpy(pi, xi, element_size);
-                pbest_cost[i] = cost;
+// Velocidade e posicao de uma particula, bloco a bloco: sorteia os
+// uniformes do bloco e atualiza v/x num laco sem desvios (vetorizavel)
+static void move_particle(OptRng *rng, double *restrict x, double *restrict v,
+                          const double *pbest, const double *gbest, size_t D,
+                          double w, double c1, double c2, double v_max,
+                          double lb, double ub) {
+    double r1[PSO_BLOCK];
+    double r2[PSO_BLOCK];
+    for (size_t start = 0; start < D; start += PSO_BLOCK) {
+        size_t len = (D - start < PSO_BLOCK) ? D - start : PSO_BLOCK;
+        opt_rng_fill_uniform(rng, r1, len, 0.0, 1.0);
+        opt_rng_fill_uniform(rng, r2, len, 0.0, 1.0);
 
-                if (pso_is_better(cost, gbest_cost, config->direction)) {
-                    memcpy(gbest_pos, xi, element_size);
-                    gbest_cost = cost;
-                    memcpy(result.best.data, xi, element_size);
-                    result.best.cost = cost;
+        double *xb = x + start;
+        double *vb = v + start;
+        const double *pb = pbest + start;
+        const double *gb = gbest + start;
+#ifdef HAVE_OMP_SIMD
+        #pragma omp simd
+#endif
+        for (size_t d = 0; d < len; d++) {
+            double vd = w * vb[d] + c1 * r1[d] * (pb[d] - xb[d]) + c2 * r2[d] * (gb[d] - xb[d]);
+            vd = (vd < -v_max) ? -v_max : vd;
+            vd = (vd > v_max) ? v_max : vd;
+            double xd = xb[d] + vd;
+            xd = (xd < lb) ? lb : xd;
+            xd = (xd > ub) ? ub : xd;
+            vb[d] = vd;
+            xb[d] = xd;
+        }
+    }
+}
+
+// Estado do enxame de pso_run_parallel visto pelas tarefas do pool
+typedef struct {
+    size_t D;
+    double *positions;
+    double *velocities;
+    double *pbest_pos;
+    double *pbest_cost;
+    double *costs;
+    const double *gbest_pos;
+    OptRng *rngs;
+    double lb, ub, v_max, w, c1, c2;
+    bool inline_eval;
+    ObjectiveFn objective;
+    const void *context;
+} PSOSwarmJob;
+
+static void swarm_init_range(void *ctx, size_t lo, size_t hi) {
+    const PSOSwarmJob *job = ctx;
+    size_t D = job->D;
+    for (size_t i = lo; i < hi; i++) {
+        double *xi = job->positions + i * D;
+        opt_rng_fill_uniform(&job->rngs[i], xi, D, job->lb, job->ub);
+        opt_rng_fill_uniform(&job->rngs[i], job->velocities + i * D, D, -job->v_max, job->v_max);
+        memcpy(job->pbest_pos + i * D, xi, D * sizeof(double));
+        if (job->inline_eval) job->pbest_cost[i] = job->objective(xi, D, job->context);
+    }
+}
+
+static void swarm_move_range(void *ctx, size_t lo, size_t hi) {
+    const PSOSwarmJob *job = ctx;
+    size_t D = job->D;
+    for (size_t i = lo; i < hi; i++) {
+        double *xi = job->positions + i * D;
+        move_particle(&job->rngs[i], xi, job->velocities + i * D, job->pbest_pos + i * D,
+                      job->gbest_pos, D, job->w, job->c1, job->c2, job->v_max, job->lb, job->ub);
+        if (job->inline_eval) job->costs[i] = job->objective(xi, D, job->context);
+    }
+}
+
+OptResult pso_run_parallel(const PSOConfig *config,
+                           size_t solution_size,
+                           ObjectiveFn objective,
+                           const void *context) {
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_iterations);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
+
+    size_t D = solution_size;
+    size_t N = config->num_particles;
+    size_t element_size = D * sizeof(double);
+    double lb = config->lower_bound;
+    double ub = config->upper_bound;
+    double range = ub - lb;
+    double v_max = config->v_max_ratio * range;
+    if (N == 0 || D == 0) return result;
+
+    // Campos em arrays separados de linhas N x D contiguas
+    double *positions = malloc(N * element_size);
+    double *velocities = malloc(N * element_size);
+    double *pbest_pos = malloc(N * element_size);
+    double *pbest_cost = malloc(N * sizeof(double));
+    double *costs = malloc(N * sizeof(double));
+    double *gbest_pos = malloc(element_size);
+    OptRng *rngs = malloc(N * sizeof(OptRng));
+
+    if (positions == NULL || velocities == NULL || pbest_pos == NULL ||
+        pbest_cost == NULL || costs == NULL || gbest_pos == NULL || rngs == NULL) {
+        free(positions);
+        free(velocities);
+        free(pbest_pos);
+        free(pbest_cost);
+        free(costs);
+        free(gbest_pos);
+        free(rngs);
+        return result;
+    }
+
+    // Stream nao sobreposto por particula: nada depende da thread
+    OptRng base = *rng;
+    for (size_t i = 0; i < N; i++) {
+        opt_rng_jump(&base);
+        rngs[i] = base;
+    }
+
+    bool inline_eval = config->batch_objective == NULL;
+    size_t threads = ds_resolve_threads(config->num_threads);
+    PSOSwarmJob swarm = { D, positions, velocities, pbest_pos, pbest_cost, costs, gbest_pos,
+                          rngs, lb, ub, v_max, 0.0, config->c1, config->c2,
+                          inline_eval, objective, context };
+
+    ds_parallel_for_threads(threads, 0, N, 0, swarm_init_range, &swarm);
+    if (inline_eval) {
+        result.num_evaluations += N;
+    } else {
+        result.num_evaluations += opt_evaluate_batch(config->batch_objective, objective,
+                                                     positions, N, element_size, D,
+                                                     pbest_cost, context);
+    }
+
+    size_t gbest = 0;
+    for (size_t i = 1; i < N; i++) {
+        if (pso_is_better(pbest_cost[i], pbest_cost[gbest], config->direction)) gbest = i;
+    }
+    double gbest_cost = pbest_cost[gbest];
+    memcpy(gbest_pos, pbest_pos + gbest * D, element_size);
+
+    double chi = constriction_chi(config);
+
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
+
+    for (size_t iter = 0; iter < config->max_iterations; iter++) {
+        double w = inertia_weight(config, iter, chi);
+
+        // gbest sincrono: cada particula move, avalia e atualiza o pbest
+        // de forma independente; o gbest e reduzido depois, em ordem
+        swarm.w = w;
+        ds_parallel_for_threads(threads, 0, N, 0, swarm_move_range, &swarm);
+        if (inline_eval) {
+            result.num_evaluations += N;
+        } else {
+            result.num_evaluations += opt_evaluate_batch(config->batch_objective, objective,
+                                                         positions, N, element_size, D,
+                                                         costs, context);
+        }
+
+        for (size_t i = 0; i < N; i++) {
+            if (pso_is_better(costs[i], pbest_cost[i], config->direction)) {
+                memcpy(pbest_pos + i * D, positions + i * D, element_size);
+                pbest_cost[i] = costs[i];
+                if (pso_is_better(costs[i], gbest_cost, config->direction)) {
+                    gbest_cost = costs[i];
+                    gbest = i;
                 }
             }
         }
+        memcpy(gbest_pos, pbest_pos + gbest * D, element_size);
 
-        if (result.convergence != NULL && iter < result.convergence_size) {
-            result.convergence[iter] = result.best.cost;
-        }
+        opt_tracer_record(&tracer, &result, iter, gbest_cost, result.num_evaluations);
         result.num_iterations = iter + 1;
+        if (opt_stop_check(&stop, result.num_evaluations, gbest_cost)) break;
+    }
+
+    result.best = opt_solution_create(element_size);
+    if (result.best.data != NULL) {
+        memcpy(result.best.data, gbest_pos, element_size);
+        result.best.cost = gbest_cost;
     }
 
     free(positions);
     free(velocities);
     free(pbest_pos);
     free(pbest_cost);
+    free(costs);
     free(gbest_pos);
+    free(rngs);
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
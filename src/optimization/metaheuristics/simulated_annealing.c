@@ -3,23 +3,28 @@
  * @brief Implementacao do Simulated Annealing e variantes
  *
  * SA classico com 4 cooling schedules (geometric, linear, logarithmic, adaptive),
- * reheating opcional e auto-calibracao de T0.
+ * reheating opcional e auto-calibracao de T0, e parallel tempering (replicas
+ * a temperatura fixa com troca de estados por Metropolis).
  *
  * Referencias:
  * - Kirkpatrick, S., Gelatt, C. D. & Vecchi, M. P. (1983).
  *   "Optimization by Simulated Annealing". Science, 220(4598), 671-680.
  * - Hajek, B. (1988). "Cooling Schedules for Optimal Annealing"
+ * - Earl, D. J. & Deem, M. W. (2005). "Parallel tempering: Theory,
+ *   applications, and new perspectives". PCCP, 7(23), 3910-3916.
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
  */
 
 #include "optimization/metaheuristics/simulated_annealing.h"
+#include "data_structures/thread_pool.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <float.h>
 
+
 // ============================================================================
 // HELPERS
 // ============================================================================
@@ -57,6 +62,73 @@ static double sa_cool(double T, double T0, double T_min, double alpha,
     }
 }
 
+typedef struct {
+    size_t element_size;
+    size_t solution_size;
+    ObjectiveFn objective;
+    NeighborFn neighbor;
+    GenerateFn generate;
+    const void *context;
+} SAProblem;
+
+// Cadeia de Metropolis: estado corrente, buffer do vizinho e melhor visto
+typedef struct {
+    void *current;
+    void *candidate;
+    double cost;
+    void *best;
+    double best_cost;
+    size_t evaluations;
+} SAChain;
+
+// Um passo de Metropolis a temperatura T; retorna true se aceitou
+static bool sa_chain_step(SAChain *c, double T, const SAConfig *config,
+                          const SAProblem *p, OptRng *rng) {
+    bool moves = config->move_delta != NULL && config->move_apply != NULL;
+    OptMove move = {0, 0, 0, 0};
+
+    double cand_cost;
+    if (moves) {
+        cand_cost = c->cost + config->move_delta(c->current, p->solution_size, &move, p->context);
+    } else {
+        p->neighbor(c->current, c->candidate, p->solution_size, p->context);
+        cand_cost = p->objective(c->candidate, p->solution_size, p->context);
+    }
+    c->evaluations++;
+
+    double delta;
+    if (config->direction == OPT_MINIMIZE) {
+        delta = cand_cost - c->cost;
+    } else {
+        delta = c->cost - cand_cost;
+    }
+
+    bool accept = false;
+    if (delta < 0) {
+        accept = true;
+    } else if (T > 1e-15) {
+        double prob = exp(-delta / T);
+        if (opt_rng_uniform(rng) < prob) {
+            accept = true;
+        }
+    }
+
+    if (accept) {
+        if (moves) {
+            config->move_apply(c->current, p->solution_size, &move, p->context);
+        } else {
+            memcpy(c->current, c->candidate, p->element_size);
+        }
+        c->cost = cand_cost;
+
+        if (sa_is_better(c->cost, c->best_cost, config->direction)) {
+            memcpy(c->best, c->current, p->element_size);
+            c->best_cost = c->cost;
+        }
+    }
+    return accept;
+}
+
 // ============================================================================
 // CONFIGURACAO
 // ============================================================================
@@ -82,8 +154,17 @@ SAConfig sa_default_config(void) {
     config.adaptive_target_high = 0.5;
     config.adaptive_factor = 1.05;
 
+    config.num_replicas = 1;
+    config.pt_cold_acceptance = 0.01;
+    config.num_threads = 1;
+
+    config.move_delta = NULL;
+    config.move_apply = NULL;
+    config.stop = opt_stop_none();
+    config.trace = opt_trace_default();
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
     return config;
 }
 
@@ -116,10 +197,18 @@ double sa_calibrate_t0(const SAConfig *config,
     size_t samples = config->calibration_samples;
     if (samples == 0) samples = 100;
 
+    bool moves = config->move_delta != NULL && config->move_apply != NULL;
+
     for (size_t i = 0; i < samples; i++) {
-        neighbor(current, candidate, solution_size, context);
-        double cand_cost = objective(candidate, solution_size, context);
-        double delta = fabs(cand_cost - current_cost);
+        double delta;
+        if (moves) {
+            OptMove move;
+            delta = fabs(config->move_delta(current, solution_size, &move, context));
+        } else {
+            neighbor(current, candidate, solution_size, context);
+            double cand_cost = objective(candidate, solution_size, context);
+            delta = fabs(cand_cost - current_cost);
+        }
         if (delta > 1e-15) {
             sum_delta += delta;
             count++;
@@ -138,6 +227,222 @@ double sa_calibrate_t0(const SAConfig *config,
     return -avg_delta / log(target);
 }
 
+// ============================================================================
+// PARALLEL TEMPERING
+// ============================================================================
+
+typedef struct {
+    SAChain chain;
+    double T;
+    OptRng own_rng;    // Stream do criterio de Metropolis
+    OptRng op_rng;     // Stream de opt_random_* de neighbor/generate
+} SAReplica;
+
+// Troca o stream de opt_random_* da thread pelo da replica (e de volta)
+static void replica_swap_op_rng(SAReplica *rep) {
+    OptRng *thread_rng = opt_rng_thread();
+    OptRng tmp = *thread_rng;
+    *thread_rng = rep->op_rng;
+    rep->op_rng = tmp;
+}
+
+static void replicas_free(SAReplica *reps, size_t M) {
+    for (size_t k = 0; k < M; k++) {
+        free(reps[k].chain.current);
+        free(reps[k].chain.candidate);
+        free(reps[k].chain.best);
+    }
+    free(reps);
+}
+
+// Escada geometrica T_frio..T_quente; reps[0] e a replica mais fria
+static void replicas_ladder(SAReplica *reps, size_t M, const SAConfig *config,
+                            const SAProblem *p) {
+    double hot, cold;
+    if (config->auto_calibrate_t0) {
+        hot = sa_calibrate_t0(config, p->element_size, p->solution_size,
+                              p->objective, p->neighbor, p->generate, p->context);
+        SAConfig cold_cfg = *config;
+        cold_cfg.target_acceptance = config->pt_cold_acceptance;
+        cold = sa_calibrate_t0(&cold_cfg, p->element_size, p->solution_size,
+                               p->objective, p->neighbor, p->generate, p->context);
+    } else {
+        hot = config->initial_temp;
+        cold = config->final_temp;
+    }
+    if (hot <= 1e-15) hot = 1.0;
+    if (cold <= 1e-15 || cold > hot) cold = hot * 1e-3;
+
+    for (size_t k = 0; k < M; k++) {
+        reps[k].T = cold * pow(hot / cold, (double)k / (double)(M - 1));
+    }
+}
+
+// Tentativas de troca entre temperaturas vizinhas (k, k+1), k = parity, parity+2, ...
+static void replicas_exchange(SAReplica *reps, size_t M, size_t parity,
+                              OptDirection dir, OptRng *rng) {
+    for (size_t k = parity; k + 1 < M; k += 2) {
+        SAChain *a = &reps[k].chain;
+        SAChain *b = &reps[k + 1].chain;
+        double ea = (dir == OPT_MINIMIZE) ? a->cost : -a->cost;
+        double eb = (dir == OPT_MINIMIZE) ? b->cost : -b->cost;
+        double x = (1.0 / reps[k].T - 1.0 / reps[k + 1].T) * (ea - eb);
+        if (x >= 0.0 || opt_rng_uniform(rng) < exp(x)) {
+            void *tmp = a->current;
+            a->current = b->current;
+            b->current = tmp;
+            double c = a->cost;
+            a->cost = b->cost;
+            b->cost = c;
+        }
+    }
+}
+
+typedef struct {
+    SAReplica *reps;
+    double *trace;
+    size_t chain_len, steps;
+    bool init;
+    const SAConfig *config;
+    const SAProblem *p;
+} SARound;
+
+// Avanca as replicas de [lo, hi) uma rodada (ou so as inicializa)
+static void sa_round_range(void *ctx, size_t lo, size_t hi) {
+    const SARound *r = ctx;
+    const SAProblem *p = r->p;
+    for (size_t k = lo; k < hi; k++) {
+        SAReplica *rep = &r->reps[k];
+        SAChain *c = &rep->chain;
+        replica_swap_op_rng(rep);
+        if (r->init) {
+            p->generate(c->current, p->solution_size, p->context);
+            c->cost = p->objective(c->current, p->solution_size, p->context);
+            c->evaluations = 1;
+            memcpy(c->best, c->current, p->element_size);
+            c->best_cost = c->cost;
+        }
+        for (size_t s = 0; s < r->steps; s++) {
+            sa_chain_step(c, rep->T, r->config, p, &rep->own_rng);
+            r->trace[k * r->chain_len + s] = c->best_cost;
+        }
+        replica_swap_op_rng(rep);
+    }
+}
+
+static OptResult sa_run_tempering(const SAConfig *config, const SAProblem *p) {
+    size_t M = config->num_replicas;
+    size_t es = p->element_size;
+    size_t max_iter = config->max_iterations;
+    size_t chain_len = config->markov_chain_length;
+    if (chain_len == 0) chain_len = 1;
+
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, max_iter);
+
+    SAReplica *reps = calloc(M, sizeof(SAReplica));
+    double *trace = malloc(M * chain_len * sizeof(double));
+    if (reps == NULL || trace == NULL) {
+        free(reps);
+        free(trace);
+        return result;
+    }
+    for (size_t k = 0; k < M; k++) {
+        reps[k].chain.current = malloc(es);
+        reps[k].chain.candidate = malloc(es);
+        reps[k].chain.best = malloc(es);
+        if (reps[k].chain.current == NULL || reps[k].chain.candidate == NULL ||
+            reps[k].chain.best == NULL) {
+            replicas_free(reps, M);
+            free(trace);
+            return result;
+        }
+    }
+
+    replicas_ladder(reps, M, config, p);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
+
+    // Streams nao sobrepostos por replica; rng fica para as trocas
+    OptRng base = *rng;
+    for (size_t k = 0; k < M; k++) {
+        opt_rng_jump(&base);
+        reps[k].own_rng = base;
+        opt_rng_jump(&base);
+        reps[k].op_rng = base;
+    }
+
+    size_t threads = (config->num_threads == 0) ? M : config->num_threads;
+    SARound work = { reps, trace, chain_len, 0, true, config, p };
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
+
+    // Rodada 0 so inicializa; as demais avancam chain_len passos e trocam
+    size_t iter = 0;
+    size_t round = 0;
+    for (bool init = true; init || iter < max_iter; init = false) {
+        size_t steps = init ? 0 : (max_iter - iter < chain_len ? max_iter - iter : chain_len);
+
+        work.init = init;
+        work.steps = steps;
+        ds_parallel_for_threads(threads, 0, M, 1, sa_round_range, &work);
+
+        size_t evals = 0;
+        for (size_t k = 0; k < M; k++) evals += reps[k].chain.evaluations;
+
+        for (size_t s = 0; s < steps; s++) {
+            double best = trace[s];
+            for (size_t k = 1; k < M; k++) {
+                if (sa_is_better(trace[k * chain_len + s], best, config->direction)) {
+                    best = trace[k * chain_len + s];
+                }
+            }
+            // Avaliacoes por passo nao sao guardadas: amostras da rodada levam o total
+            opt_tracer_record(&tracer, &result, iter + s, best, evals);
+        }
+
+        if (!init) {
+            replicas_exchange(reps, M, round % 2, config->direction, rng);
+            round++;
+        }
+        iter += steps;
+
+        // Checagem no fim da rodada (apos a reducao dos traces)
+        double best = reps[0].chain.best_cost;
+        for (size_t k = 0; k < M; k++) {
+            if (sa_is_better(reps[k].chain.best_cost, best, config->direction)) {
+                best = reps[k].chain.best_cost;
+            }
+        }
+        if (opt_stop_check(&stop, evals, best)) break;
+    }
+
+    size_t best_idx = 0;
+    for (size_t k = 0; k < M; k++) {
+        result.num_evaluations += reps[k].chain.evaluations;
+        if (sa_is_better(reps[k].chain.best_cost, reps[best_idx].chain.best_cost,
+                         config->direction)) {
+            best_idx = k;
+        }
+    }
+
+    result.best = opt_solution_create(es);
+    if (result.best.data != NULL) {
+        memcpy(result.best.data, reps[best_idx].chain.best, es);
+        result.best.cost = reps[best_idx].chain.best_cost;
+
+        // Custo acumulado por deltas deriva; recalcula o da melhor solucao
+        if (config->move_delta != NULL && config->move_apply != NULL) {
+            result.best.cost = p->objective(result.best.data, p->solution_size, p->context);
+            result.num_evaluations++;
+        }
+    }
+    result.num_iterations = iter;
+
+    replicas_free(reps, M);
+    free(trace);
+    opt_tracer_finish(&tracer, &result);
+    return result;
+}
+
 // ============================================================================
 // SA PRINCIPAL
 // ============================================================================
@@ -149,8 +454,14 @@ OptResult sa_run(const SAConfig *config,
                  NeighborFn neighbor,
                  GenerateFn generate,
                  const void *context) {
-    OptResult result = opt_result_create(config->max_iterations);
-    opt_set_seed(config->seed);
+    SAProblem prob = { element_size, solution_size, objective, neighbor, generate, context };
+    if (config->num_replicas > 1) {
+        return sa_run_tempering(config, &prob);
+    }
+
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_iterations);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
 
     void *current = malloc(element_size);
     void *candidate = malloc(element_size);
@@ -173,7 +484,7 @@ OptResult sa_run(const SAConfig *config,
     if (config->auto_calibrate_t0) {
         T = sa_calibrate_t0(config, element_size, solution_size,
                             objective, neighbor, generate, context);
-        opt_set_seed(config->seed);
+        rng = opt_rng_select(config->rng, config->seed);
         generate(current, solution_size, context);
         current_cost = objective(current, solution_size, context);
         memcpy(result.best.data, current, element_size);
@@ -183,52 +494,27 @@ OptResult sa_run(const SAConfig *config,
         T = config->initial_temp;
     }
 
+    SAChain chain = { current, candidate, current_cost, result.best.data,
+                      result.best.cost, result.num_evaluations };
+
     double T0 = T;
     size_t global_iter = 0;
     size_t temp_step = 0;
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
 
-    while (T > config->final_temp && global_iter < config->max_iterations) {
+    while (T > config->final_temp && global_iter < config->max_iterations && !stop.stopped) {
         size_t accepted = 0;
         size_t chain_len = config->markov_chain_length;
         if (chain_len == 0) chain_len = 1;
 
         for (size_t i = 0; i < chain_len && global_iter < config->max_iterations; i++) {
-            neighbor(current, candidate, solution_size, context);
-            double cand_cost = objective(candidate, solution_size, context);
-            result.num_evaluations++;
-
-            double delta;
-            if (config->direction == OPT_MINIMIZE) {
-                delta = cand_cost - current_cost;
-            } else {
-                delta = current_cost - cand_cost;
-            }
-
-            bool accept = false;
-            if (delta < 0) {
-                accept = true;
-            } else if (T > 1e-15) {
-                double prob = exp(-delta / T);
-                if (opt_random_uniform() < prob) {
-                    accept = true;
-                }
-            }
-
-            if (accept) {
-                memcpy(current, candidate, element_size);
-                current_cost = cand_cost;
+            if (sa_chain_step(&chain, T, config, &prob, rng)) {
                 accepted++;
-
-                if (sa_is_better(current_cost, result.best.cost, config->direction)) {
-                    memcpy(result.best.data, current, element_size);
-                    result.best.cost = current_cost;
-                }
             }
 
-            if (result.convergence != NULL && global_iter < result.convergence_size) {
-                result.convergence[global_iter] = result.best.cost;
-            }
+            opt_tracer_record(&tracer, &result, global_iter, chain.best_cost, chain.evaluations);
             global_iter++;
+            if (opt_stop_check(&stop, chain.evaluations, chain.best_cost)) break;
         }
 
         double acceptance_rate = (chain_len > 0) ?
@@ -250,9 +536,18 @@ OptResult sa_run(const SAConfig *config,
         }
     }
 
+    result.best.cost = chain.best_cost;
+    result.num_evaluations = chain.evaluations;
     result.num_iterations = global_iter;
 
+    // Custo acumulado por deltas deriva; recalcula o da melhor solucao
+    if (config->move_delta != NULL && config->move_apply != NULL && result.best.data != NULL) {
+        result.best.cost = objective(result.best.data, solution_size, context);
+        result.num_evaluations++;
+    }
+
     free(current);
     free(candidate);
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
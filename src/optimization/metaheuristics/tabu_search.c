@@ -2,8 +2,9 @@
  * @file tabu_search.c
  * @brief Implementacao do Tabu Search classico e variantes avancadas
  *
- * Lista tabu solution-based (hash FIFO circular), aspiracao,
- * diversificacao/intensificacao por frequencia, tenure reativo.
+ * Lista tabu solution-based (hash FIFO circular + conjunto HashTable com
+ * consulta O(1)), aspiracao, diversificacao/intensificacao por frequencia,
+ * tenure reativo.
  *
  * Referencias:
  * - Glover, F. (1986). "Future Paths for Integer Programming and Links
@@ -16,6 +17,8 @@
  */
 
 #include "optimization/metaheuristics/tabu_search.h"
+#include "optimization/benchmarks/tsp.h"
+#include "data_structures/hash_table.h"
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
@@ -25,39 +28,88 @@
 #define FNV_PRIME        1099511628211ULL
 
 // ============================================================================
-// TABU LIST (FIFO circular de hashes)
+// TABU LIST (FIFO circular de hashes + conjunto para busca O(1))
 // ============================================================================
 
+// A FIFO define a expiracao; members conta as ocorrencias de cada hash na
+// FIFO (o mesmo hash pode entrar mais de uma vez), entao contains e O(1)
+// independente do tenure. Sem members (falha de alocacao), busca linear.
 typedef struct {
     uint64_t *hashes;
     size_t capacity;
     size_t head;
     size_t count;
+    HashTable *members;
 } TabuList;
 
+static size_t tabu_key_hash(const void *key) {
+    uint64_t h;
+    memcpy(&h, key, sizeof(uint64_t));
+    return (size_t)(h ^ (h >> 32));
+}
+
+static int tabu_key_compare(const void *a, const void *b) {
+    uint64_t x, y;
+    memcpy(&x, a, sizeof(uint64_t));
+    memcpy(&y, b, sizeof(uint64_t));
+    return (x > y) - (x < y);
+}
+
+static void tabu_members_add(TabuList *tl, uint64_t hash) {
+    if (tl->members == NULL) return;
+    size_t *occurrences = hashtable_get_ptr(tl->members, &hash);
+    if (occurrences != NULL) {
+        (*occurrences)++;
+        return;
+    }
+    size_t one = 1;
+    if (hashtable_put(tl->members, &hash, &one) != DS_SUCCESS) {
+        hashtable_destroy(tl->members);
+        tl->members = NULL;
+    }
+}
+
+static void tabu_members_remove(TabuList *tl, uint64_t hash) {
+    if (tl->members == NULL) return;
+    size_t *occurrences = hashtable_get_ptr(tl->members, &hash);
+    if (occurrences != NULL && --(*occurrences) == 0) {
+        hashtable_remove(tl->members, &hash, NULL);
+    }
+}
+
 static TabuList tabu_list_create(size_t capacity) {
     TabuList tl;
     tl.capacity = (capacity > 0) ? capacity : 1;
     tl.hashes = calloc(tl.capacity, sizeof(uint64_t));
     tl.head = 0;
     tl.count = 0;
+    tl.members = hashtable_create(sizeof(uint64_t), sizeof(size_t), 2 * tl.capacity,
+                                  tabu_key_hash, tabu_key_compare, HASH_FLAT,
+                                  NULL, NULL);
     return tl;
 }
 
 static void tabu_list_destroy(TabuList *tl) {
     free(tl->hashes);
+    hashtable_destroy(tl->members);
     tl->hashes = NULL;
+    tl->members = NULL;
     tl->capacity = 0;
     tl->count = 0;
 }
 
 static void tabu_list_add(TabuList *tl, uint64_t hash) {
+    if (tl->count == tl->capacity) {
+        tabu_members_remove(tl, tl->hashes[tl->head]);
+    }
     tl->hashes[tl->head] = hash;
     tl->head = (tl->head + 1) % tl->capacity;
     if (tl->count < tl->capacity) tl->count++;
+    tabu_members_add(tl, hash);
 }
 
 static bool tabu_list_contains(const TabuList *tl, uint64_t hash) {
+    if (tl->members != NULL) return hashtable_contains(tl->members, &hash);
     for (size_t i = 0; i < tl->count; i++) {
         if (tl->hashes[i] == hash) return true;
     }
@@ -77,6 +129,11 @@ static void tabu_list_resize(TabuList *tl, size_t new_cap) {
         start = tl->count - copy_count;
     }
 
+    // Os mais antigos que nao cabem expiram
+    for (size_t i = 0; i < start; i++) {
+        size_t idx = (tl->head + tl->capacity - tl->count + i) % tl->capacity;
+        tabu_members_remove(tl, tl->hashes[idx]);
+    }
     for (size_t i = 0; i < copy_count; i++) {
         size_t idx = (tl->head + tl->capacity - tl->count + start + i) % tl->capacity;
         new_hashes[i] = tl->hashes[idx];
@@ -156,6 +213,43 @@ static bool ts_is_better(double a, double b, OptDirection dir) {
     return (dir == OPT_MINIMIZE) ? (a < b) : (a > b);
 }
 
+typedef struct {
+    OptMove move;
+    double cost;
+    bool used;
+} MoveCandidate;
+
+// ============================================================================
+// MEMORIA POR ATRIBUTOS (matriz de tenure)
+// ============================================================================
+
+// tabu_until[u * dim + v] = primeira iteracao em que (u, v) deixa de ser tabu
+typedef struct {
+    size_t *tabu_until;
+    size_t dim;
+} AttributeMemory;
+
+static bool attr_memory_is_tabu(const AttributeMemory *am, const TabuMoveAttributes *attrs,
+                                size_t iter) {
+    for (size_t a = 0; a < attrs->num_added; a++) {
+        const TabuAttribute *t = &attrs->added[a];
+        if (t->u < am->dim && t->v < am->dim && am->tabu_until[t->u * am->dim + t->v] > iter) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void attr_memory_mark(AttributeMemory *am, const TabuMoveAttributes *attrs,
+                             size_t iter, size_t tenure) {
+    for (size_t a = 0; a < attrs->num_dropped; a++) {
+        const TabuAttribute *t = &attrs->dropped[a];
+        if (t->u < am->dim && t->v < am->dim) {
+            am->tabu_until[t->u * am->dim + t->v] = iter + 1 + tenure;
+        }
+    }
+}
+
 // ============================================================================
 // CONFIGURACAO
 // ============================================================================
@@ -181,8 +275,15 @@ TSConfig ts_default_config(void) {
     config.min_tenure = 5;
     config.max_tenure = 50;
 
+    config.move_delta = NULL;
+    config.move_apply = NULL;
+    config.move_attributes = NULL;
+    config.attribute_dim = 0;
+    config.stop = opt_stop_none();
+    config.trace = opt_trace_default();
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
     return config;
 }
 
@@ -223,6 +324,106 @@ uint64_t ts_hash_double_array(const void *solution_data, size_t size) {
     return hash;
 }
 
+// ============================================================================
+// ATRIBUTOS TSP
+// ============================================================================
+
+static void attr_push(TabuAttribute *list, size_t *count, int a, int b) {
+    if (*count >= TS_MAX_MOVE_ATTRIBUTES) return;
+    list[*count].u = (size_t)(a < b ? a : b);
+    list[*count].v = (size_t)(a < b ? b : a);
+    (*count)++;
+}
+
+// Arestas removidas e reinseridas pelo mesmo movimento nao sao atributos
+static void attr_cancel_common(TabuMoveAttributes *attrs) {
+    size_t a = 0;
+    while (a < attrs->num_added) {
+        bool common = false;
+        for (size_t d = 0; d < attrs->num_dropped; d++) {
+            if (attrs->dropped[d].u == attrs->added[a].u &&
+                attrs->dropped[d].v == attrs->added[a].v) {
+                attrs->dropped[d] = attrs->dropped[--attrs->num_dropped];
+                common = true;
+                break;
+            }
+        }
+        if (common) {
+            attrs->added[a] = attrs->added[--attrs->num_added];
+        } else {
+            a++;
+        }
+    }
+}
+
+static int swapped_at(const int *tour, size_t p, size_t i, size_t j) {
+    if (p == i) return tour[j];
+    if (p == j) return tour[i];
+    return tour[p];
+}
+
+void ts_attributes_tsp(const void *current, size_t n, const OptMove *move,
+                       TabuMoveAttributes *attrs, const void *context) {
+    (void)context;
+    attrs->num_added = 0;
+    attrs->num_dropped = 0;
+    if (current == NULL || move == NULL || n < 3) return;
+
+    const int *t = (const int*)current;
+    size_t i = move->i;
+    size_t j = move->j;
+
+    switch ((TSPMoveType)move->type) {
+        case TSP_MOVE_2OPT: {
+            if (i >= j || j >= n || (i == 0 && j == n - 1)) return;
+            int a = t[(i + n - 1) % n];
+            int d = t[(j + 1) % n];
+            attr_push(attrs->dropped, &attrs->num_dropped, a, t[i]);
+            attr_push(attrs->dropped, &attrs->num_dropped, t[j], d);
+            attr_push(attrs->added, &attrs->num_added, a, t[j]);
+            attr_push(attrs->added, &attrs->num_added, t[i], d);
+            break;
+        }
+        case TSP_MOVE_SWAP: {
+            if (i == j || i >= n || j >= n) return;
+            // Arestas p -> p+1 afetadas (como em tsp_delta_swap)
+            size_t edges[4] = { (i + n - 1) % n, i, (j + n - 1) % n, j };
+            for (int e = 0; e < 4; e++) {
+                bool seen = false;
+                for (int f = 0; f < e; f++) {
+                    if (edges[f] == edges[e]) seen = true;
+                }
+                if (seen) continue;
+                size_t p = edges[e];
+                size_t q = (p + 1) % n;
+                attr_push(attrs->dropped, &attrs->num_dropped, t[p], t[q]);
+                attr_push(attrs->added, &attrs->num_added,
+                          swapped_at(t, p, i, j), swapped_at(t, q, i, j));
+            }
+            break;
+        }
+        case TSP_MOVE_OR_OPT: {
+            size_t len = move->k;
+            if (len == 0 || i + len > n || j >= n || n < len + 2) return;
+            size_t last = i + len - 1;
+            size_t a = (i + n - 1) % n;
+            size_t b = (last + 1) % n;
+            if (j == a || (j >= i && j <= last)) return;
+            size_t v = (j + 1) % n;
+            attr_push(attrs->dropped, &attrs->num_dropped, t[a], t[i]);
+            attr_push(attrs->dropped, &attrs->num_dropped, t[last], t[b]);
+            attr_push(attrs->dropped, &attrs->num_dropped, t[j], t[v]);
+            attr_push(attrs->added, &attrs->num_added, t[a], t[b]);
+            attr_push(attrs->added, &attrs->num_added, t[j], t[i]);
+            attr_push(attrs->added, &attrs->num_added, t[last], t[v]);
+            break;
+        }
+        default:
+            return;
+    }
+    attr_cancel_common(attrs);
+}
+
 // ============================================================================
 // TABU SEARCH PRINCIPAL
 // ============================================================================
@@ -235,21 +436,39 @@ OptResult ts_run(const TSConfig *config,
                  GenerateFn generate,
                  TabuHashFn hash_fn,
                  const void *context) {
-    OptResult result = opt_result_create(config->max_iterations);
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_iterations);
     opt_set_seed(config->seed);
 
     if (hash_fn == NULL) {
         hash_fn = ts_hash_bytes;
     }
 
+    bool moves = config->move_delta != NULL && config->move_apply != NULL;
+    bool by_attributes = moves && config->move_attributes != NULL;
+    size_t num_candidates = config->neighbors_per_iter;
+
     void *current = malloc(element_size);
     void *candidate = malloc(element_size);
     void *best_candidate = malloc(element_size);
+    MoveCandidate *move_cands = NULL;
+    if (moves && num_candidates > 0) {
+        move_cands = malloc(num_candidates * sizeof(MoveCandidate));
+    }
+    AttributeMemory attr_mem = {NULL, 0};
+    if (by_attributes) {
+        attr_mem.dim = (config->attribute_dim > 0) ? config->attribute_dim : solution_size;
+        attr_mem.tabu_until = calloc(attr_mem.dim * attr_mem.dim, sizeof(size_t));
+    }
 
-    if (current == NULL || candidate == NULL || best_candidate == NULL) {
+    if (current == NULL || candidate == NULL || best_candidate == NULL ||
+        (moves && num_candidates > 0 && move_cands == NULL) ||
+        (by_attributes && attr_mem.tabu_until == NULL)) {
         free(current);
         free(candidate);
         free(best_candidate);
+        free(move_cands);
+        free(attr_mem.tabu_until);
         return result;
     }
 
@@ -261,8 +480,11 @@ OptResult ts_run(const TSConfig *config,
     memcpy(result.best.data, current, element_size);
     result.best.cost = current_cost;
 
-    TabuList tabu = tabu_list_create(config->tabu_tenure);
-    tabu_list_add(&tabu, hash_fn(current, solution_size));
+    TabuList tabu = {NULL, 0, 0, 0, NULL};
+    if (!by_attributes) {
+        tabu = tabu_list_create(config->tabu_tenure);
+        tabu_list_add(&tabu, hash_fn(current, solution_size));
+    }
 
     FrequencyMemory freq;
     bool use_freq = config->enable_diversification || config->enable_intensification;
@@ -271,22 +493,81 @@ OptResult ts_run(const TSConfig *config,
         freq_increment(&freq, hash_fn(current, solution_size));
     }
 
+    // Por atributos, o hash da solucao so alimenta frequencia e reativo
+    bool need_hash = !by_attributes || use_freq || config->enable_reactive_tenure;
+    // Candidatos so sao materializados para o hash tabu ou a penalidade
+    bool materialize = !by_attributes || config->enable_diversification;
+
     size_t iters_without_improvement = 0;
     size_t current_tenure = config->tabu_tenure;
-    uint64_t prev_hash = hash_fn(current, solution_size);
+    uint64_t prev_hash = need_hash ? hash_fn(current, solution_size) : 0;
+
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
 
     for (size_t iter = 0; iter < config->max_iterations; iter++) {
         double best_cand_cost = (config->direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
+        double best_cand_raw = best_cand_cost;
         bool found_any = false;
         uint64_t best_cand_hash = 0;
+        OptMove best_move = {0, 0, 0, 0};
+        TabuMoveAttributes best_attrs;
+        best_attrs.num_added = 0;
+        best_attrs.num_dropped = 0;
+
+        if (moves) {
+            for (size_t k = 0; k < num_candidates; k++) {
+                MoveCandidate *mc = &move_cands[k];
+                mc->cost = current_cost +
+                           config->move_delta(current, solution_size, &mc->move, context);
+                mc->used = false;
+                result.num_evaluations++;
+            }
+        }
 
-        for (size_t k = 0; k < config->neighbors_per_iter; k++) {
-            neighbor(current, candidate, solution_size, context);
-            double cand_cost = objective(candidate, solution_size, context);
-            result.num_evaluations++;
+        // Sem penalidade de frequencia, o escolhido e o de menor custo
+        // admissivel: materializa (e faz hash de) candidatos em ordem de
+        // custo ate achar um, em vez de todos os neighbors_per_iter
+        bool lazy = moves && !config->enable_diversification;
+
+        for (size_t k = 0; k < num_candidates; k++) {
+            double cand_cost;
+            MoveCandidate *mc = NULL;
+            if (lazy) {
+                for (size_t m = 0; m < num_candidates; m++) {
+                    MoveCandidate *c = &move_cands[m];
+                    if (!c->used &&
+                        (mc == NULL || ts_is_better(c->cost, mc->cost, config->direction))) {
+                        mc = c;
+                    }
+                }
+                mc->used = true;
+            } else if (moves) {
+                mc = &move_cands[k];
+            }
 
-            uint64_t cand_hash = hash_fn(candidate, solution_size);
-            bool is_tabu = tabu_list_contains(&tabu, cand_hash);
+            uint64_t cand_hash = 0;
+            TabuMoveAttributes attrs;
+            bool is_tabu;
+            if (mc != NULL) {
+                cand_cost = mc->cost;
+                if (materialize) {
+                    memcpy(candidate, current, element_size);
+                    config->move_apply(candidate, solution_size, &mc->move, context);
+                }
+            } else {
+                neighbor(current, candidate, solution_size, context);
+                cand_cost = objective(candidate, solution_size, context);
+                result.num_evaluations++;
+            }
+
+            if (by_attributes) {
+                config->move_attributes(current, solution_size, &mc->move, &attrs, context);
+                is_tabu = attr_memory_is_tabu(&attr_mem, &attrs, iter);
+                if (materialize) cand_hash = hash_fn(candidate, solution_size);
+            } else {
+                cand_hash = hash_fn(candidate, solution_size);
+                is_tabu = tabu_list_contains(&tabu, cand_hash);
+            }
 
             bool aspiration = false;
             if (is_tabu && config->enable_aspiration) {
@@ -309,26 +590,47 @@ OptResult ts_run(const TSConfig *config,
 
                 if (!found_any || ts_is_better(eval_cost, best_cand_cost, config->direction)) {
                     best_cand_cost = eval_cost;
-                    memcpy(best_candidate, candidate, element_size);
+                    best_cand_raw = cand_cost;
+                    if (materialize) memcpy(best_candidate, candidate, element_size);
+                    if (by_attributes) {
+                        best_move = mc->move;
+                        best_attrs = attrs;
+                    }
                     best_cand_hash = cand_hash;
                     found_any = true;
                 }
+                if (lazy) break;
             }
         }
 
         if (!found_any) {
-            if (result.convergence != NULL && iter < result.convergence_size) {
-                result.convergence[iter] = result.best.cost;
-            }
+            opt_tracer_record(&tracer, &result, iter, result.best.cost, result.num_evaluations);
             result.num_iterations = iter + 1;
+            if (opt_stop_check(&stop, result.num_evaluations, result.best.cost)) break;
             continue;
         }
 
-        memcpy(current, best_candidate, element_size);
-        current_cost = objective(current, solution_size, context);
-        result.num_evaluations++;
+        if (by_attributes) {
+            // Os atributos referem-se a current antes do movimento
+            attr_memory_mark(&attr_mem, &best_attrs, iter, current_tenure);
+        }
 
-        tabu_list_add(&tabu, best_cand_hash);
+        if (materialize) {
+            memcpy(current, best_candidate, element_size);
+        } else {
+            config->move_apply(current, solution_size, &best_move, context);
+            if (need_hash) best_cand_hash = hash_fn(current, solution_size);
+        }
+        if (moves) {
+            current_cost = best_cand_raw;
+        } else {
+            current_cost = objective(current, solution_size, context);
+            result.num_evaluations++;
+        }
+
+        if (!by_attributes) {
+            tabu_list_add(&tabu, best_cand_hash);
+        }
         if (use_freq) {
             freq_increment(&freq, best_cand_hash);
         }
@@ -354,7 +656,9 @@ OptResult ts_run(const TSConfig *config,
                     current_tenure = config->min_tenure;
                 }
             }
-            tabu_list_resize(&tabu, current_tenure);
+            if (!by_attributes) {
+                tabu_list_resize(&tabu, current_tenure);
+            }
         }
 
         prev_hash = best_cand_hash;
@@ -373,10 +677,9 @@ OptResult ts_run(const TSConfig *config,
             iters_without_improvement = 0;
         }
 
-        if (result.convergence != NULL && iter < result.convergence_size) {
-            result.convergence[iter] = result.best.cost;
-        }
+        opt_tracer_record(&tracer, &result, iter, result.best.cost, result.num_evaluations);
         result.num_iterations = iter + 1;
+        if (opt_stop_check(&stop, result.num_evaluations, result.best.cost)) break;
     }
 
     tabu_list_destroy(&tabu);
@@ -384,8 +687,17 @@ OptResult ts_run(const TSConfig *config,
         freq_destroy(&freq);
     }
 
+    // Custo acumulado por deltas deriva; recalcula o da melhor solucao
+    if (moves && result.best.data != NULL) {
+        result.best.cost = objective(result.best.data, solution_size, context);
+        result.num_evaluations++;
+    }
+
     free(current);
     free(candidate);
     free(best_candidate);
+    free(move_cands);
+    free(attr_mem.tabu_until);
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
@@ -6,6 +6,8 @@
  * - Mladenovic, N. & Hansen, P. (1997). "Variable Neighborhood Search".
  * - Hansen, P. & Mladenovic, N. (2001). "Variable Neighborhood Search:
  *   Principles and Applications".
+ * - Garcia-Lopez, F. et al. (2002). "The Parallel Variable Neighborhood
+ *   Search for the p-Median Problem". J. Heuristics, 8(3).
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
@@ -13,6 +15,8 @@
 
 #include "optimization/metaheuristics/vns.h"
 #include "optimization/benchmarks/continuous.h"
+#include "data_structures/thread_pool.h"
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
@@ -26,17 +30,49 @@ static int is_better(double a, double b, OptDirection dir) {
     return (dir == OPT_MINIMIZE) ? (a < b) : (a > b);
 }
 
+// Melhor de num_neighbors movimentos por delta; aplica se melhorar *cost
+static bool best_move_step(void *solution, size_t solution_size,
+                           const VNSConfig *config, const void *context,
+                           size_t num_neighbors, double *cost, size_t *evaluations) {
+    OptMove best_move = {0, 0, 0, 0};
+    double best_cost = (config->direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
+
+    for (size_t n = 0; n < num_neighbors; n++) {
+        OptMove move;
+        double c = *cost + config->move_delta(solution, solution_size, &move, context);
+        (*evaluations)++;
+        if (is_better(c, best_cost, config->direction)) {
+            best_move = move;
+            best_cost = c;
+        }
+    }
+
+    if (!is_better(best_cost, *cost, config->direction)) return false;
+    config->move_apply(solution, solution_size, &best_move, context);
+    *cost = best_cost;
+    return true;
+}
+
 static void local_search(void *solution, size_t element_size, size_t solution_size,
                          ObjectiveFn objective, NeighborFn neighbor,
-                         const void *context, OptDirection direction,
+                         const VNSConfig *config, const void *context,
                          size_t max_iter, size_t num_neighbors,
-                         double *cost, size_t *evaluations) {
+                         double *cost, size_t *evaluations, OptSolutionPool *pool) {
+    OptDirection direction = config->direction;
+    if (config->move_delta != NULL && config->move_apply != NULL) {
+        for (size_t iter = 0; iter < max_iter; iter++) {
+            if (!best_move_step(solution, solution_size, config, context,
+                                num_neighbors, cost, evaluations)) break;
+        }
+        return;
+    }
+
     size_t data_size = element_size * solution_size;
-    void *candidate = malloc(data_size);
-    void *best_neighbor = malloc(data_size);
+    void *candidate = opt_solution_pool_acquire(pool);
+    void *best_neighbor = opt_solution_pool_acquire(pool);
     if (candidate == NULL || best_neighbor == NULL) {
-        free(candidate);
-        free(best_neighbor);
+        opt_solution_pool_release(pool, candidate);
+        opt_solution_pool_release(pool, best_neighbor);
         return;
     }
 
@@ -64,27 +100,44 @@ static void local_search(void *solution, size_t element_size, size_t solution_si
         if (!improved) break;
     }
 
-    free(candidate);
-    free(best_neighbor);
+    opt_solution_pool_release(pool, candidate);
+    opt_solution_pool_release(pool, best_neighbor);
 }
 
 static void vnd_search(void *solution, size_t element_size, size_t solution_size,
                        ObjectiveFn objective, NeighborFn neighbor,
-                       const void *context, OptDirection direction,
+                       const VNSConfig *config, const void *context,
                        size_t max_iter, size_t num_neighbors,
                        int num_neighborhoods,
-                       double *cost, size_t *evaluations) {
+                       double *cost, size_t *evaluations, OptSolutionPool *pool) {
+    OptDirection direction = config->direction;
+    if (config->move_delta != NULL && config->move_apply != NULL) {
+        for (int l = 1; l <= num_neighborhoods; l++) {
+            int improved_in_neighborhood = 0;
+            for (size_t iter = 0; iter < max_iter; iter++) {
+                if (!best_move_step(solution, solution_size, config, context,
+                                    num_neighbors * (size_t)l, cost, evaluations)) break;
+                improved_in_neighborhood = 1;
+            }
+            if (improved_in_neighborhood) l = 0;
+        }
+        return;
+    }
+
     size_t data_size = element_size * solution_size;
-    void *candidate = malloc(data_size);
-    if (candidate == NULL) return;
+    void *candidate = opt_solution_pool_acquire(pool);
+    void *best_cand = opt_solution_pool_acquire(pool);
+    if (candidate == NULL || best_cand == NULL) {
+        opt_solution_pool_release(pool, candidate);
+        opt_solution_pool_release(pool, best_cand);
+        return;
+    }
 
     for (int l = 1; l <= num_neighborhoods; l++) {
         int improved_in_neighborhood = 0;
 
         for (size_t iter = 0; iter < max_iter; iter++) {
             double best_c = (direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
-            void *best_cand = malloc(data_size);
-            if (best_cand == NULL) break;
 
             size_t neighbors_to_check = num_neighbors * (size_t)l;
             for (size_t n = 0; n < neighbors_to_check; n++) {
@@ -101,9 +154,7 @@ static void vnd_search(void *solution, size_t element_size, size_t solution_size
                 memcpy(solution, best_cand, data_size);
                 *cost = best_c;
                 improved_in_neighborhood = 1;
-                free(best_cand);
             } else {
-                free(best_cand);
                 break;
             }
         }
@@ -113,7 +164,95 @@ static void vnd_search(void *solution, size_t element_size, size_t solution_size
         }
     }
 
-    free(candidate);
+    opt_solution_pool_release(pool, candidate);
+    opt_solution_pool_release(pool, best_cand);
+}
+
+// Problema e configuracao de uma execucao, repassados as replicas
+typedef struct {
+    const VNSConfig *config;
+    size_t element_size;
+    size_t solution_size;
+    ObjectiveFn objective;
+    ShakeFn shake;
+    NeighborFn neighbor;
+    const void *context;
+    bool has_local_search;
+    const void *current;       // solucao incumbente (somente leitura na rodada)
+    int k;                     // vizinhanca da rodada
+} VNSProblem;
+
+// shake(current, k) seguido da busca local da variante em ls_solution
+static double shake_and_search(const VNSProblem *p, const void *current, int k,
+                               void *shaken, void *ls_solution,
+                               size_t *evaluations, OptSolutionPool *pool) {
+    const VNSConfig *config = p->config;
+    p->shake(current, shaken, p->solution_size, k, p->context);
+    double cost = p->objective(shaken, p->solution_size, p->context);
+    (*evaluations)++;
+
+    memcpy(ls_solution, shaken, p->element_size * p->solution_size);
+    if (!p->has_local_search) return cost;
+
+    if (config->variant == VNS_GENERAL) {
+        vnd_search(ls_solution, p->element_size, p->solution_size, p->objective, p->neighbor,
+                   config, p->context,
+                   config->local_search_iterations, config->local_search_neighbors,
+                   config->vnd_num_neighborhoods, &cost, evaluations, pool);
+    } else {
+        local_search(ls_solution, p->element_size, p->solution_size, p->objective, p->neighbor,
+                     config, p->context,
+                     config->local_search_iterations, config->local_search_neighbors,
+                     &cost, evaluations, pool);
+    }
+    return cost;
+}
+
+// Um ponto do replicated shaking, com buffers e rascunho proprios
+typedef struct {
+    void *shaken;
+    void *ls_solution;
+    OptSolutionPool pool;
+    uint64_t seed;
+    double cost;
+    size_t evaluations;
+} VNSReplica;
+
+typedef struct {
+    const VNSProblem *problem;
+    VNSReplica *replicas;
+} VNSReplicaBatch;
+
+// Cada replica semeia o stream da thread com a sua semente (restaurado ao
+// fim): o resultado nao depende de qual thread executa
+static void replica_range(void *ctx, size_t lo, size_t hi) {
+    const VNSReplicaBatch *b = ctx;
+    OptRng *thread_rng = opt_rng_thread();
+    for (size_t i = lo; i < hi; i++) {
+        VNSReplica *r = &b->replicas[i];
+        OptRng saved = *thread_rng;
+        opt_rng_seed(thread_rng, r->seed);
+        r->evaluations = 0;
+        r->cost = shake_and_search(b->problem, b->problem->current, b->problem->k,
+                                   r->shaken, r->ls_solution, &r->evaluations, &r->pool);
+        *thread_rng = saved;
+    }
+}
+
+// VNS reativa: roleta sobre a taxa de sucesso suavizada (melhorias + 1) /
+// (tentativas + 2) de cada k; grava os pesos normalizados em stats
+static int reactive_select_k(OptRng *rng, OptOperatorStats *stats, int k_max) {
+    double total = 0.0;
+    for (int k = 0; k < k_max; k++) {
+        stats[k].weight = ((double)stats[k].improvements + 1.0) / ((double)stats[k].calls + 2.0);
+        total += stats[k].weight;
+    }
+    double r = opt_rng_uniform(rng) * total;
+    for (int k = 0; k < k_max; k++) {
+        r -= stats[k].weight;
+        if (r < 0.0) return k + 1;
+    }
+    return k_max;
 }
 
 // ============================================================================
@@ -163,8 +302,16 @@ VNSConfig vns_default_config(void) {
     config.local_search_neighbors = 20;
     config.variant = VNS_BASIC;
     config.vnd_num_neighborhoods = 3;
+    config.move_delta = NULL;
+    config.move_apply = NULL;
+    config.reactive = false;
+    config.shake_replicas = 1;
+    config.num_threads = 1;
+    config.stop = opt_stop_none();
+    config.trace = opt_trace_default();
     config.direction = OPT_MINIMIZE;
     config.seed = 42;
+    config.rng = NULL;
     return config;
 }
 
@@ -186,108 +333,190 @@ OptResult vns_run(const VNSConfig *config,
         return empty;
     }
 
-    opt_set_seed(config->seed);
+    OptRng *rng = opt_rng_select(config->rng, config->seed);
 
     size_t data_size = element_size * solution_size;
-    OptResult result = opt_result_create(config->max_iterations);
+    OptTracer tracer = opt_tracer_begin(&config->trace, config->direction);
+    OptResult result = opt_tracer_create_result(&tracer, config->max_iterations);
     result.num_iterations = 0;
     result.num_evaluations = 0;
 
-    void *current = malloc(data_size);
-    void *shaken = malloc(data_size);
-    void *ls_solution = malloc(data_size);
-    if (current == NULL || shaken == NULL || ls_solution == NULL) {
+    int k_max = config->k_max > 0 ? config->k_max : 0;
+    size_t num_replicas = config->shake_replicas > 1 ? config->shake_replicas : 1;
+    bool parallel = num_replicas > 1 && ds_resolve_threads(config->num_threads) > 1;
+
+    // current, shaken, ls_solution, best_data + 2 buffers da busca local
+    OptSolutionPool pool = opt_solution_pool_create(data_size, 6);
+    void *current = opt_solution_pool_acquire(&pool);
+    void *shaken = opt_solution_pool_acquire(&pool);
+    void *ls_solution = opt_solution_pool_acquire(&pool);
+    void *best_data = opt_solution_pool_acquire(&pool);
+    VNSReplica *replicas = (num_replicas > 1) ? calloc(num_replicas, sizeof(VNSReplica)) : NULL;
+    result.operator_stats = (k_max > 0) ? calloc((size_t)k_max, sizeof(OptOperatorStats)) : NULL;
+    bool replicas_ok = num_replicas == 1 || replicas != NULL;
+    for (size_t r = 0; replicas != NULL && r < num_replicas; r++) {
+        replicas[r].pool = opt_solution_pool_create(data_size, 4);
+        replicas[r].shaken = opt_solution_pool_acquire(&replicas[r].pool);
+        replicas[r].ls_solution = opt_solution_pool_acquire(&replicas[r].pool);
+        if (replicas[r].shaken == NULL || replicas[r].ls_solution == NULL) replicas_ok = false;
+    }
+    if (current == NULL || shaken == NULL || ls_solution == NULL || best_data == NULL ||
+        !replicas_ok || (k_max > 0 && result.operator_stats == NULL)) {
         free(current);
         free(shaken);
         free(ls_solution);
+        free(best_data);
+        opt_solution_pool_destroy(&pool);
+        for (size_t r = 0; replicas != NULL && r < num_replicas; r++) {
+            free(replicas[r].shaken);
+            free(replicas[r].ls_solution);
+            opt_solution_pool_destroy(&replicas[r].pool);
+        }
+        free(replicas);
+        free(result.operator_stats);
+        result.operator_stats = NULL;
         return result;
     }
 
+    // operator_stats[k - 1]: shakes, novas melhores, melhorias (= aceites),
+    // tempo de shake + busca e peso (probabilidade final na VNS reativa)
+    OptOperatorStats *k_stats = result.operator_stats;
+    result.num_operators = (size_t)k_max;
+    for (int k = 0; k < k_max; k++) k_stats[k].weight = 1.0 / (double)k_max;
+
     generate(current, solution_size, context);
     double current_cost = objective(current, solution_size, context);
     result.num_evaluations++;
 
-    if (config->variant != VNS_REDUCED && neighbor != NULL) {
+    bool moves = config->move_delta != NULL && config->move_apply != NULL;
+    bool has_local_search = config->variant != VNS_REDUCED && (neighbor != NULL || moves);
+
+    if (has_local_search) {
         if (config->variant == VNS_GENERAL) {
             vnd_search(current, element_size, solution_size, objective, neighbor,
-                       context, config->direction,
+                       config, context,
                        config->local_search_iterations, config->local_search_neighbors,
                        config->vnd_num_neighborhoods,
-                       &current_cost, &result.num_evaluations);
+                       &current_cost, &result.num_evaluations, &pool);
         } else {
             local_search(current, element_size, solution_size, objective, neighbor,
-                         context, config->direction,
+                         config, context,
                          config->local_search_iterations, config->local_search_neighbors,
-                         &current_cost, &result.num_evaluations);
+                         &current_cost, &result.num_evaluations, &pool);
         }
     }
 
     double best_cost = current_cost;
-    void *best_data = malloc(data_size);
-    if (best_data == NULL) {
-        free(current);
-        free(shaken);
-        free(ls_solution);
-        return result;
-    }
     memcpy(best_data, current, data_size);
 
+    VNSProblem problem = {
+        .config = config, .element_size = element_size, .solution_size = solution_size,
+        .objective = objective, .shake = shake, .neighbor = neighbor, .context = context,
+        .has_local_search = has_local_search, .current = current, .k = 1
+    };
+    VNSReplicaBatch batch = {&problem, replicas};
+
+    OptStopState stop = opt_stop_begin(&config->stop, config->direction);
+
     for (size_t iter = 0; iter < config->max_iterations; iter++) {
+        // Classica: k = 1..k_max, voltando a 1 a cada melhoria. Reativa: k
+        // sorteado, ate k_max falhas seguidas (o mesmo numero de shakes de
+        // uma varredura sem melhoria)
         int k = 1;
+        int failures = 0;
 
-        while (k <= config->k_max) {
-            shake(current, shaken, solution_size, k, context);
-            double shaken_cost = objective(shaken, solution_size, context);
-            result.num_evaluations++;
+        while (config->reactive ? failures < k_max : k <= k_max) {
+            if (config->reactive) k = reactive_select_k(rng, k_stats, k_max);
 
-            memcpy(ls_solution, shaken, data_size);
-            double ls_cost = shaken_cost;
+            double started = opt_monotonic_time_ms();
+            const void *candidate = ls_solution;
+            double ls_cost;
 
-            if (config->variant != VNS_REDUCED && neighbor != NULL) {
-                if (config->variant == VNS_GENERAL) {
-                    vnd_search(ls_solution, element_size, solution_size, objective, neighbor,
-                               context, config->direction,
-                               config->local_search_iterations, config->local_search_neighbors,
-                               config->vnd_num_neighborhoods,
-                               &ls_cost, &result.num_evaluations);
+            if (replicas == NULL) {
+                ls_cost = shake_and_search(&problem, current, k, shaken, ls_solution,
+                                           &result.num_evaluations, &pool);
+            } else {
+                // Replicated shaking: num_replicas pontos de N_k, fica o melhor
+                problem.k = k;
+                for (size_t r = 0; r < num_replicas; r++) replicas[r].seed = opt_rng_next(rng);
+                if (parallel) {
+                    ds_parallel_for(0, num_replicas, 1, replica_range, &batch);
                 } else {
-                    local_search(ls_solution, element_size, solution_size, objective, neighbor,
-                                 context, config->direction,
-                                 config->local_search_iterations, config->local_search_neighbors,
-                                 &ls_cost, &result.num_evaluations);
+                    replica_range(&batch, 0, num_replicas);
+                }
+
+                size_t chosen = 0;
+                for (size_t r = 0; r < num_replicas; r++) {
+                    result.num_evaluations += replicas[r].evaluations;
+                    if (is_better(replicas[r].cost, replicas[chosen].cost, config->direction)) {
+                        chosen = r;
+                    }
                 }
+                candidate = replicas[chosen].ls_solution;
+                ls_cost = replicas[chosen].cost;
             }
 
+            OptOperatorStats *st = &k_stats[k - 1];
+            st->calls++;
+
             if (is_better(ls_cost, current_cost, config->direction)) {
-                memcpy(current, ls_solution, data_size);
+                memcpy(current, candidate, data_size);
                 current_cost = ls_cost;
+                st->improvements++;
+                st->accepted++;
                 k = 1;
+                failures = 0;
 
                 if (is_better(current_cost, best_cost, config->direction)) {
                     memcpy(best_data, current, data_size);
                     best_cost = current_cost;
+                    st->new_best++;
                 }
             } else {
                 k++;
+                failures++;
             }
+            st->total_time_ms += opt_monotonic_time_ms() - started;
         }
 
         result.num_iterations = iter + 1;
-        if (iter < result.convergence_size) {
-            result.convergence[iter] = best_cost;
+        opt_tracer_record(&tracer, &result, iter, best_cost, result.num_evaluations);
+        if (opt_stop_check(&stop, result.num_evaluations, best_cost)) break;
+    }
+
+    if (config->reactive && k_max > 0) {
+        double total = 0.0;
+        for (int k = 0; k < k_max; k++) {
+            k_stats[k].weight = ((double)k_stats[k].improvements + 1.0) /
+                                ((double)k_stats[k].calls + 2.0);
+            total += k_stats[k].weight;
         }
+        for (int k = 0; k < k_max; k++) k_stats[k].weight /= total;
     }
 
     result.best = opt_solution_create(data_size);
     if (result.best.data != NULL) {
         memcpy(result.best.data, best_data, data_size);
         result.best.cost = best_cost;
+        // Custo acumulado por deltas deriva; recalcula o da melhor solucao
+        if (moves) {
+            result.best.cost = objective(result.best.data, solution_size, context);
+            result.num_evaluations++;
+        }
     }
 
-    free(current);
-    free(shaken);
-    free(ls_solution);
-    free(best_data);
+    opt_solution_pool_release(&pool, current);
+    opt_solution_pool_release(&pool, shaken);
+    opt_solution_pool_release(&pool, ls_solution);
+    opt_solution_pool_release(&pool, best_data);
+    opt_solution_pool_destroy(&pool);
+    for (size_t r = 0; replicas != NULL && r < num_replicas; r++) {
+        opt_solution_pool_release(&replicas[r].pool, replicas[r].shaken);
+        opt_solution_pool_release(&replicas[r].pool, replicas[r].ls_solution);
+        opt_solution_pool_destroy(&replicas[r].pool);
+    }
+    free(replicas);
 
+    opt_tracer_finish(&tracer, &result);
     return result;
 }
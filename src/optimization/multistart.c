@@ -0,0 +1,269 @@
+/**
+ * @file multistart.c
+ * @brief Implementacao do multi-start paralelo
+ *
+ * As execucoes sao tarefas do pool global, uma por execucao (threads
+ * ociosas roubam as pendentes: execucoes de duracao desigual nao travam
+ * as threads). Cada execucao grava o
+ * proprio OptResult num slot do vetor; a reducao (melhor, media, desvio,
+ * time-to-target) e feita depois, serialmente e na ordem dos indices,
+ * entao o resultado nao depende do numero de threads.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "optimization/multistart.h"
+#include "optimization/heuristics/hill_climbing.h"
+#include "optimization/metaheuristics/simulated_annealing.h"
+#include "optimization/metaheuristics/ils.h"
+#include "data_structures/thread_pool.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static bool ms_reaches(double cost, double target, OptDirection dir) {
+    return (dir == OPT_MINIMIZE) ? (cost <= target) : (cost >= target);
+}
+
+static bool ms_is_better(double a, double b, OptDirection dir) {
+    return (dir == OPT_MINIMIZE) ? (a < b) : (a > b);
+}
+
+// Tempo ate o alvo estimado pela primeira iteracao que o atinge na curva
+// de convergencia (iteracoes de duracao uniforme); -1 se nao atingiu
+static double time_to_target(const OptResult *r, double target, OptDirection dir) {
+    if (r->best.data == NULL || !ms_reaches(r->best.cost, target, dir)) return -1.0;
+
+    size_t iters = r->num_iterations;
+    if (r->convergence == NULL || iters == 0) return r->elapsed_time_ms;
+
+    // Historico amostrado (OPT_TRACE_RING): cada amostra traz sua iteracao
+    if (r->convergence_iterations != NULL) {
+        for (size_t k = 0; k < r->convergence_size; k++) {
+            if (ms_reaches(r->convergence[k], target, dir)) {
+                size_t t = r->convergence_iterations[k];
+                if (t >= r->num_iterations) return r->elapsed_time_ms;
+                return r->elapsed_time_ms * (double)(t + 1) / (double)r->num_iterations;
+            }
+        }
+        return r->elapsed_time_ms;
+    }
+
+    if (iters > r->convergence_size) iters = r->convergence_size;
+    for (size_t t = 0; t < iters; t++) {
+        if (ms_reaches(r->convergence[t], target, dir)) {
+            return r->elapsed_time_ms * (double)(t + 1) / (double)iters;
+        }
+    }
+    return r->elapsed_time_ms;
+}
+
+// ============================================================================
+// CONFIGURACAO
+// ============================================================================
+
+OptMultiStartConfig opt_multistart_default_config(void) {
+    OptMultiStartConfig config;
+    config.num_runs = 8;
+    config.num_threads = 0;
+    config.base_seed = 42;
+    config.direction = OPT_MINIMIZE;
+    config.use_target = false;
+    config.target_cost = 0.0;
+    return config;
+}
+
+// ============================================================================
+// DRIVER
+// ============================================================================
+
+typedef struct {
+    OptResult *results;
+    unsigned base_seed;
+    OptRunFn run;
+    const void *user_data;
+} MultiStartJob;
+
+static void multistart_range(void *ctx, size_t lo, size_t hi) {
+    const MultiStartJob *job = ctx;
+    for (size_t i = lo; i < hi; i++) {
+        double t0 = opt_wall_time_ms();
+        job->results[i] = job->run(job->base_seed + (unsigned)i, job->user_data);
+        job->results[i].elapsed_time_ms = opt_wall_time_ms() - t0;
+    }
+}
+
+OptMultiStartResult opt_parallel_multistart(const OptMultiStartConfig *config,
+                                            OptRunFn run, const void *user_data) {
+    OptMultiStartResult ms;
+    memset(&ms, 0, sizeof(OptMultiStartResult));
+    if (config == NULL || run == NULL || config->num_runs == 0) return ms;
+
+    size_t n = config->num_runs;
+    OptResult *results = (OptResult*)calloc(n, sizeof(OptResult));
+    ms.run_costs = (double*)malloc(n * sizeof(double));
+    ms.run_times_ms = (double*)malloc(n * sizeof(double));
+    if (config->use_target) {
+        ms.run_time_to_target_ms = (double*)malloc(n * sizeof(double));
+    }
+    if (results == NULL || ms.run_costs == NULL || ms.run_times_ms == NULL ||
+        (config->use_target && ms.run_time_to_target_ms == NULL)) {
+        free(results);
+        opt_multistart_result_destroy(&ms);
+        return ms;
+    }
+
+    MultiStartJob job = { results, config->base_seed, run, user_data };
+    double start = opt_wall_time_ms();
+    ds_parallel_for_threads(config->num_threads, 0, n, 1, multistart_range, &job);
+
+    ms.elapsed_time_ms = opt_wall_time_ms() - start;
+
+    // Reducao serial na ordem dos indices
+    size_t valid = 0;
+    size_t best = n;
+    double sum = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        OptResult *r = &results[i];
+        ms.run_times_ms[i] = r->elapsed_time_ms;
+        ms.total_evaluations += r->num_evaluations;
+        if (config->use_target) {
+            ms.run_time_to_target_ms[i] = time_to_target(r, config->target_cost,
+                                                         config->direction);
+            if (ms.run_time_to_target_ms[i] >= 0.0) {
+                ms.target_hits++;
+                ms.mean_time_to_target_ms += ms.run_time_to_target_ms[i];
+            }
+        }
+
+        if (r->best.data == NULL) {
+            ms.run_costs[i] = NAN;
+            continue;
+        }
+        ms.run_costs[i] = r->best.cost;
+        sum += r->best.cost;
+        if (valid == 0 || ms_is_better(ms.worst_cost, r->best.cost, config->direction)) {
+            ms.worst_cost = r->best.cost;
+        }
+        if (best == n || ms_is_better(r->best.cost, results[best].best.cost, config->direction)) {
+            best = i;
+        }
+        valid++;
+    }
+
+    if (valid > 0) {
+        ms.mean_cost = sum / (double)valid;
+        double sq = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            if (results[i].best.data == NULL) continue;
+            double d = results[i].best.cost - ms.mean_cost;
+            sq += d * d;
+        }
+        ms.std_cost = (valid > 1) ? sqrt(sq / (double)(valid - 1)) : 0.0;
+    }
+    if (ms.target_hits > 0) {
+        ms.mean_time_to_target_ms /= (double)ms.target_hits;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        if (i == best) continue;
+        opt_result_destroy(&results[i]);
+    }
+    if (best < n) {
+        ms.best = results[best];
+        ms.best_run = best;
+    }
+    ms.num_runs = n;
+    free(results);
+    return ms;
+}
+
+void opt_multistart_result_destroy(OptMultiStartResult *result) {
+    if (result == NULL) return;
+    opt_result_destroy(&result->best);
+    free(result->run_costs);
+    free(result->run_times_ms);
+    free(result->run_time_to_target_ms);
+    result->run_costs = NULL;
+    result->run_times_ms = NULL;
+    result->run_time_to_target_ms = NULL;
+    result->num_runs = 0;
+}
+
+// ============================================================================
+// ADAPTADORES
+// ============================================================================
+
+OptResult opt_run_hc_restart(unsigned seed, const void *spec) {
+    const OptRunSpec *s = (const OptRunSpec*)spec;
+    HCConfig config = *(const HCConfig*)s->config;
+    config.seed = seed;
+    config.rng = NULL;
+    return hc_random_restart(&config, s->element_size, s->solution_size,
+                             s->objective, s->neighbor, s->generate, s->context);
+}
+
+OptResult opt_run_sa(unsigned seed, const void *spec) {
+    const OptRunSpec *s = (const OptRunSpec*)spec;
+    SAConfig config = *(const SAConfig*)s->config;
+    config.seed = seed;
+    config.rng = NULL;
+    if (s->stop != NULL) config.stop = *s->stop;
+    return sa_run(&config, s->element_size, s->solution_size,
+                  s->objective, s->neighbor, s->generate, s->context);
+}
+
+OptResult opt_run_ils(unsigned seed, const void *spec) {
+    const OptRunSpec *s = (const OptRunSpec*)spec;
+    ILSConfig config = *(const ILSConfig*)s->config;
+    config.seed = seed;
+    config.rng = NULL;
+    if (s->stop != NULL) config.stop = *s->stop;
+    return ils_run(&config, s->element_size, s->solution_size,
+                   s->objective, s->neighbor, s->perturb, s->generate, s->context);
+}
+
+OptResult opt_run_grasp(unsigned seed, const void *spec) {
+    const OptRunSpec *s = (const OptRunSpec*)spec;
+    GRASPConfig config = *(const GRASPConfig*)s->config;
+    config.seed = seed;
+    config.rng = NULL;
+    if (s->stop != NULL) config.stop = *s->stop;
+    return grasp_run(&config, s->element_size, s->solution_size,
+                     s->objective, s->construct, s->neighbor, s->context);
+}
+
+OptResult opt_run_vns(unsigned seed, const void *spec) {
+    const OptRunSpec *s = (const OptRunSpec*)spec;
+    VNSConfig config = *(const VNSConfig*)s->config;
+    config.seed = seed;
+    config.rng = NULL;
+    if (s->stop != NULL) config.stop = *s->stop;
+    return vns_run(&config, s->element_size, s->solution_size,
+                   s->objective, s->shake, s->neighbor, s->generate, s->context);
+}
+
+OptResult opt_run_ts(unsigned seed, const void *spec) {
+    const OptRunSpec *s = (const OptRunSpec*)spec;
+    TSConfig config = *(const TSConfig*)s->config;
+    config.seed = seed;
+    config.rng = NULL;
+    if (s->stop != NULL) config.stop = *s->stop;
+    return ts_run(&config, s->element_size, s->solution_size,
+                  s->objective, s->neighbor, s->generate, s->hash_fn, s->context);
+}
+
+OptResult opt_run_alns(unsigned seed, const void *spec) {
+    const OptRunSpec *s = (const OptRunSpec*)spec;
+    LNSConfig config = *(const LNSConfig*)s->config;
+    config.seed = seed;
+    config.rng = NULL;
+    if (s->stop != NULL) config.stop = *s->stop;
+    return alns_run(&config, s->element_size, s->solution_size, s->objective,
+                    s->generate, s->destroy_ops, s->repair_ops, s->context);
+}
@@ -0,0 +1,400 @@
+/**
+ * @file portfolio.c
+ * @brief Implementacao do portfolio com corrida entre meta-heuristicas
+ *
+ * Cada rodada monta um vetor de tarefas (braco vivo x replica), roda-o no
+ * pool e reduz os resultados serialmente, na ordem das tarefas; a melhor
+ * execucao vira o resultado e as demais sao liberadas na hora. Os custos
+ * de cada bloco (replica) ficam numa matriz blocos x bracos, usada pelo
+ * teste de Friedman do F-race sobre todos os blocos ja corridos.
+ *
+ * Os quantis do teste usam aproximacoes fechadas: normal por Acklam,
+ * qui-quadrado por Wilson-Hilferty e t de Student pela expansao de
+ * Cornish-Fisher (Abramowitz & Stegun 26.7.5), com erro desprezivel para
+ * a decisao de eliminar.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "optimization/portfolio.h"
+#include "data_structures/thread_pool.h"
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    OptRunFn run;
+    OptRunSpec spec;              // copia do spec do braco com stop da rodada
+    OptStopCriteria stop;
+    unsigned seed;
+    size_t arm;
+    size_t block;
+    OptResult result;
+    double time_ms;
+} PortfolioTask;
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+// Custo orientado: menor e melhor nas duas direcoes; execucao sem solucao
+// conta como a pior possivel
+static double oriented_cost(const OptResult *r, OptDirection dir) {
+    if (r->best.data == NULL) return DBL_MAX;
+    return (dir == OPT_MINIMIZE) ? r->best.cost : -r->best.cost;
+}
+
+static void task_range(void *ctx, size_t lo, size_t hi) {
+    PortfolioTask *tasks = ctx;
+    for (size_t i = lo; i < hi; i++) {
+        double start = opt_monotonic_time_ms();
+        tasks[i].result = tasks[i].run(tasks[i].seed, &tasks[i].spec);
+        tasks[i].time_ms = opt_monotonic_time_ms() - start;
+    }
+}
+
+// Rodadas automaticas: eliminar ate sobrar um braco e mais uma rodada com ele
+static size_t auto_rounds(size_t num_arms, double eta) {
+    size_t rounds = 1;
+    size_t n = num_arms;
+    while (n > 1) {
+        size_t next = (size_t)ceil((double)n / eta);
+        n = (next < n) ? next : n - 1;
+        rounds++;
+    }
+    return rounds;
+}
+
+// ============================================================================
+// QUANTIS
+// ============================================================================
+
+// Quantil da normal padrao (Acklam 2003, erro relativo ~1e-9)
+static double normal_quantile(double p) {
+    static const double a[6] = {-3.969683028665376e+01, 2.209460984245205e+02,
+                                -2.759285104469687e+02, 1.383577518672690e+02,
+                                -3.066479806614716e+01, 2.506628277459239e+00};
+    static const double b[5] = {-5.447609879822406e+01, 1.615858368580409e+02,
+                                -1.556989798598866e+02, 6.680131188771972e+01,
+                                -1.328068155288572e+01};
+    static const double c[6] = {-7.784894002430293e-03, -3.223964580411365e-01,
+                                -2.400758277161838e+00, -2.549732539343734e+00,
+                                4.374664141464968e+00, 2.938163982698783e+00};
+    static const double d[4] = {7.784695709041462e-03, 3.224671290700398e-01,
+                                2.445134137142996e+00, 3.754408661907416e+00};
+    const double p_low = 0.02425;
+
+    if (p <= 0.0) return -DBL_MAX;
+    if (p >= 1.0) return DBL_MAX;
+    if (p < p_low || p > 1.0 - p_low) {
+        double q = sqrt(-2.0 * log(p < p_low ? p : 1.0 - p));
+        double x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) /
+                   ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1.0);
+        return (p < p_low) ? x : -x;
+    }
+    double q = p - 0.5;
+    double r = q * q;
+    return (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q /
+           (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1.0);
+}
+
+// Quantil da qui-quadrado com df graus (Wilson-Hilferty)
+static double chi2_quantile(double p, double df) {
+    double z = normal_quantile(p);
+    double h = 2.0 / (9.0 * df);
+    double x = 1.0 - h + z * sqrt(h);
+    return df * x * x * x;
+}
+
+// Quantil da t de Student com df graus (Cornish-Fisher ate 1/df^3)
+static double t_quantile(double p, double df) {
+    double z = normal_quantile(p);
+    double z2 = z * z;
+    double g1 = (z2 + 1.0) * z / 4.0;
+    double g2 = ((5.0 * z2 + 16.0) * z2 + 3.0) * z / 96.0;
+    double g3 = (((3.0 * z2 + 19.0) * z2 + 17.0) * z2 - 15.0) * z / 384.0;
+    return z + g1 / df + g2 / (df * df) + g3 / (df * df * df);
+}
+
+// ============================================================================
+// ELIMINACAO
+// ============================================================================
+
+// Successive halving: mantem os ceil(n / eta) de menor custo medio na
+// rodada (empate: menor indice). candidates e alive em ordem de indice
+static size_t eliminate_halving(const size_t *candidates, size_t num_alive, size_t *alive,
+                                const double *round_mean, double eta) {
+    size_t keep = (size_t)ceil((double)num_alive / eta);
+    if (keep >= num_alive) keep = num_alive - 1;
+    if (keep == 0) keep = 1;
+
+    size_t kept = 0;
+    for (size_t i = 0; i < num_alive; i++) {
+        size_t a = candidates[i];
+        size_t better = 0;
+        for (size_t j = 0; j < num_alive; j++) {
+            size_t b = candidates[j];
+            if (round_mean[b] < round_mean[a] || (round_mean[b] == round_mean[a] && b < a)) {
+                better++;
+            }
+        }
+        if (better < keep) alive[kept++] = a;
+    }
+    return kept;
+}
+
+// F-race: Friedman sobre os blocos [0, num_blocks) restritos aos vivos; se
+// significativo, remove quem fica alem do limiar de Conover contra o melhor
+static size_t eliminate_frace(size_t *alive, size_t num_alive, const double *costs,
+                              size_t num_arms, size_t num_blocks, double alpha,
+                              double *rank_sum) {
+    if (num_alive < 2 || num_blocks < 2) return num_alive;
+
+    double k = (double)num_alive;
+    double blocks = (double)num_blocks;
+    double sum_sq_ranks = 0.0;
+    for (size_t i = 0; i < num_alive; i++) rank_sum[i] = 0.0;
+
+    // Postos por bloco com empates na media
+    for (size_t bl = 0; bl < num_blocks; bl++) {
+        const double *row = costs + bl * num_arms;
+        for (size_t i = 0; i < num_alive; i++) {
+            double ci = row[alive[i]];
+            double less = 0.0, ties = 0.0;
+            for (size_t j = 0; j < num_alive; j++) {
+                double cj = row[alive[j]];
+                if (cj < ci) less += 1.0;
+                else if (cj == ci && j != i) ties += 1.0;
+            }
+            double rank = 1.0 + less + 0.5 * ties;
+            rank_sum[i] += rank;
+            sum_sq_ranks += rank * rank;
+        }
+    }
+
+    double c1 = blocks * k * (k + 1.0) * (k + 1.0) / 4.0;
+    double spread = sum_sq_ranks - c1;
+    if (spread <= 1e-12) return num_alive;      // todos empatados em todo bloco
+
+    double dev = 0.0;
+    for (size_t i = 0; i < num_alive; i++) {
+        double d = rank_sum[i] - blocks * (k + 1.0) / 2.0;
+        dev += d * d;
+    }
+    double statistic = (k - 1.0) * dev / spread;
+    if (statistic <= chi2_quantile(1.0 - alpha, k - 1.0)) return num_alive;
+
+    double best_rank = rank_sum[0];
+    for (size_t i = 1; i < num_alive; i++) {
+        if (rank_sum[i] < best_rank) best_rank = rank_sum[i];
+    }
+    double df = (blocks - 1.0) * (k - 1.0);
+    double agreement = 1.0 - statistic / (blocks * (k - 1.0));
+    if (agreement < 0.0) agreement = 0.0;
+    double threshold = t_quantile(1.0 - alpha / 2.0, df) *
+                       sqrt(2.0 * blocks * spread * agreement / df);
+
+    size_t kept = 0;
+    for (size_t i = 0; i < num_alive; i++) {
+        if (rank_sum[i] - best_rank <= threshold) alive[kept++] = alive[i];
+    }
+    return kept;
+}
+
+// ============================================================================
+// CONFIGURACAO
+// ============================================================================
+
+OptPortfolioConfig opt_portfolio_default_config(void) {
+    OptPortfolioConfig config;
+    config.rule = OPT_RACE_SUCCESSIVE_HALVING;
+    config.num_threads = 0;
+    config.min_replicas = 2;
+    config.round_evaluations = 1000;
+    config.time_limit_ms = 0.0;
+    config.eta = 2.0;
+    config.max_rounds = 0;
+    config.frace_alpha = 0.05;
+    config.base_seed = 42;
+    config.direction = OPT_MINIMIZE;
+    return config;
+}
+
+// ============================================================================
+// DRIVER
+// ============================================================================
+
+OptPortfolioResult opt_portfolio_run(const OptPortfolioConfig *config,
+                                     const OptPortfolioArm *arms, size_t num_arms) {
+    OptPortfolioResult result;
+    memset(&result, 0, sizeof(result));
+    if (config == NULL || arms == NULL || num_arms == 0 || !(config->eta > 1.0)) {
+        return result;
+    }
+    for (size_t a = 0; a < num_arms; a++) {
+        if (arms[a].run == NULL || arms[a].spec == NULL) return result;
+    }
+
+    double start = opt_monotonic_time_ms();
+    size_t cores = ds_resolve_threads(config->num_threads);
+    size_t min_replicas = config->min_replicas > 0 ? config->min_replicas : 1;
+    size_t max_replicas = cores > min_replicas ? cores : min_replicas;
+    size_t num_rounds = config->max_rounds > 0 ? config->max_rounds
+                                               : auto_rounds(num_arms, config->eta);
+    size_t max_blocks = num_rounds * max_replicas;
+    bool budgeted = config->round_evaluations > 0 || config->time_limit_ms > 0.0;
+
+    OptPortfolioArmStats *stats = calloc(num_arms, sizeof(OptPortfolioArmStats));
+    size_t *alive = malloc(num_arms * sizeof(size_t));
+    size_t *previous = malloc(num_arms * sizeof(size_t));
+    double *round_mean = malloc(num_arms * sizeof(double));
+    double *rank_sum = malloc(num_arms * sizeof(double));
+    double *costs = malloc(max_blocks * num_arms * sizeof(double));
+    PortfolioTask *tasks = malloc(num_arms * max_replicas * sizeof(PortfolioTask));
+    if (stats == NULL || alive == NULL || previous == NULL || round_mean == NULL ||
+        rank_sum == NULL || costs == NULL || tasks == NULL) {
+        free(stats);
+        free(alive);
+        free(previous);
+        free(round_mean);
+        free(rank_sum);
+        free(costs);
+        free(tasks);
+        return result;
+    }
+
+    for (size_t a = 0; a < num_arms; a++) {
+        alive[a] = a;
+        stats[a].best_cost = (config->direction == OPT_MINIMIZE) ? DBL_MAX : -DBL_MAX;
+    }
+    size_t num_alive = num_arms;
+    size_t num_blocks = 0;
+    double best_oriented = DBL_MAX;
+    bool have_best = false;
+
+    for (size_t round = 0; round < num_rounds; round++) {
+        double remaining_ms = 0.0;
+        if (config->time_limit_ms > 0.0) {
+            remaining_ms = config->time_limit_ms - (opt_monotonic_time_ms() - start);
+            if (remaining_ms <= 0.0) break;
+        }
+
+        // Nucleos liberados pelos eliminados viram replicas dos vivos
+        size_t replicas = cores / num_alive;
+        if (replicas < min_replicas) replicas = min_replicas;
+        size_t num_tasks = num_alive * replicas;
+
+        OptStopCriteria budget = opt_stop_none();
+        if (config->round_evaluations > 0) {
+            double evals = (double)config->round_evaluations * pow(config->eta, (double)round);
+            budget.max_evaluations = evals < (double)SIZE_MAX ? (size_t)evals : SIZE_MAX;
+        }
+        if (config->time_limit_ms > 0.0) {
+            size_t waves = (num_tasks + cores - 1) / cores;
+            budget.time_limit_ms = remaining_ms / (double)(num_rounds - round) / (double)waves;
+        }
+
+        for (size_t i = 0; i < num_alive; i++) {
+            const OptPortfolioArm *arm = &arms[alive[i]];
+            for (size_t j = 0; j < replicas; j++) {
+                PortfolioTask *t = &tasks[i * replicas + j];
+                t->run = arm->run;
+                t->spec = *arm->spec;
+                t->stop = (arm->spec->stop != NULL) ? *arm->spec->stop : opt_stop_none();
+                if (budget.max_evaluations > 0) t->stop.max_evaluations = budget.max_evaluations;
+                if (budget.time_limit_ms > 0.0) t->stop.time_limit_ms = budget.time_limit_ms;
+                if (budgeted) t->spec.stop = &t->stop;
+                t->seed = config->base_seed + (unsigned)(num_blocks + j);
+                t->arm = alive[i];
+                t->block = num_blocks + j;
+            }
+        }
+
+        if (cores > 1 && num_tasks > 1) {
+            ds_parallel_for(0, num_tasks, 1, task_range, tasks);
+        } else {
+            task_range(tasks, 0, num_tasks);
+        }
+
+        // Reducao serial na ordem das tarefas
+        for (size_t i = 0; i < num_alive; i++) round_mean[alive[i]] = 0.0;
+        for (size_t i = 0; i < num_tasks; i++) {
+            PortfolioTask *t = &tasks[i];
+            OptPortfolioArmStats *st = &stats[t->arm];
+            double oc = oriented_cost(&t->result, config->direction);
+            costs[t->block * num_arms + t->arm] = oc;
+            round_mean[t->arm] += oc / (double)replicas;
+
+            if (t->result.best.data != NULL) {
+                double cost = t->result.best.cost;
+                st->mean_cost += cost;
+                if (oc < ((config->direction == OPT_MINIMIZE) ? st->best_cost : -st->best_cost)) {
+                    st->best_cost = cost;
+                }
+            }
+            st->runs++;
+            st->evaluations += t->result.num_evaluations;
+            st->time_ms += t->time_ms;
+            result.total_evaluations += t->result.num_evaluations;
+
+            if (t->result.best.data != NULL && (!have_best || oc < best_oriented)) {
+                if (have_best) opt_result_destroy(&result.best);
+                result.best = t->result;
+                result.best_arm = t->arm;
+                best_oriented = oc;
+                have_best = true;
+            } else {
+                opt_result_destroy(&t->result);
+            }
+        }
+        for (size_t i = 0; i < num_alive; i++) {
+            OptPortfolioArmStats *st = &stats[alive[i]];
+            st->rounds++;
+            double m = round_mean[alive[i]];
+            st->last_round_mean = (config->direction == OPT_MINIMIZE) ? m : -m;
+        }
+        num_blocks += replicas;
+        result.num_rounds = round + 1;
+
+        // Elimina para a proxima rodada (a ultima nao elimina)
+        if (round + 1 == num_rounds || num_alive == 1) continue;
+        size_t before = num_alive;
+        memcpy(previous, alive, num_alive * sizeof(size_t));
+        if (config->rule == OPT_RACE_FRACE) {
+            num_alive = eliminate_frace(alive, num_alive, costs, num_arms, num_blocks,
+                                        config->frace_alpha, rank_sum);
+        } else {
+            num_alive = eliminate_halving(previous, num_alive, alive, round_mean, config->eta);
+        }
+        for (size_t i = 0, k = 0; i < before; i++) {
+            if (k < num_alive && alive[k] == previous[i]) k++;
+            else stats[previous[i]].eliminated_round = round + 1;
+        }
+    }
+
+    for (size_t a = 0; a < num_arms; a++) {
+        if (stats[a].runs > 0) stats[a].mean_cost /= (double)stats[a].runs;
+    }
+    result.arms = stats;
+    result.num_arms = num_arms;
+    result.survivors = num_alive;
+    result.elapsed_time_ms = opt_monotonic_time_ms() - start;
+
+    free(alive);
+    free(previous);
+    free(round_mean);
+    free(rank_sum);
+    free(costs);
+    free(tasks);
+    return result;
+}
+
+void opt_portfolio_result_destroy(OptPortfolioResult *result) {
+    if (result == NULL) return;
+    opt_result_destroy(&result->best);
+    free(result->arms);
+    result->arms = NULL;
+    result->num_arms = 0;
+}
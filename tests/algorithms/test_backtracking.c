@@ -9,6 +9,7 @@
 #include "algorithms/backtracking.h"
 #include "../test_macros.h"
 
+#include <stdatomic.h>
 #include <string.h>
 
 // ============================================================================
@@ -45,6 +46,17 @@ TEST(nqueens_solve_4) {
     nqueens_result_destroy(&r);
 }
 
+TEST(nqueens_bitboard_matches_classic) {
+    for (size_t n = 0; n <= 10; n++) {
+        ASSERT_EQ(nqueens_count_bitboard(n, 1), (uint64_t)nqueens_count(n));
+    }
+    // OEIS A000170
+    ASSERT_EQ(nqueens_count_bitboard(12, 1), 14200);
+    ASSERT_EQ(nqueens_count_bitboard(13, 4), 73712);
+    ASSERT_EQ(nqueens_count_bitboard(14, 0), 365596);
+    ASSERT_EQ(nqueens_count_bitboard(NQUEENS_BITBOARD_MAX + 1, 1), 0);
+}
+
 TEST(nqueens_2_3_impossible) {
     ASSERT_EQ(nqueens_count(2), 0);
     ASSERT_EQ(nqueens_count(3), 0);
@@ -90,6 +102,78 @@ TEST(subset_sum_single) {
     ASSERT_FALSE(subset_sum_exists(set, 1, 3));
 }
 
+TEST(subset_sum_mitm_and_bitset_match) {
+    unsigned state = 60u;
+    int set[18];
+    int64_t wide[18];
+    bool included[18];
+    for (int trial = 0; trial < 200; trial++) {
+        size_t n = (size_t)(trial % 18) + 1;
+        for (size_t i = 0; i < n; i++) {
+            state = state * 1103515245u + 12345u;
+            set[i] = (int)((state >> 16) % 50) + 1;
+            wide[i] = set[i];
+        }
+        state = state * 1103515245u + 12345u;
+        int target = (int)((state >> 16) % 300);
+        bool expected = subset_sum_exists(set, n, target);
+        ASSERT_EQ(subset_sum_exists_bitset(set, n, target), expected);
+        ASSERT_EQ(subset_sum_exists_mitm(wide, n, target, included), expected);
+        if (expected) {
+            int64_t sum = 0;
+            for (size_t i = 0; i < n; i++) sum += included[i] ? wide[i] : 0;
+            ASSERT_EQ(sum, target);
+        }
+    }
+    ASSERT_TRUE(subset_sum_exists_bitset(set, 3, 0));
+    ASSERT_FALSE(subset_sum_exists_bitset(set, 3, -1));
+    int negative[] = {5, -2};
+    ASSERT_FALSE(subset_sum_exists_bitset(negative, 2, 3));
+}
+
+TEST(subset_sum_mitm_large) {
+    // n = 40 com valores da ordem de 10^15 e subconjunto plantado
+    int64_t set[40];
+    bool included[40];
+    uint64_t x = 0x9E3779B97F4A7C15ull;
+    int64_t target = 0;
+    for (size_t i = 0; i < 40; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        set[i] = (int64_t)(x % 1000000000000000ull) - 300000000000000ll;
+        if (i % 3 == 0) target += set[i];
+    }
+    ASSERT_TRUE(subset_sum_exists_mitm(set, 40, target, included));
+    int64_t sum = 0;
+    for (size_t i = 0; i < 40; i++) sum += included[i] ? set[i] : 0;
+    ASSERT_EQ(sum, target);
+    ASSERT_FALSE(subset_sum_exists_mitm(set, 40, 1000000000000000000ll, NULL));
+
+    // Soma de |set| acima de int64_t e n acima do limite
+    int64_t huge[2] = {INT64_MAX, 1};
+    ASSERT_FALSE(subset_sum_exists_mitm(huge, 2, 1, NULL));
+    ASSERT_FALSE(subset_sum_exists_mitm(set, SUBSET_SUM_MITM_MAX + 1, 0, NULL));
+    ASSERT_TRUE(subset_sum_exists_mitm(NULL, 0, 0, NULL));
+}
+
+TEST(subset_sum_bitset_large_target) {
+    // Confere contra DP booleana em alvos que cruzam varias palavras
+    static bool reach[20001];
+    int set[120];
+    unsigned state = 7u;
+    for (size_t i = 0; i < 120; i++) {
+        state = state * 1103515245u + 12345u;
+        set[i] = (int)((state >> 16) % 700) * 3 + 64;   // so multiplos de 3 mais 64
+    }
+    memset(reach, 0, sizeof(reach));
+    reach[0] = true;
+    for (size_t i = 0; i < 120; i++) {
+        for (int s = 20000; s >= set[i]; s--) reach[s] = reach[s] || reach[s - set[i]];
+    }
+    for (int target = 0; target <= 20000; target += 37) {
+        ASSERT_EQ(subset_sum_exists_bitset(set, 120, target), reach[target]);
+    }
+}
+
 // ============================================================================
 // PERMUTATIONS
 // ============================================================================
@@ -134,6 +218,75 @@ TEST(permutations_unique) {
     permutation_result_destroy(&r);
 }
 
+TEST(permutation_iterator_matches_rank_order) {
+    int arr[] = {10, 20, 30, 40, 50};
+    int out[5], perm[5];
+    PermutationIterator it;
+    ASSERT_TRUE(permutation_iterator_init(&it, arr, 5, 0, UINT64_MAX));
+    uint64_t r = 0;
+    while (permutation_iterator_next(&it, out)) {
+        ASSERT_TRUE(permutation_unrank(r, 5, perm));
+        ASSERT_EQ(permutation_rank(perm, 5), r);
+        for (size_t i = 0; i < 5; i++) ASSERT_EQ(out[i], arr[perm[i]]);
+        r++;
+    }
+    ASSERT_EQ(r, 120);
+    ASSERT_FALSE(permutation_iterator_next(&it, out));
+
+    // Intervalo no meio e limite alem de n!
+    ASSERT_TRUE(permutation_iterator_init(&it, arr, 5, 100, 1000));
+    size_t count = 0;
+    while (permutation_iterator_next(&it, out)) count++;
+    ASSERT_EQ(count, 20);
+    ASSERT_FALSE(permutation_iterator_init(&it, arr, PERMUTATION_MAX_N + 1, 0, 1));
+}
+
+TEST(permutation_rank_unrank_edges) {
+    int perm[PERMUTATION_MAX_N];
+    ASSERT_TRUE(permutation_unrank(2432902008176639999ull, 20, perm));   // 20! - 1
+    for (int i = 0; i < 20; i++) ASSERT_EQ(perm[i], 19 - i);
+    ASSERT_EQ(permutation_rank(perm, 20), 2432902008176639999ull);
+    ASSERT_FALSE(permutation_unrank(2432902008176640000ull, 20, perm));
+    int dup[] = {0, 1, 1};
+    ASSERT_EQ(permutation_rank(dup, 3), UINT64_MAX);
+    int out_of_range[] = {0, 3, 1};
+    ASSERT_EQ(permutation_rank(out_of_range, 3), UINT64_MAX);
+}
+
+typedef struct {
+    _Atomic uint64_t count;
+    _Atomic uint64_t checksum;
+    uint64_t limit;
+} PermVisitStats;
+
+static bool perm_visit(const int *perm, size_t n, void *user_data) {
+    PermVisitStats *stats = user_data;
+    uint64_t h = 0;
+    for (size_t i = 0; i < n; i++) h = h * 31 + (uint64_t)perm[i];
+    uint64_t seen = atomic_fetch_add(&stats->count, 1) + 1;
+    atomic_fetch_add(&stats->checksum, h);
+    return stats->limit == 0 || seen < stats->limit;
+}
+
+TEST(permutations_for_each_serial_and_parallel) {
+    int arr[] = {3, 1, 4, 1, 5, 9, 2, 6};
+    PermutationResult all = permutations_generate(arr, 8);
+    PermVisitStats expected = { 0, 0, 0 };
+    for (size_t i = 0; i < all.count; i++) perm_visit(all.perms[i], 8, &expected);
+    permutation_result_destroy(&all);
+
+    for (size_t threads = 1; threads <= 4; threads += 3) {
+        PermVisitStats stats = { 0, 0, 0 };
+        ASSERT_TRUE(permutations_for_each(arr, 8, perm_visit, &stats, threads));
+        ASSERT_EQ(stats.count, 40320);
+        ASSERT_EQ(stats.checksum, expected.checksum);
+
+        PermVisitStats limited = { 0, 0, 100 };
+        ASSERT_FALSE(permutations_for_each(arr, 8, perm_visit, &limited, threads));
+        ASSERT_TRUE(limited.count >= 100 && limited.count < 40320);
+    }
+}
+
 // ============================================================================
 // GRAPH COLORING
 // ============================================================================
@@ -200,6 +353,131 @@ TEST(graph_coloring_petersen) {
     graph_coloring_result_destroy(&r);
 }
 
+static bool coloring_is_valid(const int *adj, size_t n, const int *colors, int m) {
+    for (size_t i = 0; i < n; i++) {
+        if (colors[i] < 1 || colors[i] > m) return false;
+        for (size_t j = 0; j < n; j++) {
+            if (i != j && adj[i * n + j] && colors[i] == colors[j]) return false;
+        }
+    }
+    return true;
+}
+
+TEST(graph_coloring_dsatur_matches_classic) {
+    static int adj[60 * 60];
+    unsigned state = 59u;
+    for (int trial = 0; trial < 60; trial++) {
+        size_t n = (trial < 40) ? 10 : 60;
+        unsigned density = 20 + (unsigned)(trial % 5) * 15;  // % de arestas
+        memset(adj, 0, sizeof(adj));
+        for (size_t i = 0; i < n; i++) {
+            for (size_t j = i + 1; j < n; j++) {
+                state = state * 1103515245u + 12345u;
+                if ((state >> 16) % 100 < density) adj[i * n + j] = adj[j * n + i] = 1;
+            }
+        }
+        for (int m = 1; m <= 9; m++) {
+            GraphColoringResult serial = graph_coloring_dsatur(adj, n, m, 1);
+            GraphColoringResult parallel = graph_coloring_dsatur(adj, n, m, 4);
+            ASSERT_NOT_NULL(serial.colors);
+            ASSERT_NOT_NULL(parallel.colors);
+            ASSERT_EQ(serial.solvable, parallel.solvable);
+            if (n == 10) {
+                GraphColoringResult classic = graph_coloring(adj, n, m);
+                ASSERT_EQ(serial.solvable, classic.solvable);
+                graph_coloring_result_destroy(&classic);
+            }
+            if (serial.solvable) {
+                ASSERT_TRUE(coloring_is_valid(adj, n, serial.colors, m));
+                ASSERT_TRUE(coloring_is_valid(adj, n, parallel.colors, m));
+            }
+            graph_coloring_result_destroy(&serial);
+            graph_coloring_result_destroy(&parallel);
+        }
+    }
+}
+
+TEST(graph_coloring_dsatur_known_chromatic) {
+    // K_8: clique de 8 vertices
+    int complete[64];
+    for (size_t i = 0; i < 64; i++) complete[i] = (i / 8 != i % 8);
+    GraphColoringResult r = graph_coloring_dsatur(complete, 8, 7, 0);
+    ASSERT_FALSE(r.solvable);
+    graph_coloring_result_destroy(&r);
+    r = graph_coloring_dsatur(complete, 8, 8, 0);
+    ASSERT_TRUE(r.solvable);
+    ASSERT_TRUE(coloring_is_valid(complete, 8, r.colors, 8));
+    graph_coloring_result_destroy(&r);
+
+    // Petersen: numero cromatico 3
+    int adj[100];
+    memset(adj, 0, sizeof(adj));
+    int edges[][2] = {{0,1},{1,2},{2,3},{3,4},{4,0},{0,5},{1,6},{2,7},{3,8},{4,9},{5,7},{7,9},{9,6},{6,8},{8,5}};
+    for (int i = 0; i < 15; i++) {
+        adj[edges[i][0]*10 + edges[i][1]] = 1;
+        adj[edges[i][1]*10 + edges[i][0]] = 1;
+    }
+    r = graph_coloring_dsatur(adj, 10, 2, 1);
+    ASSERT_FALSE(r.solvable);
+    graph_coloring_result_destroy(&r);
+    r = graph_coloring_dsatur(adj, 10, 3, 1);
+    ASSERT_TRUE(r.solvable);
+    ASSERT_TRUE(coloring_is_valid(adj, 10, r.colors, 3));
+    graph_coloring_result_destroy(&r);
+
+    // m muito acima do necessario e argumentos invalidos
+    r = graph_coloring_dsatur(adj, 10, 1000, 1);
+    ASSERT_TRUE(r.solvable);
+    ASSERT_TRUE(coloring_is_valid(adj, 10, r.colors, 4));
+    graph_coloring_result_destroy(&r);
+    r = graph_coloring_dsatur(NULL, 10, 3, 1);
+    ASSERT_FALSE(r.solvable);
+    r = graph_coloring_dsatur(adj, 10, 0, 1);
+    ASSERT_FALSE(r.solvable);
+}
+
+TEST(graph_coloring_dsatur_sparse_graph) {
+    // Ciclo impar de 5001 vertices (acima do limite do bitset): 3 cores
+    const size_t n = 5001;
+    Graph *g = graph_create(n, GRAPH_UNDIRECTED, GRAPH_ADJACENCY_LIST, false);
+    ASSERT_NOT_NULL(g);
+    for (size_t v = 0; v < n; v++) {
+        ASSERT_EQ(graph_add_edge(g, v, (v + 1) % n, 1.0), DS_SUCCESS);
+    }
+    GraphColoringResult r = graph_coloring_dsatur_graph(g, 2, 2);
+    ASSERT_NOT_NULL(r.colors);
+    ASSERT_FALSE(r.solvable);
+    graph_coloring_result_destroy(&r);
+    r = graph_coloring_dsatur_graph(g, 3, 2);
+    ASSERT_TRUE(r.solvable);
+    ASSERT_EQ(r.n, n);
+    for (size_t v = 0; v < n; v++) ASSERT_NE(r.colors[v], r.colors[(v + 1) % n]);
+    graph_coloring_result_destroy(&r);
+    graph_destroy(g);
+
+    // Digrafo: arcos nos dois sentidos, lacos e arcos repetidos ignorados
+    Graph *d = graph_create(3, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, false);
+    ASSERT_NOT_NULL(d);
+    graph_add_edge(d, 0, 1, 1.0);
+    graph_add_edge(d, 1, 2, 1.0);
+    graph_add_edge(d, 2, 0, 1.0);
+    graph_add_edge(d, 1, 0, 1.0);
+    graph_add_edge(d, 2, 2, 1.0);
+    CSRGraph *csr = graph_freeze(d);
+    ASSERT_NOT_NULL(csr);
+    r = graph_coloring_dsatur_csr(csr, 2, 1);
+    ASSERT_FALSE(r.solvable);
+    graph_coloring_result_destroy(&r);
+    r = graph_coloring_dsatur_csr(csr, 3, 1);
+    ASSERT_TRUE(r.solvable);
+    ASSERT_NE(r.colors[0], r.colors[1]);
+    ASSERT_NE(r.colors[1], r.colors[2]);
+    ASSERT_NE(r.colors[0], r.colors[2]);
+    graph_coloring_result_destroy(&r);
+    graph_csr_destroy(csr);
+    graph_destroy(d);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -213,6 +491,7 @@ int main(void) {
     RUN_TEST(nqueens_8);
     RUN_TEST(nqueens_solve_4);
     RUN_TEST(nqueens_2_3_impossible);
+    RUN_TEST(nqueens_bitboard_matches_classic);
 
     printf("\n[Subset Sum]\n");
     RUN_TEST(subset_sum_basic);
@@ -220,12 +499,18 @@ int main(void) {
     RUN_TEST(subset_sum_zero);
     RUN_TEST(subset_sum_all_results);
     RUN_TEST(subset_sum_single);
+    RUN_TEST(subset_sum_mitm_and_bitset_match);
+    RUN_TEST(subset_sum_mitm_large);
+    RUN_TEST(subset_sum_bitset_large_target);
 
     printf("\n[Permutations]\n");
     RUN_TEST(permutations_3);
     RUN_TEST(permutations_1);
     RUN_TEST(permutations_count_check);
     RUN_TEST(permutations_unique);
+    RUN_TEST(permutation_iterator_matches_rank_order);
+    RUN_TEST(permutation_rank_unrank_edges);
+    RUN_TEST(permutations_for_each_serial_and_parallel);
 
     printf("\n[Graph Coloring]\n");
     RUN_TEST(graph_coloring_triangle);
@@ -233,6 +518,9 @@ int main(void) {
     RUN_TEST(graph_coloring_bipartite);
     RUN_TEST(graph_coloring_no_edges);
     RUN_TEST(graph_coloring_petersen);
+    RUN_TEST(graph_coloring_dsatur_matches_classic);
+    RUN_TEST(graph_coloring_dsatur_known_chromatic);
+    RUN_TEST(graph_coloring_dsatur_sparse_graph);
 
     printf("\n=== All backtracking tests passed! ===\n");
     return 0;
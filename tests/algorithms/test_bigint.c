@@ -0,0 +1,193 @@
+/**
+ * @file test_bigint.c
+ * @brief Testes unitarios para a multiplicacao de limbs e a exponenciacao modular
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "algorithms/bigint.h"
+#include "algorithms/numerical.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void fill_random(uint64_t *x, size_t n) {
+    for (size_t i = 0; i < n; i++) x[i] = rng_next();
+}
+
+// 2^p - 1 em n = ceil(p / 64) limbs
+static size_t mersenne(uint64_t *x, unsigned p) {
+    size_t n = (p + 63) / 64;
+    for (size_t i = 0; i < n; i++) x[i] = UINT64_MAX;
+    if (p % 64 != 0) x[n - 1] = (1ull << (p % 64)) - 1;
+    return n;
+}
+
+// Confere os tres algoritmos contra o schoolbook
+static bool multiply_agrees(const uint64_t *a, size_t an, const uint64_t *b, size_t bn) {
+    size_t rn = an + bn;
+    uint64_t *ref = malloc((rn + 1) * sizeof(uint64_t));
+    uint64_t *got = malloc((rn + 1) * sizeof(uint64_t));
+    if (ref == NULL || got == NULL) { free(ref); free(got); return false; }
+    bigint_multiply_schoolbook(ref, a, an, b, bn);
+    bool ok = true;
+    void (*algos[])(uint64_t *, const uint64_t *, size_t, const uint64_t *, size_t) = {
+        bigint_multiply, bigint_multiply_karatsuba, bigint_multiply_toom3
+    };
+    for (size_t k = 0; ok && k < 3; k++) {
+        got[rn] = 0xDEADBEEFull;
+        algos[k](got, a, an, b, bn);
+        ok = memcmp(got, ref, rn * sizeof(uint64_t)) == 0 && got[rn] == 0xDEADBEEFull;
+    }
+    free(ref);
+    free(got);
+    return ok;
+}
+
+// ============================================================================
+// MULTIPLICACAO
+// ============================================================================
+
+TEST(multiply_small_known) {
+    uint64_t a[1] = {UINT64_MAX}, r[2];
+    bigint_multiply(r, a, 1, a, 1);
+    ASSERT_EQ(r[0], 1);
+    ASSERT_EQ(r[1], UINT64_MAX - 1);
+
+    // (2^128 - 1)(2^64 + 3) = 2^192 + 3 * 2^128 - 2^64 - 3
+    uint64_t x[2] = {UINT64_MAX, UINT64_MAX}, y[2] = {3, 1}, z[4];
+    bigint_multiply(z, x, 2, y, 2);
+    ASSERT_EQ(z[0], UINT64_MAX - 2);
+    ASSERT_EQ(z[1], UINT64_MAX - 1);
+    ASSERT_EQ(z[2], 2);
+    ASSERT_EQ(z[3], 1);
+
+    uint64_t w[3] = {7, 7, 7};
+    bigint_multiply(w, x, 2, y, 0);
+    ASSERT_EQ(w[0], 0);
+    ASSERT_EQ(w[1], 0);
+    ASSERT_EQ(w[2], 7);
+}
+
+TEST(multiply_matches_schoolbook) {
+    // Tamanhos em volta dos limiares e dos casos de borda do Toom-3
+    const size_t sizes[] = {1, 2, 4, 5, 7, 31, 32, 33, 64, 100, 159, 160, 161, 250, 487};
+    const size_t count = sizeof(sizes) / sizeof(sizes[0]);
+    uint64_t *a = malloc(487 * sizeof(uint64_t));
+    uint64_t *b = malloc(487 * sizeof(uint64_t));
+    ASSERT_NOT_NULL(a);
+    ASSERT_NOT_NULL(b);
+    for (size_t i = 0; i < count; i++) {
+        for (size_t j = 0; j < count; j++) {
+            fill_random(a, sizes[i]);
+            fill_random(b, sizes[j]);
+            ASSERT_TRUE(multiply_agrees(a, sizes[i], b, sizes[j]));
+        }
+    }
+
+    // Todos os bits em 1: carries e sinais maximos na interpolacao
+    for (size_t i = 0; i < 487; i++) a[i] = b[i] = UINT64_MAX;
+    ASSERT_TRUE(multiply_agrees(a, 487, b, 487));
+    ASSERT_TRUE(multiply_agrees(a, 333, b, 170));
+
+    // Metades/tercos altos zerados (operandos com zeros a esquerda)
+    fill_random(a, 300);
+    fill_random(b, 300);
+    memset(a + 150, 0, 150 * sizeof(uint64_t));
+    memset(b + 200, 0, 100 * sizeof(uint64_t));
+    ASSERT_TRUE(multiply_agrees(a, 300, b, 300));
+    free(a);
+    free(b);
+}
+
+// ============================================================================
+// EXPONENCIACAO MODULAR
+// ============================================================================
+
+TEST(pow_mod_matches_fast_pow_mod) {
+    for (int t = 0; t < 200; t++) {
+        uint64_t m = (rng_next() >> 2) | 1;
+        uint64_t base = rng_next(), e = rng_next() >> 1, r;
+        ASSERT_TRUE(bigint_pow_mod(&r, &base, &e, 1, &m, 1));
+        long long expected = fast_pow_mod((long long)(base % m), (long long)e, (long long)m);
+        ASSERT_EQ(r, (uint64_t)expected);
+    }
+}
+
+TEST(pow_mod_fermat_mersenne) {
+    // Primos de Mersenne: 127 e 521 (schoolbook), 4423 bits = 70 limbs (Karatsuba)
+    const unsigned exponents[] = {127, 521, 4423};
+    static uint64_t mod[70], base[70], exp[70], r[70];
+    for (size_t k = 0; k < 3; k++) {
+        size_t n = mersenne(mod, exponents[k]);
+
+        memcpy(exp, mod, n * sizeof(uint64_t));
+        exp[0] -= 1;                                      // p - 1
+        memset(base, 0, n * sizeof(uint64_t));
+        base[0] = 3;
+        ASSERT_TRUE(bigint_pow_mod(r, base, exp, n, mod, n));
+        ASSERT_EQ(r[0], 1);
+        for (size_t i = 1; i < n; i++) ASSERT_EQ(r[i], 0);
+
+        // a^p = a para a < p (base aleatoria com o topo abaixo do modulo)
+        fill_random(base, n);
+        base[n - 1] &= mod[n - 1] >> 1;
+        ASSERT_TRUE(bigint_pow_mod(r, base, mod, n, mod, n));
+        ASSERT_EQ(memcmp(r, base, n * sizeof(uint64_t)), 0);
+    }
+}
+
+TEST(pow_mod_edge_cases) {
+    uint64_t mod[2] = {10, 0}, base[2] = {3, 0}, exp[1] = {5}, r[2];
+    ASSERT_FALSE(bigint_pow_mod(r, base, exp, 1, mod, 2));   // modulo par
+    ASSERT_FALSE(bigint_pow_mod(r, base, exp, 1, mod, 0));
+    ASSERT_FALSE(bigint_pow_mod(NULL, base, exp, 1, mod, 2));
+
+    mod[0] = 1;
+    ASSERT_TRUE(bigint_pow_mod(r, base, exp, 1, mod, 2));
+    ASSERT_EQ(r[0], 0);
+
+    // exp = 0 e base = 2^64 + 5000000 >= mod (limb alto do modulo zerado)
+    mod[0] = 1000003;
+    base[0] = 5000000; base[1] = 1;
+    ASSERT_TRUE(bigint_pow_mod(r, base, NULL, 0, mod, 2));
+    ASSERT_EQ(r[0], 1);
+    ASSERT_EQ(r[1], 0);
+    uint64_t e2[2] = {1, 0};
+    ASSERT_TRUE(bigint_pow_mod(base, base, e2, 2, mod, 2));  // saida sobre a base
+    ASSERT_EQ(base[0], (uint64_t)((fast_pow_mod(2, 64, 1000003) + 5000000) % 1000003));
+    ASSERT_EQ(base[1], 0);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Bigint Tests ===\n");
+
+    RUN_TEST(multiply_small_known);
+    RUN_TEST(multiply_matches_schoolbook);
+    RUN_TEST(pow_mod_matches_fast_pow_mod);
+    RUN_TEST(pow_mod_fermat_mersenne);
+    RUN_TEST(pow_mod_edge_cases);
+
+    printf("\nAll Bigint tests passed!\n");
+    return 0;
+}
@@ -9,7 +9,10 @@
 #include "algorithms/divide_conquer.h"
 #include "../test_macros.h"
 
+#include <float.h>
 #include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define APPROX_EQ(a, b) ASSERT(fabs((a) - (b)) < 1e-4)
@@ -64,6 +67,125 @@ TEST(strassen_3x3) {
     }
 }
 
+static void multiply_reference(const double *A, const double *B, double *C, size_t m, size_t k, size_t n) {
+    for (size_t i = 0; i < m; i++) {
+        for (size_t j = 0; j < n; j++) {
+            double sum = 0.0;
+            for (size_t l = 0; l < k; l++) sum += A[i * k + l] * B[l * n + j];
+            C[i * n + j] = sum;
+        }
+    }
+}
+
+TEST(matrix_multiply_rectangular_shapes) {
+    // Bordas de todos os micro-kernels (4, 6, 8, 16) e blocos MC = 96, KC = 256
+    const size_t shapes[][3] = {
+        {1, 1, 1}, {1, 9, 1}, {7, 5, 3}, {6, 8, 8}, {13, 17, 31},
+        {97, 300, 33}, {8, 257, 16}, {200, 3, 190}, {31, 1, 65}
+    };
+    unsigned state = 42u;
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        size_t m = shapes[s][0], k = shapes[s][1], n = shapes[s][2];
+        double *A = malloc(m * k * sizeof(double));
+        double *B = malloc(k * n * sizeof(double));
+        double *C = malloc(m * n * sizeof(double));
+        double *R = malloc(m * n * sizeof(double));
+        ASSERT(A && B && C && R);
+        for (size_t i = 0; i < m * k; i++) {
+            state = state * 1103515245u + 12345u;
+            A[i] = (double)((state >> 16) % 200u) / 10.0 - 10.0;
+        }
+        for (size_t i = 0; i < k * n; i++) {
+            state = state * 1103515245u + 12345u;
+            B[i] = (double)((state >> 16) % 200u) / 10.0 - 10.0;
+        }
+        for (size_t i = 0; i < m * n; i++) C[i] = 1e9;  // lixo: deve ser sobrescrito
+        matrix_multiply(A, B, C, m, k, n);
+        multiply_reference(A, B, R, m, k, n);
+        for (size_t i = 0; i < m * n; i++) APPROX_EQ(C[i], R[i]);
+        free(A); free(B); free(C); free(R);
+    }
+
+    double A[] = {1, 2}, B[] = {3, 4}, C[] = {5, 5, 5, 5};
+    matrix_multiply(A, B, C, 2, 0, 2);
+    for (int i = 0; i < 4; i++) APPROX_EQ(C[i], 0.0);
+}
+
+TEST(strassen_non_power_of_two) {
+    // Limiar autoajustado (>= 64): ao menos um nivel de recursao, com n
+    // completado so ate o multiplo de 2^niveis necessario
+    size_t n = 515;
+    double *A = malloc(n * n * sizeof(double));
+    double *B = malloc(n * n * sizeof(double));
+    double *C1 = malloc(n * n * sizeof(double));
+    double *C2 = malloc(n * n * sizeof(double));
+    ASSERT(A && B && C1 && C2);
+    for (size_t i = 0; i < n * n; i++) {
+        A[i] = (double)(i % 7) - 3.0;
+        B[i] = (double)(i % 5) * 0.5;
+    }
+    matrix_multiply_classic(A, B, C1, n);
+    strassen_multiply(A, B, C2, n);
+    for (size_t i = 0; i < n * n; i++) APPROX_EQ(C1[i], C2[i]);
+    free(A); free(B); free(C1); free(C2);
+}
+
+TEST(strassen_workspace_and_tasks) {
+    // n = 200 com limiar 64: completado ate 256, dois niveis de recursao
+    const size_t sizes[] = {65, 128, 200};
+    for (size_t s = 0; s < 3; s++) {
+        size_t n = sizes[s];
+        double *A = malloc(n * n * sizeof(double));
+        double *B = malloc(n * n * sizeof(double));
+        double *R = malloc(n * n * sizeof(double));
+        double *C = malloc(n * n * sizeof(double));
+        ASSERT(A && B && R && C);
+        for (size_t i = 0; i < n * n; i++) {
+            A[i] = (double)((i * 7) % 11) - 5.0;
+            B[i] = (double)((i * 3) % 13) * 0.25;
+        }
+        matrix_multiply(A, B, R, n, n, n);
+
+        StrassenConfig config = strassen_default_config();
+        config.threshold = 64;
+        for (size_t depth = 0; depth <= 2; depth++) {
+            for (size_t threads = 1; threads <= 3; threads += 2) {
+                config.parallel_depth = depth;
+                config.num_threads = threads;
+                memset(C, 0, n * n * sizeof(double));
+                strassen_multiply_ex(A, B, C, n, &config);
+                for (size_t i = 0; i < n * n; i++) APPROX_EQ(C[i], R[i]);
+            }
+        }
+        free(A); free(B); free(R); free(C);
+    }
+}
+
+static void* autotune_thread(void *arg) {
+    *(size_t *)arg = strassen_autotune();
+    return NULL;
+}
+
+TEST(strassen_autotune_range) {
+    // Primeira chamada concorrente: as duas threads veem o mesmo limiar
+    size_t seen[2] = {0, 0};
+    pthread_t other;
+    ASSERT_EQ(pthread_create(&other, NULL, autotune_thread, &seen[1]), 0);
+    autotune_thread(&seen[0]);
+    pthread_join(other, NULL);
+    ASSERT_EQ(seen[0], seen[1]);
+
+    size_t t = strassen_autotune();
+    ASSERT_EQ(t, seen[0]);
+    ASSERT_TRUE(t >= STRASSEN_THRESHOLD_MIN && t <= STRASSEN_THRESHOLD_MAX);
+    ASSERT_EQ(t & (t - 1), 0);
+    ASSERT_EQ(strassen_autotune(), t);
+
+    StrassenConfig config = strassen_default_config();
+    ASSERT_EQ(config.threshold, 0);
+    ASSERT_EQ(config.parallel_depth, 1);
+}
+
 // ============================================================================
 // CLOSEST PAIR
 // ============================================================================
@@ -92,6 +214,69 @@ TEST(closest_pair_many) {
     APPROX_EQ(r.distance, 0.5);
 }
 
+static double closest_reference(const Point2D *pts, size_t n) {
+    double best = INFINITY;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = i + 1; j < n; j++) {
+            double d = hypot(pts[i].x - pts[j].x, pts[i].y - pts[j].y);
+            if (d < best) best = d;
+        }
+    }
+    return best;
+}
+
+// A distancia devolvida deve ser a dos dois pontos devolvidos
+static bool closest_consistent(ClosestPairResult r) {
+    return fabs(hypot(r.p1.x - r.p2.x, r.p1.y - r.p2.y) - r.distance) < 1e-9;
+}
+
+TEST(closest_pair_random_and_degenerate) {
+    static Point2D pts[3000];
+    unsigned state = 123u;
+    const size_t sizes[] = {2, 3, 9, 100, 3000};
+    for (size_t s = 0; s < 5; s++) {
+        size_t n = sizes[s];
+        for (int shape = 0; shape < 3; shape++) {
+            for (size_t i = 0; i < n; i++) {
+                state = state * 1103515245u + 12345u;
+                double u = (double)(state >> 8) / 16777216.0;
+                state = state * 1103515245u + 12345u;
+                double v = (double)(state >> 8) / 16777216.0;
+                if (shape == 0) {           // uniforme
+                    pts[i].x = u * 1000.0 - 500.0;
+                    pts[i].y = v * 1000.0 - 500.0;
+                } else if (shape == 1) {    // poucas colunas: muitos x repetidos
+                    pts[i].x = (double)((state >> 16) % 4u);
+                    pts[i].y = v * 50.0;
+                } else {                    // aglomerado + pontos distantes
+                    pts[i].x = (i % 10 == 0) ? u * 1e6 : u * 1e-3;
+                    pts[i].y = (i % 10 == 0) ? v * 1e6 : v * 1e-3;
+                }
+            }
+            double expected = closest_reference(pts, n);
+            ClosestPairResult a = closest_pair(pts, n);
+            ClosestPairResult b = closest_pair_parallel(pts, n, 3);
+            ClosestPairResult c = closest_pair_grid(pts, n);
+            ASSERT(fabs(a.distance - expected) < 1e-9);
+            ASSERT(fabs(b.distance - expected) < 1e-9);
+            ASSERT(fabs(c.distance - expected) < 1e-9);
+            ASSERT_TRUE(closest_consistent(a));
+            ASSERT_TRUE(closest_consistent(b));
+            ASSERT_TRUE(closest_consistent(c));
+        }
+    }
+
+    // Todos iguais, colineares e n < 2
+    Point2D same[5] = {{2, 2}, {2, 2}, {2, 2}, {2, 2}, {2, 2}};
+    APPROX_EQ(closest_pair_grid(same, 5).distance, 0.0);
+    APPROX_EQ(closest_pair_parallel(same, 5, 0).distance, 0.0);
+    Point2D line[4] = {{0, 7}, {10, 7}, {3, 7}, {4.5, 7}};
+    APPROX_EQ(closest_pair_grid(line, 4).distance, 1.5);
+    APPROX_EQ(closest_pair_parallel(line, 4, 1).distance, 1.5);
+    ASSERT(closest_pair_grid(line, 1).distance == DBL_MAX);
+    ASSERT(closest_pair_parallel(NULL, 4, 1).distance == DBL_MAX);
+}
+
 // ============================================================================
 // KARATSUBA
 // ============================================================================
@@ -205,6 +390,27 @@ TEST(quick_select_sorted) {
     ASSERT_TRUE(found);
 }
 
+TEST(quick_select_matches_sorted) {
+    // Tamanhos que passam pelo particionamento e pela rede de ordenacao
+    int arr[500];
+    int sorted[500];
+    for (size_t i = 0; i < 500; i++) sorted[i] = (int)((i * 7919u) % 211u) - 100;
+    for (size_t i = 1; i < 500; i++) {
+        int x = sorted[i];
+        size_t j = i;
+        while (j > 0 && sorted[j - 1] > x) { sorted[j] = sorted[j - 1]; j--; }
+        sorted[j] = x;
+    }
+    bool found;
+    for (size_t k = 0; k < 500; k += 7) {
+        for (size_t i = 0; i < 500; i++) arr[i] = (int)((i * 7919u) % 211u) - 100;
+        ASSERT_EQ(quick_select(arr, 500, k, &found), sorted[k]);
+        ASSERT_TRUE(found);
+    }
+    for (size_t i = 0; i < 33; i++) arr[i] = (int)(33 - i);
+    ASSERT_EQ(median(arr, 33), 17);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -213,16 +419,21 @@ int main(void) {
     printf("=== Divide & Conquer Tests ===\n\n");
 
     printf("[Strassen]\n");
+    RUN_TEST(strassen_autotune_range);
     RUN_TEST(strassen_2x2);
     RUN_TEST(strassen_identity);
     RUN_TEST(strassen_vs_classic_4x4);
     RUN_TEST(strassen_3x3);
+    RUN_TEST(matrix_multiply_rectangular_shapes);
+    RUN_TEST(strassen_non_power_of_two);
+    RUN_TEST(strassen_workspace_and_tasks);
 
     printf("\n[Closest Pair]\n");
     RUN_TEST(closest_pair_basic);
     RUN_TEST(closest_pair_collinear);
     RUN_TEST(closest_pair_two);
     RUN_TEST(closest_pair_many);
+    RUN_TEST(closest_pair_random_and_degenerate);
 
     printf("\n[Karatsuba]\n");
     RUN_TEST(karatsuba_small);
@@ -244,6 +455,7 @@ int main(void) {
     RUN_TEST(quick_select_median);
     RUN_TEST(quick_select_invalid);
     RUN_TEST(quick_select_sorted);
+    RUN_TEST(quick_select_matches_sorted);
 
     printf("\n=== All divide & conquer tests passed! ===\n");
     return 0;
@@ -9,6 +9,7 @@
 #include "algorithms/dynamic_programming.h"
 #include "../test_macros.h"
 
+#include <stdlib.h>
 #include <string.h>
 
 static bool is_subsequence(const char *sub, const char *str) {
@@ -95,6 +96,82 @@ TEST(lcs_cormen_example) {
     dp_lcs_result_destroy(&r);
 }
 
+TEST(lcs_hirschberg_matches_dp) {
+    static char a[1200], b[1000];
+    unsigned state = 77u;
+    const size_t sizes[] = {1, 2, 7, 64, 300, 1199};
+    for (size_t s = 0; s < 6; s++) {
+        for (size_t sigma = 2; sigma <= 20; sigma += 9) {
+            size_t m = sizes[s], n = (sizes[5 - s] * 3) / 4 + 1;
+            for (size_t i = 0; i < m; i++) {
+                state = state * 1103515245u + 12345u;
+                a[i] = (char)('a' + (state >> 16) % sigma);
+            }
+            for (size_t j = 0; j < n; j++) {
+                state = state * 1103515245u + 12345u;
+                b[j] = (char)('a' + (state >> 16) % sigma);
+            }
+            a[m] = '\0';
+            b[n] = '\0';
+
+            LCSResult ref = dp_lcs(a, b);
+            LCSResult r = dp_lcs_hirschberg(a, b);
+            ASSERT_EQ(r.length, ref.length);
+            ASSERT_EQ(dp_lcs_length(a, b), ref.length);
+            if (r.length > 0) {
+                ASSERT_NOT_NULL(r.sequence);
+                ASSERT_EQ(strlen(r.sequence), r.length);
+                ASSERT_TRUE(is_subsequence(r.sequence, a));
+                ASSERT_TRUE(is_subsequence(r.sequence, b));
+            }
+            dp_lcs_result_destroy(&ref);
+            dp_lcs_result_destroy(&r);
+        }
+    }
+
+    LCSResult r = dp_lcs_hirschberg("ABCBDAB", "BDCABA");
+    ASSERT_EQ(r.length, 4);
+    ASSERT_TRUE(is_subsequence(r.sequence, "ABCBDAB"));
+    ASSERT_TRUE(is_subsequence(r.sequence, "BDCABA"));
+    dp_lcs_result_destroy(&r);
+
+    r = dp_lcs_hirschberg("ABC", "XYZ");
+    ASSERT_EQ(r.length, 0);
+    ASSERT_NULL(r.sequence);
+    r = dp_lcs_hirschberg(NULL, "ABC");
+    ASSERT_EQ(r.length, 0);
+    r = dp_lcs_hirschberg("", "ABC");
+    ASSERT_EQ(r.length, 0);
+}
+
+TEST(lcs_wavefront_matches_serial) {
+    static char a[1500], b[700];
+    unsigned state = 5u;
+    // Tamanhos ao redor do bloco (256) e nao multiplos dele
+    const size_t ms[] = {1, 255, 256, 257, 1499};
+    const size_t ns[] = {699, 1, 513, 256, 600};
+    for (size_t s = 0; s < 5; s++) {
+        for (size_t i = 0; i < ms[s]; i++) {
+            state = state * 1103515245u + 12345u;
+            a[i] = (char)('a' + (state >> 16) % 4);
+        }
+        for (size_t j = 0; j < ns[s]; j++) {
+            state = state * 1103515245u + 12345u;
+            b[j] = (char)('a' + (state >> 16) % 4);
+        }
+        a[ms[s]] = '\0';
+        b[ns[s]] = '\0';
+        size_t expected = dp_lcs_length(a, b);
+        ASSERT_EQ(dp_lcs_length_wavefront(a, b, 0), expected);
+        ASSERT_EQ(dp_lcs_length_wavefront(a, b, 1), expected);
+        ASSERT_EQ(dp_lcs_length_wavefront(a, b, 3), expected);
+        ASSERT_EQ(dp_lcs_length_wavefront(b, a, 2), expected);
+    }
+    ASSERT_EQ(dp_lcs_length_wavefront("ABCBDAB", "BDCAB", 0), 4);
+    ASSERT_EQ(dp_lcs_length_wavefront("", "ABC", 0), 0);
+    ASSERT_EQ(dp_lcs_length_wavefront(NULL, "ABC", 0), 0);
+}
+
 // ============================================================================
 // KNAPSACK 0/1
 // ============================================================================
@@ -137,6 +214,76 @@ TEST(knapsack_with_reconstruction) {
     dp_knapsack_result_destroy(&r);
 }
 
+// Tabela completa (n+1) x (W+1), como referencia
+static int knapsack_reference(const int *weights, const int *values, size_t n, int capacity) {
+    int *dp = calloc((n + 1) * (size_t)(capacity + 1), sizeof(int));
+    if (dp == NULL) return -1;
+    size_t stride = (size_t)capacity + 1;
+    for (size_t i = 1; i <= n; i++) {
+        for (int w = 0; w <= capacity; w++) {
+            int best = dp[(i - 1) * stride + (size_t)w];
+            if (weights[i - 1] <= w) {
+                int with_item = values[i - 1] + dp[(i - 1) * stride + (size_t)(w - weights[i - 1])];
+                if (with_item > best) best = with_item;
+            }
+            dp[i * stride + (size_t)w] = best;
+        }
+    }
+    int result = dp[n * stride + (size_t)capacity];
+    free(dp);
+    return result;
+}
+
+static bool knapsack_selection_ok(const KnapsackResult *r, const int *weights, const int *values,
+                                  size_t n, int capacity) {
+    if (r->selected == NULL) return false;
+    long long weight = 0, value = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (r->selected[i]) {
+            weight += weights[i];
+            value += values[i];
+        }
+    }
+    return weight <= capacity && value == r->max_value;
+}
+
+TEST(knapsack_matches_full_table) {
+    int weights[60], values[60];
+    unsigned state = 99u;
+    // Capacidades ao redor das larguras de lane (4 e 8) e pesos 0 ou > W
+    const int capacities[] = {1, 3, 7, 8, 9, 31, 100, 1001};
+    const size_t counts[] = {1, 2, 5, 17, 60};
+    for (size_t c = 0; c < 8; c++) {
+        for (size_t k = 0; k < 5; k++) {
+            size_t n = counts[k];
+            for (size_t i = 0; i < n; i++) {
+                state = state * 1103515245u + 12345u;
+                weights[i] = (int)((state >> 16) % (unsigned)(capacities[c] / 3 + 3));
+                state = state * 1103515245u + 12345u;
+                values[i] = (int)((state >> 16) % 1000u);
+            }
+            int capacity = capacities[c];
+            int expected = knapsack_reference(weights, values, n, capacity);
+            ASSERT_EQ(dp_knapsack_value(weights, values, n, capacity), expected);
+
+            KnapsackResult r = dp_knapsack(weights, values, n, capacity);
+            ASSERT_EQ(r.max_value, expected);
+            ASSERT_TRUE(knapsack_selection_ok(&r, weights, values, n, capacity));
+            dp_knapsack_result_destroy(&r);
+
+            KnapsackResult h = dp_knapsack_linear_space(weights, values, n, capacity);
+            ASSERT_EQ(h.max_value, expected);
+            ASSERT_TRUE(knapsack_selection_ok(&h, weights, values, n, capacity));
+            dp_knapsack_result_destroy(&h);
+        }
+    }
+
+    KnapsackResult none = dp_knapsack_linear_space(NULL, values, 3, 10);
+    ASSERT_NULL(none.selected);
+    none = dp_knapsack_linear_space(weights, values, 3, 0);
+    ASSERT_NULL(none.selected);
+}
+
 // ============================================================================
 // EDIT DISTANCE
 // ============================================================================
@@ -164,6 +311,73 @@ TEST(edit_distance_single_op) {
     ASSERT_EQ(dp_edit_distance("abc", "aXc"), 1);
 }
 
+TEST(edit_distance_myers_matches_dp) {
+    static char a[301], b[301];
+    unsigned state = 31u;
+    const size_t lens[] = {0, 1, 5, 63, 64, 65, 127, 128, 200, 300};
+    for (size_t x = 0; x < 10; x++) {
+        for (size_t y = 0; y < 10; y++) {
+            size_t m = lens[x], n = lens[y];
+            for (size_t i = 0; i < m; i++) {
+                state = state * 1103515245u + 12345u;
+                a[i] = (char)('a' + (state >> 16) % 4);
+            }
+            // b = a com mutacoes, para distancias pequenas e grandes
+            for (size_t i = 0; i < n; i++) {
+                state = state * 1103515245u + 12345u;
+                b[i] = (i < m && (state >> 16) % 8 != 0) ? a[i] : (char)('a' + (state >> 20) % 4);
+            }
+            a[m] = '\0';
+            b[n] = '\0';
+            size_t expected = dp_edit_distance(a, b);
+            ASSERT_EQ(dp_edit_distance_myers(a, m, b, n), expected);
+            ASSERT_EQ(dp_edit_distance_myers(b, n, a, m), expected);
+        }
+    }
+    ASSERT_EQ(dp_edit_distance_myers("kitten", 6, "sitting", 7), 3);
+    ASSERT_EQ(dp_edit_distance_myers(NULL, 0, "abc", 3), 3);
+    ASSERT_EQ(dp_edit_distance_myers(NULL, 2, "abc", 3), DP_EDIT_DISTANCE_ERROR);
+
+    // Bytes nulos contam como caracteres
+    const char x[] = {'a', '\0', 'b'};
+    const char z[] = {'a', 'b'};
+    ASSERT_EQ(dp_edit_distance_myers(x, 3, z, 2), 1);
+}
+
+TEST(edit_distance_bounded_threshold) {
+    static char a[201], b[201];
+    unsigned state = 77u;
+    for (int round = 0; round < 40; round++) {
+        state = state * 1103515245u + 12345u;
+        size_t m = (state >> 16) % 200;
+        state = state * 1103515245u + 12345u;
+        size_t n = (state >> 16) % 200;
+        for (size_t i = 0; i < m; i++) {
+            state = state * 1103515245u + 12345u;
+            a[i] = (char)('a' + (state >> 16) % 3);
+        }
+        for (size_t i = 0; i < n; i++) {
+            state = state * 1103515245u + 12345u;
+            b[i] = (i < m && (state >> 16) % 5 != 0) ? a[i] : (char)('a' + (state >> 20) % 3);
+        }
+        a[m] = '\0';
+        b[n] = '\0';
+        size_t d = dp_edit_distance(a, b);
+        const size_t ks[] = {0, 1, 3, 10, 50, 300};
+        for (size_t t = 0; t < 6; t++) {
+            size_t k = ks[t];
+            size_t expected = (d <= k) ? d : k + 1;
+            ASSERT_EQ(dp_edit_distance_bounded(a, m, b, n, k), expected);
+            ASSERT_EQ(dp_edit_distance_bounded(b, n, a, m, k), expected);
+        }
+    }
+    ASSERT_EQ(dp_edit_distance_bounded("kitten", 6, "sitting", 7, 2), 3);
+    ASSERT_EQ(dp_edit_distance_bounded("kitten", 6, "sitting", 7, 3), 3);
+    ASSERT_EQ(dp_edit_distance_bounded("abc", 3, "abcdefgh", 8, 2), 3);
+    ASSERT_EQ(dp_edit_distance_bounded("", 0, "ab", 2, 5), 2);
+    ASSERT_EQ(dp_edit_distance_bounded(NULL, 1, "ab", 2, 5), DP_EDIT_DISTANCE_ERROR);
+}
+
 // ============================================================================
 // LIS
 // ============================================================================
@@ -199,6 +413,108 @@ TEST(lis_with_reconstruction) {
     dp_lis_result_destroy(&r);
 }
 
+// DP quadratica como referencia
+static size_t lis_reference(const int *arr, size_t n, bool strict) {
+    size_t *dp = malloc(n * sizeof(size_t));
+    size_t best = 0;
+    for (size_t i = 0; i < n; i++) {
+        dp[i] = 1;
+        for (size_t j = 0; j < i; j++) {
+            bool ok = strict ? arr[j] < arr[i] : arr[j] <= arr[i];
+            if (ok && dp[j] + 1 > dp[i]) dp[i] = dp[j] + 1;
+        }
+        if (dp[i] > best) best = dp[i];
+    }
+    free(dp);
+    return best;
+}
+
+// sequence deve ser subsequencia de arr, na ordem de arr
+static bool lis_is_subsequence(const int *seq, size_t len, const int *arr, size_t n) {
+    size_t k = 0;
+    for (size_t i = 0; i < n && k < len; i++) {
+        if (arr[i] == seq[k]) k++;
+    }
+    return k == len;
+}
+
+TEST(lis_patience_matches_quadratic) {
+    static int arr[2000];
+    unsigned state = 13u;
+    const size_t sizes[] = {1, 2, 10, 257, 2000};
+    const unsigned ranges[] = {3, 50, 100000};
+    for (size_t s = 0; s < 5; s++) {
+        for (size_t r = 0; r < 3; r++) {
+            size_t n = sizes[s];
+            for (size_t i = 0; i < n; i++) {
+                state = state * 1103515245u + 12345u;
+                arr[i] = (int)((state >> 16) % ranges[r]) - 10;
+            }
+            LISResult strict = dp_lis(arr, n);
+            ASSERT_EQ(strict.length, lis_reference(arr, n, true));
+            ASSERT_EQ(strict.length, dp_lis_length(arr, n));
+            ASSERT_TRUE(lis_is_subsequence(strict.sequence, strict.seq_len, arr, n));
+            for (size_t i = 1; i < strict.seq_len; i++) ASSERT_TRUE(strict.sequence[i] > strict.sequence[i - 1]);
+            dp_lis_result_destroy(&strict);
+
+            LISResult loose = dp_lis_non_decreasing(arr, n);
+            ASSERT_EQ(loose.length, lis_reference(arr, n, false));
+            ASSERT_TRUE(lis_is_subsequence(loose.sequence, loose.seq_len, arr, n));
+            for (size_t i = 1; i < loose.seq_len; i++) ASSERT_TRUE(loose.sequence[i] >= loose.sequence[i - 1]);
+            dp_lis_result_destroy(&loose);
+        }
+    }
+
+    int repeated[] = {5, 5, 5, 5};
+    LISResult r = dp_lis_non_decreasing(repeated, 4);
+    ASSERT_EQ(r.length, 4);
+    dp_lis_result_destroy(&r);
+    r = dp_lis(repeated, 4);
+    ASSERT_EQ(r.length, 1);
+    dp_lis_result_destroy(&r);
+    r = dp_lis(NULL, 4);
+    ASSERT_EQ(r.length, 0);
+    ASSERT_NULL(r.sequence);
+}
+
+typedef struct {
+    int version;
+    const char *name;
+} LISRecord;
+
+static int compare_record_version(const void *a, const void *b) {
+    int x = ((const LISRecord *)a)->version;
+    int y = ((const LISRecord *)b)->version;
+    return (x > y) - (x < y);
+}
+
+TEST(lis_generic_records) {
+    LISRecord recs[] = {
+        {3, "c"}, {1, "a"}, {4, "d"}, {1, "a2"}, {5, "e"}, {9, "i"}, {2, "b"}, {6, "f"}, {5, "e2"}, {6, "f2"}
+    };
+    size_t idx[10];
+    size_t len = dp_lis_generic(recs, 10, sizeof(LISRecord), compare_record_version, true, idx);
+    ASSERT_EQ(len, 4);
+    for (size_t i = 1; i < len; i++) {
+        ASSERT_TRUE(idx[i] > idx[i - 1]);
+        ASSERT_TRUE(recs[idx[i]].version > recs[idx[i - 1]].version);
+    }
+
+    len = dp_lis_generic(recs, 10, sizeof(LISRecord), compare_record_version, false, idx);
+    ASSERT_EQ(len, 5);
+    for (size_t i = 1; i < len; i++) {
+        ASSERT_TRUE(idx[i] > idx[i - 1]);
+        ASSERT_TRUE(recs[idx[i]].version >= recs[idx[i - 1]].version);
+    }
+
+    // Sem indices: so o comprimento, igual a versao int
+    static int arr[500];
+    for (size_t i = 0; i < 500; i++) arr[i] = (int)((i * 7919u) % 503u);
+    ASSERT_EQ(dp_lis_generic(arr, 500, sizeof(int), compare_int, true, NULL), dp_lis_length(arr, 500));
+    ASSERT_EQ(dp_lis_generic(NULL, 5, sizeof(int), compare_int, true, NULL), 0);
+    ASSERT_EQ(dp_lis_generic(arr, 5, sizeof(int), NULL, true, NULL), 0);
+}
+
 // ============================================================================
 // ROD CUTTING
 // ============================================================================
@@ -316,12 +632,15 @@ int main(void) {
     RUN_TEST(lcs_null);
     RUN_TEST(lcs_with_reconstruction);
     RUN_TEST(lcs_cormen_example);
+    RUN_TEST(lcs_hirschberg_matches_dp);
+    RUN_TEST(lcs_wavefront_matches_serial);
 
     printf("\n[Knapsack 0/1]\n");
     RUN_TEST(knapsack_basic);
     RUN_TEST(knapsack_exact_fit);
     RUN_TEST(knapsack_zero_capacity);
     RUN_TEST(knapsack_with_reconstruction);
+    RUN_TEST(knapsack_matches_full_table);
 
     printf("\n[Edit Distance]\n");
     RUN_TEST(edit_distance_basic);
@@ -329,6 +648,8 @@ int main(void) {
     RUN_TEST(edit_distance_empty);
     RUN_TEST(edit_distance_null);
     RUN_TEST(edit_distance_single_op);
+    RUN_TEST(edit_distance_myers_matches_dp);
+    RUN_TEST(edit_distance_bounded_threshold);
 
     printf("\n[LIS]\n");
     RUN_TEST(lis_basic);
@@ -336,6 +657,8 @@ int main(void) {
     RUN_TEST(lis_reverse);
     RUN_TEST(lis_single);
     RUN_TEST(lis_with_reconstruction);
+    RUN_TEST(lis_patience_matches_quadratic);
+    RUN_TEST(lis_generic_records);
 
     printf("\n[Rod Cutting]\n");
     RUN_TEST(rod_cutting_cormen);
@@ -0,0 +1,205 @@
+/**
+ * @file test_external_sort.c
+ * @brief Testes unitarios para a ordenacao externa
+ *
+ * Os arquivos temporarios sao criados no diretorio corrente (o diretorio
+ * de build, quando executado pelo ctest) e removidos ao final de cada teste.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "algorithms/external_sort.h"
+#include "algorithms/sorting.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define IN_PATH  "test_extsort_in.bin"
+#define OUT_PATH "test_extsort_out.bin"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+typedef struct {
+    uint64_t key;
+    uint32_t check;             // derivado da chave: registro inteiro foi copiado
+    char payload[20];
+} Record;
+
+static int compare_record(const void *a, const void *b) {
+    uint64_t x = ((const Record *)a)->key;
+    uint64_t y = ((const Record *)b)->key;
+    return (x > y) - (x < y);
+}
+
+static uint32_t record_check(uint64_t key) {
+    return (uint32_t)(key * 2654435761u) ^ 0xA5A5A5A5u;
+}
+
+static uint64_t rng_state = 88172645463325252ull;
+
+static uint64_t rng_next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+// Grava n registros com chaves em [0, range); devolve a soma das chaves
+static uint64_t write_input(size_t n, uint64_t range) {
+    FILE *f = fopen(IN_PATH, "wb");
+    uint64_t sum = 0;
+    if (f == NULL) return 0;
+    for (size_t i = 0; i < n; i++) {
+        Record r;
+        memset(&r, 0, sizeof(r));
+        r.key = rng_next() % range;
+        r.check = record_check(r.key);
+        snprintf(r.payload, sizeof(r.payload), "rec%u", (unsigned)(i % 100000u));
+        fwrite(&r, sizeof(r), 1, f);
+        sum += r.key;
+    }
+    fclose(f);
+    return sum;
+}
+
+// Confere ordem, quantidade, soma das chaves e integridade dos registros
+static bool output_is_sorted(size_t n, uint64_t sum) {
+    FILE *f = fopen(OUT_PATH, "rb");
+    if (f == NULL) return false;
+    Record r;
+    uint64_t prev = 0;
+    uint64_t got_sum = 0;
+    size_t count = 0;
+    bool ok = true;
+    while (fread(&r, sizeof(r), 1, f) == 1) {
+        if (count > 0 && r.key < prev) ok = false;
+        if (r.check != record_check(r.key)) ok = false;
+        prev = r.key;
+        got_sum += r.key;
+        count++;
+    }
+    fclose(f);
+    return ok && count == n && got_sum == sum;
+}
+
+static bool file_exists(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return false;
+    fclose(f);
+    return true;
+}
+
+static void cleanup(void) {
+    remove(IN_PATH);
+    remove(OUT_PATH);
+}
+
+// ============================================================================
+// TESTES
+// ============================================================================
+
+TEST(in_memory_single_run) {
+    uint64_t sum = write_input(5000, 1000000);
+    ExternalSortStats stats;
+    ASSERT_TRUE(external_sort(IN_PATH, OUT_PATH, sizeof(Record), compare_record, NULL, &stats));
+    ASSERT_EQ(stats.records, (size_t)5000);
+    ASSERT_EQ(stats.runs, (size_t)1);
+    ASSERT_EQ(stats.merge_passes, (size_t)0);
+    ASSERT_TRUE(output_is_sorted(5000, sum));
+    cleanup();
+}
+
+TEST(many_runs_single_merge) {
+    uint64_t sum = write_input(20000, 1u << 30);
+    ExternalSortConfig config = external_sort_default_config();
+    config.memory_bytes = 1000 * sizeof(Record);    // 2 buffers de 500 registros
+    config.io_buffer_bytes = 64 * sizeof(Record);
+    ExternalSortStats stats;
+    ASSERT_TRUE(external_sort(IN_PATH, OUT_PATH, sizeof(Record), compare_record, &config, &stats));
+    ASSERT_EQ(stats.records, (size_t)20000);
+    ASSERT_EQ(stats.runs, (size_t)40);
+    ASSERT_EQ(stats.merge_passes, (size_t)1);
+    ASSERT_TRUE(output_is_sorted(20000, sum));
+    cleanup();
+}
+
+TEST(multi_pass_merge_with_duplicates) {
+    uint64_t sum = write_input(30011, 50);               // muitas chaves iguais
+    ExternalSortConfig config = external_sort_default_config();
+    config.memory_bytes = 300 * sizeof(Record);
+    config.io_buffer_bytes = 10 * sizeof(Record) + 3;    // nao multiplo do registro
+    config.max_fan_in = 4;
+    config.read_ahead = false;
+    config.temp_dir = ".";
+    ExternalSortStats stats;
+    ASSERT_TRUE(external_sort(IN_PATH, OUT_PATH, sizeof(Record), compare_record, &config, &stats));
+    ASSERT_EQ(stats.runs, (size_t)101);                  // ceil(30011 / 300)
+    ASSERT_EQ(stats.merge_passes, (size_t)4);            // 101 -> 26 -> 7 -> 2 -> 1
+    ASSERT_TRUE(output_is_sorted(30011, sum));
+    cleanup();
+}
+
+TEST(exact_multiple_of_buffer) {
+    // Ultimo bloco cheio: o fim do arquivo so aparece na leitura seguinte
+    uint64_t sum = write_input(1024, 1000);
+    ExternalSortConfig config = external_sort_default_config();
+    config.memory_bytes = 1024 * sizeof(Record);
+    config.read_ahead = false;
+    ExternalSortStats stats;
+    ASSERT_TRUE(external_sort(IN_PATH, OUT_PATH, sizeof(Record), compare_record, &config, &stats));
+    ASSERT_EQ(stats.runs, (size_t)1);
+    ASSERT_TRUE(output_is_sorted(1024, sum));
+    cleanup();
+}
+
+TEST(empty_input) {
+    FILE *f = fopen(IN_PATH, "wb");
+    ASSERT_NOT_NULL(f);
+    fclose(f);
+    ExternalSortStats stats;
+    ASSERT_TRUE(external_sort(IN_PATH, OUT_PATH, sizeof(Record), compare_record, NULL, &stats));
+    ASSERT_EQ(stats.records, (size_t)0);
+    ASSERT_TRUE(output_is_sorted(0, 0));
+    cleanup();
+}
+
+TEST(invalid_inputs) {
+    ASSERT_FALSE(external_sort(NULL, OUT_PATH, 8, compare_record, NULL, NULL));
+    ASSERT_FALSE(external_sort(IN_PATH, OUT_PATH, 0, compare_record, NULL, NULL));
+    ASSERT_FALSE(external_sort(IN_PATH, OUT_PATH, 8, NULL, NULL, NULL));
+    ASSERT_FALSE(external_sort(IN_PATH, IN_PATH, 8, compare_record, NULL, NULL));
+    ASSERT_FALSE(external_sort("missing_extsort_input.bin", OUT_PATH, 8, compare_record, NULL, NULL));
+
+    // Registro parcial no fim: falha e nao deixa saida
+    write_input(100, 1000);
+    FILE *f = fopen(IN_PATH, "ab");
+    ASSERT_NOT_NULL(f);
+    fputc('x', f);
+    fclose(f);
+    ASSERT_FALSE(external_sort(IN_PATH, OUT_PATH, sizeof(Record), compare_record, NULL, NULL));
+    ASSERT_FALSE(file_exists(OUT_PATH));
+    cleanup();
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== External Sort Tests ===\n");
+
+    RUN_TEST(in_memory_single_run);
+    RUN_TEST(many_runs_single_merge);
+    RUN_TEST(multi_pass_merge_with_duplicates);
+    RUN_TEST(exact_multiple_of_buffer);
+    RUN_TEST(empty_input);
+    RUN_TEST(invalid_inputs);
+
+    printf("\nAll External Sort tests passed!\n");
+    return 0;
+}
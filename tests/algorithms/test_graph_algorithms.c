@@ -8,9 +8,11 @@
 
 #include "algorithms/graph_algorithms.h"
 #include "data_structures/graph.h"
+#include "data_structures/union_find.h"
 #include "../test_macros.h"
 
 #include <math.h>
+#include <string.h>
 
 #define APPROX_EQ(a, b) ASSERT_TRUE(fabs((a) - (b)) < 0.01)
 
@@ -56,6 +58,53 @@ TEST(dijkstra_unreachable) {
     graph_destroy(g);
 }
 
+TEST(dijkstra_heap_matches_dense) {
+    Graph *g = graph_create(200, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, true);
+    unsigned int seed = 12345;
+    for (size_t u = 0; u < 200; u++) {
+        for (int k = 0; k < 3; k++) {
+            seed = seed * 1103515245u + 12345u;
+            size_t v = (seed >> 8) % 200;
+            double w = (double)((seed >> 16) % 50 + 1);
+            if (v != u) graph_add_edge(g, u, v, w);
+        }
+    }
+
+    ShortestPathResult *dense = dijkstra_with_strategy(g, 0, DIJKSTRA_DENSE);
+    ShortestPathResult *heap = dijkstra_with_strategy(g, 0, DIJKSTRA_BINARY_HEAP);
+    ShortestPathResult *autos = dijkstra(g, 0);
+    ASSERT_NOT_NULL(dense);
+    ASSERT_NOT_NULL(heap);
+    ASSERT_NOT_NULL(autos);
+    for (size_t v = 0; v < 200; v++) {
+        ASSERT_TRUE(dense->dist[v] == heap->dist[v]);
+        ASSERT_TRUE(dense->dist[v] == autos->dist[v]);
+    }
+
+    shortest_path_free(dense);
+    shortest_path_free(heap);
+    shortest_path_free(autos);
+    graph_destroy(g);
+}
+
+TEST(dijkstra_heap_matrix_graph) {
+    Graph *g = graph_create(4, GRAPH_UNDIRECTED, GRAPH_ADJACENCY_MATRIX, true);
+    graph_add_edge(g, 0, 1, 4.0);
+    graph_add_edge(g, 0, 2, 1.0);
+    graph_add_edge(g, 2, 1, 2.0);
+    graph_add_edge(g, 1, 3, 5.0);
+
+    ShortestPathResult *r = dijkstra_with_strategy(g, 0, DIJKSTRA_BINARY_HEAP);
+    ASSERT_NOT_NULL(r);
+    APPROX_EQ(r->dist[1], 3.0);
+    APPROX_EQ(r->dist[3], 8.0);
+    ASSERT_EQ(r->parent[1], 2);
+    ASSERT_NULL(dijkstra_with_strategy(g, 9, DIJKSTRA_BINARY_HEAP));
+
+    shortest_path_free(r);
+    graph_destroy(g);
+}
+
 // ============================================================================
 // BELLMAN-FORD
 // ============================================================================
@@ -99,6 +148,62 @@ TEST(bellman_ford_negative_cycle) {
     graph_destroy(g);
 }
 
+TEST(bellman_ford_spfa_matches_passes) {
+    // w + p(u) - p(v) com w >= 0: varias arestas negativas, sem ciclo negativo
+    unsigned state = 69u;
+    for (size_t t = 0; t < 3; t++) {
+        size_t n = 500;
+        Graph *g = graph_create(n, GRAPH_DIRECTED, t == 2 ? GRAPH_ADJACENCY_MATRIX : GRAPH_ADJACENCY_LIST, true);
+        for (size_t e = 0; e < 4 * n; e++) {
+            state = state * 1103515245u + 12345u;
+            size_t u = (state >> 8) % (n - 20);
+            state = state * 1103515245u + 12345u;
+            size_t v = (state >> 8) % (n - 20);
+            state = state * 1103515245u + 12345u;
+            if (u != v) graph_add_edge(g, u, v, (double)((state >> 16) % 50) + (double)(u % 11) - (double)(v % 11));
+        }
+        ShortestPathResult *ref = bellman_ford(g, 0);
+        ShortestPathResult *r = bellman_ford_spfa(g, 0);
+        ASSERT_NOT_NULL(ref);
+        ASSERT_NOT_NULL(r);
+        ASSERT_FALSE(r->has_negative_cycle);
+        for (size_t v = 0; v < n; v++) {
+            ASSERT_TRUE(r->dist[v] == ref->dist[v]);
+            if (v != 0 && r->dist[v] != GRAPH_INFINITY) {
+                size_t p = r->parent[v];
+                ASSERT_TRUE(r->dist[p] + graph_edge_weight(g, p, v) == r->dist[v]);
+            }
+        }
+        shortest_path_free(ref);
+        shortest_path_free(r);
+
+        // Ciclo negativo longe da origem, depois de um caminho longo
+        graph_add_edge(g, n - 20, n - 19, 1.0);
+        graph_add_edge(g, n - 19, n - 18, -4.0);
+        graph_add_edge(g, n - 18, n - 20, 2.0);
+        r = bellman_ford_spfa(g, 0);
+        ASSERT_FALSE(r->has_negative_cycle);            // ainda inalcancavel
+        shortest_path_free(r);
+        graph_add_edge(g, 1, n - 20, 3.0);
+        r = bellman_ford_spfa(g, 0);
+        ASSERT_TRUE(r->has_negative_cycle);
+        shortest_path_free(r);
+        graph_destroy(g);
+    }
+
+    Graph *g = graph_create(3, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, true);
+    graph_add_edge(g, 0, 1, 1.0);
+    graph_add_edge(g, 1, 2, -3.0);
+    graph_add_edge(g, 2, 0, 1.0);
+    ShortestPathResult *r = bellman_ford_spfa(g, 0);
+    ASSERT_NOT_NULL(r);
+    ASSERT_TRUE(r->has_negative_cycle);
+    shortest_path_free(r);
+    ASSERT_NULL(bellman_ford_spfa(g, 3));
+    ASSERT_NULL(bellman_ford_spfa(NULL, 0));
+    graph_destroy(g);
+}
+
 // ============================================================================
 // FLOYD-WARSHALL
 // ============================================================================
@@ -122,6 +227,85 @@ TEST(floyd_warshall_basic) {
     graph_destroy(g);
 }
 
+TEST(floyd_warshall_blocked_matches_classic) {
+    // Tamanhos em volta do bloco (64); pesos inteiros, grafo esparso com
+    // pares sem caminho
+    const size_t sizes[] = {1, 5, 63, 64, 65, 150};
+    unsigned state = 68u;
+    for (size_t t = 0; t < 6; t++) {
+        size_t n = sizes[t];
+        Graph *g = graph_create(n, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, true);
+        ASSERT_NOT_NULL(g);
+        for (size_t e = 0; e < 3 * n; e++) {
+            state = state * 1103515245u + 12345u;
+            size_t u = (state >> 8) % n;
+            state = state * 1103515245u + 12345u;
+            size_t v = (state >> 8) % n;
+            state = state * 1103515245u + 12345u;
+            // w + p(u) - p(v) com w >= 0: pesos negativos sem ciclo negativo
+            double w = (double)((state >> 16) % 20) + (double)(u % 7) - (double)(v % 7);
+            if (u != v) graph_add_edge(g, u, v, w);
+        }
+        AllPairsResult *ref = floyd_warshall(g);
+        ASSERT_NOT_NULL(ref);
+
+        for (int precision = 0; precision < 2; precision++) {
+            for (size_t threads = 1; threads <= 4; threads += 3) {
+                AllPairsMatrix *r = floyd_warshall_blocked(g, precision ? APSP_FLOAT : APSP_DOUBLE,
+                                                           true, threads);
+                ASSERT_NOT_NULL(r);
+                ASSERT_FALSE(r->has_negative_cycle);
+                ASSERT_TRUE(r->stride % 64 == 0 && r->stride >= n);
+                for (size_t i = 0; i < n; i++) {
+                    for (size_t j = 0; j < n; j++) {
+                        size_t cell = i * r->stride + j;
+                        double d = precision ? (double)r->dist_f[cell] : r->dist[cell];
+                        if (ref->dist[i][j] == GRAPH_INFINITY) {
+                            ASSERT_TRUE(precision ? r->dist_f[cell] == GRAPH_INFINITY_F
+                                                  : r->dist[cell] == GRAPH_INFINITY);
+                            ASSERT_EQ(r->next[cell], GRAPH_NO_NEXT);
+                            continue;
+                        }
+                        ASSERT_TRUE(d == ref->dist[i][j]);
+                        // Caminho pelo next tem o comprimento da distancia
+                        double len = 0.0;
+                        size_t x = i, hops = 0;
+                        while (x != j && hops <= n) {
+                            size_t y = r->next[x * r->stride + j];
+                            ASSERT_TRUE(y < n);
+                            len += graph_edge_weight(g, x, y);
+                            x = y;
+                            hops++;
+                        }
+                        ASSERT_TRUE(x == j);
+                        ASSERT_TRUE(len == ref->dist[i][j]);
+                    }
+                }
+                all_pairs_matrix_free(r);
+            }
+        }
+        AllPairsMatrix *bare = floyd_warshall_blocked(g, APSP_DOUBLE, false, 1);
+        ASSERT_NOT_NULL(bare);
+        ASSERT_NULL(bare->next);
+        ASSERT_NULL(bare->dist_f);
+        ASSERT_TRUE(bare->dist[(n - 1) * bare->stride] == ref->dist[n - 1][0]);
+        all_pairs_matrix_free(bare);
+        all_pairs_free(ref);
+        graph_destroy(g);
+    }
+
+    Graph *neg = graph_create(3, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, true);
+    graph_add_edge(neg, 0, 1, 1.0);
+    graph_add_edge(neg, 1, 2, -3.0);
+    graph_add_edge(neg, 2, 0, 1.0);
+    AllPairsMatrix *r = floyd_warshall_blocked(neg, APSP_DOUBLE, false, 1);
+    ASSERT_NOT_NULL(r);
+    ASSERT_TRUE(r->has_negative_cycle);
+    all_pairs_matrix_free(r);
+    graph_destroy(neg);
+    ASSERT_NULL(floyd_warshall_blocked(NULL, APSP_DOUBLE, true, 1));
+}
+
 // ============================================================================
 // KRUSKAL
 // ============================================================================
@@ -189,6 +373,735 @@ TEST(kruskal_prim_agree) {
     graph_destroy(g);
 }
 
+// ============================================================================
+// VARIANTES CSR
+// ============================================================================
+
+TEST(csr_shortest_paths) {
+    Graph *g = graph_create(5, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, true);
+    graph_add_edge(g, 0, 1, 6.0);
+    graph_add_edge(g, 0, 3, 7.0);
+    graph_add_edge(g, 1, 2, 5.0);
+    graph_add_edge(g, 1, 3, 8.0);
+    graph_add_edge(g, 1, 4, 4.0);
+    graph_add_edge(g, 2, 1, 2.0);
+    graph_add_edge(g, 3, 2, 3.0);
+    graph_add_edge(g, 3, 4, 9.0);
+    graph_add_edge(g, 4, 2, 7.0);
+
+    CSRGraph *csr = graph_freeze(g);
+    ShortestPathResult *ref = dijkstra(g, 0);
+    ShortestPathResult *dj = dijkstra_csr(csr, 0);
+    ShortestPathResult *bf = bellman_ford_csr(csr, 0);
+    ASSERT_NOT_NULL(dj);
+    ASSERT_NOT_NULL(bf);
+    ASSERT_FALSE(bf->has_negative_cycle);
+    for (size_t v = 0; v < 5; v++) {
+        APPROX_EQ(dj->dist[v], ref->dist[v]);
+        APPROX_EQ(bf->dist[v], ref->dist[v]);
+    }
+
+    shortest_path_free(ref);
+    shortest_path_free(dj);
+    shortest_path_free(bf);
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+TEST(csr_bellman_ford_negative_cycle) {
+    Graph *g = graph_create(3, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, true);
+    graph_add_edge(g, 0, 1, 1.0);
+    graph_add_edge(g, 1, 2, -3.0);
+    graph_add_edge(g, 2, 0, 1.0);
+
+    CSRGraph *csr = graph_freeze(g);
+    ShortestPathResult *r = bellman_ford_csr(csr, 0);
+    ASSERT_NOT_NULL(r);
+    ASSERT_TRUE(r->has_negative_cycle);
+
+    shortest_path_free(r);
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+TEST(csr_mst) {
+    Graph *g = graph_create(6, GRAPH_UNDIRECTED, GRAPH_ADJACENCY_LIST, true);
+    graph_add_edge(g, 0, 1, 4.0);
+    graph_add_edge(g, 0, 2, 4.0);
+    graph_add_edge(g, 1, 2, 2.0);
+    graph_add_edge(g, 1, 3, 6.0);
+    graph_add_edge(g, 2, 3, 8.0);
+    graph_add_edge(g, 2, 4, 9.0);
+    graph_add_edge(g, 3, 4, 5.0);
+    graph_add_edge(g, 3, 5, 1.0);
+    graph_add_edge(g, 4, 5, 7.0);
+
+    CSRGraph *csr = graph_freeze(g);
+    MSTResult *rk = kruskal_csr(csr);
+    MSTResult *rp = prim_csr(csr);
+    ASSERT_NOT_NULL(rk);
+    ASSERT_NOT_NULL(rp);
+    ASSERT_EQ(rk->num_edges, 5);
+    ASSERT_EQ(rp->num_edges, 5);
+    APPROX_EQ(rk->total_weight, 18.0);
+    APPROX_EQ(rp->total_weight, 18.0);
+
+    mst_free(rk);
+    mst_free(rp);
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+TEST(mst_variants_agree) {
+    // Grafos aleatorios com pesos repetidos, varias componentes e lacos
+    unsigned state = 64u;
+    for (int trial = 0; trial < 12; trial++) {
+        size_t n = (trial < 6) ? 40 : 3000;
+        size_t m = n * (size_t)(1 + trial % 4) * 2;
+        Graph *g = graph_create(n, GRAPH_UNDIRECTED, GRAPH_ADJACENCY_LIST, true);
+        ASSERT_NOT_NULL(g);
+        // Caminho pesado liga os 90% iniciais (Prim so cobre a componente de 0)
+        for (size_t v = 1; v < n - n / 10; v++) graph_add_edge(g, v - 1, v, 1000.0);
+        for (size_t e = 0; e < m; e++) {
+            state = state * 1103515245u + 12345u;
+            size_t u = (state >> 8) % (n - n / 10);            // ultimos 10% isolados
+            state = state * 1103515245u + 12345u;
+            size_t v = (state >> 8) % (n - n / 10);
+            state = state * 1103515245u + 12345u;
+            double w = (double)((state >> 16) % (trial % 2 ? 5 : 1000));
+            graph_add_edge(g, u, v, w);
+        }
+        CSRGraph *csr = graph_freeze(g);
+        ASSERT_NOT_NULL(csr);
+        MSTResult *reference = prim_csr(csr);
+        MSTResult *variants[] = {
+            kruskal(g), kruskal_csr(csr), filter_kruskal_csr(csr),
+            boruvka_csr(csr, 1), boruvka_csr(csr, 4)
+        };
+        ASSERT_NOT_NULL(reference);
+        for (size_t k = 0; k < 5; k++) {
+            ASSERT_NOT_NULL(variants[k]);
+            ASSERT_TRUE(fabs(variants[k]->total_weight - reference->total_weight) < 1e-6);
+            // Floresta: pontas nunca repetem uma componente ja unida
+            UnionFind *uf = uf_create(n);
+            ASSERT_NOT_NULL(uf);
+            for (size_t e = 0; e < variants[k]->num_edges; e++) {
+                ASSERT_TRUE(uf_union(uf, variants[k]->edges[e].u, variants[k]->edges[e].v));
+            }
+            uf_destroy(uf);
+            mst_free(variants[k]);
+        }
+        mst_free(reference);
+        graph_csr_destroy(csr);
+        graph_destroy(g);
+    }
+}
+
+TEST(bfs_csr_direction_optimizing) {
+    // Nucleo denso (a fronteira explode e o bottom-up entra) mais uma cauda
+    // longa (volta ao top-down) e vertices isolados; dist contra Dijkstra
+    unsigned state = 66u;
+    const GraphType types[] = {GRAPH_UNDIRECTED, GRAPH_DIRECTED};
+    for (size_t t = 0; t < 2; t++) {
+        size_t n = 4000, core = 3000, tail_end = 3900;
+        Graph *g = graph_create(n, types[t], GRAPH_ADJACENCY_LIST, false);
+        ASSERT_NOT_NULL(g);
+        for (size_t e = 0; e < core * 12; e++) {
+            state = state * 1103515245u + 12345u;
+            size_t u = (state >> 8) % core;
+            state = state * 1103515245u + 12345u;
+            graph_add_edge(g, u, (state >> 8) % core, 1.0);
+        }
+        for (size_t v = core; v < tail_end; v++) graph_add_edge(g, v - 1, v, 1.0);
+        CSRGraph *csr = graph_freeze(g);
+        ASSERT_NOT_NULL(csr);
+
+        ShortestPathResult *ref = dijkstra_csr(csr, 0);
+        ASSERT_NOT_NULL(ref);
+        size_t reached = 0;
+        for (size_t v = 0; v < n; v++) reached += ref->dist[v] != GRAPH_INFINITY;
+
+        const size_t threads[] = {1, 4};
+        for (size_t k = 0; k < 2; k++) {
+            BFSResult *r = bfs_csr(csr, 0, threads[k]);
+            ASSERT_NOT_NULL(r);
+            ASSERT_EQ(r->num_vertices, n);
+            ASSERT_EQ(r->num_reached, reached);
+            ASSERT_EQ(r->parent[0], GRAPH_NO_PARENT);
+            for (size_t v = 0; v < n; v++) {
+                if (ref->dist[v] == GRAPH_INFINITY) {
+                    ASSERT_EQ(r->dist[v], GRAPH_UNREACHED);
+                    ASSERT_EQ(r->parent[v], GRAPH_NO_PARENT);
+                    continue;
+                }
+                ASSERT_EQ(r->dist[v], (size_t)ref->dist[v]);
+                if (v != 0) {
+                    // Pai na camada anterior e ligado a v por um arco
+                    size_t p = r->parent[v];
+                    ASSERT_TRUE(p < n);
+                    ASSERT_EQ(r->dist[p] + 1, r->dist[v]);
+                    ASSERT_TRUE(graph_has_edge(g, p, v));
+                }
+            }
+            bfs_free(r);
+        }
+        shortest_path_free(ref);
+        graph_csr_destroy(csr);
+        graph_destroy(g);
+    }
+}
+
+TEST(delta_stepping_matches_dijkstra) {
+    // Pesos inteiros pequenos (somas exatas, muitos empates e zeros) e reais
+    unsigned state = 67u;
+    const GraphType types[] = {GRAPH_UNDIRECTED, GRAPH_DIRECTED};
+    const double deltas[] = {0.0, 0.5, 7.0, 1e6};
+    for (size_t trial = 0; trial < 4; trial++) {
+        size_t n = 3000, m = 12000;
+        Graph *g = graph_create(n, types[trial % 2], GRAPH_ADJACENCY_LIST, true);
+        ASSERT_NOT_NULL(g);
+        for (size_t e = 0; e < m; e++) {
+            state = state * 1103515245u + 12345u;
+            size_t u = (state >> 8) % (n - 100);               // ultimos 100 isolados
+            state = state * 1103515245u + 12345u;
+            size_t v = (state >> 8) % (n - 100);
+            state = state * 1103515245u + 12345u;
+            double w = (trial < 2) ? (double)((state >> 16) % 10) : (double)(state >> 8) / 65536.0;
+            graph_add_edge(g, u, v, w);
+        }
+        CSRGraph *csr = graph_freeze(g);
+        ASSERT_NOT_NULL(csr);
+        ShortestPathResult *ref = dijkstra_csr(csr, 0);
+        ASSERT_NOT_NULL(ref);
+
+        for (size_t d = 0; d < 4; d++) {
+            for (size_t threads = 1; threads <= 4; threads += 3) {
+                ShortestPathResult *r = delta_stepping_csr(csr, 0, deltas[d], threads);
+                ASSERT_NOT_NULL(r);
+                ASSERT_FALSE(r->has_negative_cycle);
+                ASSERT_EQ(r->parent[0], GRAPH_NO_PARENT);
+                for (size_t v = 0; v < n; v++) {
+                    if (ref->dist[v] == GRAPH_INFINITY) {
+                        ASSERT_TRUE(r->dist[v] == GRAPH_INFINITY);
+                        ASSERT_EQ(r->parent[v], GRAPH_NO_PARENT);
+                        continue;
+                    }
+                    ASSERT_TRUE(fabs(r->dist[v] - ref->dist[v]) <= 1e-9 * (1.0 + ref->dist[v]));
+                    if (v == 0) continue;
+                    // Pai justo e cadeia ate a origem sem ciclos
+                    size_t p = r->parent[v];
+                    ASSERT_TRUE(p < n);
+                    ASSERT_TRUE(r->dist[p] + graph_edge_weight(g, p, v) == r->dist[v]);
+                    size_t hops = 0;
+                    for (size_t x = v; x != 0 && hops <= n; x = r->parent[x]) hops++;
+                    ASSERT_TRUE(hops <= n);
+                }
+                shortest_path_free(r);
+            }
+        }
+        shortest_path_free(ref);
+        graph_csr_destroy(csr);
+        graph_destroy(g);
+    }
+
+    Graph *neg = graph_create(3, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, true);
+    graph_add_edge(neg, 0, 1, 2.0);
+    graph_add_edge(neg, 1, 2, -1.0);
+    CSRGraph *csr = graph_freeze(neg);
+    ASSERT_NULL(delta_stepping_csr(csr, 0, 1.0, 1));
+    ASSERT_NULL(delta_stepping_csr(csr, 3, 1.0, 1));
+    graph_csr_destroy(csr);
+    graph_destroy(neg);
+}
+
+TEST(bfs_csr_small) {
+    Graph *g = graph_create(5, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, false);
+    graph_add_edge(g, 0, 1, 1.0);
+    graph_add_edge(g, 1, 2, 1.0);
+    graph_add_edge(g, 0, 2, 1.0);
+    graph_add_edge(g, 3, 0, 1.0);
+    CSRGraph *csr = graph_freeze(g);
+    BFSResult *r = bfs_csr(csr, 0, 1);
+    ASSERT_NOT_NULL(r);
+    ASSERT_EQ(r->dist[0], 0);
+    ASSERT_EQ(r->dist[1], 1);
+    ASSERT_EQ(r->dist[2], 1);
+    ASSERT_EQ(r->parent[2], 0);
+    ASSERT_EQ(r->dist[3], GRAPH_UNREACHED);
+    ASSERT_EQ(r->num_reached, 3);
+    bfs_free(r);
+    ASSERT_NULL(bfs_csr(csr, 5, 1));
+    ASSERT_NULL(bfs_csr(NULL, 0, 1));
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+// Caminho devolvido: comeca/termina nas pontas e seus arcos somam dist
+static bool path_is_tight(const Graph *g, const PathSearch *ps, Vertex s, Vertex t, double dist) {
+    static Vertex path[4000];
+    size_t len = path_search_path(ps, path, 4000);
+    if (len == 0 || len > 4000 || path[0] != s || path[len - 1] != t) return false;
+    if (path_search_path(ps, path, len - 1) != len) return false;
+    double sum = 0.0;
+    for (size_t i = 1; i < len; i++) {
+        if (!graph_has_edge(g, path[i - 1], path[i])) return false;
+        sum += graph_edge_weight(g, path[i - 1], path[i]);
+    }
+    return fabs(sum - dist) <= 1e-9 * (1.0 + dist);
+}
+
+typedef struct {
+    size_t side;
+} GridInfo;
+
+static double grid_euclidean(Vertex v, Vertex target, void *user_data) {
+    size_t side = ((const GridInfo *)user_data)->side;
+    double dx = (double)(v % side) - (double)(target % side);
+    double dy = (double)(v / side) - (double)(target / side);
+    return sqrt(dx * dx + dy * dy);
+}
+
+TEST(point_to_point_matches_dijkstra) {
+    unsigned state = 70u;
+    const GraphType types[] = {GRAPH_UNDIRECTED, GRAPH_DIRECTED};
+    for (size_t trial = 0; trial < 2; trial++) {
+        size_t n = 2000, m = 6000;
+        Graph *g = graph_create(n, types[trial], GRAPH_ADJACENCY_LIST, true);
+        ASSERT_NOT_NULL(g);
+        for (size_t e = 0; e < m; e++) {
+            state = state * 1103515245u + 12345u;
+            size_t u = (state >> 8) % (n - 50);                // ultimos 50 isolados
+            state = state * 1103515245u + 12345u;
+            size_t v = (state >> 8) % (n - 50);
+            state = state * 1103515245u + 12345u;
+            graph_add_edge(g, u, v, (double)((state >> 16) % 20));
+        }
+        CSRGraph *csr = graph_freeze(g);
+        PathSearch *ps = path_search_create(csr);
+        ASSERT_NOT_NULL(ps);
+
+        // O mesmo espaco de trabalho atende todas as consultas
+        for (size_t q = 0; q < 8; q++) {
+            Vertex s = (q * 257) % n;
+            ShortestPathResult *ref = dijkstra_csr(csr, s);
+            ASSERT_NOT_NULL(ref);
+            for (Vertex t = 0; t < n; t += 13) {
+                double bi = path_search_bidirectional(ps, s, t);
+                double a = path_search_astar(ps, s, t, NULL, NULL);
+                if (ref->dist[t] == GRAPH_INFINITY) {
+                    ASSERT_TRUE(bi == GRAPH_INFINITY);
+                    ASSERT_TRUE(a == GRAPH_INFINITY);
+                    ASSERT_EQ(path_search_path(ps, NULL, 0), 0);
+                    continue;
+                }
+                ASSERT_TRUE(a == ref->dist[t]);
+                ASSERT_TRUE(path_is_tight(g, ps, s, t, a));
+                ASSERT_TRUE(bi == ref->dist[t]);
+                path_search_bidirectional(ps, s, t);
+                ASSERT_TRUE(path_is_tight(g, ps, s, t, bi));
+            }
+            shortest_path_free(ref);
+        }
+
+        ASSERT_TRUE(path_search_bidirectional(ps, 5, 5) == 0.0);
+        ASSERT_EQ(path_search_path(ps, NULL, 0), 1);
+        ASSERT_TRUE(path_search_bidirectional(ps, 0, n) == GRAPH_INFINITY);
+        ASSERT_TRUE(path_search_astar(NULL, 0, 1, NULL, NULL) == GRAPH_INFINITY);
+        path_search_destroy(ps);
+        graph_csr_destroy(csr);
+        graph_destroy(g);
+    }
+
+    Graph *neg = graph_create(2, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, true);
+    graph_add_edge(neg, 0, 1, -1.0);
+    CSRGraph *csr = graph_freeze(neg);
+    ASSERT_NULL(path_search_create(csr));
+    ASSERT_NULL(path_search_create(NULL));
+    graph_csr_destroy(csr);
+    graph_destroy(neg);
+}
+
+TEST(point_to_point_stops_early) {
+    // Grade 60x60 com pesos >= comprimento euclidiano: heuristica consistente
+    GridInfo info = {60};
+    size_t n = info.side * info.side;
+    Graph *g = graph_create(n, GRAPH_UNDIRECTED, GRAPH_ADJACENCY_LIST, true);
+    ASSERT_NOT_NULL(g);
+    for (size_t v = 0; v < n; v++) {
+        double w = 1.0 + (double)((v * 7) % 3) / 4.0;
+        if (v % info.side + 1 < info.side) graph_add_edge(g, v, v + 1, w);
+        if (v + info.side < n) graph_add_edge(g, v, v + info.side, w);
+    }
+    CSRGraph *csr = graph_freeze(g);
+    PathSearch *ps = path_search_create(csr);
+    ASSERT_NOT_NULL(ps);
+
+    const Vertex pairs[][2] = {{0, n - 1}, {1830, 1835}, {61, 3538}};
+    for (size_t k = 0; k < 3; k++) {
+        Vertex s = pairs[k][0], t = pairs[k][1];
+        ShortestPathResult *ref = dijkstra_csr(csr, s);
+        double plain = path_search_astar(ps, s, t, NULL, NULL);
+        size_t plain_settled = path_search_settled(ps);
+        double a = path_search_astar(ps, s, t, grid_euclidean, &info);
+        ASSERT_TRUE(path_is_tight(g, ps, s, t, a));
+        size_t astar_settled = path_search_settled(ps);
+        double bi = path_search_bidirectional(ps, s, t);
+        ASSERT_TRUE(path_is_tight(g, ps, s, t, bi));
+        ASSERT_TRUE(fabs(a - ref->dist[t]) < 1e-9);
+        ASSERT_TRUE(fabs(bi - ref->dist[t]) < 1e-9);
+        ASSERT_TRUE(plain == ref->dist[t]);
+        ASSERT_TRUE(astar_settled <= plain_settled);
+        if (k == 1) {                                   // pontas proximas: bola pequena
+            ASSERT_TRUE(plain_settled < n / 10);
+            ASSERT_TRUE(path_search_settled(ps) < n / 10);
+        }
+        shortest_path_free(ref);
+    }
+    path_search_destroy(ps);
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+TEST(contraction_hierarchy_matches_dijkstra) {
+    static Vertex path[5000];
+    unsigned state = 71u;
+    for (size_t trial = 0; trial < 3; trial++) {
+        // 0: grade com diagonais esparsas; 1: digrafo aleatorio; 2: nao direcionado aleatorio
+        size_t side = 40, n = (trial == 0) ? side * side : 1500;
+        GraphType type = (trial == 1) ? GRAPH_DIRECTED : GRAPH_UNDIRECTED;
+        Graph *g = graph_create(n, type, GRAPH_ADJACENCY_LIST, true);
+        ASSERT_NOT_NULL(g);
+        if (trial == 0) {
+            for (size_t v = 0; v < n; v++) {
+                double w = 1.0 + (double)((v * 7) % 5);
+                if (v % side + 1 < side) graph_add_edge(g, v, v + 1, w);
+                if (v + side < n) graph_add_edge(g, v, v + side, w + 0.5);
+                if (v % 17 == 0 && v % side + 1 < side && v + side < n) graph_add_edge(g, v, v + side + 1, 1.0);
+            }
+        } else {
+            for (size_t e = 0; e < 4 * n; e++) {
+                state = state * 1103515245u + 12345u;
+                size_t u = (state >> 8) % (n - 20);            // ultimos 20 isolados
+                state = state * 1103515245u + 12345u;
+                size_t v = (state >> 8) % (n - 20);
+                state = state * 1103515245u + 12345u;
+                if (u != v && !graph_has_edge(g, u, v)) graph_add_edge(g, u, v, (double)((state >> 16) % 30));
+            }
+        }
+        CSRGraph *csr = graph_freeze(g);
+        ContractionHierarchy *ch = contraction_hierarchy_build(csr);
+        ASSERT_NOT_NULL(ch);
+        graph_csr_destroy(csr);                             // a hierarquia nao depende do snapshot
+        csr = graph_freeze(g);
+
+        for (size_t q = 0; q < 6; q++) {
+            Vertex s = (q * 331 + trial) % n;
+            ShortestPathResult *ref = dijkstra_csr(csr, s);
+            ASSERT_NOT_NULL(ref);
+            for (Vertex t = 0; t < n; t += 7) {
+                double d = contraction_hierarchy_query(ch, s, t);
+                if (ref->dist[t] == GRAPH_INFINITY) {
+                    ASSERT_TRUE(d == GRAPH_INFINITY);
+                    ASSERT_EQ(contraction_hierarchy_path(ch, NULL, 0), 0);
+                    continue;
+                }
+                ASSERT_TRUE(fabs(d - ref->dist[t]) <= 1e-9 * (1.0 + d));
+                size_t len = contraction_hierarchy_path(ch, path, 5000);
+                ASSERT_TRUE(len > 0 && len <= 5000);
+                ASSERT_EQ(path[0], s);
+                ASSERT_EQ(path[len - 1], t);
+                double sum = 0.0;
+                for (size_t i = 1; i < len; i++) {
+                    ASSERT_TRUE(graph_has_edge(g, path[i - 1], path[i]));
+                    sum += graph_edge_weight(g, path[i - 1], path[i]);
+                }
+                ASSERT_TRUE(fabs(sum - d) <= 1e-9 * (1.0 + d));
+            }
+            shortest_path_free(ref);
+        }
+        ASSERT_TRUE(contraction_hierarchy_query(ch, 3, 3) == 0.0);
+        ASSERT_EQ(contraction_hierarchy_path(ch, path, 1), 1);
+        ASSERT_TRUE(contraction_hierarchy_query(ch, 0, n) == GRAPH_INFINITY);
+        if (trial == 0) ASSERT_TRUE(contraction_hierarchy_settled(ch) < n / 4);
+        contraction_hierarchy_destroy(ch);
+        graph_csr_destroy(csr);
+        graph_destroy(g);
+    }
+
+    Graph *neg = graph_create(2, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, true);
+    graph_add_edge(neg, 0, 1, -1.0);
+    CSRGraph *csr = graph_freeze(neg);
+    ASSERT_NULL(contraction_hierarchy_build(csr));
+    ASSERT_NULL(contraction_hierarchy_build(NULL));
+    graph_csr_destroy(csr);
+    graph_destroy(neg);
+}
+
+TEST(scc_csr_parallel_matches_tarjan) {
+    unsigned state = 72u;
+    for (size_t trial = 0; trial < 3; trial++) {
+        // 0: digrafo esparso (muitos unitarios); 1: denso (gigante); 2: nao direcionado
+        size_t n = 4000, m = (trial == 1) ? 12000 : 5000;
+        Graph *g = graph_create(n, (trial == 2) ? GRAPH_UNDIRECTED : GRAPH_DIRECTED,
+                                GRAPH_ADJACENCY_LIST, false);
+        ASSERT_NOT_NULL(g);
+        for (size_t e = 0; e < m; e++) {
+            state = state * 1103515245u + 12345u;
+            size_t u = (state >> 8) % n;
+            state = state * 1103515245u + 12345u;
+            size_t v = (trial == 2) ? (state >> 8) % n : (u + 1 + (state >> 8) % 40) % n;
+            graph_add_edge(g, u, v, 1.0);
+        }
+        CSRGraph *csr = graph_freeze(g);
+        size_t *ref = NULL, k = 0;
+        ASSERT_EQ(graph_csr_strongly_connected_components(csr, &ref, &k), DS_SUCCESS);
+
+        for (size_t threads = 1; threads <= 4; threads += 3) {
+            SCCResult *r = scc_csr_parallel(csr, threads);
+            ASSERT_NOT_NULL(r);
+            ASSERT_EQ(r->num_components, k);
+            ASSERT_EQ(r->num_vertices, n);
+            // Rotulos pela ordem do menor vertice: comparacao direta com o mapa de ref
+            size_t *map = malloc(k * sizeof(size_t));
+            ASSERT_NOT_NULL(map);
+            for (size_t c = 0; c < k; c++) map[c] = (size_t)-1;
+            size_t next = 0;
+            for (size_t v = 0; v < n; v++) {
+                if (map[ref[v]] == (size_t)-1) map[ref[v]] = next++;
+                ASSERT_EQ(r->component[v], map[ref[v]]);
+            }
+            free(map);
+            scc_free(r);
+        }
+        free(ref);
+        graph_csr_destroy(csr);
+        graph_destroy(g);
+    }
+    ASSERT_NULL(scc_csr_parallel(NULL, 1));
+}
+
+// ============================================================================
+// CONSTRUCAO EM LOTE
+// ============================================================================
+
+static int compare_edge_triple(const void *a, const void *b) {
+    const Edge *x = (const Edge *)a, *y = (const Edge *)b;
+    if (x->src != y->src) return (x->src < y->src) ? -1 : 1;
+    if (x->dest != y->dest) return (x->dest < y->dest) ? -1 : 1;
+    return (x->weight > y->weight) - (x->weight < y->weight);
+}
+
+TEST(build_from_edges_matches_reference) {
+    const size_t n = 9000, m = 30000;
+    Edge *edges = malloc(m * sizeof(Edge));
+    Edge *ref = malloc(2 * m * sizeof(Edge));
+    ASSERT_NOT_NULL(edges);
+    ASSERT_NOT_NULL(ref);
+    unsigned state = 75u;
+    for (size_t i = 0; i < m; i++) {
+        state = state * 1103515245u + 12345u;
+        edges[i].src = (state >> 8) % n;
+        state = state * 1103515245u + 12345u;
+        // Destinos proximos: repeticoes e auto-lacos frequentes
+        edges[i].dest = (edges[i].src + (state >> 8) % 4) % n;
+        edges[i].weight = (double)(1 + (state >> 4) % 5);
+    }
+
+    for (size_t mode = 0; mode < 8; mode++) {
+        GraphType type = (mode & 1) ? GRAPH_UNDIRECTED : GRAPH_DIRECTED;
+        bool dedup = (mode & 2) != 0, drop = (mode & 4) != 0;
+
+        // Referencia: arcos expandidos, ordenados por (src, dest, peso)
+        size_t count = 0;
+        for (size_t i = 0; i < m; i++) {
+            Edge e = edges[i];
+            if (drop && e.src == e.dest) continue;
+            ref[count++] = e;
+            if (type == GRAPH_UNDIRECTED && e.src != e.dest) {
+                ref[count].src = e.dest;
+                ref[count].dest = e.src;
+                ref[count++].weight = e.weight;
+            }
+        }
+        qsort(ref, count, sizeof(Edge), compare_edge_triple);
+        if (dedup) {
+            size_t w = 0;
+            for (size_t i = 0; i < count; i++) {
+                if (w == 0 || ref[i].src != ref[w - 1].src || ref[i].dest != ref[w - 1].dest)
+                    ref[w++] = ref[i];
+            }
+            count = w;
+        }
+
+        for (size_t threads = 1; threads <= 4; threads += 3) {
+            CSRGraph *csr = graph_build_from_edges(edges, m, n, type, dedup, drop, threads);
+            ASSERT_NOT_NULL(csr);
+            ASSERT_EQ(graph_csr_num_vertices(csr), n);
+            size_t k = 0;
+            for (Vertex u = 0; u < n; u++) {
+                const Vertex *dests;
+                const double *weights;
+                size_t deg;
+                ASSERT_EQ(graph_csr_neighbors(csr, u, &dests, &weights, &deg), DS_SUCCESS);
+                for (size_t i = 0; i < deg; i++, k++) {
+                    ASSERT_TRUE(k < count);
+                    ASSERT_EQ(ref[k].src, u);
+                    ASSERT_EQ(ref[k].dest, dests[i]);
+                    ASSERT_EQ(ref[k].weight, weights[i]);
+                }
+            }
+            ASSERT_EQ(k, count);
+
+            // Com dedup a contagem e a mesma de um Graph montado aresta a aresta
+            if (dedup) {
+                Graph *g = graph_create(n, type, GRAPH_ADJACENCY_LIST, true);
+                ASSERT_NOT_NULL(g);
+                for (size_t i = 0; i < m; i++) {
+                    if (!drop || edges[i].src != edges[i].dest)
+                        graph_add_edge(g, edges[i].src, edges[i].dest, edges[i].weight);
+                }
+                ASSERT_EQ(graph_csr_num_edges(csr), graph_num_edges(g));
+                graph_destroy(g);
+            }
+            graph_csr_destroy(csr);
+        }
+    }
+
+    CSRGraph *empty = graph_build_from_edges(NULL, 0, 3, GRAPH_DIRECTED, false, false, 1);
+    ASSERT_NOT_NULL(empty);
+    ASSERT_EQ(graph_csr_num_edges(empty), 0);
+    ASSERT_EQ(graph_csr_out_degree(empty, 2), 0);
+    graph_csr_destroy(empty);
+    edges[0].dest = n;
+    ASSERT_NULL(graph_build_from_edges(edges, m, n, GRAPH_DIRECTED, false, false, 1));
+    ASSERT_NULL(graph_build_from_edges(NULL, 1, n, GRAPH_DIRECTED, false, false, 1));
+    free(edges);
+    free(ref);
+}
+
+// ============================================================================
+// PAGERANK E SpMV
+// ============================================================================
+
+// Iteracao de potencia densa (push), a mesma formula de pagerank_csr
+static void pagerank_reference(const CSRGraph *csr, double d, size_t iterations, double *rank) {
+    size_t n = graph_csr_num_vertices(csr);
+    double *next = malloc(n * sizeof(double));
+    for (size_t v = 0; v < n; v++) rank[v] = 1.0 / (double)n;
+    for (size_t it = 0; it < iterations; it++) {
+        double dangling = 0.0;
+        for (size_t u = 0; u < n; u++) {
+            if (graph_csr_out_degree(csr, u) == 0) dangling += rank[u];
+        }
+        for (size_t v = 0; v < n; v++) next[v] = (1.0 - d) / (double)n + d * dangling / (double)n;
+        for (size_t u = 0; u < n; u++) {
+            const Vertex *dests;
+            size_t deg;
+            graph_csr_neighbors(csr, u, &dests, NULL, &deg);
+            for (size_t i = 0; i < deg; i++) next[dests[i]] += d * rank[u] / (double)deg;
+        }
+        memcpy(rank, next, n * sizeof(double));
+    }
+    free(next);
+}
+
+TEST(pagerank_matches_power_iteration) {
+    // Ciclo: distribuicao uniforme em qualquer precisao
+    Graph *cycle = graph_create(3, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, false);
+    graph_add_edge(cycle, 0, 1, 1.0);
+    graph_add_edge(cycle, 1, 2, 1.0);
+    graph_add_edge(cycle, 2, 0, 1.0);
+    CSRGraph *c = graph_freeze(cycle);
+    PageRankResult *r = pagerank_csr(c, 0.85, 1e-12, 100, APSP_DOUBLE, 1);
+    ASSERT_NOT_NULL(r);
+    ASSERT_TRUE(r->converged);
+    for (size_t v = 0; v < 3; v++) ASSERT_TRUE(fabs(r->rank[v] - 1.0 / 3.0) < 1e-12);
+    pagerank_free(r);
+    graph_csr_destroy(c);
+    graph_destroy(cycle);
+
+    // Digrafo aleatorio com vertices dangling e um nao direcionado
+    const size_t n = 3000;
+    unsigned state = 76u;
+    for (size_t trial = 0; trial < 2; trial++) {
+        GraphType type = trial ? GRAPH_UNDIRECTED : GRAPH_DIRECTED;
+        Graph *g = graph_create(n, type, GRAPH_ADJACENCY_LIST, false);
+        for (size_t e = 0; e < 4 * n; e++) {
+            state = state * 1103515245u + 12345u;
+            size_t u = (state >> 8) % n;
+            state = state * 1103515245u + 12345u;
+            if (u % 7 != 0) graph_add_edge(g, u, (state >> 8) % n, 1.0);
+        }
+        CSRGraph *csr = graph_freeze(g);
+        double *ref = malloc(n * sizeof(double));
+        ASSERT_NOT_NULL(ref);
+        pagerank_reference(csr, 0.85, 30, ref);
+
+        for (size_t threads = 1; threads <= 4; threads += 3) {
+            PageRankResult *pr = pagerank_csr(csr, 0.85, 0.0, 30, APSP_DOUBLE, threads);
+            ASSERT_NOT_NULL(pr);
+            ASSERT_EQ(pr->iterations, 30);
+            ASSERT_FALSE(pr->converged);
+            ASSERT_NULL(pr->rank_f);
+            double sum = 0.0;
+            for (size_t v = 0; v < n; v++) {
+                ASSERT_TRUE(fabs(pr->rank[v] - ref[v]) < 1e-12);
+                sum += pr->rank[v];
+            }
+            ASSERT_TRUE(fabs(sum - 1.0) < 1e-9);
+            pagerank_free(pr);
+
+            pr = pagerank_csr(csr, 0.85, 1e-6, 200, APSP_FLOAT, threads);
+            ASSERT_NOT_NULL(pr);
+            ASSERT_TRUE(pr->converged);
+            ASSERT_TRUE(pr->residual < 1e-6);
+            ASSERT_NULL(pr->rank);
+            for (size_t v = 0; v < n; v++) ASSERT_TRUE(fabs(pr->rank_f[v] - ref[v]) < 1e-5);
+            pagerank_free(pr);
+        }
+        free(ref);
+        graph_csr_destroy(csr);
+        graph_destroy(g);
+    }
+
+    ASSERT_NULL(pagerank_csr(NULL, 0.85, 1e-6, 10, APSP_DOUBLE, 1));
+    Graph *g = graph_create(2, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, false);
+    CSRGraph *csr = graph_freeze(g);
+    ASSERT_NULL(pagerank_csr(csr, 1.5, 1e-6, 10, APSP_DOUBLE, 1));
+    r = pagerank_csr(csr, 0.85, 1e-6, 10, APSP_DOUBLE, 1);
+    ASSERT_NOT_NULL(r);
+    ASSERT_TRUE(fabs(r->rank[0] - 0.5) < 1e-12);  // so dangling: uniforme
+    pagerank_free(r);
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+TEST(spmv_csr_matches_manual) {
+    Graph *g = graph_create(4, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, true);
+    graph_add_edge(g, 0, 1, 2.0);
+    graph_add_edge(g, 0, 2, -1.0);
+    graph_add_edge(g, 1, 3, 0.5);
+    graph_add_edge(g, 3, 3, 4.0);
+    CSRGraph *csr = graph_freeze(g);
+    const double x[4] = {1.0, 2.0, 3.0, 4.0};
+    const float xf[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+    const double expected[4] = {1.0, 2.0, 0.0, 16.0};
+    double y[4];
+    float yf[4];
+    for (size_t threads = 1; threads <= 4; threads += 3) {
+        ASSERT_TRUE(spmv_csr(csr, x, y, threads));
+        ASSERT_TRUE(spmv_csr_f(csr, xf, yf, threads));
+        for (size_t v = 0; v < 4; v++) {
+            ASSERT_EQ(y[v], expected[v]);
+            ASSERT_EQ(yf[v], (float)expected[v]);
+        }
+    }
+    ASSERT_FALSE(spmv_csr(csr, NULL, y, 1));
+    ASSERT_FALSE(spmv_csr_f(NULL, xf, yf, 1));
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -198,12 +1111,30 @@ int main(void) {
 
     RUN_TEST(dijkstra_basic);
     RUN_TEST(dijkstra_unreachable);
+    RUN_TEST(dijkstra_heap_matches_dense);
+    RUN_TEST(dijkstra_heap_matrix_graph);
     RUN_TEST(bellman_ford_basic);
     RUN_TEST(bellman_ford_negative_cycle);
+    RUN_TEST(bellman_ford_spfa_matches_passes);
     RUN_TEST(floyd_warshall_basic);
+    RUN_TEST(floyd_warshall_blocked_matches_classic);
     RUN_TEST(kruskal_basic);
     RUN_TEST(prim_basic);
     RUN_TEST(kruskal_prim_agree);
+    RUN_TEST(csr_shortest_paths);
+    RUN_TEST(csr_bellman_ford_negative_cycle);
+    RUN_TEST(csr_mst);
+    RUN_TEST(mst_variants_agree);
+    RUN_TEST(bfs_csr_direction_optimizing);
+    RUN_TEST(bfs_csr_small);
+    RUN_TEST(delta_stepping_matches_dijkstra);
+    RUN_TEST(point_to_point_matches_dijkstra);
+    RUN_TEST(point_to_point_stops_early);
+    RUN_TEST(contraction_hierarchy_matches_dijkstra);
+    RUN_TEST(scc_csr_parallel_matches_tarjan);
+    RUN_TEST(build_from_edges_matches_reference);
+    RUN_TEST(pagerank_matches_power_iteration);
+    RUN_TEST(spmv_csr_matches_manual);
 
     printf("\nAll Graph Algorithm tests passed!\n");
     return 0;
@@ -9,6 +9,8 @@
 #include "algorithms/greedy.h"
 #include "../test_macros.h"
 
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 
@@ -134,6 +136,128 @@ TEST(huffman_null) {
     huffman_result_destroy(&r);
 }
 
+TEST(huffman_lengths_sorted_matches_heap) {
+    // Mesmo custo total que a arvore do heap (greedy_huffman)
+    char chars[] = {'a', 'b', 'c', 'd', 'e', 'f'};
+    int freqs[]  = {5, 9, 12, 13, 16, 45};
+    uint64_t sorted[] = {5, 9, 12, 13, 16, 45};
+    uint32_t lengths[6];
+    ASSERT_TRUE(huffman_lengths_sorted(sorted, 6, lengths));
+    HuffmanResult r = greedy_huffman(chars, freqs, 6);
+    uint64_t heap_cost = 0, queue_cost = 0;
+    for (int i = 0; i < 6; i++) {
+        heap_cost += (uint64_t)freqs[i] * strlen(r.codes[(unsigned char)chars[i]]);
+        queue_cost += sorted[i] * lengths[i];
+    }
+    ASSERT_EQ(queue_cost, heap_cost);
+    ASSERT_EQ(lengths[5], 1);
+    huffman_result_destroy(&r);
+
+    uint64_t unsorted[] = {3, 1};
+    ASSERT_FALSE(huffman_lengths_sorted(unsorted, 2, lengths));
+    ASSERT_TRUE(huffman_lengths_sorted(unsorted, 1, lengths));
+    ASSERT_EQ(lengths[0], 1);
+}
+
+static bool huffman_roundtrip(const HuffmanCodec *codec, const unsigned char *in, size_t n) {
+    size_t size = huffman_encoded_size(codec, in, n);
+    unsigned char *packed = malloc(size + 1);
+    unsigned char *back = malloc(n + 1);
+    bool ok = packed != NULL && back != NULL;
+    if (ok) ok = huffman_encode(codec, in, n, packed, size) == size;
+    if (ok && size > 0) ok = huffman_encode(codec, in, n, packed, size - 1) == 0;
+    if (ok) ok = huffman_decode(codec, packed, size, back, n) && memcmp(back, in, n) == 0;
+    if (ok && n > 0) ok = !huffman_decode(codec, packed, size / 2, back, n);  // truncado
+    free(packed);
+    free(back);
+    return ok;
+}
+
+TEST(huffman_codec_roundtrip) {
+    // Texto com distribuicao geometrica: codigos de 1 ate comprimentos longos
+    static unsigned char text[100000];
+    uint64_t freqs[256] = { 0 };
+    unsigned state = 62u;
+    for (size_t i = 0; i < sizeof(text); i++) {
+        state = state * 1103515245u + 12345u;
+        unsigned r = (state >> 8) & 0xFFFFu, sym = 0;
+        while (r & 1u && sym < 200) { r = (r >> 1) | 0x8000u; sym++; }
+        text[i] = (unsigned char)(sym * 7);
+        freqs[text[i]]++;
+    }
+    HuffmanCodec *codec = huffman_codec_create(freqs);
+    ASSERT_NOT_NULL(codec);
+    ASSERT_TRUE(huffman_roundtrip(codec, text, sizeof(text)));
+    ASSERT_TRUE(huffman_encoded_size(codec, text, sizeof(text)) < sizeof(text) / 3);
+
+    // O decodificador so precisa dos comprimentos
+    HuffmanCodec *copy = huffman_codec_from_lengths(huffman_codec_lengths(codec));
+    ASSERT_NOT_NULL(copy);
+    size_t size = huffman_encoded_size(codec, text, sizeof(text));
+    unsigned char *packed = malloc(size);
+    unsigned char *back = malloc(sizeof(text));
+    ASSERT_NOT_NULL(packed);
+    ASSERT_NOT_NULL(back);
+    ASSERT_EQ(huffman_encode(codec, text, sizeof(text), packed, size), size);
+    ASSERT_TRUE(huffman_decode(copy, packed, size, back, sizeof(text)));
+    ASSERT_EQ(memcmp(back, text, sizeof(text)), 0);
+    free(packed);
+    free(back);
+
+    // Byte sem codigo
+    unsigned char missing = 1;
+    ASSERT_EQ(huffman_encoded_size(codec, &missing, 1), SIZE_MAX);
+    ASSERT_EQ(huffman_encode(codec, &missing, 1, text, 10), 0);
+    huffman_codec_destroy(copy);
+    huffman_codec_destroy(codec);
+}
+
+TEST(huffman_codec_length_limited) {
+    // Frequencias de Fibonacci: a arvore otima teria altura 89
+    uint64_t freqs[256] = { 0 };
+    uint64_t a = 1, b = 1;
+    for (int s = 0; s < 90; s++) {
+        freqs[s * 2] = a;
+        uint64_t c = a + b; a = b; b = c;
+    }
+    HuffmanCodec *codec = huffman_codec_create(freqs);
+    ASSERT_NOT_NULL(codec);
+    const uint8_t *lengths = huffman_codec_lengths(codec);
+    uint64_t kraft = 0;
+    for (int s = 0; s < 256; s++) {
+        ASSERT_TRUE(lengths[s] <= HUFFMAN_MAX_CODE_LENGTH);
+        ASSERT_EQ(lengths[s] != 0, freqs[s] != 0);
+        if (lengths[s]) kraft += 1ull << (HUFFMAN_MAX_CODE_LENGTH - lengths[s]);
+    }
+    ASSERT_EQ(kraft, 1ull << HUFFMAN_MAX_CODE_LENGTH);
+    unsigned char all[90];
+    for (int s = 0; s < 90; s++) all[s] = (unsigned char)(s * 2);
+    ASSERT_TRUE(huffman_roundtrip(codec, all, 90));
+    huffman_codec_destroy(codec);
+
+    // Um unico simbolo: codigo de 1 bit
+    uint64_t single[256] = { 0 };
+    single['x'] = 10;
+    codec = huffman_codec_create(single);
+    ASSERT_NOT_NULL(codec);
+    ASSERT_EQ(huffman_codec_lengths(codec)['x'], 1);
+    unsigned char xs[20];
+    memset(xs, 'x', sizeof(xs));
+    ASSERT_TRUE(huffman_roundtrip(codec, xs, sizeof(xs)));
+    unsigned char invalid = 0xFF, out;
+    ASSERT_FALSE(huffman_decode(codec, &invalid, 1, &out, 1));
+    huffman_codec_destroy(codec);
+
+    uint8_t bad[256] = { 0 };
+    bad[0] = bad[1] = bad[2] = 1;                          // viola Kraft
+    ASSERT_NULL(huffman_codec_from_lengths(bad));
+    bad[0] = bad[1] = bad[2] = 0;
+    ASSERT_NULL(huffman_codec_from_lengths(bad));
+    uint64_t none[256] = { 0 };
+    ASSERT_NULL(huffman_codec_create(none));
+    ASSERT_NULL(huffman_codec_create(NULL));
+}
+
 // ============================================================================
 // FRACTIONAL KNAPSACK
 // ============================================================================
@@ -181,6 +305,86 @@ TEST(fractional_knapsack_null) {
     APPROX_EQ(result, 0.0);
 }
 
+TEST(fractional_knapsack_linear_matches_sort) {
+    static double weights[5000], values[5000];
+    unsigned state = 63u;
+    for (int trial = 0; trial < 40; trial++) {
+        size_t n = (trial < 20) ? (size_t)trial + 1 : 5000;
+        for (size_t i = 0; i < n; i++) {
+            state = state * 1103515245u + 12345u;
+            weights[i] = 1.0 + (double)((state >> 16) % 100);
+            state = state * 1103515245u + 12345u;
+            values[i] = (double)((state >> 16) % 50 + 1) * (trial % 2 ? 1.0 : weights[i]);  // razoes repetidas
+        }
+        double capacity = 10.0 + 37.0 * (double)trial * (double)n / 20.0;
+        FractionalKnapsackResult sorted = greedy_fractional_knapsack(weights, values, n, capacity);
+        FractionalKnapsackResult linear = greedy_fractional_knapsack_linear(weights, values, n, capacity);
+        ASSERT_NOT_NULL(linear.fractions);
+        ASSERT_TRUE(fabs(linear.max_value - sorted.max_value) <= 1e-9 * sorted.max_value);
+        ASSERT_TRUE(fabs(greedy_fractional_knapsack_value_linear(weights, values, n, capacity) -
+                         sorted.max_value) <= 1e-9 * sorted.max_value);
+        double used = 0.0, value = 0.0;
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_TRUE(linear.fractions[i] >= 0.0 && linear.fractions[i] <= 1.0);
+            used += linear.fractions[i] * weights[i];
+            value += linear.fractions[i] * values[i];
+        }
+        ASSERT_TRUE(used <= capacity * (1.0 + 1e-9));
+        ASSERT_TRUE(fabs(value - linear.max_value) <= 1e-9 * linear.max_value);
+        fractional_knapsack_result_destroy(&sorted);
+        fractional_knapsack_result_destroy(&linear);
+    }
+
+    // Peso zero entra inteiro; valor nao positivo fica de fora
+    double w[] = {0.0, 10.0, 5.0};
+    double v[] = {7.0, 20.0, -3.0};
+    FractionalKnapsackResult r = greedy_fractional_knapsack_linear(w, v, 3, 5.0);
+    APPROX_EQ(r.max_value, 17.0);
+    APPROX_EQ(r.fractions[0], 1.0);
+    APPROX_EQ(r.fractions[1], 0.5);
+    APPROX_EQ(r.fractions[2], 0.0);
+    fractional_knapsack_result_destroy(&r);
+}
+
+TEST(fractional_knapsack_stream_matches_batch) {
+    const size_t n = 50000, chunk = 777;
+    double *weights = malloc(n * sizeof(double));
+    double *values = malloc(n * sizeof(double));
+    ASSERT_NOT_NULL(weights);
+    ASSERT_NOT_NULL(values);
+    unsigned state = 5u;
+    for (size_t i = 0; i < n; i++) {
+        state = state * 1103515245u + 12345u;
+        weights[i] = 0.5 + (double)((state >> 16) % 1000) / 10.0;
+        state = state * 1103515245u + 12345u;
+        values[i] = (double)((state >> 16) % 1000 + 1);
+    }
+    FractionalKnapsackStream *stream = fractional_knapsack_stream_create(3000.0);
+    ASSERT_NOT_NULL(stream);
+    for (size_t first = 0; first < n; first += chunk) {
+        size_t count = (n - first < chunk) ? n - first : chunk;
+        ASSERT_TRUE(fractional_knapsack_stream_add(stream, weights + first, values + first, count));
+        if (first % (chunk * 16) == 0) {
+            double expected = greedy_fractional_knapsack_value(weights, values, first + count, 3000.0);
+            ASSERT_TRUE(fabs(fractional_knapsack_stream_value(stream) - expected) <= 1e-9 * expected);
+        }
+    }
+    FractionalKnapsackResult batch = greedy_fractional_knapsack(weights, values, n, 3000.0);
+    FractionalKnapsackResult streamed = fractional_knapsack_stream_result(stream);
+    ASSERT_EQ(streamed.n, n);
+    ASSERT_TRUE(fabs(streamed.max_value - batch.max_value) <= 1e-9 * batch.max_value);
+    double used = 0.0;
+    for (size_t i = 0; i < n; i++) used += streamed.fractions[i] * weights[i];
+    ASSERT_TRUE(fabs(used - 3000.0) <= 1e-6);
+    fractional_knapsack_result_destroy(&batch);
+    fractional_knapsack_result_destroy(&streamed);
+    fractional_knapsack_stream_destroy(stream);
+    free(weights);
+    free(values);
+
+    ASSERT_NULL(fractional_knapsack_stream_create(0.0));
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -202,6 +406,9 @@ int main(void) {
     RUN_TEST(huffman_single);
     RUN_TEST(huffman_prefix_free);
     RUN_TEST(huffman_null);
+    RUN_TEST(huffman_lengths_sorted_matches_heap);
+    RUN_TEST(huffman_codec_roundtrip);
+    RUN_TEST(huffman_codec_length_limited);
 
     printf("\n[Fractional Knapsack]\n");
     RUN_TEST(fractional_knapsack_basic);
@@ -209,6 +416,8 @@ int main(void) {
     RUN_TEST(fractional_knapsack_zero_capacity);
     RUN_TEST(fractional_knapsack_with_fractions);
     RUN_TEST(fractional_knapsack_null);
+    RUN_TEST(fractional_knapsack_linear_matches_sort);
+    RUN_TEST(fractional_knapsack_stream_matches_batch);
 
     printf("\n=== All greedy algorithm tests passed! ===\n");
     return 0;
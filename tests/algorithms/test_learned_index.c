@@ -0,0 +1,161 @@
+/**
+ * @file test_learned_index.c
+ * @brief Testes unitarios para o indice aprendido (PGM)
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "algorithms/learned_index.h"
+#include "algorithms/searching.h"
+#include "algorithms/sorting.h"
+#include "../test_macros.h"
+
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static uint64_t rng_state = 0x853C49E6748FEA9Bull;
+
+static uint32_t rng_next(void) {
+    rng_state = rng_state * 6364136223846793005ull + 1442695040888963407ull;
+    return (uint32_t)(rng_state >> 33);
+}
+
+static size_t lower_bound_ref(const int *keys, size_t n, int key) {
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (keys[mid] < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// Confere lower_bound em todas as chaves, vizinhos e pontos aleatorios
+static void assert_matches_reference(const int *keys, size_t n, size_t epsilon) {
+    LearnedIndex *index = learned_index_build(keys, n, epsilon);
+    ASSERT_NOT_NULL(index);
+    for (size_t i = 0; i < n; i++) {
+        int k = keys[i];
+        ASSERT_EQ(learned_index_lower_bound(index, k), lower_bound_ref(keys, n, k));
+        if (k > INT_MIN) ASSERT_EQ(learned_index_lower_bound(index, k - 1), lower_bound_ref(keys, n, k - 1));
+        if (k < INT_MAX) ASSERT_EQ(learned_index_lower_bound(index, k + 1), lower_bound_ref(keys, n, k + 1));
+    }
+    for (int t = 0; t < 2000; t++) {
+        int k = (int)rng_next() - (int)(rng_next() % 2u) * INT_MAX;
+        ASSERT_EQ(learned_index_lower_bound(index, k), lower_bound_ref(keys, n, k));
+    }
+    ASSERT_EQ(learned_index_lower_bound(index, INT_MIN), 0);
+    learned_index_destroy(index);
+}
+
+// ============================================================================
+// CONSTRUCAO
+// ============================================================================
+
+TEST(build_invalid_and_empty) {
+    int unsorted[] = {1, 5, 3};
+    ASSERT_NULL(learned_index_build(NULL, 10, 8));
+    ASSERT_NULL(learned_index_build(unsorted, 3, 8));
+
+    LearnedIndex *empty = learned_index_build(NULL, 0, 8);
+    ASSERT_NOT_NULL(empty);
+    ASSERT_EQ(learned_index_lower_bound(empty, 5), 0);
+    ASSERT_EQ(learned_index_find(empty, 5), SEARCH_NOT_FOUND);
+    ASSERT_EQ(learned_index_segments(empty), 0);
+    learned_index_destroy(empty);
+    learned_index_destroy(NULL);
+    ASSERT_EQ(learned_index_lower_bound(NULL, 1), SEARCH_NOT_FOUND);
+}
+
+TEST(linear_keys_single_segment) {
+    static int keys[100000];
+    for (size_t i = 0; i < 100000; i++) keys[i] = (int)(i * 7) - 300000;
+    LearnedIndex *index = learned_index_build(keys, 100000, 0);
+    ASSERT_NOT_NULL(index);
+    ASSERT_EQ(learned_index_segments(index), 1);
+    ASSERT_EQ(learned_index_levels(index), 1);
+    ASSERT_TRUE(learned_index_memory(index) < 256);
+    for (size_t i = 0; i < 100000; i += 97) {
+        ASSERT_EQ(learned_index_find(index, keys[i]), i);
+        ASSERT_EQ(learned_index_find(index, keys[i] + 1), SEARCH_NOT_FOUND);
+    }
+    learned_index_destroy(index);
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+TEST(random_keys_all_epsilons) {
+    size_t n = 20000;
+    int *keys = malloc(n * sizeof(int));
+    ASSERT_NOT_NULL(keys);
+    for (size_t i = 0; i < n; i++) keys[i] = (int)(rng_next() % 1000000u);
+    sort_int(keys, n);
+
+    const size_t eps[] = {0, 1, 4, 32, 256};
+    for (size_t e = 0; e < 5; e++) assert_matches_reference(keys, n, eps[e]);
+
+    LearnedIndex *index = learned_index_build(keys, n, 32);
+    ASSERT_NOT_NULL(index);
+    ASSERT_TRUE(learned_index_levels(index) >= 1);
+    ASSERT_TRUE(learned_index_memory(index) < n * sizeof(int));
+    learned_index_destroy(index);
+    free(keys);
+}
+
+TEST(skewed_and_duplicate_keys) {
+    size_t n = 30000;
+    int *keys = malloc(n * sizeof(int));
+    ASSERT_NOT_NULL(keys);
+
+    // Exponencial: ruim para interpolation_search
+    for (size_t i = 0; i < n; i++) keys[i] = (int)(exp((double)i / (double)n * 20.0));
+    assert_matches_reference(keys, n, 16);
+
+    // Longas sequencias de repetidos separadas por saltos grandes
+    for (size_t i = 0; i < n; i++) keys[i] = (int)(i / 1000) * 1000000 - 15000000;
+    assert_matches_reference(keys, n, 8);
+
+    // Extremos do int e chaves consecutivas
+    for (size_t i = 0; i < n; i++) keys[i] = (i < n / 2) ? INT_MIN + (int)i : INT_MAX - (int)(n - 1 - i);
+    assert_matches_reference(keys, n, 4);
+    free(keys);
+}
+
+TEST(find_first_occurrence) {
+    int keys[] = {1, 3, 3, 3, 8, 8, 20, 21, 22, 90};
+    LearnedIndex *index = learned_index_build(keys, 10, 1);
+    ASSERT_NOT_NULL(index);
+    ASSERT_EQ(learned_index_find(index, 3), 1);
+    ASSERT_EQ(learned_index_find(index, 8), 4);
+    ASSERT_EQ(learned_index_find(index, 90), 9);
+    ASSERT_EQ(learned_index_find(index, 4), SEARCH_NOT_FOUND);
+    ASSERT_EQ(learned_index_find(index, 91), SEARCH_NOT_FOUND);
+    ASSERT_EQ(learned_index_lower_bound(index, 91), 10);
+    learned_index_destroy(index);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Learned Index Tests ===\n");
+
+    RUN_TEST(build_invalid_and_empty);
+    RUN_TEST(linear_keys_single_segment);
+    RUN_TEST(random_keys_all_epsilons);
+    RUN_TEST(skewed_and_duplicate_keys);
+    RUN_TEST(find_first_occurrence);
+
+    printf("\nAll Learned Index tests passed!\n");
+    return 0;
+}
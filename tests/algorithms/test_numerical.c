@@ -9,6 +9,9 @@
 #include "algorithms/numerical.h"
 #include "../test_macros.h"
 
+#include <stdint.h>
+#include <stdlib.h>
+
 // ============================================================================
 // GCD
 // ============================================================================
@@ -103,6 +106,21 @@ TEST(fast_pow_mod_large) {
     ASSERT_EQ(fast_pow_mod(2, 20, 1000000007), 1048576);
 }
 
+TEST(fast_pow_mod_even_modulus) {
+    // Modulo par: sem Montgomery (valores conferidos com pow do Python)
+    ASSERT_EQ(fast_pow_mod(3, 100, 1LL << 40), 368548778961LL);
+    ASSERT_EQ(fast_pow_mod(123456789, 987654321, 4000000000000000000LL), 922883132974933589LL);
+    ASSERT_EQ(fast_pow_mod(123456789, 987654321, 9223372036854775783LL), 7304489514424542795LL);
+}
+
+TEST(fast_pow_mod_large_modulus) {
+    // 2^61 - 1 e primo: produtos de 122 bits antes da reducao
+    const long long p = 2305843009213693951LL;
+    ASSERT_EQ(fast_pow_mod(3, p - 1, p), 1);
+    ASSERT_EQ(fast_pow_mod(p - 1, 2, p), 1);
+    ASSERT_EQ(fast_pow_mod(123456789, p, p), 123456789);
+}
+
 TEST(fast_pow_mod_edge) {
     ASSERT_EQ(fast_pow_mod(5, 0, 7), 1);
     ASSERT_EQ(fast_pow_mod(5, 1, 7), 5);
@@ -176,6 +194,121 @@ TEST(is_prime_negative) {
     ASSERT_FALSE(is_prime(-5));
 }
 
+static bool trial_division(uint64_t n) {
+    if (n < 2) return false;
+    for (uint64_t d = 2; d * d <= n; d++) {
+        if (n % d == 0) return false;
+    }
+    return true;
+}
+
+TEST(is_prime_matches_trial_division) {
+    for (uint64_t n = 0; n < 200000; n++) ASSERT_EQ(is_prime_u64(n), trial_division(n));
+    for (uint64_t n = 4294967296ull - 2000; n < 4294967296ull + 2000; n++) {
+        ASSERT_EQ(is_prime_u64(n), trial_division(n));
+    }
+}
+
+TEST(is_prime_pseudoprimes_and_large) {
+    // Carmichael e pseudoprimos fortes para varias bases pequenas
+    ASSERT_FALSE(is_prime(561));
+    ASSERT_FALSE(is_prime(3215031751LL));                 // spsp(2, 3, 5, 7)
+    ASSERT_FALSE(is_prime(3825123056546413051LL));        // spsp(2, ..., 23)
+    ASSERT_FALSE(is_prime_u64(4759123141ull));            // spsp(2, 7, 61)
+    ASSERT_TRUE(is_prime(2305843009213693951LL));         // 2^61 - 1
+    ASSERT_TRUE(is_prime(9223372036854775783LL));         // maior primo < 2^63
+    ASSERT_TRUE(is_prime_u64(18446744073709551557ull));   // maior primo < 2^64
+    ASSERT_FALSE(is_prime_u64(18446744073709551615ull));
+    ASSERT_FALSE(is_prime_u64(4294967291ull * 4294967279ull));
+
+    // Contra o crivo segmentado num intervalo acima de 10^12
+    const uint64_t lo = 1000000000000ull, hi = lo + 300000;
+    size_t count;
+    uint64_t *primes = primes_in_range(lo, hi, 1, &count);
+    ASSERT_NOT_NULL(primes);
+    uint64_t *values = malloc((size_t)(hi - lo) * sizeof(uint64_t));
+    bool *flags = malloc((size_t)(hi - lo) * sizeof(bool));
+    ASSERT_NOT_NULL(values);
+    ASSERT_NOT_NULL(flags);
+    for (uint64_t v = lo; v < hi; v++) values[v - lo] = v;
+    is_prime_batch(values, (size_t)(hi - lo), flags, 0);
+    size_t k = 0;
+    for (uint64_t v = lo; v < hi; v++) {
+        bool expected = k < count && primes[k] == v;
+        if (expected) k++;
+        ASSERT_EQ(flags[v - lo], expected);
+    }
+    free(flags);
+    free(values);
+    free(primes);
+}
+
+// ============================================================================
+// SEGMENTED SIEVE
+// ============================================================================
+
+// Confere o iterador em [lo, hi) contra is_prime
+static bool iterator_matches_trial(uint64_t lo, uint64_t hi) {
+    PrimeIterator *it = prime_iterator_create(lo, hi);
+    if (it == NULL) return false;
+    uint64_t expected = lo, p;
+    bool ok = true;
+    while (ok && prime_iterator_next(it, &p)) {
+        while (expected < p) ok = ok && !is_prime((long long)expected++);
+        ok = ok && p < hi && is_prime((long long)p);
+        expected = p + 1;
+    }
+    while (ok && expected < hi) ok = !is_prime((long long)expected++);
+    ok = ok && !prime_iterator_next(it, &p);
+    prime_iterator_destroy(it);
+    return ok;
+}
+
+TEST(segmented_small_ranges) {
+    // Todas as bordas de byte (30 inteiros) e os primos 2, 3, 5 fora da roda
+    for (uint64_t lo = 0; lo < 70; lo++) {
+        for (uint64_t hi = lo; hi < 130; hi += 3) {
+            ASSERT_TRUE(iterator_matches_trial(lo, hi));
+        }
+    }
+    ASSERT_TRUE(iterator_matches_trial(0, 3 * SIEVE_SEGMENT_BYTES * 30 + 17));
+    ASSERT_TRUE(iterator_matches_trial(10000000000ull, 10000000000ull + 100000));
+}
+
+TEST(segmented_counts) {
+    uint64_t count;
+    ASSERT_TRUE(prime_count_range(0, 10000000, 1, &count));
+    ASSERT_EQ(count, 664579);
+    ASSERT_TRUE(prime_count_range(0, 100000000, 0, &count));
+    ASSERT_EQ(count, 5761455);
+    ASSERT_TRUE(prime_count_range(2, 3, 1, &count));
+    ASSERT_EQ(count, 1);
+    ASSERT_TRUE(prime_count_range(5, 5, 1, &count));
+    ASSERT_EQ(count, 0);
+    ASSERT_FALSE(prime_count_range(0, SIEVE_SEGMENTED_MAX + 1, 1, &count));
+    ASSERT_NULL(prime_iterator_create(0, SIEVE_SEGMENTED_MAX + 1));
+
+    // Blocos por thread (convergem com o serial mesmo sem OpenMP)
+    uint64_t serial, parallel;
+    ASSERT_TRUE(prime_count_range(1000000007ull, 1300000000ull, 1, &serial));
+    ASSERT_TRUE(prime_count_range(1000000007ull, 1300000000ull, 4, &parallel));
+    ASSERT_EQ(serial, parallel);
+}
+
+TEST(segmented_matches_sieve) {
+    SieveResult ref = sieve_of_eratosthenes(3000000);
+    size_t count;
+    uint64_t *primes = primes_in_range(0, 3000001, 3, &count);
+    ASSERT_NOT_NULL(primes);
+    ASSERT_EQ(count, ref.count);
+    for (size_t i = 0; i < count; i++) ASSERT_EQ(primes[i], (uint64_t)ref.primes[i]);
+    free(primes);
+    sieve_result_destroy(&ref);
+
+    ASSERT_NULL(primes_in_range(24, 29, 1, &count));
+    ASSERT_EQ(count, 0);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -203,6 +336,8 @@ int main(void) {
     RUN_TEST(fast_pow_edge);
     RUN_TEST(fast_pow_mod_basic);
     RUN_TEST(fast_pow_mod_large);
+    RUN_TEST(fast_pow_mod_large_modulus);
+    RUN_TEST(fast_pow_mod_even_modulus);
     RUN_TEST(fast_pow_mod_edge);
     RUN_TEST(fast_pow_mod_fermat);
 
@@ -214,6 +349,13 @@ int main(void) {
     RUN_TEST(sieve_edge);
     RUN_TEST(is_prime_basic);
     RUN_TEST(is_prime_negative);
+    RUN_TEST(is_prime_matches_trial_division);
+    RUN_TEST(is_prime_pseudoprimes_and_large);
+
+    printf("\n[Segmented Sieve]\n");
+    RUN_TEST(segmented_small_ranges);
+    RUN_TEST(segmented_counts);
+    RUN_TEST(segmented_matches_sieve);
 
     printf("\n=== All numerical algorithm tests passed! ===\n");
     return 0;
@@ -0,0 +1,339 @@
+/**
+ * @file test_pipeline.c
+ * @brief Testes unitarios para o pipeline em lotes
+ *
+ * Lotes pequenos e queue_depth minimo forcam o back-pressure: a fonte
+ * produz muito mais lotes do que cabem em transito.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "algorithms/pipeline.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+typedef struct {
+    uint32_t host;
+    uint32_t seq;
+    char message[24];
+} LogRecord;
+
+static const char *const MESSAGES[4] = {"ok", "read timeout", "write ok", "timeout again"};
+
+static LogRecord make_record(uint32_t seq) {
+    LogRecord r;
+    memset(&r, 0, sizeof(r));
+    r.host = (seq * 2654435761u) % 37;
+    r.seq = seq;
+    strcpy(r.message, MESSAGES[(seq / 3) % 4]);
+    return r;
+}
+
+// "Parse": gera total registros, chunk por chamada
+typedef struct {
+    uint32_t next;
+    uint32_t total;
+    uint32_t chunk;
+} Source;
+
+static PipelineStatus source_process(void *ctx, const void *items, size_t count,
+                                     PipelineEmitter *out) {
+    (void)items;
+    (void)count;
+    Source *src = ctx;
+    for (uint32_t i = 0; i < src->chunk && src->next < src->total; i++) {
+        LogRecord r = make_record(src->next++);
+        if (!pipeline_emit(out, &r)) return PIPELINE_ERROR;
+    }
+    return src->next < src->total ? PIPELINE_CONTINUE : PIPELINE_DONE;
+}
+
+// Sorvedouro: copia os itens recebidos
+typedef struct {
+    unsigned char *data;
+    size_t count;
+    size_t capacity;
+    size_t item_size;
+} Collector;
+
+static PipelineStatus collect_process(void *ctx, const void *items, size_t count,
+                                      PipelineEmitter *out) {
+    (void)out;
+    Collector *c = ctx;
+    if (c->count + count > c->capacity) return PIPELINE_ERROR;
+    memcpy(c->data + c->count * c->item_size, items, count * c->item_size);
+    c->count += count;
+    return PIPELINE_CONTINUE;
+}
+
+static Collector collector_create(size_t capacity, size_t item_size) {
+    Collector c = {malloc(capacity * item_size), 0, capacity, item_size};
+    return c;
+}
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static size_t hash_u32(const void *key) {
+    return (size_t)(*(const uint32_t *)key * 2654435761u);
+}
+
+// Grupos por contador decrescente, empate pela chave
+static int compare_group(const void *a, const void *b) {
+    size_t off = PIPELINE_GROUP_COUNT_OFFSET(sizeof(uint32_t));
+    uint64_t ca, cb;
+    memcpy(&ca, (const unsigned char *)a + off, sizeof(ca));
+    memcpy(&cb, (const unsigned char *)b + off, sizeof(cb));
+    if (ca != cb) return ca > cb ? -1 : 1;
+    return compare_u32(a, b);
+}
+
+// ============================================================================
+// TESTES
+// ============================================================================
+
+TEST(passthrough_keeps_order) {
+    const uint32_t total = 10007;
+    Source src = {0, total, 13};
+    Collector sink = collector_create(total, sizeof(LogRecord));
+    PipelineStage stages[2] = {
+        {"source", source_process, NULL, &src, sizeof(LogRecord)},
+        {"sink", collect_process, NULL, &sink, 0},
+    };
+    PipelineConfig config = pipeline_default_config();
+    config.batch_size = 16;
+    config.queue_depth = 2;
+    PipelineStageStats stats[2];
+
+    ASSERT_TRUE(pipeline_run(stages, 2, &config, stats));
+    ASSERT_EQ(sink.count, total);
+    const LogRecord *got = (const LogRecord *)sink.data;
+    for (uint32_t i = 0; i < total; i++) {
+        ASSERT_EQ(got[i].seq, i);
+    }
+    ASSERT_EQ(stats[0].items_out, total);
+    ASSERT_EQ(stats[0].batches_out, (total + 15) / 16);
+    ASSERT_EQ(stats[1].items_in, total);
+    ASSERT_EQ(stats[1].batches_in, stats[0].batches_out);
+    free(sink.data);
+}
+
+TEST(filter_aggregate_sort_chain) {
+    const uint32_t total = 20000;
+    PipelineFilter *filter = pipeline_filter_create(sizeof(LogRecord), offsetof(LogRecord, message),
+                                                    sizeof(((LogRecord *)0)->message),
+                                                    "timeout", 7, SM_ALGO_AUTO);
+    PipelineAggregate *agg = pipeline_aggregate_create(sizeof(LogRecord), offsetof(LogRecord, host),
+                                                       sizeof(uint32_t), hash_u32, compare_u32);
+    size_t group_size = pipeline_group_size(sizeof(uint32_t));
+    PipelineSort *sort = pipeline_sort_create(group_size, compare_group);
+    ASSERT_NOT_NULL(filter);
+    ASSERT_NOT_NULL(agg);
+    ASSERT_NOT_NULL(sort);
+    ASSERT_EQ(group_size, 16);
+
+    Source src = {0, total, 100};
+    Collector sink = collector_create(64, group_size);
+    PipelineStage stages[5] = {
+        {"source", source_process, NULL, &src, sizeof(LogRecord)},
+        pipeline_filter_stage(filter, false),
+        pipeline_aggregate_stage(agg),
+        pipeline_sort_stage(sort),
+        {"sink", collect_process, NULL, &sink, 0},
+    };
+    PipelineConfig config = pipeline_default_config();
+    config.batch_size = 64;
+    config.queue_depth = 2;
+
+    ASSERT_TRUE(pipeline_run(stages, 5, &config, NULL));
+
+    // Referencia em serie
+    uint64_t expected[37] = {0};
+    size_t matching = 0;
+    for (uint32_t i = 0; i < total; i++) {
+        LogRecord r = make_record(i);
+        if (strstr(r.message, "timeout") != NULL) {
+            expected[r.host]++;
+            matching++;
+        }
+    }
+    size_t groups = 0;
+    for (size_t h = 0; h < 37; h++) groups += expected[h] > 0;
+
+    ASSERT_EQ(pipeline_aggregate_groups(agg), groups);
+    ASSERT_EQ(sink.count, groups);
+    uint64_t sum = 0;
+    for (size_t g = 0; g < sink.count; g++) {
+        const unsigned char *group = sink.data + g * group_size;
+        uint32_t host;
+        uint64_t count;
+        memcpy(&host, group, sizeof(host));
+        memcpy(&count, group + PIPELINE_GROUP_COUNT_OFFSET(sizeof(uint32_t)), sizeof(count));
+        ASSERT_TRUE(host < 37);
+        ASSERT_EQ(count, expected[host]);
+        if (g > 0) ASSERT_TRUE(compare_group(group - group_size, group) <= 0);
+        sum += count;
+    }
+    ASSERT_EQ(sum, matching);
+
+    free(sink.data);
+    pipeline_sort_destroy(sort);
+    pipeline_aggregate_destroy(agg);
+    pipeline_filter_destroy(filter);
+}
+
+TEST(sort_merges_many_runs) {
+    const uint32_t total = 5003;   // 157 runs de 32, o ultimo parcial
+    Source src = {0, total, 50};
+    PipelineFilter *filter = pipeline_filter_create(sizeof(LogRecord), offsetof(LogRecord, message),
+                                                    sizeof(((LogRecord *)0)->message),
+                                                    "timeout", 7, SM_ALGO_KMP);
+    PipelineSort *sort = pipeline_sort_create(sizeof(LogRecord), compare_u32);   // por host
+    Collector sink = collector_create(total, sizeof(LogRecord));
+    PipelineStage stages[4] = {
+        {"source", source_process, NULL, &src, sizeof(LogRecord)},
+        pipeline_filter_stage(filter, true),   // so os registros sem "timeout"
+        pipeline_sort_stage(sort),
+        {"sink", collect_process, NULL, &sink, 0},
+    };
+    PipelineConfig config = pipeline_default_config();
+    config.batch_size = 32;
+
+    ASSERT_TRUE(pipeline_run(stages, 4, &config, NULL));
+    size_t expected = 0;
+    for (uint32_t i = 0; i < total; i++) {
+        expected += strstr(make_record(i).message, "timeout") == NULL;
+    }
+    ASSERT_EQ(sink.count, expected);
+    const LogRecord *got = (const LogRecord *)sink.data;
+    for (size_t i = 0; i < sink.count; i++) {
+        ASSERT_TRUE(strstr(got[i].message, "timeout") == NULL);
+        ASSERT_EQ(make_record(got[i].seq).host, got[i].host);   // registro intacto
+        if (i > 0) ASSERT_TRUE(got[i - 1].host <= got[i].host);
+    }
+    free(sink.data);
+    pipeline_sort_destroy(sort);
+    pipeline_filter_destroy(filter);
+}
+
+// Etapa que repassa os primeiros limit itens e encerra
+typedef struct {
+    size_t limit;
+    size_t seen;
+} Head;
+
+static PipelineStatus head_process(void *ctx, const void *items, size_t count,
+                                   PipelineEmitter *out) {
+    Head *head = ctx;
+    size_t n = head->limit - head->seen < count ? head->limit - head->seen : count;
+    if (!pipeline_emit_n(out, items, n)) return PIPELINE_ERROR;
+    head->seen += n;
+    return head->seen == head->limit ? PIPELINE_DONE : PIPELINE_CONTINUE;
+}
+
+TEST(early_done_drains_upstream) {
+    const uint32_t total = 50000;
+    Source src = {0, total, 7};
+    Head head = {100, 0};
+    Collector sink = collector_create(total, sizeof(LogRecord));
+    PipelineStage stages[3] = {
+        {"source", source_process, NULL, &src, sizeof(LogRecord)},
+        {"head", head_process, NULL, &head, sizeof(LogRecord)},
+        {"sink", collect_process, NULL, &sink, 0},
+    };
+    PipelineConfig config = {8, 2};
+    PipelineStageStats stats[3];
+
+    ASSERT_TRUE(pipeline_run(stages, 3, &config, stats));
+    ASSERT_EQ(sink.count, 100);
+    const LogRecord *got = (const LogRecord *)sink.data;
+    for (uint32_t i = 0; i < 100; i++) ASSERT_EQ(got[i].seq, i);
+    ASSERT_EQ(src.next, total);   // a fonte foi ate o fim sem bloquear
+    ASSERT_EQ(stats[1].items_in, total);
+    ASSERT_EQ(stats[1].items_out, 100);
+    free(sink.data);
+}
+
+// Etapa que falha no terceiro lote
+static PipelineStatus failing_process(void *ctx, const void *items, size_t count,
+                                      PipelineEmitter *out) {
+    size_t *calls = ctx;
+    if (++*calls == 3) return PIPELINE_ERROR;
+    return pipeline_emit_n(out, items, count) ? PIPELINE_CONTINUE : PIPELINE_ERROR;
+}
+
+TEST(error_aborts_all_stages) {
+    Source src = {0, UINT32_MAX, 64};   // sem o abort, nao terminaria
+    size_t calls = 0;
+    Collector sink = collector_create(1024, sizeof(LogRecord));
+    PipelineStage stages[3] = {
+        {"source", source_process, NULL, &src, sizeof(LogRecord)},
+        {"fail", failing_process, NULL, &calls, sizeof(LogRecord)},
+        {"sink", collect_process, NULL, &sink, 0},
+    };
+    PipelineConfig config = {16, 2};
+
+    ASSERT_FALSE(pipeline_run(stages, 3, &config, NULL));
+    ASSERT_EQ(calls, 3);
+    ASSERT_TRUE(sink.count <= 32);
+    free(sink.data);
+}
+
+TEST(invalid_and_single_stage) {
+    ASSERT_FALSE(pipeline_run(NULL, 2, NULL, NULL));
+
+    Source src = {0, 100, 10};
+    Collector sink = collector_create(1024, sizeof(LogRecord));
+    PipelineStage stages[2] = {
+        {"source", source_process, NULL, &src, 0},   // out_item_size ausente
+        {"sink", collect_process, NULL, &sink, 0},
+    };
+    ASSERT_FALSE(pipeline_run(stages, 2, NULL, NULL));
+    stages[1].process = NULL;
+    stages[0].out_item_size = sizeof(LogRecord);
+    ASSERT_FALSE(pipeline_run(stages, 2, NULL, NULL));
+    ASSERT_EQ(sink.count, 0);
+
+    // Uma etapa so: a fonte e o sorvedouro, e emitir falha
+    PipelineStage alone = {"source", source_process, NULL, &src, sizeof(LogRecord)};
+    ASSERT_FALSE(pipeline_run(&alone, 1, NULL, NULL));
+    ASSERT_EQ(src.next, 1);
+
+    ASSERT_NULL(pipeline_filter_create(8, 4, 8, "x", 1, SM_ALGO_AUTO));
+    ASSERT_NULL(pipeline_filter_create(8, 0, 8, "x", 0, SM_ALGO_AUTO));
+    ASSERT_NULL(pipeline_aggregate_create(8, 6, 4, hash_u32, compare_u32));
+    ASSERT_NULL(pipeline_aggregate_create(8, 0, 4, NULL, compare_u32));
+    ASSERT_NULL(pipeline_sort_create(0, compare_u32));
+    ASSERT_NULL(pipeline_sort_create(4, NULL));
+    free(sink.data);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Pipeline Tests ===\n");
+
+    RUN_TEST(passthrough_keeps_order);
+    RUN_TEST(filter_aggregate_sort_chain);
+    RUN_TEST(sort_merges_many_runs);
+    RUN_TEST(early_done_drains_upstream);
+    RUN_TEST(error_aborts_all_stages);
+    RUN_TEST(invalid_and_single_stage);
+
+    printf("\nAll Pipeline tests passed!\n");
+    return 0;
+}
@@ -10,6 +10,9 @@
 #include "data_structures/common.h"
 #include "../test_macros.h"
 
+#include <stdlib.h>
+#include <math.h>
+
 // ============================================================================
 // LINEAR SEARCH
 // ============================================================================
@@ -145,6 +148,179 @@ TEST(exponential_search_not_found) {
     ASSERT_EQ(exponential_search(arr, 5, sizeof(int), &target, compare_int), SEARCH_NOT_FOUND);
 }
 
+// ============================================================================
+// BUSCA LINEAR VETORIZADA
+// ============================================================================
+
+TEST(linear_search_typed_all_positions) {
+    int32_t a32[300];
+    int64_t a64[300];
+    float af[300];
+    for (size_t n = 0; n <= 300; n += (n < 40) ? 1 : 13) {
+        for (size_t i = 0; i < n; i++) {
+            a32[i] = (int32_t)(i * 3);
+            a64[i] = (int64_t)i * 3 + ((int64_t)1 << 40);   // difere so na metade alta
+            af[i] = (float)i * 0.5f;
+        }
+        for (size_t p = 0; p < n; p++) {
+            ASSERT_EQ(linear_search_int32(a32, n, (int32_t)(p * 3)), p);
+            ASSERT_EQ(linear_search_int64(a64, n, (int64_t)p * 3 + ((int64_t)1 << 40)), p);
+            ASSERT_EQ(linear_search_float(af, n, (float)p * 0.5f), p);
+        }
+        ASSERT_EQ(linear_search_int32(a32, n, -1), SEARCH_NOT_FOUND);
+        ASSERT_EQ(linear_search_int64(a64, n, 3), SEARCH_NOT_FOUND);
+        ASSERT_EQ(linear_search_float(af, n, 0.25f), SEARCH_NOT_FOUND);
+    }
+}
+
+TEST(linear_search_typed_first_occurrence) {
+    int32_t a[40];
+    for (size_t i = 0; i < 40; i++) a[i] = 7;
+    a[35] = 9;
+    ASSERT_EQ(linear_search_int32(a, 40, 7), 0);
+    ASSERT_EQ(linear_search_int32(a, 40, 9), 35);
+
+    int target = 9;
+    ASSERT_EQ(linear_search(a, 40, sizeof(int), &target, compare_int), 35);
+
+    float f[20] = {0};
+    f[0] = -0.0f;
+    f[19] = NAN;
+    ASSERT_EQ(linear_search_float(f, 20, 0.0f), 0);
+    ASSERT_EQ(linear_search_float(f, 20, NAN), SEARCH_NOT_FOUND);
+    ASSERT_EQ(linear_search_int32(NULL, 5, 1), SEARCH_NOT_FOUND);
+}
+
+TEST(jump_and_exponential_typed_paths) {
+    // Pequeno (varredura linear) e grande (blocos de sqrt(n) varridos por SIMD)
+    static int arr[5000];
+    for (size_t i = 0; i < 5000; i++) arr[i] = (int)(i * 2);
+    const size_t sizes[] = {1, 17, 256, 257, 5000};
+    for (size_t s = 0; s < 5; s++) {
+        size_t n = sizes[s];
+        for (size_t p = 0; p < n; p += (n > 300) ? 37 : 1) {
+            int target = (int)(p * 2);
+            ASSERT_EQ(jump_search(arr, n, sizeof(int), &target, compare_int), p);
+            ASSERT_EQ(exponential_search(arr, n, sizeof(int), &target, compare_int), p);
+        }
+        int missing = 3;
+        ASSERT_EQ(jump_search(arr, n, sizeof(int), &missing, compare_int), SEARCH_NOT_FOUND);
+        ASSERT_EQ(exponential_search(arr, n, sizeof(int), &missing, compare_int), SEARCH_NOT_FOUND);
+        missing = (int)(2 * n + 10);
+        ASSERT_EQ(jump_search(arr, n, sizeof(int), &missing, compare_int), SEARCH_NOT_FOUND);
+    }
+}
+
+// ============================================================================
+// LOWER BOUND SEM DESVIOS E EYTZINGER
+// ============================================================================
+
+// Array ordenado com repetidos: 0, 0, 2, 2, 4, 4, ...
+static void fill_even_pairs(int *arr, size_t n) {
+    for (size_t i = 0; i < n; i++) arr[i] = (int)(i / 2) * 2;
+}
+
+static size_t lower_bound_linear(const int *arr, size_t n, int target) {
+    size_t i = 0;
+    while (i < n && arr[i] < target) i++;
+    return i;
+}
+
+TEST(lower_bound_all_sizes) {
+    int arr[70];
+    for (size_t n = 0; n <= 70; n++) {
+        fill_even_pairs(arr, n);
+        for (int target = -1; target <= (int)n + 1; target++) {
+            size_t expected = lower_bound_linear(arr, n, target);
+            ASSERT_EQ(lower_bound_branchless(arr, n, sizeof(int), &target, compare_int), expected);
+            ASSERT_EQ(lower_bound_int(arr, n, target), expected);
+        }
+    }
+}
+
+TEST(lower_bound_batch_matches_single) {
+    int arr[1000];
+    int targets[37];
+    size_t out[37];
+    fill_even_pairs(arr, 1000);
+    for (size_t j = 0; j < 37; j++) targets[j] = (int)((j * 131) % 1010) - 3;
+    lower_bound_batch(arr, 1000, sizeof(int), targets, 37, compare_int, out);
+    for (size_t j = 0; j < 37; j++) {
+        ASSERT_EQ(out[j], lower_bound_linear(arr, 1000, targets[j]));
+    }
+    lower_bound_int_batch(arr, 1000, targets, 37, out);
+    for (size_t j = 0; j < 37; j++) {
+        ASSERT_EQ(out[j], lower_bound_linear(arr, 1000, targets[j]));
+    }
+    lower_bound_batch(arr, 0, sizeof(int), targets, 37, compare_int, out);
+    ASSERT_EQ(out[36], 0);
+}
+
+TEST(binary_search_batch_matches_single) {
+    int arr[513];
+    int queries[100];
+    size_t out[100];
+    fill_even_pairs(arr, 513);
+    for (size_t j = 0; j < 100; j++) queries[j] = (int)((j * 53) % 530) - 4;
+    binary_search_batch(arr, 513, sizeof(int), queries, 100, compare_int, out);
+    for (size_t j = 0; j < 100; j++) {
+        size_t lb = lower_bound_linear(arr, 513, queries[j]);
+        size_t expected = (lb < 513 && arr[lb] == queries[j]) ? lb : SEARCH_NOT_FOUND;
+        ASSERT_EQ(out[j], expected);
+    }
+    binary_search_int_batch(arr, 513, queries, 100, out);
+    for (size_t j = 0; j < 100; j++) {
+        size_t lb = lower_bound_linear(arr, 513, queries[j]);
+        size_t expected = (lb < 513 && arr[lb] == queries[j]) ? lb : SEARCH_NOT_FOUND;
+        ASSERT_EQ(out[j], expected);
+    }
+    binary_search_int_batch(arr, 0, queries, 3, out);
+    ASSERT_EQ(out[2], SEARCH_NOT_FOUND);
+    binary_search_batch(NULL, 513, sizeof(int), queries, 3, compare_int, out);
+    ASSERT_EQ(out[0], SEARCH_NOT_FOUND);
+}
+
+TEST(eytzinger_lower_bound_all_sizes) {
+    int arr[70];
+    for (size_t n = 1; n <= 70; n++) {
+        fill_even_pairs(arr, n);
+        int *eyt = eytzinger_build(arr, n, sizeof(int));
+        ASSERT_NOT_NULL(eyt);
+        for (int target = -1; target <= (int)n + 1; target++) {
+            size_t expected = lower_bound_linear(arr, n, target);
+            size_t k = eytzinger_lower_bound(eyt, n, sizeof(int), &target, compare_int);
+            ASSERT_EQ(eytzinger_lower_bound_int(eyt, n, target), k);
+            if (expected == n) {
+                ASSERT_EQ(k, SEARCH_NOT_FOUND);
+            } else {
+                ASSERT_TRUE(k < n);
+                ASSERT_EQ(eyt[k], arr[expected]);
+            }
+        }
+        free(eyt);
+    }
+    ASSERT_NULL(eytzinger_build(arr, 0, sizeof(int)));
+}
+
+TEST(eytzinger_batch_matches_single) {
+    int arr[777];
+    int targets[29];
+    size_t out[29];
+    fill_even_pairs(arr, 777);
+    int *eyt = eytzinger_build(arr, 777, sizeof(int));
+    ASSERT_NOT_NULL(eyt);
+    for (size_t j = 0; j < 29; j++) targets[j] = (int)((j * 97) % 800) - 5;
+    eytzinger_lower_bound_batch(eyt, 777, sizeof(int), targets, 29, compare_int, out);
+    for (size_t j = 0; j < 29; j++) {
+        ASSERT_EQ(out[j], eytzinger_lower_bound(eyt, 777, sizeof(int), &targets[j], compare_int));
+    }
+    eytzinger_lower_bound_int_batch(eyt, 777, targets, 29, out);
+    for (size_t j = 0; j < 29; j++) {
+        ASSERT_EQ(out[j], eytzinger_lower_bound_int(eyt, 777, targets[j]));
+    }
+    free(eyt);
+}
+
 // ============================================================================
 // EDGE CASES
 // ============================================================================
@@ -152,6 +328,8 @@ TEST(exponential_search_not_found) {
 TEST(null_params) {
     ASSERT_EQ(linear_search(NULL, 5, sizeof(int), NULL, compare_int), SEARCH_NOT_FOUND);
     ASSERT_EQ(binary_search(NULL, 5, sizeof(int), NULL, compare_int), SEARCH_NOT_FOUND);
+    ASSERT_EQ(lower_bound_branchless(NULL, 5, sizeof(int), NULL, compare_int), SEARCH_NOT_FOUND);
+    ASSERT_EQ(eytzinger_lower_bound(NULL, 5, sizeof(int), NULL, compare_int), SEARCH_NOT_FOUND);
 }
 
 // ============================================================================
@@ -179,6 +357,14 @@ int main(void) {
     RUN_TEST(exponential_search_found);
     RUN_TEST(exponential_search_first);
     RUN_TEST(exponential_search_not_found);
+    RUN_TEST(linear_search_typed_all_positions);
+    RUN_TEST(linear_search_typed_first_occurrence);
+    RUN_TEST(jump_and_exponential_typed_paths);
+    RUN_TEST(lower_bound_all_sizes);
+    RUN_TEST(lower_bound_batch_matches_single);
+    RUN_TEST(binary_search_batch_matches_single);
+    RUN_TEST(eytzinger_lower_bound_all_sizes);
+    RUN_TEST(eytzinger_batch_matches_single);
     RUN_TEST(null_params);
 
     printf("\nAll Searching tests passed!\n");
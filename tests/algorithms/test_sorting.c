@@ -12,6 +12,8 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <math.h>
+#include <limits.h>
 
 // ============================================================================
 // HELPERS
@@ -25,6 +27,15 @@ static void fill_random(int *arr, size_t n) {
     for (size_t i = 0; i < n; i++) arr[i] = (int)(i * 97 + 31) % 1000;
 }
 
+typedef struct {
+    int key;
+    int seq;         // posicao original, para conferir estabilidade
+} Tagged;
+
+static int compare_tagged(const void *a, const void *b) {
+    return compare_int(&((const Tagged *)a)->key, &((const Tagged *)b)->key);
+}
+
 static void assert_sorted_int(int *arr, size_t n) {
     ASSERT_TRUE(is_sorted(arr, n, sizeof(int), compare_int));
 }
@@ -173,6 +184,79 @@ TEST(radix_sort_basic) {
     for (size_t i = 0; i < 7; i++) ASSERT_TRUE(arr[i] <= arr[i + 1]);
 }
 
+// ============================================================================
+// RADIX SORT BASE 256
+// ============================================================================
+
+TEST(radix_sort_u32_u64) {
+    static uint32_t a[100000];
+    static uint64_t b[100000];
+    size_t n = 100000;
+    uint64_t x = 88172645463325252ull;
+    for (size_t i = 0; i < n; i++) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        a[i] = (uint32_t)x;
+        b[i] = x;
+    }
+    radix_sort_u32(a, n, 4);
+    radix_sort_u64(b, n, 1);
+    for (size_t i = 1; i < n; i++) {
+        ASSERT_TRUE(a[i - 1] <= a[i]);
+        ASSERT_TRUE(b[i - 1] <= b[i]);
+    }
+
+    // Bytes altos constantes: passos pulados, mesmo resultado
+    uint64_t small[6] = {5, 3, 255, 0, 256, 3};
+    radix_sort_u64(small, 6, 0);
+    ASSERT_EQ(small[0], (uint64_t)0);
+    ASSERT_EQ(small[2], (uint64_t)3);
+    ASSERT_EQ(small[5], (uint64_t)256);
+    radix_sort_u64(NULL, 6, 0);
+}
+
+TEST(radix_sort_signed_and_float) {
+    int64_t s[8] = {5, -1, INT64_MIN, 0, INT64_MAX, -300, 7, -1};
+    radix_sort_i64(s, 8, 0);
+    for (size_t i = 1; i < 8; i++) ASSERT_TRUE(s[i - 1] <= s[i]);
+    ASSERT_EQ(s[0], INT64_MIN);
+    ASSERT_EQ(s[7], INT64_MAX);
+
+    double d[9] = {3.5, -0.0, -2.25, 1e300, -1e-300, 0.0, -INFINITY, INFINITY, 2.0};
+    radix_sort_double(d, 9, 0);
+    for (size_t i = 1; i < 9; i++) ASSERT_TRUE(d[i - 1] <= d[i]);
+    ASSERT_TRUE(isinf(d[0]) && d[0] < 0);
+    ASSERT_TRUE(signbit(d[3]) && d[3] == 0.0);   // -0.0 antes de +0.0
+    ASSERT_TRUE(!signbit(d[4]) && d[4] == 0.0);
+
+    float f[7] = {1.5f, -1.5f, 0.25f, -100.0f, 100.0f, 0.0f, -0.25f};
+    radix_sort_float(f, 7, 0);
+    for (size_t i = 1; i < 7; i++) ASSERT_TRUE(f[i - 1] <= f[i]);
+    ASSERT_TRUE(f[0] == -100.0f);
+}
+
+TEST(radix_sort_key_value_stable) {
+    size_t n = 70000;                       // acima do limite do histograma paralelo
+    double *keys = malloc(n * sizeof(double));
+    Tagged *vals = malloc(n * sizeof(Tagged));
+    ASSERT_NOT_NULL(keys);
+    ASSERT_NOT_NULL(vals);
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = (double)((int)((i * 2654435761u) % 401u) - 200) * 0.5;
+        vals[i].key = (int)(keys[i] * 2.0);
+        vals[i].seq = (int)i;
+    }
+    radix_sort_kv(RADIX_KEY_DOUBLE, keys, vals, n, sizeof(Tagged), 4);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(vals[i].key, (int)(keys[i] * 2.0));    // valor acompanha a chave
+        if (i > 0) {
+            ASSERT_TRUE(keys[i - 1] <= keys[i]);
+            if (keys[i - 1] == keys[i]) ASSERT_TRUE(vals[i - 1].seq < vals[i].seq);
+        }
+    }
+    free(keys);
+    free(vals);
+}
+
 // ============================================================================
 // BUCKET SORT
 // ============================================================================
@@ -207,6 +291,179 @@ TEST(sort_doubles) {
     ASSERT_TRUE(is_sorted(arr, 5, sizeof(double), compare_double));
 }
 
+// ============================================================================
+// ORDENACAO PARALELA
+// ============================================================================
+
+TEST(parallel_merge_sort_stable) {
+    size_t n = 100000;
+    Tagged *t = malloc(n * sizeof(Tagged));
+    ASSERT_NOT_NULL(t);
+    const size_t threads[] = {1, 4};
+    for (size_t k = 0; k < 2; k++) {
+        for (size_t i = 0; i < n; i++) {
+            t[i].key = (int)((i * 2654435761u) % 997u);
+            t[i].seq = (int)i;
+        }
+        parallel_merge_sort(t, n, sizeof(Tagged), compare_tagged, threads[k]);
+        for (size_t i = 1; i < n; i++) {
+            ASSERT_TRUE(t[i - 1].key <= t[i].key);
+            if (t[i - 1].key == t[i].key) ASSERT_TRUE(t[i - 1].seq < t[i].seq);
+        }
+    }
+    free(t);
+
+    int small[] = {5, 2, 9, 1};
+    parallel_merge_sort(small, 4, sizeof(int), compare_int, 0);
+    assert_sorted_int(small, 4);
+    parallel_merge_sort(NULL, 4, sizeof(int), compare_int, 0);
+}
+
+TEST(parallel_sample_sort_patterns) {
+    size_t n = 300000;
+    int *a = malloc(n * sizeof(int));
+    int *b = malloc(n * sizeof(int));
+    ASSERT_NOT_NULL(a);
+    ASSERT_NOT_NULL(b);
+    // Aleatorio, poucas chaves (buckets de iguais), ordenado e invertido
+    for (int pattern = 0; pattern < 4; pattern++) {
+        for (size_t i = 0; i < n; i++) {
+            switch (pattern) {
+                case 0: a[i] = (int)((i * 2654435761u) % 1000003u); break;
+                case 1: a[i] = (int)(i * 31 % 5); break;
+                case 2: a[i] = (int)i; break;
+                default: a[i] = (int)(n - i); break;
+            }
+        }
+        memcpy(b, a, n * sizeof(int));
+        parallel_sample_sort(a, n, sizeof(int), compare_int, 4);
+        quick_sort(b, n, sizeof(int), compare_int);
+        ASSERT_EQ(memcmp(a, b, n * sizeof(int)), 0);
+    }
+    free(a);
+    free(b);
+
+    int small[] = {3, 1, 2};
+    parallel_sample_sort(small, 3, sizeof(int), compare_int, 8);
+    assert_sorted_int(small, 3);
+}
+
+// ============================================================================
+// KERNELS ESPECIALIZADOS
+// ============================================================================
+
+typedef struct {
+    int key;
+    int value;
+} KeyValue;
+
+#define KEY_VALUE_GREATER(a, b) ((a).key > (b).key)
+SORT_DEFINE_WITH(key_value_desc, KeyValue, KEY_VALUE_GREATER)
+
+TEST(sort_int_matches_generic) {
+    static int a[5000];
+    static int b[5000];
+    // Aleatorio, ordenado, invertido, poucas chaves e organ pipe
+    for (int pattern = 0; pattern < 5; pattern++) {
+        size_t n = 5000;
+        for (size_t i = 0; i < n; i++) {
+            switch (pattern) {
+                case 0: a[i] = (int)((i * 2654435761u) % 100003u) - 50000; break;
+                case 1: a[i] = (int)i; break;
+                case 2: a[i] = (int)(n - i); break;
+                case 3: a[i] = (int)(i * 7 % 3); break;
+                default: a[i] = (int)((i < n / 2) ? i : n - i); break;
+            }
+        }
+        memcpy(b, a, sizeof(a));
+        sort_int(a, n);
+        quick_sort(b, n, sizeof(int), compare_int);
+        ASSERT_EQ(memcmp(a, b, sizeof(a)), 0);
+    }
+    sort_int(NULL, 10);
+    sort_int(a, 0);
+}
+
+TEST(sort_double_and_uint64) {
+    double d[1000];
+    uint64_t u[1000];
+    for (size_t i = 0; i < 1000; i++) {
+        d[i] = (double)((i * 7919u) % 1000u) * 1e-12;   // abaixo do epsilon de compare_double
+        u[i] = (uint64_t)(i * 0x9E3779B97F4A7C15ull);
+    }
+    sort_double(d, 1000);
+    sort_uint64_t(u, 1000);
+    for (size_t i = 1; i < 1000; i++) {
+        ASSERT_TRUE(d[i - 1] < d[i]);
+        ASSERT_TRUE(u[i - 1] <= u[i]);
+    }
+
+    // NaN nao tem posicao definida, mas os demais valores seguem presentes
+    double with_nan[200];
+    for (size_t i = 0; i < 200; i++) with_nan[i] = (i % 13 == 0) ? NAN : (double)(200 - i);
+    sort_double(with_nan, 200);
+    size_t nans = 0;
+    for (size_t i = 0; i < 200; i++) nans += isnan(with_nan[i]) ? 1 : 0;
+    ASSERT_EQ(nans, (size_t)16);
+}
+
+TEST(sort_define_with_custom_order) {
+    KeyValue kv[300];
+    for (size_t i = 0; i < 300; i++) {
+        kv[i].key = (int)((i * 37) % 101);
+        kv[i].value = kv[i].key * 2;
+    }
+    sort_key_value_desc(kv, 300);
+    for (size_t i = 0; i < 300; i++) {
+        if (i > 0) ASSERT_TRUE(kv[i - 1].key >= kv[i].key);
+        ASSERT_EQ(kv[i].value, kv[i].key * 2);
+    }
+}
+
+// ============================================================================
+// REDES DE ORDENACAO
+// ============================================================================
+
+TEST(sort_small_int_all_sizes) {
+    int a[40];
+    int b[40];
+    uint32_t state = 2463534242u;
+    for (size_t n = 0; n <= 40; n++) {
+        for (int trial = 0; trial < 50; trial++) {
+            for (size_t i = 0; i < n; i++) {
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                // Faixa pequena (repetidos) ou inteira, incluindo INT_MIN/INT_MAX
+                a[i] = (trial % 2) ? (int)(state % 5u) : (int)state;
+            }
+            if (n > 2 && trial == 2) { a[0] = INT_MAX; a[n - 1] = INT_MIN; }
+            memcpy(b, a, n * sizeof(int));
+            sort_small_int(a, n);
+            insertion_sort(b, n, sizeof(int), compare_int);
+            ASSERT_EQ(memcmp(a, b, n * sizeof(int)), 0);
+        }
+    }
+    sort_small_int(NULL, 8);
+}
+
+TEST(sort_small_float_total_order) {
+    float f[] = {3.5f, -0.0f, NAN, -INFINITY, 0.0f, 1e-30f, -2.0f, INFINITY,
+                 -1e-30f, 7.0f, 3.5f, -7.0f};
+    size_t n = sizeof(f) / sizeof(f[0]);
+    sort_small_float(f, n);
+    for (size_t i = 1; i + 1 < n; i++) ASSERT_TRUE(f[i - 1] <= f[i]);
+    ASSERT_TRUE(isinf(f[0]) && f[0] < 0);
+    ASSERT_TRUE(signbit(f[4]) && f[4] == 0.0f);   // -0 antes de +0
+    ASSERT_TRUE(!signbit(f[5]) && f[5] == 0.0f);
+    ASSERT_TRUE(isnan(f[n - 1]));
+
+    float g[32];
+    for (size_t i = 0; i < 32; i++) g[i] = (float)((i * 13) % 32) - 16.0f;
+    sort_small_float(g, 32);
+    for (size_t i = 0; i < 32; i++) ASSERT_TRUE(g[i] == (float)i - 16.0f);
+}
+
 // ============================================================================
 // EDGE CASES
 // ============================================================================
@@ -242,9 +499,19 @@ int main(void) {
     RUN_TEST(heap_sort_large);
     RUN_TEST(counting_sort_basic);
     RUN_TEST(radix_sort_basic);
+    RUN_TEST(radix_sort_u32_u64);
+    RUN_TEST(radix_sort_signed_and_float);
+    RUN_TEST(radix_sort_key_value_stable);
     RUN_TEST(bucket_sort_basic);
     RUN_TEST(is_sorted_check);
     RUN_TEST(sort_doubles);
+    RUN_TEST(parallel_merge_sort_stable);
+    RUN_TEST(parallel_sample_sort_patterns);
+    RUN_TEST(sort_int_matches_generic);
+    RUN_TEST(sort_double_and_uint64);
+    RUN_TEST(sort_define_with_custom_order);
+    RUN_TEST(sort_small_int_all_sizes);
+    RUN_TEST(sort_small_float_total_order);
     RUN_TEST(null_and_empty);
 
     printf("\nAll Sorting tests passed!\n");
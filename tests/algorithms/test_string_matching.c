@@ -249,6 +249,494 @@ TEST(stress_long_text) {
     ASSERT_EQ(b, 995);
 }
 
+// ============================================================================
+// VARIANTES BINARIAS (*_mem)
+// ============================================================================
+
+typedef size_t (*MemSearchFn)(const void *, size_t, const void *, size_t);
+typedef MatchResult (*MemSearchAllFn)(const void *, size_t, const void *, size_t);
+
+static size_t naive_mem_count(const unsigned char *t, size_t n, const unsigned char *p,
+                              size_t m, size_t *first) {
+    size_t count = 0;
+    *first = SM_NOT_FOUND;
+    for (size_t s = 0; m > 0 && s + m <= n; s++) {
+        if (memcmp(t + s, p, m) == 0) {
+            if (count++ == 0) *first = s;
+        }
+    }
+    return count;
+}
+
+TEST(mem_embedded_nul) {
+    const char text[] = {'a', '\0', 'b', 'c', '\0', 'b', 'c', 'x'};
+    const char pattern[] = {'\0', 'b', 'c'};
+    const MemSearchFn first[] = {kmp_search_mem, rabin_karp_search_mem,
+                                 boyer_moore_search_mem, simd_search_mem};
+    const MemSearchAllFn all[] = {kmp_search_all_mem, rabin_karp_search_all_mem,
+                                  boyer_moore_search_all_mem, simd_search_all_mem};
+    for (size_t a = 0; a < 4; a++) {
+        ASSERT_EQ(first[a](text, 8, pattern, 3), 1);
+        ASSERT_EQ(first[a](text, 8, pattern, 0), 0);
+        ASSERT_EQ(first[a](text, 2, pattern, 3), SM_NOT_FOUND);
+        ASSERT_EQ(first[a](NULL, 8, pattern, 3), SM_NOT_FOUND);
+        ASSERT_EQ(first[a](text, 8, NULL, 3), SM_NOT_FOUND);
+
+        MatchResult r = all[a](text, 8, pattern, 3);
+        ASSERT_EQ(r.count, 2);
+        ASSERT_EQ(r.positions[0], 1);
+        ASSERT_EQ(r.positions[1], 4);
+        match_result_destroy(&r);
+    }
+    // A versao string para no primeiro NUL
+    ASSERT_EQ(kmp_search("a\0bc", "bc"), SM_NOT_FOUND);
+}
+
+TEST(mem_random_binary_matches_naive) {
+    const MemSearchFn first[] = {kmp_search_mem, rabin_karp_search_mem,
+                                 boyer_moore_search_mem, simd_search_mem};
+    const MemSearchAllFn all[] = {kmp_search_all_mem, rabin_karp_search_all_mem,
+                                  boyer_moore_search_all_mem, simd_search_all_mem};
+    static unsigned char text[4096];
+    unsigned char pattern[64];
+    unsigned state = 4242u;
+
+    for (int round = 0; round < 60; round++) {
+        // Alfabetos pequenos (muitas ocorrencias e padroes periodicos) e 256 bytes
+        unsigned sigma = (round % 3 == 0) ? 2u : (round % 3 == 1) ? 4u : 256u;
+        for (size_t i = 0; i < sizeof(text); i++) {
+            state = state * 1103515245u + 12345u;
+            text[i] = (unsigned char)((state >> 16) % sigma);
+        }
+        state = state * 1103515245u + 12345u;
+        size_t m = 1 + (state >> 16) % sizeof(pattern);
+        state = state * 1103515245u + 12345u;
+        size_t at = (state >> 16) % (sizeof(text) - m);
+        if (round % 2 == 0) {
+            memcpy(pattern, text + at, m);
+        } else {
+            for (size_t i = 0; i < m; i++) pattern[i] = (unsigned char)((i % 3 == 0) ? 0 : 1);
+        }
+
+        size_t expected_first;
+        size_t expected = naive_mem_count(text, sizeof(text), pattern, m, &expected_first);
+        for (size_t a = 0; a < 4; a++) {
+            ASSERT_EQ(first[a](text, sizeof(text), pattern, m), expected_first);
+            MatchResult r = all[a](text, sizeof(text), pattern, m);
+            ASSERT_EQ(r.count, expected);
+            for (size_t i = 0; i < r.count; i++) {
+                ASSERT_EQ(memcmp(text + r.positions[i], pattern, m), 0);
+                if (i > 0) ASSERT_TRUE(r.positions[i] > r.positions[i - 1]);
+            }
+            match_result_destroy(&r);
+        }
+    }
+}
+
+// ============================================================================
+// HORSPOOL, BNDM, SHIFT-OR E PADROES PRE-COMPILADOS
+// ============================================================================
+
+TEST(pattern_compile_invalid) {
+    char long_pattern[65];
+    memset(long_pattern, 'a', sizeof(long_pattern));
+    ASSERT_NULL(string_pattern_compile(NULL, 3, SM_ALGO_AUTO));
+    ASSERT_NULL(string_pattern_compile("abc", 0, SM_ALGO_AUTO));
+    ASSERT_NULL(string_pattern_compile(long_pattern, 65, SM_ALGO_BNDM));
+    ASSERT_NULL(string_pattern_compile(long_pattern, 65, SM_ALGO_SHIFT_OR));
+    ASSERT_NULL(string_pattern_compile("abc", 3, (StringSearchAlgorithm)99));
+
+    StringPattern *sp = string_pattern_compile(long_pattern, 64, SM_ALGO_SHIFT_OR);
+    ASSERT_NOT_NULL(sp);
+    ASSERT_EQ(string_pattern_search(sp, NULL, 10), SM_NOT_FOUND);
+    ASSERT_EQ(string_pattern_search(NULL, "abc", 3), SM_NOT_FOUND);
+    string_pattern_destroy(sp);
+    string_pattern_destroy(NULL);
+
+    ASSERT_EQ(string_search_auto("abc", 3, "", 0), 0);
+    ASSERT_EQ(string_search_auto("abc", 3, "abcd", 4), SM_NOT_FOUND);
+    ASSERT_EQ(bndm_search_mem("abc", 3, long_pattern, 65), SM_NOT_FOUND);
+}
+
+TEST(pattern_algorithms_match_naive) {
+    static unsigned char text[3000];
+    unsigned char pattern[100];
+    unsigned state = 99u;
+
+    for (int round = 0; round < 90; round++) {
+        unsigned sigma = (round % 3 == 0) ? 2u : (round % 3 == 1) ? 4u : 256u;
+        for (size_t i = 0; i < sizeof(text); i++) {
+            state = state * 1103515245u + 12345u;
+            text[i] = (unsigned char)((state >> 16) % sigma);
+        }
+        state = state * 1103515245u + 12345u;
+        size_t m = 1 + (state >> 16) % sizeof(pattern);
+        state = state * 1103515245u + 12345u;
+        memcpy(pattern, text + (state >> 16) % (sizeof(text) - m), m);
+        if (round % 4 == 3) pattern[m / 2] ^= 1;     // provavelmente ausente
+
+        size_t expected_first;
+        size_t expected = naive_mem_count(text, sizeof(text), pattern, m, &expected_first);
+        for (int algo = SM_ALGO_AUTO; algo <= SM_ALGO_SIMD; algo++) {
+            StringPattern *sp = string_pattern_compile(pattern, m, (StringSearchAlgorithm)algo);
+            if (m > 64 && (algo == SM_ALGO_BNDM || algo == SM_ALGO_SHIFT_OR)) {
+                ASSERT_NULL(sp);
+                continue;
+            }
+            ASSERT_NOT_NULL(sp);
+            ASSERT_EQ(string_pattern_search(sp, text, sizeof(text)), expected_first);
+            MatchResult r = string_pattern_search_all(sp, text, sizeof(text));
+            ASSERT_EQ(r.count, expected);
+            for (size_t i = 0; i < r.count; i++) {
+                ASSERT_EQ(memcmp(text + r.positions[i], pattern, m), 0);
+            }
+            match_result_destroy(&r);
+            string_pattern_destroy(sp);
+        }
+        ASSERT_EQ(string_search_auto(text, sizeof(text), pattern, m), expected_first);
+        if (m <= 64) {
+            ASSERT_EQ(bndm_search_mem(text, sizeof(text), pattern, m), expected_first);
+            ASSERT_EQ(shift_or_search_mem(text, sizeof(text), pattern, m), expected_first);
+        }
+        ASSERT_EQ(horspool_search_mem(text, sizeof(text), pattern, m), expected_first);
+    }
+}
+
+TEST(pattern_reuse_across_lines) {
+    const char *lines[] = {"GET /index.html 200", "POST /login 403", "GET /login 200", "ERROR"};
+    StringPattern *sp = string_pattern_compile("/login", 6, SM_ALGO_AUTO);
+    ASSERT_NOT_NULL(sp);
+    ASSERT_TRUE(string_pattern_algorithm(sp) != SM_ALGO_AUTO);
+    size_t hits = 0;
+    for (size_t i = 0; i < 4; i++) {
+        if (string_pattern_search(sp, lines[i], strlen(lines[i])) != SM_NOT_FOUND) hits++;
+    }
+    ASSERT_EQ(hits, 2);
+    string_pattern_destroy(sp);
+
+    MatchResult r = shift_or_search_all_mem("aaaa", 4, "aa", 2);
+    ASSERT_EQ(r.count, 3);
+    match_result_destroy(&r);
+    r = horspool_search_all_mem("abababa", 7, "aba", 3);
+    ASSERT_EQ(r.count, 3);
+    match_result_destroy(&r);
+    r = bndm_search_all_mem("abababa", 7, "bab", 3);
+    ASSERT_EQ(r.count, 2);
+    ASSERT_EQ(r.positions[1], 3);
+    match_result_destroy(&r);
+}
+
+TEST(pattern_compiled_kmp_bm_reuse_storage) {
+    StringPattern *kmp = kmp_compile("abab", 4);
+    StringPattern *bm = bm_compile("abab", 4);
+    ASSERT_NOT_NULL(kmp);
+    ASSERT_NOT_NULL(bm);
+    ASSERT_EQ(string_pattern_algorithm(kmp), SM_ALGO_KMP);
+    ASSERT_EQ(string_pattern_algorithm(bm), SM_ALGO_BOYER_MOORE);
+    ASSERT_NULL(kmp_compile(NULL, 4));
+    ASSERT_NULL(bm_compile("x", 0));
+
+    MatchResult rk = match_result_create();
+    MatchResult rb = match_result_create();
+    ASSERT_TRUE(string_pattern_search_into(kmp, "abababab", 8, &rk));
+    ASSERT_TRUE(string_pattern_search_into(bm, "abababab", 8, &rb));
+    ASSERT_EQ(rk.count, 3);
+    ASSERT_EQ(rb.count, 3);
+    size_t *storage = rk.positions;
+    size_t capacity = rk.capacity;
+
+    // Linhas seguintes: mesmo array, sem realocar
+    const char *lines[] = {"xxabab", "ab", "", "ababxabab"};
+    const size_t counts[] = {1, 0, 0, 2};
+    for (size_t i = 0; i < 4; i++) {
+        ASSERT_TRUE(string_pattern_search_into(kmp, lines[i], strlen(lines[i]), &rk));
+        ASSERT_TRUE(string_pattern_search_into(bm, lines[i], strlen(lines[i]), &rb));
+        ASSERT_EQ(rk.count, counts[i]);
+        ASSERT_EQ(rb.count, counts[i]);
+        for (size_t j = 0; j < rk.count; j++) ASSERT_EQ(rk.positions[j], rb.positions[j]);
+        ASSERT_TRUE(rk.positions == storage);
+        ASSERT_EQ(rk.capacity, capacity);
+    }
+    ASSERT_FALSE(string_pattern_search_into(kmp, NULL, 3, &rk));
+    ASSERT_EQ(rk.count, 0);
+    ASSERT_FALSE(string_pattern_search_into(kmp, "ab", 2, NULL));
+
+    match_result_destroy(&rk);
+    match_result_destroy(&rb);
+    string_pattern_destroy(kmp);
+    string_pattern_destroy(bm);
+}
+
+TEST(pattern_choose_by_alphabet) {
+    const char *dna = "ACGTTGCAACGTTGCAACGTTGCAACGTTGCAACGT";     // 36 bytes, 4 distintos
+    ASSERT_EQ(string_search_choose(dna, strlen(dna)), SM_ALGO_BNDM);
+    ASSERT_EQ(string_search_choose("ab", 2), SM_ALGO_SIMD);
+    ASSERT_EQ(string_search_choose(NULL, 10), SM_ALGO_SIMD);
+    const char *bits = "0101100111010010";                       // 16 bytes, 2 distintos
+    ASSERT_EQ(string_search_choose(bits, 16), SM_ALGO_SHIFT_OR);
+}
+
+// ============================================================================
+// SIMD SEARCH
+// ============================================================================
+
+TEST(simd_basic) {
+    ASSERT_EQ(simd_search("hello world", "world"), 6);
+    ASSERT_EQ(simd_search("abcdef", "abc"), 0);
+    ASSERT_EQ(simd_search("abcdef", "f"), 5);
+    ASSERT_EQ(simd_search("abcdef", "xyz"), SM_NOT_FOUND);
+    ASSERT_EQ(simd_search("abc", ""), 0);
+    ASSERT_EQ(simd_search("abc", "abcd"), SM_NOT_FOUND);
+    ASSERT_EQ(simd_search(NULL, "a"), SM_NOT_FOUND);
+    ASSERT_EQ(simd_search("a", NULL), SM_NOT_FOUND);
+}
+
+TEST(simd_first_last_byte_false_positives) {
+    // Muitas posicoes com primeiro e ultimo byte corretos, meio errado
+    char text[200];
+    for (size_t i = 0; i < 199; i++) text[i] = (i % 4 == 0) ? 'a' : 'x';
+    text[199] = '\0';
+    ASSERT_EQ(simd_search(text, "axxxa"), 0);
+    ASSERT_EQ(simd_search(text, "axyxa"), SM_NOT_FOUND);
+
+    memcpy(text + 180, "aXYZa", 5);
+    ASSERT_EQ(simd_search(text, "aXYZa"), 180);
+}
+
+TEST(simd_matches_naive) {
+    // Todos os tamanhos em torno das larguras de 16/32 bytes, com sobreposicao
+    static char text[301];
+    unsigned state = 777u;
+    for (size_t i = 0; i < 300; i++) {
+        state = state * 1103515245u + 12345u;
+        text[i] = (char)('a' + (state >> 16) % 2);
+    }
+    text[300] = '\0';
+
+    char pattern[48];
+    for (size_t m = 1; m < sizeof(pattern); m++) {
+        for (size_t start = 0; start < 300 - m; start += 37) {
+            memcpy(pattern, text + start, m);
+            pattern[m] = '\0';
+            for (size_t len = 250; len <= 300; len += 7) {
+                char saved = text[len];
+                text[len] = '\0';
+                ASSERT_EQ(simd_search(text, pattern), naive_search(text, pattern));
+                MatchResult rs = simd_search_all(text, pattern);
+                MatchResult rn = naive_search_all(text, pattern);
+                ASSERT_EQ(rs.count, rn.count);
+                for (size_t i = 0; i < rn.count; i++) ASSERT_EQ(rs.positions[i], rn.positions[i]);
+                match_result_destroy(&rs);
+                match_result_destroy(&rn);
+                text[len] = saved;
+            }
+        }
+    }
+}
+
+// ============================================================================
+// AHO-CORASICK
+// ============================================================================
+
+TEST(aho_corasick_classic_example) {
+    const char *patterns[] = {"he", "she", "his", "hers"};
+    AhoCorasick *ac = aho_corasick_create(patterns, 4);
+    ASSERT_NOT_NULL(ac);
+    ASSERT_EQ(aho_corasick_states(ac), 10);
+
+    AhoMatchResult r = aho_corasick_search_all(ac, "ushers");
+    ASSERT_EQ(r.count, 3);
+    // Mesma posicao final: do mais longo para o mais curto
+    ASSERT_EQ(r.matches[0].pattern, 1);
+    ASSERT_EQ(r.matches[0].position, 1);
+    ASSERT_EQ(r.matches[1].pattern, 0);
+    ASSERT_EQ(r.matches[1].position, 2);
+    ASSERT_EQ(r.matches[2].pattern, 3);
+    ASSERT_EQ(r.matches[2].position, 2);
+    aho_match_result_destroy(&r);
+    aho_corasick_destroy(ac);
+}
+
+TEST(aho_corasick_null_args) {
+    const char *patterns[] = {"abc", ""};
+    const char *with_null[] = {"abc", NULL};
+    ASSERT_NULL(aho_corasick_create(NULL, 1));
+    ASSERT_NULL(aho_corasick_create(patterns, 0));
+    ASSERT_NULL(aho_corasick_create(patterns, 2));
+    ASSERT_NULL(aho_corasick_create(with_null, 2));
+
+    AhoCorasick *ac = aho_corasick_create(patterns, 1);
+    ASSERT_NOT_NULL(ac);
+    AhoMatchResult r = aho_corasick_search_all(ac, NULL);
+    ASSERT_EQ(r.count, 0);
+    r = aho_corasick_search_all(NULL, "abc");
+    ASSERT_EQ(r.count, 0);
+    ASSERT_EQ(aho_corasick_scan(ac, NULL, 3, NULL, NULL), 0);
+    aho_corasick_destroy(ac);
+    aho_corasick_destroy(NULL);
+}
+
+static bool stop_after_two(size_t pattern, size_t position, void *ctx) {
+    (void)pattern;
+    (void)position;
+    size_t *seen = ctx;
+    return ++(*seen) < 2;
+}
+
+TEST(aho_corasick_scan_binary_and_stop) {
+    const char *patterns[] = {"aa", "a", "aa"};
+    AhoCorasick *ac = aho_corasick_create(patterns, 3);
+    ASSERT_NOT_NULL(ac);
+
+    // Bytes nulos no meio do texto: "aa\0aa"
+    const char text[] = {'a', 'a', '\0', 'a', 'a'};
+    ASSERT_EQ(aho_corasick_scan(ac, text, 5, NULL, NULL), 8);
+
+    size_t seen = 0;
+    ASSERT_EQ(aho_corasick_scan(ac, text, 5, stop_after_two, &seen), 2);
+    ASSERT_EQ(seen, 2);
+    aho_corasick_destroy(ac);
+}
+
+TEST(aho_corasick_matches_kmp) {
+    // Muitos padroes sobre alfabeto pequeno: sobreposicoes e sufixos comuns
+    enum { K = 200, LEN = 20000 };
+    static char storage[K][8];
+    const char *patterns[K];
+    unsigned state = 12345u;
+    for (size_t p = 0; p < K; p++) {
+        state = state * 1103515245u + 12345u;
+        size_t m = 1 + (state >> 16) % 6;
+        for (size_t i = 0; i < m; i++) {
+            state = state * 1103515245u + 12345u;
+            storage[p][i] = (char)('a' + (state >> 16) % 3);
+        }
+        storage[p][m] = '\0';
+        patterns[p] = storage[p];
+    }
+    static char text[LEN + 1];
+    for (size_t i = 0; i < LEN; i++) {
+        state = state * 1103515245u + 12345u;
+        text[i] = (char)('a' + (state >> 16) % 4);
+    }
+    text[LEN] = '\0';
+
+    AhoCorasick *ac = aho_corasick_create(patterns, K);
+    ASSERT_NOT_NULL(ac);
+    AhoMatchResult r = aho_corasick_search_all(ac, text);
+
+    static size_t per_pattern[K];
+    memset(per_pattern, 0, sizeof(per_pattern));
+    for (size_t i = 0; i < r.count; i++) {
+        size_t p = r.matches[i].pattern;
+        size_t pos = r.matches[i].position;
+        ASSERT_TRUE(p < K);
+        ASSERT_EQ(strncmp(text + pos, patterns[p], strlen(patterns[p])), 0);
+        per_pattern[p]++;
+    }
+    size_t total = 0;
+    for (size_t p = 0; p < K; p++) {
+        MatchResult kr = kmp_search_all(text, patterns[p]);
+        ASSERT_EQ(per_pattern[p], kr.count);
+        total += kr.count;
+        match_result_destroy(&kr);
+    }
+    ASSERT_EQ(r.count, total);
+    aho_match_result_destroy(&r);
+    aho_corasick_destroy(ac);
+}
+
+static bool collect_match(size_t pattern, size_t position, void *ctx) {
+    AhoMatchResult *r = ctx;
+    if (r->count == r->capacity) return false;
+    r->matches[r->count++] = (AhoMatch){pattern, position};
+    return true;
+}
+
+TEST(aho_stream_chunks_match_whole_scan) {
+    const char *patterns[] = {"abcab", "bca", "cab", "a", "abcabcabc"};
+    AhoCorasick *ac = aho_corasick_create(patterns, 5);
+    ASSERT_NOT_NULL(ac);
+    const char *text = "abcabcabcabxabcabcab";
+    size_t n = strlen(text);
+
+    static AhoMatch whole_buf[256], chunk_buf[256];
+    AhoMatchResult whole = {whole_buf, 0, 256};
+    ASSERT_EQ(aho_corasick_scan(ac, text, n, collect_match, &whole), whole.count);
+    ASSERT_TRUE(whole.count > 10);
+
+    // Todos os tamanhos de bloco: ocorrencias cruzam as fronteiras
+    for (size_t chunk = 1; chunk <= n; chunk++) {
+        AhoMatchResult got = {chunk_buf, 0, 256};
+        AhoStream stream;
+        aho_stream_init(&stream, ac);
+        for (size_t off = 0; off < n; off += chunk) {
+            size_t len = (n - off < chunk) ? n - off : chunk;
+            aho_stream_feed(&stream, text + off, len, collect_match, &got);
+        }
+        ASSERT_EQ(stream.offset, n);
+        ASSERT_EQ(got.count, whole.count);
+        for (size_t i = 0; i < whole.count; i++) {
+            ASSERT_EQ(got.matches[i].pattern, whole.matches[i].pattern);
+            ASSERT_EQ(got.matches[i].position, whole.matches[i].position);
+        }
+    }
+    aho_corasick_destroy(ac);
+}
+
+TEST(aho_stream_stop_and_null_args) {
+    const char *patterns[] = {"ab"};
+    AhoCorasick *ac = aho_corasick_create(patterns, 1);
+    ASSERT_NOT_NULL(ac);
+
+    AhoStream stream;
+    aho_stream_init(&stream, ac);
+    ASSERT_EQ(aho_stream_feed(&stream, NULL, 4, NULL, NULL), 0);
+    ASSERT_EQ(aho_stream_feed(&stream, "a", 1, NULL, NULL), 0);
+    ASSERT_EQ(aho_stream_feed(&stream, "ba", 2, NULL, NULL), 1);
+    ASSERT_EQ(aho_stream_feed(&stream, "b", 1, NULL, NULL), 1);
+    ASSERT_EQ(stream.offset, 4);
+
+    size_t seen = 0;
+    aho_stream_init(&stream, ac);
+    ASSERT_EQ(aho_stream_feed(&stream, "ababab", 6, stop_after_two, &seen), 2);
+    ASSERT_TRUE(stream.stopped);
+    ASSERT_EQ(aho_stream_feed(&stream, "ab", 2, NULL, NULL), 0);
+    aho_stream_init(&stream, ac);
+    ASSERT_EQ(aho_stream_feed(&stream, "ab", 2, NULL, NULL), 1);
+
+    aho_stream_init(NULL, ac);
+    ASSERT_EQ(aho_stream_feed(NULL, "ab", 2, NULL, NULL), 0);
+    ASSERT_EQ(aho_corasick_scan_file(ac, NULL, NULL, NULL), 0);
+    aho_corasick_destroy(ac);
+}
+
+TEST(aho_scan_file_across_buffers) {
+    const char *patterns[] = {"boundary", "zz"};
+    AhoCorasick *ac = aho_corasick_create(patterns, 2);
+    ASSERT_NOT_NULL(ac);
+
+    FILE *f = tmpfile();
+    ASSERT_NOT_NULL(f);
+    // "boundary" atravessa o fim do primeiro bloco de 64 KB
+    size_t split = 64 * 1024 - 3;
+    for (size_t i = 0; i < split; i++) fputc('x', f);
+    fputs("boundary", f);
+    for (size_t i = 0; i < 100000; i++) fputc((i % 1000 == 0) ? 'z' : 'y', f);
+    fputs("zz", f);
+    rewind(f);
+
+    AhoMatch buf[8];
+    AhoMatchResult r = {buf, 0, 8};
+    ASSERT_EQ(aho_corasick_scan_file(ac, f, collect_match, &r), 2);
+    ASSERT_EQ(r.matches[0].pattern, 0);
+    ASSERT_EQ(r.matches[0].position, split);
+    ASSERT_EQ(r.matches[1].pattern, 1);
+    ASSERT_EQ(r.matches[1].position, split + 8 + 100000);
+    fclose(f);
+    aho_corasick_destroy(ac);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -299,6 +787,31 @@ int main(void) {
     RUN_TEST(all_algorithms_agree);
     RUN_TEST(stress_long_text);
 
+    printf("\n[Binary-safe *_mem]\n");
+    RUN_TEST(mem_embedded_nul);
+    RUN_TEST(mem_random_binary_matches_naive);
+
+    printf("\n[Horspool, BNDM, Shift-Or, auto]\n");
+    RUN_TEST(pattern_compile_invalid);
+    RUN_TEST(pattern_algorithms_match_naive);
+    RUN_TEST(pattern_reuse_across_lines);
+    RUN_TEST(pattern_compiled_kmp_bm_reuse_storage);
+    RUN_TEST(pattern_choose_by_alphabet);
+
+    printf("\n[SIMD Search]\n");
+    RUN_TEST(simd_basic);
+    RUN_TEST(simd_first_last_byte_false_positives);
+    RUN_TEST(simd_matches_naive);
+
+    printf("\n[Aho-Corasick]\n");
+    RUN_TEST(aho_corasick_classic_example);
+    RUN_TEST(aho_corasick_null_args);
+    RUN_TEST(aho_corasick_scan_binary_and_stop);
+    RUN_TEST(aho_corasick_matches_kmp);
+    RUN_TEST(aho_stream_chunks_match_whole_scan);
+    RUN_TEST(aho_stream_stop_and_null_args);
+    RUN_TEST(aho_scan_file_across_buffers);
+
     printf("\n=== All string matching tests passed! ===\n");
     return 0;
 }
@@ -0,0 +1,240 @@
+/**
+ * @file test_suffix_array.c
+ * @brief Testes unitarios para o suffix array (SA-IS + LCP)
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "algorithms/suffix_array.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SA_PATH "test_suffix_array.idx"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static const unsigned char *cmp_text;
+static size_t cmp_n;
+
+static int compare_suffixes(const void *a, const void *b) {
+    size_t i = *(const uint32_t *)a;
+    size_t j = *(const uint32_t *)b;
+    size_t li = cmp_n - i, lj = cmp_n - j;
+    int r = memcmp(cmp_text + i, cmp_text + j, (li < lj) ? li : lj);
+    if (r != 0) return r;
+    return (li < lj) ? -1 : (li > lj);
+}
+
+// Confere SA contra ordenacao ingenua e LCP contra comparacao direta
+static bool check_against_naive(const SuffixArray *sa, const unsigned char *text, size_t n) {
+    uint32_t *ref = malloc((n ? n : 1) * sizeof(uint32_t));
+    if (ref == NULL) return false;
+    for (size_t i = 0; i < n; i++) ref[i] = (uint32_t)i;
+    cmp_text = text;
+    cmp_n = n;
+    qsort(ref, n, sizeof(uint32_t), compare_suffixes);
+
+    const uint32_t *got = suffix_array_data(sa);
+    const uint32_t *lcp = suffix_array_lcp(sa);
+    bool ok = suffix_array_length(sa) == n;
+    for (size_t i = 0; ok && i < n; i++) {
+        if (got[i] != ref[i]) ok = false;
+        size_t h = 0;
+        if (i > 0) {
+            while (ref[i] + h < n && ref[i - 1] + h < n && text[ref[i] + h] == text[ref[i - 1] + h]) h++;
+        }
+        if (lcp[i] != h) ok = false;
+    }
+    free(ref);
+    return ok;
+}
+
+static size_t naive_count(const unsigned char *text, size_t n, const unsigned char *p, size_t m) {
+    size_t c = 0;
+    for (size_t i = 0; i + m <= n; i++) {
+        if (memcmp(text + i, p, m) == 0) c++;
+    }
+    return c;
+}
+
+// ============================================================================
+// CONSTRUCAO
+// ============================================================================
+
+TEST(build_classic_banana) {
+    const char *text = "banana";
+    SuffixArray *sa = suffix_array_build(text, 6);
+    ASSERT_NOT_NULL(sa);
+    const uint32_t expected_sa[] = {5, 3, 1, 0, 4, 2};
+    const uint32_t expected_lcp[] = {0, 1, 3, 0, 0, 2};
+    for (size_t i = 0; i < 6; i++) {
+        ASSERT_EQ(suffix_array_data(sa)[i], expected_sa[i]);
+        ASSERT_EQ(suffix_array_lcp(sa)[i], expected_lcp[i]);
+    }
+    size_t pos;
+    ASSERT_EQ(suffix_array_longest_repeat(sa, &pos), 3);
+    ASSERT_EQ(memcmp(text + pos, "ana", 3), 0);
+    suffix_array_destroy(sa);
+}
+
+TEST(build_invalid_and_empty) {
+    ASSERT_NULL(suffix_array_build(NULL, 5));
+    SuffixArray *sa = suffix_array_build(NULL, 0);
+    ASSERT_NOT_NULL(sa);
+    ASSERT_EQ(suffix_array_length(sa), 0);
+    ASSERT_EQ(suffix_array_count(sa, "a", 1), 0);
+    ASSERT_EQ(suffix_array_longest_repeat(sa, NULL), 0);
+    suffix_array_destroy(sa);
+    suffix_array_destroy(NULL);
+    ASSERT_EQ(suffix_array_count(NULL, "a", 1), 0);
+}
+
+TEST(build_matches_naive_sort) {
+    static unsigned char text[3000];
+    unsigned state = 2024u;
+    // Alfabetos 1 (todo repetido), 2, 4 e 256 (inclui byte 0) e varios tamanhos
+    const unsigned sigmas[] = {1, 2, 4, 256};
+    const size_t sizes[] = {1, 2, 3, 17, 256, 1000, 3000};
+    for (size_t a = 0; a < 4; a++) {
+        for (size_t z = 0; z < 7; z++) {
+            size_t n = sizes[z];
+            for (size_t i = 0; i < n; i++) {
+                state = state * 1103515245u + 12345u;
+                text[i] = (unsigned char)((state >> 16) % sigmas[a]);
+            }
+            SuffixArray *sa = suffix_array_build(text, n);
+            ASSERT_NOT_NULL(sa);
+            ASSERT_TRUE(check_against_naive(sa, text, n));
+            suffix_array_destroy(sa);
+        }
+    }
+
+    // Periodico: forca varios niveis de recursao do SA-IS
+    for (size_t i = 0; i < 3000; i++) text[i] = "abaababa"[i % 8];
+    SuffixArray *sa = suffix_array_build(text, 3000);
+    ASSERT_NOT_NULL(sa);
+    ASSERT_TRUE(check_against_naive(sa, text, 3000));
+    suffix_array_destroy(sa);
+}
+
+// ============================================================================
+// CONSULTAS
+// ============================================================================
+
+TEST(count_and_locate) {
+    static unsigned char text[20000];
+    unsigned state = 7u;
+    for (size_t i = 0; i < sizeof(text); i++) {
+        state = state * 1103515245u + 12345u;
+        text[i] = (unsigned char)('a' + (state >> 16) % 3);
+    }
+    SuffixArray *sa = suffix_array_build(text, sizeof(text));
+    ASSERT_NOT_NULL(sa);
+
+    for (size_t m = 1; m <= 12; m++) {
+        const unsigned char *p = text + (m * 997) % (sizeof(text) - m);
+        size_t expected = naive_count(text, sizeof(text), p, m);
+        ASSERT_EQ(suffix_array_count(sa, p, m), expected);
+
+        MatchResult r = suffix_array_locate(sa, p, m);
+        ASSERT_EQ(r.count, expected);
+        for (size_t i = 0; i < r.count; i++) {
+            ASSERT_EQ(memcmp(text + r.positions[i], p, m), 0);
+            if (i > 0) ASSERT_TRUE(r.positions[i] > r.positions[i - 1]);
+        }
+        match_result_destroy(&r);
+    }
+
+    ASSERT_EQ(suffix_array_count(sa, "abd", 3), 0);
+    ASSERT_EQ(suffix_array_count(sa, "", 0), sizeof(text));
+    size_t first, last;
+    ASSERT_FALSE(suffix_array_range(sa, "zz", 2, &first, &last));
+    ASSERT_EQ(first, last);
+    MatchResult none = suffix_array_locate(sa, "d", 1);
+    ASSERT_EQ(none.count, 0);
+    suffix_array_destroy(sa);
+}
+
+TEST(pattern_at_text_end) {
+    const char text[] = {'x', 'y', '\0', 'x', 'y'};
+    SuffixArray *sa = suffix_array_build(text, 5);
+    ASSERT_NOT_NULL(sa);
+    ASSERT_EQ(suffix_array_count(sa, "xy", 2), 2);
+    ASSERT_EQ(suffix_array_count(sa, "xyz", 3), 0);
+    ASSERT_EQ(suffix_array_count(sa, "y\0x", 3), 1);
+    MatchResult r = suffix_array_locate(sa, "y", 1);
+    ASSERT_EQ(r.count, 2);
+    ASSERT_EQ(r.positions[0], 1);
+    ASSERT_EQ(r.positions[1], 4);
+    match_result_destroy(&r);
+    suffix_array_destroy(sa);
+}
+
+// ============================================================================
+// SERIALIZACAO
+// ============================================================================
+
+TEST(save_load_roundtrip) {
+    static char text[5000];
+    for (size_t i = 0; i < sizeof(text); i++) text[i] = (char)('a' + (i * i + i / 7) % 5);
+    SuffixArray *sa = suffix_array_build(text, sizeof(text));
+    ASSERT_NOT_NULL(sa);
+    ASSERT_TRUE(suffix_array_save(sa, SA_PATH));
+
+    SuffixArray *loaded = suffix_array_load(SA_PATH, text, sizeof(text));
+    ASSERT_NOT_NULL(loaded);
+    ASSERT_EQ(memcmp(suffix_array_data(loaded), suffix_array_data(sa), sizeof(text) * 4), 0);
+    ASSERT_EQ(memcmp(suffix_array_lcp(loaded), suffix_array_lcp(sa), sizeof(text) * 4), 0);
+    ASSERT_EQ(suffix_array_count(loaded, "abc", 3), suffix_array_count(sa, "abc", 3));
+
+    // n diferente do gravado e arquivo inexistente
+    ASSERT_NULL(suffix_array_load(SA_PATH, text, sizeof(text) - 1));
+    ASSERT_NULL(suffix_array_load("missing_suffix_array.idx", text, sizeof(text)));
+    suffix_array_destroy(loaded);
+
+    // Buffer em memoria: mesmo formato, sem copia
+    FILE *f = fopen(SA_PATH, "rb");
+    ASSERT_NOT_NULL(f);
+    size_t size = 24 + 2 * sizeof(text) * 4;
+    uint32_t *buffer = malloc(size);
+    ASSERT_NOT_NULL(buffer);
+    ASSERT_EQ(fread(buffer, 1, size, f), size);
+    fclose(f);
+    SuffixArray *view = suffix_array_from_buffer(buffer, size, text, sizeof(text));
+    ASSERT_NOT_NULL(view);
+    ASSERT_TRUE(suffix_array_data(view) == buffer + 6);
+    ASSERT_EQ(suffix_array_count(view, "abc", 3), suffix_array_count(sa, "abc", 3));
+    suffix_array_destroy(view);
+    ASSERT_NULL(suffix_array_from_buffer(buffer, size - 4, text, sizeof(text)));
+    ((char *)buffer)[0] = 'X';
+    ASSERT_NULL(suffix_array_from_buffer(buffer, size, text, sizeof(text)));
+    free(buffer);
+
+    suffix_array_destroy(sa);
+    remove(SA_PATH);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Suffix Array Tests ===\n");
+
+    RUN_TEST(build_classic_banana);
+    RUN_TEST(build_invalid_and_empty);
+    RUN_TEST(build_matches_naive_sort);
+    RUN_TEST(count_and_locate);
+    RUN_TEST(pattern_at_text_end);
+    RUN_TEST(save_load_roundtrip);
+
+    printf("\nAll Suffix Array tests passed!\n");
+    return 0;
+}
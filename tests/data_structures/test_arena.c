@@ -0,0 +1,283 @@
+/**
+ * @file test_arena.c
+ * @brief Testes unitarios para a arena e o alocador plugavel
+ *
+ * Testa alocacao, alinhamento, reuso por classe de tamanho, blocos
+ * grandes, reset e uso da arena como DSAllocator de containers.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "data_structures/arena.h"
+#include "data_structures/common.h"
+#include "data_structures/linked_list.h"
+#include "data_structures/bst.h"
+#include "data_structures/array_list.h"
+#include "data_structures/queue.h"
+#include "data_structures/stack.h"
+#include "data_structures/priority_queue.h"
+#include "data_structures/union_find.h"
+#include "data_structures/graph.h"
+#include "data_structures/hash_table.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <string.h>
+
+// ============================================================================
+// TESTES DA ARENA
+// ============================================================================
+
+TEST(create_destroy) {
+    DSArena *arena = ds_arena_create(0);
+    ASSERT_NOT_NULL(arena);
+    ASSERT_EQ(ds_arena_bytes_used(arena), 0);
+    ASSERT_EQ(ds_arena_bytes_reserved(arena), 0);
+    ds_arena_destroy(arena);
+    ds_arena_destroy(NULL);
+}
+
+TEST(alloc_alignment) {
+    DSArena *arena = ds_arena_create(1024);
+    for (size_t size = 1; size < 100; size += 7) {
+        void *ptr = ds_arena_alloc(arena, size);
+        ASSERT_NOT_NULL(ptr);
+        ASSERT_EQ((uintptr_t)ptr % _Alignof(max_align_t), 0);
+        memset(ptr, 0xAB, size);
+    }
+    ASSERT_TRUE(ds_arena_bytes_reserved(arena) >= ds_arena_bytes_used(arena));
+    ds_arena_destroy(arena);
+}
+
+TEST(free_list_reuse) {
+    DSArena *arena = ds_arena_create(0);
+    void *a = ds_arena_alloc(arena, 40);
+    void *b = ds_arena_alloc(arena, 40);
+    ASSERT_NE(a, b);
+
+    size_t used = ds_arena_bytes_used(arena);
+    ds_arena_free(arena, a, 40);
+    ASSERT_LT(ds_arena_bytes_used(arena), used);
+
+    // Mesmo tamanho (mesma classe) reaproveita o bloco liberado
+    void *c = ds_arena_alloc(arena, 33);
+    ASSERT_EQ(c, a);
+    ds_arena_destroy(arena);
+}
+
+TEST(large_block) {
+    DSArena *arena = ds_arena_create(256);
+    void *small = ds_arena_alloc(arena, 16);
+    char *big = (char*)ds_arena_alloc(arena, 4096);
+    ASSERT_NOT_NULL(small);
+    ASSERT_NOT_NULL(big);
+    big[0] = 1;
+    big[4095] = 2;
+
+    // O chunk corrente continua disponivel apos o bloco dedicado
+    void *next = ds_arena_alloc(arena, 16);
+    ASSERT_EQ((char*)next, (char*)small + 16);
+    ds_arena_destroy(arena);
+}
+
+TEST(reset) {
+    DSArena *arena = ds_arena_create(512);
+    for (int i = 0; i < 100; i++) {
+        ASSERT_NOT_NULL(ds_arena_alloc(arena, 64));
+    }
+    ASSERT_GT(ds_arena_bytes_reserved(arena), 512);
+
+    ds_arena_reset(arena);
+    ASSERT_EQ(ds_arena_bytes_used(arena), 0);
+    ASSERT_EQ(ds_arena_bytes_reserved(arena), 512);
+    ASSERT_NOT_NULL(ds_arena_alloc(arena, 64));
+    ds_arena_destroy(arena);
+}
+
+// ============================================================================
+// TESTES DO DSAllocator
+// ============================================================================
+
+TEST(default_allocator) {
+    int *p = (int*)ds_alloc(NULL, sizeof(int));
+    ASSERT_NOT_NULL(p);
+    *p = 7;
+    ds_free(NULL, p, sizeof(int));
+
+    int *zeros = (int*)ds_calloc(ds_default_allocator(), 8, sizeof(int));
+    ASSERT_NOT_NULL(zeros);
+    for (int i = 0; i < 8; i++) ASSERT_EQ(zeros[i], 0);
+    ds_free(ds_default_allocator(), zeros, 8 * sizeof(int));
+}
+
+TEST(containers_share_arena) {
+    DSArena *arena = ds_arena_create(0);
+    DSAllocator alloc = ds_arena_allocator(arena);
+
+    LinkedList *list = list_create_with_allocator(sizeof(int), LIST_DOUBLY, NULL, &alloc);
+    BST *bst = bst_create_with_allocator(sizeof(int), compare_int, NULL, &alloc);
+    ASSERT_NOT_NULL(list);
+    ASSERT_NOT_NULL(bst);
+
+    for (int i = 0; i < 1000; i++) {
+        int v = (i * 37) % 1000;
+        ASSERT_EQ(list_push_back(list, &v), DS_SUCCESS);
+        ASSERT_EQ(bst_insert(bst, &v), DS_SUCCESS);
+    }
+    ASSERT_EQ(list_size(list), 1000);
+    ASSERT_EQ(bst_size(bst), 1000);
+    ASSERT_GT(ds_arena_bytes_used(arena), 0);
+
+    // Sem list_destroy/bst_destroy: a arena libera tudo de uma vez
+    ds_arena_destroy(arena);
+}
+
+TEST(destroy_returns_blocks) {
+    DSArena *arena = ds_arena_create(0);
+    DSAllocator alloc = ds_arena_allocator(arena);
+
+    BST *bst = bst_create_with_allocator(sizeof(int), compare_int, NULL, &alloc);
+    for (int i = 0; i < 64; i++) {
+        bst_insert(bst, &i);
+    }
+    size_t reserved = ds_arena_bytes_reserved(arena);
+    bst_destroy(bst);
+    ASSERT_EQ(ds_arena_bytes_used(arena), 0);
+
+    // Nova arvore reaproveita os nos liberados sem reservar mais memoria
+    bst = bst_create_with_allocator(sizeof(int), compare_int, NULL, &alloc);
+    for (int i = 0; i < 64; i++) {
+        bst_insert(bst, &i);
+    }
+    ASSERT_EQ(ds_arena_bytes_reserved(arena), reserved);
+    bst_destroy(bst);
+    ds_arena_destroy(arena);
+}
+
+// ============================================================================
+// ALOCADOR CONTADOR (sem realloc: exercita o fallback de ds_realloc)
+// ============================================================================
+
+typedef struct {
+    size_t allocs;
+    size_t frees;
+    size_t live_bytes;
+} CountingCtx;
+
+static void* counting_alloc(void *ctx, size_t size) {
+    CountingCtx *c = (CountingCtx*)ctx;
+    c->allocs++;
+    c->live_bytes += size;
+    return malloc(size);
+}
+
+static void counting_free(void *ctx, void *ptr, size_t size) {
+    CountingCtx *c = (CountingCtx*)ctx;
+    c->frees++;
+    c->live_bytes -= size;
+    free(ptr);
+}
+
+TEST(realloc_fallback) {
+    CountingCtx ctx = {0, 0, 0};
+    DSAllocator alloc = { counting_alloc, NULL, counting_free, &ctx };
+
+    int *p = (int*)ds_alloc(&alloc, 4 * sizeof(int));
+    for (int i = 0; i < 4; i++) p[i] = i;
+    p = (int*)ds_realloc(&alloc, p, 4 * sizeof(int), 64 * sizeof(int));
+    ASSERT_NOT_NULL(p);
+    for (int i = 0; i < 4; i++) ASSERT_EQ(p[i], i);
+    ds_free(&alloc, p, 64 * sizeof(int));
+
+    ASSERT_EQ(ctx.allocs, 2);
+    ASSERT_EQ(ctx.frees, 2);
+    ASSERT_EQ(ctx.live_bytes, 0);
+}
+
+TEST(arena_realloc_in_place) {
+    DSArena *arena = ds_arena_create(0);
+    char *p = (char*)ds_arena_realloc(arena, NULL, 0, 32);
+    memset(p, 7, 32);
+    char *q = (char*)ds_arena_realloc(arena, p, 32, 256);
+    ASSERT_EQ(q, p);
+    ASSERT_EQ(q[31], 7);
+    ASSERT_EQ(ds_arena_bytes_used(arena), 256);
+    ds_arena_destroy(arena);
+}
+
+TEST(all_containers_use_allocator) {
+    CountingCtx ctx = {0, 0, 0};
+    DSAllocator alloc = { counting_alloc, NULL, counting_free, &ctx };
+
+    ArrayList *arr = arraylist_create_with_allocator(sizeof(int), 2, GROWTH_DOUBLE, NULL, &alloc);
+    Queue *q = queue_create_with_allocator(sizeof(int), QUEUE_ARRAY, 2, NULL, &alloc);
+    Queue *ql = queue_create_with_allocator(sizeof(int), QUEUE_LINKED, 0, NULL, &alloc);
+    Stack *st = stack_create_with_allocator(sizeof(int), STACK_ARRAY, 2, NULL, &alloc);
+    PriorityQueue *pq = pq_create_with_allocator(sizeof(int), 2, PQ_MIN, compare_int, NULL, &alloc);
+    UnionFind *uf = uf_create_with_allocator(16, &alloc);
+    Graph *g = graph_create_with_allocator(2, GRAPH_UNDIRECTED, GRAPH_ADJACENCY_LIST, true, &alloc);
+    HashTable *ht = hashtable_create_with_allocator(sizeof(int), sizeof(int), 4, hash_int,
+                                                    compare_int, HASH_LINEAR_PROBING,
+                                                    NULL, NULL, &alloc);
+
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(arraylist_push_back(arr, &i), DS_SUCCESS);
+        ASSERT_EQ(queue_enqueue(q, &i), DS_SUCCESS);
+        ASSERT_EQ(queue_enqueue(ql, &i), DS_SUCCESS);
+        ASSERT_EQ(stack_push(st, &i), DS_SUCCESS);
+        ASSERT_EQ(pq_insert(pq, &i), DS_SUCCESS);
+        ASSERT_EQ(hashtable_put(ht, &i, &i), DS_SUCCESS);
+        Vertex v = graph_add_vertex(g);
+        ASSERT_EQ(graph_add_edge(g, v, v - 1, 1.0), DS_SUCCESS);
+    }
+    uf_union(uf, 1, 2);
+
+    Graph *gc = graph_clone(g);
+    ASSERT_NOT_NULL(gc);
+    ASSERT_GT(ctx.allocs, 0);
+
+    arraylist_destroy(arr);
+    queue_destroy(q);
+    queue_destroy(ql);
+    stack_destroy(st);
+    pq_destroy(pq);
+    uf_destroy(uf);
+    graph_destroy(g);
+    graph_destroy(gc);
+    hashtable_destroy(ht);
+
+    ASSERT_EQ(ctx.allocs, ctx.frees);
+    ASSERT_EQ(ctx.live_bytes, 0);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("========================================\n");
+    printf("  TESTES DE ARENA E ALOCADOR\n");
+    printf("========================================\n\n");
+
+    printf("Arena:\n");
+    RUN_TEST(create_destroy);
+    RUN_TEST(alloc_alignment);
+    RUN_TEST(free_list_reuse);
+    RUN_TEST(large_block);
+    RUN_TEST(reset);
+
+    printf("\nDSAllocator:\n");
+    RUN_TEST(default_allocator);
+    RUN_TEST(containers_share_arena);
+    RUN_TEST(destroy_returns_blocks);
+    RUN_TEST(realloc_fallback);
+    RUN_TEST(arena_realloc_in_place);
+    RUN_TEST(all_containers_use_allocator);
+
+    printf("\n============================================\n");
+    printf("  TODOS OS TESTES PASSARAM! (11 testes)\n");
+    printf("============================================\n");
+
+    return 0;
+}
@@ -3,9 +3,11 @@
  * @brief Testes para ArrayList (Dynamic Array)
  *
  * Valida:
- * - Crescimento automático com estratégias (2x, 1.5x, FIXED)
+ * - Crescimento automático com estratégias (2x, 1.5x, FIXED, golden)
+ * - Buffer embutido (arraylist_create_small) e listas acima do limiar de mremap
  * - Operações O(1): get, set, push_back
  * - Operações O(n): insert, remove
+ * - Operações em intervalo: append_n, insert_range, erase_range, erase_if
  * - Busca linear e binária
  * - Ordenação e reversão
  * - Gerenciamento de memória
@@ -444,6 +446,225 @@ TEST(arraylist_with_structs) {
     arraylist_destroy(list);
 }
 
+// ============================================================================
+// TESTES: OPERAÇÕES EM INTERVALO
+// ============================================================================
+
+TEST(append_and_insert_range) {
+    ArrayList *list = arraylist_create(sizeof(int), 4, NULL);
+    int a[] = {10, 20, 30};
+    ASSERT_EQ(arraylist_append_n(list, a, 3), DS_SUCCESS);
+
+    // Lote que não cabe: cresce uma vez, direto para o tamanho necessário
+    int b[] = {1, 2, 3, 4, 5, 6};
+    ASSERT_EQ(arraylist_insert_range(list, 0, b, 6), DS_SUCCESS);
+    ASSERT_EQ(arraylist_size(list), 9);
+    ASSERT_EQ(arraylist_capacity(list), 9);
+
+    int c[] = {-1, -2};
+    ASSERT_EQ(arraylist_insert_range(list, 7, c, 2), DS_SUCCESS);
+
+    int expected[] = {1, 2, 3, 4, 5, 6, 10, -1, -2, 20, 30};
+    ASSERT_EQ(arraylist_size(list), 11);
+    for (size_t i = 0; i < 11; i++) {
+        ASSERT_EQ(*(int*)arraylist_get_ptr(list, i), expected[i]);
+    }
+
+    ASSERT_EQ(arraylist_insert_range(list, 12, c, 2), DS_ERROR_INVALID_INDEX);
+    ASSERT_EQ(arraylist_insert_range(list, 0, NULL, 1), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(arraylist_append_n(list, NULL, 0), DS_SUCCESS);
+    ASSERT_EQ(arraylist_append_n(NULL, a, 1), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(arraylist_size(list), 11);
+
+    arraylist_destroy(list);
+}
+
+static int range_destroyed = 0;
+
+static void count_range_destroy(void *data) {
+    (void)data;
+    range_destroyed++;
+}
+
+TEST(erase_range) {
+    ArrayList *list = arraylist_create(sizeof(int), 0, count_range_destroy);
+    for (int i = 0; i < 10; i++) arraylist_push_back(list, &i);
+
+    ASSERT_EQ(arraylist_erase_range(list, 2, 3), DS_SUCCESS);
+    ASSERT_EQ(range_destroyed, 3);
+    int expected[] = {0, 1, 5, 6, 7, 8, 9};
+    ASSERT_EQ(arraylist_size(list), 7);
+    for (size_t i = 0; i < 7; i++) {
+        ASSERT_EQ(*(int*)arraylist_get_ptr(list, i), expected[i]);
+    }
+
+    ASSERT_EQ(arraylist_erase_range(list, 5, 3), DS_ERROR_INVALID_INDEX);
+    ASSERT_EQ(arraylist_erase_range(list, 7, 0), DS_SUCCESS);
+    ASSERT_EQ(arraylist_erase_range(list, 5, 2), DS_SUCCESS);
+    ASSERT_EQ(arraylist_size(list), 5);
+    ASSERT_EQ(*(int*)arraylist_get_ptr(list, 4), 7);
+    ASSERT_EQ(range_destroyed, 5);
+
+    arraylist_destroy(list);
+}
+
+typedef struct {
+    int calls;
+    int divisor;
+} EraseIfCtx;
+
+static bool is_multiple(const void *element, void *ctx) {
+    EraseIfCtx *c = (EraseIfCtx*)ctx;
+    c->calls++;
+    return *(const int*)element % c->divisor == 0;
+}
+
+TEST(erase_if_stable) {
+    ArrayList *list = arraylist_create(sizeof(int), 0, count_range_destroy);
+    for (int i = 0; i < 20; i++) arraylist_push_back(list, &i);
+    range_destroyed = 0;
+
+    // Remove 0, 3, 6, ..., 18: blocos mantidos de 2 elementos
+    EraseIfCtx ctx = {0, 3};
+    ASSERT_EQ(arraylist_erase_if(list, is_multiple, &ctx), 7);
+    ASSERT_EQ(ctx.calls, 20);
+    ASSERT_EQ(range_destroyed, 7);
+    ASSERT_EQ(arraylist_size(list), 13);
+
+    int prev = -1;
+    for (size_t i = 0; i < arraylist_size(list); i++) {
+        int v = *(int*)arraylist_get_ptr(list, i);
+        ASSERT_TRUE(v % 3 != 0);
+        ASSERT_TRUE(v > prev);
+        prev = v;
+    }
+
+    ctx = (EraseIfCtx){0, 1000};
+    ASSERT_EQ(arraylist_erase_if(list, is_multiple, &ctx), 0);
+    ASSERT_EQ(arraylist_size(list), 13);
+    ctx = (EraseIfCtx){0, 1};
+    ASSERT_EQ(arraylist_erase_if(list, is_multiple, &ctx), 13);
+    ASSERT_TRUE(arraylist_is_empty(list));
+    ASSERT_EQ(arraylist_erase_if(NULL, is_multiple, &ctx), 0);
+
+    arraylist_destroy(list);
+}
+
+// ============================================================================
+// TESTES: BUFFER EMBUTIDO E LISTAS GRANDES
+// ============================================================================
+
+static int small_destroyed = 0;
+
+static void count_small_destroy(void *data) {
+    (void)data;
+    small_destroyed++;
+}
+
+TEST(small_buffer_mode) {
+    ArrayList *list = arraylist_create_small(sizeof(int), 3, GROWTH_DOUBLE,
+                                             count_small_destroy, NULL);
+    ASSERT_NOT_NULL(list);
+    ASSERT_TRUE(arraylist_is_inline(list));
+    ASSERT_EQ(arraylist_capacity(list), 3);
+
+    for (int i = 0; i < 3; i++) arraylist_push_back(list, &i);
+    ASSERT_TRUE(arraylist_is_inline(list));
+
+    // O quarto elemento leva tudo para um buffer separado
+    int value = 3;
+    arraylist_push_back(list, &value);
+    ASSERT_FALSE(arraylist_is_inline(list));
+    ASSERT_EQ(arraylist_capacity(list), 6);
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQ(*(int*)arraylist_get_ptr(list, i), i);
+    }
+
+    // Voltando a caber, shrink_to_fit devolve os elementos ao cabeçalho
+    arraylist_pop_back(list, NULL);
+    arraylist_pop_front(list, NULL);
+    ASSERT_EQ(arraylist_shrink_to_fit(list), DS_SUCCESS);
+    ASSERT_TRUE(arraylist_is_inline(list));
+    ASSERT_EQ(arraylist_capacity(list), 3);
+    ASSERT_EQ(*(int*)arraylist_get_ptr(list, 0), 1);
+    ASSERT_EQ(*(int*)arraylist_get_ptr(list, 1), 2);
+
+    ArrayList *copy = arraylist_clone(list, NULL);
+    ASSERT_NOT_NULL(copy);
+    ASSERT_TRUE(arraylist_is_inline(copy));
+    ASSERT_EQ(arraylist_size(copy), 2);
+    arraylist_destroy(copy);
+
+    ASSERT_EQ(small_destroyed, 4);
+    arraylist_destroy(list);
+    ASSERT_EQ(small_destroyed, 6);
+
+    ASSERT_NULL(arraylist_create_small(sizeof(int), 0, GROWTH_DOUBLE, NULL, NULL));
+    ArrayList *plain = arraylist_create(sizeof(int), 4, NULL);
+    ASSERT_FALSE(arraylist_is_inline(plain));
+    arraylist_destroy(plain);
+}
+
+TEST(growth_golden_and_tiny_capacity) {
+    ArrayList *list = arraylist_create_with_growth(sizeof(int), 8, GROWTH_GOLDEN, NULL);
+    for (int i = 0; i < 9; i++) arraylist_push_back(list, &i);
+    ASSERT_EQ(arraylist_capacity(list), 13);  // 8 + 4 + 1
+    arraylist_destroy(list);
+
+    // Capacidade 1 precisa crescer mesmo com fator 1.5
+    list = arraylist_create_with_growth(sizeof(int), 1, GROWTH_1_5, NULL);
+    for (int i = 0; i < 5; i++) arraylist_push_back(list, &i);
+    ASSERT_EQ(arraylist_size(list), 5);
+    ASSERT_TRUE(arraylist_capacity(list) >= 5);
+    arraylist_destroy(list);
+}
+
+TEST(large_list_growth) {
+    // Passa do limiar de mmap/mremap (1 MiB) e volta para baixo dele
+    const int n = 1 << 19;
+    ArrayList *list = arraylist_create_small(sizeof(int), 2, GROWTH_DOUBLE, NULL, NULL);
+    for (int i = 0; i < n; i++) {
+        ASSERT_EQ(arraylist_push_back(list, &i), DS_SUCCESS);
+    }
+    for (int i = 0; i < n; i += 4099) {
+        ASSERT_EQ(*(int*)arraylist_get_ptr(list, i), i);
+    }
+    ASSERT_EQ(*(int*)arraylist_get_ptr(list, n - 1), n - 1);
+
+    while (arraylist_size(list) > 1000) arraylist_pop_back(list, NULL);
+    ASSERT_EQ(arraylist_shrink_to_fit(list), DS_SUCCESS);
+    ASSERT_EQ(arraylist_capacity(list), 1000);
+    ASSERT_EQ(*(int*)arraylist_get_ptr(list, 999), 999);
+    arraylist_destroy(list);
+}
+
+TEST(memory_usage) {
+    ArrayList *small = arraylist_create_small(sizeof(int), 8, GROWTH_DOUBLE, NULL, NULL);
+    size_t inline_bytes = arraylist_memory_usage(small);
+    ASSERT_TRUE(inline_bytes >= 8 * sizeof(int));
+    for (int i = 0; i < 8; i++) arraylist_push_back(small, &i);
+    ASSERT_EQ(arraylist_memory_usage(small), inline_bytes);   // ainda no buffer embutido
+
+    int extra = 8;
+    arraylist_push_back(small, &extra);
+    ASSERT_FALSE(arraylist_is_inline(small));
+    ASSERT_EQ(arraylist_memory_usage(small),
+              inline_bytes + arraylist_capacity(small) * sizeof(int));
+    arraylist_destroy(small);
+
+    // A capacidade reservada conta mesmo vazia
+    ArrayList *list = arraylist_create(sizeof(int), 100, NULL);
+    size_t reserved = arraylist_memory_usage(list);
+    ASSERT_TRUE(reserved >= 100 * sizeof(int));
+    for (int i = 0; i < 50; i++) arraylist_push_back(list, &i);
+    ASSERT_EQ(arraylist_memory_usage(list), reserved);
+    ASSERT_EQ(arraylist_shrink_to_fit(list), DS_SUCCESS);
+    ASSERT_EQ(arraylist_memory_usage(list), reserved - 50 * sizeof(int));
+    arraylist_destroy(list);
+
+    ASSERT_EQ(arraylist_memory_usage(NULL), 0);
+}
+
 // ============================================================================
 // TESTES: ERROS E EDGE CASES
 // ============================================================================
@@ -551,6 +772,17 @@ int main(void) {
     RUN_TEST(arraylist_with_strings);
     RUN_TEST(arraylist_with_structs);
 
+    printf("\nOperações em Intervalo:\n");
+    RUN_TEST(append_and_insert_range);
+    RUN_TEST(erase_range);
+    RUN_TEST(erase_if_stable);
+
+    printf("\nBuffer Embutido e Listas Grandes:\n");
+    RUN_TEST(small_buffer_mode);
+    RUN_TEST(growth_golden_and_tiny_capacity);
+    RUN_TEST(large_list_growth);
+    RUN_TEST(memory_usage);
+
     printf("\nErros e Edge Cases:\n");
     RUN_TEST(pop_from_empty);
     RUN_TEST(invalid_index_access);
@@ -560,7 +792,7 @@ int main(void) {
     RUN_TEST(print_visual);
 
     printf("\n============================================\n");
-    printf("  ✅ TODOS OS TESTES PASSARAM! (26 testes)\n");
+    printf("  ✅ TODOS OS TESTES PASSARAM! (33 testes)\n");
     printf("============================================\n\n");
 
     return 0;
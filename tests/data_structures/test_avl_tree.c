@@ -10,7 +10,9 @@
  */
 
 #include "data_structures/avl_tree.h"
+#include "data_structures/arena.h"
 #include "data_structures/common.h"
+#include "data_structures/thread_pool.h"
 #include "../test_macros.h"
 
 #include <string.h>
@@ -314,6 +316,160 @@ TEST(range_search) {
     avl_destroy(tree);
 }
 
+TEST(order_statistics) {
+    AVLTree *tree = avl_create(sizeof(int), compare_int, NULL);
+    int out;
+    ASSERT_EQ(avl_select(tree, 1, &out), DS_ERROR_INVALID_INDEX);
+
+    // Pares 0..398 (cada um duas vezes), inseridos fora de ordem
+    for (int i = 0; i < 400; i++) {
+        int v = ((i * 37) % 200) * 2;
+        ASSERT_EQ(avl_insert(tree, &v), DS_SUCCESS);
+    }
+    for (size_t k = 1; k <= 400; k++) {
+        ASSERT_EQ(avl_select(tree, k, &out), DS_SUCCESS);
+        ASSERT_EQ(out, (int)((k - 1) / 2) * 2);
+    }
+    ASSERT_EQ(avl_select(tree, 0, &out), DS_ERROR_INVALID_INDEX);
+    ASSERT_EQ(avl_select(tree, 401, &out), DS_ERROR_INVALID_INDEX);
+
+    for (int key = -1; key <= 400; key++) {
+        size_t smaller = (key <= 0) ? 0 : (size_t)((key + 1) / 2) * 2;
+        ASSERT_EQ(avl_rank(tree, &key), smaller);
+    }
+
+    int lo = 10, hi = 20;
+    ASSERT_EQ(avl_range_count(tree, &lo, &hi), 12);
+    ASSERT_EQ(avl_range_count(tree, &hi, &lo), 0);
+    lo = -50; hi = 1000;
+    ASSERT_EQ(avl_range_count(tree, &lo, &hi), 400);
+
+    // Tamanhos das subárvores seguem as remoções e rotações
+    for (int v = 0; v < 400; v += 4) {
+        ASSERT_EQ(avl_remove(tree, &v), DS_SUCCESS);
+    }
+    ASSERT_TRUE(avl_is_valid(tree));
+    ASSERT_EQ(avl_size(tree), 300);
+    // Restam uma cópia dos múltiplos de 4 e duas dos demais pares
+    size_t k = 1;
+    for (int v = 0; v < 400; v += 2) {
+        size_t copies = (v % 4 == 0) ? 1 : 2;
+        ASSERT_EQ(avl_rank(tree, &v), k - 1);
+        for (size_t c = 0; c < copies; c++, k++) {
+            ASSERT_EQ(avl_select(tree, k, &out), DS_SUCCESS);
+            ASSERT_EQ(out, v);
+        }
+    }
+    lo = 0; hi = 7;
+    ASSERT_EQ(avl_range_count(tree, &lo, &hi), 6);
+
+    avl_destroy(tree);
+}
+
+TEST(from_sorted_array) {
+    int sorted[1000];
+    for (int i = 0; i < 1000; i++) sorted[i] = 3 * i;
+
+    for (size_t n = 0; n <= 1000; n += (n < 40) ? 1 : 321) {
+        AVLTree *tree = avl_from_sorted_array(sizeof(int), sorted, n, compare_int, NULL);
+        ASSERT_NOT_NULL(tree);
+        ASSERT_EQ(avl_size(tree), n);
+        ASSERT_TRUE(avl_is_valid(tree));
+        for (size_t k = 1; k <= n; k++) {
+            int out;
+            ASSERT_EQ(avl_select(tree, k, &out), DS_SUCCESS);
+            ASSERT_EQ(out, sorted[k - 1]);
+        }
+        avl_destroy(tree);
+    }
+
+    int unsorted[3] = {1, 3, 2};
+    ASSERT_NULL(avl_from_sorted_array(sizeof(int), unsorted, 3, compare_int, NULL));
+}
+
+// Conjunto {v em [0, range) : member(v, seed)} como AVL, inserido fora de ordem
+static bool set_member(int v, unsigned seed, unsigned density) {
+    return ((unsigned)v * 2654435761u + seed * 40503u) % 100u < density;
+}
+
+static AVLTree* build_set(int range, unsigned seed, unsigned density) {
+    AVLTree *tree = avl_create(sizeof(int), compare_int, NULL);
+    for (int i = 0; i < range; i++) {
+        int v = (i * 7919) % range;
+        if (set_member(v, seed, density)) avl_insert(tree, &v);
+    }
+    return tree;
+}
+
+TEST(set_operations) {
+    const int range = 5000;
+    // Densidades diferentes: junção de índice pequeno com grande e vice-versa
+    const unsigned densities[][2] = {{50, 50}, {90, 2}, {2, 90}, {30, 0}, {0, 30}};
+    for (size_t d = 0; d < sizeof(densities) / sizeof(densities[0]); d++) {
+        unsigned da = densities[d][0], db = densities[d][1];
+        AVLTree *b = build_set(range, 2, db);
+
+        for (int op = 0; op < 3; op++) {
+            AVLTree *a = build_set(range, 1, da);
+            if (op == 0) ASSERT_EQ(avl_union(a, b, NULL), DS_SUCCESS);
+            if (op == 1) ASSERT_EQ(avl_intersection(a, b), DS_SUCCESS);
+            if (op == 2) ASSERT_EQ(avl_difference(a, b), DS_SUCCESS);
+            ASSERT_TRUE(avl_is_valid(a));
+
+            size_t expected = 0;
+            for (int v = 0; v < range; v++) {
+                bool in_a = set_member(v, 1, da), in_b = set_member(v, 2, db);
+                bool want = (op == 0) ? (in_a || in_b) : (op == 1) ? (in_a && in_b) : (in_a && !in_b);
+                ASSERT_EQ(avl_contains(a, &v), want);
+                expected += want;
+            }
+            ASSERT_EQ(avl_size(a), expected);
+            avl_destroy(a);
+        }
+        ASSERT_TRUE(avl_is_valid(b));
+        avl_destroy(b);
+    }
+
+    // Operações da árvore com ela mesma
+    AVLTree *a = build_set(range, 3, 40);
+    size_t size = avl_size(a);
+    ASSERT_EQ(avl_union(a, a, NULL), DS_SUCCESS);
+    ASSERT_EQ(avl_intersection(a, a), DS_SUCCESS);
+    ASSERT_EQ(avl_size(a), size);
+    ASSERT_EQ(avl_difference(a, a), DS_SUCCESS);
+    ASSERT_TRUE(avl_is_empty(a));
+    ASSERT_EQ(avl_union(NULL, a, NULL), DS_ERROR_NULL_POINTER);
+    avl_destroy(a);
+}
+
+TEST(set_operations_parallel) {
+    // Acima de AVL_SET_PARALLEL_MIN as metades rodam no pool: mesmo
+    // resultado que em série
+    const int range = 60000;
+    AVLTree *b = build_set(range, 5, 50);
+    for (int op = 0; op < 3; op++) {
+        AVLTree *result[2];
+        size_t threads[2] = {1, 4};
+        for (int t = 0; t < 2; t++) {
+            ds_set_num_threads(threads[t]);
+            result[t] = build_set(range, 4, 50);
+            if (op == 0) ASSERT_EQ(avl_union(result[t], b, NULL), DS_SUCCESS);
+            if (op == 1) ASSERT_EQ(avl_intersection(result[t], b), DS_SUCCESS);
+            if (op == 2) ASSERT_EQ(avl_difference(result[t], b), DS_SUCCESS);
+            ASSERT_TRUE(avl_is_valid(result[t]));
+        }
+        ASSERT_EQ(avl_size(result[0]), avl_size(result[1]));
+        for (int v = 0; v < range; v++) {
+            ASSERT_EQ(avl_contains(result[0], &v), avl_contains(result[1], &v));
+        }
+        avl_destroy(result[0]);
+        avl_destroy(result[1]);
+    }
+    avl_destroy(b);
+    ds_set_num_threads(0);
+    ds_thread_pool_shutdown();
+}
+
 TEST(clear) {
     AVLTree *tree = avl_create(sizeof(int), compare_int, NULL);
     int values[] = {50, 30, 70, 20, 40};
@@ -360,6 +516,30 @@ TEST(clone) {
     avl_destroy(cloned);
 }
 
+TEST(arena_allocator) {
+    DSArena *arena = ds_arena_create(0);
+    DSAllocator alloc = ds_arena_allocator(arena);
+    AVLTree *tree = avl_create_with_allocator(sizeof(int), compare_int, NULL, &alloc);
+    ASSERT_NOT_NULL(tree);
+
+    for (int i = 0; i < 200; i++) {
+        ASSERT_EQ(avl_insert(tree, &i), DS_SUCCESS);
+    }
+    for (int i = 0; i < 200; i += 2) {
+        ASSERT_EQ(avl_remove(tree, &i), DS_SUCCESS);
+    }
+    ASSERT_TRUE(avl_is_valid(tree));
+
+    AVLTree *cloned = avl_clone(tree, NULL);
+    ASSERT_NOT_NULL(cloned);
+    ASSERT_EQ(avl_size(cloned), 100);
+
+    avl_destroy(cloned);
+    avl_destroy(tree);
+    ASSERT_EQ(ds_arena_bytes_used(arena), 0);
+    ds_arena_destroy(arena);
+}
+
 TEST(stress_test) {
     AVLTree *tree = avl_create(sizeof(int), compare_int, NULL);
 
@@ -392,6 +572,84 @@ TEST(stress_test) {
     avl_destroy(tree);
 }
 
+TEST(iterators_and_seek) {
+    AVLTree *tree = avl_create(sizeof(int), compare_int, NULL);
+    const int N = 1000;
+    for (int i = 0; i < N; i++) {
+        int v = (i * 389) % N;  // permutação de [0, N)
+        avl_insert(tree, &v);
+    }
+
+    // Inorder em ordem crescente, pausado e retomado no meio
+    AVLIter it;
+    void *data;
+    int expected = 0;
+    avl_iter_begin(tree, AVL_INORDER, &it);
+    for (int step = 0; step < 2; step++) {
+        for (int k = 0; k < N / 2 && avl_iter_next(&it, &data); k++) {
+            ASSERT_EQ(*(int*)data, expected);
+            expected++;
+        }
+    }
+    ASSERT_EQ(expected, N);
+    ASSERT_FALSE(avl_iter_next(&it, &data));
+
+    // Pré e pós-ordem: raiz primeiro e por último, todos visitados
+    void *root_data = NULL;
+    void *last = NULL;
+    size_t count = 0;
+    avl_iter_begin(tree, AVL_PREORDER, &it);
+    while (avl_iter_next(&it, &data)) {
+        if (count++ == 0) root_data = data;
+    }
+    ASSERT_EQ(count, (size_t)N);
+    count = 0;
+    avl_iter_begin(tree, AVL_POSTORDER, &it);
+    while (avl_iter_next(&it, &data)) {
+        last = data;
+        count++;
+    }
+    ASSERT_EQ(count, (size_t)N);
+    ASSERT_EQ(*(int*)last, *(int*)root_data);
+
+    int key = 500;
+    avl_iter_seek(tree, &key, &it);
+    for (int v = 500; v < N; v++) {
+        ASSERT_TRUE(avl_iter_next(&it, &data));
+        ASSERT_EQ(*(int*)data, v);
+    }
+    ASSERT_FALSE(avl_iter_next(&it, &data));
+
+    avl_destroy(tree);
+}
+
+TEST(memory_usage) {
+    AVLTree *tree = avl_create(sizeof(int), compare_int, NULL);
+    size_t empty = avl_memory_usage(tree);
+    ASSERT_TRUE(empty > 0);
+
+    int v = 0;
+    avl_insert(tree, &v);
+    size_t per_node = avl_memory_usage(tree) - empty;
+    ASSERT_TRUE(per_node > sizeof(int));
+    for (v = 1; v < 100; v++) {
+        avl_insert(tree, &v);
+    }
+    ASSERT_EQ(avl_memory_usage(tree), empty + 100 * per_node);
+
+    v = 42;
+    avl_remove(tree, &v);
+    ASSERT_EQ(avl_memory_usage(tree), empty + 99 * per_node);
+
+#ifdef DS_COMPACT_INDEX
+    // Contador de subárvore em 32 bits divide a palavra com a altura
+    ASSERT_TRUE(per_node <= 4 * sizeof(void *) + sizeof(int));
+#endif
+
+    ASSERT_EQ(avl_memory_usage(NULL), 0);
+    avl_destroy(tree);
+}
+
 TEST(null_pointer_checks) {
     ASSERT_NULL(avl_create(0, compare_int, NULL));
     ASSERT_NULL(avl_create(sizeof(int), NULL, NULL));
@@ -442,13 +700,20 @@ int main(void) {
     RUN_TEST(height_balanced);
     RUN_TEST(is_valid_after_operations);
     RUN_TEST(range_search);
+    RUN_TEST(order_statistics);
+    RUN_TEST(from_sorted_array);
+    RUN_TEST(set_operations);
+    RUN_TEST(set_operations_parallel);
     RUN_TEST(clear);
     RUN_TEST(clone);
+    RUN_TEST(arena_allocator);
     RUN_TEST(stress_test);
+    RUN_TEST(iterators_and_seek);
+    RUN_TEST(memory_usage);
     RUN_TEST(null_pointer_checks);
 
     printf("\n============================================\n");
-    printf("  TODOS OS TESTES PASSARAM! (18 testes)\n");
+    printf("  TODOS OS TESTES PASSARAM! (25 testes)\n");
     printf("============================================\n\n");
 
     return 0;
@@ -7,15 +7,19 @@
  * - Travessias: inorder, preorder, postorder, levelorder
  * - Propriedades: altura, tamanho, folhas, completa, cheia, perfeita
  * - Operações avançadas: busca, remoção, clone, LCA, diâmetro
+ * - Índice de LCA em O(1) comparado com btree_lca
  *
  * @author Algoritmos e Heurísticas
  * @date 2025
  */
 
 #include "data_structures/binary_tree.h"
+#include "data_structures/arena.h"
 #include "data_structures/common.h"
 #include "../test_macros.h"
 
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 // ============================================================================
@@ -231,6 +235,97 @@ TEST(levelorder_traversal) {
     btree_destroy(tree);
 }
 
+TEST(iterators_match_traversals) {
+    BinaryTree *tree = btree_create(sizeof(int), compare_int, NULL);
+
+    /**
+     *        1
+     *       / \
+     *      2   3
+     *       \   \
+     *        4   5
+     *       /
+     *      6
+     */
+
+    int values[] = {1, 2, 3, 4, 5, 6};
+    TreeNode *nodes[6];
+    for (int i = 0; i < 6; i++) {
+        nodes[i] = btree_create_node(tree, &values[i]);
+    }
+    btree_set_root(tree, nodes[0]);
+    btree_set_left(tree, nodes[0], nodes[1]);
+    btree_set_right(tree, nodes[0], nodes[2]);
+    btree_set_right(tree, nodes[1], nodes[3]);
+    btree_set_right(tree, nodes[2], nodes[4]);
+    btree_set_left(tree, nodes[3], nodes[5]);
+
+    int inorder[] = {2, 6, 4, 1, 3, 5};
+    int preorder[] = {1, 2, 4, 6, 3, 5};
+    int postorder[] = {6, 4, 2, 5, 3, 1};
+    int *expected[] = {inorder, preorder, postorder};
+    BTreeOrder orders[] = {BTREE_INORDER, BTREE_PREORDER, BTREE_POSTORDER};
+
+    for (int o = 0; o < 3; o++) {
+        BTreeIter it;
+        void *data;
+        int count = 0;
+        btree_iter_begin(tree, orders[o], &it);
+        while (btree_iter_next(&it, &data)) {
+            ASSERT_EQ(*(int*)data, expected[o][count]);
+            count++;
+        }
+        ASSERT_EQ(count, 6);
+    }
+
+    traversal_count = 0;
+    btree_postorder(tree, count_callback, NULL);
+    ASSERT_EQ(traversal_count, 6);
+    ASSERT_EQ(traversal_values[0], 6);
+
+    BTreeIter it;
+    btree_iter_begin(NULL, BTREE_INORDER, &it);
+    ASSERT_FALSE(btree_iter_next(&it, NULL));
+    btree_destroy(tree);
+}
+
+static void sum_callback(void *data, void *user_data) {
+    *(long*)user_data += *(int*)data;
+}
+
+TEST(deep_tree_without_recursion) {
+    // Cadeia de 1M nós: a versão recursiva estouraria a pilha
+    const int N = 1000000;
+    BinaryTree *tree = btree_create(sizeof(int), compare_int, NULL);
+    TreeNode *prev = NULL;
+    for (int i = 0; i < N; i++) {
+        TreeNode *node = btree_create_node(tree, &i);
+        if (prev == NULL) {
+            btree_set_root(tree, node);
+        } else {
+            btree_set_left(tree, prev, node);
+        }
+        prev = node;
+    }
+
+    long sums[3] = {0, 0, 0};
+    btree_inorder(tree, sum_callback, &sums[0]);
+    btree_preorder(tree, sum_callback, &sums[1]);
+    btree_postorder(tree, sum_callback, &sums[2]);
+    long expected = (long)N * (N - 1) / 2;
+    ASSERT_EQ(sums[0], expected);
+    ASSERT_EQ(sums[1], expected);
+    ASSERT_EQ(sums[2], expected);
+
+    BTreeIter it;
+    void *data;
+    btree_iter_begin(tree, BTREE_INORDER, &it);
+    ASSERT_TRUE(btree_iter_next(&it, &data));
+    ASSERT_EQ(*(int*)data, N - 1);
+
+    btree_destroy(tree);  // destruição também iterativa
+}
+
 // ============================================================================
 // TESTES: PROPRIEDADES
 // ============================================================================
@@ -514,6 +609,29 @@ TEST(clone_tree) {
 // TESTES: TO_ARRAY
 // ============================================================================
 
+TEST(arena_allocator) {
+    DSArena *arena = ds_arena_create(0);
+    DSAllocator alloc = ds_arena_allocator(arena);
+    BinaryTree *tree = btree_create_with_allocator(sizeof(int), compare_int, NULL, &alloc);
+    ASSERT_NOT_NULL(tree);
+
+    int values[] = {10, 5, 15};
+    TreeNode *root = btree_create_node(tree, &values[0]);
+    btree_set_root(tree, root);
+    btree_set_left(tree, root, btree_create_node(tree, &values[1]));
+    btree_set_right(tree, root, btree_create_node(tree, &values[2]));
+    ASSERT_EQ(btree_size(tree), 3);
+
+    BinaryTree *clone = btree_clone(tree, NULL);
+    ASSERT_NOT_NULL(clone);
+    ASSERT_EQ(*(int*)btree_node_data(btree_left(btree_root(clone))), 5);
+
+    btree_destroy(clone);
+    btree_destroy(tree);
+    ASSERT_EQ(ds_arena_bytes_used(arena), 0);
+    ds_arena_destroy(arena);
+}
+
 TEST(to_array_inorder) {
     BinaryTree *tree = btree_create(sizeof(int), compare_int, NULL);
 
@@ -649,6 +767,121 @@ TEST(tree_diameter) {
     btree_destroy(tree);
 }
 
+// ============================================================================
+// TESTES: ÍNDICE DE LCA
+// ============================================================================
+
+TEST(lca_index_small_tree) {
+    BinaryTree *tree = btree_create(sizeof(int), compare_int, NULL);
+
+    /**
+     *        10
+     *       /  \
+     *      5    15
+     *     / \     \
+     *    3   7    20
+     *       /
+     *      6
+     */
+
+    int values[] = {10, 5, 15, 3, 7, 20, 6};
+    TreeNode *nodes[7];
+    for (int i = 0; i < 7; i++) {
+        nodes[i] = btree_create_node(tree, &values[i]);
+    }
+    btree_set_root(tree, nodes[0]);
+    btree_set_left(tree, nodes[0], nodes[1]);
+    btree_set_right(tree, nodes[0], nodes[2]);
+    btree_set_left(tree, nodes[1], nodes[3]);
+    btree_set_right(tree, nodes[1], nodes[4]);
+    btree_set_right(tree, nodes[2], nodes[5]);
+    btree_set_left(tree, nodes[4], nodes[6]);
+
+    BTreeLCAIndex *index = btree_lca_index_create(tree);
+    ASSERT_NOT_NULL(index);
+    for (int i = 0; i < 7; i++) {
+        for (int j = 0; j < 7; j++) {
+            ASSERT_EQ(btree_lca_index_query(index, nodes[i], nodes[j]),
+                      btree_lca(tree, nodes[i], nodes[j]));
+            ASSERT_EQ(btree_lca_index_distance(index, nodes[i], nodes[j]),
+                      btree_distance(tree, nodes[i], nodes[j]));
+        }
+    }
+    ASSERT_EQ(btree_lca_index_query(index, nodes[6], nodes[3]), nodes[1]);
+    ASSERT_EQ(btree_lca_index_distance(index, nodes[6], nodes[5]), 5);
+    ASSERT_EQ(btree_lca_index_depth(index, nodes[6]), 3);
+
+    // Nó de outra árvore não pertence ao índice
+    BinaryTree *other = btree_create(sizeof(int), compare_int, NULL);
+    TreeNode *stranger = btree_create_node(other, &values[0]);
+    btree_set_root(other, stranger);
+    ASSERT_NULL(btree_lca_index_query(index, nodes[0], stranger));
+    ASSERT_EQ(btree_lca_index_distance(index, stranger, nodes[0]), -1);
+    ASSERT_EQ(btree_lca_index_depth(index, NULL), -1);
+
+    btree_lca_index_destroy(index);
+    btree_destroy(other);
+    btree_destroy(tree);
+}
+
+TEST(lca_index_random_and_deep_trees) {
+    // Árvore aleatória com vários blocos de 64 e uma cadeia profunda
+    const int N = 3000;
+    int *values = malloc((size_t)N * sizeof(int));
+    TreeNode **nodes = malloc((size_t)N * sizeof(TreeNode*));
+    uint64_t rng = 0x2545F4914F6CDD1DULL;
+
+    for (int shape = 0; shape < 2; shape++) {
+        BinaryTree *tree = btree_create(sizeof(int), compare_int, NULL);
+        for (int i = 0; i < N; i++) {
+            values[i] = i;
+            nodes[i] = btree_create_node(tree, &values[i]);
+            if (i == 0) {
+                btree_set_root(tree, nodes[0]);
+                continue;
+            }
+            if (shape == 1) {
+                btree_set_left(tree, nodes[i - 1], nodes[i]);
+                continue;
+            }
+            for (;;) {
+                rng ^= rng << 13;
+                rng ^= rng >> 7;
+                rng ^= rng << 17;
+                TreeNode *parent = nodes[rng % (uint64_t)i];
+                if (btree_left(parent) == NULL) {
+                    btree_set_left(tree, parent, nodes[i]);
+                    break;
+                }
+                if (btree_right(parent) == NULL) {
+                    btree_set_right(tree, parent, nodes[i]);
+                    break;
+                }
+            }
+        }
+
+        BTreeLCAIndex *index = btree_lca_index_create(tree);
+        ASSERT_NOT_NULL(index);
+        for (int q = 0; q < 5000; q++) {
+            rng ^= rng << 13;
+            rng ^= rng >> 7;
+            rng ^= rng << 17;
+            TreeNode *a = nodes[rng % (uint64_t)N];
+            TreeNode *b = nodes[(rng >> 32) % (uint64_t)N];
+            ASSERT_EQ(btree_lca_index_query(index, a, b), btree_lca(tree, a, b));
+            ASSERT_EQ(btree_lca_index_distance(index, a, b), btree_distance(tree, a, b));
+        }
+        if (shape == 1) {
+            ASSERT_EQ(btree_lca_index_depth(index, nodes[N - 1]), N - 1);
+        }
+        btree_lca_index_destroy(index);
+        btree_destroy(tree);
+    }
+    ASSERT_NULL(btree_lca_index_create(NULL));
+    free(values);
+    free(nodes);
+}
+
 // ============================================================================
 // TESTE VISUAL
 // ============================================================================
@@ -707,6 +940,8 @@ int main(void) {
     RUN_TEST(preorder_traversal);
     RUN_TEST(postorder_traversal);
     RUN_TEST(levelorder_traversal);
+    RUN_TEST(iterators_match_traversals);
+    RUN_TEST(deep_tree_without_recursion);
 
     printf("\nPropriedades:\n");
     RUN_TEST(height_calculation);
@@ -725,6 +960,7 @@ int main(void) {
 
     printf("\nClone:\n");
     RUN_TEST(clone_tree);
+    RUN_TEST(arena_allocator);
 
     printf("\nTo Array:\n");
     RUN_TEST(to_array_inorder);
@@ -734,11 +970,15 @@ int main(void) {
     RUN_TEST(node_distance);
     RUN_TEST(tree_diameter);
 
+    printf("\nÍndice de LCA:\n");
+    RUN_TEST(lca_index_small_tree);
+    RUN_TEST(lca_index_random_and_deep_trees);
+
     printf("\nTeste Visual:\n");
     RUN_TEST(print_visual);
 
     printf("\n============================================\n");
-    printf("  ✅ TODOS OS TESTES PASSARAM! (24 testes)\n");
+    printf("  ✅ TODOS OS TESTES PASSARAM! (29 testes)\n");
     printf("============================================\n\n");
 
     return 0;
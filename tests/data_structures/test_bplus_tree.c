@@ -0,0 +1,320 @@
+/**
+ * @file test_bplus_tree.c
+ * @brief Testes unitários para Árvore B+
+ *
+ * Compara a árvore com um array ordenado de referência sob inserções e
+ * remoções aleatórias (com repetidos), e testa bulk loading, range search
+ * pela lista de folhas, clone e alocador customizado.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/bplus_tree.h"
+#include "data_structures/arena.h"
+#include "data_structures/common.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Registro largo: folhas com a capacidade mínima, árvores altas com poucos elementos
+typedef struct {
+    int key;
+    int serial;
+    char payload[BPTREE_NODE_BYTES / 4];
+} Wide;
+
+static int compare_wide(const void *a, const void *b) {
+    return compare_int(&((const Wide*)a)->key, &((const Wide*)b)->key);
+}
+
+static uint32_t next_random(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+// Posição do primeiro elemento >= key no array de referência
+static size_t ref_lower_bound(const int *ref, size_t n, int key) {
+    size_t lo = 0, hi = n;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (ref[mid] < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+static void collect_int(void *data, void *user_data) {
+    int **cursor = (int**)user_data;
+    **cursor = *(int*)data;
+    (*cursor)++;
+}
+
+// ============================================================================
+// TESTES
+// ============================================================================
+
+TEST(create_destroy) {
+    BPlusTree *tree = bptree_create(sizeof(int), compare_int, NULL);
+    ASSERT_NOT_NULL(tree);
+    ASSERT_TRUE(bptree_is_empty(tree));
+    ASSERT_EQ(bptree_size(tree), 0);
+    ASSERT_EQ(bptree_height(tree), -1);
+    ASSERT_TRUE(bptree_is_valid(tree));
+    ASSERT_TRUE(bptree_leaf_capacity(tree) >= BPTREE_MIN_FANOUT);
+    bptree_destroy(tree);
+
+    tree = bptree_create(sizeof(Wide), compare_wide, NULL);
+    ASSERT_NOT_NULL(tree);
+    ASSERT_EQ(bptree_leaf_capacity(tree), BPTREE_MIN_FANOUT);
+    bptree_destroy(tree);
+}
+
+TEST(random_operations_match_reference) {
+    const size_t n = 6000;
+    int *ref = (int*)malloc(n * sizeof(int));
+    ASSERT_NOT_NULL(ref);
+    size_t ref_size = 0;
+    uint32_t state = 12345u;
+
+    BPlusTree *tree = bptree_create(sizeof(int), compare_int, NULL);
+    ASSERT_NOT_NULL(tree);
+
+    for (size_t op = 0; op < 3 * n; op++) {
+        // Chaves em [0, 2000): muitos repetidos atravessando folhas
+        int key = (int)(next_random(&state) % 2000);
+        bool insert = ref_size == 0 || (op < 2 * n && next_random(&state) % 3 != 0) ||
+                      (op >= 2 * n && next_random(&state) % 4 == 0);
+        size_t pos = ref_lower_bound(ref, ref_size, key);
+        bool present = pos < ref_size && ref[pos] == key;
+        if (insert && ref_size < n) {
+            ASSERT_EQ(bptree_insert(tree, &key), DS_SUCCESS);
+            pos = ref_lower_bound(ref, ref_size, key + 1);
+            memmove(ref + pos + 1, ref + pos, (ref_size - pos) * sizeof(int));
+            ref[pos] = key;
+            ref_size++;
+        } else {
+            ASSERT_EQ(bptree_remove(tree, &key), present ? DS_SUCCESS : DS_ERROR_NOT_FOUND);
+            if (present) {
+                memmove(ref + pos, ref + pos + 1, (ref_size - pos - 1) * sizeof(int));
+                ref_size--;
+            }
+        }
+        ASSERT_EQ(bptree_size(tree), ref_size);
+        ASSERT_EQ(bptree_contains(tree, &key), ref_lower_bound(ref, ref_size, key) < ref_size &&
+                                               ref[ref_lower_bound(ref, ref_size, key)] == key);
+        if (op % 500 == 0) ASSERT_TRUE(bptree_is_valid(tree));
+    }
+    ASSERT_TRUE(bptree_is_valid(tree));
+    ASSERT_TRUE(bptree_height(tree) >= 1);
+
+    int *seen = (int*)malloc(ref_size * sizeof(int) + 1);
+    int *cursor = seen;
+    bptree_inorder(tree, collect_int, &cursor);
+    ASSERT_EQ((size_t)(cursor - seen), ref_size);
+    ASSERT_TRUE(memcmp(seen, ref, ref_size * sizeof(int)) == 0);
+    free(seen);
+
+    // Remove tudo: a árvore encolhe até ficar vazia
+    for (size_t i = 0; i < ref_size; i++) {
+        ASSERT_EQ(bptree_remove(tree, &ref[ref_size - 1 - i]), DS_SUCCESS);
+        if (i % 97 == 0) ASSERT_TRUE(bptree_is_valid(tree));
+    }
+    ASSERT_TRUE(bptree_is_empty(tree));
+    ASSERT_EQ(bptree_height(tree), -1);
+    ASSERT_TRUE(bptree_is_valid(tree));
+
+    bptree_destroy(tree);
+    free(ref);
+}
+
+TEST(duplicates_keep_insertion_order) {
+    // Capacidade mínima: as cópias de uma chave se espalham por várias folhas
+    BPlusTree *tree = bptree_create(sizeof(Wide), compare_wide, NULL);
+    ASSERT_NOT_NULL(tree);
+    Wide w;
+    memset(&w, 0, sizeof(w));
+    int serial = 0;
+    for (int round = 0; round < 12; round++) {
+        for (int k = 0; k < 10; k++) {
+            w.key = k;
+            w.serial = serial++;
+            ASSERT_EQ(bptree_insert(tree, &w), DS_SUCCESS);
+        }
+    }
+    ASSERT_TRUE(bptree_is_valid(tree));
+    ASSERT_TRUE(bptree_height(tree) >= 3);
+
+    // search e remove atuam sobre a cópia mais antiga
+    for (int round = 0; round < 12; round++) {
+        for (int k = 0; k < 10; k++) {
+            Wide probe = {k, 0, {0}}, out;
+            ASSERT_EQ(bptree_search(tree, &probe, &out), DS_SUCCESS);
+            ASSERT_EQ(out.serial, round * 10 + k);
+            ASSERT_EQ(bptree_remove(tree, &probe), DS_SUCCESS);
+        }
+        ASSERT_TRUE(bptree_is_valid(tree));
+    }
+    ASSERT_TRUE(bptree_is_empty(tree));
+    bptree_destroy(tree);
+}
+
+TEST(from_sorted_array) {
+    int sorted[5000];
+    for (int i = 0; i < 5000; i++) sorted[i] = 2 * i;
+
+    for (size_t n = 0; n <= 5000; n += (n < 300) ? 1 : 937) {
+        BPlusTree *tree = bptree_from_sorted_array(sizeof(int), sorted, n, compare_int, NULL);
+        ASSERT_NOT_NULL(tree);
+        ASSERT_EQ(bptree_size(tree), n);
+        ASSERT_TRUE(bptree_is_valid(tree));
+        for (int key = -1; key <= 2 * (int)n; key += 7) {
+            int out = -1;
+            bool expected = key >= 0 && key % 2 == 0 && key < 2 * (int)n;
+            ASSERT_EQ(bptree_search(tree, &key, &out), expected ? DS_SUCCESS : DS_ERROR_NOT_FOUND);
+            if (expected) ASSERT_EQ(out, key);
+        }
+        // Continua válida após inserções e remoções
+        int odd = (int)n | 1;
+        ASSERT_EQ(bptree_insert(tree, &odd), DS_SUCCESS);
+        if (n > 0) ASSERT_EQ(bptree_remove(tree, &sorted[n / 2]), DS_SUCCESS);
+        ASSERT_TRUE(bptree_is_valid(tree));
+        bptree_destroy(tree);
+    }
+
+    int unsorted[3] = {1, 3, 2};
+    ASSERT_NULL(bptree_from_sorted_array(sizeof(int), unsorted, 3, compare_int, NULL));
+
+    // Registros largos: vários níveis internos
+    Wide *wide = (Wide*)calloc(1000, sizeof(Wide));
+    ASSERT_NOT_NULL(wide);
+    for (int i = 0; i < 1000; i++) wide[i].key = i / 3;
+    BPlusTree *tree = bptree_from_sorted_array(sizeof(Wide), wide, 1000, compare_wide, NULL);
+    ASSERT_NOT_NULL(tree);
+    ASSERT_TRUE(bptree_is_valid(tree));
+    ASSERT_TRUE(bptree_height(tree) >= 4);
+    bptree_destroy(tree);
+    free(wide);
+}
+
+TEST(min_max_and_range_search) {
+    BPlusTree *tree = bptree_create(sizeof(int), compare_int, NULL);
+    int out;
+    ASSERT_EQ(bptree_min(tree, &out), DS_ERROR_EMPTY);
+    ASSERT_EQ(bptree_max(tree, &out), DS_ERROR_EMPTY);
+
+    for (int i = 0; i < 3000; i++) {
+        int v = (i * 7919) % 3000;
+        ASSERT_EQ(bptree_insert(tree, &v), DS_SUCCESS);
+    }
+    ASSERT_EQ(bptree_min(tree, &out), DS_SUCCESS);
+    ASSERT_EQ(out, 0);
+    ASSERT_EQ(bptree_max(tree, &out), DS_SUCCESS);
+    ASSERT_EQ(out, 2999);
+
+    const int bounds[][2] = {{-10, -1}, {-5, 3}, {100, 100}, {250, 1999}, {2990, 5000}, {7, 3}};
+    for (size_t b = 0; b < sizeof(bounds) / sizeof(bounds[0]); b++) {
+        int lo = bounds[b][0], hi = bounds[b][1];
+        void *results = NULL;
+        size_t count = 99;
+        ASSERT_EQ(bptree_range_search(tree, &lo, &hi, &results, &count), DS_SUCCESS);
+        int first = lo < 0 ? 0 : lo;
+        int last = hi > 2999 ? 2999 : hi;
+        size_t expected = (last >= first) ? (size_t)(last - first + 1) : 0;
+        ASSERT_EQ(count, expected);
+        for (size_t i = 0; i < count; i++) ASSERT_EQ(((int*)results)[i], first + (int)i);
+        if (expected == 0) ASSERT_NULL(results);
+        free(results);
+    }
+    bptree_destroy(tree);
+}
+
+TEST(clone_and_clear) {
+    BPlusTree *tree = bptree_create(sizeof(int), compare_int, NULL);
+    for (int i = 0; i < 1000; i++) {
+        int v = 999 - i;
+        bptree_insert(tree, &v);
+    }
+    BPlusTree *cloned = bptree_clone(tree, NULL);
+    ASSERT_NOT_NULL(cloned);
+    ASSERT_EQ(bptree_size(cloned), 1000);
+    ASSERT_TRUE(bptree_is_valid(cloned));
+
+    bptree_clear(tree);
+    ASSERT_TRUE(bptree_is_empty(tree));
+    ASSERT_TRUE(bptree_is_valid(tree));
+    int v = 500;
+    ASSERT_TRUE(bptree_contains(cloned, &v));
+    ASSERT_FALSE(bptree_contains(tree, &v));
+    ASSERT_EQ(bptree_insert(tree, &v), DS_SUCCESS);
+    ASSERT_EQ(bptree_size(tree), 1);
+
+    bptree_destroy(cloned);
+    bptree_destroy(tree);
+}
+
+TEST(arena_allocator) {
+    DSArena *arena = ds_arena_create(0);
+    DSAllocator alloc = ds_arena_allocator(arena);
+    BPlusTree *tree = bptree_create_with_allocator(sizeof(int), compare_int, NULL, &alloc);
+    ASSERT_NOT_NULL(tree);
+
+    for (int i = 0; i < 2000; i++) {
+        ASSERT_EQ(bptree_insert(tree, &i), DS_SUCCESS);
+    }
+    for (int i = 0; i < 2000; i += 2) {
+        ASSERT_EQ(bptree_remove(tree, &i), DS_SUCCESS);
+    }
+    ASSERT_TRUE(bptree_is_valid(tree));
+
+    BPlusTree *cloned = bptree_clone(tree, NULL);
+    ASSERT_NOT_NULL(cloned);
+    ASSERT_EQ(bptree_size(cloned), 1000);
+
+    bptree_destroy(cloned);
+    bptree_destroy(tree);
+    ASSERT_EQ(ds_arena_bytes_used(arena), 0);
+    ds_arena_destroy(arena);
+}
+
+TEST(null_pointer_checks) {
+    int v = 1, out;
+    void *results;
+    size_t count;
+    ASSERT_NULL(bptree_create(0, compare_int, NULL));
+    ASSERT_NULL(bptree_create(sizeof(int), NULL, NULL));
+    ASSERT_NULL(bptree_from_sorted_array(sizeof(int), NULL, 3, compare_int, NULL));
+    ASSERT_EQ(bptree_insert(NULL, &v), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(bptree_search(NULL, &v, &out), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(bptree_remove(NULL, &v), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(bptree_min(NULL, &out), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(bptree_range_search(NULL, &v, &v, &results, &count), DS_ERROR_NULL_POINTER);
+    ASSERT_FALSE(bptree_contains(NULL, &v));
+    ASSERT_FALSE(bptree_is_valid(NULL));
+    ASSERT_EQ(bptree_size(NULL), 0);
+    ASSERT_EQ(bptree_height(NULL), -1);
+    ASSERT_NULL(bptree_clone(NULL, NULL));
+    bptree_destroy(NULL);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== B+ Tree Tests ===\n");
+
+    RUN_TEST(create_destroy);
+    RUN_TEST(random_operations_match_reference);
+    RUN_TEST(duplicates_keep_insertion_order);
+    RUN_TEST(from_sorted_array);
+    RUN_TEST(min_max_and_range_search);
+    RUN_TEST(clone_and_clear);
+    RUN_TEST(arena_allocator);
+    RUN_TEST(null_pointer_checks);
+
+    printf("\nAll B+ Tree tests passed!\n");
+    return 0;
+}
@@ -13,6 +13,7 @@
 #include "data_structures/common.h"
 #include "../test_macros.h"
 
+#include <stdlib.h>
 #include <string.h>
 #include <assert.h>
 
@@ -336,6 +337,84 @@ TEST(clone) {
     bst_destroy(clone);
 }
 
+TEST(iterators_and_seek) {
+    BST *bst = bst_create(sizeof(int), compare_int, NULL);
+    int values[] = {50, 30, 70, 20, 40, 60, 80, 35};
+    for (size_t i = 0; i < 8; i++) {
+        bst_insert(bst, &values[i]);
+    }
+
+    int inorder[] = {20, 30, 35, 40, 50, 60, 70, 80};
+    int preorder[] = {50, 30, 20, 40, 35, 70, 60, 80};
+    int postorder[] = {20, 35, 40, 30, 60, 80, 70, 50};
+    int *expected[] = {inorder, preorder, postorder};
+    BSTOrder orders[] = {BST_INORDER, BST_PREORDER, BST_POSTORDER};
+
+    for (int o = 0; o < 3; o++) {
+        BSTIter it;
+        void *data;
+        size_t count = 0;
+        bst_iter_begin(bst, orders[o], &it);
+        while (bst_iter_next(&it, &data)) {
+            ASSERT_EQ(*(int*)data, expected[o][count]);
+            count++;
+        }
+        ASSERT_EQ(count, 8);
+        ASSERT_FALSE(bst_iter_next(&it, &data));
+    }
+
+    // Seek: começa no primeiro >= chave, mesmo se a chave não existe
+    BSTIter it;
+    void *data;
+    int key = 36;
+    bst_iter_seek(bst, &key, &it);
+    ASSERT_TRUE(bst_iter_next(&it, &data));
+    ASSERT_EQ(*(int*)data, 40);
+    ASSERT_TRUE(bst_iter_next(&it, &data));
+    ASSERT_EQ(*(int*)data, 50);
+    key = 81;
+    bst_iter_seek(bst, &key, &it);
+    ASSERT_FALSE(bst_iter_next(&it, &data));
+
+    int lo = 25, hi = 60;
+    ASSERT_EQ(bst_range_count(bst, &lo, &hi), 5);
+    int rank_key = 45;
+    ASSERT_EQ(bst_rank(bst, &rank_key), 4);
+
+    bst_destroy(bst);
+}
+
+TEST(degenerate_tree_traversal) {
+    // Inserções ordenadas: uma lista de N nós, percorrida sem recursão
+    const int N = 20000;
+    BST *bst = bst_create(sizeof(int), compare_int, NULL);
+    for (int i = 0; i < N; i++) {
+        bst_insert(bst, &i);
+    }
+    ASSERT_EQ(bst_height(bst), N - 1);
+
+    BSTIter it;
+    void *data;
+    int expected = 0;
+    bst_iter_begin(bst, BST_INORDER, &it);
+    while (bst_iter_next(&it, &data)) {
+        ASSERT_EQ(*(int*)data, expected);
+        expected++;
+    }
+    ASSERT_EQ(expected, N);
+
+    int lo = 100, hi = 199;
+    ASSERT_EQ(bst_range_count(bst, &lo, &hi), 100);
+    void *results = NULL;
+    size_t count = 0;
+    ASSERT_EQ(bst_range_search(bst, &lo, &hi, &results, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 100);
+    ASSERT_EQ(((int*)results)[99], 199);
+    free(results);
+
+    bst_destroy(bst);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -367,9 +446,11 @@ int main(void) {
     RUN_TEST(range_count);
     RUN_TEST(select_kth);
     RUN_TEST(clone);
+    RUN_TEST(iterators_and_seek);
+    RUN_TEST(degenerate_tree_traversal);
 
     printf("\n============================================\n");
-    printf("  ✅ TODOS OS TESTES PASSARAM! (20 testes)\n");
+    printf("  ✅ TODOS OS TESTES PASSARAM! (22 testes)\n");
     printf("============================================\n\n");
 
     return 0;
@@ -0,0 +1,286 @@
+/**
+ * @file test_double_array_trie.c
+ * @brief Testes unitários para a trie estática em double array
+ *
+ * Compara busca, prefixos e autocomplete com o Trie (trie.h) e testa a
+ * gravação e a abertura com mmap e a partir de um buffer.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/double_array_trie.h"
+#include "data_structures/trie.h"
+#include "data_structures/common.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#define DATRIE_PATH "test_datrie.bin"
+
+// ============================================================================
+// FUNÇÕES AUXILIARES DE TESTE
+// ============================================================================
+
+static void free_string_array(char **array, size_t count) {
+    if (array == NULL) return;
+    for (size_t i = 0; i < count; i++) {
+        free(array[i]);
+    }
+    free(array);
+}
+
+static uint32_t next_random(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+// Trie com palavras aleatórias sobre {a, b, c, d, e}, de 0 a 9 letras
+static Trie* random_trie(size_t n, uint32_t seed) {
+    Trie *trie = trie_create(26);
+    char word[16];
+    for (size_t i = 0; i < n; i++) {
+        size_t len = next_random(&seed) % 10;
+        for (size_t j = 0; j < len; j++) word[j] = (char)('a' + next_random(&seed) % 5);
+        word[len] = '\0';
+        trie_insert(trie, word);
+    }
+    return trie;
+}
+
+static bool same_autocomplete(const DoubleArrayTrie *dat, const Trie *trie, const char *prefix) {
+    char **a = NULL, **b = NULL;
+    size_t na = 0, nb = 0;
+    bool same = datrie_autocomplete(dat, prefix, &a, &na) == DS_SUCCESS &&
+                trie_autocomplete(trie, prefix, &b, &nb) == DS_SUCCESS && na == nb;
+    for (size_t i = 0; same && i < na; i++) same = strcmp(a[i], b[i]) == 0;
+    free_string_array(a, na);
+    free_string_array(b, nb);
+    return same;
+}
+
+// ============================================================================
+// TESTES
+// ============================================================================
+
+TEST(basic_operations) {
+    const char *words[] = {"car", "card", "care", "careful", "dog"};
+    DoubleArrayTrie *dat = datrie_from_sorted_array(words, 5);
+    ASSERT_NOT_NULL(dat);
+    ASSERT_EQ(datrie_size(dat), 5);
+
+    for (size_t i = 0; i < 5; i++) {
+        size_t index = 99;
+        ASSERT_TRUE(datrie_lookup(dat, words[i], &index));
+        ASSERT_EQ(index, i);
+    }
+    ASSERT_FALSE(datrie_search(dat, "ca"));
+    ASSERT_FALSE(datrie_search(dat, "cares"));
+    ASSERT_FALSE(datrie_search(dat, ""));
+    ASSERT_TRUE(datrie_starts_with(dat, "caref"));
+    ASSERT_TRUE(datrie_starts_with(dat, ""));
+    ASSERT_FALSE(datrie_starts_with(dat, "carefully"));
+
+    char **results = NULL;
+    size_t count = 0;
+    ASSERT_EQ(datrie_autocomplete(dat, "car", &results, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 4);
+    for (size_t i = 0; i < 4; i++) ASSERT_EQ(strcmp(results[i], words[i]), 0);
+    free_string_array(results, count);
+
+    ASSERT_EQ(datrie_autocomplete(dat, "cat", &results, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 0);
+    ASSERT_NULL(results);
+    ASSERT_TRUE(datrie_memory_usage(dat) > 0);
+    datrie_destroy(dat);
+
+    // Fora de ordem, repetições e NULL são recusados
+    const char *unsorted[] = {"b", "a"};
+    const char *duplicated[] = {"a", "a"};
+    const char *with_null[] = {"a", NULL};
+    ASSERT_NULL(datrie_from_sorted_array(unsorted, 2));
+    ASSERT_NULL(datrie_from_sorted_array(duplicated, 2));
+    ASSERT_NULL(datrie_from_sorted_array(with_null, 2));
+    ASSERT_NULL(datrie_from_sorted_array(NULL, 1));
+
+    // Vazia e só com a string vazia
+    dat = datrie_from_sorted_array(NULL, 0);
+    ASSERT_NOT_NULL(dat);
+    ASSERT_FALSE(datrie_search(dat, ""));
+    ASSERT_FALSE(datrie_starts_with(dat, ""));
+    ASSERT_EQ(datrie_autocomplete(dat, "", &results, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 0);
+    datrie_destroy(dat);
+
+    const char *empty[] = {""};
+    dat = datrie_from_sorted_array(empty, 1);
+    ASSERT_TRUE(datrie_search(dat, ""));
+    ASSERT_FALSE(datrie_starts_with(dat, "a"));
+    datrie_destroy(dat);
+}
+
+TEST(matches_trie) {
+    Trie *trie = random_trie(3000, 7u);
+    DoubleArrayTrie *dat = datrie_from_trie(trie);
+    ASSERT_NOT_NULL(dat);
+    ASSERT_EQ(datrie_size(dat), trie_size(trie));
+
+    char **all = NULL;
+    size_t count = 0;
+    ASSERT_EQ(trie_to_array(trie, &all, &count), DS_SUCCESS);
+    for (size_t i = 0; i < count; i++) {
+        size_t index = 0;
+        ASSERT_TRUE(datrie_lookup(dat, all[i], &index));
+        ASSERT_EQ(index, i);
+    }
+    free_string_array(all, count);
+
+    uint32_t seed = 99u;
+    char word[16];
+    for (int q = 0; q < 5000; q++) {
+        size_t len = next_random(&seed) % 11;
+        for (size_t j = 0; j < len; j++) word[j] = (char)('a' + next_random(&seed) % 6);
+        word[len] = '\0';
+        ASSERT_EQ(datrie_search(dat, word), trie_search(trie, word));
+        ASSERT_EQ(datrie_starts_with(dat, word), trie_starts_with(trie, word));
+    }
+
+    ASSERT_TRUE(same_autocomplete(dat, trie, ""));
+    ASSERT_TRUE(same_autocomplete(dat, trie, "a"));
+    ASSERT_TRUE(same_autocomplete(dat, trie, "bce"));
+    ASSERT_TRUE(same_autocomplete(dat, trie, "eeeee"));
+
+    // Poucas células por byte de chave: a busca por base deixa o array denso
+    ASSERT_TRUE(datrie_memory_usage(dat) < 3 * 8 * 3000 * 10);
+
+    datrie_destroy(dat);
+    trie_destroy(trie);
+}
+
+TEST(full_byte_alphabet) {
+    // "x" seguido de cada byte 1..255: 255 filhos no mesmo nó, em ordem de strcmp
+    char keys[255][3];
+    const char *sorted[255];
+    for (int b = 1; b < 256; b++) {
+        keys[b - 1][0] = 'x';
+        keys[b - 1][1] = (char)b;
+        keys[b - 1][2] = '\0';
+        sorted[b - 1] = keys[b - 1];
+    }
+    DoubleArrayTrie *dat = datrie_from_sorted_array(sorted, 255);
+    ASSERT_NOT_NULL(dat);
+    for (size_t i = 0; i < 255; i++) {
+        size_t index = 0;
+        ASSERT_TRUE(datrie_lookup(dat, sorted[i], &index));
+        ASSERT_EQ(index, i);
+    }
+    ASSERT_FALSE(datrie_search(dat, "x"));
+    ASSERT_TRUE(datrie_starts_with(dat, "x"));
+    ASSERT_FALSE(datrie_search(dat, "\xff"));
+
+    char **results = NULL;
+    size_t count = 0;
+    ASSERT_EQ(datrie_autocomplete(dat, "x", &results, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 255);
+    for (size_t i = 0; i < count; i++) ASSERT_EQ(strcmp(results[i], sorted[i]), 0);
+    free_string_array(results, count);
+    datrie_destroy(dat);
+}
+
+TEST(save_and_mmap_roundtrip) {
+    Trie *trie = random_trie(2000, 2025u);
+    DoubleArrayTrie *dat = datrie_from_trie(trie);
+    ASSERT_NOT_NULL(dat);
+    ASSERT_TRUE(datrie_save(dat, DATRIE_PATH));
+
+    DoubleArrayTrie *mapped = datrie_mmap_open(DATRIE_PATH);
+    ASSERT_NOT_NULL(mapped);
+    ASSERT_EQ(datrie_size(mapped), datrie_size(dat));
+    ASSERT_EQ(datrie_memory_usage(mapped), datrie_memory_usage(dat));
+    ASSERT_TRUE(same_autocomplete(mapped, trie, ""));
+    ASSERT_TRUE(same_autocomplete(mapped, trie, "dc"));
+    datrie_destroy(mapped);
+
+    // Arquivo inteiro em memória: mesmo formato, sem cópia
+    FILE *f = fopen(DATRIE_PATH, "rb");
+    ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    size_t size = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint64_t *buffer = malloc(size);
+    ASSERT_NOT_NULL(buffer);
+    ASSERT_EQ(fread(buffer, 1, size, f), size);
+    fclose(f);
+    ASSERT_EQ(size, 40 + datrie_memory_usage(dat));
+
+    DoubleArrayTrie *view = datrie_from_buffer(buffer, size);
+    ASSERT_NOT_NULL(view);
+    ASSERT_TRUE(same_autocomplete(view, trie, "ab"));
+    datrie_destroy(view);
+
+    // Tamanho, alinhamento, magic e ordem de bytes errados são recusados
+    ASSERT_NULL(datrie_from_buffer(buffer, size - 8));
+    ASSERT_NULL(datrie_from_buffer((char*)buffer + 4, size - 4));
+    uint32_t order = ((uint32_t*)buffer)[3];
+    ((uint32_t*)buffer)[3] = 0x04030201u;
+    ASSERT_NULL(datrie_from_buffer(buffer, size));
+    ((uint32_t*)buffer)[3] = order;
+    ((char*)buffer)[0] = 'X';
+    ASSERT_NULL(datrie_from_buffer(buffer, size));
+    free(buffer);
+
+    ASSERT_NULL(datrie_mmap_open("missing_datrie.bin"));
+    ASSERT_FALSE(datrie_save(NULL, DATRIE_PATH));
+
+    // Trie vazia também vai e volta
+    DoubleArrayTrie *empty = datrie_from_sorted_array(NULL, 0);
+    ASSERT_TRUE(datrie_save(empty, DATRIE_PATH));
+    mapped = datrie_mmap_open(DATRIE_PATH);
+    ASSERT_NOT_NULL(mapped);
+    ASSERT_EQ(datrie_size(mapped), 0);
+    ASSERT_FALSE(datrie_starts_with(mapped, ""));
+    datrie_destroy(mapped);
+    datrie_destroy(empty);
+
+    remove(DATRIE_PATH);
+    datrie_destroy(dat);
+    trie_destroy(trie);
+}
+
+TEST(null_pointer_checks) {
+    char **results;
+    size_t count, index;
+    ASSERT_NULL(datrie_from_trie(NULL));
+    ASSERT_FALSE(datrie_search(NULL, "a"));
+    ASSERT_FALSE(datrie_lookup(NULL, "a", &index));
+    ASSERT_FALSE(datrie_starts_with(NULL, "a"));
+    ASSERT_EQ(datrie_autocomplete(NULL, "a", &results, &count), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(datrie_size(NULL), 0);
+    ASSERT_NULL(datrie_from_buffer(NULL, 64));
+    ASSERT_NULL(datrie_mmap_open(NULL));
+
+    const char *words[] = {"a"};
+    DoubleArrayTrie *dat = datrie_from_sorted_array(words, 1);
+    ASSERT_FALSE(datrie_search(dat, NULL));
+    ASSERT_EQ(datrie_autocomplete(dat, NULL, &results, &count), DS_ERROR_NULL_POINTER);
+    datrie_destroy(dat);
+    datrie_destroy(NULL);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Double-Array Trie Tests ===\n");
+
+    RUN_TEST(basic_operations);
+    RUN_TEST(matches_trie);
+    RUN_TEST(full_byte_alphabet);
+    RUN_TEST(save_and_mmap_roundtrip);
+    RUN_TEST(null_pointer_checks);
+
+    printf("\nAll Double-Array Trie tests passed!\n");
+    return 0;
+}
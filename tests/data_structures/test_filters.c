@@ -0,0 +1,228 @@
+/**
+ * @file test_filters.c
+ * @brief Testes unitários para os filtros de pertinência (Bloom em blocos e cuckoo)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/bloom_filter.h"
+#include "data_structures/cuckoo_filter.h"
+#include "data_structures/hash_table.h"
+#include "data_structures/arena.h"
+#include "data_structures/common.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <string.h>
+
+// ============================================================================
+// TESTES: BLOOM EM BLOCOS
+// ============================================================================
+
+TEST(bloom_no_false_negatives) {
+    const int N = 20000;
+    BloomFilter *bf = bloom_filter_create((size_t)N, 10, hash_int);
+    ASSERT_NOT_NULL(bf);
+    ASSERT_EQ(bloom_filter_size_bytes(bf) % BLOOM_BLOCK_BYTES, 0);
+    ASSERT_TRUE(bloom_filter_size_bytes(bf) * 8 >= (size_t)N * 10);
+
+    for (int i = 0; i < N; i++) {
+        int key = i * 3;
+        ASSERT_EQ(bloom_filter_add(bf, &key), DS_SUCCESS);
+    }
+    ASSERT_EQ(bloom_filter_count(bf), (size_t)N);
+    for (int i = 0; i < N; i++) {
+        int key = i * 3;
+        ASSERT_TRUE(bloom_filter_contains(bf, &key));
+    }
+
+    bloom_filter_clear(bf);
+    ASSERT_EQ(bloom_filter_count(bf), 0);
+    int key = 0;
+    ASSERT_FALSE(bloom_filter_contains(bf, &key));
+    bloom_filter_destroy(bf);
+}
+
+TEST(bloom_false_positive_rate) {
+    // 10 bits/chave: ~1.0% medido; aceita até 2%
+    const int N = 50000;
+    BloomFilter *bf = bloom_filter_create((size_t)N, 10, hash_int);
+    for (int i = 0; i < N; i++) {
+        int key = i;
+        bloom_filter_add(bf, &key);
+    }
+    int false_positives = 0;
+    for (int i = N; i < 3 * N; i++) {
+        int key = i;
+        if (bloom_filter_contains(bf, &key)) {
+            false_positives++;
+        }
+    }
+    double rate = (double)false_positives / (2.0 * N);
+    ASSERT_TRUE(rate > 0.0);
+    ASSERT_TRUE(rate < 0.02);
+    bloom_filter_destroy(bf);
+}
+
+TEST(bloom_string_keys_and_allocator) {
+    DSArena *arena = ds_arena_create(0);
+    ASSERT_NOT_NULL(arena);
+    DSAllocator alloc = ds_arena_allocator(arena);
+    BloomFilter *bf = bloom_filter_create_with_allocator(100, 12, hash_wyhash_string, &alloc);
+    ASSERT_NOT_NULL(bf);
+
+    char *words[] = {"alfa", "beta", "gama", "delta"};
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQ(bloom_filter_add(bf, &words[i]), DS_SUCCESS);
+    }
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(bloom_filter_contains(bf, &words[i]));
+    }
+    bloom_filter_destroy(bf);
+    ds_arena_destroy(arena);
+}
+
+// ============================================================================
+// TESTES: CUCKOO FILTER
+// ============================================================================
+
+TEST(cuckoo_add_contains_remove) {
+    const int N = 10000;
+    CuckooFilter *cf = cuckoo_filter_create((size_t)N, hash_int);
+    ASSERT_NOT_NULL(cf);
+    ASSERT_TRUE(cuckoo_filter_capacity(cf) >= (size_t)N);
+
+    for (int i = 0; i < N; i++) {
+        int key = i * 7;
+        ASSERT_EQ(cuckoo_filter_add(cf, &key), DS_SUCCESS);
+    }
+    ASSERT_EQ(cuckoo_filter_size(cf), (size_t)N);
+    for (int i = 0; i < N; i++) {
+        int key = i * 7;
+        ASSERT_TRUE(cuckoo_filter_contains(cf, &key));
+    }
+
+    // Remove as chaves pares; as ímpares continuam presentes
+    for (int i = 0; i < N; i += 2) {
+        int key = i * 7;
+        ASSERT_EQ(cuckoo_filter_remove(cf, &key), DS_SUCCESS);
+    }
+    ASSERT_EQ(cuckoo_filter_size(cf), (size_t)(N / 2));
+    int still_present = 0;
+    for (int i = 0; i < N; i++) {
+        int key = i * 7;
+        if (i % 2 == 1) {
+            ASSERT_TRUE(cuckoo_filter_contains(cf, &key));
+        } else if (cuckoo_filter_contains(cf, &key)) {
+            still_present++;
+        }
+    }
+    // Só falsos positivos (fingerprint de 16 bits) podem sobrar
+    ASSERT_TRUE(still_present < 10);
+
+    int absent = -1;
+    ASSERT_EQ(cuckoo_filter_remove(cf, &absent), DS_ERROR_NOT_FOUND);
+    cuckoo_filter_clear(cf);
+    ASSERT_EQ(cuckoo_filter_size(cf), 0);
+    cuckoo_filter_destroy(cf);
+}
+
+TEST(cuckoo_duplicates_and_fpr) {
+    CuckooFilter *cf = cuckoo_filter_create(50000, hash_int);
+    int dup = 42;
+    ASSERT_EQ(cuckoo_filter_add(cf, &dup), DS_SUCCESS);
+    ASSERT_EQ(cuckoo_filter_add(cf, &dup), DS_SUCCESS);
+    ASSERT_EQ(cuckoo_filter_remove(cf, &dup), DS_SUCCESS);
+    ASSERT_TRUE(cuckoo_filter_contains(cf, &dup));
+    ASSERT_EQ(cuckoo_filter_remove(cf, &dup), DS_SUCCESS);
+    ASSERT_FALSE(cuckoo_filter_contains(cf, &dup));
+
+    for (int i = 0; i < 50000; i++) {
+        int key = i;
+        ASSERT_EQ(cuckoo_filter_add(cf, &key), DS_SUCCESS);
+    }
+    int false_positives = 0;
+    for (int i = 50000; i < 250000; i++) {
+        int key = i;
+        if (cuckoo_filter_contains(cf, &key)) {
+            false_positives++;
+        }
+    }
+    // Esperado ~2·4/2^16 · load ≈ 0.01%: 200000 consultas dão ~20
+    ASSERT_TRUE(false_positives < 100);
+    cuckoo_filter_destroy(cf);
+}
+
+TEST(cuckoo_fills_up_without_losing_keys) {
+    // Insere até o filtro recusar: todas as chaves aceitas seguem presentes
+    CuckooFilter *cf = cuckoo_filter_create(1000, hash_int);
+    size_t slots = cuckoo_filter_capacity(cf);
+    int accepted = 0;
+    for (int i = 0; i < (int)(2 * slots); i++) {
+        int key = i;
+        if (cuckoo_filter_add(cf, &key) != DS_SUCCESS) {
+            break;
+        }
+        accepted++;
+    }
+    ASSERT_TRUE(accepted < (int)(2 * slots));
+    ASSERT_TRUE(cuckoo_filter_load_factor(cf) > 0.9);
+    for (int i = 0; i < accepted; i++) {
+        int key = i;
+        ASSERT_TRUE(cuckoo_filter_contains(cf, &key));
+    }
+
+    // Uma remoção libera espaço de novo
+    int first = 0;
+    ASSERT_EQ(cuckoo_filter_remove(cf, &first), DS_SUCCESS);
+    for (int i = 1; i < accepted; i++) {
+        int key = i;
+        ASSERT_TRUE(cuckoo_filter_contains(cf, &key));
+    }
+    ASSERT_EQ(cuckoo_filter_add(cf, &first), DS_SUCCESS);
+    ASSERT_EQ(cuckoo_filter_size(cf), (size_t)accepted);
+    cuckoo_filter_destroy(cf);
+}
+
+TEST(filters_invalid_arguments) {
+    int key = 1;
+    ASSERT_NULL(bloom_filter_create(0, 10, hash_int));
+    ASSERT_NULL(bloom_filter_create(10, 0, hash_int));
+    ASSERT_NULL(bloom_filter_create(10, 10, NULL));
+    ASSERT_EQ(bloom_filter_add(NULL, &key), DS_ERROR_NULL_POINTER);
+    ASSERT_FALSE(bloom_filter_contains(NULL, &key));
+    ASSERT_EQ(bloom_filter_size_bytes(NULL), 0);
+    bloom_filter_destroy(NULL);
+
+    ASSERT_NULL(cuckoo_filter_create(0, hash_int));
+    ASSERT_NULL(cuckoo_filter_create(10, NULL));
+    ASSERT_EQ(cuckoo_filter_add(NULL, &key), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(cuckoo_filter_remove(NULL, &key), DS_ERROR_NULL_POINTER);
+    ASSERT_FALSE(cuckoo_filter_contains(NULL, &key));
+    ASSERT_EQ(cuckoo_filter_size(NULL), 0);
+    cuckoo_filter_destroy(NULL);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Membership Filter Tests ===\n");
+
+    printf("\nBloom em blocos:\n");
+    RUN_TEST(bloom_no_false_negatives);
+    RUN_TEST(bloom_false_positive_rate);
+    RUN_TEST(bloom_string_keys_and_allocator);
+
+    printf("\nCuckoo filter:\n");
+    RUN_TEST(cuckoo_add_contains_remove);
+    RUN_TEST(cuckoo_duplicates_and_fpr);
+    RUN_TEST(cuckoo_fills_up_without_losing_keys);
+
+    RUN_TEST(filters_invalid_arguments);
+
+    printf("\nAll membership filter tests passed!\n");
+    return 0;
+}
@@ -14,8 +14,11 @@
 #include "data_structures/common.h"
 #include "../test_macros.h"
 
+#include <stdio.h>
 #include <string.h>
 
+#define GRAPH_PATH "test_graph.csr"
+
 // ============================================================================
 // HELPERS
 // ============================================================================
@@ -470,6 +473,545 @@ TEST(matrix_full) {
     graph_destroy(g);
 }
 
+TEST(neighbor_iterator) {
+    Graph *g = create_sample_undirected_list();
+
+    for (Vertex v = 0; v < 5; v++) {
+        Vertex *expected = NULL;
+        size_t expected_count = 0;
+        graph_neighbors(g, v, &expected, &expected_count);
+
+        GraphNeighborIter it;
+        Vertex w;
+        double weight;
+        size_t count = 0;
+        ASSERT_EQ(graph_neighbor_iter_begin(g, v, &it), DS_SUCCESS);
+        while (graph_neighbor_iter_next(&it, &w, &weight)) {
+            ASSERT_TRUE(count < expected_count);
+            ASSERT_EQ(w, expected[count]);
+            ASSERT_TRUE(weight > 0.99 && weight < 1.01);
+            count++;
+        }
+        ASSERT_EQ(count, expected_count);
+        free(expected);
+    }
+
+    GraphNeighborIter it;
+    ASSERT_EQ(graph_neighbor_iter_begin(g, 42, &it), DS_ERROR_INVALID_INDEX);
+    ASSERT_FALSE(graph_neighbor_iter_next(&it, NULL, NULL));
+
+    graph_destroy(g);
+}
+
+TEST(neighbor_iterator_matrix) {
+    Graph *g = graph_create(4, GRAPH_DIRECTED, GRAPH_ADJACENCY_MATRIX, true);
+    graph_add_edge(g, 1, 0, 2.5);
+    graph_add_edge(g, 1, 3, 4.0);
+
+    GraphNeighborIter it;
+    Vertex w;
+    double weight;
+    graph_neighbor_iter_begin(g, 1, &it);
+    ASSERT_TRUE(graph_neighbor_iter_next(&it, &w, &weight));
+    ASSERT_EQ(w, 0);
+    ASSERT_TRUE(weight > 2.4 && weight < 2.6);
+    ASSERT_TRUE(graph_neighbor_iter_next(&it, &w, &weight));
+    ASSERT_EQ(w, 3);
+    ASSERT_FALSE(graph_neighbor_iter_next(&it, &w, &weight));
+
+    graph_neighbor_iter_begin(g, 2, &it);
+    ASSERT_FALSE(graph_neighbor_iter_next(&it, &w, NULL));
+
+    graph_destroy(g);
+}
+
+// ============================================================================
+// TESTES - SNAPSHOT CSR
+// ============================================================================
+
+TEST(csr_freeze) {
+    Graph *g = create_sample_undirected_list();
+    CSRGraph *csr = graph_freeze(g);
+    ASSERT_NOT_NULL(csr);
+    ASSERT_EQ(graph_csr_num_vertices(csr), 5);
+    ASSERT_EQ(graph_csr_num_edges(csr), graph_num_edges(g));
+    ASSERT_FALSE(graph_csr_is_directed(csr));
+
+    for (Vertex v = 0; v < 5; v++) {
+        ASSERT_EQ(graph_csr_out_degree(csr, v), graph_out_degree(g, v));
+
+        Vertex *expected = NULL;
+        size_t expected_count = 0;
+        graph_neighbors(g, v, &expected, &expected_count);
+
+        const Vertex *dests = NULL;
+        const double *weights = NULL;
+        size_t count = 0;
+        ASSERT_EQ(graph_csr_neighbors(csr, v, &dests, &weights, &count), DS_SUCCESS);
+        ASSERT_EQ(count, expected_count);
+        for (size_t i = 0; i < count; i++) {
+            ASSERT_EQ(dests[i], expected[i]);
+            ASSERT_TRUE(weights[i] > 0.99 && weights[i] < 1.01);
+        }
+        free(expected);
+    }
+
+    const Vertex *dests = NULL;
+    size_t count = 0;
+    ASSERT_EQ(graph_csr_neighbors(csr, 9, &dests, NULL, &count), DS_ERROR_INVALID_INDEX);
+
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+TEST(csr_traversals_match_graph) {
+    Graph *g = create_sample_directed_list();
+    graph_add_edge(g, 3, 4, 1.0);
+    CSRGraph *csr = graph_freeze(g);
+    ASSERT_NOT_NULL(csr);
+    ASSERT_TRUE(graph_csr_is_directed(csr));
+
+    Vertex buf_g[6], buf_c[6];
+    VisitData dg = { buf_g, 0 };
+    VisitData dc = { buf_c, 0 };
+    graph_bfs(g, 0, collect_vertex, &dg);
+    graph_csr_bfs(csr, 0, collect_vertex, &dc);
+    ASSERT_EQ(dg.count, dc.count);
+    ASSERT_EQ(memcmp(buf_g, buf_c, dg.count * sizeof(Vertex)), 0);
+
+    dg.count = 0;
+    dc.count = 0;
+    graph_dfs(g, 0, collect_vertex, &dg);
+    graph_csr_dfs(csr, 0, collect_vertex, &dc);
+    ASSERT_EQ(dg.count, 6);
+    ASSERT_EQ(dg.count, dc.count);
+    ASSERT_EQ(memcmp(buf_g, buf_c, dg.count * sizeof(Vertex)), 0);
+
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+TEST(csr_from_matrix) {
+    Graph *g = graph_create(3, GRAPH_DIRECTED, GRAPH_ADJACENCY_MATRIX, true);
+    graph_add_edge(g, 0, 2, 7.0);
+    graph_add_edge(g, 1, 0, 3.0);
+
+    CSRGraph *csr = graph_freeze(g);
+    ASSERT_NOT_NULL(csr);
+    const Vertex *dests = NULL;
+    const double *weights = NULL;
+    size_t count = 0;
+    graph_csr_neighbors(csr, 0, &dests, &weights, &count);
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(dests[0], 2);
+    ASSERT_TRUE(weights[0] > 6.9 && weights[0] < 7.1);
+    ASSERT_EQ(graph_csr_out_degree(csr, 2), 0);
+
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+// Mesma particao: a bijecao entre rotulos vale nos dois sentidos
+static bool same_partition(const size_t *a, const size_t *b, size_t n, size_t k) {
+    size_t *ab = malloc(k * sizeof(size_t));
+    size_t *ba = malloc(k * sizeof(size_t));
+    bool ok = ab != NULL && ba != NULL;
+    for (size_t i = 0; ok && i < k; i++) ab[i] = ba[i] = (size_t)-1;
+    for (size_t v = 0; ok && v < n; v++) {
+        if (a[v] >= k || b[v] >= k) ok = false;
+        else if (ab[a[v]] == (size_t)-1 && ba[b[v]] == (size_t)-1) { ab[a[v]] = b[v]; ba[b[v]] = a[v]; }
+        else if (ab[a[v]] != b[v] || ba[b[v]] != a[v]) ok = false;
+    }
+    free(ab);
+    free(ba);
+    return ok;
+}
+
+TEST(csr_topological_sort_and_scc) {
+    unsigned state = 72u;
+    size_t n = 3000;
+    Graph *g = graph_create(n, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, false);
+    Graph *dag = graph_create(n, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, false);
+    for (size_t e = 0; e < 4500; e++) {
+        state = state * 1103515245u + 12345u;
+        size_t u = (state >> 8) % n;
+        state = state * 1103515245u + 12345u;
+        size_t v = (state >> 8) % n;
+        graph_add_edge(g, u, v, 1.0);
+        if (u < v) graph_add_edge(dag, u, v, 1.0);
+    }
+
+    CSRGraph *csr = graph_freeze(g);
+    size_t *tarjan = NULL, *kosaraju = NULL, kt = 0, kk = 0;
+    ASSERT_EQ(graph_csr_strongly_connected_components(csr, &tarjan, &kt), DS_SUCCESS);
+    ASSERT_EQ(graph_strongly_connected_components(g, &kosaraju, &kk), DS_SUCCESS);
+    ASSERT_EQ(kt, kk);
+    ASSERT_TRUE(kt > 1 && kt < n);
+    ASSERT_TRUE(same_partition(tarjan, kosaraju, n, kt));
+    // Tarjan numera em ordem topologica reversa: arcos nunca sobem de rotulo
+    for (Vertex u = 0; u < n; u++) {
+        const Vertex *dests;
+        size_t count;
+        graph_csr_neighbors(csr, u, &dests, NULL, &count);
+        for (size_t i = 0; i < count; i++) ASSERT_TRUE(tarjan[dests[i]] <= tarjan[u]);
+    }
+    Vertex *order = NULL;
+    size_t size = 0;
+    ASSERT_EQ(graph_csr_topological_sort(csr, &order, &size), DS_ERROR_INVALID_PARAM);
+    free(tarjan);
+    free(kosaraju);
+    graph_csr_destroy(csr);
+
+    csr = graph_freeze(dag);
+    ASSERT_EQ(graph_csr_topological_sort(csr, &order, &size), DS_SUCCESS);
+    ASSERT_EQ(size, n);
+    size_t *pos = malloc(n * sizeof(size_t));
+    for (size_t i = 0; i < n; i++) pos[order[i]] = i;
+    for (Vertex u = 0; u < n; u++) {
+        const Vertex *dests;
+        size_t count;
+        graph_csr_neighbors(csr, u, &dests, NULL, &count);
+        for (size_t i = 0; i < count; i++) ASSERT_TRUE(pos[u] < pos[dests[i]]);
+    }
+    free(pos);
+    free(order);
+    graph_csr_destroy(csr);
+
+    Graph *ug = create_sample_undirected_list();
+    CSRGraph *undirected = graph_freeze(ug);
+    ASSERT_EQ(graph_csr_topological_sort(undirected, &order, &size), DS_ERROR_INVALID_PARAM);
+    ASSERT_EQ(graph_csr_topological_sort(NULL, &order, &size), DS_ERROR_NULL_POINTER);
+    graph_csr_destroy(undirected);
+    graph_destroy(ug);
+    graph_destroy(g);
+    graph_destroy(dag);
+}
+
+TEST(deep_graphs_without_recursion) {
+    // Caminho de 500k vertices fechado em ciclo: a DFS recursiva estourava a pilha
+    size_t n = 500000;
+    Graph *g = graph_create(n, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, false);
+    ASSERT_NOT_NULL(g);
+    for (size_t v = 0; v + 1 < n; v++) graph_add_edge(g, v, v + 1, 1.0);
+
+    Vertex *order = NULL;
+    size_t size = 0;
+    ASSERT_FALSE(graph_has_cycle(g));
+    ASSERT_EQ(graph_topological_sort(g, &order, &size), DS_SUCCESS);
+    for (size_t i = 0; i < n; i++) ASSERT_EQ(order[i], i);
+    free(order);
+    CSRGraph *csr = graph_freeze(g);
+    ASSERT_EQ(graph_csr_topological_sort(csr, &order, &size), DS_SUCCESS);
+    ASSERT_EQ(order[n - 1], n - 1);
+    free(order);
+    graph_csr_destroy(csr);
+
+    graph_add_edge(g, n - 1, 0, 1.0);
+    ASSERT_TRUE(graph_has_cycle(g));
+    size_t *components = NULL, k = 0;
+    ASSERT_EQ(graph_strongly_connected_components(g, &components, &k), DS_SUCCESS);
+    ASSERT_EQ(k, 1);
+    free(components);
+    csr = graph_freeze(g);
+    ASSERT_EQ(graph_csr_strongly_connected_components(csr, &components, &k), DS_SUCCESS);
+    ASSERT_EQ(k, 1);
+    ASSERT_EQ(components[n / 2], 0);
+    free(components);
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+// ============================================================================
+// SERIALIZACAO CSR
+// ============================================================================
+
+static bool csr_equal(const CSRGraph *a, const CSRGraph *b) {
+    if (graph_csr_num_vertices(a) != graph_csr_num_vertices(b) ||
+        graph_csr_num_edges(a) != graph_csr_num_edges(b) ||
+        graph_csr_is_directed(a) != graph_csr_is_directed(b)) return false;
+    for (Vertex v = 0; v < graph_csr_num_vertices(a); v++) {
+        const Vertex *da, *db;
+        const double *wa, *wb;
+        size_t ca, cb;
+        graph_csr_neighbors(a, v, &da, &wa, &ca);
+        graph_csr_neighbors(b, v, &db, &wb, &cb);
+        if (ca != cb) return false;
+        for (size_t i = 0; i < ca; i++) {
+            if (da[i] != db[i] || wa[i] != wb[i]) return false;
+        }
+    }
+    return true;
+}
+
+TEST(csr_save_and_mmap_roundtrip) {
+    Graph *g = graph_create(300, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, true);
+    ASSERT_NOT_NULL(g);
+    for (size_t u = 0; u < 300; u++) {
+        graph_add_edge(g, u, (u * 7 + 1) % 300, (double)u + 0.5);
+        graph_add_edge(g, u, (u * 13 + 5) % 300, -(double)u);
+    }
+    graph_add_vertex(g);  // vertice isolado no fim
+    CSRGraph *csr = graph_freeze(g);
+    ASSERT_NOT_NULL(csr);
+    ASSERT_TRUE(graph_save(g, GRAPH_PATH));
+
+    CSRGraph *mapped = graph_mmap_open(GRAPH_PATH);
+    ASSERT_NOT_NULL(mapped);
+    ASSERT_TRUE(csr_equal(mapped, csr));
+    size_t *components = NULL, k = 0, expected_k = 0, *expected = NULL;
+    ASSERT_EQ(graph_csr_strongly_connected_components(mapped, &components, &k), DS_SUCCESS);
+    ASSERT_EQ(graph_csr_strongly_connected_components(csr, &expected, &expected_k), DS_SUCCESS);
+    ASSERT_EQ(k, expected_k);
+    free(components);
+    free(expected);
+    graph_csr_destroy(mapped);
+
+    // Arquivo inteiro em memoria: mesmo formato, sem copia
+    FILE *f = fopen(GRAPH_PATH, "rb");
+    ASSERT_NOT_NULL(f);
+    fseek(f, 0, SEEK_END);
+    size_t size = (size_t)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    uint64_t *buffer = malloc(size);
+    ASSERT_NOT_NULL(buffer);
+    ASSERT_EQ(fread(buffer, 1, size, f), size);
+    fclose(f);
+    CSRGraph *view = graph_csr_from_buffer(buffer, size);
+    ASSERT_NOT_NULL(view);
+    ASSERT_TRUE(csr_equal(view, csr));
+    const Vertex *dests;
+    size_t count;
+    graph_csr_neighbors(view, 0, &dests, NULL, &count);
+    ASSERT_TRUE((const void*)dests > (const void*)buffer &&
+                (const void*)dests < (const void*)((char*)buffer + size));
+    graph_csr_destroy(view);
+
+    // Tamanho, magic e ordem de bytes errados sao recusados
+    ASSERT_NULL(graph_csr_from_buffer(buffer, size - 8));
+    ASSERT_NULL(graph_csr_from_buffer((char*)buffer + 4, size - 4));
+    uint32_t order = ((uint32_t*)buffer)[3];
+    ((uint32_t*)buffer)[3] = 0x04030201u;
+    ASSERT_NULL(graph_csr_from_buffer(buffer, size));
+    ((uint32_t*)buffer)[3] = order;
+    ((char*)buffer)[0] = 'X';
+    ASSERT_NULL(graph_csr_from_buffer(buffer, size));
+    free(buffer);
+
+    ASSERT_NULL(graph_mmap_open("missing_graph.csr"));
+    ASSERT_FALSE(graph_csr_save(NULL, GRAPH_PATH));
+
+    // Grafo vazio e nao-direcionado, em arquivo
+    Graph *empty = graph_create(0, GRAPH_UNDIRECTED, GRAPH_ADJACENCY_MATRIX, false);
+    ASSERT_TRUE(graph_save(empty, GRAPH_PATH));
+    mapped = graph_mmap_open(GRAPH_PATH);
+    ASSERT_NOT_NULL(mapped);
+    ASSERT_EQ(graph_csr_num_vertices(mapped), 0);
+    ASSERT_FALSE(graph_csr_is_directed(mapped));
+    graph_csr_destroy(mapped);
+    graph_destroy(empty);
+
+    remove(GRAPH_PATH);
+    graph_csr_destroy(csr);
+    graph_destroy(g);
+}
+
+// ============================================================================
+// BITSET
+// ============================================================================
+
+// Mesmo grafo aleatorio em bitset e em matriz de doubles
+static void fill_random_pair(Graph *a, Graph *b, size_t n, bool directed, unsigned seed) {
+    for (size_t u = 0; u < n; u++) {
+        for (size_t v = directed ? 0 : u; v < n; v++) {
+            seed = seed * 1103515245u + 12345u;
+            if ((seed >> 16) % 3 == 0) {
+                graph_add_edge(a, u, v, 1.0);
+                graph_add_edge(b, u, v, 1.0);
+            }
+        }
+    }
+}
+
+TEST(bitset_matches_matrix) {
+    const size_t n = 130;  // tres palavras por linha, a ultima parcial
+    GraphType types[] = {GRAPH_DIRECTED, GRAPH_UNDIRECTED};
+    for (size_t k = 0; k < 2; k++) {
+        Graph *bits = graph_create(n, types[k], GRAPH_ADJACENCY_BITSET, false);
+        Graph *mat = graph_create(n, types[k], GRAPH_ADJACENCY_MATRIX, false);
+        ASSERT_NOT_NULL(bits);
+        ASSERT_NOT_NULL(mat);
+        fill_random_pair(bits, mat, n, types[k] == GRAPH_DIRECTED, 42u + (unsigned)k);
+
+        // Repetir uma aresta nao conta de novo
+        if (!graph_has_edge(mat, 1, 2)) {
+            graph_add_edge(bits, 1, 2, 1.0);
+            graph_add_edge(mat, 1, 2, 1.0);
+        }
+        size_t edges = graph_num_edges(bits);
+        ASSERT_EQ(graph_add_edge(bits, 1, 2, 1.0), DS_SUCCESS);
+        ASSERT_EQ(graph_num_edges(bits), edges);
+        ASSERT_EQ(edges, graph_num_edges(mat));
+
+        for (size_t u = 0; u < n; u++) {
+            ASSERT_EQ(graph_out_degree(bits, u), graph_out_degree(mat, u));
+            ASSERT_EQ(graph_in_degree(bits, u), graph_in_degree(mat, u));
+            for (size_t v = 0; v < n; v++) {
+                ASSERT_EQ(graph_has_edge(bits, u, v), graph_has_edge(mat, u, v));
+                ASSERT_EQ(graph_edge_weight(bits, u, v), graph_edge_weight(mat, u, v));
+            }
+
+            Vertex *nb = NULL, *nm = NULL;
+            size_t cb = 0, cm = 0;
+            ASSERT_EQ(graph_neighbors(bits, u, &nb, &cb), DS_SUCCESS);
+            ASSERT_EQ(graph_neighbors(mat, u, &nm, &cm), DS_SUCCESS);
+            ASSERT_EQ(cb, cm);
+            for (size_t i = 0; i < cb; i++) ASSERT_EQ(nb[i], nm[i]);
+            free(nb);
+            free(nm);
+
+            size_t words = 0;
+            const uint64_t *row = graph_adjacency_bits(bits, u, &words);
+            ASSERT_NOT_NULL(row);
+            ASSERT_EQ(words, 3);
+            ASSERT_EQ((row[u / 64] >> (u % 64)) & 1u, graph_has_edge(bits, u, u) ? 1u : 0u);
+        }
+        ASSERT_NULL(graph_adjacency_bits(mat, 0, NULL));
+
+        Edge *eb = NULL, *em = NULL;
+        size_t cb = 0, cm = 0;
+        ASSERT_EQ(graph_edges(bits, &eb, &cb), DS_SUCCESS);
+        ASSERT_EQ(graph_edges(mat, &em, &cm), DS_SUCCESS);
+        ASSERT_EQ(cb, cm);
+        for (size_t i = 0; i < cb; i++) {
+            ASSERT_EQ(eb[i].src, em[i].src);
+            ASSERT_EQ(eb[i].dest, em[i].dest);
+        }
+        free(eb);
+        free(em);
+
+        ASSERT_EQ(graph_is_connected(bits), graph_is_connected(mat));
+        ASSERT_EQ(graph_is_strongly_connected(bits), graph_is_strongly_connected(mat));
+        ASSERT_EQ(graph_has_cycle(bits), graph_has_cycle(mat));
+
+        CSRGraph *cb_csr = graph_freeze(bits);
+        CSRGraph *cm_csr = graph_freeze(mat);
+        ASSERT_NOT_NULL(cb_csr);
+        ASSERT_EQ(graph_csr_num_edges(cb_csr), graph_csr_num_edges(cm_csr));
+        for (size_t u = 0; u < n; u++) ASSERT_EQ(graph_csr_out_degree(cb_csr, u), graph_csr_out_degree(cm_csr, u));
+        graph_csr_destroy(cb_csr);
+        graph_csr_destroy(cm_csr);
+
+        Graph *t = graph_transpose(bits);
+        Graph *c = graph_clone(bits);
+        ASSERT_NOT_NULL(t);
+        ASSERT_NOT_NULL(c);
+        for (size_t u = 0; u < n; u++) {
+            for (size_t v = 0; v < n; v++) {
+                ASSERT_EQ(graph_has_edge(t, v, u), graph_has_edge(bits, u, v));
+                ASSERT_EQ(graph_has_edge(c, u, v), graph_has_edge(bits, u, v));
+            }
+        }
+        ASSERT_EQ(graph_num_edges(t), graph_num_edges(bits));
+        graph_destroy(t);
+        graph_destroy(c);
+
+        graph_destroy(bits);
+        graph_destroy(mat);
+    }
+
+    ASSERT_NULL(graph_create(4, GRAPH_UNDIRECTED, GRAPH_ADJACENCY_BITSET, true));
+}
+
+TEST(bitset_bipartite_and_growth) {
+    // Bipartido completo K(70, 70): as duas metades cruzam a fronteira de palavra
+    Graph *g = graph_create(140, GRAPH_UNDIRECTED, GRAPH_ADJACENCY_BITSET, false);
+    ASSERT_NOT_NULL(g);
+    for (size_t u = 0; u < 70; u++)
+        for (size_t v = 70; v < 140; v++) graph_add_edge(g, u, v, 1.0);
+    ASSERT_EQ(graph_num_edges(g), 70 * 70);
+    ASSERT_TRUE(graph_is_bipartite(g));
+    ASSERT_TRUE(graph_is_connected(g));
+    ASSERT_EQ(graph_out_degree(g, 3), 70);
+    graph_add_edge(g, 0, 1, 1.0);
+    ASSERT_FALSE(graph_is_bipartite(g));
+    ASSERT_EQ(graph_remove_edge(g, 0, 1), DS_SUCCESS);
+    ASSERT_EQ(graph_remove_edge(g, 0, 1), DS_ERROR_NOT_FOUND);
+    ASSERT_TRUE(graph_is_bipartite(g));
+
+    ASSERT_EQ(graph_remove_vertex(g, 0), DS_SUCCESS);
+    ASSERT_EQ(graph_num_edges(g), 69 * 70);
+    ASSERT_EQ(graph_in_degree(g, 100), 69);
+    graph_destroy(g);
+
+    // Crescimento: linhas sao copiadas quando o numero de palavras muda
+    g = graph_create(1, GRAPH_DIRECTED, GRAPH_ADJACENCY_BITSET, false);
+    ASSERT_NOT_NULL(g);
+    for (size_t i = 1; i < 200; i++) {
+        ASSERT_EQ(graph_add_vertex(g), i);
+        graph_add_edge(g, i - 1, i, 1.0);
+    }
+    graph_add_edge(g, 5, 150, 1.0);
+    ASSERT_EQ(graph_num_edges(g), 200);
+    for (size_t i = 1; i < 200; i++) ASSERT_TRUE(graph_has_edge(g, i - 1, i));
+    ASSERT_TRUE(graph_has_edge(g, 5, 150));
+    ASSERT_EQ(graph_out_degree(g, 5), 2);
+    ASSERT_EQ(graph_num_connected_components(g), 1);
+
+    GraphNeighborIter it;
+    Vertex w;
+    double weight;
+    ASSERT_EQ(graph_neighbor_iter_begin(g, 5, &it), DS_SUCCESS);
+    ASSERT_TRUE(graph_neighbor_iter_next(&it, &w, &weight));
+    ASSERT_EQ(w, 6);
+    ASSERT_EQ(weight, 1.0);
+    ASSERT_TRUE(graph_neighbor_iter_next(&it, &w, NULL));
+    ASSERT_EQ(w, 150);
+    ASSERT_FALSE(graph_neighbor_iter_next(&it, &w, NULL));
+    graph_destroy(g);
+}
+
+TEST(memory_usage_by_representation) {
+    Graph *list = graph_create(64, GRAPH_DIRECTED, GRAPH_ADJACENCY_LIST, false);
+    Graph *matrix = graph_create(64, GRAPH_DIRECTED, GRAPH_ADJACENCY_MATRIX, false);
+    Graph *bits = graph_create(64, GRAPH_DIRECTED, GRAPH_ADJACENCY_BITSET, false);
+    ASSERT_NOT_NULL(list);
+    ASSERT_NOT_NULL(matrix);
+    ASSERT_NOT_NULL(bits);
+
+    size_t list_empty = graph_memory_usage(list);
+    size_t matrix_empty = graph_memory_usage(matrix);
+    size_t bits_empty = graph_memory_usage(bits);
+    // Matriz: V² doubles; bitset: V² bits
+    ASSERT_TRUE(matrix_empty >= 64 * 64 * sizeof(double));
+    ASSERT_TRUE(bits_empty < matrix_empty / 32);
+
+    for (size_t u = 0; u < 64; u++) {
+        for (size_t k = 1; k <= 4; k++) {
+            graph_add_edge(list, u, (u + k) % 64, 1.0);
+            graph_add_edge(matrix, u, (u + k) % 64, 1.0);
+            graph_add_edge(bits, u, (u + k) % 64, 1.0);
+        }
+    }
+    // Só a lista cresce com as arestas
+    ASSERT_TRUE(graph_memory_usage(list) > list_empty);
+    ASSERT_EQ(graph_memory_usage(matrix), matrix_empty);
+    ASSERT_EQ(graph_memory_usage(bits), bits_empty);
+
+    // CSR: arrays contíguos, sem ponteiro por aresta
+    CSRGraph *csr = graph_freeze(list);
+    ASSERT_NOT_NULL(csr);
+    ASSERT_EQ(graph_csr_num_edges(csr), 256);
+    ASSERT_TRUE(graph_csr_memory_usage(csr) > 256 * sizeof(Vertex));
+    ASSERT_TRUE(graph_csr_memory_usage(csr) < graph_memory_usage(list));
+
+    ASSERT_EQ(graph_memory_usage(NULL), 0);
+    ASSERT_EQ(graph_csr_memory_usage(NULL), 0);
+    graph_csr_destroy(csr);
+    graph_destroy(list);
+    graph_destroy(matrix);
+    graph_destroy(bits);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -501,6 +1043,17 @@ int main(void) {
     RUN_TEST(clone);
     RUN_TEST(transpose);
     RUN_TEST(matrix_full);
+    RUN_TEST(neighbor_iterator);
+    RUN_TEST(neighbor_iterator_matrix);
+    RUN_TEST(csr_freeze);
+    RUN_TEST(csr_traversals_match_graph);
+    RUN_TEST(csr_from_matrix);
+    RUN_TEST(csr_topological_sort_and_scc);
+    RUN_TEST(deep_graphs_without_recursion);
+    RUN_TEST(csr_save_and_mmap_roundtrip);
+    RUN_TEST(bitset_matches_matrix);
+    RUN_TEST(bitset_bipartite_and_growth);
+    RUN_TEST(memory_usage_by_representation);
 
     printf("\nAll Graph tests passed!\n");
     return 0;
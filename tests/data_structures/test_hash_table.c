@@ -14,11 +14,17 @@
  */
 
 #include "data_structures/hash_table.h"
+#include "data_structures/arena.h"
 #include "data_structures/common.h"
 #include "../test_macros.h"
 
+#include <stdlib.h>
 #include <string.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // ============================================================================
 // TESTES: CRIAÇÃO E DESTRUIÇÃO
 // ============================================================================
@@ -38,10 +44,11 @@ TEST(create_all_strategies) {
         HASH_CHAINING,
         HASH_LINEAR_PROBING,
         HASH_QUADRATIC_PROBING,
-        HASH_DOUBLE_HASHING
+        HASH_DOUBLE_HASHING,
+        HASH_FLAT
     };
 
-    for (int i = 0; i < 4; i++) {
+    for (int i = 0; i < 5; i++) {
         HashTable *ht = hashtable_create(sizeof(int), sizeof(int), 8,
                                           hash_int, compare_int,
                                           strategies[i], NULL, NULL);
@@ -597,6 +604,644 @@ TEST(null_pointer_checks) {
 // TESTE VISUAL
 // ============================================================================
 
+// ============================================================================
+// TESTES: HASH_FLAT (SLOTS INLINE)
+// ============================================================================
+
+TEST(chaining_arena_allocator) {
+    DSArena *arena = ds_arena_create(0);
+    DSAllocator alloc = ds_arena_allocator(arena);
+    HashTable *ht = hashtable_create_with_allocator(sizeof(int), sizeof(int), 8,
+                                                    hash_int, compare_int,
+                                                    HASH_CHAINING, NULL, NULL, &alloc);
+    ASSERT_NOT_NULL(ht);
+
+    for (int i = 0; i < 500; i++) {
+        int v = i * 2;
+        ASSERT_EQ(hashtable_put(ht, &i, &v), DS_SUCCESS);
+    }
+    for (int i = 0; i < 500; i += 3) {
+        ASSERT_EQ(hashtable_remove(ht, &i, NULL), DS_SUCCESS);
+    }
+    for (int i = 0; i < 500; i++) {
+        int out = -1;
+        DataStructureError err = hashtable_get(ht, &i, &out);
+        if (i % 3 == 0) {
+            ASSERT_EQ(err, DS_ERROR_NOT_FOUND);
+        } else {
+            ASSERT_EQ(err, DS_SUCCESS);
+            ASSERT_EQ(out, i * 2);
+        }
+    }
+
+    hashtable_destroy(ht);
+    ASSERT_EQ(ds_arena_bytes_used(arena), 0);
+    ds_arena_destroy(arena);
+}
+
+TEST(flat_put_get_remove) {
+    HashTable *ht = hashtable_create(sizeof(int), sizeof(long long), 4,
+                                      hash_int, compare_int,
+                                      HASH_FLAT, NULL, NULL);
+    ASSERT_NOT_NULL(ht);
+    ASSERT_EQ(hashtable_capacity(ht), 16);
+
+    for (int i = 0; i < 1000; i++) {
+        long long v = (long long)i * 3;
+        ASSERT_EQ(hashtable_put(ht, &i, &v), DS_SUCCESS);
+    }
+    ASSERT_EQ(hashtable_size(ht), 1000);
+    ASSERT_TRUE(hashtable_load_factor(ht) <= 0.875);
+
+    for (int i = 0; i < 1000; i++) {
+        long long v = 0;
+        ASSERT_EQ(hashtable_get(ht, &i, &v), DS_SUCCESS);
+        ASSERT_EQ(v, (long long)i * 3);
+    }
+
+    for (int i = 0; i < 1000; i += 2) {
+        ASSERT_EQ(hashtable_remove(ht, &i, NULL), DS_SUCCESS);
+    }
+    ASSERT_EQ(hashtable_size(ht), 500);
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(hashtable_contains(ht, &i), i % 2 == 1);
+    }
+
+    int missing = 5000;
+    ASSERT_EQ(hashtable_get(ht, &missing, NULL), DS_ERROR_NOT_FOUND);
+    ASSERT_EQ(hashtable_remove(ht, &missing, NULL), DS_ERROR_NOT_FOUND);
+
+    hashtable_destroy(ht);
+}
+
+TEST(flat_update_and_ptr_alignment) {
+    HashTable *ht = hashtable_create(sizeof(int), sizeof(double), 16,
+                                      hash_int, compare_int,
+                                      HASH_FLAT, NULL, NULL);
+    ASSERT_NOT_NULL(ht);
+
+    int key = 7;
+    double v1 = 1.5, v2 = 2.5;
+    hashtable_put(ht, &key, &v1);
+    hashtable_put(ht, &key, &v2);
+    ASSERT_EQ(hashtable_size(ht), 1);
+
+    double *ptr = (double*)hashtable_get_ptr(ht, &key);
+    ASSERT_NOT_NULL(ptr);
+    ASSERT_EQ(((size_t)ptr) % _Alignof(double), 0);
+    ASSERT_NEAR(*ptr, 2.5, 1e-12);
+
+    hashtable_destroy(ht);
+}
+
+TEST(flat_tombstone_churn) {
+    HashTable *ht = hashtable_create(sizeof(int), sizeof(int), 16,
+                                      hash_int, compare_int,
+                                      HASH_FLAT, NULL, NULL);
+
+    // Inserções/remoções alternadas não devem esgotar slots EMPTY
+    for (int round = 0; round < 200; round++) {
+        for (int k = 0; k < 10; k++) {
+            int key = round * 10 + k;
+            hashtable_put(ht, &key, &key);
+        }
+        for (int k = 0; k < 10; k++) {
+            int key = round * 10 + k;
+            ASSERT_EQ(hashtable_remove(ht, &key, NULL), DS_SUCCESS);
+        }
+    }
+    ASSERT_TRUE(hashtable_is_empty(ht));
+    ASSERT_TRUE(hashtable_capacity(ht) <= 64);
+
+    int key = 42;
+    ASSERT_FALSE(hashtable_contains(ht, &key));
+
+    hashtable_destroy(ht);
+}
+
+TEST(flat_iterator_keys_values) {
+    HashTable *ht = hashtable_create(sizeof(int), sizeof(int), 16,
+                                      hash_int, compare_int,
+                                      HASH_FLAT, NULL, NULL);
+    int sum_expected = 0;
+    for (int i = 1; i <= 50; i++) {
+        int v = i * 10;
+        hashtable_put(ht, &i, &v);
+        sum_expected += i;
+    }
+
+    int sum = 0, count = 0;
+    HashTableIterator *it = hashtable_iterator(ht);
+    while (hashtable_iterator_has_next(it)) {
+        HashTableEntry *entry = hashtable_iterator_next(it);
+        ASSERT_EQ(*(int*)entry->value, *(int*)entry->key * 10);
+        sum += *(int*)entry->key;
+        count++;
+    }
+    hashtable_iterator_destroy(it);
+    ASSERT_EQ(count, 50);
+    ASSERT_EQ(sum, sum_expected);
+
+    void *keys = NULL;
+    size_t n = 0;
+    ASSERT_EQ(hashtable_keys(ht, &keys, &n), DS_SUCCESS);
+    ASSERT_EQ(n, 50);
+    free(keys);
+
+    HashTableStats stats = hashtable_stats(ht);
+    ASSERT_EQ(stats.size, 50);
+    ASSERT_EQ(stats.empty_buckets, hashtable_capacity(ht) - 50);
+
+    ASSERT_EQ(hashtable_rehash(ht, 1024), DS_SUCCESS);
+    ASSERT_EQ(hashtable_capacity(ht), 1024);
+    for (int i = 1; i <= 50; i++) {
+        ASSERT_TRUE(hashtable_contains(ht, &i));
+    }
+
+    hashtable_clear(ht);
+    ASSERT_TRUE(hashtable_is_empty(ht));
+
+    hashtable_destroy(ht);
+}
+
+// ============================================================================
+// TESTES: REHASH INCREMENTAL
+// ============================================================================
+
+TEST(incremental_rehash_chaining) {
+    HashTable *ht = hashtable_create(sizeof(int), sizeof(int), 17,
+                                      hash_int, compare_int,
+                                      HASH_CHAINING, NULL, NULL);
+    ASSERT_EQ(hashtable_set_incremental_rehash(ht, 1), DS_SUCCESS);
+
+    bool saw_rehashing = false;
+    for (int i = 0; i < 2000; i++) {
+        int v = i * 3;
+        ASSERT_EQ(hashtable_put(ht, &i, &v), DS_SUCCESS);
+
+        if (hashtable_is_rehashing(ht)) {
+            saw_rehashing = true;
+            // Durante a migração todas as chaves seguem visíveis
+            for (int k = 0; k <= i; k += 97) {
+                int out;
+                ASSERT_EQ(hashtable_get(ht, &k, &out), DS_SUCCESS);
+                ASSERT_EQ(out, k * 3);
+            }
+        }
+        if (i % 5 == 0 && i > 0) {
+            int gone = i - 1;
+            ASSERT_EQ(hashtable_remove(ht, &gone, NULL), DS_SUCCESS);
+            ASSERT_FALSE(hashtable_contains(ht, &gone));
+            hashtable_put(ht, &gone, &(int){gone * 3});
+        }
+    }
+    ASSERT_TRUE(saw_rehashing);
+    ASSERT_EQ(hashtable_size(ht), 2000);
+
+    // Atualização de chave que pode estar no array antigo
+    int k = 5, v = -1;
+    ASSERT_EQ(hashtable_put(ht, &k, &v), DS_SUCCESS);
+    ASSERT_EQ(*(int*)hashtable_get_ptr(ht, &k), -1);
+    ASSERT_EQ(hashtable_size(ht), 2000);
+
+    // Iterador e keys enxergam os dois arrays
+    size_t count = 0;
+    HashTableIterator *it = hashtable_iterator(ht);
+    while (hashtable_iterator_has_next(it)) {
+        ASSERT_NOT_NULL(hashtable_iterator_next(it));
+        count++;
+    }
+    hashtable_iterator_destroy(it);
+    ASSERT_EQ(count, 2000);
+
+    void *keys = NULL;
+    size_t n = 0;
+    ASSERT_EQ(hashtable_keys(ht, &keys, &n), DS_SUCCESS);
+    ASSERT_EQ(n, 2000);
+    free(keys);
+
+    while (hashtable_rehash_step(ht, 4)) {
+    }
+    ASSERT_FALSE(hashtable_is_rehashing(ht));
+    for (int i = 0; i < 2000; i++) {
+        ASSERT_TRUE(hashtable_contains(ht, &i));
+    }
+
+    hashtable_destroy(ht);
+}
+
+static int destroyed_values = 0;
+
+static void count_value_destroy(void *value) {
+    (void)value;
+    destroyed_values++;
+}
+
+TEST(incremental_rehash_controls) {
+    HashTable *flat = hashtable_create(sizeof(int), sizeof(int), 16,
+                                        hash_int, compare_int,
+                                        HASH_FLAT, NULL, NULL);
+    ASSERT_EQ(hashtable_set_incremental_rehash(flat, 1), DS_ERROR_INVALID_PARAM);
+    ASSERT_EQ(hashtable_set_incremental_rehash(flat, 0), DS_SUCCESS);
+    ASSERT_FALSE(hashtable_rehash_step(flat, 1));
+    hashtable_destroy(flat);
+    ASSERT_EQ(hashtable_set_incremental_rehash(NULL, 1), DS_ERROR_NULL_POINTER);
+    ASSERT_FALSE(hashtable_is_rehashing(NULL));
+
+    HashTable *ht = hashtable_create(sizeof(int), sizeof(int), 17,
+                                      hash_int, compare_int,
+                                      HASH_CHAINING, NULL, count_value_destroy);
+    hashtable_set_incremental_rehash(ht, 1);
+
+    int i = 0;
+    while (!hashtable_is_rehashing(ht)) {
+        hashtable_put(ht, &i, &i);
+        i++;
+    }
+
+    // Desativar conclui a migração em andamento
+    ASSERT_EQ(hashtable_set_incremental_rehash(ht, 0), DS_SUCCESS);
+    ASSERT_FALSE(hashtable_is_rehashing(ht));
+
+    hashtable_set_incremental_rehash(ht, 1);
+    while (!hashtable_is_rehashing(ht)) {
+        hashtable_put(ht, &i, &i);
+        i++;
+    }
+
+    // Rehash explícito também conclui antes
+    ASSERT_EQ(hashtable_rehash(ht, 4099), DS_SUCCESS);
+    ASSERT_FALSE(hashtable_is_rehashing(ht));
+    for (int k = 0; k < i; k++) {
+        ASSERT_TRUE(hashtable_contains(ht, &k));
+    }
+
+    while (!hashtable_is_rehashing(ht)) {
+        hashtable_put(ht, &i, &i);
+        i++;
+    }
+
+    // clear no meio da migração destrói tudo exatamente uma vez
+    destroyed_values = 0;
+    hashtable_clear(ht);
+    ASSERT_EQ(destroyed_values, i);
+    ASSERT_FALSE(hashtable_is_rehashing(ht));
+    ASSERT_TRUE(hashtable_is_empty(ht));
+
+    hashtable_destroy(ht);
+}
+
+// ============================================================================
+// TESTES: TABELA CONCORRENTE
+// ============================================================================
+
+TEST(concurrent_table_sequential) {
+    ASSERT_NULL(cht_create(0, sizeof(int), 8, hash_int, compare_int, NULL, NULL));
+    ASSERT_NULL(cht_create(sizeof(int), sizeof(int), 8, NULL, compare_int, NULL, NULL));
+
+    ConcurrentHashTable *ht = cht_create(sizeof(int), sizeof(int), 5,
+                                         hash_int, compare_int, NULL, NULL);
+    ASSERT_NOT_NULL(ht);
+    ASSERT_EQ(cht_num_segments(ht), 8);
+
+    for (int i = 0; i < 5000; i++) {
+        int v = i * 2;
+        ASSERT_EQ(cht_put(ht, &i, &v), DS_SUCCESS);
+    }
+    ASSERT_EQ(cht_size(ht), 5000);
+
+    int k = 77, v = -1, out;
+    ASSERT_EQ(cht_put(ht, &k, &v), DS_SUCCESS);
+    ASSERT_EQ(cht_size(ht), 5000);
+    ASSERT_EQ(cht_get(ht, &k, &out), DS_SUCCESS);
+    ASSERT_EQ(out, -1);
+
+    for (int i = 0; i < 5000; i += 2) {
+        ASSERT_EQ(cht_remove(ht, &i, NULL), DS_SUCCESS);
+    }
+    ASSERT_EQ(cht_size(ht), 2500);
+    for (int i = 0; i < 5000; i++) {
+        ASSERT_EQ(cht_contains(ht, &i), i % 2 == 1);
+    }
+    ASSERT_EQ(cht_remove(ht, &(int){0}, NULL), DS_ERROR_NOT_FOUND);
+    ASSERT_EQ(cht_get(NULL, &k, &out), DS_ERROR_NULL_POINTER);
+
+    cht_clear(ht);
+    ASSERT_EQ(cht_size(ht), 0);
+    ASSERT_FALSE(cht_contains(ht, &k));
+
+    // Um único segmento também funciona
+    ConcurrentHashTable *one = cht_create(sizeof(int), sizeof(int), 1,
+                                          hash_int, compare_int, NULL, NULL);
+    ASSERT_EQ(cht_num_segments(one), 1);
+    ASSERT_EQ(cht_put(one, &k, &k), DS_SUCCESS);
+    ASSERT_TRUE(cht_contains(one, &k));
+    cht_destroy(one);
+
+    cht_destroy(ht);
+}
+
+TEST(concurrent_table_threads) {
+#ifdef _OPENMP
+    // Cada thread escreve suas chaves, lê as de todas e remove metade
+    const int PER_THREAD = 20000;
+    ConcurrentHashTable *ht = cht_create(sizeof(int), sizeof(int), 16,
+                                         hash_int, compare_int, NULL, NULL);
+    ASSERT_NOT_NULL(ht);
+    int threads = 0;
+    _Atomic int bad_reads = 0;
+
+    #pragma omp parallel num_threads(4)
+    {
+        #pragma omp single
+        threads = omp_get_num_threads();
+        int id = omp_get_thread_num();
+        for (int i = 0; i < PER_THREAD; i++) {
+            int key = id * PER_THREAD + i;
+            int value = key * 3;
+            cht_put(ht, &key, &value);
+
+            int probe = (i * 7919) % (PER_THREAD * 4), out;
+            if (cht_get(ht, &probe, &out) == DS_SUCCESS && out != probe * 3) {
+                bad_reads++;
+            }
+        }
+        #pragma omp barrier
+        for (int i = 0; i < PER_THREAD; i += 2) {
+            int key = id * PER_THREAD + i;
+            cht_remove(ht, &key, NULL);
+        }
+    }
+
+    ASSERT_EQ(bad_reads, 0);
+    ASSERT_EQ(cht_size(ht), (size_t)(threads * PER_THREAD / 2));
+    for (int key = 0; key < threads * PER_THREAD; key++) {
+        int out;
+        if (key % 2 == 1) {
+            ASSERT_EQ(cht_get(ht, &key, &out), DS_SUCCESS);
+            ASSERT_EQ(out, key * 3);
+        } else {
+            ASSERT_FALSE(cht_contains(ht, &key));
+        }
+    }
+    cht_destroy(ht);
+#endif
+}
+
+// ============================================================================
+// TESTES: OPERAÇÕES EM LOTE
+// ============================================================================
+
+TEST(batch_put_get_all_strategies) {
+    const CollisionStrategy strategies[] = {
+        HASH_CHAINING, HASH_LINEAR_PROBING, HASH_QUADRATIC_PROBING,
+        HASH_DOUBLE_HASHING, HASH_FLAT
+    };
+    const size_t N = 3000;
+    int *keys = malloc(2 * N * sizeof(int));
+    int *values = malloc(2 * N * sizeof(int));
+    int *out = malloc(2 * N * sizeof(int));
+    bool *found = malloc(2 * N * sizeof(bool));
+    ASSERT_NOT_NULL(keys);
+    ASSERT_NOT_NULL(values);
+    ASSERT_NOT_NULL(out);
+    ASSERT_NOT_NULL(found);
+
+    for (size_t s = 0; s < sizeof(strategies) / sizeof(strategies[0]); s++) {
+        HashTable *ht = hashtable_create(sizeof(int), sizeof(int), 7,
+                                         hash_int, compare_int, strategies[s], NULL, NULL);
+        ASSERT_NOT_NULL(ht);
+
+        // Lote com chaves repetidas: a última ocorrência vence
+        for (size_t i = 0; i < N; i++) {
+            keys[i] = (int)(i * 2);
+            values[i] = (int)i;
+        }
+        keys[N - 1] = 0;
+        values[N - 1] = -1;
+        ASSERT_EQ(hashtable_put_batch(ht, keys, values, N), DS_SUCCESS);
+        ASSERT_EQ(hashtable_size(ht), N - 1);
+
+        // Consultas alternando chaves presentes (pares) e ausentes (ímpares)
+        for (size_t i = 0; i < 2 * N; i++) {
+            keys[i] = (int)i;
+            out[i] = 12345;
+        }
+        ASSERT_EQ(hashtable_get_batch(ht, keys, 2 * N, out, found), DS_ERROR_NOT_FOUND);
+        for (size_t i = 0; i < 2 * N; i++) {
+            bool present = (i % 2 == 0) && i < 2 * (N - 1);
+            ASSERT_EQ(found[i], present);
+            if (i == 0) {
+                ASSERT_EQ(out[i], -1);
+            } else if (present) {
+                ASSERT_EQ(out[i], (int)(i / 2));
+            } else {
+                ASSERT_EQ(out[i], 12345);
+            }
+        }
+
+        // Só chaves presentes; sem buffers de saída
+        for (size_t i = 0; i < N - 1; i++) {
+            keys[i] = (int)(i * 2);
+        }
+        ASSERT_EQ(hashtable_get_batch(ht, keys, N - 1, NULL, NULL), DS_SUCCESS);
+        ASSERT_EQ(hashtable_get_batch(ht, keys, 0, NULL, NULL), DS_SUCCESS);
+        hashtable_destroy(ht);
+    }
+
+    ASSERT_EQ(hashtable_get_batch(NULL, keys, 1, out, found), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(hashtable_put_batch(NULL, keys, values, 1), DS_ERROR_NULL_POINTER);
+    free(keys);
+    free(values);
+    free(out);
+    free(found);
+}
+
+TEST(batch_put_incremental_and_reserve) {
+    // Com rehash incremental o lote não força uma migração completa
+    HashTable *ht = hashtable_create(sizeof(int), sizeof(int), 16,
+                                     hash_int, compare_int, HASH_CHAINING, NULL, NULL);
+    ASSERT_EQ(hashtable_set_incremental_rehash(ht, 2), DS_SUCCESS);
+    int keys[500], values[500];
+    for (int i = 0; i < 500; i++) {
+        keys[i] = i;
+        values[i] = i * 5;
+    }
+    ASSERT_EQ(hashtable_put_batch(ht, keys, values, 500), DS_SUCCESS);
+    ASSERT_EQ(hashtable_size(ht), 500);
+    int out[500];
+    ASSERT_EQ(hashtable_get_batch(ht, keys, 500, out, NULL), DS_SUCCESS);
+    for (int i = 0; i < 500; i++) {
+        ASSERT_EQ(out[i], i * 5);
+    }
+    hashtable_destroy(ht);
+
+    // Sem rehash incremental a capacidade é reservada de uma vez
+    HashTable *flat = hashtable_create(sizeof(int), sizeof(int), 16,
+                                       hash_int, compare_int, HASH_FLAT, NULL, NULL);
+    ASSERT_EQ(hashtable_put_batch(flat, keys, values, 500), DS_SUCCESS);
+    ASSERT_TRUE(hashtable_capacity(flat) * 7 >= 500 * 8);
+    ASSERT_EQ(hashtable_get_batch(flat, keys, 500, out, NULL), DS_SUCCESS);
+    ASSERT_EQ(out[499], 499 * 5);
+    hashtable_destroy(flat);
+}
+
+// ============================================================================
+// TESTES: FUNÇÕES HASH COM SEMENTE
+// ============================================================================
+
+static size_t hash_wyhash_int(const void *data) {
+    return hash_wyhash(data, sizeof(int), 0);
+}
+
+TEST(wyhash_vectors_and_lengths) {
+    // Vetores de referência de wyhash final v4 (semente = índice)
+    ASSERT_TRUE(hash_wyhash("", 0, 0) == (size_t)0x93228a4de0eec5a2ULL);
+    ASSERT_TRUE(hash_wyhash("a", 1, 1) == (size_t)0xc5bac3db178713c4ULL);
+    ASSERT_TRUE(hash_wyhash("abc", 3, 2) == (size_t)0xa97f2f7b1d9b3314ULL);
+    ASSERT_TRUE(hash_wyhash("message digest", 14, 3) == (size_t)0x786d1f1df3801df4ULL);
+    ASSERT_TRUE(hash_wyhash("abcdefghijklmnopqrstuvwxyz", 26, 4) ==
+                (size_t)0xdca5a8138ad37c87ULL);
+    ASSERT_TRUE(hash_wyhash(NULL, 0, 0) == hash_wyhash("", 0, 0));
+
+    // Todos os caminhos (0-3, 4-16, 17-47, >= 48 bytes) independem do alinhamento
+    unsigned char buf[160];
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        buf[i] = (unsigned char)(i * 37 + 11);
+    }
+    for (size_t len = 0; len <= 128; len++) {
+        size_t h = hash_wyhash(buf, len, 42);
+        ASSERT_TRUE(hash_wyhash(buf, len, 42) == h);
+        unsigned char shifted[160];
+        memcpy(shifted + 3, buf, len);
+        ASSERT_TRUE(hash_wyhash(shifted + 3, len, 42) == h);
+        ASSERT_TRUE(hash_wyhash(buf, len, 43) != h);
+        if (len > 0) {
+            // Mudar o último byte altera o hash
+            buf[len - 1] ^= 1;
+            ASSERT_TRUE(hash_wyhash(buf, len, 42) != h);
+            buf[len - 1] ^= 1;
+        }
+    }
+}
+
+TEST(wyhash_string_seeded_table) {
+    uint64_t saved = hash_get_seed();
+    uint64_t seed = hash_random_seed();
+    ASSERT_TRUE(seed != hash_random_seed());
+
+    char *key = "chave";
+    hash_set_seed(1);
+    size_t h1 = hash_wyhash_string(&key);
+    hash_set_seed(2);
+    ASSERT_TRUE(hash_wyhash_string(&key) != h1);
+    ASSERT_EQ(hash_wyhash_string(NULL), 0);
+
+    hash_set_seed(seed);
+    ASSERT_TRUE(hash_get_seed() == seed);
+    HashTable *ht = hashtable_create(sizeof(char*), sizeof(int), 16,
+                                     hash_wyhash_string, compare_string,
+                                     HASH_CHAINING, NULL, NULL);
+    ASSERT_NOT_NULL(ht);
+    char names[200][24];
+    for (int i = 0; i < 200; i++) {
+        snprintf(names[i], sizeof(names[i]), "nome_%d", i);
+        char *name = names[i];
+        ASSERT_EQ(hashtable_put(ht, &name, &i), DS_SUCCESS);
+    }
+    for (int i = 0; i < 200; i++) {
+        char *name = names[i];
+        int out;
+        ASSERT_EQ(hashtable_get(ht, &name, &out), DS_SUCCESS);
+        ASSERT_EQ(out, i);
+    }
+    hashtable_destroy(ht);
+    hash_set_seed(saved);
+}
+
+TEST(hash_quality_report) {
+    const size_t N = 4096;
+    int *keys = malloc(N * sizeof(int));
+    ASSERT_NOT_NULL(keys);
+    for (size_t i = 0; i < N; i++) {
+        keys[i] = (int)(i << 10);  // chaves com os bits baixos zerados
+    }
+
+    HashQualityReport wy;
+    ASSERT_EQ(hashtable_hash_quality(keys, N, sizeof(int), hash_wyhash_int,
+                                     compare_int, 0, &wy), DS_SUCCESS);
+    ASSERT_EQ(wy.stats.size, N);
+    ASSERT_TRUE(wy.stats.capacity >= N);
+    ASSERT_TRUE(wy.ns_per_key > 0.0);
+    // Hash uniforme: vazios e colisões dentro de 15% do esperado
+    ASSERT_TRUE(wy.stats.empty_buckets > 0.85 * wy.expected_empty_buckets);
+    ASSERT_TRUE(wy.stats.empty_buckets < 1.15 * wy.expected_empty_buckets);
+    ASSERT_TRUE(wy.stats.collisions < 1.15 * wy.expected_collisions);
+    ASSERT_EQ(wy.stats.collisions + (wy.stats.capacity - wy.stats.empty_buckets), N);
+
+    HashQualityReport basic;
+    ASSERT_EQ(hashtable_hash_quality(keys, N, sizeof(int), hash_int,
+                                     compare_int, 2 * N, &basic), DS_SUCCESS);
+    ASSERT_EQ(basic.stats.size, N);
+
+    ASSERT_EQ(hashtable_hash_quality(NULL, N, sizeof(int), hash_int, compare_int, 0, &basic),
+              DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(hashtable_hash_quality(keys, 0, sizeof(int), hash_int, compare_int, 0, &basic),
+              DS_ERROR_INVALID_PARAM);
+    free(keys);
+}
+
+TEST(memory_usage_all_strategies) {
+    CollisionStrategy strategies[] = {
+        HASH_CHAINING, HASH_LINEAR_PROBING, HASH_QUADRATIC_PROBING,
+        HASH_DOUBLE_HASHING, HASH_FLAT
+    };
+    const size_t pair = 2 * sizeof(int);
+
+    for (int s = 0; s < 5; s++) {
+        HashTable *ht = hashtable_create(sizeof(int), sizeof(int), 64,
+                                          hash_int, compare_int,
+                                          strategies[s], NULL, NULL);
+        ASSERT_NOT_NULL(ht);
+        size_t empty = hashtable_memory_usage(ht);
+        ASSERT_TRUE(empty > hashtable_capacity(ht));
+
+        for (int i = 0; i < 10; i++) {
+            ASSERT_EQ(hashtable_put(ht, &i, &i), DS_SUCCESS);
+        }
+        size_t full = hashtable_memory_usage(ht);
+        for (int i = 0; i < 5; i++) {
+            ASSERT_EQ(hashtable_remove(ht, &i, NULL), DS_SUCCESS);
+        }
+        size_t after_remove = hashtable_memory_usage(ht);
+
+        if (strategies[s] == HASH_FLAT) {
+            // Slots inline: a memória não depende dos elementos
+            ASSERT_EQ(full, empty);
+            ASSERT_EQ(after_remove, empty);
+        } else if (strategies[s] == HASH_CHAINING) {
+            ASSERT_TRUE(full > empty + 10 * pair);
+            ASSERT_TRUE(after_remove < full);
+        } else {
+            // Lápides mantêm os buffers de chave e valor
+            ASSERT_EQ(full, empty + 10 * pair);
+            ASSERT_EQ(after_remove, full);
+        }
+        hashtable_destroy(ht);
+    }
+    ASSERT_EQ(hashtable_memory_usage(NULL), 0);
+
+    ConcurrentHashTable *cht = cht_create(sizeof(int), sizeof(int), 4,
+                                          hash_int, compare_int, NULL, NULL);
+    ASSERT_NOT_NULL(cht);
+    size_t before = cht_memory_usage(cht);
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(cht_put(cht, &i, &i), DS_SUCCESS);
+    }
+    ASSERT_TRUE(cht_memory_usage(cht) >= before + 100 * pair);   // segmentos em chaining
+    cht_destroy(cht);
+}
+
 TEST(print_visual) {
     printf("\n");
 
@@ -689,11 +1334,40 @@ int main(void) {
     RUN_TEST(remove_nonexistent_key);
     RUN_TEST(null_pointer_checks);
 
+    printf("\nAlocador:\n");
+    RUN_TEST(chaining_arena_allocator);
+
+    printf("\nHASH_FLAT:\n");
+    RUN_TEST(flat_put_get_remove);
+    RUN_TEST(flat_update_and_ptr_alignment);
+    RUN_TEST(flat_tombstone_churn);
+    RUN_TEST(flat_iterator_keys_values);
+
+    printf("\nRehash Incremental:\n");
+    RUN_TEST(incremental_rehash_chaining);
+    RUN_TEST(incremental_rehash_controls);
+
+    printf("\nTabela Concorrente:\n");
+    RUN_TEST(concurrent_table_sequential);
+    RUN_TEST(concurrent_table_threads);
+
+    printf("\nOperações em Lote:\n");
+    RUN_TEST(batch_put_get_all_strategies);
+    RUN_TEST(batch_put_incremental_and_reserve);
+
+    printf("\nFunções Hash com Semente:\n");
+    RUN_TEST(wyhash_vectors_and_lengths);
+    RUN_TEST(wyhash_string_seeded_table);
+    RUN_TEST(hash_quality_report);
+
+    printf("\nMemória:\n");
+    RUN_TEST(memory_usage_all_strategies);
+
     printf("\nTeste Visual:\n");
     RUN_TEST(print_visual);
 
     printf("\n============================================\n");
-    printf("  ✅ TODOS OS TESTES PASSARAM! (32 testes)\n");
+    printf("  ✅ TODOS OS TESTES PASSARAM! (47 testes)\n");
     printf("============================================\n\n");
 
     return 0;
@@ -11,12 +11,14 @@
  * - Clear, to_array, operacoes em heap vazio
  * - Robustez com ponteiros nulos
  * - Stress test com 1000 elementos
+ * - Heaps d-arios (heap_create_with_arity) e heaps tipados (typed_heap.h)
  *
  * @author Algoritmos e Heuristicas
  * @date 2025
  */
 
 #include "data_structures/heap.h"
+#include "data_structures/typed_heap.h"
 #include "data_structures/common.h"
 #include "../test_macros.h"
 #include <string.h>
@@ -320,6 +322,110 @@ TEST(stress_test) {
     heap_destroy(heap);
 }
 
+// ============================================================================
+// TESTES: HEAP D-ARIO E HEAPS TIPADOS
+// ============================================================================
+
+TEST(dary_heap_orders) {
+    const size_t arities[] = {2, 3, 4, 8};
+    for (size_t a = 0; a < 4; a++) {
+        for (int t = 0; t < 2; t++) {
+            HeapType type = t == 0 ? HEAP_MIN : HEAP_MAX;
+            Heap *heap = heap_create_with_arity(sizeof(int), 4, arities[a], type,
+                                                compare_int, NULL, NULL);
+            ASSERT_NOT_NULL(heap);
+            ASSERT_EQ(heap_arity(heap), arities[a]);
+
+            unsigned seed = 7u + (unsigned)a;
+            for (int i = 0; i < 500; i++) {
+                seed = seed * 1103515245u + 12345u;
+                int val = (int)((seed >> 16) % 200);
+                ASSERT_EQ(heap_insert(heap, &val), DS_SUCCESS);
+            }
+
+            // heap_update nos indices continua valido com d filhos
+            int extreme = type == HEAP_MIN ? -1 : 1000;
+            ASSERT_EQ(heap_update(heap, 250, &extreme), DS_SUCCESS);
+            int top;
+            ASSERT_EQ(heap_peek(heap, &top), DS_SUCCESS);
+            ASSERT_EQ(top, extreme);
+
+            int prev;
+            heap_extract(heap, &prev);
+            for (int i = 1; i < 500; i++) {
+                int curr;
+                ASSERT_EQ(heap_extract(heap, &curr), DS_SUCCESS);
+                ASSERT_TRUE(type == HEAP_MIN ? curr >= prev : curr <= prev);
+                prev = curr;
+            }
+            ASSERT_TRUE(heap_is_empty(heap));
+            heap_destroy(heap);
+        }
+    }
+
+    ASSERT_NULL(heap_create_with_arity(sizeof(int), 16, 1, HEAP_MIN, compare_int, NULL, NULL));
+    Heap *binary = heap_create(sizeof(int), 16, HEAP_MIN, compare_int, NULL);
+    ASSERT_EQ(heap_arity(binary), 2);
+    heap_destroy(binary);
+}
+
+typedef struct {
+    double time;
+    int id;
+} TestEvent;
+
+#define TEST_EVENT_LATER(a, b) ((a).time > (b).time)
+
+TYPED_HEAP_DECLARE(test_event_max, TestEvent)
+TYPED_HEAP_DEFINE(test_event_max, TestEvent, 8, TEST_EVENT_LATER)
+
+TEST(typed_heaps) {
+    int_min_heap ih;
+    int_min_heap_init(&ih);
+    int out;
+    ASSERT_EQ(int_min_heap_pop(&ih, &out), DS_ERROR_EMPTY);
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(int_min_heap_push(&ih, (i * 7919) % 1000), DS_SUCCESS);
+    }
+    ASSERT_EQ(int_min_heap_size(&ih), 1000);
+    ASSERT_EQ(int_min_heap_peek(&ih, &out), DS_SUCCESS);
+    ASSERT_EQ(out, 0);
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(int_min_heap_pop(&ih, &out), DS_SUCCESS);
+        ASSERT_EQ(out, i);
+    }
+    int_min_heap_destroy(&ih);
+
+    double_min_heap dh;
+    double_min_heap_init(&dh);
+    ASSERT_EQ(double_min_heap_reserve(&dh, 64), DS_SUCCESS);
+    double values[] = {3.5, -1.25, 2.0, 9.75, 0.5, -7.0};
+    for (int i = 0; i < 6; i++) double_min_heap_push(&dh, values[i]);
+    double d, prev = -1e300;
+    while (double_min_heap_pop(&dh, &d) == DS_SUCCESS) {
+        ASSERT_TRUE(d >= prev);
+        prev = d;
+    }
+    ASSERT_TRUE(prev == 9.75);
+    double_min_heap_destroy(&dh);
+
+    // Instancia customizada: max-heap de structs por campo
+    test_event_max_heap eh;
+    test_event_max_heap_init(&eh);
+    for (int i = 0; i < 100; i++) {
+        TestEvent e = {(double)((i * 37) % 100), i};
+        test_event_max_heap_push(&eh, e);
+    }
+    TestEvent e;
+    for (int i = 99; i >= 0; i--) {
+        ASSERT_EQ(test_event_max_heap_pop(&eh, &e), DS_SUCCESS);
+        ASSERT_TRUE(e.time == (double)i);
+        ASSERT_EQ((e.id * 37) % 100, i);
+    }
+    ASSERT_EQ(test_event_max_heap_pop(&eh, NULL), DS_ERROR_EMPTY);
+    test_event_max_heap_destroy(&eh);
+}
+
 // ============================================================================
 // TESTES: OPERACOES EM HEAP VAZIO
 // ============================================================================
@@ -482,6 +588,10 @@ int main(void) {
     printf("\nStress Test:\n");
     RUN_TEST(stress_test);
 
+    printf("\nHeap d-ario e Heaps Tipados:\n");
+    RUN_TEST(dary_heap_orders);
+    RUN_TEST(typed_heaps);
+
     printf("\nOperacoes em Heap Vazio:\n");
     RUN_TEST(empty_operations);
 
@@ -492,7 +602,7 @@ int main(void) {
     RUN_TEST(print_visual);
 
     printf("\n============================================\n");
-    printf("  ✅ TODOS OS TESTES PASSARAM! (17 testes)\n");
+    printf("  ✅ TODOS OS TESTES PASSARAM! (19 testes)\n");
     printf("============================================\n\n");
 
     return 0;
@@ -0,0 +1,156 @@
+/**
+ * @file test_instrument.c
+ * @brief Testes unitarios da camada de instrumentacao
+ *
+ * Sem DS_INSTRUMENT, verifica que snapshot devolve zeros e dump so avisa.
+ * Com DS_INSTRUMENT, verifica que cada ponto instrumentado (ordenacao,
+ * hash, AVL, alocador) conta e que reset descarta o que veio antes.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "data_structures/instrument.h"
+#include "data_structures/common.h"
+#include "data_structures/hash_table.h"
+#include "data_structures/avl_tree.h"
+#include "data_structures/pdqsort.h"
+#include "algorithms/sorting.h"
+#include "../test_macros.h"
+
+#include <string.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+#define COUNTER(stats, comp, counter) \
+    ((stats).counters[DS_COMPONENT_##comp][DS_COUNTER_##counter])
+
+static void fill_reversed(int *arr, size_t n) {
+    for (size_t i = 0; i < n; i++) arr[i] = (int)(n - i);
+}
+
+static void run_workload(void) {
+    int arr[256];
+    fill_reversed(arr, 256);
+    merge_sort(arr, 256, sizeof(int), compare_int);
+    fill_reversed(arr, 256);
+    ds_pdqsort(arr, 256, sizeof(int), compare_int);
+
+    HashTable *ht = hashtable_create(sizeof(int), sizeof(int), 4, hash_int, compare_int,
+                                     HASH_LINEAR_PROBING, NULL, NULL);
+    for (int i = 0; i < 100; i++) hashtable_put(ht, &i, &i);
+    for (int i = 0; i < 100; i++) {
+        int v;
+        hashtable_get(ht, &i, &v);
+    }
+    hashtable_destroy(ht);
+
+    AVLTree *tree = avl_create(sizeof(int), compare_int, NULL);
+    for (int i = 0; i < 100; i++) avl_insert(tree, &i);
+    avl_destroy(tree);
+}
+
+// ============================================================================
+// TESTES
+// ============================================================================
+
+TEST(names) {
+    ASSERT_TRUE(strcmp(ds_instrument_component_name(DS_COMPONENT_HASH_TABLE), "hash_table") == 0);
+    ASSERT_TRUE(strcmp(ds_instrument_counter_name(DS_COUNTER_PROBES), "probes") == 0);
+    ASSERT_TRUE(strcmp(ds_instrument_timer_name(DS_TIMER_SORT), "sort") == 0);
+    ASSERT_TRUE(strcmp(ds_instrument_counter_name(DS_COUNTER_COUNT), "?") == 0);
+}
+
+TEST(snapshot_matches_mode) {
+    ds_instrument_reset();
+    run_workload();
+
+    DSInstrumentStats stats;
+    ds_instrument_snapshot(&stats);
+
+    if (!ds_instrument_enabled()) {
+        DSInstrumentStats zero;
+        memset(&zero, 0, sizeof(zero));
+        ASSERT_TRUE(memcmp(&stats, &zero, sizeof(stats)) == 0);
+        return;
+    }
+
+    ASSERT_TRUE(COUNTER(stats, SORTING, COMPARISONS) > 0);
+    ASSERT_TRUE(COUNTER(stats, SORTING, SWAPS) > 0);
+    ASSERT_TRUE(stats.timer_calls[DS_TIMER_SORT] == 2);
+    ASSERT_TRUE(COUNTER(stats, HASH_TABLE, PROBES) >= 200);
+    ASSERT_TRUE(COUNTER(stats, HASH_TABLE, REHASHES) > 0);
+    ASSERT_TRUE(stats.timer_calls[DS_TIMER_HASH_REHASH] == COUNTER(stats, HASH_TABLE, REHASHES));
+    ASSERT_TRUE(COUNTER(stats, AVL_TREE, ROTATIONS) > 0);
+    ASSERT_TRUE(COUNTER(stats, ALLOCATOR, ALLOCATIONS) > 0);
+    ASSERT_TRUE(COUNTER(stats, ALLOCATOR, ALLOCATED_BYTES) >= COUNTER(stats, ALLOCATOR, ALLOCATIONS));
+    ASSERT_TRUE(COUNTER(stats, ALLOCATOR, FREES) > 0);
+    ASSERT_TRUE(stats.ns_per_tick > 0.0);
+}
+
+TEST(reset_discards_previous) {
+    run_workload();
+    ds_instrument_reset();
+
+    DSInstrumentStats stats;
+    ds_instrument_snapshot(&stats);
+    ASSERT_EQ(COUNTER(stats, SORTING, COMPARISONS), 0);
+    ASSERT_EQ(COUNTER(stats, ALLOCATOR, ALLOCATIONS), 0);
+    ASSERT_EQ(stats.timer_calls[DS_TIMER_SORT], 0);
+
+    // Ordenar uma vez mais conta so essa chamada
+    int arr[64];
+    fill_reversed(arr, 64);
+    insertion_sort(arr, 64, sizeof(int), compare_int);
+    ds_instrument_snapshot(&stats);
+    if (ds_instrument_enabled()) {
+        ASSERT_TRUE(COUNTER(stats, SORTING, COMPARISONS) >= 63);
+        ASSERT_EQ(stats.timer_calls[DS_TIMER_SORT], 1);
+    }
+}
+
+TEST(dump_output) {
+    FILE *out = tmpfile();
+    ASSERT_NOT_NULL(out);
+
+    ds_instrument_reset();
+    run_workload();
+    ds_instrument_dump(out);
+
+    char buf[4096];
+    rewind(out);
+    size_t len = fread(buf, 1, sizeof(buf) - 1, out);
+    buf[len] = '\0';
+    fclose(out);
+
+    if (ds_instrument_enabled()) {
+        ASSERT_NOT_NULL(strstr(buf, "sorting.comparisons"));
+        ASSERT_NOT_NULL(strstr(buf, "avl_tree.rotations"));
+        ASSERT_NOT_NULL(strstr(buf, "timer.sort 2 chamadas"));
+    } else {
+        ASSERT_NOT_NULL(strstr(buf, "desligada"));
+    }
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("========================================\n");
+    printf("  TESTES DA INSTRUMENTACAO (%s)\n", ds_instrument_enabled() ? "ligada" : "desligada");
+    printf("========================================\n\n");
+
+    RUN_TEST(names);
+    RUN_TEST(snapshot_matches_mode);
+    RUN_TEST(reset_discards_previous);
+    RUN_TEST(dump_output);
+
+    printf("\n============================================\n");
+    printf("  TODOS OS TESTES PASSARAM! (4 testes)\n");
+    printf("============================================\n");
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file test_large_alloc.c
+ * @brief Testes unitarios da alocacao de buffers grandes
+ *
+ * Testa blocos pequenos (calloc) e mapeados, zeragem, alinhamento a huge
+ * page, estouro de count * size, flags globais e contagem de nos NUMA.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "data_structures/large_alloc.h"
+#include "../test_macros.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static bool all_zero(const unsigned char *p, size_t bytes) {
+    for (size_t i = 0; i < bytes; i++) {
+        if (p[i] != 0) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// TESTES
+// ============================================================================
+
+TEST(small_block_uses_calloc) {
+    ASSERT_FALSE(ds_large_is_mapped(100, sizeof(double)));
+    double *v = ds_large_calloc(100, sizeof(double));
+    ASSERT_NOT_NULL(v);
+    ASSERT_TRUE(all_zero((const unsigned char *)v, 100 * sizeof(double)));
+    v[99] = 1.5;
+    ds_large_free(v, 100, sizeof(double));
+
+    // count ou size zero devolvem um bloco liberavel
+    void *empty = ds_large_calloc(0, sizeof(double));
+    ASSERT_NOT_NULL(empty);
+    ds_large_free(empty, 0, sizeof(double));
+    ds_large_free(NULL, 10, 10);
+}
+
+TEST(large_block_zeroed_and_aligned) {
+    size_t count = 3 * DS_HUGE_PAGE_SIZE / sizeof(double) + 17;   // nao multiplo da huge page
+    double *m = ds_large_calloc(count, sizeof(double));
+    ASSERT_NOT_NULL(m);
+    ASSERT_TRUE(all_zero((const unsigned char *)m, count * sizeof(double)));
+    if (ds_large_is_mapped(count, sizeof(double))) {
+        ASSERT_EQ((uintptr_t)m % DS_HUGE_PAGE_SIZE, 0);
+    }
+    for (size_t i = 0; i < count; i++) m[i] = (double)i;
+    ASSERT_TRUE(m[count - 1] == (double)(count - 1));
+    ds_large_free(m, count, sizeof(double));
+}
+
+TEST(explicit_flags) {
+    size_t count = DS_LARGE_ALLOC_THRESHOLD / sizeof(int);
+    unsigned masks[4] = {0, DS_LARGE_HUGE_PAGES, DS_LARGE_INTERLEAVE, DS_LARGE_DEFAULT_FLAGS};
+    for (size_t k = 0; k < 4; k++) {
+        int *v = ds_large_calloc_flags(count, sizeof(int), masks[k]);
+        ASSERT_NOT_NULL(v);
+        v[0] = 1;
+        v[count - 1] = 2;
+        ASSERT_EQ(v[count / 2], 0);
+        ds_large_free(v, count, sizeof(int));
+    }
+}
+
+TEST(overflow_rejected) {
+    ASSERT_NULL(ds_large_calloc(SIZE_MAX / 2, 4));
+    ASSERT_FALSE(ds_large_is_mapped(SIZE_MAX / 2, 4));
+}
+
+TEST(global_flags) {
+    ASSERT_EQ(ds_get_large_alloc_flags(), DS_LARGE_DEFAULT_FLAGS);
+    ds_set_large_alloc_flags(0);
+    ASSERT_EQ(ds_get_large_alloc_flags(), 0u);
+
+    size_t count = 2 * DS_LARGE_ALLOC_THRESHOLD;
+    unsigned char *b = ds_large_calloc(count, 1);
+    ASSERT_NOT_NULL(b);
+    memset(b, 0xAB, count);
+    ds_large_free(b, count, 1);
+
+    ds_set_large_alloc_flags(DS_LARGE_DEFAULT_FLAGS);
+    ASSERT_EQ(ds_get_large_alloc_flags(), DS_LARGE_DEFAULT_FLAGS);
+}
+
+TEST(numa_nodes) {
+    size_t nodes = ds_numa_num_nodes();
+    ASSERT_TRUE(nodes >= 1);
+    ASSERT_EQ(ds_numa_num_nodes(), nodes);   // lido do cache
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("========================================\n");
+    printf("  TESTES DO LARGE ALLOC\n");
+    printf("========================================\n\n");
+
+    RUN_TEST(small_block_uses_calloc);
+    RUN_TEST(large_block_zeroed_and_aligned);
+    RUN_TEST(explicit_flags);
+    RUN_TEST(overflow_rejected);
+    RUN_TEST(global_flags);
+    RUN_TEST(numa_nodes);
+
+    printf("\n============================================\n");
+    printf("  TODOS OS TESTES PASSARAM! (6 testes)\n");
+    printf("============================================\n");
+
+    return 0;
+}
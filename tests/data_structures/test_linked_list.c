@@ -2,7 +2,7 @@
  * @file test_linked_list.c
  * @brief Testes unitários para LinkedList
  *
- * Testa as três variantes: SINGLY, DOUBLY, CIRCULAR
+ * Testa as quatro variantes: SINGLY, DOUBLY, CIRCULAR, UNROLLED
  *
  * @author Algoritmos e Heurísticas
  * @date 2025
@@ -339,6 +339,167 @@ TEST(circular_iteration) {
     list_destroy(list);
 }
 
+// ============================================================================
+// TESTES - UNROLLED LINKED LIST
+// ============================================================================
+
+/**
+ * @brief Confere a lista contra o array de referência, percorrendo blocos
+ */
+static bool unrolled_matches(const LinkedList *list, const int *ref, size_t n) {
+    if (list_size(list) != n) return false;
+    size_t i = 0;
+    for (ListNode *node = list_begin(list); node != NULL; node = list_next(node)) {
+        const int *data = (const int*)list_node_data(node);
+        size_t count = list_node_count(node);
+        // Com int (4 bytes), blocos de até 16 elementos, nunca vazios
+        if (count == 0 || count > 16) return false;
+        for (size_t j = 0; j < count; j++, i++) {
+            if (i >= n || data[j] != ref[i]) return false;
+        }
+    }
+    return i == n;
+}
+
+TEST(unrolled_random_operations) {
+    // Operações aleatórias contra um array de referência
+    enum { MAX = 600 };
+    LinkedList *list = list_create(sizeof(int), LIST_UNROLLED, NULL);
+    ASSERT_NOT_NULL(list);
+    int ref[MAX];
+    size_t n = 0;
+    unsigned seed = 12345;
+
+    for (int step = 0; step < 4000; step++) {
+        seed = seed * 1103515245u + 12345u;
+        unsigned r = (seed >> 16) % 100;
+        int value = step;
+        if (n < MAX && (r < 55 || n == 0)) {
+            size_t index = (seed >> 4) % (n + 1);
+            if (r % 5 == 0) index = 0;
+            if (r % 5 == 1) index = n;
+            ASSERT_EQ(list_insert_at(list, index, &value), DS_SUCCESS);
+            memmove(&ref[index + 1], &ref[index], (n - index) * sizeof(int));
+            ref[index] = value;
+            n++;
+        } else {
+            size_t index = (seed >> 4) % n;
+            int out = -1;
+            if (r % 3 == 0) {
+                ASSERT_EQ(list_pop_back(list, &out), DS_SUCCESS);
+                index = n - 1;
+            } else {
+                ASSERT_EQ(list_remove_at(list, index, &out), DS_SUCCESS);
+            }
+            ASSERT_EQ(out, ref[index]);
+            memmove(&ref[index], &ref[index + 1], (n - index - 1) * sizeof(int));
+            n--;
+        }
+        if (step % 97 == 0) {
+            ASSERT_TRUE(unrolled_matches(list, ref, n));
+        }
+    }
+    ASSERT_TRUE(unrolled_matches(list, ref, n));
+
+    for (size_t i = 0; i < n; i += 7) {
+        int out;
+        ASSERT_EQ(list_get(list, i, &out), DS_SUCCESS);
+        ASSERT_EQ(out, ref[i]);
+    }
+
+    list_reverse(list);
+    for (size_t i = 0; i < n / 2; i++) {
+        int t = ref[i];
+        ref[i] = ref[n - 1 - i];
+        ref[n - 1 - i] = t;
+    }
+    ASSERT_TRUE(unrolled_matches(list, ref, n));
+
+    list_destroy(list);
+}
+
+TEST(unrolled_node_operations) {
+    LinkedList *list = list_create(sizeof(int), LIST_UNROLLED, NULL);
+
+    for (int i = 0; i < 100; i++) {
+        list_push_back(list, &i);
+    }
+    int front = -1;
+    list_push_front(list, &front);
+
+    // 101 elementos em blocos de até 16: bem menos nós que elementos
+    size_t chunks = 0;
+    for (ListNode *node = list_begin(list); node != NULL; node = list_next(node)) {
+        chunks++;
+    }
+    ASSERT_TRUE(chunks <= 8);
+
+    int key = 50;
+    ListNode *node = list_find(list, &key, compare_int);
+    ASSERT_NOT_NULL(node);
+    ASSERT_EQ(list_index_of(list, &key, compare_int), 51);
+
+    // insert_after insere após o último elemento do bloco
+    int extra = 1000;
+    size_t count = list_node_count(node);
+    int last = ((int*)list_node_data(node))[count - 1];
+    ASSERT_EQ(list_insert_after(list, node, &extra), DS_SUCCESS);
+    ASSERT_EQ(list_index_of(list, &extra, compare_int),
+              list_index_of(list, &last, compare_int) + 1);
+
+    ASSERT_EQ(list_remove(list, &extra, compare_int), DS_SUCCESS);
+    ASSERT_EQ(list_remove(list, &extra, compare_int), DS_ERROR_NOT_FOUND);
+
+    int seven = 7;
+    ASSERT_EQ(list_set(list, 0, &seven), DS_SUCCESS);
+    int out;
+    ASSERT_EQ(list_pop_front(list, &out), DS_SUCCESS);
+    ASSERT_EQ(out, 7);
+    ASSERT_EQ(list_size(list), 100);
+
+    // remove_node remove o bloco inteiro
+    node = list_begin(list);
+    size_t first_count = list_node_count(node);
+    ASSERT_EQ(list_remove_node(list, node), DS_SUCCESS);
+    ASSERT_EQ(list_size(list), 100 - first_count);
+    ASSERT_EQ(list_get(list, 0, &out), DS_SUCCESS);
+    ASSERT_EQ(out, (int)first_count);
+
+    ASSERT_EQ(list_get(list, list_size(list), &out), DS_ERROR_INVALID_INDEX);
+    list_clear(list);
+    ASSERT_TRUE(list_is_empty(list));
+    ASSERT_NULL(list_begin(list));
+
+    list_destroy(list);
+}
+
+static int unrolled_destroyed = 0;
+
+static void count_destroy(void *data) {
+    (void)data;
+    unrolled_destroyed++;
+}
+
+TEST(unrolled_large_elements_destroy) {
+    // Elementos maiores que uma linha de cache ainda ficam vários por bloco
+    typedef struct { char bytes[100]; } Big;
+    LinkedList *list = list_create(sizeof(Big), LIST_UNROLLED, count_destroy);
+    Big b;
+    for (int i = 0; i < 10; i++) {
+        memset(b.bytes, 'a' + i, sizeof(b.bytes));
+        list_push_back(list, &b);
+    }
+    ASSERT_TRUE(list_node_count(list_begin(list)) > 1);
+
+    ASSERT_EQ(list_get(list, 9, &b), DS_SUCCESS);
+    ASSERT_EQ(b.bytes[99], 'j');
+    ASSERT_EQ(list_pop_front(list, NULL), DS_SUCCESS);
+    ASSERT_EQ(unrolled_destroyed, 1);
+
+    list_destroy(list);
+    ASSERT_EQ(unrolled_destroyed, 10);
+}
+
 // ============================================================================
 // TESTES COM STRINGS
 // ============================================================================
@@ -504,6 +665,11 @@ int main(void) {
     RUN_TEST(circular_push_operations);
     RUN_TEST(circular_iteration);
 
+    printf("\nUNROLLED LINKED LIST:\n");
+    RUN_TEST(unrolled_random_operations);
+    RUN_TEST(unrolled_node_operations);
+    RUN_TEST(unrolled_large_elements_destroy);
+
     printf("\nTestes com Strings:\n");
     RUN_TEST(doubly_strings);
 
@@ -519,7 +685,7 @@ int main(void) {
     RUN_TEST(print_visual);
 
     printf("\n============================================\n");
-    printf("  ✅ TODOS OS TESTES PASSARAM! (24 testes)\n");
+    printf("  ✅ TODOS OS TESTES PASSARAM! (27 testes)\n");
     printf("============================================\n");
 
     return 0;
@@ -0,0 +1,268 @@
+/**
+ * @file test_pdqsort.c
+ * @brief Testes unitarios para o pattern-defeating quicksort
+ *
+ * Testa padroes de entrada (ordenado, invertido, repetidos, organ pipe,
+ * aleatorio), tamanhos de elemento com e sem caminho especializado,
+ * limites de comparacoes e a integracao com arraylist_sort.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "data_structures/pdqsort.h"
+#include "data_structures/common.h"
+#include "data_structures/array_list.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <string.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static uint32_t lcg_state = 12345u;
+
+static uint32_t lcg_next(void) {
+    lcg_state = lcg_state * 1664525u + 1013904223u;
+    return lcg_state >> 8;
+}
+
+static size_t comparisons = 0;
+
+static int compare_int_counted(const void *a, const void *b) {
+    comparisons++;
+    return compare_int(a, b);
+}
+
+enum { PATTERN_RANDOM, PATTERN_SORTED, PATTERN_REVERSED, PATTERN_EQUAL,
+       PATTERN_FEW, PATTERN_ORGAN_PIPE, PATTERN_SAWTOOTH, PATTERN_COUNT };
+
+static void fill_pattern(int *arr, size_t n, int pattern) {
+    for (size_t i = 0; i < n; i++) {
+        switch (pattern) {
+            case PATTERN_RANDOM:     arr[i] = (int)(lcg_next() % 100000u) - 50000; break;
+            case PATTERN_SORTED:     arr[i] = (int)i; break;
+            case PATTERN_REVERSED:   arr[i] = (int)(n - i); break;
+            case PATTERN_EQUAL:      arr[i] = 7; break;
+            case PATTERN_FEW:        arr[i] = (int)(lcg_next() % 4u); break;
+            case PATTERN_ORGAN_PIPE: arr[i] = (int)((i < n / 2) ? i : n - i); break;
+            default:                 arr[i] = (int)(i % 17); break;
+        }
+    }
+}
+
+// Ordenado e mesma soma/xor do original (permutacao, salvo colisoes improvaveis)
+static void assert_sorted_permutation(const int *sorted, const int *orig, size_t n) {
+    long long sum_a = 0, sum_b = 0;
+    unsigned x_a = 0, x_b = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (i > 0) ASSERT_TRUE(sorted[i - 1] <= sorted[i]);
+        sum_a += sorted[i];
+        sum_b += orig[i];
+        x_a ^= (unsigned)sorted[i] * 2654435761u;
+        x_b ^= (unsigned)orig[i] * 2654435761u;
+    }
+    ASSERT_EQ(sum_a, sum_b);
+    ASSERT_EQ(x_a, x_b);
+}
+
+static int compare_u8(const void *a, const void *b) {
+    return (int)*(const unsigned char *)a - (int)*(const unsigned char *)b;
+}
+
+typedef struct {
+    int key;
+    char payload[96];       // > 64 bytes: buffers no heap
+} BigRecord;
+
+static int compare_big(const void *a, const void *b) {
+    return compare_int(&((const BigRecord *)a)->key, &((const BigRecord *)b)->key);
+}
+
+typedef struct {
+    double key;
+    int id;
+    char tag[12];           // 24 bytes: caminho generico na pilha
+} MidRecord;
+
+static int compare_mid(const void *a, const void *b) {
+    return compare_double(&((const MidRecord *)a)->key, &((const MidRecord *)b)->key);
+}
+
+// ============================================================================
+// TESTES DE PADROES
+// ============================================================================
+
+TEST(null_and_trivial) {
+    int one = 5;
+    ds_pdqsort(NULL, 10, sizeof(int), compare_int);
+    ds_pdqsort(&one, 1, sizeof(int), compare_int);
+    ds_pdqsort(&one, 0, sizeof(int), compare_int);
+    ds_pdqsort(&one, 1, sizeof(int), NULL);
+    ASSERT_EQ(one, 5);
+}
+
+TEST(all_patterns_all_sizes) {
+    static int arr[3000];
+    static int orig[3000];
+    const size_t sizes[] = {2, 3, 7, 23, 24, 25, 100, 127, 128, 129, 130, 500, 1000, 3000};
+
+    for (int p = 0; p < PATTERN_COUNT; p++) {
+        for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); k++) {
+            size_t n = sizes[k];
+            fill_pattern(orig, n, p);
+            memcpy(arr, orig, n * sizeof(int));
+            ds_pdqsort(arr, n, sizeof(int), compare_int);
+            assert_sorted_permutation(arr, orig, n);
+        }
+    }
+}
+
+TEST(large_random) {
+    size_t n = 200000;
+    int *arr = malloc(n * sizeof(int));
+    int *orig = malloc(n * sizeof(int));
+    ASSERT_NOT_NULL(arr);
+    ASSERT_NOT_NULL(orig);
+    fill_pattern(orig, n, PATTERN_RANDOM);
+    memcpy(arr, orig, n * sizeof(int));
+    ds_pdqsort(arr, n, sizeof(int), compare_int);
+    assert_sorted_permutation(arr, orig, n);
+    free(arr);
+    free(orig);
+}
+
+// ============================================================================
+// TESTES DE COMPLEXIDADE
+// ============================================================================
+
+TEST(linear_on_sorted_and_equal) {
+    size_t n = 10000;
+    int *arr = malloc(n * sizeof(int));
+    ASSERT_NOT_NULL(arr);
+
+    // Ordenado, invertido e constante: O(n) comparacoes
+    const int patterns[] = {PATTERN_SORTED, PATTERN_REVERSED, PATTERN_EQUAL};
+    for (size_t k = 0; k < 3; k++) {
+        fill_pattern(arr, n, patterns[k]);
+        comparisons = 0;
+        ds_pdqsort(arr, n, sizeof(int), compare_int_counted);
+        ASSERT_TRUE(comparisons < 4 * n);
+        for (size_t i = 1; i < n; i++) ASSERT_TRUE(arr[i - 1] <= arr[i]);
+    }
+    free(arr);
+}
+
+TEST(median_of_three_killer) {
+    // Sequencia de Musser que leva quicksort com mediana de 3 a O(n^2)
+    size_t n = 1 << 14;
+    size_t k = n / 2;
+    int *arr = malloc(n * sizeof(int));
+    ASSERT_NOT_NULL(arr);
+    for (size_t i = 1; i <= k; i++) {
+        if (i % 2 == 1) {
+            arr[i - 1] = (int)i;
+            arr[i] = (int)(k + i);
+        }
+        arr[k + i - 1] = (int)(2 * i);
+    }
+
+    comparisons = 0;
+    ds_pdqsort(arr, n, sizeof(int), compare_int_counted);
+    for (size_t i = 1; i < n; i++) ASSERT_TRUE(arr[i - 1] <= arr[i]);
+    ASSERT_TRUE(comparisons < 4 * n * 14);   // folgado acima de n log2 n
+    free(arr);
+}
+
+// ============================================================================
+// TESTES DE TAMANHO DE ELEMENTO
+// ============================================================================
+
+TEST(element_sizes) {
+    // 1 byte (caminho generico)
+    unsigned char bytes[300];
+    for (size_t i = 0; i < 300; i++) bytes[i] = (unsigned char)(lcg_next() & 0xFF);
+    ds_pdqsort(bytes, 300, 1, compare_u8);
+    for (size_t i = 1; i < 300; i++) ASSERT_TRUE(bytes[i - 1] <= bytes[i]);
+
+    // 8 bytes
+    double dv[1000];
+    for (size_t i = 0; i < 1000; i++) dv[i] = (double)(lcg_next() % 5000u) * 0.5;
+    ds_pdqsort(dv, 1000, sizeof(double), compare_double);
+    for (size_t i = 1; i < 1000; i++) ASSERT_TRUE(dv[i - 1] <= dv[i]);
+
+    // 24 bytes: o id acompanha a chave
+    MidRecord mid[700];
+    for (size_t i = 0; i < 700; i++) {
+        mid[i].key = (double)(lcg_next() % 300u);
+        mid[i].id = (int)mid[i].key * 3;
+        snprintf(mid[i].tag, sizeof(mid[i].tag), "r%zu", i);
+    }
+    ds_pdqsort(mid, 700, sizeof(MidRecord), compare_mid);
+    for (size_t i = 0; i < 700; i++) {
+        if (i > 0) ASSERT_TRUE(mid[i - 1].key <= mid[i].key);
+        ASSERT_EQ(mid[i].id, (int)mid[i].key * 3);
+    }
+
+    // > 64 bytes: buffers alocados
+    static BigRecord big[400];
+    for (size_t i = 0; i < 400; i++) {
+        big[i].key = (int)(400 - i);
+        memset(big[i].payload, (int)(big[i].key & 0x7F), sizeof(big[i].payload));
+    }
+    ds_pdqsort(big, 400, sizeof(BigRecord), compare_big);
+    for (size_t i = 0; i < 400; i++) {
+        ASSERT_EQ(big[i].key, (int)(i + 1));
+        ASSERT_EQ(big[i].payload[95], (char)(big[i].key & 0x7F));
+    }
+}
+
+// ============================================================================
+// TESTES DE INTEGRACAO
+// ============================================================================
+
+TEST(arraylist_sort_uses_engine) {
+    ArrayList *list = arraylist_create(sizeof(int), 0, NULL);
+    ASSERT_NOT_NULL(list);
+    for (int i = 0; i < 5000; i++) {
+        int v = (int)(lcg_next() % 1000u);
+        arraylist_push_back(list, &v);
+    }
+    arraylist_sort(list, compare_int);
+    const int *data = (const int *)arraylist_data(list);
+    for (size_t i = 1; i < arraylist_size(list); i++) ASSERT_TRUE(data[i - 1] <= data[i]);
+    arraylist_destroy(list);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("========================================\n");
+    printf("  TESTES DO PDQSORT\n");
+    printf("========================================\n\n");
+
+    printf("Padroes:\n");
+    RUN_TEST(null_and_trivial);
+    RUN_TEST(all_patterns_all_sizes);
+    RUN_TEST(large_random);
+
+    printf("\nComplexidade:\n");
+    RUN_TEST(linear_on_sorted_and_equal);
+    RUN_TEST(median_of_three_killer);
+
+    printf("\nTamanho de elemento:\n");
+    RUN_TEST(element_sizes);
+
+    printf("\nIntegracao:\n");
+    RUN_TEST(arraylist_sort_uses_engine);
+
+    printf("\n============================================\n");
+    printf("  TODOS OS TESTES PASSARAM! (7 testes)\n");
+    printf("============================================\n");
+
+    return 0;
+}
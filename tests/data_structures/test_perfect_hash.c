@@ -0,0 +1,249 @@
+/**
+ * @file test_perfect_hash.c
+ * @brief Testes unitários para o mapa com hash perfeito mínimo
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/perfect_hash.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// AUXILIARES
+// ============================================================================
+
+typedef struct {
+    uint32_t *storage;
+    const void **keys;
+    size_t *lengths;
+    uint64_t *values;
+} IntKeys;
+
+// Chaves inteiras de 4 bytes i * 2654435761 (distintas), valor = i
+static bool int_keys_init(IntKeys *k, size_t n) {
+    k->storage = malloc((n + 1) * sizeof(uint32_t));
+    k->keys = malloc((n + 1) * sizeof(void*));
+    k->lengths = malloc((n + 1) * sizeof(size_t));
+    k->values = malloc((n + 1) * sizeof(uint64_t));
+    if (!k->storage || !k->keys || !k->lengths || !k->values) return false;
+    for (size_t i = 0; i < n; i++) {
+        k->storage[i] = (uint32_t)(i * 2654435761u);
+        k->keys[i] = &k->storage[i];
+        k->lengths[i] = sizeof(uint32_t);
+        k->values[i] = i;
+    }
+    return true;
+}
+
+static void int_keys_free(IntKeys *k) {
+    free(k->storage);
+    free(k->keys);
+    free(k->lengths);
+    free(k->values);
+}
+
+// Confere que todas as chaves estão presentes e os índices formam [0, n)
+static bool check_all_keys(const PerfectHashMap *map, const IntKeys *k, size_t n) {
+    unsigned char *seen = calloc(n + 1, 1);
+    bool ok = seen != NULL && phmap_size(map) == n;
+    for (size_t i = 0; ok && i < n; i++) {
+        size_t index = phmap_index(map, k->keys[i], k->lengths[i]);
+        uint64_t value = 0;
+        ok = index < n && !seen[index] &&
+             phmap_get(map, k->keys[i], k->lengths[i], &value) == DS_SUCCESS &&
+             value == i;
+        if (ok) seen[index] = 1;
+    }
+    free(seen);
+    return ok;
+}
+
+// ============================================================================
+// TESTES: CONSTRUÇÃO E BUSCA
+// ============================================================================
+
+TEST(phmap_build_and_lookup) {
+    const size_t N = 100000;
+    IntKeys k;
+    ASSERT_TRUE(int_keys_init(&k, N));
+    PerfectHashMap *map = phmap_build(k.keys, k.lengths, N, k.values, sizeof(uint64_t), 1);
+    ASSERT_NOT_NULL(map);
+    ASSERT_EQ(phmap_value_size(map), sizeof(uint64_t));
+    ASSERT_TRUE(check_all_keys(map, &k, N));
+
+    // Chaves ausentes (mesmo tamanho e tamanhos diferentes)
+    size_t found = 0;
+    for (uint32_t i = 0; i < 10000; i++) {
+        uint32_t absent = (uint32_t)(N + i) * 2654435761u;
+        if (phmap_contains(map, &absent, sizeof(absent))) found++;
+    }
+    ASSERT_EQ(found, 0);
+    uint64_t wide = 7;
+    ASSERT_FALSE(phmap_contains(map, &wide, sizeof(wide)));
+    ASSERT_EQ(phmap_get(map, &wide, sizeof(wide), NULL), DS_ERROR_NOT_FOUND);
+    ASSERT_NULL(phmap_get_ptr(map, &wide, sizeof(wide)));
+
+    // key_at devolve a chave guardada no índice
+    size_t index = phmap_index(map, k.keys[123], k.lengths[123]);
+    size_t len = 0;
+    const void *stored = phmap_key_at(map, index, &len);
+    ASSERT_EQ(len, sizeof(uint32_t));
+    ASSERT_EQ(memcmp(stored, k.keys[123], len), 0);
+    const uint64_t *value = phmap_get_ptr(map, k.keys[123], k.lengths[123]);
+    ASSERT_NOT_NULL(value);
+    ASSERT_EQ(*value, 123);
+    ASSERT_NULL(phmap_key_at(map, N, NULL));
+
+    // ~1 byte de pilot por chave, além das chaves, offsets e valores
+    ASSERT_TRUE(phmap_memory_usage(map) < N * (4 + 8 + 8 + 2));
+
+    phmap_destroy(map);
+    int_keys_free(&k);
+}
+
+TEST(phmap_strings_and_index_only) {
+    const char *words[] = {"alfa", "beta", "gama", "delta", "epsilon", "", "zeta", "eta"};
+    size_t n = sizeof(words) / sizeof(words[0]);
+    PerfectHashMap *map = phmap_build_strings(words, n, NULL, 0, 1);
+    ASSERT_NOT_NULL(map);
+    ASSERT_EQ(phmap_size(map), n);
+
+    unsigned seen = 0;
+    for (size_t i = 0; i < n; i++) {
+        size_t index = phmap_index(map, words[i], strlen(words[i]));
+        ASSERT_TRUE(index < n);
+        ASSERT_FALSE(seen & (1u << index));
+        seen |= 1u << index;
+        // Sem valores: get só testa presença
+        ASSERT_EQ(phmap_get(map, words[i], strlen(words[i]), NULL), DS_SUCCESS);
+        ASSERT_NULL(phmap_get_ptr(map, words[i], strlen(words[i])));
+    }
+    ASSERT_FALSE(phmap_contains(map, "alf", 3));
+    ASSERT_FALSE(phmap_contains(map, "alfa!", 5));
+    phmap_destroy(map);
+}
+
+TEST(phmap_duplicates_and_empty) {
+    const char *dup[] = {"um", "dois", "tres", "dois"};
+    ASSERT_NULL(phmap_build_strings(dup, 4, NULL, 0, 1));
+
+    PerfectHashMap *empty = phmap_build(NULL, NULL, 0, NULL, 0, 1);
+    ASSERT_NOT_NULL(empty);
+    ASSERT_EQ(phmap_size(empty), 0);
+    ASSERT_FALSE(phmap_contains(empty, "x", 1));
+    ASSERT_EQ(phmap_index(empty, "x", 1), PHMAP_NOT_FOUND);
+    phmap_destroy(empty);
+}
+
+TEST(phmap_parallel_build) {
+    // Com OpenMP as partições são construídas em paralelo; sem, é serial.
+    // O resultado é o mesmo em ambos os casos.
+    const size_t N = 50000;
+    IntKeys k;
+    ASSERT_TRUE(int_keys_init(&k, N));
+    PerfectHashMap *serial = phmap_build(k.keys, k.lengths, N, k.values, sizeof(uint64_t), 1);
+    PerfectHashMap *parallel = phmap_build(k.keys, k.lengths, N, k.values, sizeof(uint64_t), 0);
+    ASSERT_NOT_NULL(serial);
+    ASSERT_NOT_NULL(parallel);
+    ASSERT_TRUE(check_all_keys(parallel, &k, N));
+    for (size_t i = 0; i < N; i += 97) {
+        ASSERT_EQ(phmap_index(serial, k.keys[i], k.lengths[i]),
+                  phmap_index(parallel, k.keys[i], k.lengths[i]));
+    }
+    phmap_destroy(serial);
+    phmap_destroy(parallel);
+    int_keys_free(&k);
+}
+
+// ============================================================================
+// TESTES: SERIALIZAÇÃO
+// ============================================================================
+
+TEST(phmap_save_and_mmap_open) {
+    const size_t N = 20000;
+    IntKeys k;
+    ASSERT_TRUE(int_keys_init(&k, N));
+    PerfectHashMap *map = phmap_build(k.keys, k.lengths, N, k.values, sizeof(uint64_t), 1);
+    ASSERT_NOT_NULL(map);
+
+    char path[] = "test_perfect_hash.bin";
+    ASSERT_TRUE(phmap_save(map, path));
+    PerfectHashMap *opened = phmap_mmap_open(path);
+    ASSERT_NOT_NULL(opened);
+    ASSERT_EQ(phmap_memory_usage(opened), phmap_memory_usage(map));
+    ASSERT_TRUE(check_all_keys(opened, &k, N));
+    for (size_t i = 0; i < N; i += 101) {
+        ASSERT_EQ(phmap_index(opened, k.keys[i], k.lengths[i]),
+                  phmap_index(map, k.keys[i], k.lengths[i]));
+    }
+    phmap_destroy(opened);
+
+    // from_buffer sobre uma cópia alinhada do arquivo
+    size_t size = phmap_memory_usage(map);
+    uint64_t *buffer = malloc(size);
+    ASSERT_NOT_NULL(buffer);
+    FILE *f = fopen(path, "rb");
+    ASSERT_NOT_NULL(f);
+    ASSERT_EQ(fread(buffer, 1, size, f), size);
+    fclose(f);
+    PerfectHashMap *view = phmap_from_buffer(buffer, size);
+    ASSERT_NOT_NULL(view);
+    ASSERT_TRUE(check_all_keys(view, &k, N));
+    phmap_destroy(view);
+
+    // Bloco truncado, cabeçalho corrompido ou desalinhado: recusado
+    ASSERT_NULL(phmap_from_buffer(buffer, size - 8));
+    ASSERT_NULL(phmap_from_buffer((unsigned char*)buffer + 4, size - 8));
+    ((unsigned char*)buffer)[0] ^= 0xFF;
+    ASSERT_NULL(phmap_from_buffer(buffer, size));
+    free(buffer);
+
+    remove(path);
+    ASSERT_NULL(phmap_mmap_open(path));
+    phmap_destroy(map);
+    int_keys_free(&k);
+}
+
+TEST(phmap_invalid_arguments) {
+    size_t len = 1;
+    const void *keys[] = {NULL};
+    ASSERT_NULL(phmap_build(NULL, &len, 1, NULL, 0, 1));
+    ASSERT_NULL(phmap_build(keys, &len, 1, NULL, 0, 1));
+    ASSERT_NULL(phmap_build_strings(NULL, 1, NULL, 0, 1));
+    ASSERT_EQ(phmap_get(NULL, "a", 1, NULL), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(phmap_index(NULL, "a", 1), PHMAP_NOT_FOUND);
+    ASSERT_FALSE(phmap_contains(NULL, "a", 1));
+    ASSERT_EQ(phmap_size(NULL), 0);
+    ASSERT_FALSE(phmap_save(NULL, "x"));
+    ASSERT_NULL(phmap_mmap_open(NULL));
+    ASSERT_NULL(phmap_from_buffer(NULL, 64));
+    phmap_destroy(NULL);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Perfect Hash Map Tests ===\n");
+
+    printf("\nConstrucao e busca:\n");
+    RUN_TEST(phmap_build_and_lookup);
+    RUN_TEST(phmap_strings_and_index_only);
+    RUN_TEST(phmap_duplicates_and_empty);
+    RUN_TEST(phmap_parallel_build);
+
+    printf("\nSerializacao:\n");
+    RUN_TEST(phmap_save_and_mmap_open);
+
+    RUN_TEST(phmap_invalid_arguments);
+
+    printf("\nAll perfect hash map tests passed!\n");
+    return 0;
+}
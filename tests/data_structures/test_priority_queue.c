@@ -9,11 +9,21 @@
  */
 
 #include "data_structures/priority_queue.h"
+#include "data_structures/indexed_priority_queue.h"
+#include "data_structures/radix_heap.h"
+#include "data_structures/pairing_heap.h"
+#include "data_structures/multi_queue.h"
 #include "data_structures/common.h"
 #include "../test_macros.h"
 
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // ============================================================================
 // TESTES DE CRIAÇÃO E DESTRUIÇÃO
 // ============================================================================
@@ -259,6 +269,362 @@ TEST(doubles_min) {
     pq_destroy(pq);
 }
 
+// ============================================================================
+// TESTES DA FILA INDEXADA
+// ============================================================================
+
+TEST(indexed_decrease_key) {
+    IndexedPriorityQueue *ipq = ipq_create(8, sizeof(int), PQ_MIN, compare_int);
+    ASSERT_NOT_NULL(ipq);
+
+    int keys[] = {50, 40, 30, 20, 10, 60, 70, 80};
+    for (size_t h = 0; h < 8; h++) {
+        ASSERT_EQ(ipq_insert(ipq, h, &keys[h]), DS_SUCCESS);
+    }
+
+    int k = 5;
+    ASSERT_EQ(ipq_decrease_key(ipq, 7, &k), DS_SUCCESS);
+    k = 15;
+    ASSERT_EQ(ipq_decrease_key(ipq, 0, &k), DS_SUCCESS);
+    k = 99;
+    ASSERT_EQ(ipq_decrease_key(ipq, 1, &k), DS_ERROR_INVALID_PARAM);
+    ASSERT_EQ(ipq_change_key(ipq, 1, &k), DS_SUCCESS);
+    ASSERT_EQ(ipq_remove(ipq, 3), DS_SUCCESS);
+    ASSERT_FALSE(ipq_contains(ipq, 3));
+    ASSERT_EQ(ipq_key_of(ipq, 0, &k), DS_SUCCESS);
+    ASSERT_EQ(k, 15);
+
+    size_t expected_handles[] = {7, 4, 0, 2, 5, 6, 1};
+    int expected_keys[] = {5, 10, 15, 30, 60, 70, 99};
+    size_t h;
+    ASSERT_EQ(ipq_peek(ipq, &h, &k), DS_SUCCESS);
+    ASSERT_EQ(h, 7);
+    for (size_t i = 0; i < 7; i++) {
+        ASSERT_EQ(ipq_extract(ipq, &h, &k), DS_SUCCESS);
+        ASSERT_EQ(h, expected_handles[i]);
+        ASSERT_EQ(k, expected_keys[i]);
+        ASSERT_FALSE(ipq_contains(ipq, h));
+    }
+    ASSERT_TRUE(ipq_is_empty(ipq));
+    ASSERT_EQ(ipq_extract(ipq, &h, &k), DS_ERROR_EMPTY);
+
+    // Handles extraídos podem ser reinseridos
+    ASSERT_EQ(ipq_insert(ipq, 7, &keys[0]), DS_SUCCESS);
+    ASSERT_EQ(ipq_size(ipq), 1);
+
+    ipq_destroy(ipq);
+}
+
+TEST(indexed_random_against_reference) {
+    enum { N = 200 };
+    IndexedPriorityQueue *ipq = ipq_create(N, sizeof(int), PQ_MAX, compare_int);
+    int ref[N];
+    bool in[N] = {false};
+    uint32_t seed = 12345u;
+
+    for (int step = 0; step < 5000; step++) {
+        seed = seed * 1664525u + 1013904223u;
+        size_t h = (seed >> 8) % N;
+        int key = (int)((seed >> 16) % 1000);
+        int op = (int)(seed % 4);
+
+        if (!in[h]) {
+            ASSERT_EQ(ipq_insert(ipq, h, &key), DS_SUCCESS);
+            ref[h] = key;
+            in[h] = true;
+        } else if (op == 0) {
+            ASSERT_EQ(ipq_remove(ipq, h), DS_SUCCESS);
+            in[h] = false;
+        } else if (op == 1) {
+            ASSERT_EQ(ipq_change_key(ipq, h, &key), DS_SUCCESS);
+            ref[h] = key;
+        } else {
+            size_t top;
+            int top_key;
+            ASSERT_EQ(ipq_extract(ipq, &top, &top_key), DS_SUCCESS);
+            ASSERT_TRUE(in[top]);
+            ASSERT_EQ(top_key, ref[top]);
+            for (size_t j = 0; j < N; j++) {
+                ASSERT_TRUE(!in[j] || ref[j] <= top_key);
+            }
+            in[top] = false;
+        }
+    }
+
+    size_t count = 0;
+    for (size_t j = 0; j < N; j++) {
+        count += in[j];
+    }
+    ASSERT_EQ(ipq_size(ipq), count);
+
+    ipq_clear(ipq);
+    ASSERT_TRUE(ipq_is_empty(ipq));
+    for (size_t j = 0; j < N; j++) {
+        ASSERT_FALSE(ipq_contains(ipq, j));
+    }
+    ipq_destroy(ipq);
+}
+
+TEST(indexed_errors) {
+    int k = 1;
+    ASSERT_NULL(ipq_create(0, sizeof(int), PQ_MIN, compare_int));
+    ASSERT_NULL(ipq_create(4, 0, PQ_MIN, compare_int));
+    ASSERT_NULL(ipq_create(4, sizeof(int), PQ_MIN, NULL));
+    ASSERT_EQ(ipq_insert(NULL, 0, &k), DS_ERROR_NULL_POINTER);
+    ASSERT_FALSE(ipq_contains(NULL, 0));
+
+    IndexedPriorityQueue *ipq = ipq_create(4, sizeof(int), PQ_MIN, compare_int);
+    ASSERT_EQ(ipq_max_handles(ipq), 4);
+    ASSERT_EQ(ipq_insert(ipq, 4, &k), DS_ERROR_INVALID_INDEX);
+    ASSERT_EQ(ipq_insert(ipq, 2, &k), DS_SUCCESS);
+    ASSERT_EQ(ipq_insert(ipq, 2, &k), DS_ERROR_INVALID_PARAM);
+    ASSERT_EQ(ipq_decrease_key(ipq, 1, &k), DS_ERROR_NOT_FOUND);
+    ASSERT_EQ(ipq_change_key(ipq, 9, &k), DS_ERROR_NOT_FOUND);
+    ASSERT_EQ(ipq_remove(ipq, 0), DS_ERROR_NOT_FOUND);
+    ASSERT_EQ(ipq_key_of(ipq, 3, &k), DS_ERROR_NOT_FOUND);
+    ASSERT_FALSE(ipq_contains(ipq, 100));
+    ipq_destroy(ipq);
+}
+
+// ============================================================================
+// TESTES DO RADIX HEAP
+// ============================================================================
+
+TEST(radix_heap_monotone) {
+    RadixHeap *heap = radix_heap_create();
+    ASSERT_NOT_NULL(heap);
+
+    // Simula Dijkstra: cada extração insere chaves >= a extraída
+    uint32_t seed = 777u;
+    uint64_t prev = 0;
+    size_t pushed = 0, popped = 0;
+    ASSERT_EQ(radix_heap_push(heap, 0, 0), DS_SUCCESS);
+    pushed++;
+
+    while (!radix_heap_is_empty(heap)) {
+        uint64_t peek_key, key;
+        size_t value;
+        ASSERT_EQ(radix_heap_peek(heap, &peek_key, NULL), DS_SUCCESS);
+        ASSERT_EQ(radix_heap_pop(heap, &key, &value), DS_SUCCESS);
+        ASSERT_EQ(key, peek_key);
+        ASSERT_TRUE(key >= prev);
+        ASSERT_EQ(radix_heap_last(heap), key);
+        prev = key;
+        popped++;
+
+        for (int i = 0; i < 3 && pushed < 20000; i++) {
+            seed = seed * 1664525u + 1013904223u;
+            uint64_t w = (i == 2) ? ((uint64_t)seed << 20) : (seed >> 12) % 100;
+            ASSERT_EQ(radix_heap_push(heap, key + w, pushed), DS_SUCCESS);
+            pushed++;
+        }
+    }
+
+    ASSERT_EQ(popped, pushed);
+    ASSERT_EQ(radix_heap_size(heap), 0);
+    radix_heap_destroy(heap);
+}
+
+TEST(radix_heap_errors) {
+    uint64_t key;
+    size_t value;
+    ASSERT_EQ(radix_heap_push(NULL, 1, 1), DS_ERROR_NULL_POINTER);
+    ASSERT_TRUE(radix_heap_is_empty(NULL));
+
+    RadixHeap *heap = radix_heap_create();
+    ASSERT_EQ(radix_heap_pop(heap, &key, &value), DS_ERROR_EMPTY);
+    ASSERT_EQ(radix_heap_peek(heap, &key, &value), DS_ERROR_EMPTY);
+
+    ASSERT_EQ(radix_heap_push(heap, 10, 1), DS_SUCCESS);
+    ASSERT_EQ(radix_heap_push(heap, UINT64_MAX, 2), DS_SUCCESS);
+    ASSERT_EQ(radix_heap_pop(heap, &key, &value), DS_SUCCESS);
+    ASSERT_EQ(key, 10);
+    ASSERT_EQ(value, 1);
+    ASSERT_EQ(radix_heap_push(heap, 9, 3), DS_ERROR_INVALID_PARAM);
+    ASSERT_EQ(radix_heap_push(heap, 10, 3), DS_SUCCESS);
+    ASSERT_EQ(radix_heap_size(heap), 2);
+
+    radix_heap_clear(heap);
+    ASSERT_TRUE(radix_heap_is_empty(heap));
+    ASSERT_EQ(radix_heap_last(heap), 0);
+    ASSERT_EQ(radix_heap_push(heap, 0, 4), DS_SUCCESS);
+    radix_heap_destroy(heap);
+}
+
+// ============================================================================
+// TESTES DO PAIRING HEAP
+// ============================================================================
+
+static int destroyed_count = 0;
+
+static void count_destroy(void *data) {
+    (void)data;
+    destroyed_count++;
+}
+
+TEST(pairing_heap_order) {
+    PairingHeap *heap = pairing_heap_create(sizeof(int), HEAP_MIN, compare_int, NULL);
+    ASSERT_NOT_NULL(heap);
+
+    int counts[1000] = {0};
+    uint32_t seed = 42u;
+    for (int i = 0; i < 5000; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        int v = (int)((seed >> 8) % 1000);
+        counts[v]++;
+        ASSERT_EQ(pairing_heap_insert(heap, &v), DS_SUCCESS);
+    }
+    ASSERT_EQ(pairing_heap_size(heap), 5000);
+
+    int top;
+    ASSERT_EQ(pairing_heap_peek(heap, &top), DS_SUCCESS);
+    int prev = -1;
+    for (int i = 0; i < 5000; i++) {
+        int v;
+        ASSERT_EQ(pairing_heap_extract(heap, &v), DS_SUCCESS);
+        if (i == 0) {
+            ASSERT_EQ(v, top);
+        }
+        ASSERT_TRUE(v >= prev);
+        counts[v]--;
+        prev = v;
+    }
+    for (int v = 0; v < 1000; v++) {
+        ASSERT_EQ(counts[v], 0);
+    }
+    ASSERT_EQ(pairing_heap_extract(heap, &top), DS_ERROR_EMPTY);
+    ASSERT_TRUE(pairing_heap_is_empty(heap));
+
+    pairing_heap_destroy(heap);
+}
+
+TEST(pairing_heap_meld) {
+    PairingHeap *a = pairing_heap_create(sizeof(int), HEAP_MAX, compare_int, count_destroy);
+    PairingHeap *b = pairing_heap_create(sizeof(int), HEAP_MAX, compare_int, count_destroy);
+    PairingHeap *min = pairing_heap_create(sizeof(int), HEAP_MIN, compare_int, NULL);
+
+    for (int i = 0; i < 100; i += 2) {
+        pairing_heap_insert(a, &i);
+    }
+    for (int i = 1; i < 100; i += 2) {
+        pairing_heap_insert(b, &i);
+    }
+
+    ASSERT_EQ(pairing_heap_meld(a, min), DS_ERROR_INVALID_PARAM);
+    ASSERT_EQ(pairing_heap_meld(a, a), DS_ERROR_INVALID_PARAM);
+    ASSERT_EQ(pairing_heap_meld(a, NULL), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(pairing_heap_meld(a, b), DS_SUCCESS);
+    ASSERT_EQ(pairing_heap_size(a), 100);
+    ASSERT_TRUE(pairing_heap_is_empty(b));
+
+    for (int expected = 99; expected >= 50; expected--) {
+        int v;
+        ASSERT_EQ(pairing_heap_extract(a, &v), DS_SUCCESS);
+        ASSERT_EQ(v, expected);
+    }
+
+    // O heap esvaziado pelo meld continua utilizável
+    int v = 7;
+    ASSERT_EQ(pairing_heap_insert(b, &v), DS_SUCCESS);
+
+    destroyed_count = 0;
+    pairing_heap_clear(a);
+    ASSERT_EQ(destroyed_count, 50);
+    ASSERT_TRUE(pairing_heap_is_empty(a));
+    pairing_heap_destroy(b);
+    ASSERT_EQ(destroyed_count, 51);
+
+    pairing_heap_destroy(a);
+    pairing_heap_destroy(min);
+}
+
+// ============================================================================
+// TESTES DA MULTIQUEUE
+// ============================================================================
+
+TEST(multiqueue_sequential) {
+    ASSERT_NULL(multiqueue_create(sizeof(int), 0, PQ_MIN, compare_int, NULL));
+    ASSERT_NULL(multiqueue_create(sizeof(int), 4, PQ_MIN, NULL, NULL));
+
+    // Com um único heap a ordem é exata
+    MultiQueue *single = multiqueue_create(sizeof(int), 1, PQ_MAX, compare_int, NULL);
+    for (int i = 0; i < 50; i++) {
+        int v = (i * 37) % 50;
+        ASSERT_EQ(multiqueue_insert(single, &v), DS_SUCCESS);
+    }
+    for (int expected = 49; expected >= 0; expected--) {
+        int v;
+        ASSERT_EQ(multiqueue_extract(single, &v), DS_SUCCESS);
+        ASSERT_EQ(v, expected);
+    }
+    ASSERT_EQ(multiqueue_extract(single, NULL), DS_ERROR_EMPTY);
+    multiqueue_destroy(single);
+
+    // Com vários heaps todo elemento sai exatamente uma vez
+    MultiQueue *mq = multiqueue_create(sizeof(int), 8, PQ_MIN, compare_int, NULL);
+    ASSERT_EQ(multiqueue_num_queues(mq), 8);
+    unsigned char seen[1000] = {0};
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(multiqueue_insert(mq, &i), DS_SUCCESS);
+    }
+    ASSERT_EQ(multiqueue_size(mq), 1000);
+    long rank_error = 0;
+    for (int i = 0; i < 1000; i++) {
+        int v;
+        ASSERT_EQ(multiqueue_extract(mq, &v), DS_SUCCESS);
+        ASSERT_TRUE(v >= 0 && v < 1000);
+        seen[v]++;
+        rank_error += labs((long)v - i);
+    }
+    for (int i = 0; i < 1000; i++) {
+        ASSERT_EQ(seen[i], 1);
+    }
+    // Relaxada, mas perto da ordem: erro médio de posto pequeno
+    ASSERT_TRUE(rank_error / 1000 < 64);
+    ASSERT_TRUE(multiqueue_is_empty(mq));
+    ASSERT_EQ(multiqueue_extract(mq, NULL), DS_ERROR_EMPTY);
+    multiqueue_destroy(mq);
+}
+
+TEST(multiqueue_threads) {
+#ifdef _OPENMP
+    // Threads inserem e extraem ao mesmo tempo: cada elemento sai uma vez
+    const int PER_THREAD = 5000;
+    MultiQueue *mq = multiqueue_create(sizeof(int), MULTIQUEUE_QUEUES_PER_THREAD * 4,
+                                       PQ_MIN, compare_int, NULL);
+    ASSERT_NOT_NULL(mq);
+    _Atomic unsigned char *seen = calloc((size_t)PER_THREAD * 4, 1);
+    ASSERT_NOT_NULL(seen);
+    int threads = 0;
+
+    #pragma omp parallel num_threads(4)
+    {
+        #pragma omp single
+        threads = omp_get_num_threads();
+        int id = omp_get_thread_num();
+        for (int i = 0; i < PER_THREAD; i++) {
+            int v = id * PER_THREAD + i;
+            multiqueue_insert(mq, &v);
+            int out;
+            if (i % 2 == 1 && multiqueue_extract(mq, &out) == DS_SUCCESS) {
+                seen[out]++;
+            }
+        }
+    }
+
+    int out;
+    while (multiqueue_extract(mq, &out) == DS_SUCCESS) {
+        seen[out]++;
+    }
+    for (int i = 0; i < threads * PER_THREAD; i++) {
+        ASSERT_EQ(seen[i], 1);
+    }
+    ASSERT_TRUE(multiqueue_is_empty(mq));
+    free((void *)seen);
+    multiqueue_destroy(mq);
+#endif
+}
+
 // ============================================================================
 // MAIN - RUNNER DE TESTES
 // ============================================================================
@@ -296,8 +662,25 @@ int main(void) {
     printf("\nDoubles:\n");
     RUN_TEST(doubles_min);
 
+    printf("\nFila Indexada:\n");
+    RUN_TEST(indexed_decrease_key);
+    RUN_TEST(indexed_random_against_reference);
+    RUN_TEST(indexed_errors);
+
+    printf("\nRadix Heap:\n");
+    RUN_TEST(radix_heap_monotone);
+    RUN_TEST(radix_heap_errors);
+
+    printf("\nPairing Heap:\n");
+    RUN_TEST(pairing_heap_order);
+    RUN_TEST(pairing_heap_meld);
+
+    printf("\nMultiQueue:\n");
+    RUN_TEST(multiqueue_sequential);
+    RUN_TEST(multiqueue_threads);
+
     printf("\n============================================\n");
-    printf("  TODOS OS TESTES PASSARAM! (12 testes)\n");
+    printf("  TODOS OS TESTES PASSARAM! (21 testes)\n");
     printf("============================================\n");
 
     return 0;
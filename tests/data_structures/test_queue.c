@@ -2,7 +2,8 @@
  * @file test_queue.c
  * @brief Testes unitários para Queue (FIFO)
  *
- * Testa ambas implementações: QUEUE_ARRAY (circular buffer) e QUEUE_LINKED
+ * Testa ambas implementações: QUEUE_ARRAY (circular buffer) e QUEUE_LINKED,
+ * e as filas concorrentes SPSC e MPMC (com threads OpenMP, se disponível)
  *
  * @author Algoritmos e Heurísticas
  * @date 2025
@@ -12,8 +13,13 @@
 #include "data_structures/common.h"
 #include "../test_macros.h"
 
+#include <stdint.h>
 #include <string.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 // ============================================================================
 // TESTES PARA QUEUE_ARRAY
 // ============================================================================
@@ -401,6 +407,318 @@ TEST(queue_null_pointer_checks) {
     queue_destroy(q);
 }
 
+// ============================================================================
+// TESTES DE OPERAÇÕES EM LOTE E ACESSO SEM CÓPIA
+// ============================================================================
+
+TEST(queue_array_batch_wraparound) {
+    Queue *q = queue_create(sizeof(int), QUEUE_ARRAY, 8, NULL);
+    ASSERT_NOT_NULL(q);
+    ASSERT_NULL(queue_front_ptr(q));
+
+    // Desloca head para o meio do buffer antes do lote que dá a volta
+    int values[20];
+    for (int i = 0; i < 20; i++) values[i] = i;
+    ASSERT_EQ(queue_enqueue_n(q, values, 6), DS_SUCCESS);
+    int out[20];
+    ASSERT_EQ(queue_dequeue_n(q, out, 5), 5);
+    for (int i = 0; i < 5; i++) ASSERT_EQ(out[i], i);
+
+    ASSERT_EQ(queue_enqueue_n(q, values + 6, 6), DS_SUCCESS);
+    ASSERT_EQ(queue_size(q), 7);
+    ASSERT_EQ(queue_capacity(q), 8);
+    ASSERT_EQ(*(const int*)queue_front_ptr(q), 5);
+
+    // Lote que não cabe: cresce uma vez e preserva a ordem
+    ASSERT_EQ(queue_enqueue_n(q, values + 12, 8), DS_SUCCESS);
+    ASSERT_EQ(queue_size(q), 15);
+    ASSERT_EQ(queue_dequeue_n(q, out, 20), 15);
+    for (int i = 0; i < 15; i++) ASSERT_EQ(out[i], i + 5);
+
+    ASSERT_EQ(queue_dequeue_n(q, out, 4), 0);
+    ASSERT_EQ(queue_enqueue_n(q, values, 0), DS_SUCCESS);
+    ASSERT_EQ(queue_enqueue_n(NULL, values, 1), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(queue_enqueue_n(q, NULL, 1), DS_ERROR_NULL_POINTER);
+
+    queue_destroy(q);
+}
+
+TEST(queue_linked_batch) {
+    Queue *q = queue_create(sizeof(int), QUEUE_LINKED, 0, NULL);
+    ASSERT_NOT_NULL(q);
+
+    int values[10];
+    for (int i = 0; i < 10; i++) values[i] = i * 3;
+    int one = -1;
+    ASSERT_EQ(queue_enqueue(q, &one), DS_SUCCESS);
+    ASSERT_EQ(queue_enqueue_n(q, values, 10), DS_SUCCESS);
+    ASSERT_EQ(queue_size(q), 11);
+    ASSERT_EQ(*(const int*)queue_front_ptr(q), -1);
+
+    int out[11];
+    ASSERT_EQ(queue_dequeue_n(q, out, 4), 4);
+    ASSERT_EQ(out[0], -1);
+    ASSERT_EQ(out[3], 6);
+    ASSERT_EQ(*(const int*)queue_front_ptr(q), 9);
+
+    ASSERT_EQ(queue_dequeue_n(q, NULL, 3), 3);
+    ASSERT_EQ(queue_dequeue_n(q, out, 11), 4);
+    for (int i = 0; i < 4; i++) ASSERT_EQ(out[i], (i + 6) * 3);
+    ASSERT_TRUE(queue_is_empty(q));
+    ASSERT_NULL(queue_front_ptr(q));
+
+    // A fila continua utilizável após esvaziar por lote
+    ASSERT_EQ(queue_enqueue_n(q, values, 2), DS_SUCCESS);
+    ASSERT_EQ(queue_dequeue(q, &one), DS_SUCCESS);
+    ASSERT_EQ(one, 0);
+
+    queue_destroy(q);
+}
+
+TEST(queue_memory_usage) {
+    // Array: o buffer inteiro, ocupado ou não
+    Queue *array = queue_create(sizeof(int), QUEUE_ARRAY, 32, NULL);
+    size_t reserved = queue_memory_usage(array);
+    ASSERT_TRUE(reserved >= 32 * sizeof(int));
+    int values[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    ASSERT_EQ(queue_enqueue_n(array, values, 10), DS_SUCCESS);
+    ASSERT_EQ(queue_memory_usage(array), reserved);
+    queue_destroy(array);
+
+    // Encadeada: cresce e encolhe com os elementos
+    Queue *linked = queue_create(sizeof(int), QUEUE_LINKED, 0, NULL);
+    size_t empty = queue_memory_usage(linked);
+    ASSERT_EQ(queue_enqueue_n(linked, values, 10), DS_SUCCESS);
+    size_t full = queue_memory_usage(linked);
+    ASSERT_TRUE(full > empty + 10 * sizeof(int));
+    int out;
+    ASSERT_EQ(queue_dequeue(linked, &out), DS_SUCCESS);
+    ASSERT_EQ(full - queue_memory_usage(linked), (full - empty) / 10);
+    queue_destroy(linked);
+
+    SPSCQueue *spsc = spsc_queue_create(sizeof(int), 64);
+    ASSERT_TRUE(spsc_queue_memory_usage(spsc) >= 64 * sizeof(int));
+    spsc_queue_destroy(spsc);
+    MPMCQueue *mpmc = mpmc_queue_create(sizeof(int), 64);
+    ASSERT_TRUE(mpmc_queue_memory_usage(mpmc) >= 64 * (sizeof(int) + sizeof(size_t)));
+    mpmc_queue_destroy(mpmc);
+
+    ASSERT_EQ(queue_memory_usage(NULL), 0);
+}
+
+// ============================================================================
+// TESTES PARA FILAS CONCORRENTES (SPSC / MPMC)
+// ============================================================================
+
+typedef struct {
+    uint32_t producer;
+    uint32_t seq;
+    uint32_t check;
+} Message;  // 12 bytes: posições que não são múltiplas de 8
+
+TEST(spsc_queue_sequential) {
+    ASSERT_NULL(spsc_queue_create(0, 8));
+    ASSERT_NULL(spsc_queue_create(sizeof(int), 0));
+
+    SPSCQueue *q = spsc_queue_create(sizeof(Message), 5);
+    ASSERT_NOT_NULL(q);
+    ASSERT_EQ(spsc_queue_capacity(q), 8);
+
+    Message m = {0, 0, 0}, out;
+    ASSERT_EQ(spsc_queue_dequeue(q, &out), DS_ERROR_EMPTY);
+    for (uint32_t i = 0; i < 8; i++) {
+        m.seq = i;
+        ASSERT_EQ(spsc_queue_enqueue(q, &m), DS_SUCCESS);
+    }
+    ASSERT_EQ(spsc_queue_enqueue(q, &m), DS_ERROR_FULL);
+    ASSERT_EQ(spsc_queue_size(q), 8);
+    for (uint32_t i = 0; i < 5; i++) {
+        ASSERT_EQ(spsc_queue_dequeue(q, &out), DS_SUCCESS);
+        ASSERT_EQ(out.seq, i);
+    }
+
+    // Lote que dá a volta no anel e lote maior que o espaço livre
+    Message batch[10];
+    for (uint32_t i = 0; i < 10; i++) batch[i] = (Message){1, 100 + i, i * 3};
+    ASSERT_EQ(spsc_queue_enqueue_batch(q, batch, 10), 5);
+    ASSERT_EQ(spsc_queue_enqueue_batch(q, batch, 1), 0);
+
+    Message got[16];
+    ASSERT_EQ(spsc_queue_dequeue_batch(q, got, 16), 8);
+    for (uint32_t i = 0; i < 3; i++) ASSERT_EQ(got[i].seq, 5 + i);
+    for (uint32_t i = 0; i < 5; i++) {
+        ASSERT_EQ(got[3 + i].seq, 100 + i);
+        ASSERT_EQ(got[3 + i].check, i * 3);
+    }
+    ASSERT_EQ(spsc_queue_dequeue_batch(q, got, 16), 0);
+    ASSERT_EQ(spsc_queue_size(q), 0);
+
+    ASSERT_EQ(spsc_queue_enqueue(NULL, &m), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(spsc_queue_dequeue(q, NULL), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(spsc_queue_capacity(NULL), 0);
+    spsc_queue_destroy(q);
+    spsc_queue_destroy(NULL);
+}
+
+TEST(mpmc_queue_sequential) {
+    ASSERT_NULL(mpmc_queue_create(0, 8));
+    MPMCQueue *q = mpmc_queue_create(sizeof(Message), 1);
+    ASSERT_NOT_NULL(q);
+    ASSERT_EQ(mpmc_queue_capacity(q), 2);
+    mpmc_queue_destroy(q);
+
+    q = mpmc_queue_create(sizeof(Message), 16);
+    Message m = {0, 0, 0}, out;
+    ASSERT_EQ(mpmc_queue_dequeue(q, &out), DS_ERROR_EMPTY);
+
+    // Várias voltas no anel alternando operações simples e em lote
+    uint32_t next_in = 0, next_out = 0;
+    Message batch[7], got[7];
+    for (int round = 0; round < 50; round++) {
+        for (uint32_t i = 0; i < 7; i++) batch[i] = (Message){2, next_in + i, ~(next_in + i)};
+        size_t n = mpmc_queue_enqueue_batch(q, batch, 7);
+        next_in += (uint32_t)n;
+        while (n == 7 && mpmc_queue_size(q) < 16) {
+            m.seq = next_in;
+            m.check = ~next_in;
+            if (mpmc_queue_enqueue(q, &m) != DS_SUCCESS) break;
+            next_in++;
+        }
+        if (mpmc_queue_size(q) == 16) {
+            ASSERT_EQ(mpmc_queue_enqueue(q, &m), DS_ERROR_FULL);
+            ASSERT_EQ(mpmc_queue_enqueue_batch(q, batch, 7), 0);
+        }
+
+        size_t k = mpmc_queue_dequeue_batch(q, got, 7);
+        for (size_t i = 0; i < k; i++) {
+            ASSERT_EQ(got[i].seq, next_out);
+            ASSERT_EQ(got[i].check, ~next_out);
+            next_out++;
+        }
+        if (mpmc_queue_dequeue(q, &out) == DS_SUCCESS) {
+            ASSERT_EQ(out.seq, next_out);
+            next_out++;
+        }
+        ASSERT_EQ(mpmc_queue_size(q), next_in - next_out);
+    }
+    while (mpmc_queue_dequeue(q, &out) == DS_SUCCESS) {
+        ASSERT_EQ(out.seq, next_out);
+        next_out++;
+    }
+    ASSERT_EQ(next_out, next_in);
+
+    ASSERT_EQ(mpmc_queue_enqueue(NULL, &m), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(mpmc_queue_dequeue(q, NULL), DS_ERROR_NULL_POINTER);
+    mpmc_queue_destroy(q);
+    mpmc_queue_destroy(NULL);
+}
+
+TEST(spsc_queue_threads) {
+#ifdef _OPENMP
+    // Produtor e consumidor em threads distintas; lotes de tamanhos variados
+    const uint32_t N = 20000;
+    SPSCQueue *q = spsc_queue_create(sizeof(uint32_t), 256);
+    ASSERT_NOT_NULL(q);
+    int threads = 0;
+    bool in_order = true;
+
+    #pragma omp parallel num_threads(2)
+    {
+        #pragma omp single
+        threads = omp_get_num_threads();
+        if (threads == 2 && omp_get_thread_num() == 0) {
+            uint32_t buffer[32];
+            for (uint32_t i = 0; i < N;) {
+                uint32_t want = 1 + i % 32 < N - i ? 1 + i % 32 : N - i;
+                for (uint32_t j = 0; j < want; j++) buffer[j] = i + j;
+                i += (uint32_t)spsc_queue_enqueue_batch(q, buffer, want);
+            }
+        } else if (threads == 2) {
+            uint32_t buffer[32], expected = 0, value;
+            while (expected < N) {
+                if (expected % 3 == 0) {
+                    if (spsc_queue_dequeue(q, &value) == DS_SUCCESS) {
+                        in_order = in_order && value == expected;
+                        expected++;
+                    }
+                    continue;
+                }
+                size_t n = spsc_queue_dequeue_batch(q, buffer, 1 + expected % 32);
+                for (size_t j = 0; j < n; j++) in_order = in_order && buffer[j] == expected + j;
+                expected += (uint32_t)n;
+            }
+        }
+    }
+
+    ASSERT_TRUE(in_order);
+    ASSERT_EQ(spsc_queue_size(q), 0);
+    spsc_queue_destroy(q);
+#endif
+}
+
+TEST(mpmc_queue_threads) {
+#ifdef _OPENMP
+    // 2 produtores e 2 consumidores: cada mensagem sai exatamente uma vez e,
+    // para cada consumidor, as de um mesmo produtor saem em ordem
+    const uint32_t PER_PRODUCER = 5000;
+    MPMCQueue *q = mpmc_queue_create(sizeof(Message), 128);
+    ASSERT_NOT_NULL(q);
+    unsigned char *seen = calloc(2 * PER_PRODUCER, 1);
+    ASSERT_NOT_NULL(seen);
+    int threads = 0;
+    bool ok = true;
+    _Atomic uint32_t consumed = 0;
+
+    #pragma omp parallel num_threads(4)
+    {
+        #pragma omp single
+        threads = omp_get_num_threads();
+        int id = omp_get_thread_num();
+        if (threads == 4 && id < 2) {
+            Message batch[8];
+            for (uint32_t i = 0; i < PER_PRODUCER;) {
+                uint32_t want = 1 + i % 8 < PER_PRODUCER - i ? 1 + i % 8 : PER_PRODUCER - i;
+                for (uint32_t j = 0; j < want; j++) {
+                    batch[j] = (Message){(uint32_t)id, i + j, (i + j) * 7 + (uint32_t)id};
+                }
+                i += (uint32_t)(want == 1 ? (mpmc_queue_enqueue(q, batch) == DS_SUCCESS)
+                                          : mpmc_queue_enqueue_batch(q, batch, want));
+            }
+        } else if (threads == 4) {
+            uint32_t last[2] = {0, 0};
+            bool any[2] = {false, false};
+            Message batch[8];
+            bool local_ok = true;
+            while (consumed < 2 * PER_PRODUCER) {
+                size_t n = mpmc_queue_dequeue_batch(q, batch, id == 2 ? 1 : 8);
+                for (size_t j = 0; j < n; j++) {
+                    Message m = batch[j];
+                    local_ok = local_ok && m.producer < 2 && m.seq < PER_PRODUCER &&
+                               m.check == m.seq * 7 + m.producer &&
+                               (!any[m.producer] || m.seq > last[m.producer]);
+                    if (m.producer < 2 && m.seq < PER_PRODUCER) {
+                        seen[m.producer * PER_PRODUCER + m.seq]++;
+                        last[m.producer] = m.seq;
+                        any[m.producer] = true;
+                    }
+                }
+                consumed += (uint32_t)n;
+            }
+            #pragma omp critical
+            ok = ok && local_ok;
+        }
+    }
+
+    if (threads == 4) {
+        ASSERT_TRUE(ok);
+        for (size_t i = 0; i < 2 * PER_PRODUCER; i++) ASSERT_EQ(seen[i], 1);
+        ASSERT_EQ(mpmc_queue_size(q), 0);
+    }
+    free(seen);
+    mpmc_queue_destroy(q);
+#endif
+}
+
 // ============================================================================
 // TESTE VISUAL (PRINT)
 // ============================================================================
@@ -464,11 +782,22 @@ int main(void) {
     printf("\nTestes de Erro:\n");
     RUN_TEST(queue_null_pointer_checks);
 
+    printf("\nOperações em Lote:\n");
+    RUN_TEST(queue_array_batch_wraparound);
+    RUN_TEST(queue_linked_batch);
+    RUN_TEST(queue_memory_usage);
+
+    printf("\nFilas Concorrentes:\n");
+    RUN_TEST(spsc_queue_sequential);
+    RUN_TEST(mpmc_queue_sequential);
+    RUN_TEST(spsc_queue_threads);
+    RUN_TEST(mpmc_queue_threads);
+
     printf("\nPrint Visual:\n");
     RUN_TEST(queue_print_visual);
 
     printf("\n============================================\n");
-    printf("  ✅ TODOS OS TESTES PASSARAM! (24 testes)\n");
+    printf("  ✅ TODOS OS TESTES PASSARAM! (27 testes)\n");
     printf("============================================\n");
 
     return 0;
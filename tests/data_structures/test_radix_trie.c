@@ -0,0 +1,299 @@
+/**
+ * @file test_radix_trie.c
+ * @brief Testes unitários para a trie compactada (ART)
+ *
+ * Compara com o Trie (trie.h) sob inserções e remoções aleatórias e testa
+ * as trocas de tipo de nó (4/16/48/256), prefixos comprimidos mais longos
+ * que RADIX_MAX_PREFIX, autocomplete e ordem com bytes acima de 127.
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/radix_trie.h"
+#include "data_structures/trie.h"
+#include "data_structures/arena.h"
+#include "data_structures/common.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <string.h>
+
+// ============================================================================
+// FUNÇÕES AUXILIARES DE TESTE
+// ============================================================================
+
+static void free_string_array(char **array, size_t count) {
+    if (array == NULL) return;
+    for (size_t i = 0; i < count; i++) {
+        free(array[i]);
+    }
+    free(array);
+}
+
+static uint32_t next_random(uint32_t *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 8;
+}
+
+// Palavra curta sobre {a, b, c, d}: muitos prefixos compartilhados
+static void random_word(uint32_t *state, char *out) {
+    size_t len = next_random(state) % 7;
+    for (size_t i = 0; i < len; i++) out[i] = (char)('a' + next_random(state) % 4);
+    out[len] = '\0';
+}
+
+// ============================================================================
+// TESTES
+// ============================================================================
+
+TEST(basic_operations) {
+    RadixTrie *trie = radix_trie_create();
+    ASSERT_NOT_NULL(trie);
+    ASSERT_TRUE(radix_trie_is_empty(trie));
+    ASSERT_FALSE(radix_trie_search(trie, ""));
+    ASSERT_FALSE(radix_trie_starts_with(trie, ""));
+
+    const char *words[] = {"car", "card", "care", "careful", "dog"};
+    for (size_t i = 0; i < 5; i++) ASSERT_EQ(radix_trie_insert(trie, words[i]), DS_SUCCESS);
+    ASSERT_EQ(radix_trie_insert(trie, "care"), DS_SUCCESS);
+    ASSERT_EQ(radix_trie_size(trie), 5);
+
+    ASSERT_TRUE(radix_trie_search(trie, "care"));
+    ASSERT_FALSE(radix_trie_search(trie, "ca"));
+    ASSERT_FALSE(radix_trie_search(trie, "cares"));
+    ASSERT_TRUE(radix_trie_starts_with(trie, "caref"));
+    ASSERT_TRUE(radix_trie_starts_with(trie, ""));
+    ASSERT_FALSE(radix_trie_starts_with(trie, "carefully"));
+
+    char **results = NULL;
+    size_t count = 0;
+    ASSERT_EQ(radix_trie_autocomplete(trie, "car", &results, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 4);
+    for (size_t i = 0; i < 4; i++) ASSERT_EQ(strcmp(results[i], words[i]), 0);
+    free_string_array(results, count);
+
+    ASSERT_EQ(radix_trie_autocomplete(trie, "xyz", &results, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 0);
+    ASSERT_NULL(results);
+
+    char *lcp = radix_trie_longest_common_prefix(trie);
+    ASSERT_EQ(strcmp(lcp, ""), 0);
+    free(lcp);
+    ASSERT_EQ(radix_trie_remove(trie, "dog"), DS_SUCCESS);
+    ASSERT_EQ(radix_trie_remove(trie, "dog"), DS_ERROR_NOT_FOUND);
+    lcp = radix_trie_longest_common_prefix(trie);
+    ASSERT_EQ(strcmp(lcp, "car"), 0);
+    free(lcp);
+
+    ASSERT_EQ(radix_trie_remove(trie, "car"), DS_SUCCESS);
+    ASSERT_FALSE(radix_trie_search(trie, "car"));
+    ASSERT_TRUE(radix_trie_search(trie, "card"));
+    ASSERT_TRUE(radix_trie_starts_with(trie, "car"));
+
+    radix_trie_clear(trie);
+    ASSERT_TRUE(radix_trie_is_empty(trie));
+    ASSERT_EQ(radix_trie_memory_usage(trie), 0);
+    ASSERT_EQ(radix_trie_insert(trie, ""), DS_SUCCESS);
+    ASSERT_TRUE(radix_trie_search(trie, ""));
+    ASSERT_TRUE(radix_trie_starts_with(trie, ""));
+    radix_trie_destroy(trie);
+}
+
+TEST(random_operations_match_trie) {
+    RadixTrie *radix = radix_trie_create();
+    Trie *trie = trie_create(26);
+    uint32_t state = 2025u;
+    char word[16];
+
+    for (int op = 0; op < 20000; op++) {
+        random_word(&state, word);
+        if (next_random(&state) % 3 != 0) {
+            ASSERT_EQ(radix_trie_insert(radix, word), DS_SUCCESS);
+            ASSERT_EQ(trie_insert(trie, word), DS_SUCCESS);
+        } else {
+            ASSERT_EQ(radix_trie_remove(radix, word), trie_remove(trie, word));
+        }
+        ASSERT_EQ(radix_trie_size(radix), trie_size(trie));
+
+        random_word(&state, word);
+        ASSERT_EQ(radix_trie_search(radix, word), trie_search(trie, word));
+        // O Trie responde true para "" mesmo vazio (a raiz sempre existe)
+        if (word[0] != '\0' || trie_size(trie) > 0) {
+            ASSERT_EQ(radix_trie_starts_with(radix, word), trie_starts_with(trie, word));
+        }
+    }
+
+    char **a = NULL, **b = NULL;
+    size_t na = 0, nb = 0;
+    ASSERT_EQ(radix_trie_to_array(radix, &a, &na), DS_SUCCESS);
+    ASSERT_EQ(trie_to_array(trie, &b, &nb), DS_SUCCESS);
+    ASSERT_EQ(na, nb);
+    for (size_t i = 0; i < na; i++) ASSERT_EQ(strcmp(a[i], b[i]), 0);
+    free_string_array(a, na);
+    free_string_array(b, nb);
+
+    const char *prefixes[] = {"", "a", "ab", "cdd", "dddd"};
+    for (size_t p = 0; p < 5; p++) {
+        ASSERT_EQ(radix_trie_autocomplete(radix, prefixes[p], &a, &na), DS_SUCCESS);
+        ASSERT_EQ(trie_autocomplete(trie, prefixes[p], &b, &nb), DS_SUCCESS);
+        ASSERT_EQ(na, nb);
+        for (size_t i = 0; i < na; i++) ASSERT_EQ(strcmp(a[i], b[i]), 0);
+        free_string_array(a, na);
+        free_string_array(b, nb);
+    }
+
+    radix_trie_destroy(radix);
+    trie_destroy(trie);
+}
+
+TEST(node_growth_and_shrink) {
+    // "k" seguido de cada byte 1..255: a raiz passa por Node4, 16, 48 e 256
+    RadixTrie *trie = radix_trie_create();
+    char key[3] = {'k', 0, 0};
+    size_t memory[256];
+    memory[0] = 0;
+    for (int b = 1; b < 256; b++) {
+        key[1] = (char)b;
+        ASSERT_EQ(radix_trie_insert(trie, key), DS_SUCCESS);
+        memory[b] = radix_trie_memory_usage(trie);
+    }
+    ASSERT_EQ(radix_trie_size(trie), 255);
+    ASSERT_FALSE(radix_trie_search(trie, "k"));
+    ASSERT_TRUE(radix_trie_starts_with(trie, "k"));
+    ASSERT_FALSE(radix_trie_search(trie, "kk\x01"));
+
+    // Ordem de strcmp: bytes sem sinal
+    char **all = NULL;
+    size_t count = 0;
+    ASSERT_EQ(radix_trie_to_array(trie, &all, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 255);
+    for (size_t i = 1; i < count; i++) ASSERT_TRUE(strcmp(all[i - 1], all[i]) < 0);
+    free_string_array(all, count);
+
+    // Remove de trás para frente: os nós encolhem e a memória volta a cair
+    for (int b = 255; b >= 1; b--) {
+        key[1] = (char)b;
+        ASSERT_EQ(radix_trie_remove(trie, key), DS_SUCCESS);
+        ASSERT_FALSE(radix_trie_search(trie, key));
+        if (b > 1) {
+            key[1] = (char)(b - 1);
+            ASSERT_TRUE(radix_trie_search(trie, key));
+        }
+        ASSERT_TRUE(radix_trie_memory_usage(trie) <= memory[b - 1] + sizeof(void*) * 256);
+    }
+    ASSERT_TRUE(radix_trie_is_empty(trie));
+    ASSERT_EQ(radix_trie_memory_usage(trie), 0);
+    radix_trie_destroy(trie);
+}
+
+TEST(long_compressed_prefixes) {
+    RadixTrie *trie = radix_trie_create();
+    char url[96];
+    for (int i = 0; i < 3000; i++) {
+        snprintf(url, sizeof(url), "https://www.example.com/catalog/section-%02d/item-%05d",
+                 i % 7, i * 13);
+        ASSERT_EQ(radix_trie_insert(trie, url), DS_SUCCESS);
+    }
+    ASSERT_EQ(radix_trie_size(trie), 3000);
+
+    char *lcp = radix_trie_longest_common_prefix(trie);
+    ASSERT_EQ(strcmp(lcp, "https://www.example.com/catalog/section-0"), 0);
+    free(lcp);
+
+    // Divergências em bytes não guardados no nó (além de RADIX_MAX_PREFIX)
+    ASSERT_FALSE(radix_trie_search(trie, "https://www.exampXe.com/catalog/section-00/item-00000"));
+    ASSERT_FALSE(radix_trie_starts_with(trie, "https://www.exampXe"));
+    ASSERT_TRUE(radix_trie_search(trie, "https://www.example.com/catalog/section-00/item-00000"));
+    ASSERT_TRUE(radix_trie_starts_with(trie, "https://www.example.com/cat"));
+
+    // Insere uma divergência no meio do prefixo longo e outra antes dele
+    ASSERT_EQ(radix_trie_insert(trie, "https://www.exampXe.com/"), DS_SUCCESS);
+    ASSERT_EQ(radix_trie_insert(trie, "http://"), DS_SUCCESS);
+    ASSERT_TRUE(radix_trie_search(trie, "https://www.exampXe.com/"));
+    ASSERT_TRUE(radix_trie_search(trie, "http://"));
+    ASSERT_TRUE(radix_trie_search(trie, "https://www.example.com/catalog/section-01/item-00013"));
+
+    char **results = NULL;
+    size_t count = 0;
+    ASSERT_EQ(radix_trie_autocomplete(trie, "https://www.example.com/catalog/section-03/", &results,
+                                      &count), DS_SUCCESS);
+    ASSERT_EQ(count, 3000 / 7 + (3000 % 7 > 3));
+    free_string_array(results, count);
+
+    // Remover as divergências funde os nós de volta
+    ASSERT_EQ(radix_trie_remove(trie, "https://www.exampXe.com/"), DS_SUCCESS);
+    ASSERT_EQ(radix_trie_remove(trie, "http://"), DS_SUCCESS);
+    for (int i = 0; i < 3000; i += 2) {
+        snprintf(url, sizeof(url), "https://www.example.com/catalog/section-%02d/item-%05d",
+                 i % 7, i * 13);
+        ASSERT_EQ(radix_trie_remove(trie, url), DS_SUCCESS);
+    }
+    for (int i = 0; i < 3000; i++) {
+        snprintf(url, sizeof(url), "https://www.example.com/catalog/section-%02d/item-%05d",
+                 i % 7, i * 13);
+        ASSERT_EQ(radix_trie_search(trie, url), i % 2 == 1);
+    }
+
+    // Folhas com a chave mais alguns nós pequenos: bem abaixo de um nó de Trie por byte
+    ASSERT_TRUE(radix_trie_memory_usage(trie) < 1500 * 160);
+    radix_trie_destroy(trie);
+}
+
+TEST(arena_allocator) {
+    DSArena *arena = ds_arena_create(0);
+    DSAllocator alloc = ds_arena_allocator(arena);
+    RadixTrie *trie = radix_trie_create_with_allocator(&alloc);
+    ASSERT_NOT_NULL(trie);
+
+    char key[8];
+    for (int i = 0; i < 500; i++) {
+        snprintf(key, sizeof(key), "w%d", i);
+        ASSERT_EQ(radix_trie_insert(trie, key), DS_SUCCESS);
+    }
+    ASSERT_EQ(radix_trie_remove(trie, "w250"), DS_SUCCESS);
+    ASSERT_FALSE(radix_trie_search(trie, "w250"));
+    ASSERT_TRUE(radix_trie_starts_with(trie, "w25"));
+
+    radix_trie_destroy(trie);
+    ASSERT_EQ(ds_arena_bytes_used(arena), 0);
+    ds_arena_destroy(arena);
+}
+
+TEST(null_pointer_checks) {
+    char **results;
+    size_t count;
+    ASSERT_EQ(radix_trie_insert(NULL, "hello"), DS_ERROR_NULL_POINTER);
+    ASSERT_FALSE(radix_trie_search(NULL, "hello"));
+    ASSERT_FALSE(radix_trie_starts_with(NULL, "he"));
+    ASSERT_EQ(radix_trie_remove(NULL, "hello"), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(radix_trie_autocomplete(NULL, "he", &results, &count), DS_ERROR_NULL_POINTER);
+    ASSERT_NULL(radix_trie_longest_common_prefix(NULL));
+    ASSERT_TRUE(radix_trie_is_empty(NULL));
+    ASSERT_EQ(radix_trie_size(NULL), 0);
+
+    RadixTrie *trie = radix_trie_create();
+    ASSERT_EQ(radix_trie_insert(trie, NULL), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(radix_trie_remove(trie, NULL), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(radix_trie_remove(trie, "x"), DS_ERROR_NOT_FOUND);
+    radix_trie_destroy(trie);
+    radix_trie_destroy(NULL);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Radix Trie (ART) Tests ===\n");
+
+    RUN_TEST(basic_operations);
+    RUN_TEST(random_operations_match_trie);
+    RUN_TEST(node_growth_and_shrink);
+    RUN_TEST(long_compressed_prefixes);
+    RUN_TEST(arena_allocator);
+    RUN_TEST(null_pointer_checks);
+
+    printf("\nAll Radix Trie tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,223 @@
+/**
+ * @file test_range_query.c
+ * @brief Testes unitários para as estruturas de consulta por intervalo
+ *        (Fenwick tree e segment tree)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/fenwick_tree.h"
+#include "data_structures/segment_tree.h"
+#include "data_structures/arena.h"
+#include "../test_macros.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+static uint64_t rng_state = 0x9E3779B97F4A7C15ULL;
+
+static uint64_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+// ============================================================================
+// TESTES: FENWICK TREE
+// ============================================================================
+
+TEST(fenwick_build_and_prefix_sums) {
+    int64_t values[] = {5, -2, 7, 0, 3, 3, -8, 10, 1};
+    size_t n = sizeof(values) / sizeof(values[0]);
+    FenwickTree *ft = fenwick_create(values, n);
+    ASSERT_NOT_NULL(ft);
+    ASSERT_EQ(fenwick_size(ft), n);
+
+    int64_t expected = 0;
+    for (size_t i = 0; i <= n; i++) {
+        ASSERT_EQ(fenwick_prefix_sum(ft, i), expected);
+        if (i < n) {
+            ASSERT_EQ(fenwick_get(ft, i), values[i]);
+            expected += values[i];
+        }
+    }
+    ASSERT_EQ(fenwick_prefix_sum(ft, n + 100), expected);
+    ASSERT_EQ(fenwick_range_sum(ft, 2, 5), 7 + 0 + 3);
+    ASSERT_EQ(fenwick_range_sum(ft, 5, 2), 0);
+
+    ASSERT_EQ(fenwick_add(ft, 3, 4), DS_SUCCESS);
+    ASSERT_EQ(fenwick_set(ft, 0, -1), DS_SUCCESS);
+    ASSERT_EQ(fenwick_get(ft, 3), 4);
+    ASSERT_EQ(fenwick_get(ft, 0), -1);
+    ASSERT_EQ(fenwick_prefix_sum(ft, n), expected + 4 - 6);
+    ASSERT_EQ(fenwick_add(ft, n, 1), DS_ERROR_INVALID_INDEX);
+    fenwick_destroy(ft);
+}
+
+TEST(fenwick_random_against_array) {
+    const size_t N = 1000;
+    int64_t *naive = calloc(N, sizeof(int64_t));
+    DSArena *arena = ds_arena_create(0);
+    DSAllocator alloc = ds_arena_allocator(arena);
+    FenwickTree *ft = fenwick_create_with_allocator(NULL, N, &alloc);
+    ASSERT_NOT_NULL(ft);
+
+    for (int op = 0; op < 20000; op++) {
+        size_t a = (size_t)(next_random() % N);
+        size_t b = (size_t)(next_random() % (N + 1));
+        if (op % 2 == 0) {
+            int64_t delta = (int64_t)(next_random() % 201) - 100;
+            naive[a] += delta;
+            ASSERT_EQ(fenwick_add(ft, a, delta), DS_SUCCESS);
+        } else {
+            size_t lo = a < b ? a : b;
+            size_t hi = a < b ? b : a;
+            int64_t sum = 0;
+            for (size_t i = lo; i < hi; i++) {
+                sum += naive[i];
+            }
+            ASSERT_EQ(fenwick_range_sum(ft, lo, hi), sum);
+        }
+    }
+    fenwick_destroy(ft);
+    ds_arena_destroy(arena);
+    free(naive);
+}
+
+TEST(fenwick_lower_bound_on_weights) {
+    // Pesos 0..: o k-ésimo item (1 a total) cai no índice certo
+    int64_t weights[] = {3, 0, 1, 4, 0, 2};
+    FenwickTree *ft = fenwick_create(weights, 6);
+    size_t expected[] = {0, 0, 0, 0, 2, 3, 3, 3, 3, 5, 5};
+    for (int64_t k = 0; k <= 10; k++) {
+        ASSERT_EQ(fenwick_lower_bound(ft, k), expected[k]);
+    }
+    ASSERT_EQ(fenwick_lower_bound(ft, 11), 6);
+    fenwick_destroy(ft);
+}
+
+// ============================================================================
+// TESTES: SEGMENT TREE
+// ============================================================================
+
+TEST(segment_tree_basic_queries) {
+    int64_t values[] = {4, -1, 9, 2, 2, 7, -5};
+    SegmentTree *st = segment_tree_create(values, 7);
+    ASSERT_NOT_NULL(st);
+    ASSERT_EQ(segment_tree_size(st), 7);
+
+    RangeAggregate agg;
+    ASSERT_EQ(segment_tree_query(st, 0, 7, &agg), DS_SUCCESS);
+    ASSERT_EQ(agg.sum, 18);
+    ASSERT_EQ(agg.min, -5);
+    ASSERT_EQ(agg.max, 9);
+
+    ASSERT_EQ(segment_tree_range_add(st, 1, 4, 10), DS_SUCCESS);
+    ASSERT_EQ(segment_tree_query(st, 1, 3, &agg), DS_SUCCESS);
+    ASSERT_EQ(agg.sum, 9 + 19);
+    ASSERT_EQ(agg.min, 9);
+    ASSERT_EQ(agg.max, 19);
+
+    ASSERT_EQ(segment_tree_set(st, 2, 0), DS_SUCCESS);
+    int64_t v = 0;
+    ASSERT_EQ(segment_tree_get(st, 2, &v), DS_SUCCESS);
+    ASSERT_EQ(v, 0);
+    ASSERT_EQ(segment_tree_get(st, 3, &v), DS_SUCCESS);
+    ASSERT_EQ(v, 12);
+
+    ASSERT_EQ(segment_tree_query(st, 3, 3, &agg), DS_ERROR_INVALID_INDEX);
+    ASSERT_EQ(segment_tree_query(st, 0, 8, &agg), DS_ERROR_INVALID_INDEX);
+    ASSERT_EQ(segment_tree_range_add(st, 4, 4, 1), DS_SUCCESS);
+    ASSERT_EQ(segment_tree_range_add(st, 5, 4, 1), DS_ERROR_INVALID_INDEX);
+    segment_tree_destroy(st);
+}
+
+TEST(segment_tree_random_against_array) {
+    // n não potência de 2: exercita as folhas de preenchimento
+    const size_t N = 777;
+    int64_t *naive = malloc(N * sizeof(int64_t));
+    for (size_t i = 0; i < N; i++) {
+        naive[i] = (int64_t)(next_random() % 1000) - 500;
+    }
+    SegmentTree *st = segment_tree_create(naive, N);
+    ASSERT_NOT_NULL(st);
+
+    for (int op = 0; op < 20000; op++) {
+        size_t a = (size_t)(next_random() % N);
+        size_t b = (size_t)(next_random() % N);
+        size_t lo = a < b ? a : b;
+        size_t hi = (a < b ? b : a) + 1;
+        int kind = (int)(next_random() % 3);
+        if (kind == 0) {
+            int64_t delta = (int64_t)(next_random() % 201) - 100;
+            for (size_t i = lo; i < hi; i++) {
+                naive[i] += delta;
+            }
+            ASSERT_EQ(segment_tree_range_add(st, lo, hi, delta), DS_SUCCESS);
+        } else if (kind == 1) {
+            int64_t value = (int64_t)(next_random() % 1000) - 500;
+            naive[a] = value;
+            ASSERT_EQ(segment_tree_set(st, a, value), DS_SUCCESS);
+        } else {
+            RangeAggregate expected = {0, INT64_MAX, INT64_MIN};
+            for (size_t i = lo; i < hi; i++) {
+                expected.sum += naive[i];
+                if (naive[i] < expected.min) expected.min = naive[i];
+                if (naive[i] > expected.max) expected.max = naive[i];
+            }
+            RangeAggregate agg;
+            ASSERT_EQ(segment_tree_query(st, lo, hi, &agg), DS_SUCCESS);
+            ASSERT_EQ(agg.sum, expected.sum);
+            ASSERT_EQ(agg.min, expected.min);
+            ASSERT_EQ(agg.max, expected.max);
+        }
+    }
+    for (size_t i = 0; i < N; i++) {
+        int64_t v = 0;
+        ASSERT_EQ(segment_tree_get(st, i, &v), DS_SUCCESS);
+        ASSERT_EQ(v, naive[i]);
+    }
+    segment_tree_destroy(st);
+    free(naive);
+}
+
+TEST(range_query_invalid_arguments) {
+    RangeAggregate agg;
+    int64_t v;
+    ASSERT_NULL(fenwick_create(NULL, 0));
+    ASSERT_EQ(fenwick_add(NULL, 0, 1), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(fenwick_prefix_sum(NULL, 3), 0);
+    ASSERT_EQ(fenwick_size(NULL), 0);
+    fenwick_destroy(NULL);
+
+    ASSERT_NULL(segment_tree_create(NULL, 0));
+    ASSERT_EQ(segment_tree_range_add(NULL, 0, 1, 1), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(segment_tree_query(NULL, 0, 1, &agg), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(segment_tree_get(NULL, 0, &v), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(segment_tree_size(NULL), 0);
+    segment_tree_destroy(NULL);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Range Query Tests ===\n");
+
+    printf("\nFenwick tree:\n");
+    RUN_TEST(fenwick_build_and_prefix_sums);
+    RUN_TEST(fenwick_random_against_array);
+    RUN_TEST(fenwick_lower_bound_on_weights);
+
+    printf("\nSegment tree:\n");
+    RUN_TEST(segment_tree_basic_queries);
+    RUN_TEST(segment_tree_random_against_array);
+
+    RUN_TEST(range_query_invalid_arguments);
+
+    printf("\nAll range query tests passed!\n");
+    return 0;
+}
@@ -390,6 +390,68 @@ TEST(stack_null_pointer_checks) {
     stack_destroy(s);
 }
 
+// ============================================================================
+// TESTES DE OPERAÇÕES EM LOTE E ACESSO SEM CÓPIA
+// ============================================================================
+
+TEST(stack_array_batch) {
+    Stack *s = stack_create(sizeof(int), STACK_ARRAY, 4, NULL);
+    ASSERT_NOT_NULL(s);
+    ASSERT_NULL(stack_top_ptr(s));
+
+    int values[20];
+    for (int i = 0; i < 20; i++) values[i] = i;
+    ASSERT_EQ(stack_push_n(s, values, 20), DS_SUCCESS);
+    ASSERT_EQ(stack_size(s), 20);
+    ASSERT_EQ(*(const int*)stack_top_ptr(s), 19);
+
+    // pop_n devolve na ordem de empilhamento: desfaz o push_n
+    int out[20];
+    ASSERT_EQ(stack_pop_n(s, out, 5), 5);
+    for (int i = 0; i < 5; i++) ASSERT_EQ(out[i], 15 + i);
+    ASSERT_EQ(*(const int*)stack_top_ptr(s), 14);
+
+    int top;
+    ASSERT_EQ(stack_pop(s, &top), DS_SUCCESS);
+    ASSERT_EQ(top, 14);
+    ASSERT_EQ(stack_pop_n(s, NULL, 4), 4);
+    ASSERT_EQ(stack_pop_n(s, out, 100), 10);
+    for (int i = 0; i < 10; i++) ASSERT_EQ(out[i], i);
+    ASSERT_TRUE(stack_is_empty(s));
+    ASSERT_EQ(stack_pop_n(s, out, 1), 0);
+
+    ASSERT_EQ(stack_push_n(NULL, values, 1), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(stack_push_n(s, NULL, 1), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(stack_push_n(s, values, 0), DS_SUCCESS);
+
+    stack_destroy(s);
+}
+
+TEST(stack_linked_batch) {
+    Stack *s = stack_create(sizeof(int), STACK_LINKED, 0, NULL);
+    ASSERT_NOT_NULL(s);
+
+    int base = -1;
+    ASSERT_EQ(stack_push(s, &base), DS_SUCCESS);
+    int values[8];
+    for (int i = 0; i < 8; i++) values[i] = i * 10;
+    ASSERT_EQ(stack_push_n(s, values, 8), DS_SUCCESS);
+    ASSERT_EQ(stack_size(s), 9);
+    ASSERT_EQ(*(const int*)stack_top_ptr(s), 70);
+
+    int top;
+    ASSERT_EQ(stack_pop(s, &top), DS_SUCCESS);
+    ASSERT_EQ(top, 70);
+
+    int out[9];
+    ASSERT_EQ(stack_pop_n(s, out, 9), 8);
+    ASSERT_EQ(out[0], -1);
+    for (int i = 1; i < 8; i++) ASSERT_EQ(out[i], (i - 1) * 10);
+    ASSERT_NULL(stack_top_ptr(s));
+
+    stack_destroy(s);
+}
+
 // ============================================================================
 // TESTE VISUAL
 // ============================================================================
@@ -453,11 +515,15 @@ int main(void) {
     printf("\nTestes de Erro:\n");
     RUN_TEST(stack_null_pointer_checks);
 
+    printf("\nOperações em Lote:\n");
+    RUN_TEST(stack_array_batch);
+    RUN_TEST(stack_linked_batch);
+
     printf("\nPrint Visual:\n");
     RUN_TEST(stack_print_visual);
 
     printf("\n============================================\n");
-    printf("  ✅ TODOS OS TESTES PASSARAM! (23 testes)\n");
+    printf("  ✅ TODOS OS TESTES PASSARAM! (25 testes)\n");
     printf("============================================\n");
 
     return 0;
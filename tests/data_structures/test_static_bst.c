@@ -0,0 +1,130 @@
+/**
+ * @file test_static_bst.c
+ * @brief Testes unitários para a árvore de busca estática (Eytzinger e vEB)
+ *
+ * @author Algoritmos e Heurísticas
+ * @date 2025
+ */
+
+#include "data_structures/static_bst.h"
+#include "data_structures/bst.h"
+#include "data_structures/common.h"
+#include "../test_macros.h"
+
+#include <string.h>
+
+static const StaticBSTLayout layouts[] = {STATIC_BST_EYTZINGER, STATIC_BST_VEB};
+
+// ============================================================================
+// TESTES
+// ============================================================================
+
+TEST(veb_layout_order) {
+    // Árvore perfeita de altura 4: topo {8, 4, 12} e quatro subárvores de baixo
+    int sorted[15];
+    for (int i = 0; i < 15; i++) sorted[i] = i + 1;
+    StaticBST *tree = static_bst_create(sorted, 15, sizeof(int), compare_int, STATIC_BST_VEB);
+    ASSERT_NOT_NULL(tree);
+    const int expected[15] = {8, 4, 12, 2, 1, 3, 6, 5, 7, 10, 9, 11, 14, 13, 15};
+    size_t slots = 0;
+    const int *data = static_bst_data(tree, &slots);
+    ASSERT_EQ(slots, 15);
+    for (size_t i = 0; i < 15; i++) ASSERT_EQ(data[i], expected[i]);
+    static_bst_destroy(tree);
+
+    // Eytzinger: ordem BFS
+    tree = static_bst_create(sorted, 7, sizeof(int), compare_int, STATIC_BST_EYTZINGER);
+    ASSERT_NOT_NULL(tree);
+    const int bfs[7] = {4, 2, 6, 1, 3, 5, 7};
+    data = static_bst_data(tree, &slots);
+    ASSERT_EQ(slots, 7);
+    for (size_t i = 0; i < 7; i++) ASSERT_EQ(data[i], bfs[i]);
+    static_bst_destroy(tree);
+}
+
+TEST(search_matches_bst) {
+    // Chaves pares: ímpares nunca estão presentes
+    int sorted[1000];
+    for (int i = 0; i < 1000; i++) sorted[i] = 2 * i;
+
+    for (size_t n = 0; n <= 1000; n += (n < 70) ? 1 : 331) {
+        BST *bst = (n > 0) ? bst_from_sorted_array(sizeof(int), sorted, n, compare_int, NULL) : NULL;
+        for (size_t l = 0; l < 2; l++) {
+            StaticBST *tree = static_bst_create(sorted, n, sizeof(int), compare_int, layouts[l]);
+            ASSERT_NOT_NULL(tree);
+            ASSERT_EQ(static_bst_size(tree), n);
+            ASSERT_EQ(static_bst_layout(tree), layouts[l]);
+            for (int key = -1; key <= 2 * (int)n; key++) {
+                int got = -7, ref = -7;
+                DataStructureError expected = (bst != NULL) ? bst_search(bst, &key, &ref)
+                                                            : DS_ERROR_NOT_FOUND;
+                ASSERT_EQ(static_bst_search(tree, &key, &got), expected);
+                if (expected == DS_SUCCESS) ASSERT_EQ(got, ref);
+                ASSERT_EQ(static_bst_contains(tree, &key), expected == DS_SUCCESS);
+
+                // lower bound: menor par >= key
+                int lb = -7;
+                int want = (key <= 0) ? 0 : ((key + 1) / 2) * 2;
+                if (want < 2 * (int)n) {
+                    ASSERT_EQ(static_bst_lower_bound(tree, &key, &lb), DS_SUCCESS);
+                    ASSERT_EQ(lb, want);
+                } else {
+                    ASSERT_EQ(static_bst_lower_bound(tree, &key, &lb), DS_ERROR_NOT_FOUND);
+                }
+            }
+            static_bst_destroy(tree);
+        }
+        bst_destroy(bst);
+    }
+}
+
+TEST(duplicates_and_wide_elements) {
+    typedef struct { int key; char payload[20]; } Record;
+    Record records[100];
+    for (int i = 0; i < 100; i++) {
+        records[i].key = i / 4;               // cada chave aparece 4 vezes
+        memset(records[i].payload, 'a' + i % 26, sizeof(records[i].payload));
+    }
+    for (size_t l = 0; l < 2; l++) {
+        StaticBST *tree = static_bst_create(records, 100, sizeof(Record), compare_int, layouts[l]);
+        ASSERT_NOT_NULL(tree);
+        for (int k = 0; k < 25; k++) {
+            Record probe = {k, {0}}, out;
+            ASSERT_EQ(static_bst_search(tree, &probe, &out), DS_SUCCESS);
+            ASSERT_EQ(out.key, k);
+            // lower bound devolve a primeira cópia da chave
+            ASSERT_EQ(static_bst_lower_bound(tree, &probe, &out), DS_SUCCESS);
+            ASSERT_EQ(out.payload[0], records[4 * k].payload[0]);
+        }
+        static_bst_destroy(tree);
+    }
+}
+
+TEST(invalid_arguments) {
+    int v = 1, out;
+    ASSERT_NULL(static_bst_create(NULL, 3, sizeof(int), compare_int, STATIC_BST_VEB));
+    ASSERT_NULL(static_bst_create(&v, 1, sizeof(int), NULL, STATIC_BST_VEB));
+    ASSERT_NULL(static_bst_create(&v, 1, 0, compare_int, STATIC_BST_EYTZINGER));
+    ASSERT_EQ(static_bst_search(NULL, &v, &out), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(static_bst_lower_bound(NULL, &v, &out), DS_ERROR_NULL_POINTER);
+    ASSERT_FALSE(static_bst_contains(NULL, &v));
+    ASSERT_EQ(static_bst_size(NULL), 0);
+    ASSERT_NULL(static_bst_data(NULL, NULL));
+    static_bst_destroy(NULL);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Static BST Tests ===\n");
+
+    RUN_TEST(veb_layout_order);
+    RUN_TEST(search_matches_bst);
+    RUN_TEST(duplicates_and_wide_elements);
+    RUN_TEST(invalid_arguments);
+
+    printf("\nAll Static BST tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,216 @@
+/**
+ * @file test_thread_pool.c
+ * @brief Testes unitarios do pool global com work stealing
+ *
+ * Testa configuracao de threads, fork-join aninhado (fib recursivo),
+ * parallel_for com e sem grain, threads de regioes OpenMP aninhadas,
+ * invoke, execucao serial com uma thread e recriacao do pool ao mudar o
+ * numero de threads.
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "data_structures/thread_pool.h"
+#include "../test_macros.h"
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+typedef struct {
+    int n;
+    long result;
+} FibArgs;
+
+static void fib_task(void *arg) {
+    FibArgs *a = arg;
+    if (a->n < 2) {
+        a->result = a->n;
+        return;
+    }
+    FibArgs left = {a->n - 1, 0};
+    FibArgs right = {a->n - 2, 0};
+    DSTaskGroup group;
+    ds_task_group_init(&group);
+    ds_task_spawn(&group, fib_task, &left);
+    fib_task(&right);
+    ds_task_wait(&group);
+    a->result = left.result + right.result;
+}
+
+static void mark_range(void *ctx, size_t lo, size_t hi) {
+    atomic_int *hits = ctx;
+    for (size_t i = lo; i < hi; i++) atomic_fetch_add(&hits[i], 1);
+}
+
+static void increment(void *arg) {
+    atomic_fetch_add((atomic_int *)arg, 1);
+}
+
+static atomic_size_t max_index_seen;
+
+static atomic_size_t region_threads_seen;
+
+static void record_region_threads(void *ctx, size_t lo, size_t hi) {
+    (void)ctx;
+    (void)lo;
+    (void)hi;
+    size_t t = ds_region_threads(0);
+    if (t > atomic_load(&region_threads_seen)) atomic_store(&region_threads_seen, t);
+}
+
+static void record_index(void *ctx, size_t lo, size_t hi) {
+    (void)ctx;
+    (void)lo;
+    (void)hi;
+    size_t idx = ds_thread_index();
+    size_t cur = atomic_load(&max_index_seen);
+    while (idx > cur && !atomic_compare_exchange_weak(&max_index_seen, &cur, idx)) {
+    }
+}
+
+static bool all_hit_once(atomic_int *hits, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        if (atomic_load(&hits[i]) != 1) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// TESTES
+// ============================================================================
+
+TEST(thread_count_setting) {
+    ds_set_num_threads(3);
+    ASSERT_EQ(ds_get_num_threads(), 3);
+    ASSERT_EQ(ds_resolve_threads(0), 3);
+    ASSERT_EQ(ds_resolve_threads(5), 5);
+
+    ds_set_num_threads(0);
+    ASSERT_TRUE(ds_get_num_threads() >= 1);
+    ASSERT_EQ(ds_thread_index(), 0);
+}
+
+TEST(nested_fork_join) {
+    ds_set_num_threads(4);
+    FibArgs args = {22, 0};
+    fib_task(&args);
+    ASSERT_EQ(args.result, 17711);
+}
+
+TEST(parallel_for_covers_range) {
+    ds_set_num_threads(4);
+    size_t n = 100003;
+    atomic_int *hits = calloc(n, sizeof(atomic_int));
+    ASSERT_NOT_NULL(hits);
+
+    ds_parallel_for(0, n, 0, mark_range, hits);
+    ASSERT_TRUE(all_hit_once(hits, n));
+
+    memset(hits, 0, n * sizeof(atomic_int));
+    ds_parallel_for(0, n, 1, mark_range, hits);
+    ASSERT_TRUE(all_hit_once(hits, n));
+
+    // Intervalo deslocado e vazio
+    memset(hits, 0, n * sizeof(atomic_int));
+    ds_parallel_for(10, 20, 3, mark_range, hits);
+    ds_parallel_for(5, 5, 1, mark_range, hits);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(atomic_load(&hits[i]), (i >= 10 && i < 20) ? 1 : 0);
+    }
+    free(hits);
+}
+
+TEST(thread_index_in_range) {
+    ds_set_num_threads(4);
+    atomic_store(&max_index_seen, 0);
+    ds_parallel_for(0, 4096, 1, record_index, NULL);
+    ASSERT_TRUE(atomic_load(&max_index_seen) < ds_get_num_threads());
+}
+
+TEST(region_threads_inside_tasks) {
+    ds_set_num_threads(4);
+    ASSERT_FALSE(ds_in_task());
+    ASSERT_EQ(ds_region_threads(0), (size_t)4);
+    ASSERT_EQ(ds_region_threads(3), (size_t)3);
+
+    // Dentro do pool (workers e thread chamadora) as regioes OpenMP viram seriais
+    atomic_store(&region_threads_seen, 0);
+    ds_parallel_for(0, 4096, 1, record_region_threads, NULL);
+    ASSERT_EQ(atomic_load(&region_threads_seen), (size_t)1);
+    ASSERT_FALSE(ds_in_task());
+}
+
+TEST(invoke_and_many_spawns) {
+    ds_set_num_threads(4);
+    atomic_int a = 0, b = 0;
+    ds_parallel_invoke(increment, &a, increment, &b);
+    ASSERT_EQ(atomic_load(&a), 1);
+    ASSERT_EQ(atomic_load(&b), 1);
+
+    // Mais tarefas que a capacidade inicial das deques e da fila de injeção
+    atomic_int counter = 0;
+    DSTaskGroup group;
+    ds_task_group_init(&group);
+    for (int i = 0; i < 5000; i++) ds_task_spawn(&group, increment, &counter);
+    ds_task_wait(&group);
+    ASSERT_EQ(atomic_load(&counter), 5000);
+}
+
+TEST(single_thread_runs_inline) {
+    ds_set_num_threads(1);
+    FibArgs args = {15, 0};
+    fib_task(&args);
+    ASSERT_EQ(args.result, 610);
+
+    atomic_int hits[64] = {0};
+    ds_parallel_for(0, 64, 4, mark_range, hits);
+    ASSERT_TRUE(all_hit_once(hits, 64));
+}
+
+TEST(resize_and_shutdown) {
+    for (size_t threads = 2; threads <= 8; threads *= 2) {
+        ds_set_num_threads(threads);
+        FibArgs args = {18, 0};
+        fib_task(&args);
+        ASSERT_EQ(args.result, 2584);
+    }
+    ds_thread_pool_shutdown();
+
+    // Recriado sob demanda
+    FibArgs args = {18, 0};
+    fib_task(&args);
+    ASSERT_EQ(args.result, 2584);
+    ds_thread_pool_shutdown();
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("========================================\n");
+    printf("  TESTES DO THREAD POOL\n");
+    printf("========================================\n\n");
+
+    RUN_TEST(thread_count_setting);
+    RUN_TEST(nested_fork_join);
+    RUN_TEST(parallel_for_covers_range);
+    RUN_TEST(thread_index_in_range);
+    RUN_TEST(region_threads_inside_tasks);
+    RUN_TEST(invoke_and_many_spawns);
+    RUN_TEST(single_thread_runs_inline);
+    RUN_TEST(resize_and_shutdown);
+
+    printf("\n============================================\n");
+    printf("  TODOS OS TESTES PASSARAM! (8 testes)\n");
+    printf("============================================\n");
+
+    return 0;
+}
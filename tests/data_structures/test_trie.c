@@ -10,6 +10,7 @@
  */
 
 #include "data_structures/trie.h"
+#include "data_structures/arena.h"
 #include "data_structures/common.h"
 #include "../test_macros.h"
 
@@ -314,10 +315,201 @@ TEST(clear) {
     trie_destroy(trie);
 }
 
+TEST(memory_usage) {
+    Trie *trie = trie_create(26);
+    size_t empty = trie_memory_usage(trie);
+    ASSERT_TRUE(empty > 0);
+
+    ASSERT_EQ(trie_insert(trie, "abc"), DS_SUCCESS);
+    size_t one = trie_memory_usage(trie);
+    ASSERT_TRUE(one > empty);
+
+    // Folha nova não aloca array de filhos: custa menos que 26 ponteiros
+    ASSERT_EQ(trie_insert(trie, "abd"), DS_SUCCESS);
+    size_t two = trie_memory_usage(trie);
+    ASSERT_TRUE(two > one);
+    ASSERT_TRUE(two - one < 26 * sizeof(void *));
+
+    ASSERT_EQ(trie_remove(trie, "abd"), DS_SUCCESS);
+    ASSERT_EQ(trie_memory_usage(trie), one);
+    ASSERT_TRUE(trie_search(trie, "abc"));
+    ASSERT_EQ(trie_remove(trie, "abc"), DS_SUCCESS);
+    ASSERT_TRUE(trie_memory_usage(trie) <= empty + 26 * sizeof(void *));
+
+    ASSERT_EQ(trie_memory_usage(NULL), 0);
+    trie_destroy(trie);
+}
+
+// ============================================================================
+// TESTES DE TOP-K
+// ============================================================================
+
+TEST(weighted_insert_and_scores) {
+    Trie *trie = trie_create(26);
+    double score = -1.0;
+
+    ASSERT_EQ(trie_insert_weighted(trie, "apple", 5.0), DS_SUCCESS);
+    ASSERT_EQ(trie_insert(trie, "apply"), DS_SUCCESS);
+    ASSERT_EQ(trie_get_score(trie, "apple", &score), DS_SUCCESS);
+    ASSERT_TRUE(score == 5.0);
+    ASSERT_EQ(trie_get_score(trie, "apply", &score), DS_SUCCESS);
+    ASSERT_TRUE(score == 0.0);
+    ASSERT_EQ(trie_get_score(trie, "app", &score), DS_ERROR_NOT_FOUND);
+
+    // trie_insert mantém a pontuação; trie_insert_weighted substitui
+    ASSERT_EQ(trie_insert(trie, "apple"), DS_SUCCESS);
+    ASSERT_EQ(trie_get_score(trie, "apple", &score), DS_SUCCESS);
+    ASSERT_TRUE(score == 5.0);
+    ASSERT_EQ(trie_insert_weighted(trie, "apple", -2.0), DS_SUCCESS);
+    ASSERT_EQ(trie_get_score(trie, "apple", &score), DS_SUCCESS);
+    ASSERT_TRUE(score == -2.0);
+    ASSERT_EQ(trie_size(trie), 2);
+
+    char **results = NULL;
+    double scores[2];
+    size_t count = 0;
+    ASSERT_EQ(trie_autocomplete_topk(trie, "app", 1, &results, scores, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(strcmp(results[0], "apply"), 0);
+    ASSERT_TRUE(scores[0] == 0.0);
+    free_string_array(results, count);
+
+    trie_destroy(trie);
+}
+
+TEST(autocomplete_topk) {
+    Trie *trie = trie_create(26);
+    trie_insert_weighted(trie, "car", 10.0);
+    trie_insert_weighted(trie, "card", 30.0);
+    trie_insert_weighted(trie, "care", 20.0);
+    trie_insert_weighted(trie, "careful", 30.0);
+    trie_insert_weighted(trie, "cat", 5.0);
+    trie_insert_weighted(trie, "dog", 100.0);
+
+    char **results = NULL;
+    double scores[8];
+    size_t count = 0;
+    ASSERT_EQ(trie_autocomplete_topk(trie, "ca", 4, &results, scores, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 4);
+    ASSERT_EQ(strcmp(results[0], "card"), 0);       // empate com "careful": ordem lexicográfica
+    ASSERT_EQ(strcmp(results[1], "careful"), 0);
+    ASSERT_EQ(strcmp(results[2], "care"), 0);
+    ASSERT_EQ(strcmp(results[3], "car"), 0);
+    ASSERT_TRUE(scores[0] == 30.0 && scores[2] == 20.0 && scores[3] == 10.0);
+    free_string_array(results, count);
+
+    // k maior que o número de completações
+    ASSERT_EQ(trie_autocomplete_topk(trie, "", 8, &results, NULL, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 6);
+    ASSERT_EQ(strcmp(results[0], "dog"), 0);
+    ASSERT_EQ(strcmp(results[5], "cat"), 0);
+    free_string_array(results, count);
+
+    // Remover a melhor e diminuir outra atualiza os máximos do caminho
+    ASSERT_EQ(trie_remove(trie, "card"), DS_SUCCESS);
+    ASSERT_EQ(trie_insert_weighted(trie, "careful", 1.0), DS_SUCCESS);
+    ASSERT_EQ(trie_autocomplete_topk(trie, "car", 2, &results, scores, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(strcmp(results[0], "care"), 0);
+    ASSERT_EQ(strcmp(results[1], "car"), 0);
+    free_string_array(results, count);
+
+    ASSERT_EQ(trie_autocomplete_topk(trie, "x", 3, &results, scores, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 0);
+    ASSERT_NULL(results);
+    ASSERT_EQ(trie_autocomplete_topk(trie, "ca", 0, &results, scores, &count), DS_SUCCESS);
+    ASSERT_EQ(count, 0);
+
+    trie_destroy(trie);
+}
+
+typedef struct {
+    char *word;
+    double score;
+} ScoredWord;
+
+static int scored_word_compare(const void *a, const void *b) {
+    const ScoredWord *x = (const ScoredWord *)a;
+    const ScoredWord *y = (const ScoredWord *)b;
+    if (x->score != y->score) return x->score > y->score ? -1 : 1;
+    return strcmp(x->word, y->word);
+}
+
+TEST(autocomplete_topk_matches_sorting) {
+    // Pontuações inteiras pequenas: muitos empates
+    Trie *trie = trie_create(26);
+    unsigned seed = 17u;
+    char word[12];
+    for (int op = 0; op < 4000; op++) {
+        seed = seed * 1103515245u + 12345u;
+        size_t len = 1 + (seed >> 16) % 7;
+        for (size_t j = 0; j < len; j++) {
+            seed = seed * 1103515245u + 12345u;
+            word[j] = (char)('a' + (seed >> 16) % 4);
+        }
+        word[len] = '\0';
+        seed = seed * 1103515245u + 12345u;
+        if ((seed >> 16) % 5 == 0) {
+            trie_remove(trie, word);
+        } else {
+            trie_insert_weighted(trie, word, (double)((seed >> 20) % 9));
+        }
+    }
+
+    const char *prefixes[] = {"", "a", "bc", "ddd", "abca"};
+    for (size_t p = 0; p < 5; p++) {
+        char **all = NULL;
+        size_t total = 0;
+        ASSERT_EQ(trie_autocomplete(trie, prefixes[p], &all, &total), DS_SUCCESS);
+        ScoredWord *expected = malloc((total + 1) * sizeof(ScoredWord));
+        for (size_t i = 0; i < total; i++) {
+            expected[i].word = all[i];
+            trie_get_score(trie, all[i], &expected[i].score);
+        }
+        qsort(expected, total, sizeof(ScoredWord), scored_word_compare);
+
+        size_t k = 25;
+        char **results = NULL;
+        double scores[25];
+        size_t count = 0;
+        ASSERT_EQ(trie_autocomplete_topk(trie, prefixes[p], k, &results, scores, &count),
+                  DS_SUCCESS);
+        ASSERT_EQ(count, total < k ? total : k);
+        for (size_t i = 0; i < count; i++) {
+            ASSERT_EQ(strcmp(results[i], expected[i].word), 0);
+            ASSERT_TRUE(scores[i] == expected[i].score);
+        }
+        free_string_array(results, count);
+        free(expected);
+        free_string_array(all, total);
+    }
+
+    trie_destroy(trie);
+}
+
 // ============================================================================
 // TESTES DE NULL POINTER
 // ============================================================================
 
+TEST(arena_allocator) {
+    DSArena *arena = ds_arena_create(0);
+    DSAllocator alloc = ds_arena_allocator(arena);
+    Trie *trie = trie_create_with_allocator(26, &alloc);
+    ASSERT_NOT_NULL(trie);
+
+    trie_insert(trie, "arena");
+    trie_insert(trie, "arvore");
+    trie_insert(trie, "array");
+    ASSERT_TRUE(trie_search(trie, "arvore"));
+    ASSERT_EQ(trie_remove(trie, "arvore"), DS_SUCCESS);
+    ASSERT_FALSE(trie_search(trie, "arvore"));
+    ASSERT_TRUE(trie_starts_with(trie, "arr"));
+
+    trie_destroy(trie);
+    ASSERT_EQ(ds_arena_bytes_used(arena), 0);
+    ds_arena_destroy(arena);
+}
+
 TEST(null_pointer_checks) {
     ASSERT_EQ(trie_insert(NULL, "hello"), DS_ERROR_NULL_POINTER);
     ASSERT_FALSE(trie_search(NULL, "hello"));
@@ -329,6 +521,13 @@ TEST(null_pointer_checks) {
     Trie *trie = trie_create(26);
     ASSERT_EQ(trie_insert(trie, NULL), DS_ERROR_NULL_POINTER);
     ASSERT_EQ(trie_remove(trie, NULL), DS_ERROR_NULL_POINTER);
+    char **results;
+    size_t count;
+    double score;
+    ASSERT_EQ(trie_insert_weighted(NULL, "a", 1.0), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(trie_get_score(trie, NULL, &score), DS_ERROR_NULL_POINTER);
+    ASSERT_EQ(trie_autocomplete_topk(NULL, "a", 3, &results, NULL, &count),
+              DS_ERROR_NULL_POINTER);
     trie_destroy(trie);
 }
 
@@ -361,6 +560,11 @@ int main(void) {
     printf("\nAutocomplete:\n");
     RUN_TEST(autocomplete);
 
+    printf("\nTop-K:\n");
+    RUN_TEST(weighted_insert_and_scores);
+    RUN_TEST(autocomplete_topk);
+    RUN_TEST(autocomplete_topk_matches_sorting);
+
     printf("\nLongest Common Prefix:\n");
     RUN_TEST(longest_common_prefix);
     RUN_TEST(longest_common_prefix_full);
@@ -373,12 +577,14 @@ int main(void) {
 
     printf("\nClear:\n");
     RUN_TEST(clear);
+    RUN_TEST(arena_allocator);
+    RUN_TEST(memory_usage);
 
     printf("\nNull Pointer:\n");
     RUN_TEST(null_pointer_checks);
 
     printf("\n============================================\n");
-    printf("  TODOS OS TESTES PASSARAM! (14 testes)\n");
+    printf("  TODOS OS TESTES PASSARAM! (21 testes)\n");
     printf("============================================\n");
 
     return 0;
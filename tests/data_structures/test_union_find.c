@@ -13,6 +13,8 @@
 #include "data_structures/common.h"
 #include "../test_macros.h"
 
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 // ============================================================================
@@ -339,6 +341,100 @@ TEST(invalid_index) {
     uf_destroy(uf);
 }
 
+TEST(memory_usage) {
+    UnionFind *small = uf_create(100);
+    UnionFind *large = uf_create(200);
+    ASSERT_NOT_NULL(small);
+    ASSERT_NOT_NULL(large);
+
+    // parent e set_size em ds_index_t, rank em um byte
+    size_t per_element = 2 * sizeof(ds_index_t) + 1;
+    ASSERT_EQ(uf_memory_usage(large) - uf_memory_usage(small), 100 * per_element);
+    uf_union(small, 0, 1);
+    ASSERT_EQ(uf_memory_usage(small), uf_memory_usage(large) - 100 * per_element);
+    ASSERT_EQ(uf_memory_usage(NULL), 0);
+
+#ifdef DS_COMPACT_INDEX
+    ASSERT_EQ(per_element, 9);
+    ASSERT_NULL(uf_create(DS_INDEX_MAX + 1));
+#endif
+
+    uf_destroy(small);
+    uf_destroy(large);
+}
+
+// ============================================================================
+// TESTES DO UNION-FIND CONCORRENTE
+// ============================================================================
+
+TEST(concurrent_basic) {
+    ASSERT_NULL(cuf_create(0));
+    ConcurrentUnionFind *uf = cuf_create(6);
+    ASSERT_NOT_NULL(uf);
+    ASSERT_EQ(cuf_count(uf), 6);
+
+    ASSERT_TRUE(cuf_union(uf, 0, 1));
+    ASSERT_TRUE(cuf_union(uf, 2, 3));
+    ASSERT_FALSE(cuf_union(uf, 1, 0));
+    ASSERT_TRUE(cuf_union(uf, 1, 3));
+    ASSERT_EQ(cuf_count(uf), 3);
+    ASSERT_TRUE(cuf_connected(uf, 0, 2));
+    ASSERT_FALSE(cuf_connected(uf, 0, 4));
+    ASSERT_EQ(cuf_find(uf, 0), cuf_find(uf, 3));
+    ASSERT_EQ(cuf_find(uf, 5), 5);
+
+    ASSERT_FALSE(cuf_union(uf, 0, 6));
+    ASSERT_FALSE(cuf_connected(uf, 6, 0));
+    ASSERT_EQ(cuf_count(NULL), 0);
+    ASSERT_FALSE(cuf_union(NULL, 0, 1));
+    cuf_destroy(uf);
+    cuf_destroy(NULL);
+}
+
+TEST(concurrent_matches_sequential) {
+    // Unioes aleatorias em paralelo; a particao final deve ser a sequencial
+    const size_t N = 20000, M = 30000;
+    size_t *a = malloc(M * sizeof(size_t));
+    size_t *b = malloc(M * sizeof(size_t));
+    ASSERT_NOT_NULL(a);
+    ASSERT_NOT_NULL(b);
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < M; i++) {
+        state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+        a[i] = (size_t)(state % N);
+        b[i] = (size_t)((state >> 32) % N);
+    }
+
+    UnionFind *seq = uf_create(N);
+    size_t seq_unions = 0;
+    for (size_t i = 0; i < M; i++) seq_unions += uf_union(seq, a[i], b[i]);
+
+    for (int round = 0; round < 4; round++) {
+        ConcurrentUnionFind *uf = cuf_create(N);
+        size_t unions = 0;
+        #pragma omp parallel for num_threads(4) schedule(dynamic, 64) reduction(+:unions)
+        for (size_t i = 0; i < M; i++) {
+            // Finds concorrentes com as unioes exercitam o path splitting
+            if (cuf_union(uf, a[i], b[i])) unions++;
+            (void)cuf_find(uf, a[(i * 7) % M]);
+        }
+
+        ASSERT_EQ(unions, seq_unions);
+        ASSERT_EQ(cuf_count(uf), uf_count(seq));
+        for (size_t i = 0; i < M; i++) {
+            ASSERT_TRUE(cuf_connected(uf, a[i], b[i]));
+        }
+        for (size_t i = 0; i + 1 < N; i += 97) {
+            ASSERT_EQ(cuf_connected(uf, i, i + 1), uf_connected(seq, i, i + 1));
+        }
+        cuf_destroy(uf);
+    }
+
+    uf_destroy(seq);
+    free(a);
+    free(b);
+}
+
 // ============================================================================
 // MAIN - RUNNER DE TESTES
 // ============================================================================
@@ -386,9 +482,14 @@ int main(void) {
     printf("\nNull Pointer e Indice Invalido:\n");
     RUN_TEST(null_pointer_checks);
     RUN_TEST(invalid_index);
+    RUN_TEST(memory_usage);
+
+    printf("\nUnion-Find Concorrente:\n");
+    RUN_TEST(concurrent_basic);
+    RUN_TEST(concurrent_matches_sequential);
 
     printf("\n============================================\n");
-    printf("  TODOS OS TESTES PASSARAM! (14 testes)\n");
+    printf("  TODOS OS TESTES PASSARAM! (18 testes)\n");
     printf("============================================\n");
 
     return 0;
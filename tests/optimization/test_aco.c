@@ -11,6 +11,8 @@
 #include "optimization/benchmarks/tsp.h"
 #include <math.h>
 #include <float.h>
+#include <string.h>
+#include <stdlib.h>
 
 // ============================================================================
 // TESTES: CONFIGURACAO
@@ -26,6 +28,7 @@ TEST(aco_default_config_values) {
     ASSERT_NEAR(cfg.q, 1.0, 1e-9);
     ASSERT_NEAR(cfg.tau_0, 0.1, 1e-9);
     ASSERT_EQ(cfg.variant, ACO_ANT_SYSTEM);
+    ASSERT_EQ(cfg.num_threads, 1);
     ASSERT_EQ(cfg.direction, OPT_MINIMIZE);
     ASSERT_EQ(cfg.seed, 42);
 }
@@ -242,6 +245,114 @@ TEST(aco_single_ant) {
     tsp_instance_destroy(inst);
 }
 
+// ============================================================================
+// TESTES: CONSTRUCAO PARALELA E CHOICE-INFO
+// ============================================================================
+
+TEST(aco_threads_deterministic) {
+    TSPInstance *inst = tsp_create_random(40, 9);
+    ASSERT_NOT_NULL(inst);
+
+    ACOConfig cfg = aco_default_config();
+    cfg.n_ants = 12;
+    cfg.max_iterations = 40;
+    cfg.variant = ACO_MAX_MIN;
+    cfg.num_threads = 1;
+    OptResult serial = aco_run(&cfg, inst->n_cities, tsp_tour_cost, aco_heuristic_tsp, inst);
+    cfg.num_threads = 4;
+    OptResult parallel = aco_run(&cfg, inst->n_cities, tsp_tour_cost, aco_heuristic_tsp, inst);
+
+    ASSERT_NEAR(serial.best.cost, parallel.best.cost, 1e-12);
+    ASSERT_EQ(memcmp(serial.best.data, parallel.best.data, inst->n_cities * sizeof(int)), 0);
+    for (size_t i = 0; i < serial.num_iterations; i++) {
+        ASSERT_NEAR(serial.convergence[i], parallel.convergence[i], 1e-12);
+    }
+    ASSERT_EQ(parallel.num_evaluations, 12 * 40);
+
+    opt_result_destroy(&serial);
+    opt_result_destroy(&parallel);
+    tsp_instance_destroy(inst);
+}
+
+TEST(aco_alpha_non_unit) {
+    TSPInstance *inst = tsp_create_example_10();
+    ASSERT_NOT_NULL(inst);
+
+    // alpha != 1 usa o caminho com pow() na atualizacao de choice-info
+    ACOConfig cfg = aco_default_config();
+    cfg.n_ants = 10;
+    cfg.max_iterations = 60;
+    cfg.alpha = 2.0;
+    cfg.variant = ACO_ELITIST;
+
+    OptResult result = aco_run(&cfg, inst->n_cities, tsp_tour_cost, aco_heuristic_tsp, inst);
+    ASSERT_TRUE(tsp_is_valid_tour((int*)result.best.data, inst->n_cities));
+    ASSERT_NEAR(result.best.cost, tsp_tour_cost(result.best.data, inst->n_cities, inst), 1e-6);
+    ASSERT_NEAR(result.best.cost, 100.0, 1e-6);
+
+    opt_result_destroy(&result);
+    tsp_instance_destroy(inst);
+}
+
+TEST(aco_candidate_lists) {
+    TSPInstance *inst = tsp_create_random(200, 4);
+    ASSERT_NOT_NULL(inst);
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 12));
+
+    ACOConfig cfg = aco_default_config();
+    cfg.n_ants = 10;
+    cfg.max_iterations = 30;
+    cfg.variant = ACO_MAX_MIN;
+    cfg.candidate_k = 12;
+
+    // Listas por eta = 1/d coincidem com as kNN da instancia
+    OptResult by_eta = aco_run(&cfg, inst->n_cities, tsp_tour_cost, aco_heuristic_tsp, inst);
+    cfg.candidate_lists = inst->neighbors;
+    OptResult by_knn = aco_run(&cfg, inst->n_cities, tsp_tour_cost, aco_heuristic_tsp, inst);
+
+    ASSERT_TRUE(tsp_is_valid_tour((int*)by_knn.best.data, inst->n_cities));
+    ASSERT_NEAR(by_knn.best.cost, tsp_tour_cost(by_knn.best.data, inst->n_cities, inst), 1e-6);
+    ASSERT_NEAR(by_eta.best.cost, by_knn.best.cost, 1e-9);
+
+    // Tours restritos aos vizinhos proximos: bem melhores que aleatorios
+    int *random_tour = malloc(inst->n_cities * sizeof(int));
+    tsp_generate_random(random_tour, inst->n_cities, inst);
+    ASSERT_LT(by_knn.best.cost, 0.5 * tsp_tour_cost(random_tour, inst->n_cities, inst));
+    free(random_tour);
+
+    opt_result_destroy(&by_eta);
+    opt_result_destroy(&by_knn);
+    tsp_instance_destroy(inst);
+}
+
+TEST(aco_candidate_fallback) {
+    TSPInstance *inst = tsp_create_random(60, 8);
+    ASSERT_NOT_NULL(inst);
+
+    // k = 2: candidatos esgotam com frequencia e a formiga usa o fallback
+    ACOConfig cfg = aco_default_config();
+    cfg.n_ants = 6;
+    cfg.max_iterations = 15;
+    cfg.candidate_k = 2;
+    cfg.variant = ACO_ELITIST;
+
+    OptResult result = aco_run(&cfg, inst->n_cities, tsp_tour_cost, aco_heuristic_tsp, inst);
+    ASSERT_TRUE(tsp_is_valid_tour((int*)result.best.data, inst->n_cities));
+    ASSERT_NEAR(result.best.cost, tsp_tour_cost(result.best.data, inst->n_cities, inst), 1e-6);
+
+    // k >= n - 1 equivale a varredura completa
+    cfg.candidate_k = 100;
+    OptResult full = aco_run(&cfg, inst->n_cities, tsp_tour_cost, aco_heuristic_tsp, inst);
+    cfg.candidate_k = 0;
+    OptResult none = aco_run(&cfg, inst->n_cities, tsp_tour_cost, aco_heuristic_tsp, inst);
+    ASSERT_NEAR(full.best.cost, none.best.cost, 1e-12);
+
+    opt_result_destroy(&result);
+    opt_result_destroy(&full);
+    opt_result_destroy(&none);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -269,6 +380,14 @@ int main(void) {
     RUN_TEST(aco_valid_tour_cost);
     RUN_TEST(aco_single_ant);
 
-    printf("\n=== Todos os 10 testes passaram! ===\n");
+    printf("\n[Construcao Paralela e Choice-Info]\n");
+    RUN_TEST(aco_threads_deterministic);
+    RUN_TEST(aco_alpha_non_unit);
+
+    printf("\n[Listas de Candidatos]\n");
+    RUN_TEST(aco_candidate_lists);
+    RUN_TEST(aco_candidate_fallback);
+
+    printf("\n=== Todos os 14 testes passaram! ===\n");
     return 0;
 }
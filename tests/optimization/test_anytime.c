@@ -0,0 +1,218 @@
+/**
+ * @file test_anytime.c
+ * @brief Testes do modo servico (solver em thread de fundo)
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "../test_macros.h"
+#include "optimization/anytime.h"
+#include "optimization/metaheuristics/genetic_algorithm.h"
+#include "optimization/benchmarks/tsp.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define N_CITIES 30
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+typedef struct {
+    size_t calls;
+    double last_cost;
+    bool strictly_better;
+    size_t last_evaluations;
+} ImprovementLog;
+
+static void log_improvement(const void *solution, double cost, size_t evaluations,
+                            double elapsed_ms, void *user_data) {
+    ImprovementLog *log = user_data;
+    (void)elapsed_ms;
+    if (!tsp_is_valid_tour((const int*)solution, N_CITIES)) log->strictly_better = false;
+    if (log->calls > 0 && !(cost < log->last_cost)) log->strictly_better = false;
+    if (evaluations <= log->last_evaluations) log->strictly_better = false;
+    log->calls++;
+    log->last_cost = cost;
+    log->last_evaluations = evaluations;
+}
+
+// GA sem limite proprio: so termina com opt_anytime_stop
+static OptResult solve_ga_unbounded(OptAnytime *solver, void *user_data) {
+    (void)user_data;
+    GAConfig cfg = ga_default_config();
+    cfg.population_size = 30;
+    cfg.max_generations = (size_t)1 << 40;
+    cfg.trace.mode = OPT_TRACE_NONE;
+    cfg.stop.cancel = opt_anytime_cancel_flag(solver);
+    return ga_run(&cfg, sizeof(int) * N_CITIES, N_CITIES, opt_anytime_objective,
+                  tsp_generate_random, ga_crossover_ox, ga_mutation_swap, NULL, solver);
+}
+
+static OptResult solve_ga_short(OptAnytime *solver, void *user_data) {
+    (void)user_data;
+    GAConfig cfg = ga_default_config();
+    cfg.population_size = 20;
+    cfg.max_generations = 30;
+    cfg.num_threads = 0;
+    return ga_run(&cfg, sizeof(int) * N_CITIES, N_CITIES, opt_anytime_objective,
+                  tsp_generate_random, ga_crossover_ox, ga_mutation_swap, NULL, solver);
+}
+
+// Corpo que avalia por conta propria e publica com opt_anytime_offer
+static OptResult solve_offer(OptAnytime *solver, void *user_data) {
+    const double *values = user_data;
+    for (size_t i = 0; i < 6; i++) opt_anytime_offer(solver, &values[i], values[i]);
+    OptResult empty = {0};
+    return empty;
+}
+
+// ============================================================================
+// TESTES
+// ============================================================================
+
+TEST(anytime_invalid_params) {
+    OptAnytimeConfig ac = opt_anytime_default_config(0, tsp_tour_cost, NULL);
+    ASSERT_EQ(ac.direction, OPT_MINIMIZE);
+    ASSERT_NULL(ac.on_improvement);
+    ASSERT_NULL(opt_anytime_start(&ac, solve_ga_short, NULL));
+    ac.data_size = sizeof(int);
+    ASSERT_NULL(opt_anytime_start(&ac, NULL, NULL));
+    ASSERT_NULL(opt_anytime_start(NULL, solve_ga_short, NULL));
+    ASSERT_FALSE(opt_anytime_poll(NULL, NULL, NULL));
+    opt_anytime_destroy(NULL);
+}
+
+TEST(anytime_streams_until_stop) {
+    TSPInstance *inst = tsp_create_random(N_CITIES, 4);
+    ASSERT_NOT_NULL(inst);
+
+    ImprovementLog log = {0, 0.0, true, 0};
+    OptAnytimeConfig ac = opt_anytime_default_config(sizeof(int) * N_CITIES,
+                                                     tsp_tour_cost, inst);
+    ac.on_improvement = log_improvement;
+    ac.user_data = &log;
+    OptAnytime *solver = opt_anytime_start(&ac, solve_ga_unbounded, NULL);
+    ASSERT_NOT_NULL(solver);
+
+    // Primeira solucao chega logo; a execucao segue ate o stop
+    ASSERT_TRUE(opt_anytime_wait(solver, 0, 5000.0));
+    int tour[N_CITIES];
+    OptAnytimeStatus st;
+    ASSERT_TRUE(opt_anytime_poll(solver, tour, &st));
+    ASSERT_TRUE(st.version >= 1);
+    ASSERT_TRUE(tsp_is_valid_tour(tour, N_CITIES));
+    ASSERT_NEAR(st.cost, tsp_tour_cost(tour, N_CITIES, inst), 1e-9);
+
+    // A execucao continua melhorando em fundo
+    ASSERT_TRUE(opt_anytime_wait(solver, st.version, 5000.0));
+    OptAnytimeStatus later;
+    ASSERT_TRUE(opt_anytime_poll(solver, tour, &later));
+    ASSERT_TRUE(later.version > st.version);
+    ASSERT_TRUE(later.cost < st.cost);
+    ASSERT_FALSE(later.finished);
+
+    opt_anytime_stop(solver);
+    OptResult r = opt_anytime_join(solver);
+    ASSERT_TRUE(r.num_iterations < ((size_t)1 << 40));
+    ASSERT_NOT_NULL(r.best.data);
+
+    OptAnytimeStatus final;
+    ASSERT_TRUE(opt_anytime_poll(solver, tour, &final));
+    ASSERT_TRUE(final.finished);
+    ASSERT_EQ(final.evaluations, r.num_evaluations);
+    ASSERT_TRUE(final.cost == r.best.cost);      // GA guarda todo filho avaliado
+    ASSERT_EQ(log.calls, (size_t)final.version);
+    ASSERT_TRUE(log.strictly_better);
+    ASSERT_TRUE(log.last_cost == final.cost);
+
+    // Resultado entregue uma vez
+    OptResult again = opt_anytime_join(solver);
+    ASSERT_NULL(again.best.data);
+
+    opt_result_destroy(&r);
+    opt_anytime_destroy(solver);
+    tsp_instance_destroy(inst);
+}
+
+TEST(anytime_finishes_on_its_own) {
+    TSPInstance *inst = tsp_create_random(N_CITIES, 6);
+    ASSERT_NOT_NULL(inst);
+
+    // Avaliacao paralela: as melhorias chegam de varias threads
+    OptAnytimeConfig ac = opt_anytime_default_config(sizeof(int) * N_CITIES,
+                                                     tsp_tour_cost, inst);
+    OptAnytime *solver = opt_anytime_start(&ac, solve_ga_short, NULL);
+    ASSERT_NOT_NULL(solver);
+
+    OptResult r = opt_anytime_join(solver);
+    ASSERT_EQ(r.num_iterations, (size_t)30);
+
+    OptAnytimeStatus st;
+    ASSERT_TRUE(opt_anytime_poll(solver, NULL, &st));
+    ASSERT_TRUE(st.finished);
+    ASSERT_TRUE(st.cost == r.best.cost);
+
+    // Execucao terminada: esperar alem da ultima versao volta na hora
+    ASSERT_FALSE(opt_anytime_wait(solver, st.version, -1.0));
+    ASSERT_TRUE(opt_anytime_wait(solver, st.version - 1, -1.0));
+
+    opt_result_destroy(&r);
+    opt_anytime_destroy(solver);
+    tsp_instance_destroy(inst);
+}
+
+TEST(anytime_offer_maximize) {
+    double values[6] = {3.0, 1.0, 5.0, 5.0, 4.0, 7.0};
+    OptAnytimeConfig ac = opt_anytime_default_config(sizeof(double), NULL, NULL);
+    ac.direction = OPT_MAXIMIZE;
+    OptAnytime *solver = opt_anytime_start(&ac, solve_offer, values);
+    ASSERT_NOT_NULL(solver);
+    OptResult r = opt_anytime_join(solver);
+    opt_result_destroy(&r);
+
+    double best = 0.0;
+    OptAnytimeStatus st;
+    ASSERT_TRUE(opt_anytime_poll(solver, &best, &st));
+    ASSERT_NEAR(best, 7.0, 1e-12);
+    ASSERT_NEAR(st.cost, 7.0, 1e-12);
+    ASSERT_EQ(st.version, 3);          // 3, 5 e 7
+    ASSERT_EQ(st.evaluations, 6);
+    ASSERT_FALSE(opt_anytime_stop_requested(solver));
+    opt_anytime_destroy(solver);
+}
+
+TEST(anytime_destroy_while_running) {
+    TSPInstance *inst = tsp_create_random(N_CITIES, 8);
+    ASSERT_NOT_NULL(inst);
+
+    OptAnytimeConfig ac = opt_anytime_default_config(sizeof(int) * N_CITIES,
+                                                     tsp_tour_cost, inst);
+    OptAnytime *solver = opt_anytime_start(&ac, solve_ga_unbounded, NULL);
+    ASSERT_NOT_NULL(solver);
+    ASSERT_TRUE(opt_anytime_wait(solver, 0, 5000.0));
+
+    OptAnytimeStatus st;
+    opt_anytime_poll(solver, NULL, &st);
+    ASSERT_FALSE(st.finished);
+    opt_anytime_destroy(solver);       // para, espera e descarta o resultado
+    tsp_instance_destroy(inst);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Testes Modo Servico (anytime) ===\n\n");
+
+    RUN_TEST(anytime_invalid_params);
+    RUN_TEST(anytime_streams_until_stop);
+    RUN_TEST(anytime_finishes_on_its_own);
+    RUN_TEST(anytime_offer_maximize);
+    RUN_TEST(anytime_destroy_while_running);
+
+    printf("\n=== Todos os 5 testes passaram! ===\n");
+    return 0;
+}
@@ -65,6 +65,65 @@ TEST(solution_clone_null) {
     ASSERT_NULL(clone.data);
 }
 
+TEST(solution_copy_into) {
+    OptSolution src = opt_solution_create(sizeof(int) * 4);
+    OptSolution dst = opt_solution_create(sizeof(int) * 4);
+    int *s = (int*)src.data;
+    for (int i = 0; i < 4; i++) s[i] = 10 + i;
+    src.cost = 7.5;
+
+    void *dst_data = dst.data;
+    ASSERT_TRUE(opt_solution_copy_into(&dst, &src));
+    ASSERT_EQ(dst.data, dst_data);
+    ASSERT_EQ(((int*)dst.data)[3], 13);
+    ASSERT_NEAR(dst.cost, 7.5, 1e-12);
+
+    OptSolution other = opt_solution_create(sizeof(int) * 3);
+    ASSERT_FALSE(opt_solution_copy_into(&other, &src));
+    ASSERT_FALSE(opt_solution_copy_into(NULL, &src));
+
+    opt_solution_destroy(&src);
+    opt_solution_destroy(&dst);
+    opt_solution_destroy(&other);
+}
+
+TEST(solution_pool_recycles) {
+    OptSolutionPool pool = opt_solution_pool_create(sizeof(double) * 8, 2);
+    ASSERT_EQ(pool.num_allocated, (size_t)2);
+    ASSERT_EQ(pool.num_free, (size_t)2);
+
+    void *a = opt_solution_pool_acquire(&pool);
+    void *b = opt_solution_pool_acquire(&pool);
+    void *c = opt_solution_pool_acquire(&pool);
+    ASSERT_NOT_NULL(a);
+    ASSERT_NOT_NULL(b);
+    ASSERT_NOT_NULL(c);
+    ASSERT_EQ(pool.num_allocated, (size_t)3);
+
+    // Regime estacionario: acquire/release nao aloca mais nada
+    for (int i = 0; i < 100; i++) {
+        opt_solution_pool_release(&pool, c);
+        c = opt_solution_pool_acquire(&pool);
+        ((double*)c)[7] = (double)i;
+    }
+    ASSERT_EQ(pool.num_allocated, (size_t)3);
+
+    // Buffer adquirido pode virar o data de uma OptSolution
+    OptSolution sol = { a, pool.data_size, 1.0 };
+    opt_solution_destroy(&sol);
+
+    opt_solution_pool_release(&pool, b);
+    opt_solution_pool_release(&pool, c);
+    opt_solution_pool_release(&pool, NULL);
+    ASSERT_EQ(pool.num_free, (size_t)2);
+    opt_solution_pool_destroy(&pool);
+    ASSERT_NULL(pool.free_buffers);
+
+    OptSolutionPool empty = opt_solution_pool_create(0, 4);
+    ASSERT_NULL(opt_solution_pool_acquire(&empty));
+    opt_solution_pool_destroy(&empty);
+}
+
 // ============================================================================
 // TESTES: OptResult
 // ============================================================================
@@ -79,6 +138,149 @@ TEST(result_create_destroy) {
     ASSERT_NULL(res.convergence);
 }
 
+// ============================================================================
+// TESTES: CRITERIOS DE PARADA
+// ============================================================================
+
+TEST(stop_none_never_stops) {
+    OptStopCriteria none = opt_stop_none();
+    OptStopState st = opt_stop_begin(&none, OPT_MINIMIZE);
+    for (size_t i = 0; i < 10000; i++) {
+        ASSERT_FALSE(opt_stop_check(&st, i, -1e300));
+    }
+    OptStopState null_st = opt_stop_begin(NULL, OPT_MAXIMIZE);
+    ASSERT_FALSE(opt_stop_check(&null_st, 1000000, 1e300));
+}
+
+TEST(stop_evaluations_and_target) {
+    OptStopCriteria c = opt_stop_none();
+    c.max_evaluations = 100;
+    OptStopState st = opt_stop_begin(&c, OPT_MINIMIZE);
+    ASSERT_FALSE(opt_stop_check(&st, 99, 5.0));
+    ASSERT_TRUE(opt_stop_check(&st, 100, 5.0));
+    ASSERT_TRUE(opt_stop_check(&st, 0, 5.0));     // permanece parado
+
+    c = opt_stop_none();
+    c.use_target = true;
+    c.target_cost = 10.0;
+    st = opt_stop_begin(&c, OPT_MINIMIZE);
+    ASSERT_FALSE(opt_stop_check(&st, 1, 10.5));
+    ASSERT_TRUE(opt_stop_check(&st, 2, 10.0));
+
+    st = opt_stop_begin(&c, OPT_MAXIMIZE);
+    ASSERT_FALSE(opt_stop_check(&st, 1, 9.0));
+    ASSERT_TRUE(opt_stop_check(&st, 2, 11.0));
+}
+
+TEST(stop_time_limit) {
+    OptStopCriteria c = opt_stop_none();
+    c.time_limit_ms = 5.0;
+    for (int mode = 0; mode < 2; mode++) {
+        c.check_interval = (mode == 0) ? 0 : 16;   // adaptativo e fixo
+        double t0 = opt_monotonic_time_ms();
+        OptStopState st = opt_stop_begin(&c, OPT_MINIMIZE);
+        size_t checks = 0;
+        while (!opt_stop_check(&st, checks, 0.0)) checks++;
+        double elapsed = opt_monotonic_time_ms() - t0;
+        ASSERT_TRUE(elapsed >= 5.0);
+        ASSERT_TRUE(elapsed < 1000.0);
+        ASSERT_GT(checks, (size_t)0);
+    }
+}
+
+// ============================================================================
+// TESTES: PROGRESSO E AMOSTRAGEM
+// ============================================================================
+
+typedef struct {
+    size_t calls;
+    size_t last_iteration;
+    double last_cost;
+} ProgressLog;
+
+static void log_progress(const OptProgress *p, void *user_data) {
+    ProgressLog *log = (ProgressLog*)user_data;
+    log->calls++;
+    log->last_iteration = p->iteration;
+    log->last_cost = p->best_cost;
+}
+
+TEST(trace_full_default) {
+    OptTraceConfig tc = opt_trace_default();
+    ASSERT_EQ(tc.mode, OPT_TRACE_FULL);
+    ASSERT_NULL(tc.callback);
+
+    OptTracer t = opt_tracer_begin(&tc, OPT_MINIMIZE);
+    OptResult r = opt_tracer_create_result(&t, 10);
+    ASSERT_EQ(r.convergence_size, (size_t)10);
+    ASSERT_NULL(r.convergence_iterations);
+    for (size_t i = 0; i < 10; i++) {
+        opt_tracer_record(&t, &r, i, 100.0 - (double)i, i + 1);
+    }
+    opt_tracer_finish(&t, &r);
+    ASSERT_EQ(r.convergence_size, (size_t)10);
+    ASSERT_NEAR(r.convergence[9], 91.0, 1e-12);
+    opt_result_destroy(&r);
+}
+
+TEST(trace_ring_keeps_last_samples) {
+    OptTraceConfig tc = opt_trace_default();
+    tc.mode = OPT_TRACE_RING;
+    tc.capacity = 4;
+    tc.every = 3;
+    OptTracer t = opt_tracer_begin(&tc, OPT_MINIMIZE);
+    OptResult r = opt_tracer_create_result(&t, 1000);
+    ASSERT_EQ(r.convergence_size, (size_t)4);
+    ASSERT_NOT_NULL(r.convergence_iterations);
+
+    // Amostras em 2, 5, 8, ..., 20 e a ultima (21): anel guarda as 4 finais
+    for (size_t i = 0; i < 22; i++) {
+        opt_tracer_record(&t, &r, i, 1000.0 - (double)i, i);
+    }
+    opt_tracer_finish(&t, &r);
+    ASSERT_EQ(r.convergence_size, (size_t)4);
+    size_t expected[4] = {14, 17, 20, 21};
+    for (size_t k = 0; k < 4; k++) {
+        ASSERT_EQ(r.convergence_iterations[k], expected[k]);
+        ASSERT_NEAR(r.convergence[k], 1000.0 - (double)expected[k], 1e-12);
+    }
+    opt_result_destroy(&r);
+
+    // Anel nao cheio: ordem cronologica sem rotacao
+    t = opt_tracer_begin(&tc, OPT_MINIMIZE);
+    r = opt_tracer_create_result(&t, 1000);
+    for (size_t i = 0; i < 5; i++) opt_tracer_record(&t, &r, i, 5.0, i);
+    opt_tracer_finish(&t, &r);
+    ASSERT_EQ(r.convergence_size, (size_t)2);
+    ASSERT_EQ(r.convergence_iterations[0], (size_t)2);
+    ASSERT_EQ(r.convergence_iterations[1], (size_t)4);
+    opt_result_destroy(&r);
+}
+
+TEST(trace_none_with_callback) {
+    ProgressLog log = {0};
+    OptTraceConfig tc = opt_trace_default();
+    tc.mode = OPT_TRACE_NONE;
+    tc.on_improvement = true;
+    tc.callback = log_progress;
+    tc.user_data = &log;
+    OptTracer t = opt_tracer_begin(&tc, OPT_MAXIMIZE);
+    OptResult r = opt_tracer_create_result(&t, 1000);
+    ASSERT_NULL(r.convergence);
+    ASSERT_EQ(r.convergence_size, (size_t)0);
+
+    // Melhora em 0, 3 e 7; a ultima iteracao (9) fecha a serie
+    double costs[10] = {1, 1, 1, 2, 2, 2, 2, 5, 5, 5};
+    for (size_t i = 0; i < 10; i++) opt_tracer_record(&t, &r, i, costs[i], i);
+    ASSERT_EQ(log.calls, (size_t)3);
+    ASSERT_EQ(log.last_iteration, (size_t)7);
+    opt_tracer_finish(&t, &r);
+    ASSERT_EQ(log.calls, (size_t)4);
+    ASSERT_EQ(log.last_iteration, (size_t)9);
+    ASSERT_NEAR(log.last_cost, 5.0, 1e-12);
+    opt_result_destroy(&r);
+}
+
 // ============================================================================
 // TESTES: RNG
 // ============================================================================
@@ -125,6 +327,63 @@ TEST(rng_deterministic_seed) {
     ASSERT_NEAR(v2, v4, 1e-15);
 }
 
+TEST(rng_state_streams) {
+    OptRng a, b;
+    opt_rng_seed(&a, 7);
+    opt_rng_seed(&b, 7);
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(opt_rng_next(&a), opt_rng_next(&b));
+    }
+
+    // Stream explicito nao consome o stream da thread
+    opt_set_seed(42);
+    double expected = opt_random_uniform();
+    opt_set_seed(42);
+    for (int i = 0; i < 10; i++) opt_rng_uniform(&a);
+    ASSERT_NEAR(opt_random_uniform(), expected, 1e-15);
+
+    // Jump gera stream distinto
+    opt_rng_jump(&b);
+    ASSERT_NE(opt_rng_next(&a), opt_rng_next(&b));
+}
+
+TEST(rng_state_int_covers_range) {
+    OptRng rng;
+    opt_rng_seed(&rng, 2024);
+    int counts[6] = {0};
+    for (int i = 0; i < 6000; i++) {
+        int v = opt_rng_int(&rng, -2, 3);
+        ASSERT_TRUE(v >= -2 && v <= 3);
+        counts[v + 2]++;
+    }
+    for (int k = 0; k < 6; k++) {
+        ASSERT_TRUE(counts[k] > 800 && counts[k] < 1200);
+    }
+    ASSERT_EQ(opt_rng_int(&rng, 4, 4), 4);
+}
+
+TEST(rng_state_bulk_fill) {
+    OptRng rng;
+    opt_rng_seed(&rng, 31337);
+    enum { N = 10001 };
+    static double buf[N];
+
+    opt_rng_fill_uniform(&rng, buf, N, -2.0, 2.0);
+    for (int i = 0; i < N; i++) {
+        ASSERT_TRUE(buf[i] >= -2.0 && buf[i] < 2.0);
+    }
+
+    opt_rng_fill_gaussian(&rng, buf, N);
+    double sum = 0.0, sq = 0.0;
+    for (int i = 0; i < N; i++) {
+        sum += buf[i];
+        sq += buf[i] * buf[i];
+    }
+    double mean = sum / N;
+    ASSERT_NEAR(mean, 0.0, 0.05);
+    ASSERT_NEAR(sq / N - mean * mean, 1.0, 0.05);
+}
+
 // ============================================================================
 // TESTES: TSP INSTANCIAS
 // ============================================================================
@@ -136,9 +395,9 @@ TEST(tsp_example_5_create) {
     ASSERT_TRUE(inst->known_optimum > 0);
 
     for (size_t i = 0; i < 5; i++) {
-        ASSERT_NEAR(inst->dist_matrix[i][i], 0.0, 1e-9);
+        ASSERT_NEAR(tsp_dist(inst, i, i), 0.0, 1e-9);
         for (size_t j = 0; j < 5; j++) {
-            ASSERT_NEAR(inst->dist_matrix[i][j], inst->dist_matrix[j][i], 1e-9);
+            ASSERT_NEAR(tsp_dist(inst, i, j), tsp_dist(inst, j, i), 1e-9);
         }
     }
 
@@ -175,10 +434,236 @@ TEST(tsp_random_create) {
     tsp_instance_destroy(inst);
 }
 
+TEST(tsp_storage_modes_agree) {
+    TSPInstance *dbl = tsp_create_random_with_storage(40, 9, TSP_DIST_DOUBLE);
+    TSPInstance *flt = tsp_create_random_with_storage(40, 9, TSP_DIST_FLOAT);
+    TSPInstance *crd = tsp_create_random_with_storage(40, 9, TSP_DIST_COORDS);
+    ASSERT_NOT_NULL(dbl);
+    ASSERT_NOT_NULL(flt);
+    ASSERT_NOT_NULL(crd);
+    ASSERT_NULL(flt->dist_matrix);
+    ASSERT_NULL(crd->dist_matrix);
+    ASSERT_NULL(crd->dist_matrix_f32);
+
+    for (size_t i = 0; i < 40; i++) {
+        for (size_t j = 0; j < 40; j++) {
+            double d = tsp_dist(dbl, i, j);
+            ASSERT_NEAR(tsp_dist(crd, i, j), d, 1e-12);
+            ASSERT_NEAR(tsp_dist(flt, i, j), d, 1e-5 * (d + 1.0));
+        }
+    }
+
+    int tour[40];
+    for (int i = 0; i < 40; i++) tour[i] = i;
+    double cost = tsp_tour_cost(tour, 40, dbl);
+    ASSERT_NEAR(tsp_tour_cost(tour, 40, crd), cost, 1e-9);
+    ASSERT_NEAR(tsp_tour_cost(tour, 40, flt), cost, 1e-4);
+
+    tsp_instance_destroy(dbl);
+    tsp_instance_destroy(flt);
+    tsp_instance_destroy(crd);
+}
+
+TEST(tsp_neighbor_lists_sorted) {
+    TSPInstance *inst = tsp_create_random(50, 3);
+    ASSERT_NULL(tsp_neighbor_list(inst, 0));
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 8));
+    ASSERT_EQ(inst->n_neighbors, (size_t)8);
+
+    for (size_t i = 0; i < 50; i++) {
+        const int *nb = tsp_neighbor_list(inst, i);
+        // Distancia do k-esimo vizinho limita todas as cidades fora da lista
+        double kth = tsp_dist(inst, i, (size_t)nb[7]);
+        size_t closer = 0;
+        for (size_t k = 0; k < 8; k++) {
+            ASSERT_NE((size_t)nb[k], i);
+            if (k > 0) {
+                ASSERT_TRUE(tsp_dist(inst, i, (size_t)nb[k - 1]) <= tsp_dist(inst, i, (size_t)nb[k]));
+            }
+        }
+        for (size_t j = 0; j < 50; j++) {
+            if (j != i && tsp_dist(inst, i, j) < kth) closer++;
+        }
+        ASSERT_TRUE(closer < 8);
+    }
+
+    // k maior que n-1 e limitado
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 100));
+    ASSERT_EQ(inst->n_neighbors, (size_t)49);
+    ASSERT_FALSE(tsp_build_neighbor_lists(inst, 0));
+
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // TESTES: TSP CUSTO
 // ============================================================================
 
+// Escreve text num arquivo temporario e le como TSPLIB
+static TSPInstance* tsplib_from_text(const char *text, TSPDistStorage storage) {
+    FILE *f = tmpfile();
+    if (f == NULL) return NULL;
+    fputs(text, f);
+    rewind(f);
+    TSPInstance *inst = tsp_read_tsplib(f, storage);
+    fclose(f);
+    return inst;
+}
+
+TEST(tsplib_euc_2d_matrix_and_coords) {
+    const char *text =
+        "NAME: square4\n"
+        "COMMENT : lados 3 e 4: diagonal 5\n"
+        "TYPE : TSP\n"
+        "DIMENSION:4\n"
+        "EDGE_WEIGHT_TYPE : EUC_2D\n"
+        "NODE_COORD_SECTION\n"
+        "1 0 0\n2 3.0 0\n4 0 4e0\n3 3 4\n"
+        "EOF\n";
+    TSPInstance *mat = tsplib_from_text(text, TSP_DIST_DOUBLE);
+    TSPInstance *crd = tsplib_from_text(text, TSP_DIST_COORDS);
+    ASSERT_NOT_NULL(mat);
+    ASSERT_NOT_NULL(crd);
+    ASSERT_EQ(mat->n_cities, (size_t)4);
+    ASSERT_EQ(mat->metric, TSP_METRIC_EUC_2D);
+    ASSERT_NULL(crd->dist_matrix);
+    ASSERT_NEAR(mat->x[3], 0.0, 1e-12);
+    ASSERT_NEAR(mat->y[3], 4.0, 1e-12);
+    ASSERT_NEAR(tsp_dist(mat, 0, 2), 5.0, 1e-12);
+
+    for (size_t i = 0; i < 4; i++) {
+        for (size_t j = 0; j < 4; j++) {
+            ASSERT_NEAR(tsp_dist(crd, i, j), tsp_dist(mat, i, j), 1e-12);
+        }
+    }
+    tsp_instance_destroy(mat);
+    tsp_instance_destroy(crd);
+
+    // nint: sqrt(2) -> 1, sqrt(8) = 2.83 -> 3
+    TSPInstance *r = tsplib_from_text("TYPE: TSP\nDIMENSION: 3\nEDGE_WEIGHT_TYPE: EUC_2D\n"
+                                      "NODE_COORD_SECTION\n1 0 0\n2 1 1\n3 2 2\nEOF\n",
+                                      TSP_DIST_COORDS);
+    ASSERT_NOT_NULL(r);
+    ASSERT_NEAR(tsp_dist(r, 0, 1), 1.0, 1e-12);
+    ASSERT_NEAR(tsp_dist(r, 0, 2), 3.0, 1e-12);
+    tsp_instance_destroy(r);
+}
+
+TEST(tsplib_ceil_att_geo) {
+    TSPInstance *ceil2d = tsplib_from_text("TYPE: TSP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: CEIL_2D\n"
+                                           "NODE_COORD_SECTION\n1 0 0\n2 1 1\n", TSP_DIST_DOUBLE);
+    ASSERT_NOT_NULL(ceil2d);
+    ASSERT_NEAR(tsp_dist(ceil2d, 0, 1), 2.0, 1e-12);
+    tsp_instance_destroy(ceil2d);
+
+    // sqrt(100 / 10) = 3.16 -> nint 3 < r -> 4
+    TSPInstance *att = tsplib_from_text("TYPE: TSP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: ATT\n"
+                                        "NODE_COORD_SECTION\n1 0 0\n2 10 0\nEOF\n", TSP_DIST_DOUBLE);
+    ASSERT_NOT_NULL(att);
+    ASSERT_NEAR(tsp_dist(att, 0, 1), 4.0, 1e-12);
+    tsp_instance_destroy(att);
+
+    // burma14: otimo publicado 3323
+    const char *burma14 =
+        "NAME: burma14\nTYPE: TSP\nDIMENSION: 14\nEDGE_WEIGHT_TYPE: GEO\nEDGE_WEIGHT_FORMAT: FUNCTION\n"
+        "DISPLAY_DATA_TYPE: COORD_DISPLAY\nNODE_COORD_SECTION\n"
+        "   1  16.47       96.10\n   2  16.47       94.44\n   3  20.09       92.54\n"
+        "   4  22.39       93.37\n   5  25.23       97.24\n   6  22.00       96.05\n"
+        "   7  20.47       97.02\n   8  17.20       96.29\n   9  16.30       97.38\n"
+        "  10  14.05       98.12\n  11  16.53       97.38\n  12  21.52       95.59\n"
+        "  13  19.41       97.13\n  14  20.09       94.55\nEOF\n";
+    int optimal[14] = {1, 2, 14, 3, 4, 5, 6, 12, 7, 13, 8, 11, 9, 10};
+    for (size_t i = 0; i < 14; i++) optimal[i]--;
+
+    TSPInstance *geo = tsplib_from_text(burma14, TSP_DIST_DOUBLE);
+    TSPInstance *geo_crd = tsplib_from_text(burma14, TSP_DIST_COORDS);
+    ASSERT_NOT_NULL(geo);
+    ASSERT_NOT_NULL(geo_crd);
+    ASSERT_NEAR(tsp_tour_cost(optimal, 14, geo), 3323.0, 1e-9);
+    ASSERT_NEAR(tsp_tour_cost(optimal, 14, geo_crd), 3323.0, 1e-9);
+
+    // Listas kNN pela distancia geografica, nao pelas coordenadas
+    ASSERT_TRUE(tsp_build_neighbor_lists(geo, 4));
+    const int *nb = tsp_neighbor_list(geo, 0);
+    for (size_t k = 1; k < 4; k++) {
+        ASSERT_TRUE(tsp_dist(geo, 0, (size_t)nb[k - 1]) <= tsp_dist(geo, 0, (size_t)nb[k]));
+    }
+    tsp_instance_destroy(geo);
+    tsp_instance_destroy(geo_crd);
+}
+
+TEST(tsplib_explicit_formats) {
+    // Matriz simetrica 4 x 4 (diagonal 0) em cada formato
+    const double expected[4][4] = {
+        {0, 1, 2, 3}, {1, 0, 4, 5}, {2, 4, 0, 6}, {3, 5, 6, 0}
+    };
+    const char *sections[] = {
+        "EDGE_WEIGHT_FORMAT: FULL_MATRIX\nEDGE_WEIGHT_SECTION\n0 1 2 3\n1 0 4 5\n2 4 0 6\n3 5 6 0\n",
+        "EDGE_WEIGHT_FORMAT: UPPER_ROW\nEDGE_WEIGHT_SECTION\n1 2 3\n4 5\n6\n",
+        "EDGE_WEIGHT_FORMAT: LOWER_ROW\nEDGE_WEIGHT_SECTION\n1\n2 4\n3 5 6\n",
+        "EDGE_WEIGHT_FORMAT: UPPER_DIAG_ROW\nEDGE_WEIGHT_SECTION\n0 1 2 3 0 4 5 0 6 0\n",
+        "EDGE_WEIGHT_FORMAT: LOWER_DIAG_ROW\nEDGE_WEIGHT_SECTION\n0\n1 0\n2 4 0\n3 5 6 0\n",
+        "EDGE_WEIGHT_FORMAT: UPPER_COL\nEDGE_WEIGHT_SECTION\n1 2 4 3 5 6\n",
+        "EDGE_WEIGHT_FORMAT: LOWER_DIAG_COL\nEDGE_WEIGHT_SECTION\n0 1 2 3 0 4 5 0 6 0\n",
+    };
+
+    for (size_t f = 0; f < sizeof(sections) / sizeof(sections[0]); f++) {
+        char text[512];
+        snprintf(text, sizeof(text), "TYPE: TSP\nDIMENSION: 4\nEDGE_WEIGHT_TYPE: EXPLICIT\n%sEOF\n",
+                 sections[f]);
+        // COORDS nao se aplica a EXPLICIT: cai para matriz double
+        TSPInstance *inst = tsplib_from_text(text, (f % 2) ? TSP_DIST_COORDS : TSP_DIST_FLOAT);
+        ASSERT_NOT_NULL(inst);
+        ASSERT_EQ(inst->metric, TSP_METRIC_EXPLICIT);
+        ASSERT_TRUE(inst->storage == ((f % 2) ? TSP_DIST_DOUBLE : TSP_DIST_FLOAT));
+        for (size_t i = 0; i < 4; i++) {
+            for (size_t j = 0; j < 4; j++) {
+                ASSERT_NEAR(tsp_dist(inst, i, j), expected[i][j], 1e-6);
+            }
+        }
+        tsp_instance_destroy(inst);
+    }
+}
+
+TEST(tsplib_auto_matrix_free_and_errors) {
+    size_t n = TSP_MATRIX_MAX_CITIES + 1;
+    FILE *f = tmpfile();
+    ASSERT_NOT_NULL(f);
+    fprintf(f, "NAME: grid\nTYPE: TSP\nDIMENSION: %zu\nEDGE_WEIGHT_TYPE: EUC_2D\nNODE_COORD_SECTION\n", n);
+    for (size_t i = 0; i < n; i++) fprintf(f, "%zu %zu.5 %zu\n", i + 1, i % 1000, i / 1000);
+    fputs("EOF\n", f);
+    rewind(f);
+    TSPInstance *big = tsp_read_tsplib(f, TSP_DIST_AUTO);
+    fclose(f);
+    ASSERT_NOT_NULL(big);
+    ASSERT_EQ(big->storage, TSP_DIST_COORDS);
+    ASSERT_NULL(big->dist_matrix);
+    ASSERT_NEAR(big->x[n - 1], (double)((n - 1) % 1000) + 0.5, 1e-12);
+    ASSERT_NEAR(tsp_dist(big, 0, 1000), 1.0, 1e-12);
+    tsp_instance_destroy(big);
+
+    TSPInstance *small = tsplib_from_text("TYPE: TSP\nDIMENSION: 3\nEDGE_WEIGHT_TYPE: EUC_2D\n"
+                                          "NODE_COORD_SECTION\n1 0 0\n2 1 0\n3 0 1\nEOF\n",
+                                          TSP_DIST_AUTO);
+    ASSERT_NOT_NULL(small);
+    ASSERT_EQ(small->storage, TSP_DIST_DOUBLE);
+    tsp_instance_destroy(small);
+
+    const char *bad[] = {
+        "TYPE: ATSP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: EUC_2D\nNODE_COORD_SECTION\n1 0 0\n2 1 1\nEOF\n",
+        "TYPE: TSP\nEDGE_WEIGHT_TYPE: EUC_2D\nNODE_COORD_SECTION\n1 0 0\n2 1 1\nEOF\n",
+        "TYPE: TSP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: EUC_3D\nNODE_COORD_SECTION\n1 0 0 0\n2 1 1 1\nEOF\n",
+        "TYPE: TSP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: EUC_2D\nNODE_COORD_SECTION\n1 0 0\n3 1 1\nEOF\n",
+        "TYPE: TSP\nDIMENSION: 3\nEDGE_WEIGHT_TYPE: EUC_2D\nNODE_COORD_SECTION\n1 0 0\n2 1 1\n",
+        "TYPE: TSP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: EUC_2D\nNODE_COORD_SECTION\n1 0 x\n2 1 1\nEOF\n",
+        "TYPE: TSP\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: EUC_2D\nEOF\n",
+    };
+    for (size_t b = 0; b < sizeof(bad) / sizeof(bad[0]); b++) {
+        ASSERT_NULL(tsplib_from_text(bad[b], TSP_DIST_DOUBLE));
+    }
+    ASSERT_NULL(tsp_load_tsplib("/nonexistent/file.tsp", TSP_DIST_AUTO));
+}
+
 TEST(tsp_tour_cost_sequential) {
     TSPInstance *inst = tsp_create_example_5();
     ASSERT_NOT_NULL(inst);
@@ -246,6 +731,143 @@ TEST(tsp_2opt_neighbor) {
     tsp_instance_destroy(inst);
 }
 
+TEST(tsp_move_delta_matches_full_cost) {
+    MoveDeltaFn gens[3] = { tsp_move_2opt, tsp_move_swap, tsp_move_or_opt };
+    const size_t sizes[5] = {3, 4, 5, 9, 30};
+    opt_set_seed(77);
+
+    for (int s = 0; s < 5; s++) {
+        size_t n = sizes[s];
+        TSPInstance *inst = tsp_create_random(n, (unsigned)(10 + s));
+        int tour[30];
+        tsp_generate_random(tour, n, inst);
+
+        for (int g = 0; g < 3; g++) {
+            for (int trial = 0; trial < 300; trial++) {
+                double before = tsp_tour_cost(tour, n, inst);
+                OptMove move;
+                double delta = gens[g](tour, n, &move, inst);
+                ASSERT_EQ(move.type, g == 0 ? TSP_MOVE_2OPT :
+                                     g == 1 ? TSP_MOVE_SWAP : TSP_MOVE_OR_OPT);
+                tsp_move_apply(tour, n, &move, inst);
+                ASSERT_TRUE(tsp_is_valid_tour(tour, n));
+                ASSERT_NEAR(tsp_tour_cost(tour, n, inst) - before, delta, 1e-9);
+            }
+        }
+        tsp_instance_destroy(inst);
+    }
+}
+
+TEST(tsp_or_opt_all_positions) {
+    TSPInstance *inst = tsp_create_random(8, 5);
+    int base[8] = {3, 7, 0, 5, 1, 6, 2, 4};
+
+    for (size_t len = 1; len <= 3; len++) {
+        for (size_t i = 0; i + len <= 8; i++) {
+            for (size_t j = 0; j < 8; j++) {
+                if (j == (i + 7) % 8 || (j >= i && j < i + len)) continue;
+                int tour[8];
+                memcpy(tour, base, sizeof(base));
+                double delta = tsp_delta_or_opt(inst, tour, 8, i, len, j);
+                tsp_apply_or_opt(tour, 8, i, len, j);
+                ASSERT_TRUE(tsp_is_valid_tour(tour, 8));
+                ASSERT_NEAR(tsp_tour_cost(tour, 8, inst) - tsp_tour_cost(base, 8, inst),
+                            delta, 1e-9);
+            }
+        }
+    }
+    tsp_instance_destroy(inst);
+}
+
+// ============================================================================
+// TESTES: TSP BUSCA LOCAL
+// ============================================================================
+
+TEST(tsp_local_search_2opt_optimal) {
+    // Listas completas (k = n - 1): o resultado e 2-opt-otimo de fato
+    TSPInstance *inst = tsp_create_random(60, 11);
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 59));
+
+    opt_set_seed(7);
+    int tour[60];
+    tsp_generate_random(tour, 60, inst);
+    double start = tsp_tour_cost(tour, 60, inst);
+
+    double cost = tsp_local_search_2opt(tour, 60, NULL, inst);
+    ASSERT_TRUE(tsp_is_valid_tour(tour, 60));
+    ASSERT_NEAR(cost, tsp_tour_cost(tour, 60, inst), 1e-9);
+    ASSERT_LT(cost, start);
+
+    for (size_t i = 1; i < 60; i++) {
+        for (size_t j = i + 1; j < 60; j++) {
+            ASSERT_TRUE(tsp_delta_2opt(inst, tour, 60, i, j) > -1e-6);
+        }
+    }
+    tsp_instance_destroy(inst);
+}
+
+TEST(tsp_local_search_candidate_lists) {
+    TSPInstance *inst = tsp_create_random(500, 3);
+    opt_set_seed(21);
+    int tour[500];
+    tsp_generate_random(tour, 500, inst);
+    double start = tsp_tour_cost(tour, 500, inst);
+
+    // Sem listas na instancia: or-opt com listas temporarias
+    int or_tour[500];
+    memcpy(or_tour, tour, sizeof(tour));
+    double or_cost = tsp_local_search_or_opt(or_tour, 500, tsp_tour_cost, inst);
+    ASSERT_TRUE(tsp_is_valid_tour(or_tour, 500));
+    ASSERT_NEAR(or_cost, tsp_tour_cost(or_tour, 500, inst), 1e-9);
+    ASSERT_LT(or_cost, start);
+
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 10));
+    double cost = tsp_local_search(tour, 500, NULL, inst);
+    ASSERT_TRUE(tsp_is_valid_tour(tour, 500));
+    ASSERT_NEAR(cost, tsp_tour_cost(tour, 500, inst), 1e-9);
+    ASSERT_LT(cost, 0.2 * start);
+
+    // Otimo local: nova chamada nao muda o tour
+    int again[500];
+    memcpy(again, tour, sizeof(tour));
+    ASSERT_NEAR(tsp_local_search(again, 500, NULL, inst), cost, 1e-9);
+    ASSERT_EQ(memcmp(again, tour, sizeof(tour)), 0);
+
+    // n < 5: tour inalterado
+    TSPInstance *tiny = tsp_create_random(4, 1);
+    int small[4] = {0, 2, 1, 3};
+    ASSERT_NEAR(tsp_local_search(small, 4, NULL, tiny), tsp_tour_cost(small, 4, tiny), 1e-12);
+    ASSERT_EQ(small[1], 2);
+    tsp_instance_destroy(tiny);
+    tsp_instance_destroy(inst);
+}
+
+TEST(tsp_local_search_lk_improves) {
+    TSPInstance *inst = tsp_create_random(400, 8);
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 10));
+
+    opt_set_seed(5);
+    int tour[400], base[400];
+    tsp_generate_random(base, 400, inst);
+    double start = tsp_tour_cost(base, 400, inst);
+
+    memcpy(tour, base, sizeof(base));
+    double two_opt = tsp_local_search(tour, 400, NULL, inst);
+
+    memcpy(tour, base, sizeof(base));
+    double lk = tsp_local_search_lk(tour, 400, tsp_tour_cost, inst);
+    ASSERT_TRUE(tsp_is_valid_tour(tour, 400));
+    ASSERT_NEAR(lk, tsp_tour_cost(tour, 400, inst), 1e-9);
+    ASSERT_LT(lk, start);
+    ASSERT_LT(lk, two_opt);
+
+    int again[400];
+    memcpy(again, tour, sizeof(tour));
+    ASSERT_NEAR(tsp_local_search_lk(again, 400, NULL, inst), lk, 1e-9);
+    ASSERT_EQ(memcmp(again, tour, sizeof(tour)), 0);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // TESTES: TSP PERTURBACAO
 // ============================================================================
@@ -386,6 +1008,72 @@ TEST(continuous_evaluate_dispatch) {
     continuous_instance_destroy(inst);
 }
 
+TEST(continuous_evaluate_batch_matches) {
+    ContinuousInstance *inst = continuous_create_rosenbrock(3);
+    ASSERT_NOT_NULL(inst);
+
+    double pop[4][3] = {
+        {1.0, 1.0, 1.0}, {0.0, 0.0, 0.0}, {-1.0, 2.0, 0.5}, {2.0, -2.0, 1.0}
+    };
+    double batch[4];
+    double fallback[4];
+
+    continuous_evaluate_batch(pop, 4, sizeof(pop[0]), 3, batch, inst);
+    size_t evals = opt_evaluate_batch(NULL, continuous_evaluate, pop, 4,
+                                      sizeof(pop[0]), 3, fallback, inst);
+    ASSERT_EQ(evals, (size_t)4);
+
+    for (int i = 0; i < 4; i++) {
+        double expected = continuous_evaluate(pop[i], 3, inst);
+        ASSERT_NEAR(batch[i], expected, 1e-12);
+        ASSERT_NEAR(fallback[i], expected, 1e-12);
+    }
+    ASSERT_NEAR(batch[0], 0.0, 1e-12);
+
+    continuous_instance_destroy(inst);
+}
+
+TEST(continuous_simd_matches_scalar) {
+    double (*fns[5])(const double*, size_t) = {
+        continuous_sphere, continuous_rastrigin, continuous_rosenbrock,
+        continuous_ackley, continuous_schwefel
+    };
+    const double bounds[5] = {5.12, 5.12, 10.0, 32.768, 500.0};
+    const size_t dims[5] = {2, 3, 7, 13, 1000};
+
+    OptRng rng;
+    opt_rng_seed(&rng, 11);
+    double x[1000];
+
+    for (int f = 0; f < 5; f++) {
+        for (int k = 0; k < 5; k++) {
+            opt_rng_fill_uniform(&rng, x, dims[k], -bounds[f], bounds[f]);
+
+            continuous_set_simd_level(CONTINUOUS_SIMD_SCALAR);
+            double ref = fns[f](x, dims[k]);
+            continuous_set_simd_level(CONTINUOUS_SIMD_AVX512);
+            double vec = fns[f](x, dims[k]);
+
+            double scale = fabs(ref) > 1.0 ? fabs(ref) : 1.0;
+            ASSERT_NEAR(vec, ref, 1e-12 * scale);
+        }
+    }
+
+    // Argumento fora da faixa da reducao vetorial cai na libm
+    for (int i = 0; i < 8; i++) x[i] = 1e7 + 0.25 * i;
+    continuous_set_simd_level(CONTINUOUS_SIMD_SCALAR);
+    double ref = continuous_rastrigin(x, 8);
+    continuous_set_simd_level(CONTINUOUS_SIMD_AVX512);
+    ASSERT_NEAR(continuous_rastrigin(x, 8), ref, 1e-12 * fabs(ref));
+}
+
+TEST(continuous_simd_level_override) {
+    ContinuousSimdLevel best = continuous_simd_level();
+    ASSERT_EQ(continuous_set_simd_level(CONTINUOUS_SIMD_SCALAR), CONTINUOUS_SIMD_SCALAR);
+    ASSERT_EQ(continuous_simd_level(), CONTINUOUS_SIMD_SCALAR);
+    ASSERT_EQ(continuous_set_simd_level(CONTINUOUS_SIMD_AVX512), best);
+}
+
 // ============================================================================
 // TESTES: CONTINUOUS VIZINHANCA E GERACAO
 // ============================================================================
@@ -490,21 +1178,42 @@ int main(void) {
     RUN_TEST(solution_create_zero);
     RUN_TEST(solution_clone);
     RUN_TEST(solution_clone_null);
+    RUN_TEST(solution_copy_into);
+    RUN_TEST(solution_pool_recycles);
 
     printf("\n[OptResult]\n");
     RUN_TEST(result_create_destroy);
 
+    printf("\n[Criterios de Parada]\n");
+    RUN_TEST(stop_none_never_stops);
+    RUN_TEST(stop_evaluations_and_target);
+    RUN_TEST(stop_time_limit);
+
+    printf("\n[Progresso e Amostragem]\n");
+    RUN_TEST(trace_full_default);
+    RUN_TEST(trace_ring_keeps_last_samples);
+    RUN_TEST(trace_none_with_callback);
+
     printf("\n[RNG]\n");
     RUN_TEST(rng_uniform_range);
     RUN_TEST(rng_int_range);
     RUN_TEST(rng_gaussian_distribution);
     RUN_TEST(rng_deterministic_seed);
+    RUN_TEST(rng_state_streams);
+    RUN_TEST(rng_state_int_covers_range);
+    RUN_TEST(rng_state_bulk_fill);
 
     printf("\n[TSP Instancias]\n");
     RUN_TEST(tsp_example_5_create);
     RUN_TEST(tsp_example_10_create);
     RUN_TEST(tsp_example_20_create);
     RUN_TEST(tsp_random_create);
+    RUN_TEST(tsp_storage_modes_agree);
+    RUN_TEST(tsp_neighbor_lists_sorted);
+    RUN_TEST(tsplib_euc_2d_matrix_and_coords);
+    RUN_TEST(tsplib_ceil_att_geo);
+    RUN_TEST(tsplib_explicit_formats);
+    RUN_TEST(tsplib_auto_matrix_free_and_errors);
 
     printf("\n[TSP Custo]\n");
     RUN_TEST(tsp_tour_cost_sequential);
@@ -514,6 +1223,13 @@ int main(void) {
     printf("\n[TSP Vizinhancas]\n");
     RUN_TEST(tsp_swap_neighbor);
     RUN_TEST(tsp_2opt_neighbor);
+    RUN_TEST(tsp_move_delta_matches_full_cost);
+    RUN_TEST(tsp_or_opt_all_positions);
+
+    printf("\n[TSP Busca Local]\n");
+    RUN_TEST(tsp_local_search_2opt_optimal);
+    RUN_TEST(tsp_local_search_candidate_lists);
+    RUN_TEST(tsp_local_search_lk_improves);
 
     printf("\n[TSP Perturbacao]\n");
     RUN_TEST(tsp_double_bridge);
@@ -535,6 +1251,9 @@ int main(void) {
     RUN_TEST(continuous_ackley_at_optimum);
     RUN_TEST(continuous_schwefel_at_optimum);
     RUN_TEST(continuous_evaluate_dispatch);
+    RUN_TEST(continuous_evaluate_batch_matches);
+    RUN_TEST(continuous_simd_matches_scalar);
+    RUN_TEST(continuous_simd_level_override);
 
     printf("\n[Continuous Vizinhanca/Geracao]\n");
     RUN_TEST(continuous_gaussian_neighbor);
@@ -545,6 +1264,6 @@ int main(void) {
     RUN_TEST(continuous_fn_name_strings);
     RUN_TEST(continuous_known_optimum_point_values);
 
-    printf("\n=== Todos os %d testes passaram! ===\n", 32);
+    printf("\n=== Todos os %d testes passaram! ===\n", 57);
     return 0;
 }
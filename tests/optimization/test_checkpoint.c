@@ -0,0 +1,240 @@
+/**
+ * @file test_checkpoint.c
+ * @brief Testes do formato de checkpoint
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "../test_macros.h"
+#include "optimization/checkpoint.h"
+#include <stdbool.h>
+#include <string.h>
+
+#define CKPT_PATH "test_checkpoint.ckpt"
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static const size_t DIMS[3] = {8, 16, 2};
+
+// Grava um checkpoint GA com um bloco de estado, um stream e um historico
+static bool write_sample(size_t iteration, const OptRng *rng, const OptResult *history) {
+    OptCheckpoint ck;
+    if (!opt_checkpoint_write_begin(&ck, CKPT_PATH, OPT_CHECKPOINT_GA,
+                                    opt_checkpoint_fingerprint(DIMS, 3), iteration)) {
+        return false;
+    }
+    int block[4] = {1, -2, 3, -4};
+    opt_checkpoint_write(&ck, block, sizeof(block));
+    opt_checkpoint_write_rng(&ck, rng);
+    opt_checkpoint_write_history(&ck, history, 3);
+    return opt_checkpoint_write_end(&ck, CKPT_PATH);
+}
+
+static long file_size(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (f == NULL) return -1;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fclose(f);
+    return size;
+}
+
+// ============================================================================
+// TESTES: CONFIGURACAO
+// ============================================================================
+
+TEST(checkpoint_due) {
+    OptCheckpointConfig cfg = opt_checkpoint_none();
+    size_t saved = 0;
+    ASSERT_FALSE(opt_checkpoint_due(&cfg, 10, &saved, true));
+    ASSERT_FALSE(opt_checkpoint_due(NULL, 10, &saved, true));
+
+    cfg.path = CKPT_PATH;
+    cfg.interval = 10;
+    ASSERT_FALSE(opt_checkpoint_due(&cfg, 9, &saved, false));
+    ASSERT_TRUE(opt_checkpoint_due(&cfg, 10, &saved, false));
+    ASSERT_EQ(saved, 10);
+    ASSERT_FALSE(opt_checkpoint_due(&cfg, 15, &saved, false));
+    ASSERT_TRUE(opt_checkpoint_due(&cfg, 15, &saved, true));
+    ASSERT_EQ(saved, 15);
+    ASSERT_TRUE(opt_checkpoint_due(&cfg, 25, &saved, false));
+
+    // interval = 0: so no fim
+    cfg.interval = 0;
+    saved = 0;
+    ASSERT_FALSE(opt_checkpoint_due(&cfg, 1000, &saved, false));
+    ASSERT_TRUE(opt_checkpoint_due(&cfg, 1000, &saved, true));
+}
+
+TEST(checkpoint_fingerprint) {
+    size_t a[3] = {8, 16, 2};
+    size_t b[3] = {8, 16, 3};
+    ASSERT_EQ(opt_checkpoint_fingerprint(a, 3), opt_checkpoint_fingerprint(DIMS, 3));
+    ASSERT_NE(opt_checkpoint_fingerprint(a, 3), opt_checkpoint_fingerprint(b, 3));
+    ASSERT_NE(opt_checkpoint_fingerprint(a, 2), opt_checkpoint_fingerprint(a, 3));
+}
+
+// ============================================================================
+// TESTES: FORMATO
+// ============================================================================
+
+TEST(checkpoint_roundtrip) {
+    OptRng rng;
+    opt_rng_seed(&rng, 7);
+    (void)opt_rng_gaussian(&rng);   // deixa um gaussiano guardado
+    OptResult history = opt_result_create(5);
+    for (size_t i = 0; i < 5; i++) history.convergence[i] = 10.0 - (double)i;
+    ASSERT_TRUE(write_sample(42, &rng, &history));
+
+    OptCheckpoint ck;
+    size_t iteration = 0;
+    ASSERT_TRUE(opt_checkpoint_read_begin(&ck, CKPT_PATH, OPT_CHECKPOINT_GA,
+                                          opt_checkpoint_fingerprint(DIMS, 3), &iteration));
+    ASSERT_EQ(iteration, 42);
+
+    int block[4];
+    OptRng restored;
+    OptResult out = opt_result_create(5);
+    ASSERT_TRUE(opt_checkpoint_read(&ck, block, sizeof(block)));
+    ASSERT_TRUE(opt_checkpoint_read_rng(&ck, &restored));
+    ASSERT_TRUE(opt_checkpoint_read_history(&ck, &out));
+    ASSERT_TRUE(opt_checkpoint_read_end(&ck));
+
+    ASSERT_EQ(block[0], 1);
+    ASSERT_EQ(block[3], -4);
+    for (int i = 0; i < 8; i++) ASSERT_EQ(opt_rng_next(&restored), opt_rng_next(&rng));
+    ASSERT_TRUE(opt_rng_gaussian(&restored) == opt_rng_gaussian(&rng));
+    ASSERT_NEAR(out.convergence[0], 10.0, 1e-12);
+    ASSERT_NEAR(out.convergence[2], 8.0, 1e-12);
+    ASSERT_NEAR(out.convergence[3], 0.0, 1e-12);   // so o prefixo [0, 3)
+
+    opt_result_destroy(&history);
+    opt_result_destroy(&out);
+    remove(CKPT_PATH);
+}
+
+TEST(checkpoint_rejects_mismatch) {
+    OptRng rng;
+    opt_rng_seed(&rng, 1);
+    OptResult history = opt_result_create(0);
+    ASSERT_TRUE(write_sample(5, &rng, &history));
+
+    OptCheckpoint ck;
+    size_t iteration = 0;
+    size_t other[3] = {8, 16, 3};
+    ASSERT_FALSE(opt_checkpoint_read_begin(&ck, CKPT_PATH, OPT_CHECKPOINT_ALNS,
+                                           opt_checkpoint_fingerprint(DIMS, 3), &iteration));
+    ASSERT_FALSE(opt_checkpoint_read_begin(&ck, CKPT_PATH, OPT_CHECKPOINT_GA,
+                                           opt_checkpoint_fingerprint(other, 3), &iteration));
+    ASSERT_FALSE(opt_checkpoint_read_begin(&ck, "missing_checkpoint.ckpt", OPT_CHECKPOINT_GA,
+                                           opt_checkpoint_fingerprint(DIMS, 3), &iteration));
+    ASSERT_EQ(iteration, 0);
+
+    // Ler alem do fim, ou nao consumir tudo, invalida a leitura
+    ASSERT_TRUE(opt_checkpoint_read_begin(&ck, CKPT_PATH, OPT_CHECKPOINT_GA,
+                                          opt_checkpoint_fingerprint(DIMS, 3), &iteration));
+    int block[4];
+    ASSERT_TRUE(opt_checkpoint_read(&ck, block, sizeof(block)));
+    ASSERT_FALSE(opt_checkpoint_read_end(&ck));
+
+    ASSERT_TRUE(opt_checkpoint_read_begin(&ck, CKPT_PATH, OPT_CHECKPOINT_GA,
+                                          opt_checkpoint_fingerprint(DIMS, 3), &iteration));
+    char big[4096];
+    ASSERT_FALSE(opt_checkpoint_read(&ck, big, sizeof(big)));
+    ASSERT_FALSE(opt_checkpoint_read_end(&ck));
+
+    opt_result_destroy(&history);
+    remove(CKPT_PATH);
+}
+
+TEST(checkpoint_rejects_corruption) {
+    OptRng rng;
+    opt_rng_seed(&rng, 3);
+    OptResult history = opt_result_create(0);
+    ASSERT_TRUE(write_sample(9, &rng, &history));
+    long size = file_size(CKPT_PATH);
+    ASSERT_TRUE(size > 48);
+
+    // Um bit trocado no meio do estado
+    FILE *f = fopen(CKPT_PATH, "r+b");
+    ASSERT_NOT_NULL(f);
+    fseek(f, 44, SEEK_SET);
+    int c = fgetc(f);
+    fseek(f, 44, SEEK_SET);
+    fputc(c ^ 0x10, f);
+    fclose(f);
+
+    OptCheckpoint ck;
+    size_t iteration = 0;
+    ASSERT_FALSE(opt_checkpoint_read_begin(&ck, CKPT_PATH, OPT_CHECKPOINT_GA,
+                                           opt_checkpoint_fingerprint(DIMS, 3), &iteration));
+
+    // Arquivo truncado (gravacao interrompida)
+    ASSERT_TRUE(write_sample(9, &rng, &history));
+    f = fopen(CKPT_PATH, "rb");
+    ASSERT_NOT_NULL(f);
+    char buffer[256];
+    size_t n = fread(buffer, 1, sizeof(buffer), f);
+    fclose(f);
+    f = fopen(CKPT_PATH, "wb");
+    ASSERT_NOT_NULL(f);
+    fwrite(buffer, 1, n - 8, f);
+    fclose(f);
+    ASSERT_FALSE(opt_checkpoint_read_begin(&ck, CKPT_PATH, OPT_CHECKPOINT_GA,
+                                           opt_checkpoint_fingerprint(DIMS, 3), &iteration));
+
+    opt_result_destroy(&history);
+    remove(CKPT_PATH);
+}
+
+TEST(checkpoint_replaces_previous) {
+    OptRng rng;
+    opt_rng_seed(&rng, 5);
+    OptResult history = opt_result_create(0);
+    ASSERT_TRUE(write_sample(10, &rng, &history));
+    ASSERT_TRUE(write_sample(20, &rng, &history));
+
+    // O temporario foi renomeado: nao sobra nada alem do checkpoint
+    ASSERT_EQ(file_size(CKPT_PATH ".tmp"), -1);
+
+    OptCheckpoint ck;
+    size_t iteration = 0;
+    ASSERT_TRUE(opt_checkpoint_read_begin(&ck, CKPT_PATH, OPT_CHECKPOINT_GA,
+                                          opt_checkpoint_fingerprint(DIMS, 3), &iteration));
+    ASSERT_EQ(iteration, 20);
+    opt_checkpoint_read_end(&ck);
+
+    // Diretorio inexistente: falha sem tocar no checkpoint anterior
+    OptCheckpoint bad;
+    ASSERT_FALSE(opt_checkpoint_write_begin(&bad, "missing_dir/x.ckpt", OPT_CHECKPOINT_GA, 0, 1));
+    ASSERT_TRUE(opt_checkpoint_read_begin(&ck, CKPT_PATH, OPT_CHECKPOINT_GA,
+                                          opt_checkpoint_fingerprint(DIMS, 3), &iteration));
+    opt_checkpoint_read_end(&ck);
+
+    opt_result_destroy(&history);
+    remove(CKPT_PATH);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Testes Checkpoint ===\n\n");
+
+    printf("[Configuracao]\n");
+    RUN_TEST(checkpoint_due);
+    RUN_TEST(checkpoint_fingerprint);
+
+    printf("\n[Formato]\n");
+    RUN_TEST(checkpoint_roundtrip);
+    RUN_TEST(checkpoint_rejects_mismatch);
+    RUN_TEST(checkpoint_rejects_corruption);
+    RUN_TEST(checkpoint_replaces_previous);
+
+    printf("\n=== Todos os 6 testes passaram! ===\n");
+    return 0;
+}
@@ -8,6 +8,7 @@
 #include "optimization/benchmarks/continuous.h"
 #include "optimization/metaheuristics/differential_evolution.h"
 #include <math.h>
+#include <string.h>
 
 // ============================================================================
 // TESTES DE CONFIGURACAO
@@ -22,6 +23,8 @@ TEST(de_default_config_values) {
     ASSERT_EQ(cfg.strategy, DE_RAND_1);
     ASSERT_NEAR(cfg.lower_bound, -5.12, 1e-9);
     ASSERT_NEAR(cfg.upper_bound, 5.12, 1e-9);
+    ASSERT_FALSE(cfg.parallel_generation);
+    ASSERT_EQ(cfg.num_threads, 1);
     ASSERT_EQ(cfg.direction, OPT_MINIMIZE);
     ASSERT_EQ(cfg.seed, 42);
 }
@@ -214,6 +217,124 @@ TEST(de_small_population) {
     continuous_instance_destroy(inst);
 }
 
+// Lote que so chama continuous_evaluate por linha (referencia do kernel)
+static void per_row_batch(const void *solutions, size_t count, size_t stride,
+                          size_t solution_size, double *costs, const void *context) {
+    const unsigned char *row = solutions;
+    for (size_t i = 0; i < count; i++) {
+        costs[i] = continuous_evaluate(row + i * stride, solution_size, context);
+    }
+}
+
+TEST(de_batch_objective_matches_per_row) {
+    ContinuousInstance *inst = continuous_create_rastrigin(4);
+    ASSERT_NOT_NULL(inst);
+
+    DEConfig cfg = de_default_config();
+    cfg.population_size = 20;
+    cfg.max_generations = 60;
+    cfg.seed = 11;
+
+    cfg.batch_objective = per_row_batch;
+    OptResult rows = de_run(&cfg, inst->dimensions, continuous_evaluate, inst);
+    cfg.batch_objective = continuous_evaluate_batch;
+    OptResult batch = de_run(&cfg, inst->dimensions, continuous_evaluate, inst);
+
+    ASSERT_EQ(rows.num_evaluations, batch.num_evaluations);
+    ASSERT_NEAR(rows.best.cost, batch.best.cost, 1e-12);
+    for (size_t i = 0; i < rows.num_iterations; i++) {
+        ASSERT_NEAR(rows.convergence[i], batch.convergence[i], 1e-12);
+    }
+
+    opt_result_destroy(&rows);
+    opt_result_destroy(&batch);
+    continuous_instance_destroy(inst);
+}
+
+TEST(de_scalar_selection_is_asynchronous) {
+    ContinuousInstance *inst = continuous_create_rastrigin(4);
+    ASSERT_NOT_NULL(inst);
+
+    DEConfig cfg = de_default_config();
+    cfg.population_size = 20;
+    cfg.max_generations = 60;
+    cfg.seed = 11;
+
+    // Mesmos sorteios, mas o trial aceito ja entra na populacao da geracao
+    OptResult async = de_run(&cfg, inst->dimensions, continuous_evaluate, inst);
+    cfg.batch_objective = per_row_batch;
+    OptResult sync = de_run(&cfg, inst->dimensions, continuous_evaluate, inst);
+
+    ASSERT_EQ(async.num_evaluations, sync.num_evaluations);
+    ASSERT_EQ(async.num_evaluations, (size_t)(20 * 61));
+    ASSERT_TRUE(async.best.cost != sync.best.cost);
+
+    opt_result_destroy(&async);
+    opt_result_destroy(&sync);
+    continuous_instance_destroy(inst);
+}
+
+// ============================================================================
+// TESTES: GERACAO PARALELA
+// ============================================================================
+
+TEST(de_parallel_threads_deterministic) {
+    ContinuousInstance *inst = continuous_create_rastrigin(12);
+    ASSERT_NOT_NULL(inst);
+
+    DEConfig cfg = de_default_config();
+    cfg.population_size = 40;
+    cfg.max_generations = 80;
+    cfg.strategy = DE_CURRENT_TO_BEST_1;
+    cfg.parallel_generation = true;
+    cfg.num_threads = 1;
+    OptResult serial = de_run(&cfg, inst->dimensions, continuous_evaluate, inst);
+    cfg.num_threads = 4;
+    OptResult parallel = de_run(&cfg, inst->dimensions, continuous_evaluate, inst);
+    cfg.batch_objective = continuous_evaluate_batch;
+    OptResult batch = de_run(&cfg, inst->dimensions, continuous_evaluate, inst);
+
+    ASSERT_EQ(serial.num_evaluations, (size_t)(40 * 81));
+    ASSERT_EQ(parallel.num_evaluations, serial.num_evaluations);
+    ASSERT_NEAR(serial.best.cost, parallel.best.cost, 1e-12);
+    ASSERT_NEAR(serial.best.cost, batch.best.cost, 1e-12);
+    for (size_t i = 0; i < serial.num_iterations; i++) {
+        ASSERT_NEAR(serial.convergence[i], parallel.convergence[i], 1e-12);
+    }
+    ASSERT_EQ(memcmp(serial.best.data, parallel.best.data, 12 * sizeof(double)), 0);
+
+    opt_result_destroy(&serial);
+    opt_result_destroy(&parallel);
+    opt_result_destroy(&batch);
+    continuous_instance_destroy(inst);
+}
+
+TEST(de_parallel_all_strategies) {
+    ContinuousInstance *inst = continuous_create_sphere(8);
+    ASSERT_NOT_NULL(inst);
+
+    DEStrategy strategies[] = { DE_RAND_1, DE_BEST_1, DE_CURRENT_TO_BEST_1,
+                                DE_RAND_2, DE_BEST_2 };
+    for (size_t s = 0; s < 5; s++) {
+        DEConfig cfg = de_default_config();
+        cfg.population_size = 30;
+        cfg.max_generations = 300;
+        cfg.strategy = strategies[s];
+        cfg.parallel_generation = true;
+        cfg.num_threads = 0;
+
+        OptResult res = de_run(&cfg, inst->dimensions, continuous_evaluate, inst);
+        ASSERT_LT(res.best.cost, 1.0);
+        const double *x = (const double*)res.best.data;
+        for (size_t d = 0; d < 8; d++) {
+            ASSERT_TRUE(x[d] >= cfg.lower_bound && x[d] <= cfg.upper_bound);
+        }
+        opt_result_destroy(&res);
+    }
+
+    continuous_instance_destroy(inst);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -244,7 +365,13 @@ int main(void) {
     RUN_TEST(de_zero_generations);
     RUN_TEST(de_convergence_monotonic);
     RUN_TEST(de_small_population);
+    RUN_TEST(de_batch_objective_matches_per_row);
+    RUN_TEST(de_scalar_selection_is_asynchronous);
+
+    printf("\n[Geracao Paralela]\n");
+    RUN_TEST(de_parallel_threads_deterministic);
+    RUN_TEST(de_parallel_all_strategies);
 
-    printf("\n=== Todos os 10 testes passaram! ===\n");
+    printf("\n=== Todos os 14 testes passaram! ===\n");
     return 0;
 }
@@ -0,0 +1,233 @@
+/**
+ * @file test_eval_cache.c
+ * @brief Testes do cache LRU de avaliacoes
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "../test_macros.h"
+#include "optimization/eval_cache.h"
+#include "optimization/metaheuristics/genetic_algorithm.h"
+#include "optimization/benchmarks/tsp.h"
+#include <stdbool.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+typedef struct {
+    size_t calls;
+} CountingCtx;
+
+// Soma ponderada dos elementos; conta as chamadas reais
+static double counting_objective(const void *data, size_t size, const void *context) {
+    CountingCtx *ctx = (CountingCtx*)context;
+    const int *v = (const int*)data;
+    double sum = 0.0;
+    for (size_t i = 0; i < size; i++) sum += (double)((int)i + 1) * v[i];
+    ctx->calls++;
+    return sum;
+}
+
+// ============================================================================
+// TESTES: CRIACAO
+// ============================================================================
+
+TEST(eval_cache_invalid_params) {
+    CountingCtx ctx = {0};
+    ASSERT_NULL(opt_eval_cache_create(0, sizeof(int), counting_objective, &ctx));
+    ASSERT_NULL(opt_eval_cache_create(8, 0, counting_objective, &ctx));
+    ASSERT_NULL(opt_eval_cache_create(8, sizeof(int), NULL, &ctx));
+    opt_eval_cache_destroy(NULL);
+    ASSERT_EQ(opt_eval_cache_hits(NULL), (size_t)0);
+}
+
+// ============================================================================
+// TESTES: MEMOIZACAO
+// ============================================================================
+
+TEST(eval_cache_hits_and_misses) {
+    CountingCtx ctx = {0};
+    OptEvalCache *cache = opt_eval_cache_create(8, 3 * sizeof(int), counting_objective, &ctx);
+    ASSERT_NOT_NULL(cache);
+
+    int a[3] = {1, 2, 3};
+    int b[3] = {3, 2, 1};
+    double ca = opt_eval_cache_objective(a, 3, cache);
+    double cb = opt_eval_cache_objective(b, 3, cache);
+    ASSERT_NEAR(ca, 14.0, 1e-12);
+    ASSERT_NEAR(cb, 10.0, 1e-12);
+    for (int i = 0; i < 5; i++) {
+        ASSERT_NEAR(opt_eval_cache_objective(a, 3, cache), ca, 1e-12);
+    }
+
+    ASSERT_EQ(ctx.calls, (size_t)2);
+    ASSERT_EQ(opt_eval_cache_misses(cache), (size_t)2);
+    ASSERT_EQ(opt_eval_cache_hits(cache), (size_t)5);
+    ASSERT_EQ(opt_eval_cache_size(cache), (size_t)2);
+
+    OptResult r = opt_result_create(0);
+    r.num_evaluations = 7;
+    opt_eval_cache_report(cache, &r);
+    ASSERT_EQ(r.num_evaluations, (size_t)2);
+    ASSERT_EQ(r.num_cache_hits, (size_t)5);
+
+    opt_eval_cache_clear(cache);
+    ASSERT_EQ(opt_eval_cache_size(cache), (size_t)0);
+    ASSERT_EQ(opt_eval_cache_hits(cache), (size_t)0);
+    opt_eval_cache_objective(a, 3, cache);
+    ASSERT_EQ(ctx.calls, (size_t)3);
+
+    opt_eval_cache_destroy(cache);
+}
+
+TEST(eval_cache_lru_eviction) {
+    CountingCtx ctx = {0};
+    OptEvalCache *cache = opt_eval_cache_create(2, sizeof(int), counting_objective, &ctx);
+    int x = 1, y = 2, z = 3;
+
+    opt_eval_cache_objective(&x, 1, cache);
+    opt_eval_cache_objective(&y, 1, cache);
+    opt_eval_cache_objective(&x, 1, cache);  // x mais recente
+    opt_eval_cache_objective(&z, 1, cache);  // expulsa y
+    ASSERT_EQ(ctx.calls, (size_t)3);
+    ASSERT_EQ(opt_eval_cache_size(cache), (size_t)2);
+
+    opt_eval_cache_objective(&x, 1, cache);
+    opt_eval_cache_objective(&z, 1, cache);
+    ASSERT_EQ(ctx.calls, (size_t)3);
+    opt_eval_cache_objective(&y, 1, cache);
+    ASSERT_EQ(ctx.calls, (size_t)4);
+
+    opt_eval_cache_destroy(cache);
+}
+
+TEST(eval_cache_lookup_and_store) {
+    CountingCtx ctx = {0};
+    OptEvalCache *cache = opt_eval_cache_create(2, sizeof(int), counting_objective, &ctx);
+    int x = 1, y = 2, z = 3;
+    double cost = 0.0;
+
+    ASSERT_FALSE(opt_eval_cache_lookup(cache, &x, &cost));
+    opt_eval_cache_store(cache, &x, 10.0);
+    opt_eval_cache_store(cache, &y, 20.0);
+    ASSERT_TRUE(opt_eval_cache_lookup(cache, &x, &cost));  // x mais recente
+    ASSERT_NEAR(cost, 10.0, 1e-12);
+
+    opt_eval_cache_store(cache, &x, 11.0);                 // atualiza
+    opt_eval_cache_store(cache, &z, 30.0);                 // expulsa y
+    ASSERT_FALSE(opt_eval_cache_lookup(cache, &y, NULL));
+    ASSERT_TRUE(opt_eval_cache_lookup(cache, &x, &cost));
+    ASSERT_NEAR(cost, 11.0, 1e-12);
+
+    // Guardado conta como hit para a objective memoizada
+    ASSERT_NEAR(opt_eval_cache_objective(&z, 1, cache), 30.0, 1e-12);
+    ASSERT_EQ(ctx.calls, (size_t)0);
+    ASSERT_EQ(opt_eval_cache_hits(cache), (size_t)1);
+    ASSERT_EQ(opt_eval_cache_misses(cache), (size_t)0);
+
+    opt_eval_cache_destroy(cache);
+}
+
+TEST(eval_cache_many_distinct) {
+    CountingCtx ctx = {0};
+    OptEvalCache *cache = opt_eval_cache_create(64, 2 * sizeof(int), counting_objective, &ctx);
+
+    // 500 solucoes distintas em cache de 64: todo custo devolvido e o real
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < 500; i++) {
+            int v[2] = {i, i % 7};
+            double expected = (double)i + 2.0 * (double)(i % 7);
+            ASSERT_NEAR(opt_eval_cache_objective(v, 2, cache), expected, 1e-12);
+        }
+    }
+    ASSERT_EQ(opt_eval_cache_size(cache), (size_t)64);
+    ASSERT_EQ(opt_eval_cache_hits(cache) + opt_eval_cache_misses(cache), (size_t)1000);
+
+    opt_eval_cache_destroy(cache);
+}
+
+// ============================================================================
+// TESTES: INTEGRACAO
+// ============================================================================
+
+static GAConfig small_ga(void) {
+    GAConfig cfg = ga_default_config();
+    cfg.population_size = 30;
+    cfg.max_generations = 60;
+    cfg.seed = 11;
+    return cfg;
+}
+
+TEST(eval_cache_ga_same_result) {
+    TSPInstance *inst = tsp_create_random(8, 5);
+    size_t n = inst->n_cities;
+    GAConfig cfg = small_ga();
+
+    OptResult plain = ga_run(&cfg, n * sizeof(int), n, tsp_tour_cost, tsp_generate_random,
+                             ga_crossover_ox, ga_mutation_swap, NULL, inst);
+
+    OptEvalCache *cache = opt_eval_cache_create(256, n * sizeof(int), tsp_tour_cost, inst);
+    OptResult cached = ga_run(&cfg, n * sizeof(int), n, opt_eval_cache_objective,
+                              tsp_generate_random, ga_crossover_ox, ga_mutation_swap,
+                              NULL, cache);
+    size_t calls = cached.num_evaluations;
+    opt_eval_cache_report(cache, &cached);
+
+    ASSERT_NEAR(cached.best.cost, plain.best.cost, 1e-12);
+    ASSERT_EQ(calls, plain.num_evaluations);
+    ASSERT_EQ(cached.num_evaluations + cached.num_cache_hits, calls);
+    ASSERT_GT(cached.num_cache_hits, (size_t)0);   // 8 cidades: muitos repetidos
+
+    opt_eval_cache_destroy(cache);
+    opt_result_destroy(&plain);
+    opt_result_destroy(&cached);
+    tsp_instance_destroy(inst);
+}
+
+TEST(eval_cache_ga_parallel) {
+    TSPInstance *inst = tsp_create_random(8, 9);
+    size_t n = inst->n_cities;
+    GAConfig cfg = small_ga();
+    cfg.num_threads = 4;
+
+    OptResult plain = ga_run(&cfg, n * sizeof(int), n, tsp_tour_cost, tsp_generate_random,
+                             ga_crossover_ox, ga_mutation_swap, NULL, inst);
+
+    OptEvalCache *cache = opt_eval_cache_create(32, n * sizeof(int), tsp_tour_cost, inst);
+    OptResult cached = ga_run(&cfg, n * sizeof(int), n, opt_eval_cache_objective,
+                              tsp_generate_random, ga_crossover_ox, ga_mutation_swap,
+                              NULL, cache);
+    ASSERT_NEAR(cached.best.cost, plain.best.cost, 1e-12);
+    ASSERT_TRUE(opt_eval_cache_size(cache) <= 32);
+
+    opt_eval_cache_destroy(cache);
+    opt_result_destroy(&plain);
+    opt_result_destroy(&cached);
+    tsp_instance_destroy(inst);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Testes Cache de Avaliacoes ===\n\n");
+
+    printf("[Criacao]\n");
+    RUN_TEST(eval_cache_invalid_params);
+
+    printf("\n[Memoizacao]\n");
+    RUN_TEST(eval_cache_hits_and_misses);
+    RUN_TEST(eval_cache_lru_eviction);
+    RUN_TEST(eval_cache_lookup_and_store);
+    RUN_TEST(eval_cache_many_distinct);
+
+    printf("\n[Integracao]\n");
+    RUN_TEST(eval_cache_ga_same_result);
+    RUN_TEST(eval_cache_ga_parallel);
+
+    printf("\n=== Todos os 7 testes passaram! ===\n");
+    return 0;
+}
@@ -12,6 +12,7 @@
 #include "optimization/benchmarks/continuous.h"
 #include <math.h>
 #include <float.h>
+#include <string.h>
 
 // ============================================================================
 // TESTES: CONFIGURACAO
@@ -28,6 +29,7 @@ TEST(ga_default_config_values) {
     ASSERT_EQ(cfg.tournament_size, (size_t)3);
     ASSERT_FALSE(cfg.enable_local_search);
     ASSERT_FALSE(cfg.enable_adaptive_rates);
+    ASSERT_EQ(cfg.num_threads, (size_t)1);
     ASSERT_EQ((int)cfg.direction, (int)OPT_MINIMIZE);
 }
 
@@ -325,6 +327,261 @@ TEST(ga_elitism_preserves_best) {
     continuous_instance_destroy(inst);
 }
 
+// ============================================================================
+// TESTES: AVALIACAO PARALELA
+// ============================================================================
+
+TEST(ga_parallel_matches_serial) {
+    ContinuousInstance *inst = continuous_create_rastrigin(5);
+    ASSERT_NOT_NULL(inst);
+
+    GAConfig cfg = ga_default_config();
+    cfg.population_size = 30;
+    cfg.max_generations = 40;
+    cfg.seed = 7;
+
+    OptResult serial = ga_run(&cfg, sizeof(double) * 5, 5,
+                              continuous_evaluate, continuous_generate_random,
+                              ga_crossover_blx, ga_mutation_gaussian, NULL, inst);
+
+    cfg.num_threads = 4;
+    OptResult parallel = ga_run(&cfg, sizeof(double) * 5, 5,
+                                continuous_evaluate, continuous_generate_random,
+                                ga_crossover_blx, ga_mutation_gaussian, NULL, inst);
+
+    ASSERT_EQ(serial.num_evaluations, parallel.num_evaluations);
+    ASSERT_EQ(serial.num_iterations, parallel.num_iterations);
+    for (size_t i = 0; i < serial.num_iterations; i++) {
+        ASSERT_NEAR(serial.convergence[i], parallel.convergence[i], 1e-12);
+    }
+    ASSERT_NEAR(serial.best.cost, parallel.best.cost, 1e-12);
+
+    opt_result_destroy(&serial);
+    opt_result_destroy(&parallel);
+    continuous_instance_destroy(inst);
+}
+
+// ============================================================================
+// TESTES: MODELO DE ILHAS
+// ============================================================================
+
+TEST(ga_islands_ring) {
+    ContinuousInstance *inst = continuous_create_rastrigin(5);
+    ASSERT_NOT_NULL(inst);
+
+    GAConfig cfg = ga_default_config();
+    cfg.population_size = 20;
+    cfg.max_generations = 60;
+    cfg.num_islands = 4;
+    cfg.migration_interval = 10;
+    cfg.migration_count = 2;
+    cfg.seed = 11;
+
+    OptResult res = ga_run(&cfg, sizeof(double) * 5, 5,
+                           continuous_evaluate, continuous_generate_random,
+                           ga_crossover_blx, ga_mutation_gaussian, NULL, inst);
+
+    ASSERT_EQ(res.num_islands, 4);
+    ASSERT_NOT_NULL(res.island_convergence);
+    ASSERT_EQ(res.num_iterations, 60);
+    ASSERT_EQ(res.num_evaluations, 4 * (20 + 60 * (20 - cfg.elitism_count)));
+    ASSERT_NEAR(res.best.cost, continuous_evaluate(res.best.data, 5, inst), 1e-12);
+
+    // Global = melhor das ilhas; cada ilha monotonica
+    for (size_t g = 0; g < 60; g++) {
+        double best = res.island_convergence[g];
+        for (size_t i = 0; i < 4; i++) {
+            double c = res.island_convergence[i * 60 + g];
+            if (c < best) best = c;
+            if (g > 0) ASSERT_TRUE(c <= res.island_convergence[i * 60 + g - 1]);
+        }
+        ASSERT_NEAR(res.convergence[g], best, 1e-12);
+    }
+    ASSERT_NEAR(res.convergence[59], res.best.cost, 1e-12);
+
+    opt_result_destroy(&res);
+    ASSERT_NULL(res.island_convergence);
+    continuous_instance_destroy(inst);
+}
+
+TEST(ga_islands_threads_deterministic) {
+    TSPInstance *inst = tsp_create_random(20, 3);
+    ASSERT_NOT_NULL(inst);
+
+    GAConfig cfg = ga_default_config();
+    cfg.population_size = 16;
+    cfg.max_generations = 30;
+    cfg.num_islands = 3;
+    cfg.migration_interval = 5;
+    cfg.migration_topology = GA_MIGRATION_FULL;
+    cfg.seed = 5;
+
+    OptResult serial = ga_run(&cfg, sizeof(int) * 20, 20,
+                              tsp_tour_cost, tsp_generate_random,
+                              ga_crossover_ox, ga_mutation_swap, NULL, inst);
+    cfg.num_threads = 0;
+    OptResult parallel = ga_run(&cfg, sizeof(int) * 20, 20,
+                                tsp_tour_cost, tsp_generate_random,
+                                ga_crossover_ox, ga_mutation_swap, NULL, inst);
+
+    ASSERT_TRUE(tsp_is_valid_tour((int*)parallel.best.data, 20));
+    ASSERT_NEAR(serial.best.cost, parallel.best.cost, 1e-12);
+    for (size_t i = 0; i < 3 * 30; i++) {
+        ASSERT_NEAR(serial.island_convergence[i], parallel.island_convergence[i], 1e-12);
+    }
+
+    opt_result_destroy(&serial);
+    opt_result_destroy(&parallel);
+    tsp_instance_destroy(inst);
+}
+
+// ============================================================================
+// TESTES: CRITERIOS DE PARADA
+// ============================================================================
+
+TEST(ga_stop_criteria) {
+    ContinuousInstance *inst = continuous_create_sphere(4);
+    ASSERT_NOT_NULL(inst);
+
+    GAConfig cfg = ga_default_config();
+    cfg.population_size = 20;
+    cfg.max_generations = 1000;
+    cfg.stop.max_evaluations = 20 + 10 * (20 - cfg.elitism_count);
+
+    OptResult r = ga_run(&cfg, sizeof(double) * 4, 4,
+                         continuous_evaluate, continuous_generate_random,
+                         ga_crossover_blx, ga_mutation_gaussian, NULL, inst);
+    ASSERT_EQ(r.num_iterations, (size_t)10);
+    ASSERT_EQ(r.num_evaluations, cfg.stop.max_evaluations);
+    opt_result_destroy(&r);
+
+    // Ilhas: checagem por epoca, convergencia so das geracoes executadas
+    cfg.num_islands = 2;
+    cfg.migration_interval = 5;
+    cfg.stop = opt_stop_none();
+    cfg.stop.use_target = true;
+    cfg.stop.target_cost = 1.0;
+    r = ga_run(&cfg, sizeof(double) * 4, 4,
+               continuous_evaluate, continuous_generate_random,
+               ga_crossover_blx, ga_mutation_gaussian, NULL, inst);
+    ASSERT_TRUE(r.best.cost <= 1.0);
+    ASSERT_TRUE(r.num_iterations < 1000);
+    ASSERT_EQ(r.num_iterations % 5, (size_t)0);
+    ASSERT_NEAR(r.convergence[r.num_iterations - 1], r.best.cost, 1e-12);
+    opt_result_destroy(&r);
+
+    continuous_instance_destroy(inst);
+}
+
+// ============================================================================
+// TESTES: CHECKPOINT
+// ============================================================================
+
+#define GA_CKPT_PATH "test_ga.ckpt"
+
+static OptResult run_rastrigin(const GAConfig *cfg, const ContinuousInstance *inst) {
+    return ga_run(cfg, sizeof(double) * 5, 5,
+                  continuous_evaluate, continuous_generate_random,
+                  ga_crossover_blx, ga_mutation_gaussian, NULL, inst);
+}
+
+// Interrompe em 20 geracoes e retoma ate 40: igual a uma execucao de 40
+static void check_resume_matches(GAConfig *cfg, const ContinuousInstance *inst) {
+    remove(GA_CKPT_PATH);
+    cfg->max_generations = 40;
+    cfg->checkpoint = opt_checkpoint_none();
+    OptResult full = run_rastrigin(cfg, inst);
+
+    cfg->max_generations = 20;
+    cfg->checkpoint.path = GA_CKPT_PATH;
+    cfg->checkpoint.interval = 10;
+    cfg->checkpoint.resume = true;
+    OptResult first = run_rastrigin(cfg, inst);
+    ASSERT_EQ(first.num_iterations, (size_t)20);
+
+    cfg->max_generations = 40;
+    OptResult resumed = run_rastrigin(cfg, inst);
+
+    ASSERT_EQ(resumed.num_iterations, full.num_iterations);
+    ASSERT_EQ(resumed.num_evaluations, full.num_evaluations);
+    ASSERT_TRUE(resumed.best.cost == full.best.cost);
+    ASSERT_TRUE(memcmp(resumed.best.data, full.best.data, sizeof(double) * 5) == 0);
+    for (size_t g = 0; g < 40; g++) {
+        ASSERT_TRUE(resumed.convergence[g] == full.convergence[g]);
+    }
+    ASSERT_EQ(resumed.num_islands, full.num_islands);
+    for (size_t k = 0; k < full.num_islands * 40; k++) {
+        ASSERT_TRUE(resumed.island_convergence[k] == full.island_convergence[k]);
+    }
+
+    // Checkpoint ja no fim: retomar com o mesmo limite nao avalia mais nada
+    OptResult again = run_rastrigin(cfg, inst);
+    ASSERT_EQ(again.num_iterations, (size_t)40);
+    ASSERT_EQ(again.num_evaluations, full.num_evaluations);
+    ASSERT_TRUE(again.best.cost == full.best.cost);
+
+    opt_result_destroy(&full);
+    opt_result_destroy(&first);
+    opt_result_destroy(&resumed);
+    opt_result_destroy(&again);
+    remove(GA_CKPT_PATH);
+}
+
+TEST(ga_checkpoint_resume) {
+    ContinuousInstance *inst = continuous_create_rastrigin(5);
+    ASSERT_NOT_NULL(inst);
+
+    GAConfig cfg = ga_default_config();
+    cfg.population_size = 20;
+    cfg.enable_adaptive_rates = true;
+    cfg.seed = 21;
+    check_resume_matches(&cfg, inst);
+
+    continuous_instance_destroy(inst);
+}
+
+TEST(ga_checkpoint_resume_islands) {
+    ContinuousInstance *inst = continuous_create_rastrigin(5);
+    ASSERT_NOT_NULL(inst);
+
+    // A migracao pulada no fim da primeira sessao acontece na retomada
+    GAConfig cfg = ga_default_config();
+    cfg.population_size = 16;
+    cfg.num_islands = 3;
+    cfg.migration_interval = 10;
+    cfg.seed = 8;
+    check_resume_matches(&cfg, inst);
+
+    continuous_instance_destroy(inst);
+}
+
+TEST(ga_checkpoint_incompatible) {
+    ContinuousInstance *inst = continuous_create_rastrigin(5);
+    ASSERT_NOT_NULL(inst);
+
+    GAConfig cfg = ga_default_config();
+    cfg.population_size = 20;
+    cfg.max_generations = 15;
+    cfg.checkpoint.path = GA_CKPT_PATH;
+    cfg.checkpoint.resume = true;
+    remove(GA_CKPT_PATH);
+    OptResult first = run_rastrigin(&cfg, inst);
+    opt_result_destroy(&first);
+
+    // Outra populacao: o checkpoint e ignorado e a execucao comeca do zero
+    cfg.population_size = 24;
+    OptResult resumed = run_rastrigin(&cfg, inst);
+    cfg.checkpoint = opt_checkpoint_none();
+    OptResult fresh = run_rastrigin(&cfg, inst);
+    ASSERT_EQ(resumed.num_evaluations, fresh.num_evaluations);
+    ASSERT_TRUE(resumed.best.cost == fresh.best.cost);
+
+    opt_result_destroy(&resumed);
+    opt_result_destroy(&fresh);
+    remove(GA_CKPT_PATH);
+    continuous_instance_destroy(inst);
+}
+
 // ============================================================================
 // TESTES: EDGE CASES
 // ============================================================================
@@ -411,10 +668,25 @@ int main(void) {
     RUN_TEST(ga_convergence_monotonic);
     RUN_TEST(ga_elitism_preserves_best);
 
+    printf("\n[Avaliacao Paralela]\n");
+    RUN_TEST(ga_parallel_matches_serial);
+
+    printf("\n[Modelo de Ilhas]\n");
+    RUN_TEST(ga_islands_ring);
+    RUN_TEST(ga_islands_threads_deterministic);
+
+    printf("\n[Criterios de Parada]\n");
+    RUN_TEST(ga_stop_criteria);
+
+    printf("\n[Checkpoint]\n");
+    RUN_TEST(ga_checkpoint_resume);
+    RUN_TEST(ga_checkpoint_resume_islands);
+    RUN_TEST(ga_checkpoint_incompatible);
+
     printf("\n[Edge Cases]\n");
     RUN_TEST(ga_zero_generations);
     RUN_TEST(ga_small_population);
 
-    printf("\n=== Todos os %d testes passaram! ===\n", 13);
+    printf("\n=== Todos os %d testes passaram! ===\n", 20);
     return 0;
 }
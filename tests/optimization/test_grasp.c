@@ -10,6 +10,7 @@
 #include "optimization/metaheuristics/grasp.h"
 #include "optimization/benchmarks/tsp.h"
 #include "optimization/benchmarks/continuous.h"
+#include "data_structures/thread_pool.h"
 #include <math.h>
 #include <float.h>
 
@@ -26,6 +27,9 @@ TEST(grasp_default_config_values) {
     ASSERT_FALSE(cfg.enable_reactive);
     ASSERT_EQ(cfg.reactive_num_alphas, 5);
     ASSERT_EQ(cfg.reactive_block_size, 50);
+    ASSERT_EQ(cfg.elite_size, 0);
+    ASSERT_TRUE(cfg.relink == NULL);
+    ASSERT_EQ(cfg.num_threads, 1);
     ASSERT_EQ(cfg.direction, OPT_MINIMIZE);
     ASSERT_EQ(cfg.seed, 42);
 }
@@ -280,6 +284,142 @@ TEST(grasp_valid_tour) {
     tsp_instance_destroy(inst);
 }
 
+TEST(grasp_tsp_local_search_fn) {
+    TSPInstance *inst = tsp_create_random(100, 9);
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 8));
+
+    GRASPConfig cfg = grasp_default_config();
+    cfg.max_iterations = 20;
+    cfg.local_search = tsp_local_search;
+    cfg.seed = 42;
+
+    OptResult result = grasp_run(&cfg,
+                                 sizeof(int) * inst->n_cities,
+                                 inst->n_cities,
+                                 tsp_tour_cost,
+                                 grasp_construct_tsp_nn,
+                                 NULL,
+                                 inst);
+
+    int *tour = (int*)result.best.data;
+    ASSERT_TRUE(tsp_is_valid_tour(tour, inst->n_cities));
+    ASSERT_NEAR(result.best.cost, tsp_tour_cost(tour, inst->n_cities, inst), 1e-6);
+    ASSERT_EQ(result.num_evaluations, 2 * cfg.max_iterations);
+
+    opt_result_destroy(&result);
+    tsp_instance_destroy(inst);
+}
+
+// ============================================================================
+// PATH-RELINKING E PARALELO
+// ============================================================================
+
+TEST(grasp_relink_permutation_path) {
+    TSPInstance *inst = tsp_create_example_5();
+    int initial[5] = {0, 1, 2, 3, 4};
+    int guide[5] = {4, 3, 2, 1, 0};
+    int best[5];
+    size_t evals = 0;
+
+    // A troca da posicao 0 fixa as posicoes 0 e 4; a seguinte ja chega ao guia
+    double cost = grasp_relink_permutation(initial, guide, best, 5, tsp_tour_cost,
+                                           OPT_MINIMIZE, inst, &evals);
+    int expected[5] = {4, 1, 2, 3, 0};
+    ASSERT_EQ(evals, (size_t)1);
+    for (int i = 0; i < 5; i++) ASSERT_EQ(best[i], expected[i]);
+    ASSERT_NEAR(cost, tsp_tour_cost(expected, 5, inst), 1e-12);
+
+    // Sem intermediaria: pior valor e nenhuma avaliacao
+    evals = 0;
+    cost = grasp_relink_permutation(initial, initial, best, 5, tsp_tour_cost,
+                                    OPT_MINIMIZE, inst, &evals);
+    ASSERT_EQ(evals, (size_t)0);
+    ASSERT_TRUE(cost == DBL_MAX);
+
+    tsp_instance_destroy(inst);
+}
+
+TEST(grasp_relink_continuous_path) {
+    ContinuousInstance *inst = continuous_create_sphere(4);
+    double initial[4] = {1.0, 2.0, 3.0, 4.0};
+    double guide[4] = {0.0, 2.0, 0.0, 0.0};
+    double best[4];
+    size_t evals = 0;
+
+    // Tres coordenadas diferem: duas intermediarias
+    double cost = grasp_relink_continuous(initial, guide, best, 4, continuous_evaluate,
+                                          OPT_MINIMIZE, inst, &evals);
+    ASSERT_EQ(evals, (size_t)2);
+    ASSERT_NEAR(cost, 4.0 + 16.0, 1e-12);
+    ASSERT_NEAR(best[0], 0.0, 1e-12);
+    ASSERT_NEAR(best[2], 0.0, 1e-12);
+    ASSERT_NEAR(best[3], 4.0, 1e-12);
+
+    continuous_instance_destroy(inst);
+}
+
+TEST(grasp_elite_path_relinking_tsp) {
+    TSPInstance *inst = tsp_create_random(60, 11);
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 8));
+
+    GRASPConfig cfg = grasp_default_config();
+    cfg.max_iterations = 30;
+    cfg.local_search = tsp_local_search;
+    cfg.elite_size = 6;
+    cfg.relink = grasp_relink_permutation;
+
+    OptResult result = grasp_run(&cfg, sizeof(int) * inst->n_cities, inst->n_cities,
+                                 tsp_tour_cost, grasp_construct_tsp_nn, NULL, inst);
+
+    int *tour = (int*)result.best.data;
+    ASSERT_TRUE(tsp_is_valid_tour(tour, inst->n_cities));
+    ASSERT_NEAR(result.best.cost, tsp_tour_cost(tour, inst->n_cities, inst), 1e-6);
+    ASSERT_EQ(result.num_iterations, cfg.max_iterations);
+    // Relinking (por iteracao e entre pares) avalia alem de construcao + LS
+    ASSERT_GT(result.num_evaluations, 2 * cfg.max_iterations);
+    ASSERT_NEAR(result.convergence[cfg.max_iterations - 1], result.best.cost, 1e-12);
+
+    opt_result_destroy(&result);
+    tsp_instance_destroy(inst);
+}
+
+TEST(grasp_parallel_thread_count_invariant) {
+    TSPInstance *inst = tsp_create_random(60, 12);
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 8));
+
+    GRASPConfig cfg = grasp_default_config();
+    cfg.max_iterations = 25;
+    cfg.local_search = tsp_local_search;
+    cfg.num_threads = 0;
+
+    // Sem pool de elite cada iteracao so depende da propria semente
+    ds_set_num_threads(2);
+    OptResult a = grasp_run(&cfg, sizeof(int) * inst->n_cities, inst->n_cities,
+                            tsp_tour_cost, grasp_construct_tsp_nn, NULL, inst);
+    ds_set_num_threads(4);
+    OptResult b = grasp_run(&cfg, sizeof(int) * inst->n_cities, inst->n_cities,
+                            tsp_tour_cost, grasp_construct_tsp_nn, NULL, inst);
+    ASSERT_NEAR(a.best.cost, b.best.cost, 1e-12);
+    ASSERT_EQ(a.num_evaluations, b.num_evaluations);
+
+    // Com pool compartilhado o resultado varia, mas continua valido
+    cfg.elite_size = 5;
+    cfg.relink = grasp_relink_permutation;
+    OptResult c = grasp_run(&cfg, sizeof(int) * inst->n_cities, inst->n_cities,
+                            tsp_tour_cost, grasp_construct_tsp_nn, NULL, inst);
+    ds_set_num_threads(0);
+
+    int *tour = (int*)c.best.data;
+    ASSERT_TRUE(tsp_is_valid_tour(tour, inst->n_cities));
+    ASSERT_NEAR(c.best.cost, tsp_tour_cost(tour, inst->n_cities, inst), 1e-6);
+    ASSERT_EQ(c.num_iterations, cfg.max_iterations);
+
+    opt_result_destroy(&a);
+    opt_result_destroy(&b);
+    opt_result_destroy(&c);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -306,7 +446,14 @@ int main(void) {
     RUN_TEST(grasp_zero_iterations);
     RUN_TEST(grasp_convergence_monotonic);
     RUN_TEST(grasp_valid_tour);
+    RUN_TEST(grasp_tsp_local_search_fn);
+
+    printf("\n[Path-Relinking e Paralelo]\n");
+    RUN_TEST(grasp_relink_permutation_path);
+    RUN_TEST(grasp_relink_continuous_path);
+    RUN_TEST(grasp_elite_path_relinking_tsp);
+    RUN_TEST(grasp_parallel_thread_count_invariant);
 
-    printf("\n=== Todos os 10 testes passaram! ===\n");
+    printf("\n=== Todos os 15 testes passaram! ===\n");
     return 0;
 }
@@ -29,6 +29,8 @@ TEST(hc_default_config_values) {
     ASSERT_NEAR(cfg.stochastic_temperature, 1.0, 1e-9);
     ASSERT_EQ((int)cfg.direction, (int)OPT_MINIMIZE);
     ASSERT_EQ(cfg.seed, 42u);
+    ASSERT_NULL(cfg.neighborhood_scan);
+    ASSERT_EQ(cfg.early_exit_min_size, (size_t)1000);
 }
 
 // ============================================================================
@@ -88,6 +90,121 @@ TEST(hc_steepest_tsp_improves) {
     tsp_instance_destroy(inst);
 }
 
+TEST(hc_steepest_tsp_move_delta) {
+    TSPInstance *inst = tsp_create_random(60, 8);
+    ASSERT_NOT_NULL(inst);
+
+    HCConfig cfg = hc_default_config();
+    cfg.max_iterations = 2000;
+    cfg.neighbors_per_iter = 50;
+    cfg.move_delta = tsp_move_2opt;
+    cfg.move_apply = tsp_move_apply;
+
+    OptResult result = hc_steepest(&cfg, sizeof(int) * 60, 60,
+                                   tsp_tour_cost, NULL, tsp_generate_random, inst);
+
+    ASSERT_TRUE(tsp_is_valid_tour((const int*)result.best.data, 60));
+    ASSERT_NEAR(result.best.cost, tsp_tour_cost(result.best.data, 60, inst), 1e-9);
+    ASSERT_TRUE(result.convergence[result.num_iterations - 1] < result.convergence[0]);
+
+    opt_result_destroy(&result);
+    tsp_instance_destroy(inst);
+}
+
+// ============================================================================
+// TESTES: VARREDURA DE VIZINHANCA
+// ============================================================================
+
+// Nenhum 2-opt melhora o tour
+static bool is_2opt_optimal(const TSPInstance *inst, const int *tour, size_t n) {
+    for (size_t i = 0; i + 1 < n; i++) {
+        for (size_t j = i + 1; j < n; j++) {
+            if (tsp_delta_2opt(inst, tour, n, i, j) < -1e-9) return false;
+        }
+    }
+    return true;
+}
+
+TEST(hc_scan_2opt_local_optimum) {
+    TSPInstance *inst = tsp_create_random(60, 5);
+    ASSERT_NOT_NULL(inst);
+
+    HCVariant variants[] = {HC_STEEPEST, HC_FIRST_IMPROVEMENT};
+    for (size_t v = 0; v < 2; v++) {
+        HCConfig cfg = hc_default_config();
+        cfg.variant = variants[v];
+        cfg.max_iterations = 100000;
+        cfg.neighborhood_scan = tsp_scan_2opt;
+        cfg.move_apply = tsp_move_apply;
+
+        OptResult result = hc_run(&cfg, sizeof(int) * 60, 60, tsp_tour_cost, NULL,
+                                  tsp_generate_random, inst);
+        const int *tour = (const int*)result.best.data;
+        ASSERT_TRUE(tsp_is_valid_tour(tour, 60));
+        ASSERT_NEAR(result.best.cost, tsp_tour_cost(tour, 60, inst), 1e-9);
+        ASSERT_TRUE(result.num_iterations < cfg.max_iterations);
+        ASSERT_TRUE(is_2opt_optimal(inst, tour, 60));
+        // A ultima varredura (sem melhora) avalia a vizinhanca inteira
+        ASSERT_TRUE(result.num_evaluations >= 60 * 59 / 2 - 1);
+        opt_result_destroy(&result);
+    }
+    tsp_instance_destroy(inst);
+}
+
+TEST(hc_scan_2opt_first_vs_best) {
+    TSPInstance *inst = tsp_create_random(30, 2);
+    int tour[30];
+    for (int i = 0; i < 30; i++) tour[i] = i;
+
+    OptScan best = {OPT_MINIMIZE, false, 0, {0, 0, 0, 0}, 0.0, 0};
+    OptScan first = best;
+    first.first_improvement = true;
+    ASSERT_TRUE(tsp_scan_2opt(tour, 30, &best, inst));
+    ASSERT_TRUE(tsp_scan_2opt(tour, 30, &first, inst));
+
+    ASSERT_EQ(best.evaluations, (size_t)(30 * 29 / 2 - 1));
+    ASSERT_TRUE(first.evaluations <= best.evaluations);
+    ASSERT_TRUE(best.delta <= first.delta);
+    ASSERT_NEAR(best.delta, tsp_delta_2opt(inst, tour, 30, best.move.i, best.move.j), 1e-12);
+
+    // Maximizar: o melhor delta passa a ser o maior
+    OptScan up = best;
+    up.direction = OPT_MAXIMIZE;
+    ASSERT_TRUE(tsp_scan_2opt(tour, 30, &up, inst));
+    ASSERT_TRUE(up.delta > 0.0);
+    tsp_instance_destroy(inst);
+}
+
+TEST(hc_sampled_early_exit_large_n) {
+    size_t n = 1500;
+    TSPInstance *inst = tsp_create_random_with_storage(n, 4, TSP_DIST_COORDS);
+    ASSERT_NOT_NULL(inst);
+
+    HCConfig cfg = hc_default_config();
+    cfg.max_iterations = 200;
+    cfg.neighbors_per_iter = 50;
+    cfg.move_delta = tsp_move_2opt;
+    cfg.move_apply = tsp_move_apply;
+    ASSERT_TRUE(n >= cfg.early_exit_min_size);
+
+    OptResult fast = hc_steepest(&cfg, sizeof(int) * n, n, tsp_tour_cost, NULL,
+                                 tsp_generate_random, inst);
+    cfg.early_exit_min_size = 0;
+    OptResult full = hc_steepest(&cfg, sizeof(int) * n, n, tsp_tour_cost, NULL,
+                                 tsp_generate_random, inst);
+
+    // De um tour aleatorio quase todo 2-opt melhora: a saida antecipada
+    // avalia poucos vizinhos por iteracao
+    ASSERT_EQ(fast.num_iterations, (size_t)200);
+    ASSERT_EQ(full.num_iterations, (size_t)200);
+    ASSERT_TRUE(fast.num_evaluations * 5 < full.num_evaluations);
+    ASSERT_TRUE(fast.convergence[199] < fast.convergence[0]);
+
+    opt_result_destroy(&fast);
+    opt_result_destroy(&full);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // TESTES: STEEPEST - CONTINUOUS
 // ============================================================================
@@ -420,6 +537,12 @@ int main(void) {
     printf("\n[Steepest - TSP]\n");
     RUN_TEST(hc_steepest_tsp_5);
     RUN_TEST(hc_steepest_tsp_improves);
+    RUN_TEST(hc_steepest_tsp_move_delta);
+
+    printf("\n[Varredura de Vizinhanca]\n");
+    RUN_TEST(hc_scan_2opt_local_optimum);
+    RUN_TEST(hc_scan_2opt_first_vs_best);
+    RUN_TEST(hc_sampled_early_exit_large_n);
 
     printf("\n[Steepest - Continuous]\n");
     RUN_TEST(hc_steepest_sphere);
@@ -445,6 +568,6 @@ int main(void) {
     RUN_TEST(hc_convergence_monotonic);
     RUN_TEST(hc_rastrigin_finds_local_optimum);
 
-    printf("\n=== Todos os %d testes passaram! ===\n", 16);
+    printf("\n=== Todos os %d testes passaram! ===\n", 20);
     return 0;
 }
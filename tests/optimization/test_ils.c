@@ -27,6 +27,9 @@ TEST(ils_default_config_values) {
     ASSERT_NEAR(cfg.sa_initial_temp, 10.0, 1e-9);
     ASSERT_NEAR(cfg.sa_alpha, 0.95, 1e-9);
     ASSERT_EQ(cfg.restart_threshold, 50);
+    ASSERT_EQ(cfg.history_length, 50);
+    ASSERT_FALSE(cfg.adaptive_perturbation);
+    ASSERT_EQ(cfg.visited_capacity, 0);
     ASSERT_EQ(cfg.direction, OPT_MINIMIZE);
     ASSERT_EQ(cfg.seed, 42);
 }
@@ -338,8 +341,156 @@ TEST(ils_valid_tour_output) {
     tsp_instance_destroy(inst);
 }
 
+TEST(ils_tsp_local_search_fn) {
+    TSPInstance *inst = tsp_create_random(100, 9);
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 8));
+
+    ILSConfig cfg = ils_default_config();
+    cfg.max_iterations = 50;
+    cfg.local_search = tsp_local_search;
+    cfg.seed = 42;
+
+    OptResult result = ils_run(&cfg,
+                               sizeof(int) * inst->n_cities,
+                               inst->n_cities,
+                               tsp_tour_cost,
+                               tsp_neighbor_2opt,
+                               tsp_perturb_double_bridge,
+                               tsp_generate_random,
+                               inst);
+
+    int *tour = (int*)result.best.data;
+    ASSERT_TRUE(tsp_is_valid_tour(tour, inst->n_cities));
+    ASSERT_NEAR(result.best.cost, tsp_tour_cost(tour, inst->n_cities, inst), 1e-6);
+
+    // Ja e otimo local da mesma busca
+    ASSERT_NEAR(tsp_local_search(tour, inst->n_cities, NULL, inst), result.best.cost, 1e-9);
+    ASSERT_EQ(result.num_evaluations, 2 + 2 * cfg.max_iterations);
+
+    opt_result_destroy(&result);
+    tsp_instance_destroy(inst);
+}
+
+TEST(ils_chained_lk) {
+    TSPInstance *inst = tsp_create_random(150, 12);
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 10));
+
+    ILSConfig cfg = ils_default_config();
+    cfg.max_iterations = 60;
+    cfg.seed = 42;
+
+    double best[2];
+    LocalSearchFn searches[2] = {tsp_local_search, tsp_local_search_lk};
+    for (int s = 0; s < 2; s++) {
+        cfg.local_search = searches[s];
+        OptResult result = ils_run(&cfg,
+                                   sizeof(int) * inst->n_cities,
+                                   inst->n_cities,
+                                   tsp_tour_cost,
+                                   tsp_neighbor_2opt,
+                                   tsp_perturb_double_bridge,
+                                   tsp_generate_random,
+                                   inst);
+        int *tour = (int*)result.best.data;
+        ASSERT_TRUE(tsp_is_valid_tour(tour, inst->n_cities));
+        ASSERT_NEAR(result.best.cost, tsp_tour_cost(tour, inst->n_cities, inst), 1e-6);
+        best[s] = result.best.cost;
+        opt_result_destroy(&result);
+    }
+    ASSERT_TRUE(best[1] <= best[0] + 1e-9);
+
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
-// MAIN
+// TESTES: ACEITACAO POR HISTORICO, LSMC, VISITADOS E FORCA ADAPTATIVA
+// ============================================================================
+
+static OptResult run_ils_tsp(const ILSConfig *cfg, const TSPInstance *inst) {
+    return ils_run(cfg, sizeof(int) * inst->n_cities, inst->n_cities,
+                   tsp_tour_cost, tsp_neighbor_swap, tsp_perturb_double_bridge,
+                   tsp_generate_random, inst);
+}
+
+TEST(ils_late_and_lsmc_acceptance) {
+    TSPInstance *inst = tsp_create_example_10();
+    ILSAcceptance rules[2] = {ILS_ACCEPT_LATE, ILS_ACCEPT_LSMC};
+
+    for (int r = 0; r < 2; r++) {
+        ILSConfig cfg = ils_default_config();
+        cfg.max_iterations = 150;
+        cfg.local_search_iterations = 50;
+        cfg.acceptance = rules[r];
+        cfg.history_length = 10;
+        cfg.lsmc_temperature = 5.0;
+
+        OptResult result = run_ils_tsp(&cfg, inst);
+        ASSERT_TRUE(tsp_is_valid_tour(result.best.data, inst->n_cities));
+        ASSERT_NEAR(result.best.cost,
+                    tsp_tour_cost(result.best.data, inst->n_cities, inst), 1e-9);
+        ASSERT_EQ(result.num_iterations, 150);
+        for (size_t i = 1; i < result.num_iterations; i++) {
+            ASSERT(result.convergence[i] <= result.convergence[i - 1] + 1e-9);
+        }
+        opt_result_destroy(&result);
+    }
+
+    tsp_instance_destroy(inst);
+}
+
+TEST(ils_visited_optima_skip_search) {
+    TSPInstance *inst = tsp_create_example_5();
+
+    // Tour de 5 cidades: poucas permutacoes, perturbacoes caem em otimos ja vistos
+    ILSConfig cfg = ils_default_config();
+    cfg.max_iterations = 200;
+    cfg.local_search_iterations = 20;
+    cfg.local_search_neighbors = 10;
+    cfg.perturbation_strength = 2;
+    cfg.visited_capacity = 64;
+
+    OptResult with_set = ils_run(&cfg, sizeof(int) * inst->n_cities, inst->n_cities,
+                                 tsp_tour_cost, tsp_neighbor_swap, NULL,
+                                 tsp_generate_random, inst);
+    ASSERT_GT(with_set.num_cache_hits, (size_t)0);
+    ASSERT_TRUE(tsp_is_valid_tour(with_set.best.data, inst->n_cities));
+    ASSERT_NEAR(with_set.best.cost,
+                tsp_tour_cost(with_set.best.data, inst->n_cities, inst), 1e-9);
+
+    cfg.visited_capacity = 0;
+    OptResult without = ils_run(&cfg, sizeof(int) * inst->n_cities, inst->n_cities,
+                                tsp_tour_cost, tsp_neighbor_swap, NULL,
+                                tsp_generate_random, inst);
+    ASSERT_EQ(without.num_cache_hits, (size_t)0);
+
+    opt_result_destroy(&with_set);
+    opt_result_destroy(&without);
+    tsp_instance_destroy(inst);
+}
+
+TEST(ils_adaptive_perturbation_tsp) {
+    TSPInstance *inst = tsp_create_random(40, 21);
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 8));
+
+    ILSConfig cfg = ils_default_config();
+    cfg.max_iterations = 100;
+    cfg.local_search = tsp_local_search;
+    cfg.adaptive_perturbation = true;
+    cfg.perturbation_max_strength = 6;
+    cfg.visited_capacity = 256;
+
+    OptResult result = run_ils_tsp(&cfg, inst);
+    ASSERT_TRUE(tsp_is_valid_tour(result.best.data, inst->n_cities));
+    ASSERT_NEAR(result.best.cost,
+                tsp_tour_cost(result.best.data, inst->n_cities, inst), 1e-6);
+    ASSERT_EQ(result.num_iterations, 100);
+    // LS externa conta 1 por chamada: revisitas pulam avaliacao + busca
+    ASSERT_EQ(result.num_evaluations + 2 * result.num_cache_hits, 2 + 2 * cfg.max_iterations);
+
+    opt_result_destroy(&result);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 
 int main(void) {
@@ -369,7 +520,14 @@ int main(void) {
     RUN_TEST(ils_zero_iterations);
     RUN_TEST(ils_convergence_monotonic);
     RUN_TEST(ils_valid_tour_output);
+    RUN_TEST(ils_tsp_local_search_fn);
+    RUN_TEST(ils_chained_lk);
+
+    printf("\n[Aceitacao, Visitados e Forca Adaptativa]\n");
+    RUN_TEST(ils_late_and_lsmc_acceptance);
+    RUN_TEST(ils_visited_optima_skip_search);
+    RUN_TEST(ils_adaptive_perturbation_tsp);
 
-    printf("\n=== Todos os 11 testes passaram! ===\n");
+    printf("\n=== Todos os 16 testes passaram! ===\n");
     return 0;
 }
@@ -7,6 +7,8 @@
 #include "optimization/common.h"
 #include "optimization/benchmarks/tsp.h"
 #include "optimization/metaheuristics/lns.h"
+#include <stdio.h>
+#include <string.h>
 
 // ============================================================================
 // TESTES DE CONFIGURACAO
@@ -137,6 +139,38 @@ TEST(lns_random_repair_tsp5) {
     tsp_instance_destroy(inst);
 }
 
+TEST(lns_regret_repair_tsp) {
+    // Parte de um otimo local: regret-k perde menos que a insercao sequencial
+    TSPInstance *inst = tsp_create_random(300, 21);
+    ASSERT_NOT_NULL(inst);
+    int tour[300], destroyed[300], greedy[300], regret[300];
+    opt_set_seed(4);
+    tsp_generate_random(tour, 300, inst);
+    tsp_local_search(tour, 300, tsp_tour_cost, inst);
+
+    RepairFn regrets[2] = { lns_repair_tsp_regret2, lns_repair_tsp_regret3 };
+    for (int lists = 0; lists < 2; lists++) {
+        if (lists) ASSERT_TRUE(tsp_build_neighbor_lists(inst, 12));
+        for (int rep = 0; rep < 4; rep++) {
+            lns_destroy_tsp_random(tour, destroyed, 300, 0.2, inst);
+            lns_repair_tsp_greedy(destroyed, greedy, 300, inst);
+            double greedy_cost = tsp_tour_cost(greedy, 300, inst);
+            for (int r = 0; r < 2; r++) {
+                regrets[r](destroyed, regret, 300, inst);
+                ASSERT_TRUE(tsp_is_valid_tour(regret, 300));
+                ASSERT_TRUE(tsp_tour_cost(regret, 300, inst) <= greedy_cost + 1e-9);
+            }
+        }
+    }
+
+    // Tudo removido: o tour e construido do zero
+    for (int i = 0; i < 300; i++) destroyed[i] = -1;
+    lns_repair_tsp_regret2(destroyed, regret, 300, inst);
+    ASSERT_TRUE(tsp_is_valid_tour(regret, 300));
+
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // ALNS (ADAPTIVE)
 // ============================================================================
@@ -171,6 +205,125 @@ TEST(alns_tsp10) {
     tsp_instance_destroy(inst);
 }
 
+TEST(alns_operator_stats) {
+    // Dezenas de operadores: a roleta sorteia entre 30 destroy
+    TSPInstance *inst = tsp_create_random(20, 3);
+    ASSERT_NOT_NULL(inst);
+
+    LNSConfig cfg = lns_default_config();
+    cfg.max_iterations = 600;
+    cfg.variant = LNS_ADAPTIVE;
+    cfg.acceptance = LNS_ACCEPT_SA_LIKE;
+    cfg.sa_initial_temp = 20.0;
+    cfg.num_destroy_ops = 30;
+    cfg.num_repair_ops = 2;
+    cfg.weight_update_interval = 25;
+
+    DestroyFn destroys[30];
+    for (size_t i = 0; i < 30; i++) {
+        destroys[i] = (i % 2 == 0) ? lns_destroy_tsp_random : lns_destroy_tsp_worst;
+    }
+    RepairFn repairs[] = { lns_repair_tsp_greedy, lns_repair_tsp_random };
+
+    OptResult res = alns_run(&cfg, sizeof(int), inst->n_cities,
+                             tsp_tour_cost, tsp_generate_random,
+                             destroys, repairs, inst);
+    ASSERT_NOT_NULL(res.operator_stats);
+    ASSERT_EQ(res.num_operators, (size_t)32);
+
+    size_t calls[2] = {0, 0};
+    size_t accepted[2] = {0, 0};
+    for (size_t i = 0; i < res.num_operators; i++) {
+        const OptOperatorStats *st = &res.operator_stats[i];
+        size_t family = (i < 30) ? 0 : 1;
+        calls[family] += st->calls;
+        accepted[family] += st->accepted;
+        ASSERT_TRUE(st->new_best <= st->improvements);
+        ASSERT_TRUE(st->improvements <= st->calls);
+        ASSERT_TRUE(st->total_time_ms >= 0.0);
+        ASSERT_TRUE(st->weight >= 0.01);
+    }
+    ASSERT_EQ(calls[0], (size_t)600);
+    ASSERT_EQ(calls[1], (size_t)600);
+    ASSERT_EQ(accepted[0], accepted[1]);
+
+    // Todos os destroy sao sorteados ao menos uma vez
+    for (size_t i = 0; i < 30; i++) {
+        ASSERT_GT(res.operator_stats[i].calls, (size_t)0);
+    }
+
+    opt_result_destroy(&res);
+    ASSERT_NULL(res.operator_stats);
+    ASSERT_EQ(res.num_operators, (size_t)0);
+    tsp_instance_destroy(inst);
+}
+
+#define ALNS_CKPT_PATH "test_alns.ckpt"
+
+static OptResult run_alns_tsp(const LNSConfig *cfg, const TSPInstance *inst) {
+    DestroyFn destroys[] = { lns_destroy_tsp_random, lns_destroy_tsp_worst };
+    RepairFn repairs[] = { lns_repair_tsp_greedy, lns_repair_tsp_random };
+    return alns_run(cfg, sizeof(int), inst->n_cities, tsp_tour_cost, tsp_generate_random,
+                    destroys, repairs, inst);
+}
+
+TEST(alns_checkpoint_resume) {
+    TSPInstance *inst = tsp_create_random(15, 9);
+    ASSERT_NOT_NULL(inst);
+
+    LNSConfig cfg = lns_default_config();
+    cfg.max_iterations = 300;
+    cfg.variant = LNS_ADAPTIVE;
+    cfg.acceptance = LNS_ACCEPT_SA_LIKE;
+    cfg.sa_initial_temp = 30.0;
+    cfg.num_destroy_ops = 2;
+    cfg.num_repair_ops = 2;
+    cfg.weight_update_interval = 40;
+    cfg.seed = 13;
+    remove(ALNS_CKPT_PATH);
+    OptResult full = run_alns_tsp(&cfg, inst);
+
+    // Interrompe no meio de um periodo de pesos e retoma ate o fim
+    cfg.max_iterations = 170;
+    cfg.checkpoint.path = ALNS_CKPT_PATH;
+    cfg.checkpoint.interval = 50;
+    cfg.checkpoint.resume = true;
+    OptResult first = run_alns_tsp(&cfg, inst);
+    ASSERT_EQ(first.num_iterations, (size_t)170);
+
+    cfg.max_iterations = 300;
+    OptResult resumed = run_alns_tsp(&cfg, inst);
+
+    ASSERT_EQ(resumed.num_iterations, full.num_iterations);
+    ASSERT_EQ(resumed.num_evaluations, full.num_evaluations);
+    ASSERT_TRUE(resumed.best.cost == full.best.cost);
+    ASSERT_TRUE(memcmp(resumed.best.data, full.best.data, sizeof(int) * 15) == 0);
+    for (size_t i = 0; i < 300; i++) {
+        ASSERT_TRUE(resumed.convergence[i] == full.convergence[i]);
+    }
+    for (size_t i = 0; i < full.num_operators; i++) {
+        ASSERT_EQ(resumed.operator_stats[i].calls, full.operator_stats[i].calls);
+        ASSERT_EQ(resumed.operator_stats[i].accepted, full.operator_stats[i].accepted);
+        ASSERT_TRUE(resumed.operator_stats[i].weight == full.operator_stats[i].weight);
+    }
+
+    // Checkpoint de outro numero de operadores e ignorado
+    cfg.num_repair_ops = 1;
+    OptResult other = run_alns_tsp(&cfg, inst);
+    cfg.checkpoint = opt_checkpoint_none();
+    OptResult fresh = run_alns_tsp(&cfg, inst);
+    ASSERT_EQ(other.num_evaluations, fresh.num_evaluations);
+    ASSERT_TRUE(other.best.cost == fresh.best.cost);
+
+    opt_result_destroy(&full);
+    opt_result_destroy(&first);
+    opt_result_destroy(&resumed);
+    opt_result_destroy(&other);
+    opt_result_destroy(&fresh);
+    remove(ALNS_CKPT_PATH);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // EDGE CASES
 // ============================================================================
@@ -254,15 +407,18 @@ int main(void) {
     printf("\n[Worst Destroy / Random Repair]\n");
     RUN_TEST(lns_worst_destroy_tsp10);
     RUN_TEST(lns_random_repair_tsp5);
+    RUN_TEST(lns_regret_repair_tsp);
 
     printf("\n[ALNS (Adaptive)]\n");
     RUN_TEST(alns_tsp10);
+    RUN_TEST(alns_operator_stats);
+    RUN_TEST(alns_checkpoint_resume);
 
     printf("\n[Edge Cases]\n");
     RUN_TEST(lns_zero_iterations);
     RUN_TEST(lns_convergence_monotonic);
     RUN_TEST(lns_valid_tour);
 
-    printf("\n=== Todos os 10 testes passaram! ===\n");
+    printf("\n=== Todos os 13 testes passaram! ===\n");
     return 0;
 }
@@ -9,6 +9,7 @@
 #include "optimization/benchmarks/continuous.h"
 #include "optimization/metaheuristics/memetic.h"
 #include "optimization/metaheuristics/genetic_algorithm.h"
+#include "data_structures/thread_pool.h"
 
 // ============================================================================
 // WRAPPERS (GA operators -> MA operator signatures)
@@ -51,6 +52,9 @@ TEST(ma_default_config_values) {
     ASSERT_EQ(cfg.learning, MA_LAMARCKIAN);
     ASSERT_NEAR(cfg.ls_probability, 1.0, 1e-9);
     ASSERT_TRUE(cfg.ls_on_initial);
+    ASSERT_EQ(cfg.ls_budget, (size_t)0);
+    ASSERT_NEAR(cfg.ls_top_fraction, 1.0, 1e-12);
+    ASSERT_EQ(cfg.num_threads, (size_t)1);
     ASSERT_EQ(cfg.direction, OPT_MINIMIZE);
     ASSERT_EQ(cfg.seed, (unsigned)42);
 }
@@ -133,6 +137,36 @@ TEST(ma_baldwin_tsp5) {
     tsp_instance_destroy(inst);
 }
 
+TEST(ma_tsp_local_search_fn) {
+    TSPInstance *inst = tsp_create_random(60, 4);
+    ASSERT_TRUE(tsp_build_neighbor_lists(inst, 8));
+
+    MALearningType modes[2] = {MA_LAMARCKIAN, MA_BALDWINIAN};
+    for (int m = 0; m < 2; m++) {
+        MAConfig cfg = ma_default_config();
+        cfg.population_size = 10;
+        cfg.max_generations = 10;
+        cfg.learning = modes[m];
+        cfg.local_search = tsp_local_search;
+        cfg.seed = 42;
+
+        OptResult res = ma_run(&cfg, sizeof(int), inst->n_cities,
+                               tsp_tour_cost, tsp_generate_random,
+                               ma_crossover_ox, ma_mutation_swap,
+                               NULL, inst);
+        int *tour = (int*)res.best.data;
+        ASSERT_TRUE(tsp_is_valid_tour(tour, inst->n_cities));
+        if (modes[m] == MA_LAMARCKIAN) {
+            ASSERT_NEAR(res.best.cost, tsp_tour_cost(tour, inst->n_cities, inst), 1e-6);
+        } else {
+            // Baldwiniana: custo do otimo local, genotipo original
+            ASSERT_TRUE(res.best.cost <= tsp_tour_cost(tour, inst->n_cities, inst) + 1e-9);
+        }
+        opt_result_destroy(&res);
+    }
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // CONTINUOUS
 // ============================================================================
@@ -278,6 +312,101 @@ TEST(ma_convergence_monotonic) {
     tsp_instance_destroy(inst);
 }
 
+// ============================================================================
+// TESTES DE PARALELISMO, BUDGET E TOP-P
+// ============================================================================
+
+static OptResult run_tsp10(const MAConfig *cfg, const TSPInstance *inst) {
+    return ma_run(cfg, sizeof(int), inst->n_cities,
+                  tsp_tour_cost, tsp_generate_random,
+                  ma_crossover_ox, ma_mutation_swap,
+                  tsp_neighbor_swap, inst);
+}
+
+TEST(ma_parallel_thread_count_invariant) {
+    TSPInstance *inst = tsp_create_example_10();
+    ASSERT_NOT_NULL(inst);
+
+    MAConfig cfg = ma_default_config();
+    cfg.population_size = 20;
+    cfg.max_generations = 15;
+    cfg.ls_iterations = 20;
+    cfg.ls_neighbors = 10;
+    cfg.num_threads = 0;
+
+    ds_set_num_threads(2);
+    OptResult a = run_tsp10(&cfg, inst);
+    ds_set_num_threads(4);
+    OptResult b = run_tsp10(&cfg, inst);
+    ds_set_num_threads(0);
+
+    ASSERT_NOT_NULL(a.best.data);
+    ASSERT_NOT_NULL(b.best.data);
+    ASSERT_NEAR(a.best.cost, b.best.cost, 1e-12);
+    ASSERT_EQ(a.num_evaluations, b.num_evaluations);
+    ASSERT_NEAR(a.best.cost, tsp_tour_cost(a.best.data, inst->n_cities, inst), 1e-9);
+
+    opt_result_destroy(&a);
+    opt_result_destroy(&b);
+    tsp_instance_destroy(inst);
+}
+
+TEST(ma_ls_budget_caps_evaluations) {
+    TSPInstance *inst = tsp_create_example_10();
+    ASSERT_NOT_NULL(inst);
+
+    MAConfig cfg = ma_default_config();
+    cfg.population_size = 20;
+    cfg.max_generations = 10;
+    cfg.ls_iterations = 50;
+    cfg.ls_neighbors = 10;
+    cfg.ls_budget = 7;
+
+    // 20 iniciais + 18 filhos por geracao, cada um com ate 7 avaliacoes de LS
+    size_t evaluated = 20 + 10 * 18;
+    OptResult res = run_tsp10(&cfg, inst);
+    ASSERT_NOT_NULL(res.best.data);
+    ASSERT_TRUE(res.num_evaluations > evaluated);
+    ASSERT_TRUE(res.num_evaluations <= evaluated * (1 + 7));
+
+    opt_result_destroy(&res);
+    tsp_instance_destroy(inst);
+}
+
+TEST(ma_top_fraction_limits_refinement) {
+    TSPInstance *inst = tsp_create_example_10();
+    ASSERT_NOT_NULL(inst);
+
+    MAConfig cfg = ma_default_config();
+    cfg.population_size = 20;
+    cfg.max_generations = 10;
+    cfg.ls_iterations = 20;
+    cfg.ls_neighbors = 10;
+
+    // p = 0: so as avaliacoes da geracao, sem nenhuma busca local
+    cfg.ls_top_fraction = 0.0;
+    OptResult none = run_tsp10(&cfg, inst);
+    ASSERT_EQ(none.num_evaluations, (size_t)(20 + 10 * 18));
+
+    cfg.ls_top_fraction = 0.25;
+    OptResult top = run_tsp10(&cfg, inst);
+    cfg.ls_top_fraction = 1.0;
+    OptResult all = run_tsp10(&cfg, inst);
+    ASSERT_TRUE(top.num_evaluations > none.num_evaluations);
+    ASSERT_TRUE(top.num_evaluations < all.num_evaluations);
+
+    cfg.learning = MA_BALDWINIAN;
+    cfg.ls_top_fraction = 0.25;
+    OptResult baldwin = run_tsp10(&cfg, inst);
+    ASSERT_NOT_NULL(baldwin.best.data);
+
+    opt_result_destroy(&none);
+    opt_result_destroy(&top);
+    opt_result_destroy(&all);
+    opt_result_destroy(&baldwin);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -294,6 +423,7 @@ int main(void) {
 
     printf("\n[Baldwinian]\n");
     RUN_TEST(ma_baldwin_tsp5);
+    RUN_TEST(ma_tsp_local_search_fn);
 
     printf("\n[Continuous]\n");
     RUN_TEST(ma_lamarck_sphere5);
@@ -307,6 +437,11 @@ int main(void) {
     RUN_TEST(ma_partial_ls_probability);
     RUN_TEST(ma_convergence_monotonic);
 
-    printf("\n=== Todos os 10 testes passaram! ===\n");
+    printf("\n[Paralelo, Budget e Top-p]\n");
+    RUN_TEST(ma_parallel_thread_count_invariant);
+    RUN_TEST(ma_ls_budget_caps_evaluations);
+    RUN_TEST(ma_top_fraction_limits_refinement);
+
+    printf("\n=== Todos os 14 testes passaram! ===\n");
     return 0;
 }
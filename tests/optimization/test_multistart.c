@@ -0,0 +1,233 @@
+/**
+ * @file test_multistart.c
+ * @brief Testes do multi-start paralelo
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "../test_macros.h"
+#include "optimization/multistart.h"
+#include "optimization/heuristics/hill_climbing.h"
+#include "optimization/metaheuristics/simulated_annealing.h"
+#include "optimization/metaheuristics/ils.h"
+#include "optimization/metaheuristics/grasp.h"
+#include "optimization/metaheuristics/vns.h"
+#include "optimization/benchmarks/tsp.h"
+#include "optimization/benchmarks/continuous.h"
+#include <math.h>
+#include <stdbool.h>
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static bool is_valid_tour(const int *tour, size_t n) {
+    bool seen[64] = {false};
+    for (size_t i = 0; i < n; i++) {
+        if (tour[i] < 0 || (size_t)tour[i] >= n || seen[tour[i]]) return false;
+        seen[tour[i]] = true;
+    }
+    return true;
+}
+
+static OptRunSpec tsp_spec(const void *config, const TSPInstance *inst, size_t element_size) {
+    OptRunSpec spec = {0};
+    spec.config = config;
+    spec.element_size = element_size;
+    spec.solution_size = inst->n_cities;
+    spec.objective = tsp_tour_cost;
+    spec.neighbor = tsp_neighbor_2opt;
+    spec.generate = tsp_generate_random;
+    spec.context = inst;
+    return spec;
+}
+
+// ============================================================================
+// TESTES: CONFIGURACAO
+// ============================================================================
+
+TEST(multistart_default_config_values) {
+    OptMultiStartConfig cfg = opt_multistart_default_config();
+    ASSERT_EQ(cfg.num_runs, 8);
+    ASSERT_EQ(cfg.num_threads, 0);
+    ASSERT_EQ(cfg.base_seed, 42);
+    ASSERT_EQ(cfg.direction, OPT_MINIMIZE);
+    ASSERT_FALSE(cfg.use_target);
+}
+
+// ============================================================================
+// TESTES: DRIVER
+// ============================================================================
+
+TEST(multistart_sa_statistics) {
+    TSPInstance *inst = tsp_create_random(20, 7);
+    SAConfig sa = sa_default_config();
+    sa.max_iterations = 2000;
+    OptRunSpec spec = tsp_spec(&sa, inst, sizeof(int) * inst->n_cities);
+
+    OptMultiStartConfig cfg = opt_multistart_default_config();
+    cfg.num_runs = 6;
+    cfg.num_threads = 1;
+    OptMultiStartResult r = opt_parallel_multistart(&cfg, opt_run_sa, &spec);
+
+    ASSERT_EQ(r.num_runs, 6);
+    ASSERT_NOT_NULL(r.best.best.data);
+    ASSERT_TRUE(is_valid_tour((const int*)r.best.best.data, inst->n_cities));
+    ASSERT_NEAR(r.best.best.cost, r.run_costs[r.best_run], 1e-9);
+
+    double sum = 0.0;
+    for (size_t i = 0; i < r.num_runs; i++) {
+        ASSERT_TRUE(r.run_costs[i] >= r.best.best.cost - 1e-9);
+        ASSERT_TRUE(r.run_costs[i] <= r.worst_cost + 1e-9);
+        ASSERT_TRUE(r.run_times_ms[i] >= 0.0);
+        sum += r.run_costs[i];
+    }
+    ASSERT_NEAR(r.mean_cost, sum / 6.0, 1e-9);
+    ASSERT_TRUE(r.std_cost >= 0.0);
+    ASSERT_TRUE(r.total_evaluations >= r.best.num_evaluations);
+    ASSERT_NULL(r.run_time_to_target_ms);
+
+    // A execucao best_run, repetida isoladamente, reproduz o mesmo custo
+    OptResult single = opt_run_sa(cfg.base_seed + (unsigned)r.best_run, &spec);
+    ASSERT_NEAR(single.best.cost, r.best.best.cost, 1e-12);
+    opt_result_destroy(&single);
+
+    opt_multistart_result_destroy(&r);
+    tsp_instance_destroy(inst);
+}
+
+TEST(multistart_threads_deterministic) {
+    TSPInstance *inst = tsp_create_random(25, 3);
+    ILSConfig ils = ils_default_config();
+    ils.max_iterations = 60;
+    ils.local_search_iterations = 50;
+    OptRunSpec spec = tsp_spec(&ils, inst, sizeof(int) * inst->n_cities);
+    spec.perturb = tsp_perturb_double_bridge;
+
+    OptMultiStartConfig cfg = opt_multistart_default_config();
+    cfg.num_runs = 5;
+    cfg.num_threads = 1;
+    OptMultiStartResult serial = opt_parallel_multistart(&cfg, opt_run_ils, &spec);
+    cfg.num_threads = 4;
+    OptMultiStartResult parallel = opt_parallel_multistart(&cfg, opt_run_ils, &spec);
+
+    ASSERT_EQ(serial.num_runs, parallel.num_runs);
+    for (size_t i = 0; i < serial.num_runs; i++) {
+        ASSERT_NEAR(serial.run_costs[i], parallel.run_costs[i], 1e-12);
+    }
+    ASSERT_EQ(serial.best_run, parallel.best_run);
+    ASSERT_EQ(serial.total_evaluations, parallel.total_evaluations);
+    ASSERT_NEAR(serial.std_cost, parallel.std_cost, 1e-12);
+
+    opt_multistart_result_destroy(&serial);
+    opt_multistart_result_destroy(&parallel);
+    tsp_instance_destroy(inst);
+}
+
+TEST(multistart_time_to_target) {
+    ContinuousInstance *inst = continuous_create_sphere(5);
+    VNSConfig vns = vns_default_config();
+    vns.max_iterations = 80;
+    vns.k_max = 4;
+
+    OptRunSpec spec = {0};
+    spec.config = &vns;
+    spec.element_size = sizeof(double);
+    spec.solution_size = inst->dimensions;
+    spec.objective = continuous_evaluate;
+    spec.neighbor = continuous_neighbor_gaussian;
+    spec.generate = continuous_generate_random;
+    spec.shake = vns_shake_continuous;
+    spec.context = inst;
+
+    OptMultiStartConfig cfg = opt_multistart_default_config();
+    cfg.num_runs = 4;
+    cfg.use_target = true;
+    cfg.target_cost = 1e9;    // qualquer execucao atinge
+    OptMultiStartResult easy = opt_parallel_multistart(&cfg, opt_run_vns, &spec);
+    ASSERT_EQ(easy.target_hits, 4);
+    ASSERT_NOT_NULL(easy.run_time_to_target_ms);
+    for (size_t i = 0; i < easy.num_runs; i++) {
+        ASSERT_TRUE(easy.run_time_to_target_ms[i] >= 0.0);
+        ASSERT_TRUE(easy.run_time_to_target_ms[i] <= easy.run_times_ms[i] + 1e-9);
+    }
+    ASSERT_TRUE(easy.mean_time_to_target_ms >= 0.0);
+
+    cfg.target_cost = -1.0;   // sphere >= 0: inatingivel
+    OptMultiStartResult hard = opt_parallel_multistart(&cfg, opt_run_vns, &spec);
+    ASSERT_EQ(hard.target_hits, 0);
+    ASSERT_NEAR(hard.run_time_to_target_ms[0], -1.0, 1e-12);
+    ASSERT_NEAR(hard.mean_time_to_target_ms, 0.0, 1e-12);
+
+    opt_multistart_result_destroy(&easy);
+    opt_multistart_result_destroy(&hard);
+    continuous_instance_destroy(inst);
+}
+
+// ============================================================================
+// TESTES: ADAPTADORES
+// ============================================================================
+
+TEST(multistart_hc_restart_and_grasp) {
+    TSPInstance *inst = tsp_create_example_10();
+    OptMultiStartConfig cfg = opt_multistart_default_config();
+    cfg.num_runs = 3;
+
+    HCConfig hc = hc_default_config();
+    hc.max_iterations = 100;
+    hc.num_restarts = 3;
+    OptRunSpec spec = tsp_spec(&hc, inst, sizeof(int) * inst->n_cities);
+    OptMultiStartResult r = opt_parallel_multistart(&cfg, opt_run_hc_restart, &spec);
+    ASSERT_EQ(r.num_runs, 3);
+    ASSERT_TRUE(is_valid_tour((const int*)r.best.best.data, inst->n_cities));
+    opt_multistart_result_destroy(&r);
+
+    GRASPConfig grasp = grasp_default_config();
+    grasp.max_iterations = 20;
+    spec = tsp_spec(&grasp, inst, sizeof(int) * inst->n_cities);
+    spec.construct = grasp_construct_tsp_nn;
+    spec.neighbor = tsp_neighbor_swap;
+    r = opt_parallel_multistart(&cfg, opt_run_grasp, &spec);
+    ASSERT_EQ(r.num_runs, 3);
+    ASSERT_TRUE(is_valid_tour((const int*)r.best.best.data, inst->n_cities));
+    ASSERT_GT(r.total_evaluations, (size_t)0);
+    opt_multistart_result_destroy(&r);
+
+    tsp_instance_destroy(inst);
+}
+
+TEST(multistart_invalid_input) {
+    OptMultiStartConfig cfg = opt_multistart_default_config();
+    OptMultiStartResult r = opt_parallel_multistart(&cfg, NULL, NULL);
+    ASSERT_EQ(r.num_runs, 0);
+    ASSERT_NULL(r.best.best.data);
+
+    cfg.num_runs = 0;
+    r = opt_parallel_multistart(&cfg, opt_run_sa, NULL);
+    ASSERT_EQ(r.num_runs, 0);
+    opt_multistart_result_destroy(&r);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Testes Multi-Start Paralelo ===\n\n");
+
+    printf("[Configuracao]\n");
+    RUN_TEST(multistart_default_config_values);
+
+    printf("\n[Driver]\n");
+    RUN_TEST(multistart_sa_statistics);
+    RUN_TEST(multistart_threads_deterministic);
+    RUN_TEST(multistart_time_to_target);
+
+    printf("\n[Adaptadores]\n");
+    RUN_TEST(multistart_hc_restart_and_grasp);
+    RUN_TEST(multistart_invalid_input);
+
+    printf("\n=== Todos os 6 testes passaram! ===\n");
+    return 0;
+}
@@ -0,0 +1,344 @@
+/**
+ * @file test_portfolio.c
+ * @brief Testes do portfolio com corrida entre meta-heuristicas
+ *
+ * @author Algoritmos e Heuristicas
+ * @date 2025
+ */
+
+#include "../test_macros.h"
+#include "optimization/portfolio.h"
+#include "optimization/metaheuristics/simulated_annealing.h"
+#include "optimization/metaheuristics/ils.h"
+#include "optimization/metaheuristics/tabu_search.h"
+#include "optimization/metaheuristics/lns.h"
+#include "optimization/benchmarks/tsp.h"
+#include <float.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define N_CITIES 30
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+static OptRunSpec tsp_spec(const void *config, const TSPInstance *inst, size_t element_size) {
+    OptRunSpec spec = {0};
+    spec.config = config;
+    spec.element_size = element_size;
+    spec.solution_size = inst->n_cities;
+    spec.objective = tsp_tour_cost;
+    spec.neighbor = tsp_neighbor_2opt;
+    spec.generate = tsp_generate_random;
+    spec.context = inst;
+    return spec;
+}
+
+// Busca aleatoria: o braco fraco, gasta o orcamento da rodada sorteando tours
+static OptResult run_random_search(unsigned seed, const void *user_data) {
+    const OptRunSpec *s = user_data;
+    size_t budget = (s->stop != NULL && s->stop->max_evaluations > 0)
+                    ? s->stop->max_evaluations : 100;
+    OptRng *rng = opt_rng_thread();
+    OptRng saved = *rng;
+    opt_rng_seed(rng, seed);
+
+    OptResult r = opt_result_create(0);
+    r.best = opt_solution_create(s->element_size);
+    r.best.cost = DBL_MAX;
+    int tour[N_CITIES];
+    for (size_t i = 0; i < budget; i++) {
+        s->generate(tour, s->solution_size, s->context);
+        double cost = s->objective(tour, s->solution_size, s->context);
+        if (cost < r.best.cost) {
+            memcpy(r.best.data, tour, sizeof(tour));
+            r.best.cost = cost;
+        }
+    }
+    r.num_evaluations = budget;
+    r.num_iterations = budget;
+    *rng = saved;
+    return r;
+}
+
+// Braco sintetico de custo conhecido: value + ruido pequeno pela seed
+static OptResult run_constant(unsigned seed, const void *user_data) {
+    const OptRunSpec *s = user_data;
+    double value = *(const double*)s->context;
+    OptResult r = opt_result_create(0);
+    r.best = opt_solution_create(sizeof(double));
+    r.best.cost = value + 0.01 * (double)(seed % 3);
+    memcpy(r.best.data, &r.best.cost, sizeof(double));
+    r.num_evaluations = 1;
+    return r;
+}
+
+typedef struct {
+    SAConfig sa;
+    TSConfig ts;
+    ILSConfig ils;
+    LNSConfig alns;
+    DestroyFn destroys[2];
+    RepairFn repairs[2];
+    OptRunSpec specs[5];
+    OptPortfolioArm arms[5];
+} TSPPortfolio;
+
+// SA, TS, ILS, ALNS e busca aleatoria (indice 4); limite so pelo orcamento
+// (sem historico: max_iterations folgado nao aloca convergence)
+static void tsp_portfolio(TSPPortfolio *p, const TSPInstance *inst) {
+    size_t tour_bytes = sizeof(int) * inst->n_cities;
+
+    p->sa = sa_default_config();
+    p->sa.max_iterations = (size_t)1 << 30;
+    p->sa.trace.mode = OPT_TRACE_NONE;
+    p->ts = ts_default_config();
+    p->ts.max_iterations = (size_t)1 << 30;
+    p->ts.trace.mode = OPT_TRACE_NONE;
+    p->ils = ils_default_config();
+    p->ils.max_iterations = (size_t)1 << 30;
+    p->ils.trace.mode = OPT_TRACE_NONE;
+    p->ils.local_search_iterations = 50;
+    p->alns = lns_default_config();
+    p->alns.max_iterations = (size_t)1 << 30;
+    p->alns.trace.mode = OPT_TRACE_NONE;
+    p->alns.variant = LNS_ADAPTIVE;
+    p->alns.num_destroy_ops = 2;
+    p->alns.num_repair_ops = 2;
+    p->destroys[0] = lns_destroy_tsp_random;
+    p->destroys[1] = lns_destroy_tsp_worst;
+    p->repairs[0] = lns_repair_tsp_greedy;
+    p->repairs[1] = lns_repair_tsp_random;
+
+    p->specs[0] = tsp_spec(&p->sa, inst, tour_bytes);
+    p->specs[1] = tsp_spec(&p->ts, inst, tour_bytes);
+    p->specs[1].hash_fn = ts_hash_int_array;
+    p->specs[2] = tsp_spec(&p->ils, inst, tour_bytes);
+    p->specs[2].perturb = tsp_perturb_double_bridge;
+    p->specs[3] = tsp_spec(&p->alns, inst, sizeof(int));
+    p->specs[3].destroy_ops = p->destroys;
+    p->specs[3].repair_ops = p->repairs;
+    p->specs[4] = tsp_spec(NULL, inst, tour_bytes);
+
+    OptRunFn runs[5] = {opt_run_sa, opt_run_ts, opt_run_ils, opt_run_alns, run_random_search};
+    const char *names[5] = {"SA", "TS", "ILS", "ALNS", "Random"};
+    for (size_t i = 0; i < 5; i++) {
+        p->arms[i].name = names[i];
+        p->arms[i].run = runs[i];
+        p->arms[i].spec = &p->specs[i];
+    }
+}
+
+// ============================================================================
+// TESTES: CONFIGURACAO
+// ============================================================================
+
+TEST(portfolio_default_config_values) {
+    OptPortfolioConfig cfg = opt_portfolio_default_config();
+    ASSERT_EQ(cfg.rule, OPT_RACE_SUCCESSIVE_HALVING);
+    ASSERT_EQ(cfg.num_threads, 0);
+    ASSERT_EQ(cfg.min_replicas, 2);
+    ASSERT_EQ(cfg.round_evaluations, 1000);
+    ASSERT_NEAR(cfg.eta, 2.0, 1e-12);
+    ASSERT_NEAR(cfg.frace_alpha, 0.05, 1e-12);
+    ASSERT_EQ(cfg.direction, OPT_MINIMIZE);
+
+    double value = 1.0;
+    OptRunSpec spec = {0};
+    spec.context = &value;
+    OptPortfolioArm arm = {"C", run_constant, &spec};
+    OptPortfolioResult r = opt_portfolio_run(&cfg, NULL, 1);
+    ASSERT_EQ(r.num_arms, 0);
+    r = opt_portfolio_run(&cfg, &arm, 0);
+    ASSERT_EQ(r.num_arms, 0);
+    cfg.eta = 1.0;
+    r = opt_portfolio_run(&cfg, &arm, 1);
+    ASSERT_EQ(r.num_arms, 0);
+    opt_portfolio_result_destroy(&r);
+}
+
+// ============================================================================
+// TESTES: CORRIDA
+// ============================================================================
+
+TEST(portfolio_halving_reallocates_cores) {
+    double values[4] = {3.0, 1.0, 4.0, 2.0};
+    OptRunSpec specs[4];
+    OptPortfolioArm arms[4];
+    for (size_t i = 0; i < 4; i++) {
+        memset(&specs[i], 0, sizeof(OptRunSpec));
+        specs[i].context = &values[i];
+        arms[i].name = "C";
+        arms[i].run = run_constant;
+        arms[i].spec = &specs[i];
+    }
+
+    OptPortfolioConfig cfg = opt_portfolio_default_config();
+    cfg.num_threads = 8;
+    OptPortfolioResult r = opt_portfolio_run(&cfg, arms, 4);
+    ASSERT_EQ(r.num_arms, 4);
+    ASSERT_EQ(r.num_rounds, 3);        // 4 -> 2 -> 1
+    ASSERT_EQ(r.survivors, 1);
+    ASSERT_EQ(r.best_arm, 1);
+    ASSERT_NEAR(r.best.best.cost, 1.0, 1e-12);
+
+    // 8 nucleos: 2 replicas com 4 vivos, 4 com 2, 8 com o vencedor
+    ASSERT_EQ(r.arms[1].runs, 14);
+    ASSERT_EQ(r.arms[3].runs, 6);
+    ASSERT_EQ(r.arms[0].runs, 2);
+    ASSERT_EQ(r.arms[0].eliminated_round, 1);
+    ASSERT_EQ(r.arms[2].eliminated_round, 1);
+    ASSERT_EQ(r.arms[3].eliminated_round, 2);
+    ASSERT_EQ(r.arms[1].eliminated_round, 0);
+    ASSERT_EQ(r.arms[1].rounds, 3);
+    ASSERT_EQ(r.total_evaluations, 24);
+    opt_portfolio_result_destroy(&r);
+
+    // Maximizar inverte o vencedor
+    cfg.direction = OPT_MAXIMIZE;
+    r = opt_portfolio_run(&cfg, arms, 4);
+    ASSERT_EQ(r.best_arm, 2);
+    ASSERT_NEAR(r.best.best.cost, 4.02, 1e-12);
+    ASSERT_NEAR(r.arms[2].best_cost, 4.02, 1e-12);
+    ASSERT_EQ(r.arms[1].eliminated_round, 1);
+    opt_portfolio_result_destroy(&r);
+}
+
+TEST(portfolio_tsp_halving) {
+    TSPInstance *inst = tsp_create_random(N_CITIES, 11);
+    ASSERT_NOT_NULL(inst);
+    TSPPortfolio p;
+    tsp_portfolio(&p, inst);
+
+    OptPortfolioConfig cfg = opt_portfolio_default_config();
+    cfg.num_threads = 1;
+    cfg.round_evaluations = 2000;
+    OptPortfolioResult r = opt_portfolio_run(&cfg, p.arms, 5);
+    ASSERT_EQ(r.num_rounds, 4);        // 5 -> 3 -> 2 -> 1
+    ASSERT_EQ(r.survivors, 1);
+    ASSERT_EQ(r.arms[4].eliminated_round, 1);
+    ASSERT_EQ(r.arms[4].runs, 2);
+    ASSERT_TRUE(r.best_arm != 4);
+    ASSERT_TRUE(tsp_is_valid_tour((const int*)r.best.best.data, N_CITIES));
+    ASSERT_NEAR(r.best.best.cost, tsp_tour_cost(r.best.best.data, N_CITIES, inst), 1e-9);
+
+    size_t runs = 0, evaluations = 0;
+    for (size_t a = 0; a < 5; a++) {
+        ASSERT_TRUE(r.arms[a].best_cost >= r.best.best.cost);
+        ASSERT_TRUE(r.arms[a].mean_cost >= r.arms[a].best_cost - 1e-9);
+        runs += r.arms[a].runs;
+        evaluations += r.arms[a].evaluations;
+    }
+    ASSERT_NEAR(r.arms[r.best_arm].best_cost, r.best.best.cost, 1e-12);
+    ASSERT_EQ(runs, (5 + 3 + 2 + 1) * 2);
+    ASSERT_EQ(evaluations, r.total_evaluations);
+
+    opt_portfolio_result_destroy(&r);
+    tsp_instance_destroy(inst);
+}
+
+TEST(portfolio_threads_deterministic) {
+    TSPInstance *inst = tsp_create_random(N_CITIES, 5);
+    ASSERT_NOT_NULL(inst);
+    TSPPortfolio p;
+    tsp_portfolio(&p, inst);
+
+    // 2 nucleos e 2 replicas minimas: mesmas execucoes que o serial
+    OptPortfolioConfig cfg = opt_portfolio_default_config();
+    cfg.round_evaluations = 1000;
+    cfg.num_threads = 1;
+    OptPortfolioResult serial = opt_portfolio_run(&cfg, p.arms, 4);
+    cfg.num_threads = 2;
+    OptPortfolioResult parallel = opt_portfolio_run(&cfg, p.arms, 4);
+
+    ASSERT_EQ(serial.best_arm, parallel.best_arm);
+    ASSERT_TRUE(serial.best.best.cost == parallel.best.best.cost);
+    ASSERT_EQ(serial.total_evaluations, parallel.total_evaluations);
+    for (size_t a = 0; a < 4; a++) {
+        ASSERT_EQ(serial.arms[a].eliminated_round, parallel.arms[a].eliminated_round);
+        ASSERT_TRUE(serial.arms[a].best_cost == parallel.arms[a].best_cost);
+    }
+
+    opt_portfolio_result_destroy(&serial);
+    opt_portfolio_result_destroy(&parallel);
+    tsp_instance_destroy(inst);
+}
+
+TEST(portfolio_frace_drops_dominated) {
+    TSPInstance *inst = tsp_create_random(N_CITIES, 9);
+    ASSERT_NOT_NULL(inst);
+    TSPPortfolio p;
+    tsp_portfolio(&p, inst);
+    OptPortfolioArm arms[3] = {p.arms[0], p.arms[2], p.arms[4]};   // SA, ILS, Random
+
+    OptPortfolioConfig cfg = opt_portfolio_default_config();
+    cfg.rule = OPT_RACE_FRACE;
+    cfg.num_threads = 0;
+    cfg.min_replicas = 6;
+    cfg.round_evaluations = 1000;
+    OptPortfolioResult r = opt_portfolio_run(&cfg, arms, 3);
+    ASSERT_EQ(r.num_rounds, 3);
+
+    // A busca aleatoria perde em todo bloco: Friedman a derruba na 1a rodada
+    ASSERT_EQ(r.arms[2].eliminated_round, 1);
+    ASSERT_EQ(r.arms[2].rounds, 1);
+    ASSERT_TRUE(r.survivors >= 1 && r.survivors <= 2);
+    ASSERT_TRUE(r.best_arm != 2);
+    ASSERT_TRUE(tsp_is_valid_tour((const int*)r.best.best.data, N_CITIES));
+
+    opt_portfolio_result_destroy(&r);
+
+    // Bracos identicos nunca diferem: ninguem e eliminado
+    OptPortfolioArm same[3] = {p.arms[0], p.arms[0], p.arms[0]};
+    r = opt_portfolio_run(&cfg, same, 3);
+    ASSERT_EQ(r.survivors, 3);
+    ASSERT_EQ(r.best_arm, 0);
+    opt_portfolio_result_destroy(&r);
+    tsp_instance_destroy(inst);
+}
+
+TEST(portfolio_time_budget) {
+    TSPInstance *inst = tsp_create_random(N_CITIES, 13);
+    ASSERT_NOT_NULL(inst);
+    TSPPortfolio p;
+    tsp_portfolio(&p, inst);
+
+    OptPortfolioConfig cfg = opt_portfolio_default_config();
+    cfg.round_evaluations = 0;
+    cfg.time_limit_ms = 200.0;
+    cfg.num_threads = 2;
+    OptPortfolioResult r = opt_portfolio_run(&cfg, p.arms, 3);   // SA, TS, ILS
+    // Execucoes que estouram a fatia podem esgotar o orcamento antes da
+    // ultima rodada (ex.: sob sanitizers): as rodadas restantes sao puladas
+    ASSERT_TRUE(r.num_rounds >= 1 && r.num_rounds <= 3);
+    if (r.num_rounds == 3) ASSERT_EQ(r.survivors, 1);
+    ASSERT_TRUE(r.elapsed_time_ms < 2000.0);
+    ASSERT_TRUE(r.total_evaluations > 0);
+    ASSERT_TRUE(tsp_is_valid_tour((const int*)r.best.best.data, N_CITIES));
+
+    opt_portfolio_result_destroy(&r);
+    tsp_instance_destroy(inst);
+}
+
+// ============================================================================
+// MAIN
+// ============================================================================
+
+int main(void) {
+    printf("=== Testes Portfolio (racing) ===\n\n");
+
+    printf("[Configuracao]\n");
+    RUN_TEST(portfolio_default_config_values);
+
+    printf("\n[Corrida]\n");
+    RUN_TEST(portfolio_halving_reallocates_cores);
+    RUN_TEST(portfolio_tsp_halving);
+    RUN_TEST(portfolio_threads_deterministic);
+    RUN_TEST(portfolio_frace_drops_dominated);
+    RUN_TEST(portfolio_time_budget);
+
+    printf("\n=== Todos os 6 testes passaram! ===\n");
+    return 0;
+}
@@ -28,6 +28,7 @@ TEST(pso_default_config_values) {
     ASSERT_EQ(cfg.inertia_type, PSO_INERTIA_LINEAR_DECREASING);
     ASSERT_EQ(cfg.direction, OPT_MINIMIZE);
     ASSERT_EQ(cfg.seed, 42);
+    ASSERT_EQ(cfg.num_threads, 0);
 }
 
 // ============================================================================
@@ -249,6 +250,102 @@ TEST(pso_single_particle) {
     continuous_instance_destroy(inst);
 }
 
+// ============================================================================
+// TESTES: MOTOR DE ALTO THROUGHPUT
+// ============================================================================
+
+TEST(pso_parallel_sphere_blocks) {
+    // D > PSO_BLOCK exercita a atualizacao em varios blocos
+    ContinuousInstance *inst = continuous_create_sphere(300);
+    ASSERT_NOT_NULL(inst);
+
+    PSOConfig cfg = pso_default_config();
+    cfg.num_particles = 40;
+    cfg.max_iterations = 300;
+    cfg.lower_bound = inst->lower_bound;
+    cfg.upper_bound = inst->upper_bound;
+    cfg.num_threads = 2;
+
+    OptResult result = pso_run_parallel(&cfg, inst->dimensions,
+                                        continuous_evaluate, inst);
+
+    ASSERT_NOT_NULL(result.best.data);
+    ASSERT_EQ(result.num_iterations, 300);
+    ASSERT_EQ(result.num_evaluations, 40 * 301);
+    ASSERT_NEAR(result.best.cost, continuous_evaluate(result.best.data, 300, inst), 1e-9);
+    // Inicio aleatorio em [-5.12, 5.12]^300 custa ~2600
+    ASSERT_TRUE(result.best.cost < 1000.0);
+    for (size_t i = 0; i < 300; i++) {
+        double x = ((const double*)result.best.data)[i];
+        ASSERT_TRUE(x >= cfg.lower_bound && x <= cfg.upper_bound);
+    }
+    for (size_t i = 1; i < result.num_iterations; i++) {
+        ASSERT_TRUE(result.convergence[i] <= result.convergence[i - 1] + 1e-12);
+    }
+
+    opt_result_destroy(&result);
+    continuous_instance_destroy(inst);
+}
+
+TEST(pso_batch_objective_synchronous) {
+    ContinuousInstance *inst = continuous_create_sphere(6);
+    ASSERT_NOT_NULL(inst);
+
+    PSOConfig cfg = pso_default_config();
+    cfg.num_particles = 20;
+    cfg.max_iterations = 80;
+    cfg.lower_bound = inst->lower_bound;
+    cfg.upper_bound = inst->upper_bound;
+
+    // Sem lote: gbest assincrono; com lote: gbest sincrono, mesma contagem
+    OptResult async = pso_run(&cfg, inst->dimensions, continuous_evaluate, inst);
+    cfg.batch_objective = continuous_evaluate_batch;
+    OptResult sync = pso_run(&cfg, inst->dimensions, continuous_evaluate, inst);
+
+    ASSERT_EQ(async.num_evaluations, (size_t)(20 * 81));
+    ASSERT_EQ(sync.num_evaluations, async.num_evaluations);
+    ASSERT_TRUE(sync.best.cost < 1.0);
+    ASSERT_TRUE(async.best.cost != sync.best.cost);
+
+    opt_result_destroy(&async);
+    opt_result_destroy(&sync);
+    continuous_instance_destroy(inst);
+}
+
+TEST(pso_parallel_threads_deterministic) {
+    ContinuousInstance *inst = continuous_create_rastrigin(20);
+    ASSERT_NOT_NULL(inst);
+
+    PSOConfig cfg = pso_default_config();
+    cfg.num_particles = 64;
+    cfg.max_iterations = 100;
+    cfg.lower_bound = inst->lower_bound;
+    cfg.upper_bound = inst->upper_bound;
+    cfg.inertia_type = PSO_INERTIA_CONSTRICTION;
+    cfg.c1 = 2.05;
+    cfg.c2 = 2.05;
+
+    cfg.num_threads = 1;
+    OptResult serial = pso_run_parallel(&cfg, inst->dimensions, continuous_evaluate, inst);
+    cfg.num_threads = 4;
+    OptResult parallel = pso_run_parallel(&cfg, inst->dimensions, continuous_evaluate, inst);
+    cfg.batch_objective = continuous_evaluate_batch;
+    OptResult batch = pso_run_parallel(&cfg, inst->dimensions, continuous_evaluate, inst);
+
+    ASSERT_NEAR(serial.best.cost, parallel.best.cost, 1e-12);
+    ASSERT_NEAR(serial.best.cost, batch.best.cost, 1e-9);
+    ASSERT_EQ(serial.num_evaluations, parallel.num_evaluations);
+    for (size_t i = 0; i < 20; i++) {
+        ASSERT_NEAR(((const double*)serial.best.data)[i],
+                    ((const double*)parallel.best.data)[i], 1e-12);
+    }
+
+    opt_result_destroy(&serial);
+    opt_result_destroy(&parallel);
+    opt_result_destroy(&batch);
+    continuous_instance_destroy(inst);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -277,7 +374,12 @@ int main(void) {
     RUN_TEST(pso_zero_iterations);
     RUN_TEST(pso_convergence_monotonic);
     RUN_TEST(pso_single_particle);
+    RUN_TEST(pso_batch_objective_synchronous);
+
+    printf("\n[Alto Throughput]\n");
+    RUN_TEST(pso_parallel_sphere_blocks);
+    RUN_TEST(pso_parallel_threads_deterministic);
 
-    printf("\n=== Todos os 10 testes passaram! ===\n");
+    printf("\n=== Todos os 13 testes passaram! ===\n");
     return 0;
 }
@@ -15,6 +15,7 @@
 #include "optimization/benchmarks/continuous.h"
 #include <math.h>
 #include <float.h>
+#include <string.h>
 
 // ============================================================================
 // TESTES: CONFIGURACAO
@@ -30,7 +31,9 @@ TEST(sa_default_config_values) {
     ASSERT_EQ(cfg.markov_chain_length, (size_t)50);
     ASSERT_FALSE(cfg.enable_reheating);
     ASSERT_FALSE(cfg.auto_calibrate_t0);
+    ASSERT_EQ(cfg.num_replicas, (size_t)1);
     ASSERT_EQ((int)cfg.direction, (int)OPT_MINIMIZE);
+    ASSERT_NULL(cfg.rng);
 }
 
 // ============================================================================
@@ -90,6 +93,28 @@ TEST(sa_geometric_tsp_10) {
     tsp_instance_destroy(inst);
 }
 
+TEST(sa_geometric_tsp_move_delta) {
+    TSPInstance *inst = tsp_create_random(60, 8);
+    ASSERT_NOT_NULL(inst);
+
+    SAConfig cfg = sa_default_config();
+    cfg.max_iterations = 20000;
+    cfg.initial_temp = 50.0;
+    cfg.auto_calibrate_t0 = true;
+    cfg.move_delta = tsp_move_or_opt;
+    cfg.move_apply = tsp_move_apply;
+
+    OptResult result = sa_run(&cfg, sizeof(int) * 60, 60,
+                              tsp_tour_cost, NULL, tsp_generate_random, inst);
+
+    ASSERT_TRUE(tsp_is_valid_tour((const int*)result.best.data, 60));
+    ASSERT_NEAR(result.best.cost, tsp_tour_cost(result.best.data, 60, inst), 1e-9);
+    ASSERT_TRUE(result.best.cost < result.convergence[0]);
+
+    opt_result_destroy(&result);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // TESTES: GEOMETRIC COOLING - CONTINUOUS
 // ============================================================================
@@ -380,6 +405,229 @@ TEST(sa_convergence_recorded) {
     continuous_instance_destroy(inst);
 }
 
+// ============================================================================
+// TESTES: PARALLEL TEMPERING
+// ============================================================================
+
+TEST(sa_tempering_schwefel) {
+    ContinuousInstance *inst = continuous_create_schwefel(10);
+    ASSERT_NOT_NULL(inst);
+
+    // Mesmo orcamento de avaliacoes: 40000 passos de 1 cadeia vs 8 x 5000
+    SAConfig sa_cfg = sa_default_config();
+    sa_cfg.max_iterations = 40000;
+    sa_cfg.markov_chain_length = 20;
+    sa_cfg.alpha = 0.995;
+    sa_cfg.auto_calibrate_t0 = true;
+
+    SAConfig pt_cfg = sa_cfg;
+    pt_cfg.num_replicas = 8;
+    pt_cfg.max_iterations = 5000;
+
+    double sa_sum = 0.0, pt_sum = 0.0;
+    for (unsigned seed = 1; seed <= 4; seed++) {
+        sa_cfg.seed = seed;
+        pt_cfg.seed = seed;
+        OptResult sa = sa_run(&sa_cfg, sizeof(double) * 10, 10, continuous_evaluate,
+                              continuous_neighbor_gaussian, continuous_generate_random, inst);
+        OptResult pt = sa_run(&pt_cfg, sizeof(double) * 10, 10, continuous_evaluate,
+                              continuous_neighbor_gaussian, continuous_generate_random, inst);
+        ASSERT_EQ(pt.num_iterations, (size_t)5000);
+        ASSERT_EQ(pt.num_evaluations, (size_t)(8 * 5000 + 8));
+        ASSERT_NEAR(pt.convergence[4999], pt.best.cost, 1e-9);
+        sa_sum += sa.best.cost;
+        pt_sum += pt.best.cost;
+        opt_result_destroy(&sa);
+        opt_result_destroy(&pt);
+    }
+    ASSERT_LT(pt_sum, sa_sum);
+
+    continuous_instance_destroy(inst);
+}
+
+TEST(sa_tempering_threads_deterministic) {
+    TSPInstance *inst = tsp_create_random(30, 11);
+    ASSERT_NOT_NULL(inst);
+
+    SAConfig cfg = sa_default_config();
+    cfg.num_replicas = 6;
+    cfg.max_iterations = 3000;
+    cfg.markov_chain_length = 25;
+    cfg.auto_calibrate_t0 = true;
+    cfg.num_threads = 1;
+
+    OptResult serial = sa_run(&cfg, sizeof(int) * 30, 30, tsp_tour_cost,
+                              tsp_neighbor_2opt, tsp_generate_random, inst);
+    cfg.num_threads = 0;
+    OptResult parallel = sa_run(&cfg, sizeof(int) * 30, 30, tsp_tour_cost,
+                                tsp_neighbor_2opt, tsp_generate_random, inst);
+
+    ASSERT_NEAR(serial.best.cost, parallel.best.cost, 1e-12);
+    ASSERT_EQ(memcmp(serial.best.data, parallel.best.data, sizeof(int) * 30), 0);
+    ASSERT_NEAR(tsp_tour_cost(serial.best.data, 30, inst), serial.best.cost, 1e-9);
+    for (size_t i = 1; i < serial.num_iterations; i++) {
+        ASSERT_TRUE(serial.convergence[i] <= serial.convergence[i - 1] + 1e-12);
+    }
+
+    // Movimentos por delta tambem funcionam nas replicas
+    cfg.move_delta = tsp_move_2opt;
+    cfg.move_apply = tsp_move_apply;
+    OptResult moves = sa_run(&cfg, sizeof(int) * 30, 30, tsp_tour_cost,
+                             tsp_neighbor_2opt, tsp_generate_random, inst);
+    ASSERT_NEAR(tsp_tour_cost(moves.best.data, 30, inst), moves.best.cost, 1e-9);
+
+    opt_result_destroy(&serial);
+    opt_result_destroy(&parallel);
+    opt_result_destroy(&moves);
+    tsp_instance_destroy(inst);
+}
+
+// ============================================================================
+// TESTES: STREAM RNG DA CONFIG
+// ============================================================================
+
+TEST(sa_config_rng_stream) {
+    ContinuousInstance *inst = continuous_create_sphere(5);
+    ASSERT_NOT_NULL(inst);
+
+    SAConfig cfg = sa_default_config();
+    cfg.max_iterations = 2000;
+    OptRng stream;
+    cfg.rng = &stream;
+
+    double costs[2];
+    for (int run = 0; run < 2; run++) {
+        opt_rng_seed(&stream, 2024);
+        OptResult result = sa_run(&cfg, sizeof(double) * 5, 5,
+                                  continuous_evaluate,
+                                  continuous_neighbor_gaussian,
+                                  continuous_generate_random,
+                                  inst);
+        costs[run] = result.best.cost;
+        opt_result_destroy(&result);
+    }
+    ASSERT_NEAR(costs[0], costs[1], 1e-12);
+
+    continuous_instance_destroy(inst);
+}
+
+// ============================================================================
+// TESTES: CRITERIOS DE PARADA
+// ============================================================================
+
+TEST(sa_stop_evaluation_budget) {
+    ContinuousInstance *inst = continuous_create_sphere(5);
+    ASSERT_NOT_NULL(inst);
+
+    SAConfig cfg = sa_default_config();
+    cfg.max_iterations = 100000;
+    cfg.final_temp = 1e-12;
+    cfg.stop.max_evaluations = 1500;
+    OptResult r = sa_run(&cfg, sizeof(double) * 5, 5,
+                         continuous_evaluate, continuous_neighbor_gaussian,
+                         continuous_generate_random, inst);
+    ASSERT_EQ(r.num_evaluations, (size_t)1500);
+    ASSERT_EQ(r.num_iterations, (size_t)1499);
+    opt_result_destroy(&r);
+
+    // Parallel tempering: para no fim da rodada que estoura o orcamento
+    cfg.num_replicas = 4;
+    cfg.markov_chain_length = 10;
+    cfg.stop.max_evaluations = 400;
+    r = sa_run(&cfg, sizeof(double) * 5, 5,
+               continuous_evaluate, continuous_neighbor_gaussian,
+               continuous_generate_random, inst);
+    ASSERT_TRUE(r.num_evaluations >= 400 && r.num_evaluations < 400 + 4 * 10);
+    ASSERT_EQ(r.num_iterations % 10, (size_t)0);
+    ASSERT_TRUE(r.num_iterations < 100000);
+    opt_result_destroy(&r);
+
+    continuous_instance_destroy(inst);
+}
+
+TEST(sa_stop_time_and_target) {
+    TSPInstance *inst = tsp_create_random(30, 4);
+    ASSERT_NOT_NULL(inst);
+
+    SAConfig cfg = sa_default_config();
+    cfg.max_iterations = 2000000;
+    cfg.final_temp = 0.0;
+    cfg.cooling = SA_COOLING_LOGARITHMIC;   // T nunca chega a final_temp
+    cfg.stop.time_limit_ms = 20.0;
+    double t0 = opt_monotonic_time_ms();
+    OptResult r = sa_run(&cfg, sizeof(int) * 30, 30, tsp_tour_cost, tsp_neighbor_2opt,
+                         tsp_generate_random, inst);
+    double elapsed = opt_monotonic_time_ms() - t0;
+    ASSERT_TRUE(elapsed >= 20.0);
+    ASSERT_TRUE(elapsed < 2000.0);
+    ASSERT_GT(r.num_iterations, (size_t)0);
+    ASSERT_TRUE(r.num_iterations < 2000000);
+    double first_cost = r.convergence[0];
+    opt_result_destroy(&r);
+
+    // Alvo logo abaixo do custo inicial: para muito antes de max_iterations
+    cfg = sa_default_config();
+    cfg.max_iterations = 50000;
+    cfg.stop.use_target = true;
+    cfg.stop.target_cost = first_cost * 0.9;
+    r = sa_run(&cfg, sizeof(int) * 30, 30, tsp_tour_cost, tsp_neighbor_2opt,
+               tsp_generate_random, inst);
+    ASSERT_TRUE(r.best.cost <= cfg.stop.target_cost);
+    ASSERT_TRUE(r.num_iterations < 50000);
+    opt_result_destroy(&r);
+
+    tsp_instance_destroy(inst);
+}
+
+// ============================================================================
+// TESTES: PROGRESSO
+// ============================================================================
+
+typedef struct {
+    size_t calls;
+    size_t last_iteration;
+} SAProgressLog;
+
+static void sa_log_progress(const OptProgress *p, void *user_data) {
+    SAProgressLog *log = (SAProgressLog*)user_data;
+    log->calls++;
+    log->last_iteration = p->iteration;
+}
+
+TEST(sa_trace_ring_matches_full) {
+    TSPInstance *inst = tsp_create_random(20, 6);
+    ASSERT_NOT_NULL(inst);
+
+    SAConfig cfg = sa_default_config();
+    cfg.max_iterations = 5000;
+    OptResult full = sa_run(&cfg, sizeof(int) * 20, 20, tsp_tour_cost, tsp_neighbor_2opt,
+                            tsp_generate_random, inst);
+
+    SAProgressLog log = {0};
+    cfg.trace.mode = OPT_TRACE_RING;
+    cfg.trace.capacity = 16;
+    cfg.trace.every = 100;
+    cfg.trace.callback = sa_log_progress;
+    cfg.trace.user_data = &log;
+    OptResult ring = sa_run(&cfg, sizeof(int) * 20, 20, tsp_tour_cost, tsp_neighbor_2opt,
+                            tsp_generate_random, inst);
+
+    // Mesma trajetoria: so o armazenamento do historico muda
+    ASSERT_NEAR(ring.best.cost, full.best.cost, 1e-12);
+    ASSERT_EQ(ring.num_iterations, full.num_iterations);
+    ASSERT_EQ(log.calls, full.num_iterations / 100);
+    ASSERT_EQ(log.last_iteration, full.num_iterations - 1);
+    ASSERT_EQ(ring.convergence_size, (size_t)16);
+    for (size_t k = 0; k < ring.convergence_size; k++) {
+        size_t it = ring.convergence_iterations[k];
+        ASSERT_NEAR(ring.convergence[k], full.convergence[it], 1e-12);
+    }
+
+    opt_result_destroy(&full);
+    opt_result_destroy(&ring);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // TESTES: EDGE CASES
 // ============================================================================
@@ -443,6 +691,7 @@ int main(void) {
     printf("\n[Geometric - TSP]\n");
     RUN_TEST(sa_geometric_tsp_5);
     RUN_TEST(sa_geometric_tsp_10);
+    RUN_TEST(sa_geometric_tsp_move_delta);
 
     printf("\n[Geometric - Continuous]\n");
     RUN_TEST(sa_geometric_sphere);
@@ -470,10 +719,24 @@ int main(void) {
     printf("\n[Convergence]\n");
     RUN_TEST(sa_convergence_recorded);
 
+    printf("\n[Parallel Tempering]\n");
+    RUN_TEST(sa_tempering_schwefel);
+    RUN_TEST(sa_tempering_threads_deterministic);
+
+    printf("\n[Stream RNG]\n");
+    RUN_TEST(sa_config_rng_stream);
+
+    printf("\n[Criterios de Parada]\n");
+    RUN_TEST(sa_stop_evaluation_budget);
+    RUN_TEST(sa_stop_time_and_target);
+
+    printf("\n[Progresso]\n");
+    RUN_TEST(sa_trace_ring_matches_full);
+
     printf("\n[Edge Cases]\n");
     RUN_TEST(sa_zero_iterations);
     RUN_TEST(sa_very_low_temp);
 
-    printf("\n=== Todos os %d testes passaram! ===\n", 15);
+    printf("\n=== Todos os %d testes passaram! ===\n", 22);
     return 0;
 }
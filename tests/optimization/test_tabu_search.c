@@ -13,6 +13,7 @@
 #include <math.h>
 #include <float.h>
 #include <stdint.h>
+#include <string.h>
 
 // ============================================================================
 // TESTES: CONFIGURACAO
@@ -27,6 +28,7 @@ TEST(ts_default_config_values) {
     ASSERT_FALSE(cfg.enable_diversification);
     ASSERT_FALSE(cfg.enable_intensification);
     ASSERT_FALSE(cfg.enable_reactive_tenure);
+    ASSERT_NULL(cfg.move_attributes);
     ASSERT_EQ((int)cfg.direction, (int)OPT_MINIMIZE);
 }
 
@@ -120,6 +122,108 @@ TEST(ts_classic_tsp_10) {
     tsp_instance_destroy(inst);
 }
 
+TEST(ts_classic_tsp_move_delta) {
+    TSPInstance *inst = tsp_create_random(40, 4);
+    ASSERT_NOT_NULL(inst);
+
+    TSConfig cfg = ts_default_config();
+    cfg.max_iterations = 1500;
+    cfg.neighbors_per_iter = 30;
+    cfg.move_delta = tsp_move_2opt;
+    cfg.move_apply = tsp_move_apply;
+
+    OptResult result = ts_run(&cfg, sizeof(int) * 40, 40,
+                              tsp_tour_cost, NULL, tsp_generate_random,
+                              ts_hash_int_array, inst);
+
+    ASSERT_TRUE(tsp_is_valid_tour((const int*)result.best.data, 40));
+    ASSERT_NEAR(result.best.cost, tsp_tour_cost(result.best.data, 40, inst), 1e-9);
+    ASSERT_TRUE(result.best.cost < result.convergence[0]);
+
+    opt_result_destroy(&result);
+    tsp_instance_destroy(inst);
+}
+
+// ============================================================================
+// TESTES: TABU POR ATRIBUTOS
+// ============================================================================
+
+static bool tour_has_edge(const int *tour, size_t n, size_t u, size_t v) {
+    for (size_t p = 0; p < n; p++) {
+        size_t a = (size_t)tour[p];
+        size_t b = (size_t)tour[(p + 1) % n];
+        if ((a == u && b == v) || (a == v && b == u)) return true;
+    }
+    return false;
+}
+
+TEST(ts_attributes_tsp_edges) {
+    // Para cada tipo de movimento: arestas dropped saem do tour e added entram
+    TSPInstance *inst = tsp_create_random(12, 9);
+    MoveDeltaFn gens[3] = {tsp_move_2opt, tsp_move_swap, tsp_move_or_opt};
+    int tour[12];
+    int next[12];
+    opt_set_seed(5);
+
+    for (int g = 0; g < 3; g++) {
+        for (int rep = 0; rep < 200; rep++) {
+            tsp_generate_random(tour, 12, inst);
+            OptMove move;
+            gens[g](tour, 12, &move, inst);
+            TabuMoveAttributes attrs;
+            ts_attributes_tsp(tour, 12, &move, &attrs, inst);
+
+            memcpy(next, tour, sizeof(tour));
+            tsp_move_apply(next, 12, &move, inst);
+            for (size_t a = 0; a < attrs.num_dropped; a++) {
+                ASSERT_TRUE(attrs.dropped[a].u < attrs.dropped[a].v);
+                ASSERT_TRUE(tour_has_edge(tour, 12, attrs.dropped[a].u, attrs.dropped[a].v));
+                ASSERT_FALSE(tour_has_edge(next, 12, attrs.dropped[a].u, attrs.dropped[a].v));
+            }
+            for (size_t a = 0; a < attrs.num_added; a++) {
+                ASSERT_FALSE(tour_has_edge(tour, 12, attrs.added[a].u, attrs.added[a].v));
+                ASSERT_TRUE(tour_has_edge(next, 12, attrs.added[a].u, attrs.added[a].v));
+            }
+            ASSERT_EQ(attrs.num_added, attrs.num_dropped);
+        }
+    }
+    tsp_instance_destroy(inst);
+}
+
+TEST(ts_attribute_mode_tsp) {
+    TSPInstance *inst = tsp_create_example_10();
+    ASSERT_NOT_NULL(inst);
+
+    TSConfig cfg = ts_default_config();
+    cfg.max_iterations = 1000;
+    cfg.neighbors_per_iter = 30;
+    cfg.tabu_tenure = 3;
+    cfg.move_delta = tsp_move_2opt;
+    cfg.move_apply = tsp_move_apply;
+    cfg.move_attributes = ts_attributes_tsp;
+
+    // hash_fn nao e necessario: sem frequencia nem tenure reativo
+    OptResult result = ts_run(&cfg, sizeof(int) * 10, 10,
+                              tsp_tour_cost, NULL, tsp_generate_random,
+                              NULL, inst);
+    ASSERT_TRUE(tsp_is_valid_tour((const int*)result.best.data, 10));
+    ASSERT_NEAR(result.best.cost, 100.0, 1e-9);
+
+    // Com tenure reativo e diversificacao o hash volta a ser usado
+    cfg.enable_reactive_tenure = true;
+    cfg.enable_diversification = true;
+    cfg.max_tenure = 8;
+    OptResult full = ts_run(&cfg, sizeof(int) * 10, 10,
+                            tsp_tour_cost, NULL, tsp_generate_random,
+                            ts_hash_int_array, inst);
+    ASSERT_TRUE(tsp_is_valid_tour((const int*)full.best.data, 10));
+    ASSERT_NEAR(full.best.cost, tsp_tour_cost(full.best.data, 10, inst), 1e-9);
+
+    opt_result_destroy(&result);
+    opt_result_destroy(&full);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // TESTES: CLASSIC TS - CONTINUOUS
 // ============================================================================
@@ -272,6 +376,39 @@ TEST(ts_reactive_tenure_tsp) {
     tsp_instance_destroy(inst);
 }
 
+TEST(ts_long_tenure_tsp) {
+    // Tenure maior que o numero de iteracoes: nenhum hash expira e a
+    // memoria tabu cresce ate max_iterations entradas
+    TSPInstance *inst = tsp_create_random(30, 11);
+    ASSERT_NOT_NULL(inst);
+
+    TSConfig cfg = ts_default_config();
+    cfg.max_iterations = 3000;
+    cfg.neighbors_per_iter = 30;
+    cfg.tabu_tenure = 5000;
+
+    OptResult result = ts_run(&cfg, sizeof(int) * 30, 30,
+                              tsp_tour_cost, tsp_neighbor_2opt,
+                              tsp_generate_random, ts_hash_int_array, inst);
+    ASSERT_NOT_NULL(result.best.data);
+    ASSERT_NEAR(result.best.cost, tsp_tour_cost(result.best.data, 30, inst), 1e-9);
+
+    // Reativo partindo do tenure longo: resize encolhe a lista e expira
+    // as entradas mais antigas
+    cfg.enable_reactive_tenure = true;
+    cfg.min_tenure = 3;
+    cfg.max_tenure = 20;
+    OptResult reactive = ts_run(&cfg, sizeof(int) * 30, 30,
+                                tsp_tour_cost, tsp_neighbor_2opt,
+                                tsp_generate_random, ts_hash_int_array, inst);
+    ASSERT_NOT_NULL(reactive.best.data);
+    ASSERT_EQ(reactive.num_iterations, 3000);
+
+    opt_result_destroy(&result);
+    opt_result_destroy(&reactive);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // TESTES: NULL HASH (should use default)
 // ============================================================================
@@ -417,6 +554,11 @@ int main(void) {
     printf("\n[Classic TS - TSP]\n");
     RUN_TEST(ts_classic_tsp_5);
     RUN_TEST(ts_classic_tsp_10);
+    RUN_TEST(ts_classic_tsp_move_delta);
+
+    printf("\n[Attribute-Based Tabu]\n");
+    RUN_TEST(ts_attributes_tsp_edges);
+    RUN_TEST(ts_attribute_mode_tsp);
 
     printf("\n[Classic TS - Continuous]\n");
     RUN_TEST(ts_classic_sphere);
@@ -432,6 +574,7 @@ int main(void) {
 
     printf("\n[Reactive Tenure]\n");
     RUN_TEST(ts_reactive_tenure_tsp);
+    RUN_TEST(ts_long_tenure_tsp);
 
     printf("\n[Null Hash / Default]\n");
     RUN_TEST(ts_null_hash_fn);
@@ -445,6 +588,6 @@ int main(void) {
     printf("\n[Edge Cases]\n");
     RUN_TEST(ts_zero_iterations);
 
-    printf("\n=== Todos os %d testes passaram! ===\n", 15);
+    printf("\n=== Todos os %d testes passaram! ===\n", 19);
     return 0;
 }
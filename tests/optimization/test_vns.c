@@ -8,6 +8,7 @@
 #include "optimization/benchmarks/tsp.h"
 #include "optimization/benchmarks/continuous.h"
 #include "optimization/metaheuristics/vns.h"
+#include "data_structures/thread_pool.h"
 
 // ============================================================================
 // TESTES DE CONFIGURACAO
@@ -20,6 +21,9 @@ TEST(vns_default_config_values) {
     ASSERT_EQ(cfg.local_search_iterations, (size_t)200);
     ASSERT_EQ(cfg.local_search_neighbors, (size_t)20);
     ASSERT_EQ(cfg.variant, VNS_BASIC);
+    ASSERT_FALSE(cfg.reactive);
+    ASSERT_EQ(cfg.shake_replicas, (size_t)1);
+    ASSERT_EQ(cfg.num_threads, (size_t)1);
     ASSERT_EQ(cfg.direction, OPT_MINIMIZE);
     ASSERT_EQ(cfg.seed, (unsigned)42);
 }
@@ -72,6 +76,30 @@ TEST(vns_basic_tsp10) {
     tsp_instance_destroy(inst);
 }
 
+TEST(vns_basic_tsp_move_delta) {
+    TSPInstance *inst = tsp_create_random(40, 4);
+    ASSERT_NOT_NULL(inst);
+
+    VNSConfig cfg = vns_default_config();
+    cfg.max_iterations = 20;
+    cfg.local_search_neighbors = 40;
+    cfg.move_delta = tsp_move_2opt;
+    cfg.move_apply = tsp_move_apply;
+
+    OptResult res = vns_run(&cfg, sizeof(int), inst->n_cities,
+                            tsp_tour_cost, vns_shake_tsp,
+                            NULL, tsp_generate_random, inst);
+    ASSERT_TRUE(tsp_is_valid_tour((const int*)res.best.data, 40));
+    ASSERT_NEAR(res.best.cost, tsp_tour_cost(res.best.data, 40, inst), 1e-9);
+
+    int random_tour[40];
+    tsp_generate_random(random_tour, 40, inst);
+    ASSERT_LT(res.best.cost, tsp_tour_cost(random_tour, 40, inst));
+
+    opt_result_destroy(&res);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // BASIC VNS - CONTINUOUS
 // ============================================================================
@@ -211,6 +239,99 @@ TEST(vns_single_k) {
     tsp_instance_destroy(inst);
 }
 
+// ============================================================================
+// REATIVA, ESTATISTICAS POR K E REPLICATED SHAKING
+// ============================================================================
+
+static OptResult run_vns_tsp10(const VNSConfig *cfg, const TSPInstance *inst) {
+    return vns_run(cfg, sizeof(int), inst->n_cities, tsp_tour_cost, vns_shake_tsp,
+                   tsp_neighbor_swap, tsp_generate_random, inst);
+}
+
+TEST(vns_neighborhood_stats) {
+    TSPInstance *inst = tsp_create_example_10();
+    VNSConfig cfg = vns_default_config();
+    cfg.max_iterations = 20;
+    cfg.k_max = 4;
+    cfg.local_search_iterations = 50;
+    cfg.local_search_neighbors = 10;
+
+    OptResult res = run_vns_tsp10(&cfg, inst);
+    ASSERT_NOT_NULL(res.operator_stats);
+    ASSERT_EQ(res.num_operators, (size_t)4);
+
+    // Cada iteracao termina com uma varredura sem melhoria em 1..k_max
+    size_t calls = 0;
+    for (size_t k = 0; k < 4; k++) {
+        const OptOperatorStats *st = &res.operator_stats[k];
+        ASSERT_TRUE(st->calls >= cfg.max_iterations);
+        ASSERT_TRUE(st->improvements <= st->calls);
+        ASSERT_TRUE(st->new_best <= st->improvements);
+        ASSERT_EQ(st->accepted, st->improvements);
+        ASSERT_TRUE(st->total_time_ms >= 0.0);
+        ASSERT_NEAR(st->weight, 0.25, 1e-12);
+        calls += st->calls;
+    }
+    ASSERT_TRUE(res.num_evaluations > calls);
+
+    opt_result_destroy(&res);
+    tsp_instance_destroy(inst);
+}
+
+TEST(vns_reactive_tsp10) {
+    TSPInstance *inst = tsp_create_example_10();
+    VNSConfig cfg = vns_default_config();
+    cfg.max_iterations = 30;
+    cfg.k_max = 5;
+    cfg.local_search_iterations = 50;
+    cfg.local_search_neighbors = 10;
+    cfg.reactive = true;
+
+    OptResult res = run_vns_tsp10(&cfg, inst);
+    ASSERT_TRUE(tsp_is_valid_tour(res.best.data, inst->n_cities));
+    ASSERT_NEAR(res.best.cost, tsp_tour_cost(res.best.data, inst->n_cities, inst), 1e-9);
+    ASSERT_EQ(res.num_iterations, cfg.max_iterations);
+
+    double total = 0.0;
+    size_t calls = 0;
+    for (size_t k = 0; k < 5; k++) {
+        ASSERT_TRUE(res.operator_stats[k].weight > 0.0);
+        total += res.operator_stats[k].weight;
+        calls += res.operator_stats[k].calls;
+    }
+    ASSERT_NEAR(total, 1.0, 1e-9);
+    ASSERT_TRUE(calls >= cfg.max_iterations * 5);
+
+    opt_result_destroy(&res);
+    tsp_instance_destroy(inst);
+}
+
+TEST(vns_replicated_shaking_invariant) {
+    TSPInstance *inst = tsp_create_example_10();
+    VNSConfig cfg = vns_default_config();
+    cfg.max_iterations = 15;
+    cfg.k_max = 3;
+    cfg.local_search_iterations = 50;
+    cfg.local_search_neighbors = 10;
+    cfg.shake_replicas = 4;
+
+    OptResult serial = run_vns_tsp10(&cfg, inst);
+    cfg.num_threads = 0;
+    ds_set_num_threads(4);
+    OptResult parallel = run_vns_tsp10(&cfg, inst);
+    ds_set_num_threads(0);
+
+    ASSERT_NEAR(serial.best.cost, parallel.best.cost, 1e-12);
+    ASSERT_EQ(serial.num_evaluations, parallel.num_evaluations);
+    ASSERT_TRUE(tsp_is_valid_tour(parallel.best.data, inst->n_cities));
+    ASSERT_NEAR(parallel.best.cost,
+                tsp_tour_cost(parallel.best.data, inst->n_cities, inst), 1e-9);
+
+    opt_result_destroy(&serial);
+    opt_result_destroy(&parallel);
+    tsp_instance_destroy(inst);
+}
+
 // ============================================================================
 // MAIN
 // ============================================================================
@@ -224,6 +345,7 @@ int main(void) {
     printf("\n[Basic VNS - TSP]\n");
     RUN_TEST(vns_basic_tsp5);
     RUN_TEST(vns_basic_tsp10);
+    RUN_TEST(vns_basic_tsp_move_delta);
 
     printf("\n[Basic VNS - Continuous]\n");
     RUN_TEST(vns_basic_sphere5);
@@ -239,6 +361,11 @@ int main(void) {
     RUN_TEST(vns_convergence_monotonic);
     RUN_TEST(vns_single_k);
 
-    printf("\n=== Todos os 10 testes passaram! ===\n");
+    printf("\n[Reativa e Replicated Shaking]\n");
+    RUN_TEST(vns_neighborhood_stats);
+    RUN_TEST(vns_reactive_tsp10);
+    RUN_TEST(vns_replicated_shaking_invariant);
+
+    printf("\n=== Todos os 13 testes passaram! ===\n");
     return 0;
 }